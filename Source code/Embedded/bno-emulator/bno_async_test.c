@@ -0,0 +1,259 @@
+/*
+ * bno_async_test.c
+ *
+ * Runs the background report read (bno_async.c) against a simulated TWI peripheral: INTN starting a read and its
+ * completion handing the report over, a busy bus, a NACK in the middle of a transfer, and async reads being turned
+ * off while a read is in flight. The exit status is non-zero if any check failed.
+ */
+
+#include "bno_async.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int failures_ = 0;
+
+/// The simulated peripheral: at most one transfer in flight, ended by complete() or by the main loop's wait.
+static bool busBusy_ = false;
+static bool inFlight_ = false;
+static int starts_ = 0;
+static int waits_ = 0;
+static uint8_t hubReport_[BNO070_MAX_INPUT_REPORT_LEN];
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+static void check(bool ok, const char *what, int line)
+{
+	if (!ok)
+	{
+		failures_++;
+		printf("    FAILED at line %d: %s\n", line, what);
+	}
+}
+
+static bool startRead(bno_async_t *async)
+{
+	if (busBusy_ || inFlight_)
+	{
+		return false;
+	}
+	starts_++;
+	inFlight_ = true;
+	return true;
+}
+
+/// The TWI interrupt at the end of the transfer. A prefixed read stops at the length in the header, like twim.
+static void complete(bno_async_t *async, bool ok, uint32_t time)
+{
+	int length = sizeof(async->report);
+	if (async->prefixed)
+	{
+		int size = hubReport_[0] | (hubReport_[1] << 8);
+		length = (size < 2) ? 2 : (size < length) ? size : length;
+	}
+	if (ok)
+	{
+		memcpy(async->report, hubReport_, length);
+	}
+	else
+	{
+		// NACKed part way: whatever got into the buffer is garbage
+		memcpy(async->report, hubReport_, length / 2);
+	}
+	inFlight_ = false;
+	bno_async_readDone(async, ok, time);
+}
+
+static void waitForInterrupt(bno_async_t *async)
+{
+	waits_++;
+	if (inFlight_)
+	{
+		complete(async, true, 900);
+	}
+}
+
+static const bno_async_twi_t twi_ = { startRead, waitForInterrupt };
+
+static void setUp(bno_async_t *async, bool prefixed)
+{
+	busBusy_ = false;
+	inFlight_ = false;
+	starts_ = 0;
+	waits_ = 0;
+	bno_async_init(async, &twi_, NULL, prefixed);
+	bno_async_enable(async, true);
+}
+
+/// A rotation vector report of `length` bytes, with the bytes after it poisoned.
+static void setHubReport(uint8_t length, uint8_t seed)
+{
+	memset(hubReport_, 0xA5, sizeof(hubReport_));
+	hubReport_[0] = length;
+	hubReport_[1] = 0;
+	for (int i = 2; i < length; i++)
+	{
+		hubReport_[i] = (uint8_t)(seed + i);
+	}
+}
+
+static void handover(void)
+{
+	bno_async_t async;
+	uint8_t data[BNO070_MAX_INPUT_REPORT_LEN];
+	uint32_t intnTime = 0;
+	uint32_t doneTime = 0;
+
+	setUp(&async, false);
+	setHubReport(14, 0x10);
+	CHECK(!bno_async_pending(&async));
+
+	CHECK(bno_async_intn(&async, 100));
+	CHECK(async.state == BNO_ASYNC_READING && starts_ == 1);
+	CHECK(bno_async_pending(&async));
+
+	// a second edge while the read is in flight is left to polling, and does not start another transfer
+	CHECK(!bno_async_intn(&async, 150));
+	CHECK(starts_ == 1);
+
+	complete(&async, true, 350);
+	CHECK(async.state == BNO_ASYNC_READY && bno_async_pending(&async));
+
+	// still waiting to be taken: INTN does not overwrite it
+	CHECK(!bno_async_intn(&async, 400));
+	CHECK(starts_ == 1);
+
+	memset(data, 0xFF, sizeof(data));
+	CHECK(bno_async_take(&async, data, sizeof(data), &intnTime, &doneTime));
+	CHECK(!memcmp(data, hubReport_, sizeof(data)));
+	CHECK(intnTime == 100 && doneTime == 350);
+	CHECK(async.state == BNO_ASYNC_IDLE && !bno_async_pending(&async));
+	CHECK(waits_ == 0);
+
+	// taken once only
+	CHECK(!bno_async_take(&async, data, sizeof(data), &intnTime, &doneTime));
+
+	// the next edge starts the next read
+	CHECK(bno_async_intn(&async, 500));
+	CHECK(starts_ == 2);
+}
+
+static void prefixedReads(void)
+{
+	bno_async_t async;
+	uint8_t data[BNO070_MAX_INPUT_REPORT_LEN + 4];
+	uint32_t intnTime, doneTime;
+
+	// only the bytes the header gives are handed over, the rest of the caller's buffer is cleared
+	setUp(&async, true);
+	setHubReport(14, 0x20);
+	CHECK(bno_async_intn(&async, 100));
+	complete(&async, true, 200);
+	memset(data, 0xFF, sizeof(data));
+	CHECK(bno_async_take(&async, data, sizeof(data), &intnTime, &doneTime));
+	CHECK(!memcmp(data, hubReport_, 14));
+	CHECK(data[14] == 0 && data[17] == 0 && data[sizeof(data) - 1] == 0);
+
+	// an empty report still brings its 2-byte header
+	setHubReport(0, 0);
+	CHECK(bno_async_intn(&async, 300));
+	complete(&async, true, 400);
+	memset(data, 0xFF, sizeof(data));
+	CHECK(bno_async_take(&async, data, BNO070_MAX_INPUT_REPORT_LEN, &intnTime, &doneTime));
+	CHECK(data[0] == 0 && data[1] == 0 && data[2] == 0 && data[BNO070_MAX_INPUT_REPORT_LEN - 1] == 0);
+	CHECK(data[BNO070_MAX_INPUT_REPORT_LEN] == 0xFF);
+}
+
+static void busBusy(void)
+{
+	bno_async_t async;
+	uint8_t data[BNO070_MAX_INPUT_REPORT_LEN];
+	uint32_t intnTime, doneTime;
+
+	// a transfer the main loop owns, or a STOP still on the bus: no read, and no waiting for the bus
+	setUp(&async, false);
+	busBusy_ = true;
+	CHECK(!bno_async_intn(&async, 100));
+	CHECK(async.state == BNO_ASYNC_IDLE && starts_ == 0);
+	CHECK(!bno_async_take(&async, data, sizeof(data), &intnTime, &doneTime));
+
+	busBusy_ = false;
+	CHECK(bno_async_intn(&async, 200));
+}
+
+static void nack(void)
+{
+	bno_async_t async;
+	uint8_t data[BNO070_MAX_INPUT_REPORT_LEN];
+	uint32_t intnTime, doneTime;
+
+	setUp(&async, true);
+	setHubReport(18, 0x30);
+	CHECK(bno_async_intn(&async, 100));
+	complete(&async, false, 200);
+
+	// nothing is handed over, so the sensorhub library reads the report itself
+	CHECK(async.state == BNO_ASYNC_IDLE && !bno_async_pending(&async));
+	CHECK(!bno_async_take(&async, data, sizeof(data), &intnTime, &doneTime));
+
+	// and the next edge reads in the background again
+	CHECK(bno_async_intn(&async, 300));
+	complete(&async, true, 400);
+	CHECK(bno_async_take(&async, data, sizeof(data), &intnTime, &doneTime));
+	CHECK(intnTime == 300 && doneTime == 400 && !memcmp(data, hubReport_, sizeof(data)));
+}
+
+static void disableInFlight(void)
+{
+	bno_async_t async;
+	uint8_t data[BNO070_MAX_INPUT_REPORT_LEN];
+	uint32_t intnTime, doneTime;
+
+	setUp(&async, false);
+	setHubReport(18, 0x40);
+	CHECK(bno_async_intn(&async, 100));
+
+	// disabling waits for the transfer to end instead of leaving the TWI interrupt writing into the buffer
+	bno_async_enable(&async, false);
+	CHECK(waits_ == 1 && !inFlight_);
+	CHECK(!async.enabled && async.state == BNO_ASYNC_READY);
+
+	// no new reads while disabled
+	CHECK(!bno_async_intn(&async, 1000));
+	CHECK(starts_ == 1);
+
+	// the report it fetched is still handed over
+	CHECK(bno_async_take(&async, data, sizeof(data), &intnTime, &doneTime));
+	CHECK(intnTime == 100 && doneTime == 900 && !memcmp(data, hubReport_, sizeof(data)));
+	CHECK(!bno_async_intn(&async, 1100));
+
+	bno_async_enable(&async, true);
+	CHECK(bno_async_intn(&async, 1200));
+	CHECK(starts_ == 2);
+
+	// a take while the read is in flight waits for it too
+	CHECK(bno_async_take(&async, data, sizeof(data), &intnTime, &doneTime));
+	CHECK(waits_ == 2 && intnTime == 1200 && doneTime == 900);
+}
+
+int main(void)
+{
+	printf("INTN to report handover\n");
+	handover();
+	printf("length-prefixed reads\n");
+	prefixedReads();
+	printf("busy bus\n");
+	busBusy();
+	printf("NACK mid-transfer\n");
+	nack();
+	printf("disable with a read in flight\n");
+	disableInFlight();
+
+	if (failures_)
+	{
+		printf("%d checks FAILED\n", failures_);
+		return 1;
+	}
+	printf("all checks passed\n");
+	return 0;
+}
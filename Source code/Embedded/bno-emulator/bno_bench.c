@@ -0,0 +1,671 @@
+/*
+ * bno_bench.c
+ *
+ * Runs the sensorhub library against the BNO070 emulator: probe, product ID, FRS, feature reports, streaming, hub
+ * resets, DCD saves and every DFU path. Each scenario checks its results and prints what it cost on the bus; the
+ * exit status is non-zero if any check failed.
+ *
+ * Usage: bno-bench [-v] [-s seconds] [-c file]   -v shows the library's debug output, -s sets how long each stream
+ * runs, -c records the reports of the first stream in a capture file for bno-replay.
+ */
+
+#include "bno_emulator.h"
+#include "capture_file.h"
+#include "sensorhub.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DFU_APPLICATION_SIZE 20000
+#define DFU_PAYLOAD_SIZE 30
+
+static bnoemu_t emu_;
+static sensorhub_t sh_;
+static sensorhub_stats_t shStats_;
+static bool verbose_ = false;
+static uint32_t streamSeconds_ = 2;
+static int failures_ = 0;
+static int lastError_ = 0;
+static uint32_t dfuWritten_ = 0;
+static const char *capturePath_ = NULL;
+static FILE *capture_ = NULL;
+
+typedef struct
+{
+	bnoemu_stats_t emu;
+	sensorhub_stats_t sh;
+	uint64_t us;
+} snapshot_t;
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+static void check(bool ok, const char *what, int line)
+{
+	if (!ok)
+	{
+		failures_++;
+		printf("    FAILED at line %d: %s\n", line, what);
+	}
+}
+
+static void onError(const sensorhub_t *sh, int err) { lastError_ = err; }
+static void debugPrintf(const char *format, ...)
+{
+	if (verbose_)
+	{
+		va_list args;
+		va_start(args, format);
+		vprintf(format, args);
+		va_end(args);
+	}
+}
+
+static void dfuProgress(const sensorhub_t *sh, uint32_t written, uint32_t total) { dfuWritten_ = written; }
+/// Far addresses are offsets into the memory given to bnoemu_setFarMemory().
+uint32_t dfuAddr(uint32_t index) { return index; }
+static uint32_t farAddress(uint32_t index) { return index; }
+static void setUp(uint32_t busHz)
+{
+	bnoemu_init(&emu_);
+	emu_.busHz = busHz;
+	memset(&sh_, 0, sizeof(sh_));
+	memset(&shStats_, 0, sizeof(shStats_));
+	sh_.stats = &shStats_;
+	sh_.onError = onError;
+	sh_.debugPrintf = debugPrintf;
+	sh_.max_retries = 5;
+	bnoemu_attach(&emu_, &sh_);
+	lastError_ = 0;
+}
+
+static void mark(snapshot_t *snapshot)
+{
+	snapshot->emu = emu_.stats;
+	snapshot->sh = shStats_;
+	snapshot->us = bnoemu_nowUs(&emu_);
+}
+
+/// Print the bus cost since `before`, divided over `units` of work.
+static void printCost(const char *name, const snapshot_t *before, uint32_t units, const char *unit)
+{
+	double n = units ? units : 1;
+	uint32_t transactions = emu_.stats.transactions - before->emu.transactions;
+	uint32_t bytes = emu_.stats.bytes - before->emu.bytes;
+	double busUs = (emu_.stats.busNs - before->emu.busNs) / 1000.0;
+
+	printf("  %-34s %6.2f transactions %6.1f bytes %7.1f us bus per %s  (%lu %ss, %.1f ms, %lu retries)\n", name,
+	       transactions / n, bytes / n, busUs / n, unit, (unsigned long)units, unit,
+	       (bnoemu_nowUs(&emu_) - before->us) / 1000.0, (unsigned long)(shStats_.i2cRetries - before->sh.i2cRetries));
+}
+
+static void probe(void)
+{
+	snapshot_t before;
+
+	setUp(400000);
+	mark(&before);
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(emu_.mode == BNOEMU_RUNNING);
+	CHECK(emu_.queueCount == 0);  // the reset indication was read
+	printCost("probe", &before, 1, "probe");
+	printf("  probe phases: reset %lu ms, HID descriptor %lu ms, first INTN %lu ms\n",
+	       (unsigned long)shStats_.probeResetMs, (unsigned long)shStats_.probeDescriptorMs,
+	       (unsigned long)shStats_.probeIntnMs);
+
+	sensorhub_ProductID_t pid;
+	mark(&before);
+	CHECK(sensorhub_getProductID(&sh_, &pid) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(pid.swPartNumber == emu_.productId.swPartNumber && pid.swBuildNumber == emu_.productId.swBuildNumber);
+	CHECK(pid.swVersionMajor == emu_.productId.swVersionMajor && pid.swVersionMinor == emu_.productId.swVersionMinor);
+	printCost("product ID", &before, 1, "request");
+
+	// the hub keeps NAKing while it boots; the handshake has to ride that out, and finish soon after it answers
+	setUp(400000);
+	emu_.bootUs = 255000;
+	mark(&before);
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(emu_.stats.naks > 0);
+	CHECK(bnoemu_nowUs(&emu_) - before.us < 10000 + emu_.bootUs + 3000);
+	printCost("probe, 255 ms boot", &before, 1, "probe");
+
+	// a hub that never answers fails the probe at its deadline
+	setUp(400000);
+	emu_.bootUs = 5000000;
+	mark(&before);
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_ERROR_I2C_IO);
+	CHECK(bnoemu_nowUs(&emu_) - before.us < 1300000);
+}
+
+static void frs(void)
+{
+	uint32_t record[41];
+	uint32_t readBack[64];
+	uint16_t length = 0;
+	snapshot_t before;
+
+	for (int i = 0; i < 41; i++)
+	{
+		record[i] = 0x01000193u * (i + 1);
+	}
+
+	setUp(400000);
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+
+	mark(&before);
+	CHECK(sensorhub_writeFRS(&sh_, SENSORHUB_FRS_SCD_ACTIVE, record, 41) == SENSORHUB_STATUS_SUCCESS);
+	const bnoemu_frs_t *stored = bnoemu_getFrs(&emu_, SENSORHUB_FRS_SCD_ACTIVE);
+	CHECK(stored && stored->length == 41 && !memcmp(stored->data, record, sizeof(record)));
+	printCost("FRS write", &before, 41, "word");
+
+	mark(&before);
+	CHECK(sensorhub_readFRS(&sh_, SENSORHUB_FRS_SCD_ACTIVE, readBack, 0, 64, &length) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(length == 41 && !memcmp(readBack, record, sizeof(record)));
+	printCost("FRS read", &before, 41, "word");
+
+	// part of a record, ending before the record does
+	CHECK(sensorhub_readFRS(&sh_, SENSORHUB_FRS_SCD_ACTIVE, readBack, 10, 8, &length) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(length == 8 && !memcmp(readBack, &record[10], 8 * sizeof(uint32_t)));
+
+	CHECK(sensorhub_readFRS(&sh_, SENSORHUB_FRS_DCD, readBack, 0, 64, &length) == SENSORHUB_STATUS_FRS_READ_EMPTY);
+	CHECK(sensorhub_readFRS(&sh_, SENSORHUB_FRS_SCD_ACTIVE, readBack, 41, 8, &length) ==
+	      SENSORHUB_STATUS_FRS_READ_OFFSET_OUT_OF_RANGE);
+
+	// a zero-length write erases the record
+	CHECK(sensorhub_writeFRS(&sh_, SENSORHUB_FRS_SCD_ACTIVE, NULL, 0) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(bnoemu_getFrs(&emu_, SENSORHUB_FRS_SCD_ACTIVE)->length == 0);
+}
+
+static void features(void)
+{
+	sensorhub_SensorFeature_t set = {0};
+	sensorhub_SensorFeature_t got;
+
+	setUp(400000);
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+
+	set.changeSensitivityEnabled = true;
+	set.changeSensitivity = 5;
+	set.reportInterval = 2500;
+	set.sensorSpecificConfiguration = 0x1234;
+	CHECK(sensorhub_setDynamicFeature(&sh_, SENSORHUB_GAME_ROTATION_VECTOR, &set) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(sensorhub_getDynamicFeature(&sh_, SENSORHUB_GAME_ROTATION_VECTOR, &got) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(got.changeSensitivityEnabled && !got.changeSensitivityRelative && got.changeSensitivity == 5);
+	CHECK(got.reportInterval == 2500 && got.sensorSpecificConfiguration == 0x1234);
+
+	// faster than the hub can go: it reports the interval it will really use
+	set.reportInterval = 100;
+	CHECK(sensorhub_setDynamicFeature(&sh_, SENSORHUB_GAME_ROTATION_VECTOR, &set) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(sensorhub_getDynamicFeature(&sh_, SENSORHUB_GAME_ROTATION_VECTOR, &got) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(got.reportInterval == emu_.minIntervalUs);
+}
+
+static int enable(sensorhub_Sensor_t sensor, uint32_t interval)
+{
+	sensorhub_SensorFeature_t feature = {0};
+	feature.reportInterval = interval;
+	return sensorhub_setDynamicFeature(&sh_, sensor, &feature);
+}
+
+/// Poll as a main loop would every loopUs; returns the events received and counts hub resets seen.
+static uint32_t pollFor(uint32_t us, uint32_t loopUs, int *resets)
+{
+	sensorhub_Event_t events[8];
+	uint32_t received = 0;
+	uint64_t end = bnoemu_nowUs(&emu_) + us;
+
+	while (bnoemu_nowUs(&emu_) < end)
+	{
+		bnoemu_advance(&emu_, loopUs);
+		int rc;
+		do
+		{
+			int count = 0;
+			rc = sensorhub_poll(&sh_, events, 8, &count);
+			received += count;
+			if (rc == SENSORHUB_STATUS_HUB_RESET && resets)
+			{
+				(*resets)++;
+			}
+			CHECK(rc >= 0);
+		} while (rc == SENSORHUB_STATUS_MORE_EVENTS_PENDING && bnoemu_nowUs(&emu_) < end);
+	}
+	return received;
+}
+
+/// takeReport hook recording each report as read, stamped with the simulated time, as the tracker's capture mode does.
+static bool captureReport(const sensorhub_t *sh, const uint8_t *report)
+{
+	bnocap_record_t record = {.timeUs = (uint32_t)bnoemu_nowUs(&emu_)};
+	memcpy(record.report, report, sizeof(record.report));
+	CHECK(bnocap_writeRecord(capture_, &record));
+	return false;
+}
+
+/// The tracker's configuration: orientation and gyro at 1 kHz and the stability detector at 10 Hz.
+static void stream(const char *name, uint32_t busHz, bool lengthPrefixed, uint32_t nakEvery)
+{
+	snapshot_t before;
+
+	setUp(busHz);
+	if (!lengthPrefixed)
+	{
+		sh_.i2cReadReport = NULL;
+	}
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(enable(SENSORHUB_GAME_ROTATION_VECTOR, 1000) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(enable(SENSORHUB_GYROSCOPE_CALIBRATED, 1000) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(enable(SENSORHUB_STABILITY_DETECTOR, 100000) == SENSORHUB_STATUS_SUCCESS);
+	bnoemu_injectNaks(&emu_, 0, nakEvery);
+
+	if (capturePath_)
+	{
+		capture_ = fopen(capturePath_, "wb");
+		CHECK(capture_ && bnocap_writeHeader(capture_));
+		sh_.takeReport = capture_ ? captureReport : NULL;
+		capturePath_ = NULL;
+	}
+
+	mark(&before);
+	uint8_t queued = emu_.queueCount;
+	uint32_t received = pollFor(streamSeconds_ * 1000000, 250, NULL);
+	if (capture_)
+	{
+		CHECK(fclose(capture_) == 0);
+		capture_ = NULL;
+	}
+
+	uint32_t samples = emu_.stats.samples - before.emu.samples;
+	CHECK(emu_.stats.dropped == before.emu.dropped);
+	CHECK(received == samples + queued - emu_.queueCount);
+	CHECK(!nakEvery || shStats_.i2cRetries > before.sh.i2cRetries);
+	printCost(name, &before, received, "sample");
+}
+
+static uint8_t takenReport_[BNO070_MAX_INPUT_REPORT_LEN];
+static int reportsTaken_ = 0;
+
+/// takeReport hook keeping the report exactly as the library handed it over.
+static bool keepReport(const sensorhub_t *sh, const uint8_t *report)
+{
+	memcpy(takenReport_, report, sizeof(takenReport_));
+	reportsTaken_++;
+	return true;
+}
+
+/// Queue one report with the given header and poll it; returns the bytes its read put on the bus.
+static uint32_t readOne(uint8_t lengthLow, uint8_t lengthHigh)
+{
+	uint8_t report[BNO070_MAX_INPUT_REPORT_LEN];
+	sensorhub_Event_t event;
+	int count = 0;
+
+	report[0] = lengthLow;
+	report[1] = lengthHigh;
+	for (int i = 2; i < (int)sizeof(report); i++)
+	{
+		report[i] = (uint8_t)(0x40 + i);
+	}
+	CHECK(bnoemu_pushReport(&emu_, report));
+	uint32_t bytes = emu_.stats.bytes;
+	memset(takenReport_, 0xFF, sizeof(takenReport_));
+	CHECK(sensorhub_poll(&sh_, &event, 1, &count) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(count == 0 && emu_.queueCount == 0);
+	return emu_.stats.bytes - bytes;
+}
+
+/// Length-prefixed reads: one transaction of the 2-byte header and the body it announces, whatever the header says.
+static void reportSizes(void)
+{
+	setUp(400000);
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(emu_.queueCount == 0);
+	sh_.takeReport = keepReport;
+
+	// a 14-byte rotation vector: address, header and body, and the rest of the buffer cleared
+	sensorhub_stats_t before = shStats_;
+	uint32_t transactions = emu_.stats.transactions;
+	CHECK(readOne(14, 0) == 1 + 14);
+	CHECK(emu_.stats.transactions == transactions + 1);
+	CHECK(reportsTaken_ == 1 && takenReport_[0] == 14 && takenReport_[1] == 0 && takenReport_[13] == 0x40 + 13);
+	CHECK(takenReport_[14] == 0 && takenReport_[BNO070_MAX_INPUT_REPORT_LEN - 1] == 0);
+	CHECK(shStats_.reportBytesRead - before.reportBytesRead == 14);
+	CHECK(shStats_.reportBytesSaved - before.reportBytesSaved == BNO070_MAX_INPUT_REPORT_LEN - 14);
+
+	// lengths under 2 still cost the header, and nothing after it is left over
+	before = shStats_;
+	CHECK(readOne(1, 0) == 1 + 2);
+	CHECK(reportsTaken_ == 2 && takenReport_[0] == 1 && takenReport_[1] == 0 && takenReport_[2] == 0);
+	CHECK(takenReport_[BNO070_MAX_INPUT_REPORT_LEN - 1] == 0);
+	CHECK(shStats_.reportBytesRead - before.reportBytesRead == 2);
+	CHECK(shStats_.reportBytesSaved - before.reportBytesSaved == BNO070_MAX_INPUT_REPORT_LEN - 2);
+
+	// an empty report is the end of the events, not one to take
+	before = shStats_;
+	CHECK(readOne(0, 0) == 1 + 2);
+	CHECK(reportsTaken_ == 2);
+	CHECK(shStats_.reportBytesRead - before.reportBytesRead == 2);
+
+	// longer than a report can be: the read stops at the buffer, and the header reaches the library as it was
+	before = shStats_;
+	CHECK(readOne(40, 0) == 1 + BNO070_MAX_INPUT_REPORT_LEN);
+	CHECK(reportsTaken_ == 3 && takenReport_[0] == 40 && takenReport_[BNO070_MAX_INPUT_REPORT_LEN - 1] == 0x40 + 17);
+	CHECK(shStats_.reportBytesRead - before.reportBytesRead == BNO070_MAX_INPUT_REPORT_LEN);
+	CHECK(shStats_.reportBytesSaved == before.reportBytesSaved);
+
+	// the length's high byte counts too
+	CHECK(readOne(2, 1) == 1 + BNO070_MAX_INPUT_REPORT_LEN);
+	CHECK(shStats_.i2cErrors == 0);
+
+	// and decoding turns such a report down instead of reading past it
+	sh_.takeReport = NULL;
+	uint8_t tooLong[BNO070_MAX_INPUT_REPORT_LEN] = {40, 0, SENSORHUB_GAME_ROTATION_VECTOR};
+	sensorhub_Event_t event;
+	int count = 0;
+	CHECK(bnoemu_pushReport(&emu_, tooLong));
+	CHECK(sensorhub_poll(&sh_, &event, 1, &count) == SENSORHUB_STATUS_REPORT_LEN_TOO_LONG && count == 0);
+}
+
+static void hubReset(void)
+{
+	int resets = 0;
+
+	setUp(400000);
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(enable(SENSORHUB_GAME_ROTATION_VECTOR, 1000) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(pollFor(50000, 250, &resets) > 0);
+
+	uint32_t before = sensorhub_resets;
+	bnoemu_resetHub(&emu_);
+	pollFor(100000, 250, &resets);
+	CHECK(resets == 1);
+	CHECK(sensorhub_resets == before + 1);
+	CHECK(emu_.features[SENSORHUB_GAME_ROTATION_VECTOR].reportInterval == 0);
+}
+
+/// Time from the hub's reset indication to its first GRV sample when the tracker reconfigures it at once, against
+/// probing it again first as a cold start does.
+static void resetRecovery(const char *name, bool reprobe)
+{
+	sensorhub_Event_t event;
+	int count = 0;
+	int rc;
+
+	setUp(400000);
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(enable(SENSORHUB_GAME_ROTATION_VECTOR, 1000) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(enable(SENSORHUB_GYROSCOPE_CALIBRATED, 1000) == SENSORHUB_STATUS_SUCCESS);
+	pollFor(50000, 250, NULL);
+
+	bnoemu_resetHub(&emu_);
+	uint64_t deadline = bnoemu_nowUs(&emu_) + 200000;
+	do
+	{
+		bnoemu_advance(&emu_, 250);
+		rc = sensorhub_poll(&sh_, &event, 1, &count);
+	} while (rc != SENSORHUB_STATUS_HUB_RESET && bnoemu_nowUs(&emu_) < deadline);
+	CHECK(rc == SENSORHUB_STATUS_HUB_RESET);
+
+	uint64_t start = bnoemu_nowUs(&emu_);
+	if (reprobe)
+	{
+		CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+	}
+	CHECK(enable(SENSORHUB_GAME_ROTATION_VECTOR, 1000) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(enable(SENSORHUB_GYROSCOPE_CALIBRATED, 1000) == SENSORHUB_STATUS_SUCCESS);
+	bool orientation = false;
+	while (!orientation && bnoemu_nowUs(&emu_) < deadline)
+	{
+		bnoemu_advance(&emu_, 250);
+		do
+		{
+			count = 0;
+			rc = sensorhub_poll(&sh_, &event, 1, &count);
+			orientation |= count && event.sensor == SENSORHUB_GAME_ROTATION_VECTOR;
+		} while (count && !orientation);
+	}
+	CHECK(orientation);
+	printf("  %-34s %7.1f ms from reset indication to the first orientation sample\n", name,
+	       (bnoemu_nowUs(&emu_) - start) / 1000.0);
+}
+
+static void commands(void)
+{
+	setUp(400000);
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+
+	CHECK(sensorhub_calEnable(&sh_, ACCEL_CAL_EN | GYRO_CAL_EN) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(emu_.calFlags == (ACCEL_CAL_EN | GYRO_CAL_EN));
+	CHECK(sensorhub_dcdAutoSave(&sh_, false) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(!emu_.dcdAutoSave);
+
+	CHECK(sensorhub_saveDcd(&sh_) == SENSORHUB_STATUS_SUCCESS);
+	emu_.dcdSaveFailures = 1;
+	CHECK(sensorhub_saveDcd(&sh_) == SENSORHUB_STATUS_OP_FAILED);
+
+	// the non-blocking save, answered while streaming
+	CHECK(enable(SENSORHUB_GAME_ROTATION_VECTOR, 1000) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(sensorhub_startSaveDcd(&sh_) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(sensorhub_dcdSaveStatus == SENSORHUB_STATUS_DCD_SAVE_PENDING);
+	pollFor(emu_.dcdSaveUs + 5000, 250, NULL);
+	CHECK(sensorhub_dcdSaveStatus == SENSORHUB_STATUS_SUCCESS);
+}
+
+static uint8_t *appendCrc(uint8_t *out, const uint8_t *data, uint32_t length)
+{
+	uint16_t crc = bnoemu_crc16(0xFFFF, data, length);
+	memmove(out, data, length);
+	out[length] = (uint8_t)(crc >> 8);
+	out[length + 1] = (uint8_t)crc;
+	return out + length + 2;
+}
+
+/// A 0x01010101 DFU stream for application; returns its length.
+static uint32_t buildDfuStream(const uint8_t *application, uint32_t size, uint8_t payload, uint8_t *stream)
+{
+	uint8_t header[4] = {(uint8_t)(size >> 24), (uint8_t)(size >> 16), (uint8_t)(size >> 8), (uint8_t)size};
+	uint8_t *out = stream;
+
+	memset(out, 0x01, 4);
+	out = appendCrc(out + 4, header, 4);
+	out = appendCrc(out, &payload, 1);
+	for (uint32_t index = 0; index < size; index += payload)
+	{
+		out = appendCrc(out, &application[index], (size - index < payload) ? size - index : payload);
+	}
+	return (uint32_t)(out - stream);
+}
+
+/// The LZ format of sensorhub_dfu_avr_lz(), using only runs of the previous byte as matches.
+static uint32_t compressRuns(const uint8_t *data, uint32_t length, uint8_t *out)
+{
+	uint32_t in = 0;
+	uint32_t n = 0;
+	uint32_t flagsAt = 0;
+	int tokens = 8;
+
+	while (in < length)
+	{
+		uint32_t run = 0;
+		if (tokens == 8)
+		{
+			flagsAt = n;
+			out[n++] = 0;
+			tokens = 0;
+		}
+		while (in > 0 && run < 130 && in + run < length && data[in + run] == data[in - 1])
+		{
+			run++;
+		}
+		if (run >= 3)
+		{
+			uint16_t token = (uint16_t)((run - 3) << 9);  // distance 1
+			out[n++] = (uint8_t)token;
+			out[n++] = (uint8_t)(token >> 8);
+			in += run;
+		}
+		else
+		{
+			out[flagsAt] |= 1 << tokens;
+			out[n++] = data[in++];
+		}
+		tokens++;
+	}
+	return n;
+}
+
+typedef enum
+{
+	DFU_RAM,
+	DFU_RAM_BACKGROUND,
+	DFU_PROGMEM,
+	DFU_PROGMEM_LZ
+} dfu_path_t;
+
+static void dfu(const char *name, dfu_path_t path, const uint8_t *application, const uint8_t *stream, uint32_t length,
+                const uint8_t *compressed, uint32_t compressedLength)
+{
+	snapshot_t before;
+	int rc = SENSORHUB_STATUS_OP_FAILED;
+
+	setUp(400000);
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+	sh_.dfuProgress = dfuProgress;
+	dfuWritten_ = 0;
+	if (path == DFU_RAM)
+	{
+		sh_.i2cWriteStart = NULL;
+	}
+
+	mark(&before);
+	switch (path)
+	{
+	case DFU_RAM:
+	case DFU_RAM_BACKGROUND:
+		rc = sensorhub_dfu(&sh_, stream, (int)length);
+		break;
+	case DFU_PROGMEM:
+	{
+		avrDfuStream_t avr = {.totalLength = length};
+		bnoemu_setFarMemory(stream, length);
+		rc = sensorhub_dfu_avr(&sh_, &avr);
+		break;
+	}
+	case DFU_PROGMEM_LZ:
+	{
+		avrLzDfuStream_t lz = {.applicationSize = DFU_APPLICATION_SIZE,
+		                       .compressedLength = compressedLength,
+		                       .packetPayloadSize = DFU_PAYLOAD_SIZE,
+		                       .addr = farAddress};
+		bnoemu_setFarMemory(compressed, compressedLength);
+		rc = sensorhub_dfu_avr_lz(&sh_, &lz);
+		break;
+	}
+	}
+
+	CHECK(rc == SENSORHUB_STATUS_SUCCESS);
+	CHECK(emu_.mode == BNOEMU_RUNNING);
+	CHECK(emu_.dfuReceived == DFU_APPLICATION_SIZE);
+	CHECK(emu_.dfuCrc == bnoemu_crc16(0xFFFF, application, DFU_APPLICATION_SIZE));
+	CHECK(emu_.stats.dfuBadPackets == 0);
+	CHECK(dfuWritten_ == length);
+	printCost(name, &before, emu_.stats.dfuPackets, "packet");
+
+	// BOOTN is high again: a later reset the host did not ask for starts the new firmware, not the bootloader
+	CHECK(emu_.bootn);
+	bnoemu_resetHub(&emu_);
+	bnoemu_advance(&emu_, emu_.bootUs + 1000);
+	CHECK(emu_.mode == BNOEMU_RUNNING);
+}
+
+static void dfuAll(void)
+{
+	static uint8_t application[DFU_APPLICATION_SIZE];
+	static uint8_t stream[DFU_APPLICATION_SIZE + DFU_APPLICATION_SIZE / 10 + 64];
+	static uint8_t compressed[DFU_APPLICATION_SIZE + DFU_APPLICATION_SIZE / 8 + 8];
+	uint32_t seed = 1;
+
+	// code-like bytes with the long runs of erased flash real images have
+	for (uint32_t i = 0; i < DFU_APPLICATION_SIZE; i++)
+	{
+		seed = seed * 1103515245u + 12345u;
+		application[i] = ((i / 1024) % 4 == 3) ? 0xFF : (uint8_t)(seed >> 16);
+	}
+	uint32_t length = buildDfuStream(application, DFU_APPLICATION_SIZE, DFU_PAYLOAD_SIZE, stream);
+	uint32_t compressedLength = compressRuns(application, DFU_APPLICATION_SIZE, compressed);
+
+	dfu("DFU from RAM", DFU_RAM, application, stream, length, NULL, 0);
+	dfu("DFU from RAM, background writes", DFU_RAM_BACKGROUND, application, stream, length, NULL, 0);
+	dfu("DFU from PROGMEM", DFU_PROGMEM, application, stream, length, NULL, 0);
+	dfu("DFU from LZ PROGMEM", DFU_PROGMEM_LZ, application, stream, length, compressed, compressedLength);
+
+	// a damaged packet is refused by the bootloader and the update stops there
+	setUp(400000);
+	stream[13 + 5 * (DFU_PAYLOAD_SIZE + 2) + 7] ^= 0x10;
+	CHECK(sensorhub_dfu(&sh_, stream, (int)length) == SENSORHUB_STATUS_DFU_RECEIVED_NAK);
+	CHECK(emu_.stats.dfuBadPackets == 1 && emu_.stats.dfuPackets == 2 + 5);
+
+	// a compressed image with the wrong length is refused before the hub enters its bootloader
+	const int32_t wrongLengths[] = {-1, 1};
+	for (int i = 0; i < 2; i++)
+	{
+		avrLzDfuStream_t lz = {.applicationSize = DFU_APPLICATION_SIZE,
+		                       .compressedLength = compressedLength + wrongLengths[i],
+		                       .packetPayloadSize = DFU_PAYLOAD_SIZE,
+		                       .addr = farAddress};
+		setUp(400000);
+		CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+		bnoemu_setFarMemory(compressed, lz.compressedLength);
+		CHECK(sensorhub_dfu_avr_lz(&sh_, &lz) == SENSORHUB_STATUS_DFU_STREAM_SIZE_WRONG);
+		CHECK(emu_.mode == BNOEMU_RUNNING && emu_.stats.dfuPackets == 0);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-v"))
+		{
+			verbose_ = true;
+		}
+		else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+		{
+			streamSeconds_ = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+		{
+			capturePath_ = argv[++i];
+		}
+		else
+		{
+			fprintf(stderr, "usage: %s [-v] [-s seconds] [-c file]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	printf("probe and product ID\n");
+	probe();
+	printf("FRS\n");
+	frs();
+	printf("feature reports\n");
+	features();
+	printf("streaming GRV + gyro at 1 kHz, stability at 10 Hz, polled every 250 us\n");
+	stream("400 kHz, 18-byte reads", 400000, false, 0);
+	stream("400 kHz, length-prefixed reads", 400000, true, 0);
+	stream("400 kHz, NAK every 50th transfer", 400000, true, 50);
+	printf("length-prefixed report sizes\n");
+	reportSizes();
+	printf("hub reset\n");
+	hubReset();
+	resetRecovery("reconfigured at once", false);
+	resetRecovery("probed again, then reconfigured", true);
+	printf("commands\n");
+	commands();
+	printf("DFU, %d-byte application\n", DFU_APPLICATION_SIZE);
+	dfuAll();
+
+	printf(failures_ ? "%d checks FAILED\n" : "all checks passed\n", failures_);
+	return failures_ ? 1 : 0;
+}
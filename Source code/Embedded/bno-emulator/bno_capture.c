@@ -0,0 +1,126 @@
+/*
+ * bno_capture.c
+ *
+ * Records the hub reports a tracker streams in capture mode (#BCC01 on the console, or HID feature command 13)
+ * from its hidraw node into a capture file for bno-replay. Packets in any other format are skipped, so capture mode
+ * can be switched on after recording has started; the node goes away while the tracker re-enumerates, so start this
+ * once it is back. Stops after the time given with -s, or on Ctrl-C.
+ *
+ * Usage: bno-capture [-s seconds] /dev/hidrawN file
+ */
+
+#include "capture_file.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+static volatile sig_atomic_t stop_ = 0;
+
+static void onSignal(int signal) { stop_ = 1; }
+
+static uint64_t nowMs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t seconds = 0;
+	int arg = 1;
+
+	if (arg + 1 < argc && !strcmp(argv[arg], "-s"))
+	{
+		seconds = (uint32_t)strtoul(argv[arg + 1], NULL, 0);
+		arg += 2;
+	}
+	if (argc - arg != 2)
+	{
+		fprintf(stderr, "usage: %s [-s seconds] /dev/hidrawN file\n", argv[0]);
+		return 2;
+	}
+
+	int device = open(argv[arg], O_RDONLY);
+	if (device < 0)
+	{
+		fprintf(stderr, "%s: %s\n", argv[arg], strerror(errno));
+		return 1;
+	}
+	FILE *out = fopen(argv[arg + 1], "wb");
+	if (!out || !bnocap_writeHeader(out))
+	{
+		fprintf(stderr, "%s: %s\n", argv[arg + 1], strerror(errno));
+		return 1;
+	}
+
+	signal(SIGINT, onSignal);
+	signal(SIGTERM, onSignal);
+
+	uint64_t end = seconds ? nowMs() + seconds * 1000ull : 0;
+	unsigned long packets = 0, skipped = 0, reports = 0, lost = 0;
+	int status = 0;
+	while (!stop_ && (!end || nowMs() < end))
+	{
+		struct pollfd pfd = {.fd = device, .events = POLLIN};
+		if (poll(&pfd, 1, 100) <= 0)
+		{
+			continue;
+		}
+
+		uint8_t packet[BNOCAP_PACKET_SIZE];
+		ssize_t length = read(device, packet, sizeof(packet));
+		if (length < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			fprintf(stderr, "%s: %s\n", argv[arg], strerror(errno));
+			status = 1;
+			break;
+		}
+
+		bnocap_record_t records[BNOCAP_PACKET_SIZE / 6 + 1];
+		int count = bnocap_parsePacket(packet, (int)length, records, sizeof(records) / sizeof(records[0]));
+		if (count < 0)
+		{
+			skipped++;  // tracker or packed reports, before capture mode took effect
+			continue;
+		}
+		packets++;
+		for (int i = 0; i < count; i++)
+		{
+			if (!bnocap_writeRecord(out, &records[i]))
+			{
+				fprintf(stderr, "%s: %s\n", argv[arg + 1], strerror(errno));
+				return 1;
+			}
+			if (records[i].lost)
+			{
+				lost += records[i].lost;
+			}
+			else
+			{
+				reports++;
+			}
+		}
+	}
+
+	if (fclose(out) != 0)
+	{
+		fprintf(stderr, "%s: %s\n", argv[arg + 1], strerror(errno));
+		status = 1;
+	}
+	close(device);
+	printf("%lu reports in %lu packets, %lu dropped by the tracker, %lu other packets skipped\n", reports, packets,
+	       lost, skipped);
+	return status;
+}
@@ -0,0 +1,202 @@
+/*
+ * bno_dfu_test.c
+ *
+ * Checks a compressed firmware image written by generate-bno-dfu.py against the image it was compressed from: both
+ * are sent to the emulated bootloader, by sensorhub_dfu_avr_lz() and sensorhub_dfu_avr() respectively, and must
+ * deliver the same application. The generated sources are read as text, the way generate-bno-dfu.py reads them, so
+ * they need no AVR headers. The exit status is non-zero if any check failed.
+ *
+ * Usage: bno-dfu-test avr-image lz-image
+ */
+
+#include "bno_emulator.h"
+#include "sensorhub.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IMAGE_MAX (512 * 1024)
+
+static bnoemu_t emu_;
+static sensorhub_t sh_;
+static sensorhub_stats_t shStats_;
+static int failures_ = 0;
+static uint32_t dfuWritten_ = 0;
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+static void check(bool ok, const char *what, int line)
+{
+	if (!ok)
+	{
+		failures_++;
+		printf("    FAILED at line %d: %s\n", line, what);
+	}
+}
+
+static void dfuProgress(const sensorhub_t *sh, uint32_t written, uint32_t total) { dfuWritten_ = written; }
+/// Far addresses are offsets into the memory given to bnoemu_setFarMemory().
+uint32_t dfuAddr(uint32_t index) { return index; }
+static uint32_t farAddress(uint32_t index) { return index; }
+
+static char *readText(const char *path)
+{
+	FILE *file = fopen(path, "rb");
+	char *text = NULL;
+	long size;
+
+	if (!file)
+	{
+		fprintf(stderr, "bno-dfu-test: cannot open %s\n", path);
+		return NULL;
+	}
+	if (fseek(file, 0, SEEK_END) == 0 && (size = ftell(file)) >= 0 && fseek(file, 0, SEEK_SET) == 0)
+	{
+		text = malloc(size + 1);
+		if (text && fread(text, 1, size, file) == (size_t)size)
+		{
+			text[size] = '\0';
+		}
+		else
+		{
+			free(text);
+			text = NULL;
+		}
+	}
+	fclose(file);
+	return text;
+}
+
+/// Append the bytes of every `<name>N[length] PROGMEM = {...}` array with names starting with `prefix`, in the
+/// order they appear; returns the number of bytes, or 0 if an array did not hold the bytes its length gives.
+static uint32_t readPages(const char *text, const char *prefix, uint8_t *image, uint32_t size)
+{
+	uint32_t length = 0;
+	const char *at = text;
+
+	while ((at = strstr(at, prefix)) != NULL)
+	{
+		char *end;
+		const char *bracket = at + strlen(prefix);
+		while (isalnum((unsigned char)*bracket) || *bracket == '_')
+		{
+			bracket++;
+		}
+		at = bracket;
+		if (*bracket != '[')
+		{
+			continue;  // a use of the array, not its definition
+		}
+		unsigned long pageLength = strtoul(bracket + 1, &end, 10);
+		const char *open = strchr(end, '{');
+		const char *close = open ? strchr(open, '}') : NULL;
+		if (!close || strncmp(end, "] PROGMEM", 9) != 0)
+		{
+			continue;
+		}
+
+		unsigned long found = 0;
+		for (const char *p = open + 1; p < close; p++)
+		{
+			if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+			{
+				if (length >= size)
+				{
+					return 0;
+				}
+				image[length++] = (uint8_t)strtoul(p, &end, 16);
+				p = end - 1;
+				found++;
+			}
+		}
+		if (found != pageLength)
+		{
+			fprintf(stderr, "bno-dfu-test: %s array has %lu of %lu bytes\n", prefix, found, pageLength);
+			return 0;
+		}
+		at = close;
+	}
+	return length;
+}
+
+/// The value of `.field = N` in the generated stream description, or 0 if it is missing.
+static unsigned long readField(const char *text, const char *field)
+{
+	const char *at = strstr(text, field);
+	if (!at)
+	{
+		return 0;
+	}
+	at = strchr(at, '=');
+	return at ? strtoul(at + 1, NULL, 0) : 0;
+}
+
+static void setUp(void)
+{
+	bnoemu_init(&emu_);
+	memset(&sh_, 0, sizeof(sh_));
+	memset(&shStats_, 0, sizeof(shStats_));
+	sh_.stats = &shStats_;
+	sh_.max_retries = 5;
+	bnoemu_attach(&emu_, &sh_);
+	CHECK(sensorhub_probe(&sh_) == SENSORHUB_STATUS_SUCCESS);
+	sh_.dfuProgress = dfuProgress;
+	dfuWritten_ = 0;
+}
+
+int main(int argc, char **argv)
+{
+	static uint8_t avrImage[IMAGE_MAX];
+	static uint8_t lzImage[IMAGE_MAX];
+
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage: %s avr-image lz-image\n", argv[0]);
+		return 2;
+	}
+	char *avrText = readText(argv[1]);
+	char *lzText = readText(argv[2]);
+	if (!avrText || !lzText)
+	{
+		return 2;
+	}
+
+	uint32_t avrLength = readPages(avrText, "dfuPage_", avrImage, sizeof(avrImage));
+	uint32_t lzLength = readPages(lzText, "dfuStream_", lzImage, sizeof(lzImage));
+	avrDfuStream_t avr = {.totalLength = readField(avrText, ".totalLength")};
+	avrLzDfuStream_t lz = {.applicationSize = readField(lzText, ".applicationSize"),
+	                       .compressedLength = readField(lzText, ".compressedLength"),
+	                       .packetPayloadSize = (uint8_t)readField(lzText, ".packetPayloadSize"),
+	                       .addr = farAddress};
+
+	printf("%s: %lu-byte stream\n", argv[1], (unsigned long)avrLength);
+	printf("%s: %lu bytes for a %lu-byte application\n", argv[2], (unsigned long)lzLength,
+	       (unsigned long)lz.applicationSize);
+	CHECK(avrLength > 0 && avrLength == avr.totalLength);
+	CHECK(lzLength > 0 && lzLength == lz.compressedLength);
+
+	setUp();
+	bnoemu_setFarMemory(avrImage, avrLength);
+	CHECK(sensorhub_dfu_avr(&sh_, &avr) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(emu_.mode == BNOEMU_RUNNING && emu_.stats.dfuBadPackets == 0);
+	CHECK(dfuWritten_ == avrLength);
+	uint32_t avrReceived = emu_.dfuReceived;
+	uint16_t avrCrc = emu_.dfuCrc;
+
+	setUp();
+	bnoemu_setFarMemory(lzImage, lzLength);
+	CHECK(sensorhub_dfu_avr_lz(&sh_, &lz) == SENSORHUB_STATUS_SUCCESS);
+	CHECK(emu_.mode == BNOEMU_RUNNING && emu_.stats.dfuBadPackets == 0);
+	CHECK(dfuWritten_ == avrLength);
+	CHECK(emu_.dfuReceived == lz.applicationSize && emu_.dfuReceived == avrReceived);
+	CHECK(emu_.dfuCrc == avrCrc);
+	printf("  application %lu bytes, CRC 0x%04x from the image, 0x%04x decompressed\n",
+	       (unsigned long)emu_.dfuReceived, avrCrc, emu_.dfuCrc);
+
+	free(avrText);
+	free(lzText);
+	printf(failures_ ? "%d checks FAILED\n" : "all checks passed\n", failures_);
+	return failures_ ? 1 : 0;
+}
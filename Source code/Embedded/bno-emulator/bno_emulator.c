@@ -0,0 +1,1037 @@
+/*
+ * bno_emulator.c
+ *
+ * Only what the sensorhub library uses is modelled: the HID descriptor, set and get report through the command
+ * register, the vendor output reports (product ID, FRS read and write, commands), sensor feature reports, input
+ * report reads and the bootloader's packet protocol. Sensor data is synthetic: the orientation turns about the
+ * vertical axis at 1 rad/s.
+ */
+
+#include "bno_emulator.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CMD_RESP_LEN 16
+#define RESET_INDICATION 0x84  // unsolicited response to command 0x04, reported after every boot
+
+/// Input reports kept free of sensor samples so that responses are never lost behind a stream.
+#define RESPONSE_RESERVE 4
+
+static const uint8_t *farMemory_ = NULL;
+static uint32_t farLength_ = 0;
+
+static inline uint16_t read16(const uint8_t *buffer) { return buffer[0] | ((uint16_t)buffer[1] << 8); }
+static inline uint32_t read32(const uint8_t *buffer)
+{
+	return buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+static inline void write16(uint8_t *buffer, uint16_t value)
+{
+	buffer[0] = (uint8_t)value;
+	buffer[1] = (uint8_t)(value >> 8);
+}
+
+static inline void write32(uint8_t *buffer, uint32_t value)
+{
+	write16(buffer, (uint16_t)value);
+	write16(buffer + 2, (uint16_t)(value >> 16));
+}
+
+uint16_t bnoemu_crc16(uint16_t crc, const uint8_t *data, uint32_t length)
+{
+	while (length--)
+	{
+		crc ^= (uint16_t)(*data++) << 8;
+		for (int bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+		}
+	}
+	return crc;
+}
+
+void bnoemu_setFarMemory(const uint8_t *data, uint32_t length)
+{
+	farMemory_ = data;
+	farLength_ = length;
+}
+
+uint8_t bnoemu_farRead(uint32_t address)
+{
+	if (address >= farLength_)
+	{
+		fprintf(stderr, "bno-emulator: far read at %lu beyond %lu bytes\n", (unsigned long)address,
+		        (unsigned long)farLength_);
+		abort();
+	}
+	return farMemory_[address];
+}
+
+/// Total length of the input report a sensor sends, 0 for the ones not emulated.
+static uint8_t sampleLength(uint8_t sensor)
+{
+	switch (sensor)
+	{
+	case SENSORHUB_ACCELEROMETER:
+	case SENSORHUB_GYROSCOPE_CALIBRATED:
+	case SENSORHUB_MAGNETIC_FIELD_CALIBRATED:
+	case SENSORHUB_LINEAR_ACCELERATION:
+	case SENSORHUB_GRAVITY:
+		return 12;
+	case SENSORHUB_GAME_ROTATION_VECTOR:
+	case SENSORHUB_STEP_COUNTER:
+		return 14;
+	case SENSORHUB_ROTATION_VECTOR:
+	case SENSORHUB_GEOMAGNETIC_ROTATION_VECTOR:
+		return 16;
+	case SENSORHUB_GYROSCOPE_UNCALIBRATED:
+	case SENSORHUB_MAGNETIC_FIELD_UNCALIBRATED:
+	case SENSORHUB_RAW_ACCELEROMETER:
+	case SENSORHUB_RAW_GYROSCOPE:
+	case SENSORHUB_RAW_MAGNETOMETER:
+	case SENSORHUB_PERSONAL_ACTIVITY_CLASSIFIER:
+		return 18;
+	case SENSORHUB_PRESSURE:
+	case SENSORHUB_AMBIENT_LIGHT:
+		return 10;
+	case SENSORHUB_HUMIDITY:
+	case SENSORHUB_PROXIMITY:
+	case SENSORHUB_TEMPERATURE:
+	case SENSORHUB_SIGNIFICANT_MOTION:
+	case SENSORHUB_SHAKE_DETECTOR:
+	case SENSORHUB_FLIP_DETECTOR:
+	case SENSORHUB_PICKUP_DETECTOR:
+	case SENSORHUB_STEP_DETECTOR:
+	case SENSORHUB_STABILITY_DETECTOR:
+	case SENSORHUB_ACTIVITY_CLASSIFICATION:
+		return 8;
+	default:
+		return 0;
+	}
+}
+
+/* ---- Input report queue ---- */
+
+static uint8_t *queueTail(bnoemu_t *emu)
+{
+	return emu->queue[(emu->queueHead + emu->queueCount) % BNOEMU_QUEUE_DEPTH];
+}
+
+/// Queue a response; these only wait for space, the host reading them first if need be.
+static bool pushResponse(bnoemu_t *emu, const uint8_t *report)
+{
+	if (emu->queueCount == BNOEMU_QUEUE_DEPTH)
+	{
+		return false;
+	}
+	memcpy(queueTail(emu), report, BNO070_MAX_INPUT_REPORT_LEN);
+	emu->queueCount++;
+	return true;
+}
+
+static void pushCmdResponse(bnoemu_t *emu, uint8_t command, uint8_t commandSequence, uint8_t status)
+{
+	uint8_t report[BNO070_MAX_INPUT_REPORT_LEN] = {CMD_RESP_LEN, 0, SENSORHUB_CMD_RESP};
+	report[3] = emu->respSequence++;
+	report[4] = command;
+	report[5] = commandSequence;
+	report[6] = 0;  // response sequence: every response here is complete in one report
+	report[7] = status;
+	pushResponse(emu, report);
+}
+
+/* ---- Reports ---- */
+
+static void makeSample(bnoemu_t *emu, uint8_t sensor, uint8_t *report)
+{
+	double t = emu->nowNs / 1e9;
+	uint8_t length = sampleLength(sensor);
+
+	memset(report, 0, BNO070_MAX_INPUT_REPORT_LEN);
+	report[0] = length;
+	report[2] = sensor;
+	report[3] = emu->sequence[sensor]++;
+	report[4] = 3;  // accuracy: high
+	report[5] = 0;  // delay
+
+	switch (sensor)
+	{
+	case SENSORHUB_GAME_ROTATION_VECTOR:
+	case SENSORHUB_ROTATION_VECTOR:
+	case SENSORHUB_GEOMAGNETIC_ROTATION_VECTOR:
+		// i, j, k, real in Q14, then for the rotation vectors the heading accuracy in Q12
+		write16(&report[10], (uint16_t)(int16_t)lrint(sin(t / 2) * 16384));
+		write16(&report[12], (uint16_t)(int16_t)lrint(cos(t / 2) * 16384));
+		if (length >= 16)
+		{
+			write16(&report[14], 0x0200);
+		}
+		break;
+	case SENSORHUB_GYROSCOPE_CALIBRATED:
+		write16(&report[10], 512);  // 1 rad/s about z in Q9
+		break;
+	case SENSORHUB_ACCELEROMETER:
+	case SENSORHUB_GRAVITY:
+		write16(&report[10], 2511);  // 9.81 m/s^2 in Q8
+		break;
+	case SENSORHUB_RAW_ACCELEROMETER:
+	case SENSORHUB_RAW_GYROSCOPE:
+	case SENSORHUB_RAW_MAGNETOMETER:
+		write16(&report[6], report[3]);
+		write32(&report[14], (uint32_t)(emu->nowNs / 1000));
+		break;
+	case SENSORHUB_STABILITY_DETECTOR:
+		write16(&report[6], 0);
+		break;
+	default:
+		write16(&report[6], report[3]);
+		break;
+	}
+}
+
+/// Put the next FRS read responses in the queue, as far as it has room.
+static void streamFrsRead(bnoemu_t *emu)
+{
+	const bnoemu_frs_t *record = bnoemu_getFrs(emu, emu->frsReadType);
+
+	while (emu->frsReadType && emu->queueCount < BNOEMU_QUEUE_DEPTH)
+	{
+		uint8_t report[BNO070_MAX_INPUT_REPORT_LEN] = {18, 0, SENSORHUB_FRS_READ_RESPONSE};
+		uint16_t offset = emu->frsReadOffset;
+		uint8_t words = (emu->frsReadEnd - offset > 2) ? 2 : (uint8_t)(emu->frsReadEnd - offset);
+		uint8_t status = SENSORHUB_FRP_RD_NO_ERR;
+
+		if (offset + words == emu->frsReadEnd)
+		{
+			bool blockDone = (emu->frsReadEnd == emu->frsReadBlock);
+			if (emu->frsReadEnd != record->length)
+			{
+				status = SENSORHUB_FRP_RD_BLOCK_DONE;
+			}
+			else
+			{
+				status = blockDone ? SENSORHUB_FRP_RD_BLOCK_REC_DONE : SENSORHUB_FRP_RD_COMPLETE;
+			}
+		}
+		report[3] = (uint8_t)(words << 4) | status;
+		write16(&report[4], offset);
+		write32(&report[6], record->data[offset]);
+		write32(&report[10], (words > 1) ? record->data[offset + 1] : 0);
+		write16(&report[14], emu->frsReadType);
+		pushResponse(emu, report);
+
+		emu->frsReadOffset += words;
+		if (status != SENSORHUB_FRP_RD_NO_ERR)
+		{
+			emu->frsReadType = 0;
+		}
+	}
+}
+
+static void clearHubState(bnoemu_t *emu)
+{
+	memset(emu->features, 0, sizeof(emu->features));
+	memset(emu->nextSampleNs, 0, sizeof(emu->nextSampleNs));
+	memset(emu->sequence, 0, sizeof(emu->sequence));
+	emu->dcdAutoSave = true;
+	emu->calFlags = ACCEL_CAL_EN | GYRO_CAL_EN | MAG_CAL_EN;
+	emu->queueHead = 0;
+	emu->queueCount = 0;
+	emu->frsReadType = 0;
+	emu->frsWriteType = 0;
+	emu->dcdSaveDueNs = 0;
+	emu->writePending = NULL;
+}
+
+static void enterMode(bnoemu_t *emu, bnoemu_mode_t mode)
+{
+	emu->mode = mode;
+	emu->modeNs = emu->nowNs;
+}
+
+/// Start the application or the bootloader once the boot time is up.
+static void finishBoot(bnoemu_t *emu)
+{
+	if (emu->bootToApp)
+	{
+		enterMode(emu, BNOEMU_RUNNING);
+		pushCmdResponse(emu, RESET_INDICATION, 0, 0);
+	}
+	else
+	{
+		enterMode(emu, BNOEMU_BOOTLOADER);
+		emu->dfuApplicationSize = 0;
+		emu->dfuPayloadSize = 0;
+		emu->dfuReceived = 0;
+		emu->dfuCrc = 0xFFFF;
+		emu->dfuLastOk = false;
+		emu->dfuComplete = false;
+	}
+}
+
+/* ---- Time and the bus ---- */
+
+#define EVENT_NONE (-1)
+#define EVENT_BOOT (-2)
+#define EVENT_DCD_SAVED (-3)
+
+/// Run the hub up to time `until`: boot, the sensor streams and the pending DCD save, in time order.
+static void runUntil(bnoemu_t *emu, uint64_t until)
+{
+	for (;;)
+	{
+		uint64_t next = until;
+		int event = EVENT_NONE;
+
+		uint64_t bootedNs = emu->modeNs + (emu->bootToApp ? emu->bootUs : emu->bootloaderUs) * 1000ull;
+		if (emu->mode == BNOEMU_BOOTING && bootedNs <= next)
+		{
+			next = bootedNs;
+			event = EVENT_BOOT;
+		}
+		if (emu->mode == BNOEMU_RUNNING)
+		{
+			if (emu->dcdSaveDueNs && emu->dcdSaveDueNs <= next)
+			{
+				next = emu->dcdSaveDueNs;
+				event = EVENT_DCD_SAVED;
+			}
+			for (int i = 0; i < BNOEMU_SENSORS; i++)
+			{
+				if (emu->features[i].reportInterval && emu->nextSampleNs[i] <= next &&
+				    (event == EVENT_NONE || emu->nextSampleNs[i] < next))
+				{
+					next = emu->nextSampleNs[i];
+					event = i;
+				}
+			}
+		}
+		if (event == EVENT_NONE)
+		{
+			break;
+		}
+		if (emu->nowNs < next)
+		{
+			emu->nowNs = next;
+		}
+
+		if (event == EVENT_BOOT)
+		{
+			finishBoot(emu);
+		}
+		else if (event == EVENT_DCD_SAVED)
+		{
+			uint8_t status = (emu->dcdSaveFailures > 0) ? 1 : 0;
+			emu->dcdSaveFailures -= status;
+			emu->dcdSaveDueNs = 0;
+			pushCmdResponse(emu, CMD_SAVE_DCD, emu->dcdSaveSequence, status);
+		}
+		else
+		{
+			emu->nextSampleNs[event] += emu->features[event].reportInterval * 1000ull;
+			emu->stats.samples++;
+			if (emu->queueCount >= BNOEMU_QUEUE_DEPTH - RESPONSE_RESERVE)
+			{
+				emu->stats.dropped++;
+			}
+			else
+			{
+				makeSample(emu, (uint8_t)event, queueTail(emu));
+				emu->queueCount++;
+			}
+		}
+	}
+	if (emu->nowNs < until)
+	{
+		emu->nowNs = until;
+	}
+	streamFrsRead(emu);
+}
+
+void bnoemu_advance(bnoemu_t *emu, uint32_t us) { runUntil(emu, emu->nowNs + us * 1000ull); }
+uint64_t bnoemu_nowUs(const bnoemu_t *emu) { return emu->nowNs / 1000; }
+
+/// Account for bytes clocked on the bus: START, the address bytes, the data, and a STOP.
+static void busy(bnoemu_t *emu, int addressBytes, int dataBytes)
+{
+	uint32_t bits = 9 * (uint32_t)(addressBytes + dataBytes) + 2 * (uint32_t)addressBytes;
+	uint64_t ns = (uint64_t)bits * 1000000000ull / emu->busHz;
+
+	emu->stats.bytes += addressBytes + dataBytes;
+	emu->stats.busNs += ns;
+	runUntil(emu, emu->nowNs + ns);
+}
+
+/// Start a transaction; false if it is NAKed, which costs the address byte.
+static bool addressed(bnoemu_t *emu, uint8_t address)
+{
+	bool present = (emu->mode == BNOEMU_RUNNING && address == emu->sensorhubAddress) ||
+	               (emu->mode == BNOEMU_BOOTLOADER && address == emu->bootloaderAddress);
+	bool inject = false;
+
+	emu->stats.transactions++;
+	if (present && emu->nakNext)
+	{
+		emu->nakNext--;
+		inject = true;
+	}
+	else if (present && emu->nakEvery && ++emu->nakCountdown >= emu->nakEvery)
+	{
+		emu->nakCountdown = 0;
+		inject = true;
+	}
+
+	if (!present || inject)
+	{
+		emu->stats.naks++;
+		emu->stats.injectedNaks += inject;
+		busy(emu, 1, 0);
+		return false;
+	}
+	return true;
+}
+
+/* ---- Application protocol ---- */
+
+/// Hand over the next queued report, or an empty one. Only `length` bytes are clocked; the rest of the buffer is
+/// poisoned, standing for whatever it held before, so a reader that does not clear it gets caught.
+static void readReport(bnoemu_t *emu, uint8_t *receiveData, int receiveLength, int length)
+{
+	uint8_t report[BNO070_MAX_INPUT_REPORT_LEN] = {0};
+
+	if (emu->queueCount)
+	{
+		memcpy(report, emu->queue[emu->queueHead], sizeof(report));
+		emu->queueHead = (emu->queueHead + 1) % BNOEMU_QUEUE_DEPTH;
+		emu->queueCount--;
+		emu->stats.reportsRead++;
+	}
+	else
+	{
+		emu->stats.emptyReads++;
+	}
+	if (length > receiveLength)
+	{
+		length = receiveLength;
+	}
+	memset(receiveData, 0, length);
+	memcpy(receiveData, report, (length < (int)sizeof(report)) ? length : (int)sizeof(report));
+	memset(receiveData + length, BNOEMU_POISON, receiveLength - length);
+	streamFrsRead(emu);
+}
+
+static void frsWriteResponse(bnoemu_t *emu, uint8_t status, uint16_t offset)
+{
+	uint8_t report[BNO070_MAX_INPUT_REPORT_LEN] = {6, 0, SENSORHUB_FRS_WRITE_RESPONSE, status};
+	write16(&report[4], offset);
+	pushResponse(emu, report);
+}
+
+static void frsReadRequest(bnoemu_t *emu, const uint8_t *payload)
+{
+	uint16_t offset = read16(&payload[1]);
+	uint16_t type = read16(&payload[3]);
+	uint16_t block = read16(&payload[7]);
+	const bnoemu_frs_t *record = bnoemu_getFrs(emu, type);
+	uint8_t status = SENSORHUB_FRP_RD_NO_ERR;
+
+	if (!record || record->length == 0)
+	{
+		status = SENSORHUB_FRP_RD_RECORD_EMPTY;
+	}
+	else if (offset >= record->length)
+	{
+		status = SENSORHUB_FRP_RD_BAD_OFFSET;
+	}
+	if (status != SENSORHUB_FRP_RD_NO_ERR)
+	{
+		uint8_t report[BNO070_MAX_INPUT_REPORT_LEN] = {18, 0, SENSORHUB_FRS_READ_RESPONSE, status};
+		write16(&report[4], offset);
+		write16(&report[14], type);
+		pushResponse(emu, report);
+		return;
+	}
+
+	emu->frsReadType = type;
+	emu->frsReadOffset = offset;
+	emu->frsReadBlock = block ? offset + block : 0;
+	emu->frsReadEnd = (block && offset + block < record->length) ? offset + block : record->length;
+	streamFrsRead(emu);
+}
+
+static void frsWriteRequest(bnoemu_t *emu, const uint8_t *payload)
+{
+	uint16_t length = read16(&payload[1]);
+	uint16_t type = read16(&payload[3]);
+
+	if (length == 0)
+	{
+		bnoemu_setFrs(emu, type, NULL, 0);
+		frsWriteResponse(emu, SENSORHUB_FRP_WR_COMPLETE, 0);
+		return;
+	}
+	if (length > BNOEMU_FRS_WORDS)
+	{
+		frsWriteResponse(emu, SENSORHUB_FRP_WR_BAD_LENGTH, 0);
+		return;
+	}
+	emu->frsWriteType = type;
+	emu->frsWriteLength = length;
+	emu->frsWriteReceived = 0;
+	memset(emu->frsWriteData, 0, sizeof(emu->frsWriteData));
+	frsWriteResponse(emu, SENSORHUB_FRP_WR_READY, 0);
+}
+
+static void frsWriteData(bnoemu_t *emu, const uint8_t *payload)
+{
+	uint16_t offset = read16(&payload[1]);
+
+	if (!emu->frsWriteType)
+	{
+		frsWriteResponse(emu, SENSORHUB_FRP_WR_BAD_MODE, offset);
+		return;
+	}
+	if (offset != emu->frsWriteReceived)
+	{
+		frsWriteResponse(emu, SENSORHUB_FRP_WR_FAILED, offset);
+		emu->frsWriteType = 0;
+		return;
+	}
+	for (int i = 0; i < 2 && offset + i < emu->frsWriteLength; i++)
+	{
+		emu->frsWriteData[offset + i] = read32(&payload[3 + 4 * i]);
+		emu->frsWriteReceived++;
+	}
+	frsWriteResponse(emu, SENSORHUB_FRP_WR_ACK, offset);
+
+	if (emu->frsWriteReceived == emu->frsWriteLength)
+	{
+		bool stored = bnoemu_setFrs(emu, emu->frsWriteType, emu->frsWriteData, emu->frsWriteLength);
+		frsWriteResponse(emu, stored ? SENSORHUB_FRP_WR_REC_VALID : SENSORHUB_FRP_WR_DEVICE_ERROR, 0);
+		if (stored)
+		{
+			frsWriteResponse(emu, SENSORHUB_FRP_WR_COMPLETE, 0);
+		}
+		emu->frsWriteType = 0;
+	}
+}
+
+static void command(bnoemu_t *emu, const uint8_t *payload)
+{
+	uint8_t sequence = payload[0];
+
+	switch (payload[1])
+	{
+	case CMD_SAVE_DCD:
+		emu->dcdSaveSequence = sequence;
+		emu->dcdSaveDueNs = emu->nowNs + (emu->dcdSaveUs ? emu->dcdSaveUs : 1) * 1000ull;
+		break;
+	case CMD_CONFIG_ME_CAL:
+		emu->calFlags = (payload[2] ? ACCEL_CAL_EN : 0) | (payload[3] ? GYRO_CAL_EN : 0) | (payload[4] ? MAG_CAL_EN : 0);
+		pushCmdResponse(emu, CMD_CONFIG_ME_CAL, sequence, 0);
+		break;
+	case CMD_CONFIG_DCD_SAVE:
+		emu->dcdAutoSave = (payload[2] == 0);
+		break;
+	case CMD_TARE:
+		break;
+	default:
+		pushCmdResponse(emu, payload[1], sequence, 1);
+		break;
+	}
+}
+
+static void outputReport(bnoemu_t *emu, uint8_t id, const uint8_t *payload, int length)
+{
+	uint8_t report[BNO070_MAX_INPUT_REPORT_LEN] = {18, 0};
+
+	switch (id)
+	{
+	case SENSORHUB_PRODUCT_ID_REQUEST:
+		report[2] = SENSORHUB_PRODUCT_ID_RESPONSE;
+		report[3] = emu->productId.resetCause;
+		report[4] = emu->productId.swVersionMajor;
+		report[5] = emu->productId.swVersionMinor;
+		write32(&report[6], emu->productId.swPartNumber);
+		write32(&report[10], emu->productId.swBuildNumber);
+		write16(&report[14], emu->productId.swVersionPatch);
+		for (int i = 0; i < emu->productIdReports; i++)
+		{
+			pushResponse(emu, report);
+		}
+		break;
+	case SENSORHUB_FRS_READ_REQUEST:
+		if (length >= 9)
+		{
+			frsReadRequest(emu, payload);
+		}
+		break;
+	case SENSORHUB_FRS_WRITE_REQUEST:
+		if (length >= 5)
+		{
+			frsWriteRequest(emu, payload);
+		}
+		break;
+	case SENSORHUB_FRS_WRITE_DATA_REQUEST:
+		if (length >= 11)
+		{
+			frsWriteData(emu, payload);
+		}
+		break;
+	case SENSORHUB_CMD_REQ:
+		if (length >= 3)
+		{
+			command(emu, payload);
+		}
+		break;
+	}
+}
+
+static void setFeature(bnoemu_t *emu, uint8_t sensor, const uint8_t *payload, int length)
+{
+	if (sensor >= BNOEMU_SENSORS || length < 15)
+	{
+		return;
+	}
+	sensorhub_SensorFeature_t *feature = &emu->features[sensor];
+	uint32_t interval = read32(&payload[3]);
+
+	if (interval && interval < emu->minIntervalUs)
+	{
+		interval = emu->minIntervalUs;
+	}
+	if (!sampleLength(sensor))
+	{
+		interval = 0;
+	}
+	if (interval && interval != feature->reportInterval)
+	{
+		emu->nextSampleNs[sensor] = emu->nowNs + interval * 1000ull;
+	}
+	feature->changeSensitivityRelative = (payload[0] & 0x1) != 0;
+	feature->changeSensitivityEnabled = (payload[0] & 0x2) != 0;
+	feature->wakeupEnabled = (payload[0] & 0x4) != 0;
+	feature->changeSensitivity = read16(&payload[1]);
+	feature->reportInterval = interval;
+	feature->batchInterval = read32(&payload[7]);
+	feature->sensorSpecificConfiguration = read32(&payload[11]);
+}
+
+static void getFeature(const bnoemu_t *emu, uint8_t sensor, uint8_t *receiveData, int receiveLength)
+{
+	uint8_t report[17] = {17, 0};
+
+	if (sensor < BNOEMU_SENSORS)
+	{
+		const sensorhub_SensorFeature_t *feature = &emu->features[sensor];
+		report[2] = (feature->changeSensitivityRelative ? 0x1 : 0) | (feature->changeSensitivityEnabled ? 0x2 : 0) |
+		            (feature->wakeupEnabled ? 0x4 : 0);
+		write16(&report[3], feature->changeSensitivity);
+		write32(&report[5], feature->reportInterval);
+		write32(&report[9], feature->batchInterval);
+		write32(&report[13], feature->sensorSpecificConfiguration);
+	}
+	memset(receiveData, 0, receiveLength);
+	memcpy(receiveData, report, (receiveLength < (int)sizeof(report)) ? receiveLength : (int)sizeof(report));
+}
+
+/// A write to the command register, possibly followed by a read of the data register.
+static void hidCommand(bnoemu_t *emu, const uint8_t *send, int sendLength, uint8_t *receiveData, int receiveLength)
+{
+	uint8_t type = send[2] & 0x30;
+	uint8_t id = send[2] & 0x0F;
+	uint8_t opcode = send[3] & 0x0F;
+	int ix = 4;
+
+	if (id == 0x0F)
+	{
+		id = send[ix++];
+	}
+	if (opcode == HID_RESET_OPCODE)
+	{
+		bnoemu_resetHub(emu);
+		return;
+	}
+	if (sendLength < ix + 2 || send[ix] != BNO070_REGISTER_DATA || send[ix + 1] != 0)
+	{
+		return;
+	}
+	ix += 2;
+
+	if (opcode == HID_GET_REPORT_OPCODE && receiveLength > 0 && type == HID_REPORT_TYPE_FEATURE)
+	{
+		getFeature(emu, id, receiveData, receiveLength);
+	}
+	else if (opcode == HID_SET_REPORT_OPCODE && sendLength >= ix + 2)
+	{
+		int length = read16(&send[ix]) - 2;
+		const uint8_t *payload = &send[ix + 2];
+		if (length > sendLength - ix - 2)
+		{
+			length = sendLength - ix - 2;
+		}
+		if (type == HID_REPORT_TYPE_OUTPUT)
+		{
+			outputReport(emu, id, payload, length);
+		}
+		else if (type == HID_REPORT_TYPE_FEATURE)
+		{
+			setFeature(emu, id, payload, length);
+		}
+	}
+}
+
+static void hidDescriptor(uint8_t *receiveData, int receiveLength)
+{
+	uint8_t desc[BNO070_DESC_V1_LEN] = {0};
+	write16(&desc[0], BNO070_DESC_V1_LEN);
+	write16(&desc[2], BNO070_DESC_V1_BCD);
+	write16(&desc[6], BNO070_REGISTER_REPORT_DESCRIPTOR);
+	write16(&desc[8], BNO070_REGISTER_INPUT);
+	write16(&desc[10], BNO070_MAX_INPUT_REPORT_LEN);
+	write16(&desc[12], BNO070_REGISTER_OUTPUT);
+	write16(&desc[14], 64);
+	write16(&desc[16], BNO070_REGISTER_COMMAND);
+	write16(&desc[18], BNO070_REGISTER_DATA);
+	// vendor, product and version IDs stay 0: the library doesn't look at them
+
+	memset(receiveData, 0, receiveLength);
+	memcpy(receiveData, desc, (receiveLength < (int)sizeof(desc)) ? receiveLength : (int)sizeof(desc));
+}
+
+/* ---- Bootloader ---- */
+
+static void bootloaderPacket(bnoemu_t *emu, const uint8_t *packet, int length)
+{
+	emu->dfuLastOk = false;
+	if (length < 3 || emu->dfuComplete)
+	{
+		emu->stats.dfuBadPackets++;
+		return;
+	}
+	uint16_t crc = ((uint16_t)packet[length - 2] << 8) | packet[length - 1];
+	if (bnoemu_crc16(0xFFFF, packet, length - 2) != crc)
+	{
+		emu->stats.dfuBadPackets++;
+		return;
+	}
+
+	if (emu->dfuApplicationSize == 0)
+	{
+		if (length != 6)
+		{
+			emu->stats.dfuBadPackets++;
+			return;
+		}
+		emu->dfuApplicationSize = ((uint32_t)packet[0] << 24) | ((uint32_t)packet[1] << 16) |
+		                          ((uint32_t)packet[2] << 8) | packet[3];
+	}
+	else if (emu->dfuPayloadSize == 0)
+	{
+		if (length != 3 || packet[0] == 0)
+		{
+			emu->stats.dfuBadPackets++;
+			return;
+		}
+		emu->dfuPayloadSize = packet[0];
+	}
+	else
+	{
+		uint32_t left = emu->dfuApplicationSize - emu->dfuReceived;
+		uint32_t payload = (left < emu->dfuPayloadSize) ? left : emu->dfuPayloadSize;
+		if ((uint32_t)length != payload + 2)
+		{
+			emu->stats.dfuBadPackets++;
+			return;
+		}
+		emu->dfuCrc = bnoemu_crc16(emu->dfuCrc, packet, payload);
+		emu->dfuReceived += payload;
+		emu->dfuComplete = (emu->dfuReceived == emu->dfuApplicationSize);
+	}
+	emu->stats.dfuPackets++;
+	emu->dfuLastOk = true;
+}
+
+/// The bootloader's one-byte status; after the last packet's, the new application boots.
+static void bootloaderStatus(bnoemu_t *emu, uint8_t *receiveData, int receiveLength)
+{
+	memset(receiveData, 0, receiveLength);
+	receiveData[0] = emu->dfuLastOk ? 's' : 'n';
+	if (emu->dfuComplete)
+	{
+		emu->bootToApp = true;
+		enterMode(emu, BNOEMU_BOOTING);
+	}
+}
+
+/* ---- sensorhub_t callbacks ---- */
+
+static int i2cTransfer(const sensorhub_t *sh, uint8_t address, const uint8_t *sendData, int sendLength,
+                       uint8_t *receiveData, int receiveLength)
+{
+	bnoemu_t *emu = sh->cookie;
+
+	if (!addressed(emu, address))
+	{
+		return SENSORHUB_STATUS_ERROR_I2C_IO;
+	}
+	busy(emu, (sendLength > 0) + (receiveLength > 0), sendLength + receiveLength);
+
+	if (emu->mode == BNOEMU_BOOTLOADER)
+	{
+		if (sendLength > 0)
+		{
+			bootloaderPacket(emu, sendData, sendLength);
+		}
+		if (receiveLength > 0)
+		{
+			bootloaderStatus(emu, receiveData, receiveLength);
+		}
+	}
+	else if (sendLength == 0 && receiveLength > 0)
+	{
+		readReport(emu, receiveData, receiveLength, receiveLength);
+	}
+	else if (sendLength == 2 && read16(sendData) == BNO070_REGISTER_HID_DESCRIPTOR && receiveLength > 0)
+	{
+		hidDescriptor(receiveData, receiveLength);
+	}
+	else if (sendLength >= 4 && read16(sendData) == BNO070_REGISTER_COMMAND)
+	{
+		hidCommand(emu, sendData, sendLength, receiveData, receiveLength);
+	}
+	return SENSORHUB_STATUS_SUCCESS;
+}
+
+/// Reads only the length header and the bytes it announces, in one transaction.
+static int i2cReadReport(const sensorhub_t *sh, uint8_t address, uint8_t *receiveData, int maxLength)
+{
+	bnoemu_t *emu = sh->cookie;
+
+	if (!addressed(emu, address))
+	{
+		return SENSORHUB_STATUS_ERROR_I2C_IO;
+	}
+	int length = emu->queueCount ? read16(emu->queue[emu->queueHead]) : 0;
+	if (length < 2)
+	{
+		length = 2;
+	}
+	if (length > maxLength)
+	{
+		length = maxLength;
+	}
+	busy(emu, 1, length);
+	readReport(emu, receiveData, maxLength, length);
+	return SENSORHUB_STATUS_SUCCESS;
+}
+
+static int i2cWriteStart(const sensorhub_t *sh, uint8_t address, const uint8_t *sendData, int sendLength)
+{
+	bnoemu_t *emu = sh->cookie;
+
+	if (emu->writePending)
+	{
+		return SENSORHUB_STATUS_ERROR_I2C_IO;
+	}
+	emu->writePending = sendData;
+	emu->writeAddress = address;
+	emu->writeLength = sendLength;
+	return SENSORHUB_STATUS_SUCCESS;
+}
+
+static int i2cWriteWait(const sensorhub_t *sh)
+{
+	bnoemu_t *emu = sh->cookie;
+	const uint8_t *data = emu->writePending;
+
+	if (!data)
+	{
+		return SENSORHUB_STATUS_ERROR_I2C_IO;
+	}
+	emu->writePending = NULL;
+	return i2cTransfer(sh, emu->writeAddress, data, emu->writeLength, NULL, 0);
+}
+
+static void setRSTN(const sensorhub_t *sh, int value)
+{
+	bnoemu_t *emu = sh->cookie;
+
+	if (!value && emu->rstn)
+	{
+		clearHubState(emu);
+		enterMode(emu, BNOEMU_RESET);
+	}
+	else if (value && !emu->rstn)
+	{
+		emu->stats.resets++;
+		emu->bootToApp = emu->bootn;
+		enterMode(emu, BNOEMU_BOOTING);
+	}
+	emu->rstn = value;
+}
+
+static void setBOOTN(const sensorhub_t *sh, int value)
+{
+	bnoemu_t *emu = sh->cookie;
+	emu->bootn = value;
+}
+
+static int getHOST_INTN(const sensorhub_t *sh)
+{
+	bnoemu_t *emu = sh->cookie;
+	return !(emu->mode == BNOEMU_RUNNING && emu->queueCount);
+}
+
+/// Every check costs the host pollUs, so that the library's busy-wait loops see time pass.
+static int getDataReady(const sensorhub_t *sh)
+{
+	bnoemu_t *emu = sh->cookie;
+	bnoemu_advance(emu, emu->pollUs);
+	return !getHOST_INTN(sh);
+}
+
+static void delay(const sensorhub_t *sh, int milliseconds)
+{
+	bnoemu_t *emu = sh->cookie;
+	bnoemu_advance(emu, (uint32_t)milliseconds * 1000);
+}
+
+/// Stands in for an interrupt-driven wait: time moves in 100 us steps until INTN reaches the level.
+static int waitHOST_INTN(const sensorhub_t *sh, int level, uint32_t timeoutMs)
+{
+	bnoemu_t *emu = sh->cookie;
+	uint64_t endNs = emu->nowNs + timeoutMs * 1000000ull;
+	while (getHOST_INTN(sh) != level && emu->nowNs < endNs)
+	{
+		bnoemu_advance(emu, 100);
+	}
+	return getHOST_INTN(sh);
+}
+
+static uint32_t getTick(const sensorhub_t *sh)
+{
+	const bnoemu_t *emu = sh->cookie;
+	return (uint32_t)(emu->nowNs / 1000000);
+}
+
+/* ---- Public ---- */
+
+void bnoemu_init(bnoemu_t *emu)
+{
+	memset(emu, 0, sizeof(*emu));
+	emu->sensorhubAddress = 0x48;
+	emu->bootloaderAddress = 0x28;
+	emu->busHz = 400000;
+	emu->bootUs = 30000;
+	emu->bootloaderUs = 5000;
+	emu->minIntervalUs = 1000;
+	emu->dcdSaveUs = 20000;
+	emu->pollUs = 5;
+	emu->productIdReports = 4;
+	emu->productId.resetCause = 1;  // power on
+	emu->productId.swVersionMajor = 1;
+	emu->productId.swVersionMinor = 7;
+	emu->productId.swPartNumber = 10003251;
+	emu->productId.swBuildNumber = 390;
+	emu->productId.swVersionPatch = 0;
+
+	emu->rstn = true;
+	emu->bootn = true;
+	emu->bootToApp = true;
+	clearHubState(emu);
+	enterMode(emu, BNOEMU_RUNNING);
+}
+
+void bnoemu_attach(bnoemu_t *emu, sensorhub_t *sh)
+{
+	sh->sensorhubAddress = emu->sensorhubAddress;
+	sh->bootloaderAddress = emu->bootloaderAddress;
+	sh->cookie = emu;
+	sh->i2cTransfer = i2cTransfer;
+	sh->setRSTN = setRSTN;
+	sh->setBOOTN = setBOOTN;
+	sh->getHOST_INTN = getHOST_INTN;
+	sh->getDataReady = getDataReady;
+	sh->delay = delay;
+	sh->getTick = getTick;
+	sh->waitHOST_INTN = waitHOST_INTN;
+	sh->i2cReadReport = i2cReadReport;
+	sh->i2cWriteStart = i2cWriteStart;
+	sh->i2cWriteWait = i2cWriteWait;
+}
+
+void bnoemu_resetHub(bnoemu_t *emu)
+{
+	clearHubState(emu);
+	emu->stats.resets++;
+	emu->bootToApp = emu->bootn;  // the bootloader samples BOOTN on every start, not only after RSTN
+	enterMode(emu, BNOEMU_BOOTING);
+}
+
+bool bnoemu_pushReport(bnoemu_t *emu, const uint8_t *report)
+{
+	emu->stats.samples++;
+	if (emu->queueCount >= BNOEMU_QUEUE_DEPTH - RESPONSE_RESERVE)
+	{
+		emu->stats.dropped++;
+		return false;
+	}
+	uint8_t *tail = queueTail(emu);
+	uint16_t length = read16(report);
+	memset(tail, 0, BNO070_MAX_INPUT_REPORT_LEN);
+	memcpy(tail, report, (length < BNO070_MAX_INPUT_REPORT_LEN) ? length : BNO070_MAX_INPUT_REPORT_LEN);
+	emu->queueCount++;
+	return true;
+}
+
+void bnoemu_injectNaks(bnoemu_t *emu, uint32_t count, uint32_t every)
+{
+	emu->nakNext = count;
+	emu->nakEvery = every;
+	emu->nakCountdown = 0;
+}
+
+bool bnoemu_setFrs(bnoemu_t *emu, uint16_t type, const uint32_t *data, uint16_t length)
+{
+	bnoemu_frs_t *record = (bnoemu_frs_t *)bnoemu_getFrs(emu, type);
+
+	if (length > BNOEMU_FRS_WORDS)
+	{
+		return false;
+	}
+	for (int i = 0; !record && i < BNOEMU_FRS_RECORDS; i++)
+	{
+		if (emu->frs[i].type == 0)
+		{
+			record = &emu->frs[i];
+			record->type = type;
+		}
+	}
+	if (!record)
+	{
+		return false;
+	}
+	record->length = length;
+	if (length)
+	{
+		memcpy(record->data, data, length * sizeof(uint32_t));
+	}
+	return true;
+}
+
+const bnoemu_frs_t *bnoemu_getFrs(const bnoemu_t *emu, uint16_t type)
+{
+	for (int i = 0; type && i < BNOEMU_FRS_RECORDS; i++)
+	{
+		if (emu->frs[i].type == type)
+		{
+			return &emu->frs[i];
+		}
+	}
+	return NULL;
+}
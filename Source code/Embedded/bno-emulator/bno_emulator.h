@@ -0,0 +1,165 @@
+/*
+ * bno_emulator.h
+ *
+ * Host-side model of a BNO070 on its HID-over-I2C interface, plugged into the sensorhub_t callbacks so the
+ * sensorhub library can be run and measured on a PC. Time is simulated: it moves only when the library waits,
+ * transfers bytes on the bus, or the caller advances it.
+ */
+
+#ifndef BNO_EMULATOR_H_
+#define BNO_EMULATOR_H_
+
+#include "sensorhub.h"
+#include "sensorhub_hid.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// Number of sensor report IDs the emulator keeps settings for.
+#define BNOEMU_SENSORS 0x20
+
+/// Input reports the hub holds before it starts dropping sensor samples.
+#define BNOEMU_QUEUE_DEPTH 32
+
+/// Fills the part of a read buffer a length-prefixed read did not transfer.
+#define BNOEMU_POISON 0xA5
+
+/// Words held for each FRS record.
+#define BNOEMU_FRS_WORDS 256
+
+/// FRS records the emulator can store.
+#define BNOEMU_FRS_RECORDS 8
+
+typedef struct bnoemu_stats_s
+{
+	uint32_t transactions;  // I2C transactions started, NAKed ones included
+	uint32_t naks;          // transactions NAKed, whatever the reason
+	uint32_t injectedNaks;  // of those, the ones asked for with bnoemu_injectNaks()
+	uint32_t bytes;         // bytes clocked on the bus, address bytes included
+	uint64_t busNs;         // time the bus was busy
+	uint32_t reportsRead;   // input reports handed to the host, empty ones excluded
+	uint32_t emptyReads;    // reads that found no report pending
+	uint32_t samples;       // sensor reports generated
+	uint32_t dropped;       // sensor reports lost because the queue was full
+	uint32_t resets;        // hub restarts: RSTN, HID reset or bnoemu_resetHub()
+	uint32_t dfuPackets;    // bootloader packets accepted
+	uint32_t dfuBadPackets; // bootloader packets refused
+} bnoemu_stats_t;
+
+typedef struct bnoemu_frs_s
+{
+	uint16_t type;
+	uint16_t length;  // words, 0 when the record is empty
+	uint32_t data[BNOEMU_FRS_WORDS];
+} bnoemu_frs_t;
+
+typedef enum
+{
+	BNOEMU_RESET,       // RSTN held low
+	BNOEMU_BOOTING,     // NAKs everything until bootUs (or bootloaderUs) has passed
+	BNOEMU_RUNNING,     // application answering at sensorhubAddress
+	BNOEMU_BOOTLOADER   // started with BOOTN low, answering at bootloaderAddress
+} bnoemu_mode_t;
+
+typedef struct bnoemu_s
+{
+	/* Configuration: set by bnoemu_init(), change before use as needed */
+	uint8_t sensorhubAddress;
+	uint8_t bootloaderAddress;
+	uint32_t busHz;           // I2C clock
+	uint32_t bootUs;          // from reset release to the application answering
+	uint32_t bootloaderUs;    // from reset release with BOOTN low to the bootloader answering
+	uint32_t minIntervalUs;   // fastest report interval the hub honours
+	uint32_t dcdSaveUs;       // from the save DCD command to its response
+	uint32_t pollUs;          // host time taken by each getDataReady() call
+	uint8_t productIdReports; // product ID responses sent per request, one per firmware part
+	sensorhub_ProductID_t productId;
+
+	/* State */
+	uint64_t nowNs;
+	bnoemu_mode_t mode;
+	uint64_t modeNs;  // when the current mode started
+	bool rstn;
+	bool bootn;
+	bool bootToApp;  // BOOTN was high at reset release, or the bootloader has taken a whole image
+
+	sensorhub_SensorFeature_t features[BNOEMU_SENSORS];
+	uint64_t nextSampleNs[BNOEMU_SENSORS];
+	uint8_t sequence[BNOEMU_SENSORS];
+	bool dcdAutoSave;
+	uint8_t calFlags;
+
+	uint8_t queue[BNOEMU_QUEUE_DEPTH][BNO070_MAX_INPUT_REPORT_LEN];
+	uint8_t queueHead;
+	uint8_t queueCount;
+
+	bnoemu_frs_t frs[BNOEMU_FRS_RECORDS];
+	uint16_t frsReadType;  // record being streamed back, 0 when none
+	uint16_t frsReadOffset;
+	uint16_t frsReadEnd;    // last word + 1 this read will send
+	uint16_t frsReadBlock;  // word after the block asked for, 0 when the whole record was
+	uint16_t frsWriteType; // record being written, 0 when none
+	uint16_t frsWriteLength;
+	uint16_t frsWriteReceived;
+	uint32_t frsWriteData[BNOEMU_FRS_WORDS];
+
+	uint64_t dcdSaveDueNs;  // 0 when no save is in progress
+	uint8_t dcdSaveSequence;  // command sequence number of that save
+	uint8_t respSequence;     // sequence number of the next command response
+	int dcdSaveFailures;    // the next saves to report as failed
+
+	uint32_t nakNext;       // NAK this many transactions from now on
+	uint32_t nakEvery;      // and every nakEvery-th one after that, 0 for never
+	uint32_t nakCountdown;
+
+	const uint8_t *writePending;  // i2cWriteStart() data not yet clocked out
+	uint8_t writeAddress;
+	int writeLength;
+
+	/* What the bootloader received */
+	uint32_t dfuApplicationSize;
+	uint8_t dfuPayloadSize;
+	uint32_t dfuReceived;   // application bytes accepted
+	uint16_t dfuCrc;        // CRC-16/CCITT of those bytes
+	bool dfuLastOk;         // answer to the next status read: 's' or 'n'
+	bool dfuComplete;       // the whole application is in; the next status read starts it
+
+	bnoemu_stats_t stats;
+} bnoemu_t;
+
+/// Set up a powered, running hub with no sensors enabled and the default timings.
+void bnoemu_init(bnoemu_t *emu);
+
+/// Point the callbacks of sh at emu; sh->cookie is used to find it again.
+void bnoemu_attach(bnoemu_t *emu, sensorhub_t *sh);
+
+/// Let simulated time pass, queueing the sensor reports that fall due.
+void bnoemu_advance(bnoemu_t *emu, uint32_t us);
+
+/// Restart the hub as if its watchdog fired or its supply browned out: sensors are turned off and a reset indication
+/// follows the boot. With BOOTN low it starts its bootloader instead.
+void bnoemu_resetHub(bnoemu_t *emu);
+
+/// Queue an input report as if the hub had just produced it, e.g. one from a capture; false if it was dropped.
+bool bnoemu_pushReport(bnoemu_t *emu, const uint8_t *report);
+
+/// NAK the next count transactions, then every `every`-th one (0 for none).
+void bnoemu_injectNaks(bnoemu_t *emu, uint32_t count, uint32_t every);
+
+/// Store an FRS record as if it had been written earlier; length 0 empties it.
+bool bnoemu_setFrs(bnoemu_t *emu, uint16_t type, const uint32_t *data, uint16_t length);
+
+/// The stored record of that type, or NULL.
+const bnoemu_frs_t *bnoemu_getFrs(const bnoemu_t *emu, uint16_t type);
+
+/// Simulated time in microseconds.
+uint64_t bnoemu_nowUs(const bnoemu_t *emu);
+
+/// Memory read by pgm_read_byte_far() in the host build of sensorhub.c, so the PROGMEM DFU paths can run.
+void bnoemu_setFarMemory(const uint8_t *data, uint32_t length);
+uint8_t bnoemu_farRead(uint32_t address);
+
+/// CRC-16/CCITT seeded with crc, as used by the BNO070 bootloader.
+uint16_t bnoemu_crc16(uint16_t crc, const uint8_t *data, uint32_t length);
+
+#endif /* BNO_EMULATOR_H_ */
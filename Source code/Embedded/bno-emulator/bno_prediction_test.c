@@ -0,0 +1,323 @@
+/*
+ * bno_prediction_test.c
+ *
+ * Checks the orientation prediction (BNO070_Prediction.c) against gyro and orientation traces as the hub reports them
+ * at 1 kHz: Q14 quaternions and Q9 rates, with the orientation from exact integration of the rates. Each orientation
+ * sample is predicted with the gyro sample beside it and compared with the orientation recorded one horizon later.
+ * A capture from bno-bench or bno-capture can be given to check recorded reports the same way. The exit status is
+ * non-zero if any check failed.
+ *
+ * Usage: bno-prediction-test [capture]
+ */
+
+#include "BNO070_Prediction.h"
+#include "capture_file.h"
+#include "sensorhub.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRACE_SAMPLES 4000  // 4 s at 1 kHz
+#define INTEGRATION_STEPS 100  // per sample
+
+static int failures_ = 0;
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+static void check(bool ok, const char *what, int line)
+{
+	if (!ok)
+	{
+		failures_++;
+		printf("    FAILED at line %d: %s\n", line, what);
+	}
+}
+
+typedef struct
+{
+	int16_t quat[4];  // i, j, k, real, Q14
+	int16_t gyro[3];  // rad/s, Q9, sensor frame
+} sample_t;
+
+static sample_t trace_[TRACE_SAMPLES];
+
+/// Angular velocity of a trace at time t, in rad/s.
+typedef void (*motion_t)(double t, double w[3]);
+
+static void slowYaw(double t, double w[3])
+{
+	w[0] = 0;
+	w[1] = 0;
+	w[2] = 1;
+}
+
+/// A fast head turn: 6 rad/s about an axis tilted off vertical.
+static void fastTurn(double t, double w[3])
+{
+	w[0] = 6 * 0.267;
+	w[1] = 6 * 0.535;
+	w[2] = 6 * 0.802;
+}
+
+/// Looking around: nods, turns and tilts at different rates, up to a few rad/s.
+static void lookingAround(double t, double w[3])
+{
+	w[0] = 2.0 * sin(2 * M_PI * 0.7 * t);
+	w[1] = 3.0 * sin(2 * M_PI * 0.5 * t + 1);
+	w[2] = 1.5 * sin(2 * M_PI * 1.1 * t + 2);
+}
+
+/// q = q * exp(w dt / 2), with w in the body frame as the gyro reports it.
+static void rotate(double q[4], const double w[3], double dt)
+{
+	double rate = sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+	if (rate == 0)
+	{
+		return;
+	}
+	double s = sin(rate * dt / 2) / rate;
+	double d[4] = {w[0] * s, w[1] * s, w[2] * s, cos(rate * dt / 2)};
+	double r[4];
+
+	r[3] = q[3] * d[3] - q[0] * d[0] - q[1] * d[1] - q[2] * d[2];
+	r[0] = q[3] * d[0] + q[0] * d[3] + q[1] * d[2] - q[2] * d[1];
+	r[1] = q[3] * d[1] + q[1] * d[3] + q[2] * d[0] - q[0] * d[2];
+	r[2] = q[3] * d[2] + q[2] * d[3] + q[0] * d[1] - q[1] * d[0];
+	memcpy(q, r, sizeof(r));
+}
+
+static int16_t toFixed(double value, int q)
+{
+	return (int16_t)lrint(value * (1 << q));
+}
+
+/// Record a trace as the hub would report it, starting from an arbitrary orientation.
+static void record(motion_t motion)
+{
+	double q[4] = {0.2, -0.1, 0.3, 0.927};
+	double norm = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+	double w[3];
+
+	for (int i = 0; i < 4; i++)
+	{
+		q[i] /= norm;
+	}
+	for (int n = 0; n < TRACE_SAMPLES; n++)
+	{
+		double t = n / 1000.0;
+		motion(t, w);
+		for (int i = 0; i < 4; i++)
+		{
+			trace_[n].quat[i] = toFixed(q[i], 14);
+		}
+		for (int i = 0; i < 3; i++)
+		{
+			trace_[n].gyro[i] = toFixed(w[i], 9);
+		}
+		for (int step = 0; step < INTEGRATION_STEPS; step++)
+		{
+			motion(t + step / (1000.0 * INTEGRATION_STEPS), w);
+			rotate(q, w, 1 / (1000.0 * INTEGRATION_STEPS));
+		}
+	}
+}
+
+/// Angle between two orientations in degrees; neither has to be exactly unit length.
+static double angleDeg(const int16_t a[4], const int16_t b[4])
+{
+	double dot = 0;
+	double na = 0;
+	double nb = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		dot += (double)a[i] * b[i];
+		na += (double)a[i] * a[i];
+		nb += (double)b[i] * b[i];
+	}
+	double c = fabs(dot) / sqrt(na * nb);
+	return 2 * acos((c > 1) ? 1 : c) * 180 / M_PI;
+}
+
+typedef struct
+{
+	double maxError;
+	double meanError;
+	double maxHeld;  // error of sending the orientation as it is
+	double meanHeld;
+} result_t;
+
+/// Predict each sample `horizon` ms ahead and compare with the sample recorded then.
+static result_t evaluate(const sample_t *samples, int count, uint8_t horizon)
+{
+	result_t result = {0};
+	int compared = 0;
+
+	CHECK(Prediction_SetHorizon(horizon));
+	for (int n = 0; n + horizon < count; n++)
+	{
+		int16_t q[4];
+		memcpy(q, samples[n].quat, sizeof(q));
+		Prediction_UpdateGyro(samples[n].gyro);
+		Prediction_Apply(q);
+
+		double error = angleDeg(q, samples[n + horizon].quat);
+		double held = angleDeg(samples[n].quat, samples[n + horizon].quat);
+		result.maxError = (error > result.maxError) ? error : result.maxError;
+		result.maxHeld = (held > result.maxHeld) ? held : result.maxHeld;
+		result.meanError += error;
+		result.meanHeld += held;
+		compared++;
+	}
+	if (compared)
+	{
+		result.meanError /= compared;
+		result.meanHeld /= compared;
+	}
+	Prediction_Reset();
+	return result;
+}
+
+static const uint8_t horizons_[] = {10, 25, PREDICTION_MAX_HORIZON_MS};
+
+/// Check one trace at each horizon against the largest error allowed there, in degrees.
+static void checkTrace(const char *name, const sample_t *samples, int count, const double bounds[3])
+{
+	for (int h = 0; h < (int)sizeof(horizons_); h++)
+	{
+		result_t result = evaluate(samples, count, horizons_[h]);
+		printf("  %-22s %2u ms  error %6.3f deg max %6.3f mean, held %6.3f deg max\n", name, horizons_[h],
+		       result.maxError, result.meanError, result.maxHeld);
+		CHECK(result.maxError <= bounds[h]);
+		CHECK(result.meanError < result.meanHeld / 4);
+	}
+}
+
+/// Orientation and gyro reports from a capture, paired as the tracker pairs them.
+static int loadCapture(const char *path, sample_t *samples, int maxSamples)
+{
+	FILE *file = fopen(path, "rb");
+	bnocap_record_t record;
+	int16_t gyro[3] = {0, 0, 0};
+	bool haveGyro = false;
+	int count = 0;
+
+	CHECK(file && bnocap_readHeader(file));
+	if (!file)
+	{
+		return 0;
+	}
+	while (count < maxSamples && bnocap_readRecord(file, &record) == 1)
+	{
+		const uint8_t *report = record.report;
+		if (record.lost)
+		{
+			// a gap would pair samples a horizon apart in the file but not in time
+			count = 0;
+			continue;
+		}
+		if (report[2] == SENSORHUB_GYROSCOPE_CALIBRATED)
+		{
+			for (int i = 0; i < 3; i++)
+			{
+				gyro[i] = (int16_t)(report[6 + 2 * i] | (report[7 + 2 * i] << 8));
+			}
+			haveGyro = true;
+		}
+		else if (haveGyro && report[2] == SENSORHUB_GAME_ROTATION_VECTOR)
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				samples[count].quat[i] = (int16_t)(report[6 + 2 * i] | (report[7 + 2 * i] << 8));
+			}
+			memcpy(samples[count].gyro, gyro, sizeof(gyro));
+			count++;
+		}
+	}
+	fclose(file);
+	return count;
+}
+
+static void horizonLimits(void)
+{
+	CHECK(Prediction_SetHorizon(0) && Prediction_GetHorizon() == 0);
+	CHECK(Prediction_SetHorizon(PREDICTION_MAX_HORIZON_MS) && Prediction_GetHorizon() == PREDICTION_MAX_HORIZON_MS);
+	CHECK(!Prediction_SetHorizon(PREDICTION_MAX_HORIZON_MS + 1));
+	CHECK(!Prediction_SetHorizon(255));
+	CHECK(Prediction_GetHorizon() == PREDICTION_MAX_HORIZON_MS);
+
+	// horizon 0 leaves the orientation alone, whatever the gyro says
+	int16_t gyro[3] = {512, -512, 1024};
+	int16_t q[4] = {3000, -2000, 5000, 15000};
+	int16_t before[4];
+	memcpy(before, q, sizeof(q));
+	CHECK(Prediction_SetHorizon(0));
+	Prediction_UpdateGyro(gyro);
+	Prediction_Apply(q);
+	CHECK(!memcmp(q, before, sizeof(q)));
+
+	// full-scale rates at the longest horizon: nothing wraps, and the result stays a roughly unit orientation on the
+	// same side as the input, turned well away from it
+	static const int16_t fullScale[][3] = {
+	    {INT16_MAX, 0, 0}, {0, INT16_MIN, 0}, {0, 0, INT16_MAX}, {INT16_MAX, INT16_MAX, INT16_MAX},
+	    {INT16_MIN, INT16_MAX, INT16_MIN}};
+	static const int16_t starts[][4] = {{0, 0, 0, 16384}, {0, 0, 0, -16384}, {16384, 0, 0, 0}, {8192, -8192, 8192, 8192}};
+	CHECK(Prediction_SetHorizon(PREDICTION_MAX_HORIZON_MS));
+	for (int g = 0; g < (int)(sizeof(fullScale) / sizeof(fullScale[0])); g++)
+	{
+		for (int s = 0; s < (int)(sizeof(starts) / sizeof(starts[0])); s++)
+		{
+			memcpy(q, starts[s], sizeof(q));
+			Prediction_UpdateGyro(fullScale[g]);
+			Prediction_Apply(q);
+
+			double dot = 0;
+			double norm = 0;
+			for (int i = 0; i < 4; i++)
+			{
+				dot += (double)q[i] * starts[s][i] / (16384.0 * 16384.0);
+				norm += (double)q[i] * q[i] / (16384.0 * 16384.0);
+			}
+			CHECK(dot > 0);
+			CHECK(norm > 0.5 * 0.5 && norm < 1.1 * 1.1);
+			CHECK(angleDeg(q, starts[s]) > 30);
+		}
+	}
+	Prediction_Reset();
+}
+
+int main(int argc, char **argv)
+{
+	// constant rates only leave the first-order step and the fixed point; changing rates add what the gyro cannot
+	// know about the horizon ahead
+	static const double constantBounds[3] = {0.05, 0.08, 0.25};
+	static const double lookingBounds[3] = {0.15, 0.5, 1.8};
+
+	if (argc > 2)
+	{
+		fprintf(stderr, "usage: %s [capture]\n", argv[0]);
+		return 2;
+	}
+
+	printf("horizon limits and full-scale rates\n");
+	horizonLimits();
+
+	printf("prediction error against the orientation one horizon later\n");
+	record(slowYaw);
+	checkTrace("yaw 1 rad/s", trace_, TRACE_SAMPLES, constantBounds);
+	record(fastTurn);
+	checkTrace("turn 6 rad/s", trace_, TRACE_SAMPLES, constantBounds);
+	record(lookingAround);
+	checkTrace("looking around", trace_, TRACE_SAMPLES, lookingBounds);
+
+	if (argc == 2)
+	{
+		int count = loadCapture(argv[1], trace_, TRACE_SAMPLES);
+		CHECK(count > 2 * PREDICTION_MAX_HORIZON_MS);
+		checkTrace(argv[1], trace_, count, constantBounds);
+	}
+
+	printf(failures_ ? "%d checks FAILED\n" : "all checks passed\n", failures_);
+	return failures_ ? 1 : 0;
+}
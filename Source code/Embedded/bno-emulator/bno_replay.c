@@ -0,0 +1,403 @@
+/*
+ * bno_replay.c
+ *
+ * Feeds a capture file (see capture_file.h) through the sensorhub library and the tracker's report building, for
+ * benchmarks driven by recorded head motion:
+ *  - throughput: the reports are served from memory as fast as sensorhub_poll() takes them, decoded and built into
+ *    tracker reports and packed samples, and the host CPU time per report is measured;
+ *  - latency: the reports are queued in the BNO070 emulator at their recorded INTN times and read over the simulated
+ *    bus, as soon as INTN is seen, with 18-byte and length-prefixed reads; the time from INTN to each report's read
+ *    completing is what the tracker would add before decoding at that bus speed.
+ * The exit status is non-zero if the file is malformed or the library reported an error.
+ *
+ * Usage: bno-replay [-v] [-r repeats] [-b busHz] file
+ */
+
+#include "bno_emulator.h"
+#include "capture_file.h"
+#include "sensorhub.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define PACKED_HEADER_SIZE 4
+#define PACKED_SAMPLE_SIZE 20
+
+typedef struct
+{
+	uint64_t timeUs;  // INTN time, unwrapped and relative to the first report
+	uint8_t report[BNO070_MAX_INPUT_REPORT_LEN];
+} replay_record_t;
+
+/// Stand-in for the firmware's report building: what handleEvent() makes of the tracker's orientation and gyro.
+typedef struct
+{
+	uint8_t tracker[16];  // version 4 report: sequence, quaternion, INTN time, BNO delay
+	uint8_t packet[64];   // packed report of fused samples
+	uint8_t packedCount;
+	int16_t gyro[3];
+	uint32_t trackerReports;
+	uint32_t packets;
+} builder_t;
+
+static replay_record_t *records_ = NULL;
+static uint32_t recordCount_ = 0;
+static uint32_t lost_ = 0;  // reports the tracker dropped while capturing
+static uint32_t position_ = 0;
+static sensorhub_t sh_;
+static sensorhub_stats_t shStats_;
+static bnoemu_t emu_;
+static bool verbose_ = false;
+static uint32_t errors_ = 0;
+static uint32_t sensorEvents_[256];
+
+/* Latency replay: INTN times of the reports queued in the emulator, oldest first */
+static uint64_t *pendingUs_ = NULL;
+static uint32_t pendingHead_ = 0;
+static uint32_t pendingTail_ = 0;
+static uint32_t *latencyUs_ = NULL;
+static uint32_t latencyCount_ = 0;
+
+static void onError(const sensorhub_t *sh, int err) { errors_++; }
+static void debugPrintf(const char *format, ...)
+{
+	if (verbose_)
+	{
+		va_list args;
+		va_start(args, format);
+		vprintf(format, args);
+		va_end(args);
+	}
+}
+
+/// Far addresses are offsets into the memory given to bnoemu_setFarMemory().
+uint32_t dfuAddr(uint32_t index) { return index; }
+
+static uint64_t cpuNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static bool load(const char *path)
+{
+	FILE *file = fopen(path, "rb");
+	if (!file)
+	{
+		perror(path);
+		return false;
+	}
+	if (!bnocap_readHeader(file))
+	{
+		fprintf(stderr, "%s: not a capture file\n", path);
+		fclose(file);
+		return false;
+	}
+
+	uint32_t capacity = 0;
+	uint64_t now = 0;
+	uint32_t last = 0;
+	bnocap_record_t record;
+	int rc;
+	while ((rc = bnocap_readRecord(file, &record)) > 0)
+	{
+		if (record.lost)
+		{
+			lost_ += record.lost;
+			continue;
+		}
+		if (recordCount_ == capacity)
+		{
+			capacity = capacity ? 2 * capacity : 4096;
+			records_ = realloc(records_, capacity * sizeof(*records_));
+			if (!records_)
+			{
+				fprintf(stderr, "out of memory\n");
+				exit(1);
+			}
+		}
+		uint32_t step = record.timeUs - last;
+		if (recordCount_ != 0 && step < 0x80000000u)  // the clock wraps; it never steps back
+		{
+			now += step;
+		}
+		last = record.timeUs;
+		records_[recordCount_].timeUs = now;
+		memcpy(records_[recordCount_].report, record.report, sizeof(record.report));
+		recordCount_++;
+	}
+	fclose(file);
+	if (rc < 0)
+	{
+		fprintf(stderr, "%s: malformed record after %lu reports\n", path, (unsigned long)recordCount_);
+		return false;
+	}
+	return true;
+}
+
+static void build(builder_t *b, const sensorhub_Event_t *event, uint32_t timestamp)
+{
+	sensorEvents_[event->sensor]++;
+	switch (event->sensor)
+	{
+	case SENSORHUB_ROTATION_VECTOR:
+	case SENSORHUB_GAME_ROTATION_VECTOR:
+	{
+		uint16_t delay = (uint16_t)event->delay << ((event->status >> 2) & 0x7);
+		b->tracker[1] = event->sequenceNumber;
+		memcpy(&b->tracker[2], &event->un.rotationVector.i_16Q14, 8);
+		memcpy(&b->tracker[10], &timestamp, 4);
+		memcpy(&b->tracker[14], &delay, 2);
+		b->trackerReports++;
+
+		uint8_t *sample = &b->packet[PACKED_HEADER_SIZE + b->packedCount * PACKED_SAMPLE_SIZE];
+		uint32_t sampleTime = timestamp - delay;
+		memcpy(&sample[0], &sampleTime, 4);
+		sample[4] = event->sequenceNumber;
+		sample[5] = event->status;
+		memcpy(&sample[6], &b->tracker[2], 8);
+		memcpy(&sample[14], b->gyro, 6);
+		if (++b->packedCount == (sizeof(b->packet) - PACKED_HEADER_SIZE) / PACKED_SAMPLE_SIZE)
+		{
+			b->packet[1] = b->packedCount;
+			b->packedCount = 0;
+			b->packets++;
+		}
+		break;
+	}
+	case SENSORHUB_GYROSCOPE_CALIBRATED:
+		memcpy(b->gyro, &event->un.gyroscope.x_16Q9, 6);
+		break;
+	}
+}
+
+/* ---- Throughput: reports served from memory ---- */
+
+static int memDataReady(const sensorhub_t *sh) { return position_ < recordCount_; }
+
+static int memReadReport(const sensorhub_t *sh, uint8_t address, uint8_t *receiveData, int maxLength)
+{
+	memset(receiveData, 0, maxLength);
+	if (position_ < recordCount_)
+	{
+		const uint8_t *report = records_[position_++].report;
+		memcpy(receiveData, report, (report[0] < maxLength) ? report[0] : maxLength);
+	}
+	return SENSORHUB_STATUS_SUCCESS;
+}
+
+static void memDelay(const sensorhub_t *sh, int milliseconds) {}
+static uint32_t memTick(const sensorhub_t *sh) { return 0; }
+
+static void throughput(uint32_t repeats)
+{
+	sensorhub_Event_t event;
+	builder_t builder;
+	uint32_t resets = 0;
+
+	memset(&sh_, 0, sizeof(sh_));
+	memset(&shStats_, 0, sizeof(shStats_));
+	memset(&builder, 0, sizeof(builder));
+	sh_.stats = &shStats_;
+	sh_.onError = onError;
+	sh_.debugPrintf = debugPrintf;
+	sh_.getDataReady = memDataReady;
+	sh_.i2cReadReport = memReadReport;
+	sh_.delay = memDelay;
+	sh_.getTick = memTick;
+
+	uint64_t start = cpuNs();
+	for (uint32_t r = 0; r < repeats; r++)
+	{
+		position_ = 0;
+		while (position_ < recordCount_)
+		{
+			// one event at a time, so the last report read is the one it came from
+			int count = 0;
+			int rc = sensorhub_poll(&sh_, &event, 1, &count);
+			if (count)
+			{
+				build(&builder, &event, (uint32_t)records_[position_ - 1].timeUs);
+			}
+			resets += (rc == SENSORHUB_STATUS_HUB_RESET);
+		}
+	}
+	double ns = (double)(cpuNs() - start);
+
+	double reports = (double)recordCount_ * repeats;
+	printf("  decode and build: %.0f ns per report, %.0f reports/s (%lu tracker reports, %lu packed, %lu hub resets)\n",
+	       ns / reports, reports * 1e9 / ns, (unsigned long)builder.trackerReports, (unsigned long)builder.packets,
+	       (unsigned long)resets);
+}
+
+/* ---- Latency: reports queued in the emulator at their INTN times ---- */
+
+/// Called as each report has been read; its INTN time is the oldest still pending.
+static bool noteRead(const sensorhub_t *sh, const uint8_t *report)
+{
+	if (pendingHead_ != pendingTail_)
+	{
+		latencyUs_[latencyCount_++] = (uint32_t)(bnoemu_nowUs(&emu_) - pendingUs_[pendingHead_++]);
+	}
+	return false;
+}
+
+static int compareU32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+	return (x > y) - (x < y);
+}
+
+static void latency(const char *name, uint32_t busHz, bool lengthPrefixed)
+{
+	sensorhub_Event_t event;
+	builder_t builder;
+
+	bnoemu_init(&emu_);
+	emu_.busHz = busHz;
+	memset(&sh_, 0, sizeof(sh_));
+	memset(&shStats_, 0, sizeof(shStats_));
+	memset(&builder, 0, sizeof(builder));
+	sh_.stats = &shStats_;
+	sh_.onError = onError;
+	sh_.debugPrintf = debugPrintf;
+	sh_.max_retries = 5;
+	bnoemu_attach(&emu_, &sh_);
+	if (!lengthPrefixed)
+	{
+		sh_.i2cReadReport = NULL;
+	}
+	sh_.takeReport = noteRead;
+	pendingHead_ = pendingTail_ = 0;
+	latencyCount_ = 0;
+
+	uint32_t next = 0;
+	while (next < recordCount_ || emu_.queueCount)
+	{
+		while (next < recordCount_ && records_[next].timeUs <= bnoemu_nowUs(&emu_))
+		{
+			if (bnoemu_pushReport(&emu_, records_[next].report))
+			{
+				pendingUs_[pendingTail_++] = records_[next].timeUs;
+			}
+			next++;
+		}
+		if (emu_.queueCount)
+		{
+			// one report at a time, so those arriving meanwhile are queued before the next read
+			int count = 0;
+			sensorhub_poll(&sh_, &event, 1, &count);
+			if (count)
+			{
+				build(&builder, &event, (uint32_t)bnoemu_nowUs(&emu_));
+			}
+		}
+		else if (next < recordCount_)
+		{
+			bnoemu_advance(&emu_, (uint32_t)(records_[next].timeUs - bnoemu_nowUs(&emu_)));
+		}
+	}
+
+	if (latencyCount_ == 0)
+	{
+		return;
+	}
+	uint64_t sum = 0;
+	for (uint32_t i = 0; i < latencyCount_; i++)
+	{
+		sum += latencyUs_[i];
+	}
+	qsort(latencyUs_, latencyCount_, sizeof(latencyUs_[0]), compareU32);
+	double seconds = bnoemu_nowUs(&emu_) / 1e6;
+	printf("  %-34s INTN to read %6.1f us mean %5lu us median %5lu us 99%% %5lu us max, bus %4.1f%% busy, %lu "
+	       "dropped\n",
+	       name, (double)sum / latencyCount_, (unsigned long)latencyUs_[latencyCount_ / 2],
+	       (unsigned long)latencyUs_[(uint32_t)(latencyCount_ * 0.99)], (unsigned long)latencyUs_[latencyCount_ - 1],
+	       seconds > 0 ? emu_.stats.busNs / 1e7 / seconds : 0.0, (unsigned long)emu_.stats.dropped);
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t repeats = 20;
+	uint32_t busHz = 400000;
+	const char *path = NULL;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-v"))
+		{
+			verbose_ = true;
+		}
+		else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+		{
+			repeats = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (!strcmp(argv[i], "-b") && i + 1 < argc)
+		{
+			busHz = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (!path && argv[i][0] != '-')
+		{
+			path = argv[i];
+		}
+		else
+		{
+			path = NULL;
+			break;
+		}
+	}
+	if (!path || repeats == 0 || busHz == 0)
+	{
+		fprintf(stderr, "usage: %s [-v] [-r repeats] [-b busHz] file\n", argv[0]);
+		return 2;
+	}
+
+	if (!load(path))
+	{
+		return 1;
+	}
+	if (recordCount_ == 0)
+	{
+		fprintf(stderr, "%s: no reports\n", path);
+		return 1;
+	}
+	pendingUs_ = malloc(recordCount_ * sizeof(*pendingUs_));
+	latencyUs_ = malloc(recordCount_ * sizeof(*latencyUs_));
+	if (!pendingUs_ || !latencyUs_)
+	{
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+
+	double seconds = records_[recordCount_ - 1].timeUs / 1e6;
+	printf("%s: %lu reports over %.1f s (%.0f/s), %lu dropped by the tracker while capturing\n", path,
+	       (unsigned long)recordCount_, seconds, seconds > 0 ? recordCount_ / seconds : 0.0, (unsigned long)lost_);
+
+	throughput(repeats);
+	printf("  events per replay:");
+	for (int i = 0; i < 256; i++)
+	{
+		if (sensorEvents_[i])
+		{
+			printf(" 0x%02x: %lu", i, (unsigned long)(sensorEvents_[i] / repeats));
+		}
+	}
+	printf("\n");
+
+	char name[40];
+	snprintf(name, sizeof(name), "%lu kHz, 18-byte reads", (unsigned long)(busHz / 1000));
+	latency(name, busHz, false);
+	snprintf(name, sizeof(name), "%lu kHz, length-prefixed reads", (unsigned long)(busHz / 1000));
+	latency(name, busHz, true);
+
+	if (errors_)
+	{
+		printf("%lu library errors\n", (unsigned long)errors_);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * bno_source_fade_test.c
+ *
+ * Runs the orientation source cross-fade (BNO070_SourceFade.c) through a switch that completes, a switch whose new
+ * source never reports, one whose new source reports late, and a switch without a fade. The exit status is non-zero
+ * if any check failed.
+ */
+
+#include "BNO070_SourceFade.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define RV 0   // BNO_USE_ values
+#define GRV 1
+
+static int failures_ = 0;
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+static void check(bool ok, const char *what, int line)
+{
+	if (!ok)
+	{
+		failures_++;
+		printf("    FAILED at line %d: %s\n", line, what);
+	}
+}
+
+// the two sources 90 degrees apart in heading
+static const int16_t grvSample_[4] = {0, 0, 0, 16384};
+static const int16_t rvSample_[4] = {0, 0, 11585, 11585};
+
+static double length(const int16_t q[4])
+{
+	double sum = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		sum += (double)q[i] * q[i];
+	}
+	return sqrt(sum) / 16384;
+}
+
+static void completes(void)
+{
+	int16_t quat[4];
+
+	SourceFade_Reset();
+	SourceFade_Begin(GRV, 1000);
+	CHECK(SourceFade_From() == GRV);
+
+	// the old source is reported until the new one's first sample
+	CHECK(SourceFade_Sample(GRV, RV, grvSample_, 1010, quat) && !memcmp(quat, grvSample_, 8));
+	CHECK(SourceFade_Sample(RV, RV, rvSample_, 1020, quat) && !memcmp(quat, grvSample_, 8));
+
+	// then only the new one, blended with the latest old sample
+	CHECK(!SourceFade_Sample(GRV, RV, grvSample_, 1030, quat));
+	CHECK(SourceFade_Sample(RV, RV, rvSample_, 1020 + 256, quat));
+	CHECK(quat[2] > 2000 && quat[2] < 11585 - 2000 && fabs(length(quat) - 1) < 0.002);
+	CHECK(SourceFade_TakeFadedOut() == SOURCE_FADE_NONE);
+	CHECK(SourceFade_Expire(1020 + 5000) == SOURCE_FADE_NONE);
+
+	// and the old source is handed back to be turned off once the fade is over
+	CHECK(SourceFade_Sample(RV, RV, rvSample_, 1020 + 512, quat) && !memcmp(quat, rvSample_, 8));
+	CHECK(SourceFade_From() == SOURCE_FADE_NONE);
+	CHECK(SourceFade_TakeFadedOut() == GRV);
+	CHECK(SourceFade_TakeFadedOut() == SOURCE_FADE_NONE);
+	CHECK(!SourceFade_Sample(GRV, RV, grvSample_, 1600, quat));
+}
+
+static void neverReports(void)
+{
+	int16_t quat[4];
+
+	SourceFade_Reset();
+	SourceFade_Begin(GRV, 1000);
+	for (uint32_t ms = 1000; ms < 1000 + SOURCE_FADE_TIMEOUT_MS; ms += 10)
+	{
+		CHECK(SourceFade_Sample(GRV, RV, grvSample_, ms, quat) && !memcmp(quat, grvSample_, 8));
+		CHECK(SourceFade_Expire(ms) == SOURCE_FADE_NONE);
+	}
+
+	// the switch is given up once, handing back the source to select again
+	CHECK(SourceFade_Expire(1000 + SOURCE_FADE_TIMEOUT_MS) == GRV);
+	CHECK(SourceFade_From() == SOURCE_FADE_NONE);
+	CHECK(SourceFade_Expire(1000 + SOURCE_FADE_TIMEOUT_MS + 10) == SOURCE_FADE_NONE);
+	CHECK(SourceFade_TakeFadedOut() == SOURCE_FADE_NONE);
+
+	// with the old source selected again its samples go straight out, and a straggler from the new one is dropped
+	CHECK(SourceFade_Sample(GRV, GRV, grvSample_, 2100, quat) && !memcmp(quat, grvSample_, 8));
+	CHECK(!SourceFade_Sample(RV, GRV, rvSample_, 2110, quat));
+}
+
+static void reportsLate(void)
+{
+	int16_t quat[4];
+
+	// the deadline runs from the switch, and a first sample before it ends the wait
+	SourceFade_Reset();
+	SourceFade_Begin(GRV, 0xFFFFFF00);  // across the millisecond counter wrapping
+	CHECK(SourceFade_Sample(GRV, RV, grvSample_, 0xFFFFFF10, quat));
+	CHECK(SourceFade_Expire(0xFFFFFF00 + SOURCE_FADE_TIMEOUT_MS - 1) == SOURCE_FADE_NONE);
+	CHECK(SourceFade_Sample(RV, RV, rvSample_, 0xFFFFFF00 + SOURCE_FADE_TIMEOUT_MS - 1, quat));
+	CHECK(SourceFade_Expire(0xFFFFFF00 + 3 * SOURCE_FADE_TIMEOUT_MS) == SOURCE_FADE_NONE);
+	CHECK(SourceFade_From() == GRV);
+}
+
+static void withoutFade(void)
+{
+	int16_t quat[4];
+
+	SourceFade_Reset();
+	SourceFade_Begin(SOURCE_FADE_NONE, 1000);
+	CHECK(SourceFade_Expire(1000 + 10 * SOURCE_FADE_TIMEOUT_MS) == SOURCE_FADE_NONE);
+	CHECK(!SourceFade_Sample(GRV, RV, grvSample_, 1010, quat));
+	CHECK(SourceFade_Sample(RV, RV, rvSample_, 1020, quat) && !memcmp(quat, rvSample_, 8));
+	CHECK(SourceFade_TakeFadedOut() == SOURCE_FADE_NONE);
+}
+
+int main(void)
+{
+	printf("switch that completes\n");
+	completes();
+	printf("new source never reports\n");
+	neverReports();
+	printf("new source reports late\n");
+	reportsLate();
+	printf("switch without a fade\n");
+	withoutFade();
+
+	printf(failures_ ? "%d checks FAILED\n" : "all checks passed\n", failures_);
+	return failures_ ? 1 : 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * capture_file.c
+ *
+ * Reading and writing the capture files described in capture_file.h.
+ */
+
+#include "capture_file.h"
+
+#include <string.h>
+
+#define STAMP_SIZE 4
+
+static const uint8_t header_[8] = {'B', 'N', 'O', 'C', 'A', 'P', 0, BNOCAP_VERSION};
+
+static inline uint32_t read32(const uint8_t *buffer)
+{
+	return buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+static inline void write32(uint8_t *buffer, uint32_t value)
+{
+	buffer[0] = (uint8_t)value;
+	buffer[1] = (uint8_t)(value >> 8);
+	buffer[2] = (uint8_t)(value >> 16);
+	buffer[3] = (uint8_t)(value >> 24);
+}
+
+static inline bool validLength(uint8_t length) { return length >= 2 && length <= BNO070_MAX_INPUT_REPORT_LEN; }
+
+bool bnocap_writeHeader(FILE *file) { return fwrite(header_, sizeof(header_), 1, file) == 1; }
+
+bool bnocap_writeRecord(FILE *file, const bnocap_record_t *record)
+{
+	uint8_t out[STAMP_SIZE + BNO070_MAX_INPUT_REPORT_LEN];
+	size_t size;
+
+	write32(out, record->timeUs);
+	if (record->lost)
+	{
+		out[STAMP_SIZE] = 0;
+		out[STAMP_SIZE + 1] = record->lost;
+		size = STAMP_SIZE + 2;
+	}
+	else
+	{
+		if (!validLength(record->report[0]))
+		{
+			return false;
+		}
+		memcpy(&out[STAMP_SIZE], record->report, record->report[0]);
+		size = STAMP_SIZE + record->report[0];
+	}
+	return fwrite(out, size, 1, file) == 1;
+}
+
+bool bnocap_readHeader(FILE *file)
+{
+	uint8_t in[sizeof(header_)];
+	return fread(in, sizeof(in), 1, file) == 1 && memcmp(in, header_, sizeof(in)) == 0;
+}
+
+int bnocap_readRecord(FILE *file, bnocap_record_t *record)
+{
+	uint8_t stamp[STAMP_SIZE + 1];
+
+	size_t got = fread(stamp, 1, sizeof(stamp), file);
+	if (got == 0)
+	{
+		return 0;
+	}
+	if (got != sizeof(stamp))
+	{
+		return -1;
+	}
+
+	memset(record, 0, sizeof(*record));
+	record->timeUs = read32(stamp);
+	uint8_t length = stamp[STAMP_SIZE];
+	if (length == 0)
+	{
+		int lost = fgetc(file);
+		if (lost == EOF || lost == 0)
+		{
+			return -1;
+		}
+		record->lost = (uint8_t)lost;
+		return 1;
+	}
+	if (!validLength(length))
+	{
+		return -1;
+	}
+	record->report[0] = length;
+	return fread(&record->report[1], length - 1, 1, file) == 1 ? 1 : -1;
+}
+
+int bnocap_parsePacket(const uint8_t *packet, int length, bnocap_record_t *records, int maxRecords)
+{
+	if (length < BNOCAP_PACKET_HEADER || (packet[0] & 0x0F) != BNOCAP_PACKET_VERSION || packet[2] != 0)
+	{
+		return -1;
+	}
+
+	int count = 0;
+	int offset = BNOCAP_PACKET_HEADER;
+	if (packet[3])
+	{
+		if (count == maxRecords)
+		{
+			return -1;
+		}
+		memset(&records[count], 0, sizeof(records[count]));
+		records[count].lost = packet[3];
+		count++;
+	}
+	for (int i = 0; i < packet[1]; i++)
+	{
+		if (offset + STAMP_SIZE + 1 > length || count == maxRecords)
+		{
+			return -1;
+		}
+		uint8_t reportLength = packet[offset + STAMP_SIZE];
+		if (!validLength(reportLength) || offset + STAMP_SIZE + reportLength > length)
+		{
+			return -1;
+		}
+		bnocap_record_t *record = &records[count++];
+		memset(record, 0, sizeof(*record));
+		record->timeUs = read32(&packet[offset]);
+		memcpy(record->report, &packet[offset + STAMP_SIZE], reportLength);
+		offset += STAMP_SIZE + reportLength;
+	}
+
+	// a gap record takes the time of the report after it, so time never steps back in the file
+	if (packet[3])
+	{
+		records[0].timeUs = (count > 1) ? records[1].timeUs : 0;
+	}
+	return count;
+}
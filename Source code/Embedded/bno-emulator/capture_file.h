@@ -0,0 +1,49 @@
+/*
+ * capture_file.h
+ *
+ * Recordings of the hub's input reports as streamed by the tracker in capture mode (#BCC01, or HID feature
+ * command 13). A file is an 8-byte header, "BNOCAP" then a zero byte and BNOCAP_VERSION, followed by records laid
+ * out as in the 64-byte capture packets:
+ *   INTN time of the report (MCU us, little-endian, 4), then the report as read, starting with its length byte.
+ * A record with length 0 marks reports the tracker dropped; the byte after it holds how many.
+ */
+
+#ifndef CAPTURE_FILE_H_
+#define CAPTURE_FILE_H_
+
+#include "sensorhub_hid.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define BNOCAP_VERSION 1
+
+/// Low nibble of byte 0 of a capture packet (CAPTURE_REPORT_VERSION in the firmware).
+#define BNOCAP_PACKET_VERSION 7
+#define BNOCAP_PACKET_SIZE 64
+#define BNOCAP_PACKET_HEADER 4
+
+typedef struct bnocap_record_s
+{
+	uint32_t timeUs;  // svr_clock_us() at the INTN edge; wraps every 71 minutes
+	uint8_t lost;     // for a gap record, the reports dropped before the next one; 0 for a report
+	uint8_t report[BNO070_MAX_INPUT_REPORT_LEN];  // report[0] is its length
+} bnocap_record_t;
+
+bool bnocap_writeHeader(FILE *file);
+bool bnocap_writeRecord(FILE *file, const bnocap_record_t *record);
+
+/// False if the file does not start with a capture header of this version.
+bool bnocap_readHeader(FILE *file);
+
+/// 1 when a record was read, 0 at the end of the file, -1 if it is truncated or malformed.
+int bnocap_readRecord(FILE *file, bnocap_record_t *record);
+
+/**
+ * Split one capture packet into records, a gap record first if the packet says reports were dropped.
+ * @return the number of records, or -1 if the packet is not a capture packet or is malformed.
+ */
+int bnocap_parsePacket(const uint8_t *packet, int length, bnocap_record_t *records, int maxRecords);
+
+#endif /* CAPTURE_FILE_H_ */
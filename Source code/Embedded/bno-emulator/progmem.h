@@ -0,0 +1,17 @@
+/*
+ * progmem.h
+ *
+ * Stands in for the ASF header when sensorhub.c is built on the host: far PROGMEM reads come from the memory given
+ * to bnoemu_setFarMemory().
+ */
+
+#ifndef PROGMEM_H_
+#define PROGMEM_H_
+
+#include <stdint.h>
+
+uint8_t bnoemu_farRead(uint32_t address);
+
+#define pgm_read_byte_far(address) bnoemu_farRead(address)
+
+#endif /* PROGMEM_H_ */
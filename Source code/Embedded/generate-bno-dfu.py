@@ -0,0 +1,241 @@
+#!/usr/bin/env python3
+
+"""Compress the BNO070 DFU images for PERFORM_BNO_DFU builds.
+
+Reads each src/DeviceDrivers/bno-hostif/1000-3251_<version>_avr.c image, LZ compresses its application bytes in the
+format decoded by sensorhub_dfu_avr_lz(), and writes 1000-3251_<version>_lz.c next to it. The stream header and the
+packet CRCs are left out; the firmware rebuilds them. Every image is decompressed again and rebuilt into a DFU stream
+that must match the original byte for byte before its file is written.
+"""
+
+import os
+import re
+import sys
+from collections import defaultdict
+
+IMAGES = ["1000-3251_1.7.0.390", "1000-3251_1.2.5"]
+
+WINDOW = 512  # DFU_LZ_WINDOW in sensorhub.h
+MIN_MATCH = 3
+MAX_MATCH = MIN_MATCH + 0x7F
+PAGE_SIZE = 30000  # keeps each PROGMEM array below 32 KB
+DFU_FORMAT = b"\x01\x01\x01\x01"
+
+
+def crc16(data):
+    """CRC-16/CCITT seeded with 0xFFFF, as checked by the BNO070 bootloader."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def with_crc(data):
+    return bytes(data) + crc16(data).to_bytes(2, "big")
+
+
+def read_avr_image(path):
+    """The DFU stream held in the dfuPage_N arrays of an _avr.c image."""
+    with open(path) as f:
+        text = f.read()
+    stream = bytearray()
+    for body in re.findall(r"dfuPage_\d+\[\d+\] PROGMEM = \{([^}]*)\}", text):
+        stream += bytes(int(value, 16) for value in re.findall(r"0x[0-9a-fA-F]+", body))
+    return bytes(stream)
+
+
+def split_stream(stream):
+    """Returns (application bytes, packet payload size), checking every CRC on the way."""
+    if stream[:4] != DFU_FORMAT:
+        raise ValueError("not a 0x01010101 DFU stream")
+    if stream[4:10] != with_crc(stream[4:8]) or stream[10:13] != with_crc(stream[10:11]):
+        raise ValueError("bad header CRC")
+    size = int.from_bytes(stream[4:8], "big")
+    payload = stream[10]
+
+    application = bytearray()
+    index = 13
+    while index < len(stream):
+        packet = stream[index:index + payload + 2]
+        if packet != with_crc(packet[:-2]):
+            raise ValueError("bad CRC in the packet at %d" % index)
+        application += packet[:-2]
+        index += len(packet)
+    if len(application) != size:
+        raise ValueError("application is %d bytes, header says %d" % (len(application), size))
+    return bytes(application), payload
+
+
+def build_stream(application, payload):
+    stream = bytearray(DFU_FORMAT)
+    stream += with_crc(len(application).to_bytes(4, "big"))
+    stream += with_crc(bytes([payload]))
+    for index in range(0, len(application), payload):
+        stream += with_crc(application[index:index + payload])
+    return bytes(stream)
+
+
+def compress(data):
+    """Greedy LZSS with hash chains over MIN_MATCH-byte prefixes."""
+    out = bytearray()
+    chains = defaultdict(list)
+    flags_at = 0
+    tokens = 8
+
+    def remember(position):
+        if position + MIN_MATCH <= len(data):
+            chains[data[position:position + MIN_MATCH]].append(position)
+
+    index = 0
+    while index < len(data):
+        if tokens == 8:
+            flags_at = len(out)
+            out.append(0)
+            tokens = 0
+
+        best_length, best_distance = 0, 0
+        for start in reversed(chains.get(data[index:index + MIN_MATCH], ())):
+            distance = index - start
+            if distance > WINDOW:
+                break
+            length = 0
+            while length < MAX_MATCH and index + length < len(data) and data[start + length] == data[index + length]:
+                length += 1
+            if length > best_length:
+                best_length, best_distance = length, distance
+                if length == MAX_MATCH:
+                    break
+
+        if best_length >= MIN_MATCH:
+            token = ((best_length - MIN_MATCH) << 9) | (best_distance - 1)
+            out += token.to_bytes(2, "little")
+            for position in range(index, index + best_length):
+                remember(position)
+            index += best_length
+        else:
+            out[flags_at] |= 1 << tokens
+            out.append(data[index])
+            remember(index)
+            index += 1
+        tokens += 1
+    return bytes(out)
+
+
+def decompress(data, size):
+    """Mirrors lz_next() in sensorhub.c, including its window, so the round trip checks the format it decodes."""
+    window = bytearray(WINDOW)
+    out = bytearray()
+    index = 0
+    flags, tokens = 0, 0
+    while len(out) < size:
+        if tokens == 0:
+            flags, tokens = data[index], 8
+            index += 1
+        tokens -= 1
+        literal = flags & 1
+        flags >>= 1
+        if literal:
+            byte = data[index]
+            index += 1
+            window[len(out) % WINDOW] = byte
+            out.append(byte)
+            continue
+        token = int.from_bytes(data[index:index + 2], "little")
+        index += 2
+        start = len(out) - 1 - (token & 0x1FF)
+        for offset in range((token >> 9) + MIN_MATCH):
+            byte = window[(start + offset) % WINDOW]
+            window[len(out) % WINDOW] = byte
+            out.append(byte)
+    if index != len(data) or len(out) != size:
+        raise ValueError("compressed image does not end where the application does")
+    return bytes(out)
+
+
+def c_array(name, data):
+    lines = ["static const uint8_t %s[%d] PROGMEM = {" % (name, len(data))]
+    for index in range(0, len(data), 16):
+        lines.append("    " + ",".join("0x%x" % byte for byte in data[index:index + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def write_c(path, source, prefix, application, payload, compressed):
+    pages = [compressed[index:index + PAGE_SIZE] for index in range(0, len(compressed), PAGE_SIZE)]
+    parts = [
+        "/* THIS IS A GENERATED FILE - DO NOT EDIT */",
+        "/* Compressed from %s by generate-bno-dfu.py: %d bytes for a %d-byte application. */"
+        % (source, len(compressed), len(application)),
+        "",
+        "#include <avr/pgmspace.h>",
+        "",
+        '#include "sensorhub.h"',
+        "",
+    ]
+    for number, page in enumerate(pages):
+        parts += [c_array("%s_page%d" % (prefix, number), page), ""]
+
+    parts += [
+        "#ifndef GET_FAR_ADDRESS",
+        "#define GET_FAR_ADDRESS(var)                                       \\",
+        "	({                                                             \\",
+        "		uint_farptr_t tmp;                                         \\",
+        "		__asm__ __volatile__(\"ldi    %A0, lo8(%1)\"    \"\\n\\t\"  \\",
+        "		                     \"ldi    %B0, hi8(%1)\"    \"\\n\\t\"  \\",
+        "		                     \"ldi    %C0, hh8(%1)\"    \"\\n\\t\"  \\",
+        "		                     \"clr    %D0\"             \"\\n\\t\"  \\",
+        "		                     : \"=d\"(tmp)                          \\",
+        "		                     : \"p\"(&(var)));                      \\",
+        "		tmp;                                                       \\",
+        "	})",
+        "#endif",
+        "",
+        "static uint32_t %s_addr(uint32_t index)" % prefix,
+        "{",
+        "	switch (index / %d)" % PAGE_SIZE,
+        "	{",
+    ]
+    for number in range(len(pages)):
+        parts += [
+            "	case %d:" % number,
+            "		return GET_FAR_ADDRESS(%s_page%d) + index %% %d;" % (prefix, number, PAGE_SIZE),
+        ]
+    parts += [
+        "	default:",
+        "		return 0;",
+        "	}",
+        "}",
+        "",
+        "const avrLzDfuStream_t %s = {" % prefix,
+        "    .applicationSize = %d," % len(application),
+        "    .compressedLength = %d," % len(compressed),
+        "    .packetPayloadSize = %d," % payload,
+        "    .addr = %s_addr," % prefix,
+        "};",
+        "",
+    ]
+    with open(path, "w") as f:
+        f.write("\n".join(parts))
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "src", "DeviceDrivers", "bno-hostif")
+    for image in IMAGES:
+        source = image + "_avr.c"
+        stream = read_avr_image(os.path.join(root, source))
+        application, payload = split_stream(stream)
+        compressed = compress(application)
+
+        if build_stream(decompress(compressed, len(application)), payload) != stream:
+            sys.exit("%s: round trip does not reproduce the DFU stream" % source)
+
+        prefix = "dfuStream_" + image.split("_", 1)[1].replace(".", "_")
+        write_c(os.path.join(root, image + "_lz.c"), source, prefix, application, payload, compressed)
+        print("%s: %d -> %d bytes, round trip exact" % (source, len(stream), len(compressed)))
+
+
+if __name__ == "__main__":
+    main()
@@ -96,9 +96,14 @@ COMPILER_WORD_ALIGNED
 static uint8_t udi_hid_generic_protocol;
 //! To signal if the report IN buffer is free (no transfer on going)
 static bool udi_hid_generic_b_report_in_free;
-//! Report to send
+
+//! True while the application holds back reception of the next OUT report
+static volatile bool udi_hid_generic_b_report_out_held;
+//! Report to send, sized for the largest report the endpoint can carry
 COMPILER_WORD_ALIGNED
-static uint8_t udi_hid_generic_report_in[UDI_HID_REPORT_IN_SIZE];
+static uint8_t udi_hid_generic_report_in[UDI_HID_GENERIC_EP_SIZE];
+//! Length of the IN report currently announced in the report descriptor
+static uint8_t udi_hid_generic_report_in_size = UDI_HID_REPORT_IN_SIZE;
 //! Report to receive
 COMPILER_WORD_ALIGNED
 static uint8_t udi_hid_generic_report_out[UDI_HID_REPORT_OUT_SIZE];
@@ -120,7 +125,7 @@ UDC_DESC_STORAGE udi_hid_generic_report_desc_t udi_hid_generic_report_desc = { {
         0x26, 0xFF, 0x00,	// 24|1   , Logical Maximum(255 for signed byte?)
         0x75, 0x08,	// 74|1   , Report Size(8) = field size in bits = 1 byte
         // 94|1   , ReportCount(size) = repeat count of previous item
-        0x95, sizeof(udi_hid_generic_report_in),
+        0x95, UDI_HID_REPORT_IN_SIZE,	// patched by udi_hid_generic_set_report_in_size()
         0x81, 0x02,	// 80|1   , IN report (Data,Variable, Absolute)
         // OUT report
         0x09, 0x04,	// 08|1   , Usage      (vendor defined)
@@ -143,6 +148,9 @@ UDC_DESC_STORAGE udi_hid_generic_report_desc_t udi_hid_generic_report_desc = { {
     }
 };
 
+//! Offset of the IN report count in udi_hid_generic_report_desc
+#define UDI_HID_GENERIC_REPORT_IN_COUNT_OFFSET 19
+
 /**
  * \name Internal routines
  */
@@ -198,6 +206,7 @@ bool udi_hid_generic_enable(void)
     udi_hid_generic_rate = 0;
     udi_hid_generic_protocol = 0;
     udi_hid_generic_b_report_in_free = true;
+    udi_hid_generic_b_report_out_held = false;
     if (!udi_hid_generic_report_out_enable())
         return false;
     return UDI_HID_GENERIC_ENABLE_EXT();
@@ -232,6 +241,17 @@ static bool udi_hid_generic_setreport(void)
             && (sizeof(udi_hid_generic_report_feature) ==
                 udd_g_ctrlreq.req.wLength)) {
         // Feature type on report ID 0
+#ifdef UDI_HID_GENERIC_GET_FEATURE
+        if (Udd_setup_is_in()) {
+            // GetFeature: let the application fill the report
+            UDI_HID_GENERIC_GET_FEATURE(udi_hid_generic_report_feature);
+            udd_g_ctrlreq.payload =
+                (uint8_t *) & udi_hid_generic_report_feature;
+            udd_g_ctrlreq.payload_size =
+                sizeof(udi_hid_generic_report_feature);
+            return true;
+        }
+#endif
         udd_g_ctrlreq.payload =
             (uint8_t *) & udi_hid_generic_report_feature;
         udd_g_ctrlreq.callback = udi_hid_generic_setfeature_valid;
@@ -251,19 +271,64 @@ bool udi_hid_generic_send_report_in(uint8_t *data)
         return false;
     irqflags_t flags = cpu_irq_save();
     // Fill report
-    memset(&udi_hid_generic_report_in, 0,
-           sizeof(udi_hid_generic_report_in));
     memcpy(&udi_hid_generic_report_in, data,
-           sizeof(udi_hid_generic_report_in));
+           udi_hid_generic_report_in_size);
     udi_hid_generic_b_report_in_free =
         !udd_ep_run(UDI_HID_GENERIC_EP_IN,
                     false,
                     (uint8_t *) & udi_hid_generic_report_in,
-                    sizeof(udi_hid_generic_report_in),
+                    udi_hid_generic_report_in_size,
+                    udi_hid_generic_report_in_sent);
+    cpu_irq_restore(flags);
+    return !udi_hid_generic_b_report_in_free;
+
+}
+
+bool udi_hid_generic_send_report_in_nocopy(uint8_t *data)
+{
+    if (!udi_hid_generic_b_report_in_free)
+        return false;
+    irqflags_t flags = cpu_irq_save();
+    udi_hid_generic_b_report_in_free =
+        !udd_ep_run(UDI_HID_GENERIC_EP_IN,
+                    false,
+                    data,
+                    udi_hid_generic_report_in_size,
                     udi_hid_generic_report_in_sent);
     cpu_irq_restore(flags);
     return !udi_hid_generic_b_report_in_free;
+}
 
+bool udi_hid_generic_set_report_in_size(uint8_t size)
+{
+    if ((size == 0) || (size > sizeof(udi_hid_generic_report_in)))
+        return false;
+    irqflags_t flags = cpu_irq_save();
+    udi_hid_generic_report_in_size = size;
+    ((uint8_t *) &udi_hid_generic_report_desc)[UDI_HID_GENERIC_REPORT_IN_COUNT_OFFSET] = size;
+    cpu_irq_restore(flags);
+    return true;
+}
+
+uint8_t udi_hid_generic_get_report_in_size(void)
+{
+    return udi_hid_generic_report_in_size;
+}
+
+void udi_hid_generic_hold_report_out(void)
+{
+    udi_hid_generic_b_report_out_held = true;
+}
+
+bool udi_hid_generic_release_report_out(void)
+{
+    irqflags_t flags = cpu_irq_save();
+    bool held = udi_hid_generic_b_report_out_held;
+    udi_hid_generic_b_report_out_held = false;
+    cpu_irq_restore(flags);
+    if (!held)
+        return true;
+    return udi_hid_generic_report_out_enable();
 }
 
 //--------------------------------------------
@@ -286,6 +351,8 @@ static void udi_hid_generic_report_out_received(udd_ep_status_t status,
     if (sizeof(udi_hid_generic_report_out) == nb_received) {
         UDI_HID_GENERIC_REPORT_OUT(udi_hid_generic_report_out);
     }
+    if (udi_hid_generic_b_report_out_held)
+        return;	// re-armed by udi_hid_generic_release_report_out()
     udi_hid_generic_report_out_enable();
 }
 
@@ -310,6 +377,10 @@ static void udi_hid_generic_report_in_sent(udd_ep_status_t status,
 	#ifdef MeasurePerformance
 		TimingDebug_event3();
 	#endif
+#ifdef UDI_HID_GENERIC_REPORT_IN_SENT
+    // The endpoint is free again: let the application queue the next report
+    UDI_HID_GENERIC_REPORT_IN_SENT();
+#endif
 }
 
 //@}
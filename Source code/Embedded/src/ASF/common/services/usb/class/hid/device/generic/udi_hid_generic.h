@@ -139,12 +139,59 @@ typedef struct {
 /**
  * \brief Routine used to send a report to USB Host
  *
- * \param data     Pointer on the report to send (size = UDI_HID_REPORT_IN_SIZE)
+ * \param data     Pointer on the report to send
+ *                 (size = udi_hid_generic_get_report_in_size())
  *
  * \return \c 1 if function was successfully done, otherwise \c 0.
  */
 bool udi_hid_generic_send_report_in(uint8_t *data);
 
+/**
+ * \brief Send a report to USB Host straight from the caller's buffer
+ *
+ * Unlike udi_hid_generic_send_report_in() the report is not copied, so the
+ * buffer must stay unchanged until UDI_HID_GENERIC_REPORT_IN_SENT is called.
+ *
+ * \param data     Pointer on the report to send
+ *                 (size = udi_hid_generic_get_report_in_size())
+ *
+ * \return \c 1 if function was successfully done, otherwise \c 0.
+ */
+bool udi_hid_generic_send_report_in_nocopy(uint8_t *data);
+
+/**
+ * \brief Change the IN report size announced in the report descriptor
+ *
+ * The host only reads the descriptor while enumerating, so the device must
+ * be detached and attached again for the new size to be used.
+ *
+ * \param size     Report size, from 1 to UDI_HID_GENERIC_EP_SIZE
+ *
+ * \return \c 1 if function was successfully done, otherwise \c 0.
+ */
+bool udi_hid_generic_set_report_in_size(uint8_t size);
+
+/**
+ * \brief Current IN report size (UDI_HID_REPORT_IN_SIZE by default)
+ */
+uint8_t udi_hid_generic_get_report_in_size(void);
+
+/**
+ * \brief Stop receiving OUT reports after the current one
+ *
+ * Call from UDI_HID_GENERIC_REPORT_OUT when there is no room for another
+ * report; the endpoint NAKs, and the host waits, until
+ * udi_hid_generic_release_report_out() is called.
+ */
+void udi_hid_generic_hold_report_out(void);
+
+/**
+ * \brief Resume receiving OUT reports after udi_hid_generic_hold_report_out()
+ *
+ * \return \c 1 if function was successfully done, otherwise \c 0.
+ */
+bool udi_hid_generic_release_report_out(void);
+
 //@}
 
 
@@ -107,6 +107,9 @@ typedef struct
     unsigned int length;
     //! Whether to wait if bus is busy (false) or return immediately (true)
     bool no_wait;
+    //! Read only: the first two bytes received hold the little-endian
+    //! total transfer length (HID over I2C); stop there, capped at length.
+    bool length_prefixed;
 } twi_package_t;
 
 /**
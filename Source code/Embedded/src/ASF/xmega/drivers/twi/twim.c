@@ -53,9 +53,11 @@ static struct
     twi_package_t * pkg;            // Bus message descriptor
     int             addr_count;     // Bus transfer address data counter
     unsigned int    data_count;     // Bus transfer payload data counter
+    unsigned int    length;         // Bus transfer payload data length
     bool            read;           // Bus transfer direction
     bool            locked;         // Bus busy or unavailable
     volatile status_code_t status;  // Transfer status
+    twi_master_callback_t callback; // Completion callback (asynchronous transfers only)
 
 } transfer;
 
@@ -132,21 +134,27 @@ static inline bool twim_idle (const TWI_t * twi)
  */
 static inline status_code_t twim_acquire(bool no_wait)
 {
-    while (transfer.locked) {
+    /* The test and the set must be atomic: asynchronous transfers may be
+     * started from interrupt context while the main loop is acquiring.
+     */
+    for (;;) {
+        irqflags_t const flags = cpu_irq_save ();
+
+        if (! transfer.locked) {
+            transfer.locked = true;
+            transfer.status = OPERATION_IN_PROGRESS;
+            transfer.callback = NULL;
+
+            cpu_irq_restore (flags);
+            return STATUS_OK;
+        }
+
+        cpu_irq_restore (flags);
 
         if (no_wait) {
             return ERR_BUSY;
         }
     }
-
-    irqflags_t const flags = cpu_irq_save ();
-
-    transfer.locked = true;
-    transfer.status = OPERATION_IN_PROGRESS;
-
-    cpu_irq_restore (flags);
-
-    return STATUS_OK;
 }
 
 /**
@@ -201,7 +209,7 @@ static inline void twim_write_handler(void)
         const uint8_t * const data = pkg->addr;
         bus->MASTER.DATA = data[transfer.addr_count++];
 
-    } else if (transfer.data_count < pkg->length) {
+    } else if (transfer.data_count < transfer.length) {
 
         if (transfer.read) {
 
@@ -236,15 +244,29 @@ static inline void twim_read_handler(void)
     TWI_t * const         bus = transfer.bus;
     twi_package_t * const pkg = transfer.pkg;
 
-    if (transfer.data_count < pkg->length) {
+    if (transfer.data_count < transfer.length) {
 
         uint8_t * const data = pkg->buffer;
         data[transfer.data_count++] = bus->MASTER.DATA;
 
+        /* Once the length header is in, continue the same read for just
+         * the rest of the message.
+         */
+        if (pkg->length_prefixed && (2 == transfer.data_count)) {
+
+            unsigned int const length = data[0] | ((unsigned int) data[1] << 8);
+
+            if (length < 2) {
+                transfer.length = 2;
+            } else if (length < transfer.length) {
+                transfer.length = length;
+            }
+        }
+
         /* If there is more to read, issue ACK and start a byte read.
          * Otherwise, issue NACK and STOP to complete the transaction.
          */
-        if (transfer.data_count < pkg->length) {
+        if (transfer.data_count < transfer.length) {
 
             bus->MASTER.CTRLC = TWI_MASTER_CMD_RECVTRANS_gc;
 
@@ -298,6 +320,47 @@ static void twim_interrupt_handler(void)
 
         transfer.status = ERR_PROTOCOL;
     }
+
+    /* Asynchronous transfers release the bus from here, since nobody is
+     * waiting in twim_release().  The STOP condition may still be on the
+     * bus; the next synchronous transfer waits for the idle state, the next
+     * asynchronous one is refused with ERR_BUSY until then.
+     */
+    if ((transfer.callback != NULL) &&
+            (OPERATION_IN_PROGRESS != transfer.status)) {
+
+        twi_master_callback_t const callback = transfer.callback;
+        status_code_t const status = transfer.status;
+
+        transfer.callback = NULL;
+        transfer.locked = false;
+
+        callback(status);
+    }
+}
+
+/**
+ * \internal
+ *
+ * \brief Address the slave to start a transfer on an acquired bus.
+ */
+static inline void twim_start(TWI_t *twi, const twi_package_t *package,
+                              bool read)
+{
+    transfer.bus         = (TWI_t *) twi;
+    transfer.pkg         = (twi_package_t *) package;
+    transfer.addr_count  = 0;
+    transfer.data_count  = 0;
+    transfer.length      = package->length;
+    transfer.read        = read;
+
+    uint8_t const chip = (package->chip) << 1;
+
+    if (package->addr_length || (false == read)) {
+        transfer.bus->MASTER.ADDR = chip ;
+    } else if (read) {
+        transfer.bus->MASTER.ADDR = chip | 0x01;
+    }
 }
 
 /**
@@ -362,22 +425,62 @@ status_code_t twi_master_transfer(TWI_t *twi,
     status_code_t status = twim_acquire(package->no_wait);
 
     if (STATUS_OK == status) {
-        transfer.bus         = (TWI_t *) twi;
-        transfer.pkg         = (twi_package_t *) package;
-        transfer.addr_count  = 0;
-        transfer.data_count  = 0;
-        transfer.read        = read;
-
-        uint8_t const chip = (package->chip) << 1;
-
-        if (package->addr_length || (false == read)) {
-            transfer.bus->MASTER.ADDR = chip ;
-        } else if (read) {
-            transfer.bus->MASTER.ADDR = chip | 0x01;
+        while (! twim_idle(twi)) {
+            barrier();
         }
 
+        twim_start(twi, package, read);
+
         status = twim_release();
     }
 
     return status;
 }
+
+/**
+ * \brief Start a TWI master write or read transfer without waiting for it.
+ *
+ * The transfer runs from the TWI master interrupt.  When it finishes,
+ * successfully or not, the bus is released and \c callback is called from
+ * interrupt context with the final status.  The package and its buffer must
+ * stay valid until then.  The bus is never waited for: if another transfer
+ * owns it or the bus is not idle yet, ERR_BUSY is returned immediately, so
+ * this may be called from an interrupt handler.
+ *
+ * \param twi       Base address of the TWI (i.e. &TWI_t).
+ * \param package   Package information and data
+ *                  (see \ref twi_package_t)
+ * \param read      Selects the transfer direction
+ * \param callback  Called with the transfer status on completion
+ *
+ * \return  status_code_t
+ *      - STATUS_OK if the transfer was started
+ *      - ERR_BUSY to indicate an unavailable bus
+ *      - ERR_INVALID_ARG to indicate invalid arguments.
+ */
+status_code_t twi_master_transfer_async(TWI_t *twi,
+                                        const twi_package_t *package, bool read,
+                                        twi_master_callback_t callback)
+{
+    if ((twi == NULL) || (package == NULL) || (callback == NULL)) {
+        return ERR_INVALID_ARG;
+    }
+
+    status_code_t const status = twim_acquire(true);
+
+    if (STATUS_OK == status) {
+        if (! twim_idle(twi)) {
+            /* The STOP of the last transfer is still going out (or another
+             * master holds the bus); waiting here could be in an interrupt
+             * handler, so give the bus back and let the caller retry.
+             */
+            transfer.locked = false;
+            return ERR_BUSY;
+        }
+
+        transfer.callback = callback;
+        twim_start(twi, package, read);
+    }
+
+    return status;
+}
@@ -80,6 +80,13 @@ extern "C" {
 #define TWI_BAUD(F_SYS, F_TWI) ((F_SYS / (2 * F_TWI)) - 5)
 
 
+/*! \brief Completion callback for asynchronous transfers.
+ *
+ * Called from the TWI master interrupt with the final transfer status.
+ */
+typedef void (*twi_master_callback_t)(status_code_t status);
+
+
 /*! \brief Initialize the twi master module
  *
  * \param twi       Base address of the TWI (i.e. &TWIC).
@@ -110,6 +117,23 @@ status_code_t twi_master_init(TWI_t *twi, const twi_options_t *opt);
 status_code_t twi_master_transfer(TWI_t *twi, const twi_package_t *package,
                                   bool read);
 
+/*! \brief Start a TWI master write or read transfer without waiting for it.
+ *
+ * \param twi       Base address of the TWI (i.e. &TWI_t).
+ * \param package   Package information and data, which must remain valid
+ *                  until \c callback runs (see \ref twi_package_t)
+ * \param read      Selects the transfer direction
+ * \param callback  Called from interrupt context when the transfer ends
+ *
+ * \return  status_code_t
+ *      - STATUS_OK if the transfer was started
+ *      - ERR_BUSY to indicate an unavailable bus (never waits)
+ *      - ERR_INVALID_ARG to indicate invalid arguments.
+ */
+status_code_t twi_master_transfer_async(TWI_t *twi,
+                                        const twi_package_t *package, bool read,
+                                        twi_master_callback_t callback);
+
 /*! \brief Read multiple bytes from a TWI compatible slave device
  *
  * \param twi       Base address of the TWI (i.e. &TWI_t).
@@ -16,9 +16,54 @@ struct BNO070_Stats_s
 	uint32_t resets;
 	uint32_t events;
 	uint32_t empty_events;
+	uint32_t ring_overflows;      // event ring filled while the hub still had reports pending
+	uint32_t report_bytes_read;   // input report bytes transferred over I2C
+	uint32_t report_bytes_saved;  // input report bytes skipped by length-prefixed reads
+	uint32_t dcd_saves;           // DCD saves the hub confirmed
+	uint32_t dcd_failures;        // DCD saves that failed or timed out
+	uint32_t dcd_aborts;          // automatic DCD saves cut short because the tracker moved
+	uint32_t dcd_gap_last_ms;     // time without full-rate orientation reports during the last DCD save
+	uint32_t dcd_gap_max_ms;
+	uint32_t source_switch_failures;  // orientation source switches undone because the new source never reported
+	uint32_t config_writes;       // configuration writes sent to the hub
+	uint32_t config_skipped;      // configuration writes left out because the hub already had the setting
+	uint32_t tracker_cycles;      // CPU cycles from reading the last orientation report to queueing its HID report
+	uint32_t tracker_cycles_max;
+	uint32_t fast_path_reports;   // reports built straight from the I2C buffer (BNO_TRACKER_FAST_PATH)
+	uint32_t reset_recovery_last_us;  // from the last hub reset indication to the next orientation sample
+	uint32_t reset_recovery_max_us;
+	uint32_t probe_reset_ms;      // last probe: reset release until INTN went high
+	uint32_t probe_descriptor_ms; // ... then until the HID descriptor was read
+	uint32_t probe_intn_ms;       // ... then until INTN was first asserted
+	uint32_t product_id_ms;       // last product ID request
+	uint32_t gyro_matched;        // orientations sent with a gyro sample taken at the same time (BNO_GYRO_PAIRING)
+	uint32_t gyro_interpolated;   // ... with a gyro interpolated to their time
+	uint32_t gyro_nearest;        // ... with the nearest gyro sample, the one after them not arriving in time
+	int16_t gyro_skew_last_us;    // gyro sample time less orientation sample time for the last orientation sent
+	uint16_t gyro_skew_max_us;
 };
 typedef struct BNO070_Stats_s BNO070_Stats_t;
 
+/// Sensors whose rate can be set at runtime.
+typedef enum
+{
+	BNO_SENSOR_ORIENTATION = 0,  // rotation vector or game rotation vector, whichever is selected
+	BNO_SENSOR_GYRO = 1,
+	BNO_SENSOR_ACC = 2,
+	BNO_SENSOR_MAG = 3,
+	BNO_SENSOR_LIN_ACC = 4,  // linear acceleration, gravity removed
+	BNO_SENSOR_COUNT
+} BNO070_Sensor_t;
+
+/// Orientation sources, as kept in SELECT_GRV and the GRV EEPROM slot.
+enum
+{
+	BNO_USE_RV = 0,      // rotation vector: gyro, accelerometer and magnetometer, heading toward magnetic North
+	BNO_USE_GRV = 1,     // game rotation vector: no magnetometer, so the heading drifts slowly
+	BNO_USE_GEO_RV = 2,  // geomagnetic rotation vector: no gyro, so no drift but more noise and lag
+	BNO_SOURCE_COUNT
+};
+
 extern bool BNO070Active;
 extern sensorhub_ProductID_t BNO070id;
 extern uint8_t SELECT_GRV;
@@ -31,17 +76,48 @@ bool SetDcdEn_BNO070(uint8_t flags);
 bool SaveDcd_BNO070(void);
 bool ClearDcd_BNO070(void);
 bool MagSetEnable_BNO070(bool enabled);
+/// Request USB report version 1, 3 or 4 (0 restores the default); takes effect on the next report.
+bool SetReportVersion_BNO070(uint8_t version);
+/// Switch between the 16-byte report and packed 64-byte reports carrying several timestamped samples; the device
+/// re-enumerates to apply it.
+bool SetPackedReports_BNO070(bool enabled);
+/// Stream raw accelerometer, gyroscope and magnetometer samples in 64-byte reports instead of the fused
+/// orientation (false returns to the 16-byte report); the device re-enumerates to apply it.
+bool SetRawImu_BNO070(bool enabled);
+/// Stream every report read from the hub, undecoded and stamped with its INTN time, in 64-byte reports for
+/// recording (false returns to the 16-byte report); the device re-enumerates to apply it.
+bool SetCapture_BNO070(bool enabled);
+#ifdef BNO_POSE_PREDICTION
+/// Set the pose prediction horizon in ms (0 = off); takes effect on the next report.
+bool SetPredictionHorizon_BNO070(uint8_t ms);
+uint8_t GetPredictionHorizon_BNO070(void);
+#endif
+/// Set a sensor's report rate in Hz, 0 to turn it off; rates are kept in 5 Hz steps. A sensor that is on has its
+/// channel in the reports: gyro in version 3 and packed reports, accelerometer and linear acceleration in packed
+/// reports. Applied by the main loop.
+bool SetSensorRate_BNO070(BNO070_Sensor_t sensor, uint16_t hz);
+uint16_t GetSensorRate_BNO070(BNO070_Sensor_t sensor);
+/// Switch the orientation source to one of the BNO_USE_ values. Applied by the main loop, which runs both sources for
+/// about half a second and cross-fades so the reported orientation does not jump.
+bool SetOrientationSource_BNO070(uint8_t source);
+uint8_t GetOrientationSource_BNO070(void);
+/// Store the sensor rates and RV/GRV choice in EEPROM (true), or forget stored rates so the build defaults apply on
+/// the next start (false).
+bool PersistSensorConfig_BNO070(bool save);
 uint8_t MagStatus_BNO070(void);  // 0 - Unreliable, 1 - Low, 2 - Medium, 3 - High Accuracy.
 void GetStats_BNO070(BNO070_Stats_t *stats);
 void SetDebugPrintEvents_BNO070(bool);
 bool ReInit_BNO070(void);
 bool Reset_BNO070(void);
 bool dfu_BNO070(void);
+/// Print the progress of a BNO DFU to the console every 10%, then its time and throughput once @a written reaches
+/// @a total. A call with fewer bytes written than the last one starts a new update.
+void DfuProgress_BNO070(uint32_t written, uint32_t total);
 #ifdef OSVRHDK
 void BNO_Yield(void);
 #endif
 
-void Update_BNO_Report_Header(void);  // update message header to reflect video status
+void Update_BNO_Report_Header(void);  // update message header to reflect video status and orientation source
 uint8_t Get_BNO_Report_Header(void);  // for debug, returns first byte of BNO message header
 
 #endif /* BNO070_H_ */
@@ -0,0 +1,337 @@
+/*
+ * BNO070_Dfu.c
+ *
+ * The DFU stream (format 0x01010101) is: the format word, the application size and its CRC, the packet payload size
+ * and its CRC, then the application in packets of payload plus CRC. Every CRC is CRC-16/CCITT seeded with 0xFFFF
+ * and stored big-endian. Stream bytes from the host are buffered here, cut into those packets, checked, and written
+ * to the bootloader one packet at a time.
+ */
+
+// Options header
+#include "GlobalOptions.h"
+
+#ifdef BNO_HOST_DFU
+
+#include "BNO070_Dfu.h"
+#include "BNO070.h"
+#include "bno_callbacks.h"
+#include "SvrClock.h"
+
+// asf headers
+#include <interrupt.h>
+#include <udi_hid_generic.h>
+#include <util/crc16.h>
+
+#include "sensorhub.h"
+extern sensorhub_t sensorhub;
+
+#define DFU_FORMAT 0x01010101UL
+#define DFU_PACKET_MAX 32  // the bootloader takes at most 30 payload bytes plus the CRC
+
+/* Stream bytes from the USB interrupt, consumed by BnoDfu_Task; the indexes wrap at 256 */
+static uint8_t ring_[256];
+static volatile uint8_t ringHead_ = 0;
+static volatile uint8_t ringTail_ = 0;
+static volatile bool held_ = false;  // OUT endpoint held because the ring could not take another report
+
+static volatile uint8_t request_ = 0xFF;  // 1 start, 0 abandon, 0xFF none
+static volatile uint8_t state_ = BNO_DFU_IDLE;
+static volatile uint8_t nextSequence_ = 0;
+static volatile bool lostChunk_ = false;
+static int8_t error_ = 0;
+
+/* One packet is filled while the other is on the bus waiting for the bootloader's ack */
+static uint8_t packet_[2][DFU_PACKET_MAX];
+static uint8_t fill_ = 0;             // packet_ being filled
+static uint8_t packetFill_ = 0;
+static uint8_t inFlight_ = 0;         // length of the other packet_ if it has been started, else 0
+static uint32_t index_ = 0;           // stream offset of packet_[fill_]
+static uint32_t written_ = 0;         // stream bytes the bootloader has accepted
+static uint32_t startTime_ = 0;       // svr_clock_ms() at the start and the end of the update
+static uint32_t endTime_ = 0;
+static uint32_t applicationSize_ = 0;
+static uint8_t payloadSize_ = 0;      // 0 until the packet size has been received
+static uint32_t expected_ = 0;        // total stream length, 0 until known
+static bool inBootloader_ = false;
+static bool wasActive_ = false;  // tracking state to restore if the bootloader was never entered
+
+static inline uint8_t ringCount(void) { return (uint8_t)(ringHead_ - ringTail_); }
+static inline uint8_t ringSpace(void) { return 255 - ringCount(); }
+
+static uint16_t crc16(const uint8_t *data, uint8_t length)
+{
+	uint16_t crc = 0xFFFF;
+	while (length--)
+	{
+		crc = _crc_xmodem_update(crc, *data++);
+	}
+	return crc;
+}
+
+/// Packet length at the current stream offset; the header fields come first, and the last packet may be short.
+static uint8_t packetLength(void)
+{
+	if (index_ == 0)
+	{
+		return 4;  // format word, checked here and not sent
+	}
+	if (index_ == 4)
+	{
+		return 6;  // application size + CRC
+	}
+	if (index_ == 10)
+	{
+		return 3;  // packet payload size + CRC
+	}
+	uint32_t left = expected_ - index_;
+	return (left < payloadSize_ + 2u) ? (uint8_t)left : payloadSize_ + 2;
+}
+
+static bool checkCrc(const uint8_t *packet, uint8_t length)
+{
+	uint16_t crc = ((uint16_t)packet[length - 2] << 8) | packet[length - 1];
+	return crc16(packet, length - 2) == crc;
+}
+
+/// Release the OUT endpoint once the ring has room for a report again. The USB interrupt holds it from
+/// BnoDfu_Receive(), so the test and the release must not interleave with it.
+static void releaseEndpoint(void)
+{
+	irqflags_t flags = cpu_irq_save();
+	if (held_ && ringSpace() >= BNO_DFU_CHUNK_MAX)
+	{
+		held_ = false;
+		udi_hid_generic_release_report_out();
+	}
+	cpu_irq_restore(flags);
+}
+
+static void start(void)
+{
+	wasActive_ = BNO070Active || (wasActive_ && state_ == BNO_DFU_RECEIVING);  // restarted mid-update
+	BNO070Active = false;
+#ifdef BNO_ASYNC_READS
+	bno_set_async_reads(false);
+#endif
+
+	state_ = BNO_DFU_IDLE;  // ignore reports until everything is reset
+	ringHead_ = 0;
+	ringTail_ = 0;
+	nextSequence_ = 0;
+	lostChunk_ = false;
+	error_ = 0;
+	fill_ = 0;
+	packetFill_ = 0;
+	inFlight_ = 0;
+	index_ = 0;
+	written_ = 0;
+	startTime_ = svr_clock_ms();
+	payloadSize_ = 0;
+	expected_ = 0;
+	inBootloader_ = false;
+	state_ = BNO_DFU_RECEIVING;
+
+	held_ = true;  // re-arm the endpoint in case an earlier update left it held
+	releaseEndpoint();
+	sensorhub.debugPrintf("BNO DFU: waiting for stream\r\n");
+}
+
+/// Leave the update; the hub is restarted and tracking resumes if its firmware is usable.
+static void finish(BnoDfu_State_t state, int error)
+{
+	if (inFlight_)
+	{
+		sensorhub_dfuFinishPacket(&sensorhub, packet_[!fill_], inFlight_);  // don't leave the TWI mid-write
+		inFlight_ = 0;
+	}
+	endTime_ = svr_clock_ms();
+	state_ = state;
+	error_ = (int8_t)error;
+	if (state == BNO_DFU_FAILED)
+	{
+		sensorhub.debugPrintf("BNO DFU failed at %lu: %d\r\n", (unsigned long)written_, error);
+	}
+	else
+	{
+		sensorhub.debugPrintf("BNO DFU complete\r\n");
+	}
+
+	held_ = true;
+	releaseEndpoint();
+
+	if (inBootloader_ || state == BNO_DFU_DONE)
+	{
+		// init_BNO070 resets the hub with BOOTN high, out of the bootloader, and probes the new firmware as
+		// sensorhub_dfuEnd() asks
+		BNO070Active = init_BNO070();
+	}
+	else if (wasActive_)
+	{
+		BNO070Active = true;
+#ifdef BNO_ASYNC_READS
+		bno_set_async_reads(true);
+#endif
+	}
+}
+
+/// Check the complete packet in packet_[fill_] and start sending it; returns a sensorhub status.
+static int handlePacket(uint8_t length)
+{
+	const uint8_t *packet = packet_[fill_];
+
+	if (index_ == 0)
+	{
+		uint32_t format = packet[0] | ((uint32_t)packet[1] << 8) | ((uint32_t)packet[2] << 16) |
+		                  ((uint32_t)packet[3] << 24);
+		if (format != DFU_FORMAT)
+		{
+			return SENSORHUB_STATUS_UNEXPECTED_DFU_STREAM_TYPE;
+		}
+		inBootloader_ = true;
+		written_ = 4;
+		return sensorhub_dfuBegin(&sensorhub);
+	}
+
+	if (!checkCrc(packet, length))
+	{
+		return SENSORHUB_STATUS_DFU_BAD_CRC;
+	}
+	if (index_ == 4)
+	{
+		applicationSize_ = ((uint32_t)packet[0] << 24) | ((uint32_t)packet[1] << 16) |
+		                   ((uint32_t)packet[2] << 8) | packet[3];
+	}
+	else if (index_ == 10)
+	{
+		payloadSize_ = packet[0];
+		if (payloadSize_ == 0 || payloadSize_ + 2 > DFU_PACKET_MAX)
+		{
+			return SENSORHUB_STATUS_DFU_STREAM_SIZE_WRONG;
+		}
+		expected_ = 13 + applicationSize_ + ((applicationSize_ + payloadSize_ - 1) / payloadSize_) * 2;
+	}
+
+	int rc = sensorhub_dfuStartPacket(&sensorhub, packet, length);
+	if (rc == SENSORHUB_STATUS_SUCCESS)
+	{
+		inFlight_ = length;
+		fill_ = !fill_;
+	}
+	return rc;
+}
+
+void BnoDfu_Request(bool start) { request_ = start ? 1 : 0; }
+void BnoDfu_Receive(const uint8_t *report)
+{
+	if (state_ != BNO_DFU_RECEIVING || lostChunk_)
+	{
+		return;
+	}
+
+	uint8_t length = report[3];
+	if (report[2] != nextSequence_ || length == 0 || length > BNO_DFU_CHUNK_MAX || length > ringSpace())
+	{
+		lostChunk_ = true;
+		return;
+	}
+	nextSequence_++;
+
+	uint8_t head = ringHead_;
+	for (uint8_t i = 0; i < length; i++)
+	{
+		ring_[head++] = report[4 + i];
+	}
+	ringHead_ = head;
+
+	if (ringSpace() < BNO_DFU_CHUNK_MAX)
+	{
+		held_ = true;
+		udi_hid_generic_hold_report_out();
+	}
+}
+
+bool BnoDfu_Active(void) { return request_ != 0xFF || state_ == BNO_DFU_RECEIVING; }
+void BnoDfu_Task(void)
+{
+	uint8_t request = request_;
+	if (request != 0xFF)
+	{
+		request_ = 0xFF;
+		if (request)
+		{
+			start();
+		}
+		else if (state_ == BNO_DFU_RECEIVING)
+		{
+			finish(BNO_DFU_FAILED, SENSORHUB_STATUS_OP_FAILED);
+		}
+	}
+	if (state_ != BNO_DFU_RECEIVING)
+	{
+		return;
+	}
+	if (lostChunk_)
+	{
+		finish(BNO_DFU_FAILED, BNO_DFU_LOST_CHUNK);
+		return;
+	}
+
+	// gather the next packet while the last one is written
+	uint8_t length = (expected_ && index_ == expected_) ? 0 : packetLength();
+	uint8_t *packet = packet_[fill_];
+	uint8_t tail = ringTail_;
+	while (packetFill_ < length && tail != ringHead_)
+	{
+		packet[packetFill_++] = ring_[tail++];
+	}
+	ringTail_ = tail;
+	releaseEndpoint();
+
+	int rc;
+	if (inFlight_)
+	{
+		rc = sensorhub_dfuFinishPacket(&sensorhub, packet_[!fill_], inFlight_);
+		if (rc != SENSORHUB_STATUS_SUCCESS)
+		{
+			inFlight_ = 0;
+			finish(BNO_DFU_FAILED, rc);
+			return;
+		}
+		written_ += inFlight_;
+		inFlight_ = 0;
+		if (expected_)
+		{
+			DfuProgress_BNO070(written_, expected_);
+		}
+		if (written_ == expected_)
+		{
+			rc = sensorhub_dfuEnd(&sensorhub);
+			finish((rc == SENSORHUB_STATUS_SUCCESS) ? BNO_DFU_DONE : BNO_DFU_FAILED, rc);
+			return;
+		}
+	}
+	if (length == 0 || packetFill_ < length)
+	{
+		return;
+	}
+
+	rc = handlePacket(length);
+	if (rc != SENSORHUB_STATUS_SUCCESS)
+	{
+		finish(BNO_DFU_FAILED, rc);
+		return;
+	}
+	index_ += length;
+	packetFill_ = 0;
+}
+
+void BnoDfu_GetStatus(BnoDfu_Status_t *status)
+{
+	status->state = state_;
+	status->error = error_;
+	status->written = written_;
+	status->expected = expected_;
+	status->elapsed = (uint16_t)((((state_ == BNO_DFU_RECEIVING) ? svr_clock_ms() : endTime_) - startTime_) / 100);
+}
+
+#endif  // BNO_HOST_DFU
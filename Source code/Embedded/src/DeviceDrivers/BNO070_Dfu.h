@@ -0,0 +1,54 @@
+/*
+ * BNO070_Dfu.h
+ *
+ * BNO070 firmware update streamed from the host over HID, so the normal firmware can update the tracker without a
+ * special PERFORM_BNO_DFU build carrying the image.
+ */
+
+#ifndef BNO070_DFU_H_
+#define BNO070_DFU_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// Largest number of DFU stream bytes carried by one OUT report.
+#define BNO_DFU_CHUNK_MAX 60
+
+/// Error reported when an OUT report arrives out of sequence; other errors are sensorhub status codes.
+#define BNO_DFU_LOST_CHUNK (-100)
+
+typedef enum
+{
+	BNO_DFU_IDLE = 0,
+	BNO_DFU_RECEIVING = 1,  // waiting for or writing stream data
+	BNO_DFU_DONE = 2,       // whole stream written and the hub restarted
+	BNO_DFU_FAILED = 3      // see BnoDfu_Status_t.error
+} BnoDfu_State_t;
+
+typedef struct
+{
+	uint8_t state;      // BnoDfu_State_t
+	int8_t error;       // 0, a sensorhub status code or BNO_DFU_LOST_CHUNK
+	uint32_t written;   // stream bytes accepted by the bootloader, counting the 4-byte format word
+	uint32_t expected;  // total stream length, 0 until the header has been received
+	uint16_t elapsed;   // time since the update started, in tenths of a second; stops when it ends
+} BnoDfu_Status_t;
+
+/// Start (true) or abandon (false) an update; carried out by BnoDfu_Task. Safe to call from the USB interrupt.
+void BnoDfu_Request(bool start);
+
+/**
+ * Take one OUT report: byte 2 is a sequence number starting at 0 for each update, byte 3 the number of stream bytes
+ * (1 to BNO_DFU_CHUNK_MAX) that follow from byte 4. Called from the USB interrupt.
+ */
+void BnoDfu_Receive(const uint8_t *report);
+
+/// True while an update owns the BNO; tracking is suspended meanwhile.
+bool BnoDfu_Active(void);
+
+/// Forward received stream data to the bootloader. Call from the main loop.
+void BnoDfu_Task(void);
+
+void BnoDfu_GetStatus(BnoDfu_Status_t *status);
+
+#endif /* BNO070_DFU_H_ */
@@ -0,0 +1,106 @@
+/*
+ * BNO070_Prediction.c
+ *
+ * First-order quaternion integration in 16/32-bit fixed point: q' = q * (1, w*h/2), renormalized with the
+ * first-order approximation 1/sqrt(1+x) ~ 1 - x/2.  No divisions are done per sample.
+ */
+
+#include "BNO070_Prediction.h"
+
+static uint8_t horizon_ = 0;   // ms
+static int32_t halfAngleScale_ = 0;  // converts Q9 rad/s to a Q14 half angle over the horizon, in units of 2^-16
+static int16_t gyro_[3] = {0, 0, 0};
+
+bool Prediction_SetHorizon(uint8_t ms)
+{
+	if (ms > PREDICTION_MAX_HORIZON_MS)
+	{
+		return false;
+	}
+	horizon_ = ms;
+
+	// half angle [Q14] = w [Q9] * 2^5 * (ms / 1000) / 2 = w * ms * 2 / 125
+	halfAngleScale_ = ((int32_t)ms << 17) / 125;
+	return true;
+}
+
+uint8_t Prediction_GetHorizon(void) { return horizon_; }
+void Prediction_UpdateGyro(const int16_t gyro_Q9[3])
+{
+	gyro_[0] = gyro_Q9[0];
+	gyro_[1] = gyro_Q9[1];
+	gyro_[2] = gyro_Q9[2];
+}
+
+void Prediction_Reset(void)
+{
+	gyro_[0] = 0;
+	gyro_[1] = 0;
+	gyro_[2] = 0;
+}
+
+static inline int16_t saturate16(int32_t value)
+{
+	if (value > INT16_MAX)
+	{
+		return INT16_MAX;
+	}
+	if (value < INT16_MIN)
+	{
+		return INT16_MIN;
+	}
+	return (int16_t)value;
+}
+
+/// Product of two Q14 values, in Q14.
+static inline int32_t mulQ14(int32_t a, int32_t b) { return (a * b) >> 14; }
+/// Half angles past 1/2 rad on an axis (over 1100 deg/s at the longest horizon) are far outside head motion, and
+/// past |v|^2 = 2 the first-order normalization turns negative and flips the quaternion; hold each axis there.
+static inline int32_t clampHalfAngle(int32_t v)
+{
+	if (v > (1L << 13))
+	{
+		return 1L << 13;
+	}
+	if (v < -(1L << 13))
+	{
+		return -(1L << 13);
+	}
+	return v;
+}
+
+void Prediction_Apply(int16_t quat_Q14[4])
+{
+	if (horizon_ == 0)
+	{
+		return;
+	}
+
+	// Half rotation over the horizon; |w| < 64 rad/s and horizon <= 50 ms keep this well inside 32 bits.
+	int32_t vx = clampHalfAngle(((int32_t)gyro_[0] * halfAngleScale_) >> 16);
+	int32_t vy = clampHalfAngle(((int32_t)gyro_[1] * halfAngleScale_) >> 16);
+	int32_t vz = clampHalfAngle(((int32_t)gyro_[2] * halfAngleScale_) >> 16);
+	if ((vx | vy | vz) == 0)
+	{
+		return;
+	}
+
+	int32_t x = quat_Q14[0];
+	int32_t y = quat_Q14[1];
+	int32_t z = quat_Q14[2];
+	int32_t w = quat_Q14[3];
+
+	// Gyro rates are in the sensor frame, so the increment multiplies on the right.
+	int32_t nw = w - mulQ14(x, vx) - mulQ14(y, vy) - mulQ14(z, vz);
+	int32_t nx = x + mulQ14(w, vx) + mulQ14(y, vz) - mulQ14(z, vy);
+	int32_t ny = y + mulQ14(w, vy) + mulQ14(z, vx) - mulQ14(x, vz);
+	int32_t nz = z + mulQ14(w, vz) + mulQ14(x, vy) - mulQ14(y, vx);
+
+	// |q * (1, v)|^2 = 1 + |v|^2 for a unit q
+	int32_t scale = (1L << 14) - ((mulQ14(vx, vx) + mulQ14(vy, vy) + mulQ14(vz, vz)) >> 1);
+
+	quat_Q14[0] = saturate16(mulQ14(nx, scale));
+	quat_Q14[1] = saturate16(mulQ14(ny, scale));
+	quat_Q14[2] = saturate16(mulQ14(nz, scale));
+	quat_Q14[3] = saturate16(mulQ14(nw, scale));
+}
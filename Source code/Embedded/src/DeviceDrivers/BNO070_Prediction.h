@@ -0,0 +1,30 @@
+/*
+ * BNO070_Prediction.h
+ *
+ * Extrapolates the tracker orientation forward in time using the latest calibrated gyro sample, so the pose sent to
+ * the host matches where the head will be when the frame is displayed.
+ */
+
+#ifndef BNO070_PREDICTION_H_
+#define BNO070_PREDICTION_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// Longest prediction horizon accepted, in milliseconds.
+#define PREDICTION_MAX_HORIZON_MS 50
+
+/// Set how far ahead to predict, in milliseconds; 0 disables prediction. Returns false if out of range.
+bool Prediction_SetHorizon(uint8_t ms);
+uint8_t Prediction_GetHorizon(void);
+
+/// Record the latest calibrated angular velocity (x, y, z in rad/s, Q9, sensor frame).
+void Prediction_UpdateGyro(const int16_t gyro_Q9[3]);
+
+/// Forget the cached angular velocity, e.g. when gyro reports stop.
+void Prediction_Reset(void);
+
+/// Rotate a unit quaternion (i, j, k, real in Q14) forward by the horizon, in place.
+void Prediction_Apply(int16_t quat_Q14[4]);
+
+#endif /* BNO070_PREDICTION_H_ */
@@ -0,0 +1,130 @@
+/*
+ * BNO070_SourceFade.c
+ *
+ * Only the main loop calls these, so the state needs no protection.
+ */
+
+#include "BNO070_SourceFade.h"
+
+// standard headers
+#include <string.h>
+
+static uint8_t from_ = SOURCE_FADE_NONE;     // source being faded out
+static uint8_t fadedOut_ = SOURCE_FADE_NONE;  // source whose fade has ended, for the main loop to turn off
+static uint32_t switched_;                    // ms at the switch
+static bool started_ = false;                 // the new source has sent a sample; start_ is valid
+static uint32_t start_;                       // ms at that sample
+static bool haveOld_ = false;                 // oldQuat_ holds a sample from the old source
+static int16_t oldQuat_[4];                   // latest quaternion from the old source, Q14
+
+/**
+ * Normalized linear interpolation from @a from to @a to by @a weight (Q14, 0 to 1), the shorter way round. The
+ * interpolated quaternion's squared length is at least 1/2, so four Newton steps from 1 bring 1/sqrt of it to
+ * within a few LSB.
+ */
+static void blendQuaternion(const int16_t *from, const int16_t *to, int32_t weight, int16_t *out)
+{
+	int32_t dot = 0;
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		dot += (int32_t)from[i] * to[i];
+	}
+	int32_t keep = (1L << 14) - weight;
+	if (dot < 0)
+	{
+		keep = -keep;  // q and -q are the same rotation; go the short way
+	}
+
+	int32_t q[4];
+	int32_t norm = 0;  // Q14
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		q[i] = ((int32_t)from[i] * keep + (int32_t)to[i] * weight) >> 14;
+		norm += (q[i] * q[i]) >> 14;
+	}
+	int32_t scale = 1L << 14;
+	for (uint8_t step = 0; step < 4; step++)
+	{
+		scale = (scale * ((3L << 13) - ((norm * ((scale * scale) >> 14)) >> 15))) >> 14;
+	}
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		out[i] = (int16_t)((q[i] * scale) >> 14);
+	}
+}
+
+void SourceFade_Begin(uint8_t from, uint32_t nowMs)
+{
+	from_ = from;
+	switched_ = nowMs;
+	started_ = false;
+	haveOld_ = false;
+}
+
+void SourceFade_Reset(void)
+{
+	from_ = SOURCE_FADE_NONE;
+	fadedOut_ = SOURCE_FADE_NONE;
+	started_ = false;
+	haveOld_ = false;
+}
+
+uint8_t SourceFade_From(void) { return from_; }
+
+bool SourceFade_Sample(uint8_t source, uint8_t selected, const int16_t sample[4], uint32_t nowMs, int16_t quat[4])
+{
+	if (from_ != SOURCE_FADE_NONE && source == from_)
+	{
+		memcpy(oldQuat_, sample, 8);
+		haveOld_ = true;
+		if (started_)
+		{
+			return false;
+		}
+		memcpy(quat, sample, 8);  // until the new source has a sample
+		return true;
+	}
+	if (source != selected)
+	{
+		return false;  // a late sample from a source just turned off
+	}
+	memcpy(quat, sample, 8);
+	if (from_ == SOURCE_FADE_NONE)
+	{
+		return true;
+	}
+
+	if (!started_)
+	{
+		started_ = true;
+		start_ = nowMs;
+	}
+	uint32_t elapsed = nowMs - start_;
+	if (!haveOld_ || elapsed >= (1UL << SOURCE_FADE_SHIFT))
+	{
+		fadedOut_ = from_;
+		from_ = SOURCE_FADE_NONE;
+		return true;
+	}
+	blendQuaternion(oldQuat_, sample, (int32_t)(elapsed << (14 - SOURCE_FADE_SHIFT)), quat);
+	return true;
+}
+
+uint8_t SourceFade_TakeFadedOut(void)
+{
+	uint8_t source = fadedOut_;
+	fadedOut_ = SOURCE_FADE_NONE;
+	return source;
+}
+
+uint8_t SourceFade_Expire(uint32_t nowMs)
+{
+	if (from_ == SOURCE_FADE_NONE || started_ || nowMs - switched_ < SOURCE_FADE_TIMEOUT_MS)
+	{
+		return SOURCE_FADE_NONE;
+	}
+	uint8_t from = from_;
+	from_ = SOURCE_FADE_NONE;
+	haveOld_ = false;
+	return from;
+}
@@ -0,0 +1,45 @@
+/*
+ * BNO070_SourceFade.h
+ *
+ * Switching the orientation source at runtime runs the old and the new one side by side and cross-fades between
+ * them, so the reported quaternion does not jump by the heading difference. The old source is reported until the new
+ * one's first sample; from then on each new sample is blended with the latest old one, the new weight rising from 0
+ * to 1 over 2^SOURCE_FADE_SHIFT ms, and then the old source is turned off. A new source that has not reported
+ * SOURCE_FADE_TIMEOUT_MS after the switch is given up on, and the old one is selected again.
+ */
+
+#ifndef BNO070_SOURCEFADE_H_
+#define BNO070_SOURCEFADE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SOURCE_FADE_NONE 0xFF
+#define SOURCE_FADE_SHIFT 9          // 512 ms, a power of two so the weight is a shift
+#define SOURCE_FADE_TIMEOUT_MS 1000  // from the switch to the new source's first sample
+
+/// Start a switch at @a nowMs, fading from source @a from (SOURCE_FADE_NONE to switch without a fade).
+void SourceFade_Begin(uint8_t from, uint32_t nowMs);
+
+/// Forget any switch in progress, e.g. when the hub is set up again.
+void SourceFade_Reset(void);
+
+/// The source being faded out; SOURCE_FADE_NONE outside a switch.
+uint8_t SourceFade_From(void);
+
+/**
+ * The quaternion (i, j, k, real, Q14) to report for a sample from @a source while @a selected is the selected source,
+ * in @a quat; false if the sample is not reported.
+ */
+bool SourceFade_Sample(uint8_t source, uint8_t selected, const int16_t sample[4], uint32_t nowMs, int16_t quat[4]);
+
+/// The source whose fade has ended, for the caller to turn off, once; SOURCE_FADE_NONE if there is none.
+uint8_t SourceFade_TakeFadedOut(void);
+
+/**
+ * End a switch whose new source has sent nothing within SOURCE_FADE_TIMEOUT_MS of it. Returns the source faded from,
+ * once, for the caller to select again; SOURCE_FADE_NONE otherwise.
+ */
+uint8_t SourceFade_Expire(uint32_t nowMs);
+
+#endif /* BNO070_SOURCEFADE_H_ */
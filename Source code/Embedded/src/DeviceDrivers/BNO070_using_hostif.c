@@ -11,6 +11,16 @@
 // internal headers for BNO driver
 #include "BNO070.h"
 #include "bno_callbacks.h"
+#include "SvrClock.h"
+#include "ReportQueue.h"
+#include "LatencyStats.h"
+#include "BNO070_SourceFade.h"
+#ifdef BNO_POSE_PREDICTION
+#include "BNO070_Prediction.h"
+#endif
+#ifdef BNO_HOST_DFU
+#include "BNO070_Dfu.h"
+#endif
 
 // application headers
 #include "my_hardware.h"
@@ -24,16 +34,24 @@
 #include <delay.h>  // to dynamically define F_CPU for <util/delay.h>
 #include <util/delay.h>
 #include <udi_hid_generic.h>
+#include <udc.h>
 #include <twi_master.h>
 
 // standard headers
+#include <stdio.h>
 #include <string.h>
 
 /* Define this to enable the calibrated gyro reports and stuff them in the USB reports at offset 10 */
 #define REPORT_GYRO 1
+/* Build defaults for the optional sensors; SetSensorRate_BNO070 changes them at runtime */
 #define REPORT_ACC 0
+#define REPORT_LIN_ACC 0
 #define REPORT_MAG 0
 
+/* Runtime sensor rates are kept in steps of this many Hz so each fits one EEPROM config byte */
+#define RATE_STEP_HZ 5
+#define RATE_DEFAULT 0xFF  // use the rate loadDefaultConfig picks for this firmware
+
 // Skip version check and always DFU
 //#define FORCE_DFU 1
 /// @todo Without a definition of FORCE_DFU, build fails when defining PERFORM_BNO_DFU.
@@ -42,29 +60,140 @@
 #define FORCE_DFU 0
 #endif
 
-#define STABILITY_ON_TABLE 1
+#define STABILITY_ON_TABLE 1  // higher classifications mean the tracker is no longer lying still
+#define DCD_SAVE_TIMEOUT_MS 1000
+#define DCD_SAVE_ABORTED 1  // endDcdSave result when motion cut an automatic save short
 #define DCD_SAVE_PERIOD_SEC (300UL)  // 300sec = 5 min
+#define FRS_COMPARE_WORDS 16         // FRS words read back per request when checking a record before writing it
+
+/* Raw IMU rates requested in raw streaming mode; the hub runs each sensor at the nearest rate it supports.
+ * At 400 kHz the I2C bus, not the sensors, sets the ceiling, so these stay a little under it. */
+#define RAW_ACC_HZ 500
+#define RAW_GYRO_HZ 500
+#define RAW_MAG_HZ 100
 
 #ifdef BNO070
 
 #include "sensorhub.h"
+#include "sensorhub_hid.h"  // for BNO070_MAX_INPUT_REPORT_LEN
 extern sensorhub_t sensorhub;
 
 bool BNO070Active = false;
 uint8_t BNO070_Report[USB_REPORT_SIZE];
 bool TWI_BNO070_PORT_initialized = false;  // true if already initialized
-uint8_t BNOReportVersion;                  // version 1 or 3 depending on whether velocity is being reported
+uint8_t BNOReportVersion;                  // version 1 or 3 depending on whether velocity is being reported, 4 if timed
+static uint8_t defaultReportVersion_ = 1;  // version chosen at init from the BNO firmware
+static volatile uint8_t pendingReportVersion_ = 0xFF;  // set from USB, applied by the main loop; 0xFF if none
+#ifdef BNO_POSE_PREDICTION
+static volatile uint8_t pendingHorizon_ = 0xFF;  // prediction horizon in ms from USB or console; 0xFF if none
+#endif
+
+/*
+ * Packed reports fill the whole 64-byte interrupt packet with as many samples as are waiting:
+ *   byte 0: PACKED_REPORT_VERSION + (HDMIStatus << 4) + the orientation source in bits 7:6 (see sourceHeaderBits)
+ *   byte 1: number of samples, byte 2: bytes per sample, byte 3: samples dropped since the previous packet
+ *   then per sample: sample time (MCU us, INTN time less the BNO delay, 4), sequence (1), status (1),
+ *   quaternion (Q14, 8), gyro (Q9, 6)
+ *   and, while the accelerometer is on, accelerometer (Q8, 6).
+ * While linear acceleration is on, byte 0 carries PACKED_MOTION_REPORT_VERSION instead and each sample has the
+ * linear acceleration (m/s^2 less gravity, Q8, 6) after the gyro, before any accelerometer channel. Like the gyro and
+ * accelerometer it is in the tracker's own frame; the quaternion rotates that frame into the world.
+ * With BNO_GYRO_PAIRING, bits 7:5 of the status byte (reserved by the BNO) tell how the gyro was paired with the
+ * quaternion, one of the PAIR_ values.
+ */
+#define PACKED_REPORT_VERSION 5
+#define PACKED_HEADER_SIZE 4
+#define PACKED_SAMPLE_SIZE 20
+#define PACKED_ACC_SIZE 6
+#define PACKED_MOTION_REPORT_VERSION 8
 
+/*
+ * Raw IMU reports use the same packet and header with RAW_REPORT_VERSION, for hosts running their own fusion:
+ *   per sample: sensor (SENSORHUB_RAW_ACCELEROMETER, _GYROSCOPE or _MAGNETOMETER, 1), sequence (1),
+ *   x, y, z in ADC counts (6), gyro temperature (reserved for the others, 2), BNO sample time in us (4)
+ */
+#define RAW_REPORT_VERSION 6
+#define RAW_SAMPLE_SIZE 14
+
+/*
+ * Capture reports carry every input report sensorhub_poll() reads, undecoded, for recording and replay on a PC.
+ * Same packet and header with CAPTURE_REPORT_VERSION; byte 2 is 0 as the records vary in length:
+ *   per record: INTN time of the report (MCU us, 4), then the report as read, starting with its length byte
+ */
+#define CAPTURE_REPORT_VERSION 7
+#define CAPTURE_STAMP_SIZE 4
+
+enum
+{
+	STREAM_TRACKER = 0,  // 16-byte tracker report
+	STREAM_PACKED = 1,   // 64-byte reports of fused samples
+	STREAM_RAW = 2,      // 64-byte reports of raw IMU samples
+	STREAM_CAPTURE = 3   // 64-byte reports of undecoded hub reports
+};
+static uint8_t streamMode_ = STREAM_TRACKER;
+static volatile uint8_t pendingStreamMode_ = 0xFF;  // set from USB or console, applied by the main loop; 0xFF if none
+static bool reattachPending_ = false;  // detached to change the IN report size; BNO_Yield reattaches
+static uint32_t detachTime_ = 0;      // svr_clock_ms() at that detach
+#define REATTACH_DELAY_MS 50          // long enough for the host to see the disconnect
+static uint8_t packedReport_[UDI_HID_GENERIC_EP_SIZE];
+static uint8_t packedCount_ = 0;    // samples waiting in packedReport_
+static uint8_t packedDropped_ = 0;  // samples discarded because the endpoint stayed busy (saturates)
+static uint8_t packedBytes_ = 0;    // bytes after the header in use, for the variable-length capture records
+static int16_t lastGyro_[3];        // Q9
+static int16_t lastAcc_[3];         // Q8
+static int16_t lastLinAcc_[3];      // Q8
+
+#ifdef BNO_GYRO_PAIRING
+#define GYRO_HISTORY 4        // calibrated gyro samples kept for pairing, newest first
+#define PAIR_MATCH_US 100     // gyro and orientation sample times this close are taken as the same instant
+#define PAIR_HOLD_US 1500     // longest an orientation is held back waiting for the gyro sample after it
 enum
 {
-	BNO_USE_RV = 0,
-	BNO_USE_GRV = 1
+	PAIR_NONE = 0,          // no gyro sample to pair with
+	PAIR_MATCHED = 1,       // gyro sampled at the same time as the orientation
+	PAIR_INTERPOLATED = 2,  // gyro interpolated between the samples either side of the orientation
+	PAIR_NEAREST = 3        // the gyro sample after it did not arrive in time; the nearest one was used
 };
-/* Set this to 1 to report GRV instead of standard RV */
-uint8_t SELECT_GRV =
-    BNO_USE_GRV;  // When set to 1, the system will use Game Rotation Vector (GRV) which does not align to
-                  // magnetic North.  When set to 0, the system will use Rotation Vector (RV) which will always
-                  // try to have its 0 degree heading aligned with magnetic North.
+static struct
+{
+	uint32_t time;    // BNO sample time in MCU us: INTN time less the reported delay
+	int16_t rate[3];  // Q9
+} gyroHistory_[GYRO_HISTORY];
+static uint8_t gyroHistoryCount_ = 0;
+static bool orientationHeld_ = false;  // heldEvent_ is waiting for a gyro sample at or after its time
+static sensorhub_Event_t heldEvent_;
+static uint32_t heldTimestamp_;        // INTN time of heldEvent_
+static uint32_t heldSince_;            // svr_clock_us() when it was held back
+static uint8_t pairKind_ = PAIR_NONE;  // how the orientation being sent was paired
+static int16_t pairSkew_ = 0;          // us from that orientation sample to its gyro sample, 0 if interpolated
+static uint16_t pairSkewMax_ = 0;
+static uint32_t pairCounts_[4];        // indexed by PAIR_ value
+#endif
+
+/* Per-sensor rates in RATE_STEP_HZ steps (0 = off, RATE_DEFAULT = build default), indexed by BNO070_Sensor_t.
+ * Written from USB or the console; the main loop rebuilds the hub configuration when pendingSensorConfig_ is set. */
+static volatile uint8_t sensorRate_[BNO_SENSOR_COUNT] = {RATE_DEFAULT, RATE_DEFAULT, RATE_DEFAULT, RATE_DEFAULT,
+                                                         RATE_DEFAULT};
+static volatile bool pendingSensorConfig_ = false;
+static volatile uint8_t pendingPersist_ = 0xFF;  // 1 to store the rates, 0 to forget them; 0xFF if none
+
+/* The orientation source, one of the BNO_USE_ values: the Game Rotation Vector (GRV) does not align to magnetic
+ * North, the Rotation Vector (RV) always tries to have its 0 degree heading aligned with it, and the geomagnetic
+ * rotation vector aligns with it without using the gyro. */
+uint8_t SELECT_GRV = BNO_USE_GRV;
+
+/* Switching the source at runtime cross-fades from the old one (see BNO070_SourceFade.h). */
+static volatile uint8_t pendingSource_ = 0xFF;  // set from USB or the console, applied by the main loop; 0xFF if none
+static uint32_t sourceSwitchFailures_ = 0;      // switches given up because the new source never reported
+
+/// Bits 7:6 of report byte 0 name the orientation source: 0 GRV, so reports from before the flag read the same,
+/// 1 RV, 2 geomagnetic RV. During a switch they name the new source. Version 1 reports have no header byte (byte 0
+/// stays 0 for the hosts that expect it), so they do not carry the source.
+static inline uint8_t sourceHeaderBits(void)
+{
+	static const uint8_t bits[BNO_SOURCE_COUNT] = {1, 0, 2};  // indexed by BNO_USE_ value
+	return bits[SELECT_GRV] << 6;
+}
 
 sensorhub_ProductID_t BNO070id;
 Bool BNO_supports_400Hz = false;  // true if firmware is new enough to support higher-rate reads
@@ -76,10 +205,15 @@ struct BNO070_Config
 	{
 		sensorhub_SensorFeature_t rv;
 		sensorhub_SensorFeature_t grv;
+		sensorhub_SensorFeature_t geo_rv;
 		sensorhub_SensorFeature_t acc;
+		sensorhub_SensorFeature_t lin_acc;
 		sensorhub_SensorFeature_t gyro;
 		sensorhub_SensorFeature_t mag;
 		sensorhub_SensorFeature_t stab_det;
+		sensorhub_SensorFeature_t raw_acc;
+		sensorhub_SensorFeature_t raw_gyro;
+		sensorhub_SensorFeature_t raw_mag;
 	} sensors;
 
 	/* calibration flags */
@@ -94,18 +228,100 @@ static struct BNO070_Config config_;
 static struct BNO070_Config dcdSaveConfig_;
 static int magneticFieldStatus_ = 0xff;
 static bool printEvents_ = false;
+static uint32_t untilDcdSave_ = 0xFFFFFFFF;
+
+/* Steps of applyConfig in priority order, so orientation flows again first after a hub reset; a DCD save slows the
+ * sensors in reverse order so the orientation sensor is slowed last and restored first. */
+enum
+{
+	CONFIG_ORIENTATION,  // GRV, then RV, then geomagnetic RV
+	CONFIG_GYRO,
+	CONFIG_ACC,
+	CONFIG_LIN_ACC,
+	CONFIG_MAG,
+	CONFIG_STAB_DET,
+	CONFIG_RAW_ACC,
+	CONFIG_RAW_GYRO,
+	CONFIG_RAW_MAG,
+	CONFIG_DCD_AUTO_SAVE,
+	CONFIG_CAL,
+	CONFIG_STEPS
+};
+#define STEP_BIT(step) (1U << (step))
+
+/* What the hub is configured with, so applyConfigStep only sends what changed; steps whose bit is clear in
+ * hubKnown_ are sent regardless (never set, or the last write failed). */
+static struct BNO070_Config hubConfig_;
+static uint16_t hubKnown_ = 0;
+static uint32_t configWrites_ = 0;   // configuration commands and feature reports sent to the hub
+static uint32_t configSkipped_ = 0;  // ... and left out because the hub already had them
+
+/* DCD save, stepped from BNO_Yield one hub write at a time so tracking reports keep flowing in between */
+enum
+{
+	DCD_IDLE,
+	DCD_SLOWING,    // applying dcdSaveConfig_, step dcdStep_ counting down
+	DCD_SAVING,     // waiting for the hub to answer the save command
+	DCD_RESTORING,  // applying config_, step dcdStep_ counting up
+};
+static uint8_t dcdState_ = DCD_IDLE;
+static uint8_t dcdStep_ = 0;
+static bool dcdManual_ = false;         // started from the console: report the result, don't abort on motion
+static int dcdResult_ = 0;              // outcome to report once the rates are restored
+static uint32_t dcdSaveSent_ = 0;       // svr_clock_ms() when the save command went out
+static uint32_t lastOrientationMs_ = 0; // svr_clock_ms() of the latest RV or GRV event
+static uint32_t gapStart_ = 0;          // lastOrientationMs_ when the orientation sensor was slowed
+static bool gapOpen_ = false;           // orientation slowed, no sample at the full rate yet
+static bool orientationRestored_ = true;
+static uint32_t dcdSaves_ = 0;
+static uint32_t dcdFailures_ = 0;
+static uint32_t dcdAborts_ = 0;
+static uint32_t dcdGapLast_ = 0;
+static uint32_t dcdGapMax_ = 0;
+
+/* Recovery from a hub reset: orientation and gyro are configured at once, the other steps from BNO_Yield */
+static uint8_t recoveryStep_ = CONFIG_STEPS;  // next config_ step to send; CONFIG_STEPS when none is left
+static bool recoveryGapOpen_ = false;         // reset seen, no orientation sample since
+static uint32_t resetTime_ = 0;               // svr_clock_us() at the INTN of the last reset indication
+static uint32_t recoveryLast_ = 0;            // us from that reset indication to the next orientation sample
+static uint32_t recoveryMax_ = 0;
+
+/* Decoded events drained from the hub on each INTN, consumed oldest first */
+#if BNO_EVENT_RING_DEPTH < 1 || BNO_EVENT_RING_DEPTH > 128
+#error "BNO_EVENT_RING_DEPTH must be between 1 and 128"
+#endif
+static sensorhub_Event_t eventRing_[BNO_EVENT_RING_DEPTH];
+static uint32_t eventTime_[BNO_EVENT_RING_DEPTH];      // svr_clock_us() at the INTN edge of each queued event
+static uint32_t eventReadTime_[BNO_EVENT_RING_DEPTH];  // svr_clock_us() when each queued event's read completed
+static uint32_t eventCycles_[BNO_EVENT_RING_DEPTH];   // svr_clock_cycles() spent reading and decoding each event
+static uint32_t decodeTime_;                           // svr_clock_us() when the current event started being handled
+static uint32_t pollCycles_;         // svr_clock_cycles() when the read of the current report started
+static uint32_t trackerCycles_ = 0;  // cycles from reading an orientation report to queueing its HID report
+static uint32_t trackerCyclesMax_ = 0;
+static uint32_t fastPathReports_ = 0;  // reports handled by takeReport() without being decoded
+#ifdef BNO_TRACKER_FAST_PATH
+static uint8_t fastOrientation_ = 0;  // orientation sensor the fast path sends, 0 if none is on
+#if REPORT_GYRO
+static uint8_t fastGyro_ = 0;         // SENSORHUB_GYROSCOPE_CALIBRATED while the gyro is on, else 0
+#endif
+#endif
+static uint8_t eventRingHead_ = 0;        // index of the oldest queued event
+static uint8_t eventRingCount_ = 0;       // number of queued events
+static uint32_t eventRingOverflows_ = 0;  // drains that stopped with reports still pending in the hub
 
 #ifdef PERFORM_BNO_DFU
 #if 1  // 1.7.0
 #define DFU_MAJOR 1
 #define DFU_MINOR 7
 #define DFU_PATCH 0
-#include "bno-hostif/1000-3251_1.7.0.390_avr.c"
+#define DFU_STREAM dfuStream_1_7_0_390
+#include "bno-hostif/1000-3251_1.7.0.390_lz.c"
 #else  // 1.2.5
 #define DFU_MAJOR 1
 #define DFU_MINOR 2
 #define DFU_PATCH 5
-#include "bno-hostif/1000-3251_1.2.5_avr.c"
+#define DFU_STREAM dfuStream_1_2_5
+#include "bno-hostif/1000-3251_1.2.5_lz.c"
 #endif
 #endif
 
@@ -124,13 +340,17 @@ static inline int32_t hz2us(int hz)
 
 #define toFixed32(x, Q) round32(x *(float)(1ul << Q))
 
+static uint32_t productIdMs_ = 0;  // how long the last product ID request took
+
 static sensorhub_ProductID_t readProductId(void)
 {
 	sensorhub_ProductID_t id;
 	memset(&id, 0, sizeof(id));
 
 	sensorhub.debugPrintf("Requesting product ID...\r\n");
+	uint32_t start = svr_clock_ms();
 	int rc = sensorhub_getProductID(&sensorhub, &id);
+	productIdMs_ = svr_clock_ms() - start;
 	if (rc != SENSORHUB_STATUS_SUCCESS)
 	{
 		sensorhub.debugPrintf("readProductId received error: %d\r\n", rc);
@@ -144,6 +364,40 @@ static sensorhub_ProductID_t readProductId(void)
 	return id;
 }
 
+static uint32_t dfuStart_ = 0;                // svr_clock_ms() when the running update started
+static uint32_t dfuReported_ = UINT32_MAX;    // bytes written at the last progress line, UINT32_MAX when idle
+
+void DfuProgress_BNO070(uint32_t written, uint32_t total)
+{
+	uint32_t now = svr_clock_ms();
+
+	if ((dfuReported_ == UINT32_MAX) || (written < dfuReported_))
+	{
+		dfuStart_ = now;
+		dfuReported_ = written;
+		sprintf(Msg, "BNO DFU: sending %lu bytes", (unsigned long)total);
+		WriteLn(Msg);
+		return;
+	}
+
+	uint32_t elapsed = now - dfuStart_;
+	uint32_t rate = elapsed ? written * 1000 / elapsed : 0;  // streams are well under 4 MB
+	if (written >= total)
+	{
+		sprintf(Msg, "BNO DFU: %lu bytes in %lu ms, %lu B/s", (unsigned long)written, (unsigned long)elapsed,
+		        (unsigned long)rate);
+		WriteLn(Msg);
+		dfuReported_ = UINT32_MAX;
+	}
+	else if (written * 10 / total != dfuReported_ * 10 / total)
+	{
+		sprintf(Msg, "BNO DFU: %lu%% %lu B/s", (unsigned long)(written * 100 / total), (unsigned long)rate);
+		WriteLn(Msg);
+		dfuReported_ = written;
+	}
+}
+
+static void dfuProgress(const sensorhub_t *sh, uint32_t written, uint32_t total) { DfuProgress_BNO070(written, total); }
 static void checkDfu(void)
 {
 #ifdef PERFORM_BNO_DFU
@@ -153,7 +407,8 @@ static void checkDfu(void)
 	{
 		sensorhub.debugPrintf("BNO is not at %d.%d.%d.  Performing DFU . . . \r\n", DFU_MAJOR, DFU_MINOR, DFU_PATCH);
 
-		int rc = sensorhub_dfu_avr(&sensorhub, &dfuStream);
+		uint32_t start = svr_clock_ms();
+		int rc = sensorhub_dfu_avr_lz(&sensorhub, &DFU_STREAM);
 		if (rc != SENSORHUB_STATUS_SUCCESS)
 		{
 			sensorhub.debugPrintf("dfu received error: %d\r\n", rc);
@@ -162,6 +417,8 @@ static void checkDfu(void)
 		sensorhub.debugPrintf("DFU Completed Successfully\r\n");
 		// Re-probe:
 		sensorhub_probe(&sensorhub);
+		sprintf(Msg, "BNO DFU done in %lu ms", (unsigned long)(svr_clock_ms() - start));
+		WriteLn(Msg);
 
 		// Get the updated version number
 		readProductId();
@@ -169,30 +426,71 @@ static void checkDfu(void)
 #endif  // PERFORM_BNO_DFU
 }
 
-// TODO - skip the write FRS if the FRS on the device does not differ
-static void configureARVRStabilizationFRS(void)
+/**
+ * True if FRS record @a type on the hub holds exactly @a words words of @a data. The record is read back in chunks so
+ * the SCD needs no RAM copy; one word past the end is asked for so that a longer stored record counts as different.
+ */
+static bool frsMatches(sensorhub_FRS_t type, const uint32_t *data, uint16_t words)
 {
-	int status;
-	int32_t arvrConfig[4] = {
-	    toFixed32(0.2f, 30),  // scaling
-	    degToRadQ28(7.3f),    // maxRotation
-	    degToRadQ28(90.0f),   // maxError
-	    degToRadQ28(0.0f),    // stability
-	};
+	uint32_t chunk[FRS_COMPARE_WORDS];
+	uint16_t offset = 0;
 
-	sensorhub.debugPrintf("Configuring ARVR Stabilization.\r\n");
-	status = sensorhub_writeFRS(&sensorhub, SENSORHUB_FRS_ARVR_CONFIG, (uint32_t *)arvrConfig, 4);
-	if (status != SENSORHUB_STATUS_SUCCESS)
+	for (;;)
+	{
+		uint16_t want = words + 1 - offset;
+		if (want > FRS_COMPARE_WORDS)
+		{
+			want = FRS_COMPARE_WORDS;
+		}
+		uint16_t got = 0;
+		int status = sensorhub_readFRS(&sensorhub, type, chunk, offset, want, &got);
+		if (status == SENSORHUB_STATUS_FRS_READ_OFFSET_OUT_OF_RANGE && offset == words)
+		{
+			return true;  // record ended exactly on a chunk boundary
+		}
+		if (status != SENSORHUB_STATUS_SUCCESS || offset + got > words ||
+		    memcmp(chunk, &data[offset], got * sizeof(uint32_t)) != 0)
+		{
+			return false;  // empty, unreadable, longer or different
+		}
+		if (got < want)
+		{
+			return offset + got == words;  // shorter if it ended early
+		}
+		offset += got;
+	}
+}
+
+/// Write an FRS record unless the hub already has it; returns true if it was written.
+static bool writeFrsIfChanged(sensorhub_FRS_t type, const uint32_t *data, uint16_t words, const char *name)
+{
+	if (frsMatches(type, data, words))
 	{
-		sensorhub.debugPrintf("Write FRS failed: %d", status);
+		sensorhub.debugPrintf("%s up to date.\r\n", name);
+		return false;
 	}
 
-	sensorhub.debugPrintf("Configuring ARVR Game Stabilization.\r\n");
-	status = sensorhub_writeFRS(&sensorhub, SENSORHUB_FRS_ARVR_GAME_CONFIG, (uint32_t *)arvrConfig, 4);
+	sensorhub.debugPrintf("Configuring %s.\r\n", name);
+	int status = sensorhub_writeFRS(&sensorhub, type, data, words);
 	if (status != SENSORHUB_STATUS_SUCCESS)
 	{
-		sensorhub.debugPrintf("Write FRS failed: %d", status);
+		sensorhub.debugPrintf("Write FRS of %s failed: %d", name, status);
 	}
+	return true;
+}
+
+static bool configureARVRStabilizationFRS(void)
+{
+	int32_t arvrConfig[4] = {
+	    toFixed32(0.2f, 30),  // scaling
+	    degToRadQ28(7.3f),    // maxRotation
+	    degToRadQ28(90.0f),   // maxError
+	    degToRadQ28(0.0f),    // stability
+	};
+
+	bool wrote = writeFrsIfChanged(SENSORHUB_FRS_ARVR_CONFIG, (uint32_t *)arvrConfig, 4, "ARVR Stabilization");
+	wrote |= writeFrsIfChanged(SENSORHUB_FRS_ARVR_GAME_CONFIG, (uint32_t *)arvrConfig, 4, "ARVR Game Stabilization");
+	return wrote;
 }
 
 uint8_t const scd[] = {
@@ -201,17 +499,49 @@ uint8_t const scd[] = {
 #include "bno-hostif/SCD-Bosch-BNO070-sqtsNoise.c"
 };
 
-// TODO - skip the write FRS if the FRS on the device does not differ
-static void configureScdFrs(void)
+static bool configureScdFrs(void)
 {
-	int status;
-	sensorhub.debugPrintf("Configuring SCD.\r\n");
-	status =
-	    sensorhub_writeFRS(&sensorhub, SENSORHUB_FRS_SCD_ACTIVE, (uint32_t const *)scd, sizeof(scd) / sizeof(uint32_t));
-	if (status != SENSORHUB_STATUS_SUCCESS)
+	return writeFrsIfChanged(SENSORHUB_FRS_SCD_ACTIVE, (uint32_t const *)scd, sizeof(scd) / sizeof(uint32_t), "SCD");
+}
+
+/// The hub feature of orientation source @a source in @a cfg.
+static sensorhub_SensorFeature_t *orientationFeature(struct BNO070_Config *cfg, uint8_t source)
+{
+	switch (source)
+	{
+	case BNO_USE_RV:
+		return &cfg->sensors.rv;
+	case BNO_USE_GEO_RV:
+		return &cfg->sensors.geo_rv;
+	default:
+		return &cfg->sensors.grv;
+	}
+}
+
+/// Run the selected orientation source at @a interval, and the one being faded out during a switch; the rest are off.
+static void setOrientationInterval(struct BNO070_Config *cfg, int32_t interval)
+{
+	cfg->sensors.rv.reportInterval = 0;
+	cfg->sensors.grv.reportInterval = 0;
+	cfg->sensors.geo_rv.reportInterval = 0;
+	orientationFeature(cfg, SELECT_GRV)->reportInterval = interval;
+	uint8_t fadeFrom = SourceFade_From();
+	if (fadeFrom != SOURCE_FADE_NONE)
+	{
+		orientationFeature(cfg, fadeFrom)->reportInterval = interval;
+	}
+}
+
+/// Report interval for a sensor's runtime rate; false if it has none and keeps the default.
+static bool rateInterval(BNO070_Sensor_t sensor, int32_t *interval)
+{
+	uint8_t steps = sensorRate_[sensor];
+	if (steps == RATE_DEFAULT)
 	{
-		sensorhub.debugPrintf("Write FRS of SCD failed: %d", status);
+		return false;
 	}
+	*interval = hz2us(steps * RATE_STEP_HZ);
+	return true;
 }
 
 static void loadDefaultConfig(struct BNO070_Config *cfg)
@@ -239,15 +569,67 @@ static void loadDefaultConfig(struct BNO070_Config *cfg)
 	/* enable stability detector */
 	cfg->sensors.stab_det.reportInterval = hz2us(10);
 
-	/* rv and grv are mutually exclusive */
-	cfg->sensors.rv.reportInterval = !SELECT_GRV ? common_period : 0;
-	cfg->sensors.grv.reportInterval = SELECT_GRV ? common_period : 0;
+	/* the orientation sources are mutually exclusive, except while switching */
+	setOrientationInterval(cfg, common_period);
 	/* enable the other reports as needed */
 	cfg->sensors.gyro.reportInterval = REPORT_GYRO ? gyro_period : 0;
 	cfg->sensors.acc.reportInterval = REPORT_ACC ? common_period : 0;
+	cfg->sensors.lin_acc.reportInterval = REPORT_LIN_ACC ? common_period : 0;
 	cfg->sensors.mag.reportInterval = REPORT_MAG ? hz2us(100) : 0;
 
 	cfg->cal_flags = ACCEL_CAL_EN;
+
+	/* rates set at runtime or restored from EEPROM */
+	int32_t interval;
+	if (rateInterval(BNO_SENSOR_ORIENTATION, &interval))
+	{
+		setOrientationInterval(cfg, interval);
+	}
+	if (rateInterval(BNO_SENSOR_GYRO, &interval))
+	{
+		cfg->sensors.gyro.reportInterval = interval;
+	}
+	if (rateInterval(BNO_SENSOR_ACC, &interval))
+	{
+		cfg->sensors.acc.reportInterval = interval;
+	}
+	if (rateInterval(BNO_SENSOR_LIN_ACC, &interval))
+	{
+		cfg->sensors.lin_acc.reportInterval = interval;
+	}
+	if (rateInterval(BNO_SENSOR_MAG, &interval))
+	{
+		cfg->sensors.mag.reportInterval = interval;
+	}
+}
+
+/// Raw accelerometer, gyroscope and magnetometer only; the stability detector stays on for manual DCD saves.
+static void loadRawConfig(struct BNO070_Config *cfg)
+{
+	loadDefaultConfig(cfg);
+
+	setOrientationInterval(cfg, 0);
+	cfg->sensors.gyro.reportInterval = 0;
+	cfg->sensors.acc.reportInterval = 0;
+	cfg->sensors.lin_acc.reportInterval = 0;
+	cfg->sensors.mag.reportInterval = 0;
+
+	cfg->sensors.raw_acc.reportInterval = hz2us(RAW_ACC_HZ);
+	cfg->sensors.raw_gyro.reportInterval = hz2us(RAW_GYRO_HZ);
+	cfg->sensors.raw_mag.reportInterval = hz2us(RAW_MAG_HZ);
+}
+
+/// The configuration for the current stream mode.
+static void loadConfig(struct BNO070_Config *cfg)
+{
+	if (streamMode_ == STREAM_RAW)
+	{
+		loadRawConfig(cfg);
+	}
+	else
+	{
+		loadDefaultConfig(cfg);
+	}
 }
 
 static void loadDcdSaveConfig(struct BNO070_Config *cfg)
@@ -273,17 +655,27 @@ static void loadDcdSaveConfig(struct BNO070_Config *cfg)
 	/* enable stability detector */
 	cfg->sensors.stab_det.reportInterval = hz2us(10);
 
-	/* rv and grv are mutually exclusive */
-	cfg->sensors.rv.reportInterval = !SELECT_GRV ? common_period : 0;
-	cfg->sensors.grv.reportInterval = SELECT_GRV ? common_period : 0;
+	/* the orientation sources are mutually exclusive, except while switching */
+	setOrientationInterval(cfg, common_period);
 	/* enable the other reports as needed */
 	cfg->sensors.gyro.reportInterval = REPORT_GYRO ? gyro_period : 0;
 	cfg->sensors.acc.reportInterval = REPORT_ACC ? common_period : 0;
+	cfg->sensors.lin_acc.reportInterval = REPORT_LIN_ACC ? common_period : 0;
 	cfg->sensors.mag.reportInterval = REPORT_MAG ? hz2us(1) : 0;
 
 	cfg->cal_flags = ACCEL_CAL_EN;
 }
 
+/// Read rates stored by PersistSensorConfig_BNO070; sensors without one keep the build default.
+static void loadSensorRates(void)
+{
+	sensorRate_[BNO_SENSOR_ORIENTATION] = GetValidConfigValueOrDefault(OrientationRateOffset, RATE_DEFAULT);
+	sensorRate_[BNO_SENSOR_GYRO] = GetValidConfigValueOrDefault(GyroRateOffset, RATE_DEFAULT);
+	sensorRate_[BNO_SENSOR_ACC] = GetValidConfigValueOrDefault(AccRateOffset, RATE_DEFAULT);
+	sensorRate_[BNO_SENSOR_LIN_ACC] = GetValidConfigValueOrDefault(LinAccRateOffset, RATE_DEFAULT);
+	sensorRate_[BNO_SENSOR_MAG] = GetValidConfigValueOrDefault(MagRateOffset, RATE_DEFAULT);
+}
+
 static void printEvent(const sensorhub_Event_t *event)
 {
 	switch (event->sensor)
@@ -296,6 +688,14 @@ static void printEvent(const sensorhub_Event_t *event)
 	}
 	break;
 
+	case SENSORHUB_LINEAR_ACCELERATION:
+	{
+		sensorhub.debugPrintf("Lin:%02x  0x%04x 0x%04x 0x%04x\r\n", (int)event->sequenceNumber,
+		                      event->un.linearAcceleration.x_16Q8, event->un.linearAcceleration.y_16Q8,
+		                      event->un.linearAcceleration.z_16Q8);
+	}
+	break;
+
 	case SENSORHUB_GYROSCOPE_CALIBRATED:
 	{
 		sensorhub.debugPrintf("Rot:%02x  0x%04x 0x%04x 0x%04x\r\n", (int)event->sequenceNumber,
@@ -319,6 +719,14 @@ static void printEvent(const sensorhub_Event_t *event)
 	}
 	break;
 
+	case SENSORHUB_GEOMAGNETIC_ROTATION_VECTOR:
+	{
+		sensorhub.debugPrintf("GeoRV: %02x %5d %5d %5d %5d\r\n", (int)event->sequenceNumber,
+		                      event->un.geoMagRotationVector.i_16Q14, event->un.geoMagRotationVector.j_16Q14,
+		                      event->un.geoMagRotationVector.k_16Q14, event->un.geoMagRotationVector.real_16Q14);
+	}
+	break;
+
 	case SENSORHUB_GAME_ROTATION_VECTOR:
 	{
 		sensorhub.debugPrintf("RV: %02x %5d %5d %5d %5d\r\n", (int)event->sequenceNumber,
@@ -329,271 +737,1521 @@ static void printEvent(const sensorhub_Event_t *event)
 	}
 }
 
-static void handleEvent(const sensorhub_Event_t *event)
+/// The BNO's delay from sampling to signalling a report, in us, from the report's status and delay bytes.
+static inline uint16_t delayUs(uint8_t status, uint8_t delay) { return (uint16_t)delay << ((status >> 2) & 0x7); }
+static inline uint16_t eventDelayUs(const sensorhub_Event_t *event) { return delayUs(event->status, event->delay); }
+
+/**
+ * Version 4 reports replace the gyro values with the sample timing: bytes 10-13 hold svr_clock_us() when INTN
+ * signalled the report, bytes 14-15 the BNO's own delay in us from sampling to signalling.
+ */
+static void stampReport(uint8_t *report, uint32_t timestamp, uint16_t delay)
+{
+	memcpy(&report[10], &timestamp, 4);
+	memcpy(&report[14], &delay, 2);
+}
+
+/// Copy a quaternion into the report, extrapolated if prediction is enabled.
+static void storeQuaternion(const int16_t *quat_Q14)
 {
-	switch (event->sensor)
+#ifdef BNO_POSE_PREDICTION
+	int16_t predicted[4];
+	memcpy(predicted, quat_Q14, sizeof(predicted));
+	Prediction_Apply(predicted);
+	memcpy(&BNO070_Report[2], predicted, 8);
+#else
+	memcpy(&BNO070_Report[2], quat_Q14, 8);
+#endif
+}
+
+/// Bytes per fused packed sample; the linear acceleration and accelerometer channels are only there while they are on.
+static inline uint8_t packedSampleSize(void)
+{
+	uint8_t size = PACKED_SAMPLE_SIZE;
+	if (config_.sensors.lin_acc.reportInterval)
 	{
-	case SENSORHUB_ROTATION_VECTOR:
+		size += PACKED_ACC_SIZE;
+	}
+	if (config_.sensors.acc.reportInterval)
 	{
-		BNO070_Report[1] = event->sequenceNumber;
-		memcpy(&BNO070_Report[2], &event->un.rotationVector.i_16Q14, 8);  // copy quaternion data
-#ifdef MeasurePerformance
-		TimingDebug_event2();
-		TimingDebug_RecordEventType(1);
-#endif
-		udi_hid_generic_send_report_in(BNO070_Report);
+		size += PACKED_ACC_SIZE;
 	}
-	break;
+	return size;
+}
 
-	case SENSORHUB_GAME_ROTATION_VECTOR:
+/**
+ * Try to send the waiting packed samples; they stay queued if the endpoint is busy. Packed reports do not go through
+ * ReportQueue, whose slots hold 16-byte tracker reports: there is only ever the one being filled, and the endpoint
+ * takes a copy of it. They are still counted in its statistics, with the samples dropped from them.
+ */
+static void flushPacked(void)
+{
+	if (packedCount_ == 0)
 	{
-		BNO070_Report[1] = event->sequenceNumber;
-		memcpy(&BNO070_Report[2], &event->un.gameRotationVector.i_16Q14, 8);  // copy quaternion data
-#ifdef MeasurePerformance
-		TimingDebug_event2();
-		TimingDebug_RecordEventType(2);
-#endif
-		udi_hid_generic_send_report_in(BNO070_Report);
+		return;
 	}
-	break;
 
-	case SENSORHUB_GYROSCOPE_CALIBRATED:
+	switch (streamMode_)
 	{
-		memcpy(&BNO070_Report[10], &event->un.gyroscope.x_16Q9, 6);  // copy gyroscope values
+	case STREAM_RAW:
+		packedReport_[0] = RAW_REPORT_VERSION;
+		packedReport_[2] = RAW_SAMPLE_SIZE;
+		break;
+	case STREAM_CAPTURE:
+		packedReport_[0] = CAPTURE_REPORT_VERSION;
+		packedReport_[2] = 0;
+		break;
+	default:
+		packedReport_[0] = config_.sensors.lin_acc.reportInterval ? PACKED_MOTION_REPORT_VERSION : PACKED_REPORT_VERSION;
+		packedReport_[0] += sourceHeaderBits();
+		packedReport_[2] = packedSampleSize();
+		break;
 	}
-	break;
+	packedReport_[0] += HDMIStatus << 4;
+	packedReport_[1] = packedCount_;
+	packedReport_[3] = packedDropped_;
+	if (udi_hid_generic_send_report_in(packedReport_))
+	{
+		ReportQueue_CountDirect(packedDropped_);
+		packedCount_ = 0;
+		packedDropped_ = 0;
+		packedBytes_ = 0;
+	}
+}
 
-	case SENSORHUB_MAGNETIC_FIELD_CALIBRATED:
+/// Slot for the next sample of @a sampleSize bytes in packedReport_; drops the oldest if the packet is full.
+static uint8_t *nextPackedSample(uint8_t sampleSize)
+{
+	uint8_t maxSamples = (UDI_HID_GENERIC_EP_SIZE - PACKED_HEADER_SIZE) / sampleSize;
+	if (packedCount_ == maxSamples)
 	{
-		// store the mag status field only if the mag is enabled
-		if (config_.sensors.mag.reportInterval)
+		// endpoint busy for a whole packet's worth of samples: keep the newest
+		memmove(&packedReport_[PACKED_HEADER_SIZE], &packedReport_[PACKED_HEADER_SIZE + sampleSize],
+		        (maxSamples - 1) * sampleSize);
+		packedCount_--;
+		if (packedDropped_ < 0xFF)
 		{
-			magneticFieldStatus_ = event->status & 0x3;
+			packedDropped_++;
 		}
-		// we don't send it to the host (yet?)
-	}
-	break;
 	}
+	return &packedReport_[PACKED_HEADER_SIZE + packedCount_ * sampleSize];
+}
 
-	if (printEvents_)
-	{
-		printEvent(event);
-	}
+/// Add the sample just written to the slot from nextPackedSample() and try to send the packet.
+static void commitPackedSample(uint8_t *sample, uint8_t sampleSize)
+{
+	packedCount_++;
+
+	// clear what is left of the packet so stale samples never reach the host
+	memset(sample + sampleSize, 0, sizeof(packedReport_) - (sample + sampleSize - packedReport_));
+
+	flushPacked();
 }
 
-static inline int checkError(int status, const char *msg)
+/// Queue the orientation just stored in BNO070_Report, with the latest rates, as a packed sample.
+static void appendPacked(const sensorhub_Event_t *event, uint32_t timestamp)
 {
-	if (status < 0)
+	uint8_t size = packedSampleSize();
+	uint8_t *sample = nextPackedSample(size);
+	uint32_t sampleTime = timestamp - eventDelayUs(event);
+	memcpy(&sample[0], &sampleTime, 4);
+	sample[4] = event->sequenceNumber;
+#ifdef BNO_GYRO_PAIRING
+	sample[5] = (event->status & 0x1F) | (pairKind_ << 5);
+#else
+	sample[5] = event->status;
+#endif
+	memcpy(&sample[6], &BNO070_Report[2], 8);
+	memcpy(&sample[14], lastGyro_, 6);
+	uint8_t offset = PACKED_SAMPLE_SIZE;
+	if (config_.sensors.lin_acc.reportInterval)
 	{
-		sensorhub.debugPrintf("Err %d: %s", status, msg);
+		memcpy(&sample[offset], lastLinAcc_, 6);
+		offset += PACKED_ACC_SIZE;
 	}
-	return status;
+	if (offset < size)
+	{
+		memcpy(&sample[offset], lastAcc_, 6);
+	}
+	commitPackedSample(sample, size);
+}
+
+/// Queue a raw accelerometer, gyroscope or magnetometer sample for the raw IMU stream.
+static void appendRaw(const sensorhub_Event_t *event)
+{
+	uint8_t *sample = nextPackedSample(RAW_SAMPLE_SIZE);
+	sample[0] = event->sensor;
+	sample[1] = event->sequenceNumber;
+	// all three are decoded into field16[0..3] and field32[2]; the named raw structs only match that with padding
+	memcpy(&sample[2], &event->un.field16[0], 8);
+	memcpy(&sample[10], &event->un.field32[2], 4);
+	commitPackedSample(sample, RAW_SAMPLE_SIZE);
+	Latency_Record(LATENCY_DECODE_TO_QUEUE, svr_clock_us() - decodeTime_);
 }
 
 /**
- * Apply settings in activeConfig_ to BNO
+ * Queue an input report as read from the hub, stamped with its INTN time, for the capture stream. When the endpoint
+ * has been busy for a whole packet the oldest records are dropped to make room.
  */
-static bool applyConfig(struct BNO070_Config *cfg)
+static void appendCapture(const uint8_t *report, uint32_t timestamp)
 {
-	int status;
-
-	/* Disable DCD Auto save, which is on by default */
-	status = sensorhub_dcdAutoSave(&sensorhub, cfg->dcd_auto_save);
-	checkError(status, "Error configuring DCD auto save.");
-
-	if (BNO_supports_400Hz)
+	uint8_t length = report[0];
+	if (length > BNO070_MAX_INPUT_REPORT_LEN)
 	{
-		/* Cal Enable introduced in version 1.8.x */
-		status = sensorhub_calEnable(&sensorhub, cfg->cal_flags);
-		if (checkError(status, "error setting cal enable flags") < 0)
+		length = BNO070_MAX_INPUT_REPORT_LEN;
+	}
+	uint8_t size = CAPTURE_STAMP_SIZE + length;
+	uint8_t *records = &packedReport_[PACKED_HEADER_SIZE];
+	while (packedBytes_ + size > UDI_HID_GENERIC_EP_SIZE - PACKED_HEADER_SIZE)
+	{
+		uint8_t oldest = CAPTURE_STAMP_SIZE + records[CAPTURE_STAMP_SIZE];
+		memmove(records, records + oldest, packedBytes_ - oldest);
+		packedBytes_ -= oldest;
+		packedCount_--;
+		if (packedDropped_ < 0xFF)
 		{
-			return false;
+			packedDropped_++;
 		}
 	}
 
-	/* Enable stability classifier -- we need to use it for manual DCD saves */
-	status = sensorhub_setDynamicFeature(&sensorhub, SENSORHUB_ACTIVITY_CLASSIFICATION, &cfg->sensors.stab_det);
-	if (checkError(status, "error setting Stability Detector") < 0)
+	uint8_t *record = records + packedBytes_;
+	memcpy(record, &timestamp, CAPTURE_STAMP_SIZE);
+	memcpy(record + CAPTURE_STAMP_SIZE, report, length);
+	record[CAPTURE_STAMP_SIZE] = length;  // as clamped, so the host can walk the records
+	packedBytes_ += size;
+	packedCount_++;
+	memset(records + packedBytes_, 0, sizeof(packedReport_) - PACKED_HEADER_SIZE - packedBytes_);
+
+	flushPacked();
+}
+
+/// Queue the orientation in BNO070_Report in the current report format.
+static void queueOrientation(const sensorhub_Event_t *event, uint32_t timestamp)
+{
+	if (streamMode_ == STREAM_PACKED)
 	{
-		return false;
+		appendPacked(event, timestamp);
 	}
-
-	status = sensorhub_setDynamicFeature(&sensorhub, SENSORHUB_ROTATION_VECTOR, &cfg->sensors.rv);
-	if (checkError(status, "error setting RV") < 0)
+	else
 	{
-		return false;
+		ReportQueue_Push(BNO070_Report);
 	}
+	Latency_Record(LATENCY_DECODE_TO_QUEUE, svr_clock_us() - decodeTime_);
+}
+
+#ifdef BNO_GYRO_PAIRING
+/// True while the gyro goes out next to the orientation, so the two are worth pairing.
+static bool pairingActive(void)
+{
+	return config_.sensors.gyro.reportInterval &&
+	       (streamMode_ == STREAM_PACKED || (streamMode_ == STREAM_TRACKER && BNOReportVersion != 4));
+}
+
+/// Forget the gyro history and drop any held orientation once the configuration or report format has changed.
+static void resetPairing(void)
+{
+	gyroHistoryCount_ = 0;
+	orientationHeld_ = false;
+}
 
-	status = sensorhub_setDynamicFeature(&sensorhub, SENSORHUB_GAME_ROTATION_VECTOR, &cfg->sensors.grv);
-	if (checkError(status, "error setting GRV") < 0)
+static void notePair(uint8_t kind, int32_t skew)
+{
+	if (skew > INT16_MAX)
 	{
-		return false;
+		skew = INT16_MAX;
+	}
+	else if (skew < -INT16_MAX)
+	{
+		skew = -INT16_MAX;
+	}
+	pairKind_ = kind;
+	pairSkew_ = (int16_t)skew;
+	pairCounts_[kind]++;
+	uint16_t magnitude = (uint16_t)((skew < 0) ? -skew : skew);
+	if (magnitude > pairSkewMax_)
+	{
+		pairSkewMax_ = magnitude;
 	}
+}
 
-	status = sensorhub_setDynamicFeature(&sensorhub, SENSORHUB_ACCELEROMETER, &cfg->sensors.acc);
-	if (checkError(status, "error setting ACCEL") < 0)
+/**
+ * Put the gyro for an orientation sampled at @a time into @a rate: a sample taken at the same time, else one
+ * interpolated from the samples either side. Without @a force, false means no sample at or after that time has
+ * arrived yet and it is worth waiting for; with it, the newest sample is used instead.
+ */
+static bool pairGyro(uint32_t time, int16_t *rate, bool force)
+{
+	for (uint8_t i = 0; i < gyroHistoryCount_; i++)
 	{
-		return false;
+		int32_t skew = (int32_t)(gyroHistory_[i].time - time);
+		if (skew >= -PAIR_MATCH_US && skew <= PAIR_MATCH_US)
+		{
+			memcpy(rate, gyroHistory_[i].rate, 6);
+			notePair(PAIR_MATCHED, skew);
+			return true;
+		}
+		if (skew < 0 && i > 0)
+		{
+			// gyroHistory_[i] was sampled before the orientation and gyroHistory_[i - 1] after it
+			uint32_t span = gyroHistory_[i - 1].time - gyroHistory_[i].time;
+			int16_t fraction = (int16_t)(((uint32_t)-skew << 8) / span);  // Q8, below 1
+			for (uint8_t axis = 0; axis < 3; axis++)
+			{
+				int32_t before = gyroHistory_[i].rate[axis];
+				int32_t after = gyroHistory_[i - 1].rate[axis];
+				rate[axis] = (int16_t)(before + (((after - before) * fraction) >> 8));
+			}
+			notePair(PAIR_INTERPOLATED, 0);
+			return true;
+		}
+		if (skew < 0)
+		{
+			break;  // every sample is older than the orientation
+		}
 	}
 
-	status = sensorhub_setDynamicFeature(&sensorhub, SENSORHUB_GYROSCOPE_CALIBRATED, &cfg->sensors.gyro);
-	if (checkError(status, "error setting GYRO") < 0)
+	if (gyroHistoryCount_ && (force || (int32_t)(gyroHistory_[0].time - time) > 0))
 	{
-		return false;
+		// the newest sample if we gave up waiting, or the oldest kept if even that is later than the orientation
+		uint8_t nearest = force ? 0 : gyroHistoryCount_ - 1;
+		memcpy(rate, gyroHistory_[nearest].rate, 6);
+		notePair(PAIR_NEAREST, (int32_t)(gyroHistory_[nearest].time - time));
+		return true;
+	}
+	if (force)
+	{
+		memset(rate, 0, 6);
+		notePair(PAIR_NONE, 0);
+		return true;
 	}
+	return false;
+}
 
-	status = sensorhub_setDynamicFeature(&sensorhub, SENSORHUB_MAGNETIC_FIELD_CALIBRATED, &cfg->sensors.mag);
-	if (checkError(status, "error setting MAG") < 0)
+/// Pair an orientation with the gyro, putting the gyro where the report format carries it; false if it is held.
+static bool pairOrientation(const sensorhub_Event_t *event, uint32_t timestamp, bool force)
+{
+	int16_t rate[3];
+	if (!pairGyro(timestamp - eventDelayUs(event), rate, force))
 	{
+		heldEvent_ = *event;
+		heldTimestamp_ = timestamp;
+		heldSince_ = svr_clock_us();
+		orientationHeld_ = true;
 		return false;
 	}
-
+	memcpy(lastGyro_, rate, 6);
+	if (BNOReportVersion != 4)
+	{
+		memcpy(&BNO070_Report[10], rate, 6);
+	}
 	return true;
 }
 
-bool init_BNO070(void)
+/// Send the held orientation with the best gyro there is. BNO070_Report still holds its quaternion.
+static void releaseHeldOrientation(void)
 {
-	int result;
-
-	// determine if we are in GRV or RV mode
-	GetValidConfigValueOrWriteDefault(GRVOffset, BNO_USE_GRV, &SELECT_GRV);
+	if (orientationHeld_)
+	{
+		orientationHeld_ = false;
+		pairOrientation(&heldEvent_, heldTimestamp_, true);
+		queueOrientation(&heldEvent_, heldTimestamp_);
+	}
+}
 
-	// Clear BNO070_Report so we don't send garbage out the USB.
+/// Give up waiting for a gyro sample once PAIR_HOLD_US has passed; called from the main loop.
+static void checkHeldOrientation(void)
+{
+	if (orientationHeld_ && (uint32_t)(svr_clock_us() - heldSince_) >= PAIR_HOLD_US)
+	{
+		releaseHeldOrientation();
+	}
+}
+
+/// Keep a gyro sample for pairing, and send the held orientation if this is the sample it was waiting for.
+static void recordGyro(const int16_t *rate, uint32_t time)
+{
+	memmove(&gyroHistory_[1], &gyroHistory_[0], (GYRO_HISTORY - 1) * sizeof(gyroHistory_[0]));
+	gyroHistory_[0].time = time;
+	memcpy(gyroHistory_[0].rate, rate, 6);
+	if (gyroHistoryCount_ < GYRO_HISTORY)
+	{
+		gyroHistoryCount_++;
+	}
+
+	if (orientationHeld_ && (int32_t)(time - (heldTimestamp_ - eventDelayUs(&heldEvent_))) >= -PAIR_MATCH_US)
+	{
+		releaseHeldOrientation();
+	}
+}
+#endif
+
+/// Send the orientation just stored in BNO070_Report in the current report format.
+static void sendOrientation(const sensorhub_Event_t *event, uint32_t timestamp)
+{
+	if (streamMode_ == STREAM_RAW || streamMode_ == STREAM_CAPTURE)
+	{
+		return;  // fused samples go out only in the tracker and packed formats
+	}
+#ifdef BNO_GYRO_PAIRING
+	if (!pairingActive())
+	{
+		pairKind_ = PAIR_NONE;
+	}
+	else if (!pairOrientation(event, timestamp, false))
+	{
+		return;  // held until the gyro sample after it arrives
+	}
+#endif
+	queueOrientation(event, timestamp);
+}
+
+static inline bool isOrientation(uint8_t sensor)
+{
+	return sensor == SENSORHUB_ROTATION_VECTOR || sensor == SENSORHUB_GAME_ROTATION_VECTOR ||
+	       sensor == SENSORHUB_GEOMAGNETIC_ROTATION_VECTOR;
+}
+
+/// The BNO_USE_ value of an orientation sensor.
+static uint8_t orientationSource(uint8_t sensor)
+{
+	switch (sensor)
+	{
+	case SENSORHUB_ROTATION_VECTOR:
+		return BNO_USE_RV;
+	case SENSORHUB_GEOMAGNETIC_ROTATION_VECTOR:
+		return BNO_USE_GEO_RV;
+	default:
+		return BNO_USE_GRV;
+	}
+}
+
+#ifdef BNO_TRACKER_FAST_PATH
+/// Point the fast path at the sensors config_ turns on: the selected orientation source and, if built in, the gyro.
+static void selectFastPath(void)
+{
+	static const uint8_t sourceSensors[BNO_SOURCE_COUNT] = {
+	    [BNO_USE_RV] = SENSORHUB_ROTATION_VECTOR,
+	    [BNO_USE_GRV] = SENSORHUB_GAME_ROTATION_VECTOR,
+	    [BNO_USE_GEO_RV] = SENSORHUB_GEOMAGNETIC_ROTATION_VECTOR};
+
+	fastOrientation_ = orientationFeature(&config_, SELECT_GRV)->reportInterval ? sourceSensors[SELECT_GRV] : 0;
+#if REPORT_GYRO
+	fastGyro_ = config_.sensors.gyro.reportInterval ? SENSORHUB_GYROSCOPE_CALIBRATED : 0;
+#endif
+}
+#endif
+
+/**
+ * The quaternion to report for an orientation event, in @a quat; false if the event is not reported. Outside a
+ * switch only the selected source is reported; during one, the old source's samples are remembered and the new
+ * source's are blended with them.
+ */
+static bool fadeOrientation(const sensorhub_Event_t *event, int16_t *quat)
+{
+	// i, j, k, real for all three sources
+	return SourceFade_Sample(orientationSource(event->sensor), SELECT_GRV, &event->un.field16[0], svr_clock_ms(), quat);
+}
+
+static void handleEvent(const sensorhub_Event_t *event, uint32_t timestamp)
+{
+	switch (event->sensor)
+	{
+	case SENSORHUB_ROTATION_VECTOR:
+	case SENSORHUB_GAME_ROTATION_VECTOR:
+	case SENSORHUB_GEOMAGNETIC_ROTATION_VECTOR:
+	{
+		int16_t quat[4];
+		if (!fadeOrientation(event, quat))
+		{
+			break;
+		}
+#ifdef BNO_GYRO_PAIRING
+		releaseHeldOrientation();  // before its quaternion is overwritten
+#endif
+		BNO070_Report[1] = event->sequenceNumber;
+		storeQuaternion(quat);  // copy quaternion data
+		if (BNOReportVersion == 4)
+		{
+			stampReport(BNO070_Report, timestamp, eventDelayUs(event));
+		}
+#ifdef MeasurePerformance
+		TimingDebug_event2();
+		TimingDebug_RecordEventType(event->sensor == SENSORHUB_GAME_ROTATION_VECTOR ? 2 : 1);
+#endif
+		sendOrientation(event, timestamp);
+	}
+	break;
+
+	case SENSORHUB_GYROSCOPE_CALIBRATED:
+	{
+#ifdef BNO_POSE_PREDICTION
+		const int16_t gyro[3] = {event->un.gyroscope.x_16Q9, event->un.gyroscope.y_16Q9,
+		                         event->un.gyroscope.z_16Q9};
+		Prediction_UpdateGyro(gyro);
+#endif
+#ifdef BNO_GYRO_PAIRING
+		if (pairingActive())
+		{
+			recordGyro(&event->un.gyroscope.x_16Q9, timestamp - eventDelayUs(event));
+			break;  // the gyro goes out with the orientation it is paired with
+		}
+#endif
+		memcpy(lastGyro_, &event->un.gyroscope.x_16Q9, 6);
+		if (BNOReportVersion != 4)
+		{
+			memcpy(&BNO070_Report[10], &event->un.gyroscope.x_16Q9, 6);  // copy gyroscope values
+		}
+	}
+	break;
+
+	case SENSORHUB_ACCELEROMETER:
+	{
+		memcpy(lastAcc_, &event->un.accelerometer.x_16Q8, 6);
+	}
+	break;
+
+	case SENSORHUB_LINEAR_ACCELERATION:
+	{
+		memcpy(lastLinAcc_, &event->un.linearAcceleration.x_16Q8, 6);
+	}
+	break;
+
+	case SENSORHUB_MAGNETIC_FIELD_CALIBRATED:
+	{
+		// store the mag status field only if the mag is enabled
+		if (config_.sensors.mag.reportInterval)
+		{
+			magneticFieldStatus_ = event->status & 0x3;
+		}
+		// we don't send it to the host (yet?)
+	}
+	break;
+
+	case SENSORHUB_RAW_ACCELEROMETER:
+	case SENSORHUB_RAW_GYROSCOPE:
+	case SENSORHUB_RAW_MAGNETOMETER:
+	{
+		if (streamMode_ == STREAM_RAW)
+		{
+			appendRaw(event);
+		}
+	}
+	break;
+	}
+
+	if (printEvents_)
+	{
+		printEvent(event);
+	}
+}
+
+static inline int checkError(int status, const char *msg)
+{
+	if (status < 0)
+	{
+		sensorhub.debugPrintf("Err %d: %s", status, msg);
+	}
+	return status;
+}
+
+/// Finish the DCD save in progress, reporting it on the console if it was asked for there.
+static void endDcdSave(int result)
+{
+	dcdState_ = DCD_IDLE;
+	if (result == SENSORHUB_STATUS_SUCCESS)
+	{
+		dcdSaves_++;
+	}
+	else if (result != DCD_SAVE_ABORTED)
+	{
+		dcdFailures_++;
+	}
+	if (dcdManual_)
+	{
+		WriteLn((result == SENSORHUB_STATUS_SUCCESS) ? "DCD Saved." : "DCD save failed.");
+	}
+}
+
+/// The hub has just reset: every sensor is off and DCD auto save is on. Its calibration flags are not assumed.
+static void hubConfigReset(void)
+{
+	memset(&hubConfig_, 0, sizeof(hubConfig_));
+	hubConfig_.dcd_auto_save = 1;
+	hubKnown_ = (uint16_t)(STEP_BIT(CONFIG_STEPS) - 1) & ~STEP_BIT(CONFIG_CAL);
+}
+
+/// Send one sensor's configuration unless the hub is known to have it already.
+static bool setFeature(bool known, sensorhub_Sensor_t sensor, const sensorhub_SensorFeature_t *feature,
+                       sensorhub_SensorFeature_t *hub, const char *msg)
+{
+	if (known && memcmp(feature, hub, sizeof(*feature)) == 0)
+	{
+		configSkipped_++;
+		return true;
+	}
+	configWrites_++;
+	int status = sensorhub_setDynamicFeature(&sensorhub, sensor, feature);
+	if (checkError(status, msg) < 0)
+	{
+		return false;
+	}
+	*hub = *feature;
+	return true;
+}
+
+/**
+ * Apply one step of cfg to BNO, skipping it if the hub already has it
+ */
+static bool applyConfigStep(struct BNO070_Config *cfg, uint8_t step)
+{
+	bool known = (hubKnown_ & STEP_BIT(step)) != 0;
+	bool ok = true;
+	int status;
+
+	switch (step)
+	{
+	case CONFIG_ORIENTATION:
+		ok = setFeature(known, SENSORHUB_GAME_ROTATION_VECTOR, &cfg->sensors.grv, &hubConfig_.sensors.grv,
+		                "error setting GRV") &&
+		     setFeature(known, SENSORHUB_ROTATION_VECTOR, &cfg->sensors.rv, &hubConfig_.sensors.rv,
+		                "error setting RV") &&
+		     setFeature(known, SENSORHUB_GEOMAGNETIC_ROTATION_VECTOR, &cfg->sensors.geo_rv, &hubConfig_.sensors.geo_rv,
+		                "error setting geomagnetic RV");
+		break;
+
+	case CONFIG_GYRO:
+		ok = setFeature(known, SENSORHUB_GYROSCOPE_CALIBRATED, &cfg->sensors.gyro, &hubConfig_.sensors.gyro,
+		                "error setting GYRO");
+		break;
+
+	case CONFIG_ACC:
+		ok = setFeature(known, SENSORHUB_ACCELEROMETER, &cfg->sensors.acc, &hubConfig_.sensors.acc,
+		                "error setting ACCEL");
+		break;
+
+	case CONFIG_LIN_ACC:
+		ok = setFeature(known, SENSORHUB_LINEAR_ACCELERATION, &cfg->sensors.lin_acc, &hubConfig_.sensors.lin_acc,
+		                "error setting linear ACCEL");
+		break;
+
+	case CONFIG_MAG:
+		ok = setFeature(known, SENSORHUB_MAGNETIC_FIELD_CALIBRATED, &cfg->sensors.mag, &hubConfig_.sensors.mag,
+		                "error setting MAG");
+		break;
+
+	case CONFIG_STAB_DET:
+		/* Enable stability classifier -- we need to use it for manual DCD saves */
+		ok = setFeature(known, SENSORHUB_ACTIVITY_CLASSIFICATION, &cfg->sensors.stab_det, &hubConfig_.sensors.stab_det,
+		                "error setting Stability Detector");
+		break;
+
+	case CONFIG_RAW_ACC:
+		ok = setFeature(known, SENSORHUB_RAW_ACCELEROMETER, &cfg->sensors.raw_acc, &hubConfig_.sensors.raw_acc,
+		                "error setting raw ACCEL");
+		break;
+
+	case CONFIG_RAW_GYRO:
+		ok = setFeature(known, SENSORHUB_RAW_GYROSCOPE, &cfg->sensors.raw_gyro, &hubConfig_.sensors.raw_gyro,
+		                "error setting raw GYRO");
+		break;
+
+	case CONFIG_RAW_MAG:
+		ok = setFeature(known, SENSORHUB_RAW_MAGNETOMETER, &cfg->sensors.raw_mag, &hubConfig_.sensors.raw_mag,
+		                "error setting raw MAG");
+		break;
+
+	case CONFIG_DCD_AUTO_SAVE:
+		if (known && cfg->dcd_auto_save == hubConfig_.dcd_auto_save)
+		{
+			configSkipped_++;
+			return true;
+		}
+		/* Disable DCD Auto save, which is on by default */
+		configWrites_++;
+		status = sensorhub_dcdAutoSave(&sensorhub, cfg->dcd_auto_save);
+		checkError(status, "Error configuring DCD auto save.");
+		hubConfig_.dcd_auto_save = cfg->dcd_auto_save;
+		if (status < 0)
+		{
+			hubKnown_ &= ~STEP_BIT(step);  // not fatal, but try again next time
+			return true;
+		}
+		break;
+
+	case CONFIG_CAL:
+		if (!BNO_supports_400Hz)
+		{
+			return true;
+		}
+		if (known && cfg->cal_flags == hubConfig_.cal_flags)
+		{
+			configSkipped_++;
+			return true;
+		}
+		/* Cal Enable introduced in version 1.8.x */
+		configWrites_++;
+		status = sensorhub_calEnable(&sensorhub, cfg->cal_flags);
+		ok = checkError(status, "error setting cal enable flags") >= 0;
+		hubConfig_.cal_flags = cfg->cal_flags;
+		break;
+
+	default:
+		return true;
+	}
+
+	if (ok)
+	{
+		hubKnown_ |= STEP_BIT(step);
+	}
+	else
+	{
+		hubKnown_ &= ~STEP_BIT(step);
+	}
+	return ok;
+}
+
+/**
+ * Apply settings in activeConfig_ to BNO
+ */
+static bool applyConfig(struct BNO070_Config *cfg)
+{
+	if (cfg == &config_)
+	{
+		if (dcdState_ != DCD_IDLE)
+		{
+			endDcdSave(SENSORHUB_STATUS_OP_FAILED);  // the save's rates are being replaced; give it up
+		}
+		orientationRestored_ = true;
+		recoveryStep_ = CONFIG_STEPS;  // everything is sent now
+#ifdef BNO_TRACKER_FAST_PATH
+		selectFastPath();
+#endif
+	}
+
+	for (uint8_t step = 0; step < CONFIG_STEPS; step++)
+	{
+		if (!applyConfigStep(cfg, step))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/// Switch to restoring config_; result is reported when that is done.
+static void restoreAfterDcdSave(int result)
+{
+	dcdResult_ = result;
+	dcdState_ = DCD_RESTORING;
+	dcdStep_ = 0;
+}
+
+/// Take the DCD save one hub write further.
+static void stepDcdSave(void)
+{
+	switch (dcdState_)
+	{
+	case DCD_SLOWING:
+		if (dcdStep_ == CONFIG_ORIENTATION && orientationFeature(&config_, SELECT_GRV)->reportInterval)
+		{
+			gapStart_ = lastOrientationMs_;
+			gapOpen_ = true;
+			orientationRestored_ = false;
+		}
+		if (!applyConfigStep(&dcdSaveConfig_, dcdStep_))
+		{
+			restoreAfterDcdSave(SENSORHUB_STATUS_OP_FAILED);
+		}
+		else if (dcdStep_ > 0)
+		{
+			dcdStep_--;
+		}
+		else if (sensorhub_startSaveDcd(&sensorhub) != SENSORHUB_STATUS_SUCCESS)
+		{
+			restoreAfterDcdSave(sensorhub_dcdSaveStatus);
+		}
+		else
+		{
+			dcdSaveSent_ = svr_clock_ms();
+			dcdState_ = DCD_SAVING;
+		}
+		break;
+
+	case DCD_SAVING:
+		if (sensorhub_dcdSaveStatus != SENSORHUB_STATUS_DCD_SAVE_PENDING)
+		{
+			restoreAfterDcdSave(sensorhub_dcdSaveStatus);
+		}
+		else if (svr_clock_ms() - dcdSaveSent_ > DCD_SAVE_TIMEOUT_MS)
+		{
+			restoreAfterDcdSave(SENSORHUB_STATUS_UNEXPECTED_REPORT);
+		}
+		break;
+
+	case DCD_RESTORING:
+		applyConfigStep(&config_, dcdStep_);
+		if (dcdStep_ == CONFIG_ORIENTATION)
+		{
+			orientationRestored_ = true;
+		}
+		if (++dcdStep_ == CONFIG_STEPS)
+		{
+			endDcdSave(dcdResult_);
+		}
+		break;
+	}
+}
+
+/// Begin a DCD save at 1Hz sensor rates; false if one is already under way or the hub is still being reconfigured.
+static bool startDcdSave(bool manual)
+{
+	if (dcdState_ != DCD_IDLE || recoveryStep_ < CONFIG_STEPS)
+	{
+		return false;
+	}
+	dcdManual_ = manual;
+	dcdState_ = DCD_SLOWING;
+	dcdStep_ = CONFIG_STEPS - 1;
+	return true;
+}
+
+/**
+ * The hub has reset itself and lost its configuration. Its descriptor and product ID are as before, so rather than
+ * probing it again only the orientation and gyro are set up here, so tracking resumes as soon as the hub can deliver;
+ * stepRecovery() sends the rest of config_ afterwards, one step per yield.
+ */
+static void recoverFromReset(uint32_t timestamp)
+{
+	resetTime_ = timestamp;
+	recoveryGapOpen_ = true;
+	hubConfigReset();
+	if (dcdState_ != DCD_IDLE)
+	{
+		endDcdSave(SENSORHUB_STATUS_OP_FAILED);  // the hub forgot the save's rates along with everything else
+	}
+	orientationRestored_ = true;
+	gapOpen_ = false;
+
+	applyConfigStep(&config_, CONFIG_ORIENTATION);
+	applyConfigStep(&config_, CONFIG_GYRO);
+	recoveryStep_ = CONFIG_GYRO + 1;
+}
+
+/// Send the next step of config_ left over from recoverFromReset().
+static void stepRecovery(void)
+{
+	if (recoveryStep_ < CONFIG_STEPS)
+	{
+		applyConfigStep(&config_, recoveryStep_++);  // a failed step is sent again by the next applyConfig()
+	}
+}
+
+/// Orientation report handled: close the tracking gap of a DCD save or hub reset once the full rate is back.
+static void orientationSample(void)
+{
+	lastOrientationMs_ = svr_clock_ms();
+	if (recoveryGapOpen_)
+	{
+		recoveryGapOpen_ = false;
+		recoveryLast_ = svr_clock_us() - resetTime_;
+		if (recoveryLast_ > recoveryMax_)
+		{
+			recoveryMax_ = recoveryLast_;
+		}
+	}
+	if (gapOpen_ && orientationRestored_)
+	{
+		gapOpen_ = false;
+		dcdGapLast_ = lastOrientationMs_ - gapStart_;
+		if (dcdGapLast_ > dcdGapMax_)
+		{
+			dcdGapMax_ = dcdGapLast_;
+		}
+	}
+}
+
+static bool takeReport(const sensorhub_t *sh, const uint8_t *report);
+
+bool init_BNO070(void)
+{
+	int result;
+
+#ifdef BNO_ASYNC_READS
+	// probe and DFU read with lengths of their own; only stream reports in the background
+	bno_set_async_reads(false);
+#endif
+
+	// determine the orientation source: GRV, RV or geomagnetic RV
+	GetValidConfigValueOrWriteDefault(GRVOffset, BNO_USE_GRV, &SELECT_GRV);
+	if (SELECT_GRV >= BNO_SOURCE_COUNT)
+	{
+		SELECT_GRV = BNO_USE_GRV;
+	}
+	SourceFade_Reset();
+	loadSensorRates();
+
+	// Clear BNO070_Report so we don't send garbage out the USB.
 	memset(BNO070_Report, 0, sizeof(BNO070_Report));
 
-	// reset line is an output but we config as input when deasserted.  External pullup sets in high state.
-	// When Reset_Pin must be asserted (low), the pin is reconfigured as an output.
-	// This is so that a JTAG debugger can assert reset on the BNO070 if necessary.
-	ioport_configure_pin(BNO_070_Reset_Pin, IOPORT_DIR_INPUT);
+	// reset line is an output but we config as input when deasserted.  External pullup sets in high state.
+	// When Reset_Pin must be asserted (low), the pin is reconfigured as an output.
+	// This is so that a JTAG debugger can assert reset on the BNO070 if necessary.
+	ioport_configure_pin(BNO_070_Reset_Pin, IOPORT_DIR_INPUT);
+
+	ioport_configure_pin(BNO_BOOTN, IOPORT_DIR_OUTPUT | IOPORT_INIT_HIGH);  // Actually the BootN pin
+	ioport_configure_pin(Int_BNO070, IOPORT_DIR_INPUT | IOPORT_MODE_PULLUP | IOPORT_FALLING);
+
+	if (!TWI_BNO070_PORT_initialized)
+	{
+		twi_master_options_t opt_BNO070;
+
+		opt_BNO070.speed = BNO_TWI_SPEED;
+		opt_BNO070.chip = BNO070_ADDR;
+		result = twi_master_setup(TWI_BNO070_PORT, &opt_BNO070);
+		if (result == STATUS_OK)
+		{
+			TWI_BNO070_PORT_initialized = true;
+			// WriteLn("Init success");
+		}
+		else
+			return false;
+	}
+
+	sensorhub.dfuProgress = dfuProgress;
+	sensorhub.takeReport = takeReport;
+#ifdef PERFORM_BNO_DFU
+	return dfu_BNO070();
+#endif
+
+	// Enable interrupts from BNO070.
+	PORTD.INTCTRL &= ~PORT_INT0LVL0_bm;  // disable interrupt
+	PORTD.INT0MASK = 0x08;               // set interrupt mask for BNO INTN
+	PORTD.INTFLAGS = 0xFF;               // clear all pending interrupt flags.
+	PORTD.INTCTRL |= PORT_INT0LVL0_bm;   // enable interrupt at high priority.
+
+	// sensorhub_probe must be called before any other sensorhub API calls.
+	if (sensorhub_probe(&sensorhub) != SENSORHUB_STATUS_SUCCESS)
+	{
+		return false;
+	}
+
+	// Get Product Id and determine whether 400Hz is supported.
+	BNO070id = readProductId();
+	if ((BNO070id.swVersionMajor * 10 + BNO070id.swVersionMinor) >= 18)  // version>1.8
+		BNO_supports_400Hz = true;
+
+// setup USB output report
+
+// determine report version coming out of BNO
+#ifdef REPORT_GYRO
+	if (BNO_supports_400Hz)
+		defaultReportVersion_ = 3;
+	else
+		defaultReportVersion_ = 1;
+#else
+	defaultReportVersion_ = 1;
+#endif
+	BNOReportVersion = defaultReportVersion_;
+	Update_BNO_Report_Header();  // set up some initial value for BNO_report[0]
+	BNO070_Report[1] = 0;        // this indicates the sequence number
+
+	// restore normal setting
+	bool frsWritten = configureARVRStabilizationFRS();
+	frsWritten |= configureScdFrs();
+
+	// reset + probe again after applying FRS settings; the records are only read at reset
+	if (frsWritten && sensorhub_probe(&sensorhub) != SENSORHUB_STATUS_SUCCESS)
+	{
+		return false;
+	}
+
+	// configure BNO with our default settings and sensor rate
+	hubConfigReset();
+	ReInit_BNO070();
+
+#ifdef BNO_ASYNC_READS
+	bno_set_async_reads(true);
+#endif
+
+	return true;
+}
+
+static void recordTrackerCycles(uint32_t cycles)
+{
+	trackerCycles_ = cycles;
+	if (cycles > trackerCyclesMax_)
+	{
+		trackerCyclesMax_ = cycles;
+	}
+}
+
+/// Bookkeeping after an event has been handled, whether it was decoded or took the fast path.
+static void noteEvent(uint8_t sensor, uint16_t value)
+{
+	if (isOrientation(sensor))
+	{
+		orientationSample();
+	}
+
+	if (config_.dcd_save_period > 0)
+	{
+		/* Check for DCD Save condition */
+		if (untilDcdSave_ > config_.dcd_save_period)
+		{
+			untilDcdSave_ = config_.dcd_save_period;
+		}
+		if (sensor == SENSORHUB_GAME_ROTATION_VECTOR)
+		{
+			if (untilDcdSave_ > 0)
+			{
+				/* count down on GRV samples until we reach zero.  After that we need a DCD save. */
+				untilDcdSave_--;
+			}
+		}
+
+		if (sensor == SENSORHUB_ACTIVITY_CLASSIFICATION)
+		{
+			if (value == STABILITY_ON_TABLE)
+			{
+				if (untilDcdSave_ == 0 && startDcdSave(false))
+				{
+					/* We are on table and it's time to save DCD. Count down to next DCD save */
+					untilDcdSave_ = config_.dcd_save_period;
+				}
+			}
+			else if (value > STABILITY_ON_TABLE && !dcdManual_ &&
+			         (dcdState_ == DCD_SLOWING || dcdState_ == DCD_SAVING))
+			{
+				/* Picked up again: put the rates back now rather than after the save */
+				dcdAborts_++;
+				restoreAfterDcdSave(DCD_SAVE_ABORTED);
+			}
+		}
+	}
+}
+
+/// Handle an event from the ring; @a cycles is what reading and decoding it cost.
+static void processEvent(const sensorhub_Event_t *event, uint32_t timestamp, uint32_t readTime, uint32_t cycles)
+{
+	uint32_t start = svr_clock_cycles();
+	decodeTime_ = svr_clock_us();
+	Latency_Record(LATENCY_READ_TO_DECODE, decodeTime_ - readTime);
+
+	handleEvent(event, timestamp);
+	if (isOrientation(event->sensor))
+	{
+		recordTrackerCycles(cycles + svr_clock_cycles() - start);
+	}
+
+	noteEvent(event->sensor, event->un.field16[0]);
+}
+
+#ifdef BNO_TRACKER_FAST_PATH
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "BNO_TRACKER_FAST_PATH copies the little-endian report fields as they are"
+#endif
+static bool takeTrackerReport(const uint8_t *report);
+#endif
+
+/**
+ * sensorhub takeReport hook. While capturing, every report is queued for the host as read and then decoded as usual,
+ * so resets and DCD saves are still handled.
+ */
+static bool takeReport(const sensorhub_t *sh, const uint8_t *report)
+{
+	if (streamMode_ == STREAM_CAPTURE)
+	{
+		appendCapture(report, bno_report_timestamp());
+		return false;
+	}
+#ifdef BNO_TRACKER_FAST_PATH
+	return takeTrackerReport(report);
+#else
+	return false;
+#endif
+}
+
+#ifdef BNO_TRACKER_FAST_PATH
+/**
+ * While the plain tracker report is streamed, reports from the sensors selectFastPath() picked are handled straight
+ * from the I2C buffer: the orientation source's are written into a HID queue slot and the gyro's into BNO070_Report,
+ * without being decoded into the event ring. Everything else, orientation reports the queue has no room for, and
+ * everything while packed, raw, captured, predicted, printed, paired or switching orientation source, goes through
+ * processEvent.
+ */
+static bool takeTrackerReport(const uint8_t *report)
+{
+	if (streamMode_ != STREAM_TRACKER || printEvents_ || SourceFade_From() != SOURCE_FADE_NONE
+#ifdef BNO_POSE_PREDICTION
+	    || Prediction_GetHorizon() != 0
+#endif
+#ifdef BNO_GYRO_PAIRING
+	    || pairingActive()
+#endif
+	)
+	{
+		return false;
+	}
 
-	ioport_configure_pin(BNO_BOOTN, IOPORT_DIR_OUTPUT | IOPORT_INIT_HIGH);  // Actually the BootN pin
-	ioport_configure_pin(Int_BNO070, IOPORT_DIR_INPUT | IOPORT_MODE_PULLUP | IOPORT_FALLING);
+	uint8_t sensor = report[2];
+#if REPORT_GYRO
+	if (sensor == fastGyro_)
+	{
+		if (report[0] < 12)
+		{
+			return false;
+		}
+		memcpy(lastGyro_, &report[6], 6);
+#ifdef BNO_POSE_PREDICTION
+		Prediction_UpdateGyro(lastGyro_);  // keeps the extrapolation ready for when a horizon is set
+#endif
+		if (BNOReportVersion != 4)
+		{
+			memcpy(&BNO070_Report[10], &report[6], 6);
+		}
+		fastPathReports_++;
+		pollCycles_ = svr_clock_cycles();
+		return true;
+	}
+#endif
 
-	if (!TWI_BNO070_PORT_initialized)
+	// a full queue is left to the decode path, which keeps BNO070_Report current and counts the drop
+	if (sensor != fastOrientation_ || report[0] < 14 || !ReportQueue_HasRoom())
 	{
-		twi_master_options_t opt_BNO070;
+		return false;
+	}
 
-		opt_BNO070.speed = BNO_TWI_SPEED;
-		opt_BNO070.chip = BNO070_ADDR;
-		result = twi_master_setup(TWI_BNO070_PORT, &opt_BNO070);
-		if (result == STATUS_OK)
+	uint32_t timestamp = bno_report_timestamp();
+	decodeTime_ = svr_clock_us();
+	Latency_Record(LATENCY_READ_TO_DECODE, decodeTime_ - bno_report_read_time());
+
+	uint8_t *slot = ReportQueue_Claim();
+	slot[0] = BNO070_Report[0];
+	slot[1] = report[3];              // sequence number
+	memcpy(&slot[2], &report[6], 8);  // quaternion, Q14
+	if (BNOReportVersion == 4)
+	{
+		stampReport(slot, timestamp, delayUs(report[4], report[5]));
+	}
+	else
+	{
+		memcpy(&slot[10], &BNO070_Report[10], 6);  // latest gyro
+	}
+	ReportQueue_Commit();
+#ifdef MeasurePerformance
+	TimingDebug_event2();
+	TimingDebug_RecordEventType(sensor == SENSORHUB_GAME_ROTATION_VECTOR ? 2 : 1);
+#endif
+	Latency_Record(LATENCY_DECODE_TO_QUEUE, svr_clock_us() - decodeTime_);
+
+	uint32_t now = svr_clock_cycles();
+	recordTrackerCycles(now - pollCycles_);
+	pollCycles_ = now;
+	fastPathReports_++;
+
+	noteEvent(sensor, 0);
+	return true;
+}
+#endif
+
+/**
+ * Read every report the hub has pending into the event ring.
+ * Stops when the hub has nothing more to send or the ring is full.
+ */
+static void drainEvents(void)
+{
+	while (eventRingCount_ < BNO_EVENT_RING_DEPTH)
+	{
+		uint8_t tail = eventRingHead_ + eventRingCount_;
+		if (tail >= BNO_EVENT_RING_DEPTH)
 		{
-			TWI_BNO070_PORT_initialized = true;
-			// WriteLn("Init success");
+			tail -= BNO_EVENT_RING_DEPTH;
+		}
+
+		int numEvents = 0;
+		pollCycles_ = svr_clock_cycles();
+		int rc = sensorhub_poll(&sensorhub, &eventRing_[tail], 1, &numEvents);
+		eventCycles_[tail] = svr_clock_cycles() - pollCycles_;
+		eventTime_[tail] = bno_report_timestamp();
+		eventReadTime_[tail] = bno_report_read_time();
+		eventRingCount_ += numEvents;
+
+		if (rc == SENSORHUB_STATUS_HUB_RESET)
+		{
+			/* reset event received */
+			sensorhub.debugPrintf("Hub reset event received\r\n");
+			recoverFromReset(eventTime_[tail]);
+			untilDcdSave_ = config_.dcd_save_period;
+#ifdef BNO_GYRO_PAIRING
+			resetPairing();
+#endif
+			return;
+		}
+		if (numEvents == 0)
+		{
+			/* nothing pending (or an error) - the hub is drained */
+			return;
 		}
-		else
-			return false;
 	}
 
-#ifdef PERFORM_BNO_DFU
-	return dfu_BNO070();
+	if (bno_report_pending())
+	{
+		/* ring is full but the hub still has reports; they wait for the next call */
+		eventRingOverflows_++;
+	}
+}
+
+/**
+ * Switch to a report version requested by the host. The report buffer is only touched from the main loop, so the
+ * request from the USB interrupt is applied here.
+ */
+static void applyPendingReportVersion(void)
+{
+	uint8_t version = pendingReportVersion_;
+	if (version == 0xFF)
+	{
+		return;
+	}
+	pendingReportVersion_ = 0xFF;
+
+	BNOReportVersion = (version == 0) ? defaultReportVersion_ : version;
+	memset(&BNO070_Report[10], 0, 6);  // gyro or timing, depending on version
+#ifdef BNO_GYRO_PAIRING
+	resetPairing();
 #endif
+	if (BNOReportVersion == 1)
+	{
+		BNO070_Report[0] = 0;  // as after init
+	}
+	Update_BNO_Report_Header();
+}
 
-	// Enable interrupts from BNO070.
-	PORTD.INTCTRL &= ~PORT_INT0LVL0_bm;  // disable interrupt
-	PORTD.INT0MASK = 0x08;               // set interrupt mask for BNO INTN
-	PORTD.INTFLAGS = 0xFF;               // clear all pending interrupt flags.
-	PORTD.INTCTRL |= PORT_INT0LVL0_bm;   // enable interrupt at high priority.
+bool SetReportVersion_BNO070(uint8_t version)
+{
+	if (version == 3 && defaultReportVersion_ != 3)
+	{
+		return false;  // no gyro reports from this BNO firmware
+	}
+	if (version != 0 && version != 1 && version != 3 && version != 4)
+	{
+		return false;
+	}
+	pendingReportVersion_ = version;
+	return true;
+}
 
-	// sensorhub_probe must be called before any other sensorhub API calls.
-	if (sensorhub_probe(&sensorhub) != SENSORHUB_STATUS_SUCCESS)
+#ifdef BNO_POSE_PREDICTION
+bool SetPredictionHorizon_BNO070(uint8_t ms)
+{
+	if (ms > PREDICTION_MAX_HORIZON_MS)
 	{
 		return false;
 	}
+	pendingHorizon_ = ms;
+	return true;
+}
 
-	// Get Product Id and determine whether 400Hz is supported.
-	BNO070id = readProductId();
-	if ((BNO070id.swVersionMajor * 10 + BNO070id.swVersionMinor) >= 18)  // version>1.8
-		BNO_supports_400Hz = true;
+uint8_t GetPredictionHorizon_BNO070(void)
+{
+	uint8_t pending = pendingHorizon_;
+	return (pending != 0xFF) ? pending : Prediction_GetHorizon();
+}
 
-// setup USB output report
+static void applyPendingHorizon(void)
+{
+	uint8_t ms = pendingHorizon_;
+	if (ms != 0xFF)
+	{
+		pendingHorizon_ = 0xFF;
+		Prediction_SetHorizon(ms);
+	}
+}
+#endif
 
-// determine report version coming out of BNO
-#ifdef REPORT_GYRO
-	if (BNO_supports_400Hz)
-		BNOReportVersion = 3;
-	else
-		BNOReportVersion = 1;
-#else
-	BNOReportVersion = 1;
+bool SetPackedReports_BNO070(bool enabled)
+{
+	pendingStreamMode_ = enabled ? STREAM_PACKED : STREAM_TRACKER;
+	return true;
+}
+
+bool SetRawImu_BNO070(bool enabled)
+{
+	pendingStreamMode_ = enabled ? STREAM_RAW : STREAM_TRACKER;
+	return true;
+}
+
+bool SetCapture_BNO070(bool enabled)
+{
+	pendingStreamMode_ = enabled ? STREAM_CAPTURE : STREAM_TRACKER;
+	return true;
+}
+
+/**
+ * The IN report length is part of the HID report descriptor, so switching between the 16-byte and a 64-byte
+ * format makes the device re-enumerate: it detaches here and stepReattach() attaches it again REATTACH_DELAY_MS
+ * later. This also drops the virtual COM port briefly. Entering or leaving raw mode reconfigures the hub; leaving it
+ * restores the default sensor configuration.
+ */
+static void applyPendingStreamMode(void)
+{
+	uint8_t mode = pendingStreamMode_;
+	if (mode == 0xFF)
+	{
+		return;
+	}
+	pendingStreamMode_ = 0xFF;
+	if (mode == streamMode_)
+	{
+		return;
+	}
+
+	bool resize = (mode == STREAM_TRACKER) || (streamMode_ == STREAM_TRACKER);
+	if (resize)
+	{
+		udc_detach();
+		detachTime_ = svr_clock_ms();
+		reattachPending_ = true;
+	}
+	bool reconfigure = (mode == STREAM_RAW) != (streamMode_ == STREAM_RAW);
+	streamMode_ = mode;
+	if (reconfigure)
+	{
+		loadConfig(&config_);
+		applyConfig(&config_);
+	}
+	packedCount_ = 0;
+	packedDropped_ = 0;
+	packedBytes_ = 0;
+#ifdef BNO_GYRO_PAIRING
+	resetPairing();
 #endif
-	Update_BNO_Report_Header();  // set up some initial value for BNO_report[0]
-	BNO070_Report[1] = 0;        // this indicates the sequence number
+	if (resize)
+	{
+		ReportQueue_Flush();  // queued reports are 16 bytes; they must not go out as 64
+		udi_hid_generic_set_report_in_size((mode != STREAM_TRACKER) ? UDI_HID_GENERIC_EP_SIZE
+		                                                             : UDI_HID_REPORT_IN_SIZE);
+	}
+}
 
-	// restore normal setting
-	configureARVRStabilizationFRS();
-	configureScdFrs();
+/// Attach again once the host has had time to see the disconnect, without holding up the main loop meanwhile.
+static void stepReattach(void)
+{
+	if (reattachPending_ && (svr_clock_ms() - detachTime_ >= REATTACH_DELAY_MS))
+	{
+		reattachPending_ = false;
+
+		// anything produced while detached is stale, and no transfer can be using a queue slot yet
+		ReportQueue_Flush();
+		packedCount_ = 0;
+		packedDropped_ = 0;
+		packedBytes_ = 0;
+		udc_attach();
+	}
+}
 
-	// reset + probe again after applying FRS settings
-	if (sensorhub_probe(&sensorhub) != SENSORHUB_STATUS_SUCCESS)
+bool SetSensorRate_BNO070(BNO070_Sensor_t sensor, uint16_t hz)
+{
+	if (sensor >= BNO_SENSOR_COUNT || hz >= RATE_DEFAULT * RATE_STEP_HZ)
 	{
 		return false;
 	}
+	sensorRate_[sensor] = hz / RATE_STEP_HZ;
+	pendingSensorConfig_ = true;
+	return true;
+}
 
-	// configure BNO with our default settings and sensor rate
-	ReInit_BNO070();
+uint16_t GetSensorRate_BNO070(BNO070_Sensor_t sensor)
+{
+	const sensorhub_SensorFeature_t *feature;
+	switch (sensor)
+	{
+	case BNO_SENSOR_ORIENTATION:
+		feature = orientationFeature(&config_, SELECT_GRV);
+		break;
+	case BNO_SENSOR_GYRO:
+		feature = &config_.sensors.gyro;
+		break;
+	case BNO_SENSOR_ACC:
+		feature = &config_.sensors.acc;
+		break;
+	case BNO_SENSOR_LIN_ACC:
+		feature = &config_.sensors.lin_acc;
+		break;
+	case BNO_SENSOR_MAG:
+		feature = &config_.sensors.mag;
+		break;
+	default:
+		return 0;
+	}
+	return feature->reportInterval ? (uint16_t)(1000000UL / feature->reportInterval) : 0;
+}
 
+bool SetOrientationSource_BNO070(uint8_t source)
+{
+	if (source >= BNO_SOURCE_COUNT)
+	{
+		return false;
+	}
+	pendingSource_ = source;
 	return true;
 }
 
-bool Check_BNO070(void)
+uint8_t GetOrientationSource_BNO070(void)
 {
-#define MAX_EVENTS_AT_A_TIME 1
-	sensorhub_Event_t shEvents[MAX_EVENTS_AT_A_TIME];
-	int numEvents = 0;
-	static uint32_t untilDcdSave = 0xFFFFFFFF;
-	int i;
-	int rc;
+	uint8_t pending = pendingSource_;
+	return (pending != 0xFF) ? pending : SELECT_GRV;
+}
 
-	/* Get the shEvents - we may get 0 */
-	rc = sensorhub_poll(&sensorhub, shEvents, MAX_EVENTS_AT_A_TIME, &numEvents);
+/// Select @a source and have the main loop rebuild the hub configuration for it.
+static void selectSource(uint8_t source)
+{
+	SELECT_GRV = source;
+	Update_BNO_Report_Header();
+#ifdef BNO_TRACKER_FAST_PATH
+	selectFastPath();
+#endif
+	pendingSensorConfig_ = true;
+}
 
-	if (rc == SENSORHUB_STATUS_HUB_RESET)
+/**
+ * Switch the orientation source as asked from USB or the console, fading from the old one if orientation is being
+ * streamed; a switch during a fade fades from the source that was coming in. Also turns off a source once it has
+ * faded out, and goes back to the old source if the new one never reports.
+ */
+static void applyPendingSource(void)
+{
+	uint8_t fadedOut = SourceFade_TakeFadedOut();
+	if (fadedOut != SOURCE_FADE_NONE)
 	{
-		/* reset event received */
-		sensorhub.debugPrintf("Hub reset event received\r\n");
-		applyConfig(&config_);
-		untilDcdSave = config_.dcd_save_period;
+		orientationFeature(&config_, fadedOut)->reportInterval = 0;
+		orientationFeature(&dcdSaveConfig_, fadedOut)->reportInterval = 0;
+		if (dcdState_ == DCD_IDLE)
+		{
+			applyConfigStep(&config_, CONFIG_ORIENTATION);  // a DCD save restores config_ when it ends
+		}
 	}
 
-	for (i = 0; i < numEvents; i++)
+	uint8_t previous = SourceFade_Expire(svr_clock_ms());
+	if (previous != SOURCE_FADE_NONE)
+	{
+		sourceSwitchFailures_++;
+		sensorhub.debugPrintf("Orientation source %u never reported, back to %u\r\n", SELECT_GRV, previous);
+		selectSource(previous);
+	}
+
+	uint8_t source = pendingSource_;
+	if (source == 0xFF)
+	{
+		return;
+	}
+	pendingSource_ = 0xFF;
+	if (source == SELECT_GRV)
+	{
+		return;
+	}
+
+	bool fade = (streamMode_ != STREAM_RAW) && orientationFeature(&config_, SELECT_GRV)->reportInterval;
+	SourceFade_Begin(fade ? SELECT_GRV : SOURCE_FADE_NONE, svr_clock_ms());
+	selectSource(source);
+}
+
+bool PersistSensorConfig_BNO070(bool save)
+{
+	pendingPersist_ = save ? 1 : 0;
+	return true;
+}
+
+/**
+ * Rebuild the hub configuration after a rate or orientation source change from USB or the console. Calibration flags
+ * set with SetDcdEn_BNO070 are kept.
+ */
+static void applyPendingSensorConfig(void)
+{
+	if (!pendingSensorConfig_)
 	{
-		handleEvent(&shEvents[i]);
+		return;
+	}
+	pendingSensorConfig_ = false;
+
+	int cal_flags = config_.cal_flags;
+	loadConfig(&config_);
+	config_.cal_flags = cal_flags;
+	loadDcdSaveConfig(&dcdSaveConfig_);
+	applyConfig(&config_);
 
-		if (config_.dcd_save_period > 0)
+	packedCount_ = 0;  // the packed sample size follows the accelerometer and linear acceleration
+	packedDropped_ = 0;
+	packedBytes_ = 0;
+#ifdef BNO_GYRO_PAIRING
+	resetPairing();
+#endif
+	if (!config_.sensors.gyro.reportInterval)
+	{
+		if (BNOReportVersion != 4)
 		{
-			/* Check for DCD Save condition */
-			if (untilDcdSave > config_.dcd_save_period)
-			{
-				untilDcdSave = config_.dcd_save_period;
-			}
-			if (shEvents[i].sensor == SENSORHUB_GAME_ROTATION_VECTOR)
-			{
-				if (untilDcdSave > 0)
-				{
-					/* count down on GRV samples until we reach zero.  After that we need a DCD save. */
-					untilDcdSave--;
-				}
-			}
+			memset(&BNO070_Report[10], 0, 6);  // no stale rates in the report
+		}
+		memset(lastGyro_, 0, sizeof(lastGyro_));
+#ifdef BNO_POSE_PREDICTION
+		Prediction_Reset();
+#endif
+	}
+	if (!config_.sensors.mag.reportInterval)
+	{
+		magneticFieldStatus_ = 0xff;
+	}
+}
 
-			if (shEvents[i].sensor == SENSORHUB_ACTIVITY_CLASSIFICATION)
-			{
-				if (shEvents[i].un.field16[0] == STABILITY_ON_TABLE)
-				{
-					if (untilDcdSave == 0)
-					{
-						/* We are on table and it's time to save DCD. */
-						SaveDcd_BNO070();
-
-						/* Count down to next DCD save */
-						untilDcdSave = config_.dcd_save_period;
-					}
-				}
-			}
+/// EEPROM writes take milliseconds, so a request from USB is carried out here rather than in the interrupt.
+static void applyPendingPersist(void)
+{
+	uint8_t save = pendingPersist_;
+	if (save == 0xFF)
+	{
+		return;
+	}
+	pendingPersist_ = 0xFF;
+
+	SetConfigValue(GRVOffset, save ? SELECT_GRV : BNO_USE_GRV);
+	SetConfigValue(OrientationRateOffset, save ? sensorRate_[BNO_SENSOR_ORIENTATION] : RATE_DEFAULT);
+	SetConfigValue(GyroRateOffset, save ? sensorRate_[BNO_SENSOR_GYRO] : RATE_DEFAULT);
+	SetConfigValue(AccRateOffset, save ? sensorRate_[BNO_SENSOR_ACC] : RATE_DEFAULT);
+	SetConfigValue(MagRateOffset, save ? sensorRate_[BNO_SENSOR_MAG] : RATE_DEFAULT);
+	SetConfigValue(LinAccRateOffset, save ? sensorRate_[BNO_SENSOR_LIN_ACC] : RATE_DEFAULT);
+}
+
+/// Settings changed from USB or the console, applied from the main loop whether or not the hub has a report waiting.
+static void applyPendingSettings(void)
+{
+	applyPendingReportVersion();
+	applyPendingStreamMode();
+	applyPendingSource();
+	applyPendingSensorConfig();
+	applyPendingPersist();
+#ifdef BNO_POSE_PREDICTION
+	applyPendingHorizon();
+#endif
+}
+
+bool Check_BNO070(void)
+{
+	applyPendingSettings();
+	drainEvents();
+
+	bool gotEvents = eventRingCount_ > 0;
+	while (eventRingCount_ > 0)
+	{
+		processEvent(&eventRing_[eventRingHead_], eventTime_[eventRingHead_], eventReadTime_[eventRingHead_],
+		             eventCycles_[eventRingHead_]);
+		eventRingHead_++;
+		if (eventRingHead_ >= BNO_EVENT_RING_DEPTH)
+		{
+			eventRingHead_ = 0;
 		}
+		eventRingCount_--;
 	}
 
-	return numEvents > 0;
+	return gotEvents;
 }
 
 bool Tare_BNO070(void)
@@ -641,19 +2299,7 @@ bool SetDcdEn_BNO070(uint8_t flags)
 	return applyConfig(&config_);
 }
 
-bool SaveDcd_BNO070(void)
-{
-	/* change sensor rates to 1Hz while we save DCD */
-	applyConfig(&dcdSaveConfig_);
-
-	/* save DCD */
-	int status = sensorhub_saveDcd(&sensorhub);
-
-	/* restore desired sensor rates now */
-	applyConfig(&config_);
-
-	return (status == SENSORHUB_STATUS_SUCCESS);
-}
+bool SaveDcd_BNO070(void) { return BNO070Active && startDcdSave(true); }
 
 bool ClearDcd_BNO070(void)
 {
@@ -665,6 +2311,7 @@ bool ClearDcd_BNO070(void)
 
 bool MagSetEnable_BNO070(bool enabled)
 {
+	sensorRate_[BNO_SENSOR_MAG] = enabled ? 25 / RATE_STEP_HZ : 0;
 	config_.sensors.mag.reportInterval = enabled ? hz2us(25) : 0;
 	if (!enabled)
 	{
@@ -679,12 +2326,45 @@ void GetStats_BNO070(BNO070_Stats_t *stats)
 	stats->resets = sensorhub_resets;
 	stats->events = sensorhub_events;
 	stats->empty_events = sensorhub_empty_events;
+	stats->ring_overflows = eventRingOverflows_;
+	stats->report_bytes_read = sensorhub.stats->reportBytesRead;
+	stats->report_bytes_saved = sensorhub.stats->reportBytesSaved;
+	stats->dcd_saves = dcdSaves_;
+	stats->dcd_failures = dcdFailures_;
+	stats->dcd_aborts = dcdAborts_;
+	stats->dcd_gap_last_ms = dcdGapLast_;
+	stats->dcd_gap_max_ms = dcdGapMax_;
+	stats->source_switch_failures = sourceSwitchFailures_;
+	stats->config_writes = configWrites_;
+	stats->config_skipped = configSkipped_;
+	stats->tracker_cycles = trackerCycles_;
+	stats->tracker_cycles_max = trackerCyclesMax_;
+	stats->fast_path_reports = fastPathReports_;
+	stats->reset_recovery_last_us = recoveryLast_;
+	stats->reset_recovery_max_us = recoveryMax_;
+	stats->probe_reset_ms = sensorhub.stats->probeResetMs;
+	stats->probe_descriptor_ms = sensorhub.stats->probeDescriptorMs;
+	stats->probe_intn_ms = sensorhub.stats->probeIntnMs;
+	stats->product_id_ms = productIdMs_;
+#ifdef BNO_GYRO_PAIRING
+	stats->gyro_matched = pairCounts_[PAIR_MATCHED];
+	stats->gyro_interpolated = pairCounts_[PAIR_INTERPOLATED];
+	stats->gyro_nearest = pairCounts_[PAIR_NEAREST];
+	stats->gyro_skew_last_us = pairSkew_;
+	stats->gyro_skew_max_us = pairSkewMax_;
+#else
+	stats->gyro_matched = 0;
+	stats->gyro_interpolated = 0;
+	stats->gyro_nearest = 0;
+	stats->gyro_skew_last_us = 0;
+	stats->gyro_skew_max_us = 0;
+#endif
 }
 
 void SetDebugPrintEvents_BNO070(bool enabled) { printEvents_ = enabled; }
 bool ReInit_BNO070(void)
 {
-	loadDefaultConfig(&config_);
+	loadConfig(&config_);
 	loadDcdSaveConfig(&dcdSaveConfig_);
 
 	return applyConfig(&config_);
@@ -709,9 +2389,9 @@ void Update_BNO_Report_Header()
 // update message header to reflect video status
 
 {
-	if (BNOReportVersion == 3)
+	if (BNOReportVersion >= 3)  // version 1 has no header byte
 	{
-		BNO070_Report[0] = BNOReportVersion + (HDMIStatus << 4);
+		BNO070_Report[0] = BNOReportVersion + (HDMIStatus << 4) + sourceHeaderBits();
 	}
 }
 
@@ -725,12 +2405,48 @@ void BNO_Yield()
 {
 #ifdef BNO070
 	{
+		stepReattach();
+
+		// the hub's delay yields too; don't call back into the library from inside it
+#ifdef BNO_HOST_DFU
+		if (BnoDfu_Active())
+		{
+			if (!bno_hub_waiting())
+			{
+				BnoDfu_Task();  // the update owns the hub until it finishes
+			}
+			return;
+		}
+#endif
+		if (bno_hub_waiting())
+		{
+			// only what stays off the bus, e.g. while a configuration write waits for the hub
+			if (BNO070Active && streamMode_ != STREAM_TRACKER)
+			{
+				flushPacked();
+			}
+			return;
+		}
 		if (BNO070Active)
 		{
-			if (bno_data_ready > 0)
+			if (bno_report_pending())
 			{
 				Check_BNO070();
 			}
+			else
+			{
+				// e.g. sensors turned back on after all of them were off
+				applyPendingSettings();
+				if (streamMode_ != STREAM_TRACKER)
+				{
+					flushPacked();  // samples left queued while the endpoint was busy
+				}
+			}
+#ifdef BNO_GYRO_PAIRING
+			checkHeldOrientation();
+#endif
+			stepRecovery();
+			stepDcdSave();
 		}
 	}
 #endif
@@ -0,0 +1,11348 @@
+/* THIS IS A GENERATED FILE - DO NOT EDIT */
+/* Compressed from 1000-3251_1.7.0.390_avr.c by generate-bno-dfu.py: 180426 bytes for a 200412-byte application. */
+
+#include <avr/pgmspace.h>
+
+#include "sensorhub.h"
+
+static const uint8_t dfuStream_1_7_0_390_page0[30000] PROGMEM = {
+    0xff,0xe0,0x59,0x0,0x20,0x61,0x4d,0x3,0x0,0x9f,0xcd,0x3f,0x3,0x0,0xd1,0x3,
+    0x0,0x0,0x32,0xd5,0xaa,0x1f,0x10,0xdd,0xb,0x0,0xe1,0x3,0x0,0xe5,0x3,0x0,
+    0xe9,0xfa,0x3,0x0,0xed,0x3,0x0,0x6d,0xc6,0x2,0x0,0xdd,0xaf,0xbc,0x2,0x0,
+    0xf9,0xb,0x0,0xfd,0x3,0x0,0x1,0xff,0x40,0x3,0x0,0x27,0xdb,0x1,0x0,0x9,
+    0xea,0x7,0x0,0xd,0x3,0x0,0x11,0x3,0x0,0x2b,0x32,0x3,0xab,0x0,0x19,0x7,
+    0x0,0x1d,0x3,0x0,0x21,0x3,0x0,0x25,0xaa,0x3,0x0,0x29,0x3,0x0,0x2d,0x3,
+    0x0,0x31,0x3,0x0,0x35,0x2a,0x3,0x0,0x39,0x3,0x0,0x3d,0x3,0x0,0x41,0x3,
+    0x0,0x9d,0x0,0xff,0x49,0x8,0x70,0x70,0x47,0x60,0x49,0x1,0xff,0x60,0x3,0x21,
+    0x1,0x71,0x4,0x21,0x41,0xff,0x71,0x0,0x21,0xc1,0x80,0xd3,0x21,0x81,0xff,0x60,
+    0x1,0x21,0x1,0x73,0x81,0x74,0xc1,0xff,0x74,0x41,0x73,0x81,0x73,0xc1,0x73,0x1,
+    0xff,0x74,0x1,0x75,0x41,0x75,0x81,0x75,0x41,0xff,0x74,0xc1,0x75,0x0,0x20,0x70,
+    0x47,0x0,0xff,0x0,0x80,0xb5,0x0,0xf0,0xbd,0xf9,0x2,0xff,0xbd,0x70,0xb5,0x6,
+    0x0,0xd,0x0,0x51,0xff,0x4c,0xda,0x48,0x20,0x18,0x1,0x78,0x0,0xf7,0x29,0x11,
+    0xd1,0x39,0x0,0x70,0x20,0x0,0x0,0xdf,0xf0,0xf8,0xf8,0x29,0x0,0x7,0x2,0xf0,
+    0xf9,0xdf,0x5,0x0,0x9,0xd5,0x21,0xb,0x0,0x2,0xf0,0xff,0xb4,0xfd,0x0,0x20,
+    0x30,0x60,0x3,0xe0,0xff,0x14,0x25,0xed,0x43,0x0,0xe0,0x34,0x60,0xff,0x28,0x0,
+    0x70,0xbd,0x80,0xb5,0x1,0x0,0x7f,0x41,0x48,0x2,0xf0,0xa6,0xfd,0x1,0xb,0x0,
+    0x5f,0x0,0xf0,0x58,0xfc,0x2,0x7,0x4,0x9e,0x7,0x8,0xeb,0x2d,0xfd,0x7,0x6,
+    0x76,0x7,0x0,0x0,0x22,0xd2,0xff,0x43,0x91,0x42,0x5,0xd1,0x2,0x21,0xa5,0xdf,
+    0x22,0x12,0x1,0x81,0x50,0x8b,0x2,0x3,0x29,0xff,0xf8,0xd3,0x3,0x20,0xc0,0x43,
+    0x70,0x47,0x5a,0x25,0x2,0xc3,0x2d,0x8,0x35,0xfe,0x7,0x6,0x5c,0x7,0x8,0xfd,
+    0xa1,0x7,0x0,0x10,0xb5,0x82,0xb0,0x4,0x9c,0xff,0x0,0x94,0x0,0xf0,0xac,0xfe,
+    0x16,0xbd,0xbf,0x1c,0xb5,0x5,0x9c,0x1,0x94,0xf,0x6,0xa,0xcb,0xff,0x16,0x1d,
+    0x10,0x97,0xd,0x0,0x33,0x2,0xeb,0xff,0xde,0x3b,0x2,0x1,0xf0,0x4b,0xf8,0x3b,
+    0x0,0xb4,0x83,0xbf,0x68,0xd4,0x7,0x1,0xd5,0xb,0xb7,0x0,0x8b,0xbf,0x43,0x83,
+    0x60,0xc3,0x68,0x92,0xd,0x0,0x19,0xfb,0x43,0x1,0xd,0x0,0x19,0x0,0xc1,0x60,
+    0x10,0xff,0xbc,0x70,0x47,0x30,0xb4,0x2,0x0,0x8,0xff,0x0,0x91,0x0,0x9,0xe,
+    0x0,0x22,0xad,0xff,0x4b,0x1c,0x0,0x25,0x78,0xa9,0x42,0x3,0xff,0xdb,0x52,0x1c,
+    0x64,0x1c,0x6,0x2a,0xf8,0xff,0xd3,0x99,0x18,0xa,0x7a,0xc0,0xb2,0x82,0xff,0x42,
+    0x0,0xd2,0x10,0x0,0x9,0x7c,0x88,0xee,0x7,0x0,0x8,0x0,0x30,0x35,0x0,0x0,
+    0x0,0x90,0xff,0x2b,0x0,0x20,0xe3,0xa2,0x98,0x0,0xc8,0xff,0x1e,0x0,0x20,0x40,
+    0x17,0x3,0x28,0x1,0x7b,0xdb,0x3,0xd7,0x0,0x1,0x28,0x0,0xda,0xdf,0x2,0xff,
+    0x11,0xb5,0x81,0xb0,0x8,0x0,0x14,0x0,0xff,0x1,0x9a,0x1c,0x21,0x2,0xf0,0x21,
+    0xfd,0xaf,0x20,0x60,0x13,0xbd,0x13,0xe,0x1e,0x13,0x0,0x17,0xfe,0x13,0x4,0xe,
+    0xb4,0x30,0xb5,0x9c,0x21,0x9,0xff,0x1,0x42,0x18,0x10,0x68,0x80,0x21,0xc9,0xff,
+    0x5,0x88,0x42,0x3,0xd0,0x3,0xa9,0x3,0xff,0xa8,0x2,0xf0,0x35,0xfd,0x7,0x9d,
+    0x8,0xeb,0x9c,0x5,0x2b,0x0,0x28,0x83,0x1,0x18,0xfe,0x20,0xfb,0x60,0x4,0xb,
+    0x8,0x12,0xfe,0x60,0x60,0x6,0xfe,0xb,0x8,0xc,0xfe,0x41,0x42,0xa1,0x60,0x3,
+    0xfe,0xd,0x8,0x5,0xfe,0x1,0x0,0xa,0xd5,0x48,0xff,0x42,0x1,0x0,0x20,0x68,
+    0x42,0x42,0x22,0xbb,0x60,0x60,0x5,0x0,0x62,0x60,0xa0,0x5,0x0,0xa2,0xff,0x60,
+    0xe1,0x60,0x2,0x98,0x30,0xbc,0x4,0x7f,0xb0,0x0,0x47,0x49,0x1e,0x40,0x1e,0xc9,
+    0x0,0xff,0xd9,0x8,0x0,0x40,0x1c,0x70,0x47,0xf0,0xff,0xb5,0x85,0xb0,0x4,0x0,
+    0x40,0x30,0x0,0xff,0x25,0x5,0x60,0x85,0x63,0x85,0x65,0xc5,0xff,0x65,0x5,0x66,
+    0x45,0x66,0x4,0x95,0x3,0xff,0x95,0x2,0x95,0x80,0x26,0xf6,0x5,0x1,0xff,0x96,
+    0x4,0xa8,0x0,0x90,0x3,0xab,0x2,0xff,0xaa,0x1,0xa9,0x20,0x0,0xac,0x30,0x2,
+    0xff,0xf0,0xd8,0xfd,0x20,0x0,0xbc,0x30,0xc0,0xbf,0x46,0xc0,0x46,0x20,0x0,0xc0,
+    0xf,0x0,0xdc,0xff,0xfd,0xa2,0x20,0x80,0x0,0x20,0x18,0x3,0xef,0xf0,0x2f,0xfc,
+    0xab,0x9,0x8,0x2e,0xfc,0xaf,0xee,0x9,0x8,0x8c,0xfc,0xc0,0x9,0x8,0x87,0xfc,
+    0xd1,0xee,0x9,0x8,0x3d,0xff,0xd9,0x9,0x4,0x5,0x60,0x45,0xef,0x60,0x85,0x60,
+    0xdc,0x15,0x8,0x64,0xff,0x4e,0xff,0x48,0x27,0x18,0x3d,0x60,0x0,0x1d,0x20,0xfd,
+    0x18,0x5d,0x2,0x4c,0x48,0x20,0x18,0x4,0xf0,0xdf,0x24,0xf9,0xfd,0x67,0x4a,0x9,
+    0x0,0x5,0x60,0xdf,0xc5,0x60,0xa1,0x20,0xc0,0x29,0x0,0x4,0xf0,0xa7,0x42,0xf9,
+    0xfb,0x9,0x4,0x3f,0x6,0xfd,0xb,0x4,0x3,0x7f,0xf0,0x44,0xff,0x8d,0x20,0x0,
+    0x1,0x3b,0x6,0xf4,0xbf,0x6,0xbb,0x12,0x9b,0x1b,0x4,0x2,0xf0,0x79,0xfd,0xba,
+    0x1b,0x1e,0x9c,0x1b,0x8,0x6b,0xfd,0x9d,0x9,0x4,0x5,0xef,0xf0,0xf4,0xfd,0x2e,
+    0x73,0x2,0xf0,0xf0,0xfd,0x7d,0x2d,0x7,0x0,0x6,0xf0,0x32,0xfb,0x2c,0x7,0x4,
+    0xeb,0x3a,0xfb,0x3d,0x1e,0x27,0x19,0x0,0x2,0xf0,0x4d,0xbb,0xfd,0x26,0x21,0x4,
+    0x38,0xfb,0x25,0x7,0x0,0x7,0xef,0xf0,0x23,0xf8,0x24,0x7,0x4,0x39,0xf8,0x20,
+    0xff,0x0,0x5,0xb0,0xf0,0xbd,0xc8,0xc,0x0,0xff,0x0,0x70,0xb5,0x4,0x0,0x26,
+    0x0,0x34,0xff,0x36,0x0,0x25,0xf5,0x61,0xb5,0x61,0x75,0xff,0x61,0x35,0x62,0xf5,
+    0x60,0xb5,0x60,0x75,0xff,0x60,0x35,0x61,0x1a,0x48,0x22,0x0,0x30,0xff,0x32,0x1c,
+    0x21,0xff,0xf7,0xe2,0xfe,0x80,0x7f,0x22,0x92,0x4,0x19,0x21,0x19,0x20,0xcf,0x1,
+    0xff,0xfc,0xe0,0x62,0x14,0x48,0x60,0x62,0xa5,0xff,0x61,0xe5,0x61,0x25,0x62,0xa5,
+    0x60,0xe5,0xff,0x60,0x35,0x70,0x25,0x61,0x65,0x61,0x3,0xff,0x20,0x20,0x85,0x0,
+    0x20,0x58,0x21,0x60,0xff,0x54,0x25,0x60,0x65,0x60,0x70,0xbd,0x5c,0xff,0x0,0x0,
+    0x20,0x54,0x4,0x0,0x0,0xac,0xfa,0x3,0x0,0xd4,0x3,0x0,0xc,0xa,0x0,0x0,
+    0x58,0xaa,0x3,0x0,0x74,0x3,0x0,0xb4,0x3,0x0,0xc8,0x3,0x0,0x88,0xfa,0x7f,
+    0x0,0x98,0x3,0x0,0x33,0x33,0x33,0x3,0x10,0xbf,0x27,0x0,0x0,0xf0,0xb5,0x87,
+    0xf7,0x1,0xd,0xff,0x0,0x29,0x68,0x0,0x29,0x9,0xd0,0x68,0xdf,0x68,0x4,0x28,
+    0x6,0xd3,0x3f,0x7,0x7,0xf0,0xff,0x43,0xfa,0x0,0x28,0x2,0xd0,0xc,0x20,0xff,
+    0xc0,0x43,0x46,0xe2,0x28,0x69,0x20,0x61,0xff,0x68,0x69,0x21,0x0,0x10,0x31,0x48,
+    0x60,0xff,0x0,0x26,0x80,0x20,0xc0,0x5,0x9c,0x21,0xff,0x9,0x1,0x60,0x50,0xb2,
+    0x48,0x26,0x50,0xfb,0x0,0x1d,0x3,0x6,0xa8,0x69,0x0,0x28,0x5,0xfb,0xd1,0xe8,
+    0x5,0x0,0x2,0xd1,0x28,0x6a,0x0,0xef,0x28,0x22,0xd0,0xac,0xc9,0x1,0x0,0x21,
+    0x68,0xff,0x6a,0x7,0xf0,0xa8,0xfa,0x78,0x60,0x0,0xff,0x21,0xa8,0x69,0x7,0xf0,
+    0xa3,0xfa,0xb8,0xba,0x9,0x0,0xe8,0x9,0x0,0x9e,0xfa,0xf8,0x9,0x0,0x28,0xde,
+    0x1d,0x0,0x99,0xfa,0x38,0x61,0x99,0x3,0x27,0x18,0xff,0x38,0x0,0x7,0xf0,0x9d,
+    0xfa,0x39,0x0,0xde,0x83,0xa,0x34,0xfa,0x9,0xe0,0x6d,0x2,0x10,0x39,0xf7,0x60,
+    0x50,0x99,0x6b,0x10,0x3,0x20,0x97,0x49,0xff,0x8,0x70,0x2,0x20,0x2,0x90,0x4,
+    0x96,0xff,0x0,0x27,0xa8,0x68,0x0,0x28,0x34,0xd0,0xff,0xe9,0x68,0x4,0x29,0xe,
+    0xd3,0x7,0xf0,0xfd,0xb7,0xb7,0x0,0x7,0xd0,0xc1,0x6b,0x8c,0x4a,0xff,0xa2,0x58,
+    0x91,0x42,0x13,0xd1,0x0,0x1d,0xef,0x4,0x90,0x25,0xe0,0x23,0x2,0x22,0xd0,0xe8,
+    0xfe,0xe1,0x0,0x15,0xd3,0xa8,0x68,0x7,0xf0,0xc0,0xfe,0x25,0x0,0xd,0xd0,0xb8,
+    0x21,0x41,0x58,0x82,0xee,0x27,0x4,0x2,0xd0,0x1,0x4d,0x0,0x12,0xe0,0x1,0xff,
+    0x1d,0x4,0x91,0x7,0x0,0x3c,0x37,0xc,0xfa,0x31,0x4,0x9,0x31,0x4,0x6,0xd3,
+    0xa9,0x68,0x8,0xff,0x78,0x4a,0x78,0x12,0x6,0x12,0xc,0x10,0xdf,0x43,0x0,0xd1,
+    0x2,0x96,0x9f,0x6,0x3,0x90,0xff,0x0,0x20,0x0,0x21,0x0,0x22,0x0,0x23,0xff,
+    0xf,0xc4,0x10,0x3c,0x20,0x0,0xbc,0x30,0xff,0xc0,0x46,0xc0,0x46,0x1,0x23,0x4,
+    0x9a,0xff,0x3,0x99,0x20,0x0,0xc0,0x30,0x2,0xf0,0xff,0xab,0xfe,0xa2,0x20,0x80,
+    0x0,0x20,0x18,0xff,0x1,0x0,0x18,0x31,0xe,0x60,0x4e,0x60,0xbf,0x8e,0x72,0x4e,
+    0x72,0xe,0x72,0xfb,0x2,0xd1,0xde,0x17,0x6,0x21,0x1,0x70,0xdc,0x9,0x4,0x3,
+    0xf0,0xf7,0xe,0xfe,0x20,0xfd,0x0,0x98,0xfa,0x40,0x12,0xff,0xd9,0x21,0x89,0x0,
+    0x60,0x50,0xec,0x31,0xdf,0x66,0x54,0x9a,0x20,0xc0,0x1b,0x0,0x46,0x60,0xfe,0x7,
+    0x6,0x86,0x60,0x0,0x20,0x80,0x31,0x61,0xff,0x18,0x8,0x73,0x9a,0x21,0xc9,0x0,
+    0x61,0xff,0x18,0x48,0x73,0x13,0x22,0xbe,0x49,0x7,0x7f,0xf0,0x90,0xfa,0x7,0xf0,
+    0xc8,0xfa,0x13,0x6,0xff,0x8,0x61,0x0,0x2f,0x8,0xd0,0xba,0x6f,0xff,0x96,0x42,
+    0x1,0xd1,0xf0,0x7,0x3,0xd5,0xff,0xb7,0x49,0x62,0x50,0xb8,0x6f,0x3,0xe0,0xff,
+    0xf0,0x20,0x0,0x4,0xb4,0x49,0x60,0x50,0xff,0x3c,0x31,0x60,0x50,0x6,0x96,0x3,
+    0x98,0xff,0xa8,0x30,0x7,0xf0,0xd7,0xfa,0x80,0x11,0xff,0x6,0x90,0x1,0x96,0xbd,
+    0x48,0x0,0x90,0xff,0x6a,0x46,0x6,0xa9,0x1,0xa8,0x7,0xf0,0xff,0xf0,0xfa,0x80,
+    0x21,0x49,0x3,0x1,0x98,0xbf,0x7,0xf0,0xf,0xfb,0x1,0x90,0x7b,0x1,0x2,0xee,
+    0x1b,0x2,0x1,0xa9,0xda,0xa5,0x4,0x7,0xf0,0x8,0xf9,0xfb,0x1f,0x2,0xd,0x4,
+    0x58,0x7,0xf0,0x2d,0xfb,0xbd,0xda,0xab,0x4,0x0,0x20,0xc0,0x43,0x93,0x8,0x61,
+    0xda,0x7,0x6,0x88,0x7,0x8,0xc8,0x61,0xbb,0x6,0x6,0x62,0xf4,0xc3,0x8,0x7,
+    0x8,0x46,0x7,0x8,0xc6,0x62,0x58,0x20,0x7f,0x28,0x5c,0xb8,0x49,0x60,0x54,0x3a,
+    0xf5,0x5,0xf7,0x21,0x18,0xa1,0x17,0x4,0x3,0xf0,0x83,0xff,0xad,0xfd,0x9,0x8,
+    0x81,0xfd,0x19,0x3,0xfb,0x19,0x1,0xfb,0xae,0x53,0x0,0x60,0x50,0x5,0xbf,0x0,
+    0xb4,0xbf,0x0,0x77,0xae,0xbf,0x0,0x5,0x90,0xaa,0xbd,0x4,0x5,0xbd,0x4,0x91,
+    0xb6,0xbd,0xc,0xb0,0xfa,0xbd,0x12,0xa2,0x48,0xbb,0x2,0xaa,0xfb,0xfa,0xa1,0x7,
+    0x0,0x6,0x70,0x0,0x21,0xc9,0xef,0x43,0x41,0x60,0x8b,0x5d,0x4,0x0,0x2f,0xa,
+    0xff,0xd0,0x3c,0x37,0x3a,0x0,0x8,0xe0,0xc4,0xaf,0x9,0x0,0x0,0xac,0x3,0x0,
+    0xb4,0x3,0x0,0x78,0xfd,0x0,0xd9,0x1,0x22,0x8d,0x21,0x9,0x1,0x61,0xee,0x37,
+    0x0,0xb6,0xfb,0x9d,0xef,0x5,0x5,0xf0,0x10,0xfb,0xfc,0x92,0x41,0x0,0x5,0xf0,
+    0xc,0xfc,0x91,0xfe,0x49,0x2,0xf0,0x5f,0xfe,0x28,0x0,0x34,0x30,0x7b,0x41,0x68,
+    0x5,0x2,0x80,0x68,0x42,0x10,0x7,0x2,0xf7,0xc0,0x68,0x43,0x7,0x4,0x0,0x69,
+    0x40,0x10,0xb7,0x0,0x90,0xaf,0xdd,0x9,0x24,0xfa,0x29,0x4,0x69,0xaa,0x29,0x4,
+    0x69,0x29,0x8,0x69,0x29,0x8,0x6a,0x29,0x2,0xc0,0xee,0x29,0x8,0xf,0xfa,0xa9,
+    0x9,0x0,0x26,0x50,0x21,0xff,0x18,0x8e,0x71,0xe,0x71,0x3,0x98,0xc4,0xef,0x30,
+    0x0,0x68,0x76,0xb9,0x1,0x24,0x21,0x76,0xbe,0xc5,0x4,0x63,0xfc,0x75,0x48,0x99,
+    0x7,0x5,0x9,0x7f,0x1d,0x60,0x50,0x80,0x20,0x0,0x5,0x7,0x2,0xff,0xe8,0x6a,
+    0x42,0x0,0x29,0x8d,0x9,0xb2,0xfd,0xab,0x45,0x8,0x76,0xf9,0x6c,0x48,0x27,0x18,
+    0xff,0x3,0x20,0x38,0x70,0x9,0x20,0x78,0x70,0xff,0x2,0x20,0xb8,0x70,0xe,0x20,
+    0xf8,0x70,0xff,0x1,0x20,0x38,0x71,0x23,0x20,0x78,0x71,0xfe,0xf,0x0,0x60,0x3e,
+    0x73,0x20,0x0,0xa4,0x30,0xff,0x29,0x6b,0x1,0x60,0x34,0x35,0x29,0x78,0x7f,0x1,
+    0x71,0x46,0x71,0x20,0x0,0x28,0x55,0x1,0xdf,0x50,0xf9,0x20,0x0,0x50,0x7,0x0,
+    0x31,0xfc,0x57,0x20,0x0,0x44,0x7,0x0,0x34,0x7,0x0,0x34,0x7,0x0,0xff,0x44,
+    0xf9,0x35,0x22,0x21,0x0,0x28,0x31,0xe7,0x20,0x0,0x60,0xd,0x2,0x15,0x0,0x10,
+    0x30,0xc6,0xfd,0x60,0x5,0x2,0x6,0x61,0xff,0x20,0x21,0x0,0xaf,0x10,0x31,0x8,
+    0x75,0x5f,0x0,0x74,0xcb,0x3,0xa9,0xbe,0x2f,0x5,0x7,0xf0,0x2a,0xf9,0xb6,0xb3,
+    0x4,0x12,0xdb,0xfc,0xb5,0x7,0x4,0xe,0xfc,0x93,0x1,0x5,0xb3,0xff,0x49,0x61,
+    0x18,0x8,0x60,0x4e,0x60,0x8e,0xef,0x60,0xce,0x60,0xb1,0x17,0x0,0x46,0x60,0x86,
+    0xff,0x60,0x86,0x73,0x46,0x73,0x6,0x73,0xc6,0xff,0x73,0xae,0x49,0x1,0x60,0x1,
+    0x23,0x4,0xbb,0x9a,0x8d,0x41,0x0,0x21,0x18,0xab,0x65,0x5,0xd5,0x9f,0xf9,0x7e,
+    0x73,0xbe,0x73,0x15,0x3,0xd,0x0,0x75,0x7f,0x2,0x98,0x7,0xb0,0xf0,0xbd,0x0,
+    0x0,0x0,0xf7,0xf0,0x3f,0xf4,0xab,0x1,0x10,0xb5,0x4,0x0,0x7d,0x2d,0x27,0x0,
+    0xc0,0x46,0xc0,0x46,0x2a,0x7,0x8,0x4,0xaf,0x7,0x9,0x2,0xa1,0xe5,0x5,0x9,
+    0x2,0xef,0x7,0x9,0x2,0xb3,0x0,0xfe,0x3f,0x0,0x29,0x5c,0xf,0x0,0xf8,0xb5,
+    0x5,0xff,0x0,0xc,0x0,0x1f,0x0,0xc0,0x2a,0x2,0xff,0xd2,0xa,0x20,0xc0,0x43,
+    0xf2,0xbd,0xc0,0xff,0x21,0x20,0x0,0x7,0xf0,0xaf,0xfb,0xc0,0xff,0x20,0x20,0x80,
+    0x14,0x20,0x60,0x80,0x21,0xff,0x1d,0x28,0x0,0xc0,0x30,0x2,0xf0,0xb0,0x5f,0xfa,
+    0x21,0x0,0x3c,0x31,0x4d,0x2,0x28,0x5d,0x1,0xbf,0x81,0xff,0x21,0x0,0x78,0x31,
+    0x51,0x2,0x28,0xfe,0xd5,0x0,0xd1,0xfa,0xb0,0x48,0x28,0x58,0xb4,0xff,0x21,0x60,
+    0x50,0x26,0x0,0xb8,0x36,0xae,0xee,0xb,0x0,0x30,0x60,0xbc,0x47,0x4,0xcb,0xfb,
+    0x70,0xff,0x60,0x20,0x88,0x38,0x60,0x0,0x20,0xf2,0xff,0xbd,0x4,0x5,0x0,0x0,
+    0x37,0x89,0x1,0xff,0x0,0xdc,0x7,0x0,0x0,0xc8,0x8,0x0,0xff,0x0,0xc,0xa,
+    0x0,0x0,0x98,0xc,0x0,0xbf,0x0,0x54,0x4,0x0,0x0,0xac,0x3,0x0,0xa9,0xaf,
+    0xf6,0x43,0x32,0x48,0x13,0x0,0xf8,0xcf,0x0,0xd,0xff,0x0,0x16,0x0,0x0,0x27,
+    0xa7,0x61,0x28,0xff,0x68,0x30,0x60,0xa9,0x68,0x68,0x68,0xff,0xff,0xf7,0x27,0xfc,
+    0x70,0x60,0x29,0x69,0xe8,0xfe,0x9,0x0,0x22,0xfc,0xb0,0x60,0xf7,0x60,0x28,0xff,
+    0x68,0x1,0x28,0x3,0xdb,0xa0,0x69,0x1,0xbf,0x21,0x1,0x43,0xa1,0x61,0x68,0xd,
+    0x8,0x4,0xea,0xd,0x4,0xa8,0xd,0x0,0x4,0xd,0x0,0x80,0x21,0x89,0xd5,0x0,
+    0xf,0x2,0xe8,0x1d,0x8,0x2,0x1d,0x4,0x28,0x69,0xfa,0x1d,0xa,0x49,0x1d,0x4,
+    0x29,0x6a,0xe8,0x69,0xff,0xbf,0xf7,0xf7,0xfb,0xf0,0x60,0x69,0x7,0x0,0xf3,0x2a,
+    0x7,0x0,0xa9,0x7,0x0,0xef,0x7,0x0,0x68,0x29,0x0,0x37,0x2,0xa9,0x8,0x55,
+    0x6,0xd,0x8,0x10,0xd,0x4,0xe8,0xd,0x8,0x20,0xea,0x53,0x6,0x6a,0x53,0xa,
+    0xc9,0x53,0x4,0xf1,0x68,0x1,0xcf,0x29,0x3,0xdb,0x70,0xad,0x0,0x1,0x3,0xa9,
+    0x6a,0x17,0x1,0x29,0x7,0xd,0x4,0xc4,0xd,0x0,0x25,0x2,0x23,0x2,0xdd,0x71,
+    0x23,0x0,0x8,0xdb,0x30,0x15,0x0,0xb9,0xfb,0xdf,0x30,0x60,0x71,0x68,0xb0,0x9,
+    0x0,0xb4,0xfb,0xb7,0xb0,0x60,0x69,0x2d,0x0,0xd,0xdb,0xd,0x2,0xad,0x64,0xd,
+    0x4,0x21,0x2,0xa8,0x21,0x0,0x37,0x2,0x9,0x1,0x39,0x2,0xfa,0x4d,0x3,0x38,
+    0x25,0x5,0xa9,0x30,0x1,0x78,0x0,0xff,0x29,0x1,0xd0,0x3,0x21,0x1,0x70,0x20,
+    0xff,0x0,0x29,0x0,0x10,0x22,0x7,0xf0,0xf7,0xef,0xfa,0x21,0x1d,0x88,0xf1,0x0,
+    0x0,0xda,0x8,0xff,0x68,0x7,0xf0,0x2a,0xfb,0x1,0x0,0x20,0xfe,0xc1,0x5,0xfb,
+    0xf9,0xe8,0x68,0x0,0x28,0x4,0xfb,0xd1,0x0,0xe7,0x1,0x7f,0x49,0x61,0x18,0x88,
+    0xeb,0x60,0xa8,0xf,0x0,0x8,0xf,0x4,0x7c,0x49,0x60,0x75,0x50,0xdb,0x3,0x20,
+    0xdb,0x1,0xbb,0xfe,0x28,0x17,0x0,0x55,0x3,0x17,0x4,0x75,0x17,0x0,0x68,0x35,
+    0xc,0x72,0x35,0x0,0x5d,0x48,0xcb,0x1,0x32,0xbd,0x74,0xa7,0x1,0x9c,0x3,0x0,
+    0xd5,0xa8,0x3,0x0,0xb4,0x3,0x0,0x88,0xc7,0x1,0xf4,0x28,0xf7,0x5c,0xcf,0xc8,
+    0xb,0x0,0x38,0xb5,0xb,0x0,0xff,0x14,0x0,0x1a,0x68,0x0,0x21,0x0,0x2a,0xff,
+    0x3,0xd4,0x5,0x7e,0xed,0x7,0x0,0xd4,0xff,0x0,0x22,0x22,0x60,0x2,0x7e,0x52,
+    0x7,0xff,0x1,0xd5,0x5a,0x68,0x0,0xe0,0x0,0x22,0xbf,0x62,0x60,0x82,0x69,0x92,
+    0x5,0xd,0xa,0xa2,0xfe,0x1b,0x0,0x92,0x7,0x4,0xd5,0xda,0x68,0x0,0xaf,0x2a,
+    0x2,0xd1,0x9a,0x13,0x4,0xe2,0x21,0x0,0xd2,0x7d,0x5,0x13,0x16,0x22,0x61,0x2,
+    0x7e,0x12,0x43,0x0,0x58,0x13,0x0,0x43,0x2,0xd,0x0,0xd2,0x6,0xd,0xa,0xa2,
+    0xd,0x0,0x7d,0x92,0xd,0xc,0xe2,0x61,0x82,0x69,0x52,0x5f,0x0,0x3e,0xd,0x6,
+    0x22,0x62,0x82,0x69,0x12,0xd,0x0,0x45,0x6,0xff,0x62,0x62,0x0,0x7e,0x0,0x6,
+    0x4,0xd5,0xf7,0x19,0x68,0x98,0x59,0x1,0xfb,0xfa,0x1,0x0,0xfb,0xa1,0x62,0xd3,
+    0x2,0xf4,0x9,0x0,0x0,0xac,0xfe,0x3,0x0,0xf0,0xb5,0x8d,0xb0,0x4,0x0,0x4,
+    0x7f,0x29,0x1b,0xd0,0x7,0x29,0x65,0xd1,0xc3,0x0,0xff,0xd0,0x2,0x2a,0x13,0xd0,
+    0x10,0xd3,0x5f,0xff,0xe0,0x9d,0x20,0x0,0x1,0x21,0x18,0x6,0xbf,0xa8,0x7,0xf0,
+    0x8b,0xfa,0x9c,0xb,0x0,0x20,0xf7,0x18,0x6,0xa9,0x71,0x3,0x3e,0xfa,0x0,0x20,
+    0xff,0xd,0xb0,0xf0,0xbd,0x9d,0x48,0xef,0xe7,0xff,0x9d,0x48,0xed,0xe7,0x1,0x2a,
+    0x4,0xd1,0xff,0x9a,0x48,0x20,0x18,0x5,0xf0,0x47,0xfe,0x73,0xf1,0xe7,0xbf,0x0,
+    0x41,0x0,0xb,0xd0,0x3f,0x3f,0x4,0xff,0x26,0x58,0x0,0x1d,0x20,0x58,0x1,0x90,
+    0xff,0x94,0x48,0x20,0x58,0x0,0x90,0x93,0x48,0x2f,0x9,0xe0,0x90,0x48,0x13,0xa,
+    0xca,0x53,0x2,0x15,0x0,0xff,0x8f,0x48,0x27,0x58,0x2,0x96,0x1,0x98,0xff,0x3,
+    0x90,0x0,0x98,0x4,0x90,0x5,0x97,0xfe,0x6b,0x2,0x25,0x18,0x2a,0x0,0x2,0xa9,
+    0x2,0xbf,0xa8,0x1,0xf0,0xab,0xff,0xa,0x7,0x0,0x7,0xdb,0xf0,0x5f,0x75,0x0,
+    0xc,0x90,0xb,0x6,0x9,0xfb,0xff,0x1,0x99,0x48,0x42,0x0,0x9a,0x51,0x42,0xff,
+    0x7a,0x42,0x2e,0x60,0xc8,0x4b,0xe0,0x50,0xff,0xc8,0x48,0x21,0x50,0x0,0x1d,0x22,
+    0x50,0xff,0x28,0x0,0x2,0xaa,0x1,0x0,0x1,0xf0,0xdf,0x90,0xff,0xac,0xe7,0x1,
+    0xc3,0x1,0xaa,0xe7,0xfd,0x0,0x0,0x0,0xe4,0x4,0x0,0x0,0xcc,0x8,0xff,0x0,
+    0x0,0x30,0xb5,0x85,0xb0,0x5,0x0,0xff,0xc,0x0,0x68,0x46,0x9b,0x21,0x9,0x1,
+    0xdb,0x69,0x18,0xcd,0x2,0xd7,0xf9,0x6f,0x2,0x2a,0x18,0xff,0x69,0x46,0x68,0x46,
+    0x1,0xf0,0x74,0xff,0xff,0x22,0x0,0xc,0x32,0x1e,0x21,0x0,0x98,0xff,0xff,0xf7,
+    0x21,0xfa,0x22,0x0,0x1e,0x21,0xfd,0x1,0x9,0x0,0x1c,0xfa,0x22,0x1d,0x1e,0x21,
+    0xbd,0x2,0x9,0x0,0x17,0xfa,0x8,0x34,0x15,0x2,0x3,0xfa,0xb,0x0,0x11,0x91,
+    0x0,0x5,0xb0,0x30,0xbd,0x30,0xeb,0xb5,0x89,0x55,0x4,0x9b,0x47,0x0,0x29,0x18,
+    0x68,0xef,0x46,0x7,0xf0,0xf3,0x53,0x4,0x2d,0x18,0x28,0xf7,0x0,0x69,0x46,0x63,
+    0x2,0xa5,0xf9,0x20,0x68,0xdf,0x0,0x28,0x5,0xd1,0x60,0x5,0x0,0x2,0xd1,0xfd,
+    0xa0,0x5,0x0,0x2a,0xd0,0x0,0x20,0x4,0x90,0xff,0x3,0x90,0x2,0x90,0x80,0x20,
+    0xc0,0x5,0xff,0x1,0x90,0x4,0xa8,0x0,0x90,0x3,0xab,0xfe,0xbb,0x0,0xa9,0x5,
+    0xa8,0x2,0xf0,0x21,0xf8,0xff,0x0,0x21,0xe0,0x68,0x6,0xf0,0x4,0xfe,0xdf,0x5,
+    0x90,0x0,0x21,0x20,0x9,0x0,0xff,0xfd,0x75,0x6,0x9,0x0,0x60,0x9,0x0,0xfa,
+    0xfd,0x7,0x9,0x0,0xfd,0xa0,0x9,0x0,0xf5,0xfd,0x8,0x90,0x5,0xa8,0x7f,0x6,
+    0xf0,0xfc,0xfd,0x28,0x0,0x5,0xf5,0x4,0xdf,0x15,0xff,0x0,0x20,0x9,0x91,0x0,
+    0x38,0xb5,0xfe,0x8f,0x2,0x24,0x20,0x28,0x5c,0x40,0x7,0x6,0xff,0xd4,0x60,0x7,
+    0x4,0xd5,0xa1,0x20,0xc0,0xff,0x0,0x28,0x18,0x3,0xf0,0x44,0xfd,0x24,0x77,0x35,
+    0x2c,0x70,0xff,0x3,0xf0,0xb5,0x83,0xf7,0x1,0xff,0x15,0x0,0x1e,0x0,0x20,0x68,
+    0x1,0x28,0x77,0x2,0xda,0xd,0x2d,0x1,0x4d,0xe0,0xa1,0xc7,0x1,0xf7,0xc1,0x61,
+    0x9f,0x5,0x0,0xc0,0x68,0x8,0x1a,0xff,0x9d,0x4a,0xa2,0x18,0xd1,0x60,0x9d,0x49,
+    0xff,0x61,0x5c,0x0,0x29,0x6,0xd1,0x27,0x68,0xff,0x39,0x0,0x4a,0x8,0x80,0x18,
+    0x7,0xf0,0xff,0x4,0xfb,0x78,0x43,0x96,0x49,0x61,0x58,0xff,0x0,0x22,0xd2,0x43,
+    0x91,0x42,0x1,0xd1,0xfe,0x69,0x3,0x92,0x49,0x60,0x50,0x1,0xa8,0x5,0xff,0x80,
+    0x46,0x80,0x8,0x99,0x81,0x80,0x20,0xff,0x0,0x5c,0x30,0x0,0x90,0x23,0x0,0x50,
+    0xef,0x33,0x1,0xaa,0x8d,0xb,0x1,0x21,0x18,0x20,0xff,0x0,0xbc,0x30,0x7,0xf0,
+    0x3e,0xfb,0x0,0xff,0x22,0x23,0x0,0x28,0x33,0xb6,0x4d,0xb6,0xff,0x4e,0x18,0x0,
+    0x28,0x30,0x7,0x68,0xaf,0xff,0x42,0x1,0xdb,0x2e,0x0,0x2,0xe0,0xbe,0xff,0x42,
+    0x0,0xda,0x3e,0x46,0xb0,0x0,0x18,0xff,0x60,0x52,0x1c,0x1b,0x1d,0x3,0x2a,0xee,
+    0xff,0xdb,0x1,0x20,0xe1,0x69,0x1,0x43,0xe1,0xff,0x61,0x21,0x6a,0x8,0x43,0x20,
+    0x62,0x0,0xff,0x20,0x3,0xb0,0xf0,0xbd,0x0,0x0,0xc,0xff,0xa,0x0,0x0,0x98,
+    0xc,0x0,0x0,0xd8,0xaf,0x9,0x0,0x0,0xdc,0x3,0x0,0xa4,0xb,0x0,0xfc,0xee,
+    0x81,0x1,0x4,0x0,0x60,0xc7,0xc,0x83,0xe0,0xa0,0xfa,0xc7,0x4,0x9e,0x5,0x0,
+    0x0,0x69,0xd,0x1a,0x9c,0xfe,0x7,0x0,0x1,0x61,0x6b,0x48,0x20,0x5c,0x0,0xfb,
+    0x28,0x16,0x85,0x1,0x6,0x0,0xc1,0x17,0x9a,0xff,0x22,0x12,0x1,0xa2,0x58,0xd3,
+    0x17,0x7,0xff,0xf0,0x72,0xfc,0x40,0xf,0xca,0x0,0x10,0xff,0x43,0x47,0x10,0xc0,
+    0x7,0x0,0xd5,0x7f,0xff,0x1c,0x70,0x8,0x28,0x18,0x31,0x0,0x7,0xff,0xf0,0x91,
+    0xfa,0x5,0x0,0x7d,0x43,0x0,0xef,0x27,0xff,0x43,0x8c,0x3f,0x0,0x40,0x68,0xb8,
+    0xde,0xe9,0x2,0x25,0xed,0x43,0x89,0xd,0x0,0x45,0x60,0xff,0x78,0xc,0x10,0x9d,
+    0x9,0x99,0x9,0xb2,0xdf,0x81,0x42,0x8,0xd1,0xa,0x7,0x4,0x4,0xd1,0xf7,0x2d,
+    0xb2,0x85,0x23,0x2,0x26,0x0,0xe0,0x0,0x77,0x26,0x31,0x0,0xf6,0x0,0xf0,0xae,
+    0xfd,0xfd,0x2,0xbf,0x20,0x18,0x2,0x90,0x3,0xa8,0x2d,0x2,0x1,0xfd,0x80,0x2b,
+    0x2,0x41,0x80,0x85,0x80,0x0,0x2e,0xff,0x19,0xd1,0x21,0x0,0x28,0x31,0x5,0xa8,
+    0xff,0x7,0xf0,0x4a,0xfc,0x25,0x0,0xbc,0x35,0xff,0x21,0x0,0x5c,0x31,0x1,0x91,
+    0x21,0x0,0xff,0x34,0x31,0x0,0x91,0x3,0x0,0x3,0xaa,0xf7,0x2,0x99,0x28,0x85,
+    0x0,0xf9,0xfa,0x23,0x0,0xef,0x40,0x33,0x11,0x9a,0xd,0x6,0x65,0xfb,0x69,0xff,
+    0x48,0x20,0x58,0xb8,0x42,0x6,0xd0,0xa0,0xbf,0x68,0x0,0x28,0x7,0xd0,0x67,0xd,
+    0x4,0x3,0xfb,0xd1,0x64,0x93,0x0,0x47,0x60,0x6,0xe0,0x4,0x2a,0x33,0x19,0xb,
+    0x33,0x5,0xc4,0x27,0x1,0xc8,0x3,0x0,0xf3,0x7,0xdf,0x16,0x0,0x1f,0x0,0xa0,
+    0x2b,0xd,0x45,0xe0,0xf5,0x24,0x2b,0x5,0x22,0x5,0x0,0x80,0x69,0x8,0x1a,0xdd,
+    0x20,0xf3,0x1,0x91,0x61,0x20,0xf3,0x9,0xa5,0x68,0x7d,0x29,0xf3,0x9,0xa,0xfa,
+    0x68,0x43,0x0,0xfd,0x0,0xd5,0x4a,0xf7,0x1,0xa9,0xf3,0x9,0x47,0xf3,0x5,0x6,
+    0x80,0x75,0x47,0xf3,0x15,0x44,0xf3,0x19,0x5d,0xfb,0x20,0xab,0x0,0xf7,0x6,0xd0,
+    0xa,0xab,0x0,0xa8,0x42,0x2,0xd1,0x7f,0x3a,0x48,0x25,0x50,0x9,0xe0,0x2,0xa9,
+    0x14,0xf6,0x2b,0x3,0x2a,0xfc,0xe3,0xb,0xe4,0x4,0x0,0x0,0xff,0x4,0x5,0x0,
+    0x0,0xf8,0xb5,0x4,0x0,0xfd,0xe0,0xa9,0xc,0xf2,0xbd,0x2a,0x48,0x25,0x18,0xff,
+    0xe9,0x61,0x68,0x69,0xe,0x1a,0x69,0x61,0xfd,0x29,0xcd,0x5,0x1b,0xd1,0xe7,0x68,
+    0x39,0x0,0xf7,0x48,0x8,0x30,0xa1,0x0,0xb9,0xf9,0x6,0x0,0x7f,0x60,0x68,0x87,
+    0x42,0xb,0xd1,0x38,0xdf,0x15,0xfb,0x82,0xfb,0xdf,0x7,0x0,0xe0,0x78,0x0,0x41,
+    0xbe,0xe3,0x5,0x49,0x1c,0x4e,0x43,0x0,0x51,0x0,0xa9,0xff,0x68,0x81,0x42,0xe,
+    0xd1,0x1,0x21,0xc9,0xef,0x43,0xa9,0x60,0x29,0xb,0x0,0x6,0xd0,0x13,0xbe,0xdd,
+    0x0,0x81,0x42,0x2,0xd0,0x69,0xd,0x0,0xc,0xff,0xd1,0xa8,0x60,0x14,0xe0,0xae,
+    0x60,0xe1,0xff,0x68,0xa,0x1,0x51,0x1a,0xb1,0x42,0xed,0xbf,0xd2,0x28,0x60,0x68,
+    0x60,0xa,0xf3,0x0,0xf2,0xfb,0xe7,0x20,0xbd,0x1c,0xcb,0xfb,0x0,0x20,0xf2,0xfe,
+    0xbb,0x0,0x9a,0x99,0x99,0x13,0x66,0x66,0x66,0xed,0xec,0xc3,0x2,0xcc,0x8,0xc7,
+    0x6,0xf0,0xb5,0xc7,0xfe,0x77,0x1,0xd,0x0,0xe0,0x69,0x28,0x60,0x0,0xff,0x20,
+    0x64,0x31,0x48,0x70,0xc0,0x43,0xa8,0xfb,0x60,0xe8,0xb,0x0,0x10,0x70,0xe0,0x69,
+    0xe1,0xff,0x68,0x0,0x29,0x1,0xd0,0x20,0x21,0x0,0xff,0xe0,0x4,0x21,0x8,0x40,
+    0x53,0xd0,0xa9,0xfd,0x20,0xd9,0x2,0x48,0xd1,0x21,0x0,0x28,0x31,0xff,0x5,0xa8,
+    0x7,0xf0,0x46,0xfb,0x5,0xae,0xff,0x32,0x0,0x1c,0x32,0x21,0x0,0x44,0x31,0xff,
+    0xa1,0x20,0xc0,0x0,0x20,0x18,0x3,0xf0,0xff,0x52,0xff,0xd9,0x48,0x27,0x18,0x3a,
+    0x0,0xff,0x31,0x0,0x1c,0x31,0x1c,0x36,0x30,0x0,0xff,0x7,0xf0,0x52,0xfb,0x26,
+    0x0,0xc0,0x36,0xf7,0x39,0x68,0x30,0x8b,0x0,0xcc,0xfe,0xa2,0x20,0xdf,0x80,0x0,
+    0x23,0x18,0x24,0x49,0x0,0x82,0x7,0xff,0xd2,0xf,0x5,0xa9,0x30,0x0,0x2,0xf0,
+    0xff,0xe8,0xf9,0x20,0x0,0x34,0x30,0x3,0x21,0xff,0x95,0x22,0x92,0x0,0x82,0x58,
+    0x3,0x68,0xff,0x9b,0x1a,0x83,0x63,0x0,0x1d,0x49,0x1e,0xf7,0xf6,0xd1,0xc7,0x4b,
+    0x5,0xa,0xd0,0x28,0x0,0xff,0x64,0x30,0x40,0x78,0x1,0x21,0x1,0x43,0xf6,0x9,
+    0x2,0x41,0x70,0xd7,0x2,0x8f,0xfb,0x28,0x68,0xfd,0x80,0x11,0x0,0x29,0x60,0x6,
+    0xe0,0x20,0x0,0xdf,0x6c,0x30,0x6,0xf0,0x37,0xa7,0x1,0xbb,0x49,0xff,0x60,0x54,
+    0x20,0x7f,0x40,0x7,0x0,0xd4,0x3b,0xe0,0xe0,0xaf,0x6,0x0,0xd0,0xa2,0x1f,0x0,
+    0x5f,0x26,0xef,0x20,0x6c,0xa0,0x67,0x3b,0x2,0x7,0xf0,0x5f,0xff,0xfb,0x0,0x21,
+    0x3,0x91,0xc1,0x17,0xac,0x7d,0x4a,0x9b,0x7,0xb4,0xfa,0xc0,0xf,0x4a,0x9b,0x1,
+    0xff,0x3,0x90,0xa8,0x48,0x20,0x18,0x6,0xf0,0xff,0x85,0xfc,0x27,0x0,0x5c,0x37,
+    0xc0,0x11,0xff,0x38,0x64,0x26,0x0,0x9c,0x36,0x32,0x0,0xdd,0x3,0xb9,0x0,0x7,
+    0xf0,0x67,0x5b,0x1,0x2,0x90,0x7e,0x5e,0x0,0x5,0x4,0x90,0x4,0xa9,0xa8,0xdb,
+    0x0,0xfd,0x20,0xef,0x1,0x74,0xfb,0x0,0x28,0x1,0xd0,0xff,0x9b,0x48,0x0,0xe0,
+    0x9b,0x48,0x2,0x90,0xf7,0x32,0x0,0x2,0x2b,0x4,0x51,0xfb,0x38,0x78,0x7f,0x80,
+    0x7,0x6,0xd5,0x97,0x48,0x0,0x13,0x0,0xbb,0x69,0x46,0x13,0x2,0x47,0xfb,0x8e,
+    0x37,0x1,0x26,0xff,0x18,0x23,0x0,0x6c,0x33,0x62,0x68,0xb1,0xfb,0x6f,0xd1,0x41,
+    0x4,0x2,0xf0,0xfe,0xfe,0x21,0xfb,0x0,0x6c,0x63,0x5,0x89,0xfa,0x2b,0x0,0x38,
+    0xbf,0x33,0x19,0x22,0x1,0x0,0x20,0x2f,0x0,0x58,0xaf,0xfb,0x21,0x0,0x34,0x17,
+    0x4,0x7d,0x17,0x0,0x80,0xb6,0x17,0xc,0x4c,0xfb,0x57,0x3,0x21,0x18,0x19,0x2,
+    0x70,0x6a,0x19,0x0,0x8c,0x19,0xc,0x3f,0x25,0x5,0x89,0x0,0x27,0x3,0xff,0x0,
+    0x20,0x69,0x46,0x8,0x71,0x1,0xa8,0xfb,0x0,0x90,0x6f,0x2,0xb2,0x6f,0x61,0x68,
+    0xab,0x7e,0x6f,0x8,0xa8,0xfb,0x68,0x46,0x0,0x79,0x69,0xf,0xad,0x2,0x69,0x15,
+    0xda,0xfa,0x43,0x2,0x2b,0x65,0x9,0x84,0xfe,0x83,0x0,0x6c,0x31,0x68,0x46,0x7,
+    0xf0,0x3b,0x6a,0x9b,0x14,0xa,0x17,0xc,0x2f,0x9b,0x14,0xfe,0xfa,0x9b,0x6,0x8a,
+    0x19,0x2,0x22,0x9b,0x14,0xf1,0x57,0x4,0x9b,0x6,0x3b,0x5,0x58,0x7f,0xfe,0xf7,
+    0xa0,0xfe,0xc2,0xb2,0x81,0x13,0x0,0xff,0x28,0x0,0xfe,0xf7,0x66,0xfe,0x20,0x7f,
+    0xdf,0xc0,0x7,0x3b,0xd5,0x46,0x81,0x1,0x41,0x78,0xff,0x0,0x29,0x2,0xd1,0x0,
+    0x78,0x0,0x28,0xf7,0xe,0xd0,0x24,0xd7,0x1,0xc0,0x7,0xa,0xd5,0xfd,0xa5,0x6f,
+    0x9,0x81,0xfa,0x40,0x1e,0x80,0x41,0xff,0xc0,0xf,0x1,0x26,0x46,0x40,0x0,0xe0,
+    0xef,0x0,0x26,0x5,0xa9,0x19,0x6,0x2,0x0,0x3,0xff,0x23,0x17,0x68,0xbf,0x10,
+    0xf,0x60,0x12,0xff,0x1d,0x9,0x1d,0x5b,0x1e,0xf8,0xd1,0x6,0xff,0xf0,0x25,0xfb,
+    0x20,0x68,0x6,0xf0,0x63,0xff,0xfe,0x2,0xa9,0x1,0x91,0x5,0xa9,0x0,0xff,0x91,
+    0x23,0x0,0x50,0x33,0x32,0x0,0x1,0xf3,0x0,0x8b,0x87,0x1,0xe7,0x3,0x3a,0xfd,
+    0x20,0x0,0xff,0x50,0x30,0x2,0xa9,0x4c,0xc9,0x4c,0xc0,0xff,0xe1,0x69,0xe0,0x68,
+    0x1,0x28,0x2,0xdb,0xff,0x20,0x20,0x1,0x40,0x1,0xe0,0xc9,0x7,0xff,0xc9,0xf,
+    0x0,0x29,0x65,0xd0,0x0,0x20,0xcf,0x5,0x90,0x6,0x90,0xb7,0x7,0x1f,0x2,0x1,
+    0xdb,0x7f,0xf7,0x6f,0x0,0xe0,0x77,0x6f,0x7,0x57,0x1,0xfe,0xe9,0x2,0x23,0x18,
+    0x22,0x0,0x50,0x32,0x39,0xfe,0xe1,0x0,0x0,0xf0,0x25,0xfe,0x26,0x0,0x88,0xff,
+    0x36,0x6,0xa8,0x4,0x90,0x5,0xa8,0x3,0x6f,0x90,0x2,0x96,0xd2,0x97,0x4,0x1,
+    0x90,0x2b,0x2,0xfd,0xdb,0x2b,0x2,0x58,0x22,0x68,0x39,0x0,0x0,0xdd,0x1d,0x83,
+    0x3,0x58,0xfe,0x8a,0x53,0x0,0x21,0x18,0xfd,0x8,0xe3,0x4,0x2,0x28,0x1c,0xd1,
+    0x20,0x0,0xff,0x98,0x30,0x5,0x9a,0xbc,0x4b,0x9a,0x42,0xff,0x3,0xda,0x3,0x22,
+    0xa,0x70,0x5,0x99,0xff,0x0,0xe0,0x59,0x1e,0x1,0x60,0x12,0xe0,0xff,0xb8,0x48,
+    0xe,0xe0,0xc4,0x4,0x0,0x0,0xff,0xa9,0x2,0x0,0x0,0x9c,0x9,0x0,0x0,0xfd,
+    0x6c,0x3,0x0,0x60,0x66,0x66,0x0,0x70,0x3d,0xff,0xa,0x0,0x63,0xd3,0x78,0xa,
+    0x5,0x98,0xdf,0x98,0x21,0x60,0x50,0x31,0x83,0x0,0x60,0x30,0xff,0x7,0xf0,0x68,
+    0xfa,0x21,0x0,0x8c,0x31,0x5d,0x20,0xcf,0x1,0x7,0xf0,0x62,0xb,0x0,0x90,0xb,
+    0x0,0xfd,0x68,0xb,0x0,0x5c,0xfa,0x20,0x7f,0x80,0x7,0xff,0x0,0xd4,0xb0,0xe0,
+    0xa5,0x48,0x27,0x18,0xff,0x79,0x68,0x1,0x29,0xb,0xdb,0x24,0x20,0xff,0x22,0x5c,
+    0x50,0x7,0xc0,0xf,0x6a,0x46,0x7f,0x90,0x77,0x2,0x29,0x6,0xdb,0x39,0x77,0x1,
+    0xff,0x3,0xd0,0x3,0xe0,0x0,0x20,0x69,0x46,0x6b,0x88,0x77,0x5,0x2,0x48,0x5,
+    0x0,0x4,0x90,0xcd,0x0,0xff,0x90,0x80,0x20,0xc0,0x5,0x1,0x90,0x4,0xfe,0xcb,
+    0x0,0x3,0xab,0x2,0xaa,0x1,0xa9,0xc,0xff,0xa8,0x1,0xf0,0x10,0xfc,0x60,0x68,
+    0x0,0xff,0x28,0x1e,0xd1,0x10,0xa8,0x7,0xf0,0x40,0xff,0xfa,0x10,0xa8,0x8d,0x21,
+    0x9,0x1,0x61,0xff,0x18,0xdc,0x22,0x6,0xf0,0x6f,0xfd,0x10,0xff,0xa8,0xb4,0x30,
+    0x6,0xf0,0xe0,0xfa,0x80,0xff,0x11,0x8,0x90,0xbf,0x48,0x21,0x0,0x34,0xff,0x31,
+    0x3,0x22,0x40,0x8,0x8,0x60,0x9,0xff,0x1d,0x52,0x1e,0xfb,0xd1,0x0,0x20,0xc,
+    0xff,0x90,0xd,0x92,0xe,0x90,0xf,0x90,0xa,0xfb,0xe0,0x88,0x27,0x3,0x58,0x8,
+    0x90,0xc,0xa8,0x7f,0xd2,0x21,0x89,0x0,0x61,0x18,0x10,0x3f,0x0,0xbb,0x4f,0xfd,
+    0x6d,0x3,0x2e,0xdb,0x1,0x83,0x0,0x8,0xfd,0x77,0x7f,0x7,0xf0,0x6f,0x1,0x21,
+    0xc9,0x43,0x7f,0x88,0x42,0xd,0xd3,0x70,0x6f,0x0,0x9,0x4,0xef,0x9,0xa9,0x2,
+    0xd0,0xc1,0x3,0x1,0xe0,0x20,0xff,0x0,0x88,0x30,0x4c,0xc8,0x4c,0xc1,0x1b,0xfd,
+    0xe0,0x83,0x3,0x30,0x0,0x7,0xf0,0x6,0xfa,0xf7,0x1,0x22,0xda,0x4f,0x2,0x58,
+    0x89,0x1a,0xd9,0xff,0x22,0x92,0x0,0xa2,0x58,0x8a,0x42,0x6,0xef,0xdb,0x9d,0x49,
+    0x88,0x5f,0x1,0x9,0xa8,0xe,0xff,0xce,0xe,0xc0,0x5,0xe0,0x9,0xa8,0x6,0xf7,
+    0xf0,0xf8,0xfc,0xe7,0x2,0x8,0x77,0xa0,0x68,0xff,0x6,0xf0,0x4e,0xfd,0x96,0x49,
+    0x61,0x18,0xff,0x6,0x91,0x69,0x46,0x9,0x7f,0x5,0x91,0xff,0x9,0xa9,0x4,0x91,
+    0xc,0xa9,0x3,0x91,0xfa,0xbb,0x2,0x2,0x5,0x0,0x44,0x31,0x1,0x91,0x8,0xfb,
+    0x99,0x0,0x1d,0x0,0x4b,0x7f,0x8a,0x7f,0x1,0xfb,0x0,0xa1,0x95,0x0,0x20,0x18,
+    0x3,0xf0,0x57,0xfb,0xf9,0x78,0xab,0x0,0x1,0xdb,0x0,0x20,0x1,0xff,0xe0,0x38,
+    0x7a,0x40,0x1c,0x38,0x72,0xa0,0xfe,0x15,0x1,0x0,0xd1,0xc,0xe1,0xe0,0x69,0xe1,
+    0xfe,0x67,0x1,0x1,0xdb,0x20,0x21,0x0,0xe0,0x2,0xbf,0x21,0x8,0x40,0x0,0xd1,
+    0xfe,0x5b,0x1,0x6,0xff,0x90,0x5,0x90,0x7,0xa9,0x7c,0x4a,0xa2,0xff,0x18,0x13,
+    0x68,0x0,0x2b,0x0,0xd0,0xdb,0xff,0x10,0xb,0x60,0x40,0x1c,0x12,0x1d,0x9,0x9f,
+    0x1d,0x3,0x28,0xf5,0xdb,0xeb,0x6,0xfd,0x2,0x1,0xff,0xdb,0xf7,0x6f,0x2,0xe0,
+    0x89,0x48,0x20,0xef,0x18,0x47,0x68,0x70,0x5,0x0,0x1,0x90,0x10,0xfa,0x7d,0x1,
+    0xa2,0x2d,0x1,0x23,0x18,0x7,0xaa,0x39,0xfe,0xef,0x1,0x0,0xf0,0xc7,0xfd,0x5,
+    0xa8,0x4,0xff,0x90,0x6,0xa8,0x3,0x90,0x7,0xa8,0x2,0xd3,0x90,0xd2,0x49,0x3,
+    0x27,0x8,0xfc,0x47,0x0,0x23,0x58,0xff,0xa2,0x68,0x39,0x0,0x8,0x30,0x20,0x18,
+    0xff,0x2,0xf0,0x1f,0xfd,0x30,0x6e,0x80,0x21,0xff,0x9,0x5,0x88,0x42,0x12,0xd1,
+    0x1b,0x22,0xff,0x74,0xa0,0x3,0xc8,0x6,0xf0,0xae,0xf9,0xff,0x0,0x22,0x74,0x4b,
+    0x7,0xf0,0x90,0xf9,0xff,0x6,0xf0,0xe2,0xf9,0x71,0x6d,0x81,0x42,0xf7,0x4,0xda,
+    0xfd,0xd5,0x4,0x2,0xf0,0x1,0xfd,0xff,0x6e,0x48,0x20,0x58,0x9a,0x21,0xc9,0x0,
+    0xff,0x60,0x50,0x6,0x99,0x5,0x98,0x9,0x18,0xff,0x66,0x48,0x27,0x18,0x38,0x78,
+    0x0,0x28,0xff,0xc,0xd0,0x2,0x28,0xe,0xd1,0x20,0x0,0xff,0xa0,0x30,0x67,0x4a,
+    0x91,0x42,0x2,0xda,0xff,0x3,0x22,0x3a,0x70,0x0,0xe0,0x51,0x1e,0xff,0x1,0x60,
+    0x5,0xe0,0x63,0x48,0xa0,0x21,0xff,0x60,0x50,0x1,0xe0,0xa0,0x20,0x21,0x50,0xbd,
+    0x0,0xf6,0x0,0x7c,0x31,0x7,0xaa,0xe5,0x2,0x13,0xbf,0xd0,0xf0,0x27,0x3f,0x6,
+    0xbb,0x2d,0x0,0x80,0xff,0x23,0x1b,0x6,0xc,0xe0,0x7f,0x42,0xbb,0xff,0x42,0x8,
+    0xdb,0x39,0x4b,0x7,0xe0,0x0,0xff,0xbf,0x9b,0x99,0x19,0x0,0xc1,0xc7,0x69,0x7f,
+    0x0,0x4c,0xa,0x0,0x0,0xdb,0x0,0xb,0xf,0xff,0xe2,0xdb,0x64,0x27,0x0,0x97,
+    0x6a,0x46,0xff,0x31,0x48,0x21,0x18,0xd,0xa8,0x7,0xf0,0xff,0x11,0xfa,0xd,0xa9,
+    0x68,0x46,0x7,0xf0,0xff,0x4c,0xfa,0x2b,0x0,0x28,0x33,0x14,0x22,0xfd,0x1,0x1,
+    0x1,0x7,0xf0,0x50,0xfa,0xb0,0x6d,0xff,0xc1,0x17,0xd5,0x4a,0x0,0x23,0x6,0xf0,
+    0xff,0xd0,0xff,0x48,0x10,0x0,0x90,0x2,0x46,0xff,0x14,0x21,0x14,0x20,0x1,0xf0,
+    0xa3,0xf9,0x7f,0x68,0x63,0x1,0x97,0x1,0xaa,0x97,0xd1,0x0,0xf7,0x21,0x18,0xa,
+    0x41,0x0,0xf0,0xf9,0xd,0xa9,0xed,0x1,0x7,0x0,0x2b,0xfa,0xab,0x1,0xa9,0xa,
+    0xaa,0xbf,0xb,0x68,0x16,0x68,0x9b,0x19,0x71,0xe,0xf6,0xaf,0xdb,0x1,0xa9,0x13,
+    0x1f,0x0,0x1b,0x61,0x0,0x68,0xae,0x61,0xc,0x1f,0xfa,0xa,0x15,0x4,0x10,0x15,
+    0x0,0x74,0xfe,0x15,0xc,0x14,0xfa,0x81,0x26,0x76,0x0,0x28,0xff,0x68,0x30,0x43,
+    0x28,0x60,0x0,0x98,0x80,0xff,0x0,0x26,0x49,0x67,0x18,0x79,0x7a,0xfe,0xff,0xf7,
+    0x14,0xfc,0x78,0x72,0x2,0x0,0x31,0xff,0x0,0x28,0x0,0xfe,0xf7,0xfc,0xfb,0xa,
+    0xfe,0xdf,0x0,0xff,0xff,0xff,0x7f,0x9a,0x99,0x99,0xef,0x13,0xac,0x4,0x0,0x2f,
+    0x0,0x1d,0x49,0x1,0xff,0x40,0x29,0x60,0xa0,0x69,0x0,0x5,0x0,0xff,0xd4,0xb7,
+    0xe0,0x20,0x7f,0x80,0x7,0x5c,0xbf,0xd5,0x19,0x48,0x26,0x18,0xc,0xa5,0x1,0xe,
+    0xff,0xce,0xe,0xc0,0xc,0x3e,0x80,0x27,0xbf,0xff,0x2,0xa0,0x68,0x6,0xf0,0x7,
+    0xfc,0x41,0xfb,0x12,0x38,0x69,0x0,0x9,0xfa,0xda,0x49,0x61,0xff,0x18,0x8c,0xc9,
+    0x8c,0xc6,0xc,0x3e,0x1,0xf7,0x90,0xf,0x48,0xe1,0x1,0x78,0x0,0x29,0x1f,0xff,
+    0xd1,0xa1,0x68,0xa,0x1,0x51,0x1a,0x49,0xff,0x0,0x0,0x4a,0x15,0xe0,0xc8,0x8,
+    0x0,0xf9,0x0,0x63,0x0,0x0,0x0,0xe9,0x3f,0x0,0x0,0xe0,0xfb,0x3f,0xc4,0x6b,
+    0x0,0x5d,0x8f,0x2,0x0,0xd2,0xfb,0x9e,0x3,0x57,0x5,0xfd,0xfe,0xff,0xff,0x9c,
+    0xfa,0x7,0x0,0x74,0x3,0x0,0xa2,0x18,0x52,0x68,0x91,0xff,0x42,0xc,0xd2,0x31,
+    0x0,0x2,0x1d,0x3,0xff,0x23,0xf,0x68,0x17,0x60,0xf,0x68,0x57,0xff,0x60,0x8,
+    0x32,0x9,0x1d,0x5b,0x1e,0xf7,0xff,0xd1,0x0,0x21,0x1,0x70,0x37,0x0,0x0,0xff,
+    0x1d,0x0,0x90,0x3,0x26,0x1,0x98,0x0,0xdb,0x9a,0x39,0x81,0x0,0xea,0xf9,0x9,
+    0x2,0x12,0x1d,0xfe,0xb,0x2,0xe4,0xf9,0x0,0x98,0x8,0x30,0x0,0x7f,0x90,0x3f,
+    0x1d,0x76,0x1e,0xee,0xd1,0xc7,0x2,0xff,0x54,0xd5,0x20,0x7f,0xc0,0x7,0x6c,0xd5,
+    0xdf,0x80,0x26,0xb6,0x2,0x20,0xb7,0x0,0xab,0xfb,0xf7,0x41,0x12,0x30,0x29,0x0,
+    0xad,0xf9,0x2,0x90,0xff,0x26,0x0,0x50,0x36,0xa9,0x20,0x0,0x1,0xf6,0xb3,0x0,
+    0x90,0x3,0xcd,0x1,0x31,0x0,0x1,0x98,0xef,0x7,0xf0,0x16,0xf8,0x4f,0x0,0x1d,
+    0x1,0x90,0xff,0x36,0x1d,0x0,0x98,0x40,0x1e,0x0,0x90,0xbb,0xf3,0xd1,0x23,0x6,
+    0x0,0x90,0xce,0xdd,0x8,0x9,0xbb,0xd1,0x21,0xdd,0x8,0x8e,0x22,0xd2,0xb1,0x2,
+    0x6f,0xf6,0xb1,0x2,0x0,0x99,0xb1,0x2,0xe,0x68,0x16,0x60,0xb7,0xe,0x68,0x56,
+    0xb1,0x14,0x0,0x9e,0xb1,0x2,0x0,0x99,0x9a,0xd3,0x0,0x5f,0x0,0xb5,0xf9,0xad,
+    0x2,0xb,0x6,0xaf,0xce,0xaf,0x8,0x36,0x1d,0x7f,0xaf,0x0,0xa9,0x2,0x17,0xd5,
+    0xff,0x21,0x0,0x50,0x31,0x68,0x46,0x7,0xf0,0x7f,0xc0,0xf9,0x2b,0x0,0x10,0x33,
+    0x18,0xd1,0x9,0xff,0xc4,0xf9,0x8e,0x20,0xc0,0x0,0x20,0x5c,0xff,0x0,0x28,0x1,
+    0xd0,0x3,0x22,0x0,0xe0,0x6f,0x2,0x22,0x1,0x21,0xc5,0x3,0x19,0xfb,0xa5,0x1,
+    0xff,0x6,0x0,0xd4,0xbc,0xe1,0x38,0x26,0xa9,0xfd,0x20,0x1f,0x2,0x0,0xd0,0xc5,
+    0xe0,0x20,0x0,0xff,0x0,0xf0,0xdc,0xfc,0x0,0x20,0x4,0x90,0xff,0x3,0x90,0x2,
+    0x90,0x80,0x27,0xff,0x5,0xef,0x1,0x97,0x4,0xa8,0x35,0x1,0xab,0x2,0xaa,0xff,
+    0x1,0xa9,0x9,0xa8,0x1,0xf0,0x81,0xf9,0xf4,0x1d,0xa,0x19,0x12,0x5,0x19,0x0,
+    0x74,0xf9,0xa0,0x69,0xff,0x6,0x40,0x62,0xd0,0x20,0x0,0x5c,0x30,0xff,0x0,0x6c,
+    0x80,0x0,0x9d,0x21,0x9,0x1,0xff,0x67,0x18,0x8e,0x21,0xc9,0x0,0x66,0x18,0xdf,
+    0x9,0xa9,0x4,0x91,0x5e,0xef,0x1,0x3,0x91,0x7f,0xa0,0x21,0x61,0x58,0x2,0x91,
+    0x98,0x5,0x0,0xff,0x1,0x91,0x0,0x90,0x23,0x0,0x60,0x33,0xff,0xf2,0x6f,0xe1,
+    0x68,0x38,0x0,0x4,0xf0,0xbf,0x30,0xfa,0x55,0x48,0x21,0x18,0x9,0x2,0xea,0x57,
+    0xfe,0x7,0x0,0x6b,0x0,0x90,0x1f,0x2,0x6c,0x1f,0x4,0xff,0xaf,0x20,0x80,0x0,
+    0x20,0x18,0x2,0xf0,0xff,0x5a,0xf8,0x0,0x21,0x7c,0x48,0x87,0x42,0xff,0x6e,0xda,
+    0xb9,0x42,0x0,0xdb,0x0,0x27,0xff,0x28,0x0,0x50,0x30,0x2,0x90,0x1e,0x20,0xff,
+    0x1,0x90,0x9,0xa8,0x83,0xb0,0x69,0x46,0xef,0xc,0xc8,0xc,0xc1,0x3,0x2,0xe,
+    0xbc,0x20,0xfe,0xe3,0x0,0xf8,0xfa,0x2a,0x0,0x60,0x32,0x1c,0xfb,0x21,0x38,0xb,
+    0x0,0xde,0xfa,0x38,0x0,0xf9,0xff,0x17,0x1,0x4a,0x2,0xe0,0x0,0xbf,0x6a,0xff,
+    0x70,0x97,0x72,0x0,0x23,0x6,0xf0,0x23,0xff,0xfe,0x48,0x10,0x80,0x0,0x69,0x49,
+    0x67,0xff,0x18,0xb9,0x7a,0xfe,0xf7,0xa2,0xfa,0xb8,0x6f,0x72,0x2,0x0,0x20,0x1d,
+    0x5,0x8a,0xfa,0xfb,0x0,0xff,0x0,0xa0,0x69,0x38,0x40,0x0,0xd1,0x8a,0xff,0xe0,
+    0xd,0xa8,0x2,0xf0,0x88,0xfc,0xd,0xff,0xa8,0x6,0xf0,0x53,0xfa,0x5c,0x48,0x14,
+    0xff,0x90,0x15,0x90,0xa0,0x20,0x0,0x5,0x21,0xbf,0x0,0x5c,0x31,0x9,0x6c,0x89,
+    0xcb,0x5,0xa6,0xff,0x18,0x5,0xaa,0x4,0x92,0xd,0xaa,0x3,0x7f,0x92,0x2,0x90,
+    0x98,0x20,0x20,0x58,0xbb,0x0,0xf5,0x91,0xdb,0xa,0x52,0xfd,0x1,0x4,0xf0,0xc1,
+    0xf9,0xf4,0x23,0x1,0xd1,0x10,0xc0,0xd1,0x4,0x1,0xf0,0xf1,0xff,0xff,0x28,0x68,
+    0x7,0x43,0x2f,0x60,0x28,0x0,0xfd,0x98,0xc9,0x8,0x5,0xa8,0x41,0xe0,0x7,0x0,
+    0xfb,0x91,0xe7,0x4d,0x3,0x2d,0xd0,0x9d,0x20,0x0,0xf7,0x1,0x27,0x18,0xe7,0xe,
+    0x83,0xb0,0x68,0x46,0xff,0xe,0xcf,0xe,0xc0,0x39,0x68,0x1,0x60,0xbb,0xc,0x3f,
+    0xe7,0x6,0x84,0xfa,0x7,0x39,0x9,0x4d,0xdf,0xfe,0xc1,0x17,0xd5,0x4a,0xdb,0x2,
+    0xb5,0xfd,0xf6,0xdb,0x2,0x32,0x49,0xef,0x2,0xac,0x4,0x0,0x0,0x6a,0xe3,0x6,
+    0x30,0xe3,0x10,0x18,0xe3,0xc,0x19,0xd0,0x83,0x1a,0xf9,0x25,0xb3,0x0,0x4f,0x1f,
+    0x50,0xfa,0x0,0x20,0x2a,0xfb,0x0,0xa8,0x51,0x1,0xfe,0xf7,0x36,0xfa,0xe0,0xff,
+    0x68,0x0,0x28,0x3,0xd1,0x28,0x68,0x20,0xff,0x21,0x88,0x43,0x28,0x60,0x20,0x7f,
+    0x80,0xff,0x6,0x0,0xd4,0x95,0xe0,0x1,0x20,0xda,0xff,0x21,0x89,0x0,0x61,0x58,
+    0x9,0x1a,0x3,0xfb,0x27,0xd9,0xe3,0x2,0x58,0x88,0x42,0x24,0xdb,0xff,0x26,0x0,
+    0x88,0x36,0x30,0x68,0x21,0x6d,0x5f,0x9,0x1a,0x7,0x91,0x8c,0x1f,0x1,0x61,0x9,
+    0x0,0xd7,0x8,0x91,0x90,0x9,0x0,0xa1,0x9,0x0,0x9,0x91,0xff,0x31,0x0,0x68,
+    0x46,0x7,0xf0,0x63,0xf8,0xff,0x2b,0x0,0x1c,0x33,0x18,0x22,0x1,0x0,0x7f,0x20,
+    0x0,0x7,0xf0,0x67,0xf8,0x5b,0xbb,0x0,0xff,0x58,0xa,0x0,0x0,0xa9,0xf6,0x43,
+    0x32,0xf5,0x4c,0x7,0x0,0xc,0x3,0x0,0xca,0x48,0x0,0x21,0xbf,0x0,0x91,0x1,
+    0x91,0x2,0x90,0x19,0x3,0x26,0xff,0x18,0x0,0x98,0xc,0x90,0x1,0x98,0xb,0xff,
+    0x90,0x2,0x98,0xa,0x90,0x1,0x91,0xa,0xff,0xa8,0x0,0x90,0xb,0xab,0xc,0xaa,
+    0x1,0x7f,0xa9,0x11,0xa8,0x7,0xf0,0x70,0xf8,0x57,0x2,0xff,0x6,0xf0,0xd9,0xf9,
+    0xd,0xa8,0x69,0x46,0xff,0x10,0x22,0x6,0xf0,0x8e,0xf9,0x0,0x20,0xff,0x80,0x23,
+    0x5b,0x4,0x0,0x93,0x1,0x90,0xff,0x2,0x90,0x3,0x90,0x11,0xaa,0xd,0xa9,0x7e,
+    0x79,0x2,0x67,0xf8,0x32,0x0,0x69,0x46,0x9,0x2,0xdf,0x4c,0xf9,0x1,0x98,0x4,
+    0x4d,0x0,0x5,0x90,0xbf,0x3,0x98,0x6,0x90,0x4,0x98,0xb3,0x6,0x5,0xed,0x98,
+    0xb1,0x6,0x6,0x98,0xaf,0x6,0x68,0x46,0x4,0xff,0xa9,0x3,0x22,0xb,0x68,0x3,
+    0x60,0x9,0x7f,0x1d,0x0,0x1d,0x52,0x1e,0xf9,0xd1,0xb9,0x6,0xdb,0x69,0x46,0xb9,
+    0x2,0xa,0xf8,0x49,0x0,0xa9,0xa,0xab,0x68,0x2,0x1d,0x4,0x7f,0x1d,0x4,0x44,
+    0x1d,0x8,0x6,0xfb,0xf0,0xfb,0xf1,0x1,0x18,0x21,0x1,0x43,0x29,0xfe,0x33,0x3,
+    0x7,0x15,0xd0,0x0,0x20,0x69,0x46,0xff,0x8,0x70,0x20,0x0,0x0,0xf0,0xf0,0xfd,
+    0xff,0x68,0x46,0x0,0x78,0x0,0x28,0x7,0xd0,0x7f,0x28,0x0,0x64,0x30,0x40,0x78,
+    0x4,0x25,0x0,0xbe,0x9,0x2,0x41,0x70,0x28,0x68,0x80,0x31,0x4,0x28,0xdf,0x78,
+    0x0,0x6,0xa,0xd5,0x13,0x2,0x42,0x78,0xed,0xa2,0x5d,0x1,0x21,0x18,0x37,0x2,
+    0x54,0xfe,0x64,0xff,0x21,0x68,0x54,0xa0,0x69,0x0,0x5,0x0,0xf7,0xd4,0x28,0xe1,
+    0x55,0x2,0x0,0xd4,0x24,0xe1,0xff,0x8e,0x20,0xc0,0x0,0x26,0x18,0xb0,0x6d,0xff,
+    0xc1,0x17,0x50,0x4a,0x0,0x23,0x6,0xf0,0xff,0xac,0xfc,0x48,0x10,0x4,0x90,0x95,
+    0x49,0xff,0x88,0x42,0x17,0xda,0x70,0x6d,0x41,0x0,0xff,0x94,0x48,0x26,0x18,0x30,
+    0x0,0x4,0xf0,0xbf,0xab,0xfd,0x21,0x0,0x50,0x31,0x27,0x3,0xa3,0xbf,0xff,0x90,
+    0x48,0x21,0x18,0x5,0x39,0x1,0xb3,0xff,0xf9,0x8e,0x49,0x63,0x18,0x6a,0x46,0x1,
+    0xff,0x0,0x30,0x0,0x5,0xf0,0x47,0xf8,0x0,0xf9,0x20,0xf,0x1,0x31,0x1,0x80,
+    0x20,0xc0,0x5,0x1,0xbb,0x90,0x5,0x65,0x1,0x3,0xab,0x2,0x65,0x1,0x6,0xbf,
+    0xa8,0x0,0xf0,0x78,0xff,0x84,0x49,0x0,0x31,0xbb,0x0,0xd,0x37,0x0,0x97,0xf9,
+    0xa9,0x95,0x1,0x21,0xff,0x18,0xa,0xa8,0x6,0xf0,0x8d,0xfc,0x4,0xff,0x98,0x80,
+    0x0,0x5,0x90,0xa0,0x68,0x6,0xff,0xf0,0xc,0xf9,0x7c,0x49,0x67,0x18,0x6,0xff,
+    0xa9,0x3,0x91,0xd,0xa9,0x2,0x91,0xa,0xff,0xa9,0x1,0x91,0x76,0x49,0x61,0x58,
+    0x0,0xff,0x91,0x5,0x9b,0x7a,0x68,0x1,0x0,0x76,0x7f,0x48,0x20,0x18,0x5,0xf0,
+    0x6a,0xfa,0xe5,0x2,0xfb,0x9,0x1,0xe7,0x4,0x0,0xac,0x30,0x2,0x90,0xff,0x1e,
+    0x20,0x1,0x90,0x6,0xa8,0x83,0xb0,0xbf,0x69,0x46,0xc,0xc8,0xc,0xc1,0x3,0x2,
+    0xe,0xbf,0xbc,0x20,0x0,0xfe,0xf7,0xc,0xc5,0x1,0x3,0xf3,0x90,0x6a,0xab,0x0,
+    0x73,0x2,0x5d,0xf9,0x31,0x0,0xed,0xa,0x7,0x0,0x59,0xf9,0x6f,0x6,0x80,0x26,
+    0xf6,0x5d,0x2,0x73,0x2,0xd2,0xf8,0x3,0x6b,0x0,0xd,0x6b,0x0,0xfb,0xa,0xa9,
+    0x69,0x2,0x32,0x0,0x1,0x0,0x5c,0xfe,0x69,0x4,0x49,0xfb,0x0,0x21,0x5b,0x48,
+    0x3,0xff,0x9a,0x82,0x42,0x2,0xda,0x10,0x46,0x81,0xff,0x42,0x12,0xda,0x3,0x90,
+    0x2a,0x0,0xbc,0xff,0x32,0x1c,0x21,0xfe,0xf7,0xca,0xf8,0x78,0xff,0x68,0xe1,0x68,
+    0xa,0x1,0x51,0x1a,0x81,0xff,0x42,0x8,0xd2,0x11,0xa8,0x5,0xf0,0x6d,0xff,0xfd,
+    0x6d,0xe0,0x0,0xbf,0x6a,0x70,0x97,0xff,0x72,0x0,0x20,0xea,0xe7,0x0,0x28,0x66,
+    0xbf,0xd0,0x6,0xf0,0xa4,0xf8,0xb4,0x47,0x1,0x61,0xff,0xdb,0x0,0x28,0x1,0xd1,
+    0xb5,0x48,0x4,0xff,0xe0,0x2,0x0,0x0,0x20,0x71,0x8,0x7,0xbf,0xf0,0x22,0xf9,
+    0x4,0x90,0xb3,0x97,0x0,0x14,0xfe,0xff,0x0,0x9e,0xf8,0xd,0xa8,0x14,0xa9,0x10,
+    0xff,0x22,0x6,0xf0,0x53,0xf8,0x6,0xaa,0xd,0xbb,0xa9,0xd,0x2b,0x1,0xf2,0xfd,
+    0xa,0x7,0x0,0x7,0xfb,0xf0,0x1e,0xc1,0x0,0x2,0x90,0x11,0xa8,0x1,0xfb,0x90,
+    0xa,0x4b,0x1,0x0,0x98,0x0,0x68,0xc1,0xff,0x17,0x4,0x9a,0xd3,0x17,0x6,0xf0,
+    0xd9,0xff,0xfb,0x6,0x0,0xf,0x0,0xb2,0xd,0xb8,0xff,0x2,0x2,0x43,0xbb,0x15,
+    0x9c,0xa0,0x3,0xff,0xc8,0x8b,0x42,0x4,0xdc,0x1,0xdb,0x82,0x7f,0x42,0x1,0xd2,
+    0x6,0x46,0x1a,0xe0,0x19,0x6,0xff,0x80,0x20,0x0,0x6,0x0,0x21,0x8b,0x42,0xfd,
+    0xb,0x19,0x4,0x8,0xd2,0xc0,0x43,0x8b,0x42,0xff,0x9,0xdb,0x1,0xdc,0x82,0x42,
+    0x6,0xd3,0xff,0x40,0xa,0x30,0x40,0x3,0xd0,0x8f,0x4e,0x7f,0x4,0xe0,0x33,0x33,
+    0x33,0xf6,0xb6,0x2f,0x0,0xff,0x6,0x43,0x1,0x98,0x6,0x60,0x2,0x98,0xf7,0x40,
+    0x1c,0x2,0x6b,0x2,0x1d,0x0,0x90,0x1,0xfe,0x5,0x0,0x1,0x90,0x2,0x98,0x3,
+    0x28,0xc0,0xff,0xdb,0x86,0x48,0x20,0x5c,0x0,0x28,0x2,0xfd,0xd0,0xeb,0x2,0xf7,
+    0xfc,0xe0,0x69,0x4,0x21,0x5f,0x1,0x43,0xe1,0x61,0x81,0x29,0x1,0x6,0xbd,0x0,
+    0xff,0x5,0xf0,0xf4,0xff,0x0,0x20,0xe0,0x61,0xff,0x20,0x62,0x20,0x0,0x0,0xf0,
+    0x6,0xfc,0xff,0xa0,0x20,0xc0,0x0,0x20,0x58,0x68,0x60,0xff,0x28,0x68,0xa1,0x69,
+    0x1,0x40,0x29,0x60,0x7f,0x0,0x20,0x47,0xb0,0xf0,0xbd,0x0,0x5b,0x1,0xff,0x40,
+    0x1,0xc8,0xa,0x0,0x0,0xac,0x4,0x7f,0x0,0x0,0x88,0xc,0x0,0x0,0x9c,0xb,
+    0x0,0x5f,0xc8,0x8,0x0,0x0,0x98,0xb,0x0,0xa8,0xb,0x0,0xff,0xa9,0xf6,0x43,
+    0x32,0xf4,0xb5,0x86,0xb0,0xfd,0x4,0xdd,0x0,0xd9,0x20,0x80,0x0,0x25,0x18,0xff,
+    0x28,0x68,0x5,0x90,0x20,0x0,0x5,0xf0,0xff,0xc4,0xfc,0x40,0x10,0x1,0x90,0x0,
+    0x26,0xff,0x20,0x68,0x1,0x1,0x8,0x1a,0xb8,0x42,0xff,0x6,0xd2,0x1,0x99,0x48,
+    0x42,0x40,0x12,0xff,0x28,0x60,0x8a,0x21,0xc9,0x0,0x66,0x54,0xbf,0x6,0x98,0x6,
+    0xf0,0x8a,0xfc,0xb,0x2,0x61,0xff,0x18,0x49,0x68,0x88,0x42,0x5,0xdb,0xbe,0xdf,
+    0x48,0x28,0x60,0x1,0x20,0x11,0x2,0x60,0x54,0xff,0x0,0x96,0x80,0x27,0xbf,0x3,
+    0x3,0x97,0xff,0xba,0x48,0x3,0xa9,0x7,0xf0,0xe6,0xf8,0xff,0x4,0x90,0x4,0xa9,
+    0x20,0x0,0x9c,0x30,0xef,0x7,0xf0,0xf2,0xf8,0x9d,0x3,0x0,0x97,0x7,0xff,0xe0,
+    0xb3,0x48,0x2,0x90,0x22,0x0,0x9c,0xff,0x32,0x2,0xa9,0x68,0x46,0x7,0xf0,0xf8,
+    0xff,0xf8,0x79,0x8,0x0,0x98,0x5,0xf0,0x44,0xef,0xfd,0x0,0x90,0x8a,0xcd,0x2,
+    0x5c,0xc,0x9f,0xff,0x3,0x28,0x25,0xd0,0x2,0x28,0x23,0xd0,0xf7,0xaa,0x21,0x89,
+    0x65,0x0,0x89,0x78,0x0,0x29,0xf7,0x3d,0xd0,0x2,0x61,0x8,0x1,0x20,0xe8,0x39,
+    0xff,0x61,0x58,0x9,0x1a,0x29,0x60,0xae,0x60,0xff,0x88,0x20,0x40,0x0,0x20,0x18,
+    0xc1,0x68,0xff,0x89,0x10,0x39,0x60,0x1,0x69,0x89,0x10,0xff,0x79,0x60,0x40,0x69,
+    0x80,0x10,0xb8,0x60,0xdf,0x3a,0x0,0x39,0x0,0x8b,0x4b,0x2,0x18,0x5,0xdf,0xf0,
+    0xf0,0xfe,0x57,0xe0,0x47,0x4,0x5c,0x0,0xef,0x29,0x1a,0xd0,0x4,0xa7,0xa,0x98,
+    0x28,0x60,0xbb,0xa9,0x20,0x69,0x3,0x3,0xd0,0xda,0xff,0x0,0x20,0xfb,0x58,0x28,
+    0x43,0x1,0x5,0x99,0x88,0x42,0x3d,0xff,0xd0,0x86,0x42,0x30,0xdb,0xae,0x60,0xdc,
+    0xfe,0x15,0x2,0x18,0x1,0xf0,0xaf,0xff,0x34,0xe0,0xf7,0x0,0x28,0x6,0x8f,0x0,
+    0x21,0xd0,0x3,0xd3,0xff,0x4,0x28,0xe1,0xd0,0x1d,0xd3,0xe1,0xe7,0xff,0x28,0x68,
+    0x86,0x42,0x8,0xda,0xc1,0x17,0xff,0x81,0x4a,0x0,0x23,0x6,0xf0,0xc6,0xfa,0xbf,
+    0x80,0xf,0x8a,0x0,0x10,0x43,0x43,0x2,0x1,0xff,0x99,0x49,0x12,0x40,0x18,0x28,
+    0x60,0x0,0xdf,0x99,0x5,0xf0,0xa,0xfd,0x7,0x2,0x88,0x42,0xdb,0xc9,0xd1,0x77,
+    0xa,0xc4,0xe7,0x6d,0x6,0xbf,0xe7,0xfb,0x45,0x10,0x6d,0x3,0xd,0xfc,0x41,0x12,
+    0x28,0xbf,0x0,0x6,0xf0,0x49,0xfd,0xdb,0xa3,0x0,0x60,0xff,0x50,0x6,0x98,0xe,
+    0xc8,0xe,0xc7,0x7,0xf6,0xc3,0x5,0x28,0x31,0xb0,0x1,0x0,0x0,0x80,0xff,0x96,
+    0x0,0x6,0x7f,0x96,0xbb,0x1,0xb4,0xbb,0x1,0xb7,0xb,0xd,0x2f,0x9e,0x5,0xf0,
+    0xdd,0xad,0x5,0xfb,0xeb,0x0,0xc1,0x3,0xf7,0x3,0x90,0xa0,0xb5,0x1d,0x0,0x20,
+    0x59,0x49,0xff,0x60,0x54,0xf0,0x69,0x59,0x49,0x88,0x42,0xfb,0x8,0xdb,0x73,0x2,
+    0xc3,0xfc,0x41,0x42,0x48,0xee,0x19,0x0,0x1,0x20,0x53,0x19,0x0,0x0,0x20,0x0,
+    0xff,0x90,0x80,0x27,0x7f,0x3,0x4,0x97,0x51,0xef,0x4e,0x30,0x0,0x4,0xb5,0x1,
+    0xb,0xf8,0x5,0xeb,0x90,0x5,0xb5,0x9,0x17,0xb5,0x9,0x6,0xe0,0x2,0xbd,0x96,
+    0xb3,0xf,0x1e,0xf8,0x44,0x48,0xa7,0x1,0x9e,0xd7,0x3,0x28,0x24,0x17,0x1,0x22,
+    0xa7,0x11,0x3b,0xd0,0xfd,0x99,0xe7,0x0,0x61,0x58,0x3d,0x4a,0x91,0x42,0xdf,0x35,
+    0xda,0x2,0x20,0x3a,0x61,0x0,0x1,0x20,0x5d,0xec,0xb1,0x9,0x0,0x20,0xa8,0xb3,
+    0x9,0x81,0xad,0x1,0xf7,0x31,0x60,0xc1,0x5,0x0,0x71,0x60,0x0,0x6a,0x5f,0x80,
+    0x10,0xb0,0x60,0x56,0xa5,0xd,0x19,0xa5,0x1,0x79,0x2c,0x99,0x2,0xa3,0xd,0x2,
+    0xd0,0x2b,0x48,0xa1,0x7,0x7d,0x3,0x4d,0x1,0x3e,0xd0,0x0,0x21,0x81,0xa3,0x1,
+    0xf7,0xa9,0x60,0xfd,0xe3,0x5,0x1,0xf0,0xdd,0xfe,0xea,0xa3,0xb,0x22,0xa3,0x9,
+    0x1e,0xa3,0x1,0x0,0x20,0x29,0xff,0x68,0x88,0x42,0x9,0xda,0x8,0x46,0xc1,0xdb,
+    0x17,0x17,0xa7,0x5,0xf2,0xf9,0xa7,0x27,0x36,0xfc,0xea,0xa7,0x7,0xc7,0xa7,0x1,
+    0xe,0x79,0x0,0xc3,0xe7,0xf,0x74,0x6f,0x0,0xa3,0xb,0x2b,0xa3,0x9,0x77,0xfc,
+    0xfc,0xc3,0x3,0xfa,0xa3,0x7,0xc6,0xa3,0x7,0xf6,0x28,0xfc,0xff,0xc3,0xff,0xf5,
+    0x28,0x1c,0xa,0xd7,0xa3,0x40,0xc8,0xfe,0xae,0x1,0x30,0x6f,0xf6,0xd,0xe1,0x7a,
+    0x14,0xff,0xe,0xdc,0x7,0x0,0x0,0xf1,0xb5,0x8a,0xff,0xb0,0x41,0x6f,0x0,0x6f,
+    0x6,0xf0,0xaa,0xff,0xff,0x1,0x0,0xa,0x98,0xc0,0x6e,0x6,0x4f,0xf0,0xa5,0xff,
+    0x4,0x9,0x0,0x15,0x6,0xa3,0x15,0xc,0xff,0x9e,0xff,0xa,0x99,0x99,0x22,0x12,
+    0x1,0xff,0x89,0x58,0xab,0x4a,0x89,0x18,0xa,0x9a,0xff,0x8e,0x23,0xdb,0x0,0xd2,
+    0x18,0x2,0x92,0xff,0x62,0x10,0x8a,0x42,0x7,0xda,0x4a,0x42,0xfd,0x41,0x7,0x0,
+    0x19,0xdb,0x91,0x42,0x1,0xdb,0xff,0xc0,0x7,0x15,0xd4,0xa,0x98,0x40,0x68,0xff,
+    0x5,0xf0,0x2a,0xfe,0x4,0x0,0x1,0xd1,0xff,0xa0,0x48,0xb,0xe0,0xc0,0x17,0x1,
+    0x0,0xff,0x61,0x40,0xa,0x1a,0x0,0x20,0xc0,0x21,0xff,0xc9,0x2,0x6,0xf0,0xb1,
+    0xfe,0xe1,0x17,0xff,0x48,0x40,0x40,0x1a,0x0,0x15,0x4,0xe0,0xff,0x2,0x98,0x80,
+    0x6e,0x1,0x28,0x2,0xdb,0xff,0x40,0x1e,0x2,0x99,0x88,0x66,0x2,0x98,0xff,0x0,
+    0x78,0x69,0x46,0x8,0x71,0xa,0x98,0xfd,0x8a,0xc9,0x0,0x40,0x18,0x8,0x90,0x1,
+    0x78,0xff,0x1,0x20,0x0,0x29,0x1,0xd0,0x1,0x29,0xff,0x1,0xd1,0x1,0x21,0x0,
+    0xe0,0x0,0x21,0xff,0xa,0x9a,0x8c,0x4b,0xd2,0x18,0x4,0x92,0xaf,0x52,0x78,0x0,
+    0x2a,0x17,0x0,0x2a,0x17,0x0,0x22,0xfe,0x17,0x0,0x22,0x4,0x9b,0x1b,0x78,0x6c,
+    0x46,0xff,0x24,0x79,0x1,0x25,0x65,0x40,0x1d,0x43,0xff,0x7,0xd0,0x2,0x9b,0x9b,
+    0x6e,0x1,0x2b,0xff,0x3,0xd0,0x1,0x24,0x4c,0x40,0x14,0x40,0xff,0x0,0xe0,0x1,
+    0x24,0x6a,0x46,0x12,0x79,0xff,0x0,0x2a,0xf,0xd0,0x2,0x9a,0x92,0x6e,0xff,0x1,
+    0x2a,0xb,0xda,0x0,0x29,0x9,0xd1,0xfd,0xe0,0x40,0x1,0x0,0x90,0x69,0x46,0xa,
+    0x98,0xff,0xa8,0x22,0x92,0x0,0x80,0x18,0x6,0xf0,0xff,0xe,0xfa,0x0,0x2c,0x4,
+    0xd1,0xa,0x99,0xff,0xb5,0x4a,0x89,0x5c,0x1,0x42,0xc,0xd0,0xff,0x0,0x20,0x2,
+    0x99,0x48,0x66,0xa,0x98,0xfd,0xd2,0xfd,0x1,0x42,0x18,0x1,0x46,0x88,0x31,0xff,
+    0xdc,0x23,0x9b,0x0,0xc0,0x18,0xf9,0xe0,0xff,0x1,0x23,0x43,0x40,0x19,0x42,0x0,
+    0xd1,0xdf,0xf7,0xe0,0xa,0x98,0xdc,0x1d,0x0,0x40,0x18,0x7f,0x7,0x90,0xa,0x98,
+    0x88,0x30,0x6,0x5,0x0,0xff,0x28,0x39,0x40,0x18,0x5,0x90,0x2,0x46,0x7f,0x6,
+    0x99,0x7,0x98,0x1,0xf0,0x1a,0x3f,0x1,0xfd,0xbb,0x39,0x1,0x3,0x91,0xa0,0x49,
+    0x88,0x42,0xff,0x0,0xda,0xbd,0xe0,0x2,0x99,0x49,0x6e,0xdf,0x80,0x22,0x52,0x2,
+    0x91,0xd,0x0,0xb6,0xe0,0xff,0xa,0x99,0xb7,0x4a,0x8e,0x18,0xc1,0x17,0xff,0x9,
+    0x4,0x2,0xc,0x11,0x43,0x0,0x4,0xfb,0x32,0x68,0xdb,0x0,0xd1,0x51,0x48,0x10,
+    0xe0,0xff,0xcc,0x17,0xcd,0x17,0xd3,0x17,0x5a,0x40,0xff,0xd2,0x1a,0x60,0x40,0x69,
+    0x40,0x2b,0x0,0xff,0x0,0x1b,0x99,0x41,0x6,0xf0,0x10,0xfe,0xbf,0x31,0x68,0xc9,
+    0x17,0x61,0x40,0x45,0x3,0xa6,0xfb,0x4a,0x90,0x43,0x0,0x94,0xe0,0xc1,0x17,0xc9,
+    0x7f,0x5,0x43,0xa,0x19,0x43,0xc0,0x5,0x33,0x2,0xea,0x2d,0x2,0x2f,0x2d,0x0,
+    0xb9,0x2d,0x0,0xf9,0xfd,0x60,0xff,0x40,0x0,0x1b,0x2,0x0,0xc3,0x17,0x19,0xff,
+    0x0,0x6,0xf0,0xc0,0xf8,0xc2,0xd,0x4c,0xff,0x2,0x22,0x43,0xcb,0x15,0x98,0xa4,
+    0x30,0xff,0xcc,0xab,0x42,0x4,0xdc,0x1,0xdb,0xa2,0xff,0x42,0x1,0xd2,0x22,0x46,
+    0xf,0xe0,0x0,0xef,0x27,0xbb,0x42,0xb,0xf,0x4,0x8,0xd2,0xe6,0xff,0x43,0xbb,
+    0x42,0x6,0xdb,0x1,0xdc,0xb2,0xff,0x42,0x3,0xd3,0x6c,0xa,0x4,0x40,0x0,0xff,
+    0xd0,0x6a,0x8,0xd3,0x17,0x9b,0x7,0x90,0xff,0x8,0x3,0x43,0x92,0x7,0x50,0xf,
+    0xdc,0xff,0x0,0x20,0x43,0x59,0x17,0x80,0x24,0x24,0xbf,0x6,0x0,0x25,0xed,0x43,
+    0xa9,0x47,0x4,0xa0,0xee,0x47,0x0,0x20,0x46,0xa,0x47,0x0,0xb9,0x42,0x2,0x7b,
+    0xdc,0x3,0xf,0x2,0xd3,0xe0,0x43,0x2,0xb5,0x1,0xff,0x0,0x28,0x0,0xd0,0x1,
+    0x0,0x20,0xa,0xff,0x8,0x18,0x2,0xd5,0x0,0x29,0x0,0xd4,0xff,0xe0,0x43,0xc1,
+    0x17,0xf0,0x22,0x12,0x4,0x1f,0x0,0x23,0x6,0xf0,0x77,0x91,0xc,0x4d,0xa,0x95,
+    0x56,0xff,0x3,0x98,0x0,0x68,0x7e,0x49,0x8a,0x42,0xf7,0xe,0xda,0x90,0x3,0x0,
+    0x3,0x98,0x2,0x60,0xff,0xa,0x98,0xa3,0x21,0x9,0x1,0x42,0x50,0xff,0x21,0xe0,
+    0xcd,0xcc,0xcc,0xfd,0xff,0xff,0xff,0xff,0x7f,0xdc,0x4,0x0,0x0,0xa,0x0,0xff,
+    0xf0,0xe7,0x2,0x0,0xee,0xe7,0x2,0x98,0xff,0x40,0x6e,0x81,0x1,0x73,0x48,0x6,
+    0xf0,0xff,0xde,0xfa,0x3,0x99,0x9,0x68,0x0,0x91,0xff,0xf0,0x21,0x9,0x4,0x9,
+    0x91,0x6a,0x46,0xff,0x9,0xa9,0x6,0xf0,0x2c,0xfe,0x0,0x98,0xff,0x3,0x99,0x8,
+    0x60,0x0,0x98,0xa,0x99,0xff,0xa3,0x22,0x12,0x1,0x88,0x50,0x0,0x20,0xbf,0x2,
+    0x99,0x48,0x66,0x5,0x9a,0xcb,0x7,0x78,0xff,0xfe,0x66,0xe0,0x0,0x28,0x64,0xd1,
+    0xa,0xff,0x98,0x40,0x68,0x5,0xf0,0xb7,0xfc,0x5,0xff,0x90,0x0,0x20,0x3,0x90,
+    0x0,0x26,0x0,0xff,0x27,0xa,0x9c,0x6c,0x34,0x3,0x25,0x20,0xff,0x68,0x40,0x10,
+    0xc1,0x17,0x2,0x0,0xb,0xfe,0x6b,0x1,0xa,0xf8,0x80,0x19,0x79,0x41,0x6,0xff,
+    0x0,0xf,0x0,0x24,0x1d,0x6d,0x1e,0xf1,0xff,0xd1,0x2,0x20,0x0,0x90,0x32,0x0,
+    0x3b,0xff,0x0,0x3,0xa8,0x6,0xf0,0x17,0xfe,0x3,0xef,0x9a,0x5,0x98,0xc1,0xdd,
+    0x1,0x5,0xf0,0xf6,0xff,0xff,0x2,0xf,0xc,0x1,0x22,0x43,0xb,0xdb,0x17,0x33,
+    0x93,0x4d,0x2c,0x9,0xfd,0x6,0xa,0x98,0xef,0x28,0x49,0x40,0x18,0x61,0x1,0x23,
+    0x2,0x9c,0xff,0x64,0x6e,0x0,0x2c,0x0,0xd0,0x21,0x0,0xff,0x0,0x2a,0x0,0xd0,
+    0x13,0x13,0xca,0x18,0xfe,0x9,0x1,0xd4,0x0,0x29,0xe,0xd5,0x0,0x2b,0xff,0xc,
+    0xd5,0x80,0x21,0x9,0x6,0x8,0xe0,0xff,0xaa,0x2,0x0,0x0,0x9a,0x99,0x99,0x1,
+    0xff,0x0,0x29,0x3,0xd4,0x0,0x2b,0x1,0xd4,0xff,0x69,0x8,0x1,0x60,0x68,0x46,
+    0x0,0x79,0xff,0x4,0x99,0x8,0x70,0x8,0x98,0x0,0x78,0xff,0x4,0x99,0x48,0x70,
+    0xa,0x98,0x10,0x49,0xff,0x40,0x58,0xa,0x99,0x9c,0x22,0xd2,0x0,0xff,0x8e,0x18,
+    0xc1,0x17,0xc9,0x4,0x42,0xb,0x7f,0x11,0x43,0xc0,0x4,0xcc,0x17,0xcd,0xb3,0x5,
+    0xff,0x60,0x40,0x69,0x40,0x2b,0x0,0x0,0x1b,0xff,0x99,0x41,0x6,0xf0,0xcb,0xfc,
+    0x60,0x40,0xff,0x0,0x1b,0x30,0x60,0x2,0x22,0x1,0x46,0xfd,0x30,0xf1,0x0,0xda,
+    0xfd,0xb,0xb0,0xf0,0xbd,0xff,0x0,0xbf,0xf4,0x9,0x0,0x0,0x37,0x89,0x6b,0x41,
+    0x0,0x0,0x0,0x80,0x7f,0x1,0xff,0xd4,0x7f,0x1,0xff,0x10,0xb4,0xc3,0x69,0xa3,
+    0x49,0x41,0x18,0xff,0x2,0x22,0x13,0x42,0x7,0xd0,0xa,0x24,0xff,0xc,0x57,0x4,
+    0x2c,0x1,0xdb,0x3,0x24,0xff,0x2,0xe0,0xa,0x70,0x1,0xe0,0x0,0x24,0xff,0xc,
+    0x70,0x9b,0x6,0xf,0xd5,0x9c,0x4b,0xff,0xc3,0x18,0x1c,0x79,0x0,0x2c,0x1,0xd1,
+    0xff,0x0,0x22,0x7,0xe0,0x1b,0x68,0x40,0x2b,0xff,0x1,0xd3,0x3,0x22,0x2,0xe0,
+    0x20,0x2b,0xff,0x0,0xd2,0x1,0x22,0x8a,0x70,0xa,0x78,0xff,0x8b,0x78,0x9a,0x42,
+    0x0,0xd2,0x1a,0x0,0xff,0xa,0x70,0x10,0xbc,0x70,0x47,0x0,0x0,0xff,0x33,0x33,
+    0xff,0x7f,0xcd,0xcc,0xec,0x3,0xff,0x80,0xb5,0xa8,0x22,0x82,0x5c,0x1,0x2a,0xff,
+    0x6,0xd0,0x14,0xd3,0x3,0x2a,0x9,0xd0,0xf7,0x5,0xd3,0x4,0x5,0x0,0x1,0xbd,
+    0xc9,0x7,0xff,0xc,0xd5,0x9,0xe0,0x89,0x7,0x9,0xd5,0xdd,0x6,0x5,0x0,0x6,
+    0xd0,0x3,0x5,0x0,0x89,0xf,0xfb,0x3,0x29,0x61,0x0,0xf0,0x1,0xf8,0x1,0xbd,
+    0xf7,0x38,0xb5,0x5,0x36,0x1,0xa9,0x34,0x20,0x78,0xff,0x0,0x28,0x3,0xd0,0x2,
+    0x28,0x12,0xd0,0xff,0x11,0xd3,0x2,0xe0,0x68,0x68,0x0,0x28,0xff,0xd,0xd0,0x28,
+    0x1d,0xc2,0x68,0x11,0x0,0xff,0x2,0xd0,0x1,0x69,0x1,0x20,0x90,0x47,0xff,0x29,
+    0x0,0xac,0x31,0x28,0x0,0x0,0xf0,0xff,0x3,0xf8,0x1,0x20,0x20,0x70,0x31,0xbd,
+    0xff,0x70,0xb5,0x8a,0xb0,0x5,0x0,0xe,0x0,0xff,0x3,0x22,0x6,0xa9,0x60,0x30,
+    0x6,0xf0,0xdf,0x7f,0xfd,0x28,0x0,0x7c,0x7,0x0,0x4,0xfe,0xff,0x0,0x24,0xa0,
+    0x42,0x5,0xd1,0x80,0x20,0xff,0xc0,0x5,0x3,0x90,0x4,0x94,0x5,0x94,0xff,0x5,
+    0xe0,0x3,0x22,0x3,0xa9,0x7c,0x35,0xfd,0x28,0x23,0x1,0x15,0xfe,0x6a,0x46,0x3,
+    0xa9,0xff,0x6,0xa8,0x3,0xf0,0x44,0xff,0x0,0x28,0xfd,0x4,0x25,0x4,0x0,0x90,
+    0x1,0x94,0x2,0x94,0xff,0x33,0x0,0x3,0xaa,0x6,0xa9,0x68,0x46,0xff,0x6,0xf0,
+    0x87,0xfe,0xa,0xb0,0x70,0xbd,0xff,0xf0,0xb5,0x91,0xb0,0x6,0x0,0xf,0x0,0xff,
+    0x0,0x24,0x3c,0x70,0xa4,0x30,0x40,0x79,0xff,0x0,0x28,0x3b,0xd0,0x3,0x28,0x39,
+    0xd0,0xfe,0x31,0x2,0x9,0x90,0xa,0x94,0xb,0x94,0xc,0xff,0x94,0x9,0xa9,0x30,
+    0x0,0xff,0xf7,0xba,0xfb,0xff,0x31,0x9b,0x0,0xd,0xa8,0x5,0xf0,0x7a,0xff,0xfb,
+    0x2,0xa8,0xd,0xa9,0x10,0x22,0x5,0xff,0xf0,0x2f,0xfb,0x9,0xaa,0x2,0xa9,0x2,
+    0xff,0xa8,0x0,0xf0,0xce,0xf8,0x4,0x99,0x5,0xff,0x98,0x3,0x9a,0x6,0x92,0x7,
+    0x91,0x8,0x7f,0x90,0x6,0xa8,0x7,0xf0,0x1c,0xf8,0x71,0x0,0xff,0x25,0xa8,0x42,
+    0xb,0xdb,0x2,0x98,0xc1,0xff,0x17,0x48,0x40,0x40,0x1a,0x1,0x90,0x1,0xde,0x79,
+    0x0,0x7,0xf0,0x2f,0xf8,0xf,0x2,0x44,0x1a,0xff,0xa4,0x20,0x30,0x58,0xa0,0x42,
+    0x3,0xda,0xdd,0x30,0xef,0x4,0x3d,0x70,0x11,0xd7,0x1,0x10,0xb5,0xdf,0x4,0x0,
+    0x10,0x30,0x2,0x11,0x5,0x41,0x68,0x6d,0x0,0x11,0x1,0x3,0x20,0x37,0x1,0x70,
+    0x10,0x9,0x1,0xff,0x5,0x0,0xc,0x0,0x2e,0x0,0xa9,0x36,0x7f,0x4,0xe0,0x0,
+    0x2c,0x21,0xd1,0x28,0x93,0x0,0xd7,0xe8,0xff,0x30,0x51,0x1,0x16,0x51,0x1,0xf5,
+    0xd0,0xff,0x2,0xd3,0x3,0x28,0x5,0xd0,0x70,0xbd,0xff,0x0,0x2c,0x13,0xd0,0x2,
+    0x20,0x30,0x70,0xee,0x9,0x2,0xe,0xd1,0x0,0x9,0x0,0x9d,0x20,0xc0,0xff,0x0,
+    0x28,0x18,0x0,0x21,0xc9,0x43,0x1,0xb7,0x60,0x41,0x60,0x17,0x2,0x2,0xd0,0x3d,
+    0x2,0xc9,0xfb,0xff,0x70,0x55,0x0,0x14,0x0,0x1c,0x31,0xd,0xff,0x0,0xae,0x21,
+    0x89,0x0,0x46,0x18,0x69,0xdf,0x79,0x0,0x29,0x1,0xd0,0x79,0x1,0xe0,0xab,0x7e,
+    0xf,0x0,0x40,0x18,0x1,0xf0,0x10,0xf8,0x3f,0x1,0xff,0xd0,0x30,0x78,0x1,0x28,
+    0x17,0xd0,0x3,0xef,0x20,0x14,0xe0,0x28,0x21,0x1,0x7,0xd1,0x60,0xff,0x7,0x5,
+    0xd4,0x30,0x78,0x40,0x1e,0x1,0xff,0x28,0xc,0xd9,0x80,0x1e,0x1,0xd1,0x4,0xef,
+    0x20,0x7,0xe0,0xa8,0x19,0x0,0x5,0xd0,0x28,0x7f,0x68,0x5,0x49,0x88,0x42,0x1,
+    0xdb,0x81,0x2,0xfb,0x30,0x78,0x6b,0x0,0x0,0x4a,0xa,0x0,0x0,0xff,0xcc,0x7,
+    0x0,0x0,0x86,0xeb,0x51,0x0,0xff,0x80,0xb5,0x88,0x42,0x6,0xd1,0x0,0x21,0xff,
+    0x3,0x4a,0x81,0x54,0xfd,0xf7,0x90,0xfe,0xdf,0x1,0x20,0x2,0xbd,0x0,0x3,0x0,
+    0xc8,0xc,0xfd,0x0,0x1b,0x0,0x3,0x0,0x10,0x0,0x5a,0x1a,0xff,0x0,0x28,0xc,
+    0xd0,0x20,0x2a,0x6,0xdb,0xff,0x0,0x28,0x1,0xd4,0x10,0x48,0x2,0xbd,0x7f,0x80,
+    0x20,0x0,0x6,0x2,0xbd,0x1e,0xbd,0x0,0xef,0x8a,0x42,0x1,0xda,0x2d,0x2,0x1,
+    0x2a,0xe,0xff,0xdb,0x80,0x23,0x1b,0x6,0x19,0x0,0x11,0xfd,0x41,0x6b,0x0,0xda,
+    0x18,0x0,0x2,0xbd,0xd9,0xbf,0x43,0xb,0x0,0xd3,0x40,0x83,0x4d,0x1,0x8,0xfe,
+    0xd,0x0,0x0,0x2a,0x2,0xd5,0x11,0x0,0x4,0xff,0xf0,0xda,0xfe,0x2,0xbd,0xff,
+    0xff,0xff,0xff,0x7f,0xf1,0xb5,0x9c,0xb0,0x13,0x0,0x8,0xff,0x68,0x1a,0x68,0x4c,
+    0x68,0x65,0x42,0x1b,0xbf,0x95,0x5c,0x68,0x1a,0x94,0x8c,0x9,0x0,0x19,0xbf,0x95,
+    0x9c,0x68,0x18,0x94,0xcc,0x9,0x0,0x17,0xff,0x95,0xdc,0x68,0x16,0x94,0xc,0x68,
+    0x5d,0xff,0x68,0x15,0x95,0x4d,0x68,0x14,0x95,0x1d,0xff,0x68,0x13,0x95,0x8d,0x68,
+    0x12,0x95,0xdd,0xff,0x68,0x11,0x95,0xcd,0x68,0x6e,0x42,0x10,0xff,0x96,0x9d,0x68,
+    0xf,0x95,0xd,0x68,0xe,0xef,0x95,0x9d,0x68,0xd,0x21,0x0,0x6e,0x42,0xc,0xaf,
+    0x96,0xdd,0x68,0xb,0x23,0x0,0xa,0x2b,0x0,0x9,0xbe,0x23,0x0,0x8,0x95,0x5d,
+    0x68,0x7,0x21,0x0,0x6,0xaa,0x33,0x0,0x5,0x21,0x0,0x4,0x29,0x0,0x3,0x1f,
+    0x0,0x6e,0xff,0x42,0x2,0x96,0x5d,0x68,0x1,0x95,0xc9,0xff,0x68,0x0,0x91,0x1d,
+    0x68,0xc1,0x17,0xd3,0xff,0x17,0x5,0xf0,0xaf,0xfd,0x6,0x0,0xf,0x7f,0x0,0x1b,
+    0x98,0xc1,0x17,0x1a,0x9a,0xf,0x2,0xbf,0xa7,0xfd,0x80,0x19,0x79,0x41,0x13,0x2,
+    0x19,0xaa,0x13,0x0,0x18,0x13,0x4,0x9d,0x13,0xc,0x17,0x13,0x0,0x16,0xfa,0x13,
+    0x4,0x93,0x13,0x4,0x80,0xf,0x8a,0x0,0x10,0xff,0x43,0x1c,0x99,0x8,0x60,0x20,
+    0x0,0xe1,0xab,0x17,0x15,0x19,0x4,0x86,0x51,0x4,0x14,0x29,0x0,0x13,0xaa,0xf,
+    0x4,0x7e,0x3d,0xc,0x12,0x13,0x0,0x11,0x13,0x4,0x74,0xaa,0x13,0xc,0x10,0x13,
+    0x0,0xf,0x13,0x4,0x6a,0x51,0x14,0x48,0xab,0x60,0xe,0x19,0x0,0xd,0x19,0x4,
+    0x5d,0x51,0x4,0xc,0xaa,0xf,0x0,0xb,0xf,0x4,0x55,0x3d,0xc,0xa,0x13,0x0,
+    0x9,0xaa,0x13,0x4,0x4b,0x13,0xc,0x8,0x13,0x0,0x7,0x13,0x4,0x41,0xae,0x51,
+    0x14,0x88,0x60,0x6,0x19,0x0,0x5,0x19,0x4,0x34,0xaa,0x51,0x4,0x4,0xf,0x0,
+    0x3,0xf,0x4,0x2c,0x3d,0xc,0x2,0xaa,0x13,0x0,0x1,0x13,0x4,0x22,0x13,0xc,
+    0x0,0x13,0x0,0x2a,0xeb,0x0,0xeb,0x13,0x0,0x18,0x51,0x14,0xc8,0x60,0x1c,0xff,
+    0x98,0x1d,0xb0,0xf0,0xbd,0x80,0xb5,0x41,0xfb,0x1a,0x10,0xe3,0x1,0xe8,0xfd,0x2,
+    0xbd,0x10,0xff,0xb4,0x1,0x9c,0x9,0x68,0x1,0x60,0x11,0xff,0x68,0x41,0x60,0x19,
+    0x68,0x81,0x60,0x21,0xff,0x68,0xc1,0x60,0x10,0xbc,0x70,0x47,0x10,0xff,0xb5,0x4,
+    0x0,0x21,0x0,0x48,0x31,0x9,0xff,0x20,0x8,0x60,0x0,0x20,0x48,0x60,0x7f,0xff,
+    0x49,0x88,0x22,0x52,0x0,0xa2,0x18,0x3,0xff,0x23,0x13,0x60,0x50,0x60,0x91,0x60,
+    0xd0,0xff,0x60,0x96,0x21,0x49,0x0,0x61,0x18,0x8,0xff,0x60,0x88,0x62,0xc8,0x62,
+    0x8,0x63,0x48,0xff,0x63,0x88,0x63,0xc8,0x63,0x8,0x64,0x48,0xff,0x64,0x88,0x64,
+    0xc8,0x64,0xbe,0x20,0x40,0xff,0x0,0x20,0x18,0x6,0xf0,0x7f,0xfe,0x20,0xff,0x0,
+    0x10,0xbd,0x30,0xb5,0x83,0xb0,0x5,0xdf,0x0,0xc,0x0,0x60,0x6a,0x33,0x2,0x68,
+    0x50,0xff,0x20,0x0,0x5,0xf0,0x6e,0xfd,0x0,0x21,0xff,0x81,0x42,0xd,0xda,0x23,
+    0x0,0x8,0x33,0xff,0x22,0x1d,0x21,0x0,0x68,0x46,0x6,0xf0,0x7f,0x6e,0xfe,0x1,
+    0x0,0x65,0x4a,0x88,0x3b,0x0,0xfd,0x28,0x3b,0x0,0x6e,0xfe,0x3,0xb0,0x30,0xbd,
+    0xfd,0x38,0x87,0x0,0xd,0x0,0x28,0x0,0x6,0xf0,0xf7,0xb4,0xfe,0x90,0x55,0x4,
+    0x1,0x68,0x29,0x60,0xff,0x41,0x68,0x69,0x60,0x80,0x68,0xa8,0x60,0xbd,0x96,0x11,
+    0x2,0x58,0x68,0x62,0xae,0x19,0x4,0xc1,0xbf,0x68,0x49,0x0,0xe9,0x62,0x1,0x5,
+    0x0,0x29,0x7f,0x63,0x40,0x68,0xc0,0x0,0x68,0x63,0x87,0x6,0xff,0x29,0x0,0x38,
+    0x22,0x5,0xf0,0xf6,0xf8,0xf7,0x0,0x20,0xdc,0x7f,0x0,0x60,0x54,0x1,0x20,0xf7,
+    0x32,0xbd,0x70,0x57,0x4,0xb0,0x48,0x85,0x42,0xff,0x47,0xdb,0x28,0x0,0xe9,0x17,
+    0xae,0x4a,0xff,0x0,0x23,0x5,0xf0,0x80,0xfc,0x80,0xe,0x7f,0x8a,0x1,0x10,0x43,
+    0xc1,0x17,0xab,0xf,0x4,0x5f,0x78,0xfc,0x40,0xf,0xca,0x3b,0x1,0xb8,0x37,0x0,
+    0x7f,0x66,0x18,0x1,0x11,0x71,0x60,0xba,0xf5,0x2,0xfb,0x58,0xb6,0xb,0x1,0xa1,
+    0x50,0xc1,0x17,0xa3,0xf6,0x25,0x4,0x65,0xfc,0x61,0x7,0x30,0x60,0x2a,0x0,0xff,
+    0x0,0x20,0x80,0x21,0x89,0x2,0x6,0xf0,0xff,0x83,0xf9,0x40,0x0,0x9c,0x49,0x88,
+    0x42,0xdb,0x5,0xda,0x5,0x4,0xdb,0x80,0x89,0x0,0x8,0xe0,0xbf,0x80,0x20,0x80,
+    0x0,0x5,0xe0,0x11,0x2,0x1,0xef,0xda,0x40,0x20,0x0,0xf,0x0,0xa0,0x60,0x3,
+    0xff,0x46,0xd9,0x8,0x61,0x60,0x21,0x60,0xa,0xef,0x0,0x10,0x34,0x20,0xe7,0x0,
+    0x52,0xfe,0x70,0xff,0xbd,0xf1,0xb5,0x81,0xb0,0xa,0x0,0xb6,0xfe,0x6b,0x0,0x40,
+    0x18,0x0,0x90,0x1,0x98,0x40,0xdf,0x18,0x80,0x68,0xc1,0x17,0xe5,0x3,0x2f,0xfc,
+    0xff,0xc2,0xe,0x4c,0x1,0x22,0x43,0xcb,0x16,0xff,0x87,0xa4,0x30,0xcc,0xab,0x42,
+    0x4,0xdc,0xff,0x1,0xdb,0xa2,0x42,0x1,0xd2,0x22,0x46,0x7f,0xf,0xe0,0x0,0x27,
+    0xbb,0x42,0xb,0xf,0x4,0xff,0x8,0xd2,0xe6,0x43,0xbb,0x42,0x6,0xdb,0xff,0x1,
+    0xdc,0xb2,0x42,0x3,0xd3,0x6c,0x9,0xff,0x4,0x40,0x0,0xd0,0x6a,0x8,0x0,0x98,
+    0xef,0x2,0x60,0x1,0x98,0x55,0x2,0x42,0x18,0x40,0xff,0x58,0xc1,0x17,0x0,0x18,
+    0x49,0x41,0x80,0xff,0x24,0x24,0x6,0x0,0x25,0xed,0x43,0xa9,0xfa,0x49,0x4,0xa0,
+    0x49,0x0,0x20,0x46,0x6,0xe0,0x0,0xbf,0x25,0xa9,0x42,0x2,0xdc,0x2,0xf,0x0,
+    0x0,0xff,0xd3,0xe0,0x43,0x10,0x60,0xf3,0xbd,0xff,0xff,0xff,0xff,0x7f,0xfd,0xb5,
+    0x82,0xb0,0x1,0xff,0x20,0x4a,0x11,0x82,0x42,0x62,0xdb,0xe,0xff,0x0,0xcf,0x17,
+    0x30,0x0,0x39,0x0,0x32,0xfb,0x0,0x3b,0xcd,0x1,0xe4,0xfb,0xc0,0x22,0x12,0xff,
+    0x6,0xeb,0x23,0x12,0x18,0x4b,0x41,0x92,0xff,0xf,0x98,0x0,0x2,0x43,0x0,0x92,
+    0x1,0xff,0x20,0x0,0x99,0x81,0x42,0x0,0xda,0x0,0xff,0x90,0x2,0x22,0x0,0x99,
+    0x2,0x98,0xb2,0xef,0x23,0x5b,0x0,0xc0,0xd7,0x1,0xf0,0xfd,0x2,0xfb,0x98,0xaa,
+    0x83,0x0,0x44,0x18,0x20,0x69,0xc1,0xdb,0x17,0x5a,0x41,0x5,0xc4,0xfb,0x67,0x7,
+    0x20,0x61,0xb7,0x2,0x98,0xbc,0xf5,0x4,0x1,0x90,0x5d,0x2,0xa0,0xf7,0x22,0xd2,
+    0x5,0x1f,0x2,0xb4,0xfb,0xc2,0xc,0x5b,0x4c,0x3,0xf5,0x0,0x14,0x49,0xf5,0x4e,
+    0xb,0xf5,0x6,0xfd,0x1,0xf5,0x0,0x0,0x98,0xc0,0x0,0x2,0x99,0xfd,0x9c,0xb5,
+    0x1,0x88,0x50,0x2,0x99,0x12,0x1f,0xfe,0x5,0xa,0x1,0x20,0x3,0x99,0x49,0x11,
+    0x81,0xff,0x42,0x2e,0xdb,0x3,0x9a,0xd3,0x17,0x10,0xfb,0x0,0x19,0xcb,0x0,0x7e,
+    0xfb,0x32,0xa6,0xc0,0xff,0xce,0x36,0x18,0x4f,0x41,0xb6,0xf,0xb8,0xbf,0x0,0x6,
+    0x43,0x1,0x20,0x86,0xc5,0x0,0x1,0xbd,0x26,0xb5,0xa,0x2,0x22,0x31,0x0,0xa7,
+    0x3,0x8c,0xab,0xfd,0x20,0x93,0x1,0x2a,0xbf,0x4,0x64,0xbf,0xa,0x60,0xd5,0xf0,
+    0x67,0x0,0xa2,0x67,0x20,0x4,0x67,0x4,0x25,0xdb,0xbe,0x45,0xa,0x4,0x98,0xc1,
+    0x17,0x1b,0x3b,0x4,0x46,0xde,0x3b,0x8,0x60,0x60,0x62,0x68,0x83,0xa,0x3c,0xfb,
+    0x77,0x80,0xf,0x8a,0x13,0x0,0x1,0x21,0x88,0x7b,0x2,0xf5,0x20,0xbd,0x2,0xa8,
+    0x55,0x1c,0x5,0xb0,0xf0,0xbd,0xff,0x27,0x31,0x8,0x0,0xa4,0x70,0x3d,0xa,0xff,
+    0xa3,0xd3,0x3c,0x9,0x66,0x66,0x66,0x4e,0xff,0x1,0x0,0xc0,0x12,0x1,0x0,0x60,
+    0x9,0xaf,0x0,0x0,0x0,0x80,0xb3,0x1,0xff,0x7,0x0,0x40,0xff,0x3d,0xa,0x0,
+    0x0,0x1,0x0,0xb0,0x4,0xff,0x9a,0x99,0x99,0x29,0xf0,0xb5,0x93,0xb0,0x7f,0x4,
+    0x0,0xd,0x0,0x69,0x46,0x28,0xc3,0x0,0xef,0x4e,0xfd,0x9,0xa9,0x7,0x2,0x88,
+    0xfd,0x1,0xf7,0x99,0x0,0x98,0xad,0x3,0x1,0x0,0x2,0x98,0xfe,0x73,0x0,0xdb,
+    0x1,0x0,0x1,0x25,0xae,0x20,0xff,0x40,0x0,0x26,0x18,0xe8,0x0,0x88,0x42,0x5f,
+    0x6,0xda,0x2,0x22,0xb4,0xd,0x0,0x20,0xbf,0x1,0xff,0x10,0xfd,0xa,0xe0,0xa,
+    0x98,0x9,0x99,0xee,0x99,0x2,0x8,0x0,0xb,0xe3,0x3,0xdb,0x8,0x0,0x7f,0x40,
+    0x10,0xf0,0x60,0x4,0x99,0x3,0x43,0x8,0x5d,0x5,0x43,0x8,0x8d,0x42,0x4,0x39,
+    0x0,0x30,0x61,0x0,0x7f,0xf5,0xfc,0xa,0xe0,0xd,0x98,0xc,0x35,0x8,0x7d,0xe,
+    0x35,0xc,0x30,0x60,0x7,0x99,0x6,0x35,0x8,0xf5,0x8,0x35,0x8,0xb0,0x69,0x0,
+    0x27,0x18,0x8d,0x42,0xf5,0x3,0x3b,0x0,0x38,0x3b,0x0,0xd7,0xfc,0x0,0x21,0xff,
+    0x3b,0x68,0x32,0x68,0x20,0x0,0xff,0xf7,0xff,0xbd,0xfe,0x26,0x0,0x10,0x36,0x30,
+    0x1d,0xfd,0x98,0x45,0x1,0x61,0x18,0x24,0x22,0x4,0xf0,0x7f,0xa,0xff,0xf8,0x36,
+    0x35,0x70,0x13,0xb,0x1,0xff,0xfe,0xb5,0x4,0x0,0x0,0x20,0xe0,0x60,0xff,0x0,
+    0x9d,0xd8,0x35,0x28,0x68,0x0,0x28,0xff,0x1,0xd1,0xbf,0x48,0xa,0xe0,0xc1,0x17,
+    0xff,0x48,0x40,0x42,0x1a,0xab,0xa0,0x3,0xc8,0x7f,0x5,0xf0,0xc2,0xff,0x29,0x68,
+    0xc9,0xf,0x0,0xdf,0x40,0x1a,0xc1,0x17,0xa9,0x7d,0x5,0x87,0xfa,0xee,0x7d,0x7,
+    0x1,0x11,0x96,0x5f,0x1,0xa2,0x18,0x91,0xdb,0x64,0xba,0x59,0x2,0x58,0xb6,0xd,
+    0x0,0xa1,0x50,0xb7,0xc1,0x17,0xa0,0x25,0x4,0x74,0xfa,0x8f,0x7,0x96,0xfe,0x75,
+    0x4,0x48,0x64,0x0,0x98,0xb4,0x30,0x4,0xff,0xf0,0x42,0xfc,0x86,0x11,0x0,0x98,
+    0xa8,0xae,0x9,0x0,0x3d,0xfc,0x87,0x9,0x0,0x9c,0x9,0x0,0x38,0xf7,0xfc,0x85,
+    0x11,0xbf,0x2,0x26,0x50,0x0,0x1f,0xff,0x27,0x50,0xc,0x30,0x25,0x50,0x1,0x98,
+    0xff,0x0,0x28,0x46,0xd0,0x0,0x20,0x1,0x99,0xff,0xc9,0x6a,0x88,0x42,0x11,0xda,
+    0x48,0x10,0xfe,0x45,0x6,0xc8,0x63,0x1,0x98,0xc0,0x6a,0xc1,0xab,0x17,0x89,0x61,
+    0x4,0x43,0x61,0x8,0x85,0x1,0x1,0x5,0x5e,0xc5,0x0,0x1,0x99,0x9,0x6b,0x2d,
+    0x12,0x8,0x2d,0x0,0x5f,0x0,0x6b,0xc1,0x17,0x7d,0x2d,0x4,0x2c,0x2d,0x8,0xf5,
+    0x87,0x2d,0x0,0x7,0x2d,0x4,0x49,0x6b,0x8b,0x10,0xff,0x98,0x42,0x3,0xdb,0x83,
+    0x42,0x10,0xdb,0x5f,0x88,0x7,0xe,0xd0,0xc8,0x37,0x8,0x48,0x37,0x0,0x75,0x40,
+    0x37,0x0,0x6f,0x37,0x4,0x10,0xfa,0x8e,0x31,0x0,0xff,0xe,0x0,0x33,0x0,0x3a,
+    0x0,0x29,0x0,0xfe,0x4f,0x3,0x15,0xfe,0x0,0x98,0xd8,0x30,0x0,0xff,0x68,0x80,
+    0x10,0x68,0x49,0x88,0x42,0x2,0xff,0xdb,0x80,0x20,0x80,0x0,0x6,0xe0,0x66,0xce,
+    0xb,0x0,0x38,0xda,0x65,0x5,0x2,0x11,0x0,0xa0,0x60,0xff,0xc0,0x8,0x60,0x60,
+    0x20,0x60,0x0,0x20,0xfd,0xde,0x53,0x4,0x3,0x25,0x3,0x22,0x8,0x60,0xff,0x9,
+    0x1d,0x52,0x1e,0xfb,0xd1,0xa0,0x68,0xff,0x61,0x68,0x22,0x68,0x27,0x0,0x10,0x37,
+    0xff,0x9,0x26,0x3e,0x60,0xba,0x62,0xf9,0x62,0xf7,0x38,0x63,0x38,0x9d,0x11,0x3b,
+    0xfe,0x38,0x0,0xff,0x38,0x30,0x0,0x21,0x41,0x60,0x6,0x60,0xff,0xf8,0x37,0x1,
+    0x26,0x3e,0x70,0x7e,0x70,0xf7,0x59,0x49,0x88,0x21,0x1,0x20,0x18,0x0,0x22,0xff,
+    0x42,0x60,0x5,0x60,0x81,0x60,0x0,0x21,0xff,0xc1,0x60,0x2,0x0,0x10,0x32,0x8,
+    0xe0,0xfd,0x80,0x17,0x0,0xc7,0xe7,0x40,0x20,0xc5,0xe7,0xff,0x0,0x23,0x13,0x60,
+    0x49,0x1c,0x12,0x1d,0xff,0x3,0x68,0x99,0x42,0xf8,0xd3,0x0,0x20,0xee,0xcd,0x2,
+    0x60,0x50,0xdc,0x1f,0x0,0x27,0x18,0x3c,0xf7,0x38,0x25,0x18,0x55,0x3,0xc,0xd0,
+    0x28,0x0,0xb7,0x1,0x99,0x38,0x65,0x0,0x8,0xfe,0xcd,0x6,0xca,0xff,0xfc,0x68,
+    0x46,0x0,0x7a,0x38,0x70,0x7,0xff,0xe0,0x28,0x0,0x6,0xf0,0x9b,0xfb,0x3e,0xfd,
+    0x70,0x17,0x6,0xbe,0xfc,0x3,0xb0,0xf0,0xbd,0xff,0xf8,0xb5,0x1,0x0,0x1,0x25,
+    0x0,0x29,0xff,0x3,0xd5,0x0,0x25,0xed,0x43,0x48,0x42,0xdd,0x1,0x39,0x1,0x2d,
+    0x4a,0x91,0xf5,0x0,0x52,0x1c,0xff,0x91,0x42,0x3c,0xda,0xc,0x1,0x2b,0x48,0xff,
+    0x84,0x42,0x17,0xdb,0x2a,0x49,0x2b,0x4e,0xff,0x2b,0x4f,0x2c,0x48,0x0,0x91,0xc1,
+    0x17,0xef,0x22,0x0,0xe3,0x17,0xff,0x1,0xf9,0x40,0xf,0xad,0xca,0x6f,0x1,0xc0,
+    0x19,0x11,0xa,0x6b,0x11,0x8,0x80,0xff,0x19,0x16,0xe0,0x22,0x49,0x23,0x4f,0x23,
+    0x5b,0x4e,0x25,0x2f,0x0,0x0,0x21,0x1d,0x6,0x5c,0x1d,0xc,0xea,0x2f,0xa,0x53,
+    0x41,0x1c,0x4a,0x11,0x8,0x0,0x99,0x40,0xff,0x18,0x0,0x21,0xc9,0x43,0x8d,0x42,
+    0x2,0xff,0xd1,0x80,0x21,0x89,0x5,0x8,0x1a,0xf2,0xfb,0xbd,0x0,0x0,0x2,0x90,
+    0xc2,0xf5,0x28,0x0,0xff,0xa3,0xd3,0x3c,0x9,0x66,0x66,0x66,0x4e,0xff,0x9a,0x99,
+    0x99,0x29,0x1,0x0,0xc0,0x12,0xff,0x1,0x0,0x60,0x9,0x1,0x0,0xb0,0x4,0xfa,
+    0x13,0x0,0x6,0x3,0x0,0x2a,0x66,0x79,0xa8,0x10,0xff,0x99,0x23,0x35,0xef,0x83,
+    0x14,0xbc,0x5,0xff,0xd0,0xd5,0x56,0xff,0xf5,0xbd,0x6,0x10,0xff,0xce,0xfd,0xd5,
+    0xf2,0x93,0xb9,0x43,0x1,0xff,0xff,0xff,0xff,0x7f,0xb5,0xe1,0xf0,0x0,0xff,0xf9,
+    0xb5,0xbd,0xb0,0xe,0x0,0x17,0x0,0xbf,0xb0,0x69,0x11,0x90,0x34,0xa8,0xbd,0x3,
+    0xcb,0xff,0x68,0x3,0x60,0xb,0x68,0xc3,0x60,0xcb,0xff,0x69,0x5b,0x10,0x83,0x61,
+    0x9,0x1d,0x0,0xfe,0xcb,0x1,0xf4,0xd1,0x3d,0x98,0x0,0x1d,0x8,0xff,0x90,0x80,
+    0x68,0x40,0x1c,0x8,0x99,0x88,0xff,0x60,0x18,0xaa,0x34,0xa9,0x3d,0x98,0x10,0xff,
+    0x30,0x6,0xf0,0x8c,0xfb,0x3e,0x98,0x1c,0xff,0x30,0x3,0x90,0x0,0x24,0x4,0x60,
+    0x3e,0xbf,0x99,0xc,0x31,0x3,0x22,0xc,0xfd,0x9,0x18,0xff,0xa8,0x24,0x21,0x41,
+    0x5c,0x3,0x9a,0x91,0xfb,0x71,0x25,0x7,0x4,0x11,0x71,0x3,0x9a,0x54,0xff,0x71,
+    0x24,0x30,0x0,0x78,0x0,0x28,0x0,0xff,0xd1,0x18,0xe2,0x3d,0x98,0x48,0x30,0x4,
+    0xff,0x90,0x40,0x68,0x7,0x90,0x22,0xa9,0x4,0xff,0x98,0x6,0xf0,0x54,0xfb,0x23,
+    0x98,0x22,0xff,0x99,0x88,0x42,0x0,0xda,0x8,0x0,0x24,0xff,0x99,0x81,0x42,0x0,
+    0xdb,0x8,0x0,0x4,0xff,0x99,0x8,0x31,0xca,0x68,0x3e,0x9b,0xda,0xff,0x60,0xa,
+    0x69,0x3e,0x9b,0x1a,0x61,0x4a,0xfe,0x5,0x0,0x5a,0x61,0x3d,0x9a,0x84,0x23,0x5b,
+    0xff,0x0,0xd2,0x18,0x2,0x92,0x12,0x6f,0x13,0xff,0x12,0x98,0x42,0x34,0xdb,0x83,
+    0x42,0x1,0xff,0xdb,0x10,0x6,0x30,0xd1,0x0,0x2f,0x0,0xff,0xd1,0xeb,0xe1,0x8,
+    0x98,0x0,0x68,0x7,0xfe,0x49,0x2,0xd3,0xe5,0xe1,0xce,0x3,0x12,0x25,0xfd,0x30,
+    0xef,0x1,0xff,0xfb,0x28,0x1a,0xc1,0x7,0xff,0xc9,0xf,0x45,0x18,0x11,0x20,0x41,
+    0x1b,0xff,0x30,0x0,0x4,0xf0,0x77,0xf9,0x2,0x21,0xff,0x6,0xf0,0xa3,0xfe,0x1,
+    0x21,0x6a,0x10,0xff,0x89,0x1a,0x4,0xf0,0x6f,0xf9,0x5,0x90,0xff,0x2,0x98,0xc0,
+    0x6d,0xc1,0x17,0x5,0x9a,0x7d,0xd3,0x83,0x1,0x88,0xf8,0x80,0xf,0x8a,0x83,0x1,
+    0xff,0x6,0x0,0x19,0x99,0x18,0x98,0x81,0x42,0xff,0x31,0xda,0x1,0x0,0x2f,0xe0,
+    0x8,0x68,0x7f,0x5,0x90,0x48,0x68,0x6,0x90,0x88,0xb7,0x0,0xff,0x1,0x20,0x3,
+    0x99,0x48,0x71,0xb9,0x4a,0xff,0x3,0x98,0x2,0x60,0x3d,0x98,0x88,0x21,0xfb,0x49,
+    0x0,0xad,0x1,0x90,0x44,0x60,0x5,0x60,0xff,0x82,0x60,0xc4,0x60,0x0,0x21,0x3,
+    0x0,0xff,0x10,0x33,0x2,0xe0,0x1c,0x60,0x49,0x1c,0xff,0x1b,0x1d,0x5,0x68,0xa9,
+    0x42,0xf9,0xd3,0xdf,0xb0,0x69,0x3d,0x99,0x96,0xbb,0x0,0xc8,0x50,0xf7,0x5,0xa9,
+    0x0,0xf3,0x0,0xa,0xfa,0x4,0x99,0xff,0x3d,0x98,0xff,0xf7,0x42,0xfd,0x1,0x20,
+    0xff,0x2,0x99,0x8,0x70,0x8d,0xe1,0x1a,0x98,0xfe,0xb7,0x0,0xdb,0x1,0x0,0x10,
+    0x94,0x2,0x22,0xff,0x10,0xa8,0x6,0xf0,0x67,0xfa,0x3d,0x98,0xfd,0xb2,0x59,0x2,
+    0x58,0x10,0x9d,0x2d,0x1a,0x0,0xff,0x2e,0x1,0xd1,0x9d,0x4a,0x5,0xe0,0x32,0xff,
+    0x0,0x0,0x20,0x64,0x39,0x5,0xf0,0x5e,0xdb,0xfd,0x2,0x4c,0x1,0xe9,0x17,0xaf,
+    0x2,0x30,0xf8,0xff,0xc2,0xb,0x4d,0x4,0x2a,0x43,0xcb,0x13,0xff,0x80,0x26,0x36,
+    0x6,0x0,0x27,0xff,0x43,0xff,0xbb,0x42,0x4,0xdc,0x1,0xdb,0xb2,0x42,0xff,0x1,
+    0xd2,0x30,0x46,0x14,0xe0,0xc2,0xb,0xdf,0x2a,0x43,0xa3,0x42,0xb,0x11,0x4,0x8,
+    0xd2,0xfd,0xf6,0xb,0x0,0x7,0xdb,0x1,0xdc,0xb2,0x42,0xff,0x4,0xd3,0x32,0xc,
+    0x2,0x40,0x1,0xd0,0xff,0x87,0x48,0x2,0xe0,0xc0,0xb,0x4a,0x4,0xff,0x10,0x43,
+    0xff,0xf7,0x78,0xfe,0x12,0x90,0xff,0x7,0x98,0x80,0x3,0xc1,0x17,0x16,0xaa,0xbf,
+    0x3,0xc2,0x2,0x98,0x80,0x6e,0x9,0x2,0xc,0xff,0xca,0x4,0xf0,0xfd,0xff,0xc0,
+    0xd,0x4a,0xe9,0x2,0x15,0x3,0x2b,0x1,0x6c,0x2b,0x7,0x4,0xf0,0xf2,0xbd,0xff,
+    0x2b,0x7,0xa,0x90,0x6,0x94,0x17,0x6,0xf7,0xef,0x17,0x2,0x0,0xb,0x65,0x1,
+    0xe5,0xff,0x40,0xff,0xe,0xca,0x1,0x10,0x43,0xc1,0x17,0x49,0xff,0x6,0xc2,0x9,
+    0x11,0x43,0x40,0x6,0x0,0xff,0x90,0x1,0x91,0x30,0x0,0x39,0x0,0x32,0xfb,0x0,
+    0x3b,0x1f,0x0,0xd5,0xff,0x0,0x9a,0x1,0xdf,0x9b,0x80,0x18,0x59,0x41,0x27,0x6,
+    0x6,0x90,0xff,0x2,0x22,0x6,0x99,0x6,0xa8,0x8,0xf0,0x5f,0x29,0xfd,0x1c,0x99,
+    0x1b,0x77,0x1,0x0,0x77,0x1,0xd5,0x1d,0x15,0x9,0xf,0x15,0x1,0xf,0x15,0x1,
+    0xdc,0xf9,0x7f,0xe,0x94,0x6,0xaa,0xf,0xa9,0xe,0x27,0x0,0xff,0x39,0xfd,0x9,
+    0x94,0xa,0x98,0x0,0x28,0xff,0x1,0xd1,0x56,0x48,0x5,0xe0,0x2,0x46,0xf7,0x0,
+    0x20,0x80,0x2f,0x1,0x5,0xf0,0xd0,0xfc,0xff,0x9,0x90,0xd,0x94,0x9,0xaa,0xe,
+    0xa9,0xfd,0xd,0x25,0x0,0x2f,0xfd,0xd,0x98,0x40,0x10,0x5f,0xff,0xf7,0xb,0xfe,
+    0x13,0xe5,0x1,0x40,0xcf,0xc,0x75,0x95,0xcf,0x10,0x0,0xfb,0x9,0x4,0xf0,0x8a,
+    0xcf,0x8,0x77,0xc,0x90,0x5,0xcf,0x0,0x2,0x6d,0xd3,0xcf,0x0,0x57,0x10,0x0,
+    0x19,0xaf,0x0,0x7d,0xcf,0x38,0x6d,0xcf,0x18,0xdd,0x5,0xcf,0x0,0x5,0x99,0x5,
+    0x81,0x0,0xc1,0xfc,0x57,0x1f,0x99,0x1e,0xcf,0x8,0x20,0xcf,0x8,0xb,0xcf,0x0,
+    0xfd,0xb,0xcf,0x0,0x74,0xf9,0xa,0x94,0x5,0xaa,0xf7,0xb,0xa9,0xa,0x27,0x0,
+    0xd1,0xfc,0x1,0x94,0xff,0xc,0x98,0x4f,0x49,0x88,0x42,0x1,0xda,0xfd,0x4f,0xd1,
+    0x14,0x67,0xfc,0x1,0x90,0x2,0x94,0xdf,0x1,0xaa,0xa,0xa9,0x2,0x27,0x0,0xc6,
+    0xfc,0xfc,0xc7,0x0,0xd1,0x0,0xa2,0xfd,0x14,0x90,0x12,0x98,0xf7,0xc1,0x17,0x13,
+    0xb9,0x4,0x2d,0xff,0x40,0xf,0x5d,0xca,0xb9,0x0,0xc1,0x17,0x14,0xf,0x4,0x25,
+    0xf,0x8,0xff,0x5,0x0,0x80,0x20,0x80,0x5,0x85,0x42,0xff,0x1c,0xda,0x1,0x2d,
+    0x0,0xda,0x0,0x25,0xff,0x1,0x20,0x2a,0x1a,0x28,0x0,0xe9,0x17,0xfa,0x23,0x2,
+    0x13,0x23,0xc,0x8,0x98,0x40,0x68,0x2,0xff,0x5,0x7,0x98,0x0,0x5,0xc1,0x17,
+    0x89,0xff,0x7,0x83,0x8,0x19,0x43,0x0,0x2a,0x5,0xff,0xd1,0x0,0x4a,0x11,0xe0,
+    0xff,0xff,0xff,0xff,0x7f,0x5,0x0,0xe3,0xe7,0xce,0x17,0xcf,0xff,0x17,0xd4,0x17,
+    0x62,0x40,0x12,0x1b,0x79,0xff,0x40,0x3b,0x0,0xb0,0x1b,0x99,0x41,0x5,0xff,0xf0,
+    0x25,0xfc,0x74,0x40,0x60,0x40,0x2,0xed,0x1b,0x4f,0xa,0xeb,0xfe,0x3d,0x7,0x5,
+    0x0,0x24,0xff,0x22,0x4,0x99,0x8,0x31,0x2b,0xa8,0x4,0xff,0xf0,0x45,0xfb,0x3,
+    0x98,0x5,0x60,0x1c,0xff,0x48,0x85,0x42,0x1b,0xdb,0x2b,0xaa,0x13,0xff,0x0,0x8,
+    0x33,0x12,0x1d,0x2b,0xa9,0x12,0xbe,0xfb,0x0,0x81,0xf8,0x3d,0x98,0x88,0xdf,0x0,
+    0x40,0xff,0x18,0x0,0x90,0x3d,0x98,0x1c,0x31,0x44,0xff,0x18,0x11,0x9a,0x21,0x68,
+    0x0,0x98,0x8,0xff,0xf0,0x81,0xfc,0x11,0x98,0x20,0x60,0x2a,0x9f,0x0,0x12,0xa9,
+    0x0,0x98,0x23,0x1,0x27,0x0,0x90,0xfe,0x27,0x4,0x1,0x68,0x3e,0x9a,0x11,0x60,
+    0x41,0xfe,0x5,0x0,0x51,0x60,0x80,0x68,0x3e,0x99,0x88,0xaf,0x60,0x3d,0x98,0x8e,
+    0x19,0x2,0x58,0xb,0x0,0x61,0xff,0x3f,0xb0,0xf0,0xbd,0x0,0x0,0x1a,0x2,0xff,
+    0x0,0x0,0x0,0x80,0xff,0x7f,0xce,0xcc,0xff,0xcc,0x4,0x0,0x21,0x81,0x61,0xc1,
+    0x61,0xff,0x70,0x47,0x0,0xbf,0x0,0x21,0x1,0x60,0xff,0x41,0x60,0x1,0x81,0x70,
+    0x47,0x1,0x81,0xff,0x2,0x60,0x0,0x21,0x41,0x60,0x70,0x47,0xff,0xf0,0xb5,0x4,
+    0x0,0x8,0x1,0x40,0x1a,0xff,0x90,0x42,0x2e,0xd3,0x18,0x68,0x1,0x0,0x7f,0x1b,
+    0x1d,0x2,0x25,0x1e,0x68,0x86,0x9f,0x1,0xf7,0x30,0x46,0xb1,0x5,0x0,0x31,0x46,
+    0x1b,0x1d,0xff,0x6d,0x1e,0xf5,0xd1,0x80,0x23,0x1b,0x6,0xff,0x99,0x42,0x1,0xd1,
+    0xd9,0x43,0x8,0xe0,0xff,0xcb,0x17,0x59,0x40,0xc9,0x1a,0xc5,0x17,0xef,0x68,0x40,
+    0x40,0x1b,0xc9,0x7,0x20,0x68,0x81,0xff,0x42,0xe,0xda,0x25,0x1d,0x2e,0x68,0xb7,
+    0xff,0x0,0x0,0x26,0x10,0x0,0xc1,0x17,0xe,0xff,0x4a,0x0,0x23,0x4,0xf0,0x65,
+    0xfe,0x80,0xff,0x19,0x79,0x41,0x88,0x10,0x28,0x60,0x1,0xff,0xe0,0x0,0x20,0x60,
+    0x60,0x8,0x20,0x21,0xdf,0x5e,0x60,0x68,0x0,0x14,0xdd,0x3,0x0,0x22,0xff,0x0,
+    0xe0,0x1,0x22,0x5,0x98,0x2,0x70,0xff,0x0,0x78,0x0,0x28,0x1,0xd0,0x8,0x4,
+    0xfb,0x60,0x60,0xbb,0x2,0x83,0xde,0x1b,0x43,0x41,0xff,0x68,0x9,0x14,0x8,0x22,
+    0x80,0x5e,0x81,0xf2,0x27,0x2,0x20,0xaf,0x0,0x3,0x0,0xc,0xb4,0x2,0xb0,0xb7,
+    0x70,0x47,0x10,0xaf,0x0,0x0,0x20,0x4a,0x0,0x60,0xff,0xa0,0x60,0xe0,0x60,0x20,
+    0x61,0x60,0x61,0xff,0xa0,0x61,0x80,0x21,0xc9,0x5,0x22,0x0,0xff,0x1c,0x32,0x11,
+    0x60,0x50,0x60,0x90,0x60,0xff,0xd0,0x60,0xe0,0x62,0x20,0x0,0x30,0x30,0xff,0x8,
+    0xf0,0x3c,0xfc,0x20,0x0,0x10,0xbd,0xff,0x10,0xb5,0x82,0xb0,0x4,0x0,0x4,0x98,
+    0xff,0x0,0x90,0x20,0x0,0x0,0xf0,0xc,0xf8,0xfb,0x0,0x20,0x2f,0x2,0xe1,0x61,
+    0x20,0x62,0x60,0xff,0x62,0xa0,0x62,0x21,0x63,0x60,0x63,0xa0,0xbf,0x63,0xe0,0x63,
+    0x13,0xbd,0xf8,0x59,0x0,0x15,0xff,0x0,0x6,0x9e,0x8f,0x10,0x27,0x60,0x65,0xff,
+    0x60,0xa3,0x60,0xe8,0x11,0x6,0xf0,0x3b,0xbb,0xfa,0xe0,0x7,0x4,0x2,0xfa,0x20,
+    0x65,0x0,0x49,0xff,0x5,0x61,0x61,0x20,0x0,0x14,0x30,0xca,0xef,0x19,0x2,0x60,
+    0xa1,0x9,0x0,0x18,0x30,0xc9,0xff,0x1b,0x1,0x60,0xb0,0x10,0x20,0x64,0xf1,0xfe,
+    0xb7,0x0,0xf9,0xb5,0x95,0xb0,0x0,0x20,0x15,0xff,0x9b,0x9b,0x68,0x83,0x42,0x2,
+    0xd1,0x1d,0xff,0x98,0x1c,0x99,0x1f,0xe1,0x0,0x2a,0x3,0xff,0xd0,0x19,0x20,0x41,
+    0x43,0x91,0x42,0xf,0xff,0xd2,0x15,0x98,0x1c,0x30,0x1c,0x99,0x10,0xff,0x22,0x4,
+    0xf0,0x3e,0xfa,0x15,0x98,0x30,0xfe,0xb,0x8,0x38,0xfa,0x1d,0x98,0x15,0x99,0x1c,
+    0xff,0x31,0x9,0xe1,0x10,0x0,0xd1,0x17,0x86,0xfe,0x35,0x5,0xca,0xfd,0x2,0xd,
+    0xc,0x3,0x22,0xff,0x43,0xb,0x15,0x83,0xa4,0x30,0xcc,0xab,0xff,0x42,0x4,0xdc,
+    0x1,0xdb,0xa2,0x42,0x1,0xff,0xd2,0x1,0x94,0x12,0xe0,0x0,0x27,0xbb,0xfb,0x42,
+    0xb,0xf,0x4,0x8,0xd2,0xe6,0x43,0xbb,0xff,0x42,0x8,0xdb,0x1,0xdc,0xb2,0x42,
+    0x5,0xff,0xd3,0x2c,0xb,0x4,0x40,0x2,0xd0,0x68,0xf7,0x8,0x1,0x90,0x55,0x1,
+    0x92,0x0,0x20,0x1,0xdf,0x99,0x88,0x42,0x3,0xdb,0x5b,0x6,0xdb,0xe0,0xff,0x0,
+    0x29,0x1,0xd1,0x68,0x8,0x4,0xe0,0xff,0xa,0x46,0x80,0x21,0x89,0x3,0x5,0xf0,
+    0xef,0xc1,0xfa,0x4,0x90,0x19,0x2,0x10,0xa8,0x4,0x7f,0xf0,0x3d,0xfa,0xc,0xa8,
+    0x10,0xa9,0x8b,0x2,0xff,0xf2,0xf9,0x1c,0x9a,0xc,0xa9,0xc,0xa8,0xdf,0xfe,0xf7,
+    0x91,0xff,0x9,0x7,0x0,0x5,0xf0,0xff,0xbd,0xfa,0x0,0x20,0x3,0x90,0x6,0xa8,
+    0xff,0x2,0x90,0x9,0xa8,0x0,0x90,0x0,0x27,0xff,0x0,0x98,0x0,0x68,0xc1,0x17,
+    0x4,0x9a,0xff,0xd3,0x17,0x4,0xf0,0x77,0xfd,0x82,0xf,0xff,0x8c,0x0,0x22,0x43,
+    0x8b,0x17,0x80,0x24,0xbf,0x24,0x6,0x0,0x25,0xed,0x43,0xa9,0xe,0x22,0xd7,0x46,
+    0xe,0xe0,0xa7,0x16,0x6,0xa7,0x4,0x3,0xd3,0xff,0xac,0x8,0x4,0x40,0x0,0xd0,
+    0x6a,0x8,0xff,0x2,0x98,0x2,0x60,0x3,0x98,0x40,0x1c,0x7b,0x3,0x90,0x53,0x0,
+    0x1d,0x0,0x90,0x2,0x5,0x0,0xff,0x2,0x90,0x3,0x98,0x3,0x28,0xcc,0xdb,0xff,
+    0x6,0x98,0x7,0x99,0x8,0x9a,0x52,0x10,0xff,0x49,0x10,0x40,0x10,0x3,0x90,0x4,
+    0x91,0xfd,0x5,0xcf,0x0,0x16,0x99,0x3,0xaa,0x13,0x68,0xff,0xc,0x68,0xa4,0x11,
+    0x1b,0x1b,0x13,0x60,0xff,0x40,0x1c,0x12,0x1d,0x9,0x1d,0x3,0x28,0xff,0xf5,0xdb,
+    0x2,0x97,0x0,0x26,0x3,0xac,0xff,0x3,0x25,0x20,0x68,0x40,0x10,0xc1,0x17,0xff,
+    0x2,0x0,0xb,0x0,0x4,0xf0,0x2a,0xfd,0xff,0x80,0x19,0x79,0x41,0x6,0x0,0xf,
+    0x0,0xff,0x24,0x1d,0x6d,0x1e,0xf1,0xd1,0x2,0x20,0xff,0x0,0x90,0x32,0x0,0x3b,
+    0x0,0x2,0xa8,0xff,0x8,0xf0,0x3b,0xfb,0x2,0x98,0x40,0x0,0xf7,0xc1,0x17,0x1,
+    0xc3,0x4,0x15,0xfd,0x80,0xf,0xff,0x8a,0x0,0x10,0x43,0x6,0x0,0x15,0x98,0xff,
+    0x84,0x68,0x20,0x12,0xb0,0x42,0xc,0xdb,0xff,0x9,0xab,0x6,0xaa,0x16,0x99,0x15,
+    0x98,0xff,0x0,0xf0,0x60,0xf8,0x1,0x9a,0x9,0xa9,0x7e,0xb7,0x3,0x8,0xf0,0x4e,
+    0xfb,0x30,0xe0,0xc1,0xf,0xff,0x5d,0xf9,0x1c,0x21,0x20,0x0,0x8,0xf0,0x7f,0xf9,
+    0xfb,0x4,0x0,0x14,0x21,0x30,0x9,0x0,0xff,0xf4,0xfb,0x5,0x0,0xb2,0xa6,0xc0,
+    0xce,0x7e,0x15,0x2,0x26,0xfc,0x0,0x22,0xb1,0x4b,0x6b,0x0,0xf9,0xfc,0x75,0x2,
+    0x25,0x0,0xfc,0x0,0x90,0x1,0x91,0x55,0x28,0x9,0x0,0x19,0x19,0x0,0xaa,0x19,
+    0x0,0x2e,0x19,0x8,0xfb,0xec,0xfc,0xb1,0x2,0x0,0xbf,0xb,0xa1,0x1,0xdf,0x20,
+    0xff,0xf7,0x8e,0xfe,0x93,0x3,0x15,0x98,0xfd,0x30,0x6f,0x0,0x40,0xfd,0x1,0x0,
+    0x1d,0x98,0xfe,0x6b,0x2,0x27,0xf9,0x17,0xb0,0xf0,0xbd,0x0,0xff,0x0,0x83,0xde,
+    0x1b,0x43,0x0,0x0,0x0,0xfb,0x80,0xff,0x0,0x0,0x51,0x75,0x61,0x74,0x65,0xff,
+    0x72,0x6e,0x69,0x6f,0x6e,0x20,0x4a,0x75,0xff,0x6d,0x70,0x3a,0x20,0x25,0x30,0x2e,
+    0x32,0x7f,0x66,0x20,0x64,0x65,0x67,0x20,0x3e,0xb,0xe,0xff,0x0,0x0,0xff,0xb5,
+    0x93,0xb0,0x18,0x46,0xff,0x1c,0xc9,0x1c,0xc0,0x14,0x99,0x68,0x46,0xff,0x8,0xf0,
+    0xa3,0xfd,0x68,0x46,0x3,0xc8,0xd7,0xc0,0xf,0x4a,0xf3,0x0,0x2,0xcf,0x3,0x22,
+    0x0,0xf7,0x23,0x15,0x9c,0x3d,0xb,0x0,0x92,0x1,0x93,0xfe,0x41,0x7,0x89,0xfc,
+    0x0,0x9a,0x1,0x9b,0x80,0xe7,0x18,0x59,0x41,0xf,0x2,0x45,0x3,0xed,0xd1,0x2,
+    0xff,0x98,0x7d,0x49,0x88,0x42,0x0,0xda,0xed,0xff,0xe0,0xd2,0xf,0x58,0x0,0x2,
+    0x43,0x2,0xff,0x2a,0x0,0xda,0xe7,0xe0,0x3,0x97,0x2,0xef,0x22,0x2,0x99,0x3,
+    0x59,0x1,0x8c,0xfd,0x14,0xef,0x9a,0x15,0x99,0x4,0x9,0x0,0xab,0xfd,0x13,0x7f,
+    0x98,0xc0,0x68,0x80,0x21,0xc9,0x5,0x2f,0x0,0xff,0xd1,0x82,0xe0,0x14,0x99,0x7,
+    0xa8,0x4,0xff,0xf0,0x78,0xfc,0x3,0x22,0x7,0xa9,0x7,0xbe,0x1f,0x0,0xb4,0xfd,
+    0x15,0x99,0xd,0x7,0x0,0x39,0xdf,0xfe,0x3,0x22,0xd,0xa9,0x9,0x2,0x3f,0xfe,
+    0xff,0xd,0x99,0xe,0x9a,0xf,0x98,0x40,0x1,0xff,0x52,0x1,0x49,0x1,0xa,0x91,
+    0xb,0x92,0xff,0xc,0x90,0x0,0x20,0x0,0x21,0x7,0xae,0xf9,0xa,0xdb,0x1,0x3d,
+    0x3,0x30,0x68,0xc1,0x17,0x22,0x75,0x68,0xb3,0x3,0x3b,0x9b,0xc,0x24,0x1d,0x36,
+    0x99,0x0,0xff,0xef,0xd1,0x80,0xe,0x8a,0x1,0x10,0x43,0xbb,0x4,0x0,0x75,0x2,
+    0x0,0x11,0xa0,0xa3,0x0,0x7e,0xef,0xe0,0x7,0xa9,0x4,0x73,0x0,0x3e,0xfc,0x66,
+    0xbf,0x42,0x0,0x24,0x4,0xad,0x28,0x3d,0x0,0x32,0xdb,0x0,0xf3,0x3d,0x0,0x1c,
+    0xfc,0x2d,0x6,0x28,0x60,0xff,0x64,0x1c,0x2d,0x1d,0x3,0x2c,0xf1,0xdb,0xff,0x0,
+    0x20,0x4,0xa9,0xa,0xaa,0xb,0x68,0xff,0x14,0x68,0x1b,0x19,0xb,0x60,0x40,0x1c,
+    0xff,0x12,0x1d,0x9,0x1d,0x3,0x28,0xf6,0xdb,0xf7,0x3,0x22,0x4,0x43,0x0,0x8,
+    0xf0,0x5d,0xfd,0xef,0x13,0x99,0xc,0x31,0xb7,0x2,0x75,0xfe,0x13,0xf7,0x99,0x10,
+    0x31,0x13,0x2,0x70,0xfe,0x7,0xa9,0xfd,0x10,0x5f,0x0,0xe,0xfc,0x4,0xa9,0x8,
+    0xf0,0xf5,0x7e,0xc7,0x0,0x10,0xf,0x0,0x8,0xf0,0x47,0xfd,0xef,0x16,0x98,0x10,
+    0xa9,0x6f,0x3,0x3,0xa9,0x16,0xdf,0x98,0x8,0xf0,0x7f,0xfe,0x13,0xb,0x21,0xfd,
+    0xff,0x4,0xa8,0x3,0xc8,0x0,0xb,0xa,0x5,0xff,0x10,0x43,0x9,0x13,0x2,0x9a,
+    0xd3,0x17,0xfe,0x27,0x1,0xfe,0x0,0x90,0x13,0x98,0x40,0x69,0xcf,0x0,0x13,0x0,
+    0x99,0x59,0x3,0xd,0x2,0x80,0x69,0xff,0x1,0x13,0x0,0x9b,0x8b,0x42,0x3,0xdb,
+    0xff,0x99,0x42,0x2,0xdb,0x0,0x5,0x0,0xd0,0xff,0x0,0x91,0x2,0x97,0x16,0x98,
+    0x1,0x90,0xd7,0x1,0x98,0x0,0xc5,0x0,0x0,0x39,0x0,0x4,0xf0,0xff,0xb9,0xfb,
+    0x2,0xc,0xc,0x4,0x22,0x43,0xff,0xb,0x14,0x80,0x24,0x24,0x6,0x0,0x25,0xff,
+    0xed,0x43,0xab,0x42,0x7,0xdc,0x1,0xdb,0xff,0xa2,0x42,0x4,0xd2,0x22,0x46,0x11,
+    0xe0,0xff,0x16,0x98,0xa,0xa9,0xbb,0xe7,0xbb,0x42,0xfd,0xb,0x13,0x4,0x8,0xd2,
+    0xe6,0x43,0xbb,0x42,0xff,0x6,0xdb,0x1,0xdc,0xb2,0x42,0x3,0xd3,0xff,0x2c,0xc,
+    0x4,0x40,0x0,0xd0,0x6a,0x8,0xff,0x1,0x98,0x2,0x60,0x2,0x98,0x40,0x1c,0xfd,
+    0x2,0x59,0x2,0x1d,0x1,0x90,0x2,0x98,0x3,0xff,0x28,0xcc,0xdb,0x17,0xb0,0xf0,
+    0xbd,0x0,0xff,0x0,0x18,0x2d,0x44,0x54,0xfb,0x21,0x9,0xff,0x40,0x0,0x80,0x66,
+    0x40,0x76,0x2,0x0,0xff,0x0,0x0,0x21,0x80,0x22,0xd2,0x5,0x3,0xff,0x1d,0x1a,
+    0x60,0x59,0x60,0x99,0x60,0xd9,0xff,0x60,0x1,0x21,0x1,0x70,0x70,0x47,0x38,0xff,
+    0xb5,0x4,0x0,0x8,0x0,0x1d,0x0,0x21,0xff,0x78,0x0,0x29,0x3,0xd1,0x11,0x1,
+    0x89,0xdb,0x1a,0x81,0x6b,0x0,0x0,0x20,0xf9,0x3,0x61,0x60,0xff,0xa0,0x60,0xe0,
+    0x60,0x20,0x61,0x20,0x70,0xff,0xe,0xe0,0xc1,0x17,0xb9,0x4a,0x0,0x23,0xff,0x4,
+    0xf0,0x5e,0xfb,0xc0,0xd,0x4a,0x2,0xff,0x10,0x43,0x3,0x0,0x2a,0x0,0x21,0x0,
+    0xff,0x14,0x31,0x20,0x1d,0x8,0xf0,0x7d,0xfe,0xff,0x14,0x34,0x7,0xcd,0x7,0xc4,
+    0x31,0xbd,0xfd,0xf8,0x4d,0x0,0xcb,0x4e,0x6,0x23,0x4,0x22,0xf7,0x31,0x0,0x0,
+    0x19,0x0,0xbe,0xfe,0x20,0x0,0xff,0x20,0x30,0x3,0x21,0x1,0x60,0x0,0x25,0xff,
+    0x45,0x60,0x20,0x0,0x68,0x30,0x1,0x60,0xff,0x45,0x60,0x27,0x0,0xb0,0x37,0x3d,
+    0x60,0xfd,0x3,0x25,0x4,0x20,0x0,0xb4,0x30,0x8,0xf0,0xeb,0xaa,0xfe,0xd,0xa,
+    0xc0,0xd,0x0,0xa3,0xfe,0xfd,0xdf,0x61,0x20,0x0,0xf2,0xbd,0xa1,0x2,0x0,0x21,
+    0xff,0x41,0x62,0xc1,0x66,0x70,0x47,0xf8,0xb5,0xff,0xa4,0xb0,0x4,0x0,0xe,0x0,
+    0x15,0x0,0xdf,0x2a,0x9a,0x2b,0x99,0x3,0x8d,0x1,0xa1,0xfe,0x57,0x3,0xa9,0x18,
+    0xbf,0x1,0x1d,0x7,0x0,0x15,0x7,0x0,0xff,0x19,0xfe,0x20,0x78,0x0,0x28,0x4,
+    0xd1,0xff,0x28,0x1,0x40,0x1b,0x40,0x0,0xb0,0x42,0xfb,0x2e,0xd2,0x5b,0x2,0x3,
+    0xa9,0x23,0x1d,0x3,0xff,0x25,0x22,0x0,0xcc,0x32,0xa6,0x4e,0xf,0xbf,0x68,0x1f,
+    0x60,0xf,0x68,0x5f,0x3,0x0,0x7,0xfe,0x3,0x0,0xc7,0x60,0x16,0x60,0x8,0x33,
+    0x9,0xff,0x1d,0x0,0x1d,0x6d,0x1e,0xf1,0xd1,0x0,0xff,0x26,0x26,0x70,0x25,0x0,
+    0xd0,0x35,0x3,0xff,0xa8,0xe,0xc8,0xe,0xc5,0xc,0x3d,0x28,0xff,0x0,0x4,0xf0,
+    0x24,0xfc,0x1,0x21,0x88,0xff,0x42,0x5,0xdb,0x29,0x0,0x3,0x22,0x8,0xff,0x0,
+    0x8,0xf0,0x95,0xfe,0x4,0xe0,0xff,0xff,0x20,0x0,0x6,0x2e,0x60,0x6e,0x60,0xa8,
+    0xff,0x60,0x3,0xad,0x27,0x1d,0x3,0x26,0x3a,0xff,0x0,0x29,0x0,0x24,0x98,0x8,
+    0xf0,0x6,0xf7,0xff,0x3a,0x1d,0x9,0x6,0x1,0xff,0x8,0x37,0xb7,0x2d,0x1d,0x76,
+    0x53,0x0,0x3,0xa9,0xfd,0x2,0x8,0xd7,0xf0,0x18,0xff,0x9,0x2,0x68,0x9,0x0,
+    0x13,0xff,0xff,0x60,0x6a,0x40,0x28,0xe,0xd2,0xe1,0x6e,0xdf,0x40,0x29,0x3,0xd3,
+    0x9,0x15,0x4,0xa,0xe0,0xff,0x20,0x28,0x5,0xd2,0xa0,0x20,0xc0,0x4,0xff,0x9,
+    0x90,0xa,0x90,0xb,0x90,0x4,0xe0,0x74,0x17,0x2,0x37,0x2,0x76,0x2d,0x4,0x12,
+    0xd1,0x6,0x3d,0x8,0xff,0x6e,0xff,0x8,0x98,0x7,0x99,0x88,0x42,0x9f,0x0,0xda,
+    0x8,0x0,0x6,0x7,0x8,0xe9,0x0,0x21,0xff,0x60,0x50,0xe6,0x66,0x14,0xe0,0xe0,
+    0x6e,0xa7,0x40,0x28,0x11,0x2b,0x4,0x3b,0x2,0x58,0x2b,0x2c,0x66,0xaf,0x62,0xb,
+    0x98,0xa,0x11,0x8,0x9,0x7,0x8,0x0,0xff,0x28,0xc,0xd0,0xc0,0x21,0x9,0x6,
+    0x88,0xef,0x42,0x2,0xda,0x80,0xe1,0x0,0x5,0xe0,0x49,0xff,0x42,0x88,0x42,0x1,
+    0xdb,0x5a,0x48,0x0,0xff,0xe0,0x40,0x0,0x2d,0x99,0x8,0x60,0x3,0xff,0x98,0x11,
+    0x90,0x4,0x98,0x10,0x90,0x5,0xff,0x98,0x2,0x90,0x1,0x96,0x2,0xa8,0x0,0xff,
+    0x90,0x10,0xab,0x11,0xaa,0x1,0xa9,0x1f,0xfe,0x79,0x1,0x91,0xfd,0x2b,0x99,0xc,
+    0xa8,0x3,0xff,0xf0,0xfa,0xfe,0x1b,0xa8,0xc,0xa9,0x10,0xff,0x22,0x3,0xf0,0xaf,
+    0xfe,0x80,0x20,0x40,0xff,0x4,0xc,0x90,0xd,0x96,0xe,0x96,0xf,0xbf,0x96,0x1f,
+    0xaa,0x1b,0xa9,0xc,0x27,0x0,0x89,0xef,0xfd,0x2b,0x9a,0xc,0x9,0x4,0x6e,0xfe,
+    0xd,0xff,0x98,0x12,0x90,0xe,0x98,0x13,0x90,0xf,0xff,0x98,0x14,0x90,0x2c,0x98,
+    0x12,0xa9,0x2c,0x77,0xc9,0x2c,0xc0,0xaf,0x3,0x1,0x90,0x18,0x5b,0x0,0xff,0x15,
+    0xaf,0xc,0xad,0x3,0x20,0x2,0x90,0xff,0x3b,0x48,0x1,0x9a,0x0,0x99,0x8,0xf0,
+    0x77,0x57,0xfe,0x3a,0x9,0x0,0xc,0x32,0x39,0x85,0x1,0xff,0x51,0xfe,0x0,0x98,
+    0x0,0x68,0x39,0x68,0xff,0x40,0x1a,0x28,0x60,0x1,0xd5,0x1,0x46,0xff,0x48,0x42,
+    0x28,0x60,0x2d,0x1d,0x3f,0x1d,0xde,0x15,0x0,0x1d,0x0,0x90,0x1,0x5,0x0,0x1,
+    0x90,0xff,0x2,0x98,0x40,0x1e,0x2,0x90,0xdf,0xd1,0x57,0xe,0x98,0xd,0xe1,0x8,
+    0xc,0x7,0x8,0x2e,0xcb,0x0,0xff,0x22,0x0,0xcc,0x32,0xb0,0x34,0xe3,0x69,0xff,
+    0x98,0x42,0x3,0xda,0x25,0x48,0x8,0xf0,0xff,0x28,0xfe,0x0,0xe0,0x10,0x60,0x25,
+    0xb0,0xf7,0xf0,0xbd,0x0,0x0,0x0,0x83,0xde,0x1b,0x43,0xff,0x30,0xb5,0x89,0xb0,
+    0x4,0x0,0x10,0x0,0xff,0xa,0x0,0x1,0x0,0x5,0xa8,0x8,0xf0,0xdf,0x6b,0xfd,
+    0x2,0xa8,0x5,0xa3,0x4,0x3,0x22,0xf7,0x2,0xa9,0x2,0x11,0x0,0x8f,0xfd,0x2,
+    0xaa,0xff,0xd0,0x34,0x21,0x0,0x68,0x46,0x8,0xf0,0xff,0xb5,0xfe,0x68,0x46,0x3,
+    0xc8,0x80,0xc,0xff,0x8a,0x3,0x10,0x43,0x80,0x21,0xc9,0x5,0xf7,0xc0,0x22,0x12,
+    0x49,0x1,0xe,0xda,0xf,0x49,0xff,0x88,0x42,0xd,0xdb,0x1e,0x21,0x8,0xf0,0xff,
+    0xc7,0xf8,0x8,0xf0,0xbb,0xfe,0x0,0x23,0xf7,0x0,0x22,0x1c,0xd,0x0,0x88,0xf8,
+    0x9,0xb0,0xff,0x30,0xbd,0x8,0x0,0xf1,0xe7,0x10,0x0,0xff,0xef,0xe7,0xd7,0xbc,
+    0x0,0x0,0x29,0x5c,0xff,0xf,0x0,0xff,0xff,0xff,0x7f,0x7f,0x6a,0xff,0xbc,0xc4,
+    0x37,0x89,0x41,0xc0,0xb4,0xc8,0xff,0x76,0xc2,0x1,0x0,0x0,0xc0,0x10,0xb5,0xf9,
+    0x84,0x87,0xc,0x69,0x2,0x27,0xfd,0x68,0x46,0x4,0xff,0xf0,0xd8,0xfa,0x1,0x0,
+    0x1,0x22,0xd0,0xff,0x34,0x20,0x0,0x91,0x42,0x6,0xda,0xff,0xfe,0xb7,0x1,0x0,
+    0x22,0x2,0x60,0x42,0x60,0x81,0xff,0x60,0x7,0xe0,0x69,0x46,0x1c,0xc9,0x1c,0xbf,
+    0xc0,0xc,0x38,0x3,0x22,0x1,0x2b,0x1,0x3c,0xff,0xfd,0x4,0xb0,0x10,0xbd,0x0,
+    0x21,0x81,0xff,0x61,0xc1,0x61,0x1,0x62,0x70,0x47,0xf8,0xff,0xb5,0x2,0x0,0xe,
+    0x0,0xf7,0x17,0xd3,0xff,0x17,0x19,0x0,0x4,0xf0,0x78,0xf9,0x4,0xff,0x0,0xd,
+    0x0,0x30,0x0,0x39,0x0,0x32,0xfb,0x0,0x3b,0xf,0x0,0x70,0xf9,0xb,0x0,0x2,
+    0xff,0x19,0x6b,0x41,0x12,0xf,0x18,0x1,0x2,0xff,0x43,0x11,0x0,0x0,0x20,0x0,
+    0x90,0x2,0xfd,0x22,0x77,0x2,0xb3,0xfe,0xc0,0x48,0x0,0x99,0xfd,0x81,0x41,0x5,
+    0xf2,0xbd,0x70,0xb5,0x4,0x0,0xff,0x0,0x25,0x25,0x60,0x65,0x60,0xdc,0x20,0xff,
+    0x40,0x0,0x20,0x18,0x5,0x60,0x45,0x60,0xdd,0xe2,0x9,0x0,0x26,0x18,0x30,0x73,
+    0x0,0xc1,0xfe,0x9f,0xb5,0x64,0x84,0x20,0x80,0x17,0x0,0xf3,0x2,0x96,0x4e,0x9,
+    0x4,0x3,0x21,0x1,0x23,0x0,0x1b,0x3,0xa8,0xf,0x4,0xbe,0xd,0x2,0x85,0x60,
+    0xc5,0x60,0xac,0xd,0x14,0xb3,0xfe,0xd,0x0,0x25,0x50,0x20,0x0,0x70,0xbd,0x7d,
+    0xfe,0x7f,0x1,0xc,0x0,0x0,0xf0,0x6f,0xf9,0x9,0xff,0x98,0xe2,0x21,0x49,0x0,
+    0x40,0x18,0x9,0xff,0x99,0x84,0x22,0x92,0x0,0x89,0x18,0x48,0xff,0x22,0x3,0xf0,
+    0x80,0xfd,0x9,0x98,0xfe,0xde,0x15,0x2,0x58,0x9,0x99,0x83,0x15,0x0,0x88,0x50,
+    0xff,0x1,0x20,0x9,0x99,0x8,0x72,0x9,0x99,0xff,0x48,0x72,0x9,0x98,0xc,0x30,
+    0x3,0xf0,0xff,0x54,0xfd,0x0,0x21,0x9,0x9a,0xf0,0x32,0xff,0x0,0x26,0x13,0x0,
+    0x3,0x25,0x1e,0x60,0xff,0x1b,0x1d,0x6d,0x1e,0xfb,0xd1,0x49,0x1c,0xbf,0xc,0x32,
+    0x6,0x29,0xf5,0xdb,0x1b,0x2,0x9c,0xdf,0x23,0x5b,0x0,0xd2,0x18,0x1d,0x22,0x9,
+    0x98,0xfd,0xc0,0x71,0x4,0x0,0x90,0x1,0x20,0x0,0x99,0x7f,0x8,0x70,0x0,0x99,
+    0x4e,0x70,0xb4,0x6b,0x1,0x7f,0x3,0xf0,0xb9,0xfa,0x9,0x99,0xb3,0x85,0x4,0xff,
+    0x1,0x91,0x6,0x91,0xc1,0x17,0x3,0x22,0xff,0x0,0x23,0x4,0xf0,0xd5,0xf8,0x4,
+    0xaa,0xff,0x3,0xc2,0x4,0xa8,0x3,0xc8,0x40,0xa,0x7f,0xca,0x5,0x10,0x43,0x49,
+    0x12,0x80,0xff,0x1,0xff,0x0,0x23,0xdb,0x43,0x99,0x42,0x4,0xdc,0xff,0x1,0xdb,
+    0x90,0x42,0x1,0xd2,0x10,0x46,0xdf,0x36,0xe0,0xa9,0x42,0xd,0xd,0x4,0xa,0xd2,
+    0xff,0xd4,0x43,0xa9,0x42,0x9,0xdb,0x1,0xdc,0xff,0xa0,0x42,0x6,0xd3,0x4,0xaa,
+    0xc,0xca,0xff,0xa4,0xd,0x14,0x40,0x1,0xd0,0xa2,0x48,0xff,0x24,0xe0,0x2,0x0,
+    0xb,0x0,0x4,0xac,0xff,0x30,0xcc,0x80,0x26,0x76,0x0,0x26,0x40,0xff,0x2,0xd0,
+    0x0,0x24,0x52,0x1c,0x63,0x41,0xdf,0x2,0xac,0xc,0xc4,0x2,0x27,0x0,0x0,0x2b,
+    0xbf,0x1,0xd1,0x0,0x2a,0xf,0xd0,0x7,0x0,0xdb,0x3f,0x1,0x24,0x0,0xe0,0x0,
+    0x24,0x3d,0x2,0xd,0x4,0xfd,0x22,0xd,0x0,0x22,0x94,0x42,0x1,0xd0,0x2,0xfa,
+    0x8b,0x0,0x2,0x8b,0x0,0x6,0x99,0x8,0x60,0x1,0xdb,0x99,0x8,0xbb,0x1,0x0,
+    0xfe,0xc7,0x1,0x99,0x8,0xff,0x62,0x8b,0x48,0x9,0x99,0xd2,0x22,0x52,0xfe,0xbd,
+    0x0,0x5,0x22,0x8,0x60,0x9,0x1d,0x52,0xfc,0xf3,0x0,0x19,0x4,0x64,0x9,0x98,
+    0xb0,0x21,0x89,0xfe,0xf1,0x2,0x21,0x41,0x60,0x1,0x72,0x9,0x9a,0xff,0x11,0x60,
+    0x1,0x60,0x80,0x20,0xc0,0x5,0xff,0x9,0x9c,0xa8,0x25,0xad,0x0,0x60,0x51,0xff,
+    0x9,0x9c,0x2d,0x1d,0x61,0x51,0x9,0x9b,0xff,0xaa,0x24,0xa4,0x0,0x19,0x51,0x9,
+    0x9a,0xff,0xab,0x23,0x9b,0x0,0xd1,0x50,0x9,0x9c,0x5b,0xc,0x35,0x1b,0x0,0x98,
+    0xad,0x15,0x0,0x1,0x7,0x0,0x7d,0xae,0x15,0x0,0xc1,0x50,0x9,0x98,0xaf,0x21,
+    0x1,0xff,0x81,0x50,0xa,0x98,0x0,0x28,0x7,0xd0,0xff,0x80,0x6b,0x6f,0x49,0x88,
+    0x42,0x3,0xda,0xff,0xa,0x99,0x9,0x98,0x0,0xf0,0x2,0xf8,0xff,0xc,0xb0,0x70,
+    0xbd,0xf0,0xb5,0x8d,0xb0,0xfb,0x5,0x0,0xdd,0x1,0x20,0x28,0x72,0x3,0xa8,0xff,
+    0xc,0x31,0x3,0x22,0x3,0x23,0xf,0x68,0xfd,0x7,0x91,0x0,0x0,0x1d,0x5b,0x1e,
+    0xf9,0xd1,0xff,0x52,0x1e,0xf6,0xd1,0x68,0x46,0x21,0x0,0x5f,0x3,0x22,0xb,0x68,
+    0x3,0x15,0x4,0x52,0x15,0x0,0xff,0x6a,0x46,0x3,0xa9,0x28,0x0,0x0,0xf0,0xff,
+    0x46,0xff,0xe2,0x20,0x40,0x0,0x28,0x18,0xeb,0x3,0xa9,0x37,0x22,0xf4,0x1b,0x4,
+    0x69,0x46,0x4c,0xff,0xc9,0x4c,0xc0,0x21,0x0,0x30,0x31,0xfa,0xfe,0xf,0x4,0x9,
+    0x68,0x1,0x60,0x60,0x6b,0xfc,0xee,0xd5,0x1,0x68,0x50,0xe0,0x11,0x4,0xa1,0x6b,
+    0x49,0xfb,0x4a,0x91,0x97,0x0,0x1,0x21,0x1,0x60,0x47,0xfd,0x49,0x3b,0x1,0x21,
+    0x81,0x64,0xa0,0x6b,0xfe,0xde,0x21,0x4,0xa0,0x6b,0x9,0x1d,0x5,0xe,0x8,0x31,
+    0xff,0x68,0x50,0xd,0xb0,0xf0,0xbd,0x0,0x0,0xff,0xa9,0xf6,0x43,0x32,0xf0,0xb4,
+    0xb,0x0,0xfd,0xf4,0x43,0x1,0x84,0x18,0x3,0x25,0x26,0x68,0x7f,0x1e,0x60,0x24,
+    0x1d,0x1b,0x1d,0x6d,0x7b,0x0,0xff,0xb,0x0,0xc,0x33,0xe2,0x24,0x64,0x0,0xff,
+    0x4,0x19,0x3,0x25,0x3,0x26,0x27,0x68,0xd5,0x1f,0x19,0x4,0x76,0x19,0x0,0x6d,
+    0x95,0x0,0xc,0x32,0xdf,0x82,0x58,0xa,0x63,0xfe,0x37,0x0,0x82,0x58,0xf7,0x8a,
+    0x63,0xfc,0x7,0x0,0x80,0x58,0x48,0x63,0xff,0xf0,0xbc,0x70,0x47,0xf8,0xb5,0x4,
+    0x0,0xff,0x8d,0x20,0x80,0x0,0x20,0x18,0x3,0xf0,0xf7,0xfa,0xfb,0x84,0x9,0x4,
+    0x0,0x25,0x0,0x22,0xff,0x3,0x0,0x3,0x21,0x1e,0x0,0x3,0x27,0xdf,0x35,0x60,
+    0x36,0x1d,0x7f,0xa7,0x1,0x52,0x1c,0xff,0xc,0x33,0x3,0x2a,0xf5,0xdb,0x80,0x22,
+    0x7f,0x12,0x5,0x2,0x60,0x10,0x30,0x49,0x13,0x0,0x7d,0x90,0x2d,0x0,0x22,0x50,
+    0x19,0x48,0x92,0xbb,0x1,0xff,0x60,0x50,0x9,0x1d,0x60,0x50,0x41,0x8,0xdd,0x91,
+    0x7b,0x1,0xa1,0x50,0x94,0x11,0x8,0x65,0x50,0xdd,0x20,0x31,0x1,0x23,0xf8,0xc0,
+    0xf3,0x0,0x26,0x18,0xff,0x1,0x27,0x37,0x70,0x18,0x21,0x0,0x1d,0xfe,0x6b,0x2,
+    0xbb,0xfb,0xf5,0x61,0x35,0x62,0x7,0xfb,0x48,0xd2,0xf1,0x0,0x61,0x18,0x5,0x22,
+    0x8,0xfa,0x45,0x1,0x52,0x53,0x0,0x35,0x64,0x27,0x72,0xf1,0xfe,0xeb,0x0,0xff,
+    0xff,0xff,0x7f,0xf6,0x28,0x5c,0xff,0x7f,0x54,0xfb,0x21,0x19,0xff,0xeb,0x2f,0xfd,
+    0x2d,0xfb,0x2,0x1,0x0,0x18,0x31,0x2d,0x22,0xf7,0x0,0x23,0xb,0x2b,0x8,0xcc,
+    0x30,0x9,0x21,0xef,0x3,0x60,0x0,0x1d,0x8b,0x2,0x70,0x47,0x10,0xef,0xb5,0x84,
+    0xb0,0x4,0xd3,0x1,0x0,0x90,0x80,0xff,0x20,0x80,0x5,0x0,0x21,0x2,0xaa,0x3,
+    0xff,0xc2,0x22,0x0,0x2,0xa9,0x68,0x46,0x8,0xbf,0xf0,0xd4,0xfc,0x0,0x98,0xb0,
+    0x93,0x4,0x4,0xff,0xb0,0x10,0xbd,0xfa,0xb5,0x93,0xb0,0x6,0xff,0x0,0x17,0x0,
+    0x30,0x68,0x88,0x42,0x34,0xff,0xd0,0x31,0x60,0xac,0x4c,0x60,0x42,0x80,0xff,0x8,
+    0x40,0x18,0x0,0x90,0x30,0x1d,0x1,0xff,0x90,0xe5,0x17,0x2d,0x7,0x20,0x9,0x5,
+    0xff,0x43,0x24,0x7,0x0,0x98,0x0,0x28,0x1,0xff,0xd1,0xa6,0x48,0x19,0xe0,0xe8,
+    0x17,0xe9,0xfd,0x17,0x4f,0x2,0x0,0x98,0xc0,0x17,0x0,0x99,0xff,0x41,0x40,0xa,
+    0x1a,0x94,0x46,0x2,0xa8,0xff,0x3,0xc8,0x60,0x40,0x69,0x40,0x2,0xaa,0xff,0xc,
+    0xca,0x80,0x1a,0x62,0x46,0x4,0xf0,0xf7,0x43,0xfc,0xec,0x1d,0x0,0xc9,0x17,0x61,
+    0x40,0xff,0x48,0x40,0x40,0x1a,0x1,0x99,0x8,0x60,0xfb,0x0,0x20,0x75,0x2,0x70,
+    0x50,0x30,0x0,0xff,0xff,0xf7,0x4a,0xff,0x0,0x20,0x13,0x99,0x88,0xff,0x42,0x0,
+    0xdb,0x3c,0xe2,0xff,0x20,0x82,0xff,0x30,0x35,0x18,0x1f,0x9c,0x28,0x78,0x84,0xf7,
+    0x42,0x3,0xd0,0x1d,0x2,0x3b,0xff,0x2c,0x70,0xdf,0x0,0x21,0x1b,0x98,0x0,0x93,
+    0x0,0x8,0xd1,0x7f,0x1b,0x9a,0x52,0x68,0x8a,0x42,0x4,0x7,0x0,0xfd,0x92,0x7,
+    0x0,0x0,0xd1,0x1d,0xe2,0x84,0x49,0xff,0x88,0x42,0x5e,0xda,0xa,0x46,0x1b,0x99,
+    0xff,0x49,0x68,0x91,0x42,0x59,0xda,0x13,0x46,0xfe,0x1b,0x2,0x9a,0x42,0x54,0xda,
+    0x80,0x23,0x1b,0xff,0x6,0x83,0x42,0x50,0xda,0x8b,0x42,0x4e,0xbf,0xda,0x93,0x42,
+    0x4c,0xda,0xb0,0x95,0x1,0x30,0xff,0x58,0x0,0x28,0x57,0xd1,0x3f,0x6,0x0,0xff,
+    0xd1,0xdd,0xe1,0x69,0x46,0x8,0x74,0x1d,0xff,0x9c,0x20,0x0,0x8,0xf0,0x83,0xfc,
+    0x0,0xfd,0x21,0x7f,0x0,0xd1,0xb1,0xe0,0x21,0x0,0xac,0xfe,0x25,0x2,0x18,0x8,
+    0xf0,0x98,0xfc,0x0,0x90,0xf7,0x21,0x0,0xa8,0xd,0x8,0x91,0xfc,0x5,0x0,0xf7,
+    0x0,0x98,0xc4,0x6b,0x0,0x3d,0xda,0x48,0x8,0xef,0x85,0x42,0xb,0xdb,0x19,0x6,
+    0x21,0x0,0x10,0xff,0x22,0x3,0xf0,0x5,0xfb,0x0,0x20,0x82,0xfe,0xcf,0x0,0x71,
+    0x18,0x48,0x65,0x1b,0x99,0x96,0xf6,0x33,0x8,0xbe,0xfc,0x9,0x6,0x0,0x90,0x40,
+    0x68,0xff,0x2,0x28,0x41,0xd2,0x0,0x20,0x7,0xa9,0xdd,0x3,0xcf,0xd,0x8,0x98,
+    0x7,0xf3,0x0,0x72,0xda,0x6f,0x8,0x0,0x70,0xe0,0xe7,0x2,0xc7,0xfe,0x5,0x2,
+    0xff,0x29,0xff,0xe,0xa8,0x3,0xf0,0xc2,0xfa,0xff,0x20,0x9b,0x1e,0x9a,0xe,0xa9,
+    0x30,0x0,0xff,0x0,0xf0,0xae,0xfd,0xb1,0xe1,0x40,0x1e,0x66,0x2d,0x7,0xa6,0xe1,
+    0x9d,0x6,0x75,0x6,0xca,0xfa,0x83,0x12,0xef,0xc3,0xfa,0x1,0x20,0xd1,0x2,0x9c,
+    0x48,0x85,0xef,0x42,0xbc,0xdb,0x82,0x19,0x4,0x40,0x6d,0x2,0xf3,0x28,0xbc,0x77,
+    0x0,0x9b,0xa,0xb0,0xe7,0x0,0x20,0xff,0x1,0x90,0x7,0xa8,0x5,0x90,0x0,0x98,
+    0xdf,0x18,0x30,0x6,0x90,0x21,0xbf,0x7,0xab,0x3,0x7f,0xc3,0xd7,0x17,0x7a,0x40,
+    0xd2,0x1b,0xbb,0x1b,0xfb,0x99,0x41,0xbd,0x3,0x5f,0xfb,0xec,0x17,0x67,0xbf,0x40,
+    0x78,0x40,0xc0,0x1b,0x5,0xb9,0x1,0x1,0xff,0x98,0x40,0x1c,0x1,0x90,0x6,0x98,
+    0x8,0xfe,0x3f,0x0,0x5,0x98,0x0,0x1d,0x5,0x90,0x1,0xef,0x98,0x0,0x99,0x9,
+    0x9d,0x1,0x95,0xd2,0x0,0xff,0x98,0x42,0x68,0x52,0x1e,0x6,0x98,0x30,0xff,0xc8,
+    0x64,0xe,0xe8,0x1,0x4,0x43,0x6d,0xff,0x16,0x0,0x2a,0xcd,0xd1,0x1c,0x48,0xe2,
+    0xef,0xe7,0x9,0x9c,0x84,0xdf,0x1,0x85,0xe0,0x4,0xef,0x0,0x83,0xe0,0xb3,0x15,
+    0x9,0x1a,0x98,0xc1,0xff,0x17,0x3,0x22,0x0,0x23,0x3,0xf0,0x1,0xbf,0xfe,0xc,
+    0xaa,0x3,0xc2,0xc,0x7b,0x0,0xc0,0xff,0x8,0x4a,0x7,0x10,0x43,0xc9,0x10,0x9d,
+    0xff,0xa2,0xc,0xca,0x99,0x42,0x4,0xdc,0x1,0xff,0xdb,0x90,0x42,0x1,0xd2,0x10,
+    0x46,0x3e,0xbf,0xe0,0x0,0x25,0xa9,0x42,0xd,0xf,0x4,0xa,0xff,0xd2,0xd4,0x43,
+    0xa9,0x42,0xe,0xdb,0x1,0xbf,0xdc,0xa0,0x42,0xb,0xd3,0xc,0xa9,0x0,0x7,0xff,
+    0x24,0x14,0x40,0x6,0xd0,0x2,0x48,0x2b,0xff,0xe0,0x0,0xbf,0xcd,0xcc,0xcc,0xcc,
+    0xff,0x4f,0xff,0xff,0x7f,0x2,0x51,0x2,0x1b,0x0,0x4,0x1b,0x6,0xfe,0x9,0x0,
+    0x0,0x24,0x52,0x1c,0x63,0x41,0x2,0x57,0xac,0xc,0xc4,0xd,0x2,0xa,0x7,0x0,
+    0xa,0x15,0x2,0xff,0x2b,0x1,0xd1,0x0,0x2a,0xc,0xd0,0x1,0x7f,0x24,0x0,0x2b,
+    0x0,0xdb,0x1,0x25,0x33,0x2,0xfe,0x9,0x0,0xda,0x0,0x24,0xa5,0x42,0x1,0xd0,
+    0x95,0xa,0x45,0x0,0xa,0x97,0x0,0x0,0xf9,0x0,0xb7,0x2,0x31,0xed,0x18,0xd9,
+    0x3,0x24,0xfb,0xb,0x2,0x37,0x58,0x74,0xff,0x38,0x35,0x18,0x7,0xaa,0x1b,0x99,
+    0x28,0x5f,0x0,0x8,0xf0,0x55,0xfc,0xd1,0x7,0x0,0xd1,0x1,0xfe,0xed,0x4,0xda,
+    0x4,0x0,0xbc,0x42,0x3,0xda,0xfe,0x1d,0x6,0xb8,0xfb,0xbc,0x42,0x1,0xda,0x1,
+    0xf7,0x20,0x0,0xe0,0x81,0x1,0x21,0x41,0x40,0x68,0xf7,0x46,0x1,0x74,0xa3,0xb,
+    0xff,0x28,0x2,0xd9,0x7e,0xbb,0x7,0xbb,0x48,0x84,0x42,0x1f,0xdb,0x5,0x2,0xff,
+    0x15,0xdb,0x30,0x0,0xff,0xf7,0xbd,0xfd,0xf6,0x5,0x2,0x1f,0xfe,0x29,0x2,0x31,
+    0x58,0xb6,0x48,0xff,0x8,0xf0,0xc4,0xfc,0x40,0x0,0x40,0x8,0xff,0xb4,0x49,0x8,
+    0xf0,0x4f,0xfd,0x3,0xd2,0x9b,0xb3,0x48,0xd9,0x3,0x70,0x50,0xe1,0xf,0x45,0x2,
+    0xb0,0xde,0x57,0x6,0x68,0x40,0x1c,0xb0,0x15,0x6,0x60,0x68,0xff,0x46,0x0,0x7c,
+    0x0,0x28,0x64,0xd0,0x70,0xff,0x7a,0x0,0x28,0x5,0xd0,0x1b,0x99,0x30,0xff,0x0,
+    0x0,0xf0,0xbc,0xfc,0x0,0x20,0x70,0xfb,0x72,0x98,0xd3,0x4,0xe,0xa8,0x4,0xf0,
+    0x5c,0xf7,0xfa,0x1,0x0,0x47,0x0,0x22,0x92,0x0,0xb2,0xdf,0x18,0x50,0x65,0x1e,
+    0x9a,0x23,0x2,0x8f,0xf9,0xff,0x0,0x20,0xe,0xa9,0x32,0x0,0xc,0x32,0xff,0xb,
+    0x68,0x14,0x68,0x1d,0x1b,0xd,0x60,0xff,0xb,0xd4,0x0,0x2b,0xf,0xd5,0x0,0x2c,
+    0x7f,0xd,0xd4,0x80,0x23,0x1b,0x6,0x9,0x6f,0x1,0xff,0x86,0x71,0x65,0x1,0xc3,
+    0xb8,0xb2,0x0,0xff,0x0,0x2b,0x3,0xd4,0x0,0x2c,0x1,0xd5,0xff,0x8f,0x4b,0xb,
+    0x60,0x40,0x1c,0x12,0x1d,0xff,0x9,0x1d,0x3,0x28,0xe3,0xdb,0xe,0xa9,0xde,0x47,
+    0x2,0xcb,0xfe,0x1,0x20,0x8b,0x6,0x8,0x72,0xff,0x0,0x23,0x0,0x22,0x0,0x21,
+    0xc8,0x20,0x7f,0x30,0x58,0x7,0xf0,0xd1,0xfb,0x4,0x73,0x0,0xfb,0x0,0x90,0x9,
+    0x5,0x58,0x0,0x21,0x8,0xf0,0xff,0xf8,0xfc,0x2,0xd1,0x80,0x20,0xc0,0x5,0xbf,
+    0x1,0xe0,0x80,0x20,0x0,0x6,0xc3,0x3,0x32,0xff,0x0,0x2,0xa9,0x68,0x46,0x8,
+    0xf0,0x7f,0x7f,0xfa,0x0,0x98,0xa0,0x42,0x2,0xda,0x11,0x3,0xff,0x31,0xfd,0x14,
+    0xa8,0x0,0x78,0x0,0x28,0xab,0x1e,0xd0,0xeb,0x6,0x0,0xd7,0x0,0x18,0xb,0x8,
+    0x40,0xbf,0x68,0x0,0x28,0x12,0xd0,0x0,0x6f,0x8,0x48,0xf9,0x60,0x77,0xa,0x87,
+    0x2,0x5,0xfd,0x0,0x28,0x4,0xf7,0xd0,0x1e,0x9a,0x1,0x7,0xc,0xf8,0x20,0x9b,
+    0xfe,0xb,0xa,0xfb,0xfb,0x15,0xb0,0xf0,0xbd,0x0,0xef,0x0,0x0,0x80,0xff,0x0,
+    0x0,0xf7,0xb5,0x9a,0xff,0xb0,0x8,0xac,0x5,0x46,0xf0,0x35,0x6,0xff,0x26,0x22,
+    0x0,0x29,0x0,0x1a,0x98,0x0,0xff,0xf0,0xb5,0xf8,0xc,0x35,0xc,0x34,0x76,0xff,
+    0x1e,0xf6,0xd1,0x8,0x98,0x44,0x10,0x11,0xff,0x98,0x40,0x10,0x24,0x1a,0xc,0x98,
+    0x46,0xfb,0x10,0x15,0x9,0x0,0x36,0x1a,0x10,0x98,0x45,0xfb,0x10,0x19,0x9,0x0,
+    0x2d,0x1a,0xe0,0x17,0x44,0xff,0x40,0x24,0x1a,0xf0,0x17,0x46,0x40,0x36,0xff,0x1a,
+    0xe8,0x17,0x45,0x40,0x2d,0x1a,0x29,0xff,0x0,0xb1,0x42,0x0,0xda,0x31,0x0,0xa1,
+    0xff,0x42,0x1,0xda,0x1,0x94,0x0,0xe0,0x1,0xef,0x91,0x2a,0x0,0x96,0x11,0x0,
+    0x32,0x0,0x94,0xfa,0x5,0x0,0x22,0x5d,0x0,0xd0,0x21,0x49,0x0,0x40,0xf7,0x18,
+    0x0,0x90,0xb,0x1,0x99,0xc8,0x61,0x1,0xff,0x98,0xb2,0x49,0x88,0x42,0x30,0xdb,
+    0x1a,0xfb,0x98,0xde,0x17,0x4,0x6,0x90,0x2,0xab,0x10,0xff,0x0,0xd1,0x17,0x49,
+    0x1,0xc2,0xe,0x11,0xff,0x43,0x40,0x1,0x3,0xc3,0x2,0xa8,0x3,0xbf,0xc8,0xc8,
+    0x17,0xc9,0x17,0x4,0x1f,0x1,0x1,0xff,0x98,0xc7,0x17,0x78,0x40,0xc2,0x1b,0x94,
+    0xff,0x46,0x2,0xa8,0xc,0xc8,0x3,0xc8,0x50,0xff,0x40,0x59,0x40,0x2,0x0,0xb,
+    0x0,0x4,0xfe,0x23,0x0,0x12,0x1a,0x8b,0x41,0x10,0x0,0x19,0xff,0x0,0x62,0x46,
+    0x4,0xf0,0x81,0xf9,0x2,0xfd,0x0,0x37,0x6,0x47,0x40,0x7a,0x40,0xd0,0x1b,0xff,
+    0x6,0x99,0x8,0x60,0x60,0x15,0xc1,0x17,0xff,0x32,0x0,0xf3,0x17,0x3,0xf0,0x40,
+    0xfc,0xff,0x80,0xe,0x8a,0x1,0x10,0x43,0xc1,0x17,0xd7,0x2a,0x0,0xeb,0xf,0x0,
+    0x38,0xf,0x8,0x0,0x99,0x67,0x88,0x61,0x1c,0x23,0x1,0x1,0x3,0x7c,0xf9,0x5,
+    0x0,0xaf,0x99,0x9,0x68,0x89,0x93,0x0,0xd2,0x99,0x4,0x1a,0xff,0x99,0x92,0x22,
+    0x92,0x0,0x89,0x58,0x0,0xff,0x29,0xc,0xd0,0xe0,0x22,0x12,0x6,0x91,0xfe,0x9f,
+    0x1,0x80,0x21,0x9,0x6,0x5,0xe0,0x52,0xff,0x42,0x91,0x42,0x1,0xdb,0xc,0x49,
+    0x0,0xff,0xe0,0x89,0x0,0x1,0x60,0x0,0x98,0x0,0xdf,0x68,0x4,0x28,0x1,0xdb,
+    0xdf,0x0,0xe0,0x40,0xeb,0x1c,0x0,0x79,0x0,0x1d,0x6d,0x5,0xc4,0xf5,0x0,0xff,
+    0x0,0x9b,0x99,0x9,0x0,0x0,0x50,0xc3,0xff,0xc7,0x0,0x0,0xc8,0x42,0xff,0xeb,
+    0x2f,0xfd,0x2d,0x7e,0x1,0x7f,0xf2,0xb5,0x86,0xb0,0x4,0xff,0x0,0x16,0x0,0x22,
+    0x0,0xc,0x32,0x84,0xfe,0xd5,0x1,0x21,0x18,0x3,0xa8,0x8,0xf0,0xfa,0xbf,0xfb,
+    0x0,0x25,0x0,0x20,0x8d,0xcf,0x1,0x61,0xff,0x18,0x3,0xaa,0x13,0x68,0xf,0x68,
+    0x7f,0xff,0x11,0xdb,0x19,0x13,0x60,0x40,0x1c,0x12,0xff,0x1d,0x9,0x1d,0x3,0x28,
+    0xf5,0xdb,0x6,0xfd,0x9a,0x2d,0x6,0x68,0x46,0x8,0xf0,0xe3,0xfb,0xff,0x68,0x46,
+    0x3,0xa9,0x2,0x68,0xb,0x68,0xff,0xd2,0x1a,0x2,0x60,0x6d,0x1c,0x9,0x1d,0xff,
+    0x0,0x1d,0x3,0x2d,0xf6,0xdb,0x69,0x46,0x7f,0x30,0x0,0x8,0xf0,0xf8,0xfb,0x7,
+    0x81,0x0,0xf7,0x30,0xb5,0x83,0x67,0x0,0x15,0x0,0xa,0x0,0xf7,0xe2,0x20,0x40,
+    0x37,0x8,0xc7,0xfb,0x0,0x20,0xfd,0xf4,0xdd,0x0,0x61,0x18,0x6a,0x46,0x13,0x68,
+    0xbf,0xc,0x68,0x64,0x11,0x1b,0x1b,0x63,0x12,0x69,0xfb,0x46,0x28,0x3f,0x0,0xd8,
+    0xfb,0x3,0xb0,0x30,0xef,0xbd,0xf6,0xb5,0x87,0x3f,0x0,0x10,0x46,0x3,0x3f,0xf0,
+    0xdc,0xfc,0x0,0x25,0x85,0xdf,0x1,0xe1,0x2,0xf7,0x1,0x20,0xc0,0x3f,0x4,0x49,
+    0x78,0x1,0x42,0xdf,0x0,0xd0,0x7b,0xe0,0xc0,0x5b,0x0,0x20,0x5c,0xff,0x0,0x28,
+    0x14,0xd0,0x20,0x0,0xf0,0x30,0xff,0x6,0x21,0x7,0x9a,0xc8,0xca,0xc8,0xc0,0xff,
+    0xc,0x38,0x3,0x0,0x48,0x33,0x8,0x9a,0xff,0xc0,0xca,0xc0,0xc3,0x16,0x68,0x1e,
+    0x60,0xbf,0xc,0x30,0x49,0x1e,0xf1,0xd1,0x2b,0x2,0x25,0xff,0x54,0x47,0xe0,0x68,
+    0x46,0x32,0xa1,0x18,0xff,0x22,0x2,0xf0,0xd8,0xff,0x6e,0x46,0xc2,0xfe,0x13,0x0,
+    0x27,0x18,0x1,0xe0,0x3,0x2d,0xf,0xff,0xd2,0x30,0x68,0x80,0x0,0x69,0x0,0x49,
+    0xfd,0x19,0x3,0x3,0x9,0x18,0xf0,0x31,0x9,0x68,0xff,0xad,0x4a,0x89,0x18,0x7,
+    0x9a,0x10,0x58,0xbf,0x81,0x42,0x27,0xda,0xe,0xe0,0x1f,0x1e,0xa6,0x7e,0x1f,0x8,
+    0x88,0x42,0x17,0xda,0x38,0x68,0x85,0x0,0xdf,0xd1,0x0,0xbf,0x21,0xa0,0xa1,0x6,
+    0xc9,0x69,0xee,0xcb,0x1,0x58,0x38,0x60,0xa1,0x4,0x18,0xc0,0x69,0xff,0x40,0x1c,
+    0x6,0x21,0x3,0xf0,0x65,0xf9,0xfe,0xf,0x6,0xc1,0x61,0x6d,0x1c,0x3f,0x1d,0x36,
+    0xdf,0x1d,0x6,0x2d,0xc1,0xd3,0x83,0x2,0x20,0x18,0xff,0xf0,0x34,0x6,0x21,0x2,
+    0x68,0x1,0x2a,0xff,0x8,0xd1,0x7,0x9a,0x68,0xca,0x68,0xc4,0xff,0xc,0x3c,0x22,
+    0x0,0x48,0x32,0x8,0x9b,0xef,0xe0,0xcb,0xe0,0xc2,0x17,0x2,0x1,0xdb,0x52,0xff,
+    0x1e,0x2,0x60,0xc,0x34,0x0,0x1d,0x49,0xef,0x1e,0xea,0xd1,0x9,0xe3,0x5,0x67,
+    0x66,0x66,0x95,0x0,0x0,0x2,0x1,0x3,0x0,0x2,0x9,0x4,0xb,0xe,0x3,0xea,
+    0x7,0x8,0x4,0x3,0x0,0x5,0x13,0x10,0xf2,0xb5,0x82,0xfe,0x57,0x1,0x17,0x0,
+    0x0,0x26,0x1,0x96,0x1,0xff,0xaa,0x2,0x99,0x0,0xf0,0x84,0xfc,0x0,0xeb,0x96,
+    0xfc,0xa3,0x3,0x58,0xa3,0x3,0x35,0xfb,0x69,0xff,0x46,0x1,0xa8,0x8,0xf0,0x45,
+    0xfb,0x45,0xfb,0x10,0x80,0xf1,0x1,0x20,0x58,0xa8,0x42,0x0,0x7f,0xdb,0x5,0x0,
+    0xff,0x20,0x82,0x30,0x69,0x3,0xff,0x21,0xd0,0x38,0x0,0x3,0xf0,0x12,0xfc,0x7f,
+    0xb0,0x42,0x12,0xd0,0x2,0x99,0x38,0xaf,0x1,0xdf,0x5d,0xfb,0x0,0x1,0xfc,0xf3,
+    0x2,0x58,0x40,0xff,0x1a,0xc1,0x17,0x48,0x40,0x40,0x1a,0x81,0xf9,0x21,0x23,0x1,
+    0x15,0x1,0x3,0xda,0x8,0x0,0x1,0xff,0xe0,0x5e,0x48,0x3,0xe0,0x41,0x10,0x68,
+    0xbf,0x10,0xff,0xf7,0x3b,0xf9,0x83,0x19,0x0,0x60,0xef,0x50,0x2,0xe0,0x83,0x59,
+    0x0,0x25,0x50,0x3,0xde,0xc5,0x0,0xf7,0xb5,0xa0,0xb0,0x31,0x3,0x40,0x18,0xff,
+    0x0,0x90,0x0,0x78,0x0,0x28,0x0,0xd0,0xff,0x9c,0xe0,0x3,0xae,0xa,0xad,0x20,
+    0x9c,0xfe,0x11,0x1,0x27,0x2a,0x0,0x21,0x0,0x20,0x98,0x7f,0xff,0xf7,0xa4,0xfe,
+    0x0,0x98,0x40,0x1d,0x0,0xff,0x6,0xd0,0x29,0x0,0x20,0x0,0x48,0x30,0xf7,0x8,
+    0xf0,0x22,0x75,0x0,0x0,0xe0,0x48,0x48,0xfd,0x30,0x13,0x1,0xc,0x35,0x36,0x1d,
+    0x7f,0x1e,0x6f,0xe8,0xd1,0xa,0xac,0x33,0x3,0x21,0x99,0x31,0x2,0xff,0x8b,0xfe,
+    0x22,0x98,0x3,0xf0,0xbe,0xfb,0xff,0x0,0x21,0x88,0x42,0x6,0xd0,0x48,0x34,0x7f,
+    0x21,0x0,0x22,0x98,0x8,0xf0,0x7,0x35,0x4,0xef,0x3a,0x48,0x9,0x90,0x46,0x0,
+    0x21,0x3,0xac,0xff,0x7,0x26,0x7,0x25,0x22,0x68,0xd3,0x17,0xff,0x12,0x18,0x4b,
+    0x41,0x10,0x0,0x19,0x0,0xff,0x24,0x1d,0x6d,0x1e,0xf6,0xd1,0xcc,0x17,0xff,0xcd,
+    0x17,0x7,0x22,0x60,0x40,0x69,0x40,0xff,0x2b,0x0,0x0,0x1b,0x99,0x41,0x3,0xf0,
+    0xff,0x90,0xff,0x60,0x40,0x0,0x1b,0x20,0x99,0xff,0x91,0x22,0x92,0x0,0x8f,0x18,
+    0x38,0x60,0xff,0x0,0x24,0xa,0xad,0x0,0x20,0x2,0x90,0xfb,0x2,0xaa,0x8f,0x0,
+    0x98,0x0,0xf0,0xe2,0xfb,0xbf,0x0,0x20,0x1,0x90,0x39,0x68,0x39,0x3,0x94,0xef,
+    0xfa,0x1,0xa9,0x2,0x7,0x0,0xa4,0xfa,0x40,0xfb,0x10,0xa0,0x3b,0x1,0x4,0x0,
+    0xc,0x35,0x76,0xbf,0x1e,0xe7,0xd1,0x20,0x98,0x93,0xfd,0x0,0x44,0xfd,0x50,0xc9,
+    0x6,0x20,0xd0,0x3,0x99,0x38,0x68,0xff,0x9,0x1a,0xca,0x17,0x51,0x40,0x8a,0x1a,
+    0xff,0x3,0xa9,0x9,0x1d,0x6,0x23,0xd,0x68,0xff,0x2d,0x1a,0xee,0x17,0x75,0x40,
+    0xad,0x1b,0xff,0xaa,0x42,0x0,0xda,0x2a,0x0,0x9,0x1d,0xd7,0x5b,0x1e,0xf4,0x37,
+    0x0,0x94,0x37,0x0,0x42,0x50,0xf7,0x61,0x10,0x50,0x43,0x1,0x99,0xf8,0x20,0x99,
+    0xfd,0x92,0x85,0x0,0x88,0x50,0x8,0xe0,0x7,0x48,0x77,0x20,0x99,0x94,0xb,0x4,
+    0x20,0x98,0x92,0x5b,0x4,0xfd,0x23,0x51,0x1,0x0,0x0,0x1f,0x85,0xeb,0xff,0xff,
+    0xe1,0x7a,0x14,0x0,0xa9,0xf6,0x43,0x32,0xff,0x54,0xfb,0x21,0x19,0xf0,0xb5,0x89,
+    0xb0,0xf7,0x5,0x0,0xe0,0xe3,0x1,0x2c,0x18,0x20,0x68,0xff,0x1,0x28,0x1,0xd0,
+    0x14,0x20,0x20,0x60,0xfd,0xd2,0xf,0x0,0x28,0x18,0x8,0xf0,0x8b,0xfa,0xf7,0x47,
+    0x0,0x8c,0x8f,0x1,0x29,0x18,0xb,0x68,0x7f,0x10,0x38,0x28,0x18,0x2,0x68,0x93,
+    0x7d,0x0,0xf7,0x13,0x0,0x84,0x59,0x0,0xaa,0x18,0x16,0x68,0xfd,0xb3,0xd,0x0,
+    0x33,0x0,0x2,0x93,0x9,0x68,0x77,0x0,0x68,0x88,0xb,0x0,0x1,0x0,0x10,0x7,
+    0x8,0x57,0x3,0x91,0x89,0x37,0x8,0xc,0x37,0x10,0x85,0x37,0x14,0xfd,0x0,0x37,
+    0x20,0x80,0x20,0x0,0x6,0x88,0x42,0xfb,0x3,0xda,0x3,0x0,0xdb,0xc0,0x43,0x4,
+    0xe0,0xff,0x4,0x20,0x24,0xe0,0xc8,0x17,0x41,0x40,0xf7,0x8,0x1a,0x98,0x1f,0x0,
+    0x18,0x0,0x0,0x90,0xfe,0x21,0x0,0x4,0x4,0x90,0x6,0x90,0x2,0x98,0xff,0x5e,
+    0x49,0x88,0x42,0x9,0xdb,0x2,0xaa,0xf7,0x69,0x46,0x6,0x53,0x1,0x88,0xfa,0x2,
+    0xaa,0xf7,0x3,0xa9,0x4,0x9,0x0,0x83,0xfa,0x2,0x98,0xfd,0x58,0x1b,0x0,0x6,
+    0xda,0x0,0x26,0x3,0x98,0x75,0xb0,0x7,0x0,0x6,0xd3,0x0,0xa2,0xe0,0x5,0x5,
+    0x0,0x7f,0x0,0x20,0x9f,0xe0,0x4,0x98,0x52,0x1d,0x0,0xff,0xa,0xdb,0x48,0x1c,
+    0x4,0x99,0x81,0x42,0xff,0x6,0xdb,0x3,0x99,0x0,0x9a,0x91,0x42,0x77,0x5,0xda,
+    0x8,0x1f,0x0,0x8f,0xe0,0x7,0x5,0x0,0xbf,0x8c,0xe0,0x11,0x46,0x4a,0x4a,0x13,
+    0x2,0x6,0xee,0x21,0x0,0x5,0xdb,0xb,0x13,0x0,0x82,0xe0,0x9,0xfe,0x5,0x0,
+    0x7f,0xe0,0x45,0x48,0x87,0x42,0x17,0xff,0xda,0x44,0x48,0x8,0x90,0x8,0xa9,0xdc,
+    0xfe,0x27,0x9,0x6e,0xfa,0x0,0x28,0x10,0xd1,0x80,0xff,0x20,0x80,0x4,0x7,0x90,
+    0x7,0xa9,0xde,0xba,0x15,0x8,0x63,0x15,0x0,0x8,0xd0,0xf,0x35,0x0,0x64,0xbb,
+    0xe0,0xd,0x5,0x0,0x61,0xe0,0xe,0x5,0x0,0x5e,0xfb,0xe0,0x92,0x19,0x1,0x2f,
+    0x18,0xa0,0x6c,0x0,0xff,0x21,0x8,0xf0,0x3b,0xf9,0x2d,0xd0,0x5,0xff,0xa9,0xf8,
+    0x68,0x8,0xf0,0x5e,0xfa,0x1,0xff,0xa9,0xa0,0x6c,0x8,0xf0,0x5a,0xfa,0x1,0xff,
+    0x98,0xb,0x28,0x1,0xdb,0x8,0x21,0x5,0xff,0xe0,0x2,0x28,0x1,0xda,0x4,0x21,
+    0x1,0xff,0xe0,0x41,0x10,0xc9,0x1c,0x3b,0x68,0xe0,0xff,0x6c,0x1b,0x1a,0xda,0x17,
+    0x53,0x40,0x9a,0xef,0x1a,0xaa,0x4b,0x9a,0xd,0x1,0x4,0x21,0x3a,0xff,0x68,0x12,
+    0x1a,0xd0,0x17,0x42,0x40,0x10,0xff,0x1a,0xa6,0x4a,0x90,0x42,0x0,0xdb,0x14,0xff,
+    0x21,0x1,0x98,0x5,0x9a,0x80,0x1a,0x81,0xef,0x42,0x2,0xda,0x10,0x6b,0x0,0x28,
+    0xe0,0xf8,0x7d,0x68,0x65,0x2,0x8,0xf9,0x3,0xd1,0x11,0xfd,0x4,0xf7,0x20,0xe0,
+    0xfe,0x9d,0x2,0x58,0x39,0x68,0x40,0xff,0x1a,0x83,0x21,0x89,0x0,0x69,0x58,0x3a,
+    0xef,0x68,0x89,0x1a,0x98,0x3d,0x0,0x7,0xda,0x91,0xda,0x13,0x1,0x96,0x19,0x3,
+    0xda,0x13,0x2b,0x0,0xa,0xe0,0xba,0xff,0x2,0x12,0x9,0x0,0x5,0xe0,0x19,0x5,
+    0x0,0x2,0xff,0xe0,0x20,0x68,0x1,0x28,0x0,0xd0,0x0,0xff,0x20,0x9,0xb0,0xf0,
+    0xbd,0xce,0xcc,0xcc,0xff,0x0,0xa4,0x8b,0x2e,0x3a,0x66,0x66,0x26,0xff,0x0,0x1,
+    0x0,0x0,0x8,0xcf,0x15,0xf3,0xff,0x1,0x9a,0x99,0x99,0x9,0x10,0xb5,0x84,0xff,
+    0xb0,0x4,0x0,0x0,0x23,0x68,0x46,0x8,0xff,0xf0,0x6,0xfa,0x0,0x21,0xc,0x34,
+    0x6a,0xff,0x46,0x13,0x68,0x23,0x60,0x49,0x1c,0x12,0xff,0x1d,0x24,0x1d,0x3,0x29,
+    0xf8,0xdb,0x4,0xff,0xb0,0x10,0xbd,0xf8,0xb5,0x4,0x0,0xf,0xff,0x0,0x16,0x0,
+    0x1d,0x0,0x2a,0x0,0xff,0xff,0xf7,0xf7,0xfc,0x32,0x0,0x29,0x0,0x20,0xf6,0x9,
+    0x0,0xbe,0xfd,0x5,0x2,0xb5,0xfe,0x0,0x28,0xff,0xc,0xd0,0x20,0x0,0x0,0xf0,
+    0xfc,0xf9,0xd7,0x2a,0x0,0x39,0x19,0x4,0xe5,0x23,0xc,0xac,0xfd,0xed,0xfa,0xc1,
+    0x0,0x26,0x18,0xf,0x2,0x28,0x0,0x3,0xbf,0xf0,0xe1,0xf8,0x32,0x0,0xf4,0x11,
+    0x0,0x21,0xff,0x18,0x28,0x0,0xc,0x30,0x3,0xf0,0xd9,0x7b,0xf8,0x83,0x5f,0x1,
+    0x20,0x58,0xe8,0x61,0xe9,0x2,0xff,0x20,0x58,0x28,0x62,0x30,0x68,0xa8,0x61,0xff,
+    0xf1,0xbd,0xf3,0xb5,0x85,0xb0,0x0,0x7a,0xfe,0x32,0x0,0xd0,0xa6,0xe0,0x1,0x90,
+    0x6,0x98,0xff,0x0,0x90,0x5,0x9d,0xc,0x35,0x3,0x24,0xdf,0x0,0x98,0x0,0x68,
+    0x29,0xd,0x1,0x8,0xf0,0xff,0xe8,0xf9,0xc1,0x17,0x1,0x9e,0xf7,0x17,0xff,0x7f,
+    0x7,0xf2,0x8,0x17,0x43,0x76,0x7,0xf7,0x2,0x0,0xb,0x5f,0x0,0x6e,0xf8,0x80,
+    0x19,0xff,0x79,0x41,0x42,0xf,0xce,0x0,0x32,0x43,0xff,0x80,0x26,0x76,0x5,0x0,
+    0x27,0x6,0x40,0xff,0x0,0xd0,0x52,0x1c,0x1,0x92,0x2d,0x1d,0xfe,0x3b,0x0,0x1d,
+    0x0,0x90,0x64,0x1e,0xdc,0xd1,0xff,0x5,0x98,0xfa,0x21,0x49,0x0,0x42,0x58,0xdf,
+    0xd3,0x17,0x10,0x0,0x19,0x35,0x0,0x53,0xf8,0xff,0x4,0x0,0xd,0x0,0x6a,0x10,
+    0xeb,0x17,0xff,0x80,0x20,0x0,0x6,0x0,0x21,0xc9,0x43,0xff,0x8b,0x42,0x2,0xdc,
+    0x34,0xdb,0x82,0x42,0x7f,0x32,0xd3,0xbb,0x42,0xf,0xdc,0x1,0x9,0x0,0xff,0xc,
+    0xd2,0xc6,0x43,0xbb,0x42,0xb,0xdb,0xff,0x1,0xdc,0xb2,0x42,0x8,0xd3,0x8,0x46,
+    0xff,0x1,0x21,0x20,0x40,0x29,0x40,0x1,0xd1,0xff,0x0,0x28,0x1,0xd0,0x99,0x48,
+    0x1e,0xe0,0xff,0x2,0xa8,0xc,0xc0,0x1,0x21,0x29,0x40,0xff,0x6,0xd0,0x2,0xa8,
+    0x3,0xc8,0x0,0x26,0xff,0x40,0x1c,0x71,0x41,0x2,0xae,0x3,0xc6,0xda,0xd,0x4,
+    0x29,0x27,0x2,0xc,0xd0,0x7,0x0,0xdb,0x1,0x7f,0x26,0x0,0xe0,0x0,0x26,0x0,
+    0x2d,0x9,0x0,0xfd,0x24,0x9,0x0,0x24,0xa6,0x42,0x0,0xd0,0x10,0xff,0x0,0x4,
+    0x0,0xc5,0x17,0x2d,0x7,0x20,0xff,0x9,0x5,0x43,0x24,0x7,0xa6,0xe,0xa8,0xff,
+    0x1,0x6,0x43,0xaf,0x16,0xa8,0xa0,0x3,0xfb,0xc8,0x8f,0x87,0x0,0x1e,0xdb,0x86,
+    0x42,0x1c,0xaf,0xd3,0x0,0x23,0x9f,0xb,0x0,0x3,0xb,0x0,0x1,0xbf,0xd3,0xc0,
+    0x43,0x14,0xe0,0x20,0x51,0x1,0x8,0x57,0xf0,0x6b,0xf9,0x5b,0x14,0x22,0x51,0x0,
+    0x22,0x5b,0x4,0xed,0x23,0x9,0x0,0x23,0x9a,0x5b,0x0,0x30,0x0,0x1,0xff,0x99,
+    0x81,0x42,0x3,0xdb,0x1,0x20,0x5,0xff,0x99,0x8,0x72,0x3,0xe0,0x5,0x98,0x0,
+    0xef,0x7a,0x1,0x28,0x7,0x3,0x1,0xc,0x30,0x6,0xff,0x99,0x1c,0xc9,0x1c,0xc0,
+    0x5,0x98,0xff,0xff,0xf7,0x70,0xf8,0x7,0xb0,0xf0,0xbd,0x86,0xff,0x71,0x65,0x1,
+    0xa,0xe3,0xca,0x2,0xe6,0xff,0x82,0xb8,0xff,0x7b,0x8e,0x9a,0xfe,0xf1,0x7f,0xb5,
+    0xf8,0xb0,0x18,0x30,0x2,0x90,0xca,0x1,0xff,0x21,0x26,0xaa,0x0,0x92,0x2,0x9b,
+    0x84,0xff,0x0,0x1b,0x19,0x8c,0x0,0x14,0x19,0x0,0xff,0x9d,0xce,0x0,0x76,0x18,
+    0xb6,0x0,0xad,0xff,0x19,0x9,0x26,0x76,0x1a,0x1f,0x68,0x2f,0xff,0x60,0x1f,0x68,
+    0x27,0x60,0x40,0x1c,0x24,0xff,0x35,0x24,0x1d,0x1b,0x1d,0x76,0x1e,0xf5,0xff,0xd1,
+    0x49,0x1c,0x24,0x32,0x0,0x9b,0x1b,0xff,0x1d,0x0,0x93,0x9,0x29,0xe2,0xdb,0x1,
+    0xff,0xab,0x78,0x9a,0xcc,0x32,0x26,0xa9,0xb,0xbf,0xa8,0x8,0xf0,0x20,0xf9,0x1d,
+    0x7,0x0,0x0,0xff,0xf0,0x57,0xfa,0x8,0xaa,0xb,0xa9,0x1d,0xee,0x9,0x0,0xea,
+    0xfa,0x13,0xe1,0x1,0x6b,0x46,0x8,0xef,0xaa,0x78,0x99,0x4,0xf,0x0,0xf6,0xfa,
+    0x4,0xff,0x98,0x40,0x0,0x40,0x8,0x8,0xf0,0x4a,0xfd,0xf9,0xf9,0x1,0xac,0x8,
+    0xad,0x3,0x26,0x28,0xff,0x68,0x0,0x99,0x8,0xf0,0x75,0xf9,0x20,0xef,0x60,0x2d,
+    0x1d,0x24,0x61,0x0,0xf6,0xd1,0x0,0xff,0x25,0x78,0x98,0x8d,0x21,0x89,0x0,0x46,
+    0xff,0x18,0x5,0xac,0x1,0x23,0x1,0x22,0x1b,0xff,0x21,0x20,0x68,0x6,0xf0,0x39,
+    0xfe,0x30,0xff,0x60,0x6d,0x1c,0x24,0x1d,0x36,0x1d,0x3,0xff,0x2d,0xf3,0xdb,0x0,
+    0x20,0x2,0x90,0x1d,0xff,0xa8,0x3,0x90,0x14,0xac,0x25,0x0,0x3,0xff,0x9e,0x3,
+    0x27,0x31,0x68,0x0,0x98,0x8,0xff,0xf0,0x52,0xf9,0x28,0x60,0x36,0x1d,0x2d,0xfb,
+    0x1d,0x7f,0x45,0x0,0x2,0x98,0x40,0x1c,0x2,0xef,0x90,0xc,0x34,0x3,0xf,0x1,
+    0x3,0x90,0x2,0xff,0x98,0x3,0x28,0xe9,0xdb,0x78,0x98,0x84,0xfe,0x57,0x0,0x40,
+    0x18,0x0,0x90,0x6,0x46,0x14,0x5f,0xad,0x3,0x27,0x0,0x24,0x5f,0x6,0x28,0x5f,
+    0x0,0xdd,0x9,0x5f,0x0,0x64,0x1c,0x2d,0x5f,0x2,0x2c,0xf3,0xff,0xdb,0x7f,0x1e,
+    0xf0,0xd1,0x72,0x49,0x78,0xff,0x98,0xc8,0x30,0x0,0x68,0x8,0xf0,0xe3,0xfb,0xfa,
+    0x1,0xa3,0x0,0x23,0xf9,0x1,0x90,0x0,0xff,0x98,0x0,0xf0,0x2a,0xf8,0x78,0x99,
+    0x90,0xff,0x22,0x92,0x0,0x8c,0x18,0x20,0x60,0x1b,0xff,0x21,0x6,0xf0,0x24,0xfe,
+    0x68,0x49,0x8,0xfb,0xf0,0xd1,0x23,0x4,0x11,0xf9,0x66,0x49,0x7,0xdf,0xf0,0xff,
+    0xfe,0x1,0xd2,0x2b,0x0,0xe0,0x1,0xff,0x91,0x1,0x98,0x60,0x61,0x1,0x98,0x62,
+    0xfe,0x1f,0x0,0xc7,0xfa,0x5,0xd8,0x1,0x20,0x78,0xff,0x99,0xe0,0x22,0x52,0x0,
+    0x88,0x50,0x3,0xf7,0xe0,0x2,0x48,0xf7,0x0,0x60,0x0,0x20,0x79,0xfe,0x9f,0x1,
+    0xff,0xff,0xff,0x7f,0x70,0xb5,0x0,0xbf,0x26,0x4,0x0,0x3,0x25,0x20,0x6f,0x0,
+    0xc5,0x7f,0xfa,0xc1,0x17,0x48,0x40,0x41,0x1a,0x9f,0x1,0xfd,0x2e,0xe9,0x3,0x0,
+    0x29,0x1,0xd1,0x0,0x22,0xff,0xc,0xe0,0xa,0x11,0xb,0x7,0x0,0xd5,0xff,0x52,
+    0x1c,0x0,0x2a,0x6,0xd0,0xd6,0x43,0xff,0xf6,0xf,0xcb,0x43,0xdb,0xf,0x9e,0x42,
+    0xff,0x0,0xd0,0xa,0x11,0x86,0x18,0x6,0xd4,0xff,0x0,0x28,0x9,0xd5,0x0,0x2a,
+    0x7,0xd5,0xff,0x80,0x26,0x36,0x6,0x4,0xe0,0x0,0x28,0xff,0x2,0xd4,0x0,0x2a,
+    0x0,0xd4,0x44,0x4e,0xff,0x10,0x34,0x6d,0x1e,0xd3,0xd1,0x1,0x20,0xff,0xc0,0x21,
+    0x89,0x4,0x9,0x18,0x48,0x9,0xff,0xb0,0x42,0x1,0xda,0x0,0x2e,0x1,0xd1,0xff,
+    0x3e,0x48,0x70,0xbd,0xf4,0x17,0x66,0x40,0xff,0x32,0x1b,0x0,0x20,0xc9,0x9,0x3,
+    0xf0,0xff,0xe9,0xfb,0x60,0x40,0x0,0x1b,0x70,0xbd,0xf5,0x0,0x0,0x2,0x80,0x93,
+    0x0,0xff,0xf0,0xb5,0x83,0xff,0xb0,0x7,0x0,0x84,0x20,0x80,0x0,0x3c,0xff,0x18,
+    0x4c,0x38,0x38,0x18,0x21,0x0,0x48,0xff,0x22,0x2,0xf0,0xc,0xfb,0xfe,0x20,0x40,
+    0xef,0x0,0x38,0x58,0x83,0x4b,0x1,0x78,0x50,0x3a,0xff,0x0,0xc,0x32,0x21,0x0,
+    0x68,0x46,0x8,0xbf,0xf0,0x70,0xfa,0x0,0x24,0x8d,0x2b,0x0,0x3d,0xef,0x18,0x6e,
+    0x46,0x28,0xc5,0x0,0x95,0xfa,0x31,0xe7,0x68,0x8,0x18,0x55,0x3,0x93,0x3,0x3,
+    0x2c,0xf4,0xfe,0xb5,0x1,0xf4,0x21,0x49,0x0,0x79,0x18,0x6a,0xff,0x46,0x1f,0x4b,
+    0x80,0x24,0x24,0x5,0x80,0xef,0x25,0x2d,0x6,0xf8,0xad,0x0,0x17,0x68,0x0,0xef,
+    0x2f,0x8,0xd0,0xb7,0x97,0x0,0x2f,0x0,0x4,0xff,0xe0,0xa7,0x42,0x1,0xdb,0x1f,
+    0x0,0x0,0xff,0xe0,0x3f,0x1,0xf,0x60,0x40,0x1c,0x12,0xff,0x1d,0x9,0x1d,0x3,
+    0x28,0xed,0xdb,0x3,0xfe,0x27,0x1,0x10,0xb5,0x8,0x0,0x14,0x0,0x8,0xff,0xf0,
+    0x6e,0xfa,0x40,0x10,0xfe,0x21,0x9,0xf7,0x6,0x40,0x18,0x27,0x3,0x40,0x1a,0xc,
+    0xd0,0xfd,0xe0,0xd,0x0,0x88,0x42,0x2,0xda,0x80,0x20,0x7f,0x0,0x6,0x5,0xe0,
+    0x49,0x42,0x88,0x43,0x0,0xff,0x6,0x48,0x0,0xe0,0x80,0x0,0x20,0x60,0xfd,0x10,
+    0xd1,0x0,0x90,0xc0,0x0,0x0,0x50,0xc1,0xff,0x0,0x50,0xc3,0x47,0xcd,0xbc,0x8c,
+    0x2b,0xfe,0x6f,0x3,0xf1,0xb5,0x94,0xb0,0x11,0xa8,0x1c,0xf7,0xc9,0x1c,0xc0,0x77,
+    0x1,0xac,0x11,0xad,0x28,0xff,0x68,0xc1,0x17,0x6a,0x46,0x3,0xc2,0x68,0xff,0x46,
+    0x3,0xc8,0x6a,0x46,0xc,0xca,0x2,0xff,0xf0,0x34,0xfe,0x2,0x0,0x8,0x0,0xc9,
+    0xdf,0x17,0x6f,0x46,0x3,0xc7,0x57,0x2,0x10,0x40,0xfb,0x6,0xd0,0x1d,0x2,0x0,
+    0x22,0x40,0x1c,0x51,0xfd,0x41,0x2b,0xa,0x20,0x60,0x76,0x1c,0x2d,0x1d,0xff,0x24,
+    0x1d,0x3,0x2e,0xdd,0xdb,0x5,0x98,0xff,0x7,0x90,0x6,0x9d,0x11,0x9a,0x53,0x11,
+    0xff,0x1,0x21,0x12,0x11,0xa,0x40,0x0,0xd0,0xff,0x5b,0x1c,0x1,0x93,0x12,0x9c,
+    0x62,0x11,0xf7,0x23,0x11,0xb,0xd,0x0,0x52,0x1c,0x2,0x92,0xff,0x13,0x9a,0x0,
+    0x92,0x13,0x46,0x5a,0x11,0xf7,0x1b,0x11,0x19,0x11,0x4,0x3,0x92,0x7,0xf0,0xff,
+    0x6e,0xff,0x6,0x0,0x4,0x98,0x7,0xf0,0xff,0x6a,0xff,0x80,0x19,0x8,0x90,0x6,
+    0x46,0xfd,0x28,0xe3,0x0,0xc3,0xf9,0x30,0x1a,0x8,0x90,0x7f,0x28,0x0,0x7,0xf0,
+    0x5f,0xff,0x5,0x1d,0x4,0xff,0x5b,0xff,0x40,0x19,0x9,0x90,0x5,0x46,0xff,0x7,
+    0x98,0x8,0xf0,0xb4,0xf9,0x28,0x1a,0xff,0x9,0x90,0x1,0x98,0xc1,0x17,0x22,0x0,
+    0xff,0xe3,0x17,0x2,0xf0,0xde,0xfd,0x2,0xf,0xaf,0xc,0x1,0x22,0x43,0x55,0x3,
+    0x4,0x57,0x4,0xa,0xdf,0x92,0x0,0x9e,0xf7,0x17,0x21,0x2,0x32,0x0,0xdf,0x3b,
+    0x0,0x2,0xf0,0xcd,0x21,0x1c,0xb,0x92,0x5f,0x2,0x9c,0x20,0x0,0xe1,0x1f,0x8,
+    0xbd,0x1f,0x0,0xff,0xd,0x1,0x2a,0x43,0x80,0x26,0x36,0x5,0xfd,0x6,0x1f,0x4,
+    0xc,0x92,0x1,0x99,0x48,0x42,0x7f,0x8,0xf0,0x7e,0xf9,0xd,0x90,0x60,0x7,0x0,
+    0xdf,0x7a,0xf9,0xe,0x90,0x3,0x11,0x4,0x75,0xf9,0xff,0xf,0x90,0x80,0x20,0x40,
+    0x3,0x10,0x90,0xff,0x0,0x25,0x1,0x95,0x8,0xa8,0x2,0x90,0xff,0x14,0x98,0xa9,
+    0x0,0x44,0x18,0x18,0x34,0xff,0x8,0xa8,0x1,0x99,0x89,0x0,0x47,0x18,0xff,0x9,
+    0x20,0x1,0x99,0x46,0x1a,0x27,0x21,0x7f,0xc9,0x43,0x0,0x91,0x2,0x98,0x0,0x5b,
+    0x1,0xf7,0x3a,0x68,0xd3,0xa7,0x0,0x8a,0xfd,0x8,0xf0,0xff,0xb0,0xf9,0x0,0x99,
+    0x8,0xf0,0xd3,0xf9,0xff,0x21,0x68,0x7,0xf0,0xda,0xfc,0x20,0x60,0xf7,0x6d,0x1c,
+    0x3f,0x3f,0x1,0x76,0x1e,0xe7,0xd1,0xbf,0x1,0x98,0x40,0x1c,0x1,0x90,0x2f,0x0,
+    0x1d,0xfd,0x2,0xdb,0x0,0x9,0x28,0xd3,0xdb,0x4,0x98,0xff,0x16,0x21,0x6,0xf0,
+    0x73,0xfc,0x4,0x0,0xfd,0x5,0x9,0x4,0x6e,0xfc,0x1,0x0,0x6,0x9d,0xae,0x8d,
+    0x3,0x44,0x40,0x20,0x1b,0x1,0xf2,0x19,0x0,0x16,0x3f,0x21,0x28,0x0,0x6,0xf0,
+    0x61,0x19,0x0,0x11,0x2,0xff,0xe9,0xfc,0x7,0x0,0x8,0xad,0x14,0x9c,0x5f,0xcc,
+    0x34,0x28,0x68,0x14,0x31,0x0,0x55,0x17,0x0,0x4d,0x38,0x17,0x0,0x44,0xff,0x1f,
+    0x0,0x71,0x0,0xa1,0x71,0x0,0xff,0x76,0x1c,0x24,0x1d,0x2d,0x1d,0x9,0x2e,0xff,
+    0xed,0xdb,0x15,0xb0,0xf0,0xbd,0xf2,0xb5,0xff,0xe4,0xb0,0x5a,0xa9,0x0,0xf0,0x5b,
+    0xf8,0xff,0x6,0xa9,0x5a,0xa8,0x8,0xf0,0xb5,0xf9,0xff,0x2a,0xaa,0x3c,0xa9,0x6,
+    0xa8,0x5,0xf0,0xdf,0x87,0xf8,0x3c,0xa9,0x51,0x11,0x0,0xb9,0xf9,0xff,0x3,0xa8,
+    0x3c,0xa9,0x24,0x31,0x3,0x22,0xff,0xb,0x68,0x3,0x60,0x9,0x1d,0x0,0x1d,0xff,
+    0x52,0x1e,0xf9,0xd1,0x3c,0xa9,0x30,0x31,0xfd,0xf,0x1d,0x0,0xaa,0xf9,0x0,0x27,
+    0x0,0x26,0xdf,0x6c,0x46,0x3,0xad,0x28,0x5f,0x0,0xdd,0xfe,0xfa,0x5f,0x2,0x2d,
+    0xd1,0x0,0x3,0x2e,0xf6,0xdb,0x21,0xff,0xa8,0x0,0x21,0x2,0x0,0x3,0x23,0x11,
+    0xff,0x60,0x12,0x1d,0x5b,0x1e,0xfb,0xd1,0x7f,0xff,0x1c,0xc,0x30,0x3,0x2f,0xf5,
+    0xdb,0x68,0xff,0x46,0x21,0xa9,0x3,0x22,0x3,0x68,0xb,0xf7,0x60,0x10,0x31,0x4d,
+    0x6,0x21,0xaa,0x51,0xa9,0xdd,0x18,0x4d,0x0,0x92,0xf9,0xf,0x7b,0x0,0x8,0xf0,
+    0xdf,0x9e,0xf9,0x6,0xa8,0xf,0x23,0x2,0x23,0x4,0xbf,0x68,0xc,0x60,0xc,0x30,
+    0x9,0x3f,0x0,0xf9,0xff,0xd1,0x20,0x38,0x52,0x1e,0xf5,0xd1,0xf,0xff,0xaa,0x18,
+    0xa9,0x64,0x98,0x8,0xf0,0x7c,0xfb,0xf9,0x65,0xbf,0x0,0xf8,0xb5,0x4,0x0,0xd,
+    0xff,0x0,0xfe,0x26,0xb6,0x5,0x20,0x68,0x31,0xee,0xe9,0x0,0x30,0xfc,0x61,0x87,
+    0x0,0x2d,0xfc,0x28,0xff,0x60,0xa0,0x68,0x68,0x60,0xe0,0x68,0xa8,0xbe,0x7,0x0,
+    0xe8,0x60,0x80,0x27,0xff,0x1f,0x8,0x20,0xbf,0xfc,0x0,0x90,0x60,0x68,0x39,0x9,
+    0x0,0xba,0xff,0xfe,0x1,0x0,0x0,0x98,0x7,0xf0,0x4f,0x7f,0xfc,0x28,0x61,0x20,
+    0x69,0x68,0x61,0x2b,0x0,0xee,0x7,0x0,0xe8,0x61,0x60,0x27,0x4,0xc,0xfc,0x6,
+    0xd4,0x31,0x1,0x27,0x2,0xa6,0x27,0x0,0x30,0x7,0x0,0x3b,0xfc,0xff,0x28,0x62,
+    0xf1,0xbd,0x30,0xb5,0x83,0xb0,0xff,0x5,0x0,0x14,0x0,0xb,0x0,0x1c,0x33,0xff,
+    0xa,0x0,0x18,0x32,0x14,0x31,0x68,0x46,0xff,0x8,0xf0,0x52,0xf9,0x0,0x23,0x2,
+    0x0,0xfd,0x29,0x83,0x1,0x8,0xf0,0x53,0xf9,0x3,0xb0,0xff,0x30,0xbd,0xf1,0xb5,
+    0x14,0x0,0x1d,0x0,0x7f,0x0,0x26,0x3,0x27,0x21,0x68,0x8,0x3d,0x0,0xfb,0x83,
+    0xfe,0x55,0x2,0xe1,0xfb,0x6,0x0,0x24,0xbf,0x1d,0x7f,0x1e,0xf4,0xd1,0x29,0xa5,
+    0x0,0x12,0xfe,0x9d,0x1,0xfe,0x20,0x80,0x5,0x8,0xf0,0x73,0xff,0xf9,0x0,0x99,
+    0x8,0x60,0xf1,0xbd,0x70,0xff,0xb5,0x86,0xb0,0x6,0x0,0x0,0x24,0x4,0xff,0x94,
+    0x3,0x94,0x2,0x94,0x80,0x25,0xed,0xff,0x5,0x1,0x95,0x4,0xa8,0x0,0x90,0x3,
+    0xff,0xab,0x2,0xaa,0x1,0xa9,0x30,0x0,0xfc,0x7f,0xf7,0x60,0xff,0x34,0x61,0x74,
+    0x62,0x1f,0x6,0xfe,0x1b,0x16,0x28,0x30,0xfc,0xf7,0x51,0xff,0x74,0xff,0x87,0x30,
+    0x0,0x6,0xb0,0x70,0xbd,0x38,0xfe,0x17,0x1,0x0,0x25,0x80,0x20,0xc0,0x5,0x20,
+    0xff,0x60,0x65,0x60,0xa5,0x60,0xe5,0x60,0x20,0xff,0x60,0xa0,0x62,0xe5,0x62,0x25,
+    0x63,0x65,0xfd,0x63,0x7,0xa,0x1c,0x22,0x8,0xa0,0x3,0xc8,0xff,0x1,0xf0,0xb4,
+    0xfd,0x1,0xf0,0xec,0xfd,0xff,0x20,0x61,0x9,0x20,0x20,0x62,0x38,0x21,0xff,0x65,
+    0x54,0x14,0x34,0x3,0x20,0x25,0x60,0xf7,0x24,0x1d,0x40,0xb3,0x1,0x31,0xbd,0x96,
+    0x43,0xff,0x8b,0x6c,0xe7,0xfb,0xff,0x3f,0xff,0xb5,0xff,0xb5,0xb0,0x0,0x20,0xb,
+    0x90,0xa7,0x48,0xff,0x37,0x99,0x36,0x9a,0x13,0x1,0x9a,0x1a,0xff,0x91,0x42,0x2,
+    0x90,0x1,0xd3,0x36,0x98,0xff,0x0,0xe0,0x37,0x98,0x0,0x90,0x2,0xaa,0xf7,0x69,
+    0x46,0xb,0xbb,0x1,0x63,0xf9,0x3e,0x9a,0xff,0xd3,0x17,0x10,0x0,0x19,0x0,0x2,
+    0xf0,0xff,0x11,0xfc,0x4,0xf,0xa,0x1,0x14,0x43,0xff,0xd,0x17,0xab,0xa2,0xc,
+    0xca,0x9d,0x42,0xff,0x4,0xdc,0x1,0xdb,0x94,0x42,0x1,0xd2,0xff,0x14,0x46,0xf,
+    0xe0,0x0,0x27,0xbd,0x42,0xfd,0xb,0xf,0x4,0x8,0xd2,0xd6,0x43,0xbd,0x42,0xff,
+    0x6,0xdb,0x1,0xdc,0xb4,0x42,0x3,0xd3,0xff,0x1a,0x9,0x2,0x40,0x0,0xd0,0x5c,
+    0x8,0xdf,0x0,0x20,0xa,0x90,0xb,0x49,0xc,0xec,0xfb,0x7f,0x2,0xaa,0x3,0xc2,
+    0x2,0xa9,0xa,0x61,0x0,0xff,0x5e,0xf9,0xa,0x98,0x80,0x10,0xa,0x90,0xdf,0x20,
+    0x0,0xe1,0x17,0xa,0x21,0x0,0x2,0xf0,0xff,0xdd,0xfb,0x2,0xe,0xc,0x2,0x22,
+    0x43,0x7f,0xb,0x16,0x91,0xa4,0x30,0xcc,0xab,0x67,0x4,0x5d,0xa2,0x67,0x0,0x20,
+    0x46,0x11,0x67,0x0,0xbb,0x67,0x4,0x7d,0xa2,0x67,0x0,0xe6,0x43,0xbb,0x42,0x7,
+    0x67,0x0,0xff,0xb2,0x42,0x4,0xd3,0x2c,0xa,0x4,0x40,0xfb,0x1,0xd0,0x9c,0x1,
+    0xe0,0x10,0x0,0x35,0x99,0xff,0x10,0x31,0x2,0x91,0xc1,0x17,0x2,0x9a,0xfb,0x52,
+    0x69,0x4f,0x2,0xb5,0xfb,0xc4,0xc,0x4a,0xbf,0x3,0x14,0x43,0xcd,0x14,0x7d,0xb7,
+    0x4c,0x5a,0xfd,0xb,0xb7,0x6,0xa5,0x49,0x20,0x0,0x8,0xf0,0xbf,0x34,0xf9,0x4,
+    0x0,0x21,0xa8,0x57,0x0,0x22,0xff,0x1,0xf0,0xf2,0xff,0x0,0x20,0x4,0x90,0xff,
+    0x9,0x90,0x37,0x98,0x36,0x99,0xa,0x1,0xff,0x51,0x1a,0x88,0x42,0x14,0xd2,0xb,
+    0x9b,0xff,0x38,0x9a,0xc,0x32,0x35,0x99,0x14,0x31,0xfd,0x21,0xd1,0x0,0x21,0xf9,
+    0x0,0x20,0x0,0x2c,0xff,0x0,0xd0,0x20,0x0,0x1,0x0,0x6b,0x31,0xff,0x9,0x91,
+    0x7,0xd5,0x0,0x28,0x5,0xd4,0xbf,0x94,0x48,0x9,0x90,0x2,0xe0,0xc3,0x3,0x9,
+    0xbf,0x90,0x9,0xaa,0x2,0x99,0x4,0x29,0x0,0x50,0xff,0xf9,0x8f,0x49,0x4,0x98,
+    0x8,0xf0,0x6c,0xff,0xf9,0x4,0x90,0x35,0x98,0x14,0x30,0x38,0xff,0x99,0xc,0x31,
+    0x1c,0xc9,0x1c,0xc0,0x38,0xff,0x98,0x2,0xf0,0xfd,0xfb,0x1,0x21,0x3f,0xff,0x9c,
+    0x88,0x42,0x8,0xda,0xc0,0x20,0x0,0xff,0x6,0x0,0x21,0x1e,0x91,0x1f,0x91,0x20,
+    0xff,0x90,0xfe,0x24,0xe4,0x5,0x4,0xe0,0x3,0xff,0x22,0x1e,0xa9,0x38,0x98,0x3,
+    0xf0,0xb5,0xbe,0x69,0x0,0x3,0x90,0x22,0x0,0xe3,0x57,0x9,0x40,0xea,0x39,0xd,
+    0x42,0x39,0x5,0x5,0x29,0x5,0x2,0xd2,0x0,0xaf,0x20,0x76,0x49,0x17,0x3b,0x1d,
+    0x8,0x3b,0x5,0x5,0xfe,0x3b,0x5,0x2,0xd0,0x6f,0xa0,0x3,0xc8,0x5,0xfe,0x3d,
+    0x1,0xc1,0x17,0x6e,0x4a,0x0,0x23,0x2,0xef,0xf0,0x1a,0xfb,0x6,0xa3,0x1,0x6,
+    0xa9,0x3,0xf6,0xa7,0x0,0x8c,0xf8,0xed,0xe,0x1,0xd3,0x67,0x48,0xdf,0x3,0x90,
+    0x5f,0x49,0x3,0xb7,0x0,0xa8,0xf8,0xff,0x3,0x90,0x65,0x4c,0x20,0x0,0x3,0x99,
+    0xff,0x88,0x42,0x0,0xda,0x8,0x0,0x3,0x90,0xff,0x2,0x98,0x0,0x69,0x0,0x90,
+    0x9,0x20,0xff,0x2,0x99,0x8,0x61,0x0,0x20,0x8,0x90,0x5e,0xef,0x0,0x4,0x5,
+    0x90,0x5,0xef,0x0,0x8,0x47,0x0,0xff,0xfc,0xf8,0x0,0x98,0x3,0x28,0x6,0xd1,
+    0xfb,0x5a,0x48,0x13,0xe,0xf2,0xf8,0x3,0x98,0x55,0xff,0x49,0x88,0x42,0x3,0xdb,
+    0x80,0x11,0x8,0xbe,0x47,0x0,0xa,0xda,0x3,0x98,0x48,0xf,0x2,0xda,0xff,0x1,
+    0x20,0x2,0xe0,0x83,0xde,0x1b,0x43,0x5e,0x4d,0x1,0x28,0x4,0xd1,0x43,0x75,0x0,
+    0x3,0x57,0x8,0xff,0x80,0x22,0xd2,0x5,0x1b,0x92,0x1c,0x90,0xff,0x1d,0x90,0x29,
+    0xa9,0x38,0x9a,0x1c,0x32,0xff,0x13,0x68,0xb,0x60,0x40,0x1c,0x12,0x1d,0xbf,0x9,
+    0x1d,0x3,0x28,0xf8,0xdb,0xab,0xe,0x5,0xff,0xd3,0x40,0x4c,0x30,0xe0,0x0,0x0,
+    0x0,0xeb,0x80,0xff,0x0,0x0,0xcf,0x75,0x2,0xa9,0x41,0x98,0xff,0x1c,0x30,0x8,
+    0xf0,0xe3,0xf8,0x0,0x28,0x7f,0x23,0xd1,0x41,0x98,0xc2,0x69,0xd3,0x3b,0x9,0xff,
+    0xa2,0xfa,0x84,0xe,0x8a,0x1,0x14,0x43,0xff,0x8d,0x16,0xc6,0xa2,0xc,0xca,0x9d,
+    0x42,0xfd,0x4,0x29,0x1,0x94,0x42,0x1,0xd2,0x14,0x46,0xd5,0xf,0x39,0x1,0xbd,
+    0x39,0x5,0x94,0x39,0x1,0xd6,0x43,0xf7,0xbd,0x42,0x6,0x39,0x1,0xb4,0x42,0x3,
+    0xd3,0xff,0x9a,0x9,0x2,0x40,0x0,0xd0,0x5c,0x8,0xdf,0x3,0x22,0x1b,0xa9,0x29,
+    0xcb,0x0,0xca,0xf8,0xff,0x19,0x49,0x20,0x0,0x8,0xf0,0x1c,0xf8,0xff,0x4,0x0,
+    0xc,0xaa,0x1b,0xa9,0x1e,0xa8,0xdf,0x0,0xf0,0xc0,0xfa,0x0,0xf1,0x0,0x0,0x21,
+    0xfe,0xb3,0x2,0xc,0x92,0xd,0x91,0xe,0x90,0x10,0xd5,0x4c,0x15,0x17,0x71,0x15,
+    0x1,0x6,0x23,0x0,0x14,0x48,0xef,0x0,0x90,0x6a,0x46,0x13,0x6,0x67,0xf8,0xa7,
+    0xbf,0x48,0x84,0x42,0x5,0xdb,0xa0,0x13,0x5,0x1,0xbf,0xdb,0x1,0x20,0x20,0xe0,
+    0x2,0x11,0x0,0x1a,0xff,0xda,0x1,0x21,0x19,0xe0,0x0,0xbf,0x80,0xf7,0x9d,0xef,
+    0x7f,0xd2,0x0,0x7f,0x80,0xe7,0xfb,0xff,0x7f,0xe8,0xd9,0xac,0xfa,0xd0,0xb3,0x59,
+    0xff,0xf5,0x17,0x26,0x53,0x5,0x30,0x4c,0xa6,0xff,0xa,0x5e,0xba,0x49,0x0,0x6e,
+    0xa3,0x1,0xff,0x0,0x36,0x5e,0xba,0x1,0x34,0x33,0x33,0xff,0x1,0x14,0xae,0x47,
+    0x1,0x0,0x21,0x1,0xff,0x20,0x48,0x40,0x0,0x21,0x6,0x91,0x7,0xff,0x91,0x2,
+    0x99,0x9,0x69,0x3,0x29,0x4f,0xbf,0xd0,0x0,0x28,0x4d,0xd0,0x6,0x51,0x5,0x21,
+    0xff,0xa9,0xf,0xa8,0x1,0xf0,0xcb,0xfe,0x25,0xff,0xa8,0xf,0xa9,0x10,0x22,0x1,
+    0xf0,0x80,0xf9,0xfe,0x73,0x1,0xb1,0x10,0xc,0x98,0x15,0x90,0xd,0xff,0x98,0x14,
+    0x90,0xe,0x98,0x13,0x90,0x5,0xff,0x91,0x13,0xa8,0x0,0x90,0x14,0xab,0x15,0xff,
+    0xaa,0x5,0xa9,0x30,0xa8,0xfc,0xf7,0xfe,0xbb,0xfc,0x25,0x3d,0x4,0xac,0xfe,0x2c,
+    0x3d,0x8,0x61,0xfe,0x3d,0x0,0x80,0x23,0xdb,0x5,0xf,0x93,0x10,0x7f,0x90,0x11,
+    0x90,0x12,0x90,0x30,0xaa,0x21,0x2,0x7f,0xfc,0xf7,0xf9,0xfb,0x2c,0xaa,0xf,0x9,
+    0x4,0xff,0xf4,0xfb,0x10,0x98,0x16,0x90,0x11,0x98,0xff,0x17,0x90,0x12,0x98,0x18,
+    0x90,0x1b,0xa8,0xff,0x16,0xa9,0x1c,0xc9,0x1c,0xc0,0x3,0xaa,0xf7,0x3,0xa9,0x6,
+    0xfb,0x0,0xb0,0xf8,0xf0,0x20,0xff,0x80,0x5,0x6,0xe0,0x3,0x98,0x40,0x10,0xff,
+    0x61,0x10,0x40,0x18,0x6,0x90,0xf0,0x20,0xbb,0x40,0x5,0x1b,0x3,0x6,0xa9,0x7,
+    0x1f,0x0,0xa7,0xff,0xf8,0xa3,0x4c,0x21,0x0,0x6,0x98,0x8,0xff,0xf0,0xce,0xf8,
+    0x6,0x90,0x21,0x0,0x7,0xde,0x9,0x0,0xc9,0xf8,0x7,0x90,0xf7,0xf,0x2,0xd3,
+    0xfd,0x9,0xd7,0x4,0x35,0x9b,0x28,0x33,0x1b,0xaa,0xff,0x1e,0xa9,0xc,0xa8,0x3,
+    0xf0,0x4c,0xf9,0xff,0x35,0x98,0x28,0x30,0x1,0xf0,0x98,0xfa,0xfc,0xd9,0x0,0x5f,
+    0x0,0x17,0x90,0x18,0x91,0x19,0x91,0xff,0x1a,0x91,0x11,0x91,0x10,0x91,0xf,0x91,
+    0x77,0x5,0x90,0x11,0xd5,0x0,0x10,0xab,0xf,0xd5,0x0,0xfd,0x25,0x63,0x0,0xa5,
+    0xf8,0x21,0xa8,0x35,0x99,0xff,0x28,0x31,0x17,0xaa,0x25,0xab,0x4,0x24,0xff,0x5,
+    0x68,0x6d,0x10,0xf,0x68,0x7f,0x10,0xff,0xee,0x19,0x16,0x60,0xe,0x68,0x76,0x10,
+    0xff,0xad,0x1b,0x1d,0x60,0x1b,0x1d,0x12,0x1d,0xff,0x9,0x1d,0x0,0x1d,0x64,0x1e,
+    0xef,0xd1,0xfa,0x31,0x2,0x98,0xf3,0x1,0x1a,0x98,0xc1,0x17,0x14,0xaf,0xaa,0x3,
+    0xc2,0x19,0x7,0x0,0x12,0x7,0x0,0x18,0xfa,0x7,0x0,0x10,0x7,0x0,0x17,0x9a,
+    0xd3,0x17,0x10,0xff,0x0,0x19,0x0,0x2,0xf0,0x6f,0xf9,0x6,0xff,0x0,0xf,0x0,
+    0x10,0xa8,0x3,0xc8,0x10,0xff,0xaa,0xc,0xca,0x2,0xf0,0x67,0xf9,0x80,0x57,0x19,
+    0x79,0x41,0x13,0x2,0x12,0x13,0x0,0x12,0x13,0x4,0x55,0x5d,0x13,0xc,0x14,0x13,
+    0x0,0x14,0x13,0x4,0x53,0x13,0x4,0xbf,0x48,0x10,0xa0,0x42,0x8,0xda,0xc7,0x2,
+    0x4,0xff,0x21,0x3,0x68,0x5a,0x42,0x2,0x60,0x0,0xff,0x1d,0x49,0x1e,0xf9,0xd1,
+    0x2,0x98,0x0,0xff,0x69,0x3,0x28,0xd,0xd1,0x35,0x98,0x21,0xde,0x81,0x5,0xa0,
+    0xfd,0x4,0x98,0xff,0x0,0x60,0x35,0xf7,0x98,0x38,0x30,0xf9,0x1,0x70,0x41,0x80,
+    0x56,0xff,0xe1,0x0,0x20,0x7,0x99,0x0,0x29,0x0,0xff,0xd0,0x48,0x10,0x4,0x99,
+    0x44,0x18,0x6,0xff,0xd4,0x0,0x28,0x9,0xd5,0x0,0x29,0x7,0xff,0xd5,0x80,0x24,
+    0x24,0x6,0x4,0xe0,0x0,0xf7,0x28,0x2,0xd4,0x1d,0x0,0xd4,0xb3,0x4c,0x0,0xff,
+    0x20,0xa0,0x42,0x11,0xd0,0xcf,0x17,0xbf,0xff,0x7,0x88,0x8,0x7,0x43,0x8e,0x7,
+    0x0,0xff,0x2c,0xc,0xd1,0xae,0x48,0x22,0xe0,0x0,0xdf,0xbf,0xa,0xd7,0xa3,0x0,
+    0x0,0x0,0x80,0xff,0xfe,0x0,0x0,0x60,0x8f,0xc2,0x5,0xbe,0x48,0x17,0xef,0xe0,
+    0xf8,0x17,0xf9,0xe1,0x4,0x20,0x0,0x8,0xef,0xf0,0x4b,0xf8,0x5,0xd9,0x4,0x70,
+    0x40,0x79,0x7d,0x40,0xdd,0x2,0x80,0x1a,0x99,0x41,0x2a,0xf3,0x0,0xff,0x27,0xfe,
+    0xfe,0x17,0xe1,0x17,0x71,0x40,0xff,0x48,0x40,0x40,0x1a,0x5,0x90,0xb2,0x4c,0xfe,
+    0xad,0x2,0x6,0x28,0x10,0xd1,0x0,0x20,0x0,0xf7,0x90,0x21,0xa9,0xcd,0x2,0x6,
+    0xf0,0xc4,0xfe,0xff,0x0,0x90,0xac,0x48,0x1,0x90,0x1,0xa9,0xff,0x68,0x46,0x7,
+    0xf0,0x14,0xff,0x0,0x28,0xff,0x0,0xd0,0xa4,0x9,0x5,0x98,0xa0,0x42,0xff,0x0,
+    0xdb,0x5,0x94,0x5,0x98,0x13,0x90,0xff,0x0,0x20,0x80,0x23,0xdb,0x5,0xf,0x93,
+    0xff,0x10,0x90,0x11,0x90,0x12,0x90,0x13,0x99,0xff,0x58,0x1a,0x14,0x90,0xf,0xaf,
+    0x21,0xae,0x7f,0x35,0x9c,0x28,0x34,0x4,0x25,0x14,0x69,0x1,0xff,0x32,0x68,0xd3,
+    0x17,0x2,0xf0,0xbe,0xf8,0x5f,0x0,0x90,0x1,0x91,0x13,0xf,0x0,0x22,0xf,0x4,
+    0xff,0xb6,0xf8,0x0,0x9a,0x1,0x9b,0x80,0x18,0xff,0x59,0x41,0x80,0xf,0x8a,0x0,
+    0x10,0x43,0xff,0x38,0x60,0x24,0x1d,0x36,0x1d,0x3f,0x1d,0xdf,0x6d,0x1e,0xe4,0xd1,
+    0xf,0x57,0x0,0x10,0x98,0xff,0x14,0x90,0x11,0x98,0x15,0x90,0x12,0x98,0xff,0x16,
+    0x90,0x4,0x22,0x13,0xa9,0x13,0xa8,0xff,0x7,0xf0,0xea,0xff,0x13,0x98,0xf,0x90,
+    0xff,0x14,0x98,0x10,0x90,0x15,0x98,0x11,0x90,0x7f,0x16,0x98,0x12,0x90,0x35,0x98,
+    0xf,0x59,0x5,0x5b,0xf3,0xfc,0xbd,0x6,0x6,0xd1,0x61,0x7,0x34,0x17,0x1,0xff,
+    0x0,0xcf,0xf7,0x7f,0x80,0x20,0xc0,0x5,0xff,0x5,0x99,0x44,0x1a,0x8,0x46,0xc1,
+    0x17,0xdb,0x2,0x46,0x77,0x2,0x7a,0xf8,0x6f,0x6,0xc1,0x17,0xfd,0x6,0xfd,0x1,
+    0x2,0xf0,0x72,0xf8,0xc0,0xf,0xf9,0x4a,0xf,0x0,0x35,0x2,0x2,0x9d,0x2e,0x68,
+    0xf7,0xfa,0x61,0x1,0xb0,0x61,0x1,0xb6,0x7,0x20,0x0,0xe1,0x57,0x17,0x22,0x0,
+    0x23,0x2,0x60,0x33,0xc,0x4,0x33,0x4,0xf3,0x58,0xf8,0xf5,0x3,0x13,0x6,0x28,
+    0x60,0x37,0x98,0xff,0x36,0x99,0xa,0x1,0x51,0x1a,0x88,0x42,0xff,0x68,0xd3,0x35,
+    0x98,0x1,0x46,0x28,0x31,0xfe,0x91,0x2,0xaa,0xfc,0x0,0x20,0x1,0x90,0x0,0xff,
+    0x26,0x0,0x27,0x38,0x9c,0x3,0x25,0x20,0xb7,0x68,0x40,0x10,0x81,0x0,0x0,0xb,
+    0x77,0x1,0x39,0xbe,0x3d,0x4,0x6,0x0,0xf,0x0,0x24,0xed,0x0,0xf1,0xfb,0xd1,
+    0x2,0x6f,0x1,0x32,0x0,0x3b,0x0,0x1,0xff,0xa8,0x2,0xf0,0x46,0xfe,0x1,0x98,
+    0x40,0xff,0x10,0x80,0x11,0x6f,0x49,0x40,0x18,0x7,0xff,0xf0,0x6e,0xff,0x80,0x1,
+    0x0,0x90,0x80,0xff,0x11,0x6d,0x49,0x88,0x42,0x5,0xda,0x49,0xff,0x1e,0x88,0x42,
+    0x6,0xdb,0x0,0x98,0x80,0xdf,0x6,0x3,0xd0,0x69,0x48,0xaf,0x2,0x30,0xe0,0xfd,
+    0x68,0x9b,0xd,0xcd,0xff,0x40,0x10,0x41,0x99,0xff,0xc9,0x69,0x40,0x18,0x42,0x10,
+    0x2,0x98,0x7f,0x1,0x90,0xd3,0x17,0x10,0x0,0x19,0x6d,0x0,0xff,0x2,0xf8,0x2,
+    0xf,0xc,0x1,0x22,0x43,0xff,0xb,0x17,0x5e,0xa4,0x30,0xcc,0xab,0x42,0xff,0x4,
+    0xdc,0x1,0xdb,0xa2,0x42,0x1,0xd2,0xff,0x22,0x46,0xf,0xe0,0x0,0x27,0xbb,0x42,
+    0x7d,0xb,0xf,0x4,0x8,0xd2,0xe6,0x43,0xbb,0x5d,0x0,0xff,0x1,0xdc,0xb2,0x42,
+    0x3,0xd3,0x2c,0x9,0xff,0x4,0x40,0x0,0xd0,0x6a,0x8,0x1,0x98,0xef,0x2,0x60,
+    0x55,0x49,0x59,0x1,0x68,0x7,0xf0,0xf3,0xe6,0xfd,0x71,0x2,0xdf,0x0,0xf0,0xc3,
+    0xf8,0x42,0xdf,0x9c,0x20,0x0,0x35,0x99,0xe5,0x2,0x37,0xfc,0xff,0x20,0x68,0x0,
+    0x21,0x88,0x42,0x14,0xda,0xff,0x80,0x23,0xdb,0x5,0xf,0x93,0x10,0x91,0xff,0x11,
+    0x91,0x12,0x91,0x20,0x0,0xf,0xa9,0xff,0x4,0x22,0x5,0x68,0x6b,0x42,0xb,0x60,
+    0xff,0x9,0x1d,0x0,0x1d,0x52,0x1e,0xf8,0xd1,0xfc,0x13,0x2,0x31,0x2,0x1e,0xfc,
+    0x39,0xb0,0xf0,0xbd,0xff,0xff,0xff,0xff,0x7f,0x30,0xb5,0x83,0xb0,0xef,0x14,0x0,
+    0x2,0x0,0xbd,0x2,0x96,0xff,0x68,0xd7,0x46,0x3,0xc8,0x51,0x7,0x36,0xed,0x0,
+    0x16,0xda,0xfd,0x38,0x5,0x0,0x13,0xdb,0x45,0x42,0x2a,0x0,0xff,0xc1,0x17,0xd3,
+    0x17,0x1,0xf0,0x9e,0xff,0xff,0xb,0x0,0x80,0x21,0x49,0x5,0x59,0x41,0xff,0x49,
+    0x10,0x2,0x22,0x20,0x0,0x7,0xf0,0xff,0x95,0xff,0x0,0x20,0x60,0x60,0xa5,0x60,
+    0xff,0x1,0x20,0x0,0xe0,0x0,0x20,0x3,0xb0,0xff,0x30,0xbd,0x0,0x0,0xb2,0x9d,
+    0xef,0x3f,0xbd,0x33,0x0,0x0,0x6a,0xf4,0x1d,0x1,0x5f,0x2,0x4,0xff,0x0,0x69,
+    0x46,0x1,0xf0,0x40,0xfc,0x0,0xff,0x25,0x2,0x95,0x69,0x46,0x20,0x0,0x1,0xf7,
+    0xf0,0xea,0xfc,0x7,0x2,0x28,0x30,0x1,0xf0,0xdb,0x35,0xfc,0x13,0x2,0x28,0x34,
+    0x15,0x2,0xdf,0xfc,0xfc,0x3f,0x2,0x31,0x2,0x0,0x25,0x0,0x95,0x1,0x69,0xff,
+    0x16,0x4c,0x11,0x4a,0x91,0x42,0x17,0xda,0xfb,0x2,0x22,0x9d,0x2,0x83,0xff,0x0,
+    0x98,0xc1,0xff,0x17,0xa0,0x22,0xd2,0x4,0x0,0x23,0x1,0xff,0xf0,0x59,0xff,0x40,
+    0xe,0xca,0x1,0x10,0xff,0x43,0x0,0x90,0x2,0x95,0x1,0x94,0x1,0xd3,0xaa,0x2,
+    0x7f,0x5,0x8d,0x0,0x90,0x87,0x0,0x94,0x0,0xfd,0x98,0x49,0x2,0xcd,0xcc,0xd8,
+    0xff,0x9b,0x99,0xff,0x13,0x0,0x60,0xe7,0xfb,0x1f,0x33,0x33,0xeb,0x27,0x0,0x0,
+    0x0,0x80,0xf3,0x0,0xff,0x68,0xa7,0xff,0xc1,0x3f,0xa9,0xf6,0x43,0x32,0x80,0xe7,
+    0xff,0xfb,0x7f,0x99,0x58,0x3e,0xc0,0x10,0xb5,0xff,0x4,0x0,0x6,0x23,0x4,0x22,
+    0x2,0x49,0xff,0x0,0x1d,0x6,0xf0,0xa3,0xfa,0x20,0x0,0xbf,0x10,0xbd,0xef,0xba,
+    0x0,0x0,0x17,0x16,0x97,0xfe,0x17,0x4,0x5f,0xc2,0x0,0x0,0xc,0xb4,0x2,0xf7,
+    0xb0,0x70,0x47,0x1d,0x2,0x21,0x0,0x48,0x31,0x7f,0x9,0x20,0x8,0x60,0x0,0x20,
+    0x48,0xa3,0x1,0xff,0x88,0x22,0x52,0x0,0xa2,0x18,0x3,0x23,0xff,0x13,0x60,0x50,
+    0x60,0x91,0x60,0xd0,0x60,0xff,0x96,0x21,0x49,0x0,0x61,0x18,0x8,0x60,0xff,0x88,
+    0x62,0xc8,0x62,0x8,0x63,0x48,0x63,0xff,0x88,0x63,0xc8,0x63,0x8,0x64,0x48,0x64,
+    0xff,0xba,0x20,0x40,0x0,0x20,0x18,0x3,0xf0,0xfb,0x9e,0xf8,0x51,0x2,0x10,0xb5,
+    0xa,0x0,0xb4,0xde,0x29,0x0,0x44,0x18,0xa0,0x68,0x65,0x7,0xeb,0xfe,0xf7,0x0,
+    0xf,0xa,0xdb,0x0,0x20,0x60,0x20,0x68,0xde,0x29,0x0,0x60,0x10,0xbd,0xf4,0x6b,
+    0x0,0xe,0x0,0xff,0x14,0x22,0x0,0x20,0x38,0x49,0x1,0xf0,0x7f,0x51,0xf8,0x1,
+    0xf0,0x89,0xf8,0x9c,0x33,0x0,0xef,0x60,0x50,0x9,0x1f,0x3,0x6,0x1,0x25,0x70,
+    0xff,0x11,0xa8,0x42,0x0,0xda,0x6e,0x1,0xf7,0x5f,0x17,0x30,0x0,0x39,0x0,0x27,
+    0x1,0x5,0x27,0x3,0x5f,0xc5,0xfe,0xc0,0xe,0x4a,0x4b,0x0,0xaa,0x8b,0x6,0xdd,
+    0x61,0x1b,0x2,0x32,0x0,0x3b,0x6d,0x1,0xb8,0xfe,0xff,0x26,0xa6,0xc0,0xce,0x36,
+    0x18,0x4f,0x41,0xff,0xb6,0xf,0xb8,0x0,0x6,0x43,0x2,0x22,0xb7,0x31,0x0,0xaa,
+    0x99,0x8,0xcc,0xf8,0x9,0x4,0x58,0xef,0xc1,0x17,0x20,0x4a,0x45,0x2,0xa2,0xfe,
+    0x40,0xf7,0xf,0xca,0x0,0x45,0x6,0x60,0x50,0xf0,0x0,0xbb,0x10,0x39,0x79,0xe,
+    0x0,0x98,0x40,0x79,0x0,0x1,0xa7,0xda,0x68,0x1,0x7b,0x1,0xa1,0x1,0x14,0x31,
+    0x4,0x89,0xde,0x31,0x10,0x61,0x18,0x48,0x60,0x59,0x6,0x42,0x68,0xdf,0xd3,0x17,
+    0x10,0x0,0x19,0x7d,0x0,0x79,0xfe,0x77,0x80,0xf,0x8a,0x1f,0x0,0xc0,0x0,0xa8,
+    0xc7,0x14,0xdb,0xf1,0xbd,0xa6,0x3,0xe0,0x3f,0x4,0x0,0x40,0x3d,0xf7,0xa,0x0,
+    0x0,0xae,0x1,0x7f,0x66,0x66,0x66,0xff,0x26,0x70,0xb5,0x92,0xb0,0x4,0x0,0xd,
+    0xff,0x0,0x9,0xa9,0x28,0x0,0x3,0xf0,0xa0,0xf7,0xf8,0x69,0x46,0x7,0x2,0xda,
+    0xf8,0xd,0x99,0xf7,0xc,0x98,0x81,0xf7,0x0,0x1,0x0,0xe,0x98,0xff,0x88,0x42,
+    0x0,0xdb,0x1,0x0,0x1,0x25,0x7f,0x8d,0x42,0x6,0xda,0x2,0x22,0xae,0xcb,0x8,
+    0xff,0x66,0xf8,0xe,0xe0,0x4,0x98,0x3,0x99,0xbe,0x1d,0x0,0xda,0x8,0x0,0x5,
+    0x99,0x2d,0x0,0xdb,0xff,0x8,0x0,0x85,0x42,0x31,0xda,0x40,0x10,0x5d,0xae,0x7b,
+    0x4,0x10,0x99,0xf,0x43,0x8,0x11,0x43,0x8,0x7f,0x8d,0x42,0x24,0xdb,0x7,0x98,
+    0x6,0x33,0x8,0xa5,0x8,0x33,0xc,0x17,0x33,0x8,0xd1,0x2,0xb0,0x5f,0x0,0x22,
+    0xff,0x58,0x0,0x1f,0x21,0x58,0x20,0x0,0xff,0xff,0xf7,0x2e,0xff,0x26,0x0,0x10,
+    0x36,0x30,0xfb,0x1d,0x98,0x1d,0x4,0x24,0x22,0x1,0xf0,0x6c,0xff,0xfa,0xf8,0x36,
+    0x35,0x70,0x12,0xb0,0x70,0xe7,0xbd,0x2,0x22,0x2b,0x2,0x8b,0x2,0x20,0xf8,0xe3,
+    0xff,0xe7,0x30,0xb5,0x89,0xb0,0xd,0x0,0x8,0xff,0x32,0x14,0x0,0xe0,0x68,0x3,
+    0x90,0x20,0xff,0x69,0x4,0x90,0x60,0x69,0x5,0x90,0x3,0xff,0x22,0x3,0xa9,0x3,
+    0xa8,0x5,0xf0,0x47,0xff,0xff,0xa0,0x69,0x0,0x90,0xe0,0x69,0x1,0xef,0x90,0x20,
+    0x6a,0x2,0x15,0x0,0x69,0x46,0x68,0xff,0x46,0x5,0xf0,0x3c,0xff,0x6a,0x46,0x3,
+    0xff,0xa9,0x6,0xa8,0x7,0xf0,0x33,0xfe,0x6,0xbf,0xa8,0x3,0xc8,0x80,0xe,0x8a,
+    0xd3,0x1,0x28,0xff,0x60,0x9,0xb0,0x30,0xbd,0xfc,0xb5,0x83,0xfe,0x19,0x1,0xf,
+    0x0,0x0,0x20,0xe0,0x60,0x3d,0xff,0x0,0xd8,0x35,0x28,0x68,0x0,0x28,0x1,0xff,
+    0xd1,0xb3,0x48,0xa,0xe0,0xc1,0x17,0x48,0xff,0x40,0x42,0x1a,0xa9,0xa0,0x3,0xc8,
+    0x2,0xbf,0xf0,0xf3,0xfa,0x29,0x68,0xc9,0xf,0x0,0x40,0x6f,0x1a,0xc1,0x17,0xa6,
+    0xa1,0x5,0xb8,0xfd,0xa1,0x7,0xff,0x1,0x11,0x96,0x22,0x52,0x0,0xa2,0x18,0xb7,
+    0x51,0x64,0xb8,0xbb,0x2,0x58,0xb4,0xd,0x0,0xa1,0x6f,0x50,0xc1,0x17,0x9e,0x25,
+    0x4,0xa5,0xfd,0xa7,0x7,0xfd,0x96,0xd7,0x4,0x8,0x64,0x38,0x0,0xb4,0x30,0xff,
+    0x0,0xf0,0x73,0xff,0x85,0x11,0x38,0x0,0xbd,0xa8,0x9,0x0,0x6e,0xff,0x86,0x11,
+    0xdd,0x2,0x25,0xff,0x50,0x0,0x1f,0x26,0x50,0x3,0x98,0x0,0xff,0x28,0x2f,0xd0,
+    0x0,0x20,0x3,0x99,0x9,0x7f,0x6b,0x88,0x42,0x11,0xda,0x48,0x10,0x37,0x8,0xbd,
+    0x63,0x19,0x0,0x6b,0xc1,0x17,0x8a,0x53,0x4,0x7b,0xea,0x53,0x8,0x86,0x55,0x1,
+    0x6,0xb7,0x0,0x3,0x99,0x49,0xff,0x6b,0x8b,0x10,0x98,0x42,0x3,0xdb,0x83,0xff,
+    0x42,0x10,0xdb,0x88,0x7,0xe,0xd0,0xc8,0xaa,0x37,0x8,0x48,0x37,0x0,0x40,0x37,
+    0x0,0x7c,0x37,0x4,0x5f,0xfb,0xfd,0x8d,0x31,0x0,0xd,0x0,0x2a,0x0,0x31,0xfd,
+    0x0,0x73,0x3,0x74,0xfe,0xd8,0x37,0x38,0x68,0xff,0x80,0x10,0x75,0x49,0x88,0x42,
+    0x2,0xdb,0x7f,0x80,0x20,0x80,0x0,0x6,0xe0,0x73,0xb,0x0,0xf3,0x39,0xda,0x5,
+    0x4,0x11,0x0,0xa0,0x60,0x80,0x8,0xff,0x60,0x60,0x40,0x8,0x20,0x60,0x0,0x20,
+    0xfd,0xda,0x51,0x4,0x3,0x26,0x3,0x22,0x8,0x60,0xff,0x9,0x1d,0x52,0x1e,0xfb,
+    0xd1,0xa0,0x68,0xff,0x61,0x68,0x22,0x68,0x27,0x0,0x10,0x37,0xff,0x9,0x23,0x3b,
+    0x60,0xba,0x62,0xf9,0x62,0xf7,0x38,0x63,0x38,0xc1,0x11,0x8b,0xf9,0x38,0x0,0xff,
+    0x38,0x30,0x0,0x21,0x41,0x60,0x9,0x21,0xff,0x1,0x60,0xf8,0x37,0x1,0x25,0x3d,
+    0x70,0x9f,0x7d,0x70,0x5d,0x4a,0x88,0xcd,0x5,0x17,0x2,0x6,0xff,0x60,0x82,0x60,
+    0xc1,0x60,0x3,0x0,0x10,0xef,0x33,0x8,0xe0,0x80,0x15,0x0,0xc6,0xe7,0x40,0xff,
+    0x20,0xc4,0xe7,0x0,0x26,0x1e,0x60,0x49,0xff,0x1c,0x1b,0x1d,0x6,0x68,0xb1,0x42,
+    0xf8,0x7f,0xd3,0x5c,0x48,0x0,0x90,0x69,0x46,0x33,0x6,0xbf,0x2,0xf0,0xb1,0xfe,
+    0x0,0x20,0xdb,0x2,0x60,0xfb,0x50,0xba,0x11,0x4,0x3,0x99,0x0,0x29,0x5,0xdb,
+    0xd0,0x38,0x6d,0x0,0x54,0xf9,0xe9,0x1,0x7c,0x1,0xbf,0xe0,0x2,0xf0,0xed,0xfe,
+    0xd8,0x51,0x3,0x54,0xdf,0x5,0xb0,0xf0,0xbd,0xf0,0xdd,0x1,0x1,0x25,0xff,0x0,
+    0x28,0x3,0xd5,0x0,0x25,0xed,0x43,0xdf,0x41,0x42,0x8,0x0,0x3e,0xdb,0x0,0xb,
+    0xdb,0xff,0x49,0x1c,0x88,0x42,0x8,0xdb,0x1d,0x22,0xfe,0x8,0x1,0x21,0x0,0xf0,
+    0x48,0xfe,0x0,0xf0,0xff,0x80,0xfe,0x4,0x0,0x4b,0xe0,0x6,0x1,0xff,0x37,0x48,
+    0x86,0x42,0x23,0xdb,0x36,0x48,0xff,0x37,0x49,0x37,0x4f,0x38,0x4c,0x0,0x90,0xff,
+    0x1,0x91,0x20,0x0,0xc1,0x17,0x32,0x0,0xbf,0xf3,0x17,0x1,0xf0,0xbe,0xfc,0xf3,
+    0x7,0xc0,0xf5,0x19,0x11,0xa,0xb5,0x11,0x8,0x1,0x99,0x40,0x18,0xfa,0x13,0xa,
+    0xab,0x13,0x8,0x0,0x99,0x22,0xe0,0x28,0xff,0x48,0x29,0x49,0x29,0x4f,0x2a,0x4c,
+    0x1,0x5b,0x90,0x0,0x47,0x0,0x0,0x21,0x21,0x6,0x9a,0x47,0x1c,0xe9,0x91,0x33,
+    0xc,0x47,0xe,0x87,0x5b,0xc,0x44,0x18,0x0,0x7f,0x20,0xc0,0x43,0x85,0x42,0x7,
+    0xd1,0xb1,0x2,0xff,0x18,0x49,0x0,0xf0,0xef,0xfd,0x0,0xf0,0x7f,0x27,0xfe,0x4,
+    0x1b,0x20,0x0,0x3,0xe5,0x0,0xfd,0x0,0x0,0x2,0x90,0xc2,0xf5,0x28,0x0,0xa3,
+    0x7f,0xd3,0x3c,0x9,0x66,0x66,0x66,0x4e,0x3,0x0,0xff,0x26,0x1,0x0,0xc0,0x12,
+    0x1,0x0,0x60,0xff,0x9,0x1,0x0,0xb0,0x4,0xff,0xff,0xff,0xf5,0x7f,0x13,0x0,
+    0x6,0x3,0x0,0x2a,0x66,0x79,0xa8,0xff,0x10,0x99,0x23,0x35,0xef,0x83,0x14,0xbc,
+    0xff,0x5,0xd0,0xd5,0x56,0xff,0xf5,0xbd,0x6,0xff,0x10,0xce,0xfd,0xd5,0xf2,0x93,
+    0xb9,0x43,0xff,0x1,0xb5,0xe1,0xf0,0x0,0x8f,0xc2,0xf5,0xff,0xfc,0x0,0x0,0xf0,
+    0x3f,0xfb,0xb5,0xb0,0xff,0xb0,0x10,0x0,0x0,0x25,0x0,0x21,0x99,0xef,0x73,0x32,
+    0x9a,0x51,0x3,0x0,0x11,0x73,0x27,0xff,0xac,0x31,0x9b,0xb2,0x4a,0x25,0x60,0x26,
+    0xff,0x0,0xc,0x36,0x0,0x96,0x6,0x68,0x0,0xff,0x2e,0xc,0xd0,0xe0,0x27,0x3f,
+    0x6,0xbe,0xff,0x42,0x2,0xda,0x80,0x26,0x36,0x6,0x5,0xff,0xe0,0x7f,0x42,0xbe,
+    0x42,0x1,0xdb,0x16,0xff,0x0,0x0,0xe0,0xb6,0x0,0x0,0x9f,0x3e,0x7f,0x60,0x1e,
+    0x68,0x76,0x10,0xa6,0x61,0xcf,0x3,0xff,0x0,0x1d,0x24,0x1d,0x3,0x29,0xe0,0xdb,
+    0xff,0x30,0x98,0xc0,0x68,0x40,0x1c,0x30,0x99,0xff,0xc8,0x60,0x14,0xaa,0x27,0xa9,
+    0x30,0x98,0xff,0x10,0x30,0x2,0xf0,0xa8,0xfe,0x30,0x98,0xff,0x48,0x30,0x2,0x90,
+    0x40,0x68,0x8,0x90,0xff,0x31,0x98,0x40,0x68,0x31,0x99,0x9,0x68,0xff,0x88,0x42,
+    0x0,0xda,0x8,0x0,0x31,0x99,0xff,0x89,0x68,0x81,0x42,0x0,0xdb,0x8,0x0,0xff,
+    0x1,0x26,0x80,0x10,0x86,0x42,0x9,0xdb,0xff,0x14,0xa9,0x24,0x31,0xd,0x70,0x8,
+    0x95,0xff,0x30,0x99,0x84,0x22,0x52,0x0,0x8e,0x54,0xff,0x32,0x99,0xe,0x73,0x14,
+    0xa8,0x24,0x30,0xff,0x0,0x78,0x0,0x28,0x0,0xd1,0x8d,0xe1,0xff,0x1e,0xa9,0x2,
+    0x98,0x2,0xf0,0x6c,0xfe,0x6f,0x22,0x98,0x21,0x99,0x43,0x6,0x23,0x99,0x41,0x6,
+    0xfe,0x31,0x6,0x8f,0x18,0xf9,0x6d,0x88,0x42,0x44,0xff,0xdb,0x5,0x95,0x8,0x98,
+    0xc1,0x3,0x2,0xff,0x22,0x5,0xa8,0x7,0xf0,0x40,0xfc,0x70,0xff,0x7,0xb,0x90,
+    0x8,0x98,0x80,0x3,0xc1,0x7f,0x17,0x6,0xaa,0x3,0xc2,0x78,0x6e,0x7,0x2,0xff,
+    0xc,0xca,0x1,0xf0,0xc4,0xfb,0xc0,0xd,0xff,0x4a,0x2,0x10,0x43,0x4,0x0,0xf8,
+    0x6c,0xdf,0xc1,0x17,0x5,0x9a,0xd3,0x99,0x1,0xba,0xfb,0xb7,0x80,0xf,0x8a,0x99,
+    0x1,0x3,0x90,0x13,0x2,0x2,0xfd,0x46,0x13,0x2,0xb0,0xfb,0x40,0xe,0xca,0x1,
+    0xff,0x10,0x43,0xc1,0x17,0x49,0x6,0xc2,0x9,0x7f,0x11,0x43,0x40,0x6,0x0,0x90,
+    0x1,0xf3,0x1,0xef,0xe1,0x17,0x22,0x0,0x1f,0x2,0xa0,0xfb,0x0,0x7f,0x9a,0x1,
+    0x9b,0x80,0x18,0x59,0x41,0x27,0x6,0xff,0x0,0x90,0x0,0x98,0x1,0x28,0x2d,0xda,
+    0x7f,0x0,0x24,0x44,0xe0,0x2,0x9a,0x3,0x7,0x1,0xff,0xff,0xf7,0x91,0xfd,0x5b,
+    0x4a,0x30,0x98,0xff,0x88,0x21,0x49,0x0,0x40,0x18,0x0,0x90,0xff,0x45,0x60,0x3,
+    0x21,0x1,0x60,0x82,0x60,0xff,0xc5,0x60,0x0,0x21,0x3,0x0,0x10,0x33,0xef,0x2,
+    0xe0,0x1d,0x60,0x47,0x3,0x4,0x68,0xa1,0xbf,0x42,0xf9,0xd3,0x3,0xa9,0x0,0xe5,
+    0x0,0x29,0xff,0xfd,0x32,0x99,0x8e,0x73,0x32,0x99,0x4e,0xde,0x3,0x0,0xce,0x73,
+    0x2,0x99,0x45,0x2,0x9,0xfd,0xff,0x3e,0x70,0x32,0x98,0x6,0x73,0x8,0xe1,0xff,
+    0x7,0x24,0x2,0xf0,0xc2,0xfe,0x21,0x1a,0xfe,0xf9,0x0,0x40,0xc,0x18,0x6,0x20,
+    0x1,0x1b,0xff,0x0,0x98,0x0,0xf0,0x3a,0xfc,0x2,0x21,0xff,0x3,0xf0,0xe0,0xf8,
+    0xb1,0x7,0x89,0x1b,0xfc,0x17,0x1,0x1f,0x1,0x61,0x10,0x49,0x1f,0x0,0xf0,0xff,
+    0x2e,0xfc,0x4,0x0,0x18,0x99,0x17,0x98,0xde,0x13,0x2,0x1,0x0,0x19,0x98,0x3b,
+    0x1,0xdb,0x1,0xff,0x0,0xa,0x95,0x2,0x22,0xa,0xa8,0x2,0xff,0xf0,0x62,0xfd,
+    0xa,0x98,0x0,0x1b,0x10,0xff,0x90,0x4,0x95,0x3,0x98,0x0,0x28,0x1,0xff,0xd1,
+    0x31,0x48,0x4,0xe0,0x2,0x46,0x0,0xff,0x20,0x31,0x2,0x2,0xf0,0x5a,0xf8,0x4,
+    0xff,0x90,0x9,0x95,0x4,0xaa,0x10,0xa9,0x9,0xff,0xa8,0x5,0xf0,0xb9,0xf8,0x9,
+    0x98,0x40,0xff,0x10,0xff,0xf7,0x41,0xfe,0xc,0x90,0x38,0x5a,0x47,0xd,0x20,0x47,
+    0xd,0x38,0x6d,0x47,0xb,0x16,0x47,0x9,0xff,0x7,0x90,0x3,0x95,0x3a,0x6d,0xd3,
+    0x17,0x7f,0x10,0x0,0x19,0x0,0x1,0xf0,0xb,0x49,0x39,0xfb,0xfb,0xfa,0x49,0x17,
+    0x3,0x90,0x2,0x22,0x3,0xfb,0x99,0x3,0x79,0x0,0x4f,0xf8,0x1b,0x99,0x1a,0xaa,
+    0xbf,0x8,0x1c,0xbf,0x8,0x6,0xbf,0x0,0x6,0xbf,0x0,0x2,0xff,0xfd,0x3,0x98,
+    0x6,0x99,0x9,0x1a,0xf,0xef,0x91,0x0,0x95,0x7,0xc1,0x0,0x3,0xd1,0x0,0x7f,
+    0x48,0x6,0xe0,0xff,0xff,0xff,0x7f,0xc5,0x6,0xef,0x1,0xf0,0xf7,0xff,0x67,0x0,
+    0x95,0x6a,0x46,0x77,0xf,0xa9,0x1,0x4b,0x0,0x56,0xf8,0x1,0xc5,0x4,0xff,0xde,
+    0xfd,0xd,0x90,0xb,0x98,0xc1,0x17,0x7d,0xc,0xb1,0x4,0xbd,0xfa,0x40,0xf,0xca,
+    0xb1,0x0,0xd7,0xc1,0x17,0xd,0xf,0x4,0xb5,0xf,0x8,0x4,0x0,0xff,0x71,0x7,
+    0x8c,0x42,0x5f,0xda,0x1,0x2c,0xfd,0x0,0xd1,0x1,0xa2,0x1b,0x20,0x0,0xc1,0x17,
+    0xfa,0x1f,0x2,0xa5,0x1f,0xc,0x32,0x98,0x84,0x60,0x29,0xff,0x48,0x84,0x42,0x3d,
+    0xdb,0x2,0x9a,0x11,0xde,0xed,0x5,0x9a,0xfc,0x22,0x0,0x9,0x2,0x88,0x23,0xff,
+    0x5b,0x0,0xc0,0x18,0x2,0xf0,0x43,0xfc,0xfe,0xcb,0x5,0x98,0xc6,0x73,0x1a,0x21,
+    0x11,0x98,0xff,0x5,0xf0,0x8b,0xf9,0x4,0x0,0x1d,0x21,0xfd,0xd,0x9,0x0,0x86,
+    0xf9,0xe,0x90,0x1d,0x21,0xdd,0xc,0x9,0x0,0x81,0xf9,0x7,0x13,0x0,0x70,0x7,
+    0xff,0x5,0xf0,0x7c,0xf9,0x6,0x0,0x20,0x0,0xff,0x5,0xf0,0xb0,0xf9,0x6,0x90,
+    0x7,0x91,0xfd,0xe,0x1b,0x0,0xab,0xf9,0x4,0x90,0x5,0x91,0xfd,0x38,0x13,0x0,
+    0xa6,0xf9,0x2,0x90,0x3,0x91,0xed,0x30,0x9,0x0,0xa1,0xf9,0x3b,0x3,0x8,0x9a,
+    0xb,0xff,0xa1,0x1,0x20,0xff,0xf7,0x42,0xfb,0x14,0xdf,0xa8,0x26,0x30,0x0,0x78,
+    0xbf,0x3,0x32,0x98,0xff,0xc5,0x73,0x30,0x98,0x90,0x21,0x49,0x0,0xff,0x40,0x58,
+    0x0,0x1,0x32,0x99,0x8,0x60,0xff,0x33,0xb0,0xf0,0xbd,0xc,0x0,0xa0,0xe7,0xff,
+    0xce,0xcc,0xcc,0x4,0x49,0x73,0x20,0x53,0xff,0x74,0x61,0x62,0x6c,0x65,0x3a,0x20,
+    0x25,0xff,0x34,0x64,0x20,0x73,0x61,0x6d,0x70,0x6c,0xff,0x65,0x73,0x2c,0x20,0x57,
+    0x65,0x69,0x67,0xff,0x68,0x74,0x3a,0x20,0x5b,0x25,0x35,0x2e,0xef,0x32,0x66,0x2c,
+    0x20,0x6,0x12,0x5d,0x20,0x2d,0xfd,0x3e,0x9,0x2,0x34,0x66,0x0,0x0,0x0,0x21,
+    0xff,0x1,0x60,0x41,0x60,0x81,0x60,0x70,0x47,0xff,0x30,0xb4,0x1,0x21,0x0,0x22,
+    0x3,0x68,0x7f,0x0,0x1d,0x0,0x2b,0xb,0xd0,0x4,0x7,0x0,0xff,0xc,0x42,0x2,
+    0xd0,0x4d,0x46,0x6d,0x1e,0xff,0x64,0x19,0x22,0x60,0x24,0x1d,0x1b,0x1f,0xff,0xf0,
+    0xd0,0xfa,0xe7,0x30,0xbc,0x70,0x47,0xff,0x10,0xb5,0x4,0x0,0x0,0x20,0x80,0x21,
+    0xff,0xc9,0x5,0x21,0x60,0x60,0x60,0xa0,0x60,0xff,0xe0,0x60,0x6,0x23,0x4,0x22,
+    0x83,0x49,0xff,0x20,0x0,0x14,0x30,0x5,0xf0,0x77,0xfd,0xff,0x20,0x0,0x10,0xbd,
+    0x0,0x21,0x80,0x22,0xf7,0xd2,0x5,0x2,0x5b,0x4,0xc1,0x60,0x2,0x60,0xff,0x1,
+    0x21,0x1,0x74,0xc1,0x62,0x70,0x47,0xff,0xfe,0xb5,0x9a,0xb0,0x7,0x0,0x1,0xaa,
+    0xff,0x22,0x99,0x0,0xf0,0xf5,0xf8,0x0,0x20,0xff,0xb,0xa9,0x1,0xaa,0x4,0x23,
+    0x14,0x68,0xff,0xe5,0x10,0x1c,0x40,0x0,0xd0,0x6d,0x1c,0xff,0xd,0x60,0x40,0x1c,
+    0x12,0x1d,0x9,0x1d,0xff,0x3,0x28,0xf4,0xdb,0xde,0x3,0x1a,0x98,0xff,0x40,0x12,
+    0x74,0x42,0x36,0x18,0xe5,0x17,0xff,0xad,0x7,0xa0,0x8,0x5,0x43,0x0,0x2e,0xff,
+    0x1,0xd1,0x6a,0x48,0x17,0xe0,0xe8,0x17,0xff,0xe9,0x17,0x14,0xaa,0x3,0xc2,0xf0,
+    0x17,0xff,0x1,0x0,0x71,0x40,0xa,0x1a,0x94,0x46,0xff,0x14,0xa8,0x3,0xc8,0x69,
+    0x40,0x14,0xaa,0xff,0xc,0xca,0x80,0x1a,0x99,0x41,0x62,0x46,0xff,0x1,0xf0,0xee,
+    0xfe,0xec,0x17,0xf1,0x17,0xff,0x61,0x40,0x48,0x40,0x40,0x1a,0x0,0x90,0xdf,0x3e,
+    0x0,0x10,0x36,0x30,0x4f,0x1,0xe,0xd1,0xff,0x1a,0x98,0xc1,0x17,0x5a,0x4a,0x0,
+    0x23,0xf9,0x1,0x87,0x1,0xf3,0x7,0x1,0x1,0x8,0x1a,0x40,0xff,0x0,0x1b,0x99,
+    0x88,0x42,0xc,0xd2,0xb,0xef,0xa8,0x31,0x1d,0x3,0x5,0x1,0xb,0x60,0x3,0xff,
+    0x68,0x4b,0x60,0x8,0x31,0x0,0x1d,0x52,0xff,0x1e,0xf7,0xd1,0x0,0x20,0x30,0x70,
+    0xb,0xff,0xad,0x36,0x1d,0x3,0x24,0x0,0x98,0x32,0x7f,0x0,0x29,0x0,0x1,0xf0,
+    0x53,0xfc,0x9,0x0,0xfd,0x1d,0x9,0x2,0x4e,0xfc,0x8,0x36,0x2d,0x1d,0xff,0x64,
+    0x1e,0xf1,0xd1,0x3,0x22,0xb,0xa9,0xff,0xb,0xa8,0x7,0xf0,0xa,0xfa,0x1,0xa8,
+    0xfb,0xb,0xa9,0xd,0x0,0x68,0xdb,0x0,0x3,0x60,0xfb,0x9,0x1d,0x43,0x2,0xf8,
+    0xd1,0xf8,0x6a,0x1,0xff,0x28,0x1c,0x98,0x4,0xd1,0x3c,0x49,0x88,0xff,0x42,0x7,
+    0xda,0x2,0x20,0x4,0xe0,0xf0,0xff,0x21,0xc9,0x4,0x88,0x42,0x1,0xdb,0x1,0xbf,
+    0x20,0xf8,0x62,0x23,0x9d,0x28,0x4b,0x0,0x5,0xff,0xfa,0x1,0x24,0x84,0x42,0x5,
+    0xda,0x3,0xf7,0x22,0x11,0xa9,0xf,0x2,0xc7,0xff,0xe,0xe0,0xff,0xc0,0x20,0x0,
+    0x6,0x0,0x21,0x8,0x91,0xff,0x9,0x91,0xa,0x90,0x8,0xaa,0x39,0x0,0xfd,0x16,
+    0x61,0x0,0x7a,0xfa,0x11,0xa8,0x16,0xa9,0xdf,0x2c,0xc9,0x2c,0xc0,0x24,0x37,0x0,
+    0x2,0xf0,0xff,0x3c,0xf8,0x41,0x10,0x8c,0x42,0x12,0xdb,0xfd,0xa1,0x4d,0x0,0xc0,
+    0x7,0xe,0xd4,0x0,0x20,0xff,0xa2,0x7,0x1,0x92,0x2,0x90,0x3,0x90,0xf5,0x1,
+    0x31,0x0,0x8,0x31,0x0,0x61,0xfa,0xe,0xa8,0xff,0x8,0xa9,0x1c,0xc9,0x1c,0xc0,
+    0x4,0xe0,0xf7,0x3,0x22,0xe,0x5d,0x0,0x2,0xf0,0x41,0xf8,0xfe,0x93,0x2,0x6,
+    0xd1,0x3b,0x0,0xe,0xaa,0x11,0xff,0xa9,0x1,0xa8,0x2,0xf0,0xbc,0xf8,0x5,0xfd,
+    0xe0,0xd,0xe,0xf,0xfa,0x38,0x68,0x4,0x90,0xff,0x78,0x68,0x5,0x90,0xb8,0x68,
+    0x6,0x90,0xff,0xf8,0x68,0x7,0x90,0x4,0x22,0x4,0xa9,0xfd,0x4,0x4d,0x0,0x5c,
+    0xf8,0x4,0x98,0x38,0x60,0xff,0x5,0x98,0x78,0x60,0x6,0x98,0xb8,0x60,0xff,0x7,
+    0x98,0xf8,0x60,0x25,0x98,0x39,0x0,0xff,0x10,0x22,0x0,0xf0,0x65,0xfd,0x1d,0xb0,
+    0xff,0xf0,0xbd,0x0,0x0,0x5f,0xc2,0x0,0x0,0xff,0xff,0xff,0xff,0x7f,0x40,0x42,
+    0xf,0x0,0xff,0x1,0x0,0x0,0x5,0x38,0xb5,0xd,0x0,0xff,0x14,0x0,0x2a,0x0,
+    0xeb,0x17,0x10,0x0,0x7d,0x19,0xd9,0x0,0xed,0xf8,0xc0,0xf,0x4a,0x7b,0x1,0xff,
+    0x80,0x21,0x89,0x5,0x9,0x1a,0x2,0x22,0xff,0x20,0x0,0x7,0xf0,0x3e,0xfa,0x0,
+    0x20,0xff,0x60,0x60,0x68,0x42,0xa0,0x60,0x31,0xbd,0xff,0xf6,0xb5,0x85,0xb0,0xa0,
+    0x20,0xc0,0x4,0xff,0x83,0x42,0x12,0xda,0x18,0x0,0xd9,0x17,0xfd,0x8d,0xb1,0x5,
+    0xd2,0xf8,0x82,0xf,0x8c,0x0,0xff,0x22,0x43,0x8b,0x17,0x8b,0xa4,0x30,0xcc,0xff,
+    0xab,0x42,0x6,0xdc,0x1,0xdb,0xa2,0x42,0xff,0x3,0xd2,0x0,0x94,0x14,0xe0,0x8b,
+    0x48,0x7f,0xf,0xe0,0x0,0x27,0xbb,0x42,0xb,0x13,0x4,0xff,0x8,0xd2,0xe6,0x43,
+    0xbb,0x42,0x8,0xdb,0xff,0x1,0xdc,0xb2,0x42,0x5,0xd3,0xac,0x8,0xff,0x4,0x40,
+    0x2,0xd0,0x68,0x8,0x0,0x90,0xff,0x0,0xe0,0x0,0x92,0xd,0x98,0xc,0x9c,0xff,
+    0x21,0x0,0x2,0xaa,0x3,0x23,0x5,0x68,0xff,0xe,0x68,0x76,0x1b,0x16,0x60,0x12,
+    0x1d,0xfe,0xa5,0x3,0x5b,0x1e,0xf6,0xd1,0x2,0xa8,0x6,0xdf,0xf0,0xa6,0xfc,0x45,
+    0x0,0x74,0x1,0xf0,0xa2,0xff,0xfc,0x42,0x0,0x1,0xd1,0x70,0x4c,0x5,0xfb,0xe0,
+    0x80,0x83,0x5,0x1,0xf0,0xba,0xfd,0x4,0xff,0x0,0x5,0x98,0x0,0x28,0x1,0xd1,
+    0x6a,0xdf,0x48,0x5,0xe0,0x2,0x46,0x17,0xa,0xae,0xfd,0xff,0x1,0x90,0x28,0x0,
+    0xe9,0x17,0x22,0x0,0xff,0xe3,0x17,0x1,0xf0,0x7f,0xf8,0xc2,0x9,0x7f,0x4c,0x6,
+    0x22,0x43,0xcb,0x11,0x62,0xa5,0x4,0x7d,0x4,0x91,0x4,0x1,0xd2,0x20,0x46,0x11,
+    0xa1,0x1c,0xfd,0x7,0xa1,0x4,0x4,0xd3,0x7f,0x24,0x4,0x40,0xfd,0x1,0xa1,0x2,
+    0xe0,0x10,0x0,0xc1,0x17,0x6,0xfb,0x9a,0xd3,0x47,0x0,0x5b,0xf8,0x2,0xd,0xc,
+    0xff,0x3,0x22,0x43,0xb,0x15,0x80,0x24,0x24,0xdf,0x6,0x0,0x25,0xed,0x43,0x4b,
+    0x46,0x2c,0xb,0xfa,0x4b,0x12,0x1,0x4b,0x4,0x35,0xf8,0x82,0x8,0x8c,0xe5,0x7,
+    0x39,0x1,0x10,0x4b,0xe,0x3d,0xd,0x22,0xfe,0x23,0xd7,0x1b,0x6,0x16,0x3d,0x2d,
+    0x3,0x9b,0x0,0x2,0xd0,0xff,0x31,0xa2,0xc,0xca,0x4,0xe0,0xd3,0x17,0xff,0x9b,
+    0x6,0x90,0x9,0x3,0x43,0x92,0x6,0xff,0x50,0xe,0xdc,0x1,0x20,0x43,0x59,0x16,
+    0x4a,0x4f,0xa,0xa9,0x9b,0x4,0xa0,0x9b,0x4,0x89,0x3,0xb9,0x4b,0x4,0xdd,0xa0,
+    0x4b,0x4,0xb9,0x42,0x6,0x4b,0x0,0xb0,0x42,0x7f,0x3,0xd3,0xec,0x9,0x14,0x40,
+    0x0,0x9b,0x2,0xff,0x21,0x0,0x22,0x0,0x23,0x0,0x9c,0x0,0xff,0x2c,0x0,0xd0,
+    0x22,0x46,0x0,0x28,0xc,0xfb,0xd0,0xf8,0x83,0x0,0x98,0x42,0x2,0xda,0x80,0xfe,
+    0x7,0x0,0x5,0xe0,0x5b,0x42,0x98,0x42,0x1,0xfb,0xdb,0x6b,0xc3,0x0,0x3,0x1,
+    0xd4,0x18,0xe,0xff,0x98,0x4,0x60,0x6,0xd4,0x0,0x2a,0xa,0xff,0xd5,0x0,0x2b,
+    0x8,0xd5,0x80,0x22,0x12,0xff,0x6,0x4,0xe0,0x0,0x2a,0x3,0xd4,0x0,0xff,0x2b,
+    0x1,0xd4,0x6a,0x8,0x2,0x60,0xc,0xff,0x4a,0x3,0x68,0x93,0x42,0x5,0xda,0x99,
+    0xff,0x42,0x0,0xda,0x19,0x46,0x1,0x60,0x7,0xff,0xb0,0xf0,0xbd,0x11,0x0,0xfa,
+    0xe7,0x0,0xff,0x0,0x89,0x1a,0x7d,0x47,0xff,0xff,0xff,0x5f,0x7f,0x0,0x0,0x0,
+    0x80,0x7,0x0,0xff,0x7,0x0,0xfd,0xfc,0x6,0x0,0x1,0xa9,0xf6,0x43,0x32,0x38,
+    0xff,0xb5,0x4,0x0,0x8,0x0,0x0,0xf0,0x71,0xff,0xf8,0x5,0x0,0x2,0xd1,0xc,
+    0x20,0xc0,0xff,0x43,0x32,0xbd,0xe8,0x21,0x0,0xf0,0x1d,0xff,0xfc,0xdc,0x21,0x60,
+    0x50,0xc,0x35,0x29,0xfb,0x0,0x20,0x1d,0x0,0x1,0xf8,0x32,0xbd,0x70,0xfe,0x29,
+    0x0,0xd8,0x22,0x0,0xf0,0xf6,0xfb,0x20,0xff,0x0,0xd4,0x30,0xd8,0x34,0x2,0x68,
+    0x0,0xff,0x2a,0x2,0xd1,0x21,0x48,0x20,0x60,0xd,0xff,0xe0,0x0,0x20,0x80,0x21,
+    0x9,0x4,0xd3,0xff,0x17,0x5,0xf0,0x58,0xfa,0x42,0x8,0xcd,0xbf,0x7,0x2a,0x43,
+    0x1,0x26,0x6,0xe3,0x0,0x52,0xff,0x1c,0x22,0x60,0x0,0x20,0x70,0xbd,0xf0,0xf7,
+    0xb5,0x93,0xb0,0x67,0x2,0x9,0xa9,0x7,0xf0,0xff,0xf0,0xf8,0x21,0x0,0xc,0x31,
+    0x68,0x46,0xff,0x7,0xf0,0xaa,0xf9,0x6d,0x46,0x27,0x0,0xdf,0xc,0x37,0x3,0x26,
+    0x2a,0x19,0x0,0x38,0x0,0xff,0x7,0xf0,0xad,0xf9,0xc,0x37,0xc,0x35,0x7f,0x76,
+    0x1e,0xf6,0xd1,0x21,0x0,0x3c,0x23,0x4,0xff,0xcb,0xf9,0x6a,0x46,0x9,0xa9,0x20,
+    0x0,0xff,0x3c,0x30,0x7,0xf0,0xd1,0xf9,0x21,0x0,0x75,0x6c,0x15,0x4,0xc0,0x15,
+    0x4,0x6c,0x34,0x20,0x33,0x0,0xe7,0xc6,0xf9,0x13,0xe9,0x0,0xdf,0x4,0x21,0x2,
+    0x0,0xf7,0xe8,0x32,0x90,0x6d,0x1,0x3,0x68,0xc9,0x18,0xff,0x0,0x1d,0x90,0x42,
+    0xfa,0xd3,0x48,0x1e,0xff,0x80,0x41,0xc0,0xf,0x70,0x47,0x1,0x20,0xf7,0x70,0x47,
+    0x10,0xc1,0x0,0xd,0xd0,0x0,0xf0,0xbf,0x39,0xf8,0xe8,0x28,0x9,0xd1,0xd7,0x2,
+    0x35,0xef,0xf8,0xa,0x28,0x4,0x9,0x0,0xff,0xf7,0xe1,0xff,0xff,0x0,0x28,0x1,
+    0xd1,0x0,0x20,0x10,0xff,0xbd,0x20,0x0,0x10,0xbd,0x0,0x29,0x1,0xff,0xd4,0x88,
+    0x40,0x70,0x47,0x4a,0x42,0x20,0x5f,0x2a,0x1,0xdb,0xc0,0x17,0x3b,0x0,0x41,0x3f,
+    0x2,0xfd,0x84,0xc5,0x0,0x20,0x68,0x0,0x90,0x60,0x68,0xff,0x1,0x90,0xa0,0x68,
+    0x2,0x90,0xe0,0x68,0xff,0x3,0x90,0x4,0x22,0x69,0x46,0x68,0x46,0xff,0x6,0xf0,
+    0x54,0xfe,0x0,0x98,0x20,0x60,0xff,0x1,0x98,0x60,0x60,0x2,0x98,0xa0,0x60,0xff,
+    0x3,0x98,0xe0,0x60,0x20,0x0,0x4,0xb0,0xfe,0x4b,0x0,0x21,0x1,0x60,0x70,0x47,
+    0x4,0xe0,0xff,0x1,0x0,0x88,0x78,0xca,0x78,0x3,0xe0,0xff,0x0,0xbf,0x1,0x0,
+    0x8,0x78,0x4a,0x78,0xff,0x12,0x6,0x12,0xc,0x10,0x43,0x0,0xb2,0xbc,0x9b,0x0,
+    0x19,0x4,0xf6,0xe7,0xf2,0xe7,0x9,0x6,0xf1,0xdb,0xe7,0xed,0x9,0x8,0xec,0xe7,
+    0xb3,0x2,0x14,0xd0,0xff,0x20,0x78,0x61,0x78,0x9,0x6,0x9,0xc,0xff,0x8,0x43,
+    0x44,0x28,0xd,0xd1,0xa0,0x78,0xfd,0xe1,0xd,0x8,0xc,0x28,0x6,0xd1,0x40,0x21,
+    0xfe,0xc9,0x2,0x45,0xfb,0x21,0x6c,0x88,0x42,0x1,0xe9,0xd0,0xc1,0xa,0x37,0x2,
+    0x15,0x37,0x10,0xc0,0x28,0xe,0xbe,0x37,0x10,0x14,0x28,0x7,0xd1,0xbc,0x37,0x4,
+    0x29,0xdf,0xfb,0xbc,0x21,0x61,0x58,0x39,0x12,0x0,0x21,0xff,0x3,0x22,0x1,0x60,
+    0x0,0x1d,0x52,0x1e,0xff,0xfb,0xd1,0x70,0x47,0x0,0xb5,0xc2,0x68,0xff,0x1,0x2a,
+    0x0,0xda,0x2,0x68,0x10,0x0,0xff,0xd1,0x17,0x4,0x4a,0x0,0x23,0x0,0xf0,0xbf,
+    0x91,0xfe,0x40,0xd,0xca,0x2,0xbb,0x0,0xbd,0xff,0x0,0xbf,0x83,0xde,0x1b,0x43,
+    0x12,0x42,0xff,0x19,0xd4,0x0,0x23,0xdb,0x43,0x5b,0xd,0xff,0x9c,0x46,0x4b,0x0,
+    0x5b,0xd,0x6,0xd0,0xff,0x63,0x45,0x4,0xd0,0x9b,0x18,0x63,0x45,0xff,0x2,0xd2,
+    0x12,0x5,0x89,0x18,0x70,0x47,0xff,0x62,0x46,0x9,0xd,0x11,0x43,0x9,0x5,0xff,
+    0x0,0x20,0x7,0xb5,0x7,0xf0,0xfd,0xf8,0xbd,0x22,0x13,0x1,0x7,0xbd,0x52,0x42,
+    0x2d,0x2,0xef,0xff,0xd0,0x5b,0x1c,0x5b,0x5,0xec,0xd2,0x5b,0xdf,0xd,0x93,0x41,
+    0x2,0xd9,0x2f,0x0,0x1a,0x70,0xff,0x47,0xb,0xd1,0xb,0x3,0x1b,0x13,0xc9,0xff,
+    0xf,0xc9,0x7,0x82,0x1c,0x0,0x20,0x43,0xef,0x41,0x13,0x43,0xe2,0x19,0x0,0x11,
+    0x43,0xdf,0xfd,0xe7,0x13,0x2,0x0,0x20,0xdb,0xe7,0xf4,0x46,0xff,0x4a,0x18,0x5,
+    0xd2,0x0,0xf0,0xf,0xf8,0xff,0x1,0xd5,0x80,0x17,0x40,0x8,0x60,0x47,0xff,0x0,
+    0xf0,0x9,0xf8,0x1,0x21,0xc9,0x7,0xff,0x88,0x42,0x0,0xd9,0x8,0x0,0x40,0x42,
+    0xff,0x60,0x47,0x4a,0x18,0x12,0xd2,0x40,0xd,0xef,0xc9,0x2,0x8,0x43,0x17,0x2,
+    0x8,0x43,0x52,0xff,0xd,0x40,0x21,0x9,0x1,0x52,0x1a,0x52,0xff,0x1c,0x6,0xd4,
+    0x52,0x42,0x1f,0x32,0x1,0xb3,0xd4,0xd0,0xe3,0x1,0xdd,0x3,0x0,0x20,0xdd,0x1,
+    0xb4,0xff,0x1,0x68,0xa,0x0,0x0,0x1d,0x2,0x23,0xff,0x4,0x68,0x8c,0x42,0x0,
+    0xdb,0x21,0x46,0xfd,0xa2,0x5,0x0,0x22,0x46,0x0,0x1d,0x5b,0x1e,0xff,0xf5,0xd1,
+    0x80,0x20,0x0,0x6,0x82,0x42,0xff,0x1,0xd1,0xc0,0x43,0x8,0xe0,0xd3,0x17,0xff,
+    0x5a,0x40,0xd0,0x1a,0xca,0x17,0x51,0x40,0xf7,0x89,0x1a,0x81,0x23,0x0,0x8,0x0,
+    0x10,0xbc,0xf4,0x43,0x0,0xe7,0x5,0xf8,0x77,0x3,0x0,0x8,0x68,0xc1,0xff,0x17,
+    0x9,0x5,0x2,0xb,0x11,0x43,0x0,0xff,0x5,0x2b,0x68,0x0,0x2b,0x1,0xd1,0xa,
+    0xff,0x48,0x10,0xe0,0xce,0x17,0xcf,0x17,0xda,0xff,0x17,0x53,0x40,0x9a,0x1a,0x70,
+    0x40,0x79,0xff,0x40,0x3b,0x0,0x80,0x1b,0x99,0x41,0x1,0xff,0xf0,0x1c,0xfb,0x29,
+    0x68,0xc9,0x17,0x71,0xff,0x40,0x48,0x40,0x40,0x1a,0x20,0x60,0x20,0x7f,0x0,0xf2,
+    0xbd,0xff,0xff,0xff,0x7f,0x57,0x6,0xef,0x70,0x47,0xf1,0xb5,0x4b,0x2,0x12,0x68,
+    0xd3,0xff,0x17,0x0,0xf0,0xd5,0xfd,0x2,0xd,0xc,0xff,0x3,0x22,0x43,0xb,0x15,
+    0xe,0xa4,0x30,0xff,0xcc,0xab,0x42,0x4,0xdc,0x1,0xdb,0xa2,0xff,0x42,0x1,0xd2,
+    0x22,0x46,0xf,0xe0,0x0,0xef,0x27,0xbb,0x42,0xb,0xf,0x4,0x8,0xd2,0xe6,0xff,
+    0x43,0xbb,0x42,0x6,0xdb,0x1,0xdc,0xb2,0xff,0x42,0x3,0xd3,0x2c,0xb,0x4,0x40,
+    0x0,0xff,0xd0,0x6a,0x8,0x0,0x98,0x2,0x60,0x0,0x7f,0x98,0xf2,0xbd,0x0,0x0,
+    0x0,0x80,0x5f,0x0,0xd1,0xff,0x25,0x1,0x5f,0x4,0xdf,0xb,0x82,0xdf,0x11,0xa1,
+    0xfd,0xfe,0xdf,0x17,0xf5,0xb5,0x9d,0xb0,0xc,0x0,0x68,0xff,0x46,0x7,0xf0,0x28,
+    0xf8,0x68,0x46,0x3,0xff,0xc8,0xc0,0xf,0x4a,0x0,0x10,0x43,0x69,0xff,0x49,0x88,
+    0x42,0x3,0xdb,0x68,0x48,0x1e,0xff,0x99,0xc8,0x60,0xc4,0xe0,0x89,0x8,0x9,0xff,
+    0x1a,0x8,0x91,0x21,0x68,0x48,0x42,0x40,0xef,0x0,0x4,0x90,0x61,0x7,0x4,0x5,
+    0x90,0xa1,0xfe,0x7,0x4,0x6,0x90,0x80,0x20,0x40,0x4,0x7,0xff,0x90,0x0,0x20,
+    0x3,0x90,0x1,0x90,0x4,0xff,0xa8,0x2,0x90,0x1d,0x98,0x3,0x99,0x89,0xbf,0x0,
+    0x45,0x18,0x4,0xa8,0x1,0x7,0x0,0x47,0xff,0x18,0x4,0x20,0x1,0x99,0x46,0x1a,
+    0x28,0xff,0x68,0x56,0x49,0x5,0xf0,0x59,0xff,0x4,0xff,0x0,0x2c,0x60,0x2f,0x21,
+    0xc9,0x43,0x0,0xaf,0x91,0x2,0x98,0x0,0xfd,0x0,0x3a,0xfd,0x4,0x56,0xff,0xfd,
+    0x6,0xf0,0x7c,0xf9,0x0,0x99,0x6,0xff,0xf0,0x9f,0xf9,0x21,0x0,0x5,0xf0,0xa6,
+    0xff,0xfc,0x28,0x60,0x3,0x98,0x40,0x1c,0x3,0xff,0x90,0x3f,0x1d,0x2d,0x1d,0x76,
+    0x1e,0xdf,0xdb,0xd1,0x1,0xd,0x0,0x1,0x90,0x33,0x0,0x1d,0x2,0xff,0x90,0x1,
+    0x98,0x4,0x28,0xcb,0xdb,0x0,0xff,0x27,0x1d,0x9d,0x28,0x35,0x4,0xae,0x28,0xab,
+    0x68,0x3f,0x59,0x0,0x2c,0x59,0x4,0x26,0x59,0x4,0x30,0x56,0x57,0x0,0x8,0x9a,
+    0x57,0x2,0x2a,0x57,0x0,0x50,0x57,0x4,0x5f,0x73,0xf9,0x1,0x0,0x20,0x59,0x0,
+    0x79,0x59,0x0,0xf7,0x7f,0x1c,0x36,0x55,0x0,0x4,0x2f,0xe1,0xdb,0xfe,0x12,0x0,
+    0x90,0xc,0xa9,0xc,0xaa,0x1d,0x9b,0xff,0x84,0x0,0x1b,0x19,0x0,0x9c,0xa4,0x0,
+    0xff,0x14,0x19,0x0,0x9d,0x2d,0x1,0x4d,0x19,0xff,0x4,0x26,0x0,0x9f,0xf6,0x1b,
+};
+
+static const uint8_t dfuStream_1_7_0_390_page1[30000] PROGMEM = {
+    0x1f,0x68,0xff,0x2f,0x60,0x1f,0x68,0x27,0x60,0x40,0x1c,0xdf,0x10,0x35,0x24,0x1d,
+    0x1b,0x89,0x0,0xf5,0xd1,0xff,0x0,0x9b,0x5b,0x1c,0x0,0x93,0x10,0x32,0xff,0x9,
+    0x1d,0x4,0x2b,0xe2,0xdb,0x6b,0x46,0xff,0x1d,0x9a,0x28,0x32,0xc,0xa9,0x8,0xa8,
+    0xde,0xbb,0x0,0xff,0x1d,0x98,0x41,0x8e,0x1,0x5,0xf0,0xd7,0xe5,0xfe,0x1,0x5,
+    0x0,0xe2,0x5,0x0,0x0,0x98,0xff,0x6,0xf0,0xdd,0xf9,0x0,0x90,0x17,0x49,0xff,
+    0x6,0xf0,0x9d,0xf8,0x1,0xd8,0x10,0x48,0xf7,0x0,0xe0,0x12,0x57,0x5,0x0,0x20,
+    0x1e,0x99,0xff,0x3,0x26,0x3,0x22,0x8,0x60,0x9,0x1d,0xff,0x52,0x1e,0xfb,0xd1,
+    0x1e,0x98,0xc0,0x68,0xfd,0xa,0x77,0x1,0xc,0xda,0x8,0xad,0x1e,0x9c,0xfe,0xab,
+    0x1,0x22,0x18,0x21,0x28,0x68,0x4,0xf0,0xdf,0x94,0xfb,0x20,0x60,0x24,0x5,0x5,
+    0xf4,0xd1,0xf7,0x1f,0xb0,0xf0,0xe5,0x1,0x9a,0x99,0x19,0x0,0xbd,0x9b,0x3,0x0,
+    0x3e,0x57,0xc0,0x0,0xee,0x1,0x7f,0xff,0x33,0x33,0x73,0x3f,0x1,0x40,0x1c,0x46,
+    0xff,0x70,0xb4,0x1,0x0,0x1c,0x31,0xb,0x0,0xff,0xa,0x24,0x0,0x25,0x1d,0x60,
+    0x1b,0x1d,0x7d,0x64,0x55,0x0,0x28,0x31,0x4,0x23,0xd,0x61,0x0,0xfd,0x5b,0xb,
+    0x0,0x0,0x21,0x5,0x0,0x3,0x23,0xef,0x3,0x26,0x29,0x60,0x4d,0x2,0xfb,0xd1,
+    0x5,0xf7,0x0,0xc,0x35,0xd,0xe,0x1,0x76,0x0,0x2a,0xff,0x6,0xd0,0x11,0x68,
+    0xc9,0x10,0x1,0x60,0xf7,0x12,0x1d,0x0,0x31,0x0,0xf8,0xd1,0x70,0xbc,0xff,0x70,
+    0x47,0x0,0x29,0x7,0xd0,0x3,0x22,0xff,0x3,0x68,0xdb,0x0,0xb,0x60,0x0,0x1d,
+    0xfc,0xab,0x2,0x17,0x0,0x47,0xf8,0xb5,0x88,0xb0,0x4,0xff,0x0,0x12,0x6,0x69,
+    0xd0,0x4,0xa8,0x21,0x77,0x0,0xc,0x31,0xc9,0x2,0xb,0x68,0x3,0x69,0x0,0xfd,
+    0x0,0x21,0x0,0xf9,0xd1,0x0,0x27,0x0,0x20,0xff,0x4,0xa9,0xe,0x9a,0xb,0x68,
+    0x15,0x68,0xd7,0x5b,0x1b,0xb,0x41,0x1,0x12,0x3b,0x0,0x3,0x28,0xff,0xf6,0xdb,
+    0x0,0x22,0x0,0x23,0x4,0xad,0xff,0x28,0x68,0x40,0x10,0xc1,0x17,0x0,0x92,0xff,
+    0x1,0x93,0x2,0x0,0xb,0x0,0x0,0xf0,0xff,0x55,0xfc,0x0,0x9a,0x1,0x9b,0x80,
+    0x18,0xf3,0x59,0x41,0xf,0x2,0x91,0x2,0xed,0xd1,0xd2,0xf,0xff,0x58,0x0,0x2,
+    0x43,0x30,0x48,0x82,0x42,0xff,0x36,0xdb,0x20,0x0,0xc,0x30,0xe,0x99,0xff,0x2c,
+    0xc9,0x2c,0xc0,0x3,0x97,0x6a,0x46,0xff,0xe,0x99,0x20,0x0,0x1c,0x30,0xff,0xf7,
+    0xdf,0xa0,0xfe,0x3,0x98,0x27,0x33,0x1,0x26,0xda,0xff,0x0,0x98,0x1,0x0,0x6a,
+    0x46,0x12,0x1d,0xff,0x2,0x23,0x15,0x68,0x85,0x42,0x0,0xdb,0x57,0x28,0x46,0xa9,
+    0x5,0x0,0x29,0x11,0x0,0x5b,0xb3,0x1,0xff,0x80,0x22,0x12,0x6,0x91,0x42,0x1,
+    0xd1,0xff,0xd1,0x43,0x8,0xe0,0xca,0x17,0x51,0x40,0xff,0x89,0x1a,0xc3,0x17,0x58,
+    0x40,0xc0,0x1a,0xfd,0x88,0x23,0x0,0x1,0x0,0x18,0x48,0x81,0x42,0xff,0x5,0xda,
+    0x68,0x46,0xe,0xc8,0xe,0xc4,0xff,0xc,0x3c,0x1,0x20,0x20,0x76,0xf,0x9a,0x7d,
+    0x8,0x61,0x0,0x0,0xf0,0x2,0xf8,0x9,0x71,0x1,0xff,0xf0,0xb4,0x0,0x24,0xd,
+    0x68,0x6,0x68,0xff,0xaf,0x1b,0x17,0x60,0x6,0xd4,0x0,0x2d,0xff,0xa,0xd5,0x0,
+    0x2e,0x8,0xd4,0x80,0x25,0xff,0x2d,0x6,0x4,0xe0,0x0,0x2d,0x3,0xd4,0xff,0x0,
+    0x2e,0x1,0xd5,0x4,0x4d,0x15,0x60,0xfb,0x64,0x1c,0x1f,0x3,0x12,0x1d,0x3,0x2c,
+    0xe7,0xe3,0xdb,0xf0,0x39,0x1,0x9b,0x3,0xa7,0x3,0xaf,0x5d,0x0,0xff,0x0,0x4f,
+    0x40,0xe7,0x4,0x9,0x42,0x5,0xff,0xd0,0x83,0x7,0x5,0xd0,0x2,0x70,0x40,0xf3,
+    0x1c,0x49,0x23,0x1,0x5b,0x1,0x0,0x13,0x0,0x30,0xff,0xb4,0x14,0x0,0x15,0x0,
+    0x10,0x39,0x2,0xff,0xd3,0x10,0x39,0x3c,0xc0,0xfc,0xd2,0x49,0xff,0x7,0x0,0xd3,
+    0xc,0xc0,0x0,0xd5,0x4,0xff,0xc0,0x89,0x0,0x2,0xd3,0x2,0x80,0x80,0xff,0x1c,
+    0x0,0x29,0x0,0xd5,0x2,0x70,0x30,0xfe,0x8b,0x3,0x0,0x0,0x22,0xdb,0xe7,0x0,
+    0x22,0x7f,0xe3,0xe7,0x0,0x21,0x3,0x22,0x1,0x8f,0x1,0xf1,0x52,0xb9,0x1,0x17,
+    0x0,0xd,0x14,0x12,0x42,0x7,0xd0,0xff,0x8b,0x7,0x6,0xd0,0xb,0x78,0x49,0x1c,
+    0xfd,0x3,0x6b,0x0,0x52,0x1e,0xf7,0xd8,0x70,0x47,0xf9,0x83,0x11,0x14,0x7d,0x2,
+    0x70,0xb4,0x10,0x3a,0x3,0xff,0xd3,0x78,0xc9,0x10,0x3a,0x78,0xc0,0xfb,0xff,0xd2,
+    0x53,0x7,0x1,0xd3,0x18,0xc9,0x18,0xff,0xc0,0x1,0xd5,0x8,0xc9,0x8,0xc0,0xd2,
+    0xff,0x7,0x4,0xd3,0xb,0x88,0x3,0x80,0x89,0xfd,0x1c,0x7f,0x0,0x2a,0x1,0xd5,
+    0xb,0x78,0x3,0xfb,0x70,0x70,0x81,0x0,0x70,0xb4,0x0,0x22,0xd2,0xff,0x43,0x0,
+    0x29,0x13,0xd0,0xc,0x4b,0x5,0xff,0x78,0xd4,0xb2,0x6c,0x40,0x8,0x25,0x66,0xff,
+    0x8,0xe4,0x7,0x2,0xd5,0x34,0x0,0x5c,0xff,0x40,0x0,0xe0,0x34,0x0,0x6d,0x1e,
+    0xf6,0x7f,0xd1,0x15,0xa,0x22,0x0,0x6a,0x40,0xe5,0x2,0xcf,0xec,0xd1,0xd0,0x43,
+    0x37,0x2,0xb9,0x0,0x0,0x20,0xff,0x83,0xb8,0xed,0x0,0xb5,0xc1,0x17,0x3,0xff,
+    0x4a,0x0,0x23,0x0,0xf0,0x5c,0xfb,0x40,0xff,0xd,0xca,0x2,0x10,0x43,0x0,0xbd,
+    0x83,0xff,0xde,0x1b,0x43,0x30,0xb5,0x85,0xb0,0x4b,0xff,0x68,0x5a,0x42,0x8c,0x68,
+    0x63,0x42,0xcd,0xff,0x68,0x6c,0x42,0x9,0x68,0x0,0x91,0x1,0xff,0x92,0x2,0x93,
+    0x3,0x94,0x69,0x46,0x10,0xff,0x22,0xff,0xf7,0xa9,0xff,0x5,0xb0,0x30,0xff,0xbd,
+    0x0,0x21,0x1,0x60,0x70,0x47,0xf2,0xff,0xb5,0x84,0xb0,0x4,0x0,0x60,0x68,0x2,
+    0xff,0x90,0x25,0x68,0xe6,0x68,0x3,0x96,0x2,0xff,0x98,0xc1,0x17,0xa2,0x68,0xd3,
+    0x17,0x0,0xff,0xf0,0x32,0xfb,0x0,0x90,0x1,0x91,0x28,0xdf,0x0,0xe9,0x17,0x32,
+    0x0,0xf,0x2,0x2a,0xfb,0xff,0x0,0x9a,0x1,0x9b,0x80,0x18,0x59,0x41,0xaf,0x6,
+    0x0,0xf,0x0,0x17,0x2,0x22,0x27,0x4,0x1e,0xd4,0x27,0x4,0x37,0x2,0x62,0xf,
+    0x4,0x16,0x27,0xc,0x0,0x22,0xff,0xf8,0x23,0x1b,0x6,0x12,0x18,0x4b,0x41,0xff,
+    0xd2,0xf,0x58,0x0,0x2,0x43,0x1,0x92,0xff,0xf6,0xf,0x78,0x0,0x6,0x43,0x0,
+    0x96,0xff,0x1,0xa9,0x68,0x46,0x6,0xf0,0xed,0xfd,0xff,0x0,0x12,0x4,0x99,0x88,
+    0x60,0xe0,0x68,0x33,0x42,0x42,0x3f,0x2,0x3d,0x2,0xf7,0xfa,0x5d,0xa,0x85,0x6,
+    0xff,0xef,0xfa,0x80,0x19,0x79,0x41,0xc0,0xf,0xff,0x4a,0x0,0x10,0x43,0x80,0x21,
+    0x49,0x5,0xff,0xf0,0x22,0x12,0x6,0x88,0x42,0x4c,0xda,0xff,0x28,0x49,0x88,0x42,
+    0x4b,0xdb,0x1c,0x21,0xff,0x4,0xf0,0xe2,0xf9,0x6,0xf0,0xf0,0xfd,0xf6,0x5,0x1,
+    0x22,0x15,0xd,0x0,0xa3,0xf9,0x4,0x99,0x97,0x48,0x60,0x3,0xc5,0xc,0xcf,0x4f,
+    0xc,0x9d,0x6,0xc7,0xfc,0x4f,0x4,0x13,0x2,0x0,0x20,0xf8,0x21,0x9,0x6,0x1a,
+    0xe3,0x6,0xc1,0xcb,0x8,0xb8,0xfa,0xbb,0xc,0x17,0x0,0x45,0x2,0x65,0xe2,0x17,
+    0x4,0xac,0x17,0xc,0x89,0x6,0x1,0x90,0xc9,0x16,0xfd,0x88,0xc9,0x4,0x8,0x60,
+    0x5,0xb0,0xf0,0xbd,0xff,0x8,0x0,0xb3,0xe7,0x10,0x0,0xb1,0xe7,0x7f,0x0,0xbf,
+    0x1,0x0,0x0,0xf0,0xf0,0x8b,0x1,0xff,0x6,0x0,0xc,0x0,0x0,0x25,0x3,0x95,
+    0xff,0x2,0x95,0x1e,0x22,0x0,0x20,0x4b,0x49,0xff,0xff,0xf7,0xfa,0xfb,0xff,0xf7,
+    0x32,0xfc,0xfb,0x21,0x0,0x3,0x3,0x1,0xf0,0xb3,0xfe,0x7,0xd5,0x0,0x19,0x2,
+    0x44,0x19,0x0,0xed,0x19,0x0,0x25,0xfc,0xdf,0x21,0x1d,0x6,0xf0,0xe0,0x19,0x0,
+    0xa6,0xfe,0xab,0x3,0x90,0x19,0x2,0x3e,0x19,0x0,0xe0,0x19,0x0,0x18,0xbe,0x33,
+    0x0,0x8,0x31,0x6,0xf0,0xd2,0x1b,0x0,0x98,0xbf,0xfe,0x2,0x90,0x1,0x95,0x0,
+    0x53,0x4,0x36,0xaa,0x1f,0x0,0xd0,0x1f,0x0,0x8,0x53,0x4,0xc3,0x1d,0x0,0x54,
+    0xab,0xfe,0x5,0x53,0x4,0x2f,0x19,0x0,0xc3,0x19,0x0,0xfb,0x75,0xfb,0x53,0x2,
+    0xb6,0x19,0x0,0x47,0xfe,0x1,0x53,0x4,0xf5,0x29,0x19,0x0,0xb6,0x19,0x0,0xee,
+    0xfb,0x8,0x34,0xda,0x35,0x2,0xa8,0x1b,0x0,0x39,0xfe,0xf7,0x0,0xa9,0x28,0xee,
+    0xd,0x0,0xad,0xfd,0x69,0xd7,0x0,0xaa,0xfd,0x4,0xef,0x0,0x3,0xa9,0x38,0xf,
+    0x0,0xa5,0xfd,0x2,0xff,0xa9,0x6,0xf0,0xa2,0xfd,0x0,0x19,0x30,0x2b,0x60,0x1,
+    0x11,0x4,0x9c,0x21,0x4,0x99,0x21,0x4,0x31,0x2,0xfd,0x94,0x21,0x4,0x91,0xfd,
+    0x0,0x1b,0x70,0x60,0x4a,0x11,0x6,0x8b,0x21,0x4,0x88,0x21,0x0,0x31,0x6,0x83,
+    0x21,0x4,0xa5,0x80,0x43,0x0,0xb0,0x43,0x0,0x21,0x2,0x7a,0x11,0x4,0x77,0xaa,
+    0x65,0xc,0x72,0x31,0x4,0x6f,0x43,0x0,0xf0,0x4b,0x5,0x0,0xff,0xbf,0x0,0x0,
+    0xe0,0x3f,0xf4,0x46,0x0,0xff,0x28,0x4,0xd4,0x49,0x42,0x0,0xf0,0x13,0xff,0xf8,
+    0x40,0x42,0x60,0x47,0x40,0x42,0x0,0xff,0x29,0x5,0xd4,0x5f,0xd0,0x0,0xf0,0xb,
+    0xb2,0xf,0x0,0x49,0x11,0x0,0x1b,0x2,0x5,0xf8,0x9,0x2,0x3,0xff,0x46,0xb,
+    0x43,0xe6,0xd4,0x0,0x22,0x3,0xff,0xa,0x8b,0x42,0xb,0xd2,0x3,0x9,0x8b,0xff,
+    0x42,0x19,0xd2,0x43,0x8,0x8b,0x42,0x2e,0xff,0xd2,0x41,0x1a,0x0,0xd2,0x1,0x46,
+    0x52,0xff,0x41,0x10,0x46,0x70,0x47,0xff,0x22,0x9,0xff,0x2,0x3f,0xd0,0x12,0x6,
+    0x8b,0x42,0x5,0xff,0xd3,0x12,0x12,0x9,0x2,0x8b,0x42,0x1,0xfc,0x7,0x4,0x2f,
+    0x4,0xd3,0x0,0xe0,0x9,0xa,0xc3,0xfe,0x9,0x0,0x1,0xd3,0xcb,0x1,0xc0,0x1a,
+    0x52,0xab,0x41,0x83,0xb,0x4,0x8b,0xb,0x4,0x43,0xb,0x4,0x4b,0x5c,0xb,0x4,
+    0x2d,0x2,0x1,0xd3,0xb,0xb,0x4,0xc3,0x63,0x0,0x12,0x2f,0x0,0x0,0x2f,0x4,
+    0xb,0x4,0x8b,0xb,0x4,0x7b,0x2,0x2f,0x0,0xbe,0xb,0x4,0x88,0x42,0x0,0xd3,
+    0x40,0x7,0x0,0xcf,0xfc,0x87,0x0,0x85,0x2,0x8,0xb5,0xc0,0x46,0xc0,0x46,0xff,
+    0x8,0xbd,0xf4,0xb5,0x86,0xb0,0x10,0x46,0xff,0x3,0xaa,0x3,0x24,0x0,0x25,0x45,
+    0x5f,0xff,0xed,0x3,0x15,0x60,0x12,0x1d,0x80,0x1c,0xff,0x64,0x1e,0xf7,0xd1,0x0,
+    0x20,0xa,0x0,0xff,0x3,0xac,0x25,0x68,0x16,0x68,0xad,0x1b,0xff,0x25,0x60,0x40,
+    0x1c,0x24,0x1d,0x12,0x1d,0xff,0x3,0x28,0xf6,0xdb,0xc,0x31,0xe,0x0,0xff,0x2,
+    0x93,0x3,0x27,0x0,0x20,0x0,0x21,0xef,0x3,0xac,0x3,0x25,0xb5,0x1,0x91,0x30,
+    0x68,0xff,0xc1,0x17,0x22,0x68,0xd3,0x17,0x0,0xf0,0xff,0x55,0xf9,0x0,0x9a,0x1,
+    0x9b,0x80,0x18,0xff,0x59,0x41,0xc,0x36,0x24,0x1d,0x6d,0x1e,0xff,0xef,0xd1,0xc0,
+    0xb,0x4a,0x4,0x10,0x43,0xff,0x2,0x99,0x8,0x60,0x2,0x98,0x0,0x1d,0xff,0x2,
+    0x90,0x20,0x3e,0x7f,0x1e,0xe0,0xd1,0xff,0xc,0x98,0x1,0x78,0xfe,0x22,0xa,0x40,
+    0xff,0x2,0x70,0x6,0x99,0x3,0x22,0x9b,0x4b,0xff,0xdc,0x43,0x0,0x25,0x4d,0x5f,
+    0xa5,0x42,0xff,0x1,0xd0,0x9d,0x42,0x3,0xd1,0x5,0x78,0xff,0x1,0x26,0x2e,0x43,
+    0x6,0x70,0x89,0x1c,0x9f,0x52,0x1e,0xf2,0xd1,0x7,0x8d,0x1,0xa7,0xc,0x23,0x7f,
+    0x0,0x24,0x4,0x5f,0xe4,0x3,0x14,0xa7,0x4,0xfd,0x5b,0xa7,0x8,0x30,0x32,0x3,
+    0xab,0x14,0x68,0xff,0xa5,0x10,0xa4,0x7,0x0,0xd5,0x6d,0x1c,0x5f,0x1c,0x68,0x64,
+    0x1b,0x1c,0xb1,0x0,0x1b,0xb1,0x4,0x7f,0xf2,0xdb,0x3,0xaa,0x3c,0x31,0x68,0xdb,
+    0x1,0xff,0x96,0xfc,0x0,0x23,0xc,0x98,0x4,0x0,0xff,0x6d,0x46,0x80,0x49,0x80,
+    0x22,0x12,0x6,0xff,0x2e,0x68,0x0,0x2e,0xb,0xd0,0xe0,0x27,0xff,0x3f,0x6,0xbe,
+    0x42,0x1,0xda,0x16,0x0,0x6f,0x5,0xe0,0x97,0x8,0x9,0x0,0xdb,0xe,0xf8,0x1,
+    0xff,0xb6,0x0,0x26,0x60,0x5b,0x1c,0x2d,0x1d,0xff,0x24,0x1d,0x3,0x2b,0xea,0xdb,
+    0xd,0x9b,0xd7,0x19,0x78,0xfd,0xad,0x0,0x1a,0xad,0x4,0x6f,0x4c,0x7f,0xe5,0x43,
+    0x0,0x26,0x8e,0x5f,0xae,0xad,0x0,0xfd,0xa6,0xad,0x0,0x1e,0x78,0x2,0x27,0x37,
+    0x43,0xfd,0x1f,0xad,0x8,0x3,0x24,0xfc,0x25,0x2d,0x6,0xfd,0x67,0x61,0x4,0x4e,
+    0x19,0x7,0x68,0xbe,0x42,0xef,0x4,0xda,0x6,0x60,0x23,0xa,0x57,0x9,0xd6,0xfa,
+    0x13,0x0,0xb7,0x13,0x14,0x0,0x1d,0x64,0x1e,0xe9,0xfe,0xe5,0x4,0xd8,0xb5,0x83,
+    0xb0,0xb,0x0,0x11,0xff,0x4,0x0,0xd1,0x0,0x21,0x90,0x33,0x1a,0xff,0x68,0x88,
+    0x1a,0x6,0xd4,0x0,0x29,0x9,0xff,0xd5,0x0,0x2a,0x7,0xd4,0x80,0x20,0x0,0xff,
+    0x6,0x4,0xe0,0x0,0x29,0x2,0xd4,0x0,0xff,0x2a,0x0,0xd5,0x4f,0x48,0x6c,0x46,
+    0xc1,0xfb,0x17,0x5a,0x73,0x5,0x9b,0xf8,0x3,0xc4,0x68,0xff,0x46,0x3,0xc8,0x80,
+    0xf,0x8a,0x0,0x10,0xdf,0x43,0x89,0x17,0x48,0x4c,0x7b,0x2,0x0,0x23,0xff,0xdb,
+    0x43,0x99,0x42,0x4,0xdc,0x1,0xdb,0xff,0x90,0x42,0x1,0xd2,0x10,0x46,0x10,0xe0,
+    0xdf,0x0,0x27,0xb9,0x42,0xc,0xf,0x4,0x9,0xd2,0xff,0xb9,0x42,0x8,0xdb,0x1,
+    0xdc,0xa0,0x42,0xff,0x5,0xd3,0x6a,0x46,0xc,0xca,0x66,0x8,0xff,0x16,0x40,0x0,
+    0xd0,0x20,0x0,0xe1,0x9,0xfd,0x81,0x9,0x1,0xe0,0x9,0x7,0xe0,0x61,0x42,0xdb,
+    0xca,0x11,0x37,0x0,0xdb,0x82,0x3,0x0,0x60,0x42,0xdf,0xc0,0x11,0xc0,0x1,0x3,
+    0xc1,0x1,0x4,0xb0,0xff,0xd0,0xbd,0xf0,0xb5,0x87,0xb0,0x1c,0x0,0xff,0xc,0x98,
+    0x3,0x78,0xfb,0x25,0x1d,0x40,0xff,0x5,0x70,0x0,0x23,0xd3,0x5e,0x2b,0x4f,0xff,
+    0xbb,0x42,0xe,0xd0,0x2,0x25,0x55,0x5f,0xff,0xbd,0x42,0xa,0xd0,0x4,0x26,0x96,
+    0x5f,0xff,0xbe,0x42,0x6,0xd0,0xff,0x43,0xbb,0x42,0xf7,0x3,0xd0,0xbd,0x25,0x1,
+    0xbe,0x42,0xb,0xd1,0xff,0x80,0x21,0x9,0x6,0x3,0x22,0x21,0x60,0xff,0x24,0x1d,
+    0x52,0x1e,0xfb,0xd1,0x1,0x78,0xff,0x4,0x22,0xa,0x43,0x2,0x70,0x36,0xe0,0xf3,
+    0x3,0xa8,0xd3,0x1,0x39,0x0,0xed,0x3,0x5,0x60,0xf7,0x0,0x1d,0x92,0xd3,0x9,
+    0x3,0xaa,0xb,0x0,0xff,0x60,0x33,0x15,0x68,0x1e,0x68,0xad,0x1b,0xd5,0x15,0xcb,
+    0xd,0xf6,0xcb,0x1,0x6c,0xcb,0x5,0xdd,0xfb,0xff,0x0,0x20,0x69,0x46,0xe,0x4a,
+    0x80,0x23,0xf7,0x5b,0x4,0x80,0x6f,0x1,0xff,0x26,0x36,0x6,0x7f,0xf,0x68,0x0,
+    0x2f,0x8,0xd0,0xb7,0xc1,0x0,0x5f,0x2f,0x0,0x4,0xe0,0x9f,0xb9,0x0,0x17,0xc9,
+    0x1,0xd7,0xff,0x1,0x27,0x3f,0x0,0x9,0xc9,0x3,0x28,0xed,0xdd,0xdb,0x65,0x3,
+    0x0,0x80,0xff,0x0,0x2,0x7f,0x30,0xff,0xb4,0x43,0x43,0x51,0x43,0x5d,0x18,0x1,
+    0xff,0xc,0xc,0x0,0x13,0xc,0x5c,0x43,0x2d,0xff,0x19,0x80,0xb2,0x43,0x43,0x92,
+    0xb2,0x51,0xff,0x43,0x0,0x24,0xc9,0x18,0x64,0x41,0x24,0xff,0x4,0xb,0x4,0x9,
+    0xc,0x9,0x19,0x50,0xff,0x43,0xc0,0x18,0x69,0x41,0x30,0xbc,0x70,0xff,0x47,0x10,
+    0xb4,0x2,0x0,0x3,0x23,0xc,0xef,0x68,0x14,0x60,0x9,0x8f,0x0,0x5b,0x1e,0xf9,
+    0xfb,0xd1,0x10,0x15,0x0,0x38,0xb5,0x4,0x0,0xd,0xff,0x0,0xff,0xf7,0xf0,0xff,
+    0x29,0x0,0xc,0xff,0x31,0x20,0x0,0xc,0x30,0xff,0xf7,0xea,0xff,0xff,0xa8,0x69,
+    0xa0,0x61,0x29,0x0,0x1c,0xfe,0xf,0x0,0x1c,0x30,0x0,0xf0,0xe6,0xfc,0x29,0xeb,
+    0x0,0x28,0xb,0x0,0x28,0xb,0x0,0xcb,0xfa,0x34,0xff,0x35,0x28,0x78,0x34,0x21,
+    0x60,0x54,0x20,0xef,0x0,0x32,0xbd,0xf5,0x4f,0x1,0x0,0x20,0x4,0xff,0x90,0x7,
+    0x98,0x1,0x90,0x0,0x91,0x0,0xff,0x27,0x0,0x98,0x0,0x68,0xc1,0x17,0x8,0x7b,
+    0x9a,0x12,0xdb,0x1,0xff,0xf7,0xad,0xff,0x5b,0x2,0xff,0xe2,0xe,0x68,0x1,0x2,
+    0x43,0xeb,0x16,0xff,0x80,0x20,0x0,0x6,0x0,0x21,0xc9,0x43,0xdf,0x8b,0x42,0x2,
+    0xdc,0x31,0x9b,0x1,0x2f,0xd3,0xf7,0xbb,0x42,0xb,0xd1,0x1,0x82,0x42,0x8,0xd2,
+    0xf5,0xc6,0x6d,0x1,0x7,0xd3,0x1,0xb2,0x42,0x4,0xd3,0xff,0x48,0x9,0x20,0x40,
+    0x1,0xd0,0x48,0x8,0xff,0x1f,0xe0,0x2,0xa8,0xc,0xc0,0x80,0x20,0xff,0xc0,0x4,
+    0x20,0x40,0x6,0xd0,0x2,0xa8,0xff,0x3,0xc8,0x0,0x26,0x40,0x1c,0x71,0x41,0xef,
+    0x2,0xae,0x3,0xc6,0xd,0x4,0x29,0x1,0xd1,0xef,0x0,0x28,0xc,0xd0,0x7,0x0,
+    0xdb,0x1,0x26,0xbf,0x0,0xe0,0x0,0x26,0x0,0x2d,0x9,0x0,0x24,0xfe,0x9,0x0,
+    0x24,0xa6,0x42,0x0,0xd0,0x10,0x0,0x7d,0x1,0xf5,0x3,0x98,0x40,0x1c,0x4,0x90,
+    0x97,0x0,0xef,0x1d,0x0,0x90,0x1,0x5,0x0,0x1,0x90,0x4,0xff,0x98,0x3,0x28,
+    0xaa,0xdb,0x7,0x98,0x9,0xfe,0x4d,0x1,0x10,0xb4,0x1,0x68,0xa,0x0,0x0,0xff,
+    0x1d,0x2,0x23,0x4,0x68,0x8c,0x42,0x0,0xef,0xdb,0x21,0x46,0xa2,0x5,0x0,0x22,
+    0x46,0x0,0xf6,0x1f,0x1,0xf5,0xd1,0xb1,0x2,0x82,0x42,0x1,0xd1,0xff,0xc0,0x43,
+    0x8,0xe0,0xd3,0x17,0x5a,0x40,0xff,0xd0,0x1a,0xca,0x17,0x51,0x40,0x89,0x1a,0xed,
+    0x81,0x23,0x0,0x8,0x0,0x3d,0x3,0x0,0x21,0x1,0xff,0x60,0x70,0x47,0x9,0x68,
+    0x0,0x29,0x0,0xff,0xd0,0x89,0x10,0x12,0x68,0x8b,0x18,0x3,0xff,0x60,0x6,0xd4,
+    0x0,0x29,0xa,0xd5,0x0,0xff,0x2a,0x8,0xd5,0x80,0x21,0x9,0x6,0x4,0xff,0xe0,
+    0x0,0x29,0x3,0xd4,0x0,0x2a,0x1,0xc7,0xd4,0x1,0x49,0x2b,0x2,0xbb,0x3,0x2f,
+    0x0,0x68,0xc2,0xeb,0x10,0x91,0xf1,0x0,0x8a,0x3,0x0,0x40,0x7,0x40,0x7f,0xf,
+    0x40,0x1e,0x80,0x41,0xc0,0xf,0x4f,0x0,0xef,0x20,0x70,0x47,0x1,0x3,0x0,0x70,
+    0xb5,0x84,0xef,0xb0,0xc,0x0,0x16,0xb4,0x0,0x9c,0x21,0x9,0xff,0x1,0x41,0x18,
+    0x8,0x68,0x80,0x22,0xd2,0xff,0x5,0x90,0x42,0x7,0xd0,0x22,0x0,0x68,0xff,0x46,
+    0x6,0xf0,0xe3,0xfa,0x68,0x46,0xe,0xff,0xc8,0xe,0xc4,0xc,0x3c,0x62,0x68,0x1a,
+    0xff,0x21,0x30,0x0,0xfa,0xf7,0xe9,0xf9,0x28,0xfb,0x60,0x22,0xb,0x8,0xe3,0xf9,
+    0x68,0x60,0xa2,0xfe,0xb,0x8,0xdd,0xf9,0x41,0x42,0xa9,0x60,0x4,0xf7,0xb0,0x70,
+    0xbd,0xa7,0x6,0xc,0xd0,0xe0,0x22,0xbf,0x12,0x6,0x91,0x42,0x2,0xda,0x9d,0x2,
+    0x5,0xff,0xe0,0x52,0x42,0x91,0x42,0x1,0xdb,0x2,0xdf,0x49,0x0,0xe0,0x89,0x0,
+    0x9f,0xa,0x1,0x0,0xff,0x90,0x31,0x0,0x22,0xa,0x60,0x4a,0x60,0xff,0x8a,0x60,
+    0xa,0x63,0x4a,0x63,0x8a,0x63,0xff,0xca,0x63,0xa,0x64,0x4a,0x64,0x8a,0x64,0xfb,
+    0x70,0x47,0x31,0x7b,0xf0,0xb4,0x1,0x25,0xed,0xff,0x7,0xf,0x0,0x5f,0x40,0x4f,
+    0xd4,0x8b,0xff,0x42,0x0,0xd1,0x82,0x42,0x5,0xd9,0x84,0xff,0x46,0x10,0x0,0x62,
+    0x46,0x8c,0x46,0x19,0xff,0x0,0x63,0x46,0xdf,0x18,0x4c,0x18,0x64,0xff,0xd,0x7f,
+    0xd,0x3a,0xd0,0x66,0x1c,0x76,0xff,0x5,0x37,0xd0,0xe6,0x1b,0x35,0x2e,0x34,0xff,
+    0xdc,0xdb,0x2,0x2b,0x43,0xdb,0xa,0xc,0xff,0xd,0xc9,0x2,0x29,0x43,0xc9,0x12,
+    0x20,0xff,0x2e,0xd,0xdb,0x17,0x0,0x20,0x3e,0x6,0xff,0xd0,0x1f,0x0,0xf7,0x41,
+    0xf3,0x40,0x5f,0xff,0x40,0x0,0x26,0x1,0x2a,0x77,0x41,0xc0,0xff,0x18,0x71,0x41,
+    0xd,0xd2,0x17,0xe0,0x17,0xfe,0x15,0x0,0xf2,0x40,0x57,0x40,0xf3,0x41,0x5a,0xbf,
+    0x40,0xb3,0x40,0xf3,0x40,0x5a,0x1f,0x0,0x80,0xff,0x18,0x59,0x41,0xa,0xd3,0xa2,
+    0x1c,0x52,0xff,0x5,0xf,0xd0,0xc2,0x7,0x1,0x2f,0x72,0xff,0x41,0x17,0x0,0x40,
+    0x8,0xcb,0x7,0x18,0xff,0x43,0x49,0x8,0x64,0x1c,0x24,0x5,0x42,0xff,0x8,0xaf,
+    0x41,0x70,0x41,0x61,0x41,0xf0,0xfe,0xa3,0x0,0x64,0x1c,0x21,0x5,0x0,0x20,0xf9,
+    0xff,0xe7,0x6b,0x40,0xa,0xe0,0x6b,0x40,0xab,0xff,0xe7,0xf7,0x42,0xf3,0xd1,0xe9,
+    0x43,0xf1,0xff,0xe7,0x24,0x42,0xef,0xd1,0x0,0x20,0x0,0xff,0x21,0xec,0xe7,0xc,
+    0x0,0x87,0x1a,0x9c,0xff,0x41,0x5,0xd2,0xc0,0x1b,0xa1,0x41,0xd2,0xff,0x19,0x63,
+    0x41,0x69,0x40,0x6b,0x40,0xae,0xbd,0xa,0xbb,0x2,0xf4,0x42,0xe7,0xd2,0xbf,0x2,
+    0xe8,0x6e,0xb9,0x0,0x36,0x2e,0xd7,0xb9,0x8,0xa4,0x46,0xbb,0x8,0xff,0xa,0x1,
+    0x2e,0x28,0xdc,0x4,0xd1,0xd6,0xff,0x7,0x52,0x8,0xdf,0x7,0x3a,0x43,0x5b,0xff,
+    0x8,0xef,0xa,0x76,0x42,0x90,0x41,0x99,0xff,0x41,0x14,0xd0,0x39,0x42,0x3b,0xd1,
+    0xb6,0xff,0x19,0x40,0x41,0x49,0x41,0x76,0x1c,0x39,0xff,0x42,0x4,0xd1,0x76,0x1c,
+    0x0,0x18,0x49,0xff,0x41,0x39,0x42,0xfa,0xd0,0xb9,0x43,0x67,0xff,0x46,0xb7,0x42,
+    0x8,0xd9,0xa4,0x1b,0x24,0xff,0x5,0x21,0x43,0xad,0xe7,0x0,0x42,0xea,0xff,0xd1,
+    0x36,0x42,0xe8,0xd1,0xa8,0xe7,0xe4,0xff,0xa,0xe1,0x7,0x0,0x20,0xa4,0xe7,0x20,
+    0xff,0x2e,0xb,0xdd,0x20,0x3e,0x1f,0x0,0xf3,0xff,0x40,0xf7,0x41,0x5f,0x40,0x1,
+    0x2a,0x0,0xff,0x22,0x57,0x41,0x7e,0x42,0x98,0x41,0x91,0xeb,0x41,0xb,0xd,0x21,
+    0x7e,0x71,0x4,0xa,0x3,0x3,0xf7,0xd2,0x64,0x1e,0x71,0x6,0x0,0x27,0x64,0x1e,
+    0xee,0x3,0x3,0xae,0x41,0x78,0x3,0x9,0xf5,0xb5,0x83,0xff,0xb0,0x0,0x20,0x2,
+    0x90,0x3,0x98,0x1,0xff,0x90,0x0,0x91,0x0,0x27,0x0,0x98,0x0,0xff,0x68,0xc1,
+    0x17,0x4,0x9a,0x12,0x68,0xd3,0xff,0x17,0xff,0xf7,0xc0,0xfd,0x42,0x9,0xcc,0xff,
+    0x6,0x22,0x43,0x4b,0x11,0x80,0x24,0x24,0xff,0x6,0x0,0x25,0xed,0x43,0xab,0x42,
+    0x4,0xff,0xdc,0x1,0xdb,0xa2,0x42,0x1,0xd2,0x22,0xbf,0x46,0xe,0xe0,0xbb,0x42,
+    0xb,0xd,0x4,0x8,0xff,0xd2,0xe6,0x43,0xbb,0x42,0x6,0xdb,0x1,0xff,0xdc,0xb2,
+    0x42,0x3,0xd3,0x1f,0x24,0x4,0xff,0x40,0x0,0xd0,0x6a,0x8,0x1,0x98,0x2,0x7f,
+    0x60,0x2,0x98,0x40,0x1c,0x2,0x90,0x55,0x0,0xef,0x1d,0x0,0x90,0x1,0x5,0x0,
+    0x1,0x90,0x2,0xff,0x98,0x3,0x28,0xcb,0xdb,0x3,0x98,0x5,0xff,0xb0,0xf0,0xbd,
+    0x10,0xb4,0x2,0x0,0x3,0xff,0x23,0xc,0x68,0x14,0x60,0x9,0x1d,0x12,0xbf,0x1d,
+    0x5b,0x1e,0xf9,0xd1,0x10,0x93,0x0,0x70,0xbf,0xb5,0x84,0xb0,0xc,0x0,0x16,0x32,
+    0x0,0x9c,0xff,0x21,0x9,0x1,0x41,0x18,0x8,0x68,0x80,0xff,0x22,0xd2,0x5,0x90,
+    0x42,0x7,0xd0,0x22,0xff,0x0,0x68,0x46,0x6,0xf0,0x38,0xfa,0x68,0xff,0x46,0xe,
+    0xc8,0xe,0xc4,0xc,0x3c,0x62,0xff,0x68,0x16,0x21,0x30,0x0,0xfa,0xf7,0x5e,0xef,
+    0xf8,0x28,0x60,0x22,0xb,0x8,0x58,0xf8,0x68,0xfb,0x60,0xa2,0xb,0x8,0x52,0xf8,
+    0x41,0x42,0xa9,0xff,0x60,0x4,0xb0,0x70,0xbd,0x70,0xb5,0x42,0xff,0x42,0x46,0x18,
+    0x10,0x0,0xd1,0x17,0x89,0xff,0x7,0x82,0x8,0x11,0x43,0x80,0x7,0x0,0xff,0x2e,
+    0x1,0xd1,0xa,0x48,0x70,0xbd,0xcc,0xff,0x17,0xcd,0x17,0xf3,0x17,0x1a,0x0,0x72,
+    0xff,0x40,0xd2,0x1a,0x60,0x40,0x69,0x40,0x2b,0xff,0x0,0x0,0x1b,0x99,0x41,0x0,
+    0xf0,0x74,0xff,0xfa,0xf1,0x17,0x61,0x40,0x48,0x40,0x40,0xff,0x1a,0x70,0xbd,0x0,
+    0xbf,0xff,0xff,0xff,0xff,0x7f,0xf8,0xb5,0xc,0x0,0x15,0x0,0x2,0xbf,0x0,0x41,
+    0x42,0x0,0x91,0x20,0x25,0x1,0x80,0xdf,0x23,0xdb,0x5,0xd2,0x18,0x27,0x3,0x2c,
+    0xfd,0xdf,0x6,0x0,0xf,0x0,0x28,0x13,0x0,0x0,0x9a,0xfe,0xf,0x2,0x24,0xfd,
+    0x80,0x19,0x79,0x41,0x82,0xff,0xf,0x8e,0x0,0x32,0x43,0x80,0x26,0xb6,0xfb,0x5,
+    0x6,0xf,0x1,0x52,0x1c,0x22,0x60,0x2a,0x57,0x60,0xf1,0xbd,0x45,0x2e,0x9,0x45,
+    0x18,0x1,0x45,0x4,0xff,0x80,0xf,0x8a,0x0,0x10,0x43,0x20,0x60,0xa7,0x20,0x68,
+    0x28,0x3d,0x0,0x31,0x67,0x7f,0x31,0x11,0x18,0x9e,0x19,0x1,0xf9,0xf7,0xc5,0xff,
+    0x31,0x3,0xb,0x6,0xbf,0xd9,0xff,0x31,0x3,0xb,0x6,0xb9,0xff,0x31,0xb,0x10,
+    0xb4,0xff,0x1,0x9c,0x9,0x68,0x1,0x60,0x11,0x68,0xff,0x41,0x60,0x19,0x68,0x81,
+    0x60,0x21,0x68,0xfb,0xc1,0x60,0x6b,0x2,0xf1,0xb5,0x9c,0xb0,0x13,0xff,0x0,0x8,
+    0x68,0x1a,0x68,0x4c,0x68,0x65,0xff,0x42,0x1b,0x95,0x5c,0x68,0x1a,0x94,0x8c,0xfe,
+    0x9,0x0,0x19,0x95,0x9c,0x68,0x18,0x94,0xcc,0xfe,0x9,0x0,0x17,0x95,0xdc,0x68,
+    0x16,0x94,0xc,0xff,0x68,0x5d,0x68,0x15,0x95,0x4d,0x68,0x14,0xff,0x95,0x1d,0x68,
+    0x13,0x95,0x8d,0x68,0x12,0xff,0x95,0xdd,0x68,0x11,0x95,0xcd,0x68,0x6e,0xff,0x42,
+    0x10,0x96,0x9d,0x68,0xf,0x95,0xd,0xbf,0x68,0xe,0x95,0x9d,0x68,0xd,0x21,0x0,
+    0x6e,0xbf,0x42,0xc,0x96,0xdd,0x68,0xb,0x23,0x0,0xa,0xfa,0x2b,0x0,0x9,0x23,
+    0x0,0x8,0x95,0x5d,0x68,0x7,0xaa,0x21,0x0,0x6,0x33,0x0,0x5,0x21,0x0,0x4,
+    0x29,0x0,0x3,0xfe,0x1f,0x0,0x6e,0x42,0x2,0x96,0x5d,0x68,0x1,0x3f,0x95,0xc9,
+    0x68,0x0,0x91,0x1d,0x27,0x1,0x25,0x3,0xfb,0x6e,0xfc,0x35,0x3,0x1b,0x98,0xc1,
+    0x17,0x1a,0xa6,0x35,0x5,0x66,0xfc,0x35,0x3,0x13,0x2,0x19,0x13,0x0,0x18,0xaa,
+    0x13,0x4,0x5c,0x13,0xc,0x17,0x13,0x0,0x16,0x13,0x4,0x52,0xfc,0x13,0x4,0x5d,
+    0x7,0x1c,0x99,0x8,0x60,0x20,0x0,0x57,0xe1,0x17,0x15,0x19,0x4,0x45,0x51,0x4,
+    0x14,0x29,0x0,0x55,0x13,0xf,0x4,0x3d,0x3d,0xc,0x12,0x13,0x0,0x11,0x13,0x4,
+    0x55,0x33,0x13,0xc,0x10,0x13,0x0,0xf,0x13,0x4,0x29,0x51,0x14,0x57,0x48,0x60,
+    0xe,0x19,0x0,0xd,0x19,0x4,0x1c,0x51,0x4,0x55,0xc,0xf,0x0,0xb,0xf,0x4,
+    0x14,0x3d,0xc,0xa,0x13,0x0,0x55,0x9,0x13,0x4,0xa,0x13,0xc,0x8,0x13,0x0,
+    0x7,0x13,0x4,0x5d,0x0,0x51,0x14,0x88,0x60,0x6,0x19,0x0,0x5,0x19,0x4,0xab,
+    0xf3,0xfb,0x29,0x2,0x4,0xf,0x0,0x3,0xf,0x4,0xeb,0x55,0xfb,0x3d,0xa,0x2,
+    0x13,0x0,0x1,0x13,0x4,0xe1,0x13,0xc,0x5d,0x0,0x13,0x0,0x2a,0x0,0xeb,0x13,
+    0x0,0xd7,0x13,0x4,0xfe,0x51,0xa,0xc8,0x60,0x1c,0x98,0x1d,0xb0,0xf0,0x49,0xbd,
+    0xd3,0xff,0xd3,0x17,0x84,0xdd,0x4,0xd3,0xf,0x7c,0xc9,0xc,0x92,0xd3,0xf,0x72,
+    0x13,0xc,0xd3,0xf,0x68,0xdd,0x14,0xd3,0x13,0x5b,0x24,0x51,0x4,0xd3,0xf,0x53,
+    0x3d,0xc,0xd3,0xf,0x49,0x13,0xc,0xd3,0xf,0x49,0x3f,0x51,0x14,0xd3,0x13,0x32,
+    0x51,0x4,0xd3,0xf,0x2a,0x3d,0xc,0x92,0xd3,0xf,0x20,0x13,0xc,0xd3,0xf,0x16,
+    0x51,0x14,0xd3,0x13,0x9,0x5a,0xd3,0x19,0x1,0xd3,0x21,0xf7,0xfa,0xd3,0x1f,0xed,
+    0x13,0x4,0xfe,0xd3,0x1b,0x10,0xb4,0x2,0x0,0x3,0x23,0xc,0xff,0x68,0x14,0x60,
+    0x9,0x1d,0x12,0x1d,0x5b,0xff,0x1e,0xf9,0xd1,0x10,0xbc,0x70,0x47,0x0,0xff,0xb5,
+    0xd3,0x17,0x3,0xf0,0xa9,0xfd,0x0,0xff,0xbd,0x0,0xb5,0x0,0x23,0x3,0xf0,0xc3,
+    0xfa,0x9,0xc,0xbe,0x9,0x0,0x70,0x47,0xf0,0xb5,0x8b,0xff,0xb0,0x4,0x0,0xe,
+    0x0,0x23,0x0,0xc,0xff,0x33,0x22,0x0,0x8,0x32,0x21,0x1d,0x7,0xff,0xa8,0x6,
+    0xf0,0x3f,0xf9,0x0,0xf0,0x19,0xff,0xfc,0x0,0x90,0x1,0x20,0x0,0x27,0x0,0xff,
+    0x99,0x81,0x42,0x3,0xda,0x37,0x60,0x77,0xbf,0x60,0xb7,0x60,0x57,0xe0,0x20,0xb1,
+    0x1,0x48,0xff,0x40,0x40,0x1a,0x1,0x90,0x1,0xa9,0x68,0xff,0x46,0x0,0xf0,0x26,
+    0xfc,0xe1,0x68,0x89,0xff,0x10,0xa2,0x68,0x92,0x10,0x63,0x68,0x9b,0xff,0x10,0x33,
+    0x60,0x72,0x60,0xb1,0x60,0x21,0xff,0x68,0xb9,0x42,0xd,0xda,0x31,0x0,0x4,0xff,
+    0xaa,0x3,0x23,0xd,0x68,0x6c,0x42,0x14,0xef,0x60,0x12,0x1d,0x9,0x91,0x0,0xf8,
+    0xd1,0x4,0xff,0xa9,0x1c,0xc9,0x1c,0xc6,0xc,0x3e,0x4,0xff,0x0,0xc5,0x17,0x6d,
+    0x7,0xe0,0x8,0x5,0xff,0x43,0x64,0x7,0x0,0x98,0x0,0x28,0x1,0xff,0xd1,0x16,
+    0x4c,0x1a,0xe0,0xe8,0x17,0xe9,0xff,0x17,0x2,0xaa,0x3,0xc2,0x0,0x98,0xc0,0xff,
+    0x17,0x0,0x99,0x41,0x40,0xa,0x1a,0x94,0xff,0x46,0x2,0xa8,0x3,0xc8,0x60,0x40,
+    0x69,0xff,0x40,0x2,0xaa,0xc,0xca,0x80,0x1a,0x99,0xff,0x41,0x62,0x46,0xff,0xf7,
+    0x9f,0xff,0xec,0xfe,0x1f,0x0,0xc9,0x17,0x61,0x40,0x48,0x40,0x44,0xef,0x1a,0xe5,
+    0x17,0x30,0x93,0x0,0x22,0x0,0x2b,0xff,0x0,0xff,0xf7,0x60,0xfa,0x0,0xf,0xa,
+    0xff,0x1,0x10,0x43,0x30,0x60,0x7f,0x1c,0x36,0xbf,0x1d,0x3,0x2f,0xf1,0xdb,0xb,
+    0x19,0x1,0xff,0xff,0xff,0xff,0x7f,0x80,0xb5,0xa,0x68,0x0,0xff,0x2a,0x1,0xd1,
+    0x5,0x48,0x2,0xbd,0x80,0xfd,0x12,0xaf,0x1,0x5,0x3,0xb,0x19,0x43,0x0,0xff,
+    0x5,0xff,0xf7,0x6e,0xff,0x2,0xbd,0x0,0xfd,0xbf,0x23,0x2,0x9,0x68,0x0,0x68,
+    0x2,0x11,0xff,0x91,0x42,0x1,0xda,0x1,0x20,0x70,0x47,0xf5,0x8a,0x7,0x0,0x0,
+    0x7,0x0,0x0,0x7,0x0,0xf,0xff,0x40,0x1e,0x80,0x41,0xc0,0x43,0xc0,0xf,0xff,
+    0x70,0x47,0xf8,0xb5,0x4,0x0,0x15,0x0,0xfd,0x8,0x71,0x0,0x89,0x3,0x82,0xc,
+    0x11,0x43,0xff,0x80,0x3,0x2b,0x68,0x0,0x2b,0x1,0xd1,0xff,0xa,0x48,0x10,0xe0,
+    0xce,0x17,0xcf,0x17,0xff,0xda,0x17,0x53,0x40,0x9a,0x1a,0x70,0x40,0xff,0x79,0x40,
+    0x3b,0x0,0x80,0x1b,0x99,0x41,0xff,0xff,0xf7,0x48,0xff,0x29,0x68,0xc9,0x17,0xfd,
+    0x71,0xab,0x0,0x40,0x1a,0x20,0x60,0x20,0x0,0xfd,0xf2,0x8f,0x4,0x81,0x42,0x0,
+    0xdb,0x8,0x0,0x77,0x70,0x47,0x88,0x7,0x8,0xf8,0xb5,0xc,0x57,0x0,0xbf,0x2,
+    0x0,0x41,0x42,0x0,0x91,0x63,0x3,0x80,0xbf,0x23,0xdb,0x5,0xd2,0x18,0xd3,0xed,
+    0x1,0xf6,0xb5,0xf9,0xfd,0x3,0x28,0x13,0x0,0x0,0x9a,0xf,0x2,0xee,0xf9,0xf9,
+    0xfd,0xf,0x4f,0x0,0x68,0x28,0x60,0xf1,0xbd,0xff,0xf8,0xb5,0x7,0x0,0x14,0x0,
+    0x1d,0x0,0xff,0x0,0x2d,0x4,0xdc,0x1,0xdb,0x1,0x2c,0xff,0x1,0xd2,0x0,0x20,
+    0x1f,0xe0,0xe,0x26,0xff,0x20,0x0,0x29,0x0,0x6,0xf0,0x5f,0xf8,0xff,0x31,0x1a,
+    0x1,0x26,0x8,0x0,0x30,0x40,0xff,0x8,0x18,0x0,0x90,0x12,0x20,0xc0,0x43,0xef,
+    0x0,0x99,0x42,0x1a,0x1b,0x6,0x62,0xf8,0x6,0xff,0x99,0x0,0xf0,0x4c,0xff,0xb1,
+    0x7,0x89,0xfd,0x1b,0x93,0x0,0xda,0x8,0x0,0x0,0x99,0x49,0xff,0x10,0x49,0x1f,
+    0xfe,0xf7,0x99,0xfa,0x38,0xeb,0x60,0x38,0xad,0x0,0xf4,0xf1,0x0,0xe,0x0,0x1,
+    0xfd,0x2e,0xd,0x3,0x19,0xe0,0xd,0x25,0x30,0x0,0xff,0x0,0xf0,0xa,0xfd,0x29,
+    0x1a,0x1,0x25,0xff,0x8,0x0,0x28,0x40,0xf,0x18,0xc,0x20,0xff,0xc1,0x1b,0x30,
+    0x0,0xfe,0xf7,0x81,0xfa,0x7d,0x0,0x49,0x0,0x27,0xff,0xa9,0x7,0x49,0x49,0x8,
+    0xff,0x79,0x10,0xb,0x39,0xfe,0xf7,0x75,0xfa,0xfe,0xf5,0x6,0xf7,0xb5,0x82,0xb0,
+    0x7f,0x26,0x1,0xff,0x2a,0x20,0xdb,0x1,0x46,0x80,0x20,0x0,0xff,0x6,0x0,0x25,
+    0xb,0x68,0x83,0x42,0xa,0xff,0xd0,0xdd,0x17,0x6b,0x40,0x5b,0x1b,0x0,0xff,0x25,
+    0x0,0x2b,0x4,0xd4,0x5b,0x0,0x6d,0xff,0x1c,0x20,0x2d,0xf9,0xdb,0x20,0x25,0xae,
+    0xff,0x42,0x0,0xdd,0x2e,0x0,0x9,0x1d,0x52,0xff,0x1e,0xea,0xd1,0x20,0x2e,0x6,
+    0xd1,0x4,0xff,0x98,0x81,0x0,0x3,0x98,0xfe,0xf7,0xaf,0xff,0xfd,0x0,0x20,0x60,
+    0xe0,0xb6,0x1e,0x70,0xff,0xb2,0x6,0xf0,0x14,0xf8,0xc0,0x7,0x0,0xff,0xd5,0x76,
+    0x1e,0x0,0x22,0x0,0x23,0x4,0xff,0x98,0x1,0x28,0x1d,0xdb,0x2,0x9c,0x5,0xff,
+    0x46,0x77,0x42,0x20,0x68,0x0,0x2e,0x1,0xff,0xd4,0xb0,0x40,0x5,0xe0,0x39,0x0,
+    0x20,0xff,0x29,0x1,0xdb,0xc0,0x17,0x0,0xe0,0x8,0xfd,0x41,0x3f,0x1,0x92,0x1,
+    0x93,0x2,0x0,0xb,0xff,0x0,0xff,0xf7,0x4c,0xf9,0x0,0x9a,0x1,0xdf,0x9b,0x80,
+    0x18,0x59,0x41,0xf,0x2,0x24,0x1d,0xff,0x6d,0x1e,0xe4,0xd1,0x10,0x0,0x19,0x0,
+    0xbf,0x5,0xf0,0xf0,0xff,0x1,0x0,0x9d,0x0,0x1,0xff,0x81,0x42,0xca,0xdb,0x0,
+    0x24,0x1,0x94,0xff,0x3,0x22,0x1,0xa8,0x5,0xf0,0xf1,0xff,0xff,0x1,0x98,0xa0,
+    0x42,0xc1,0xd0,0x0,0x94,0xfe,0x67,0x2,0x1f,0xdb,0x3,0x9c,0x2,0x9d,0x37,0xd7,
+    0x0,0x17,0x3f,0x95,0x3,0x1,0x95,0x5,0x23,0xf9,0xdf,0x0,0x2f,0x3,0xd4,0x3a,
+    0x41,0x0,0xf8,0xff,0xff,0x6,0xe0,0x7a,0x42,0x40,0x2a,0x1,0xdb,0xff,0xc8,0x17,
+    0x1,0xe0,0x6,0xf0,0x2,0xf8,0xff,0x20,0x60,0x0,0x98,0x40,0x1c,0x0,0x90,0xff,
+    0x2d,0x1d,0x24,0x1d,0x4,0x99,0x88,0x42,0xff,0xe1,0xdb,0x1,0x20,0x5,0xb0,0xf0,
+    0xbd,0xff,0x10,0xb4,0x1,0x68,0xa,0x0,0x0,0x1d,0xff,0x2,0x23,0x4,0x68,0x8c,
+    0x42,0x0,0xdb,0xf7,0x21,0x46,0xa2,0x5,0x0,0x22,0x46,0x0,0x1d,0xef,0x5b,0x1e,
+    0xf5,0xd1,0x23,0x3,0x82,0x42,0x1,0xff,0xd1,0xc0,0x43,0x8,0xe0,0xd3,0x17,0x5a,
+    0xff,0x40,0xd0,0x1a,0xca,0x17,0x51,0x40,0x89,0xfd,0x1a,0x5b,0x1,0xdb,0x8,0x0,
+    0x10,0xbc,0x70,0xd5,0x47,0x51,0x5,0x24,0x51,0x11,0x26,0x51,0x7,0xde,0x17,0xbf,
+    0x73,0x40,0x9b,0x1b,0x0,0x26,0x51,0x7,0x76,0xb7,0x1c,0x20,0x2e,0x51,0x1,0x26,
+    0xb4,0x51,0x1,0x34,0xea,0x51,0xb,0x2c,0x51,0xf,0x6,0x51,0x1,0x5b,0xe0,0xa4,
+    0xff,0x1e,0x60,0xb2,0x1,0x12,0xa,0x0,0x42,0xb7,0x40,0x50,0x1a,0x55,0x3,0x64,
+    0x1e,0x3f,0x0,0x27,0xfe,0xed,0x2,0x15,0xdb,0x2,0x98,0x0,0x90,0x4,0xff,0x9d,
+    0x21,0x0,0x0,0x98,0x0,0x68,0xfe,0xdf,0xf7,0x8d,0xf9,0xc1,0x17,0x45,0x7,0xa9,
+    0xf8,0x7f,0x80,0x19,0x79,0x41,0x6,0x0,0xf,0x19,0x2,0xff,0x1d,0x0,0x90,0x6d,
+    0x1e,0xec,0xd1,0x78,0xff,0x10,0x1,0x23,0x3b,0x40,0x0,0xd0,0x40,0xff,0x1c,0x80,
+    0x21,0x89,0x1,0x88,0x42,0xd0,0xf5,0xdb,0xd9,0x1,0x95,0x45,0x1,0x0,0x68,0x46,
+    0x5,0xff,0xf0,0x8d,0xff,0x0,0x98,0xa8,0x42,0xc6,0xf7,0xd0,0x1,0x95,0x47,0x9,
+    0x9e,0x2,0x9d,0x27,0x6b,0x0,0x18,0x47,0x5,0x0,0x47,0x5,0x7f,0xf8,0x47,0xb,
+    0xfd,0x54,0x47,0x15,0x5,0xf0,0x5e,0xff,0x30,0x60,0xd5,0x1,0x47,0x1,0x1,0x47,
+    0x1,0x36,0x47,0x15,0xff,0xb5,0xff,0x9d,0xb0,0x49,0x68,0x48,0x42,0x8,0x90,0xfd,
+    0x1e,0xa1,0x0,0x9,0x90,0x0,0x27,0xa,0x97,0xff,0x2,0x97,0x0,0x22,0x0,0x23,
+    0x8,0xac,0xbf,0x3,0x25,0x20,0x68,0x40,0x10,0xfb,0x13,0x4e,0xfd,0xf8,0xfb,0x1b,
+    0xed,0xd1,0x2,0x20,0x0,0x90,0xfd,0x2,0xe7,0x1,0x5a,0xff,0x2,0x9e,0x1,0x20,
+    0xff,0xb0,0x42,0x2,0xdb,0x8,0x97,0x9,0x97,0xff,0x12,0xe0,0x8,0xac,0x0,0x2e,
+    0x1,0xd1,0x7f,0x92,0x48,0x8,0xe0,0x32,0x0,0x20,0xa3,0x0,0xff,0x49,0x7,0xc3,
+    0x8,0x19,0x43,0x40,0x7,0xff,0xff,0xf7,0x53,0xfd,0x20,0x60,0x6d,0x1c,0xff,0x24,
+    0x1d,0x3,0x2d,0xed,0xdb,0x80,0x20,0xff,0xc0,0x5,0xc0,0x21,0x9,0x6,0x1e,0x9a,
+    0xff,0x8,0x32,0x13,0x68,0x4,0x46,0xa3,0x42,0xff,0x4,0xda,0x86,0x48,0x83,0x42,
+    0x0,0xda,0xff,0x88,0xe0,0x18,0x46,0x4,0x97,0x41,0x42,0xff,0x1b,0x91,0x0,0x22,
+    0xd2,0x43,0x1b,0xa9,0xfd,0x4,0x63,0x0,0x56,0xff,0x7,0x97,0x66,0x8,0xff,0x4,
+    0x98,0x34,0x18,0x0,0x96,0x4,0xaa,0xf7,0x69,0x46,0x7,0x13,0x0,0x58,0xff,0x5,
+    0x97,0xfd,0x3,0xb3,0x0,0x70,0x0,0x1,0x90,0x5,0xa8,0xff,0x0,0x90,0x3,0xab,
+    0x2,0xaa,0x1,0xa9,0xff,0xf,0xa8,0xf9,0xf7,0xef,0xfa,0xa,0x22,0xf7,0x21,0x0,
+    0xf,0x23,0x0,0x4e,0xff,0xf,0xac,0xff,0xa,0x22,0x7,0x99,0x20,0x1d,0x5,0xf0,
+    0xff,0x48,0xff,0x10,0x98,0x11,0x90,0x10,0x98,0xbf,0x12,0x90,0x8,0xaa,0x21,0x1d,
+    0x11,0x2,0x61,0xff,0xff,0x8,0xad,0x2a,0x1d,0x21,0x0,0x8,0xff,0x31,0x20,0x0,
+    0x8,0x30,0x5,0xf0,0x59,0xff,0xff,0x8,0x35,0x2a,0x0,0x21,0x0,0xc,0xef,0x31,
+    0xc,0x34,0x20,0x4d,0x1,0x51,0xff,0x1f,0xf7,0x9a,0xf,0xa9,0x83,0x3,0x5a,0xff,
+    0x17,0xa8,0xbf,0x69,0x46,0x1c,0xc9,0x1c,0xc0,0x71,0x2,0x1,0xbf,0x97,0x17,0xaa,
+    0x17,0xa9,0x1,0x5f,0x0,0x40,0xff,0xff,0x18,0x98,0xc1,0x17,0xc,0xaa,0x3,0xff,
+    0xc2,0x1,0x9c,0xe5,0x17,0xad,0x7,0xa0,0xff,0x8,0x5,0x43,0xa4,0x7,0xc,0xa8,
+    0x3,0xff,0xc8,0xc,0xaa,0xc,0xca,0xfe,0xf7,0xb2,0xff,0xff,0x0,0x19,0x69,0x41,
+    0x80,0xf,0x8a,0xff,0x0,0x10,0x43,0x1,0x90,0xa,0x22,0x1,0xdd,0x99,0x35,0x2,
+    0x3,0xff,0x1d,0x73,0x1,0x0,0x28,0xf7,0xc,0xd5,0x1,0xbf,0x1,0x9b,0x7,0x90,
+    0x8,0xff,0x3,0x43,0x92,0x7,0x0,0x21,0xb8,0x1a,0xfd,0x99,0x2b,0xc,0x74,0x8,
+    0x1,0x98,0xb8,0x42,0xfb,0x4,0xd1,0x6f,0x0,0x94,0xe,0xe0,0x8,0x0,0xff,0x75,
+    0xe7,0x18,0x99,0x48,0x42,0x1a,0x90,0xdf,0x1,0xaa,0x1a,0xa9,0x3,0x43,0x0,0x53,
+    0xff,0xf9,0x1,0x83,0x0,0x7f,0x3,0x4e,0xff,0x5,0x94,0xf0,0xbf,0x25,0x2d,0x6,
+    0x0,0x95,0x5,0x19,0x1,0x3,0xff,0xa8,0x4,0xf0,0xbe,0xff,0x3,0x90,0x5,0xf5,
+    0x94,0xf,0x6,0x2,0xf,0x0,0xb6,0xff,0x2,0x90,0xff,0x2,0x46,0x1d,0x21,0x1e,
+    0x20,0xf9,0xf7,0x7f,0x5b,0xfa,0x6,0x90,0x5,0x97,0x6,0x49,0x5,0xf5,0x6,0x1f,
+    0x0,0x5,0x41,0x0,0xb3,0xfe,0xe,0x97,0x77,0xd,0x97,0xc,0x49,0x1,0xb,0x90,
+    0xe,0x49,0x1,0x7f,0xd,0xab,0xc,0xaa,0xb,0xa9,0x13,0x49,0x1,0xf5,0x4a,0x49,
+    0x5,0x13,0x23,0x0,0xa9,0xfe,0x14,0x97,0xff,0x15,0x97,0xa,0x22,0x5,0x99,0x13,
+    0xa8,0xbd,0xc,0x2b,0x1,0xa1,0xfe,0x3,0x98,0xc1,0x2,0x16,0xfe,0xc1,0x28,0x16,
+    0x90,0xf,0xaa,0x13,0xa9,0x20,0xbf,0x98,0xf9,0xf7,0x38,0xf9,0x20,0xed,0x0,0xb,
+    0xbf,0x90,0x20,0x98,0x40,0x68,0xc,0x5,0x0,0x80,0xfb,0x68,0xd,0x5,0x0,0xc0,
+    0x68,0xe,0x90,0xb,0xfb,0xa9,0xb,0x59,0x0,0x1c,0xff,0xb,0x98,0x20,0xef,0x99,
+    0x8,0x60,0xc,0x5,0x0,0x48,0x60,0xd,0xee,0x5,0x0,0x88,0x60,0xe,0x5,0x0,
+    0xc8,0x60,0x21,0xef,0xb0,0xf0,0xbd,0x0,0x0,0x0,0xff,0xff,0xff,0xff,0x7f,0x1,
+    0x0,0x0,0xc0,0xf0,0xb5,0x93,0xff,0xb0,0x5,0x0,0xe,0x0,0x14,0x0,0x1f,0xff,
+    0x0,0xb,0xaa,0x21,0x0,0x30,0x0,0xfc,0xef,0xf7,0x4b,0xff,0xb,0x17,0x1,0xb,
+    0x90,0x3b,0xfb,0x0,0x32,0xb9,0x1,0xb,0xa8,0xff,0xf7,0x92,0xff,0xfe,0x0,0x24,
+    0x1,0x94,0xa8,0x68,0x42,0xfb,0x42,0x1f,0xf1,0x4,0xe2,0xf9,0x1,0x90,0x2,0xff,
+    0x94,0x80,0x20,0x80,0x5,0x1,0x99,0x46,0xf3,0x18,0x0,0x41,0x1,0x15,0x3,0x5,
+    0xf0,0x38,0xfe,0xff,0x6,0x94,0x5,0x94,0x4,0x94,0x80,0x25,0xdf,0xed,0x5,0x3,
+    0x95,0x6,0xf7,0x0,0x5,0xab,0xdf,0x4,0xaa,0x3,0xa9,0x7,0xf7,0x0,0xce,0xf9,
+    0xdf,0xa,0x22,0x31,0x0,0x7,0x25,0x0,0x2d,0xfe,0xff,0x8,0x94,0xa,0x22,0x2,
+    0x99,0x7,0xa8,0xdd,0x8,0xf5,0x0,0x26,0xfe,0x9,0x6d,0x0,0x9,0x90,0xff,0xa,
+    0x94,0x3a,0x0,0x7,0xa9,0x38,0x0,0xff,0xf9,0xf7,0xc9,0xf8,0x38,0x68,0xa0,0x42,
+    0xd3,0x1a,0xda,0x4b,0x6,0x47,0x12,0xe,0x47,0x0,0xaa,0xf9,0xff,0x38,0x0,0xe,
+    0xa9,0x4,0x22,0x4,0x68,0xff,0x63,0x42,0xb,0x60,0x9,0x1d,0x0,0x1d,0xef,0x52,
+    0x1e,0xf8,0xd1,0x13,0x2,0x10,0x22,0xfe,0xef,0xf7,0x7,0xfb,0x13,0xe1,0x0,0xf0,
+    0xb5,0x83,0xff,0xb0,0x0,0x21,0x1,0x91,0x0,0x26,0x0,0xff,0x27,0x4,0x0,0x3,
+    0x25,0x20,0x68,0x40,0xff,0x10,0xc1,0x17,0x2,0x0,0xb,0x0,0xfe,0xfe,0xcb,0x0,
+    0x80,0x19,0x79,0x41,0x6,0x0,0xf,0xff,0x0,0x24,0x1d,0x6d,0x1e,0xf1,0xd1,0x2,
+    0xff,0x20,0x0,0x90,0x32,0x0,0x3b,0x0,0x1,0xbe,0x99,0x0,0x9e,0xfd,0x1,0x98,
+    0x3,0x3f,0x0,0xf8,0xff,0xb5,0x7,0x0,0xc,0x0,0x25,0x68,0x38,0xfe,0x37,0x0,
+    0x4,0xf0,0xc3,0xfd,0x0,0xf0,0xd5,0xef,0xf9,0x6,0x0,0x68,0xb,0x0,0xbd,0xfd,
+    0x3,0xff,0x25,0x0,0xf0,0xce,0xf9,0x28,0x1a,0x4,0xff,0x21,0x89,0x1b,0x88,0x42,
+    0x0,0xda,0x8,0xff,0x0,0x6,0x0,0x2,0x20,0x81,0x1b,0x38,0xff,0x68,0xfd,0xf7,
+    0x43,0xff,0x5,0x0,0x1,0xfa,0xb,0x0,0x20,0xb,0x0,0x3d,0xff,0x1,0x0,0x28,
+    0xff,0x0,0x0,0xf0,0xbe,0xfa,0xf2,0xbd,0x0,0xff,0x21,0x41,0x62,0xc1,0x62,0x1,
+    0x63,0x41,0xff,0x63,0x70,0x47,0x9,0x68,0x1,0x60,0x11,0xff,0x68,0x41,0x60,0x19,
+    0x68,0x81,0x60,0x70,0xff,0x47,0xf7,0xb5,0x5,0x0,0x6a,0x68,0x52,0xff,0x1c,0x6a,
+    0x60,0x0,0x20,0x1,0x2a,0x2,0xff,0x9a,0xb,0xd1,0xea,0x60,0x2a,0x0,0x10,0xff,
+    0x32,0x2b,0x68,0x98,0x42,0x39,0xd2,0xb,0xff,0x68,0x13,0x60,0x40,0x1c,0x9,0x1d,
+    0x12,0xff,0x1d,0xf6,0xe7,0x54,0x10,0xea,0x68,0x52,0xfb,0x10,0xa4,0x6d,0x1,0xf,
+    0x0,0x2e,0x0,0x10,0xf7,0x36,0x1c,0xe0,0xd1,0x0,0x9a,0xd3,0x17,0xfe,0xff,0xf7,
+    0x29,0xfe,0x40,0x8,0xca,0x7,0x10,0xff,0x43,0x49,0x10,0x22,0x0,0xe3,0x17,0x3,
+    0xff,0xf0,0xf6,0xf8,0x1,0x99,0x9,0x18,0x48,0xaf,0x0,0x30,0x60,0xa8,0xbf,0x0,
+    0xa0,0xa3,0x0,0x4,0xff,0x0,0x60,0x0,0xe8,0x60,0x0,0x98,0x40,0xff,0x1c,0x0,
+    0x90,0x36,0x1d,0x3f,0x1d,0x0,0x7f,0x98,0x29,0x68,0x88,0x42,0x9,0xd2,0xdf,0x2,
+    0xff,0x31,0x68,0x49,0x10,0x1,0x91,0x40,0x1a,0xff,0x0,0x2c,0xd6,0xd1,0x2,0x48,
+    0xe1,0xe7,0x7e,0xff,0x2,0x0,0xbf,0xff,0xff,0xff,0x7f,0xfc,0x1,0xff,0x22,0x3,
+    0x0,0x19,0x60,0xd9,0x60,0x99,0xff,0x61,0x52,0x1c,0x1b,0x1d,0x3,0x2a,0xf8,0xff,
+    0xdb,0x24,0x30,0x1,0x60,0x81,0x60,0xc1,0xff,0x60,0x1,0x61,0x1,0x21,0x1,0x71,
+    0x70,0xff,0x47,0x81,0x62,0xc2,0x62,0x3,0x63,0x2,0xff,0x68,0x1,0x0,0x38,0x31,
+    0x0,0x23,0x4b,0xdf,0x60,0xa,0x60,0xf8,0x30,0x19,0x0,0x70,0x41,0xff,0x70,0x70,
+    0x47,0xf4,0xb5,0x4,0x0,0xe,0xff,0x0,0x1,0x2e,0x1,0xda,0x0,0x20,0x19,0xef,
+    0xe0,0xc,0x25,0x30,0xd,0x1,0x31,0xf9,0x29,0xff,0x1a,0x1,0x25,0x8,0x0,0x28,
+    0x40,0xf,0xff,0x18,0xb,0x20,0xc1,0x1b,0x30,0x0,0xfd,0xff,0xf7,0xa8,0xfe,0x0,
+    0x99,0x0,0xf0,0x4e,0xbf,0xfb,0xa9,0x7,0x49,0x1b,0x81,0x51,0x5,0x79,0xff,0x10,
+    0x49,0x1f,0xfd,0xf7,0x9c,0xfe,0x20,0xff,0x60,0x20,0x0,0xf2,0xbd,0xf1,0xb5,0x82,
+    0xff,0xb0,0x8,0x0,0x2,0x99,0x49,0x68,0x2,0x7f,0x29,0x3,0xd2,0x5,0xf0,0xb2,
+    0xfd,0xa3,0x4,0xff,0x27,0x0,0x90,0x2,0x98,0x30,0x30,0x1,0xff,0x90,0x19,0xe0,
+    0xcc,0x17,0xcd,0x17,0xf2,0xff,0x17,0x13,0x0,0x73,0x40,0x9a,0x1a,0x60,0xff,0x40,
+    0x69,0x40,0x2b,0x0,0x0,0x1b,0x99,0xff,0x41,0xff,0xf7,0xce,0xfa,0xf1,0x17,0x61,
+    0xf7,0x40,0x48,0x40,0xdd,0x0,0x99,0x8,0x60,0x7f,0xef,0x1c,0x1,0x98,0x8,0x2f,
+    0x0,0x0,0x98,0x0,0xfd,0x1d,0x3b,0x2,0x0,0x68,0x87,0x42,0xd9,0xd2,0xbf,0x2,
+    0x98,0x46,0x68,0x76,0x1e,0xf7,0x1,0xc8,0xff,0x0,0xe,0xa,0x2,0x10,0x43,0x9,
+    0x16,0xff,0x0,0x2e,0xd6,0xd1,0x0,0x48,0xe5,0xe7,0xf6,0x3,0x3,0x30,0xb4,0x3,
+    0x3,0x78,0x33,0x8,0xe0,0xff,0x5c,0x6a,0x64,0x10,0x1d,0x68,0x6d,0x10,0xef,0x64,
+    0x1b,0xc,0x60,0xd,0x3,0x9,0x1d,0x4,0x7f,0x68,0xa2,0x42,0xf3,0xd3,0x30,0xbc,
+    0xe9,0x2,0xff,0x98,0xb0,0x4,0x0,0x0,0x25,0xf8,0x20,0xff,0x20,0x5c,0x0,0x28,
+    0x2,0xd0,0xe5,0x63,0xff,0xf8,0x22,0xa5,0x54,0x20,0x0,0x38,0x30,0xff,0x5,0xf0,
+    0x62,0xfd,0x18,0x98,0x24,0x30,0xff,0x0,0x90,0x5,0x70,0x0,0x99,0x4d,0x70,0xff,
+    0x18,0x98,0x5,0xf0,0x52,0xfd,0xe,0xa9,0xfe,0x1b,0x2,0xff,0xf7,0xd0,0xff,0xe0,
+    0x6b,0x4,0xff,0x90,0x20,0x0,0xf8,0x30,0x40,0x78,0x1,0xff,0x28,0x3f,0xd1,0x1,
+    0x95,0xe,0xae,0x5,0xff,0xaf,0x20,0x1d,0x2,0x90,0x7,0xe0,0x1,0xf2,0xad,0x1,
+    0x1,0xa5,0x2,0xd,0x0,0x3f,0x1d,0x36,0x1d,0xf7,0x1,0x98,0x21,0xb3,0x1,0x16,
+    0xd2,0x3,0x95,0xff,0x32,0x0,0x31,0x0,0x3,0xa8,0x5,0xf0,0xfb,0xb5,0xfd,0xc3,
+    0x2,0x80,0x0,0x38,0x60,0x3,0xff,0x99,0x4a,0x11,0x90,0x42,0x3,0xdb,0x82,0xff,
+    0x42,0xe3,0xdb,0xc8,0x6,0xe1,0xd0,0x1,0xff,0x20,0xf8,0x22,0xa0,0x54,0x0,0x99,
+    0x48,0x5f,0x70,0x4,0x98,0xa1,0x6a,0xe9,0x1,0xd1,0x99,0x6,0x7b,0x5,0xd1,0x6b,
+    0x2,0x45,0x70,0x1,0x20,0xf,0x1,0xff,0x70,0xf8,0x34,0x60,0x78,0x45,0x1e,0xad,
+    0xff,0x41,0xed,0xf,0x0,0x98,0x85,0x70,0x19,0x5e,0x53,0x3,0x28,0x5c,0xd1,0x2,
+    0x83,0x8,0x1,0x83,0x0,0x5d,0x2,0x83,0x0,0x2,0x90,0x1,0x83,0x0,0x1,0x83,
+    0x4,0xb5,0x2,0x83,0x4,0x15,0x83,0x10,0x73,0xfd,0x1d,0x0,0x68,0xfd,0xc0,0x83,
+    0x4,0x49,0x11,0x81,0x42,0xe5,0xdb,0xfe,0x7b,0x8,0x9a,0x50,0x70,0x21,0x0,0xf8,
+    0x31,0x7a,0x81,0x2,0xe1,0x81,0x0,0xc8,0xd3,0x18,0x99,0xf3,0x6,0xff,0x18,0xff,
+    0x20,0x1d,0x18,0x99,0x22,0x68,0xff,0x2,0xe0,0x6d,0x1c,0x9,0x1d,0x0,0x1d,0xff,
+    0x95,0x42,0xb,0xd2,0x3,0x68,0xe,0x68,0xef,0xb3,0x42,0xf6,0xda,0x3b,0x1e,0xa1,
+    0x6a,0xfe,0xbf,0xf7,0xe4,0xfa,0x0,0x29,0x6,0xc1,0x8,0x2,0xfd,0xd1,0xbb,0x6,
+    0x4,0x98,0x21,0x6b,0x88,0x42,0xfb,0x9d,0xd3,0xd,0x0,0x9a,0x10,0x70,0xf8,0x21,
+    0xef,0x60,0x54,0x97,0xe7,0x3d,0x0,0x34,0x60,0x70,0xff,0x98,0xe7,0x1,0x0,0x0,
+    0x20,0x0,0x29,0xff,0x4,0xd4,0x49,0x0,0x40,0x1c,0x20,0x28,0xff,0xf9,0xdb,0x20,
+    0x20,0x70,0x47,0xf8,0xb5,0xff,0x4,0x0,0xc1,0x17,0x22,0x0,0xe3,0x17,0xff,0xfe,
+    0xf7,0x91,0xfc,0x80,0xf,0x8a,0x0,0xff,0x10,0x43,0x0,0x94,0x6,0x0,0xc7,0x17,
+    0xff,0x20,0x46,0xc1,0x17,0x32,0x0,0x3b,0x0,0xf7,0xfe,0xf7,0x85,0x17,0xa,0x90,
+    0x0,0x9d,0x28,0xeb,0x0,0xe9,0x15,0x8,0x7a,0x15,0x8,0x5,0x0,0x0,0xff,0x98,
+    0xc1,0x17,0x62,0x4a,0x0,0x23,0xfe,0xbb,0xf7,0x70,0x13,0x8,0x24,0x1a,0x28,0x55,
+    0x0,0x5e,0xaa,0x13,0x4,0x66,0x13,0xa,0x18,0x3b,0xe,0x5c,0x13,0x8,0xc1,0xeb,
+    0x17,0x56,0x23,0x4,0x54,0xf,0x8,0x20,0x1a,0xf2,0xff,0xbd,0xf0,0xb5,0x2,0x0,
+    0xd1,0x17,0xd3,0x92,0x8f,0x0,0x49,0x15,0x8,0xa1,0xe,0x40,0x11,0x8,0x9f,0x4,
+    0x0,0xf5,0xe1,0x4d,0x8,0x35,0x89,0xc,0x80,0x20,0xc0,0x5,0xff,0x61,0x10,0x44,
+    0x1a,0x30,0x0,0x39,0x0,0x55,0x41,0x59,0x4,0x27,0x7d,0x14,0x3d,0x13,0x4,0x1d,
+    0x6d,0xc,0xff,0xf0,0xbd,0x80,0xb5,0x0,0x29,0x5,0xd0,0x7f,0x2,0x29,0x9,0xd0,
+    0x5,0xd3,0x3,0x5,0x0,0xff,0xd,0xe0,0xff,0xf7,0x75,0xff,0x2,0xbd,0x77,0xff,
+    0xf7,0xbb,0x5,0x4,0x6f,0xff,0x1,0x11,0x0,0xff,0xb5,0xff,0x1,0x0,0x48,0x42,
+    0x2,0xbd,0xff,0x0,0x20,0x2,0xbd,0x38,0xb5,0x0,0x21,0xff,0x2c,0x4a,0x2c,0x4b,
+    0x2d,0x4c,0x2d,0x4d,0xff,0x9,0xe0,0x98,0x42,0x1,0xda,0x80,0x18,0xff,0x49,0x1e,
+    0x0,0x29,0x0,0xd5,0x9,0x1d,0xff,0x4,0x29,0x0,0xdb,0x9,0x1f,0xa8,0x42,0xff,
+    0x5,0xda,0x98,0x42,0xf1,0xdb,0x40,0x2,0xff,0xff,0xf7,0xcf,0xff,0x32,0xbd,0x0,
+    0x19,0xaf,0x49,0x1c,0xee,0xe7,0x69,0x16,0xb,0x69,0x4,0x89,0xea,0x63,0x4,0x3d,
+    0x63,0x4,0x83,0x63,0x8,0xff,0xf7,0x35,0xfc,0x15,0x0,0x69,0xa,0x11,0x4a,0x12,
+    0x4b,0x12,0x4c,0xfd,0x13,0x69,0x54,0xb0,0xaa,0xaa,0xa,0x89,0x88,0xff,0x88,0x0,
+    0x34,0x40,0x3,0x0,0xac,0xaa,0xff,0xaa,0x2,0x6c,0xc1,0x16,0x0,0xf7,0x43,0xff,
+    0x32,0x0,0x5,0xde,0xe6,0xff,0x9,0xbc,0xff,0xcd,0xff,0xfc,0x21,0x19,0x0,0xf0,
+    0xb5,0xff,0x85,0xb0,0x5,0x0,0xc,0x0,0x80,0x11,0xff,0xc1,0x17,0x48,0x40,0x40,
+    0x1a,0xe1,0x17,0xff,0xa,0x0,0x62,0x40,0x51,0x1a,0x0,0x91,0xff,0x49,0x11,0x81,
+    0x42,0x10,0xdb,0x60,0x11,0x7f,0x1,0xd1,0xe0,0x6,0x4f,0xd0,0x68,0x7,0x0,0xff,
+    0xe8,0x6,0x51,0xd0,0xef,0x17,0xbf,0x6,0xff,0xa8,0x9,0x7,0x43,0xae,0x6,0x0,
+    0x2c,0xff,0x4f,0xd1,0x81,0x4e,0x63,0xe0,0x68,0x10,0xff,0x61,0x10,0xca,0x17,0x51,
+    0x40,0x8b,0x1a,0xff,0x0,0x22,0x0,0x21,0x0,0x2b,0x4,0xd4,0xff,0x5b,0x0,0x49,
+    0x1c,0x20,0x29,0xf9,0xdb,0xff,0x20,0x21,0xc3,0x17,0x58,0x40,0xc0,0x1a,0xff,0x0,
+    0x28,0x4,0xd4,0x40,0x0,0x52,0x1c,0xfb,0x20,0x2a,0x13,0x0,0x22,0x2,0x20,0x80,
+    0x1a,0xff,0x2,0x22,0x51,0x1a,0x88,0x42,0x0,0xda,0xff,0x8,0x0,0x41,0x42,0x8,
+    0x0,0x1,0xd4,0xff,0x84,0x40,0x5,0xe0,0x42,0x42,0x20,0x2a,0xff,0x1,0xdb,0xe4,
+    0x17,0x0,0xe0,0x14,0x41,0xdf,0x0,0x29,0x1,0xd4,0x8d,0x13,0x0,0x48,0x42,0xff,
+    0x20,0x28,0x1,0xdb,0xe9,0x17,0x1,0xe0,0xff,0x5,0x41,0x29,0x0,0x20,0x0,0xff,
+    0xf7,0xff,0xa7,0xff,0xa0,0x49,0x88,0x42,0x2,0xdb,0xbf,0x49,0x42,0x8,0x1a,0xbf,
+    0xe0,0x3d,0x2,0x9d,0xdf,0x49,0x40,0x18,0xba,0xe0,0x9f,0x0,0xd4,0x9b,0xff,0x48,
+    0xb6,0xe0,0x98,0x48,0xb4,0xe0,0x60,0xff,0x11,0x0,0xd4,0xb0,0xe0,0x9a,0x48,0xaf,
+    0xff,0xe0,0xf8,0x17,0xf9,0x17,0x2,0xaa,0x3,0xff,0xc2,0x0,0x9a,0x94,0x46,0x2,
+    0xa8,0x3,0xff,0xc8,0x70,0x40,0x79,0x40,0x2,0xaa,0xc,0xff,0xca,0x80,0x1a,0x99,
+    0x41,0x62,0x46,0xff,0xff,0xf7,0x4e,0xf8,0xfe,0x17,0xe1,0x17,0x71,0xff,0x40,0x48,
+    0x40,0x46,0x1a,0xf7,0x17,0x30,0xff,0x0,0x39,0x0,0x32,0x0,0x3b,0x0,0xfe,0xff,
+    0xf7,0x10,0xfb,0x80,0xe,0x8a,0x1,0x10,0xff,0x43,0x2,0x90,0x79,0x7,0xf2,0x8,
+    0x11,0x7f,0x43,0x70,0x7,0x0,0x90,0x1,0x91,0x1f,0x2,0x7f,0x2,0x9a,0xd3,0x17,
+    0xfe,0xf7,0x0,0x1f,0x8,0xff,0xc1,0x17,0x7f,0x4a,0x0,0x23,0xfe,0xf7,0xff,0xf8,
+    0xfa,0x0,0x9a,0x1,0x9b,0x80,0x18,0xff,0x59,0x41,0x6a,0x46,0x3,0xc2,0x2,0x98,
+    0xf7,0xc1,0x17,0x7b,0x17,0x4,0xec,0xfa,0x6,0x0,0xdb,0xf,0x0,0xf,0x2,0x2,
+    0x46,0x37,0x2,0xe4,0xfa,0xfa,0x37,0xa,0x74,0x1f,0x4,0xdc,0xfa,0x80,0x19,0x79,
+    0xff,0x41,0x0,0x22,0x80,0x23,0x1b,0x4,0x12,0xff,0x18,0x4b,0x41,0x52,0xf,0xd8,
+    0x0,0x2,0xff,0x43,0x16,0x0,0x1,0xd1,0x2a,0x48,0x21,0xff,0xe0,0x68,0x46,0x3,
+    0xc8,0xc8,0x17,0xc9,0xfe,0xc1,0x4,0xf0,0x17,0x1,0x0,0x71,0x40,0xf,0xff,0x1a,
+    0x68,0x46,0xc,0xc8,0x3,0xc8,0x50,0x7f,0x40,0x59,0x40,0x2,0x0,0xb,0x0,0xd3,
+    0x2,0xff,0x12,0x1a,0x8b,0x41,0x10,0x0,0x19,0x0,0xbd,0x3a,0xb7,0x0,0xe6,0xff,
+    0x2,0x0,0x35,0x6,0xf1,0xff,0x17,0x41,0x40,0x4a,0x40,0x50,0x1a,0x69,0xff,0x11,
+    0x1,0x29,0x1,0xdb,0x1,0x21,0x9,0xfd,0xe0,0x53,0x1,0xd5,0x0,0x21,0x5,0xe0,
+    0xe9,0xff,0x6,0xc9,0xe,0x49,0x1e,0x89,0x41,0xc9,0xbf,0x43,0xc9,0xf,0x62,0x11,
+    0x1,0x73,0x1,0x1,0xf5,0x22,0x1d,0x0,0x2a,0x1d,0x0,0x22,0x5,0xe0,0xe2,0xff,
+    0x6,0xd2,0xe,0x52,0x1e,0x92,0x41,0xd2,0xff,0x43,0xd2,0xf,0x89,0x0,0x52,0x0,
+    0x89,0xff,0x18,0x6,0xd0,0x2,0x29,0xa,0xd0,0x4,0xff,0x29,0x4,0xd0,0x6,0x29,
+    0x6,0xd0,0x4,0xff,0xe0,0x47,0x49,0x0,0xe0,0x43,0x49,0x8,0xff,0x18,0x0,0xe0,
+    0x0,0x20,0x5,0xb0,0xf0,0xff,0xbd,0x0,0x0,0xff,0xff,0xff,0x7f,0x7b,0xff,0xb5,
+    0x83,0xb0,0x1,0x28,0x1,0xda,0x0,0xf7,0x20,0x6d,0xe0,0xed,0xa,0x6d,0xfa,0xc6,
+    0xf,0xff,0x4a,0x0,0x16,0x43,0x80,0x22,0xd2,0x5,0x7f,0x2,0x40,0x0,0xd0,0x76,
+    0x1c,0x3,0x9,0x1,0xff,0x7a,0xa2,0xc,0xca,0xfe,0xf7,0x5f,0xfa,0xff,0x4,0x0,
+    0xd,0x0,0x30,0x0,0xc1,0x17,0x7d,0x78,0x9,0x5,0x57,0xfa,0x0,0x19,0x69,0x9,
+    0x1,0xfb,0x75,0x4b,0x7,0x3,0x80,0xf,0x9c,0x0,0x20,0xbf,0x43,0x80,0x24,0xa4,
+    0x5,0x14,0x37,0x0,0x40,0xd7,0x1c,0x2,0x90,0x39,0x2,0x6f,0x29,0x4,0x42,0xfa,
+    0xff,0x0,0x24,0x6e,0x4d,0x24,0x18,0x4d,0x41,0xff,0x6d,0x49,0x3,0x98,0x40,0x10,
+    0x3,0x9a,0xff,0x8a,0x42,0x2,0xd0,0xd1,0x7,0x0,0xd5,0xff,0x40,0x1c,0x1,0x90,
+    0x4,0x98,0x1,0x28,0x7f,0x24,0xdb,0x0,0x90,0xe2,0xf,0x68,0x49,0x1,0xdf,0x80,
+    0x20,0xc0,0x5,0x20,0x41,0x0,0x52,0x1c,0xfb,0xd3,0x17,0x23,0x3,0xfe,0xf7,0x23,
+    0xfa,0x82,0xff,0xf,0x8e,0x0,0x32,0x43,0x80,0x26,0xb6,0x7b,0x5,0x6,0x19,0x4,
+    0x1,0x98,0x82,0x1a,0xa1,0x3,0xf2,0xb1,0x2,0x14,0x85,0x4,0x99,0x2,0x0,0x98,
+    0x40,0x1e,0xff,0x0,0x90,0xdb,0xd1,0xe0,0xf,0x6a,0x0,0xf5,0x10,0xc1,0x4,0x22,
+    0x89,0x4,0x6,0xb0,0x70,0xbd,0xff,0x40,0x9,0xbc,0xcd,0xc0,0x1b,0x34,0x69,0xff,
+    0xc0,0xf6,0x43,0x32,0xd0,0x72,0xe7,0xb,0xff,0x80,0xed,0x87,0x64,0x20,0x1f,0x82,
+    0x16,0xff,0x22,0xdc,0x64,0x1,0x80,0x12,0x78,0x9b,0xbf,0x79,0xb5,0x84,0xb0,0xc,
+    0x0,0xd,0x7,0x7a,0xfe,0xd,0xd,0xe6,0xf9,0x2,0x0,0xc0,0xf,0x4d,0xf7,0x0,
+    0x28,0x43,0xd1,0x1,0xad,0x3,0xc5,0x80,0x9f,0x26,0xf6,0x5,0x32,0x40,0x5d,0x1,
+    0xc3,0x1,0x0,0x5f,0x22,0x40,0x1c,0x51,0x41,0xe7,0x3,0x4,0x89,0x0,0xfd,0x38,
+    0x21,0x5,0xce,0xf9,0x0,0x90,0x1,0x91,0xee,0x1d,0x2,0xc1,0x17,0x36,0xf9,0x4,
+    0xc5,0xf9,0x0,0xbf,0x9a,0x1,0x9b,0x80,0x18,0x59,0x27,0x1,0x32,0xae,0x27,0x5,
+    0xc0,0xf,0x5d,0x4f,0x0,0x16,0x99,0x4,0x1,0xff,0x2c,0x44,0xdb,0x0,0x94,0x4,
+    0x99,0x4a,0xff,0x42,0x2,0x92,0x4,0x0,0xc5,0x17,0x29,0x6f,0x0,0x22,0x0,0x2b,
+    0xf1,0x0,0xaa,0xf9,0xf1,0x1a,0xe9,0x10,0x75,0x1,0x1b,0x6,0x9c,0x1b,0x1c,0x56,
+    0x10,0xd0,0xfe,0x49,0x1,0x76,0x1c,0x2,0x98,0x1,0x90,0x20,0x7f,0x0,0x29,0x0,
+    0xc0,0x22,0x92,0x5,0x7b,0x2,0xeb,0x87,0xf9,0x15,0x3,0x1,0x9d,0x0,0x32,0x0,
+    0xf3,0xf6,0xcd,0x0,0x7f,0xf9,0x29,0x3,0x42,0xf,0xcc,0x0,0xdd,0x22,0xa7,0x1,
+    0x64,0x5,0x4,0x59,0x8,0x0,0x99,0xbf,0x49,0x1e,0x0,0x91,0xbe,0xd1,0x27,0x3,
+    0x0,0xef,0xc8,0x98,0x9b,0xff,0x0,0x0,0x0,0xfe,0xd4,0xff,0x30,0xc0,0x49,0xc,
+    0x2a,0xc0,0xaa,0xaa,0xdf,0x2a,0x10,0x56,0x55,0xb,0x12,0x0,0x7f,0x80,0xf7,0xf3,
+    0xe0,0x96,0x1b,0x2,0xc0,0xda,0x6d,0x34,0xff,0x0,0xb0,0xba,0x2a,0xf6,0xb5,0x89,
+    0xb0,0xff,0x0,0x24,0x15,0x46,0xe,0x46,0x7,0x0,0xff,0x3,0x20,0x39,0x68,0x31,
+    0x60,0x3f,0x1d,0xff,0x36,0x1d,0x40,0x1e,0xf9,0xd1,0x20,0x0,0xff,0x5,0xf0,0xfc,
+    0xf9,0x1,0x0,0xfe,0x20,0xff,0x80,0x5,0x3,0xf0,0x9b,0xf8,0x28,0x60,0xff,0x64,
+    0x1c,0x38,0x0,0x2d,0x1d,0x3,0x2c,0xff,0xe9,0xdb,0x0,0x20,0x0,0x90,0x9,0x98,
+    0xdf,0x6,0x90,0xa,0x98,0x2,0x7,0x0,0x1,0x90,0xfe,0xb5,0x1,0x1c,0x5,0x90,
+    0x3,0x46,0x1,0x98,0xff,0x0,0x68,0x40,0x0,0x40,0x8,0x0,0x99,0xff,0x89,0x1c,
+    0x4,0x91,0xa,0x46,0x0,0x99,0xff,0x4c,0x0,0x64,0x18,0x9,0x99,0x15,0x19,0xff,
+    0xad,0x0,0x49,0x19,0x9,0x1f,0x7,0x91,0xff,0xd,0x46,0x29,0x68,0x49,0x0,0x49,
+    0x8,0xff,0x3,0xf0,0x2,0xf9,0x1,0xd2,0x8,0x0,0xff,0x13,0x0,0x52,0x1c,0x2d,
+    0x1d,0x4,0x2a,0xff,0xf3,0xdb,0x5,0x98,0x83,0x42,0x1c,0xd0,0xdf,0x9d,0x0,0x9,
+    0x98,0x41,0x29,0x0,0x6,0x9a,0xff,0x3,0x23,0x8,0x68,0x16,0x68,0xe,0x60,0xff,
+    0x10,0x60,0xc,0x32,0xc,0x31,0x5b,0x1e,0x77,0xf7,0xd1,0x2,0x5d,0x0,0x5,0xf0,
+    0xce,0xcf,0x1,0xff,0xa,0x98,0x45,0x19,0x2d,0x1f,0x28,0x68,0xdf,0x2,0x99,0x8,
+    0x60,0x10,0xa7,0x0,0xa8,0xf9,0xff,0x28,0x60,0x9,0x98,0x0,0x99,0x9,0x19,0xff,
+    0x89,0x0,0x40,0x58,0x0,0x21,0x3,0xf0,0xef,0xe7,0xf8,0x11,0xd0,0x11,0x4,0x1,
+    0x44,0x18,0xff,0x24,0x1d,0x4,0x20,0x0,0x99,0x45,0x1a,0xff,0xad,0x1e,0x20,0x68,
+    0x1,0x99,0x9,0x68,0xff,0x3,0xf0,0xd2,0xfd,0x20,0x60,0x24,0x1d,0xbf,0x6d,0x1e,
+    0xf6,0xd1,0x4,0x9c,0x25,0x2,0x62,0xdf,0x0,0x12,0x19,0x89,0x18,0x3b,0x0,0x18,
+    0xc,0xff,0x38,0x3,0x90,0x4,0x9b,0x9,0x98,0x61,0xef,0x0,0x9,0x19,0x59,0x11,
+    0x0,0x45,0x18,0x10,0xf7,0x3d,0x7,0x9e,0x3f,0x2,0x47,0x1a,0xbf,0x1e,0xf7,0x31,
+    0x68,0x3,0x83,0x0,0x3,0xf0,0xb3,0xfa,0xd7,0x1,0x0,0x28,0x7,0x0,0x48,0x15,
+    0x1,0x36,0x1d,0xff,0x2d,0x1d,0x7f,0x1e,0xf1,0xd1,0x64,0x1c,0x6f,0x3,0x98,0xc,
+    0x30,0x3d,0x0,0x2c,0xde,0xcb,0x0,0xff,0x0,0x90,0x1,0x98,0x10,0x30,0x1,0x90,
+    0x5e,0xb3,0x0,0x1d,0x2,0x90,0x6,0x5,0x0,0x6,0x25,0x1,0xff,0x2,0x28,0x0,
+    0xda,0x68,0xe7,0xb,0xb0,0xff,0xf0,0xbd,0xf6,0xb5,0x97,0xb0,0xa,0xaa,0xff,0xd,
+    0xa9,0xff,0xf7,0x3e,0xff,0x0,0x24,0xfd,0x18,0x2f,0x0,0x7,0xad,0x4,0xae,0xa,
+    0xaf,0xdc,0x59,0x1,0xd3,0x0,0x2c,0x60,0x38,0xe9,0x0,0x59,0xf9,0xe7,0x40,0x1e,
+    0x30,0x75,0x1,0x91,0x3,0x2d,0x1d,0x0,0xfe,0x43,0x0,0x0,0x90,0x3,0x2c,0xed,
+    0xdb,0x7,0xff,0xa8,0x4,0xa9,0x3,0x22,0x17,0x9b,0xc,0xff,0x68,0xa4,0x0,0x1b,
+    0x59,0x18,0x9c,0x5,0xff,0x68,0xad,0x0,0x63,0x51,0x9,0x1d,0x0,0xdf,0x1d,0x52,
+    0x1e,0xf3,0xd1,0x4d,0x6,0xa0,0x1c,0xff,0x2,0x90,0x4,0x28,0x1d,0xda,0x18,0x98,
+    0xfb,0x2,0x99,0xc5,0x2,0x2d,0x1f,0xd,0xa8,0x2,0xfe,0xe7,0xc,0x46,0x18,0x36,
+    0x1f,0x4,0x20,0x7,0xff,0x1b,0xbf,0x1e,0x0,0x98,0x1,0x68,0x30,0x7a,0xc9,0x0,
+    0x4a,0xd1,0x4,0x2,0xf0,0xdf,0xff,0xd1,0x12,0xee,0x73,0xa,0xd7,0xdb,0x3,0xf1,
+    0x1,0x18,0x98,0x8,0xee,0xd1,0x0,0xd,0xa8,0x18,0xe5,0x0,0xd,0xac,0x20,0x75,
+    0x34,0xed,0x3,0x21,0x3b,0x0,0x2b,0xfd,0x1,0xb3,0x0,0xff,0x0,0x98,0x40,0x1e,
+    0x2,0x90,0x1,0x25,0xff,0x1,0x28,0x11,0xdb,0x18,0x9e,0x3,0x9f,0x55,0x1,0x59,
+    0x0,0x38,0x1d,0x0,0x1d,0x59,0x0,0x30,0x59,0x0,0xdf,0xb2,0xff,0x30,0x60,0x6d,
+    0xcb,0x4,0x2,0x98,0xef,0xa8,0x42,0xef,0xda,0x2f,0x2,0x0,0x90,0x10,0xb1,0x3c,
+    0x35,0x1,0x73,0x1,0x4b,0x0,0x1f,0x1,0x21,0x1,0x1,0xef,0x28,0xd3,0xda,0x19,
+    0x1f,0x1,0xff,0xb5,0xf7,0xff,0xb0,0x51,0x21,0x25,0xa8,0xfd,0xf7,0x46,0xaf,0xfc,
+    0x9,0x21,0x1c,0x7,0x0,0x42,0x7,0x0,0x13,0xea,0x7,0x0,0x3e,0x7,0x0,0xa,
+    0x7,0x0,0x3a,0xfc,0x25,0xff,0xa8,0x9,0x21,0xfe,0x22,0x92,0x5,0x2,0x7f,0x60,
+    0x28,0x30,0x49,0x1e,0xfb,0xd1,0x3b,0x1,0xff,0x90,0x25,0xa8,0x1,0x90,0x1c,0xa8,
+    0x8,0xff,0x90,0x0,0x24,0x15,0xe0,0x0,0x24,0x1,0xff,0x28,0x12,0xdb,0x1c,0xad,
+    0x1,0x9e,0x7,0xff,0x46,0x30,0x68,0x1,0x0,0x3,0xf0,0xd7,0xfd,0xf9,0xb7,0x7,
+    0xd3,0xf9,0x21,0x0,0x2,0xf0,0xbf,0x31,0xff,0x4,0x0,0x24,0x36,0xeb,0x2,0xef,
+    0xff,0xd1,0x0,0x98,0xc1,0x0,0xd,0x18,0x77,0xff,0x98,0x0,0x99,0x49,0x19,0x89,
+    0x0,0x40,0xfd,0x58,0x1f,0x2,0x59,0xff,0x2,0x0,0x8,0x98,0xff,0x2,0x60,0x10,
+    0x0,0x0,0x21,0x2,0xf0,0xff,0xbe,0xff,0x6,0xd0,0xfe,0x20,0x80,0x5,0xfd,0x11,
+    0x47,0x0,0xb2,0xfc,0x9,0x90,0x0,0xe0,0xfb,0x9,0x91,0xc3,0x0,0x1c,0x7,0x90,
+    0x9,0x28,0xff,0x44,0xda,0x25,0xa9,0x82,0x0,0x89,0x18,0xff,0x6,0x91,0x40,0x19,
+    0x80,0x0,0x25,0xa9,0xff,0x9,0x18,0x5,0x91,0x77,0x99,0x8,0x18,0xf7,0x2,0x90,
+    0x9,0xcf,0x1,0x40,0x1a,0x40,0x1e,0xe9,0x3,0x91,0x0,0xdd,0x2,0x18,0x8f,0x0,
+    0x6,0x98,0x4,0xbf,0x90,0x1,0x9e,0x0,0x9f,0x4,0x7b,0x9,0x8c,0xda,0x95,0x8,
+    0x88,0x95,0x4,0xe6,0xfe,0x95,0x2,0x4,0x98,0xef,0x24,0x30,0x4,0x90,0x9b,0x2,
+    0xeb,0xd1,0x2,0xfc,0x67,0x3,0x19,0x0,0x11,0xff,0x9,0x99,0x3,0xf0,0xe7,0x75,
+    0xf9,0x5,0x6d,0x1,0x13,0x0,0x1d,0x2,0x90,0xdd,0x5,0x5,0x0,0x5,0x90,0x6,
+    0x5,0x0,0x6,0x90,0x7d,0x3,0x4f,0x1,0x3,0x90,0xcb,0xd1,0x7,0xfd,0x1,0xd5,
+    0x8,0x11,0x0,0x8,0x53,0x3,0x1d,0x53,0x3,0x9,0x28,0xdf,0x0,0xda,0x78,0xe7,
+    0x78,0x45,0x0,0x13,0x90,0x69,0x1,0x23,0x5,0x17,0x2,0x13,0x5,0x0,0x4,0x90,
+    0x15,0x0,0xbf,0x1d,0x3,0x90,0x8,0x20,0x2,0x9f,0x0,0x13,0x5e,0x29,0x1,0x0,
+    0x9f,0x31,0x68,0x8b,0x2,0x42,0x8b,0x4,0xb9,0xa0,0x8b,0x4,0x85,0x2,0xf3,0xd1,
+    0x3,0x85,0x8,0xce,0x9b,0xfe,0x4,0xed,0x7,0x1c,0x0,0x73,0x0,0x3d,0x2,0x4,
+    0xe8,0x5,0x0,0xd1,0x0,0x6d,0x4,0x2,0x85,0x0,0x2,0x90,0xd8,0xff,0xd1,0x1c,
+    0xac,0xa,0xad,0x13,0xae,0x9,0xf7,0x27,0x22,0x68,0x3d,0x7,0x1f,0xff,0x4,0xd0,
+    0xfb,0x30,0x68,0x3b,0x3,0x14,0xfc,0x0,0xe0,0x0,0xff,0x20,0x28,0x60,0x36,0x1d,
+    0x2d,0x1d,0x24,0xfe,0x59,0x0,0xed,0xd1,0x12,0x98,0x79,0x99,0x8,0xff,0x62,0x7,
+    0x25,0x79,0x98,0x1c,0x30,0x1,0xdf,0x90,0xa,0xa8,0x1c,0x30,0x8d,0x2,0x68,0x1c,
+    0xff,0x25,0xa9,0xea,0x0,0x52,0x19,0x82,0x18,0xff,0x92,0x0,0x8e,0x18,0x79,0x99,
+    0x80,0x0,0xf7,0x8,0x18,0x0,0x4f,0x1,0x47,0x1b,0x7f,0x1e,0xf7,0x31,0x68,0x0,
+    0x8d,0x0,0x3,0xf0,0xef,0xf8,0xf2,0x91,0x2,0x4d,0xa5,0x0,0xf,0x0,0x1d,0x0,
+    0x90,0x36,0xba,0x4f,0x0,0xf0,0x2f,0xd,0x79,0xfe,0x1,0xa9,0x0,0x6d,0xad,0x1e,
+    0xf,0x0,0x1f,0x2,0x9f,0x2,0x1f,0xd,0x1,0x2d,0xff,0xd1,0xd5,0x7a,0x98,0x0,
+    0x28,0x13,0xd0,0xf7,0x1c,0x98,0x7a,0x1d,0x0,0x1c,0xac,0x24,0x1d,0xdb,0x8,0x25,
+    0x11,0x0,0x68,0x21,0x4f,0x0,0xc7,0xf8,0xfe,0x13,0x2,0x24,0x1d,0x6d,0x1e,0xf5,
+    0xd1,0x40,0xf7,0x0,0x40,0x8,0xd,0x2,0x7b,0xb0,0xf0,0xbd,0xff,0xff,0xb5,0x95,
+    0xb0,0x10,0xa8,0x0,0x21,0xff,0x1,0x60,0x2,0x21,0x9,0xa8,0xfd,0xf7,0x5f,0xfc,
+    0xfa,0x2,0x21,0xb,0x7,0x0,0xf8,0x7,0x0,0xfd,0xd,0x7,0x0,0xf4,0xfa,0xfe,
+    0x20,0x80,0x5,0xdf,0x10,0x90,0x13,0x90,0x0,0x5f,0x1,0x10,0xa8,0xdf,0x1,0x90,
+    0x9,0xa8,0x8,0xc3,0x0,0x15,0xe0,0x7f,0x0,0x24,0x1,0x28,0x12,0xdb,0x9,0x59,
+    0x1,0xdf,0x7,0x46,0x30,0x68,0x1,0xff,0x0,0x95,0xf8,0xfa,0xed,0x7,0x91,0xbb,
+    0x4,0xef,0xfd,0x4,0x0,0x8,0xfe,0x61,0x5,0xef,0xd1,0x0,0x98,0x45,0x0,0x15,
+    0xff,0x98,0x0,0x99,0x49,0x19,0x89,0x0,0x40,0xfd,0x58,0x1d,0x2,0x18,0xfe,0x1,
+    0x0,0x8,0x98,0xfb,0x1,0x60,0x5d,0x2,0x3,0xf0,0x77,0xfb,0xf,0xfe,0xcd,0x1,
+    0x40,0x1c,0x7,0x90,0x2,0x28,0x44,0xff,0xda,0x10,0xa9,0x82,0x0,0x89,0x18,0x6,
+    0xff,0x91,0x40,0x19,0x80,0x0,0x10,0xa9,0x9,0xff,0x18,0x5,0x91,0x15,0x99,0x8,
+    0x18,0x4,0xff,0x90,0x2,0x20,0x0,0x99,0x40,0x1a,0x40,0xfb,0x1e,0x3,0x7f,0x0,
+    0x0,0x98,0x1,0x28,0x18,0xe6,0x7d,0x0,0x6,0x98,0xff,0x0,0xdb,0x1,0x2,0x98,
+    0x1,0xab,0x68,0x30,0x7b,0x0,0x53,0x83,0x8,0x4f,0x83,0x4,0xad,0xce,0x83,0x4,
+    0x2,0x98,0x8,0x77,0x1,0x89,0x2,0xeb,0xd1,0xfc,0xd1,0x1,0x41,0x5,0xd8,0xfd,
+    0xf,0x99,0x3,0xf0,0xa7,0x3c,0xf8,0x5,0x7,0x1,0xe5,0x7,0x5,0x5,0x0,0x5,
+    0xcb,0x90,0x6,0x5,0x0,0x6,0xfd,0x1,0x65,0x2,0xcb,0xd1,0x5f,0x7,0x98,0x0,
+    0x90,0x8,0x11,0x0,0x8,0x63,0x3,0xfd,0x1d,0x63,0x1,0x98,0x2,0x28,0x82,0xdb,
+    0x16,0xae,0x43,0x0,0xb,0x90,0x11,0x3f,0x0,0x1c,0x6d,0x0,0x16,0xff,0x98,0x40,
+    0x68,0x2,0xf0,0xb0,0xfd,0xc,0xff,0x90,0xd,0xac,0xb,0xad,0x9,0xae,0x2,0xef,
+    0x27,0x28,0x68,0x31,0x81,0x0,0xd,0xfb,0x20,0xbf,0x60,0x36,0x1d,0x2d,0x1d,0x24,
+    0x77,0x0,0xf5,0xff,0xd1,0xe,0x99,0x17,0x98,0x41,0x60,0x11,0xef,0x98,0x3,0xf0,
+    0x2,0x33,0x0,0xd,0x98,0x2,0xaf,0xf0,0x97,0xfd,0x17,0x7b,0x0,0x18,0xb1,0x5,
+    0x9,0x6b,0x98,0x18,0xb,0x0,0x9,0xb1,0x1,0x2,0x25,0x11,0x0,0x1e,0xb1,0x1,
+    0x2,0xf0,0xee,0xff,0x13,0x2,0xb1,0xf,0xd,0x2,0xfd,0x19,0xb1,0x1,0xfc,0xb5,
+    0xa7,0xb0,0x23,0xaa,0xff,0x4,0x23,0xc,0x68,0x14,0x60,0x9,0x1d,0xff,0x12,0x1d,
+    0x5b,0x1e,0xf9,0xd1,0x13,0xa9,0xff,0x10,0x22,0x3,0x68,0xb,0x60,0x0,0x1d,0xf7,
+    0x9,0x1d,0x52,0xf,0x0,0x0,0x20,0x2,0xa9,0xff,0x42,0x1c,0xa,0x70,0x40,0x1c,
+    0x49,0x1c,0xff,0x4,0x28,0xf9,0xdb,0x0,0x24,0x2,0xa8,0xff,0x3,0x90,0x13,0xa8,
+    0x5,0x90,0x60,0x1c,0xff,0x1,0x90,0xa1,0x0,0x13,0xa8,0x62,0x18,0xbf,0x92,0x0,
+    0x85,0x18,0x28,0x68,0x59,0x2,0xa2,0xff,0x1c,0x13,0xab,0x51,0x18,0x89,0x0,0x59,
+    0xff,0x18,0x9,0x1f,0x6,0x91,0xb,0x46,0x19,0xff,0x68,0x49,0x0,0x49,0x8,0x2,
+    0xf0,0x9e,0xff,0xfd,0x1,0xd2,0x8,0x0,0x1,0x92,0x52,0xff,0x1c,0x1b,0x1d,0x5,
+    0x2a,0xf3,0xdb,0x1,0xff,0x99,0x60,0x1c,0x81,0x42,0x18,0xd0,0x13,0xef,0xa8,0x89,
+    0x0,0x41,0x2b,0x0,0x5,0x9a,0x4,0xff,0x23,0x8,0x68,0x16,0x68,0xe,0x60,0x10,
+    0xff,0x60,0x10,0x32,0x10,0x31,0x5b,0x1e,0xf7,0xff,0xd1,0x3,0x98,0x0,0x21,0x42,
+    0x56,0x2,0xff,0xa8,0x1,0x99,0x40,0x18,0x40,0x1e,0x1,0xff,0x78,0x3,0x9b,0x19,
+    0x70,0x2,0x70,0x28,0xff,0x68,0x0,0x21,0x2,0xf0,0x8a,0xfd,0xb,0xff,0xd0,0x2e,
+    0x1d,0x5,0x20,0x7,0x1b,0xbf,0xef,0x1e,0x30,0x68,0x29,0x23,0x1,0x7b,0xfa,0x30,
+    0xba,0x23,0x1,0x7f,0x37,0x0,0xa0,0x1c,0x0,0x9f,0x0,0x0,0xef,0x99,0x89,0x0,
+    0x61,0x89,0x0,0x40,0x18,0x10,0xaf,0x38,0x4,0x90,0xa0,0xab,0x0,0x13,0x49,0x0,
+    0x0,0xef,0x9a,0x92,0x0,0x89,0x15,0x0,0x45,0x18,0x14,0xff,0x3d,0x6,0x9e,0x5,
+    0x21,0xa0,0x1c,0xf,0xf7,0x1a,0x31,0x68,0xc9,0x3,0x2,0xf0,0x5b,0xff,0xbe,0xef,
+    0x3,0x2,0xf0,0xf0,0xfc,0x28,0x6d,0x5,0x7f,0xbf,0x1e,0xf1,0xd1,0x0,0x98,0x40,
+    0x4d,0x0,0x4,0xef,0x98,0x10,0x30,0x4,0xb1,0x1,0x5,0x28,0xda,0xe7,0xdb,0x64,
+    0x1c,0xdd,0x7,0xd7,0x1,0x1c,0x3,0x90,0x7f,0x3,0x2c,0x0,0xda,0x7a,0xe7,0x28,
+    0x79,0x1,0xff,0xd,0xd0,0x13,0x98,0x13,0xac,0x14,0x34,0xfb,0x3,0x25,0x71,0x3,
+    0x35,0xff,0x14,0x34,0x6d,0xe4,0x3d,0x1,0x13,0x3,0x28,0x6d,0x1,0x35,0x3,0x7,
+    0xa9,0xf,0xff,0xaa,0xb,0xab,0x0,0x25,0xd,0x60,0x14,0xff,0x60,0x0,0x26,0x86,
+    0x57,0x76,0x1e,0x1e,0xeb,0x60,0x64,0xf,0x1,0x12,0x69,0x1,0x40,0x1c,0x4,0xff,
+    0x2c,0xf2,0xdb,0xf,0xa8,0xb,0xa9,0x4,0xff,0x22,0x23,0xab,0xc,0x68,0xa4,0x0,
+    0x1b,0xff,0x59,0x7,0xac,0x5,0x68,0xad,0x0,0x63,0xef,0x51,0x9,0x1d,0x0,0x89,
+    0x1,0xf3,0xd1,0x0,0xef,0x24,0x7,0xa8,0x0,0xc9,0x4,0x5,0x28,0x1c,0xb3,0xda,
+    0x7,0xcd,0x0,0xc7,0x2,0x2d,0x1f,0xd7,0x2,0xa2,0xde,0xd5,0x4,0x46,0x18,0x36,
+    0x1f,0x13,0x7,0x0,0x98,0xb7,0x1,0x68,0x30,0x87,0x0,0xf1,0xfe,0xd3,0x6,0x86,
+    0xce,0xd3,0x10,0x64,0x1c,0x0,0xc1,0x0,0xd5,0x0,0x2c,0xd8,0xff,0xdb,0x4,0x20,
+    0x0,0x90,0x7,0xad,0xc,0xdf,0x35,0x13,0xa8,0x30,0x30,0xd5,0x3,0x3c,0x30,0xdb,
+    0x2,0x90,0x2f,0x0,0x99,0x9,0x51,0x1,0xd2,0xf9,0xfb,0x28,0x60,0xff,0x0,0x1e,
+    0x1,0x90,0x1,0x24,0xff,0x1,0x28,0x10,0xdb,0x7,0xaf,0x3,0x9e,0xd5,0x29,0x55,
+    0x4,0xc6,0x55,0x0,0x38,0x31,0x3,0xfc,0x38,0xfe,0xc1,0x0,0x36,0x1d,0x3f,0x1d,
+    0x1,0x98,0xa0,0xf7,0x42,0xf0,0xda,0x2d,0x2,0x0,0x90,0x2,0x98,0xf7,0x14,0x38,
+    0x2,0x1f,0x1,0x10,0x38,0x3,0x90,0xfb,0x2d,0x1f,0x89,0x0,0x28,0xd5,0xda,0x27,
+    0x98,0xbd,0x7,0xd9,0x0,0xb,0x68,0x3,0x60,0xcd,0x6,0xf9,0xff,0xd1,0x29,0xb0,
+    0xf0,0xbd,0x30,0xb5,0x85,0xff,0xb0,0xd,0x0,0x14,0x0,0x21,0x0,0x9,0x3f,0x22,
+    0x3,0x68,0xb,0x60,0x0,0x9,0x1,0x1b,0x2,0xbf,0x1,0x20,0x4,0x90,0x28,0x0,
+    0x91,0x2,0x2,0xfb,0x95,0x20,0x7,0x0,0x1,0x90,0x20,0x0,0x24,0xff,0x30,0x0,
+    0x90,0x23,0x0,0x3c,0x33,0x3,0xff,0x22,0x3,0x21,0x20,0x0,0x0,0xf0,0xd,0xff,
+    0xf8,0x24,0x35,0x3c,0x34,0x3,0x20,0x21,0xaf,0x68,0x29,0x60,0x24,0xd9,0x0,0x40,
+    0x37,0x0,0x5,0xef,0xb0,0x30,0xbd,0x0,0x0,0x0,0xff,0xb5,0x9b,0xff,0xb0,0x0,
+    0x20,0xe,0x90,0x1c,0x98,0x1d,0xff,0x99,0x88,0x42,0x0,0xdd,0x8,0x0,0xd,0xee,
+    0xb,0x0,0x40,0x1c,0x7,0x5,0x2,0x1e,0x13,0x90,0xfe,0x15,0xa,0x3,0x90,0x1d,
+    0x98,0x80,0x1e,0x1c,0xfe,0xd,0x8,0x0,0x28,0x0,0xda,0x0,0x20,0x8,0xfb,0x90,
+    0x3,0xf,0x2,0xda,0x8,0x0,0x19,0x90,0xdf,0x0,0x20,0x1,0x90,0x19,0xbf,0x0,
+    0x0,0xda,0xdf,0x3f,0xe2,0x1c,0x98,0x2,0x2d,0x0,0x40,0x1e,0xfd,0xc,0x15,0x0,
+    0x12,0x90,0x11,0x90,0x1e,0x98,0x7f,0x6,0x90,0x24,0x98,0x4,0x90,0x25,0x4b,0x1,
+    0xf7,0xb,0x90,0x1,0x5d,0x0,0x18,0x90,0x0,0x90,0xff,0x11,0x98,0x80,0x0,0x14,
+    0x90,0x1b,0x98,0x7f,0x14,0x99,0x40,0x18,0x5,0x90,0x4,0x1b,0x0,0xf9,0xa,0x1b,
+    0x0,0x51,0x2,0x74,0xda,0x0,0x26,0x5,0xff,0x9c,0x0,0x25,0x14,0xe0,0x30,0x0,
+    0x39,0xff,0x0,0x3,0xf0,0x23,0xf9,0x1,0x0,0x7e,0xff,0x0,0x76,0x8,0x2,0xf0,
+    0x1f,0xfe,0xfe,0xff,0x21,0x89,0x5,0x2,0xf0,0x7c,0xfb,0x2,0xff,0xf0,0xe6,0xfd,
+    0x31,0x0,0x2,0xf0,0x16,0xff,0xfe,0x6,0x0,0x24,0x1d,0x6d,0x1c,0x6,0xff,0x98,
+    0x6,0x60,0x2,0x98,0x85,0x42,0x16,0xff,0xda,0x27,0x68,0x78,0x0,0x40,0x8,0x71,
+    0xfb,0x0,0x49,0x2f,0x0,0xf8,0xfb,0x7,0xd2,0x38,0xab,0x0,0x31,0x43,0x0,0x1,
+    0x43,0x0,0x76,0x43,0x0,0xdc,0xff,0xe7,0x38,0x0,0x0,0x21,0x2,0xf0,0xff,0xff,
+    0xfb,0xd0,0xd1,0x0,0x26,0xe1,0xe7,0x6,0xcf,0x98,0x2,0x68,0x50,0x2f,0x0,0x13,
+    0x2,0xf5,0xfb,0x7f,0x30,0xd0,0x5,0x98,0x3,0x68,0x58,0xf,0x0,0x7f,0x2,0xf0,
+    0xee,0xfb,0xd,0xd0,0x18,0x61,0x0,0x6f,0xa8,0xff,0x2,0xd8,0x21,0x2,0x4,0xe0,
+    0x5,0x2,0xff,0x80,0x21,0x9,0x6,0x48,0x40,0x6,0x99,0x7f,0x8,0x60,0xfe,0x20,
+    0x80,0x5,0x6,0xfd,0x5,0x7f,0xd3,0xf8,0x5,0x0,0x5,0x9c,0x2,0xfd,0x0,0x7f,
+    0x8,0xdb,0x6,0x46,0x20,0x68,0x29,0x35,0x0,0xf7,0xca,0xfd,0x20,0x6b,0x1,0x76,
+    0x1e,0xf7,0xd1,0xef,0x5,0x98,0x1,0x68,0x2b,0x2,0x2,0xf0,0x21,0x7b,0xfb,0x5,
+    0x37,0x0,0x6,0x98,0x0,0x68,0x45,0xe,0xfd,0x0,0x77,0x5,0x5c,0xda,0x1b,0x98,
+    0x0,0x99,0xff,0x1c,0x9a,0x51,0x43,0x1,0x9a,0x89,0x18,0xdf,0x89,0x0,0x40,0x18,
+    0x9,0x31,0x1,0x0,0x99,0xfa,0x9,0x2,0x10,0x4b,0x1,0x0,0x99,0x40,0x1a,0xf,
+    0xd6,0x1d,0x9,0x36,0xda,0x41,0x2,0x40,0xb3,0x8,0x9b,0xfb,0xff,0x2e,0xd0,0x5,
+    0x9c,0x9,0x9d,0x0,0x26,0xfe,0x7f,0x2,0xc,0xdb,0x7,0x46,0x21,0x68,0x28,0xef,
+    0x68,0x2,0xf0,0x8a,0x1d,0x5,0xe8,0xfa,0x6,0xff,0x0,0x2d,0x1d,0x24,0x1d,0x7f,
+    0x1e,0xf3,0xef,0xd1,0x30,0x0,0x5,0xad,0x4,0x7c,0xf8,0x6,0xff,0x0,0x80,0x20,
+    0x0,0x6,0x46,0x40,0x9,0xf7,0x9c,0x5,0x9f,0x35,0x2,0xd,0xdb,0x5,0x46,0xfb,
+    0x38,0x68,0x2f,0x2,0x6f,0xfd,0x1,0x0,0x20,0xf6,0x3d,0x0,0xcc,0xfa,0xbd,0x2,
+    0x3f,0x1d,0x6d,0x1e,0x57,0xf2,0xd1,0x9,0x6d,0x0,0x10,0xa9,0x0,0x10,0xa1,0x1,
+    0xdf,0x10,0x90,0x9,0x98,0x1c,0x95,0x4,0x9,0x90,0xfd,0xf,0xe1,0x1,0xf,0x90,
+    0xb4,0xd1,0x28,0x98,0xef,0x0,0x28,0x10,0xd0,0x9b,0x6,0xc,0xda,0x26,0xf6,0xcf,
+    0x1,0x44,0x18,0x57,0x6,0x5,0xdb,0x39,0x68,0xf7,0x21,0x60,0x3f,0x7f,0x0,0x40,
+    0x1e,0xf9,0xd1,0xf7,0x1,0x98,0x8,0x21,0x0,0x0,0xdb,0x11,0xe1,0xb7,0x0,0x26,
+    0xa,0xdd,0x11,0x34,0xf8,0xdd,0xb,0x30,0xfd,0xfd,0xdd,0x7,0x8d,0xfa,0x2,0xf0,
+    0xf7,0xfc,0x56,0x8f,0x2,0x27,0xfd,0xdd,0x7,0x4,0xdd,0x1,0xc,0xdd,0x1d,0xa5,
+    0x9,0xdd,0xd,0x12,0x43,0x0,0xdd,0x13,0x10,0xdd,0x9,0x4,0xbe,0xdd,0x11,0x6,
+    0xfb,0x32,0xd0,0xa,0xdd,0xd,0xff,0xad,0xfa,0xdd,0x7,0xb9,0xfe,0xdd,0x1f,0x4,
+    0xdd,0x9,0x4,0xfe,0x2f,0x1,0x2,0xf0,0xe4,0xff,0x5,0x0,0xa,0xdb,0x9c,0xc,
+    0xcf,0x0,0xa,0xdb,0x89,0x3,0x46,0x1a,0x76,0xe1,0x7,0xd9,0xfc,0xe1,0xb,0x4,
+    0x98,0x41,0xe1,0x9,0x7f,0x30,0xfa,0x4,0x99,0x48,0x60,0x4,0xe1,0xd,0xb4,0x49,
+    0x2,0xd7,0x3,0x91,0xf7,0x0,0x7f,0xe0,0xb3,0xb,0xc1,0xbf,0xfa,0x79,0xd0,0xb,
+    0x9c,0x2,0x3f,0x1,0x10,0xff,0x90,0x1,0x28,0x6,0xdb,0x0,0x99,0x50,0xef,0x1a,
+    0x0,0x21,0x21,0x4d,0x0,0x40,0x1e,0xfb,0xef,0xd1,0x0,0x98,0x1d,0x27,0x1,0x68,
+    0xda,0x1b,0xfe,0x6b,0x0,0x1c,0x9a,0x51,0x43,0x0,0x9a,0x89,0x7d,0x18,0x71,0x3,
+    0x17,0x90,0x5,0x90,0x24,0x13,0x0,0xde,0xb,0x2,0x16,0x90,0x5,0x46,0x8b,0x2,
+    0x40,0x1a,0xdf,0x15,0x90,0x1,0x90,0x1c,0x9,0x4,0xf,0x90,0xf5,0xb,0xcf,0x1,
+    0x10,0xcf,0x5,0xf,0x9e,0x29,0x68,0xed,0x38,0xbb,0x0,0x87,0xfc,0xcf,0x7,0xe4,
+    0xf9,0x20,0xfa,0x87,0x5,0x76,0xcf,0x1,0x2d,0x1d,0x1c,0x98,0x80,0xef,0x0,0x14,
+    0x90,0x5,0xa9,0x1,0x40,0x18,0x5,0xfb,0x90,0x1,0x87,0x0,0x1,0x90,0xe0,0xd1,
+    0x17,0xff,0x98,0x9,0x90,0x16,0x98,0x5,0x90,0x15,0xd5,0x98,0x51,0xe,0x5,0xc9,
+    0x0,0xa,0x5,0x5,0x61,0xff,0xff,0x6,0x0,0x80,0x20,0x0,0x6,0x46,0x40,0xf7,
+    0x9,0x9c,0xb,0x65,0x4,0xc,0xdb,0xf,0x9d,0xfb,0x38,0x68,0xa5,0x3,0x54,0xfc,
+    0x3f,0x1d,0x21,0x72,0x23,0x0,0xb1,0x65,0x0,0xad,0x1,0x1e,0xf3,0xd1,0x37,0x0,
+    0xaf,0x1d,0x5,0x90,0x9,0x61,0x4,0x9,0x61,0x8,0xd8,0xff,0xd1,0x28,0x98,0x0,
+    0x28,0x12,0xd0,0xa,0x6b,0x9c,0x27,0x5d,0x0,0x12,0xd5,0x4,0x47,0x18,0x57,0x3,
+    0x7d,0x8,0x57,0x5,0x40,0x1a,0x21,0x68,0x39,0x3f,0x0,0x5d,0x3f,0x5,0x1,0xf9,
+    0xd1,0x18,0x85,0x0,0xb,0x45,0x0,0x7b,0xb,0x90,0x4d,0x1,0x1d,0x4,0x90,0x6,
+    0x5,0x0,0xdf,0x6,0x90,0x11,0x98,0x7,0x51,0x0,0x11,0x90,0x7d,0x12,0x23,0x1,
+    0x40,0x18,0x12,0x90,0xc,0x59,0x0,0xab,0xc,0x90,0x49,0x3,0x2,0x65,0x0,0x19,
+    0x37,0x1,0x0,0xcf,0xda,0xce,0xe5,0x1d,0x25,0x0,0x9,0x0,0xdd,0x8,0xff,0x0,
+    0x2,0x90,0x40,0x1e,0x5,0x90,0x3,0x3a,0x51,0x5,0x9,0x51,0x1,0x3,0x99,0x7,
+    0x51,0x1,0x41,0x1,0xff,0x58,0x1e,0x99,0x3,0x9a,0x92,0x0,0x88,0xef,0x50,0x1c,
+    0x98,0x2,0x1b,0x0,0x4,0xda,0x0,0xef,0x20,0x1e,0x99,0x5,0x11,0x4,0x8,0x98,
+    0x5,0xea,0x11,0x0,0xb,0x2d,0x0,0x8,0x7f,0x1,0x5,0x9b,0x5a,0xbd,0x43,0x7f,
+    0x5,0x58,0x24,0x99,0x8,0x1f,0x4,0x0,0xf3,0x20,0x24,0x29,0x8,0xcf,0x2,0x0,
+    0xd1,0x6b,0xe1,0x77,0x3,0x98,0xd,0x31,0x0,0x22,0xda,0x26,0x5f,0x0,0xd4,0xb1,
+    0x3,0xa1,0x3,0x26,0x5f,0x0,0x7,0x3b,0x0,0x92,0x0,0xff,0x89,0x18,0xd,0x9a,
+    0x3,0x9b,0xd2,0x1a,0xff,0x0,0x25,0x4,0x0,0x1c,0x9b,0x1,0x2b,0xd7,0x3,0xdb,
+    0x25,0xe5,0x0,0x5b,0xe9,0x1,0xfe,0x23,0xff,0x9b,0x5,0xb,0x60,0x7,0x9b,0x9b,
+    0x0,0xf7,0xc9,0x18,0x1c,0x5,0x0,0xc0,0x18,0x52,0x1e,0xf7,0xec,0xd1,0x3,0xcd,
+    0x0,0x0,0x90,0x0,0xd5,0xff,0xa7,0xe0,0x80,0x0,0x41,0x42,0x4,0x91,0xff,0x1c,
+    0x99,0x0,0x9a,0x89,0x1a,0x3,0x91,0xf9,0x26,0x7,0x0,0x51,0xa,0x1,0x91,0x1e,
+    0x99,0x8,0xfa,0x59,0x1,0x9,0x9f,0x1,0x40,0x0,0x40,0x8,0x0,0xff,0x21,0x2,
+    0xf0,0x96,0xf9,0x6a,0xd0,0x0,0xf7,0x98,0x40,0x1c,0x8b,0x2,0x44,0xda,0x1c,0x99,
+    0x7b,0x48,0x43,0x53,0x1,0x18,0x6,0x90,0xd,0x5b,0x5,0xfe,0x7,0x3,0x6,0x98,
+    0x1,0x9c,0x26,0x99,0x80,0xff,0x0,0x8,0x18,0xa,0x90,0x5,0x46,0x0,0xfb,0x26,
+    0x3,0xc5,0x5,0x3,0x9f,0x21,0x68,0x28,0xf6,0xbd,0x1,0x71,0xfb,0xcb,0x3,0xcf,
+    0xf8,0x6,0x0,0xdf,0x2d,0x1d,0x24,0x1d,0x7f,0xc5,0x1,0x30,0x0,0xed,0x1,0xfb,
+    0x5,0x63,0xfe,0xfb,0xb,0xa,0x9c,0x1,0x6d,0x9f,0x35,0x6,0x5,0x46,0xfb,0x7,
+    0x56,0xfb,0xfb,0x7,0xbb,0xb3,0xf8,0xfb,0xb,0x6,0x98,0x1c,0x77,0x4,0x5,0x7e,
+    0xc7,0x0,0x5,0x90,0xc4,0xd1,0x1,0x9c,0x31,0x2,0xff,0x7,0xdb,0x80,0x22,0x12,
+    0x6,0x21,0x68,0xe7,0x51,0x40,0x21,0x27,0x0,0xe1,0x3,0x1,0x98,0x1,0xff,0x68,
+    0xfe,0x20,0x80,0x5,0x2,0xf0,0x95,0xbf,0xf8,0x1,0x99,0x8,0x60,0x0,0x25,0x0,
+    0x18,0xff,0xdb,0x1,0x98,0x4,0x99,0x44,0x18,0x0,0xf7,0x98,0x0,0x21,0x27,0x6,
+    0xf,0xd0,0xfa,0xe7,0x1a,0x13,0x6,0x1c,0x1f,0x0,0x4,0xdb,0x17,0xa,0x3d,0x1,
+    0x3b,0x0,0x78,0x37,0x6,0x2f,0x3,0x9,0x1,0x1f,0x9,0x90,0x1,0xf9,0x1,0xf6,
+    0x7d,0x1,0x1a,0x1,0xf3,0x1,0x40,0x1c,0x3,0x90,0xbf,0x4,0x98,0x0,0x1d,0x4,
+    0x90,0x4d,0x0,0x28,0x5f,0x0,0xd4,0x68,0xe7,0x1d,0x29,0x0,0x1,0x59,0x1,0xfd,
+    0x92,0x59,0x5,0x9,0x1f,0xa,0x91,0x1d,0x99,0xfd,0x1,0x5b,0x1,0x49,0x1e,0x4,
+    0x91,0x1,0x99,0x6d,0x1d,0xb9,0x1,0x9,0x91,0xe5,0x1,0x18,0x7,0x47,0x0,0x7f,
+    0x40,0x1c,0x0,0x90,0x27,0x98,0x9,0x7b,0x3,0xd6,0xfd,0x3,0x18,0x3,0x13,0x0,
+    0x8,0x59,0x1,0x50,0xda,0x5d,0x7,0x73,0x11,0xdc,0xf8,0x48,0x73,0x1,0x1d,0x71,
+    0x5,0xba,0x6f,0xb,0x1d,0x6f,0x5,0x5,0x90,0x0,0x6f,0x1,0x3,0x2b,0x9c,0x27,
+    0x6f,0x5,0xb,0x6f,0x5,0x4,0x39,0x7,0x6f,0x9,0xab,0xb9,0xfa,0x3f,0x3,0x17,
+    0x6f,0x15,0x3,0x6f,0x5,0xab,0xbd,0xfd,0x6f,0xb,0xb,0x9c,0x3,0x9f,0x35,0x2,
+    0xd,0xf7,0xdb,0x5,0x9d,0x6f,0x7,0x9e,0xfa,0x1,0x0,0xff,0x20,0x68,0x1,0xf0,
+    0xfb,0xff,0x20,0x60,0x5d,0x3f,0x37,0x0,0x6d,0x1e,0xf2,0x71,0x1,0x1d,0x79,0x4,
+    0xbe,0x9,0x7,0xc3,0xd1,0x3,0x98,0xa,0x2f,0x1,0x1d,0x1c,0x2f,0x21,0x5f,0x0,
+    0x1f,0x8,0x60,0xdd,0x0,0x7,0x1,0xc7,0x0,0xb3,0x1f,0x7,0x37,0x1,0x3b,0x0,
+    0x1a,0x9,0x29,0x1,0x40,0x2f,0x1c,0x4,0x90,0xa,0x2f,0x1,0xa,0xe9,0x0,0x2f,
+    0x3,0xff,0x7c,0xe7,0x0,0x25,0x26,0x98,0x4,0x90,0xff,0x1e,0x98,0x3,0x90,0x24,
+    0x98,0x1,0x90,0xff,0x36,0xe0,0x1,0x98,0x2,0x68,0x56,0x0,0xef,0x76,0x8,0x30,
+    0x0,0xfb,0x2,0x5e,0xf8,0x21,0xfb,0xd0,0x11,0x91,0x0,0x54,0xfd,0x7,0x0,0x1,
+    0xb7,0x98,0x6,0x60,0x71,0x1,0x68,0x39,0xf,0x0,0x4d,0xbf,0xfa,0x3,0x99,0x48,
+    0x60,0x28,0x43,0x0,0x11,0x6b,0xd0,0x27,0x5d,0x0,0x0,0x57,0x1,0x89,0x0,0x8f,
+    0x6,0xdf,0x8,0xdb,0x6,0x46,0x20,0x25,0x4,0x3a,0xfa,0xfd,0x20,0x97,0x0,0x76,
+    0x1e,0xf7,0xd1,0x6d,0x1c,0x5a,0x6f,0x0,0x1d,0xb1,0x3,0x0,0x1d,0xb1,0x3,0x1c,
+    0xc1,0x3,0xff,0x18,0x4,0x90,0x2,0x98,0x85,0x42,0x32,0xeb,0xda,0x68,0x87,0x1,
+    0x3,0x77,0x14,0x22,0xf8,0x23,0xa7,0xd0,0x10,0x0,0x3b,0x5,0x79,0x0,0x3,0x79,
+    0x0,0x0,0x9b,0x98,0x2,0x81,0x1,0x6,0xda,0x47,0x0,0x5b,0x4,0xb,0xef,0xfd,
+    0x1,0x99,0x8,0x81,0x4,0xe,0xd0,0x1c,0xde,0x45,0x0,0xb,0xda,0x4,0x9c,0x7b,
+    0x12,0xfc,0xf9,0xfc,0x7b,0xa,0x39,0x6,0x92,0xd1,0x2,0x98,0x14,0x90,0xdf,0x0,
+    0x20,0xb,0x90,0xf,0x75,0x0,0x1,0x28,0xff,0x1,0xda,0x0,0xf0,0x4a,0xfd,0x24,
+    0x9a,0xdf,0x1e,0x9b,0x2,0x9c,0x10,0xeb,0x5,0x19,0x68,0xff,0x49,0x0,0x49,0x8,
+    0x0,0x91,0x1,0xf0,0xff,0xcf,0xff,0x0,0xd2,0x8,0x46,0xf,0x99,0xff,0x1,0xf0,
+    0xca,0xff,0x0,0xd3,0xf,0x90,0xff,0x1b,0x1d,0x12,0x1d,0x64,0x1e,0x0,0xd1,0xff,
+    0x92,0xe1,0xe9,0xe7,0x6d,0x1e,0x3f,0x1f,0xff,0x24,0x1f,0x0,0x2d,0x34,0xd4,0x20,
+    0x68,0xf5,0x41,0x2f,0x0,0x60,0x3b,0x4,0x1,0xf0,0x25,0xff,0xf7,0x6,0x0,0x38,
+    0xb,0x6,0x90,0x30,0x0,0x4,0xe7,0xf0,0xb2,0xf8,0x99,0x1,0xad,0x0,0x4,0xf0,
+    0xad,0xfe,0x9,0x0,0x3,0xdb,0x0,0x20,0xc0,0x43,0x0,0xff,0xf0,0x19,0xfd,0x30,
+    0x0,0xd0,0x21,0x89,0xff,0x5,0x2,0xf0,0xac,0xf9,0x1,0x99,0x2,0xff,0xf0,0x6c,
+    0xfb,0xc,0xd9,0x8,0x46,0x34,0xff,0x49,0x1,0xf0,0x95,0xff,0x7,0xd3,0xb,0x7f,
+    0x98,0x15,0x28,0xce,0xdb,0x0,0x98,0x19,0x2,0xff,0x5f,0xfb,0xc9,0xd8,0x0,0x20,
+    0x24,0x99,0xdf,0xaa,0x0,0x88,0x50,0x6,0xdf,0x0,0x1,0xd1,0xef,0x4,0x21,0x5c,
+    0xe0,0x29,0x3,0x2,0x9c,0xa0,0xff,0x0,0x24,0x99,0xf,0x18,0x8,0x3f,0x1e,0xdf,
+    0x99,0x8,0x18,0x0,0x1f,0x4f,0x1,0xe0,0x64,0xf9,0x1e,0x59,0x1,0x9,0x0,0x3f,
+    0x1f,0x0,0x98,0xa0,0xff,0x42,0x42,0xda,0x0,0x26,0x2,0x98,0x84,0xef,0x42,0x6,
+    0xd0,0x78,0x91,0x4,0x0,0x21,0x1,0x7f,0xf0,0xd5,0xfe,0x6,0x0,0xa8,0x1c,0x13,
+    0x2,0x77,0x30,0x0,0x39,0xe9,0x4,0x1,0xf0,0xcb,0x13,0x0,0xf4,0x37,0x0,0xb5,
+    0x10,0x57,0xab,0x0,0x1,0xdb,0x0,0xf0,0x6b,0xc4,0xfc,0xb9,0x2,0x50,0xd,0x8,
+    0xbd,0xfc,0xb5,0xa,0x5d,0x51,0xb5,0x4,0x11,0xfb,0x4,0xb5,0x0,0x7,0xb5,0x0,
+    0xff,0x3a,0xff,0xc1,0xd2,0x0,0x20,0x1e,0x99,0xff,0xa2,0x0,0x89,0x18,0x9,0x1f,
+    0x8,0x60,0xfe,0x75,0x2,0x7,0xd1,0x1,0x21,0x7,0xe0,0x1,0xff,0x0,0x0,0xc,
+    0x84,0x42,0xf6,0xd1,0x3,0xff,0x21,0x1,0xe0,0x2,0x21,0x65,0x1e,0x6d,0xff,0x1c,
+    0x68,0x1e,0x1,0x29,0xd,0xd0,0x1,0xff,0xd2,0x0,0xf0,0x8c,0xfc,0x3,0x29,0x0,
+    0xff,0xd1,0xc4,0xe1,0x0,0xd2,0x1,0xe1,0x4,0xff,0x29,0x1,0xd1,0x0,0xf0,0x14,
+    0xfc,0x0,0xff,0xf0,0x81,0xfc,0x8,0x98,0x4,0x68,0x0,0xfb,0x20,0x8,0xd7,0x1,
+    0x6,0x98,0x1,0x90,0xa8,0xbf,0x42,0x0,0xda,0xd7,0xe0,0x27,0xd,0x1,0x1d,0xff,
+    0x9a,0x51,0x43,0x89,0x0,0x40,0x18,0x9,0xbf,0x90,0x4,0x98,0x7,0x90,0x8,0xe9,
+    0x0,0x6,0xef,0x90,0x27,0x98,0x5,0x17,0xc,0xc,0x90,0x7,0xef,0x98,0x6,0x68,
+    0x60,0xc5,0x0,0x5,0x90,0x70,0xbe,0x5,0x0,0x4,0x90,0x5,0x98,0x4,0xbd,0x1,
+    0xeb,0x7d,0xfe,0x6d,0x0,0x96,0x0,0xe0,0x0,0x94,0x1b,0x2,0xff,0x1,0xf0,0xe3,
+    0xfe,0x7,0xd2,0x20,0x0,0xff,0x31,0x0,0x2,0xf0,0xec,0xfb,0x1,0x0,0xff,0x77,
+    0x0,0x7f,0x8,0xd,0xe0,0x20,0x0,0xf6,0x1d,0x3,0xea,0xfe,0x85,0x0,0x27,0x13,
+    0xe0,0x30,0xab,0x0,0x21,0x1d,0x0,0xdd,0x1d,0x0,0x67,0x1d,0x0,0x2,0xff,0xf0,
+    0xd9,0xf8,0x1,0x0,0xfe,0x20,0x80,0xff,0x5,0x1,0xf0,0x35,0xfe,0x2,0xf0,0x9f,
+    0xfb,0xf8,0x39,0x1d,0x0,0xcf,0xf8,0x7,0x0,0x0,0xff,0x98,0x0,0x21,0x2,0xf0,
+    0x8d,0xfa,0x2,0xff,0xd3,0x80,0x20,0x0,0x6,0x47,0x40,0x38,0xff,0x0,0x1,0xf0,
+    0xc8,0xfe,0x3,0xd1,0xfe,0x3f,0x26,0xb6,0x5,0x3,0x91,0x9,0x47,0x0,0x29,0x2,
+    0xdf,0xb9,0xfb,0x6,0x0,0x20,0x9,0x4,0xb4,0xfb,0xf5,0x3,0x93,0x8,0xa1,0x93,
+    0x0,0x3,0x9c,0xb,0xe0,0xdf,0xfe,0x24,0xa4,0x5,0x30,0x7b,0x4,0xac,0xfe,0xef,
+    0x4,0xd0,0x20,0x46,0x95,0x2,0xa1,0xfb,0x4,0xff,0x0,0x7,0x98,0x7,0x60,0x1,
+    0x98,0xa8,0xff,0x42,0xf,0xd0,0x6,0x98,0x7,0x68,0x3,0xbd,0x98,0x3d,0x2,0x96,
+    0xf8,0x4,0x0,0x67,0x2,0x44,0xdc,0x67,0x0,0x27,0x2,0x8e,0xf8,0x6,0x23,0x1,
+    0x28,0x98,0xff,0x0,0x28,0x35,0xd0,0xc,0x98,0x5,0x90,0xff,0x9,0x98,0x4,0x90,
+    0x1d,0x98,0x1,0x28,0xdf,0x2e,0xdb,0x1d,0x98,0x8,0x67,0x0,0x7,0x68,0xed,0x4,
+    0xd5,0x1,0xa,0x90,0x2b,0x2,0x78,0xf8,0x0,0xdd,0x90,0x45,0x6,0x73,0xf8,0x0,
+    0x7f,0x0,0xd1,0xfd,0xeb,0x0,0x90,0x45,0x6,0x6b,0xc7,0x0,0x3,0x99,0xa,0xcf,
+    0x98,0x2,0xf0,0x66,0xe5,0x0,0xc1,0x2,0xfb,0xfd,0xb5,0x5,0x57,0x0,0x0,0xa7,
+    0x0,0x8,0x60,0x41,0x0,0x1d,0xee,0x47,0x3,0x0,0x1d,0x5,0x71,0x1,0x40,0x1e,
+    0x8,0xef,0x90,0xd2,0xd1,0x1,0x7,0x0,0x1,0x90,0x6,0x6a,0x7f,0x5,0x7,0x5,
+    0x0,0x7,0x79,0x0,0x1d,0x99,0x81,0x1,0xf7,0x1a,0x9,0x90,0xb3,0x2,0x0,0xdb,
+    0x3a,0xe7,0xdf,0x2,0x98,0xe,0x90,0x2,0x27,0x0,0x7,0x90,0xfd,0x5,0x7,0x0,
+    0x80,0x1e,0x6,0x90,0x5,0x46,0xff,0xa8,0x0,0x1e,0x99,0x9,0x18,0x4,0x91,0xff,
+    0xc,0x46,0x24,0x99,0x8,0x18,0x8,0x90,0xdf,0x7,0x46,0xf,0x99,0xd0,0x55,0x1,
+    0x2,0xf0,0xfd,0x29,0x9d,0x0,0x58,0xe6,0x24,0x99,0x82,0x0,0xff,0x89,0x18,0xc,
+    0x68,0x0,0x22,0xa,0x60,0xff,0x1,0x95,0x2,0x99,0x8d,0x42,0xdb,0xda,0xff,0xa9,
+    0x0,0x1e,0x9a,0x52,0x18,0x6,0x92,0xff,0x24,0x9a,0x51,0x18,0x5,0x91,0x26,0x99,
+    0xff,0x1c,0x9a,0x42,0x43,0x90,0x0,0x8,0x18,0xb9,0x9,0x7f,0x0,0xeb,0x7,0x71,
+    0x0,0x49,0xd3,0x1,0xf9,0xff,0xfd,0x1,0xd2,0x37,0x0,0x0,0xe0,0x27,0xf6,0xbf,
+    0x0,0xf3,0xfd,0xdf,0xb,0xfc,0xfa,0x1,0x0,0xb7,0x75,0x0,0x6d,0xdf,0xd,0xfa,
+    0xfd,0xdf,0x1,0x25,0xae,0xdf,0xb,0xed,0xfa,0x65,0x1b,0x0,0x1,0x31,0x0,0xe9,
+    0xfd,0xff,0xdf,0xb,0x45,0xfd,0x1,0xf0,0xaf,0xff,0x9d,0x29,0x13,0x0,0xdf,0xff,
+    0x5,0xd,0x1,0xdf,0x3,0x9d,0xdd,0xf9,0xdf,0x7,0x45,0x40,0x28,0x17,0x0,0xd8,
+    0xfd,0x9a,0xdf,0x13,0x29,0x47,0x0,0xc9,0xfa,0xdf,0x3,0x9,0x2,0xc4,0xfb,0xfa,
+    0x3,0x97,0x0,0x5,0x60,0x5,0x98,0x5,0xac,0xb3,0x1,0x45,0x2,0xbc,0xff,0xb3,
+    0xb,0x28,0x91,0x0,0x1,0x67,0xf0,0xb4,0xff,0x5b,0x3,0xb3,0x3,0x39,0xd0,0xaf,
+    0x3,0xff,0x26,0x98,0x1c,0x99,0x1,0x9a,0x51,0x43,0xde,0x3d,0x1,0x18,0x0,0x90,
+    0x1c,0xbd,0x1,0x2d,0xdb,0x5f,0x1c,0x98,0x7,0x90,0x4,0xbd,0x1,0x0,0xbd,0x1,
+    0x9d,0x8,0xbd,0x1,0x1,0xf0,0x99,0x8b,0x0,0xbd,0x3,0x1,0x9b,0xf0,0x94,0x9b,
+    0x4,0xf2,0xfc,0x9b,0x2,0x19,0x2,0x8c,0x7d,0xff,0xbd,0x3,0x8,0x98,0x1,0xf0,
+    0x87,0xc3,0x0,0x96,0xbd,0x3,0x1c,0xfd,0xb7,0x3,0x0,0x85,0x0,0x3f,0x0,0x1d,
+    0xa9,0x0,0x49,0x0,0xc1,0x3,0x7,0x8b,0x5,0xd3,0xbb,0x3,0x1c,0xd9,0x1,0xcf,
+    0x9,0xc1,0x1,0x1d,0x6,0xb1,0x1,0x2,0x99,0x7d,0x88,0xb3,0x1,0x25,0xe7,0x55,
+    0xe7,0x8,0x71,0x0,0x6f,0x43,0x0,0x5b,0x8,0x33,0x0,0x68,0x41,0x57,0x1,0xfd,
+    0x18,0x4f,0x0,0x4c,0xfd,0x0,0xd2,0xb,0x0,0x77,0x1e,0x98,0x5,0xe1,0x1,0x42,
+    0x18,0x10,0x17,0xc,0xfd,0x40,0x17,0x4,0xa9,0x0,0x24,0x98,0x40,0x18,0xdf,0x6,
+    0x90,0x0,0x68,0x40,0x8b,0x1,0x1e,0x9c,0x5b,0x61,0x18,0x17,0x1,0x68,0x49,0x93,
+    0x5,0x2f,0x21,0x0,0xd7,0x8,0x0,0x59,0xb,0x4,0x29,0x9f,0x1,0x0,0x91,0xff,
+    0x0,0xe0,0x0,0x90,0x10,0x68,0x0,0x99,0xc7,0x2,0xf0,0x2f,0x33,0x1,0x65,0x2,
+    0xb,0x2,0x29,0xfa,0x33,0x4,0x0,0x79,0x2,0xb,0x2,0x23,0xfa,0xcf,0x0,0xb,
+    0x8,0xe7,0x1d,0xfa,0x1,0xa3,0x2,0xb,0x4,0x17,0xfa,0x7,0x7d,0x90,0xd3,0x3,
+    0x1,0xf0,0x74,0xfc,0x0,0x9,0x8,0x7f,0xa7,0xfc,0x0,0x99,0x1,0xf0,0xb,0x61,
+    0x1,0xbb,0x38,0x0,0x1b,0x3,0x6,0xff,0x21,0x5,0x0,0x64,0xef,0xfc,0xfc,0x21,
+    0x89,0xc9,0x1,0xff,0xfe,0x4,0xdb,0x0,0x30,0x17,0x4,0xfa,0xfe,0xe3,0x3,0xf7,
+    0xfe,0xdf,0x0,0x90,0x0,0x27,0x20,0xd1,0x1,0x1,0xf0,0xdf,0xf6,0xfc,0x3,0xd1,
+    0x0,0x33,0x1,0xf2,0xfc,0x6f,0x1a,0xd0,0x20,0x0,0x35,0x2,0xe8,0xfe,0x4b,0x2,
+    0x7f,0x46,0xfc,0x1,0xf0,0xb0,0xfe,0x7,0xcd,0x1,0xde,0x25,0x2,0xcf,0xfc,0x2,
+    0xd2,0xbb,0x3,0x47,0x40,0xfd,0x20,0x47,0x4,0x37,0xfc,0x1,0x0,0x0,0x98,0xff,
+    0x2,0xf0,0xd1,0xf9,0x7,0x0,0x1,0x98,0x6e,0x81,0x2,0x2e,0xfc,0x4,0x9,0x8,
+    0x61,0xfc,0x45,0x2,0x6b,0xc5,0xfe,0x27,0x2,0x23,0x15,0x2,0x99,0x7,0x5f,0x0,
+    0xff,0xbd,0xfe,0x4,0x90,0x1,0x95,0x5,0x98,0xfd,0x85,0x5f,0x1,0x9d,0xe1,0x27,
+    0x98,0x29,0x46,0xf5,0x1d,0xeb,0x9,0xd,0xd9,0x0,0x7,0x90,0x3,0x98,0x3e,0x7f,
+    0x3,0x40,0x1c,0x12,0x90,0x11,0xa7,0x1,0x41,0x3,0xfd,0x61,0x2d,0x5,0x92,0xfc,
+    0x1,0xd2,0x26,0x0,0xef,0x0,0xe0,0x4,0x9e,0x15,0x6,0x1,0xf0,0x89,0xff,0xfc,
+    0x4,0x98,0x6,0xd2,0x21,0x0,0x2,0xff,0xf0,0x92,0xf9,0x1,0x0,0x67,0x0,0x7f,
+    0xf7,0x8,0xd,0xe0,0xa3,0x2,0x91,0xfc,0x1,0xd1,0x7f,0x0,0x27,0x14,0xe0,0x20,
+    0x0,0x4,0x25,0x1,0x9f,0x84,0xf9,0x4,0x99,0x4f,0x1b,0x0,0xef,0x2,0x7f,0xee,
+    0xf5,0x0,0xfe,0x20,0x80,0x9,0x1,0xdb,0xfb,0x1,0xab,0xf0,0x45,0x99,0x4,0x75,
+    0xdb,0x0,0x30,0xdb,0x0,0x2,0x5f,0xf0,0x33,0xf8,0x2,0xd3,0xdb,0x6,0x38,0x17,
+    0x0,0xef,0x6e,0xfc,0x4,0xd1,0x2b,0x2,0xa,0x90,0x9,0xeb,0x91,0x9,0x4b,0x0,
+    0x39,0x67,0x0,0x5e,0xf9,0xa,0xdc,0x93,0x0,0x9,0x2,0x59,0xf9,0x9,0xa5,0x0,
+    0xa8,0x42,0xff,0x2,0xd0,0x7,0x98,0x0,0x1f,0x7,0x60,0x6f,0x7,0x98,0x6,0x68,
+    0xbd,0x0,0x68,0xa,0x1d,0x0,0xd7,0x1,0xf0,0x4b,0x67,0x1,0x9,0x3,0x5,0x46,
+    0xfe,0xbe,0x3,0x3,0xa4,0xfb,0x3,0x90,0xa,0xf,0x4,0x3e,0xd4,0x19,0x4,0x23,
+    0x2,0x39,0x8b,0x0,0x20,0x7,0x0,0xce,0xfb,0xff,0x7,0x99,0x8,0x60,0x6,0x98,
+    0x44,0x68,0xab,0x9,0x98,0x2b,0x2,0x2d,0x1f,0x1,0xa,0x9,0x4,0x28,0xff,0xfe,
+    0x6,0x99,0x48,0x60,0x28,0x98,0x0,0x7f,0x28,0x2f,0xd0,0x27,0x98,0x11,0x99,0x27,
+    0x7,0xff,0x44,0x18,0xd,0x9e,0x1,0x2a,0x26,0xdb,0xff,0xc,0x92,0x20,0x68,0x10,
+    0x90,0x30,0x68,0xd5,0xe,0x2d,0x0,0xe,0xa7,0x1,0x11,0xc7,0x0,0x9,0x99,0xf5,
+    0x10,0x61,0x1,0xc,0xd7,0x4,0x6a,0xfb,0x7,0x0,0xd7,0x10,0x99,0xa,0xf,0x0,
+    0x4,0xe5,0x1,0x9,0x99,0xed,0xe,0x9,0x0,0xff,0xfd,0xad,0x3,0x1,0xf0,0x94,
+    0xff,0xfb,0x20,0x60,0x37,0x60,0x36,0x1d,0x24,0xff,0x1d,0xc,0x98,0x40,0x1e,0xc,
+    0x90,0xd9,0xdd,0xd1,0x53,0x7,0x3,0x99,0x49,0x6b,0x5,0xdc,0xfb,0xaf,0x1,0xd2,
+    0x3,0x9c,0x6b,0x1,0x9c,0x17,0x16,0xd0,0xbf,0xfb,0x4,0x98,0x5,0xd2,0x3,0x55,
+    0x1,0xd9,0xbf,0xf8,0x1,0x0,0x3,0x98,0xb,0x6f,0x5,0xd9,0xad,0xfb,0x6f,0x7,
+    0x3,0x98,0x6f,0x3,0xcc,0x19,0x0,0x4,0xbf,0x98,0x46,0x0,0x76,0x8,0x8,0x85,
+    0x0,0xc6,0xaf,0xfd,0xfe,0x21,0x89,0x6f,0x1,0x23,0x6f,0x1,0x8d,0x9d,0xfd,0x1,
+    0x3,0xbd,0xfd,0x7,0xf7,0x0,0x37,0x2,0x7b,0xfd,0xff,0x6f,0x13,0xb6,0xfb,0x3,
+    0xd1,0xfe,0x26,0xd7,0xb6,0x5,0x3,0x6d,0x1,0x3,0x63,0x5,0xa7,0xf8,0x79,0x6,
+    0x49,0x0,0x9,0x2,0xa2,0xf8,0x3,0x90,0x5d,0x1,0xbe,0x25,0x1,0x40,0x68,0x4,
+    0x90,0x7,0x67,0x1,0x30,0xfe,0x8f,0x1,0x1,0xf0,0x97,0xfd,0x4,0x0,0x3,0xdb,
+    0x99,0x4,0xd1,0x0,0x92,0xfd,0x31,0x3,0xf0,0xfa,0x79,0x4,0x31,0x0,0x65,0x2,
+    0x8a,0xfd,0x0,0x90,0x45,0x2,0xb7,0x1,0xf0,0x85,0xf3,0x8,0x1a,0xfb,0x4d,0x3,
+    0x7,0xf7,0x98,0x47,0x68,0x17,0x6,0x79,0xfd,0x4,0x90,0xbb,0x38,0x0,0x2b,0x2,
+    0x74,0xfd,0x7,0x67,0x9,0x43,0xff,0xd0,0x1,0x98,0x13,0x99,0x88,0x42,0x3f,0xbf,
+    0xda,0x26,0x98,0x1c,0x99,0x11,0x6f,0x5,0x40,0xd7,0x18,0xa,0x90,0xd,0x2,0x1,
+    0xd,0x8,0x9,0x90,0x3f,0x1c,0x98,0x1,0x28,0x2e,0xdb,0x5,0x0,0x79,0x1,0xbd,
+    0x7,0xb5,0x1,0x0,0x68,0xc,0x90,0x47,0x2,0x50,0xee,0x73,0xc,0x4b,0xfd,0x0,
+    0x91,0x1,0xa9,0xfa,0x0,0xba,0x61,0x8,0x43,0xf3,0x0,0x3,0x99,0xc,0x85,0x0,
+    0x3e,0xdc,0x8d,0x0,0xed,0x2,0xd3,0xfa,0xa,0xf5,0x1,0x0,0x98,0xd9,0x9,0x5,
+    0x0,0x41,0x0,0x1d,0x9,0x4b,0x0,0x0,0x1d,0xf7,0xa,0x90,0x1,0x8f,0x1,0x1,
+    0x90,0xd2,0xd1,0xd5,0x12,0x5d,0x0,0x6,0x11,0x0,0x6,0xed,0x0,0x0,0x1d,0xbf,
+    0x7,0x90,0xd,0x98,0x1d,0x99,0x7d,0x2,0xd,0xfa,0x21,0x0,0x5,0xa1,0x0,0x0,
+    0xda,0x6c,0xe6,0x8,0xff,0x98,0x4,0x60,0xb,0x98,0x40,0x1c,0xb,0xff,0x90,0x2,
+    0x98,0xe,0x90,0x73,0xe0,0xa9,0xff,0x0,0x1e,0x98,0x40,0x18,0x3,0x90,0x0,0xfd,
+    0x68,0x5d,0x3,0xfa,0xfa,0x17,0xd2,0x80,0x21,0x9f,0x9,0x6,0x48,0x40,0x3,0x63,
+    0x0,0xdd,0x2,0xf,0xeb,0xd0,0x27,0x45,0x0,0x69,0xc5,0x0,0x44,0x18,0x1d,0xfe,
+    0xc3,0x0,0x7,0xdb,0x80,0x22,0x12,0x6,0x21,0xff,0x68,0x51,0x40,0x21,0x60,0x24,
+    0x1d,0x40,0xef,0x1e,0xf9,0xd1,0x14,0x7d,0x0,0x85,0x42,0x45,0xff,0xd0,0x1e,0x98,
+    0xa9,0x0,0x42,0x18,0x10,0xff,0x68,0x51,0x68,0x1,0xf0,0xd6,0xfa,0x3d,0xbf,0xd2,
+    0x69,0x1c,0x0,0x91,0x6,0x5d,0x0,0x8b,0xff,0x0,0xc0,0x18,0x3,0x68,0x13,0x60,
+    0x6,0xfe,0x4f,0x4,0x2f,0xd0,0x0,0x98,0x1d,0x9a,0x90,0xff,0x42,0x13,0xda,0x27,
+    0x98,0x6a,0x43,0x92,0xff,0x0,0x84,0x18,0x0,0x9a,0x1d,0x9b,0x5a,0xfe,0x9,0x0,
+    0x87,0x18,0x1,0x2b,0x8,0xdb,0x1a,0xbf,0x46,0x20,0x68,0x3b,0x68,0x23,0x5b,0x0,
+    0x38,0xff,0x60,0x3f,0x1d,0x52,0x1e,0xf7,0xd1,0x0,0xfb,0x98,0x1c,0x2f,0x4,0x26,
+    0x98,0x55,0x43,0xaa,0xfa,0x2f,0x4,0x1c,0x2f,0x34,0xd,0x0,0xb5,0xe7,0x0,0xab,
+    0x20,0xb,0x3,0x1,0x2,0xe3,0x4,0x2,0x75,0x0,0x3,0xff,0xd0,0xb,0x98,0x4c,
+    0x28,0x0,0xda,0x59,0xff,0xe4,0xe,0x98,0x1f,0xb0,0xf0,0xbd,0xf4,0xff,0xb5,0x4,
+    0x0,0xe,0x0,0x1,0x2e,0x1,0xff,0xda,0x0,0x20,0x19,0xe0,0x7,0x25,0x30,0xff,
+    0x0,0xfd,0xf7,0xf2,0xfd,0x29,0x1a,0x1,0xff,0x25,0x8,0x0,0x28,0x40,0xf,0x18,
+    0x6,0xff,0x20,0xc1,0x1b,0x30,0x0,0xfb,0xf7,0x69,0xff,0xfb,0x0,0x99,0xfe,0xf7,
+    0xf,0xf8,0xa9,0xef,0x7,0x49,0x1b,0x81,0x3f,0x1,0x8,0x0,0x79,0xff,0x10,0x49,
+    0x1f,0xfb,0xf7,0x5d,0xfb,0x20,0xff,0x60,0x20,0x0,0xf2,0xbd,0x81,0xb0,0x12,0xff,
+    0x68,0x0,0x92,0x9,0x68,0x89,0x1a,0x1,0xff,0x60,0x1,0xb0,0x70,0x47,0x70,0x47,
+    0xf1,0xff,0xb5,0x8,0x68,0xc1,0x17,0x12,0x68,0xd3,0xff,0x17,0xfc,0xf7,0x6b,0xfa,
+    0x82,0xb,0x8c,0xff,0x4,0x22,0x43,0x8b,0x13,0xe,0xa4,0x30,0xff,0xcc,0xab,0x42,
+    0x4,0xdc,0x1,0xdb,0xa2,0xff,0x42,0x1,0xd2,0x22,0x46,0xf,0xe0,0x0,0xef,0x27,
+    0xbb,0x42,0xb,0xf,0x4,0x8,0xd2,0xe6,0xff,0x43,0xbb,0x42,0x6,0xdb,0x1,0xdc,
+    0xb2,0xff,0x42,0x3,0xd3,0xac,0xc,0x4,0x40,0x0,0xbf,0xd0,0x6a,0x8,0x0,0x98,
+    0x2,0xe9,0x1,0xf2,0xbf,0xbd,0x0,0x0,0x0,0x80,0xff,0x0,0x0,0xf1,0xff,0xb5,
+    0x52,0x1a,0x10,0x0,0xd1,0x17,0x49,0xff,0x7,0xc2,0x8,0x11,0x43,0x40,0x7,0xcc,
+    0xff,0x17,0xcd,0x17,0xc0,0x22,0x92,0x5,0x60,0xff,0x40,0x69,0x40,0x2f,0x0,0x0,
+    0x1b,0xb9,0xff,0x41,0xfc,0xf7,0x65,0xff,0x60,0x40,0x2,0xff,0x1b,0xd3,0x17,0x10,
+    0x0,0x19,0x0,0xfc,0xff,0xf7,0x2c,0xfa,0xc2,0xd,0x4c,0x2,0x22,0xaf,0x43,0xcb,
+    0x15,0x1c,0x7d,0x18,0x13,0x7d,0x1c,0x7,0xfe,0x7d,0x4,0x4,0xd3,0x6c,0xa,0x4,
+    0x40,0x1,0xfe,0x7d,0x0,0x2,0xe0,0x0,0x20,0x0,0x2a,0x0,0xff,0xd0,0x10,0x0,
+    0x80,0x21,0x9,0x4,0x42,0xff,0x18,0x11,0xd5,0x0,0x28,0xd,0xd5,0x0,0xff,0x98,
+    0xc0,0x68,0x80,0x11,0xc1,0x17,0xc9,0xff,0x5,0x43,0xa,0x19,0x43,0xc0,0x5,0xfc,
+    0xff,0xf7,0x22,0xff,0x80,0x1,0x0,0x99,0xc8,0x7f,0x60,0xf1,0xbd,0x6a,0x8,0xef,
+    0xe7,0x1f,0x2,0xff,0xee,0xd1,0x68,0x8,0xf4,0xe7,0x0,0xbf,0xfe,0xb7,0xa,0x0,
+    0x21,0x80,0x22,0xd2,0x5,0x2,0xff,0x60,0x41,0x60,0x81,0x60,0xc1,0x60,0x1,0xff,
+    0x61,0x70,0x47,0xf8,0xb5,0x7,0x0,0x14,0xdf,0x0,0x1d,0x0,0x0,0x2d,0x91,0x2,
+    0x1,0x2c,0xff,0x1,0xd2,0x0,0x20,0x1f,0xe0,0x1a,0x26,0xff,0x20,0x0,0x29,0x0,
+    0x3,0xf0,0x5b,0xf8,0xff,0x31,0x1a,0x1,0x26,0x8,0x0,0x30,0x40,0xff,0x8,0x18,
+    0x0,0x90,0x6,0x20,0xc0,0x43,0xef,0x0,0x99,0x42,0x1a,0x1b,0x6,0x5e,0xf8,0x6,
+    0xff,0x99,0xfd,0xf7,0x48,0xff,0xb1,0x7,0x89,0xfe,0x8d,0x9,0x0,0x99,0x49,0x10,
+    0xb,0x39,0xfb,0xbf,0xf7,0x95,0xfa,0x38,0x60,0x38,0x8f,0x1,0x0,0xbf,0x0,0xf0,
+    0xb5,0x8b,0xb0,0x5,0x5f,0x0,0x4,0xff,0xa8,0x3,0x22,0xb,0x68,0x3,0x60,0x9,
+    0xff,0x1d,0x0,0x1d,0x52,0x1e,0xf9,0xd1,0x0,0xef,0x26,0x4,0xaf,0x38,0x99,0x1,
+    0x22,0x0,0xe3,0xfe,0x99,0x1,0x9e,0xf9,0x80,0xf,0x8a,0x0,0x10,0xff,0x43,0x38,
+    0x60,0x76,0x1c,0x3f,0x1d,0x3,0xff,0x2e,0xf1,0xdb,0x0,0x20,0x1,0x90,0x4,0xff,
+    0xa9,0x2,0xa8,0x0,0xf0,0x96,0xfa,0x2,0xff,0x20,0x0,0x90,0x2,0xa8,0xc,0xc8,
+    0x1,0xff,0xa8,0xfc,0xf7,0xa4,0xff,0x1,0x9e,0x70,0xff,0x10,0x80,0x24,0xe4,0x5,
+    0x1,0x21,0x7,0xff,0x11,0xb1,0x42,0xf,0xda,0x38,0x0,0xfd,0xff,0xf7,0x7f,0xfd,
+    0x0,0x2e,0x1,0xd1,0x22,0xff,0x4c,0x8,0xe0,0x32,0x0,0xc1,0x17,0x49,0xff,0x6,
+    0xc3,0x9,0x19,0x43,0x40,0x6,0xfc,0xdf,0xf7,0x9a,0xfe,0x4,0x0,0x1f,0x2,0xa4,
+    0xfd,0xeb,0x0,0x90,0x71,0x16,0x65,0x71,0x1c,0x4,0x9a,0x5,0xff,0x99,0x6,0x98,
+    0x0,0x1,0x9,0x1,0x12,0xff,0x1,0x0,0x9b,0x7,0x93,0x8,0x92,0x9,0xff,0x91,
+    0xa,0x90,0x7,0xaa,0x29,0x0,0x28,0xff,0x0,0xf6,0xf7,0x55,0xfb,0x28,0x68,0x0,
+    0xff,0x90,0x68,0x68,0x1,0x90,0xa8,0x68,0x2,0xff,0x90,0xe8,0x68,0x3,0x90,0x4,
+    0x22,0x69,0xff,0x46,0x68,0x46,0x2,0xf0,0x8e,0xf8,0x0,0xff,0x98,0x28,0x60,0x1,
+    0x98,0x68,0x60,0x2,0xff,0x98,0xa8,0x60,0x3,0x98,0xe8,0x60,0xb,0xf7,0xb0,0xf0,
+    0xbd,0x6a,0x1,0x7f,0x30,0xb4,0x80,0xff,0x24,0x24,0x6,0x4,0x40,0x5,0x0,0x40,
+    0xff,0x2,0x40,0xa,0x80,0x23,0x1b,0x4,0x3,0xff,0x43,0x68,0x0,0x5,0xe,0x96,
+    0x39,0x6d,0xff,0x18,0x0,0x20,0x8,0x2d,0x6,0xdb,0x0,0xff,0x2c,0x2,0xd0,0x80,
+    0x20,0x0,0x6,0x1c,0xff,0xe0,0xf,0x48,0x1a,0xe0,0x0,0x2d,0x1,0xff,0xd4,0xab,
+    0x40,0x11,0xe0,0x17,0x21,0xc9,0xff,0x43,0x8d,0x42,0xe,0xdb,0x69,0x42,0x0,0xff,
+    0x2a,0x9,0xd0,0x20,0x29,0x9,0xda,0x18,0xff,0x0,0xc8,0x40,0x49,0x1e,0xcb,0x40,
+    0xd9,0xff,0x7,0x3,0xd5,0x40,0x1c,0x1,0xe0,0xcb,0xff,0x40,0x18,0x0,0x0,0x2c,
+    0x1,0xd0,0x41,0x7d,0x42,0x99,0x1,0xbc,0x70,0x47,0x0,0x0,0x6f,0x2,0xfe,0xa8,
+    0x0,0xd1,0x70,0x47,0x70,0xb4,0x1,0xd4,0xff,0x2,0x0,0x0,0xe0,0x42,0x42,0x15,
+    0x0,0xef,0x0,0x23,0x0,0x24,0xd7,0x1,0xd4,0x6d,0x0,0xff,0x64,0x1c,0x20,0x2c,
+    0xf9,0xdb,0x20,0x24,0xff,0x8,0x2c,0x12,0xda,0x1,0x25,0x7,0x26,0x7f,0x34,0x1b,
+    0xa5,0x40,0x52,0x19,0x14,0x45,0x0,0xff,0x8,0xd4,0x64,0x0,0x5b,0x1c,0x20,0x2b,
+    0xfe,0x1d,0x4,0x23,0x1b,0x1b,0xda,0x40,0x4,0xe0,0xff,0x1c,0x0,0xf9,0xe7,0x23,
+    0x0,0x8,0x3b,0xff,0x9a,0x40,0x52,0x2,0x52,0xa,0x9e,0x23,0xff,0x59,0x1a,0x9,
+    0x1b,0xc9,0x5,0x11,0x43,0xff,0x80,0x22,0x12,0x6,0x10,0x40,0x8,0x43,0xf5,0x70,
+    0x73,0x4,0x1,0xd,0x0,0x1,0x18,0xca,0x42,0x7f,0xa,0xd2,0x8a,0x42,0xd,0xd8,
+    0x38,0xd,0x0,0xff,0x9,0x9,0x89,0x18,0xc2,0xf,0xd2,0x7,0xef,0x11,0x43,0x40,
+    0x7,0x21,0x0,0xd0,0x49,0x8,0xff,0x9,0x9,0x1,0x43,0x1,0xe0,0xc1,0xf,0xff,
+    0xc9,0x7,0x0,0x20,0x70,0x47,0xf0,0xb5,0xff,0xe,0x0,0x5e,0x40,0x1,0x25,0xed,
+    0x7,0xff,0x2e,0x40,0xb4,0x46,0xae,0xa,0xdf,0x18,0xff,0x4c,0x18,0xf4,0x42,0x8,
+    0xd2,0xf7,0x42,0xff,0xe,0xd2,0x64,0xd,0x1,0xd0,0x7f,0xd,0xff,0x12,0xd1,0x0,
+    0x20,0x61,0x46,0xf0,0xbd,0xff,0x5,0xd1,0xf7,0x42,0x1,0xd8,0x7f,0xd,0xfd,0x5,
+    0xf,0x0,0xc1,0x43,0xf0,0xbd,0xfb,0xd1,0xef,0x64,0xd,0xf9,0xd0,0xb,0x2,0x49,
+    0x5,0x49,0xff,0x8,0x8f,0xe0,0xe4,0x19,0xc9,0x2,0xdb,0xff,0x2,0x29,0x43,0x2b,
+    0x43,0xdb,0xa,0x46,0xff,0xd,0xc0,0x2,0x31,0x43,0x8e,0x46,0x30,0xff,0xb4,0x87,
+    0xb2,0x95,0xb2,0x7d,0x43,0x2e,0xff,0xc,0xad,0xb2,0x14,0xc,0x7c,0x43,0xa4,0xff,
+    0x19,0x26,0xc,0x24,0x4,0x25,0x43,0x9c,0xfd,0xb2,0xb,0x2,0x19,0xc,0x79,0x43,
+    0x27,0xc,0xff,0xc9,0x19,0xa4,0xb2,0xf,0x4,0x3c,0x43,0x7f,0x9,0xc,0x0,0xc,
+    0x97,0xb2,0x47,0x2b,0x0,0xff,0xbe,0x19,0x35,0x43,0xad,0xb2,0x17,0xc,0xff,0x47,
+    0x43,0x36,0xc,0xbf,0x19,0xa6,0xb2,0xff,0xbf,0x19,0x3e,0x4,0x35,0x43,0x24,0xc,
+    0xdf,0x3e,0xc,0x36,0x19,0x9f,0x21,0x0,0xbf,0x19,0x7f,0xbc,0xb2,0x3e,0xc,0x89,
+    0x19,0x1f,0x21,0x0,0xff,0x7f,0x18,0x3e,0x4,0x34,0x43,0x39,0xc,0xef,0x70,0x46,
+    0x80,0xb2,0x3d,0x6e,0x77,0x46,0x3f,0xef,0xc,0x90,0xb2,0x78,0x3d,0x0,0x80,0x19,
+    0x6,0xff,0x4,0xad,0xb2,0x2e,0x43,0x5,0xc,0xa0,0xff,0xb2,0x2d,0x18,0x12,0xc,
+    0x7a,0x43,0x50,0xff,0x19,0x2,0xc,0x80,0xb2,0x24,0xc,0xa4,0xff,0x18,0x9a,0xb2,
+    0x7a,0x43,0x12,0x19,0x14,0xff,0x4,0x20,0x43,0x12,0xc,0x89,0x18,0x1b,0xff,0xc,
+    0x7b,0x43,0xc9,0x18,0x30,0xbc,0xef,0xff,0xa,0x39,0x42,0x3,0xd1,0xb6,0x19,0x40,
+    0xff,0x41,0x49,0x41,0x64,0x1e,0x6f,0x12,0xbf,0xff,0xd,0xe4,0x1b,0xb,0xdb,0xff,
+    0x19,0xbc,0xff,0x42,0x11,0xda,0x24,0x5,0x0,0x27,0x42,0xff,0x8,0xae,0x41,0x78,
+    0x41,0x61,0x41,0x66,0xfb,0x46,0x31,0x35,0x1,0x64,0x1c,0x5,0xd1,0x40,0xff,0x1c,
+    0x61,0x41,0xcf,0x2,0x1,0xd3,0x49,0xff,0x8,0xf4,0xe7,0x50,0xe7,0x5d,0xe7,0xf0,
+    0x55,0xb4,0x83,0x23,0x3b,0x83,0x1,0x41,0x83,0x1,0x43,0x83,0x1,0xef,0x38,0xd0,
+    0xe4,0x1b,0x5d,0xb,0xcf,0xa,0xdb,0xff,0xa,0x6,0x0,0xb6,0x1a,0x9f,0x41,0x4,
+    0xff,0xd2,0x64,0x1e,0xb6,0x19,0x7f,0x41,0xb6,0xff,0x18,0x5f,0x41,0x68,0x12,0x80,
+    0xd,0x24,0xff,0x18,0x0,0x18,0x84,0x42,0x22,0xda,0xe8,0x67,0xc,0x0,0x21,0x17,
+    0x4,0x23,0x0,0x2,0xd2,0x1d,0x2,0xfb,0x3f,0x1c,0x9d,0x2,0xf4,0xd3,0x24,0x1c,
+    0x21,0xf7,0xdd,0x24,0x5,0x1b,0xa,0x5,0xd3,0x37,0x43,0xff,0xc6,0x7,0x37,0x43,
+    0x0,0x26,0x1,0x2f,0xbd,0x70,0xa1,0xa,0xbc,0x70,0x47,0xfc,0xe9,0x1,0x5,0xdd,
+    0xd2,0xd9,0xb,0xf3,0xe7,0x4,0xe5,0x5,0xf1,0xe7,0xf7,0x7f,0xd,0xfa,0x9,0x0,
+    0x61,0x46,0xec,0xe7,0xf7,0x24,0x42,0xfa,0xc5,0x4,0xf,0x3,0xf6,0xd3,0xff,0x0,
+    0x20,0xe2,0xe7,0xf1,0xb5,0x94,0xb0,0xff,0xc,0x0,0x80,0x20,0xc0,0x5,0x3,0x90,
+    0xff,0x4,0x90,0x14,0x99,0xf,0xa8,0xfb,0xf7,0xff,0x27,0xfc,0xb,0xa8,0xf,0xa9,
+    0x10,0x22,0xff,0xfb,0xf7,0xdc,0xfb,0x22,0x0,0xb,0xa9,0x7f,0xb,0xa8,0xf6,0xf7,
+    0x7b,0xf9,0x8,0x7,0x0,0xff,0xfc,0xf7,0xa7,0xfc,0x0,0x20,0x2,0x90,0xff,0x5,
+    0xa8,0x1,0x90,0x8,0xa8,0x0,0x90,0xff,0x0,0x27,0x0,0x98,0x0,0x68,0xc1,0x17,
+    0xff,0x4,0x9a,0xd3,0x17,0xfb,0xf7,0x61,0xff,0xff,0xa,0x0,0xcb,0x17,0x80,0x24,
+    0x24,0x6,0xff,0x0,0x25,0xed,0x43,0xab,0x42,0x4,0xdc,0xff,0x1,0xdb,0xa2,0x42,
+    0x1,0xd2,0x22,0x46,0xdf,0xe,0xe0,0xbb,0x42,0xb,0xd,0x4,0x8,0xd2,0xff,0xe6,
+    0x43,0xbb,0x42,0x6,0xdb,0x1,0xdc,0xff,0xb2,0x42,0x3,0xd3,0x2c,0x46,0x4,0x40,
+    0xff,0x0,0xd0,0x6a,0x8,0x1,0x98,0x2,0x60,0xbf,0x2,0x98,0x40,0x1c,0x2,0x90,
+    0x4f,0x0,0x1d,0xf7,0x0,0x90,0x1,0x5,0x0,0x1,0x90,0x2,0x98,0xff,0x3,0x28,
+    0xce,0xdb,0x1,0x97,0x5,0xa9,0x7e,0x6b,0x0,0xf0,0x38,0xf8,0x2,0x20,0x0,0x75,
+    0x0,0xf7,0xc,0xc8,0x1,0x87,0x0,0x46,0xfd,0x1,0x9a,0xff,0x14,0x98,0x0,0x69,
+    0x40,0x10,0x90,0x42,0xff,0x14,0x98,0x27,0xda,0x0,0x69,0x0,0x2a,0xff,0x1,0xd1,
+    0x68,0x8,0x7,0xe0,0x40,0x10,0xff,0xc1,0x17,0x49,0x6,0xc3,0x9,0x19,0x43,0xff,
+    0x40,0x6,0xfc,0xf7,0x3f,0xfc,0x80,0x21,0xff,0x89,0x4,0x8,0x1a,0x44,0x0,0x0,
+    0x26,0xdf,0x5,0xaf,0xe5,0x17,0x38,0xad,0x0,0x22,0x0,0xff,0x2b,0x0,0xfb,0xf7,
+    0xa,0xff,0x80,0xe,0xff,0x8a,0x1,0x10,0x43,0x38,0x60,0x76,0x1c,0xff,0x3f,0x1d,
+    0x3,0x2e,0xf1,0xdb,0x3,0x9a,0xff,0x5,0xa9,0x14,0x98,0xff,0xf7,0x4b,0xfd,0xff,
+    0x14,0x98,0x15,0xb0,0xf0,0xbd,0xf1,0xb5,0xff,0x0,0x26,0x0,0x27,0xc,0x0,0x3,
+    0x25,0xbb,0x20,0x68,0x55,0x2,0x2,0x0,0xb,0x37,0x0,0xee,0xff,0xfe,0x80,0x19,
+    0x79,0x41,0x6,0x0,0xf,0xff,0x0,0x24,0x1d,0x6d,0x1e,0xf1,0xd1,0x0,0xff,0x98,
+    0xc0,0xc0,0x8,0x38,0xf2,0xbd,0xf4,0xff,0xb5,0x4,0x0,0xe,0x0,0x1,0x2e,0x1,
+    0xff,0xda,0x0,0x20,0x19,0xe0,0xd,0x25,0x30,0xff,0x0,0xfd,0xf7,0x36,0xfa,0x29,
+    0x1a,0x1,0xff,0x25,0x8,0x0,0x28,0x40,0xf,0x18,0xc,0xff,0x20,0xc1,0x1b,0x30,
+    0x0,0xfa,0xf7,0xad,0xff,0xff,0x0,0x99,0xfd,0xf7,0x53,0xfc,0xa9,0xff,0x7,0x49,
+    0x1b,0x81,0x42,0x0,0xda,0x8,0xff,0x0,0x79,0x10,0x49,0x1f,0xfa,0xf7,0xa1,0xff,
+    0xff,0x20,0x60,0x20,0x0,0xf2,0xbd,0xfc,0xfb,0xb5,0x7,0x47,0x0,0x0,0x20,0x0,
+    0x21,0x14,0xac,0x79,0x0,0xb,0x1,0x91,0x30,0xb3,0x2,0x68,0x61,0x3,0xb0,0xff,
+    0xfe,0x0,0x9a,0x1,0x9b,0x80,0x18,0x59,0xef,0x41,0x24,0x1d,0x36,0x7d,0x0,0xef,
+    0xd1,0x3,0xff,0xc7,0xf6,0xbd,0xf7,0xb5,0x82,0xb0,0x7f,0xff,0x24,0x1,0x2a,0x20,
+    0xdb,0x1,0x46,0x80,0xff,0x20,0x0,0x6,0x0,0x26,0xb,0x68,0x83,0xff,0x42,0xa,
+    0xd0,0xde,0x17,0x73,0x40,0x9b,0xfd,0x1b,0xc3,0x0,0x2b,0x4,0xd4,0x5b,0x0,0x76,
+    0xff,0x1c,0x20,0x2e,0xf9,0xdb,0x20,0x26,0xb4,0xff,0x42,0x0,0xdd,0x34,0x0,0x9,
+    0x1d,0x52,0xff,0x1e,0xea,0xd1,0x20,0x2c,0x6,0xd1,0x4,0xff,0x98,0x81,0x0,0x3,
+    0x98,0xfb,0xf7,0xc2,0xff,0xfa,0x0,0x20,0x60,0xe0,0xa4,0x1e,0x60,0xff,0xb2,0x1,
+    0x12,0xa,0x0,0x42,0x40,0x50,0xff,0x1a,0xc0,0x7,0x0,0xd5,0x64,0x1e,0x0,0xff,
+    0x22,0x0,0x23,0x4,0x98,0x1,0x28,0x1d,0xff,0xdb,0x2,0x9e,0x5,0x46,0x67,0x42,
+    0x30,0xff,0x68,0x0,0x2c,0x1,0xd4,0xa0,0x40,0x5,0xff,0xe0,0x39,0x0,0x20,0x29,
+    0x1,0xdb,0xc0,0xff,0x17,0x0,0xe0,0x8,0x41,0xc1,0x17,0x0,0x17,0x92,0x1,0x93,
+    0x21,0x7,0x5d,0xa5,0xc,0xf,0x2,0xa7,0x2,0x7f,0xe4,0xd1,0x58,0x10,0x1,0x27,
+    0x1f,0xeb,0x1,0xff,0x40,0x1c,0x80,0x21,0x9,0x1,0x88,0x42,0xff,0xc8,0xdb,0x0,
+    0x25,0x0,0x95,0x3,0x22,0xff,0x1,0x0,0x68,0x46,0x2,0xf0,0x1,0xfd,0xff,0x0,
+    0x98,0xa8,0x42,0xbe,0xd0,0x0,0x27,0xfe,0x69,0x2,0x1c,0xdb,0x3,0x9e,0x2,0x9d,
+    0x1b,0xdb,0x3c,0x28,0xf7,0x0,0x0,0x9a,0xf7,0x2,0x34,0xfe,0xff,0x23,0x0,0x3,
+    0xd4,0x1a,0x0,0x2,0xf0,0xff,0x9,0xfd,0x6,0xe0,0x5a,0x42,0x40,0x2a,0xff,0x1,
+    0xdb,0xc8,0x17,0x1,0xe0,0x2,0xf0,0x7f,0x13,0xfd,0x30,0x60,0x7f,0x1c,0x2d,0xd,
+    0x1,0xff,0x4,0x98,0x87,0x42,0xe5,0xdb,0x1,0x20,0xfd,0x5,0xb9,0x1,0x10,0xb4,
+    0x2,0x0,0x3,0x23,0xff,0xc,0x68,0x14,0x60,0x9,0x1d,0x12,0x1d,0xff,0x5b,0x1e,
+    0xf9,0xd1,0x10,0xbc,0x70,0x47,0xea,0x27,0x5,0x26,0x27,0x11,0x25,0x27,0x7,0xdd,
+    0x17,0x6b,0xe7,0x40,0x5b,0x1b,0x8f,0x0,0x27,0x5,0x6d,0x1c,0x20,0xad,0x2d,0x27,
+    0x1,0x25,0xae,0x27,0x1,0x2e,0x27,0xb,0x2e,0xba,0x27,0xf,0x2e,0x27,0x5,0xb6,
+    0x1e,0x70,0x27,0x15,0x76,0xfe,0x27,0x13,0x9c,0x5,0x46,0x77,0x42,0x20,0x68,0xdf,
+    0x0,0x2e,0x1,0xd4,0xb0,0x27,0x31,0xc9,0xfd,0xba,0x27,0x13,0x24,0x27,0x5,0x10,
+    0x0,0x19,0xe5,0x0,0x6d,0xff,0xfc,0x1,0x0,0x2,0x29,0xca,0xdb,0x0,0xf7,0x24,
+    0x1,0x94,0x23,0x1,0xa8,0x2,0xf0,0xb4,0xff,0xfe,0x1,0x98,0xa0,0x42,0xc1,0xd0,
+    0x0,0xfd,0x94,0x63,0x2,0x1f,0xdb,0x3,0x9c,0x2,0x9d,0xaf,0x37,0x0,0x1b,0x3f,
+    0x23,0x3,0x1,0x23,0x5,0xa2,0xbf,0xfd,0x0,0x2f,0x3,0xd4,0x3a,0x3d,0x0,0x77,
+    0xef,0xfc,0x6,0xe0,0x7a,0x23,0x11,0x81,0xfc,0x20,0xff,0x60,0x0,0x98,0x40,0x1c,
+    0x0,0x90,0x2d,0xff,0x1d,0x24,0x1d,0x4,0x99,0x88,0x42,0xe1,0xfe,0x27,0x9,0xf0,
+    0xb5,0x6,0x0,0xf,0x0,0x0,0xb7,0x24,0x35,0x0,0x47,0x2,0x3a,0x68,0x47,0x2,
+    0x7e,0xff,0xfd,0x80,0xf,0x8a,0x0,0x10,0x43,0x28,0xfb,0x60,0x64,0x57,0x1,0x3,
+    0x2c,0xf1,0xdb,0x30,0xff,0x0,0xf0,0xbd,0x30,0xb4,0x0,0x22,0x3,0xff,0x0,0x1c,
+    0x68,0xd,0x68,0x64,0x19,0x1c,0xff,0x60,0x52,0x1c,0x9,0x1d,0x1b,0x1d,0x3,0xef,
+    0x2a,0xf6,0xdb,0x30,0x57,0x1,0xf3,0xb5,0x83,0xff,0xb0,0x0,0x20,0x1,0x90,0x3,
+    0x98,0x0,0xbf,0x90,0x0,0x27,0x0,0x98,0x0,0x4b,0x0,0x4,0xfb,0x9a,0x12,0x4d,
+    0x4,0x57,0xfd,0x42,0xe,0xcc,0xff,0x1,0x22,0x43,0x4b,0x16,0x80,0x24,0x24,0xfe,
+    0x71,0x1,0xed,0x43,0xab,0x42,0x4,0xdc,0x1,0xff,0xdb,0xa2,0x42,0x1,0xd2,0x22,
+    0x46,0xe,0xef,0xe0,0xbb,0x42,0xb,0xd,0x4,0x8,0xd2,0xe6,0xff,0x43,0xbb,0x42,
+    0x6,0xdb,0x1,0xdc,0xb2,0xff,0x42,0x3,0xd3,0xec,0x9,0x4,0x40,0x0,0xff,0xd0,
+    0x6a,0x8,0x0,0x98,0x2,0x60,0x1,0xf6,0xb9,0x0,0x1,0x90,0x55,0x0,0x1d,0x0,
+    0x90,0x1,0x7f,0x98,0x3,0x28,0xce,0xdb,0x3,0x98,0xbb,0x2,0xff,0x30,0xb4,0xdc,
+    0xf,0x3,0xd0,0x5b,0x42,0xff,0x52,0x42,0x0,0xd2,0x5b,0x1e,0xd,0x10,0xff,0x6c,
+    0x40,0x13,0xd0,0xf4,0x46,0x0,0x25,0xff,0x2,0xd3,0x49,0x42,0x40,0x42,0xa9,0x41,
+    0xff,0x0,0xf0,0xd,0xf8,0xe4,0x7,0x3,0xd3,0x7e,0x21,0x2,0xab,0x41,0x24,0x42,
+    0x2,0xd5,0x17,0x6,0xff,0x30,0xbc,0x60,0x47,0x30,0xbc,0x12,0x42,0xff,0x24,0xd0,
+    0x99,0x42,0x28,0xd9,0x70,0xb5,0xff,0x0,0x25,0x1b,0x42,0x2,0xd0,0xc,0x0,0xef,
+    0x0,0x21,0x9,0xe0,0x6f,0x1,0x26,0x49,0x18,0xff,0x64,0x41,0x94,0x42,0x0,0xd3,
+    0xa4,0x1a,0xff,0x76,0x41,0xf8,0xd3,0x31,0x0,0x1,0x26,0x7f,0x1,0xe0,0x76,0x41,
+    0x9,0xd2,0x0,0x17,0x0,0xff,0x6d,0x41,0xa4,0x1a,0x9d,0x41,0xf7,0xd2,0xff,0xa4,
+    0x18,0x5d,0x41,0xb6,0x19,0xf5,0xd3,0xfd,0x30,0xf4,0x1,0x2b,0x0,0x70,0xbd,0x1b,
+    0x42,0xff,0xd8,0xd1,0x8,0xb5,0xc0,0x46,0xc0,0x46,0xff,0x8,0xbd,0x1,0xd1,0x90,
+    0x42,0xd3,0xd2,0xfe,0xd1,0x3,0x0,0x21,0x0,0x20,0x70,0x47,0xf8,0xff,0xb5,0x8e,
+    0xb0,0x7,0x0,0xb,0x68,0x4c,0xff,0x68,0x88,0x68,0x40,0x10,0x61,0x10,0x5b,0xff,
+    0x10,0x4,0x93,0x5,0x91,0x6,0x90,0x0,0xff,0x20,0x4,0xa9,0xb,0x68,0x14,0x68,
+    0x64,0xbf,0x10,0x1b,0x19,0xb,0x60,0x40,0x51,0x1,0x12,0xff,0x1d,0x3,0x28,0xf5,
+    0xdb,0xb,0xac,0x4,0xd7,0xad,0x3,0x26,0x8f,0x3,0xe,0xd7,0x5,0xb6,0xfc,0xb7,
+    0xc0,0xf,0x4a,0x8f,0x1,0x20,0x60,0xbd,0x3,0x76,0xff,0x1e,0xf1,0xd1,0x80,0x20,
+    0x0,0x4,0x7,0xff,0x90,0xb,0x98,0x8,0x90,0xc,0x98,0x9,0xff,0x90,0xd,0x98,
+    0xa,0x90,0x7,0xaa,0x39,0xfb,0x0,0x38,0xf9,0x1,0xbe,0xfd,0x38,0x68,0x0,0xff,
+    0x90,0x78,0x68,0x1,0x90,0xb8,0x68,0x2,0xff,0x90,0xf8,0x68,0x3,0x90,0x4,0x22,
+    0x69,0xff,0x46,0x68,0x46,0x1,0xf0,0xe1,0xfb,0x0,0xfb,0x98,0x38,0x4b,0x1,0x78,
+    0x60,0x2,0x98,0xb8,0xbf,0x60,0x3,0x98,0xf8,0x60,0xf,0x43,0x1,0xf8,0xff,0xb5,
+    0x4,0x0,0xd,0x0,0x17,0x0,0x0,0xff,0x94,0x28,0x0,0x7,0xd0,0x0,0x2b,0x5,
+    0xff,0xd0,0x1e,0x0,0x20,0x0,0xa8,0x47,0xe4,0xff,0x19,0x76,0x1e,0xfa,0xd1,0x0,
+    0x98,0xf2,0xff,0xbd,0x70,0xb5,0x8c,0xb0,0x5,0x0,0xe,0xff,0x0,0x10,0x68,0x51,
+    0x68,0x92,0x68,0x0,0xff,0x24,0x4,0x94,0x5,0x90,0x6,0x91,0x7,0xff,0x92,0x31,
+    0x0,0x68,0x46,0xfb,0xf7,0x12,0xff,0xf9,0x8,0xa8,0x69,0x46,0x10,0x22,0xfb,0x7f,
+    0xf7,0xc7,0xf8,0x80,0x20,0x40,0x4,0xa1,0x1,0x7f,0x94,0x2,0x94,0x3,0x94,0x4,
+    0xaa,0x1f,0x6,0xef,0xa1,0xff,0x8,0xaa,0x7f,0x2,0xfc,0xf7,0x86,0xff,0xf8,0x2,
+    0x98,0x3,0x99,0x1,0x9a,0x2a,0xff,0x60,0x68,0x60,0xa9,0x60,0xc,0xb0,0x70,0xff,
+    0xbd,0xf7,0xb5,0x82,0xb0,0x7f,0x24,0x1,0xdf,0x2a,0x20,0xdb,0x1,0x46,0xd1,0x0,
+    0x6,0x0,0xff,0x26,0xb,0x68,0x83,0x42,0xa,0xd0,0xde,0xff,0x17,0x73,0x40,0x9b,
+    0x1b,0x0,0x26,0x0,0xff,0x2b,0x4,0xd4,0x5b,0x0,0x76,0x1c,0x20,0xff,0x2e,0xf9,
+    0xdb,0x20,0x26,0xb4,0x42,0x0,0xff,0xdd,0x34,0x0,0x9,0x1d,0x52,0x1e,0xea,0xff,
+    0xd1,0x20,0x2c,0x6,0xd1,0x4,0x98,0x81,0xff,0x0,0x3,0x98,0xfb,0xf7,0x67,0xf8,
+    0x0,0xff,0x20,0x56,0xe0,0xa4,0x1e,0x60,0xb2,0x2,0xff,0xf0,0xcc,0xfa,0xc0,0x7,
+    0x0,0xd5,0x64,0xfd,0x1e,0x3b,0x0,0x27,0x4,0x98,0x1,0x28,0x15,0xff,0xdb,0x2,
+    0x98,0x0,0x90,0x4,0x9d,0x21,0xff,0x0,0x0,0x98,0x0,0x68,0xfa,0xf7,0xf0,0xf7,
+    0xfc,0xc1,0x17,0x97,0x3,0xfb,0xf7,0xc,0xfc,0x7f,0x80,0x19,0x79,0x41,0x6,0x0,
+    0xf,0x19,0x2,0xff,0x1d,0x0,0x90,0x6d,0x1e,0xec,0xd1,0x30,0xfb,0x0,0x39,0x41,
+    0x1,0xb0,0xfa,0x1,0x0,0x80,0xff,0x29,0xd4,0xdb,0x0,0x25,0x0,0x95,0x3,0xff,
+    0x22,0x68,0x46,0x2,0xf0,0xfe,0xfd,0x0,0x7f,0x98,0xa8,0x42,0xcb,0xd0,0x1,0x95,
+    0x53,0x2,0xff,0x1f,0xdb,0x3,0x9e,0x2,0x9d,0x27,0x0,0xeb,0x1b,0x3f,0xa1,0x3,
+    0x0,0xa1,0x5,0xe5,0xfb,0x0,0xef,0x2f,0x3,0xd4,0x3a,0x3d,0x0,0xba,0xfa,0x6,
+    0xff,0xe0,0x7a,0x42,0x40,0x2a,0x1,0xdb,0xc8,0xff,0x17,0x1,0xe0,0x2,0xf0,0xc4,
+    0xfa,0x30,0xfe,0x73,0x1,0x40,0x1c,0x1,0x90,0x2d,0x1d,0x36,0xff,0x1d,0x4,0x99,
+    0x88,0x42,0xe1,0xdb,0x1,0xfb,0x20,0x5,0x79,0x5,0xc,0x0,0x15,0x0,0x2,0xbf,
+    0x0,0x41,0x42,0x0,0x91,0x20,0x49,0x0,0x80,0xdf,0x23,0xdb,0x5,0xd2,0x18,0x4d,
+    0x2,0xbe,0xfb,0xec,0x97,0x2,0x5d,0xe,0xb6,0xfb,0xab,0x2,0x80,0xf,0x8a,0xff,
+    0x0,0x10,0x43,0x20,0x60,0x20,0x68,0x28,0xff,0x60,0xf1,0xbd,0x0,0x0,0xf0,0xb5,
+    0x85,0xfb,0xb0,0x4,0x97,0x1,0x62,0x68,0x52,0x1c,0x62,0xff,0x60,0x1,0x2a,0x15,
+    0xd1,0x8,0x30,0xe,0xdf,0xce,0xe,0xc0,0xc,0x3e,0xc0,0x1,0x21,0x22,0xff,0x0,
+    0x18,0x32,0x3,0x23,0x3,0xc2,0x5b,0xbf,0x1e,0xfc,0xd1,0x20,0x0,0x30,0x19,0x8,
+    0x3c,0xdf,0x34,0x7,0xce,0x7,0xc4,0x7d,0x2,0x0,0x2a,0xff,0x1,0xd1,0x2b,0x48,
+    0x4,0xe0,0x80,0x20,0xff,0xc0,0x5,0x0,0x21,0xfc,0xf7,0xac,0xf8,0xff,0x4,0x90,
+    0x0,0x27,0x25,0x0,0x8,0x35,0xff,0x20,0x0,0x18,0x30,0x2,0x90,0x7,0xe0,0xff,
+    0x8,0x0,0x68,0x63,0x7f,0x1c,0x2,0x98,0xf9,0x8,0xd,0x0,0xbb,0x2,0x20,0x68,
+    0x87,0x42,0xe1,0xff,0xd2,0x30,0x68,0x1,0x11,0x28,0x68,0x2,0xff,0x11,0x89,0x1a,
+    0x3,0x91,0xc1,0x17,0x89,0x7f,0x6,0x82,0x9,0x11,0x43,0x80,0x6,0xf5,0x1,0xbf,
+    0x91,0x3,0x98,0xc1,0x17,0x4,0xaf,0x4,0x5e,0xff,0xfb,0x0,0x9a,0x1,0x9b,0x80,
+    0x18,0x59,0xff,0x41,0x80,0xe,0x8a,0x1,0x10,0x43,0x28,0xfb,0x60,0x30,0x31,0x0,
+    0x28,0x68,0x0,0x11,0x12,0x9f,0x1a,0x2,0x98,0x3,0xc8,0x2d,0xa,0x2b,0x2,0x48,
+    0xfe,0x2b,0xc,0x2,0x9a,0x3,0xc2,0x28,0x0,0x28,0xff,0x30,0x31,0x68,0xaa,0x6a,
+    0x8a,0x42,0x0,0xff,0xda,0x11,0x0,0x1,0x60,0x31,0x68,0x68,0xff,0x6b,0x81,0x42,
+    0xb9,0xda,0xb9,0xe7,0x0,0xff,0xbf,0xff,0xff,0xff,0x7f,0x30,0xb4,0x0,0xff,0x22,
+    0x3,0x0,0x30,0x33,0x8,0xe0,0xdc,0xff,0x68,0x64,0x10,0x1d,0x68,0x6d,0x10,0x64,
+    0xff,0x1b,0xc,0x60,0x52,0x1c,0x1b,0x1d,0x9,0xff,0x1d,0x4,0x68,0xa2,0x42,0xf3,
+    0xd3,0x30,0x3f,0xbc,0x70,0x47,0xfc,0xb5,0x7,0x17,0x1,0x5,0x3,0xaf,0x14,0x0,
+    0x3,0x25,0x6d,0x2,0x30,0x4b,0x1,0x22,0xd5,0x68,0x6f,0x2,0x10,0x6f,0xc,0x24,
+    0xd3,0x0,0x6d,0x1e,0xdf,0xef,0xd1,0x3,0xc7,0xf6,0x8b,0x1,0x4,0x0,0xff,0x41,
+    0x0,0x9,0xe,0xff,0x29,0x3,0xd1,0xff,0x40,0x2,0x1,0xd0,0x20,0x0,0xf2,0xbd,
+    0xff,0x20,0x0,0x0,0x21,0x0,0xf0,0xe0,0xfa,0xff,0x4,0xd2,0x80,0x20,0x0,0x6,
+    0x44,0x40,0xff,0x4,0x25,0x0,0xe0,0x2,0x25,0x20,0x0,0xff,0x1c,0x49,0x0,0xf0,
+    0xd5,0xfa,0x12,0xd2,0xdf,0xfe,0x27,0xbf,0x5,0x38,0x22,0x0,0x0,0xf0,0xd7,0x76,
+    0xfa,0x6,0x6c,0x0,0x39,0x9,0x0,0x39,0xfa,0xfd,0x31,0x5,0x0,0xd5,0xfc,0x0,
+    0xf0,0xa0,0xfc,0xdd,0x1,0x13,0x0,0x16,0xe0,0x12,0x2d,0x0,0xbe,0xfa,0xaf,0x18,
+    0xd2,0x4f,0x1e,0x2b,0x6,0x60,0x2b,0xc,0x23,0xfa,0x2b,0x4,0xbf,0x2b,0x0,0x8a,
+    0xfc,0x2,0x21,0x69,0xfb,0x40,0xd,0x1f,0x4,0xb6,0xff,0x29,0x0,0x2,0xff,0xf0,
+    0xe3,0xfc,0xf2,0xbd,0x1,0xf0,0x46,0xff,0xfd,0x21,0x21,0x1,0x60,0x2,0x48,0xf2,
+    0xff,0xbd,0xf4,0x4,0x35,0x3f,0x1,0x0,0x80,0xf5,0x3f,0x3,0x3,0xf4,0xab,0x0,
+    0xe,0x0,0x1,0x2e,0xff,0x1,0xda,0x0,0x20,0x19,0xe0,0x6,0x25,0xff,0x30,0x0,
+    0xfc,0xf7,0x3,0xfe,0x29,0x1a,0xff,0x1,0x25,0x8,0x0,0x28,0x40,0xf,0x18,0xff,
+    0x5,0x20,0xc1,0x1b,0x30,0x0,0xfa,0xf7,0xff,0x7a,0xfb,0x0,0x99,0xfd,0xf7,0x20,
+    0xf8,0xdf,0xa9,0x7,0x49,0x1b,0x81,0x4f,0x1,0x8,0x0,0xff,0x79,0x10,0x89,0x1e,
+    0xfa,0xf7,0x6e,0xfb,0xfb,0x20,0x60,0xdf,0x2,0x0,0x21,0x1,0x63,0x41,0xff,0x63,
+    0x81,0x63,0xc1,0x63,0x1,0x64,0x70,0xbb,0x47,0x70,0x55,0x0,0xa,0x0,0x20,0x27,
+    0x1,0x12,0xfe,0x27,0x5,0x7c,0xfa,0x82,0xd,0x8d,0x2,0x2a,0xff,0x43,0x80,0x26,
+    0xb6,0x3,0x6,0x40,0x0,0xef,0xd0,0x52,0x1c,0x22,0x35,0x0,0x70,0xbd,0x0,0xff,
+    0x0,0xf2,0xb5,0x82,0xb0,0x4,0x0,0x15,0xff,0x0,0x2e,0x68,0x0,0x2e,0x1,0xd1,
+    0x14,0xff,0x48,0x22,0xe0,0x8,0x46,0x3,0xc8,0x6f,0xff,0x46,0xca,0x17,0xcb,0x17,
+    0xc,0xc7,0xf2,0xff,0x17,0x56,0x40,0xb6,0x1a,0x2,0x0,0xb,0x7b,0x0,0x68,0x15,
+    0x0,0x50,0x40,0x59,0x40,0xb,0xa,0xff,0x12,0x1a,0x8b,0x41,0x10,0x0,0x19,0x0,
+    0xff,0x32,0x0,0xfb,0xf7,0x7f,0xff,0x2,0x0,0xff,0x2,0x98,0x3,0xc8,0xc8,0x17,
+    0x29,0x68,0xff,0xc9,0x17,0x41,0x40,0x4a,0x40,0x50,0x1a,0xde,0x95,0x2,0x3,0xb0,
+    0xf0,0xbd,0xe3,0x2,0x60,0xb4,0xff,0x1,0x0,0x8,0x68,0xc3,0x17,0x58,0x40,0xff,
+    0xc6,0x1a,0x48,0x68,0xc5,0x17,0x68,0x40,0xff,0x40,0x1b,0xb0,0x42,0x0,0xdb,0x6,
+    0x0,0xff,0x88,0x68,0xc2,0x17,0x3,0x0,0x53,0x40,0xf7,0x9b,0x1a,0xb3,0xd3,0x0,
+    0x33,0x0,0xc9,0x68,0xff,0xca,0x17,0x8,0x0,0x50,0x40,0x80,0x1a,0xdd,0x98,0xf,
+    0x0,0x18,0x0,0x60,0xff,0x1,0x70,0xb5,0xfd,0x8c,0xa1,0x0,0x68,0x46,0xfa,0xf7,
+    0xc3,0xfe,0xff,0x5,0xa8,0x69,0x46,0x10,0x22,0xfa,0xf7,0xff,0x78,0xfe,0x22,0x0,
+    0x5,0xa9,0x5,0xa8,0xff,0xf5,0xf7,0x17,0xfc,0x6,0x98,0x9,0x90,0xff,0x7,0x98,
+    0xa,0x90,0x8,0x98,0xb,0x90,0xff,0x0,0x26,0x3,0x96,0x0,0x22,0x0,0x23,0xff,
+    0x9,0xac,0x3,0x25,0x20,0x68,0x40,0x10,0xbf,0xc1,0x17,0x0,0x92,0x1,0x93,0xb3,
+    0x2,0xfb,0xff,0xf7,0xfa,0xf9,0x0,0x9a,0x1,0x9b,0x80,0xf7,0x18,0x59,0x41,0xf,
+    0x2,0x24,0x1d,0x6d,0x1e,0xff,0xed,0xd1,0x2,0x20,0x0,0x90,0x3,0xa8,0xff,0x2,
+    0xf0,0x6,0xf9,0x3,0x98,0x2,0x90,0xbf,0x1,0x20,0x2,0x99,0x81,0x42,0x89,0x3,
+    0x9,0xff,0xe0,0x5,0x98,0x1,0xf0,0x2b,0xf9,0x4,0xff,0x90,0x4,0xa9,0x2,0xa8,
+    0xfc,0xf7,0x5b,0xff,0xfb,0x1,0xf0,0x24,0xf9,0xc,0xb0,0x70,0xef,0xbd,0xf2,0xb5,
+    0x86,0x8d,0x0,0x62,0x68,0x52,0xff,0x1c,0x62,0x60,0x1,0x2a,0x16,0xd1,0x8,0xff,
+    0x30,0x6,0x99,0x2c,0xc9,0x2c,0xc0,0x0,0xff,0x20,0x0,0x21,0x22,0x0,0x18,0x32,
+    0x3,0xff,0x23,0x3,0xc2,0x5b,0x1e,0xfc,0xd1,0x20,0xfb,0x0,0x30,0x19,0x8,0x3c,
+    0x34,0x6,0x98,0xe,0xef,0xc8,0xe,0xc4,0x7,0xd,0x1,0x0,0x2a,0x2,0xff,0xd1,
+    0x35,0x48,0x4,0x90,0xd,0xe0,0x80,0xff,0x20,0x0,0x6,0x0,0x21,0xd3,0x17,0xff,
+    0xff,0xf7,0x83,0xfc,0x42,0x8,0xcd,0x7,0x2a,0xf7,0x43,0x1,0x26,0x99,0x7,0x4,
+    0x92,0x0,0x20,0xff,0x3,0x90,0x25,0x0,0x8,0x35,0x6,0x9f,0xff,0x20,0x0,0x18,
+    0x30,0x2,0x90,0x9,0xe0,0xff,0x8,0x0,0x68,0x63,0x3,0x98,0x40,0x1c,0xdf,0x3,
+    0x90,0x2,0x98,0x8,0x11,0x0,0x3f,0x1d,0xff,0x2d,0x1d,0x3,0x98,0x21,0x68,0x88,
+    0x42,0xff,0xd3,0xd2,0x28,0x68,0x0,0xf0,0x8d,0xfd,0xf7,0x6,0x0,0x38,0x7,0x0,
+    0x89,0xfd,0x86,0x1b,0xfd,0x28,0xf5,0x1,0x89,0x6,0x82,0x9,0x11,0x43,0xff,0x80,
+    0x6,0x0,0x90,0x1,0x91,0x30,0x0,0xff,0xf1,0x17,0x4,0x9a,0xd3,0x17,0xfb,0xf7,
+    0xfd,0x79,0x1,0xd,0x0,0xf0,0xe8,0xfa,0x28,0x60,0x77,0x29,0x0,0x1,0xfb,0x0,
+    0x10,0xfc,0x39,0x5d,0x1,0xef,0x2,0xf0,0xc,0xfc,0x1d,0x0,0x98,0x12,0x1a,0xac,
+    0xc9,0x3,0x37,0x6,0xc1,0x17,0x35,0x2,0x5e,0x37,0xf,0x9a,0x7f,0x3,0xc2,0x38,
+    0x68,0xa9,0x6a,0x81,0x9b,0x1,0xff,0x8,0x0,0xa8,0x62,0x39,0x68,0x68,0x6b,0xff,
+    0x81,0x42,0xb0,0xda,0xb0,0xe7,0x0,0xbf,0xfe,0xe7,0x3,0xf5,0xb5,0x8f,0xb0,0xf,
+    0x0,0x44,0xff,0x68,0x0,0x2c,0x23,0xd0,0x22,0x0,0x11,0xff,0xd1,0x4b,0x48,0x3,
+    0x90,0x8,0xa8,0xf,0xef,0x99,0x18,0x31,0x18,0xb3,0x1,0x9e,0xfd,0x4,0xbe,0xb,
+    0x0,0x8,0x31,0x1c,0xc9,0x1c,0x2d,0x1,0x2,0xbf,0x90,0x4,0xac,0x8,0xad,0x4f,
+    0x7,0x11,0xff,0xbf,0xfb,0x42,0x8,0xce,0x7,0x32,0x7,0xd,0x3,0xff,0x92,0x1,
+    0x2c,0xdf,0xd1,0x10,0x98,0x2,0xaf,0xf0,0xc6,0xfb,0x11,0x3b,0x1,0x20,0xdf,0x0,
+    0x19,0xaa,0xe7,0x8,0x15,0xe7,0x0,0x20,0xe7,0x20,0x3,0xe7,0x4,0x5,0xbe,0xe7,
+    0x10,0x74,0xfa,0x20,0x60,0x21,0xe7,0x4,0x9c,0xed,0xfb,0xe7,0x6,0x98,0xfb,0xe7,
+    0x6,0x3,0xcd,0x8,0xed,0x3d,0xe7,0x12,0xea,0xf8,0x35,0xa,0x3,0xc5,0x2,0xfc,
+    0x6b,0x1,0x65,0x3,0x24,0x1d,0x2,0x98,0xf,0x99,0xfd,0x9,0x67,0x1,0xbf,0xd3,
+    0x0,0x20,0x1,0x90,0xff,0x10,0x9e,0x8,0xaf,0x17,0xe0,0xcc,0x17,0xff,0xcd,0x17,
+    0xd2,0x17,0x0,0x9b,0x53,0x40,0xff,0x9a,0x1a,0x60,0x40,0x69,0x40,0x2b,0x0,0xff,
+    0x0,0x1b,0x99,0x41,0xfb,0xf7,0xf6,0xfd,0xff,0x0,0x99,0xc9,0x17,0x61,0x40,0x48,
+    0x40,0xdf,0x40,0x1a,0x30,0x60,0x1,0x43,0x0,0x1,0x90,0xdf,0x8,0x37,0x36,0x1d,
+    0x1,0x43,0x8,0x9b,0xd2,0xff,0xf,0x98,0x40,0x68,0x0,0x90,0x3,0xcf,0xff,0x8,
+    0x3f,0x40,0xe,0xca,0x1,0x10,0x43,0xff,0x49,0x16,0x0,0x9a,0x0,0x2a,0xd6,0xd1,
+    0xf7,0x1,0x48,0xe6,0x43,0x9,0x1,0x22,0xd2,0x7,0xff,0x3,0x0,0x4b,0x40,0x2e,
+    0xd4,0x43,0x1a,0xff,0x1,0xd2,0xc0,0x1a,0xc9,0x18,0x30,0xb4,0xff,0x4b,0x18,0x4,
+    0x18,0x24,0xe,0x1b,0xe,0xff,0x22,0xd0,0xff,0x2c,0x20,0xd0,0xe3,0x1a,0xff,0x18,
+    0x2b,0x1d,0xdc,0x9,0x2,0x11,0x43,0xff,0xc4,0xd,0x64,0x1e,0x0,0x2,0x10,0x43,
+    0xff,0x94,0x46,0x19,0x25,0xed,0x1a,0xa,0x0,0xff,0xaa,0x40,0xd9,0x40,0x45,0x18,
+    0x1,0xd3,0xff,0x6d,0x8,0xa4,0x1c,0xe4,0x5,0xd2,0x9,0xff,0x28,0xa,0x2d,0x6,
+    0x2a,0x43,0x65,0x46,0xff,0xaa,0x41,0x60,0x41,0x3,0x18,0x1b,0xe,0xff,0xff,0x2b,
+    0x1,0xd3,0xc0,0xd,0xc0,0x5,0xff,0x30,0xbc,0x70,0x47,0x51,0x40,0x6,0xe0,0xaf,
+    0x51,0x40,0xcc,0xe7,0x6f,0xa,0xf8,0x6f,0x0,0x3,0x1e,0x6f,0x4,0x50,0x40,0x51,
+    0x40,0x73,0x2,0x61,0x2,0x77,0x6,0xfd,0x40,0x77,0x0,0x3a,0xd0,0x25,0x0,0x9d,
+    0x41,0xff,0xb,0xd3,0x1e,0xd8,0xc5,0xd,0x40,0x2,0xff,0x40,0x1a,0xb,0xd3,0xed,
+    0x5,0x1,0x0,0xff,0x40,0xa,0xc9,0x5,0x91,0x41,0x68,0x41,0xfb,0xd5,0xe7,0x15,
+    0x2,0x49,0x18,0x40,0x1a,0xd0,0xff,0xd0,0x1,0x21,0x40,0x8,0x49,0x1c,0x0,0xff,
+    0x18,0xfc,0xd5,0x8c,0x42,0x4,0xd3,0x6d,0xff,0x1a,0x0,0xa,0xed,0x5,0x40,0x19,
+    0xc4,0xff,0xe7,0xe8,0x5,0x10,0x40,0xc1,0xe7,0x18,0xff,0x2d,0xbf,0xdc,0xac,0x1c,
+    0xd,0x0,0xe1,0xff,0x40,0xe5,0x41,0x4d,0x40,0x1,0x2d,0x49,0xf7,0x41,0xc4,0xd,
+    0xc3,0x2,0x45,0x1a,0x1,0xd4,0xff,0x6d,0x19,0x95,0x43,0x64,0x1e,0xe4,0x5,0xf2,
+    0xb7,0x2,0x95,0xb3,0x0,0xa7,0x2,0xff,0x2b,0xa7,0xd1,0xff,0xd8,0x43,0xa5,0xe7,
+    0x24,0x42,0xa3,0xd1,0xff,0x0,0x20,0xa1,0xe7,0xc,0xb4,0x1,0x22,0xff,0x12,0x6,
+    0x3,0x18,0xda,0x42,0x7,0xd8,0xfd,0x4b,0x5,0x0,0x4,0xd8,0x2,0x0,0xa,0x43,
+    0x7f,0x92,0x18,0x2,0xd2,0x88,0x42,0xc,0x2f,0x0,0xff,0xfc,0xd0,0x81,0x42,0xfa,
+    0xe7,0x0,0x0,0xfb,0x94,0x46,0x17,0x6,0x8,0xd0,0x88,0x42,0x6,0xfd,0xd1,0x33,
+    0x2,0x0,0x18,0xd0,0x42,0x8,0x46,0xff,0x0,0xd8,0x80,0x42,0x62,0x46,0x70,0x47,
+    0xff,0xf5,0xb5,0x83,0xb0,0xe,0x0,0x2,0x90,0xff,0x3,0x27,0x0,0x20,0x0,0x21,
+    0x4,0x9c,0xff,0x3,0x25,0x0,0x90,0x1,0x91,0x30,0x68,0xff,0xc1,0x17,0x22,0x68,
+    0xd3,0x17,0xfa,0xf7,0xff,0xe3,0xff,0x0,0x9a,0x1,0x9b,0x80,0x18,0xff,0x59,0x41,
+    0xc,0x36,0x24,0x1d,0x6d,0x1e,0xff,0xef,0xd1,0x2,0x98,0x1,0x60,0x2,0x98,0xff,
+    0x0,0x1d,0x2,0x90,0x20,0x3e,0x7f,0x1e,0xff,0xe3,0xd1,0x3,0x98,0x5,0xb0,0xf0,
+    0xbd,0xff,0xb0,0xb4,0x0,0x22,0x80,0x23,0xdb,0x4,0xff,0x80,0x24,0x24,0x6,0xfc,
+    0x25,0x2d,0x6,0xff,0xf,0x68,0x0,0x2f,0x8,0xd0,0xaf,0x42,0xff,0x1,0xda,0x27,
+    0x0,0x4,0xe0,0x9f,0x42,0xff,0x1,0xdb,0xe7,0x43,0x0,0xe0,0x7f,0x1,0xff,0x7,
+    0x60,0x52,0x1c,0x9,0x1d,0x0,0x1d,0xdf,0x3,0x2a,0xed,0xdb,0xb0,0xa7,0x0,0x1c,
+    0xb5,0xff,0x4,0x0,0x0,0x20,0x1,0x90,0x6a,0x46,0xff,0x10,0x70,0x1,0xa8,0x2,
+    0xf0,0x5b,0xfa,0xff,0x1,0x98,0x80,0x0,0x6a,0x46,0x0,0x21,0xff,0x51,0x56,0xfc,
+    0xf7,0x8c,0xfb,0x80,0x10,0xff,0x20,0x60,0x20,0x0,0x16,0xbd,0xf8,0xb5,0xff,0x7,
+    0x0,0xc,0x0,0x38,0x68,0x41,0x10,0xff,0xc0,0x7,0x0,0xd5,0x49,0x1c,0x20,0x68,
+    0xff,0x45,0x10,0xc8,0x17,0x41,0x40,0x8,0x1a,0xff,0xfc,0xf7,0xef,0xfa,0x6,0x0,
+    0xe8,0x17,0xff,0x45,0x40,0x28,0x1a,0x5,0x25,0xfc,0xf7,0xff,0xe8,0xfa,0x28,0x1a,
+    0x6,0x21,0x89,0x1b,0xff,0x88,0x42,0x0,0xda,0x8,0x0,0x6,0x0,0xff,0x4,0x20,
+    0x81,0x1b,0x38,0x68,0xfa,0xf7,0xdf,0x5d,0xf8,0x5,0x0,0x3,0xb,0x0,0x20,0x68,
+    0xff,0x2,0xf0,0xb8,0xfa,0x1,0x0,0x28,0x0,0xff,0xfc,0xf7,0xd8,0xfb,0xf2,0xbd,
+    0x80,0xb5,0xff,0x2,0xf0,0xc2,0xfa,0x1e,0x21,0xfe,0xf7,0xff,0x71,0xfe,0xff,0xf7,
+    0x65,0xfc,0x0,0x23,0xf7,0x0,0x22,0x18,0xd,0x0,0x32,0xfe,0x2,0xbd,0xff,0xf0,
+    0xb5,0x85,0xb0,0x69,0x46,0x5,0x22,0xff,0x3,0x68,0x5b,0x10,0xb,0x60,0x0,0x1d,
+    0xff,0x9,0x1d,0x52,0x1e,0xf8,0xd1,0x0,0x26,0xfd,0x0,0x2d,0x5,0x6a,0x46,0x5,
+    0x23,0x4,0x0,0xf7,0xd,0x0,0x10,0x2d,0x1,0x0,0x19,0x69,0x41,0xff,0x12,0x1d,
+    0x5b,0x1e,0xf6,0xd1,0xcc,0x17,0xff,0xcd,0x17,0x5,0x22,0x60,0x40,0x69,0x40,0xff,
+    0x2b,0x0,0x0,0x1b,0x99,0x41,0xfb,0xf7,0xbf,0x73,0xfc,0x60,0x40,0x0,0x1b,0x2f,
+    0x2,0x13,0xff,0x68,0x1b,0x1a,0x13,0x60,0x49,0x1c,0x12,0xff,0x1d,0x5,0x29,0xf8,
+    0xdb,0x6c,0x46,0x5,0xff,0x25,0x20,0x68,0x40,0x10,0xc1,0x17,0x2,0xff,0x0,0xb,
+    0x0,0xfa,0xf7,0x2d,0xff,0x80,0x7f,0x19,0x79,0x41,0x6,0x0,0xf,0x0,0x69,0x3,
+    0xff,0xf1,0xd1,0xf6,0xe,0x78,0x1,0x6,0x43,0xdf,0xff,0x16,0xfc,0x17,0xfd,0x51,
+    0x0,0x66,0x40,0xff,0x6f,0x40,0x29,0x0,0x36,0x1b,0x8f,0x41,0x7f,0x30,0x0,0x39,
+    0x0,0xfb,0xf7,0x48,0x55,0x4,0xba,0x7b,0x3,0xf8,0x43,0x1,0x15,0x0,0x8,0x85,
+    0x0,0xc9,0xff,0x5,0x42,0xa,0x11,0x43,0xc0,0x5,0x2b,0xff,0x68,0x0,0x2b,0x1,
+    0xd1,0xa,0x48,0x10,0xff,0xe0,0xce,0x17,0xcf,0x17,0xda,0x17,0x53,0xff,0x40,0x9a,
+    0x1a,0x70,0x40,0x79,0x40,0x3b,0xfb,0x0,0x80,0x91,0x4,0x2a,0xfc,0x29,0x68,0xc9,
+    0x7f,0x17,0x71,0x40,0x48,0x40,0x40,0x1a,0x5f,0x3,0xff,0xf2,0xbd,0xff,0xff,0xff,
+    0x7f,0x0,0x68,0xdf,0x9,0x68,0x8a,0x15,0x90,0xb3,0x1,0x1,0x20,0xd7,0x70,0x47,
+    0x82,0x7,0x0,0x0,0x7,0x0,0x88,0x2,0xff,0x80,0xa,0x40,0x1e,0x80,0x41,0xc0,
+    0x43,0xff,0xc0,0xf,0x70,0x47,0xf4,0x46,0xb,0x46,0xff,0x0,0xf0,0x2,0xf8,0x19,
+    0x60,0x60,0x47,0xff,0x41,0x0,0x9,0xe,0x6,0xd0,0xff,0x29,0xff,0x3,0xd0,0x7e,
+    0x39,0xca,0x5,0x80,0x1a,0xff,0x70,0x47,0x0,0x21,0x70,0x47,0xfd,0xb5,0xff,0x90,
+    0xb0,0x6,0xac,0x3,0x27,0xe,0x0,0xff,0x3,0x25,0x1b,0x21,0x30,0x68,0xfe,0xf7,
+    0x7f,0xc5,0xfd,0x20,0x60,0x24,0x1d,0x36,0xd3,0x0,0xdf,0xf6,0xd1,0x31,0x0,0x7f,
+    0xd9,0x0,0x11,0x9e,0x7f,0x3,0xac,0x3,0x25,0x30,0x68,0x1b,0x67,0x1,0xfd,0xb6,
+    0x1d,0x10,0x6a,0x46,0x3,0xa9,0x6,0xa8,0xff,0xfc,0xf7,0xc,0xfe,0x6e,0x46,0x10,
+    0x9d,0xbf,0x3,0x24,0x1,0x23,0x1,0x22,0x43,0x6,0x6b,0xef,0xfd,0x28,0x60,0x2d,
+    0x25,0x0,0x64,0x1e,0xf4,0xff,0xd1,0x12,0x98,0x0,0x28,0x2,0xd0,0x0,0xff,0x20,
+    0x12,0x99,0x8,0x60,0x10,0x98,0x13,0xfe,0x1,0x1,0x1,0x0,0x80,0x10,0x89,0x7,
+    0x0,0xff,0xd5,0x40,0x1c,0x70,0x47,0x10,0xb4,0x2,0xff,0x0,0x80,0xe,0x8c,0x1,
+    0x20,0x43,0x89,0x7f,0x16,0x80,0x24,0xa4,0x4,0x14,0x40,0x2b,0x0,0xff,0x22,0x40,
+    0x1c,0x51,0x41,0x10,0xbc,0x70,0xff,0x47,0xf9,0xb5,0xe5,0xb0,0x13,0xab,0x9,0xff,
+    0x20,0x9,0x24,0x9,0x25,0xe,0x68,0x1e,0xef,0x60,0x9,0x1d,0x1b,0x79,0x0,0xf9,
+    0xd1,0x64,0xfe,0x7d,0x0,0xa,0xa9,0x13,0x68,0xb,0x60,0x12,0x7a,0xe5,0x1,0x40,
+    0x11,0x0,0x6b,0x46,0x1,0xaa,0x11,0x0,0xfe,0x8d,0x0,0x55,0xfe,0x0,0x22,0x65,
+    0x9b,0x1,0xff,0xac,0xcf,0x25,0x2d,0x6,0xe,0x4e,0x9e,0xff,0x27,0xff,0x5,0x20,
+    0x68,0x39,0x0,0x0,0xff,0xf0,0xf,0xfa,0x1,0xd8,0x38,0x0,0x4,0xff,0xe0,0x31,
+    0x0,0xff,0xf7,0x37,0xfe,0x0,0xff,0xd2,0x28,0x0,0x18,0x60,0x52,0x1c,0x24,0xbe,
+    0x51,0x0,0x9,0x2a,0xed,0xdb,0x66,0xa5,0x6,0x98,0xdd,0x66,0xa5,0x0,0x65,0x98,
+    0x67,0xa5,0x0,0xfe,0xff,0xff,0xff,0xce,0x1,0x22,0xd2,0x5,0x1,0x18,0xdf,0x25,
+    0xd2,0x9,0xe,0x22,0x39,0x1,0x20,0xd0,0xff,0xcb,0x5,0x98,0x43,0x10,0x43,0x7d,
+    0x31,0xff,0x49,0x8,0x0,0xd3,0x0,0x18,0x93,0x18,0xff,0xc0,0x1a,0x80,0x0,0x9b,
+    0x18,0x80,0x1a,0xff,0x6,0xd4,0x52,0x8,0xe,0xd2,0xc0,0x1a,0xf7,0x9b,0x18,0x0,
+    0xd,0x0,0xf8,0xd5,0x52,0x8,0xbf,0x6,0xd2,0xc0,0x18,0x9b,0x1a,0xd,0x2,0xf1,
+    0xfe,0xd,0x0,0xf8,0xd3,0x5b,0x1e,0xc9,0x5,0x58,0xff,0x8,0x48,0x41,0x70,0x47,
+    0xd0,0x42,0xfc,0xff,0xd8,0x8,0xe,0xfa,0xd0,0xc0,0x43,0x1,0xff,0xb5,0x2,0xf0,
+    0xb8,0xf9,0x1,0xbd,0x30,0xdf,0xb4,0x5,0x0,0x4d,0x40,0x6b,0x0,0x7,0x15,0xff,
+    0x40,0x4b,0x18,0x4,0x18,0x24,0xe,0x2e,0xff,0xd0,0x1b,0xe,0x32,0xd0,0xff,0x2c,
+    0x34,0xff,0xd0,0xff,0x2b,0x3a,0xd0,0xe4,0x18,0x0,0xff,0x2,0x9,0x2,0x10,0x43,
+    0x11,0x43,0x0,0xff,0xa,0x9,0xa,0x94,0x46,0xc2,0xb2,0x4a,0xee,0x9,0x0,0xc3,
+    0xb2,0x4b,0x5,0x0,0x48,0x43,0x11,0xff,0xa,0x5b,0x18,0x1a,0x43,0xd2,0xb2,0x19,
+    0xff,0xa,0x9,0x18,0x1,0xd4,0x49,0x18,0x64,0xff,0x1e,0x8,0xa,0x7f,0x3c,0x23,
+    0xdb,0xfe,0xff,0x2c,0x8,0xda,0xe4,0x5,0x9,0x6,0x11,0xff,0x43,0x63,0x46,0x99,
+    0x41,0x60,0x41,0x28,0xfb,0x43,0x30,0x51,0x1,0xff,0x20,0xc0,0x5,0xf9,0xff,0xe7,
+    0x28,0x0,0x1b,0xe,0xff,0x2b,0xf6,0xef,0xd1,0xd0,0x43,0xf4,0xb,0x0,0xff,0x2c,
+    0xf1,0xff,0xd1,0xf9,0xe7,0x40,0x2,0xf7,0xd1,0xff,0xff,0x2b,0x1,0xd1,0x49,0x2,
+    0xf3,0xd1,0xe0,0xff,0x5,0xe7,0xe7,0xd8,0x5,0x49,0x2,0xe4,0xff,0xd0,0xed,0xe7,
+    0x43,0x2,0x0,0x20,0x64,0xff,0x1c,0xdf,0xd1,0x5b,0x12,0x9b,0x1c,0xdc,0xff,0xd9,
+    0xd8,0x5,0xda,0xe7,0x0,0x0,0xf5,0xff,0xb5,0x85,0xb0,0xc,0x0,0x1,0x94,0x5,
+    0xff,0x98,0x40,0x0,0x0,0xe,0xff,0x28,0x7,0xf7,0xd1,0x0,0x27,0xb,0x0,0x2,
+    0x1,0xd0,0x2,0xff,0x26,0x16,0xe0,0x1,0x26,0x14,0xe0,0x1,0xff,0x28,0x7,0xda,
+    0x5,0xa8,0x2,0xf0,0x4e,0xff,0xf9,0x1,0x28,0x2,0xdb,0x0,0x26,0x0,0xff,0x27,
+    0xa,0xe0,0x5,0x99,0x9c,0x4a,0xa,0xff,0x40,0xfc,0x21,0x89,0x5,0x11,0x43,0x5,
+    0xff,0x91,0x7e,0x38,0x7,0x0,0x0,0x26,0xf6,0xef,0x43,0x0,0x21,0x1,0x27,0x0,
+    0x4f,0xf9,0x5,0xfb,0x0,0x6,0x83,0x7,0x20,0x6,0x99,0x8,0x80,0xff,0x0,0x2d,
+    0x4,0xd1,0x20,0x0,0x0,0x21,0xff,0xff,0xf7,0x75,0xfd,0x11,0xd0,0x0,0x2e,0xff,
+    0x12,0xd5,0x3f,0xb2,0x1,0x2f,0x13,0xd1,0xfb,0x5,0x98,0x3f,0x2,0xff,0xf7,0x6a,
+    0xfd,0x6,0xff,0xd0,0x1,0x2d,0xb,0xd1,0xbf,0x21,0x9,0xff,0x6,0xff,0xf7,0x63,
+    0xfd,0x2c,0xd1,0xfe,0xff,0x20,0x80,0x5,0x5,0xe1,0x2,0x2e,0x3,0xfe,0x23,0x0,
+    0x1,0xe1,0x1,0x2d,0x54,0xdb,0x2,0xfb,0x2d,0x1,0x43,0x0,0xfb,0xe0,0x1,0x2e,
+    0x1b,0xfc,0x13,0x0,0x5b,0x0,0xd4,0x0,0x2c,0x46,0xd5,0x31,0xff,0xe0,0x0,0x2c,
+    0x9,0xd4,0x0,0x2d,0x41,0xdf,0xd1,0x0,0x21,0xc9,0x43,0x7b,0x2,0x11,0xf9,0xff,
+    0x0,0x28,0x3a,0xd5,0x37,0xe0,0x0,0x2d,0xf5,0x23,0x13,0xc,0x7,0x13,0x0,0x1c,
+    0xd5,0x18,0xe0,0xff,0x1,0x2d,0x8,0xd1,0x3f,0xb2,0x0,0x2c,0xff,0x2,0xd4,0x1,
+    0x2f,0x28,0xda,0x13,0xe0,0x5f,0x1,0x2f,0x11,0xda,0x24,0x41,0x0,0x10,0x41,0x0,
+    0xfd,0xc,0x2d,0xc,0xf0,0xf8,0x0,0x28,0x5,0xd5,0xfe,0x63,0x4,0xd5,0x80,0x20,
+    0x0,0x6,0xc1,0xe0,0xff,0x0,0x20,0xbf,0xe0,0x0,0xf0,0xa7,0xff,0x9f,0x22,0x21,
+    0x1,0x60,0x0,0xa7,0x0,0x29,0xa,0xdb,0xfa,0x29,0x0,0x4,0x29,0x4,0x1,0xd5,
+    0x5a,0x48,0xad,0xed,0xe0,0x8f,0x3,0xaa,0xe0,0xf,0x2,0x7,0xd5,0x0,0xff,0x2d,
+    0x5,0xd5,0x0,0xf0,0x8d,0xff,0x21,0xfe,0x33,0x0,0x54,0x48,0x9f,0xe0,0x0,0x21,
+    0x0,0xff,0xf0,0xb4,0xf8,0x1,0xd2,0x0,0x25,0x9,0x7b,0xe0,0x80,0xe7,0x0,0x48,
+    0x40,0x5,0x90,0x47,0xa,0xff,0xb7,0xf8,0x5,0x0,0x5,0x98,0x4b,0x49,0xff,0xff,
+    0xf7,0xd1,0xfc,0x6,0xd2,0x1,0x46,0xfd,0x80,0x47,0x0,0xff,0xf7,0xda,0xfe,0x5,
+    0x90,0xff,0x7f,0x1e,0x5,0x99,0x46,0x48,0xff,0xf7,0xbf,0x35,0xfc,0x6,0x0,0x5,
+    0x99,0x15,0x3,0xff,0xff,0xf7,0x2f,0xfc,0x1,0x0,0x30,0x0,0x0,0xff,0xf0,0xc9,
+    0xf9,0x2,0x90,0x1,0x46,0xff,0xff,0xf7,0xc6,0xfe,0x3,0x90,0x5,0x96,0x3,0xff,
+    0x98,0x2,0xf0,0xbe,0xf8,0x3,0x99,0xff,0xef,0xf7,0xbe,0xfe,0x5,0x5,0x0,0x54,
+    0xfc,0x2,0xee,0x5,0x0,0xb8,0xfe,0x1,0x59,0x0,0xff,0xf7,0x15,0xff,0xfc,0x2,
+    0x90,0x38,0xb2,0x1,0xf0,0x6d,0xff,0xfd,0x6,0x0,0x2,0x98,0x33,0x49,0x0,0xff,
+    0xf0,0xaa,0xf9,0x31,0x0,0xff,0xf7,0x9,0xef,0xfc,0x1,0x90,0x21,0x7,0x0,0xa4,
+    0xfe,0x0,0xfb,0x90,0xc7,0x7d,0x5,0x90,0xfc,0x3a,0xd3,0x2c,0xde,0x1f,0x0,0x5e,
+    0xf8,0x38,0xd9,0xb1,0x3,0x88,0xfc,0xdf,0x1,0x46,0x2,0xd2,0xbf,0x7,0x1,0x1,
+    0xe0,0xfd,0xfc,0x7f,0x4,0xef,0xfb,0x1,0xf0,0x65,0xfd,0xf9,0x7,0x83,0x0,0x39,
+    0x2,0x87,0xfe,0x6,0x0,0x38,0xdf,0x0,0x1,0xf0,0x40,0xfd,0x95,0x2,0xff,0xf7,
+    0xd7,0x18,0xfc,0x1b,0xc7,0x0,0x7c,0x15,0x0,0x2,0x98,0xf6,0x1f,0x2,0x77,0xfe,
+    0x67,0x2,0xd5,0xfb,0x0,0x90,0xfd,0x6,0x27,0x3,0xd0,0x7,0x80,0x0,0x27,0x3a,
+    0xfb,0x0,0xfe,0xf7,0x1,0x68,0x46,0x2,0xf0,0x7d,0xae,0x41,0x1,0x2,0xd0,0x1,
+    0x3,0x0,0x8,0x65,0x1,0x1,0x7e,0x41,0x5,0x0,0x90,0x0,0xf0,0xf1,0xfe,0x6b,
+    0x7,0xef,0x0,0x98,0x2,0xd0,0x2d,0x7,0x7,0xb0,0xf0,0xff,0xbd,0x0,0x0,0xff,
+    0xff,0x7f,0x80,0x0,0xf7,0x0,0x80,0xff,0x0,0x0,0x7f,0xf3,0x4,0x35,0xfd,0x3f,
+    0xb,0x0,0xbf,0x18,0x72,0x31,0x3f,0x1,0xff,0x0,0x0,0x47,0x80,0xb5,0x0,0x22,
+    0xff,0xef,0xf7,0x98,0xfe,0x2,0x27,0x0,0xc,0xb4,0x1,0xff,0x22,0x12,0x6,0x3,
+    0x18,0xda,0x42,0x7,0xfb,0xd8,0x4b,0x5,0x0,0x4,0xd8,0x2,0x0,0xa,0xff,0x43,
+    0x92,0x18,0x2,0xd2,0x81,0x42,0xc,0xbf,0xbc,0x70,0x47,0xfc,0xd0,0x88,0x7,0x4,
+    0x1,0xff,0x0,0x40,0x10,0xc9,0x7,0x0,0xd5,0x40,0xff,0x1c,0x70,0x47,0xf5,0xb5,
+    0x83,0xb0,0xe,0xff,0x0,0x0,0x27,0x2,0x90,0x0,0x20,0x0,0xff,0x21,0x4,0x9c,
+    0x3,0x25,0x0,0x90,0x1,0xff,0x91,0x30,0x68,0xc1,0x17,0x22,0x68,0xd3,0xff,0x17,
+    0xfa,0xf7,0x1b,0xfc,0x0,0x9a,0x1,0xff,0x9b,0x80,0x18,0x59,0x41,0xc,0x36,0x24,
+    0xff,0x1d,0x6d,0x1e,0xef,0xd1,0xc2,0xf,0x4c,0xff,0x0,0x22,0x43,0x80,0x24,0xe4,
+    0x5,0x4,0xff,0x40,0x0,0xd0,0x52,0x1c,0x2,0x98,0x2,0xfb,0x60,0x7f,0x5,0x0,
+    0x0,0x1d,0x2,0x90,0x20,0xff,0x3e,0x3,0x2f,0xda,0xdb,0x3,0x98,0x5,0xac,0xb7,
+    0x0,0x9d,0x0,0x11,0x9,0x65,0x8,0xf0,0x65,0x0,0x0,0xff,0x21,0x1,0x91,0x0,
+    0x26,0x0,0x27,0x4,0xff,0x0,0x3,0x25,0x20,0x68,0x40,0x10,0xc1,0xff,0x17,0x2,
+    0x0,0xb,0x0,0xfa,0xf7,0xea,0xff,0xfb,0x80,0x19,0x79,0x41,0x6,0x0,0xf,0xfd,
+    0x0,0x5f,0x2,0xf1,0xd1,0x2,0x20,0x0,0x90,0xff,0x32,0x0,0x3b,0x0,0x1,0xa8,
+    0x2,0xf0,0xdf,0xf8,0xf8,0x1,0x98,0x3,0x3,0x5,0xbd,0x22,0xff,0x9,0x42,0xa,
+    0xd5,0x0,0x23,0x49,0x42,0xff,0x40,0x42,0x99,0x41,0x73,0x46,0x0,0xf0,0xff,0x6,
+    0xf8,0x1,0x22,0xd2,0x7,0x10,0x43,0xfb,0x18,0x47,0x1b,0x2,0x10,0xd0,0x3,0xd4,
+    0x52,0xff,0x1e,0x0,0x18,0x49,0x41,0xfb,0xd5,0xd2,0xff,0x5,0x1,0x28,0x80,0x41,
+    0x40,0x1c,0x1,0xff,0x43,0x8,0xa,0x9,0x6,0x49,0x41,0x0,0xff,0xd3,0x1,0x29,
+    0x50,0x41,0x70,0x47,0x8,0xff,0xb5,0x1,0xf0,0x73,0xfc,0x8,0xbd,0x9,0xff,0x42,
+    0x14,0xd4,0x42,0x0,0x12,0xe,0x6,0xff,0xd0,0xff,0x2a,0x4,0xd0,0x52,0x18,0xff,
+    0xff,0x2a,0x2,0xd2,0xc9,0x5,0x40,0x18,0x70,0xff,0x47,0xff,0x22,0xc0,0xd,0x10,
+    0x43,0xc0,0xbf,0x5,0x1,0xb5,0x0,0xf0,0x2a,0x8d,0x5,0x1,0xd7,0xbd,0x49,0x42,
+    0x2b,0x2,0xf0,0x2b,0x0,0xee,0xd0,0xaf,0x8a,0x42,0x2,0xd9,0x29,0x0,0x1a,0x4b,
+    0x0,0xd1,0xff,0x42,0x2,0x52,0x12,0xc0,0xf,0xc0,0x7,0xff,0x92,0x1c,0xe7,0xd9,
+    0xd2,0x5,0x10,0x43,0xfb,0xe4,0xe7,0xd,0x2,0xe1,0xe7,0x30,0xb4,0x3,0xff,0x23,
+    0x3,0x24,0x5,0x68,0xd,0x60,0x0,0xff,0x1d,0x9,0x1d,0x64,0x1e,0xf9,0xd1,0x5b,
+    0xef,0x1e,0xf6,0xd1,0x30,0x77,0x1,0x60,0xb4,0x2,0xff,0x0,0x3,0x23,0x0,0x25,
+    0xe,0x68,0x16,0xff,0x60,0x6d,0x1c,0x9,0x1d,0x12,0x1d,0x3,0xff,0x2d,0xf8,0xdb,
+    0x5b,0x1e,0xf5,0xd1,0x60,0xfe,0x1d,0x0,0xf2,0xb5,0x7,0x0,0x15,0x0,0x3e,0xff,
+    0x0,0x3,0x24,0x2a,0x0,0x0,0x99,0x30,0xff,0x0,0x2,0xf0,0xa7,0xf8,0xc,0x36,
+    0xc,0xfb,0x35,0x64,0x3d,0x0,0x38,0x0,0xf2,0xbd,0x81,0xbf,0x42,0x0,0xd1,0x70,
+    0x47,0x70,0x43,0x4,0x70,0xff,0xc9,0x70,0xc2,0x5b,0x1e,0xfb,0xd1,0x70,0xfe,0x37,
+    0x0,0x9,0x68,0x1,0x60,0x11,0x68,0x41,0xff,0x60,0x19,0x68,0x81,0x60,0x70,0x47,
+    0xf9,0xff,0xb5,0x8f,0xb0,0x8,0x0,0x14,0x0,0x6,0xff,0xa9,0xff,0xf7,0xba,0xff,
+    0x3,0xa8,0x3,0xff,0x21,0x22,0x68,0x2,0x60,0x24,0x1d,0x0,0xfb,0x1d,0x49,0x89,
+    0x0,0x6a,0x46,0x3,0xa9,0x6,0xff,0xa8,0xfc,0xf7,0x94,0xfa,0x0,0x22,0xf,0xff,
+    0x9b,0x6c,0x46,0xcf,0x25,0x2d,0x6,0xf,0xff,0x4e,0x9e,0x27,0xff,0x5,0x20,0x68,
+    0x39,0xff,0x0,0xff,0xf7,0xde,0xfe,0x1,0xd8,0x38,0xef,0x0,0x4,0xe0,0x31,0xb,
+    0x0,0x6,0xfb,0x0,0xff,0xd2,0x28,0x0,0x18,0x60,0x52,0x1c,0x24,0xff,0x1d,0x1b,
+    0x1d,0x3,0x2a,0xed,0xdb,0x10,0xff,0x98,0x0,0x28,0x2,0xd0,0x0,0x20,0x10,0xbf,
+    0x99,0x8,0x60,0xf,0x98,0x11,0x97,0x3,0xbf,0xff,0xfe,0xff,0xff,0xce,0x30,0xb4,
+    0x5,0x0,0xfb,0x4d,0x40,0x8d,0x3,0x15,0x40,0x4b,0x18,0x4,0xff,0x18,0x24,0xe,
+    0x28,0xd0,0x1b,0xe,0x2f,0xff,0xd0,0xff,0x2c,0x34,0xd0,0xff,0x2b,0x37,0xff,0xd0,
+    0xe4,0x1a,0x0,0x2,0x9,0x2,0x10,0xff,0x43,0x11,0x43,0x43,0x8,0x48,0x8,0xd1,
+    0xff,0xd,0x1b,0x1a,0x2,0xd2,0x64,0x1e,0xdb,0xff,0x18,0x1b,0x18,0xdb,0x18,0x83,
+    0x42,0x0,0xff,0xd3,0x1b,0x1a,0x49,0x41,0xf9,0xd3,0x7f,0xff,0x34,0x26,0xdd,0xfe,
+    0x2c,0x8,0xda,0xe4,0xff,0x5,0x48,0x8,0xc9,0x7,0x19,0x43,0x91,0xdf,0x41,0x60,
+    0x41,0x28,0x43,0x37,0x3,0xff,0x20,0xff,0xc0,0x5,0xf9,0xe7,0x28,0x0,0x1b,0xe,
+    0xfd,0x3,0x4f,0x0,0xf5,0xd1,0x49,0x2,0xf3,0xd0,0xff,0xd0,0x43,0xf1,0xe7,0xff,
+    0x2c,0x1,0xd1,0xef,0x40,0x2,0xf9,0xd1,0x1f,0x2,0xe9,0xe7,0x40,0xff,0x2,0xf4,
+    0xd1,0xff,0x2b,0xf8,0xd1,0xf1,0xfe,0x29,0x0,0x49,0x2,0xe2,0xd0,0xed,0xe7,0xb,
+    0xff,0x2,0x0,0x20,0x24,0x42,0xdc,0xd1,0x5b,0xff,0x12,0x9b,0x1c,0xd9,0xd9,0xd8,
+    0x5,0xd7,0xff,0xe7,0x0,0x0,0xf1,0xb5,0x8,0x68,0xc1,0xff,0x17,0x12,0x68,0xd3,
+    0x17,0xfa,0xf7,0xad,0xff,0xfa,0x42,0xd,0xcc,0x2,0x22,0x43,0x4b,0xff,0x15,0xe,
+    0xa4,0x30,0xcc,0xab,0x42,0x4,0xff,0xdc,0x1,0xdb,0xa2,0x42,0x1,0xd2,0x22,0xff,
+    0x46,0xf,0xe0,0x0,0x27,0xbb,0x42,0xb,0xfe,0xf,0x4,0x8,0xd2,0xe6,0x43,0xbb,
+    0x42,0x6,0xff,0xdb,0x1,0xdc,0xb2,0x42,0x3,0xd3,0xec,0xff,0xa,0x4,0x40,0x0,
+    0xd0,0x6a,0x8,0x0,0xff,0x98,0x2,0x60,0x0,0x98,0xf2,0xbd,0x0,0xef,0x0,0x0,
+    0x80,0xff,0x0,0x0,0xf1,0xb4,0x3,0xff,0xc9,0x2,0xf,0xc,0x1,0x22,0x43,0xb,
+    0x8d,0x17,0x4d,0x4e,0x2c,0x9,0x4d,0x14,0xeb,0x0,0x4f,0xa,0x88,0xff,0x42,0x0,
+    0xdb,0x8,0x0,0x70,0x47,0xf8,0xff,0xb5,0x90,0xb0,0x7,0x0,0xb,0x68,0x4c,0xff,
+    0x68,0x88,0x68,0x40,0x10,0x61,0x10,0x5b,0xff,0x10,0x5,0x93,0x6,0x91,0x7,0x90,
+    0x0,0xff,0x20,0x5,0xa9,0xb,0x68,0x14,0x68,0x64,0xff,0x10,0x1b,0x19,0xb,0x60,
+    0x40,0x1c,0x9,0xff,0x1d,0x12,0x1d,0x3,0x28,0xf5,0xdb,0x8,0xbf,0xac,0x5,0xad,
+    0x3,0x26,0x28,0xe3,0x0,0x10,0xfd,0x9a,0xe3,0x2,0x3b,0xfa,0xc0,0xf,0x4a,0x0,
+    0xff,0x10,0x43,0x20,0x60,0x2d,0x1d,0x24,0x1d,0xff,0x76,0x1e,0xf1,0xd1,0x8,0x98,
+    0x4,0x90,0xff,0x9,0x98,0x3,0x90,0xa,0x98,0x2,0x90,0xff,0x80,0x20,0x80,0x4,
+    0x1,0x90,0x2,0xa8,0xff,0x0,0x90,0x3,0xab,0x4,0xaa,0x1,0xa9,0xff,0xb,0xa8,
+    0x1,0xf0,0x8f,0xff,0xb,0xaa,0xff,0x39,0x0,0x38,0x0,0x1,0xf0,0x96,0xff,0xbf,
+    0x38,0x0,0xf9,0xf7,0x4,0xfb,0xe9,0x3,0x10,0xff,0xb4,0x0,0x23,0x0,0x24,0x9,
+    0x68,0x0,0xbf,0x29,0x0,0xd0,0xb,0x0,0x11,0x7,0x4,0x8c,0xff,0x10,0x19,0x19,
+    0x1,0x60,0x6,0xd4,0x0,0xff,0x2b,0xa,0xd5,0x0,0x2c,0x8,0xd5,0x80,0xff,0x21,
+    0x9,0x6,0x4,0xe0,0x0,0x2b,0x3,0xff,0xd4,0x0,0x2c,0x1,0xd4,0x2,0x49,0x1,
+    0x2b,0x60,0x10,0xd1,0x2,0xbf,0xce,0x0,0x7f,0xcf,0xa,0x7f,0x13,0xff,0xed,0xf9,
+    0x82,0xf,0x8c,0x0,0x22,0x43,0xed,0x8b,0x31,0x51,0xac,0x8,0x7f,0x27,0x0,0x68,
+    0x9,0xff,0x68,0x8a,0x10,0x90,0x42,0x1,0xda,0x1,0xaf,0x20,0x70,0x47,0x82,0x7,
+    0x0,0x0,0x7,0x0,0x88,0xff,0x7,0x80,0xf,0x40,0x1e,0x80,0x41,0xc0,0xff,0x43,
+    0xc0,0xf,0x70,0x47,0xf7,0xb5,0x82,0xff,0xb0,0x7f,0x26,0x1,0x2a,0x20,0xdb,0x1,
+    0xff,0x46,0x80,0x20,0x0,0x6,0x0,0x25,0xb,0xff,0x68,0x83,0x42,0xa,0xd0,0xdd,
+    0x17,0x6b,0xff,0x40,0x5b,0x1b,0x0,0x25,0x0,0x2b,0x4,0xff,0xd4,0x5b,0x0,0x6d,
+    0x1c,0x20,0x2d,0xf9,0xff,0xdb,0x20,0x25,0xae,0x42,0x0,0xdd,0x2e,0xff,0x0,0x9,
+    0x1d,0x52,0x1e,0xea,0xd1,0x20,0xff,0x2e,0x6,0xd1,0x4,0x98,0x81,0x0,0x3,0xff,
+    0x98,0xf9,0xf7,0xd2,0xfd,0x0,0x20,0x60,0xff,0xe0,0xb6,0x1e,0x70,0xb2,0x1,0xf0,
+    0x37,0xff,0xf8,0xc0,0x7,0x0,0xd5,0x76,0x1e,0x0,0xff,0x22,0x0,0x23,0x4,0x98,
+    0x1,0x28,0x1d,0xff,0xdb,0x2,0x9c,0x5,0x46,0x77,0x42,0x20,0xff,0x68,0x0,0x2e,
+    0x1,0xd4,0xb0,0x40,0x5,0xff,0xe0,0x39,0x0,0x20,0x29,0x1,0xdb,0xc0,0xff,0x17,
+    0x0,0xe0,0x8,0x41,0xc1,0x17,0x0,0xff,0x92,0x1,0x93,0x2,0x0,0xb,0x0,0xfa,
+    0xff,0xf7,0x6f,0xf9,0x0,0x9a,0x1,0x9b,0x80,0xf7,0x18,0x59,0x41,0xf,0x2,0x24,
+    0x1d,0x6d,0x1e,0xdf,0xe4,0xd1,0x10,0x0,0x19,0x75,0x1,0x13,0xf8,0xfb,0x1,0x0,
+    0x97,0x1,0x1,0x81,0x42,0xca,0xdb,0x7f,0x0,0x24,0x1,0x94,0x3,0x22,0x1,0x95,
+    0x1,0xff,0xba,0xff,0x1,0x98,0xa0,0x42,0xc1,0xd0,0xfb,0x0,0x94,0x67,0x2,0x1f,
+    0xdb,0x3,0x9c,0x2,0x5f,0x9d,0x37,0x0,0x18,0x3f,0xe9,0x3,0x1,0xe9,0x5,0x7f,
+    0x46,0xf9,0x0,0x2f,0x3,0xd4,0x3a,0x41,0x0,0xff,0x1b,0xf8,0x6,0xe0,0x7a,0x42,
+    0x40,0x2a,0xff,0x1,0xdb,0xc8,0x17,0x1,0xe0,0x1,0xf0,0xf7,0x25,0xf8,0x20,0x2b,
+    0x1,0x40,0x1c,0x0,0x90,0xff,0x2d,0x1d,0x24,0x1d,0x4,0x99,0x88,0x42,0xdf,0xe1,
+    0xdb,0x1,0x20,0x5,0xd5,0x1,0x9,0x68,0xff,0x49,0x10,0x12,0x68,0x52,0x10,0x89,
+    0x18,0xfb,0x1,0x60,0x9b,0x17,0x1f,0xf9,0x42,0xe,0xcc,0xdf,0x1,0x22,0x43,0x4b,
+    0x16,0x9b,0x4f,0xec,0x9,0xfc,0x9b,0x27,0xfb,0xb,0x10,0xb4,0x1,0x9c,0x9,0x68,
+    0xff,0x1,0x60,0x11,0x68,0x41,0x60,0x19,0x68,0xff,0x81,0x60,0x21,0x68,0xc1,0x60,
+    0x10,0xbc,0xff,0x70,0x47,0xf0,0xb5,0x85,0xb0,0x2,0x0,0x7f,0xd6,0x68,0xf7,0x17,
+    0x2,0xab,0x90,0x81,0x0,0x9f,0x3,0xc3,0x54,0x68,0xe5,0x87,0x4,0x11,0x3,0xfa,
+    0xff,0xf7,0xd9,0xf8,0x0,0x90,0x1,0x91,0x20,0x6b,0x0,0x29,0x66,0x1,0x2b,0xf,
+    0x0,0xd1,0xf8,0x3b,0xb,0xff,0x4,0x0,0xd,0x0,0x2,0xa8,0x3,0xc8,0xff,0x2,
+    0xaa,0xc,0xca,0xfa,0xf7,0xc5,0xf8,0xf7,0x0,0x19,0x69,0x13,0x4,0x30,0x0,0x39,
+    0x0,0xd7,0x32,0x0,0x3b,0x2b,0x0,0xbb,0x13,0x4,0x48,0x10,0xfe,0xed,0x2,0xc1,
+    0x17,0x48,0x40,0x40,0x1a,0x70,0xff,0x47,0xf7,0xb5,0x82,0xb0,0x7f,0x24,0x1,0xff,
+    0x2a,0x1b,0xdb,0x2,0x9d,0x16,0x46,0x0,0xff,0x20,0x80,0x21,0x9,0x6,0x2a,0x68,
+    0x8a,0xff,0x42,0x4,0xd0,0xd0,0x17,0x42,0x40,0x10,0xbf,0x1a,0xfb,0xf7,0xfe,0xfb,
+    0x84,0xfd,0x1,0x4,0xff,0x0,0x2d,0x1d,0x76,0x1e,0xee,0xd1,0x20,0xfd,0x2c,0xfd,
+    0xf,0xd3,0xfc,0x0,0x20,0x4d,0xe0,0xff,0xa4,0x1e,0x60,0xb2,0x1,0x12,0xa,0x0,
+    0xff,0x42,0x40,0x50,0x1a,0xc0,0x7,0x0,0xd5,0xbf,0x64,0x1e,0x0,0x26,0x0,0x27,
+    0x99,0x3,0x16,0x7f,0xdb,0x2,0x98,0x0,0x90,0x4,0x9d,0x3,0x1,0xff,0x68,0x1e,
+    0x20,0x1,0x1b,0xf4,0xf7,0x6c,0xf7,0xfb,0xc1,0x17,0xf3,0x7,0x75,0xf8,0x80,0x19,
+    0xff,0x79,0x41,0x6,0x0,0xf,0x0,0x0,0x98,0xff,0x0,0x1d,0x0,0x90,0x6d,0x1e,
+    0xeb,0xd1,0xdf,0x78,0x10,0x1,0x23,0x3b,0x35,0x1,0x40,0x1c,0xfe,0x85,0x0,0x3,
+    0x88,0x42,0xcf,0xdb,0x0,0x27,0xfb,0x0,0x97,0xf3,0x1,0x0,0x68,0x46,0x1,0xf0,
+    0xff,0xdc,0xfe,0x0,0x98,0xb8,0x42,0xc5,0xd0,0xfe,0x59,0x2,0x11,0xdb,0x2,0x9f,
+    0x3,0x9e,0x5,0xaf,0x46,0x1b,0x3c,0x38,0x23,0x1,0x0,0xf3,0x5,0x4c,0xff,0xf8,
+    0x22,0x0,0x0,0xf0,0xe4,0xfe,0x30,0xff,0x60,0x36,0x1d,0x3f,0x1d,0x6d,0x1e,0xf1,
+    0xfd,0xd1,0xd7,0x7,0xf8,0xb5,0x7,0x0,0xc,0x0,0xff,0x25,0x68,0x38,0x68,0x40,
+    0x10,0xff,0xf7,0xff,0x83,0xff,0xfb,0xf7,0x95,0xfb,0x6,0x0,0xfd,0x68,0xb,0x0,
+    0x7d,0xff,0xf,0x25,0xfb,0xf7,0xff,0x8e,0xfb,0x28,0x1a,0x9,0x21,0x89,0x1b,0xfe,
+    0x99,0x1,0xda,0x8,0x0,0x6,0x0,0x7,0x20,0xff,0x81,0x1b,0x38,0x68,0xf9,0xf7,
+    0x3,0xf9,0xd7,0x5,0x0,0xd,0xb,0x0,0x20,0xb,0x0,0xfd,0xf8,0xff,0x1,0x0,
+    0x28,0x0,0xfb,0xf7,0x7e,0xfc,0xf7,0xf2,0xbd,0xfc,0x4f,0x0,0xe,0x0,0x0,0x20,
+    0xbf,0x0,0x21,0x14,0x0,0x3,0x25,0x8d,0x3,0x30,0xba,0x83,0x0,0x22,0xa1,0x1,
+    0xfa,0xf7,0xa,0x8d,0xd,0x24,0xfb,0x1d,0x36,0x83,0x0,0xef,0xd1,0x3,0xc7,0xf6,
+    0xef,0xbd,0xf4,0xb5,0x4,0x31,0x0,0x1,0x2e,0x1,0xff,0xda,0x0,0x20,0x18,0xe0,
+    0x5,0x25,0x30,0xfe,0x49,0x0,0x53,0xfb,0x29,0x1a,0x1,0x25,0x8,0xff,0x0,0x28,
+    0x40,0xf,0x18,0x4,0x20,0xc1,0xff,0x1b,0x30,0x0,0xf9,0xf7,0xca,0xf8,0x0,0xff,
+    0x99,0xfb,0xf7,0x70,0xfd,0xa9,0x7,0x49,0xfb,0x1b,0x81,0x8d,0x4,0x79,0x10,0xf9,
+    0xf7,0xbf,0xbf,0xf8,0x20,0x60,0x20,0x0,0xf2,0x45,0x14,0x19,0xab,0xe0,0x4,0x45,
+    0x4,0x30,0x45,0x10,0x3,0x45,0x8,0xa7,0xfa,0x45,0x4,0x4d,0x45,0x14,0x89,0x1e,
+    0xf9,0xf7,0x9b,0xfe,0x47,0x8,0x10,0xb4,0x3,0x68,0x14,0x68,0xa3,0xff,0x42,0x5,
+    0xda,0xa,0x68,0x9a,0x42,0x4,0xff,0xda,0x18,0x46,0x10,0xbc,0x70,0x47,0x20,0x7f,
+    0x46,0xfb,0xe7,0x10,0x46,0xf9,0xe7,0xdd,0x2e,0xba,0x41,0x0,0xff,0xdd,0x22,0xf8,
+    0xb5,0x6,0x5f,0x1,0x17,0xef,0x0,0x12,0x25,0x20,0x91,0x0,0xe7,0xfa,0x28,0xff,
+    0x1a,0xc1,0x7,0xc9,0xf,0x45,0x18,0x11,0xef,0x20,0x41,0x1b,0x20,0x8f,0x0,0x5f,
+    0xf8,0x39,0xfe,0x17,0x0,0x8b,0xfd,0x1,0x21,0x6a,0x10,0x89,0xff,0x1a,0xf9,0xf7,
+    0x57,0xf8,0x30,0x60,0x30,0xfe,0x87,0x0,0xf7,0xb5,0x86,0xb0,0x7f,0x26,0x1,0x7f,
+    0x2a,0x20,0xdb,0x1,0x46,0x80,0x20,0x78,0x1,0xff,0x25,0xb,0x68,0x83,0x42,0xa,
+    0xd0,0xdd,0xff,0x17,0x6b,0x40,0x5b,0x1b,0x0,0x25,0x0,0xff,0x2b,0x4,0xd4,0x5b,
+    0x0,0x6d,0x1c,0x20,0xff,0x2d,0xf9,0xdb,0x20,0x25,0xae,0x42,0x0,0xff,0xdd,0x2e,
+    0x0,0x9,0x1d,0x52,0x1e,0xea,0xff,0xd1,0x20,0x2e,0x6,0xd1,0x8,0x98,0x81,0xff,
+    0x0,0x7,0x98,0xf9,0xf7,0x91,0xfb,0x0,0xff,0x20,0x78,0xe0,0xb6,0x1e,0x70,0xb2,
+    0x1,0xff,0x12,0xa,0x0,0x42,0x40,0x50,0x1a,0xc0,0xff,0x7,0x0,0xd5,0x76,0x1e,
+    0x0,0x24,0x0,0xff,0x25,0x8,0x98,0x1,0x28,0x15,0xdb,0x6,0xff,0x98,0x0,0x90,
+    0x8,0x9f,0x31,0x0,0x0,0xfb,0x98,0x0,0xc9,0x1,0x18,0xf8,0xc1,0x17,0x2,0xfb,
+    0x0,0xb,0x97,0x0,0x34,0xff,0x0,0x19,0x69,0xef,0x41,0x4,0x0,0xd,0x19,0x2,
+    0x1d,0x0,0x90,0xff,0x7f,0x1e,0xec,0xd1,0x68,0x10,0x1,0x23,0xff,0x2b,0x40,0x0,
+    0xd0,0x40,0x1c,0x80,0x21,0xbf,0x89,0x1,0x88,0x42,0xd0,0xdb,0x47,0x0,0x94,0xff,
+    0x3,0x22,0x1,0x0,0x68,0x46,0x0,0xf0,0xff,0x18,0xfe,0x0,0x98,0xa0,0x42,0xc6,
+    0xd0,0xfb,0x3,0x94,0x59,0x2,0x3c,0xdb,0x7,0x98,0x2,0xbf,0x90,0x6,0x98,0x1,
+    0x90,0x1,0x59,0x0,0xc1,0xb7,0x17,0x0,0x9a,0x23,0x3,0x9,0xff,0x51,0x2,0x32,
+    0xff,0x0,0x1b,0x3a,0x2,0xd4,0x0,0xf0,0xdc,0xff,0xfd,0x1a,0xe0,0x57,0x42,0x40,
+    0x2f,0x1,0xff,0xdb,0xe8,0x17,0x15,0xe0,0x3a,0x0,0x0,0xff,0xf0,0xe5,0xfd,0x4,
+    0xaa,0x3,0xc2,0x20,0xff,0x0,0x29,0x0,0x7a,0x1e,0x0,0xf0,0xde,0xff,0xfd,0x1,
+    0x22,0x2,0x40,0x6,0xd0,0x4,0xff,0xa8,0x3,0xc8,0x0,0x22,0x40,0x1c,0x51,0xf9,
+    0x41,0x1d,0x2,0xd,0x2,0x2,0x99,0x8,0x60,0x3,0xef,0x98,0x40,0x1c,0x3,0x5d,
+    0x2,0x1d,0x1,0x90,0xfd,0x2,0x5,0x0,0x2,0x90,0x3,0x98,0x8,0x99,0xff,0x88,
+    0x42,0xc6,0xdb,0x1,0x20,0x9,0xb0,0xbf,0xf0,0xbd,0x70,0xb5,0x8c,0xb0,0x6d,0x2,
+    0x11,0xff,0x68,0x53,0x68,0x92,0x68,0x0,0x20,0x8,0xff,0x90,0x9,0x91,0xa,0x93,
+    0xb,0x92,0x6a,0xff,0x68,0x51,0x42,0xab,0x68,0x5a,0x42,0xee,0xff,0x68,0x73,0x42,
+    0x2e,0x68,0x4,0x96,0x5,0xff,0x91,0x6,0x92,0x7,0x93,0x80,0x21,0xc9,0xf7,0x5,
+    0x0,0x91,0x49,0x0,0x90,0x3,0x90,0x8,0xff,0xaa,0x4,0xa9,0x68,0x46,0xf4,0xf7,
+    0xba,0xdf,0xf8,0x2a,0x0,0x69,0x46,0x9,0x2,0xb5,0xf8,0xff,0x2,0x98,0x3,0x99,
+    0x1,0x9a,0x22,0x60,0xff,0x60,0x60,0xa1,0x60,0xc,0xb0,0x70,0xbd,0xff,0xf4,0xb5,
+    0x4,0x0,0xe,0x0,0x1,0x2e,0xff,0x1,0xda,0x0,0x20,0x18,0xe0,0x3,0x25,0xfd,
+    0x30,0xc5,0x1,0xf8,0xf9,0x29,0x1a,0x1,0x25,0xff,0x8,0x0,0x28,0x40,0xf,0x18,
+    0x2,0x20,0xff,0xc1,0x1b,0x30,0x0,0xf8,0xf7,0x6f,0xff,0xff,0x0,0x99,0xfb,0xf7,
+    0x15,0xfc,0xa9,0x7,0xff,0x49,0x1b,0x81,0x42,0x0,0xda,0x8,0x0,0xff,0x79,0x10,
+    0xf8,0xf7,0x64,0xff,0x20,0x60,0xfd,0x20,0xe5,0x1,0xf0,0xb5,0x93,0xb0,0x5,0x0,
+    0xff,0xc,0x0,0x2e,0x68,0xf7,0x17,0x30,0x0,0xf5,0x39,0x19,0x1,0x3b,0x7b,0x1,
+    0x76,0xfe,0xc0,0xf,0xff,0x4a,0x0,0x10,0x43,0x3,0x90,0xa,0xaa,0xed,0x68,0x3b,
+    0x1,0x3,0xc2,0x1b,0x2,0xa,0xaa,0xc,0xaf,0xca,0xf9,0xf7,0x68,0x1b,0x8,0xc,
+    0xa5,0x0,0xa8,0xea,0x1b,0xc,0x8,0x1b,0x4,0x5a,0x1b,0x8,0x5,0x90,0x6,0xab,
+    0xaa,0xe8,0x1b,0xc,0x6,0x1b,0x4,0x4c,0x1b,0x8,0x4,0x53,0x90,0xa,0x3f,0x1,
+    0x4b,0x6,0x42,0x13,0x8,0x2,0x13,0x4,0x9a,0x43,0x6,0x38,0x13,0x8,0x7,0x0,
+    0x13,0x2,0x3b,0x6,0x2e,0xae,0x13,0x8,0x6,0x0,0x8,0x27,0xc,0x24,0x13,0x8,
+    0x1,0x69,0x90,0x13,0x2,0x27,0x6,0x1a,0x7f,0xa,0x0,0x6,0x13,0xc,0xf5,0x10,
+    0x13,0x8,0x0,0x9d,0x1,0x2,0x99,0x40,0x18,0xdf,0x1,0x99,0x40,0x1a,0x0,0x3,
+    0x0,0x40,0x0,0xff,0x20,0x60,0x4,0x99,0x78,0x1a,0x80,0x0,0xff,0x60,0x60,0x5,
+    0x99,0x70,0x18,0x80,0x0,0xff,0xa0,0x60,0x4,0x98,0x3f,0x18,0x10,0x97,0xff,0x1,
+    0x22,0x10,0xa9,0x20,0x0,0xc,0x30,0xaf,0x1,0xf0,0x8f,0xfc,0x33,0x4,0x1a,0x33,
+    0x0,0x18,0xfe,0x33,0x8,0x61,0xc,0x99,0x68,0x1a,0xf,0x90,0xd7,0x1,0x22,0xf,
+    0x23,0x0,0x14,0x23,0x0,0x7d,0xfc,0xff,0x5,0x98,0x36,0x1a,0xe,0x96,0x1,0x22,
+    0xf5,0xe,0x11,0x0,0x18,0x11,0x0,0x74,0xfc,0xc,0x98,0x7f,0x2d,0x18,0xd,0x95,
+    0x1,0x22,0xd,0x11,0x0,0xa5,0x1c,0x11,0x0,0x6b,0x47,0xe,0x7b,0x2,0x18,0x47,
+    0x0,0x62,0xef,0x13,0xb0,0xf0,0xbd,0x8f,0x1,0xd1,0x70,0x47,0xff,0x70,0xb4,0x2,
+    0x0,0x3,0x23,0x70,0xc9,0xff,0x70,0xc2,0x5b,0x1e,0xfb,0xd1,0x70,0xbc,0xff,0x70,
+    0x47,0xf5,0xb5,0x83,0xb0,0xe,0x0,0xff,0x2,0x90,0x3,0x27,0x0,0x20,0x0,0x21,
+    0xff,0x4,0x9c,0x3,0x25,0x0,0x90,0x1,0x91,0xfd,0x30,0x51,0x1,0x22,0x68,0xd3,
+    0x17,0xf9,0xf7,0xff,0xa6,0xfd,0x0,0x9a,0x1,0x9b,0x80,0x18,0xff,0x59,0x41,0xc,
+    0x36,0x24,0x1d,0x6d,0x1e,0xdf,0xef,0xd1,0x80,0xf,0x8a,0x47,0x3,0x99,0x8,0xff,
+    0x60,0x2,0x98,0x0,0x1d,0x2,0x90,0x20,0xff,0x3e,0x7f,0x1e,0xe0,0xd1,0x3,0x98,
+    0x5,0xfe,0x65,0x30,0xf2,0xb5,0x7,0x0,0x15,0x0,0x3e,0xff,0x0,0x3,0x24,0x2a,
+    0x0,0x0,0x99,0x30,0xff,0x0,0x1,0xf0,0x24,0xfc,0xc,0x36,0xc,0xff,0x35,0x64,
+    0x1e,0xf6,0xd1,0x38,0x0,0xf2,0xff,0xbd,0x80,0xb5,0x2,0x48,0xc0,0x46,0xc0,0xff,
+    0x46,0x2,0xbd,0x0,0x0,0x74,0x0,0x0,0xff,0x20,0xf1,0xb5,0x0,0x26,0x0,0x27,
+    0xc,0xff,0x0,0x3,0x25,0x20,0x68,0x40,0x10,0xc1,0xff,0x17,0x2,0x0,0xb,0x0,
+    0xf9,0xf7,0x60,0xff,0xfd,0x80,0x19,0x79,0x41,0x6,0x0,0xf,0xfd,0x0,0x89,0x2,
+    0xf1,0xd1,0x0,0x98,0xc0,0xc0,0xf7,0x8,0x38,0xf2,0x33,0x0,0xf9,0xb5,0x99,0xb0,
+    0xff,0x9,0xab,0x4,0x20,0x4,0x24,0x4,0x25,0x7f,0xe,0x68,0x1e,0x60,0x9,0x1d,
+    0x1b,0x21,0x0,0xfb,0xf9,0xd1,0x5f,0x2,0x5,0xa9,0x13,0x68,0xb,0xbf,0x60,0x12,
+    0x1d,0x9,0x1d,0x40,0x11,0x0,0x6b,0xff,0x46,0x1,0xaa,0x5,0xa9,0x9,0xa8,0xfb,
+    0xff,0xf7,0x4d,0xff,0x0,0x22,0x19,0x9b,0x1,0xff,0xac,0xcf,0x25,0x2d,0x6,0xe,
+    0x4e,0x9e,0xff,0x27,0xff,0x5,0x20,0x68,0x39,0x0,0xff,0xff,0xf7,0xe7,0xf8,0x1,
+    0xd8,0x38,0x0,0x4,0xff,0xe0,0x31,0x0,0xfe,0xf7,0xf,0xfd,0x0,0xff,0xd2,0x28,
+    0x0,0x18,0x60,0x52,0x1c,0x24,0xfe,0x51,0x0,0x4,0x2a,0xed,0xdb,0x1a,0x98,0x0,
+    0xbf,0x28,0x2,0xd0,0x0,0x98,0x1a,0xff,0x0,0x19,0xfb,0x98,0x1b,0xf3,0x0,0xfe,
+    0xff,0xff,0xce,0xf8,0xff,0xb5,0x5,0x0,0xc,0x0,0x20,0x68,0x47,0xfb,0x10,0x28,
+    0xaf,0x0,0xff,0xf7,0x55,0xfc,0xfb,0xbf,0xf7,0x67,0xf8,0x6,0x0,0x38,0x4f,0x0,
+    0x4f,0xff,0xfc,0x5,0x27,0xfb,0xf7,0x60,0xf8,0x38,0xff,0x1a,0xb9,0x1b,0x88,0x42,
+    0x0,0xda,0x8,0xff,0x0,0x3,0x21,0xe,0x1a,0x31,0x0,0x28,0xff,0x68,0xf8,0xf7,
+    0xd6,0xfd,0x5,0x0,0x31,0xfe,0x37,0x0,0xf8,0xf7,0xd1,0xfd,0x1,0x0,0x28,0xdf,
+    0x0,0xfb,0xf7,0x52,0xf9,0xcf,0x2,0xf8,0xb5,0xff,0x4,0x0,0x41,0x0,0x9,0xe,
+    0xff,0x29,0xff,0xd,0xd0,0x0,0x29,0x1,0xd1,0x40,0x2,0xff,0xb,0xd0,0x20,0x0,
+    0x0,0x21,0xfe,0xf7,0xff,0xc6,0xfc,0x8,0xd2,0x80,0x20,0x0,0x6,0xff,0x44,0x40,
+    0x8,0x25,0x4,0xe0,0x40,0x2,0xe9,0xf3,0x17,0x0,0x31,0x0,0x25,0xfd,0x1,0x49,
+    0xfe,0xf7,0xff,0xb7,0xfc,0x12,0xd2,0xfe,0x27,0xbf,0x5,0x77,0x38,0x0,0x21,0xbd,
+    0x0,0x58,0xfc,0x6,0xd4,0x1,0xed,0x39,0x9,0x0,0x1b,0xfc,0xcd,0x2,0xb7,0xfe,
+    0xfe,0xef,0xf7,0x82,0xfe,0x1,0x13,0x0,0x16,0xe0,0x12,0x7e,0x2d,0x0,0xa0,0xfc,
+    0x18,0xd2,0x4f,0x1e,0x2b,0x6,0xd5,0x42,0x2b,0xc,0x5,0x2b,0x4,0xa1,0x2b,0x0,
+    0x6c,0xfe,0xdf,0x2,0x21,0x69,0x40,0xd,0x1f,0x0,0xff,0xf7,0xff,0x98,0xf9,0x29,
+    0x0,0x0,0xf0,0xc5,0xfe,0xff,0xf2,0xbd,0xff,0xf7,0x28,0xff,0x21,0x21,0xff,0x1,
+    0x60,0x2,0x48,0xf2,0xbd,0xf4,0x4,0xff,0x35,0x3f,0x1,0x0,0x80,0x3f,0xff,0xff,
+    0xff,0xff,0x7f,0x0,0xb5,0xa,0x0,0x40,0x12,0xff,0xc1,0x17,0x12,0x68,0xd3,0x17,
+    0xf9,0xf7,0xff,0x8a,0xfc,0x40,0xd,0xca,0x2,0x10,0x43,0xff,0x0,0xbd,0x0,0xb5,
+    0x85,0xb0,0xa,0x0,0xfb,0x0,0x90,0x5e,0x0,0x21,0x2,0xab,0x3,0xc3,0xfb,0x0,
+    0x98,0x23,0xa,0x78,0xfc,0x80,0xf,0x8a,0xfd,0x0,0x23,0x0,0x90,0x0,0x98,0x5,
+    0xb0,0x0,0xff,0xbd,0xf5,0xb5,0x83,0xb0,0xe,0x0,0x0,0xfb,0x27,0x2,0x2b,0x4,
+    0x4,0x9c,0x3,0x25,0x0,0xff,0x90,0x1,0x91,0x30,0x68,0xc1,0x17,0x22,0xfe,0x2f,
+    0x4,0x60,0xfc,0x0,0x9a,0x1,0x9b,0x80,0xbf,0x18,0x59,0x41,0xc,0x36,0x24,0xdf,
+    0x1,0xef,0xff,0xd1,0x82,0xd,0x8c,0x2,0x22,0x43,0x80,0xff,0x24,0xa4,0x3,0x4,
+    0x40,0x0,0xd0,0x52,0xbf,0x1c,0x2,0x98,0x2,0x60,0x7f,0x5,0x0,0x0,0xff,0x1d,
+    0x2,0x90,0x20,0x3e,0x3,0x2f,0xda,0xeb,0xdb,0x3,0x59,0x0,0xf0,0x59,0x8,0x2,
+    0x90,0x3,0xf5,0x27,0x59,0x26,0x33,0x59,0x1c,0x80,0xe,0x8a,0x1,0xe7,0x10,0x43,
+    0x2,0xe5,0x1,0x4d,0xa,0x7f,0x1e,0xe0,0xfd,0xd1,0x4d,0x6,0xf1,0xb5,0x88,0xb0,
+    0xc,0x0,0xff,0x17,0x68,0x50,0x68,0x3,0x90,0x90,0x68,0xff,0x2,0x90,0xa0,0x68,
+    0x0,0x11,0xc1,0x17,0xdb,0x3,0x9a,0x49,0x2,0xe,0xfc,0x39,0x6,0x6,0x0,0xd5,
+    0xe0,0x15,0x4,0x2,0x15,0x4,0x3,0x15,0x8,0x5,0x0,0xdd,0x60,0x15,0x4,0x3a,
+    0x0,0xfb,0x15,0x0,0xf8,0xfb,0x3e,0x15,0x6,0x80,0x19,0x1,0x90,0x40,0x3,0x0,
+    0x31,0x6,0x9a,0x47,0x6,0xea,0x1b,0x8,0x5,0x0,0x5d,0x6,0x47,0x6,0xdf,0xfe,
+    0x15,0x8,0x45,0x1b,0x21,0x0,0x38,0x0,0x1,0xff,0xf0,0xa8,0xfa,0x0,0x11,0x46,
+    0x1b,0x21,0xff,0x1d,0x1,0x98,0x1,0xf0,0xa2,0xfa,0x5,0x5b,0x0,0x20,0x2b,0x4,
+    0x32,0x0,0x2b,0x2,0xc9,0x2b,0x8,0xff,0x0,0x1,0x40,0x19,0x7,0x90,0x80,0x25,
+    0xff,0x2d,0x6,0x0,0x95,0x7,0xa9,0x68,0x46,0xff,0x1,0xf0,0x99,0xfa,0x0,0x98,
+    0x0,0x11,0x4f,0xc0,0x1b,0x4,0x90,0x8d,0x6,0x5b,0x6,0xb1,0x2f,0x8,0x54,0xb9,
+    0xa,0xa3,0x6,0xa6,0x15,0x8,0x86,0x71,0x0,0x3,0x65,0x0,0xfd,0x6f,0x71,0x0,
+    0x80,0x1b,0x0,0x90,0x21,0x0,0xbb,0x8,0x31,0x75,0x2,0x67,0xfa,0x6,0x75,0x8,
+    0x0,0xfa,0x45,0x4,0x8e,0x75,0xc,0x80,0x19,0x6,0x90,0x0,0xeb,0x95,0x6,0x71,
+    0x4,0x60,0x71,0x4,0x3,0x99,0x46,0x55,0x1a,0xcd,0x6,0x3a,0xa1,0x4,0x78,0x2b,
+    0x8,0x7,0x15,0x9,0xaa,0xf9,0x6,0x6d,0x15,0x8,0xc7,0x71,0x0,0x2,0x61,0x0,
+    0x36,0xea,0x71,0x0,0xc0,0x71,0x4,0xc,0x71,0x4,0x2e,0xfa,0x7,0xba,0x71,0x14,
+    0x55,0x71,0xc,0xc0,0x19,0x5,0x71,0x0,0x5,0xfa,0x71,0x4,0x27,0x71,0x4,0x2,
+    0x99,0x40,0x1a,0x4,0xff,0x99,0x8,0x9a,0x11,0x60,0x8,0x99,0x4e,0xae,0x3,0x0,
+    0x88,0x60,0x9,0xbf,0x27,0x12,0x7d,0xa,0x2e,0x1f,0xfb,0x80,0xd,0x8a,0x2,0x5,
+    0x9,0x15,0x0,0x1b,0x7,0x21,0x23,0x15,0x8,0xbf,0x5,0x15,0x0,0x1b,0x7,0x18,
+    0x15,0x8,0xbf,0x11,0x62,0x47,0xc,0xa,0x31,0xc,0x5d,0x6,0x47,0x6,0xff,0xfa,
+    0x15,0x6,0xde,0xbf,0xb,0xe7,0xf9,0x0,0x12,0xbf,0xb,0xe1,0xf9,0x68,0xbf,0x5,
+    0x2b,0x0,0xbf,0x7,0xe9,0x2b,0x8,0x0,0x2,0xbf,0x1b,0x4b,0xb9,0xf9,0xdb,0x0,
+    0x12,0xbf,0x9,0x5b,0xc,0xd1,0x2f,0x8,0x24,0xb9,0xa,0xa3,0x6,0xc6,0x15,0x8,
+    0xbf,0xb,0xae,0x71,0x0,0xbf,0x13,0x23,0xa6,0xf9,0xbf,0x5,0x2f,0x0,0x4d,0x7,
+    0xae,0x75,0xc,0xbf,0x13,0x21,0x80,0x71,0x4,0xbf,0x9,0x5b,0x4,0x2b,0x2,0x98,
+    0x2b,0x8,0xbf,0x5,0x92,0xf9,0xc,0x8d,0x15,0x8,0xbf,0xb,0x75,0x71,0x0,0xbf,
+    0x13,0x6d,0x49,0xf9,0xbf,0x5,0x71,0xc,0x75,0x71,0xc,0xbf,0x13,0x47,0x71,0x4,
+    0xf6,0xbf,0x4b,0x80,0x11,0x7d,0xa,0x4e,0xfa,0x0,0xe,0x11,0xa,0x5,0x9,0x15,
+    0x2,0x1b,0x7,0x43,0x15,0x8,0xbf,0x3,0x15,0x2,0x22,0x1b,0x7,0x38,0x15,0x8,
+    0xbf,0xf,0x47,0xe,0x2a,0x31,0xc,0x5d,0x6,0xf2,0x47,0x6,0x1f,0x15,0x8,0xbf,
+    0xb,0x13,0xf9,0x80,0x11,0xa2,0xbf,0xb,0xd,0xbf,0x5,0x2b,0x2,0xbf,0x7,0x9,
+    0x5d,0xa,0x1,0x7e,0xbf,0x1b,0xd9,0xf8,0x0,0x98,0x80,0x11,0xbf,0x7,0x26,0x5b,
+    0xe,0xf1,0xf9,0xb9,0x16,0xa3,0x6,0xe6,0x15,0x8,0xbf,0xb,0x6f,0xda,0xf8,0x80,
+    0x11,0xbf,0x13,0xd2,0xf8,0xbf,0x3,0xb4,0x2f,0x2,0x4d,0x7,0xce,0x2f,0x8,0x80,
+    0x1,0xbf,0x13,0xa0,0x10,0x71,0x4,0xbf,0x7,0x5b,0x6,0x2b,0x2,0xb8,0x2b,0x8,
+    0xbf,0x3,0xf9,0xe,0xc9,0xad,0x15,0x8,0xbf,0xb,0xa1,0x71,0x0,0xbf,0x13,0x99,
+    0xf8,0x24,0xbf,0x3,0x71,0xe,0x95,0x71,0xc,0xbf,0x13,0x67,0x71,0x4,0xbf,0x27,
+    0xff,0x9,0x68,0x1,0x60,0x11,0x68,0x41,0x60,0xff,0x19,0x68,0x81,0x60,0x70,0x47,
+    0xa0,0xb4,0xfb,0x0,0x22,0x1d,0x3,0x2f,0x0,0xf,0x40,0x1,0xff,0xd0,0x10,0x0,
+    0x5,0xe0,0x0,0x18,0x49,0xff,0x41,0x52,0x1c,0x40,0x2a,0xf5,0xdb,0x40,0xff,0x20,
+    0xa0,0xbc,0x70,0x47,0x0,0xb5,0x0,0xff,0x2a,0x2,0xd4,0x0,0xf0,0x3a,0xf8,0x0,
+    0xff,0xbd,0x53,0x42,0x40,0x2b,0x2,0xdb,0xc8,0xff,0x17,0xc9,0x17,0x0,0xbd,0x1a,
+    0x0,0x0,0xfb,0xf0,0x42,0x13,0x0,0x1,0x12,0xa,0x0,0x42,0xff,0x40,0x50,0x1a,
+    0x40,0xb2,0x70,0x47,0x20,0xff,0xb4,0xb,0x0,0x48,0x10,0xc9,0x17,0x1,0xff,0x25,
+    0x1d,0x40,0x2,0xd0,0x0,0x22,0x40,0xef,0x1c,0x51,0x41,0x20,0x43,0x0,0xf8,0xb5,
+    0x6,0xff,0x0,0xc,0x0,0x17,0x0,0xd,0x25,0x20,0xff,0x0,0xfa,0xf7,0x99,0xfc,
+    0x28,0x1a,0xc1,0xff,0x7,0xc9,0xf,0x45,0x18,0xc,0x20,0x41,0xff,0x1b,0x20,0x0,
+    0xf8,0xf7,0x11,0xfa,0x39,0xfe,0x17,0x0,0x3d,0xff,0x1,0x21,0xc9,0x43,0x6a,0xff,
+    0x10,0x89,0x1a,0xf8,0xf7,0x8,0xfa,0x30,0xff,0x60,0x30,0x0,0xf2,0xbd,0xd2,0xb2,
+    0x20,0xff,0x3a,0x3,0xd3,0x1,0x0,0x91,0x40,0x0,0xff,0x20,0x70,0x47,0x52,0x42,
+    0xd0,0x41,0x52,0xff,0x42,0x20,0x32,0x91,0x40,0x41,0x40,0xd0,0xd3,0x40,0x90,0x5,
+    0x0,0x9f,0x0,0x0,0x23,0x6,0x8,0x0,0xef,0x10,0x41,0xc9,0x17,0x83,0x0,0x32,
+    0xd1,0x41,0x7f,0xd0,0x40,0x48,0x40,0x91,0x40,0xd1,0x5,0x4,0xab,0x11,0x41,0x7f,
+    0xe,0xb,0x7f,0x4,0x59,0x7f,0xc,0xa,0xb6,0x7f,0x8,0xd1,0xf9,0x7f,0x2,0xfd,
+    0xfe,0x7f,0xa,0x0,0xf7,0xf0,0x29,0xfc,0x7f,0x6,0xf8,0xb5,0x7,0x0,0xff,0x14,
+    0x0,0x1d,0x0,0x0,0x2d,0x4,0xdc,0xff,0x1,0xdb,0x1,0x2c,0x1,0xd2,0x0,0x20,
+    0xff,0x1f,0xe0,0x6,0x26,0x20,0x0,0x29,0x0,0xff,0xff,0xf7,0x60,0xff,0x31,0x1a,
+    0x1,0x26,0xff,0x8,0x0,0x30,0x40,0x8,0x18,0x0,0x90,0xff,0x1a,0x20,0xc0,0x43,
+    0x0,0x99,0x42,0x1a,0xfe,0x1b,0x6,0x63,0xff,0x6,0x99,0xfa,0xf7,0x4d,0xff,0xfe,
+    0xb1,0x7,0x89,0x1b,0x81,0x42,0x0,0xff,0xda,0x8,0x0,0x0,0x99,0x49,0x10,0x49,
+    0xff,0x1e,0xf8,0xf7,0x9a,0xf9,0x38,0x60,0x38,0xfe,0x5b,0x0,0x10,0xb5,0x4,0x0,
+    0x10,0x0,0xa,0xff,0x68,0x1e,0x21,0x9,0x1a,0x1e,0x20,0xf3,0xff,0xf7,0xa1,0xfb,
+    0x20,0x60,0x20,0x0,0x10,0xff,0xbd,0x81,0xb0,0x12,0x68,0x0,0x92,0x9,0xff,0x68,
+    0x89,0x1a,0x1,0x60,0x1,0xb0,0x70,0xfb,0x47,0xf4,0x27,0x0,0xe,0x0,0x1,0x2e,
+    0x1,0xff,0xda,0x0,0x20,0x17,0xe0,0x2,0x25,0x30,0xfe,0xab,0x0,0xf7,0xfb,0x29,
+    0x1a,0x1,0x25,0x8,0xff,0x0,0x28,0x40,0xf,0x18,0xe9,0x1b,0x30,0xee,0xc3,0x0,
+    0x6f,0xf9,0x0,0x6f,0x0,0x15,0xfe,0xa9,0xfb,0x7,0x49,0x6f,0x8,0x79,0x10,0xf8,
+    0xf7,0x64,0xf9,0xf9,0x53,0x2,0x6b,0x6,0x8,0x68,0xc1,0x17,0x12,0xff,0x68,0xd3,
+    0x17,0xf9,0xf7,0x7a,0xf8,0x80,0xdf,0xf,0x8a,0x0,0x10,0x43,0x6f,0x6,0x70,0xb5,
+    0xff,0x98,0xb0,0x6,0x0,0xd,0x0,0x10,0x68,0xff,0xa,0x90,0x50,0x68,0x9,0x90,
+    0x90,0x68,0xff,0x8,0x90,0x0,0x24,0x1,0x94,0x8,0xa8,0xff,0x0,0x90,0x9,0xab,
+    0xa,0xaa,0x1,0xa9,0xff,0x13,0xa8,0xf3,0xf7,0x58,0xfb,0x29,0x0,0xff,0x68,0x46,
+    0xf8,0xf7,0x6,0xfd,0xf,0xa8,0xff,0x69,0x46,0x10,0x22,0xf8,0xf7,0xbb,0xfc,0xff,
+    0x4,0x94,0x3,0x94,0x2,0x94,0x80,0x20,0xdf,0xc0,0x5,0x1,0x90,0x4,0x2d,0x0,
+    0x3,0xab,0xf5,0x2,0x2d,0x0,0xb,0x2d,0x0,0x41,0xfb,0x13,0xaa,0xff,0x29,0x0,
+    0xf3,0xf7,0x4d,0xfa,0xf,0xaa,0xfd,0xb,0x11,0x4,0x48,0xfa,0xc,0x98,0x7,0x90,
+    0xff,0xd,0x98,0x6,0x90,0xe,0x98,0x5,0x90,0x7f,0x5,0xab,0x6,0xaa,0x7,0xa9,
+    0x30,0x27,0x1,0xff,0xb7,0xfe,0x18,0xb0,0x70,0xbd,0xf0,0xb5,0xfd,0x83,0x83,0x0,
+    0x17,0x0,0xc,0x68,0xe5,0x17,0xff,0x2d,0x7,0x20,0x9,0x5,0x43,0x24,0x7,0xff,
+    0x3a,0x68,0x0,0x2a,0x1,0xd1,0xf,0x48,0xff,0x18,0xe0,0xe8,0x17,0xe9,0x17,0x6b,
+    0x46,0xff,0x3,0xc3,0x10,0x0,0xfe,0xf7,0x66,0xff,0xff,0x84,0x46,0x68,0x46,0x3,
+    0xc8,0x60,0x40,0xff,0x69,0x40,0x6a,0x46,0xc,0xca,0x80,0x1a,0xff,0x99,0x41,0x62,
+    0x46,0xf9,0xf7,0x42,0xfd,0x7f,0xec,0x17,0x39,0x68,0xc9,0x17,0x61,0xf5,0x1,0xfb,
+    0x40,0x1a,0xbd,0x3,0x3,0xb0,0xf0,0xbd,0xff,0xff,0xff,0xff,0x7f,0x80,0xb5,0x4,
+    0x22,0xfe,0xff,0xf7,0x4e,0xff,0x2,0xbd,0x0,0x21,0x9,0xff,0x22,0x1,0x60,0x0,
+    0x1d,0x52,0x1e,0xfb,0xbf,0xd1,0x70,0x47,0xf0,0xb5,0x85,0xf7,0x4,0x72,0xff,0x68,
+    0x52,0x1c,0x72,0x60,0x1,0x2a,0x19,0xef,0xd1,0x8,0x30,0x24,0xd7,0x0,0x4f,0xfc,
+    0x0,0xff,0x20,0x0,0x21,0x32,0x0,0x30,0x32,0x9,0xff,0x23,0x3,0xc2,0x5b,0x1e,
+    0xfc,0xd1,0x30,0xdf,0x0,0x78,0x30,0x29,0x0,0x1b,0x2,0x41,0xfc,0xe7,0x9c,0x36,
+    0x30,0xdf,0x1,0xb,0x2,0x3b,0xfc,0x5,0xbc,0x61,0x0,0xa3,0x2,0x2c,0x48,0x4,
+    0xe0,0x5,0x3,0x0,0xff,0x21,0xf9,0xf7,0xf4,0xfc,0x4,0x90,0x0,0xff,0x27,0x34,
+    0x0,0x8,0x34,0x30,0x0,0x30,0xff,0x30,0x2,0x90,0x7,0xe0,0x11,0x0,0x1,0xbf,
+    0x60,0x7f,0x1c,0x2,0x98,0x8,0xd,0x0,0x24,0xff,0x1d,0x2d,0x1d,0x30,0x68,0x87,
+    0x42,0xe1,0xff,0xd2,0x28,0x68,0x1,0x11,0x20,0x68,0x2,0xff,0x11,0x89,0x1a,0x3,
+    0x91,0xc1,0x17,0x89,0xff,0x6,0x82,0x9,0x11,0x43,0x80,0x6,0x0,0xff,0x90,0x1,
+    0x91,0x3,0x98,0xc1,0x17,0x4,0xff,0x9a,0xd3,0x17,0xf8,0xf7,0xa6,0xff,0x0,0xff,
+    0x9a,0x1,0x9b,0x80,0x18,0x59,0x41,0x80,0xd7,0xe,0x8a,0x1,0xaf,0x3,0x28,0x31,
+    0x0,0x20,0x68,0xff,0x0,0x11,0x12,0x1a,0x2,0x98,0x3,0xc8,0xf4,0x2d,0xa,0x2b,
+    0x2,0x90,0x2b,0xc,0x2,0x9a,0x3,0xc2,0xff,0x20,0x0,0x70,0x30,0x29,0x68,0x22,
+    0x6f,0xef,0x8a,0x42,0x0,0xda,0x7f,0x2,0x20,0x0,0x94,0xff,0x30,0x2a,0x68,0x1,
+    0x68,0x8a,0x42,0xb7,0xdf,0xda,0xb7,0xe7,0x0,0xbf,0x17,0x3,0xf1,0xb5,0xbf,0x8,
+    0x68,0xc1,0x17,0x12,0x68,0x3d,0x2,0x71,0xff,0xff,0x42,0xe,0xcc,0x1,0x22,0x43,
+    0x4b,0xff,0x16,0xe,0xa4,0x30,0xcc,0xab,0x42,0x4,0xff,0xdc,0x1,0xdb,0xa2,0x42,
+    0x1,0xd2,0x22,0xff,0x46,0xf,0xe0,0x0,0x27,0xbb,0x42,0xb,0xfe,0xf,0x4,0x8,
+    0xd2,0xe6,0x43,0xbb,0x42,0x6,0xff,0xdb,0x1,0xdc,0xb2,0x42,0x3,0xd3,0xec,0xff,
+    0x9,0x4,0x40,0x0,0xd0,0x6a,0x8,0x0,0xff,0x98,0x2,0x60,0x0,0x98,0xf2,0xbd,
+    0x0,0xf7,0x0,0x0,0x80,0x57,0x0,0xff,0x9d,0x21,0x2,0xff,0x0,0xa,0xd5,0xf4,
+    0x46,0x52,0x42,0x0,0xff,0xf0,0x7,0xf8,0x1,0x22,0xd2,0x7,0x10,0xdf,0x43,0x60,
+    0x47,0x0,0x0,0x17,0x4,0xd0,0x2,0xff,0xd4,0x49,0x1e,0x92,0x18,0xfc,0xd5,0xc9,
+    0xff,0x5,0x10,0xa,0x12,0x6,0x52,0x41,0x0,0x3f,0xd3,0x1,0x2a,0x48,0x41,0x70,
+    0x1f,0x0,0x29,0x2,0xff,0x1,0x18,0x9,0xe,0x7f,0x39,0x10,0xd4,0xff,0x49,0x42,
+    0x1f,0x31,0xf,0xd4,0x0,0x18,0xf7,0x5,0xd2,0xc0,0xf7,0x0,0xc8,0x40,0x0,0xd5,
+    0xef,0xd0,0x43,0x70,0x47,0xb,0x6,0x5,0xd4,0x40,0xf5,0x42,0x2f,0x0,0x20,0x3,
+    0x0,0x42,0xf3,0xd5,0x10,0xff,0x0,0x70,0x47,0x41,0x0,0x9,0xe,0xff,0xff,0x29,
+    0x9,0xd0,0x0,0x29,0x1,0xd0,0x0,0xff,0x20,0x3,0xe0,0x40,0x2,0x40,0xa,0x7,
+    0xef,0xd0,0x1,0x20,0xc0,0x33,0x0,0x40,0x2,0x1,0xeb,0xd0,0x2,0x2b,0x0,0x1,
+    0x3,0x0,0xf8,0xb5,0x6,0xff,0x0,0xc,0x0,0x17,0x0,0x17,0x25,0x20,0xff,0x0,
+    0xfa,0xf7,0x55,0xfa,0x28,0x1a,0xc1,0xff,0x7,0xc9,0xf,0x45,0x18,0x16,0x20,0x41,
+    0xff,0x1b,0x20,0x0,0xf7,0xf7,0xcd,0xff,0x39,0xfe,0x17,0x0,0xf9,0xfc,0x1,0x21,
+    0xc9,0x43,0x6a,0xff,0x10,0x89,0x1a,0xf7,0xf7,0xc4,0xff,0x30,0xff,0x60,0x30,0x0,
+    0xf2,0xbd,0xf1,0xb5,0x9c,0xff,0xb0,0x13,0x0,0x8,0x68,0x1a,0x68,0x4c,0xff,0x68,
+    0x65,0x42,0x1b,0x95,0x5c,0x68,0x1a,0xfb,0x94,0x8c,0x9,0x0,0x19,0x95,0x9c,0x68,
+    0x18,0xfb,0x94,0xcc,0x9,0x0,0x17,0x95,0xdc,0x68,0x16,0xff,0x94,0xc,0x68,0x5d,
+    0x68,0x15,0x95,0x4d,0xff,0x68,0x14,0x95,0x1d,0x68,0x13,0x95,0x8d,0xff,0x68,0x12,
+    0x95,0xdd,0x68,0x11,0x95,0xcd,0xff,0x68,0x6e,0x42,0x10,0x96,0x9d,0x68,0xf,0xff,
+    0x95,0xd,0x68,0xe,0x95,0x9d,0x68,0xd,0xfe,0x21,0x0,0x6e,0x42,0xc,0x96,0xdd,
+    0x68,0xb,0xea,0x23,0x0,0xa,0x2b,0x0,0x9,0x23,0x0,0x8,0x95,0x5d,0xab,0x68,
+    0x7,0x21,0x0,0x6,0x33,0x0,0x5,0x21,0x0,0x4,0xfa,0x29,0x0,0x3,0x1f,0x0,
+    0x6e,0x42,0x2,0x96,0x5d,0xff,0x68,0x1,0x95,0xc9,0x68,0x0,0x91,0x1d,0xfc,0xb1,
+    0x1,0xaf,0x3,0x99,0xfe,0x6,0x0,0xf,0x0,0xed,0x1b,0xfb,0x1,0x1a,0x9a,0xf,
+    0x2,0x91,0xfe,0x80,0x57,0x19,0x79,0x41,0x13,0x2,0x19,0x13,0x0,0x18,0x13,0x4,
+    0x55,0x87,0x13,0xc,0x17,0x13,0x0,0x16,0x13,0x4,0x7d,0x13,0x4,0xff,0xc0,0xd,
+    0x4a,0x2,0x10,0x43,0x1c,0x99,0x7f,0x8,0x60,0x20,0x0,0xe1,0x17,0x15,0x19,0x4,
+    0x55,0x70,0x51,0x4,0x14,0x29,0x0,0x13,0xf,0x4,0x68,0x3d,0xc,0x55,0x12,0x13,
+    0x0,0x11,0x13,0x4,0x5e,0x13,0xc,0x10,0x13,0x0,0x75,0xf,0x13,0x4,0x54,0x51,
+    0x14,0x48,0x60,0xe,0x19,0x0,0x55,0xd,0x19,0x4,0x47,0x51,0x4,0xc,0xf,0x0,
+    0xb,0xf,0x4,0x55,0x3f,0x3d,0xc,0xa,0x13,0x0,0x9,0x13,0x4,0x35,0x13,0xc,
+    0xd5,0x8,0x13,0x0,0x7,0x13,0x4,0x2b,0x51,0x14,0x88,0x60,0x55,0x6,0x19,0x0,
+    0x5,0x19,0x4,0x1e,0x51,0x4,0x4,0xf,0x0,0x55,0x3,0xf,0x4,0x16,0x3d,0xc,
+    0x2,0x13,0x0,0x1,0x13,0x4,0x75,0xc,0x13,0xc,0x0,0x13,0x0,0x2a,0x0,0xeb,
+    0x13,0x0,0xfd,0x2,0x51,0x14,0xc8,0x60,0x1c,0x98,0x1d,0xb0,0xff,0xf0,0xbd,0xf8,
+    0xb5,0x6,0x0,0xc,0x0,0xdf,0x17,0x0,0x11,0x25,0x20,0xf5,0x1,0x4e,0xf9,0xff,
+    0x28,0x1a,0xc1,0x7,0xc9,0xf,0x45,0x18,0xff,0x10,0x20,0x41,0x1b,0x20,0x0,0xf7,
+    0xf7,0xf7,0xc6,0xfe,0x39,0x17,0x0,0xf2,0xfb,0x1,0x21,0xff,0xc9,0x43,0x6a,0x10,
+    0x89,0x1a,0xf7,0xf7,0xff,0xbd,0xfe,0x30,0x60,0x30,0x0,0xf2,0xbd,0xdf,0x0,0x0,
+    0xf8,0xb5,0x5,0x3b,0x0,0x2c,0x49,0xff,0xfe,0xf7,0x8e,0xf9,0x13,0xd8,0x2b,0x4e,
+    0xff,0x31,0x0,0xfd,0xf7,0xc6,0xff,0x2a,0x49,0xff,0xfd,0xf7,0x24,0xfd,0x7,0x0,
+    0x28,0x0,0xfe,0xf,0x2,0x1f,0xfd,0x1,0x0,0x38,0x0,0xfe,0xff,0xf7,0xb9,0xfa,
+    0x5,0x0,0x20,0x0,0x1,0xbf,0x24,0x4,0x43,0x28,0x0,0x22,0x21,0x0,0xa3,0xef,
+    0xfd,0x3,0xd3,0x21,0x39,0x0,0x71,0xf9,0x21,0xbb,0xd8,0x29,0x27,0x0,0xaa,0xff,
+    0x6,0x31,0x8,0xa5,0xdb,0xff,0x1c,0x1f,0x0,0xa2,0xff,0x15,0x2,0x0,0xfd,0xef,
+    0x5,0x0,0x1a,0x48,0x15,0x2,0x9a,0xff,0x19,0xf6,0x15,0x0,0xf8,0xfc,0xb,0x2,
+    0x94,0xff,0xfe,0x21,0x7f,0x89,0x5,0xfd,0xf7,0xf1,0xfc,0x1,0x33,0x0,0xf7,0xfe,
+    0xf7,0x8b,0x5b,0x0,0xa0,0x7,0x2,0xd5,0xff,0x80,0x20,0x0,0x6,0x45,0x40,0x60,
+    0x7,0xff,0x7,0xd0,0x0,0xbf,0xe,0xa1,0xc0,0xe,0x9b,0x8,0x58,0x43,0x2,0xde,
+    0xfc,0x79,0x0,0x1d,0xc,0x28,0xfe,0xb9,0x0,0xa4,0x30,0x89,0x3e,0xd7,0xb3,0xdd,
+    0xdf,0x3f,0x0,0x0,0x80,0xbf,0x3,0x0,0xb9,0x1,0xff,0x0,0x80,0x39,0x6a,0xd5,
+    0x3,0x3f,0x2b,0xbf,0x94,0xa9,0x3d,0xb8,0x2a,0x59,0x17,0x0,0x0,0xff,0x0,0x92,
+    0xa,0x6,0x3f,0xdb,0xf,0xc9,0xef,0x3f,0x92,0xa,0x86,0x7,0x8,0x6,0x40,0xdb,
+    0xff,0xf,0x49,0x40,0x36,0x8d,0x27,0x40,0x9,0xff,0x68,0xca,0x10,0x49,0x7,0x0,
+    0xd5,0x52,0xff,0x1c,0x2,0x60,0x70,0x47,0x0,0x21,0x3,0xff,0x22,0x1,0x60,0x0,
+    0x1d,0x52,0x1e,0xfb,0xff,0xd1,0x70,0x47,0xf5,0xb5,0x87,0xb0,0xd,0xff,0x0,0x0,
+    0x24,0x1e,0x22,0x3f,0xa0,0x3,0xfd,0xc8,0x2d,0x3,0xf7,0xf7,0xf5,0xfe,0x3,0x90,
+    0xd7,0x1d,0x22,0x3d,0xf,0x4,0xb5,0xf,0x0,0xed,0xfe,0x5f,0x2,0x90,0x1c,0x22,
+    0x3b,0xf,0x4,0xad,0xf,0x0,0xff,0xe5,0xfe,0x0,0x90,0x28,0x17,0x65,0x28,0xff,
+    0x8,0xda,0x64,0x28,0x1,0xdb,0x28,0x1,0xff,0x4,0xd1,0x63,0x20,0xc0,0x43,0x29,
+    0x17,0xff,0x81,0x42,0x3f,0xda,0xef,0x17,0x0,0x98,0xff,0x0,0x28,0x1,0xd1,0x2a,
+    0x48,0x1a,0xe0,0xff,0xf8,0x17,0xf9,0x17,0x4,0xaa,0x3,0xc2,0xff,0x0,0x98,0xc0,
+    0x17,0x1,0x90,0x0,0x99,0xff,0x41,0x40,0xa,0x1a,0x94,0x46,0x4,0xa8,0xff,0x3,
+    0xc8,0x68,0x40,0x79,0x40,0x4,0xaa,0xff,0xc,0xca,0x80,0x1a,0x99,0x41,0x62,0x46,
+    0xff,0xf9,0xf7,0x3e,0xfa,0xfe,0x17,0x1,0x99,0xbf,0x71,0x40,0x48,0x40,0x40,0x1a,
+    0x22,0x1,0xd5,0xff,0x40,0x1e,0x0,0x99,0x4a,0x42,0xc1,0x17,0xff,0xd3,0x17,0xf8,
+    0xf7,0xfe,0xfc,0x45,0x19,0xff,0x13,0xe0,0x81,0x10,0x8d,0x42,0x3,0xdb,0xff,0xa9,
+    0x42,0x6,0xdb,0x80,0x7,0x4,0xd0,0xff,0x2,0x98,0x40,0x10,0x2d,0x18,0x64,0x1e,
+    0xff,0x64,0xb2,0x0,0x2c,0x1,0xd5,0x24,0x1d,0xff,0x64,0xb2,0x4,0x2c,0x1,0xdb,
+    0x24,0x1f,0xff,0x64,0xb2,0x3,0x98,0x80,0x10,0xa8,0x42,0xff,0xf,0xdb,0x3,0x99,
+    0x48,0x42,0x82,0x10,0xff,0x95,0x42,0xe2,0xdb,0xaa,0x42,0x1,0xdb,0xff,0x81,0x7,
+    0xde,0xd1,0x7,0x98,0x5,0x60,0xff,0x8,0x98,0x4,0x70,0x7,0x98,0x9,0xb0,0xfb,
+    0xf0,0xbd,0x41,0x4,0x1a,0x64,0x1c,0xdd,0xe7,0xff,0x0,0xbf,0xff,0xff,0xff,0x7f,
+    0x18,0x2d,0xbf,0x44,0x54,0xfb,0x21,0xe9,0x3f,0x7,0x6,0xf9,0xfe,0x7,0x8,0x19,
+    0x40,0x0,0x29,0x1,0xd4,0x88,0xff,0x40,0x70,0x47,0x4a,0x42,0x20,0x2a,0x1,0xff,
+    0xdb,0xc0,0x17,0x70,0x47,0x1,0x0,0x11,0xbf,0x41,0x52,0x1e,0x10,0x41,0xc0,0x51,
+    0x1,0x49,0xff,0x1c,0x8,0x0,0x70,0x47,0xf3,0xb5,0x83,0xf7,0xb0,0x0,0x20,0xe1,
+    0x0,0x26,0x0,0x27,0x3,0xff,0x9c,0x3,0x25,0x20,0x68,0x40,0x10,0xc1,0xff,0x17,
+    0x2,0x0,0xb,0x0,0xf8,0xf7,0x9f,0xff,0xfc,0x80,0x19,0x79,0x41,0x6,0x0,0xf,
+    0xff,0x0,0x24,0x1d,0x6d,0x1e,0xf1,0xd1,0x2,0xff,0x20,0x0,0x90,0x32,0x0,0x3b,
+    0x0,0x1,0xff,0xa8,0x0,0xf0,0x99,0xfb,0x1,0x9c,0x4,0xff,0x98,0xfe,0xf7,0x94,
+    0xf8,0x2,0x0,0x20,0xfb,0x0,0xe1,0xed,0x4,0x87,0xfc,0x8e,0x10,0x4,0xff,0x9a,
+    0x3,0x99,0x68,0x46,0x0,0xf0,0xb7,0xff,0xfb,0x1e,0x22,0x0,0x20,0x13,0x49,0xf7,
+    0xff,0xf7,0xf2,0xfd,0xf7,0xf7,0x2a,0xfe,0x4,0xd5,0x0,0xf,0x2,0x10,0xf,0x0,
+    0xea,0xf,0x0,0x22,0xfe,0xff,0x5,0x0,0x0,0x2e,0x1,0xd1,0xd,0x48,0xff,0x9,
+    0xe0,0x68,0x46,0x3,0xc8,0x80,0x9,0xff,0x8a,0x6,0x10,0x43,0x89,0x11,0x32,0x0,
+    0xff,0xd3,0x17,0xfc,0xf7,0x38,0xff,0xa8,0x42,0xd7,0x3,0xda,0x84,0x3,0x0,0x5,
+    0xed,0x0,0x28,0x0,0xdf,0xfb,0xe7,0x20,0x0,0xf9,0xeb,0x0,0x0,0x0,0xd5,0xf0,
+    0x3,0x2,0x3f,0xf3,0x2,0x1f,0xdc,0x1,0xdb,0xfe,0xff,0x21,0x21,0x1,0x60,0x1f,
+    0xbd,0x10,0xb4,0xff,0x1,0x0,0xa,0x68,0x80,0x23,0x1b,0x6,0xff,0x13,0x40,0x1,
+    0x20,0x52,0x2,0x52,0xa,0xff,0x2,0xd1,0x5,0xe0,0x52,0x0,0x40,0x1e,0xef,0x14,
+    0x2,0xfb,0xd5,0xf,0x2,0x13,0x43,0xb,0xff,0x60,0x10,0xbc,0x70,0x47,0x2,0x68,
+    0x52,0xff,0x0,0x12,0xe,0xff,0x2a,0x6,0xd1,0x0,0x7f,0x68,0x40,0x2,0x1,0xd1,
+    0x1,0x20,0x13,0x0,0xfe,0x3,0x0,0x3,0x68,0x5b,0x0,0x19,0xd0,0x96,0xff,0x23,
+    0x9a,0x1a,0x52,0x1a,0x1,0x2a,0x14,0xff,0xdb,0x18,0x2a,0x5,0xdb,0x1,0x68,0x80,
+    0xff,0x22,0x12,0x6,0x11,0x40,0x1,0x60,0x9,0xff,0xe0,0x1,0x23,0x93,0x40,0x5b,
+    0x1e,0x1,0xff,0x68,0x19,0x40,0x2,0x68,0x4a,0x40,0x2,0xff,0x60,0x0,0x29,0x2,
+    0xd0,0x0,0x20,0xc0,0xef,0x43,0x70,0x47,0x0,0x3d,0x0,0x10,0xb5,0x4,0xff,0x0,
+    0x7,0x48,0x21,0x0,0xfd,0xf7,0xfd,0x7f,0xfd,0x6,0x49,0xfd,0xf7,0x5b,0xfb,0xb,
+    0x2,0xf7,0xf7,0xfd,0x4,0xb,0x0,0x55,0xfb,0x10,0xbd,0xfd,0x0,0x0,0x0,0x15,
+    0x2,0x99,0x3e,0x11,0xae,0x7f,0xcc,0x3e,0xc0,0xaa,0x2a,0x3f,0xf7,0x2f,0x0,0xff,
+    0xe,0x0,0x27,0x68,0x79,0x0,0x9,0xe,0xcf,0xff,0x29,0x9,0xd0,0xa7,0x1,0x4d,
+    0x0,0x3,0xe0,0x7f,0x78,0x2,0x40,0xa,0x7,0xd0,0x1,0x57,0x0,0xed,0x4,0xb,
+    0x0,0x1,0xd0,0x6f,0x1,0xe0,0x1,0x20,0xe9,0x72,0xb1,0x4,0x25,0x0,0x2a,0x25,
+    0x0,0x21,0x3,0xe0,0xb7,0x71,0x2,0x49,0x25,0x2,0x21,0xc9,0x25,0x0,0x71,0xfa,
+    0x25,0x2,0x21,0x25,0x0,0x21,0x2,0x0,0x1,0xd5,0xff,0x0,0x29,0x3d,0xd4,0x2,
+    0x28,0x0,0xd1,0xff,0xc7,0xe0,0x2,0x29,0x1,0xd1,0x26,0x60,0xff,0x18,0xe0,0x0,
+    0x29,0x7,0xd1,0x38,0x0,0xff,0xff,0x21,0xc9,0x5,0xfd,0xf7,0xb4,0xfb,0xff,0xa,
+    0xd0,0x26,0x60,0x36,0xe0,0x1,0x29,0x75,0xe,0x13,0x0,0x5c,0x9b,0x0,0xab,0xfb,
+    0x1,0x11,0x0,0xdf,0x3d,0xe0,0xfe,0xf7,0x36,0x49,0x5,0x58,0x48,0xff,0x20,0x60,
+    0x2,0x20,0xa8,0xe0,0x0,0x28,0xdd,0xe,0x3d,0x0,0x2,0x99,0x20,0x6c,0x1,0xed,
+    0xfa,0xff,0x4,0x0,0x2,0xd0,0x1,0x2c,0x0,0xd0,0xdd,0x9b,0x27,0x0,0x22,0xfe,
+    0x22,0x27,0x0,0x96,0xe0,0xdf,0xff,0x25,0xe9,0x5,0x38,0xe3,0x0,0x8a,0xfb,0xf7,
+    0x9,0xd1,0x30,0x7,0x0,0x81,0xfd,0x20,0x60,0xdf,0x19,0xe0,0x38,0x0,0x49,0x55,
+    0x0,0x6c,0xfb,0x5f,0x6,0xd2,0x0,0x20,0x31,0x15,0x0,0x76,0x15,0x0,0xdf,0x0,
+    0x20,0x80,0xe0,0x44,0x15,0x0,0x33,0xff,0xbf,0xb,0xd8,0xff,0x20,0xc0,0x5,0x17,
+    0x2,0x6a,0x9e,0x17,0x0,0xfe,0xf7,0xfc,0xfd,0x4b,0x2,0x81,0x1,0xe0,0xf7,0x3d,
+    0x48,0x39,0x15,0x0,0x5f,0xfd,0x0,0x21,0xff,0xfd,0xf7,0x4d,0xfb,0x2,0xd2,0xbf,
+    0x21,0x7f,0x9,0x6,0x1,0xe0,0xfc,0x21,0x89,0xb5,0x0,0xff,0xb5,0xfa,0xff,0xf7,
+    0x2b,0xfc,0x5,0x0,0xff,0xff,0xf7,0xc,0xfc,0x0,0x90,0x1,0x46,0xff,0x33,0x48,
+};
+
+static const uint8_t dfuStream_1_7_0_390_page2[30000] PROGMEM = {
+    0xfd,0xf7,0x4a,0xfd,0x1,0x0,0xfe,0x7d,0x2,0xdf,0xfa,0x7,0x0,0x0,0x99,0x30,
+    0xaa,0x11,0x0,0x41,0x11,0x8,0xd6,0x11,0x0,0xb3,0x3d,0x0,0xfd,0xbf,0xf7,0xfb,
+    0xfe,0x5,0xd8,0x2a,0x77,0x0,0x25,0x7f,0xfb,0x1,0xd2,0x30,0x0,0x2f,0xe0,0x61,
+    0x2,0xeb,0x2e,0xfd,0x41,0x2,0x26,0x2f,0x0,0x29,0xfd,0x1,0xaf,0x90,0x0,0x99,
+    0x24,0x9,0x0,0x24,0x39,0x0,0xfc,0xdb,0x20,0x80,0x69,0x0,0x80,0xfa,0x23,0x2,
+    0x1c,0xfd,0xef,0x7,0x0,0x1,0x98,0x9,0x2,0x78,0xfa,0x1,0x9b,0x0,0xfe,0x19,
+    0x4,0x73,0xfa,0x37,0x0,0x13,0x4,0xa6,0xfa,0x13,0xc,0x69,0x9,0x0,0x0,0x98,
+    0xfe,0xf7,0x3,0xf5,0xf8,0xd1,0x2,0x1,0xd1,0x0,0x2,0x98,0x29,0x18,0xea,0x31,
+    0x3,0x54,0x31,0x1,0x1,0x31,0x1,0x3,0xd1,0xfe,0xfb,0xf7,0x8a,0xe3,0x4,0x20,
+    0x0,0x3,0xb0,0xf0,0x7f,0xbd,0x0,0xbf,0x0,0x0,0x80,0xff,0x0,0x0,0xff,0x7f,
+    0x0,0x0,0x65,0xc3,0x1,0x0,0x65,0xff,0x43,0x3b,0xaa,0xb8,0x3f,0x0,0x60,0x31,
+    0xdf,0x3f,0xbf,0xbf,0x90,0x39,0x4d,0x0,0x33,0x9e,0xff,0xbf,0xcc,0x3d,0x13,0x54,
+    0x8,0x3c,0xf8,0xff,0xb5,0x7,0x0,0x14,0x0,0x1d,0x0,0x0,0xff,0x2d,0x4,0xdc,
+    0x1,0xdb,0x1,0x2c,0x1,0xfe,0x4f,0x1,0x1f,0xe0,0xc,0x26,0x20,0x0,0x29,0xfe,
+    0x7,0x1,0x5e,0xf9,0x31,0x1a,0x1,0x26,0x8,0xff,0x0,0x30,0x40,0x8,0x18,0x0,
+    0x90,0x14,0x7f,0x20,0xc0,0x43,0x0,0x99,0x42,0x1a,0x1b,0x6,0xff,0x61,0xf9,0x6,
+    0x99,0xfa,0xf7,0x4b,0xf8,0xff,0xb1,0x7,0x89,0x1b,0x81,0x42,0x0,0xda,0xfd,0x8,
+    0x1f,0x1,0x49,0x10,0x9,0x1f,0xf7,0xf7,0xff,0x98,0xfb,0x38,0x60,0x38,0x0,0xf2,
+    0xbd,0xff,0xf5,0xb5,0x83,0xb0,0x1,0x90,0x3,0x20,0xff,0x0,0x90,0x0,0x25,0x4,
+    0x9e,0xc,0x0,0xff,0x3,0x27,0x21,0x68,0x30,0x68,0xfd,0xf7,0xf7,0xa0,0xfc,0x29,
+    0xc7,0x0,0xfe,0xf9,0x5,0x0,0xff,0xc,0x34,0x36,0x1d,0x7f,0x1e,0xf3,0xd1,0xff,
+    0x1,0x98,0x5,0x60,0x1,0x98,0x0,0x1d,0xff,0x1,0x90,0x21,0x0,0x20,0x39,0x0,
+    0x98,0xff,0x40,0x1e,0x0,0x90,0xe4,0xd1,0x3,0x98,0xfd,0x5,0xcb,0x0,0x10,0xb4,
+    0x1,0x9c,0x9,0x68,0xff,0x1,0x60,0x11,0x68,0x41,0x60,0x19,0x68,0xff,0x81,0x60,
+    0x21,0x68,0xc1,0x60,0x10,0xbc,0xff,0x70,0x47,0xf1,0xb5,0x9c,0xb0,0x13,0x0,0xff,
+    0x8,0x68,0x1a,0x68,0x4c,0x68,0x65,0x42,0x7f,0x1b,0x95,0x5c,0x68,0x1a,0x94,0x8c,
+    0x9,0x0,0x7f,0x19,0x95,0x9c,0x68,0x18,0x94,0xcc,0x9,0x0,0xff,0x17,0x95,0xdc,
+    0x68,0x16,0x94,0xc,0x68,0xff,0x5d,0x68,0x15,0x95,0x4d,0x68,0x14,0x95,0xff,0x1d,
+    0x68,0x13,0x95,0x8d,0x68,0x12,0x95,0xff,0xdd,0x68,0x11,0x95,0xcd,0x68,0x6e,0x42,
+    0xff,0x10,0x96,0x9d,0x68,0xf,0x95,0xd,0x68,0xdf,0xe,0x95,0x9d,0x68,0xd,0x21,
+    0x0,0x6e,0x42,0x5f,0xc,0x96,0xdd,0x68,0xb,0x23,0x0,0xa,0x2b,0x0,0x7d,0x9,
+    0x23,0x0,0x8,0x95,0x5d,0x68,0x7,0x21,0x0,0x55,0x6,0x33,0x0,0x5,0x21,0x0,
+    0x4,0x29,0x0,0x3,0x1f,0x0,0xff,0x6e,0x42,0x2,0x96,0x5d,0x68,0x1,0x95,0xff,
+    0xc9,0x68,0x0,0x91,0x1d,0x68,0xc1,0x17,0xff,0xd3,0x17,0xf8,0xf7,0x3e,0xfa,0x6,
+    0x0,0xff,0xf,0x0,0x1b,0x98,0xc1,0x17,0x1a,0x9a,0x7e,0xf,0x2,0x36,0xfa,0x80,
+    0x19,0x79,0x41,0x13,0x2,0x55,0x19,0x13,0x0,0x18,0x13,0x4,0x2c,0x13,0xc,0x17,
+    0x13,0x0,0xf5,0x16,0x13,0x4,0x22,0x13,0x4,0x40,0xe,0xca,0x1,0xdf,0x10,0x43,
+    0x1c,0x99,0x8,0xc1,0x1,0xe1,0x17,0x55,0x15,0x19,0x4,0x15,0x51,0x4,0x14,0x29,
+    0x0,0x13,0xf,0x4,0x55,0xd,0x3d,0xc,0x12,0x13,0x0,0x11,0x13,0x4,0x3,0x13,
+    0xc,0xb5,0x10,0x13,0x0,0xf,0x13,0x4,0xf9,0xf9,0x51,0x12,0x48,0x6b,0x60,0xe,
+    0x19,0x0,0xd,0x19,0x4,0xec,0xf9,0x29,0x2,0x95,0xc,0xf,0x0,0xb,0xf,0x4,
+    0xe4,0x29,0x4,0x13,0x2,0xa,0xaa,0x13,0x0,0x9,0x13,0x4,0xda,0x13,0xc,0x8,
+    0x13,0x0,0x7,0xba,0x13,0x4,0xd0,0x51,0x14,0x88,0x60,0x6,0x19,0x0,0x5,0xaa,
+    0x19,0x4,0xc3,0x51,0x4,0x4,0xf,0x0,0x3,0xf,0x4,0xbb,0xaa,0x3d,0xc,0x2,
+    0x13,0x0,0x1,0x13,0x4,0xb1,0x13,0xc,0x0,0xae,0x13,0x0,0x2a,0x0,0xeb,0x13,
+    0x0,0xa7,0x51,0x14,0xc8,0xef,0x60,0x1c,0x98,0x1d,0xeb,0x1,0xf8,0xb5,0x6,0xff,
+    0x0,0xc,0x0,0x17,0x0,0xb,0x25,0x20,0xff,0x0,0xf9,0xf7,0xf3,0xfc,0x28,0x1a,
+    0xc1,0xff,0x7,0xc9,0xf,0x45,0x18,0xa,0x20,0x41,0xff,0x1b,0x20,0x0,0xf7,0xf7,
+    0x6b,0xfa,0x39,0xfe,0x17,0x0,0x97,0xff,0x1,0x21,0xc9,0x43,0x6a,0xff,0x10,0x89,
+    0x1a,0xf7,0xf7,0x62,0xfa,0x30,0xaf,0x60,0x30,0x0,0xf2,0x39,0xc,0x5,0x39,0x4,
+    0xd6,0xaa,0x39,0xc,0x4,0x39,0x8,0x4e,0x39,0x4,0x7a,0x39,0x10,0x45,0xfe,0x39,
+    0x8,0x9,0x68,0x52,0x1c,0x1,0xd4,0x91,0xff,0x40,0x5,0xe0,0x53,0x42,0x20,0x2b,
+    0x1,0xff,0xdb,0xc9,0x17,0x0,0xe0,0x19,0x41,0x1,0xff,0x60,0x70,0x47,0xf5,0xb5,
+    0x83,0xb0,0xe,0xff,0x0,0x2,0x90,0x3,0x27,0x0,0x20,0x0,0xff,0x21,0x4,0x9c,
+    0x3,0x25,0x0,0x90,0x1,0xdb,0x91,0x30,0xef,0x1,0x22,0x68,0xd7,0x2,0x45,0xf9,
+    0xff,0x0,0x9a,0x1,0x9b,0x80,0x18,0x59,0x41,0xff,0xc,0x36,0x24,0x1d,0x6d,0x1e,
+    0xef,0xd1,0x7f,0x80,0xf,0x8a,0x0,0x10,0x43,0x2,0xc5,0x1,0xff,0x2,0x98,0x0,
+    0x1d,0x2,0x90,0x20,0x3e,0x7f,0x7f,0x1e,0xe0,0xd1,0x3,0x98,0x5,0xdb,0x0,0xff,
+    0x0,0xb5,0xa,0x0,0x0,0x1,0xc1,0x17,0xed,0x12,0x3b,0x4,0x27,0xf9,0x2b,0x6,
+    0x0,0xbd,0x1c,0xe7,0xb5,0x4,0x0,0x19,0x0,0x61,0x0,0x6b,0x46,0x3,0xd3,0xc3,
+    0x20,0x5d,0x0,0x21,0x6,0x16,0x21,0x8,0x20,0x60,0x57,0x20,0x0,0x16,0x3d,0x6,
+    0x2,0x1b,0xa,0x8,0x3d,0xc,0xda,0x17,0x2,0x80,0x55,0xc,0xfc,0xf8,0x17,0xa,
+    0xf8,0xb5,0xff,0x7,0x0,0x14,0x0,0x1d,0x0,0x0,0x2d,0xff,0x4,0xdc,0x1,0xdb,
+    0x1,0x2c,0x1,0xd2,0xff,0x0,0x20,0x1f,0xe0,0x12,0x26,0x20,0x0,0xff,0x29,0x0,
+    0xfe,0xf7,0x72,0xff,0x31,0x1a,0xff,0x1,0x26,0x8,0x0,0x30,0x40,0x8,0x18,0xff,
+    0x0,0x90,0xe,0x20,0xc0,0x43,0x0,0x99,0xfb,0x42,0x1a,0x1b,0x6,0x75,0xff,0x6,
+    0x99,0xf9,0xff,0xf7,0x5f,0xfe,0xb1,0x7,0x89,0x1b,0x81,0xff,0x42,0x0,0xda,0x8,
+    0x0,0x0,0x99,0x49,0xff,0x10,0xc9,0x1f,0xf7,0xf7,0xac,0xf9,0x38,0xab,0x60,0x38,
+    0x31,0x1,0xfc,0x5b,0x0,0xe,0xb1,0x4,0x14,0xed,0x0,0x13,0x1b,0xbb,0xf8,0x13,
+    0xb,0x24,0x1d,0x36,0xfe,0x13,0x5,0x3,0xc7,0xf6,0xbd,0x0,0x0,0x38,0xfb,0xb5,
+    0x5,0x9f,0x1,0x28,0x68,0x40,0x0,0x0,0xdf,0xe,0xff,0x28,0x4,0xd1,0x9,0x0,
+    0x2,0x16,0xbf,0xd0,0x2,0x20,0x32,0xbd,0x0,0xd,0x2,0x0,0xff,0xff,0xf7,0x52,
+    0xfc,0x1,0x28,0x4c,0xda,0xff,0x1,0x2c,0xd,0xdb,0xff,0x21,0x9,0x1a,0xff,0x8c,
+    0x42,0x9,0xd3,0x28,0x68,0x0,0x28,0xff,0x1,0xd5,0x23,0x48,0x1,0xe0,0xff,0x20,
+    0xdf,0xc0,0x5,0x28,0x60,0x1,0x2d,0x0,0x41,0x42,0xff,0xa1,0x42,0x29,0x68,0x6,
+    0xda,0x1e,0x4a,0xff,0xa,0x40,0x20,0x18,0xc0,0x5,0x10,0x43,0xff,0x28,0x60,0x2b,
+    0xe0,0x80,0x22,0x12,0x6,0xff,0x11,0x40,0x2a,0x68,0x52,0x2,0x52,0xa,0xff,0x80,
+    0x23,0x1b,0x4,0x13,0x43,0x2b,0x60,0xff,0x40,0x1e,0x24,0x18,0x20,0x0,0x18,0x30,
+    0xff,0x18,0x28,0x1,0xd3,0x29,0x60,0x1f,0xe0,0xff,0x0,0x22,0x60,0x42,0x6,0xd0,
+    0x1a,0x46,0xff,0x20,0x23,0x1b,0x1a,0x9a,0x40,0x2b,0x68,0x7f,0xc3,0x40,0x2b,0x60,
+    0x28,0x68,0x8,0x3f,0x0,0xff,0xc,0x48,0x82,0x42,0x6,0xd2,0x80,0x20,0xff,0x0,
+    0x6,0x82,0x42,0x8,0xd1,0x28,0x78,0xef,0xc0,0x7,0x5,0xd5,0x9f,0x0,0x1c,0x28,
+    0x60,0xfd,0x0,0x19,0x1,0x32,0xbd,0x28,0x68,0x88,0x42,0xf7,0xf9,0xd1,0x0,0xab,
+    0x2,0xbf,0x0,0x0,0x80,0xbf,0xff,0xff,0xff,0x7f,0x80,0x1,0x8,0x0,0xd6,0xff,
+    0x48,0xd7,0x49,0x41,0x18,0xd7,0x4a,0x4a,0xaf,0x61,0xd7,0x4a,0x8a,0x3,0x0,0xca,
+    0x3,0x0,0xa,0xfd,0x62,0xf,0x0,0x62,0xaa,0x4a,0x8a,0x62,0xa4,0xff,0x4a,0xca,
+    0x62,0xa2,0x4a,0xa,0x63,0xa3,0xbf,0x4a,0x4a,0x63,0xa7,0x4a,0x8a,0x3,0x0,0xca,
+    0xff,0x63,0xad,0x4a,0xa,0x64,0xa6,0x4a,0x4a,0xfa,0x3,0x0,0x8a,0x3,0x0,0xca,
+    0x64,0xaa,0x4a,0xa,0xaf,0x65,0xaa,0x4a,0x4a,0x3,0x0,0x8a,0x3,0x0,0xca,0xa6,
+    0x3,0x0,0xa,0x66,0xf,0x0,0x3,0x0,0x8a,0x3,0x0,0xca,0xff,0x66,0xa,0x67,
+    0xd6,0x4a,0x4a,0x67,0xa8,0xeb,0x4a,0x8a,0x3,0x0,0xca,0x3,0x0,0x82,0x18,0xa8,
+    0xbf,0x4b,0x13,0x60,0xa8,0x4b,0x53,0x3,0x0,0x93,0xfa,0x3,0x0,0xd3,0x3,0x0,
+    0x13,0x61,0xd0,0x4b,0x53,0xaf,0x61,0xaa,0x4b,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,
+    0xaf,0x62,0xaa,0x4b,0x53,0x3,0x0,0x93,0x3,0x0,0xd3,0xe6,0x3,0x0,0x13,0x63,
+    0xf,0x0,0x3,0x0,0x93,0x63,0xd9,0xfb,0x4b,0xd3,0x3,0x0,0x13,0x64,0xd9,0x4b,
+    0x53,0xea,0x3,0x0,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,0x65,0xab,0xfb,0x4b,0x53,
+    0x3,0x0,0x93,0x65,0xae,0x4b,0xd3,0xbe,0x3,0x0,0x13,0x66,0xae,0x4b,0x53,0x3,
+    0x0,0x93,0x9a,0x3,0x0,0xd3,0x3,0x0,0x13,0x67,0xf,0x0,0x3,0x0,0x93,0x2e,
+    0x3,0x0,0xd3,0x67,0xae,0x83,0x0,0xd0,0x83,0x0,0x73,0x0,0xae,0x3,0x0,0x93,
+    0x60,0xaf,0x83,0x0,0xaf,0x83,0x0,0xce,0x62,0x83,0x0,0xce,0x83,0x0,0x23,0x0,
+    0x3,0x0,0x13,0x62,0x33,0x0,0x6a,0x3,0x0,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,
+    0x63,0xf,0x0,0xab,0x63,0xb1,0x83,0x0,0xb1,0x83,0x0,0xb1,0x83,0x0,0xb1,0x68,
+    0x83,0x0,0xf,0x0,0x3,0x0,0xd3,0x3,0x0,0x13,0x65,0xf,0x0,0xe9,0x65,0x4f,
+    0x0,0x3,0x0,0xd3,0x3,0x0,0x13,0x66,0xd0,0xbf,0x4a,0x2,0x60,0xd0,0x4a,0x42,
+    0x3,0x0,0x82,0x9a,0x3,0x0,0xc2,0x3,0x0,0x2,0x61,0xf,0x0,0x3,0x0,0x82,
+    0x9a,0x3,0x0,0xc2,0x3,0x0,0x2,0x62,0xf,0x0,0x3,0x0,0x82,0xff,0x62,0xd4,
+    0x4a,0xc2,0x62,0xb0,0x4a,0x2,0xaf,0x63,0xb0,0x4a,0x42,0x3,0x0,0x82,0x3,0x0,
+    0xc2,0xa6,0x3,0x0,0x2,0x64,0xf,0x0,0x3,0x0,0x82,0x3,0x0,0xc2,0xa6,0x3,
+    0x0,0x2,0x65,0xf,0x0,0x3,0x0,0x82,0x3,0x0,0xc2,0xf6,0x3,0x0,0x2,0x66,
+    0xf,0x0,0x66,0xc9,0x4a,0x82,0xfa,0x3,0x0,0xc2,0x3,0x0,0x2,0x67,0xc9,0x4a,
+    0x42,0xea,0x3,0x0,0x82,0x3,0x0,0xc2,0x3,0x0,0x80,0x23,0xc2,0xbf,0x50,0x2,
+    0x0,0x84,0x32,0xc8,0xed,0x0,0xc8,0xaa,0xed,0x0,0xc8,0xed,0x0,0xcb,0xed,0x0,
+    0xcb,0xed,0x0,0xcb,0x62,0xed,0x0,0xcb,0xed,0x0,0xf,0x0,0x3,0x0,0x13,0x62,
+    0xf,0x0,0x6a,0x3,0x0,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,0x63,0xf,0x0,0x6a,
+    0x3,0x0,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,0x64,0xf,0x0,0x6a,0x3,0x0,0x93,
+    0x3,0x0,0xd3,0x3,0x0,0x13,0x65,0xf,0x0,0x3a,0x3,0x0,0x93,0x3,0x0,0xd3,
+    0x65,0xce,0xed,0x0,0x3d,0x1,0x6a,0x3,0x0,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,
+    0x67,0xf,0x0,0xee,0x3,0x0,0x93,0x67,0xd2,0x71,0x1,0x82,0x22,0x52,0x81,0x0,
+    0x73,0x17,0x23,0x1,0x3,0x0,0xf7,0x7,0xf,0x0,0x3,0x0,0xd3,0xb6,0x3,0x0,
+    0x13,0x62,0xf,0x0,0x62,0xd4,0x85,0x0,0xd4,0x8a,0x85,0x0,0xd4,0x85,0x0,0xd4,
+    0x85,0x0,0xf,0x0,0x3,0x0,0x5,0xff,0xe0,0x58,0xa8,0xf9,0x40,0x8a,0x44,0x5b,
+    0xff,0x3b,0xa7,0xec,0x8c,0x40,0xd3,0x63,0xd8,0xfe,0x93,0x0,0xdb,0x4b,0xc,0xe0,
+    0x0,0xbf,0xe4,0xff,0xaf,0x9,0x41,0x54,0x72,0x47,0x41,0xc5,0xff,0x61,0xec,0x40,
+    0x3b,0x7e,0xb9,0xb9,0xb3,0xff,0xbe,0xe3,0x40,0xd8,0x7a,0xc2,0x40,0x53,0xbb,0x64,
+    0xd8,0xaf,0x0,0xdc,0x4b,0x22,0x23,0x0,0x9a,0xff,0x38,0xec,0x40,0xd6,0xd4,0x20,
+    0x41,0xfd,0xff,0xb0,0x10,0x41,0x46,0xca,0x10,0x41,0x84,0xff,0xf6,0x49,0xbb,0x98,
+    0x9f,0x2c,0x41,0x7a,0xff,0x35,0x7b,0x41,0x7c,0x70,0x49,0x41,0x55,0xff,0x55,0x13,
+    0x41,0xe1,0xa0,0xb0,0x3f,0x34,0xff,0x46,0x87,0x3f,0x4,0x5,0x0,0x0,0xa5,0xff,
+    0xb4,0x36,0x40,0x87,0xf2,0xaa,0x40,0x5e,0xff,0x43,0xa3,0x40,0xc1,0x94,0x1a,0x39,
+    0x9a,0xdf,0xca,0xae,0x3f,0xd3,0x64,0x91,0x0,0x65,0xdd,0xfb,0x4b,0x24,0x4f,0x0,
+    0x93,0xdb,0x11,0x40,0xbb,0xff,0xdc,0xbe,0x40,0xbd,0x9a,0xb8,0x40,0xde,0xff,0x20,
+    0x77,0x38,0x6,0x23,0x9,0x40,0x7e,0xff,0x74,0x85,0x40,0x98,0x7f,0x7d,0x40,0x55,
+    0xff,0x55,0xbf,0x40,0x0,0x80,0xba,0x40,0x98,0xff,0x2b,0x0,0x20,0x84,0x4,0x0,
+    0x0,0xb4,0xff,0x5b,0xcb,0xba,0x3a,0x6b,0x1b,0x41,0x9a,0xff,0xc7,0x2c,0x41,0x4d,
+    0x25,0x5b,0x41,0x9e,0xff,0xe7,0x9,0x41,0x23,0x1a,0x55,0xb9,0x7d,0xdf,0x18,0x67,
+    0x3f,0x53,0x65,0xdd,0x0,0x65,0xde,0xfb,0x4b,0x14,0x53,0x0,0xa9,0xe,0x90,0x3d,
+    0x4e,0xff,0x4e,0xd2,0x3f,0x2f,0x6b,0x87,0x40,0x13,0xff,0xaa,0x80,0x40,0x3c,0x5e,
+    0xd4,0x39,0x7c,0xff,0x42,0x1f,0x3f,0xa,0x7b,0xff,0x3c,0xcb,0xff,0xf4,0x25,0x3f,
+    0x21,0xd,0xaa,0x40,0x84,0xee,0x9b,0x0,0xd3,0x65,0xd9,0x6f,0x1,0xde,0x4b,0x16,
+    0xfe,0x33,0x0,0x5,0x47,0x8f,0x38,0xb,0xcf,0x20,0xff,0x3d,0x97,0xfd,0x46,0x3f,
+    0xe7,0x60,0x89,0xff,0x3f,0xe2,0x52,0x1d,0xbb,0x46,0xf7,0x27,0xff,0x40,0x9,0x34,
+    0x19,0x3e,0x12,0x29,0xe2,0xff,0x3f,0x93,0x4d,0xe6,0x40,0x93,0x4d,0xf6,0xff,0x3f,
+    0x41,0x2d,0xe5,0xba,0x53,0x66,0xd6,0xee,0x9f,0x1,0xdf,0x4b,0x1c,0x37,0x0,0x1f,
+    0xcb,0x81,0xff,0x40,0x8d,0x97,0x25,0x3f,0x9d,0x67,0x31,0xff,0x40,0xba,0x3e,0xcd,
+    0x40,0xe1,0xbd,0x80,0xff,0x40,0x2,0xb8,0xb8,0xbb,0x22,0xcf,0xc,0xff,0x41,0xfd,
+    0xeb,0xa0,0x40,0x68,0xdc,0x65,0xff,0xba,0x63,0x77,0x2e,0x40,0x87,0x98,0xb9,0xff,
+    0x40,0x20,0x49,0x8d,0x40,0x4e,0x6d,0xca,0x7f,0x40,0x6a,0x53,0xcb,0x40,0xd3,0x66,
+    0x7b,0x0,0xef,0x67,0xdf,0x4b,0x26,0x43,0x0,0x62,0x27,0x36,0xff,0x3f,0xa0,0x2f,
+    0x24,0x39,0xfd,0x9c,0x21,0xff,0x3f,0x24,0xa8,0xa9,0x40,0xda,0xf0,0x79,0xff,0x3f,
+    0x88,0xc9,0xc1,0xbd,0xda,0x3f,0x12,0xff,0x3e,0xc8,0xe,0x14,0xbe,0x3c,0x5e,0x3,
+    0xff,0x40,0xb8,0x62,0xef,0x3f,0x7f,0xe6,0x1d,0xff,0xbf,0xb8,0xbc,0xdc,0x41,0x34,
+    0x87,0xc0,0xff,0xc1,0x78,0x8d,0xb1,0x41,0xdf,0xfe,0x20,0xff,0x42,0xb,0x3a,0x9a,
+    0xc0,0xc4,0x20,0xbf,0xff,0xbf,0x44,0x65,0x9a,0x40,0x22,0x9,0xb9,0xb7,0xc0,0x53,
+    0x67,0x9b,0x0,0x67,0xe1,0x9b,0x4,0x20,0xff,0xf0,0xd3,0x40,0x54,0xf0,0xb2,0x40,
+    0x7b,0xff,0x22,0xa3,0x40,0x17,0xb4,0xf,0x42,0x90,0xff,0xb3,0x3f,0xbf,0xed,0xbc,
+    0x5d,0xbe,0xf1,0xff,0x5b,0x1f,0x3f,0x9d,0x59,0xf8,0xbf,0xd1,0xff,0x61,0x1a,0x40,
+    0x3d,0xb9,0x14,0x40,0xd6,0xff,0x33,0xb2,0x3d,0x2c,0x69,0x7,0xc0,0xf,0xff,0xc0,
+    0xc0,0xbf,0x9,0x16,0x6d,0x3e,0xd3,0xff,0x67,0xc2,0x22,0x52,0x0,0x82,0x18,0xd7,
+    0xff,0x4b,0x13,0x60,0xde,0x4b,0x1,0xe0,0x9b,0xff,0xb2,0x8f,0x3d,0x53,0x60,0xe0,
+    0x4b,0x93,0xfc,0x3,0x0,0x5f,0x3,0x43,0xcc,0x10,0x41,0x52,0xaf,0xff,0x17,0x41,
+    0x4d,0x28,0xfc,0x3f,0x1d,0xf2,0xff,0x13,0xc1,0xef,0x4,0x17,0xc0,0x8f,0x96,0xff,
+    0x51,0xc0,0xcd,0x1b,0x46,0x40,0x7d,0x42,0xff,0x33,0xc0,0xd3,0x1,0x16,0xc0,0xf6,
+    0x9b,0xff,0xc1,0x3e,0xd3,0x60,0xdb,0x4b,0x13,0x61,0xf7,0xdb,0x4b,0x2a,0x33,0x0,
+    0xf9,0x43,0x16,0x41,0xff,0xc,0x54,0x5a,0x40,0xa,0x98,0x1f,0x40,0xff,0x85,0x8,
+    0x51,0x43,0xb4,0xb5,0x4a,0xc3,0xff,0xaa,0xca,0x4a,0x43,0xd6,0xa6,0xe,0x43,0xff,
+    0x78,0x28,0x7f,0xc1,0xf0,0xe2,0x48,0xbd,0xff,0x12,0x5e,0x61,0x41,0x67,0xd1,0xde,
+    0x41,0xff,0x42,0x53,0x4a,0xc1,0x75,0xf5,0x26,0x41,0xff,0x66,0xb7,0x97,0x3e,0xdb,
+    0x3b,0x16,0xc1,0xff,0xeb,0x95,0xcc,0xc0,0x41,0xb6,0x7d,0x3f,0xff,0x47,0xa2,0x84,
+    0x3f,0xab,0x7a,0xa9,0xbf,0xff,0xc,0x37,0xb1,0xbf,0xf8,0x56,0x98,0x3f,0xff,0x53,
+    0x61,0xd0,0x4b,0x93,0x61,0xd3,0x4b,0xfd,0xe,0x5f,0x0,0xad,0x3d,0x1a,0x41,0xc,
+    0xe8,0xff,0xdb,0x40,0x4,0xa,0xf4,0xbf,0x15,0x64,0xff,0x29,0x43,0x86,0x2a,0x25,
+    0xc3,0x71,0x47,0xff,0x27,0x43,0xe1,0x7c,0x84,0x42,0xd3,0x61,0xff,0xcb,0x4b,0x13,
+    0x62,0xcc,0x4b,0x53,0x62,0xfd,0xd5,0xeb,0x5,0xba,0xbc,0x9d,0xbc,0xc8,0xfa,0xff,
+    0x1a,0x3e,0x3,0xca,0x4,0x3f,0x8e,0x25,0xff,0x10,0x3f,0x5c,0x99,0x14,0x40,0x79,
+    0x56,0xff,0x96,0x3f,0x7c,0x43,0x3e,0xbe,0x3c,0x16,0xff,0xf9,0xbe,0x2,0x6b,0x88,
+    0x3e,0x2a,0x9,0x7f,0x1,0xbf,0xf9,0x2f,0x81,0x3d,0x93,0x37,0x0,0xff,0xd3,0x62,
+    0xd0,0x4b,0x13,0x63,0xd0,0x4b,0xfd,0xc,0x3b,0x0,0xf2,0x45,0x19,0xbd,0xf,0xf7,
+    0xff,0x94,0x3d,0xb0,0xfb,0x8b,0x3d,0x39,0x65,0xff,0x5f,0x3f,0x2,0x97,0xf3,0xbd,
+    0x40,0xf8,0x7f,0x9c,0x3e,0x53,0x63,0xd4,0x4b,0x93,0x3,0x0,0xfd,0xd3,0x3,0x0,
+    0x13,0x64,0xd4,0x4b,0x53,0x64,0x7f,0xcc,0x4b,0x93,0x64,0xb0,0x4b,0x2,0x33,0x0,
+    0xff,0x1e,0xa6,0x32,0x41,0xd3,0x64,0xab,0x4b,0xf7,0x13,0x65,0xad,0xf,0x4,0x8a,
+    0xb4,0x26,0xc1,0xdf,0x53,0x65,0xab,0x4b,0x93,0x3,0x0,0xd3,0x65,0xfd,0xcd,0x13,
+    0x4,0xab,0x74,0x35,0x41,0x13,0x66,0x97,0xae,0x4b,0x53,0x3,0x0,0x93,0x3,0x0,
+    0x13,0x2,0x40,0xff,0x6c,0x7d,0x44,0xd3,0x66,0xc6,0x4b,0x13,0xdf,0x67,0xc6,0x4b,
+    0x53,0x67,0x2f,0x0,0x67,0xc5,0xbf,0x4b,0xd3,0x67,0x81,0x22,0x92,0x9b,0x1,0xc3,
+    0x9e,0x9b,0x1,0xc3,0x4b,0x53,0x60,0x15,0x0,0x3,0x0,0x1,0xff,0xe0,0x7e,0xf0,
+    0x18,0x40,0xd3,0x60,0xc8,0xee,0x6f,0x1,0xc8,0x4b,0x53,0x3,0x0,0x93,0x61,0xa7,
+    0x9b,0x4b,0xd3,0x3,0x0,0x13,0x62,0x3b,0x0,0x3,0x0,0x93,0xfc,0x3,0x0,0x53,
+    0x2,0x15,0xad,0x28,0xbf,0xd3,0x62,0x5d,0xc4,0xcf,0x0,0xc4,0x4b,0x53,0x3,0x0,
+    0x93,0x3,0x0,0x57,0xd3,0x63,0xc7,0xb3,0x0,0xc7,0xb3,0x0,0xc7,0xb3,0x0,0xe7,
+    0xc7,0x4b,0xd3,0x3,0x0,0x2b,0x2,0xe8,0xa4,0xe,0xbf,0x3f,0x13,0x65,0xc5,0x4b,
+    0x53,0x3,0x0,0x93,0xbb,0x65,0xa9,0xab,0x0,0xa9,0x4b,0x13,0x8f,0x0,0x53,0xe2,
+    0x3,0x0,0x93,0x3,0x0,0x9b,0xa,0x2b,0x2,0x96,0xdb,0xf0,0xe7,0xbf,0x53,0x67,
+    0x3f,0x0,0x3,0x0,0xd3,0x67,0xa1,0xea,0xa3,0x4,0xc5,0xa3,0x0,0xc5,0x9b,0x0,
+    0xfa,0x2,0xc6,0xa7,0x3f,0x53,0x60,0x6b,0x0,0x3,0x0,0xd3,0x3,0x0,0x13,0xfb,
+    0x61,0xc4,0x33,0x4,0x73,0x3b,0x59,0x41,0x53,0xab,0x61,0xc2,0xab,0x0,0xc2,0xab,
+    0x0,0xc2,0x13,0x4,0xff,0x9f,0xda,0x5a,0x3f,0x13,0x62,0x73,0x0,0x3,0x0,0x93,
+    0x9a,0x3,0x0,0xd3,0x3,0x0,0x13,0x63,0xf,0x0,0x3,0x0,0x93,0xf2,0x3,0x0,
+    0xd3,0x3,0x0,0x27,0x2,0xdc,0xa7,0xc8,0xc0,0x53,0x13,0x64,0x8b,0x0,0x3,0x0,
+    0x93,0x3,0x0,0xd3,0x3,0x0,0x53,0x13,0x65,0xf,0x0,0x3,0x0,0x93,0x3,0x0,
+    0xd3,0x3,0x0,0x7e,0x27,0x2,0x95,0x23,0x60,0xbf,0x13,0x66,0xdb,0x0,0x2a,0x3,
+    0x0,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,0xa3,0x0,0x1b,0x2,0x9f,0xb7,0x8f,0x50,
+    0xbe,0x53,0x53,0x1,0x57,0x7,0xc1,0xa4,0xb3,0x4,0x45,0x0,0x60,0x45,0x0,0x3,
+    0x0,0x93,0x3,0x0,0xd3,0xe6,0x3,0x0,0x13,0x61,0xf,0x0,0x3,0x0,0x1,0xe0,
+    0xde,0x1f,0xc1,0x90,0x3f,0x93,0x61,0x2b,0x0,0x3,0x0,0xa3,0x16,0x72,0x77,0x1,
+    0x63,0x77,0x1,0x3,0x0,0x93,0x63,0xcb,0xa3,0x0,0xfd,0xcb,0xdf,0x6,0x53,0xa9,
+    0xbf,0x13,0x64,0xc9,0x2a,0xa3,0x0,0xc9,0xa3,0x0,0xc9,0xa3,0x0,0xc9,0xa3,0x0,
+    0xf,0x0,0xfc,0x3,0x0,0x1f,0x2,0xee,0x47,0x17,0x3e,0x93,0x65,0x55,0xca,0xab,
+    0x0,0xca,0x57,0x1,0xca,0xa3,0x0,0xca,0xa3,0x0,0xf8,0xf,0x0,0x3,0x0,0x1f,
+    0x2,0x60,0x3d,0x44,0x3e,0x13,0xbb,0x67,0xcb,0xfb,0x1,0xcb,0x4b,0x4,0xf,0x0,
+    0x8a,0xff,0xb7,0xaa,0x40,0x71,0xde,0xf6,0x3e,0x93,0x4b,0x67,0xcc,0xaf,0x0,0xe1,
+    0xaf,0x4,0x39,0x0,0x60,0x39,0x0,0xfe,0x3,0x0,0x3,0xe0,0x1f,0x70,0x5e,0xbf,
+    0x5,0x9f,0xee,0xb,0x40,0x93,0x60,0x83,0x0,0x3,0x0,0x13,0xa9,0x61,0x3b,0x0,
+    0x3,0x0,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,0x29,0x62,0xf,0x0,0x3,0x0,0x93,
+    0x3,0x0,0xd3,0x3,0x0,0x63,0x2,0x7f,0xcf,0xeb,0xdd,0xbf,0x13,0x63,0xd2,0xbb,
+    0x0,0xf7,0xd2,0x4b,0x10,0xf,0x0,0xeb,0x8e,0x22,0x40,0xff,0xeb,0x2f,0xf8,0x44,
+    0x46,0x78,0x9b,0xc0,0xff,0x92,0x0,0x98,0x41,0x4c,0xd6,0xe8,0x40,0xff,0x16,0xe9,
+    0xbb,0x3f,0x97,0x5a,0xc3,0x3f,0x3f,0x6f,0x26,0xf,0x41,0x93,0x63,0x7b,0x0,0x3,
+    0x0,0x77,0x13,0x64,0xcc,0xd7,0x0,0xd2,0x4b,0xc,0x33,0x0,0xff,0x35,0xdc,0xa2,
+    0xc1,0xbb,0x6c,0xba,0xbf,0xff,0x22,0x56,0x81,0x40,0xd5,0x85,0x19,0xc0,0xff,0x7d,
+    0x8a,0x90,0x41,0x57,0x94,0xfe,0x40,0xd7,0x93,0x64,0xce,0xf3,0x0,0xd3,0x23,0x4,
+    0xdb,0xdf,0xff,0xd5,0xc0,0xee,0x73,0x18,0xc1,0xdf,0xa6,0xff,0xa8,0xc0,0x47,0x5f,
+    0x4e,0x41,0x13,0x47,0xff,0xbe,0xbf,0x5f,0x76,0xad,0x3f,0x13,0x65,0xf5,0xcf,0xf,
+    0x1,0xcf,0x8b,0x4,0xe3,0x75,0xc7,0xbf,0x77,0x93,0x65,0xcd,0xf,0x1,0xcd,0x4b,
+    0x8,0xf,0x0,0xff,0x40,0x89,0x7c,0x41,0xe8,0xc9,0x20,0xc0,0x7f,0x9a,0x64,0x58,
+    0xc0,0x0,0xca,0xe,0xc7,0x1,0xf8,0x63,0x1,0x3,0x0,0xa7,0x2,0x4b,0x5d,0x82,
+    0xbf,0x12,0xff,0x7f,0x57,0x40,0xae,0x47,0x10,0x44,0x7b,0xff,0x4,0x59,0xbf,0xa2,
+    0x5f,0xb6,0x3e,0xf6,0xff,0x63,0x4e,0x40,0xc,0xa1,0x5f,0xc0,0xfc,0xbf,0xe9,0x8d,
+    0x41,0x93,0x66,0xd1,0x47,0x1,0xbe,0xea,0xeb,0x1,0xbe,0x3f,0x1,0xcf,0xe3,0x1,
+    0xcf,0x4b,0x14,0xfe,0x37,0x0,0xac,0x5e,0x34,0xbe,0x88,0xc9,0x8,0xff,0xc0,0xb5,
+    0xd4,0x92,0xbe,0x82,0x8c,0x21,0xff,0x3e,0x9e,0xfb,0x58,0x3e,0x37,0xaa,0xc,0xff,
+    0x3e,0xb2,0x21,0xc6,0x3f,0x1a,0x40,0x58,0xff,0x3f,0x78,0xf9,0x67,0xbf,0x33,0x7a,
+    0x92,0xff,0x40,0xd3,0x67,0xc4,0x4a,0x80,0x18,0xc4,0xfb,0x4a,0xe,0x33,0x0,0x3f,
+    0x89,0x87,0xc0,0xab,0xff,0x39,0x9a,0x40,0x39,0x3f,0xb3,0x43,0x31,0xff,0x75,0x52,
+    0xc0,0x35,0x84,0xdd,0x3e,0xe6,0xff,0x21,0xe5,0x3d,0x4c,0x1a,0x6e,0x40,0x2,0xff,
+    0x60,0xbc,0x4a,0x42,0x60,0xa6,0x4a,0xa,0xfe,0x27,0x0,0x21,0xc7,0x15,0xbf,0x3d,
+    0xa1,0xad,0xff,0xc0,0x11,0xd8,0xfb,0xbf,0x4,0x10,0xb4,0xff,0xbf,0x7,0xb7,0x96,
+    0x3e,0x82,0x60,0xa0,0xeb,0x4a,0xc2,0x3,0x0,0x16,0x1f,0x0,0xe0,0xb3,0xbf,0xff,
+    0xbe,0xe1,0xd,0xc6,0x3d,0x9d,0x23,0x2c,0xff,0xbd,0xf8,0xd8,0x4c,0x40,0xae,0x73,
+    0x4c,0xff,0x3f,0x9b,0xca,0xc0,0x3e,0xc7,0x7b,0xa7,0xff,0x40,0xc4,0x5,0x98,0xc0,
+    0x58,0xdd,0xa4,0xff,0x40,0xa3,0x5f,0x5e,0x45,0x7c,0xa4,0x31,0xbf,0x42,0x2,0x61,
+    0xa7,0x4a,0x42,0x3,0x0,0x82,0xf2,0x3,0x0,0xc2,0x3,0x0,0xf3,0x2,0x11,0xa9,
+    0x1d,0xc1,0xff,0x29,0x32,0xb1,0x40,0x24,0x60,0x25,0xc1,0xff,0x33,0xae,0xa9,0xc1,
+    0xcc,0x2e,0xba,0x42,0xff,0x34,0xff,0xb7,0xc1,0x38,0x80,0xa,0xc2,0xff,0x2d,0x5d,
+    0x17,0xc0,0x2,0x62,0xaf,0x4a,0xf9,0x42,0x3,0x0,0xc7,0x5,0x9e,0x41,0x40,0xba,
+    0x53,0xff,0x42,0x43,0xd3,0xb4,0xc9,0xbe,0x59,0x38,0xff,0xe2,0xbe,0x86,0xd2,0x4f,
+    0x40,0x90,0x51,0xdf,0xab,0x41,0x9f,0xb,0x4e,0xc5,0x0,0x55,0xc0,0x9f,0x82,0x62,
+    0xa6,0x4a,0xc2,0x3,0x0,0xdf,0x2,0x60,0xff,0xc7,0x23,0x40,0x77,0x7b,0xaa,0xbf,
+    0x77,0xff,0xfb,0x94,0x40,0xbf,0xb,0x1a,0x46,0xd6,0xff,0xe2,0x5,0x43,0x3c,0xf8,
+    0x7a,0x43,0xe4,0xff,0xed,0x37,0xc3,0x2,0x63,0x9e,0x4a,0x42,0xfa,0x3,0x0,0x18,
+    0x27,0x0,0x48,0x54,0x5c,0xc0,0x1,0xff,0x56,0x3a,0x41,0xd6,0x31,0x50,0x42,0x3f,
+    0xff,0x8b,0x28,0x42,0x5b,0xe3,0x45,0xc2,0x71,0xff,0x76,0x7c,0xbe,0x3e,0x33,0x2a,
+    0x40,0x51,0xff,0x44,0x7a,0x43,0xd1,0xcb,0x85,0xc2,0xd6,0xff,0x18,0x20,0xbe,0x6c,
+    0x20,0x0,0xc0,0x1a,0xff,0x1d,0x72,0x42,0x82,0x63,0x91,0x4a,0xc2,0xfa,0x3,0x0,
+    0x6,0x3b,0x0,0x16,0xbf,0xa8,0x3e,0x15,0xff,0x3b,0xbd,0xc0,0xdd,0xa1,0x2,0x3f,
+    0x2,0xcf,0x64,0x8d,0x4a,0x42,0x3,0x0,0xa7,0x2,0xcf,0x2c,0xff,0x75,0x3e,0x48,
+    0x8c,0x38,0x40,0xf4,0x51,0xff,0xf1,0x45,0x5e,0x18,0x25,0x42,0x5d,0xcb,0xff,0x53,
+    0xc3,0x48,0x40,0xe2,0x40,0x8a,0x60,0xff,0x9f,0xc0,0x85,0x55,0x83,0x40,0x82,0x64,
+    0xd7,0x84,0x4a,0xc2,0x3,0x0,0xc,0x2b,0x0,0xda,0x64,0xff,0xa6,0x41,0x7b,0x53,
+    0x56,0xc1,0xea,0x67,0xff,0x2b,0xc1,0x7d,0x79,0xa6,0xbf,0xb8,0x30,0xff,0x88,0x3f,
+    0xe7,0x3,0x2f,0x43,0x2,0x65,0xd7,0x7d,0x4a,0x42,0x3,0x0,0x4,0x23,0x0,0xd2,
+    0x4e,0xff,0xa5,0x3f,0x66,0xdb,0x19,0x3f,0x82,0x65,0xf7,0x7a,0x4a,0xc2,0x3,0x0,
+    0x2,0x66,0x7a,0x4a,0xfd,0x8,0x17,0x0,0x9c,0x92,0x9d,0xc0,0x5a,0x16,0xff,0x3e,
+    0x41,0x8f,0x47,0x8b,0x3f,0xfd,0xee,0x7f,0x31,0xc0,0x42,0x66,0x75,0x4a,0x82,0x3,
+    0x0,0xfd,0x14,0x1b,0x0,0xb1,0x37,0x11,0x3f,0xf4,0x2d,0xff,0x22,0xbe,0xef,0xd0,
+    0xd7,0x3f,0x22,0xe8,0xff,0x31,0x45,0xd,0xf,0xaa,0xc2,0x7c,0x2,0xff,0xb2,0x42,
+    0x5,0x22,0xa0,0x42,0x14,0x74,0xff,0x6a,0xc1,0x58,0x12,0xcf,0xbf,0x33,0xd,0xff,
+    0x52,0x42,0xc2,0x66,0x6a,0x4a,0x2,0x67,0xd7,0x6a,0x4a,0x42,0x3,0x0,0x82,0x3,
+    0x0,0xc2,0x67,0x7f,0x6a,0x48,0x8,0x60,0x6a,0x48,0x48,0x3,0x0,0xf9,0x88,0x3,
+    0x0,0x7f,0x2,0x36,0x9b,0x67,0x41,0x14,0xff,0x9e,0xa5,0xc2,0xc8,0x60,0x67,0x48,
+    0x8,0xff,0x61,0x67,0x48,0x67,0x49,0x5,0xe0,0x69,0xff,0xdd,0xe4,0x3f,0x1f,0x2f,
+    0xbb,0x3f,0x4b,0xff,0x9e,0xe6,0x42,0x1,0x60,0x64,0x49,0x41,0xea,0x3,0x0,0x81,
+    0x3,0x0,0xc1,0x3,0x0,0x1,0x61,0x64,0xfb,0x49,0x2,0x37,0x0,0xdb,0xad,0xa0,
+    0xc2,0x41,0xcf,0x61,0x62,0x49,0x81,0x3,0x0,0xf,0x2,0x66,0x31,0xff,0x49,0x40,
+    0xc1,0x61,0x60,0x49,0x1,0x62,0x97,0x60,0x49,0x41,0x3,0x0,0x81,0x3,0x0,0x17,
+    0x2,0x6b,0xff,0x2f,0xa1,0x3f,0xc1,0x62,0x5e,0x49,0x1,0xff,0x63,0x5e,0x49,0x41,
+    0x63,0x70,0x47,0x7c,0xff,0x27,0x27,0x43,0xc4,0x42,0x8d,0xc0,0x1,0xff,0x8e,0x9e,
+    0xc0,0xc5,0xc5,0x8e,0x3f,0x6d,0xff,0xad,0x7c,0x3e,0xee,0x38,0xaa,0x3f,0x89,0xff,
+    0x75,0xf9,0xc0,0xeb,0x1d,0xbf,0xc0,0x5f,0xff,0xa9,0xaf,0x40,0x5c,0xf6,0x62,0xc1,
+    0x2f,0xff,0xce,0xcc,0xbe,0x52,0x49,0x1,0x60,0x1,0xff,0x0,0x14,0x31,0x1,0x22,
+    0xa,0x60,0x0,0x7b,0x23,0x4b,0xb,0x0,0x2c,0x31,0xa,0x60,0x7,0x2,0xdd,0x44,
+    0x7,0x8,0xc0,0x31,0xb,0x7,0x0,0x8b,0x60,0xff,0xcb,0x60,0xb,0x61,0x4b,0x61,
+    0x70,0x47,0xff,0x0,0x0,0x91,0xbe,0x8b,0x44,0xd,0xbb,0xff,0x8e,0x41,0x33,0x1d,
+    0x91,0xbe,0x4,0x4,0xff,0x0,0x0,0x21,0x2a,0x7,0xc0,0x5,0x8a,0xff,0xf5,0x40,
+    0x68,0xd3,0xd,0xbc,0xbd,0x29,0xff,0x98,0x41,0xa2,0x32,0x92,0xc1,0xdf,0xd,0xff,
+    0x80,0x3e,0x38,0xb5,0x5,0x0,0xc,0x0,0xff,0x0,0xf0,0x2,0xfc,0xff,0x20,0xaa,
+    0x30,0xff,0x28,0x18,0x0,0x21,0x81,0x70,0x4,0x21,0xff,0x41,0x70,0x9,0x21,0xc1,
+    0x70,0xb,0x21,0xff,0x1,0x71,0xe,0x21,0x1,0x70,0xd8,0x20,0xff,0x40,0x0,0x28,
+    0x18,0x32,0x49,0x93,0x22,0xff,0xd2,0x0,0x8a,0x18,0x2,0x60,0x41,0x60,0xfd,0x1f,
+    0x7,0x1,0x60,0x68,0x28,0x73,0x0,0x20,0xff,0x32,0xbd,0x0,0x0,0x28,0xae,0x8d,
+    0xbe,0xff,0x83,0x81,0xfe,0x41,0x9a,0x35,0x29,0x3f,0xff,0x52,0xe,0x82,0xbe,0x4f,
+    0xd4,0x3c,0x3f,0xff,0x2d,0x39,0x6f,0xbe,0xe7,0x4e,0x40,0x3f,0xff,0x23,0x30,0x2a,
+    0x43,0x1b,0x3,0x73,0xbf,0xff,0xc0,0x6d,0xde,0xbe,0x93,0xbd,0x12,0x40,0xff,0x32,
+    0x14,0xe4,0x3e,0x94,0x2b,0x60,0xbf,0xff,0xe7,0x63,0x28,0x40,0x66,0x52,0x5e,0x3c,
+    0xff,0x95,0x3b,0x4a,0xc0,0xff,0x3d,0x85,0xbe,0xff,0x8f,0x5,0xe6,0xbd,0x37,0xfa,
+    0x56,0x3f,0xff,0xee,0xc0,0x90,0xbf,0x6d,0xd1,0xbc,0x3d,0xff,0x4f,0x6c,0x17,0xbe,
+    0xb5,0x1f,0xbb,0x40,0xff,0x12,0xc8,0xc5,0x3e,0x17,0x57,0x16,0x3e,0xff,0xb5,0xcc,
+    0xe3,0x3f,0x69,0x4b,0xa6,0xbf,0xff,0xa2,0x82,0xda,0x3f,0x48,0x47,0x0,0x20,0xff,
+    0x63,0x5d,0x8b,0xc0,0x3e,0xb1,0x4c,0xbe,0xff,0x50,0x26,0xe6,0x3c,0x23,0x4d,0x99,
+    0xc0,0xff,0xe2,0x47,0x72,0xbe,0x5b,0xa1,0xee,0x3f,0xff,0x51,0x10,0x13,0xbf,0x43,
+    0x61,0xa,0xc0,0xff,0xf5,0xed,0xb0,0x40,0x1e,0x3a,0x91,0x40,0xff,0x85,0x66,0x51,
+    0x40,0x49,0xfe,0x57,0x40,0xff,0xfa,0xa,0xf4,0xbc,0x2a,0x8d,0x2f,0xc0,0xff,0xdc,
+    0x49,0x3,0x0,0x98,0x2b,0x0,0x20,0xff,0x1,0x71,0x70,0x47,0xf2,0xb5,0x8a,0xb0,
+    0xff,0x4,0x0,0x20,0x79,0x0,0x28,0xb,0xd1,0xff,0x4,0x20,0x8,0x70,0x0,0x20,
+    0xa,0x99,0x5f,0x48,0x70,0xa,0x99,0x88,0x3,0x0,0xc8,0x3,0x0,0xff,0x8,0x71,
+    0x4d,0xe1,0x20,0x0,0x14,0x30,0xff,0x0,0x21,0x1,0xaa,0x3,0x0,0x8,0x33,0xff,
+    0x4,0xe0,0x1d,0x68,0x15,0x60,0x49,0x1c,0xff,0x1b,0x1d,0x12,0x1d,0x5,0x68,0xa9,
+    0x42,0xff,0xf7,0xd3,0x5c,0x20,0x20,0x5c,0x80,0x0,0xbf,0x20,0x18,0x1,0x99,0x1,
+    0x66,0x29,0x4,0x90,0xff,0x40,0x68,0x2,0x90,0x0,0x28,0x9,0xd1,0xff,0x1,0xa9,
+    0x0,0x27,0x0,0x9a,0x12,0x68,0xff,0x90,0x42,0x18,0xd2,0xf,0x60,0x40,0x1c,0xff,
+    0x9,0x1d,0xf7,0xe7,0x0,0x25,0x1,0xaf,0xff,0x0,0x9e,0xc,0x36,0xb,0xe0,0x2,
+    0x98,0xff,0x40,0x1e,0xfe,0xf7,0xc7,0xf9,0x1,0x0,0xff,0x30,0x68,0xfc,0xf7,0xf9,
+    0xfd,0x38,0x60,0xff,0x6d,0x1c,0x36,0x1d,0x3f,0x1d,0x0,0x98,0xdf,0x0,0x68,0x85,
+    0x42,0xef,0x57,0x12,0x67,0x20,0x5b,0x0,0x44,0x81,0x40,0xa0,0x30,0x2b,0x0,0x60,
+    0x2b,0x4,0x2a,0x83,0x54,0x85,0x83,0x8,0xb7,0x83,0x2c,0xb0,0x59,0x4,0xd,0x6,
+    0xff,0x25,0x18,0x90,0x35,0xe0,0x7b,0xfe,0xf7,0x77,0x6a,0xf9,0x28,0x11,0xc,0x80,
+    0x35,0xa0,0x11,0x0,0xfd,0x61,0x11,0x0,0x20,0x7b,0x5c,0x21,0x61,0x5c,0xff,0x4a,
+    0x1c,0x82,0x42,0x1,0xd1,0x0,0x21,0xff,0x0,0xe0,0x49,0x1c,0x5c,0x22,0xa1,0x54,
+    0xff,0xfe,0xf7,0x53,0xf9,0x0,0x90,0x0,0x20,0xff,0x25,0x0,0x60,0x35,0x4,0x26,
+    0x29,0x68,0xff,0xfb,0xf7,0xe3,0xff,0x2d,0x1d,0x76,0x1e,0xff,0xf9,0xd1,0x0,0x99,
+    0xfc,0xf7,0x7b,0xfd,0xff,0x7c,0x49,0xfb,0xf7,0xda,0xff,0x21,0x0,0xaf,0x5c,0x31,
+    0x48,0x66,0x25,0x2,0x70,0x25,0x8,0xd0,0xfe,0x25,0x8,0xfa,0x21,0x89,0x5,0xfc,
+    0xf7,0x68,0x55,0xfa,0x21,0x2,0x88,0x21,0x4,0xa0,0x21,0x8,0xbf,0x47,0x10,0xab,
+    0x57,0xfd,0x41,0x4,0x67,0x1f,0x2,0xb0,0x1f,0x8,0xaf,0xaa,0x1f,0x10,0x47,0x1f,
+    0x4,0x88,0x1f,0x4,0x90,0x1f,0x8,0x9f,0x54,0x1f,0x8,0x19,0x2,0x8,0x19,0x4,
+    0x80,0x19,0x8,0x92,0x19,0x10,0xff,0xc8,0x66,0x25,0x0,0xd8,0x35,0x20,0x0,0xcf,
+    0x5c,0x30,0x40,0x6f,0xe3,0x0,0x7,0x0,0x80,0x6f,0xdf,0xfc,0xf7,0xed,0xf9,0x68,
+    0xb,0x4,0x40,0x6e,0xfd,0xa8,0x13,0x6,0x6e,0xfc,0xf7,0xe3,0xf9,0xe8,0xde,0xb,
+    0x4,0x0,0x6f,0x28,0x61,0x7,0x2,0xc0,0x6e,0xff,0x68,0x61,0x6,0x23,0x4,0x22,
+    0x44,0x49,0xbf,0x3,0xa8,0xfb,0xf7,0x87,0xfb,0x43,0x6,0x3,0x75,0x90,0x43,0x6,
+    0x4,0x7,0x4,0x40,0x6e,0x5,0xf,0x6,0xbb,0x6e,0x6,0x7,0x4,0x0,0x6f,0x7,
+    0x7,0x4,0xc0,0x7b,0x6e,0x8,0x7,0x0,0x0,0xf0,0x71,0xf8,0x5,0x2,0xef,0x7f,
+    0xf9,0xa,0x99,0x7,0x2,0xdb,0xf9,0x0,0xff,0x20,0xa0,0x73,0xe0,0x73,0xa0,0x61,
+    0x20,0xff,0x63,0xa0,0x64,0xb,0xb0,0xf0,0xbd,0xf0,0xff,0xb5,0x85,0xb0,0x4,0x0,
+    0xd,0x0,0x20,0xff,0x79,0x0,0x28,0x30,0xd0,0x18,0x21,0x28,0xff,0x69,0xfa,0xf7,
+    0xdf,0xfe,0x2,0x90,0x18,0xbb,0x21,0x68,0x9,0x0,0xda,0xfe,0x3,0x9,0x0,0xa8,
+    0xfe,0x9,0x0,0xd5,0xfe,0x4,0x90,0x0,0x25,0x2,0xff,0xae,0x3,0x27,0x30,0x68,
+    0x1,0x0,0xfc,0xff,0xf7,0xc0,0xf9,0x29,0x0,0xfb,0xf7,0x1e,0xff,0xff,0x5,0x0,
+    0x36,0x1d,0x7f,0x1e,0xf4,0xef,0xd1,0xfc,0xf7,0x84,0xa5,0x1,0x69,0x46,0x20,0xff,
+    0x0,0x14,0x30,0x0,0xf0,0x47,0xfa,0x0,0xff,0x98,0x21,0x69,0xfb,0xf7,0x46,0xff,
+    0x1,0xff,0x90,0x0,0x98,0x20,0x61,0x1,0xa9,0x44,0xdd,0x34,0x7f,0x2,0x3b,0xfa,
+    0x5,0x73,0x0,0x2,0x79,0xff,0x0,0x2a,0x7,0xd0,0x82,0x7b,0xb,0x7b,0xff,0xd2,
+    0x18,0x82,0x73,0xc2,0x7b,0x49,0x7b,0xbf,0x51,0x18,0xc1,0x73,0x70,0x47,0x17,0x2,
+    0x0,0xff,0xd1,0x70,0x47,0x80,0xb5,0x81,0x60,0x0,0xff,0xf0,0xd9,0xf9,0x1,0xbd,
+    0x0,0x28,0x1,0xff,0xd0,0x6,0x48,0x0,0xe0,0x6,0x48,0xa,0xff,0x68,0x90,0x42,
+    0x0,0xdb,0x10,0x0,0x8,0xff,0x60,0x70,0x47,0xcd,0xcc,0x1c,0xc1,0x6b,0xff,0xca,
+    0x0,0x0,0x79,0xa4,0x0,0x0,0x40,0xff,0x9c,0x0,0x0,0xf1,0xb5,0xd2,0xb0,0x0,
+    0xff,0x20,0x2,0x90,0x52,0x98,0x9c,0x21,0x49,0xbf,0x0,0x40,0x18,0x5,0x90,0x4,
+    0xb,0x0,0x78,0xef,0x31,0x40,0x18,0x6,0x7,0x0,0xd8,0x30,0x7,0xfe,0x5,0x0,
+    0xc9,0x1f,0x40,0x18,0x3,0x90,0x7f,0xff,0xe0,0x18,0x22,0x7,0x99,0x14,0xa8,0xf6,
+    0xff,0xf7,0xcd,0xfb,0x6,0x98,0x0,0x68,0x2,0xff,0x99,0x4a,0x0,0x51,0x18,0xc9,
+    0x0,0x44,0xbf,0x18,0x18,0x22,0x14,0xa9,0xe,0x17,0x0,0xc1,0xff,0xfb,0x0,0x25,
+    0xe,0xae,0x30,0x68,0x21,0xfe,0xc5,0x1,0xe7,0xfe,0x30,0x60,0x6d,0x1c,0x24,0xff,
+    0x1d,0x36,0x1d,0x6,0x2d,0xf5,0xdb,0x8,0xff,0xa8,0xe,0xa9,0x18,0x22,0xf6,0xf7,
+    0xb0,0xfa,0x39,0x0,0x40,0x39,0x0,0x54,0x22,0x51,0x43,0x40,0xfd,0x18,0xdf,0x0,
+    0x20,0x0,0x21,0x2e,0xaa,0x0,0xff,0x92,0x1,0x9b,0x84,0x0,0x1b,0x19,0x8c,0xff,
+    0x0,0x14,0x19,0x0,0x9d,0x4e,0x0,0x76,0xff,0x18,0xf6,0x0,0xad,0x19,0x6,0x26,
+    0x76,0xff,0x1a,0x1f,0x68,0x2f,0x60,0x1f,0x68,0x27,0xff,0x60,0x40,0x1c,0x18,0x35,
+    0x24,0x1d,0x1b,0xff,0x1d,0x76,0x1e,0xf5,0xd1,0x49,0x1c,0x18,0xff,0x32,0x0,0x9b,
+    0x1b,0x1d,0x0,0x93,0x6,0xff,0x29,0xe2,0xdb,0x2e,0xac,0x28,0xa8,0x0,0xf7,0x90,
+    0x6,0x20,0x4b,0x0,0x25,0x8,0xae,0x6,0xff,0x27,0x21,0x68,0x30,0x68,0xfc,0xf7,
+    0xf,0x7e,0x61,0x5,0x6d,0xfe,0x5,0x0,0x18,0x34,0x63,0x3,0xff,0xf3,0xd1,0x0,
+    0x98,0x5,0x60,0x0,0x98,0xff,0x0,0x1d,0x0,0x90,0x8c,0x3c,0x1,0x98,0xff,0x40,
+    0x1e,0x1,0x90,0xe6,0xd1,0x0,0x24,0xd7,0x8,0xad,0x28,0x33,0x0,0x29,0x33,0x4,
+    0xf5,0xf8,0x5d,0x21,0x33,0x0,0x53,0xfe,0x4,0x95,0x1,0x2d,0x33,0x4,0xff,0x4,
+    0x98,0x4,0x60,0x2,0x98,0x40,0x1c,0xf7,0x2,0x90,0x4,0x39,0x0,0x4,0x90,0x2,
+    0x98,0xff,0x3,0x99,0x9,0x78,0x88,0x42,0x0,0xda,0x7f,0x79,0xe7,0x0,0x24,0x52,
+    0x98,0xb8,0x31,0x1,0xef,0x45,0x18,0x5,0x9e,0x3d,0x2,0xa3,0xf8,0x28,0xf7,0x60,
+    0x64,0x1c,0x39,0x2,0xe,0x2c,0xf6,0xdb,0xdf,0x1a,0xa8,0x5,0x99,0x38,0xef,0x0,
+    0x38,0xfb,0xff,0x0,0x24,0x1a,0xad,0xbf,0x26,0x36,0x6,0x17,0x28,0x68,0x31,0xf9,
+    0x1,0xc3,0x25,0x4,0x23,0x6,0x19,0x2,0xcc,0x61,0x1,0x75,0x5,0x86,0x68,0x1f,
+    0x0,0x35,0x1,0x14,0xfe,0xfe,0x45,0xe,0xf5,0xdb,0xcf,0x24,0x24,0x6,0x3,0xff,
+    0x98,0x2,0x78,0x0,0x2a,0x9,0xd0,0x1a,0xef,0xab,0x19,0x68,0x20,0x9f,0x0,0x93,
+    0xfe,0x0,0xff,0xd2,0xc,0x0,0x1b,0x1d,0x52,0x1e,0xf6,0x4f,0xd1,0x0,0x25,0x1a,
+    0x6d,0x3,0x15,0x0,0x30,0x6d,0x5,0xef,0x36,0x1d,0xe,0x2d,0x57,0x8,0x9f,0xf0,
+    0x37,0xff,0x3e,0x0,0x6,0xe0,0x28,0x68,0x0,0xf0,0xf7,0x79,0xf9,0x30,0x53,0x8,
+    0x3,0x98,0x0,0x78,0xf7,0x84,0x42,0xf4,0x21,0x0,0x3d,0x0,0xe,0x26,0x7d,0x28,
+    0x39,0x4,0xdb,0xfd,0x4,0x0,0x2d,0x57,0x1,0xf5,0xf7,0x4d,0x0,0x38,0x11,0x0,
+    0xfc,0xf7,0x70,0xfb,0xf5,0x38,0x4b,0x0,0x3f,0x4b,0x4,0x53,0xb0,0xf0,0xbd,0xff,
+    0xf8,0xb5,0x4,0x0,0x94,0x20,0x40,0x0,0xff,0x21,0x18,0x4,0x20,0x4,0x22,0x0,
+    0x23,0xf7,0xb,0x60,0x9,0x7d,0x0,0xfb,0xd1,0x21,0x0,0xff,0xc,0x31,0x4a,0x78,
+    0xb,0x78,0x9a,0x42,0x7f,0x5,0xd2,0x52,0x1c,0x4a,0x70,0xd4,0xc9,0x0,0xff,0x60,
+    0x54,0xf1,0xbd,0x0,0x25,0xed,0x43,0xff,0x0,0x26,0x27,0x0,0xf0,0x37,0x27,0xe0,
+    0xfd,0xd4,0x37,0x0,0x20,0x18,0xc0,0x78,0x86,0x42,0xab,0x11,0xd0,0xb,0x6,0x80,
+    0xb,0x0,0xb,0xb,0x8,0x0,0xaf,0x79,0x86,0x42,0x5,0xb,0x8,0x40,0xb,0x0,
+    0x0,0xbf,0xd1,0x6d,0x1c,0x6d,0xb2,0xa8,0xd,0x0,0x94,0xbe,0x15,0x5,0x0,0x90,
+    0x1,0x68,0x38,0x15,0x1,0x89,0x3f,0xfd,0x0,0x99,0x8,0x60,0x76,0x93,0x0,0x2b,
+    0x8,0xfe,0x43,0x0,0xd1,0xdb,0xcf,0x20,0x0,0x6,0x0,0xdd,0x23,0x29,0x2,0x65,
+    0x18,0x29,0x25,0x0,0x6,0xfe,0x7f,0x1,0xd2,0x8,0x0,0x1a,0x0,0x5b,0x5f,0x1,
+    0xaf,0x4,0x2b,0xf5,0xdb,0x2b,0x2,0x22,0x8f,0x0,0x38,0xf7,0xb5,0xc,0x0,0x9b,
+    0x2,0x41,0x5c,0x21,0x70,0xfe,0x2d,0x2,0x45,0x18,0x68,0x68,0x0,0x21,0xfc,0xff,
+    0xf7,0xc0,0xf9,0x2,0xd8,0xfc,0x21,0x89,0xff,0x5,0x1,0xe0,0xbf,0x21,0x9,0x6,
+    0xfb,0xff,0xf7,0x56,0xfd,0x0,0xf0,0xfe,0xf8,0xfd,0x9f,0xf7,0xca,0xfe,0x60,0x70,
+    0x37,0x1,0x21,0x0,0xaf,0xea,0x21,0x18,0x45,0x21,0x0,0xed,0x21,0x0,0xb9,0xfe,
+    0xa0,0xab,0x70,0xa8,0x21,0x4,0x9e,0x21,0x18,0x34,0x21,0x0,0xdc,0xbe,0x21,0x0,
+    0xa8,0xfe,0xe0,0x70,0xe8,0x21,0x4,0x8d,0xea,0x21,0x18,0x23,0x21,0x0,0xcb,0x21,
+    0x0,0x97,0xfe,0x21,0xff,0x78,0x3,0x29,0x2,0xd1,0x4,0x20,0x20,0xff,0x70,0x0,
+    0x20,0x20,0x71,0x31,0xbd,0xf0,0xff,0xb4,0x1,0x0,0xd,0x31,0x0,0x22,0x4a,0xff,
+    0x70,0x4,0x0,0x10,0x34,0x22,0x60,0xa2,0xff,0x60,0xa2,0x63,0x22,0x62,0x4,0x0,
+    0x5c,0xff,0x34,0x22,0x70,0x6,0x0,0x80,0x36,0x4,0xff,0x25,0x4,0x27,0x32,0x60,
+    0x36,0x1d,0x7f,0x5e,0x7b,0x1,0x6,0x0,0x60,0x36,0xd,0x12,0x70,0xd,0x14,0xd5,
+    0xa0,0xd,0x14,0xb0,0xd,0x14,0x90,0xd,0x10,0xe2,0x66,0xff,0x62,0x66,0xa2,0x66,
+    0x62,0x67,0xa2,0x67,0xff,0x22,0x67,0xd4,0x26,0x76,0x0,0x85,0x55,0xff,0x94,0x24,
+    0x64,0x0,0x0,0x19,0x2,0x60,0xf7,0x0,0x1d,0x6d,0x1f,0x0,0xa,0x70,0xf0,0xbc,
+    0xff,0x70,0x47,0xf0,0xb5,0x83,0xb0,0x4,0x0,0xff,0xf,0x0,0x60,0x68,0x40,0x1c,
+    0x60,0x60,0xff,0x0,0x25,0x1,0x28,0x10,0xd1,0x20,0x0,0xff,0x8,0x30,0x0,0x21,
+    0x22,0x68,0x95,0x42,0xff,0x47,0xd2,0x3a,0x68,0x2,0x60,0x41,0x60,0x77,0x3a,0x68,
+    0x82,0x3,0x0,0xc2,0x60,0x6d,0xa5,0x1,0xff,0x0,0x1d,0xf1,0xe7,0xfd,0xf7,0x16,
+    0xfe,0xff,0x1,0x0,0xfe,0x20,0x80,0x5,0xfc,0xf7,0xff,0x47,0xfa,0x2,0x90,0x26,
+    0x0,0x8,0x36,0xdf,0x4,0xe0,0x1,0x0,0xf1,0x21,0x0,0x36,0x1d,0xff,0x3f,0x1d,
+    0x20,0x68,0x85,0x42,0x29,0xd2,0xff,0x30,0x68,0x1,0x90,0x38,0x68,0x1,0x99,0xef,
+    0xfb,0xf7,0xcf,0xfc,0xed,0x1,0x46,0x2,0x98,0x7f,0xfb,0xf7,0x31,0xff,0x1,0x0,
+    0x1,0x7,0x0,0xbf,0x8e,0xfc,0x1,0x0,0x31,0x60,0xff,0x3,0xc1,0xaa,0x9,0x0,
+    0x0,0x11,0x0,0x24,0x19,0x0,0x70,0xf,0x0,0x81,0xbf,0xfc,0x70,0x60,0x39,0x68,
+    0xb0,0x9,0x0,0xc,0xbf,0xfd,0x0,0xd2,0x1,0x0,0xb1,0x25,0x0,0xf1,0xfe,0xd,
+    0x0,0x5,0xfd,0xce,0xd2,0xce,0xe7,0x3,0xff,0xb0,0xf0,0xbd,0x1,0xb5,0x41,0x0,
+    0x9,0xff,0xe,0xff,0x29,0x6,0xd0,0x0,0x29,0xb,0xdf,0xd1,0x40,0x2,0x9,0xd1,
+    0x89,0x2,0x2,0xbd,0xff,0x40,0x2,0x0,0x98,0xa,0xd1,0x0,0x28,0xff,0x8,0xd5,
+    0x0,0x20,0x2,0xbd,0x0,0x22,0xfd,0xfe,0x99,0x1,0x68,0x46,0xfe,0xf7,0xc,0xf9,
+    0xff,0x0,0x98,0x2,0xbd,0x42,0x0,0x12,0xe,0xff,0x7e,0x3a,0xb,0xdd,0x18,0x21,
+    0x89,0x1a,0xf7,0xf,0xdd,0xff,0xaf,0x1,0xc9,0x43,0xd1,0x40,0xff,0x0,0x42,0x0,
+    0xd5,0x40,0x18,0x88,0x43,0xff,0x70,0x47,0xc1,0xd,0x9,0x6,0x1,0xd9,0xff,0x2,
+    0x48,0x70,0x47,0x0,0xd0,0x0,0x20,0xfe,0x5,0x0,0x0,0x80,0xbf,0x1,0x21,0x1,
+    0x60,0xff,0x0,0x21,0x41,0x60,0x70,0x47,0x70,0x47,0xff,0x10,0xb4,0x3,0x0,0x14,
+    0x39,0x0,0x2b,0xff,0x28,0xd0,0x20,0x29,0x6,0xdb,0x0,0x2b,0xff,0x1,0xd4,0xe0,
+    0x4b,0x23,0xe0,0x80,0x23,0xff,0x1b,0x6,0x20,0xe0,0x1e,0x20,0xc0,0x43,0xff,0x81,
+    0x42,0x1b,0xdb,0x1,0x29,0xe,0xdb,0xef,0x80,0x24,0x24,0x6,0x41,0x1,0x41,0x83,
+    0x42,0xff,0x1,0xda,0x23,0x0,0x12,0xe0,0xe0,0x43,0xff,0x4,0x0,0xcc,0x40,0x9c,
+    0x42,0x8,0xda,0xff,0x3,0x0,0xb,0xe0,0x0,0x29,0x9,0xd5,0xff,0x48,0x42,0x20,
+    0x28,0x3,0xdb,0xdb,0x17,0xff,0x4,0xe0,0x8b,0x40,0x2,0xe0,0x3,0x41,0x7f,0x0,
+    0xe0,0x0,0x23,0x13,0x60,0x10,0x8d,0x1,0xff,0xf8,0xb5,0x5,0x0,0x0,0xf0,0x7d,
+    0xff,0xff,0x0,0x24,0x6c,0x66,0xc9,0x4e,0x6,0x23,0xff,0x4,0x22,0x31,0x0,0x28,
+    0x0,0x70,0x30,0xaf,0xfb,0xf7,0x15,0xf8,0xd,0xa,0x88,0xd,0x0,0xe,0xfa,0xd,
+    0xc,0xa0,0xd,0x0,0x7,0xf8,0xbf,0x4f,0x4,0xef,0x23,0x18,0x22,0x39,0xf,0x0,
+    0xc8,0x30,0xfa,0xef,0xf7,0xff,0xff,0x4,0x1d,0x4,0x94,0x20,0x40,0xbf,0x0,0x28,
+    0x18,0xfa,0xf7,0xf7,0xf,0x8,0x9c,0xaa,0xf,0x8,0xef,0xf,0x8,0xa4,0xf,0x8,
+    0xe7,0xf,0x8,0xac,0xd2,0xf,0x8,0xdf,0xf,0x0,0x4d,0x2,0xb4,0xf,0x8,0xd7,
+    0xff,0x6d,0xea,0x9,0x0,0x2c,0x50,0x73,0x6,0x0,0x1d,0x13,0x2,0xd5,0xcd,0x33,
+    0x8,0xf8,0x23,0x8,0xc5,0xf,0x8,0xd0,0x1,0xba,0xd,0x2,0xbe,0xd,0x8,0x84,
+    0x20,0x80,0x1d,0x4,0xb6,0xaa,0x51,0x8,0x88,0xf,0x8,0xae,0x1f,0x8,0xa0,0xf,
+    0x8,0xa6,0xd4,0x91,0xc,0xf,0x6,0x9e,0xf,0x8,0xa8,0xf,0x8,0x96,0xff,0xfd,
+    0xac,0x9,0x4,0x4,0x60,0x44,0x60,0x84,0x60,0xff,0xc4,0x60,0x4,0x61,0x44,0x61,
+    0x84,0x61,0xff,0xc4,0x61,0x4,0x62,0x44,0x62,0x84,0x62,0xff,0xc4,0x62,0x4,0x63,
+    0x44,0x63,0x84,0x63,0xff,0xc4,0x63,0x4,0x64,0x44,0x64,0x84,0x64,0xff,0xc4,0x64,
+    0x4,0x65,0x44,0x65,0x84,0x65,0xff,0xc4,0x65,0x4,0x66,0x44,0x66,0x28,0x0,0xff,
+    0xf2,0xbd,0xf8,0xb5,0x4,0x0,0xe,0x0,0xff,0xb8,0x30,0x3,0x21,0x3,0x22,0x0,
+    0x25,0xff,0x5,0x60,0x0,0x1d,0x52,0x1e,0xfb,0xd1,0xad,0xe4,0xbb,0x0,0x20,0x18,
+    0xd,0x2,0x49,0xd,0x0,0x27,0xff,0x0,0x60,0x37,0x1,0x20,0x38,0x70,0x78,0xef,
+    0x70,0x18,0x21,0x20,0x73,0x1,0xf6,0xf7,0x24,0x55,0xf8,0x9,0x2,0x88,0x9,0x0,
+    0x1f,0x9,0x4,0xa0,0x9,0x0,0xf5,0x1a,0x9,0x0,0xec,0x37,0x4,0xf6,0xf7,0x14,
+    0xf8,0xff,0x4,0x20,0x38,0x73,0x7d,0x60,0x64,0x20,0xff,0xb8,0x60,0x32,0x20,0xc4,
+    0x21,0x60,0x54,0xff,0x0,0x23,0x0,0x22,0x14,0x21,0xfe,0x20,0x3f,0x80,0x5,0xfa,
+    0xf7,0x91,0xfa,0xcb,0x1,0xf,0x4,0xff,0xab,0x48,0xfa,0xf7,0x8a,0xfa,0x29,0x0,
+    0xff,0xf6,0xf7,0x5f,0xfe,0x1e,0x21,0xfa,0xf7,0xff,0xbc,0xfa,0xad,0x21,0x89,0x0,
+    0x60,0x50,0xbd,0x20,0xeb,0x1,0xa8,0xfd,0x31,0x0,0x7,0x2,0xb0,0xbf,0xfd,0x0,
+    0x20,0xf2,0xbd,0x70,0xa7,0x0,0xa0,0xff,0x4d,0x28,0x0,0x22,0x0,0x14,0x21,0xff,
+    0x7f,0xf7,0xc6,0xfe,0x9e,0x48,0x22,0x1d,0x9,0x2,0x7f,0xc1,0xfe,0xa8,0x26,0x36,
+    0x4,0x30,0x17,0x0,0x5b,0x8,0x32,0xf,0x2,0xb9,0xfe,0x23,0x2,0xc,0xb,0x4,
+    0x7f,0xb3,0xfe,0x96,0x48,0x22,0x0,0x10,0xb,0x4,0xd7,0xad,0xfe,0x94,0xb,0x0,
+    0x14,0xb,0x4,0xa7,0xfe,0x75,0x92,0xb,0x0,0x18,0xb,0x4,0xa1,0xfe,0x90,0x55,
+    0x4,0x4d,0x1c,0xd,0x4,0x9a,0xfe,0x77,0x1,0x8,0x1,0x20,0xd,0x4,0xd7,0x93,
+    0xfe,0x8a,0x27,0x0,0x24,0xb,0x4,0x8d,0xfe,0x75,0x88,0xb,0x0,0x28,0xb,0x4,
+    0x87,0xfe,0x86,0xb,0x0,0x5d,0x2c,0xb,0x4,0x81,0xfe,0x84,0xb,0x0,0x30,0xb,
+    0x4,0xb5,0x7b,0x7b,0x4,0x34,0xb,0x4,0x75,0xfe,0x93,0x2,0x38,0xfe,0xb,0x4,
+    0x6f,0xfe,0x98,0x20,0x0,0x4,0x22,0xbb,0x0,0x3c,0xd,0x4,0x68,0xfe,0xf0,0xd,
+    0x4,0x40,0x7e,0xd,0x4,0x61,0xfe,0xa0,0x25,0xed,0x3,0x37,0x2,0x7d,0x44,0xf,
+    0x4,0x59,0xfe,0x80,0x20,0xc0,0x81,0x0,0x55,0x48,0xd,0x4,0x52,0xd,0x0,0x40,
+    0xd,0x0,0x4c,0xd,0x4,0xf5,0x4b,0x5f,0x4,0x50,0xb,0x4,0x45,0xfe,0x80,0x21,
+    0xff,0x89,0x3,0x20,0x0,0x54,0x30,0x1,0x60,0xd5,0x69,0x27,0x1,0x58,0x7,0x0,
+    0xc0,0xbb,0x0,0x5c,0x34,0xff,0x20,0x60,0x0,0x20,0x70,0xbd,0xff,0xff,0xff,0xff,
+    0x7f,0x6b,0xca,0x0,0x0,0x1d,0x5f,0xff,0x1,0x0,0xc6,0x22,0x92,0x0,0x81,0x54,
+    0xff,0x70,0x47,0x70,0xb5,0x88,0xb0,0x4,0x0,0xff,0xd,0x0,0xc6,0x20,0x80,0x0,
+    0x20,0x5c,0xef,0x0,0x28,0x53,0xd0,0x38,0x0,0x90,0x3,0x23,0xff,0x4,0x22,0x54,
+    0x49,0x68,0x46,0x0,0x1d,0xfd,0xfa,0xa9,0x0,0x18,0x21,0x28,0x69,0xfa,0xf7,0x7f,
+    0xf8,0xf9,0x1,0x90,0x18,0x21,0x68,0x9,0x0,0xd7,0xf3,0xf9,0x2,0x9,0x0,0xa8,
+    0x9,0x0,0xee,0xf9,0xff,0x3,0x90,0x68,0x68,0xfd,0xf7,0xa6,0xfb,0xff,0x49,0x49,
+    0xfb,0xf7,0xda,0xfc,0x0,0x90,0xff,0x5,0xa8,0x69,0x46,0x9,0x1d,0x3,0x22,0xff,
+    0xb,0x68,0x3,0x60,0x9,0x1d,0x0,0x1d,0xff,0x52,0x1e,0xf9,0xd1,0x0,0x98,0x4,
+    0x90,0x6f,0x4,0xaa,0x5,0xa9,0xb9,0x3,0x81,0xf8,0x7,0x6,0xcb,0xa9,0xf9,0x5,
+    0x2,0x21,0xf5,0x1,0x7,0x2,0x2e,0xfb,0xfd,0x6,0x7,0x4,0xdf,0xfb,0x0,0x2d,
+    0x3,0xd0,0xff,0x0,0x2e,0x1,0xd0,0x0,0x28,0x1,0xd1,0xfe,0x12,0x0,0xe0,0x4,
+    0x20,0x64,0x34,0x20,0x72,0xff,0x0,0x98,0x21,0x68,0xfb,0xf7,0x43,0xfa,0xfd,0xb6,
+    0x65,0x0,0x98,0xfa,0x1,0xd2,0x4,0x20,0xff,0x20,0x72,0x8,0xb0,0x70,0xbd,0x70,
+    0xb5,0xff,0x4,0x0,0x8,0x0,0xc6,0x21,0x89,0x0,0xff,0x61,0x5c,0x0,0x29,0x36,
+    0xd0,0xfd,0xf7,0xf7,0x55,0xfb,0x27,0x23,0x0,0x95,0xfc,0x5,0x0,0xff,0x0,0x23,
+    0x0,0x22,0x14,0x21,0xfa,0xf7,0xf7,0x64,0xf9,0x6,0xb,0x8,0x14,0x48,0xfa,0xf7,
+    0xff,0x5d,0xf9,0x31,0x0,0xf6,0xf7,0x32,0xfd,0xdd,0x1e,0x19,0x0,0x8f,0xf9,0xad,
+    0x39,0x0,0x60,0x50,0xf6,0x79,0x2,0x7b,0xfc,0x63,0x1,0x5,0x29,0x0,0xfb,0xff,
+    0xf7,0x76,0xff,0x5,0x0,0xfa,0x20,0x80,0xfe,0xb,0x4,0x71,0xfc,0x0,0xf0,0x68,
+    0xfd,0xc4,0xff,0x21,0x60,0x54,0x28,0x0,0xfa,0xf7,0xaf,0xff,0xf9,0x0,0x22,0x96,
+    0x4b,0xfa,0xf7,0xc4,0xff,0xf9,0xf5,0xf7,0x2f,0xfc,0xa0,0x66,0x70,0xfb,0xbd,0x0,
+    0x0,0x0,0xa0,0x40,0xcd,0xcc,0x9c,0xff,0x0,0x66,0x66,0x96,0x0,0xcd,0xcc,0x4,
+    0xef,0x0,0x9a,0x99,0x1,0xb,0x0,0x6,0x0,0x33,0xfb,0x33,0x3,0xf,0x0,0x1c,
+    0x0,0xf6,0x28,0x0,0x6f,0x0,0x31,0x8,0x0,0xb,0x0,0xc,0x0,0x7b,0x3,0xff,
+    0xbd,0x37,0x86,0x35,0xf4,0xb5,0x84,0xb0,0xff,0x5,0x0,0xe,0x0,0x1,0x20,0x84,
+    0x4c,0xff,0x21,0x78,0x0,0x29,0x6,0xd1,0x20,0x70,0xff,0x82,0x49,0xe1,0x60,0x82,
+    0x49,0x21,0x61,0xdf,0x0,0x21,0x61,0x61,0x61,0x13,0x0,0x4,0xd1,0xbf,0x60,0x70,
+    0x7f,0x49,0x21,0x63,0xf,0x0,0x63,0xfd,0xa1,0xf,0x0,0x3,0xd1,0xa0,0x70,0xfe,
+    0x21,0xdf,0x89,0x5,0xa1,0x64,0xe1,0x31,0x4,0xe0,0x70,0x7f,0x79,0x49,0xa1,0x61,
+    0x79,0x49,0xe1,0x3,0x0,0xef,0x21,0x62,0x21,0x79,0x31,0x2,0x20,0x71,0x77,0xff,
+    0x49,0xa1,0x63,0x77,0x49,0xe1,0x63,0x61,0xde,0xf,0x0,0x3,0xd1,0x60,0x71,0x31,
+    0x2,0xe1,0x64,0xfd,0xa1,0xd,0x0,0x6,0xd1,0xa0,0x71,0x71,0x49,0xdf,0x61,0x62,
+    0x71,0x49,0xa1,0x3,0x0,0xe1,0x62,0xfd,0xe1,0x31,0x4,0xe0,0x71,0x6f,0x49,0x21,
+    0x64,0xff,0x6f,0x49,0x61,0x64,0x21,0x7a,0x0,0x29,0xff,0x2,0xd1,0x20,0x72,0x6d,
+    0x48,0x20,0x65,0xff,0x60,0x20,0x28,0x5c,0x0,0x28,0x30,0xd0,0xfe,0x7f,0x1,0x90,
+    0x2f,0x0,0x78,0x37,0x30,0x68,0xff,0x21,0x6d,0xfb,0xf7,0xea,0xfe,0x1,0x0,0xff,
+    0x38,0x0,0x8,0x38,0x1,0x60,0x39,0x60,0xdf,0x30,0x68,0xb8,0x60,0x70,0x15,0x4,
+    0xdf,0xfe,0xff,0x38,0x61,0xb8,0x61,0x70,0x68,0x38,0x62,0xfd,0xb0,0xf,0x4,0xd7,
+    0xfe,0xb8,0x62,0x38,0x63,0xff,0xb0,0x68,0xb8,0x63,0x0,0x98,0x40,0x1c,0xff,0x0,
+    0x90,0x3f,0x1d,0x2,0x28,0xde,0xdb,0xff,0x28,0x0,0xb8,0x30,0xe,0xce,0xe,0xc0,
+    0xff,0x0,0x20,0x60,0x21,0x68,0x54,0x4,0x98,0xff,0x0,0x68,0x60,0x35,0x68,0x60,
+    0x82,0xe0,0xff,0x1,0x90,0x30,0x68,0x1,0x90,0xa0,0x6c,0xff,0x2,0x90,0x28,0x0,
+    0x70,0x30,0x0,0x90,0xff,0x2,0xab,0x22,0x0,0x30,0x32,0x21,0x0,0xff,0xc,0x31,
+    0x1,0xa8,0x0,0xf0,0xbe,0xfc,0x55,0xe0,0x19,0x4,0x78,0x19,0x8,0x38,0x19,0x0,
+    0x18,0x19,0x4,0xaf,0xb1,0xfc,0x20,0x6d,0x19,0x2,0x80,0x19,0x8,0x40,0xfa,0x19,
+    0x0,0x24,0x19,0x4,0xa4,0xfc,0x2f,0x0,0xb8,0x4f,0x37,0x1,0x98,0x38,0x9f,0x0,
+    0x59,0xa,0x88,0x59,0x1c,0x55,0x91,0x59,0x8,0x90,0x59,0x1c,0x84,0x59,0x8,0x98,
+    0x59,0x1c,0x7f,0x77,0xfc,0x1,0x98,0x78,0x60,0xb0,0x55,0xc,0x55,0xa0,0x55,0x1c,
+    0x66,0x55,0x8,0xa8,0x55,0x1c,0x59,0x55,0x4,0xef,0xb0,0x35,0x0,0x95,0x53,0x6,
+    0x24,0x34,0x21,0xf5,0x0,0x17,0x2,0x4d,0x53,0x0,0xb8,0x60,0x5,0xb0,0xff,0xf0,
+    0xbd,0x0,0x0,0xa0,0x40,0x0,0x0,0xff,0xe0,0x3f,0x6c,0x3d,0x0,0x20,0x8e,0x1c,
+    0xff,0xe2,0x39,0xfb,0xda,0xe1,0x39,0x33,0x22,0xff,0x7a,0x3f,0xcd,0xe0,0xb9,0x39,
+    0x65,0xc,0xff,0x3a,0x3a,0xc,0x38,0xba,0x39,0x92,0x2d,0xff,0xfb,0x3f,0xa4,0x93,
+    0x76,0xbf,0x38,0xe,0xff,0x80,0x3e,0xc2,0x2,0x0,0x3f,0xab,0xee,0xff,0x7f,0x3e,
+    0x87,0xff,0xfd,0x3f,0x16,0x5c,0xff,0x7c,0xbf,0xac,0xb9,0xbb,0x3c,0xf1,0xb5,0xff,
+    0x88,0xb0,0xec,0x22,0x52,0x0,0x86,0x18,0xff,0x61,0x30,0x0,0x78,0x0,0x28,0x10,
+    0xd0,0xff,0x4,0xa8,0x3,0x22,0xb,0x68,0x3,0x60,0xff,0x33,0x60,0x3,0x68,0x73,
+    0x60,0x8,0x36,0xff,0x9,0x1d,0x0,0x1d,0x52,0x1e,0xf5,0xd1,0xff,0x0,0x20,0x8,
+    0x99,0x61,0x31,0x8,0x70,0xff,0x43,0xe0,0x0,0x24,0x4,0xad,0x1,0x91,0xff,0x8,
+    0x98,0xad,0x21,0x89,0x0,0x40,0x18,0xe7,0x3,0x90,0x1,0x9b,0x1,0xc3,0x0,0x60,
+    0x3,0x98,0xff,0x7,0x68,0xfe,0x20,0x80,0x5,0x39,0x0,0xff,0xfb,0xf7,0x4f,0xf8,
+    0x1,0x0,0x2,0x98,0xff,0xfb,0xf7,0xea,0xfa,0x0,0x90,0x39,0x0,0xff,0x30,0x68,
+    0xfb,0xf7,0xe5,0xfa,0x1,0x0,0x7d,0x0,0x11,0x0,0x7a,0xf8,0x28,0x60,0x30,0x2b,
+    0x4,0xaf,0x30,0x1d,0x2,0x90,0x2f,0xa,0x37,0x2f,0x0,0x28,0xea,0x25,0x0,0xd2,
+    0x2f,0x4,0x2,0x51,0x0,0xfb,0xf7,0xcc,0xfa,0x31,0x8,0x61,0x31,0x0,0x2,0x99,
+    0x8,0x60,0x64,0xf7,0x1c,0x8,0x36,0x6b,0x0,0x1d,0x1,0x90,0x2d,0xff,0x1d,0x3,
+    0x2c,0xc3,0xdb,0x8,0x98,0xe4,0xff,0x21,0x49,0x0,0x44,0x18,0x4,0xa8,0xe,0xff,
+    0xc8,0xe,0xc4,0xc,0x3c,0x0,0x25,0x3,0xef,0x26,0x21,0x68,0x8,0x4d,0x0,0xaf,
+    0xfa,0x29,0xfe,0x5,0x0,0xd,0xf8,0x5,0x0,0x24,0x1d,0x76,0xff,0x1e,0xf4,0xd1,
+    0xfb,0xf7,0x73,0xfa,0x8,0xbb,0x99,0xea,0xe7,0x0,0x88,0x50,0x9,0x39,0x1,0xf0,
+    0xff,0xb5,0x85,0xb0,0x7,0x0,0x0,0x24,0x3d,0xff,0x0,0xb8,0x35,0x3,0x26,0x28,
+    0x68,0x1,0xfe,0x2d,0x0,0x95,0xfa,0x21,0x0,0xfa,0xf7,0xf3,0xaf,0xff,0x4,0x0,
+    0x2d,0x33,0x8,0x59,0x8b,0x0,0x1,0xff,0xac,0x3e,0x0,0xc8,0x36,0x4,0x25,0x69,
+    0xff,0x46,0x30,0x0,0xff,0xf7,0x19,0xfb,0x70,0xff,0x68,0x20,0x60,0x18,0x36,0x24,
+    0x1d,0x6d,0xfe,0x11,0x1,0x1,0xa9,0x38,0x0,0x0,0xf0,0x4,0xff,0xf8,0x4,0x0,
+    0x3a,0x0,0xc8,0x32,0x3,0xfb,0xe1,0xf2,0x4b,0x1,0x4,0x0,0x4,0x20,0x69,0xff,
+    0x46,0x8,0x76,0x0,0x20,0x4,0x90,0x8,0xff,0x98,0x3,0x90,0x94,0x20,0x40,0x0,
+    0x20,0xff,0x18,0x0,0x90,0x20,0x0,0xc8,0x30,0x2,0xfb,0x90,0x3,0xd7,0x0,0x1,
+    0x90,0x1,0x28,0x12,0xff,0xd1,0x0,0x25,0x26,0x0,0xb8,0x36,0x3,0xeb,0x27,0x31,
+    0xaf,0x4,0x57,0xaf,0x0,0xfa,0xf7,0xb5,0xbf,0xff,0x5,0x0,0x36,0x1d,0x7f,0x7b,
+    0x4,0x1b,0xfb,0xfa,0x0,0xf1,0x0,0x1,0x98,0xc4,0x21,0x61,0xff,0x5c,0x4a,0x0,
+    0x51,0x18,0x88,0x42,0x1d,0xaa,0x33,0x18,0x3d,0x33,0x4,0x9b,0x33,0x10,0x1,0x2f,
+    0x5,0x0,0x9f,0x68,0xfa,0xf7,0xc8,0xff,0x3d,0x2,0xb,0x2,0x40,0xf7,0x0,0x40,
+    0x8,0x49,0xe,0x49,0x0,0x88,0x42,0xaa,0x7b,0xe,0x30,0xf7,0x4,0x19,0x47,0x4,
+    0x77,0x47,0x10,0xdd,0xdd,0xf9,0x31,0x0,0x61,0x1,0xa9,0x85,0x1,0xf0,0x50,0xfd,
+    0xfb,0x71,0x1,0x99,0x8,0x63,0x0,0x20,0x5,0xff,0xa9,0x2,0x9a,0x10,0x32,0x4,
+    0xe0,0x13,0xff,0x68,0xb,0x60,0x40,0x1c,0x12,0x1d,0x9,0xff,0x1d,0x2,0x9b,0x1b,
+    0x68,0x98,0x42,0xf6,0xfb,0xd3,0x5,0x21,0x2,0x62,0x4,0x98,0x40,0x1c,0x9f,0x4,
+    0x90,0x2,0x98,0x18,0xe7,0x0,0x79,0x0,0x1d,0xfd,0x0,0xed,0x2,0x1d,0x3,0x90,
+    0x4,0x98,0x4,0xbf,0x28,0x82,0xdb,0x8,0x99,0x20,0x2b,0x1,0x44,0xeb,0xf8,0x80,
+    0xd,0x1,0x94,0xb5,0x1,0x45,0x18,0x2e,0xff,0x69,0xae,0x20,0x80,0x0,0x24,0x18,
+    0x67,0xef,0x68,0x30,0x0,0x39,0x81,0x0,0x6e,0xff,0x0,0xfd,0x21,0x85,0x1,0xfb,
+    0x2d,0xd2,0x2a,0x6a,0x10,0xfb,0x0,0x21,0xc5,0x0,0xbd,0xff,0x27,0xd2,0x38,0xfb,
+    0x0,0x11,0x1b,0x0,0xb8,0xff,0x22,0xd2,0x30,0xfb,0x0,0xa1,0x13,0x0,0xb3,0xff,
+    0x1d,0xd2,0xe0,0xfb,0x68,0x31,0x13,0x0,0xae,0xff,0x18,0xd2,0x2a,0xfd,0x6b,0x29,
+    0x0,0x69,0xfa,0xf7,0xa8,0xff,0x12,0xf7,0xd2,0x60,0x69,0x29,0x2,0xa3,0xff,0xd,
+    0xd2,0xdf,0x2a,0x68,0x10,0x0,0xa1,0x15,0x0,0x9d,0xff,0xf7,0x7,0xd2,0xe0,0x15,
+    0x4,0x98,0xff,0x2,0xd2,0xfd,0x0,0x97,0x5,0x68,0x46,0x0,0x7e,0x9,0xb0,0xff,
+    0xf0,0xbd,0x10,0xb4,0x0,0x20,0xa,0x68,0xff,0x1,0x23,0x9,0x1d,0xc,0x68,0xa2,
+    0x42,0xff,0x1,0xd2,0x22,0x0,0x18,0x0,0x5b,0x1c,0xff,0x9,0x1d,0x4,0x2b,0xf6,
+    0xdb,0x10,0xbc,0xff,0x70,0x47,0xf0,0xb5,0x85,0xb0,0x7,0x0,0xfd,0xea,0xbd,0x1,
+    0x38,0x58,0x0,0x90,0x1,0xac,0xfd,0xb4,0x9,0x0,0x3e,0x18,0x4,0x25,0x69,0x46,
+    0xff,0x30,0x0,0xff,0xf7,0x15,0xfa,0x70,0x68,0xff,0x20,0x60,0x18,0x36,0x24,0x1d,
+    0x6d,0x1e,0xdf,0xf5,0xd1,0x1,0xa9,0x38,0xdb,0x0,0xb,0xf8,0xdb,0x4,0x0,0x25,
+    0x2,0x3a,0x18,0xf,0x6,0x2e,0xfa,0xf7,0x20,0x0,0x5,0x69,0x0,0xf3,0xb5,0x87,
+    0xb0,0xfd,0x4,0x7b,0x2,0x74,0x0,0x20,0x1,0x90,0x7,0xbb,0x98,0xf8,0xfd,0x0,
+    0x40,0x18,0x0,0x9,0x0,0x88,0xdf,0x39,0x44,0x18,0x3,0xa9,0x17,0x3,0x9d,0xfa,
+    0xfc,0x2b,0x1,0xb1,0x3,0x20,0x2,0xa9,0x22,0x0,0x8,0x9a,0x65,0x15,0x23,0x63,
+    0x1,0xf7,0xd3,0x8b,0x1,0x63,0x1,0x0,0x77,0x25,0x7,0x9e,0xb9,0x3,0x31,0x68,
+    0x8,0xb9,0x1,0xdb,0x3c,0xf9,0xb9,0x3,0x9a,0xfe,0xb9,0xf,0x0,0xf9,0xdb,0x5,
+    0x90,0x23,0x0,0x98,0xe4,0x63,0x0,0x46,0x18,0xea,0xe1,0xb,0x28,0x27,0x4,0x86,
+    0x27,0x10,0xec,0xf8,0x1,0xff,0x0,0x5,0x98,0xfa,0xf7,0xb4,0xfe,0x40,0xe7,0x0,
+    0x40,0x8,0xed,0x5,0xbd,0x1,0x1,0x90,0x18,0xd5,0x34,0xb9,0x7,0x1,0xb3,0x1,
+    0xb1,0xb3,0x1,0x7,0x98,0xff,0xff,0xf7,0x6a,0xff,0x7,0x99,0x80,0x0,0xfb,0x8,
+    0x18,0xb7,0x2,0x42,0x18,0x11,0x68,0x7,0xff,0x98,0xb8,0x23,0x9b,0x0,0xc3,0x18,
+    0x58,0xfe,0x8d,0x1,0xec,0xfe,0x1b,0xd2,0x8,0x0,0x19,0xfe,0x9,0x0,0xe7,0xfe,
+    0x16,0xd2,0x11,0x69,0xd8,0xae,0x9,0x0,0xe2,0xfe,0x11,0x13,0x0,0x99,0x9,0x0,
+    0xdd,0xbf,0xfe,0xc,0xd2,0x11,0x6a,0x58,0x89,0x1,0xd8,0xb3,0xfe,0x7,0x27,0x2,
+    0x9,0x0,0xd3,0xfe,0x89,0x9,0x74,0x6a,0x89,0x1,0x7c,0x89,0x3,0xf0,0x1f,0x1,
+    0x7,0x0,0x1b,0x3,0xbd,0xe4,0x3d,0x5,0x39,0x0,0xb8,0x31,0x1b,0x0,0xf0,0xf7,
+    0x38,0xfa,0x0,0xa1,0x0,0xcd,0xfb,0x12,0x49,0xff,0xfb,0xf7,0xc7,0xf8,0x1,0x90,
+    0x2,0xac,0xb7,0x88,0x20,0x80,0x83,0x5,0x1,0xa9,0x83,0x3,0x53,0xfd,0xf9,0x83,
+    0x15,0x98,0x0,0x90,0x6a,0x46,0x2,0xb2,0x79,0x5,0xd,0x89,0x1,0x2b,0x2,0x3a,
+    0x18,0xf,0x6,0x69,0xef,0xf9,0x20,0x0,0x7,0x69,0x0,0xe6,0x2e,0x65,0xef,0x42,
+    0xf7,0xb5,0x86,0x8d,0x7,0x75,0x0,0x20,0x7f,0x4,0x90,0x6,0x98,0xa0,0x21,0x89,
+    0x8d,0x1,0xea,0x97,0x3,0x3,0xd,0x0,0x60,0x91,0x1,0x60,0x68,0x0,0xcf,0x90,
+    0x2,0x28,0x9,0xa5,0x0,0x8b,0x1,0x68,0x90,0xbf,0x42,0x1a,0xd2,0x0,0x22,0xa,
+    0x8b,0x1,0x9,0xff,0x1d,0xf7,0xe7,0x0,0x26,0x27,0x0,0xc,0xff,0x37,0x2,0xad,
+    0xd,0xe0,0x0,0x98,0x40,0xff,0x1e,0xfc,0xf7,0x44,0xff,0x1,0x0,0x38,0xff,0x68,
+    0xfb,0xf7,0x76,0xfb,0xfb,0xf7,0x42,0xff,0xf8,0x28,0x60,0x76,0x1c,0x2d,0x1d,0x3f,
+    0xbf,0x1d,0x20,0x68,0x86,0x42,0xee,0xb1,0x1,0x1,0xbe,0xd1,0x5,0x69,0x46,0x22,
+    0x0,0x10,0xd1,0x21,0x0,0xfa,0x1f,0x2,0x61,0xf7,0x1,0x68,0x6,0x99,0x89,0x6e,
+    0x9f,0x88,0x42,0x3,0xd1,0x8,0xb,0x0,0x13,0x0,0x62,0x65,0x4,0x8b,0x1,0x4,
+    0x8b,0x1,0x1b,0x0,0x1d,0x3,0x8b,0x1,0xdf,0x0,0x1d,0x1,0x90,0x4,0x91,0x5,
+    0x7,0x99,0xfd,0x6,0x91,0x1,0xa1,0xfe,0x3,0x0,0x6,0x98,0xfd,0xbe,0xb9,0x0,
+    0x42,0x18,0x8,0x98,0x4,0x68,0xf7,0x20,0x0,0x11,0x6d,0x1,0x26,0xfe,0x2e,0xd2,
+    0xf7,0x50,0x68,0x21,0xe9,0x1,0x21,0xfe,0x29,0xd2,0xe7,0x6,0x98,0x99,0xd7,0x0,
+    0xdd,0x2,0x43,0x18,0x1c,0xfa,0x21,0x0,0x91,0x21,0x0,0x15,0xfe,0x1d,0xd2,0xd0,
+    0x7e,0x21,0x4,0x10,0xfe,0x18,0xd2,0x1c,0x69,0x37,0x0,0x7e,0x91,0x1,0xa,0xfe,
+    0x12,0xd2,0x50,0x69,0x15,0x2,0xff,0x5,0xfe,0xd,0xd2,0x1b,0x6a,0x18,0x0,0xfd,
+    0x91,0x15,0x0,0xff,0xfd,0x7,0xd2,0xd0,0x69,0xad,0x19,0x15,0x0,0xfa,0xfd,0xb1,
+    0x9,0x75,0x95,0x1,0x7d,0xfe,0xb1,0x3,0xcc,0x30,0x4,0x21,0x0,0x22,0x2,0xff,
+    0x60,0xa0,0x23,0xc2,0x50,0xb8,0x33,0xc2,0xff,0x50,0x18,0x30,0x49,0x1e,0xf7,0xd1,
+    0x70,0xff,0x47,0x38,0xb5,0x4,0x0,0xd,0x0,0x14,0xff,0x21,0x28,0x68,0xf9,0xf7,
+    0xfb,0xfc,0x20,0xef,0x60,0x14,0x21,0x68,0x9,0x0,0xf6,0xfc,0x60,0xba,0x9,0x0,
+    0xa8,0x9,0x0,0xf1,0xfc,0xa0,0x9,0x0,0xe8,0xee,0x9,0x0,0xec,0xfc,0xe0,0x9,
+    0x0,0x28,0x69,0xf9,0x9f,0xf7,0xe7,0xfc,0x20,0x61,0x27,0x0,0x9,0x0,0xe2,0xeb,
+    0xfc,0x60,0x9,0x0,0xa8,0x9,0x0,0xdd,0xfc,0xa0,0xba,0x9,0x0,0xe8,0x9,0x0,
+    0xd8,0xfc,0xe0,0x9,0x0,0x28,0x7f,0x6a,0xf9,0xf7,0xd3,0xfc,0x20,0x62,0x27,0x0,
+    0xae,0x9,0x0,0xce,0xfc,0x60,0x9,0x0,0xa8,0x9,0x0,0xc9,0xeb,0xfc,0xa0,0x9,
+    0x0,0xe8,0x9,0x0,0xc4,0xfc,0xe0,0xfe,0x9,0x0,0x28,0x6b,0xf9,0xf7,0xbf,0xfc,
+    0x20,0xb9,0x63,0x27,0x0,0x9,0x0,0xba,0xfc,0x60,0x9,0x0,0xa8,0xae,0x9,0x0,
+    0xb5,0xfc,0xa0,0x9,0x0,0xe8,0x9,0x0,0xb0,0xfb,0xfc,0xe0,0x9,0x0,0x28,0x6c,
+    0xf9,0xf7,0xab,0xe7,0xfc,0x20,0x64,0x27,0x0,0x9,0x0,0xa6,0xfc,0x60,0xba,0x9,
+    0x0,0xa8,0x9,0x0,0xa1,0xfc,0xa0,0x9,0x0,0xe8,0xee,0x9,0x0,0x9c,0xfc,0xe0,
+    0x9,0x0,0x28,0x6d,0xf9,0x9f,0xf7,0x97,0xfc,0x20,0x65,0x27,0x0,0x9,0x0,0x92,
+    0xeb,0xfc,0x60,0x9,0x0,0xa8,0x9,0x0,0x8d,0xfc,0xa0,0xfa,0x9,0x0,0xe8,0x9,
+    0x0,0x88,0xfc,0xe0,0x65,0xae,0xff,0x20,0x80,0x0,0x20,0x18,0x21,0x68,0x1,0xff,
+    0x60,0x61,0x68,0x41,0x60,0xa1,0x68,0x81,0xff,0x60,0xe1,0x68,0xc1,0x60,0x21,0x69,
+    0x1,0xff,0x61,0x61,0x69,0x41,0x61,0xa1,0x69,0x81,0xff,0x61,0xe1,0x69,0xc1,0x61,
+    0x21,0x6a,0x1,0xff,0x62,0x61,0x6a,0x41,0x62,0xa1,0x6a,0x81,0xff,0x62,0xe1,0x6a,
+    0xc1,0x62,0x21,0x6b,0x1,0xff,0x63,0x61,0x6b,0x41,0x63,0xa1,0x6b,0x81,0xff,0x63,
+    0xe1,0x6b,0xc1,0x63,0x21,0x6c,0x1,0xff,0x64,0x61,0x6c,0x41,0x64,0xa1,0x6c,0x81,
+    0xff,0x64,0xe1,0x6c,0xc1,0x64,0x21,0x6d,0x1,0xff,0x65,0x61,0x6d,0x41,0x65,0xa1,
+    0x6d,0x81,0xff,0x65,0xe1,0x6d,0xc1,0x65,0x31,0xbd,0x0,0xff,0x22,0xa,0x60,0x6c,
+    0x30,0x0,0x78,0x8,0xff,0x71,0x8a,0x60,0x70,0x47,0x10,0xb4,0xc4,0xff,0x30,0xb,
+    0x68,0x4,0x78,0xa3,0x42,0x1,0xbf,0xd1,0x0,0x23,0xd3,0x61,0x4b,0xb,0xc,0x53,
+    0xfb,0x63,0x8b,0x17,0xe,0x64,0x9,0x68,0x0,0x78,0xf7,0x80,0x0,0x81,0xd,0x2,
+    0x20,0x50,0x60,0x10,0xff,0xbc,0x70,0x47,0x0,0x21,0x1,0x60,0x41,0xff,0x60,0x81,
+    0x60,0xc1,0x60,0x1,0x61,0x41,0xff,0x61,0x81,0x61,0xc1,0x61,0x1,0x62,0x41,0xff,
+    0x62,0x81,0x62,0xc1,0x62,0x1,0x63,0x41,0xff,0x63,0x81,0x63,0xc1,0x63,0x1,0x64,
+    0x41,0xff,0x64,0x81,0x64,0xc1,0x64,0x1,0x65,0x41,0xdf,0x65,0x81,0x65,0xc1,0x65,
+    0x33,0x0,0x0,0x0,0xff,0x18,0xe,0xd2,0x1,0xe,0x7f,0x39,0xb,0xff,0xd4,0x49,
+    0x42,0x1f,0x31,0x5,0xd4,0xc0,0xff,0x1,0x1,0x22,0xd2,0x7,0x10,0x43,0xc8,0xdd,
+    0x40,0x1d,0x0,0x20,0x40,0x1e,0x5,0x2,0x70,0x47,0xff,0xf8,0xb5,0x84,0xb0,0x4,
+    0x0,0xd,0x0,0xff,0x17,0x0,0xa,0x9e,0x70,0x68,0x3,0x90,0xff,0x30,0x68,0x2,
+    0x90,0x79,0x68,0x3,0x98,0xff,0xfa,0xf7,0xe6,0xfe,0x0,0x90,0x39,0x68,0xfd,0x2,
+    0x9,0x0,0xe1,0xfe,0x7,0x0,0x4,0x98,0xff,0x1,0x68,0x20,0x68,0xfa,0xf7,0xdb,
+    0xfe,0xff,0x39,0x0,0xfa,0xf7,0x39,0xfc,0x0,0x99,0x7f,0xfa,0xf7,0x36,0xfc,0x7,
+    0x0,0xa9,0x2b,0x4,0x5f,0xd0,0xfe,0x1,0x90,0x69,0x2b,0x4,0xcb,0x35,0x0,0xdb,
+    0x28,0x68,0x23,0x2,0xc6,0xfe,0x23,0x2,0x24,0xfc,0xfd,0x1,0x5,0x0,0x21,0xfc,
+    0x20,0x60,0x30,0x68,0xff,0x70,0x60,0x37,0x60,0x5,0xb0,0xf0,0xbd,0xff,0xf8,0xb5,
+    0x7,0x0,0x78,0x68,0x0,0x90,0xff,0x0,0x26,0x2,0x28,0x7,0xd2,0x0,0x20,0xff,
+    0x3a,0x68,0x96,0x42,0x18,0xd2,0x8,0x60,0xff,0x76,0x1c,0x9,0x1d,0xf8,0xe7,0x3c,
+    0x0,0xff,0xc,0x34,0xd,0x0,0xd,0xe0,0x0,0x98,0xff,0x40,0x1e,0xfc,0xf7,0x6c,
+    0xfd,0x1,0x0,0xff,0x20,0x68,0xfb,0xf7,0x9e,0xf9,0xfa,0xf7,0xf7,0x6a,0xfe,0x28,
+    0x23,0x0,0x2d,0x1d,0x24,0x1d,0xff,0x38,0x68,0x86,0x42,0xee,0xd3,0xf1,0xbd,0xff,
+    0xf7,0xb5,0x82,0xb0,0x0,0x25,0xe,0x46,0x7f,0x3,0x24,0x3,0x27,0x31,0x68,0x8,
+    0x75,0x0,0xf7,0x8b,0xfe,0x29,0x5,0x0,0xe9,0xfb,0x5,0x0,0xff,0x36,0x1d,0x7f,
+    0x1e,0xf4,0xd1,0xfa,0xf7,0xff,0x4f,0xfe,0x5,0x0,0x0,0x26,0x4,0x9f,0x77,0x38,
+    0x68,0x1,0x19,0x0,0x7b,0xfe,0x31,0x5,0x0,0x7f,0xd9,0xfb,0x6,0x0,0x3f,0x1d,
+    0x64,0x1f,0x4,0xff,0x3f,0xfe,0x4,0x0,0x4,0x99,0x3,0x98,0xff,0x0,0xf0,0x2a,
+    0xf8,0x6,0x0,0x0,0x20,0xff,0x2,0x99,0x8,0x60,0x11,0x48,0x1,0x90,0xff,0xfe,
+    0x20,0x80,0x5,0x0,0x90,0x20,0x0,0xfe,0x4f,0x2,0x60,0xfe,0x1,0x0,0x30,0x0,
+    0xfb,0xff,0xf7,0x5b,0xf9,0x2,0x0,0x2,0x98,0x2,0xff,0x60,0x10,0x0,0x0,0x99,
+    0xfb,0xf7,0x18,0xff,0xf8,0x1,0xd8,0x68,0x46,0x7,0xe0,0x1,0xfb,0x98,0x11,0x1b,
+    0x0,0x11,0xf8,0x1,0xd9,0x2,0x7f,0x98,0x0,0xe0,0x1,0xa8,0x0,0x68,0x43,0x2,
+    0xfe,0xe9,0x2,0x0,0x0,0x80,0xbf,0xf8,0xb5,0x0,0xff,0x24,0x5,0x0,0xe,0x0,
+    0x3,0x27,0x29,0xbb,0x68,0x30,0x41,0x1,0x3a,0xfe,0x21,0x51,0x0,0x98,0xeb,0xfb,
+    0x4,0xa1,0x0,0x2d,0xa3,0x0,0xf3,0xd1,0xf2,0xff,0xbd,0x80,0xb5,0x0,0xf0,0x19,
+    0xff,0x2,0xef,0xbd,0xf0,0xb5,0xcf,0x8d,0x1,0x37,0xa8,0xed,0xff,0xf7,0x2c,0xf8,
+    0x25,0x0,0x8,0x35,0x37,0xff,0xa8,0x1,0x6b,0x69,0x60,0xc1,0x6a,0xa9,0xff,0x60,
+    0x1,0x8d,0xa9,0x81,0x34,0x30,0x0,0xff,0x78,0x28,0x74,0x28,0x68,0x0,0x28,0x4,
+    0xff,0xd0,0x37,0xa9,0x18,0x31,0x10,0x22,0xf5,0x5f,0xf7,0x80,0xf8,0x68,0x69,0xf,
+    0x6,0x38,0xf,0x4,0xd7,0x78,0xf8,0xa8,0xf,0x8,0x48,0xf,0x4,0x70,0xf8,0xff,
+    0x15,0xa8,0x0,0xf0,0x13,0xff,0x10,0xa8,0xdf,0x1,0xf0,0x30,0xf9,0x9,0x5,0x0,
+    0x11,0xfb,0xdd,0x4,0x5,0x0,0x70,0xfc,0x27,0x5,0x0,0x26,0xfe,0x7f,0x2,0xa8,
+    0x2,0xf0,0xf2,0xf8,0xc,0x5,0x0,0xff,0x5d,0xfa,0x68,0x46,0x2,0xf0,0x26,0xfd,
+    0xfd,0x1a,0xb,0x0,0xd8,0xfe,0x6,0xa8,0x3,0xf0,0xf7,0x16,0xfa,0xe8,0x4b,0x0,
+    0x3,0xd0,0x15,0xa9,0xbd,0x14,0x49,0x0,0x4b,0xf8,0x28,0x6a,0xd,0x2,0x10,0xfe,
+    0xd,0x4,0x44,0xf8,0x26,0x0,0x40,0x36,0x70,0xfe,0x11,0x0,0x2,0xd0,0x9,0xa9,
+    0x8c,0xc9,0x8c,0xff,0xc0,0xb2,0x6a,0x0,0x2a,0x2,0xd0,0x4,0xbf,0xa8,0x3,0xc8,
+    0x3,0xc2,0xf0,0x29,0x4,0x27,0x7b,0xa9,0x40,0x29,0x0,0x2f,0xf8,0x32,0x6b,0x19,
+    0x2,0xb5,0x2,0x19,0x6,0x6b,0x19,0x2,0xc,0xa9,0x9b,0x2,0x22,0xdb,0xf8,0xb2,
+    0x19,0x4,0x68,0x46,0x19,0x2,0x80,0x34,0x7d,0x60,0xd9,0x0,0x3,0xd0,0x1a,0xa9,
+    0x34,0x1b,0x0,0x77,0x14,0xf8,0xa0,0xd,0x0,0x2,0xd0,0x6,0x5b,0x4,0xff,0x0,
+    0x20,0xa8,0x73,0xe8,0x73,0x30,0x70,0xff,0x70,0x70,0xb0,0x70,0xf0,0x70,0xfa,0x20,
+    0xff,0x80,0x1,0x70,0x60,0x1,0x20,0x20,0x70,0xf9,0x4f,0x63,0x1,0x3b,0x3,0x3b,
+    0xfe,0x3,0xf0,0x87,0x7f,0xfd,0x1,0x20,0x10,0x49,0x8,0x70,0xc1,0x1,0xfe,0x13,
+    0x0,0xe,0x4a,0x13,0x78,0x0,0x2b,0x3,0xff,0xd0,0x2,0x2b,0x8,0xd0,0x2,0xd3,
+    0x8,0xfb,0xe0,0x11,0x15,0x0,0x2,0x23,0x13,0x70,0x3,0xbf,0xf0,0xba,0xfd,0x2,
+    0xbd,0x12,0xd,0x0,0x26,0xfe,0x27,0x4,0x4,0x4a,0x12,0x78,0x2,0x2a,0x1,0xbb,
+    0xd8,0x1f,0xd,0x0,0x3,0xf0,0xb3,0x1b,0x0,0x78,0xff,0x46,0x0,0x20,0x80,0xb5,
+    0x3,0xf0,0xb9,0xfe,0xb,0x0,0x30,0xb5,0x93,0xb0,0x5,0x0,0xc,0xff,0x0,0x3,
+    0xf0,0xd4,0xfd,0x0,0x90,0x3,0xef,0xf0,0xd8,0xfd,0x1,0x5,0x0,0x38,0xfe,0x2,
+    0xee,0x5,0x0,0x3c,0xfe,0x3,0x5,0x0,0x63,0xfe,0x4,0xfe,0x5,0x0,0x67,0xfe,
+    0x5,0x90,0x30,0x35,0x29,0xef,0x68,0x0,0x29,0x1,0xcd,0x0,0x9,0xe0,0x2a,0x7f,
+    0x7c,0x0,0xbf,0x3c,0xa1,0x0,0x2a,0xd9,0x0,0xff,0xd0,0x18,0x30,0x12,0x1,0x89,
+    0x18,0x0,0xff,0xe0,0x18,0x30,0x10,0x22,0xf4,0xf7,0xa8,0xfb,0xff,0x69,0x25,0x8,
+    0x8,0xe0,0x6a,0x7c,0x33,0xea,0x23,0x8,0x38,0x23,0x8,0x38,0x23,0x4,0x96,0xff,
+    0xa9,0xae,0x23,0xc,0xaa,0x7c,0x2a,0x23,0x8,0x28,0x23,0x8,0x28,0xfe,0x23,0x4,
+    0x84,0xff,0x22,0x0,0x88,0x21,0x49,0xff,0x0,0x68,0x46,0x4,0xf0,0xc1,0xfa,0x0,
+    0xff,0x28,0x0,0xd0,0xf,0x20,0x13,0xb0,0x30,0xbf,0xbd,0x0,0x0,0x70,0xb5,0x92,
+    0xb3,0x8,0xba,0xea,0xb3,0x4,0xbe,0xb3,0x0,0x3c,0x9b,0x0,0x18,0xa6,0x0,0xfd,
+    0x29,0x6b,0x3,0x18,0x30,0x9,0xe0,0xe9,0x79,0xfb,0x0,0x29,0x9b,0x6,0x9,0x1,
+    0x71,0x18,0x1,0xf6,0x9b,0x0,0x31,0x0,0x55,0x2,0x59,0xff,0x0,0x25,0x7f,0x2,
+    0x95,0x3,0x95,0x68,0x46,0x38,0x11,0x0,0xfb,0x20,0x31,0x13,0x2,0x4f,0xff,0x4,
+    0x95,0x5,0x5e,0x11,0x0,0x28,0x30,0x20,0x36,0x25,0x6,0x46,0x7b,0x10,0x7d,0x83,
+    0x7b,0x4,0x10,0x20,0x12,0xb0,0x70,0x7b,0x0,0xfa,0x0,0x18,0x40,0x8,0xa,0x35,
+    0xc3,0xbe,0xd2,0xcb,0x7,0x3c,0x41,0x2d,0x1b,0x22,0x0,0x2,0x1b,0x2,0x1f,0x8,
+    0x17,0x2a,0xe2,0x0,0x12,0xc0,0x1f,0x12,0x5b,0x2,0xf,0xa,0xf0,0xb5,0xff,0xfb,
+    0xb0,0xce,0xfd,0x0,0x0,0x26,0x0,0x27,0x3,0xff,0x4c,0x20,0x78,0x2,0x28,0x5,
+    0xd9,0xc0,0x7f,0x1e,0x5,0xd0,0xc,0xe0,0x0,0xbf,0xd7,0x3,0xff,0x13,0x20,0xd7,
+    0xe1,0x4,0x20,0x20,0x70,0xff,0x68,0x6c,0xa0,0x63,0x28,0x68,0x0,0x28,0xff,0x2,
+    0xd0,0x9,0xe0,0x27,0x20,0xcd,0xe1,0xff,0x88,0xa9,0x28,0x0,0xff,0xf7,0x8,0xff,
+    0xff,0x6,0x0,0x0,0xd0,0xc6,0xe1,0x88,0xa8,0xff,0x8,0x90,0xe8,0x6a,0x0,0x28,
+    0x5,0xd1,0xf5,0x44,0x17,0x4,0x56,0x17,0x0,0x44,0xa8,0x11,0x90,0xfe,0xf3,0x2,
+    0x8,0x98,0x4,0xf0,0xad,0xfb,0x0,0x5f,0x14,0x69,0x46,0x88,0x81,0xf,0xa,0xac,
+    0xf,0x4,0xfb,0x48,0x80,0xf,0xa,0xab,0xfb,0x81,0x0,0x8,0xff,0x18,0x40,0x0,
+    0x69,0x46,0x8,0x80,0xa9,0xff,0x7d,0x68,0x46,0x80,0x89,0x3,0xf0,0x99,0xff,0xfc,
+    0x0,0x28,0x1,0xd0,0x1,0x20,0x97,0xff,0xe1,0x68,0x46,0x40,0x88,0x3,0xf0,0xfa,
+    0xae,0xf,0x4,0x2,0x20,0x8f,0xf,0x0,0x0,0xf,0x0,0x1c,0xfd,0xfd,0xf,0x2,
+    0x3,0x20,0x87,0xe1,0x11,0x98,0xef,0x0,0x28,0x4,0xd0,0x4b,0x2,0x4,0xf0,0x78,
+    0xff,0xfb,0x7,0x14,0x0,0x21,0xb8,0xb2,0x3,0xfb,0xf0,0xa2,0x2f,0x4,0xc,0x20,
+    0x77,0xe1,0x20,0xf9,0x69,0x9,0x2,0x65,0x2,0x0,0x20,0x20,0x61,0x8,0xff,0x98,
+    0x3,0x78,0x41,0x78,0x9,0x6,0x9,0xff,0xc,0xb,0x43,0x2,0x46,0x69,0x6f,0x20,
+    0x7f,0x0,0x10,0x30,0x4,0xf0,0x79,0xfb,0x23,0x2,0xff,0x1d,0x20,0x60,0xe1,0xa8,
+    0x6f,0x0,0x28,0xff,0x3,0xd0,0x3,0xc8,0x1,0xaa,0x3,0xc2,0xff,0x2,0xe0,0x1,
+    0xa8,0x2,0xf0,0x35,0xfb,0xd9,0xe0,0xf9,0x0,0x7b,0x0,0xf0,0x4b,0x41,0x0,0xe0,
+    0x60,0xff,0x1,0xa9,0x20,0x0,0xc,0x30,0x2,0xf0,0xfd,0x2a,0x33,0x4,0x22,0x20,
+    0x46,0xe1,0x80,0x20,0xff,0x20,0x71,0x69,0x6a,0x0,0x29,0x22,0xa8,0xf7,0x3,0xd0,
+    0x14,0xef,0x1,0x4e,0xfe,0x1,0xe0,0xdf,0x0,0xf0,0xf1,0xfc,0x60,0x79,0x4,0x0,
+    0xf0,0x7f,0xc,0xfd,0x0,0x20,0x60,0x61,0x22,0x37,0x0,0xdf,0x14,0x30,0x0,0xf0,
+    0xe9,0x99,0x4,0xa,0x20,0x57,0x2a,0xe1,0xa9,0x33,0x0,0x1d,0x33,0x8,0x34,0x33,
+    0x4,0xf7,0xf7,0xfe,0xa0,0x33,0x8,0x13,0xff,0x0,0x20,0xd7,0xa0,0x61,0x1d,0x33,
+    0x0,0x18,0x33,0x0,0xef,0xfe,0x7e,0x15,0x2,0xb,0x20,0x10,0xe1,0x68,0x6e,0x9f,
+    0x2,0xff,0x1a,0xa9,0x8c,0xc8,0x8c,0xc1,0x2,0xe0,0x7f,0x1a,0xa8,0x1,0xf0,0xc1,
+    0xf8,0xe0,0x33,0x4,0x6f,0x1,0xf0,0xde,0xf8,0x9f,0x0,0x61,0x1a,0x33,0x0,0xbf,
+    0x1c,0x30,0x1,0xf0,0xb9,0xf8,0x15,0x2,0x1a,0xef,0x20,0xf6,0xe0,0xa8,0x33,0x4,
+    0x3,0xc8,0x6,0x3a,0xd3,0x4,0x6,0x33,0x0,0x9,0xfa,0x20,0xaf,0x1,0x33,0x2,
+    0x5b,0x29,0xfa,0x15,0x1,0x62,0x6,0x33,0x0,0x20,0x33,0x0,0xfb,0x1,0xfa,0x15,
+    0x2,0x23,0x20,0xdc,0xe0,0xe9,0xaf,0x6e,0x0,0x29,0x34,0x9b,0x0,0x40,0x9b,0x0,
+    0xe6,0xff,0xfd,0x1,0xe0,0x1,0xf0,0xa8,0xfb,0x60,0xba,0x33,0x8,0xc8,0x7,0x1,
+    0x60,0x62,0x34,0x33,0x0,0x24,0xfa,0x33,0x0,0xa0,0x7,0x5,0x1b,0x20,0xc2,0xe0,
+    0x28,0xea,0x3b,0x9,0x4,0x67,0x4,0x4,0x67,0x0,0x5d,0xfe,0xa0,0xb6,0x33,0x8,
+    0x7f,0xfe,0xcf,0x0,0x62,0x4,0x33,0x0,0x28,0xfa,0x33,0x0,0x5e,0xcf,0x4,0x1c,
+    0x20,0xa8,0xe0,0xe9,0xaf,0x6f,0x0,0x29,0x16,0x67,0x0,0x10,0x67,0x0,0xb2,0xae,
+    0x67,0x4,0xb1,0xff,0xe0,0x33,0x8,0xd1,0x3,0x1,0xe0,0x6b,0x62,0x16,0x33,0x0,
+    0x2c,0x33,0x0,0xa9,0xff,0x15,0x2,0xff,0x20,0x20,0x8e,0xe0,0x2f,0x0,0x80,0x37,
+    0x5f,0x79,0x68,0x0,0x29,0x27,0x37,0x0,0x34,0x37,0x0,0xfd,0x96,0x37,0x0,0x2,
+    0xf0,0x16,0xfc,0x20,0x6b,0xb6,0xa7,0x7,0x36,0xfc,0xd3,0x0,0x63,0x27,0x37,0x0,
+    0x30,0xfa,0xa7,0x1,0xe,0x6f,0x5,0x24,0x20,0x72,0xe0,0xb8,0xfe,0xc7,0x1,0x5,
+    0xd0,0x13,0xa9,0xc,0xc8,0xc,0xff,0xc1,0x2,0x68,0xa,0x60,0x2,0xe0,0x13,0xae,
+    0xdf,0x1,0x3b,0xff,0x60,0x37,0x8,0x5b,0x6f,0x0,0x60,0xff,0x63,0x13,0xa9,0x34,
+    0x34,0x20,0x0,0x2,0xfb,0xf0,0x33,0x6f,0x4,0x2b,0x20,0x56,0xe0,0x68,0xff,0x68,
+    0x9,0x90,0xa8,0x68,0xa,0x90,0xa8,0xff,0x8a,0x8,0xa9,0x88,0x81,0x28,0x69,0xc,
+    0xff,0x90,0xe8,0x68,0xd,0x90,0x28,0x7e,0x8,0xff,0x76,0xe8,0x69,0xf,0x90,0x28,
+    0x6a,0x10,0xff,0x90,0x38,0x78,0x28,0x31,0x8,0x70,0x8,0xff,0xa8,0x4,0xf0,0x56,
+    0xfd,0x1,0x28,0x1,0xbf,0xd1,0x4,0x20,0x3b,0xe0,0x2,0x7,0x0,0x5,0xff,0x20,
+    0x37,0xe0,0x4,0x28,0x3,0xd1,0x0,0xff,0x2e,0x5,0xd1,0xd,0x20,0x31,0xe0,0x5,
+    0xfe,0x13,0x0,0xe,0x20,0x2d,0xe0,0x0,0x22,0xa9,0xbf,0x6c,0xb0,0x48,0x3,0xf0,
+    0xea,0x3b,0x5,0x14,0xfb,0x20,0x24,0x11,0x2,0x6d,0x64,0x20,0x3,0xf0,0x5d,0xf4,
+    0x11,0x4,0x16,0x20,0x1b,0x11,0x0,0x29,0x11,0x4,0xfd,0xb,0xbf,0x4,0x18,0x20,
+    0x12,0xe0,0x2a,0x6e,0xd7,0x69,0x6d,0x14,0x11,0x0,0x15,0x11,0x4,0x17,0x20,0x7f,
+    0x9,0xe0,0xea,0x6d,0xe9,0x6c,0x9f,0x47,0x0,0xfd,0x21,0x11,0x4,0x15,0x20,0x0,
+    0xe0,0x30,0x0,0xff,0x7f,0xb0,0x4e,0xb0,0xf0,0xbd,0x70,0xb5,0xff,0x4,0x0,0xd,
+    0x0,0x16,0x0,0x99,0x48,0xf7,0x0,0x78,0x4,0x1b,0x0,0x28,0x20,0x70,0xbd,0xdf,
+    0x97,0x48,0x21,0x0,0x78,0x2f,0x1,0xfe,0xfc,0xff,0x32,0x0,0x29,0x0,0x20,0x0,
+    0x0,0xf0,0xff,0x91,0xf9,0x70,0xbd,0x80,0xb5,0x4,0xf0,0x7f,0x7d,0xff,0x5,0xf0,
+    0x70,0xf8,0x1,0xb,0x0,0xff,0x0,0x22,0x1,0x0,0x3,0x20,0x0,0xf0,0xdf,0x41,
+    0xfb,0x5,0xf0,0x67,0x11,0x4,0x4,0xf0,0xff,0x32,0xfd,0x0,0x28,0x0,0xd0,0x6,
+    0x20,0xf5,0x2,0xd,0x0,0x1,0x9,0x0,0x0,0x20,0x4,0xf0,0x77,0x41,0xfd,0x0,
+    0xf,0x4,0x4,0xf0,0x34,0xcb,0x1,0x47,0x0,0xd0,0x1e,0xd,0x8,0xd9,0x3,0xd,
+    0xe,0x3f,0xd,0xc,0xff,0x10,0xb5,0x0,0x24,0x4,0xf0,0x62,0xfe,0xfd,0x7,0x1,
+    0x1,0x2c,0x24,0x2,0xe0,0x8,0x28,0x7f,0x0,0xd1,0x2d,0x24,0x20,0x0,0x10,0xa9,
+    0x0,0xff,0xc6,0xb0,0x6,0x0,0xc,0x0,0x5,0xf0,0xbf,0x92,0xfa,0xc0,0x20,0x30,
+    0x5c,0x31,0x0,0xd1,0xff,0xc1,0xe0,0x6b,0x4d,0x1,0xab,0x1a,0xaa,0xff,0x31,0x0,
+    0x28,0x69,0x4,0xf0,0xf0,0xf9,0xff,0x0,0x28,0x11,0xd1,0x1a,0x98,0x80,0x7,0xff,
+    0x3,0xd5,0x1a,0xa8,0x20,0x30,0x5,0xf0,0x5f,0x1b,0xfb,0x1a,0x98,0xc0,0xd,0x4,
+    0x8,0xd,0x0,0xff,0x42,0xfb,0x21,0x0,0x68,0x46,0x4,0x79,0x7f,0xc,0x43,0x1,
+    0xa8,0x0,0x90,0x14,0x37,0x0,0xff,0x20,0x32,0x31,0x0,0xe8,0x68,0x2,0xf0,0xed,
+    0x97,0x39,0x0,0x6,0xd1,0x1d,0xa,0x14,0xa8,0x5,0xff,0xf0,0xe3,0xfa,0x1,0xab,
+    0x2a,0x1d,0x31,0xbf,0x0,0x68,0x69,0x0,0xf0,0x5d,0x6b,0x1,0xd,0xfe,0x1d,0xc,
+    0xa8,0x68,0x3,0x90,0x28,0x79,0x40,0xff,0x6,0x40,0xe,0x69,0x46,0x8,0x72,0x2,
+    0xaa,0x2b,0x0,0xe2,0x2b,0x0,0x12,0x83,0x0,0xa8,0x2b,0x0,0x68,0x54,0x3,0x1,
+    0x49,0xe,0x12,0x1d,0x0,0xe7,0x1d,0x0,0x10,0x1d,0x0,0xad,0xe8,0x1d,0x0,0x3e,
+    0xff,0x1d,0x12,0x10,0x1d,0x0,0xde,0xfa,0x1d,0x0,0xe,0xbf,0x2,0x6a,0x1,0xf0,
+    0x87,0xf8,0xaa,0x1d,0x12,0xe,0x1d,0x0,0xd5,0x1d,0x0,0xc,0x1d,0x0,0x68,0x56,
+    0x1d,0x0,0x3e,0xfa,0x1d,0x12,0xc,0x1d,0x0,0xcc,0x1d,0x0,0x49,0xa,0x77,0x2,
+    0x1d,0x0,0xf3,0xd9,0x1,0x1d,0xe,0xa,0x1d,0x0,0x25,0xc3,0x1d,0x0,0x8,0x77,
+    0x2,0x1d,0x0,0x5d,0x5f,0x1,0x1d,0xe,0xd5,0x8,0x1d,0x0,0xc2,0x1d,0x0,0x6,
+    0x77,0x2,0x6b,0x2,0xfb,0xf0,0xcf,0x59,0x14,0x6,0xa8,0xc0,0x46,0xc0,0x4f,0x46,
+    0x1,0xab,0x4,0x77,0x2,0x1d,0x0,0x1,0x3b,0x14,0xfd,0x4,0x1d,0x4,0x0,0x2c,
+    0x4,0xd0,0x16,0xaa,0xff,0x28,0xa9,0xc,0x48,0x0,0xf0,0x83,0xf8,0xff,0x46,0xb0,
+    0x70,0xbd,0x0,0x2a,0x0,0xd0,0x7f,0x70,0x47,0x0,0xb5,0xa3,0xb0,0x1,0xf5,0x1,
+    0x7f,0x51,0xff,0x6a,0x46,0x4,0xa9,0x5,0x1d,0x0,0xff,0x74,0xf8,0x23,0xb0,0x0,
+    0xbd,0x4c,0x4,0xff,0x0,0x0,0xc4,0x9,0x0,0x0,0x78,0x46,0xff,0x0,0x20,0x50,
+    0x43,0x0,0x20,0x9,0x2a,0xff,0x0,0xda,0x70,0x47,0x80,0xb5,0xd0,0xb2,0xfe,0x6b,
+    0x4,0xbd,0x0,0xb5,0xb1,0xb0,0x2,0x23,0xff,0x68,0x46,0xc0,0x30,0x3,0x70,0x3,
+    0x2a,0xff,0x7,0xd0,0x48,0xd3,0x5,0x2a,0x13,0xd0,0xff,0x1c,0xd3,0x7,0x2a,0x23,
+    0xd0,0x31,0xd3,0xff,0x41,0xe0,0x48,0x68,0x0,0x90,0xa,0x68,0xff,0x1,0x92,0x68,
+    0x46,0x3,0x21,0x1,0x72,0xff,0x0,0x21,0x41,0x72,0x0,0x99,0x22,0x48,0xfd,0x0,
+    0xf3,0x1,0xfa,0xf8,0x2f,0xe0,0x68,0x46,0xff,0x8a,0x88,0x2,0x80,0x9,0x68,0x1,
+    0x91,0xea,0x1d,0x2,0x4,0x1d,0x0,0x26,0x13,0x18,0x43,0x72,0x1d,0xf8,0x11,0x8,
+    0x45,0x2,0x11,0x2,0x41,0x72,0x1,0x88,0x9,0xef,0xb2,0x11,0x48,0x0,0xe1,0x0,
+    0x57,0xfa,0xd,0xea,0x61,0x18,0x1,0x61,0x4,0xa,0x1d,0x4,0x44,0xfa,0x68,0xbf,
+    0x46,0x5,0xf0,0x58,0xf9,0x31,0xc7,0x0,0x80,0xff,0xb5,0x5,0x49,0xa,0x78,0x2,
+    0x2a,0x3,0xff,0xd1,0x2,0x28,0x1,0xd1,0x3,0x22,0xa,0x7f,0x70,0x4,0xf0,0xdb,
+    0xfe,0x1,0xbd,0xd7,0x2,0xff,0x7f,0xb5,0x96,0xb0,0x0,0x25,0x1,0x4c,0xdf,0x2,
+    0xe0,0x0,0xbf,0xc8,0xe3,0x0,0x20,0x0,0xff,0x16,0x99,0x78,0x22,0xf4,0xf7,0x5b,
+    0xfb,0xff,0x1,0x95,0xca,0x4e,0x1,0xab,0x22,0x0,0x7f,0xa1,0x6e,0xf0,0x68,0x2,
+    0xf0,0x43,0xe5,0x1,0xff,0x0,0xd0,0x21,0x25,0x1,0x98,0x0,0x28,0xff,0xa,0xd0,
+    0x60,0x6e,0x0,0x28,0x5,0xd0,0xff,0x1,0x99,0x81,0x42,0x0,0xdd,0x1,0x0,0xff,
+    0x61,0x66,0x1,0xe0,0x1,0x98,0x60,0x66,0xdf,0xa,0xa8,0x21,0x0,0x2c,0x3b,0x0,
+    0x3d,0xfb,0xff,0xe0,0x6a,0x15,0x90,0xa,0xaa,0x21,0x0,0xd7,0x60,0x31,0x30,0xed,
+    0x0,0x73,0x3b,0x8,0x20,0x0,0xfb,0xa,0xa9,0x1f,0x2,0x2d,0xfb,0x15,0x98,0xe0,
+    0xff,0x62,0x22,0x0,0x21,0x6c,0x70,0x69,0x0,0xf7,0xf0,0xf3,0xf9,0x1d,0x6,0x22,
+    0x0,0x61,0x6c,0xed,0xb0,0xf,0x0,0xc,0xfc,0xf,0xa,0xe1,0x6c,0xf0,0xf6,0xf,
+    0x0,0xe9,0xfd,0xf,0xa,0x21,0x6d,0x30,0x6a,0xef,0x0,0xf0,0x46,0xff,0x2f,0xc,
+    0x6d,0x70,0x6a,0x67,0x1,0xf0,0xf7,0x5d,0x8,0xa9,0x0,0x6d,0xb0,0xf,0x0,0x5b,
+    0xc0,0xfb,0x3f,0xc,0x6e,0xf0,0xf,0x0,0x24,0x3f,0x8,0xff,0x20,0x0,0x3c,0x30,
+    0x0,0x90,0x23,0x0,0x5b,0x38,0x33,0x49,0x0,0x6f,0x30,0x23,0x1,0x98,0x79,0xe,
+    0xeb,0x6f,0x70,0xf,0x0,0xd1,0x79,0x8,0xb0,0x6b,0x0,0xff,0x28,0xb,0xd0,0x61,
+    0x69,0x88,0x42,0x0,0xef,0xda,0x60,0x61,0xa1,0x7,0x4,0xa0,0x61,0xe1,0xfe,0x7,
+    0x4,0xe0,0x61,0x18,0x99,0x20,0x0,0x4,0xff,0xf0,0x33,0xfb,0x18,0x98,0x4,0xf0,
+    0xe4,0xbd,0xfc,0x5,0x2,0x66,0xfb,0x21,0x0,0x7,0x2,0x71,0xfe,0xf7,0x0,0x2,
+    0x90,0x20,0x6b,0x3,0x90,0x60,0xff,0x6b,0x4,0x90,0xa0,0x6b,0x5,0x90,0xe0,0xff,
+    0x6b,0x6,0x90,0x2,0xa8,0x3,0xf0,0x6a,0x55,0xf9,0x5,0x2,0x9a,0x5,0x4,0x7d,
+    0x5,0x4,0xa7,0x5,0x4,0xf7,0xb9,0xf9,0x2,0x9,0x1,0x3,0x98,0x20,0x63,0xff,
+    0x4,0x98,0x60,0x63,0x5,0x98,0xa0,0x63,0x6f,0x6,0x98,0xe0,0x63,0x47,0xb,0x99,
+    0xfa,0x47,0x5,0xbf,0xa9,0x30,0x69,0x3,0xf0,0xd5,0xf5,0x8,0x23,0x5b,0x0,0x5c,
+    0xbf,0x0,0x60,0x32,0x15,0x6,0xce,0xb,0xd,0xff,0x64,0x32,0x21,0x0,0xf0,0x68,
+    0x1,0xf0,0xa5,0x88,0x27,0xc,0x68,0x27,0x0,0x15,0xa,0x81,0x15,0x8,0x21,0x95,
+    0x0,0x71,0x3,0x4b,0xf7,0xc,0x40,0x1f,0x0,0x11,0x2,0x46,0x56,0x11,0x8,0x21,
+    0x0,0x81,0x3,0x5c,0x41,0xd,0x44,0x1f,0x0,0xa2,0x11,0x2,0x57,0x11,0x8,0x4d,
+    0x0,0xd,0x0,0x31,0x91,0xd,0x4c,0xb4,0x5f,0x2,0x11,0x0,0x2c,0x11,0x8,0x21,
+    0x0,0xa1,0x3,0x79,0x25,0xfe,0x1f,0xa,0x50,0x1f,0x0,0x11,0x2,0x74,0x11,0x8,
+    0x6d,0x0,0x4a,0x91,0x1,0x2f,0xb1,0xd,0x54,0x7f,0x2,0x11,0x0,0x2a,0x11,0x8,
+    0x2c,0x6d,0x0,0xd,0x0,0xe3,0xfa,0x1f,0xa,0x58,0x7f,0x2,0x11,0x0,0xd1,0xde,
+    0x11,0x8,0x6d,0x0,0xd,0x0,0x4c,0xa7,0x9,0x22,0x0,0xe9,0x6c,0x7f,0x2,0x11,
+    0x0,0x47,0x11,0x8,0xe3,0x6b,0xa2,0xe9,0x6b,0x71,0x0,0xcb,0x1,0xb1,0x51,0x8,
+    0x20,0x0,0x70,0xa4,0xf5,0x1,0x17,0xe,0xa9,0x69,0xc,0xf1,0x3,0xe9,0xe9,0xc,
+    0x74,0xf4,0x89,0x2,0x11,0x0,0xe4,0x11,0x8,0x16,0x98,0x80,0x6c,0xff,0x7,0x90,
+    0x0,0x20,0x8,0x90,0x9,0x90,0xbf,0x7,0xa8,0x2,0xf0,0xf3,0xff,0x5,0x2,0xf9,
+    0xff,0xff,0x7,0x98,0xa0,0x64,0x17,0x98,0x21,0xfb,0x0,0x78,0x9f,0x1,0xc9,0xf9,
+    0x4,0xf0,0x44,0xff,0xfd,0x28,0x0,0x1a,0xb0,0x70,0xbd,0x78,0xff,0x46,0x0,0x20,
+    0x0,0x20,0x2f,0x49,0x8,0xff,0x80,0x88,0x70,0x2e,0x49,0x8,0x22,0x0,0xff,0x23,
+    0x8b,0x71,0x8b,0x80,0x8,0x60,0x8b,0xff,0x73,0x8b,0x81,0x88,0x60,0x8b,0x75,0x8b,
+    0xff,0x82,0x8,0x61,0x8b,0x77,0x8b,0x83,0x88,0xff,0x61,0x20,0x31,0x52,0x1e,0xf0,
+    0xd1,0x70,0xff,0x47,0x80,0xb5,0xef,0xf3,0x10,0x83,0x0,0xff,0x93,0x72,0xb6,0x0,
+    0xf0,0x4,0xf8,0x0,0x7f,0x98,0x80,0xf3,0x10,0x88,0x1,0xbd,0x7d,0x0,0xfe,0x1b,
+    0x0,0x70,0xb5,0x1c,0x4b,0x9c,0x78,0x20,0xff,0x2c,0x4,0xdb,0x2,0x21,0x4,0x20,
+    0x5,0xff,0xf0,0x7e,0xfa,0x70,0xbd,0x64,0x1c,0x9c,0xff,0x70,0x1c,0x78,0x17,0x4d,
+    0xe6,0x0,0xad,0xff,0x19,0xa8,0x71,0x29,0x60,0xaa,0x80,0x64,0xff,0x1c,0x1c,0x70,
+    0xe4,0xb2,0x20,0x2c,0x1,0xff,0xdb,0x0,0x20,0x18,0x70,0x70,0xbd,0x10,0xff,0xb5,
+    0x82,0xb0,0xe,0x4c,0xa0,0x78,0x0,0xff,0x28,0x17,0xd0,0xd,0x48,0x61,0x78,0xc9,
+    0x7f,0x0,0x40,0x18,0x5,0xf0,0x68,0xfa,0x67,0x0,0xff,0x80,0x0,0x90,0x72,0xb6,
+    0xa0,0x78,0x40,0xff,0x1e,0xa0,0x70,0x60,0x78,0x40,0x1c,0xc0,0x6f,0xb2,0x20,0x28,
+    0x0,0x35,0x0,0x60,0x70,0x77,0x8,0xff,0x20,0x16,0xbd,0x0,0x0,0xd0,0x49,0x0,
+    0xf7,0x20,0x6c,0x3c,0xc7,0x2,0x6a,0x49,0x8,0x70,0xfe,0xa1,0x2,0x0,0xf0,0x47,
+    0xf8,0x2,0xbd,0xf8,0xff,0xb5,0x4,0x0,0xf,0x0,0x66,0x4d,0x2e,0xef,0x0,0x88,
+    0x36,0x30,0x5d,0x0,0xd,0xd1,0x1,0xbf,0x20,0x30,0x70,0x28,0x0,0x0,0xc9,0x1,
+    0x39,0xee,0xb0,0x0,0x0,0xf0,0x53,0x55,0x1,0x5,0xd5,0x0,0xff,0x25,0x35,0x70,
+    0x2,0xe0,0x14,0x20,0xc0,0xff,0x43,0xf2,0xbd,0x25,0x60,0xf2,0xbd,0x59,0xff,0x49,
+    0x81,0x42,0x2,0xd1,0x0,0x20,0x88,0xfd,0x31,0x4d,0x2,0x1,0x29,0x2,0xda,0x0,
+    0x21,0xdf,0x1,0x70,0x9,0xe0,0x1,0x5,0x0,0x10,0x68,0xff,0x53,0x49,0x88,0x42,
+    0x1,0xda,0x0,0x28,0xff,0x1,0xd1,0x48,0x1e,0x10,0x60,0x0,0x20,0x5a,0x6f,0x6,
+    0x68,0x6f,0x0,0xa6,0xe0,0x9,0x2,0xab,0x9,0x0,0xfb,0x0,0xbf,0x31,0x0,0x66,
+    0x41,0x66,0x81,0x66,0xff,0xc1,0x66,0x80,0x22,0x81,0x50,0x70,0x47,0xfd,0x10,0x8b,
+    0x0,0x80,0x20,0x0,0x5,0x20,0x60,0xff,0x44,0x4a,0x0,0x21,0x0,0x20,0xee,0xf7,
+    0xdf,0x7c,0xfe,0x60,0x60,0x42,0xb,0x8,0x76,0xfe,0xf7,0xa0,0x60,0x40,0xb,0x8,
+    0x70,0xfe,0xe0,0x60,0xfd,0x3e,0xb,0x8,0x6a,0xfe,0x20,0x61,0x0,0x20,0xf7,0x10,
+    0xbd,0x38,0x3d,0x0,0x8,0x0,0x0,0x25,0xff,0x25,0x70,0x22,0x0,0x40,0x32,0x3,
+    0x23,0xff,0x15,0x60,0x12,0x1d,0x5b,0x1e,0xfb,0xd1,0xff,0x25,0x65,0x65,0x65,0xc1,
+    0x68,0x49,0x1e,0xff,0x89,0x41,0xc9,0x43,0xc9,0xf,0xa1,0x65,0xff,0xe5,0x65,0x81,
+    0x68,0x21,0x66,0x41,0x68,0xff,0x61,0x66,0xc1,0x68,0xa1,0x66,0x1,0x69,0xff,0xe1,
+    0x66,0x25,0x67,0x65,0x67,0xa5,0x67,0xfe,0x4d,0x0,0x68,0xf3,0xf7,0x48,0xfd,0x80,
+    0x21,0x7f,0x60,0x50,0x84,0x20,0x25,0x50,0x20,0xfb,0x0,0xbf,0x2,0xf8,0x0,0x20,
+    0x32,0xbd,0x19,0x0,0x22,0xff,0x0,0x1d,0x1,0x60,0x1,0x63,0xc1,0x60,0xff,0x81,
+    0x61,0x41,0x62,0x52,0x1c,0x0,0x1d,0xff,0x3,0x2a,0xf6,0xdb,0x70,0x47,0x30,0xb5,
+    0xf7,0x5,0x0,0x28,0x35,0x1,0x28,0xd0,0x9,0x68,0xb7,0x1b,0x48,0x81,0xf3,0x2,
+    0x29,0x4,0x15,0x1,0x28,0xfb,0x70,0x17,0x29,0x1,0x30,0xbd,0x2c,0x0,0x84,0xff,
+    0x34,0x21,0x60,0x68,0x6e,0xf4,0xf7,0x65,0xff,0xfa,0xe8,0x65,0x28,0x6e,0x21,0x68,
+    0xf4,0xbf,0xf7,0x60,0xfa,0x28,0x67,0xa8,0x9,0x4,0x5b,0x7b,0xfa,0xa8,0x9,0x0,
+    0xe9,0x6e,0x40,0x1a,0xd,0x2,0xbf,0x54,0xfa,0xe8,0x67,0xb,0x48,0x9,0x2,0x4f,
+    0xff,0xfa,0x68,0x67,0x0,0x20,0x30,0xbd,0xc0,0xef,0x42,0x0,0x20,0x38,0x3,0x0,
+    0xd1,0x7,0x0,0xff,0x0,0x30,0x75,0x0,0x0,0xc8,0xaf,0x0,0xff,0x0,0x90,0xd0,
+    0x3,0x0,0xc0,0xd4,0x1,0xff,0x0,0xc5,0x9,0x0,0x0,0x70,0x17,0x0,0x7b,0x0,
+    0x0,0x7d,0x0,0x0,0xd0,0x8,0x68,0x65,0x7,0xff,0xf4,0xb5,0x8e,0xb0,0x4,0x0,
+    0xd,0x0,0xff,0x0,0x20,0x18,0x70,0x68,0x68,0xe,0x99,0xff,0x48,0x60,0x1,0x27,
+    0x28,0x68,0x38,0x40,0xf7,0x2,0xd0,0x20,0x27,0x0,0x7,0xd1,0xe,0x98,0xff,0x0,
+    0x78,0x80,0x21,0x8,0x40,0xe,0x99,0xff,0x8,0x70,0x3,0x20,0x15,0xe1,0x0,0x21,
+    0xff,0x28,0x69,0xf3,0xf7,0xce,0xfc,0x4,0x90,0x77,0x0,0x21,0x68,0x9,0x0,0xc9,
+    0xfc,0x5,0x9,0x0,0xfd,0xa8,0x9,0x0,0xc4,0xfc,0x6,0x90,0xa0,0x6d,0xff,0x38,
+    0x40,0x3,0x90,0x0,0x20,0x2,0x90,0xfe,0xff,0x0,0x23,0x26,0x0,0x40,0x36,0x3,
+    0x25,0xff,0x30,0x68,0x40,0x10,0xc1,0x17,0x0,0x92,0xff,0x1,0x93,0x2,0x0,0xb,
+    0x0,0xf4,0xf7,0xff,0xd1,0xfb,0x0,0x9a,0x1,0x9b,0x80,0x18,0xfb,0x59,0x41,0xf,
+    0x2,0x36,0x1d,0x6d,0x1e,0xed,0xff,0xd1,0x2,0x20,0x0,0x90,0x2,0xa8,0xfc,0xff,
+    0xf7,0xcb,0xfa,0x2,0x98,0x0,0x21,0x81,0xff,0x42,0x7,0xdb,0x0,0x20,0xa,0xa9,
+    0x3,0xff,0x22,0x8,0x60,0x9,0x1d,0x52,0x1e,0x23,0xbf,0xd0,0xfa,0xe7,0x7,0xa8,
+    0x4,0xf,0x0,0xb,0xeb,0x68,0x3,0x11,0x0,0x0,0x13,0x0,0xf9,0xd1,0x20,0x7f,
+    0x0,0x40,0x30,0x69,0x46,0x7,0xaa,0xb7,0x1,0xeb,0x68,0xd,0xb9,0x1,0x9,0xbb,
+    0x1,0xf9,0xd1,0x0,0xff,0x21,0x6a,0x46,0x13,0x68,0x5,0x68,0x5b,0xef,0x1b,0x13,
+    0x60,0x49,0x75,0x1,0x12,0x1d,0x3,0xff,0x29,0xf6,0xdb,0xa,0xa8,0x69,0x46,0x2c,
+    0x77,0xc9,0x2c,0xc0,0xcd,0x12,0x68,0x46,0x3,0xa5,0x1,0xdf,0x2,0x70,0x40,0x1c,
+    0x49,0xf3,0x1,0x0,0x20,0xff,0x69,0x46,0xa,0xaa,0x23,0x1d,0x15,0x68,0xff,0x0,
+    0x2d,0x1,0xd5,0x2e,0x46,0x75,0x42,0xff,0x1e,0x68,0x0,0x2e,0x3,0xd0,0x2,0x2e,
+    0xff,0x26,0xd0,0x11,0xd3,0x33,0xe0,0x80,0x26,0xff,0xa6,0x59,0xb5,0x42,0x2f,0xdb,
+    0x1f,0x60,0xfb,0x1d,0x63,0x23,0x4,0xd4,0x1,0x25,0x1,0xe0,0xff,0x0,0x25,0xed,
+    0x43,0xdd,0x60,0xe5,0x6d,0xff,0x9d,0x61,0x22,0xe0,0x9e,0x69,0x76,0x1e,0xff,0x9e,
+    0x61,0x1e,0x0,0x30,0x36,0x1,0x96,0xff,0x1e,0x6b,0xb5,0x42,0x0,0xda,0x35,0x0,
+    0xff,0x1,0x9e,0x35,0x60,0x9d,0x69,0x0,0x2d,0xff,0x13,0xd1,0x2,0x25,0x1d,0x60,
+    0x25,0x6f,0xff,0x5d,0x62,0xe,0xe0,0x5e,0x6a,0x76,0x1e,0xfb,0x5e,0x62,0x4f,0x2,
+    0x76,0x10,0xb5,0x42,0x2,0xfb,0xdb,0x0,0x19,0x0,0x3,0xe0,0x5d,0x6a,0x0,0xaf,
+    0x2d,0x0,0xd1,0xf,0x8d,0x0,0x1b,0xb3,0x0,0x49,0xff,0x1c,0x3,0x28,0xb9,0xdb,
+    0x68,0x46,0x1,0xff,0x78,0x42,0x78,0x89,0x18,0x80,0x78,0xd,0xff,0x18,0xed,0xb2,
+    0x0,0x26,0x0,0x2d,0x2f,0xff,0xd0,0x60,0x6b,0x1,0x90,0x1,0x20,0x21,0xff,0x0,
+    0x8,0x31,0xca,0x68,0x0,0x2a,0xc,0xff,0xd0,0xa,0x68,0x2,0x2a,0x9,0xd1,0x4a,
+    0xff,0x6a,0x63,0x6f,0x9a,0x42,0x5,0xd2,0x1,0xff,0x9a,0xb,0x6b,0x9a,0x42,0x1,
+    0xda,0x1,0xff,0x93,0x6,0x0,0x40,0x1c,0x9,0x1d,0x3,0xf7,0x28,0xeb,0xdb,0xf3,
+    0x2,0x72,0x0,0x1,0x21,0xff,0x91,0x40,0x1,0x43,0xe,0x98,0x1,0x70,0xfd,0xb0,
+    0xea,0x1,0x0,0x69,0x1,0x28,0x6,0xdb,0xff,0xc9,0xb2,0x52,0x1c,0x1,0x20,0x90,
+    0x40,0xfb,0x8,0x18,0xf,0x3,0x20,0x0,0xff,0xf7,0xa3,0xff,0xfe,0x3,0x98,0x0,
+    0x28,0x1d,0xd0,0x20,0xff,0x6d,0x0,0x28,0x6,0xd1,0x0,0x2d,0x18,0xff,0xd0,0x27,
+    0x65,0xa0,0x6f,0x60,0x65,0xe6,0xff,0x64,0x13,0xe0,0x60,0x6d,0x40,0x1e,0x60,0xff,
+    0x65,0x1,0x28,0xc,0xdb,0x0,0x2d,0xc,0xff,0xd0,0xe1,0x6f,0x81,0x42,0x9,0xdb,
+    0xe0,0xdf,0x6c,0xb0,0x42,0x6,0xd1,0x61,0x2,0x40,0x30,0xfe,0x43,0x2,0x0,0x20,
+    0x20,0x65,0x40,0x34,0x4,0xff,0xa8,0xe,0xc8,0xe,0xc4,0x0,0x20,0xf,0xff,0xb0,
+    0xf0,0xbd,0x0,0x0,0x0,0x20,0x5e,0xff,0x49,0x8,0x70,0x70,0x47,0x80,0xb5,0x0,
+    0xff,0xf0,0x3f,0xf8,0x2,0xbd,0x70,0xb5,0x6,0xff,0x0,0x5a,0x4c,0x60,0x20,0x20,
+    0x5c,0x0,0xff,0x28,0x10,0xd1,0x1,0x20,0x60,0x22,0xa0,0xff,0x54,0x20,0x0,0x10,
+    0x30,0x0,0x25,0x5,0xff,0x60,0x45,0x60,0x20,0x0,0x0,0xf0,0xb3,0xfd,0xf8,0x7d,
+    0x0,0xd5,0x60,0x34,0x25,0x70,0x0,0xff,0x24,0x2,0xe0,0x14,0x20,0xc0,0x43,0x70,
+    0xff,0xbd,0x34,0x60,0x70,0xbd,0x4d,0x49,0x81,0xdb,0x42,0x2,0xa9,0x1,0x60,0x31,
+    0x4f,0x2,0x1,0x29,0xff,0x2,0xda,0x0,0x21,0x1,0x70,0x9,0xe0,0x7d,0x1,0x5,
+    0x0,0x10,0x68,0x46,0x49,0x88,0xf9,0x0,0xff,0x0,0x28,0x1,0xd1,0x48,0x1e,0x10,
+    0x60,0x6b,0x0,0x20,0x71,0x6,0x14,0x71,0x0,0x83,0xe0,0x9,0x2,0xfd,0xc3,0x9,
+    0x0,0x7,0x21,0x1,0x61,0x3d,0x49,0xff,0x41,0x60,0xc9,0x8,0x1,0x60,0x3,0x21,
+    0xff,0xc1,0x60,0x80,0x21,0x89,0x5,0x8,0x30,0xfd,0x1,0x2d,0x4,0xf8,0xb5,0x5,
+    0x0,0x28,0x78,0x7f,0x0,0x28,0x62,0xd0,0x8,0x68,0xc0,0x4b,0x8,0xdd,0x4,0x6d,
+    0x0,0x28,0x70,0x17,0x81,0x0,0xf2,0xbd,0xff,0x68,0x60,0x80,0x2,0x1,0xd1,0xbb,
+    0x4c,0xff,0x8,0xe0,0xc4,0x17,0x60,0x40,0x2,0x1b,0xff,0x0,0x20,0xb9,0x49,0xf4,
+    0xf7,0x9c,0xff,0xff,0x60,0x40,0x4,0x1b,0xb7,0x48,0x84,0x42,0xff,0x2,0xda,0x1,
+    0x20,0x28,0x73,0x1e,0xe0,0xff,0xa0,0x16,0xa1,0x1,0x0,0xd5,0x40,0x1c,0xff,0x28,
+    0x73,0x28,0x7b,0xc2,0x6,0xe1,0x17,0xff,0xc9,0x6,0x63,0x9,0x19,0x43,0xe0,0x6,
+    0xff,0x0,0x2a,0x1,0xd1,0xab,0x4c,0xe,0xe0,0xff,0xce,0x17,0xcf,0x17,0xd4,0x17,
+    0x62,0x40,0xff,0x12,0x1b,0x70,0x40,0x79,0x40,0x3b,0x0,0xff,0x80,0x1b,0x99,0x41,
+    0xf4,0xf7,0x78,0xff,0xeb,0x74,0x40,0x49,0x2,0x28,0x9,0x3,0x90,0x68,0x69,0xff,
+    0xc1,0x17,0x89,0x6,0x82,0x9,0x11,0x43,0xff,0x80,0x6,0x0,0x2c,0x1,0xd1,0x9d,
+    0x48,0xfd,0x10,0x37,0x4,0xe2,0x17,0x13,0x0,0x63,0x40,0xfb,0x9a,0x1a,0x39,0x12,
+    0x5b,0xff,0xe1,0x17,0x71,0xff,0x40,0x48,0x40,0x40,0x1a,0x0,0x99,0x8,0xff,0x60,
+    0x68,0x68,0x29,0x7b,0x48,0x43,0xa8,0xfa,0xd1,0x0,0xf2,0x7b,0x1,0x90,0x45,0x0,
+    0x20,0x30,0xfe,0x3,0x0,0x1,0x7d,0x0,0x0,0x80,0x1a,0x6,0xcb,0x0,0x0,0xdf,
+    0x0,0x0,0xdf,0x0,0x1f,0x7,0x70,0xb4,0xff,0x0,0x22,0x2,0x70,0x42,0x60,0x82,
+    0x60,0xff,0x1,0x23,0x3,0x73,0x42,0x73,0x8c,0x68,0xff,0xa4,0x10,0x44,0x61,0xc,
+    0x68,0x84,0x61,0xff,0x4c,0x68,0xc4,0x61,0xcc,0x68,0x20,0x25,0xff,0x44,0x55,0x4,
+    0x0,0x21,0x34,0x9,0x69,0xff,0x21,0x70,0x63,0x70,0x3,0x0,0x30,0x33,0xff,0x4,
+    0x0,0x24,0x34,0x3,0x21,0x3,0x25,0xff,0x0,0x26,0xde,0x70,0x1e,0x70,0x22,0x60,
+    0xff,0x24,0x1d,0x5b,0x1c,0x6d,0x1e,0xf8,0xd1,0xbf,0x4,0x0,0x38,0x34,0x3,0x25,
+    0xf,0x2,0x6d,0xeb,0x1e,0xfb,0xd,0x0,0x44,0xd,0x10,0x50,0x30,0x2,0xcf,0x60,
+    0x0,0x1d,0x49,0x9,0x0,0x73,0x0,0xbc,0x70,0xff,0x47,0xf4,0xb5,0x88,0xb0,0x7,
+    0x0,0x0,0xff,0x24,0x1c,0x70,0x8,0x9a,0x14,0x70,0x48,0xff,0x68,0x8,0x9a,0x50,
+    0x60,0x8,0x78,0xc0,0xef,0x7,0x2,0xd5,0x38,0x9d,0x0,0x1,0xd1,0x3,0xff,0x20,
+    0xbe,0xe0,0x78,0x7b,0x40,0x1c,0x78,0xff,0x73,0x8,0x69,0x5,0x90,0x48,0x69,0x6,
+    0xff,0x90,0x88,0x69,0x7,0x90,0x0,0x20,0x5,0xff,0xa9,0x3a,0x0,0x50,0x32,0x13,
+    0x68,0xd,0xff,0x68,0x2d,0x11,0x5b,0x19,0x13,0x60,0x40,0xff,0x1c,0x12,0x1d,0x9,
+    0x1d,0x3,0x28,0xf5,0xff,0xdb,0x38,0x7b,0x79,0x7b,0x81,0x42,0x0,0xff,0xd0,0xa1,
+    0xe0,0xc0,0x6,0x1,0xd1,0x52,0xff,0x48,0x9,0xe0,0xc5,0x17,0x68,0x40,0x42,0xfe,
+    0xa1,0x1,0x80,0x21,0xc9,0x3,0xf4,0xf7,0xca,0xff,0xfe,0x68,0x40,0x40,0x1b,0x4,
+    0x90,0x0,0xff,0x94,0x3d,0x0,0x33,0x35,0x3e,0x0,0x24,0xff,0x36,0x30,0x6a,0x70,
+    0x61,0xf0,0x6a,0xc1,0xff,0x17,0x4,0x9a,0xd3,0x17,0xf4,0xf7,0x88,0xff,0xf9,0xc0,
+    0xe,0x4a,0x1,0x10,0x43,0x30,0xff,0x62,0x1,0x20,0x0,0x99,0x88,0x40,0xc0,0xff,
+    0xb2,0x3,0x90,0x21,0x20,0x38,0x5c,0x3,0xff,0x99,0x8,0x42,0x68,0xd0,0x30,0x6a,
+    0x71,0xff,0x69,0x40,0x1a,0xc1,0x17,0xa,0x0,0x42,0xff,0x40,0x51,0x1a,0x3a,0x69,
+    0x12,0x11,0x8a,0xff,0x42,0x4c,0xda,0x29,0x78,0x6a,0x46,0x11,0xff,0x71,0x4,0x21,
+    0x51,0x56,0xa,0x12,0x13,0xff,0x0,0x4b,0x40,0x99,0x1a,0x49,0xb2,0x1,0xff,0x29,
+    0x38,0xd1,0x33,0x68,0xda,0x17,0x53,0xfe,0xa1,0x1,0x2,0x92,0xfa,0x69,0x2,0x9b,
+    0x9a,0xff,0x42,0x3,0xda,0x2c,0x70,0xe9,0x1e,0xc,0xff,0x70,0x19,0xe0,0xba,0x69,
+    0x93,0x42,0x17,0xff,0xdb,0x1,0x28,0x1,0xdb,0x1,0x21,0x0,0xff,0xe0,0x0,0x21,
+    0xc0,0xf,0x8,0x1a,0x6a,0xfd,0x46,0x41,0x2,0x40,0xb2,0x88,0x42,0xa,0xd0,0xff,
+    0xe8,0x1e,0x0,0x78,0x40,0x1c,0xe9,0x1e,0xff,0x8,0x70,0x69,0x46,0x4,0x20,0x8,
+    0x56,0xbf,0x41,0x42,0x29,0x70,0x34,0x60,0x15,0x2,0x20,0xff,0x21,0x79,0x5c,0x88,
+    0x42,0x12,0xd1,0x8,0xff,0x98,0x0,0x78,0x3,0x99,0x1,0x43,0x8,0xf7,0x98,0x1,
+    0x70,0x55,0x6,0x34,0x60,0x7,0xe0,0xfe,0x51,0x16,0x28,0x70,0x30,0x68,0xb9,0x68,
+    0x0,0xff,0x22,0xaa,0x56,0x51,0x43,0x40,0x18,0x30,0xff,0x60,0xc1,0x17,0xfa,0x69,
+    0x48,0x40,0x40,0xfb,0x1a,0x82,0x89,0xc,0x34,0x60,0x0,0x98,0x40,0xff,0x1c,0x0,
+    0x90,0x36,0x1d,0x6d,0x1c,0x3,0xff,0x28,0x0,0xda,0x78,0xe7,0x7c,0x73,0x50,0xff,
+    0x37,0x3,0x20,0x3c,0x60,0x3f,0x1d,0x40,0xfe,0xa5,0x5,0x9,0xb0,0xf0,0xbd,0x0,
+    0x0,0x36,0xff,0x82,0x0,0x0,0xff,0xff,0xff,0x7f,0x0,0xff,0x71,0x2,0x0,0x1,
+    0x0,0x0,0x6,0x0,0xff,0x20,0x69,0x49,0x8,0x70,0x70,0x47,0x80,0xff,0xb5,0x0,
+    0xf0,0x49,0xf8,0x2,0xbd,0x70,0xff,0xb5,0x4,0x0,0xe,0x0,0x65,0x4d,0x28,0xff,
+    0x20,0x28,0x5c,0x0,0x28,0xf,0xd1,0x1,0xff,0x20,0x28,0x21,0x68,0x54,0x28,0x0,
+    0x0,0xdf,0xf0,0x31,0xf8,0x31,0x0,0x7,0x2,0x4c,0xf8,0xff,0x0,0x28,0x6,0xd5,
+    0x0,0x21,0x28,0x35,0xff,0x29,0x70,0x3,0xe0,0x14,0x20,0xc0,0x43,0xff,0x70,0xbd,
+    0x29,0x0,0x21,0x60,0x70,0xbd,0xdf,0x57,0x49,0x81,0x42,0x2,0x69,0x0,0x28,0x31,
+    0xfe,0x51,0x2,0x1,0x29,0x2,0xda,0x0,0x21,0x1,0xef,0x70,0x9,0xe0,0x1,0x5,
+    0x0,0x10,0x68,0x51,0xff,0x49,0x88,0x42,0x1,0xda,0x0,0x28,0x1,0x7f,0xd1,0x48,
+    0x1e,0x10,0x60,0x0,0x20,0x73,0x6,0xad,0x44,0x73,0x0,0xa2,0xe0,0x9,0x2,0xa7,
+    0x9,0x0,0x0,0xff,0x21,0x81,0x60,0xc1,0x60,0x1,0x61,0x2,0xff,0x0,0x14,0x32,
+    0x11,0x60,0x51,0x60,0x70,0xfb,0x47,0x10,0x8f,0x0,0x43,0x4a,0x14,0x21,0x14,0xff,
+    0x20,0xee,0xf7,0x79,0xfa,0x20,0x60,0x41,0xef,0x4a,0x1d,0x21,0x1d,0xb,0x0,0x73,
+    0xfa,0x60,0xbb,0x60,0x3f,0xb,0x8,0x6d,0xfa,0xa0,0x4f,0x0,0x10,0xfb,0xbd,0xf8,
+    0x2b,0x0,0x0,0x25,0x25,0x70,0x1,0xff,0x20,0x60,0x70,0xa5,0x70,0x65,0x60,0x8,
+    0xff,0x68,0x80,0x2,0xa0,0x60,0x4e,0x68,0x88,0xff,0x68,0x47,0x10,0xf1,0x1b,0x20,
+    0x0,0xc,0xff,0x30,0x4,0xf0,0x77,0xfe,0xf1,0x19,0x20,0xfb,0x0,0x10,0x9,0x0,
+    0x72,0xfe,0x1c,0x34,0x3,0xaf,0x20,0x25,0x60,0x24,0x1f,0x5,0xf2,0x3d,0x4,0x20,
+    0xff,0x78,0x0,0x28,0x47,0xd0,0x8,0x68,0x2a,0xba,0xab,0x8,0x4,0xcd,0x0,0x20,
+    0x70,0x17,0xe3,0x0,0xf2,0xfb,0xbd,0x60,0x75,0x1,0x25,0x4a,0x0,0x23,0xf4,0xff,
+    0xf7,0x5b,0xf8,0x2,0xd,0xd,0x3,0x2a,0xff,0x43,0x80,0x26,0x36,0x3,0x6,0x40,
+    0x0,0xff,0xd0,0x52,0x1c,0x91,0x12,0xa0,0x68,0x80,0xff,0x12,0x25,0x0,0x14,0x35,
+    0x42,0x18,0x0,0xff,0x92,0xc1,0x17,0x89,0x7,0x82,0x8,0x11,0xff,0x43,0x80,0x7,
+    0x0,0x9a,0x0,0x2a,0x1,0xff,0xd1,0x18,0x48,0x11,0xe0,0xce,0x17,0xcf,0xff,0x17,
+    0xd2,0x17,0x0,0x9b,0x53,0x40,0x9a,0xff,0x1a,0x70,0x40,0x79,0x40,0x3b,0x0,0x80,
+    0xff,0x1b,0x99,0x41,0xf4,0xf7,0x67,0xfd,0x0,0xdf,0x99,0xc9,0x17,0x71,0x40,0xcd,
+    0x3,0x28,0x60,0xff,0x29,0x68,0x48,0x42,0x68,0x60,0x2d,0x1d,0xff,0x80,0x21,0xc9,
+    0x5,0x40,0x18,0x28,0x60,0xee,0xc9,0x2,0x0,0x20,0xf2,0xb7,0x1,0xa8,0x47,0x0,
+    0xfb,0x20,0x80,0x3,0x0,0xa1,0x86,0x1,0x0,0x66,0xff,0x66,0x6,0x0,0x54,0xfb,
+    0x21,0x19,0x6a,0xff,0xf4,0x1d,0x1,0x8,0xb2,0x1,0x0,0x83,0x27,0xde,0x1b,0x43,
+    0xd3,0x5,0xbd,0x0,0x0,0xbd,0x0,0x5d,0x7,0xff,0xf4,0xb5,0x86,0xb0,0x7,0x0,
+    0xc,0x0,0x7e,0x19,0x1,0x70,0x60,0x68,0x6,0x99,0x48,0x15,0x0,0xff,0x18,0x70,
+    0x20,0x78,0xc0,0x7,0x2,0xd5,0xfd,0x38,0x29,0x0,0x1,0xd1,0x3,0x20,0x5e,0xe0,
+    0xff,0x0,0x21,0x20,0x69,0xf3,0xf7,0xd1,0xf8,0xf3,0x3,0x90,0xc2,0x1,0x9,0x0,
+    0xcc,0xf8,0x4,0x90,0xdf,0xa0,0x69,0x5,0x90,0x78,0x21,0x0,0x6,0xd0,0xff,0x38,
+    0x0,0x1c,0x30,0x3,0xa9,0x1c,0xc9,0xfb,0x1c,0xc0,0x1a,0x1,0x70,0x38,0x0,0x14,
+    0x30,0xff,0x2,0x90,0x4,0x46,0x8,0x34,0x3,0xae,0xff,0x3,0x25,0x30,0x68,0xc1,
+    0x17,0x2,0x9a,0xff,0x52,0x68,0xd3,0x17,0xf3,0xf7,0xd2,0xff,0x5f,0x0,0x90,0x1,
+    0x91,0x20,0x11,0x4,0x12,0x11,0x4,0xff,0xc9,0xff,0x0,0x9a,0x1,0x9b,0x80,0x18,
+    0xff,0x59,0x41,0x80,0xf,0x8a,0x0,0x10,0x43,0xff,0x20,0x60,0x36,0x1d,0x24,0x1d,
+    0x6d,0x1e,0xff,0xe3,0xd1,0x3,0xa8,0x2,0x99,0x8,0x31,0xfe,0x53,0x2,0x3,0x22,
+    0x3,0xa9,0x3,0xa8,0xf8,0xff,0xf7,0x68,0xfb,0xb8,0x78,0x1,0x0,0x5,0xff,0x9b,
+    0x5a,0x42,0xfb,0x68,0x5b,0x11,0x93,0xff,0x42,0x0,0xda,0x1,0x21,0x3b,0x69,0x5c,
+    0xbf,0x11,0xa2,0x42,0x3,0xdb,0x94,0x3,0x0,0xda,0xff,0x6,0x1,0xd0,0x0,0x21,
+    0x6,0xe0,0x0,0xff,0x29,0x4,0xd0,0x0,0x28,0x2,0xd1,0x1,0xbf,0x20,0x6,0x9a,
+    0x10,0x70,0xb9,0x19,0x1,0x7,0xfb,0xb0,0xf0,0x1b,0x1,0x0,0x20,0xaa,0x49,0x8,
+    0xff,0x70,0x70,0x47,0x80,0xb5,0x0,0xf0,0x3a,0xef,0xf8,0x2,0xbd,0x70,0xc9,0x1,
+    0xe,0x0,0xa6,0xff,0x4d,0x38,0x20,0x28,0x5c,0x0,0x28,0x12,0xfe,0x2f,0x0,0x38,
+    0x21,0x68,0x54,0x28,0x0,0x0,0xef,0xf0,0x27,0xf8,0x31,0x22,0x1,0x0,0xf0,0x38,
+    0xbf,0xf8,0x6,0x0,0x9,0xd5,0x29,0xb,0x0,0x4,0xf7,0xf0,0x82,0xfd,0xe3,0x1,
+    0x60,0x3,0xe0,0x14,0xfe,0xe5,0x1,0x70,0xbd,0x25,0x60,0x30,0x0,0x70,0xbf,0xbd,
+    0x97,0x49,0x81,0x42,0x2,0xfb,0x1,0x38,0xa5,0x31,0x57,0xa,0x38,0x57,0x0,0x7,
+    0x2,0x4a,0x7,0x0,0x7d,0xf5,0xe0,0x9,0x2,0x82,0x9,0x0,0x0,0x21,0xc1,0x62,
+    0xdf,0x1,0x63,0x70,0x47,0x10,0x71,0x0,0x80,0x22,0xff,0x52,0x5,0x1b,0x21,0x1b,
+    0x20,0xee,0xf7,0xff,0x25,0xf9,0x20,0x60,0x87,0x4a,0x1e,0x21,0xdd,0x1e,0xb,0x0,
+    0x1f,0xf9,0x60,0x77,0x1,0x10,0xbd,0xf7,0x38,0xb5,0x5,0x8b,0x5,0x28,0x70,0x68,
+    0x60,0x7f,0xa8,0x60,0xe8,0x60,0x28,0x61,0x34,0x93,0x4,0xff,0x14,0x30,0x4,0xf0,
+    0x4a,0xfd,0x28,0x0,0xff,0x20,0x30,0xf3,0xf7,0x71,0xfb,0x20,0x68,0xff,0xe8,0x62,
+    0x60,0x68,0x28,0x63,0x0,0x20,0xff,0x32,0xbd,0x1,0x29,0x9,0xda,0x0,0x21,0xff,
+    0x1,0x70,0x20,0x30,0x3,0x22,0x1,0x60,0xdf,0x0,0x1d,0x52,0x1e,0xfb,0x91,0x0,
+    0x70,0x47,0xfd,0x1,0x13,0x0,0x71,0x48,0x11,0x68,0x49,0x1e,0xaf,0x81,0x42,0x0,
+    0xd3,0xeb,0x7,0x38,0x7f,0x0,0xd,0xfa,0x4b,0x4,0x24,0xcd,0x0,0xa0,0x60,0x21,
+    0x78,0x0,0xff,0x29,0x29,0xd0,0x29,0x68,0x68,0x4a,0x91,0xff,0x42,0x1,0xda,0x0,
+    0x29,0x7,0xd1,0x20,0xff,0x70,0x20,0x34,0x20,0x0,0xf3,0xf7,0x3f,0xfb,0xfb,0x17,
+    0xe7,0x0,0x32,0xbd,0x61,0x60,0x88,0xff,0x2,0x1,0xd1,0x61,0x4d,0x8,0xe0,0xc5,
+    0xff,0x17,0x68,0x40,0x42,0x1b,0x0,0x20,0x5f,0xff,0x49,0xf4,0xf7,0x20,0xfc,0x68,
+    0x40,0x45,0x7f,0x1b,0x28,0x0,0xe9,0x17,0xe2,0x6a,0xc5,0x3,0xdf,0xe6,0xfe,0xc0,
+    0xf,0x4a,0xbd,0x1,0x0,0x14,0xdf,0x20,0x61,0x28,0x15,0xe0,0x6b,0x0,0x32,0xbd,
+    0xbb,0x0,0x78,0x36,0x1,0xd0,0x8,0x68,0x79,0x6,0xf4,0xff,0xb5,0x8a,0xb0,0x4,
+    0x0,0x0,0x26,0x16,0xff,0x70,0x48,0x68,0xa,0x9a,0x50,0x60,0x1e,0xfb,0x70,0x20,
+    0x1f,0x0,0x3,0xd0,0x1,0x25,0x8,0xff,0x68,0x28,0x40,0x1,0xd1,0x3,0x20,0x71,
+    0xff,0xe0,0x8,0x69,0x6,0x90,0x48,0x69,0x7,0xff,0x90,0x88,0x69,0x8,0x90,0x0,
+    0x20,0x21,0xff,0x0,0x14,0x31,0x6,0xaa,0xb,0x68,0x17,0xff,0x68,0xbf,0x13,0xdb,
+    0x19,0xb,0x60,0x40,0xff,0x1c,0x12,0x1d,0x9,0x1d,0x3,0x28,0xf5,0xff,0xdb,0xa0,
+    0x68,0x40,0x1c,0xa0,0x60,0xe1,0xbf,0x68,0x88,0x42,0x1c,0xd1,0x20,0x11,0x5,0xe2,
+    0xef,0xff,0x85,0x42,0x50,0x17,0x0,0x0,0x5,0x0,0x6f,0x90,0x69,0x46,0x20,0xe1,
+    0x4,0xba,0xfc,0x41,0x2,0xbf,0x1,0xa8,0x4,0xf0,0xd1,0xfc,0x19,0x1,0xa9,0xff,
+    0x1,0xa8,0xf8,0xf7,0x47,0xfa,0x20,0x34,0xff,0x1,0xa8,0xe,0xc8,0xe,0xc4,0x39,
+    0xe0,0xbf,0x21,0x69,0x88,0x42,0x36,0xd1,0x31,0x12,0xa1,0xba,0x31,0xc,0xb8,0x31,
+    0xc,0x2e,0xfa,0x22,0xcc,0x0,0x1,0xfb,0xa9,0x4,0xb,0x0,0x54,0xfb,0x4,0xa8,
+    0x3,0xff,0xc8,0x80,0xc,0x8a,0x3,0x10,0x43,0x21,0xdf,0x6b,0x88,0x42,0x6,0xda,
+    0x7d,0x2,0x1,0xa9,0xff,0x8c,0xc9,0x8c,0xc0,0xa,0x98,0x5,0x70,0xff,0x34,0x20,
+    0x20,0x5c,0x0,0x28,0x7,0xd1,0xff,0xa,0x98,0x1,0x78,0x48,0x1e,0x80,0x41,0xff,
+    0xc0,0x43,0xc0,0xf,0x34,0x21,0x60,0x54,0xee,0x5d,0x6,0x6b,0xfc,0xa6,0x9,0x1,
+    0xb,0xb0,0xf0,0xef,0xbd,0x1,0x0,0x8,0xfb,0x0,0x4,0xd0,0x34,0xff,0x20,0x8,
+    0x5c,0x0,0x22,0x34,0x31,0xa,0xed,0x70,0xad,0x1,0x68,0x7,0x83,0x1,0x0,0xdb,
+    0x51,0xff,0x1e,0x1,0x60,0x70,0x47,0x0,0x0,0x30,0xff,0x46,0x0,0x20,0xf8,0x45,
+    0x0,0x20,0xb2,0xdf,0xfc,0x6c,0x34,0xa0,0x86,0x31,0x0,0xb2,0x1,0xff,0x0,0xff,
+    0xff,0xff,0x7f,0x90,0xd0,0x3,0xbf,0x0,0x0,0x20,0xc6,0x49,0x8,0x33,0x0,0x11,
+    0xff,0xb5,0x81,0xb0,0x8,0x0,0x14,0x0,0x1,0xff,0x9a,0x14,0x21,0xed,0xf7,0xfe,
+    0xff,0x20,0x57,0x60,0x13,0xbd,0x13,0xe,0x1d,0x13,0x0,0xf4,0x13,0x18,0xf5,0x18,
+    0x13,0x0,0xea,0x13,0x4,0x10,0xb5,0x84,0xb0,0xff,0xc,0x0,0x2,0x21,0x41,0x5e,
+    0x0,0x22,0xff,0x82,0x5e,0x0,0x2a,0x5,0xd1,0x0,0x29,0xff,0x3,0xd1,0x4,0x23,
+    0xc3,0x5e,0x0,0x2b,0xf7,0x20,0xd0,0x6,0x7,0x0,0x1b,0x4,0x23,0x60,0xff,0x12,
+    0x4,0x62,0x60,0x9,0x4,0xa1,0x60,0xff,0x4,0x21,0x40,0x5e,0x0,0x4,0xe0,0x60,
+    0xff,0x20,0x68,0x0,0x90,0x60,0x68,0x1,0x90,0xff,0xa0,0x68,0x2,0x90,0xe0,0x68,
+    0x3,0x90,0xff,0x4,0x22,0x69,0x46,0x68,0x46,0xf9,0xf7,0xff,0x34,0xfd,0x0,0x98,
+    0x20,0x60,0x1,0x98,0xff,0x60,0x60,0x2,0x98,0xa0,0x60,0x3,0x98,0xff,0x3,0xe0,
+    0xb7,0x48,0x20,0x60,0x60,0x60,0xff,0xa0,0x60,0xe0,0x60,0x4,0xb0,0x10,0xbd,0xff,
+    0x80,0xb5,0x0,0xf0,0x78,0xf8,0x2,0xbd,0xff,0x70,0xb5,0x4,0x0,0xe,0x0,0xb1,
+    0x4d,0xff,0x28,0x0,0x88,0x30,0x1,0x78,0x0,0x29,0xff,0x11,0xd1,0x1,0x21,0x1,
+    0x70,0x28,0x0,0xbf,0x0,0xf0,0x34,0xf8,0x31,0x0,0x7,0x2,0xbb,0xbf,0xf8,0x6,
+    0x0,0x9,0xd5,0x29,0xb,0x0,0x4,0xff,0xf0,0x2,0xfc,0x0,0x20,0x20,0x60,0x3,
+    0xff,0xe0,0x14,0x20,0xc0,0x43,0x70,0xbd,0x25,0xff,0x60,0x30,0x0,0x70,0xbd,0xa2,
+    0x49,0x81,0x7f,0x42,0x2,0xd1,0x0,0x20,0x88,0x31,0x1,0x3,0xdf,0x1,0x29,0x2,
+    0xda,0x0,0x41,0x0,0x9,0xe0,0xfe,0x47,0x2,0x10,0x68,0x9c,0x49,0x88,0x42,0x1,
+    0xff,0xda,0x0,0x28,0x1,0xd1,0x48,0x1e,0x10,0xd6,0x6d,0x1,0x70,0x47,0x79,0x2,
+    0xf7,0x79,0x0,0x3c,0xe1,0xf6,0x9,0x2,0x41,0xf9,0x83,0x2,0x86,0xb0,0x5,0x0,
+    0xff,0x0,0x24,0x2c,0x61,0x6c,0x61,0xac,0x61,0xff,0x4,0x94,0x3,0x94,0x2,0x94,
+    0x80,0x26,0xff,0xf6,0x5,0x1,0x96,0x4,0xa8,0x0,0x90,0xff,0x3,0xab,0x2,0xaa,
+    0x1,0xa9,0x28,0x0,0xff,0x1c,0x30,0xee,0xf7,0x73,0xf8,0x28,0x0,0x3d,0x2c,0xb9,
+    0x1,0xc7,0xfb,0x2c,0x64,0x27,0x6,0x23,0x16,0xf5,0x44,0x23,0x0,0x61,0x23,0x0,
+    0x54,0x30,0x4,0x60,0xff,0x44,0x60,0xac,0x66,0xec,0x66,0x2c,0x67,0xff,0x6c,0x67,
+    0xac,0x67,0xec,0x67,0x28,0x0,0x77,0x6,0xb0,0x70,0x63,0x1,0x4,0x0,0x3,0xc1,
+    0x0,0xff,0x20,0x1d,0x0,0x21,0x0,0x22,0x6,0xc0,0xff,0x75,0x48,0x22,0x0,0xc,
+    0x32,0x14,0x21,0xdf,0xff,0xf7,0x22,0xff,0x73,0xb,0x0,0x10,0x32,0x5d,0x1d,0xb,
+    0x0,0x26,0xff,0x71,0xb,0x0,0x14,0xb,0x4,0xff,0x20,0xff,0x80,0x20,0xc0,0x1,
+    0xe0,0x83,0xff,0x0,0x21,0x21,0x83,0x61,0x83,0xa0,0x83,0xdf,0xc0,0x0,0x22,0x0,
+    0x20,0x31,0x4,0x9,0xff,0x75,0x69,0x25,0x0,0x24,0x25,0x4,0xd,0xff,0x67,0xb,
+    0x0,0x5d,0x28,0xb,0x4,0x7,0xff,0x65,0xb,0x0,0x2c,0xb,0x4,0xd7,0x1,0xff,
+    0x63,0xb,0x0,0x30,0xb,0x4,0xfb,0xfe,0xff,0x80,0x20,0x40,0x4,0x22,0x0,0x34,
+    0x32,0x55,0x18,0xd,0x0,0xfe,0xd,0x0,0xc0,0xd,0x0,0x38,0xd,0x4,0x9d,0xf7,
+    0x1b,0x2,0x3,0x3c,0x34,0x75,0x0,0xd,0x0,0xdc,0xbf,0xfe,0x0,0x20,0x10,0xbd,
+    0xf8,0xab,0x0,0xd,0xfd,0x0,0x6f,0x1,0x70,0x1,0x21,0x61,0x70,0x20,0xff,0x73,
+    0x60,0x60,0x28,0x68,0xa0,0x60,0x21,0xff,0x0,0x1c,0x31,0x28,0x1d,0xff,0xf7,0xe8,
+    0xff,0xfe,0xa,0x21,0xe8,0x68,0xf2,0xf7,0xd1,0xff,0xfd,0xa0,0x61,0x2e,0x69,0x68,
+    0x69,0x47,0xbf,0x10,0xf1,0x1b,0x20,0x0,0x10,0x1b,0x1,0xe3,0xbf,0xfa,0xf1,0x19,
+    0x20,0x0,0x14,0x9,0x0,0xde,0xbb,0xfa,0x20,0x2d,0x5,0x34,0xfb,0x20,0x11,0x3,
+    0xf0,0xff,0x30,0xfb,0x21,0x0,0x44,0x31,0x28,0x0,0xdf,0x18,0x30,0xff,0xf7,0xc8,
+    0x3f,0x0,0x28,0x6a,0xff,0xf2,0xf7,0xb1,0xfd,0x20,0x64,0x0,0x21,0xfd,0x68,0x9,
+    0x0,0xac,0xfd,0xa0,0x66,0x0,0x21,0xfd,0xa8,0x9,0x0,0xa7,0xfd,0xe0,0x66,0xe8,
+    0x6a,0xef,0x0,0x90,0x2f,0x6b,0x19,0x0,0x6b,0xf2,0xf7,0xcf,0x9f,0xfd,0xa0,0x67,
+    0x19,0x0,0x9,0x0,0x9a,0xfd,0xff,0xe0,0x67,0xee,0x6b,0x0,0x99,0x20,0x0,0xfd,
+    0x70,0x4f,0x0,0x10,0xfb,0x39,0x0,0x20,0x0,0xfd,0x74,0x9,0x0,0xb,0xfb,0x30,
+    0x0,0xf1,0x17,0xff,0x29,0x4a,0x0,0x23,0xf3,0xf7,0xa9,0xfc,0xff,0xc0,0xf,0x4a,
+    0x0,0x10,0x43,0x80,0x34,0x3d,0x20,0xef,0x1,0xf2,0xbd,0x30,0x42,0xf5,0x1,0xcb,
+    0x0,0xff,0x20,0x78,0x0,0x28,0x2a,0xd0,0x8,0x68,0xff,0xc2,0x49,0x88,0x42,0x1,
+    0xda,0x0,0x28,0xfb,0x4,0xd1,0xdb,0x2,0x17,0x20,0xc0,0x43,0x70,0xbf,0xbd,0x60,
+    0x60,0xc1,0x17,0xbd,0x3d,0x4,0x8a,0xff,0xfc,0x2,0xd,0xd,0x3,0x2a,0x43,0x80,
+    0xff,0x26,0x36,0x3,0x6,0x40,0x0,0xd0,0x52,0xff,0x1c,0x95,0x12,0xa0,0x69,0x81,
+    0x12,0x2a,0x3c,0x69,0x0,0xcb,0x2,0xea,0xfa,0x20,0x6c,0xd,0x6,0xd1,0x2,0xbf,
+    0xe3,0xfa,0x1,0x20,0x60,0x70,0x5f,0x0,0xbd,0xff,0x0,0x0,0xff,0xff,0xff,0x7f,
+    0xa8,0x41,0xff,0x0,0x20,0xa1,0x86,0x1,0x0,0x66,0x66,0xff,0x6,0x0,0x54,0xfb,
+    0x21,0x19,0x6a,0xf4,0xff,0x1d,0x1,0xed,0x39,0x6a,0xfa,0x3e,0x27,0xff,0xf2,0x5e,
+    0x90,0x5b,0x7d,0xde,0x70,0xa4,0x7f,0x82,0x21,0x0,0x0,0x12,0x7a,0x0,0x8b,0x0,
+    0xf5,0x0,0x8b,0x0,0x10,0xa1,0x0,0x70,0x47,0xf4,0xb5,0xfb,0x94,0xb0,0x6b,0x7,
+    0x10,0x60,0x68,0x68,0x14,0xfb,0x99,0x48,0x15,0x0,0x18,0x70,0x28,0x78,0xc0,0xf7,
+    0x7,0x2,0xd5,0xb5,0x2,0x1,0xd1,0x3,0x20,0xff,0x26,0xe1,0x0,0x21,0x28,0x69,
+    0xf2,0xf7,0xcf,0x19,0xfd,0x2,0x90,0x15,0x1,0x9,0x0,0x14,0xfd,0xf5,0x3,0x9,
+    0x0,0xa8,0x9,0x0,0xf,0xfd,0x4,0x90,0xfd,0x60,0x27,0x0,0xb,0xd0,0x20,0x0,
+    0x34,0x30,0xff,0x2,0xa9,0x2c,0xc9,0x2c,0xc0,0x20,0x0,0xf5,0x5c,0x9,0x8,0x0,
+    0xa1,0x0,0x20,0x7a,0xc0,0x7,0xff,0x3d,0xd5,0x86,0x48,0xe1,0x69,0x81,0x42,0xef,
+    0x8,0xd0,0x2,0xaa,0xc5,0x3,0xb,0xa8,0xf7,0xff,0xf7,0x9b,0xff,0x5,0xa8,0xb,
+    0xa9,0x1,0xb7,0xe0,0x5,0xa8,0x2b,0x6,0x5,0xa9,0xe5,0x6,0xa1,0xbf,0xfa,0x3,
+    0x22,0x5,0xa9,0x5,0x21,0x0,0xb7,0xff,0xff,0x20,0x7b,0x7,0x99,0xca,0x17,0x51,
+    0xff,0x40,0x89,0x1a,0x7,0x91,0x21,0x69,0x49,0xff,0x11,0x7,0x9a,0x91,0x42,0x0,
+    0xda,0x1,0xff,0x20,0x11,0x46,0x62,0x69,0x53,0x11,0x99,0xef,0x42,0x3,0xdb,0x8b,
+    0x3,0x0,0xd1,0x6,0x1,0xff,0xd0,0x0,0x20,0x1,0xe0,0x0,0x28,0x8,0xff,0xd1,
+    0x21,0x7b,0x0,0x29,0x5,0xd0,0x14,0xff,0x99,0x9,0x68,0x1,0x22,0xa,0x43,0x14,
+    0xff,0x99,0xa,0x60,0x20,0x73,0x20,0x7a,0x80,0xff,0x7,0x0,0xd4,0xc2,0xe0,0x3,
+    0x22,0x2,0xfb,0xa9,0x2,0x57,0x0,0x8b,0xff,0x0,0x25,0x2,0xbf,0xae,0x30,0x68,
+    0xc1,0x17,0x61,0x77,0x5,0xce,0xff,0xfb,0x0,0xe,0xa,0x2,0x10,0x43,0x30,0xff,
+    0x60,0x6d,0x1c,0x36,0x1d,0x3,0x2d,0xf1,0xff,0xdb,0x5a,0x48,0x61,0x6c,0x81,0x42,
+    0xb,0x3a,0xad,0x4,0x44,0xad,0x4,0x44,0xff,0x2,0xad,0x0,0xa7,0x2,0xf,0x7,
+    0xa8,0x2,0xe0,0x3,0x0,0xb,0x6,0xb3,0x0,0x8b,0x3,0xff,0x47,0xfa,0x7,0x99,
+    0x48,0x42,0xa,0x90,0xff,0x7,0xa9,0x8,0x31,0xa,0xa8,0x4,0xf0,0xff,0x66,0xfa,
+    0x40,0x10,0x5,0x90,0x8,0x98,0xff,0xc1,0x17,0xc9,0x6,0x42,0x9,0x11,0x43,0xff,
+    0xc0,0x6,0xce,0x17,0xcf,0x17,0x46,0x4a,0xff,0x70,0x40,0x79,0x40,0x3b,0x0,0x80,
+    0x1b,0xff,0x99,0x41,0xf4,0xf7,0xc5,0xf8,0x70,0x40,0xff,0x87,0x1b,0x2,0xa9,0xe,
+    0xa8,0xf3,0xf7,0xdf,0x95,0xfe,0xe,0xa9,0xb,0x7,0x0,0x91,0xfe,0xff,0x0,0x20,
+    0xb,0xa9,0x7,0xaa,0xb,0x68,0xff,0x15,0x68,0x5b,0x1b,0xb,0x60,0x40,0x1c,0xff,
+    0x12,0x1d,0x9,0x1d,0x3,0x28,0xf6,0xdb,0xfd,0x11,0x7d,0x8,0x0,0x20,0x6,0x90,
+    0x0,0x22,0xff,0x0,0x23,0x11,0xae,0x3,0x25,0x30,0x68,0xff,0x40,0x10,0xc1,0x17,
+    0x0,0x92,0x1,0x93,0xff,0x2,0x0,0xb,0x0,0xf3,0xf7,0x6a,0xfb,0xff,0x0,0x9a,
+    0x1,0x9b,0x80,0x18,0x59,0x41,0xfe,0xf,0x2,0x36,0x1d,0x6d,0x1e,0xed,0xd1,0x2,
+    0xff,0x20,0x0,0x90,0x6,0xa8,0xfb,0xf7,0x64,0xff,0xfa,0x6,0x98,0x41,0x0,0xa0,
+    0x6e,0x42,0xff,0x10,0x5,0x9b,0x93,0x42,0xd,0xdb,0x9a,0xff,0x42,0x1,0xdb,0xc0,
+    0x7,0x9,0xd4,0xe0,0xbf,0x6e,0x40,0x10,0x98,0x42,0x1,0x53,0x1,0x0,0xdd,0xe0,
+    0x43,0x1,0x22,0x42,0x40,0x7,0x0,0x22,0x20,0xff,0x6f,0x87,0x42,0x8,0xdb,0x60,
+    0x6f,0xb8,0xf6,0x19,0xe,0x23,0x43,0x19,0x2,0x23,0xa0,0x6f,0x88,0xfe,0x13,0xe,
+    0x25,0x45,0x40,0x20,0x0,0x84,0x30,0xff,0xe6,0x6f,0xb1,0x42,0x2,0xdb,0x80,0x21,
+    0xff,0x61,0x58,0x1,0x60,0x1,0x68,0x1,0x29,0xff,0xd,0xdb,0x64,0x68,0x9,0x1b,
+    0x1,0x60,0x5f,0x13,0x40,0x2b,0x42,0x7,0x8b,0x5,0x2,0x8b,0x9,0xff,0x0,0x21,
+    0x1,0x60,0x0,0x20,0x15,0xb0,0xff,0xf0,0xbd,0x0,0x0,0x8,0xb2,0x1,0x0,0xff,
+    0x83,0xde,0x1b,0x43,0xff,0xff,0xff,0x7f,0xff,0xcd,0xcc,0xcc,0x9,0x0,0x20,0x53,
+    0x49,0xff,0x8,0x70,0x70,0x47,0x10,0xb5,0x4,0x0,0xff,0x0,0x23,0x1,0x22,0x18,
+    0x21,0x50,0x48,0xff,0xf7,0xf7,0xcc,0xf9,0x20,0x60,0x4f,0x48,0xfd,0x60,0x35,0x0,
+    0x10,0xbd,0x70,0xb5,0x6,0x0,0xff,0x4d,0x4c,0x30,0x20,0x20,0x5c,0x0,0x28,0xff,
+    0xd,0xd1,0x1,0x20,0x30,0x22,0xa0,0x54,0xff,0x0,0x25,0x25,0x61,0x20,0x0,0x0,
+    0xf0,0xff,0x1f,0xf8,0x0,0x28,0x6,0xd5,0x30,0x34,0xff,0x25,0x70,0x0,0x24,0x2,
+    0xe0,0x14,0x20,0xff,0xc0,0x43,0x70,0xbd,0x34,0x60,0x70,0xbd,0xff,0x41,0x49,0x81,
+    0x42,0x2,0xd1,0x0,0x20,0xfb,0x30,0x31,0x5b,0x2,0x80,0xb5,0x0,0xf0,0x30,0xd7,
+    0xf8,0x2,0xbd,0x7,0x2,0x4d,0x7,0x0,0x7a,0xe0,0xfa,0x9,0x2,0x7f,0x9,0x0,
+    0xf0,0xb5,0x5,0x0,0xc,0xff,0x0,0x0,0x26,0x2e,0x73,0x20,0x68,0xc2,0xff,0x11,
+    0x2a,0x61,0x2f,0x0,0x10,0x37,0x10,0xff,0x46,0xc1,0x17,0xd3,0x17,0xf3,0xf7,0xbe,
+    0xff,0xfa,0x40,0xc,0xca,0x3,0x10,0x43,0x38,0xff,0x60,0x60,0x68,0x68,0x61,0xae,
+    0x61,0x29,0xff,0x0,0x1c,0x31,0x3,0x22,0xe,0x60,0x9,0xff,0x1d,0x52,0x1e,0xfb,
+    0xd1,0xae,0x62,0x28,0xff,0x0,0x2c,0x30,0x6,0x70,0x46,0x70,0x0,0xff,0x20,0x28,
+    0x70,0x6e,0x60,0xf0,0xbd,0x1,0xf7,0x29,0x7,0xda,0xe9,0x0,0x73,0x1,0x70,0x41,
+    0xef,0x60,0x2c,0x30,0x1,0x17,0x0,0x70,0x47,0x1,0xfe,0xf,0x0,0x11,0x68,0x0,
+    0x78,0x2,0x28,0x9,0xf7,0xd1,0x0,0x29,0x91,0x2,0xc0,0x43,0x8,0xe0,0xff,0x1a,
+    0x48,0x81,0x42,0x6,0xdb,0x40,0x1e,0xff,0x3,0xe0,0x19,0x48,0x49,0x1e,0x81,0x42,
+    0xf7,0x0,0xd3,0x10,0xe9,0x0,0x70,0x47,0x2,0x7b,0xff,0x0,0x2a,0xa,0xd0,0x2,
+    0x78,0x9,0x68,0xff,0x1,0x2a,0x8,0xd1,0x0,0x22,0x2,0x70,0xff,0x4a,0x1e,0x11,
+    0x4b,0x9a,0x42,0xf,0xd2,0xdb,0x81,0x61,0x1f,0x4,0x2a,0x6,0x15,0x0,0xd2,0x43,
+    0xf9,0x91,0xdb,0x2,0x1d,0x0,0xf3,0xe7,0x4a,0x1e,0x9,0xd6,0x1f,0x0,0xef,0xd3,
+    0x77,0x2,0x17,0xfd,0x2,0x47,0x40,0xff,0x47,0x0,0x20,0x3b,0xb4,0x48,0x3f,0x20,
+    0xef,0xa1,0x7,0x0,0x10,0xb,0x0,0xa1,0x86,0x1,0xeb,0x0,0xa0,0x3,0x0,0x7,
+    0x77,0x1,0x0,0x7b,0x0,0xdf,0x28,0x0,0xd0,0x8,0x68,0x6d,0x6,0xfe,0xb5,0xfb,
+    0x89,0xb0,0x73,0x1,0x20,0x10,0x70,0x9,0x98,0xdf,0x40,0x68,0xa,0x99,0x48,0x15,
+    0x0,0xb,0x99,0xff,0x8,0x70,0x1,0x26,0x9,0x98,0x0,0x68,0xdf,0x30,0x40,0x2,
+    0xd0,0x20,0x2f,0x0,0x1,0xd1,0xef,0x3,0x20,0x98,0xe0,0x11,0x0,0x69,0x3,0x90,
+    0x76,0x27,0x0,0x69,0x4,0x5,0x0,0x80,0x69,0x5,0xb,0x2,0xff,0x68,0x2c,0x21,
+    0x61,0x5c,0x0,0x29,0x7,0x7f,0xd0,0x61,0x69,0xa2,0x68,0x82,0x1a,0x95,0x0,0xbf,
+    0xd2,0x0,0x21,0x2c,0x22,0xa1,0x9d,0x1,0xa0,0xfb,0x60,0x2c,0xaf,0x5,0xa,0xd1,
+    0x20,0x0,0x1c,0x7f,0x30,0x3,0xa9,0x2c,0xc9,0x2c,0xc0,0x31,0x2,0xff,0xa0,0x62,
+    0x2c,0x34,0x26,0x70,0x6f,0xe0,0xff,0x6,0xa8,0x3,0xa9,0x3,0x22,0xb,0x68,0xd5,
+    0x3,0x4d,0x1,0x0,0x4f,0x1,0xf9,0x19,0x1,0x6,0xa9,0xff,0x22,0x0,0x1c,0x32,
+    0xb,0x68,0x17,0x68,0xff,0xdb,0x1b,0xb,0x60,0x40,0x1c,0x12,0x1d,0xff,0x9,0x1d,
+    0x3,0x28,0xf6,0xdb,0x0,0x20,0xff,0x0,0x21,0x6,0xaf,0x3,0x22,0x2,0x92,0xff,
+    0x3a,0x68,0x52,0x10,0xd3,0x17,0x0,0x90,0xff,0x1,0x91,0x10,0x0,0x19,0x0,0xf3,
+    0xf7,0xff,0xed,0xf9,0x0,0x9a,0x1,0x9b,0x80,0x18,0xff,0x59,0x41,0x3f,0x1d,0x2,
+    0x9a,0x52,0x1e,0xff,0x2,0x92,0xed,0xd1,0x22,0x69,0x40,0xf,0xff,0xcb,0x0,0x18,
+    0x43,0x82,0x42,0x27,0xdb,0xff,0x60,0x69,0x9,0x99,0x49,0x68,0xa2,0x6a,0xff,0x89,
+    0x1a,0x88,0x42,0xd,0xd2,0x1,0x25,0xee,0x8b,0x6,0x8c,0xc9,0x8c,0x8b,0x8,0x60,
+    0x68,0xa,0xbf,0x28,0x1,0xd2,0x40,0x1c,0x60,0xe1,0x1,0xa,0xdf,0x28,0x6,0xd3,
+    0x20,0x78,0xef,0x2,0xb,0x98,0xff,0x6,0x70,0x2,0x20,0x20,0x70,0x0,0x2d,0xf7,
+    0x1b,0xd0,0x20,0xe3,0x1,0x40,0x78,0xa8,0x42,0xdd,0x11,0x9f,0x0,0x10,0xe0,0x2,
+    0x41,0x1c,0x0,0x20,0xf7,0x60,0x60,0x20,0xdd,0x1,0xea,0xd1,0x26,0x70,0xdf,0xe8,
+    0xe7,0x28,0x0,0xa,0x3f,0x1,0x2c,0x34,0xfd,0x65,0xfb,0x1,0xc,0xb0,0xf0,0xbd,
+    0x0,0x20,0xff,0x49,0x49,0x8,0x70,0x70,0x47,0x80,0xb5,0xff,0x0,0xf0,0x4d,0xf8,
+    0x2,0xbd,0x70,0xb5,0xff,0x4,0x0,0xe,0x0,0x45,0x4d,0x70,0x20,0xfd,0x28,0x1b,
+    0x1,0x12,0xd1,0x1,0x20,0x70,0x21,0xff,0x68,0x54,0x28,0x0,0x0,0xf0,0x34,0xf8,
+    0xfd,0x31,0x9a,0x1,0x0,0xf0,0x8f,0xf8,0x6,0x0,0xf7,0x9,0xd5,0x29,0xb,0x0,
+    0x4,0xf0,0x67,0xf8,0x7f,0x0,0x20,0x20,0x60,0x3,0xe0,0x14,0xd7,0x3,0xff,0xbd,
+    0x25,0x60,0x30,0x0,0x70,0xbd,0x36,0xbb,0x49,0x81,0xfb,0x3,0x20,0x70,0x31,0x57,
+    0x2,0x1,0xf7,0x29,0x2,0xda,0xf9,0x1,0x70,0x9,0xe0,0x1,0xfe,0x5,0x0,0x10,
+    0x68,0x2f,0x49,0x88,0x42,0x1,0x4d,0xda,0xc3,0x2,0x48,0x1e,0xe3,0x7,0x79,0x2,
+    0x2c,0x79,0x0,0xeb,0x5b,0xe0,0x9,0x2,0x8a,0x9,0x0,0x0,0x21,0x81,0xff,0x63,
+    0xc1,0x63,0x1,0x64,0x41,0x64,0x81,0xff,0x64,0xc1,0x64,0x1,0x65,0x41,0x65,0x70,
+    0xfb,0x47,0x10,0x97,0x0,0x21,0x4a,0x1d,0x21,0x1d,0xff,0x20,0xed,0xf7,0x1d,0xfb,
+    0x20,0x60,0xa,0xef,0x22,0x0,0x21,0x0,0xb,0x0,0x17,0xfb,0x60,0xfb,0x60,0x3c,
+    0xb,0x8,0x11,0xfb,0xa0,0x60,0x19,0xae,0x23,0x8,0xb,0xfb,0xe0,0x5d,0x0,0x10,
+    0xcf,0x0,0x2,0xff,0x78,0x0,0x2a,0x1c,0xd0,0x9,0x68,0x14,0xbb,0x4a,0x91,0x79,
+    0x2,0x29,0x4,0xd1,0x8f,0x2,0x17,0xfe,0xb1,0x4,0x41,0x60,0x4,0x0,0x48,0x34,
+    0x8,0xff,0x46,0xc1,0x17,0xd,0x4a,0x0,0x23,0xf3,0xff,0xf7,0x16,0xf9,0x82,0xc,
+    0x8d,0x3,0x2a,0xff,0x43,0x80,0x26,0xb6,0x2,0x6,0x40,0x0,0xef,0xd0,0x52,0x1c,
+    0x22,0xa3,0x2,0xbd,0x0,0x0,0xff,0x28,0x45,0x0,0x20,0xb8,0x44,0x0,0x20,0xff,
+    0xa1,0x86,0x1,0x0,0x2b,0x87,0x16,0x1,0xff,0x66,0x66,0x66,0xe,0x8,0xb2,0x1,
+    0x0,0xdf,0x83,0xde,0x1b,0x43,0x0,0x93,0x1,0x0,0xd0,0xf3,0x8,0x68,0xcf,0x6,
+    0x41,0x3,0xd,0x0,0x0,0x26,0xff,0x26,0x70,0x66,0x60,0xa6,0x60,0xe6,0x60,0xff,
+    0x26,0x61,0x66,0x61,0x1c,0x21,0x18,0x30,0xff,0xf2,0xf7,0x27,0xfd,0x66,0x63,0x28,
+    0x68,0xff,0xa0,0x63,0xe8,0x68,0x81,0x10,0x40,0x10,0xff,0xc0,0x7,0x0,0xd5,0x49,
+    0x1c,0xe1,0x63,0xff,0x26,0x64,0x66,0x64,0xa6,0x64,0x68,0x68,0xff,0xe0,0x64,0xa8,
+    0x68,0x0,0x6,0x20,0x65,0xf7,0x20,0x0,0x58,0x2b,0x0,0x13,0xfd,0x64,0x34,0xbf,
+    0x20,0x0,0xf2,0xf7,0xf,0xfd,0x7f,0x2,0xf4,0xff,0xb5,0x96,0xb0,0x4,0x0,0x3,
+    0x20,0xd,0xff,0x90,0x48,0x68,0x16,0x9a,0x50,0x60,0x4,0xff,0x20,0x16,0x9d,0x28,
+    0x70,0x0,0x22,0x1a,0xff,0x70,0xa,0x78,0xd2,0x7,0x2,0xd5,0x22,0xfe,0xe3,0x0,
+    0x1,0xd1,0x3,0x20,0xcf,0xe1,0x6a,0xff,0x46,0x10,0x70,0x8,0x69,0xa0,0x65,0x48,
+    0xff,0x69,0xe0,0x65,0x88,0x69,0x20,0x66,0x20,0xdf,0x69,0x40,0x1c,0x20,0x61,0x53,
+    0x2,0x3,0xf0,0xff,0x99,0xff,0x14,0x90,0x21,0x0,0x38,0x31,0xbf,0x14,0xa8,0x3,
+    0xf0,0x98,0xff,0x83,0x1,0xd0,0xd7,0x0,0x20,0xa0,0x6f,0x0,0x5c,0x1b,0x0,0x8b,
+    0xff,0x55,0x13,0x1b,0x4,0x13,0x1b,0x0,0x8a,0x1b,0x8,0xe0,0x1b,0x0,0x5d,0x60,
+    0x1b,0x0,0x7d,0xff,0x12,0x1b,0x4,0x12,0x1b,0x0,0xfd,0x7c,0x1b,0x8,0x20,0x66,
+    0x22,0x0,0x48,0x32,0x7f,0x21,0x0,0x40,0x31,0x20,0x0,0x40,0x23,0x0,0xab,0x82,
+    0xff,0xf,0x6,0x44,0xf,0x0,0x44,0xf,0x0,0x7a,0xff,0xff,0x0,0x20,0xc,0x90,
+    0xb,0x90,0xa,0xef,0x90,0x22,0x0,0x64,0x17,0x0,0x58,0x31,0xc,0xea,0x3d,0x0,
+    0x78,0x25,0x0,0x68,0xd,0x0,0x5c,0x31,0xb,0xea,0xd,0x0,0x71,0xd,0x0,0x6c,
+    0xd,0x0,0x60,0x31,0xa,0xfe,0xd,0x0,0x6a,0xff,0xc,0x98,0x1,0x28,0x5,0xff,
+    0xda,0xa0,0x6d,0x0,0x28,0x14,0xd1,0x60,0xbf,0x6e,0x0,0x28,0x11,0xd1,0xb,0x11,
+    0x4,0xe0,0xee,0x11,0x0,0xb,0xd1,0xa0,0x11,0x0,0x8,0xd1,0xa,0xee,0x11,0x0,
+    0xb,0xda,0x20,0xb,0x0,0x2,0xd1,0xe0,0xfe,0x5,0x0,0x5,0xd0,0xa0,0x68,0x40,
+    0x1c,0xa0,0x73,0x60,0xe0,0x5,0x0,0xf1,0x3,0x1,0x90,0x60,0xf1,0x0,0xff,0x60,
+    0x61,0x2,0x4,0xa1,0x6c,0x8,0x14,0xff,0x9,0x4,0x0,0xd5,0x40,0x1c,0xc1,0x17,
+    0xff,0xd3,0x17,0xf3,0xf7,0x28,0xf8,0x2,0xc,0xeb,0xd,0x4,0xdb,0x3,0x36,0xdb,
+    0x9,0x10,0x14,0xe1,0xff,0x6c,0x88,0x42,0x7,0xdb,0xe0,0x68,0x7,0xef,0x28,0x1,
+    0xd3,0x1,0x3b,0x0,0x0,0x20,0x60,0xff,0x61,0xa0,0x60,0xa0,0x6c,0xc1,0x17,0x22,
+    0xfd,0x69,0x33,0x2,0xe,0xf8,0x2,0xa,0xd,0x6,0xfc,0x33,0x2,0x31,0x6,0x20,
+    0x6d,0x82,0x42,0x0,0xda,0xf7,0x11,0xe1,0x0,0x89,0x1,0xe6,0x6a,0x26,0x63,0xff,
+    0xa5,0x6a,0xe5,0x62,0x60,0x6a,0x9,0x90,0xff,0xa0,0x62,0x20,0x6a,0x8,0x90,0x60,
+    0x62,0xff,0xe0,0x69,0x7,0x90,0x20,0x62,0xa0,0x69,0xff,0x6,0x90,0xe0,0x61,0xe0,
+    0x68,0xa0,0x61,0xff,0xc1,0x17,0x85,0x4a,0x0,0x23,0xf2,0xf7,0xff,0xea,0xff,0x2,
+    0xaa,0x3,0xc2,0x60,0x6b,0xff,0x6,0x28,0x17,0xd2,0x2,0xa8,0x3,0xc8,0x7f,0x3,
+    0xc2,0x4,0xa9,0x20,0x0,0x54,0x27,0x1,0x95,0x3d,0x3,0x1,0x3c,0x3,0x1,0x54,
+    0x37,0x1,0xf,0x2,0x7d,0xfe,0x37,0x1,0x60,0x64,0x69,0x46,0x8,0x70,0x60,0xdd,
+    0x6b,0xc7,0x0,0x63,0xca,0xe0,0x17,0x2,0x11,0x90,0xdf,0x30,0x0,0xf1,0x17,0x72,
+    0x4b,0x4,0xc4,0xff,0x7f,0x6,0x0,0xf,0x0,0x28,0x0,0xe9,0xf,0x8,0xbf,0xbc,
+    0xff,0x80,0x19,0x79,0x41,0x13,0x2,0x9,0xaf,0x98,0xc1,0x17,0x6a,0x13,0x4,0xb2,
+    0x13,0xc,0x8,0xaa,0x13,0x0,0x66,0x13,0x4,0xa8,0x13,0xc,0x7,0x13,0x0,0x62,
+    0xaa,0x13,0x4,0x9e,0x13,0xc,0x6,0x13,0x0,0x5e,0x13,0x4,0x94,0xfe,0x13,0x4,
+    0x2,0xaa,0xc,0xca,0x12,0x18,0x4b,0xbf,0x41,0x4,0xa8,0xc,0xc0,0x4,0xb1,0x0,
+    0xc0,0xff,0x9,0x4a,0x6,0x10,0x43,0xc9,0x11,0x56,0xff,0xa2,0xc,0xca,0x99,0x42,
+    0x4,0xdc,0x1,0xff,0xdb,0x90,0x42,0x1,0xd2,0x10,0x46,0x3b,0xbf,0xe0,0x0,0x27,
+    0xb9,0x42,0xd,0xf,0x4,0xa,0xff,0xd2,0xd6,0x43,0xb9,0x42,0x9,0xdb,0x1,0xbf,
+    0xdc,0xb0,0x42,0x6,0xd3,0x4,0x41,0x0,0x7f,0xff,0x26,0x16,0x40,0x1,0xd0,0x4b,
+    0x48,0x28,0xdd,0xe0,0xff,0x2,0xc,0xca,0x40,0xf,0x0,0x6,0xd0,0xfe,0x5b,0x2,
+    0x0,0x25,0x52,0x1c,0x6b,0x41,0x2,0x57,0xad,0xc,0xc5,0xd,0x2,0xe,0x7,0x0,
+    0xe,0x15,0x2,0x7f,0x2b,0x1,0xd1,0x0,0x2a,0xf,0xd0,0x7,0x0,0x7f,0xdb,0x1,
+    0x25,0x0,0xe0,0x0,0x25,0x45,0x2,0xfa,0xd,0x4,0x22,0xd,0x0,0x22,0x95,0x42,
+    0x1,0xd0,0xf5,0xe,0x49,0x0,0xe,0x91,0x0,0x11,0x99,0x8,0x60,0xfe,0x3b,0x17,
+    0xdf,0xfe,0x60,0x6d,0x0,0x16,0x1,0xdf,0x28,0x1,0xda,0x1,0x20,0x2d,0x0,0x20,
+    0x1,0xff,0x99,0x1,0x43,0x9,0x6,0x4,0xd1,0x1,0xf9,0x20,0x4f,0x3,0x57,0x3,
+    0x1,0x98,0x0,0x28,0x4,0xfb,0xd0,0x0,0xf,0x4,0x60,0x64,0x1c,0xe0,0x68,0xff,
+    0x46,0x0,0x78,0x4,0x28,0x18,0xd1,0x96,0xbf,0x20,0xc0,0x0,0x1,0x90,0x1,0x93,
+    0x1,0x44,0xfe,0x47,0x0,0x9,0xff,0x0,0x28,0xb,0xd0,0xe1,0xae,0x13,0x0,0x10,
+    0x90,0x10,0x13,0x0,0x40,0x13,0x0,0xff,0xbf,0xfe,0x0,0x28,0x1,0xd0,0x3,0x57,
+    0x0,0x2,0xde,0x4d,0x8,0x20,0x61,0xe0,0x60,0x3f,0x2,0x2,0x28,0xfb,0x9,0xda,
+    0x23,0x2,0x21,0x6d,0x8a,0x12,0x89,0xff,0x5,0x0,0xd5,0x52,0x1c,0x21,0x6c,0x89,
+    0xff,0x1a,0x1,0x60,0xa0,0x6d,0x60,0x66,0xe0,0x7f,0x6d,0xa0,0x66,0x20,0x6e,0xe0,
+    0x66,0x27,0x2,0xff,0x16,0x99,0x8,0x70,0xd,0x98,0x17,0xb0,0xf7,0xf0,0xbd,0x0,
+    0x0,0x0,0x14,0xae,0x47,0x1,0xff,0x6,0x81,0x95,0x3,0xd9,0xce,0xf7,0x3,0xff,
+    0xae,0x47,0xe1,0xa,0x1f,0x85,0xeb,0x1,0xf6,0x16,0x0,0x80,0xff,0x0,0x6,0x7f,
+    0x0,0x20,0x4b,0xff,0x49,0x8,0x70,0x70,0x47,0x4f,0xe0,0x70,0xff,0xb5,0x5,0x0,
+    0xc,0x0,0xa9,0x4e,0x30,0xbf,0x20,0x30,0x5c,0x0,0x28,0xe,0xcd,0x0,0x30,0xff,
+    0x21,0x70,0x54,0x30,0x0,0x0,0xf0,0x38,0xff,0xf8,0x0,0x20,0x30,0x70,0x20,0x68,
+    0x70,0xff,0x60,0x60,0x68,0x30,0x72,0x2e,0x60,0x0,0xff,0x20,0x70,0xbd,0x14,0x20,
+    0xc0,0x43,0x70,0x7f,0xbd,0x9e,0x49,0x81,0x42,0x2,0xd1,0x1d,0x0,0xfd,0x31,0x43,
+    0x2,0x10,0xb4,0x1,0x29,0x1,0xda,0xff,0x0,0x21,0xf,0xe0,0x11,0x68,0x98,0x4c,
+    0xfb,0xa1,0x42,0xb,0x0,0x29,0x1,0xd1,0x61,0x1e,0xef,0x11,0x60,0x19,0x68,0xd,
+    0xe,0x19,0x60,0x1,0xfb,0x21,0x1,0xd7,0x0,0x10,0xbc,0x70,0x47,0x80,0xff,0xb5,
+    0x0,0xf0,0x1a,0xf8,0x2,0xbd,0x55,0xff,0xe0,0x10,0xb5,0x82,0xb0,0x4,0x9c,0x0,
+    0xff,0x94,0x0,0xf0,0x57,0xf8,0x16,0xbd,0x0,0xff,0xbf,0x0,0x21,0x41,0x60,0x1,
+    0x61,0x41,0xff,0x61,0x81,0x61,0xc1,0x61,0x1,0x62,0x41,0xff,0x62,0x70,0x47,0xa0,
+    0x21,0x9,0x5,0x1,0xf3,0x60,0x5,0x17,0x0,0x7f,0x0,0x47,0x70,0xb5,0x4,0xff,
+    0x0,0x20,0x78,0x0,0x28,0x34,0xd0,0x8,0x7f,0x68,0x7d,0x49,0x88,0x42,0x6,0xda,
+    0x71,0x3,0xb7,0x12,0x68,0x8a,0x67,0x2,0x2a,0x4,0x93,0x0,0x20,0xfb,0x70,0x17,
+    0xa3,0x4,0xe0,0x60,0x76,0x49,0x8d,0xff,0x8,0xc1,0x17,0x76,0x4a,0x0,0x23,0xf2,
+    0xff,0xf7,0x59,0xfe,0x40,0xd,0xca,0x2,0x10,0xff,0x43,0x2d,0x18,0x26,0x0,0x20,
+    0x36,0x0,0xff,0x2d,0x1,0xd1,0x71,0x48,0xa,0xe0,0xe8,0xff,0x17,0x1,0x0,0x69,
+    0x40,0xa,0x1a,0x0,0xff,0x20,0x6e,0x49,0xf3,0xf7,0x79,0xfb,0xe9,0xff,0x17,0x48,
+    0x40,0x40,0x1a,0x30,0x60,0x20,0xff,0x6a,0x40,0x10,0x80,0x21,0xc9,0x5,0x40,0xf7,
+    0x18,0x60,0x62,0xf5,0x2,0x0,0x0,0x8,0x47,0x57,0x0,0x20,0x0,0x77,0x0,0x0,
+    0x77,0x0,0x18,0x89,0x4,0xff,0xfc,0xb5,0x83,0xb0,0x4,0x0,0xd,0x0,0xff,0x0,
+    0x20,0x18,0x70,0x68,0x68,0x4,0x99,0xe5,0x48,0x15,0x0,0xa,0x83,0x1,0x9d,0x2,
+    0x47,0xd0,0x28,0xff,0x78,0xc0,0x7,0x44,0xd5,0x18,0x21,0x28,0xff,0x69,0xf6,0xf7,
+    0x1f,0xfd,0x0,0x90,0x18,0xbb,0x21,0x68,0x9,0x0,0x1a,0xfd,0x1,0x9,0x0,0xa8,
+    0xfe,0x9,0x0,0x15,0xfd,0x2,0x90,0x20,0x78,0x1,0xff,0x28,0x2,0xd0,0x2,0x28,
+    0x33,0xd0,0x2f,0xbf,0xe0,0xe0,0x68,0xc1,0x17,0x4b,0xa9,0x4,0x4,0xfe,0xa9,0x8,
+    0x21,0x0,0x10,0x31,0xa,0x68,0x40,0xbf,0x0,0x10,0x18,0x8,0x60,0x48,0xe9,0x0,
+    0x1d,0xff,0xdb,0x0,0x25,0x6e,0x46,0x3,0x27,0x31,0xff,0x68,0x8,0x0,0xf7,0xf7,
+    0xe8,0xff,0x29,0xfe,0x5,0x0,0x46,0xfd,0x5,0x0,0x36,0x1d,0x7f,0xff,0x1e,0xf4,
+    0xd1,0xf7,0xf7,0xac,0xff,0x0,0xff,0x23,0x0,0x22,0x17,0x21,0xf6,0xf7,0xaf,0xff,
+    0xfc,0x60,0x61,0x0,0x20,0xa0,0x61,0xe0,0xff,0x61,0x3,0x98,0x80,0x68,0xa0,0x62,
+    0x2,0x7e,0x13,0x1,0x3,0x20,0x5,0xb0,0xf0,0xbd,0x41,0x6,0x57,0x30,0x68,0x1,
+    0x3b,0x0,0xc7,0x41,0x4,0x25,0x41,0x10,0xfd,0x8b,0x41,0xc,0x8e,0xfc,0x5,0x0,
+    0x60,0x69,0xff,0x2a,0x1a,0x60,0x6a,0xc1,0x17,0xd3,0x17,0xff,0xf2,0xf7,0xba,0xfd,
+    0xc0,0xf,0x4a,0x0,0xff,0x10,0x43,0x6,0x0,0xc7,0x17,0xff,0x7,0xff,0x70,0x8,
+    0x7,0x43,0xf6,0x7,0xa0,0x69,0xef,0xc1,0x17,0x22,0x6a,0x1d,0x2,0xab,0xfd,0x80,
+    0xf7,0x19,0x79,0x41,0x21,0xa,0x1,0xd1,0x0,0x22,0xff,0x0,0xe0,0x32,0x0,0xd3,
+    0x17,0xdb,0x7,0x7f,0x50,0x8,0x3,0x43,0xd2,0x7,0xe0,0x29,0x0,0xff,0xc9,0x4,
+    0x47,0xb,0x39,0x43,0xc0,0x4,0x77,0x80,0x18,0x59,0x29,0x8,0x65,0x61,0xa6,0xa1,
+    0x2,0xff,0x99,0x89,0x68,0xa2,0x6a,0x89,0x1a,0x22,0xff,0x7a,0x91,0x42,0x7,0xd2,
+    0x61,0x68,0x4a,0xff,0x10,0x90,0x42,0xa8,0xdb,0x82,0x42,0x1,0xdf,0xdb,0xc8,0x7,
+    0xa4,0xd4,0xcd,0x1,0x61,0x1,0xfb,0x20,0x4,0x55,0x1,0x0,0x20,0x9e,0xe7,0x0,
+    0xfe,0x0,0x0,0xd8,0x46,0x0,0x20,0x41,0x9c,0x0,0xff,0x0,0xb8,0x1e,0x85,0xb,
+    0x83,0xde,0x1b,0xff,0x43,0xff,0xff,0xff,0x7f,0xd7,0xa3,0x70,0xfb,0x1,0x1,0x87,
+    0x1,0x0,0x20,0xc5,0x49,0x8,0xff,0x70,0x70,0x47,0x11,0xb5,0x81,0xb0,0x8,0xff,
+    0x0,0x14,0x0,0x1,0x9a,0x14,0x21,0xec,0x7f,0xf7,0x36,0xff,0x20,0x60,0x13,0xbd,
+    0x13,0xe,0xf5,0x1d,0x13,0x0,0x2c,0x13,0x4,0x10,0xb5,0x84,0xb0,0xff,0xc,0x0,
+    0x2,0x21,0x41,0x5e,0x0,0x22,0xff,0x82,0x5e,0x0,0x2a,0x5,0xd1,0x0,0x29,0xff,
+    0x3,0xd1,0x4,0x23,0xc3,0x5e,0x0,0x2b,0xf7,0x20,0xd0,0x6,0x7,0x0,0x1b,0x4,
+    0x23,0x60,0xff,0x12,0x4,0x62,0x60,0x9,0x4,0xa1,0x60,0xff,0x4,0x21,0x40,0x5e,
+    0x0,0x4,0xe0,0x60,0xff,0x20,0x68,0x0,0x90,0x60,0x68,0x1,0x90,0xff,0xa0,0x68,
+    0x2,0x90,0xe0,0x68,0x3,0x90,0xff,0x4,0x22,0x69,0x46,0x68,0x46,0xf8,0xf7,0xff,
+    0x76,0xfc,0x0,0x98,0x20,0x60,0x1,0x98,0xff,0x60,0x60,0x2,0x98,0xa0,0x60,0x3,
+    0x98,0xff,0x3,0xe0,0xa2,0x48,0x20,0x60,0x60,0x60,0xff,0xa0,0x60,0xe0,0x60,0x4,
+    0xb0,0x10,0xbd,0xff,0x80,0xb5,0x0,0xf0,0x67,0xf8,0x2,0xbd,0xff,0x70,0xb5,0x4,
+    0x0,0xe,0x0,0x9c,0x4d,0xff,0x28,0x0,0x80,0x30,0x1,0x78,0x0,0x29,0xff,0x11,
+    0xd1,0x1,0x21,0x1,0x70,0x28,0x0,0xbf,0x0,0xf0,0x3c,0xf8,0x31,0x0,0x7,0x2,
+    0x9b,0xbf,0xf8,0x6,0x0,0x9,0xd5,0x29,0xb,0x0,0x3,0xf7,0xf0,0x5,0xfd,0x3,
+    0x1,0x60,0x3,0xe0,0x14,0xff,0x20,0xc0,0x43,0x70,0xbd,0x25,0x60,0x30,0xff,0x0,
+    0x70,0xbd,0x8d,0x49,0x81,0x42,0x2,0xdf,0xd1,0x0,0x20,0x80,0x31,0xed,0x2,0x10,
+    0xb5,0xff,0x82,0xb0,0x4,0x9c,0x0,0x94,0x0,0xf0,0xd7,0xb9,0xf8,0x16,0x65,0x4,
+    0xd1,0x65,0x0,0x81,0xb0,0xef,0x3c,0x30,0x0,0x78,0x42,0x0,0xd0,0x8,0x68,0xff,
+    0x1,0x99,0x8,0x60,0x0,0x20,0x1,0xb0,0xbb,0x70,0x47,0x1d,0x2,0xa,0xf9,0x2,
+    0x25,0x4,0xba,0xf5,0xfa,0x7,0x6,0xcc,0x7,0x0,0x0,0x21,0x80,0x22,0xff,0xd2,
+    0x5,0x2,0x60,0x41,0x60,0x81,0x60,0xff,0xc1,0x60,0x1,0x61,0x41,0x61,0x1,0x62,
+    0xff,0x41,0x62,0x81,0x62,0xc1,0x62,0x1,0x63,0xff,0x41,0x63,0x81,0x63,0x81,0x64,
+    0xc1,0x64,0xff,0x1,0x65,0x2,0x0,0x54,0x32,0x11,0x60,0xdf,0x51,0x60,0x2,0x0,
+    0x68,0x7,0x4,0x70,0x47,0xf9,0x38,0xcb,0x0,0x77,0x1,0x21,0x3,0xc4,0x8,0x3c,
+    0xff,0x80,0x20,0x80,0x2,0x22,0x0,0x8,0x32,0xff,0x14,0x21,0xff,0xf7,0x3e,0xff,
+    0xa0,0x20,0xdf,0xc0,0x3,0x22,0x0,0xc,0xd,0x4,0x37,0xff,0xdf,0xa,0x20,0x60,
+    0x61,0x3,0xcb,0x1,0x60,0x48,0x5f,0x22,0x0,0x18,0x32,0x1d,0x13,0x4,0x5e,0xb,
+    0x0,0x5d,0x1c,0xb,0x4,0x31,0xff,0x5c,0xb,0x0,0x20,0xb,0x4,0xff,0x2b,0xff,
+    0x80,0x25,0x2d,0x5,0x2a,0x0,0xff,0x1a,0x21,0x1a,0x20,0xec,0xf7,0x58,0xfe,0x7f,
+    0x60,0x62,0x2a,0x0,0x1c,0x21,0x1c,0xb,0x0,0xff,0x52,0xfe,0xa0,0x62,0xed,0x9,
+    0x28,0x0,0xf7,0x22,0x0,0x2c,0x55,0x4,0xc,0xff,0x2a,0x0,0xf7,0x14,0x21,0x14,
+    0x19,0x0,0x45,0xfe,0x20,0x63,0xf4,0x3e,0x0,0x59,0x5,0xd,0x3f,0x1,0x79,0xfa,
+    0x1,0x20,0x9f,0x3d,0x21,0x60,0x54,0x21,0xfe,0x0,0x27,0x2,0x26,0xff,0x0,0x10,
+    0x36,0x0,0x21,0xa8,0x68,0xf1,0xff,0xf7,0x35,0xfd,0x30,0x60,0x0,0x21,0xe8,0xfe,
+    0x9,0x0,0x30,0xfd,0x70,0x60,0x68,0x69,0xb0,0xdf,0x60,0x28,0x69,0x30,0x73,0x1b,
+    0x0,0x69,0xf1,0xff,0xf7,0x27,0xfd,0x30,0x61,0xe9,0x69,0x48,0xff,0x42,0x60,0x62,
+    0x0,0x21,0x28,0x6a,0xf1,0xff,0xf7,0x1f,0xfd,0xb0,0x61,0x68,0x6a,0xf0,0xbf,0x61,
+    0xa8,0x6a,0x80,0x0,0x30,0x13,0x0,0xe8,0xee,0x13,0x0,0x15,0xfd,0x70,0x1d,0x2,
+    0x6b,0xf1,0xf7,0x7f,0x10,0xfd,0xb0,0x62,0x0,0x20,0x70,0x41,0x1,0xff,0x1,0x29,
+    0x2,0xda,0x0,0xf0,0x3f,0xfa,0xff,0x13,0xe0,0x1,0x21,0x3c,0x30,0x1,0x70,0xff,
+    0x2a,0x49,0x10,0x68,0x40,0x1e,0x88,0x42,0xdf,0x0,0xd3,0x11,0x60,0x18,0x9,0x8,
+    0x19,0x60,0x7f,0x2,0x98,0x2,0x68,0x52,0x1e,0x8a,0xb,0x0,0xf5,0x1,0x8b,0x1,
+    0x2,0xab,0x4,0x25,0x0,0x3c,0x35,0xf5,0x28,0xa3,0x1,0x2c,0xa3,0x1,0x1d,0x49,
+    0x88,0x42,0xff,0x9,0xda,0x0,0x28,0x7,0xd0,0x8a,0x42,0xff,0x5,0xda,0x0,0x2a,
+    0x3,0xd0,0x8b,0x42,0x7f,0x1,0xda,0x0,0x2b,0x5,0xd1,0x20,0xd1,0x0,0xf7,0x10,
+    0xfa,0x17,0xff,0x5,0xa8,0x60,0xc1,0x17,0xff,0x14,0x4a,0x0,0x23,0xf2,0xf7,0xf1,
+    0xfb,0xff,0x80,0xf,0x8a,0x0,0x10,0x43,0x6,0x0,0xff,0x32,0x0,0x21,0x69,0x20,
+    0x0,0x54,0x30,0xff,0x3,0xf0,0x57,0xfa,0x32,0x0,0x61,0x69,0x7f,0x68,0x34,0x20,
+    0x0,0x3,0xf0,0x51,0x3,0x1,0xfb,0x68,0x70,0xa1,0x2,0x0,0x0,0x48,0x43,0x0,
+    0xff,0x20,0xff,0xff,0xff,0x7f,0xc8,0x42,0x0,0xff,0x20,0x47,0xdd,0xe8,0x1e,0x60,
+    0x79,0x71,0xff,0xfa,0xa0,0x86,0x8e,0x5,0x40,0xd,0x3,0xfb,0x0,0x41,0x3,0x0,
+    0x83,0xde,0x1b,0x43,0xf4,0x77,0xb5,0x92,0xb0,0x3d,0x3,0x68,0x68,0x50,0x9f,0x0,
+    0xbf,0x18,0x70,0x3c,0x20,0x20,0x5c,0x3e,0x1,0xd1,0xff,0x98,0xe1,0x28,0x78,0xc0,
+    0x7,0x0,0xd4,0xf3,0x94,0xe1,0xf7,0x0,0x25,0x1,0x94,0xfc,0x9,0x90,0x77,0x0,
+    0x21,0x68,0x9,0x0,0x8f,0xfc,0xa,0x9,0x0,0xfe,0x39,0x3,0x8a,0xfc,0xb,0x90,
+    0x20,0x0,0x3c,0xfb,0x30,0x40,0xcb,0x0,0x4,0xd0,0x20,0x0,0x5c,0x7f,0x30,0x9,
+    0xa9,0x2c,0xc9,0x2c,0xc0,0xe7,0x0,0xfd,0x90,0xae,0x1,0x23,0x9,0xae,0x3,0x25,
+    0x30,0xff,0x68,0x40,0x10,0xc1,0x17,0x0,0x92,0x1,0xff,0x93,0x2,0x0,0xb,0x0,
+    0xf2,0xf7,0x91,0xff,0xfb,0x0,0x9a,0x1,0x9b,0x80,0x18,0x59,0xfd,0x41,0xf,0x2,
+    0x36,0x1d,0x6d,0x1e,0xed,0xd1,0xff,0x2,0x20,0x0,0x90,0x2,0xa8,0xfa,0xf7,0xff,
+    0x8b,0xfa,0x2,0x98,0x40,0x0,0x2,0x90,0xff,0x1,0xd1,0xaf,0x4d,0x6,0xe0,0x2,
+    0x46,0xff,0x0,0x20,0x80,0x21,0x49,0x2,0xf3,0xf7,0xff,0x9f,0xf8,0x5,0x0,0x6,
+    0xa8,0x9,0xa9,0xff,0x3,0x22,0xb,0x68,0x3,0x60,0x9,0x1d,0xff,0x0,0x1d,0x52,
+    0x1e,0xf9,0xd1,0x0,0x26,0xff,0x6,0xaf,0x38,0x68,0xc1,0x17,0x2a,0x0,0xff,0xeb,
+    0x17,0xf2,0xf7,0x65,0xfb,0x0,0xe,0xff,0xa,0x2,0x10,0x43,0x38,0x60,0x76,0x1c,
+    0xff,0x3f,0x1d,0x3,0x2e,0xf1,0xdb,0x9e,0x48,0xff,0x21,0x68,0x81,0x42,0xd,0xd0,
+    0x6,0xaa,0xff,0x21,0x0,0xf,0xa8,0xf6,0xf7,0xdc,0xfe,0xf7,0x6,0xa8,0xf,0x9f,
+    0x4,0x3,0xa8,0x6,0xa9,0x3f,0x2c,0xc0,0xc,0xa8,0x5,0xe0,0x9,0x4,0x11,0x0,
+    0x6d,0xc,0x7,0x8,0x3,0xa9,0x51,0x7,0xd8,0xf9,0xd7,0xa,0xdd,0x8,0xd7,0x0,
+    0x70,0x30,0x3,0xd7,0x8,0x21,0x0,0x5f,0x3c,0x31,0x48,0x70,0xc,0x25,0x0,0x68,
+    0x25,0x0,0xff,0xc5,0xf9,0x60,0x6a,0x40,0x11,0x3,0x99,0xfd,0x88,0xb1,0x1,0x1,
+    0x20,0x0,0xe0,0x0,0x20,0xff,0x1,0x21,0x41,0x40,0x68,0x46,0x81,0x70,0xff,0x4,
+    0x98,0xc1,0x17,0x48,0x40,0x40,0x1a,0xdf,0xa1,0x6a,0x4a,0x11,0x90,0x1d,0x4,0x9,
+    0xe0,0xfd,0x82,0xd7,0x3,0x20,0x5,0xe0,0xc8,0x6,0xc0,0xff,0xe,0x40,0x1e,0x80,
+    0x41,0xc0,0x43,0xc0,0xbf,0xf,0x69,0x46,0x48,0x70,0x5,0x2b,0x8,0x21,0xcf,0x6a,
+    0x49,0x11,0x81,0x49,0xc,0x69,0x2,0x8,0x71,0x6a,0x85,0x2,0x80,0xe3,0x0,0x6c,
+    0xfb,0x5,0xf3,0xfa,0xfb,0x7,0xff,0x1,0x90,0x2,0x9d,0x68,0x48,0x2d,0x18,0xdf,
+    0xc,0xaa,0x3,0xa9,0x10,0xd9,0x0,0xc8,0xff,0xff,0x10,0xa8,0x3,0xc8,0x80,0xc,
+    0x8a,0x3,0x7f,0x10,0x43,0xe1,0x6a,0x89,0x10,0xa9,0x45,0x2,0xfd,0x21,0x45,0x0,
+    0x21,0x22,0x6b,0x90,0x42,0x6,0xfe,0x51,0x0,0x22,0x0,0x70,0x32,0x3,0xab,0xe0,
+    0xf7,0xcb,0xe0,0xc2,0x5b,0x2,0x8,0x43,0x9,0xd0,0xff,0x60,0x6b,0xa1,0x6b,0x40,
+    0x18,0x14,0x21,0xef,0xf6,0xf7,0xcc,0xf9,0x6b,0x2,0xc8,0x60,0x11,0xfd,0xe0,0x6d,
+    0x2,0xc0,0x68,0x53,0x49,0xf7,0xf7,0xbf,0x78,0xfe,0xa,0xd8,0x1,0x98,0x1d,0x2,
+    0xbd,0xff,0xf9,0x1,0x0,0x25,0x0,0x48,0x35,0x28,0x7f,0x68,0xf7,0xf7,0x43,0xfa,
+    0x28,0x60,0x23,0x4,0x7f,0x78,0xff,0x28,0x0,0xd1,0x87,0xe0,0x37,0x2,0xff,0x89,
+    0x78,0xff,0x29,0x0,0xd1,0x81,0xe0,0xff,0x22,0x0,0x3c,0x32,0x12,0x79,0xff,0x2a,
+    0xfb,0x7c,0xd0,0x9,0x2,0x52,0x79,0x6b,0x46,0x1a,0x7f,0x70,0x0,0x25,0x8,0x42,
+    0xe,0xd1,0x31,0x2,0xab,0x5,0x61,0x4d,0x6,0x96,0x4d,0x4,0x50,0x4d,0x4,0xe4,
+    0xdf,0xf9,0x28,0x60,0xc,0xe0,0x17,0x6,0x8a,0xf9,0xdf,0x26,0x0,0x4c,0x36,0x31,
+    0x15,0x0,0xd9,0xf9,0xbd,0x30,0x63,0x4,0x45,0x61,0x31,0x4e,0x7,0x2,0x41,0xff,
+    0x69,0x30,0x48,0xf7,0xf7,0xce,0xf9,0x31,0xff,0x0,0xf7,0xf7,0x2d,0xfe,0x1,0xd8,
+    0x1,0x5d,0x25,0xc1,0x0,0x25,0xa0,0x6b,0x35,0x2,0x6f,0x4d,0x0,0xbe,0x23,0x2,
+    0x0,0x69,0xf7,0xf7,0xf5,0x21,0x4,0x1c,0xf7,0xfe,0xc,0xd8,0x11,0x4,0x79,0x0,
+    0x28,0x7,0xfa,0x79,0x4,0xc0,0x53,0x0,0x11,0xfe,0x18,0xd8,0x1,0xf3,0x20,0x17,
+    0xf,0x1,0xd5,0x5,0x79,0xff,0x28,0x17,0xff,0xd1,0x0,0x2d,0x2,0xd0,0x0,0x21,
+    0x6a,0xff,0x46,0x11,0x70,0x69,0x46,0x9,0x78,0x81,0xff,0x42,0x20,0xd0,0x3c,0x34,
+    0x61,0x71,0x68,0xfb,0x46,0x0,0xf3,0x1,0xf,0xd0,0x1,0x20,0xe,0xfe,0x27,0x1,
+    0x69,0x46,0x8a,0x78,0x49,0x78,0x11,0xff,0x43,0x1,0x40,0xe2,0xe7,0x0,0x28,0x9,
+    0xff,0xd0,0x0,0x2d,0xe8,0xd0,0x0,0x20,0x3c,0xff,0x34,0x60,0x71,0x2,0x20,0x12,
+    0x99,0x8,0xff,0x70,0x0,0x20,0x6,0xe0,0x0,0x29,0xde,0xfc,0x2d,0x0,0x13,0x2,
+    0xe4,0xe7,0x3,0x20,0x13,0xb0,0xff,0xf0,0xbd,0x0,0x0,0xff,0xff,0xff,0x7f,0xff,
+    0x83,0xde,0x1b,0x43,0x33,0x33,0x33,0xf6,0xff,0x1,0x0,0x0,0x34,0xcd,0xcc,0x4c,
+    0xbe,0x7f,0x38,0xb5,0x4,0x0,0x8,0x0,0x8,0xb5,0x0,0xff,0x14,0xf9,0x5,0x0,
+    0xa0,0x69,0xf9,0xf7,0xdf,0xcc,0xfa,0x1,0x0,0x28,0xb3,0x0,0xf0,0xf9,0xbb,0x1,
+    0xd2,0xf3,0x7,0x3e,0x34,0x20,0x53,0x0,0x32,0xf5,0xbd,0x2b,0x6,0x4,0x2b,0x0,
+    0xfe,0xf8,0x5,0x0,0x5f,0x20,0x7f,0xf9,0xf7,0xb6,0x2b,0x8,0xda,0x2b,0xc,0xf9,
+    0x3f,0x2b,0x8,0xeb,0x0,0x21,0x1,0x70,0x81,0x60,0xff,0xff,0x21,0x81,0x70,0xc1,
+    0x70,0x1,0x71,0xff,0x41,0x71,0x0,0x21,0xc1,0x60,0x1,0x61,0xff,0x41,0x61,0x70,
+    0x47,0x0,0x20,0x9d,0x49,0xff,0x8,0x70,0x70,0x47,0x80,0xb5,0x0,0xf0,0xdf,0x4f,
+    0xf8,0x2,0xbd,0x70,0x57,0x0,0xe,0x0,0xff,0x99,0x4d,0x28,0x0,0xf0,0x30,0x1,
+    0x78,0xdf,0x0,0x29,0x11,0xd1,0x1,0x3b,0x0,0x28,0x0,0xdf,0x0,0xf0,0x34,0xf8,
+    0x31,0x5f,0x0,0x0,0xf0,0x7f,0x53,0xf8,0x6,0x0,0x9,0xd5,0x29,0xb,0x0,0xff,
+    0x3,0xf0,0xcd,0xf9,0x0,0x20,0x20,0x60,0xff,0x3,0xe0,0x14,0x20,0xc0,0x43,0x70,
+    0xbd,0xff,0x25,0x60,0x30,0x0,0x70,0xbd,0x8a,0x49,0xff,0x81,0x42,0x2,0xd1,0x0,
+    0x20,0xf0,0x31,0x7e,0x57,0x2,0x10,0x30,0x1,0x29,0x3,0xda,0x7f,0x2,0xef,0x1,
+    0x77,0x7,0xe0,0x4b,0x2,0x83,0x48,0x11,0xff,0x68,0x49,0x1e,0x81,0x42,0x0,0xd3,
+    0x10,0xd7,0x60,0x0,0x20,0x79,0x6,0x87,0x79,0x0,0x3,0xe1,0xde,0x9,0x2,0x9,
+    0xf9,0x2,0xbd,0x2d,0x0,0x60,0x41,0xff,0x60,0x81,0x60,0xc1,0x60,0x2,0x0,0x18,
+    0xff,0x32,0x11,0x60,0x51,0x60,0xe4,0x22,0x81,0xf9,0x50,0x4b,0x0,0x9b,0x0,0x80,
+    0x22,0xd2,0x4,0x18,0xff,0x21,0x18,0x20,0xec,0xf7,0x58,0xfb,0x20,0xbf,0x60,0x0,
+    0x22,0x1e,0x21,0x1e,0xb,0x0,0x52,0xff,0xfb,0x60,0x60,0x6e,0x4a,0x19,0x21,0x19,
+    0xee,0xb,0x0,0x4c,0xfb,0xa0,0x57,0x0,0x10,0xbd,0xf8,0xfe,0xc9,0x4,0x0,0x25,
+    0x25,0x74,0x65,0x61,0x27,0xff,0x0,0x2c,0x37,0x3d,0x70,0x18,0x22,0x66,0xff,0xa0,
+    0x3,0xc8,0xf1,0xf7,0xd7,0xfa,0xf1,0xff,0xf7,0xf,0xfb,0x21,0x0,0x30,0x31,0xd,
+    0xff,0x60,0x4d,0x60,0x88,0x60,0x19,0x20,0x38,0xff,0x61,0x7d,0x61,0xbd,0x61,0x20,
+    0x0,0x48,0xef,0x30,0x3,0xf0,0x6c,0xd3,0x0,0x21,0x0,0x54,0xff,0x31,0x0,0x22,
+    0xb,0x0,0x3,0x27,0x1a,0xff,0x60,0x1b,0x1d,0x7f,0x1e,0xfb,0xd1,0x40,0xff,0x1c,
+    0xc,0x31,0xc,0x28,0xf5,0xdb,0x19,0xff,0x22,0x0,0x20,0x0,0x21,0xf1,0xf7,0xb5,
+    0xfe,0x43,0x0,0xed,0xfa,0xe4,0x21,0x60,0x50,0x21,0xef,0x0,0xe4,0x31,0xd,0x51,
+    0x1,0x30,0x68,0xf1,0xff,0xf7,0x13,0xfa,0x60,0x60,0x70,0x68,0x20,0xff,0x60,0xb0,
+    0x68,0xa0,0x60,0xc1,0x17,0x49,0xff,0x6,0xc2,0x9,0x11,0x43,0x40,0x6,0xce,0xff,
+    0x17,0xcf,0x17,0xc0,0x22,0x52,0x5,0x70,0xff,0x40,0x79,0x40,0x3b,0x0,0x80,0x1b,
+    0x99,0xff,0x41,0xf2,0xf7,0x51,0xfe,0x70,0x40,0x80,0xff,0x1b,0x0,0x11,0xf3,0xf7,
+    0x50,0xfd,0xe0,0xff,0x60,0x20,0x0,0x18,0x30,0x2,0xf0,0x69,0xff,0xff,0xe4,0x34,
+    0x65,0x71,0x0,0x20,0xf2,0xfe,0x85,0x1,0x82,0xb0,0x4,0x0,0x25,0x0,0x10,0xff,
+    0x35,0x0,0x20,0x28,0x77,0x2a,0x78,0x0,0xff,0x2a,0x59,0xd0,0x9,0x68,0x2d,0x4a,
+    0x91,0xff,0x42,0x1,0xda,0x0,0x29,0x3,0xd1,0x28,0xfb,0x70,0x17,0x71,0x1,0x76,
+    0xbd,0x68,0x68,0x81,0xff,0x42,0x4c,0xd0,0x69,0x60,0x88,0x2,0x1,0xff,0xd1,0x31,
+    0x48,0x8,0xe0,0xc6,0x17,0x70,0xff,0x40,0x82,0x1b,0x0,0x20,0x24,0x49,0xf2,0xfb,
+    0xf7,0x20,0x61,0x4,0xc1,0x17,0x22,0x4a,0x0,0xff,0x23,0xf2,0xf7,0xe7,0xf8,0x88,
+    0x10,0x1,0xff,0x14,0x0,0x4,0x0,0xd5,0x49,0x1c,0xe9,0xbf,0x62,0x68,0x68,0xc1,
+    0x17,0x1d,0x17,0x4,0xdb,0xff,0xf8,0x2,0xd,0xd,0x3,0x2a,0x43,0x80,0xff,0x26,
+    0x36,0x3,0x6,0x40,0x0,0xd0,0x52,0xff,0x1c,0x91,0x12,0x17,0x48,0x25,0x0,0x18,
+    0xff,0x35,0x42,0x18,0x0,0x92,0x0,0x21,0x82,0xff,0x8,0x11,0x43,0x80,0x7,0x0,
+    0x9a,0x0,0xff,0x2a,0x1,0xd1,0x18,0x48,0x9,0xe0,0xd2,0xff,0x17,0x0,0x9b,0x53,
+    0x40,0x9a,0x1a,0xf2,0xff,0xf7,0xf0,0xfd,0x0,0x99,0xc9,0x17,0x48,0xff,0x40,0x40,
+    0x1a,0x28,0x60,0x29,0x68,0x48,0xff,0x42,0x68,0x60,0x2d,0x1d,0x80,0x21,0xc9,0xff,
+    0x5,0x40,0x18,0x28,0x60,0x18,0x34,0x20,0xff,0x0,0x2,0xf0,0x1,0xff,0x0,0x20,
+    0x76,0xff,0xbd,0x0,0x0,0x41,0x9c,0x0,0x0,0x90,0xff,0xd0,0x3,0x0,0x66,0x66,
+    0x66,0x6,0x83,0xff,0xde,0x1b,0x43,0xd7,0xa3,0x0,0x0,0xb0,0xff,0x3e,0x0,0x20,
+    0xc0,0x3d,0x0,0x20,0x40,0x7e,0x1b,0x0,0x7f,0x7c,0xd9,0x12,0x9a,0x99,0x0,0x2,
+    0xff,0x23,0x40,0xff,0xff,0xff,0x7f,0x0,0x7c,0x7f,0x0,0x28,0x0,0xd0,0x8,0x68,
+    0x10,0xc7,0x1,0x7f,0x70,0x47,0x0,0x0,0xf4,0xb5,0x9e,0xd,0x1,0xfb,0xd,0x0,
+    0xd5,0x1,0x70,0x68,0x68,0x1e,0x99,0xfd,0x48,0x17,0x0,0x18,0x70,0x20,0x1d,0x0,
+    0x7b,0xff,0x0,0x28,0x2,0xd0,0x28,0x78,0xc0,0x7,0xff,0x1,0xd4,0x3,0x20,0x0,
+    0xe2,0x0,0x21,0xff,0x28,0x69,0xf1,0xf7,0x51,0xf9,0x9,0x90,0x77,0x0,0x21,0x68,
+    0x9,0x0,0x4c,0xf9,0xa,0x9,0x0,0xfd,0xa8,0x9,0x0,0x47,0xf9,0xb,0x90,0x3,
+    0xa8,0xff,0x9,0xa9,0x3,0x22,0xb,0x68,0x3,0x60,0xff,0x9,0x1d,0x0,0x1d,0x52,
+    0x1e,0xf9,0xd1,0xfe,0x75,0x5,0x90,0x5,0x46,0x8,0x35,0x3,0xaf,0xf7,0x3,0x26,
+    0x38,0x13,0x1,0x2,0x9a,0x52,0x68,0xff,0xd3,0x17,0xf2,0xf7,0x50,0xf8,0x0,0x90,
+    0xd7,0x1,0x91,0x28,0x11,0x4,0x12,0x11,0x4,0x47,0xf8,0xff,0x0,0x9a,0x1,0x9b,
+    0x80,0x18,0x59,0x41,0xff,0x80,0xf,0x8a,0x0,0x10,0x43,0x28,0x60,0xff,0x3f,0x1d,
+    0x2d,0x1d,0x76,0x1e,0xe3,0xd1,0xff,0x3,0xa8,0x2,0x99,0x8,0x31,0x2c,0xc9,0xf7,
+    0x2c,0xc0,0xf,0x61,0x1c,0x3,0xaa,0xf,0xa9,0xff,0x68,0x46,0x3,0xf0,0x49,0xf8,
+    0x1a,0xa8,0xfb,0x69,0x46,0x23,0x2,0x1a,0xa8,0x3,0xf0,0x57,0xef,0xf8,0x40,0x0,
+    0x10,0x8f,0x0,0x3,0xf0,0x52,0xff,0xf8,0x77,0x4f,0x40,0x0,0xc0,0x19,0xc1,0xfe,
+    0x47,0x5,0xf,0x90,0x0,0x20,0x2,0x90,0x0,0xff,0x22,0x0,0x23,0x9,0xae,0x3,
+    0x25,0x30,0xff,0x68,0x40,0x10,0xc1,0x17,0x0,0x92,0x1,0xff,0x93,0x2,0x0,0xb,
+    0x0,0xf2,0xf7,0x6,0xfc,0x81,0xc,0xf,0x2,0x36,0x1d,0x6d,0x1e,0xed,0xd1,0xff,
+    0x12,0xa8,0xc,0xc0,0x2,0x20,0x0,0x90,0xfe,0x7,0x0,0xc8,0x2,0xa8,0xf9,0xf7,
+    0xfc,0xfe,0xfb,0x2,0x98,0x4f,0xe,0x10,0x99,0xbd,0x4a,0x91,0xff,0x42,0xd,0xda,
+    0xbc,0x49,0xf,0x9a,0x8a,0xff,0x42,0x9,0xda,0x88,0x42,0x1,0xdb,0x1,0xff,0x20,
+    0x0,0xe0,0x0,0x20,0x1,0x21,0x41,0xbf,0x40,0x68,0x46,0x1,0x70,0x2,0xb,0x0,
+    0x69,0xff,0x46,0x8,0x70,0x27,0x0,0x2c,0x37,0x38,0xff,0x78,0x0,0x28,0x3,0xd0,
+    0x2,0x28,0x5e,0xff,0xd0,0xd,0xd3,0x55,0xe1,0x68,0x46,0x0,0xfe,0xf,0x0,0x0,
+    0xd1,0x50,0xe1,0x1,0x20,0x38,0x7f,0x70,0x20,0x0,0x30,0x30,0x3,0xa9,0xbf,0x2,
+    0xcd,0x48,0x19,0x8,0x6,0xd0,0x17,0x16,0xfb,0x1e,0x22,0x0,0xff,0x30,0x32,0xf,
+    0xa9,0xc,0xa8,0x2,0xf0,0x5f,0xca,0xff,0x6,0xa8,0xc,0x25,0x4,0x6,0xd,0x0,
+    0xff,0xd8,0xff,0x40,0x0,0x1,0x90,0x61,0x68,0x7f,0x88,0x42,0x0,0xda,0x21,0xe1,
+    0x2,0x45,0x0,0xff,0x0,0x20,0xb8,0x61,0x78,0x61,0x0,0x26,0xff,0x6,0xad,0x1,
+    0x98,0x0,0x28,0x1,0xd1,0xbf,0x93,0x48,0x8,0xe0,0x2,0x46,0x7d,0x3,0x9,0xff,
+    0x6,0x3,0xa,0x19,0x43,0x0,0x6,0xf2,0xff,0xf7,0xaf,0xfc,0x28,0x60,0x76,0x1c,
+    0x2d,0xff,0x1d,0x3,0x2e,0xec,0xdb,0x6,0xa9,0x20,0xff,0x0,0x48,0x30,0x2,0xf0,
+    0xd3,0xff,0x19,0xff,0x22,0x0,0x20,0x0,0x21,0xf1,0xf7,0xee,0xff,0xf8,0xf1,0xf7,
+    0x26,0xf9,0xe4,0x21,0x60,0xf7,0x50,0xf8,0xe0,0x9f,0x6,0xb,0xd0,0x20,0x0,0xef,
+    0xe4,0x30,0x40,0x79,0xa9,0x1e,0xb8,0x69,0x40,0xef,0x1c,0xb8,0x61,0x17,0xaf,0x24,
+    0x17,0xa9,0xf,0xaa,0xa1,0x0,0x72,0xaf,0x0,0xf,0xaf,0xc,0x80,0xaf,0x4,0x60,
+    0xfe,0x8d,0x2,0x7,0x2,0x9,0x11,0x43,0x0,0x7,0xff,0x12,0xaa,0x3,0xc2,0x12,
+    0xa8,0x3,0xc8,0xff,0x80,0xf,0x8a,0x0,0x10,0x43,0x89,0x17,0xf5,0x10,0xf,0x0,
+    0x10,0xf,0x0,0x63,0xa2,0xc,0xca,0xff,0x99,0x42,0x7,0xdc,0x1,0xdb,0x90,0x42,
+    0xff,0x4,0xd2,0x10,0x46,0x19,0xe0,0x0,0xbf,0xef,0x33,0x33,0x33,0xf6,0x1b,0x2,
+    0x0,0x23,0x99,0xfb,0x42,0xd,0x19,0x4,0xa,0xd2,0xd2,0x43,0x99,0xff,0x42,0x9,
+    0xdb,0x1,0xdc,0x90,0x42,0x6,0xfd,0xd3,0x47,0x2,0x52,0x8,0x2,0x40,0x1,0xd0,
+    0xef,0x56,0x48,0x1,0xe0,0x29,0x2,0x1,0x99,0x81,0xfe,0x19,0x1,0x92,0xe0,0xb8,
+    0x69,0x39,0x69,0xc9,0x5d,0x0,0x25,0x1,0xd1,0x8c,0xe0,0x1b,0xf,0x4c,0x1b,0x21,
+    0xf5,0x21,0x1b,0x15,0x14,0xb3,0x0,0x46,0xff,0x22,0x0,0xf7,0x48,0x32,0x14,0x7d,
+    0x1,0xf7,0xf7,0xd1,0xfe,0xfd,0xc,0xab,0xc,0x6,0x0,0x20,0x1d,0x80,0x68,0x8f,
+    0x86,0x42,0x65,0xda,0x73,0x3,0x23,0x6,0xf1,0x2,0x3b,0xbb,0xff,0xc,0xf1,0x8,
+    0x3,0x22,0xc,0x35,0x4,0x1d,0xff,0xfe,0x78,0x69,0x25,0x0,0xe4,0x35,0x0,0xff,
+    0x28,0x15,0xd0,0x0,0x23,0x41,0x0,0x8,0xff,0x18,0x80,0x0,0x22,0x18,0x48,0x32,
+    0xc,0xfe,0x7b,0x1,0x0,0xf0,0x58,0xf8,0x0,0x28,0x9,0x47,0xd1,0x78,0x61,0xb7,
+    0x3,0x83,0x1,0x81,0x1,0x2d,0x81,0x1,0xff,0x65,0xf8,0xc,0xe0,0x1e,0x21,0x30,
+    0x0,0xff,0xf5,0xf7,0xb4,0xfd,0xf6,0xf7,0xa8,0xfb,0xff,0x0,0x23,0x0,0x22,0x19,
+    0x21,0xf5,0xf7,0xff,0x75,0xfd,0x29,0x68,0x8,0x18,0x28,0x60,0xfb,0x78,0x69,0x47,
+    0x6,0x20,0x18,0x54,0x30,0xc,0xbf,0xa9,0x4c,0xc9,0x4c,0xc0,0x78,0x8b,0x1,0x78,
+    0xff,0x61,0xc,0x28,0x1,0xd3,0xc,0x20,0x78,0xf5,0x61,0xd5,0x3,0x14,0x17,0x4,
+    0x7a,0x69,0x9,0x2a,0xff,0x13,0xd3,0x28,0x68,0x21,0x1d,0x49,0x68,0xff,0x88,0x42,
+    0xe,0xdb,0x23,0x68,0xd2,0xb2,0xaf,0x21,0x0,0x54,0x31,0x7b,0x2,0x2c,0x7b,0x0,
+    0x3,0xfe,0xd3,0x1,0x1e,0x99,0x8,0x70,0x28,0x71,0x0,0xdc,0xdb,0x1,0xf1,0x3,
+    0xe4,0x34,0x60,0xb,0x0,0x1f,0xb0,0xff,0xf0,0xbd,0x0,0x0,0x1,0x0,0x0,0x2,
+    0x6f,0x49,0xe1,0xfa,0x0,0x0,0x0,0x80,0xff,0x0,0x6,0xff,0x7f,0x30,0xb5,0x83,
+    0xb0,0x1d,0x0,0x1,0xff,0x24,0x68,0x46,0xf7,0xf7,0x48,0xfe,0x68,0xf5,0x46,0x11,
+    0xb,0xa8,0x6b,0x1,0x0,0x24,0x20,0x0,0xff,0x3,0xb0,0x30,0xbd,0xfd,0xb5,0x86,
+    0xb0,0xfb,0xc,0x0,0x1b,0x0,0x22,0xb,0x68,0x9b,0x11,0xff,0x3,0x60,0x9,0x1d,
+    0x0,0x1d,0x52,0x1e,0xff,0xf8,0xd1,0x1,0x20,0x69,0x46,0x9,0x7f,0xff,0x2,0x29,
+    0x15,0xd3,0x21,0x0,0xc,0x31,0xff,0x0,0x22,0xb,0x0,0x6d,0x46,0x2e,0x68,0xff,
+    0x1f,0x68,0xbf,0x11,0xf6,0x19,0x2e,0x60,0xfd,0x52,0x79,0x1,0x1b,0x1d,0x3,0x2a,
+    0xf5,0xdb,0xff,0x40,0x1c,0xc,0x31,0x6a,0x46,0x12,0x7f,0xff,0xc0,0xb2,0x90,0x42,
+    0xeb,0xd3,0x3,0x22,0xff,0x69,0x46,0x68,0x46,0xf6,0xf7,0xdf,0xf9,0xf7,0x69,0x46,
+    0x3,0x63,0x1,0x7c,0xfe,0x1,0x26,0xff,0x0,0x25,0x1,0xe0,0x6d,0x1c,0xc,0x34,
+    0xfe,0xb1,0x0,0x7f,0xed,0xb2,0x85,0x42,0x8,0xd2,0xff,0x8,0x9b,0x22,0x0,0x3,
+    0xa9,0x6,0x98,0xff,0xff,0xf7,0xae,0xff,0x0,0x28,0xf0,0xd1,0xdf,0x0,0x26,0x30,
+    0x0,0x9,0xc5,0x0,0x1f,0x48,0xff,0x0,0x21,0x1,0x60,0x41,0x60,0x70,0x47,0xff,
+    0x38,0xb5,0x4,0x0,0x1c,0x4d,0x20,0x68,0xff,0x0,0x28,0x2,0xd1,0x68,0x68,0xa0,
+    0x42,0xff,0x3,0xd1,0x2,0x21,0x30,0x20,0x2,0xf0,0xf7,0x4c,0xfb,0x28,0x13,0x0,
+    0x3,0xd0,0x68,0x68,0x7f,0x4,0x60,0x6c,0x60,0x31,0xbd,0x2c,0x5,0x0,0xff,0xa8,
+    0x60,0x20,0x0,0x2,0xf0,0xc7,0xfe,0xbf,0x31,0xbd,0x10,0xb5,0xf,0x4c,0x33,0x2,
+    0x18,0xff,0xd0,0x41,0x7c,0x0,0x29,0x4,0xd0,0xa1,0xff,0x68,0x49,0x1c,0xa1,0x60,
+    0x3,0x29,0xe,0xff,0xd3,0x1,0x68,0x21,0x60,0x0,0x22,0x0,0xff,0x29,0x0,0xd1,
+    0x62,0x60,0x2,0x60,0x2,0xff,0x7b,0x0,0x21,0x5,0x20,0xfd,0xf7,0x90,0xfd,0xf8,
+    0x2d,0x2,0x1,0xd0,0x2,0xf0,0xa8,0xfe,0xfd,0x10,0x43,0x1,0x6c,0x49,0x0,0x20,
+    0x80,0xb5,0xff,0x89,0x48,0x0,0xf0,0x4d,0xf9,0x1,0xbd,0xd7,0x80,0xb5,0xa,0x55,
+    0x1,0x85,0xd,0x0,0x9d,0xf9,0x55,0x2,0xd,0x8,0x82,0xd,0x0,0xa6,0xd,0x4,
+    0x7f,0x17,0x2,0xd5,0xfa,0x25,0xa,0x7c,0xd,0x0,0x58,0x17,0x4,0x3,0x0,0xff,
+    0x79,0x48,0x40,0x6d,0x27,0xe0,0x80,0xb5,0x5f,0x77,0x49,0x4a,0x6d,0x2c,0x7,0x0,
+    0x75,0x7,0x0,0xf7,0x31,0xe0,0x73,0x15,0x0,0x0,0x7e,0x70,0x47,0xb5,0x10,0xd9,
+    0x0,0x84,0xb,0x0,0x32,0xe0,0x9,0x2,0x82,0xea,0x9,0x0,0x38,0x23,0x0,0x80,
+    0x7,0x0,0x1,0x68,0x9,0x57,0x6b,0x88,0x47,0x43,0x2,0x7c,0xd,0x4,0x49,0xd,
+    0x8,0xff,0x3,0x0,0x64,0x48,0x40,0x6f,0xca,0xb2,0x7f,0x19,0x0,0x3,0x68,0x5b,
+    0x69,0x98,0x13,0x4,0xff,0x60,0x49,0x4a,0x6f,0x1,0x0,0x10,0x0,0x5f,0x12,0x68,
+    0xd2,0x69,0x90,0x11,0x4,0x5b,0x11,0xc,0xd3,0x12,0x6a,0x11,0x2,0x5d,0x2,0x56,
+    0x37,0x0,0x13,0x0,0xff,0xa,0x0,0x21,0x0,0x4,0x68,0x24,0x6c,0x57,0xa0,0x47,
+    0x10,0x15,0x4,0x51,0x15,0x10,0x64,0x15,0x4,0xc8,0x4f,0x0,0x13,0x0,0x7f,0xe,
+    0x5c,0xd,0x4,0x7f,0xa,0x1,0x0,0xff,0x58,0x48,0x80,0x6d,0x0,0x22,0xbf,0xe7,
+    0x7f,0x80,0xb5,0x56,0x49,0x8a,0x6d,0xc2,0x7,0x0,0x9d,0x54,0x7,0x0,0xc7,0xe7,
+    0x52,0x17,0x2,0xd3,0x8,0x4f,0x56,0xb,0x0,0xc8,0xe7,0x9,0x2,0x4d,0x9,0x0,
+    0xce,0x23,0x0,0xc9,0x4b,0x7,0x0,0x53,0xe,0x47,0xd,0x4,0x53,0xe,0x43,0x48,
+    0xf5,0xc0,0x53,0x0,0x95,0x27,0x0,0x41,0x49,0xca,0x6d,0x55,0x98,0x7,0x0,0x3f,
+    0x7,0x0,0x9d,0x41,0x4,0x3c,0x1b,0x0,0x55,0xa2,0x9,0x4,0x3a,0x9,0x0,0xa8,
+    0x9,0x4,0x37,0x9,0x0,0x4a,0xb5,0xa,0xa4,0xb5,0x8,0x32,0x13,0x0,0x61,0xe,
+    0x2f,0xd,0x4,0x7c,0x61,0x6,0x31,0x2,0x2b,0x48,0x0,0x6e,0x11,0x5b,0x1,0x5f,
+    0x29,0x49,0xa,0x6e,0x17,0x6d,0x5,0x26,0x11,0x0,0xd5,0x76,0x4d,0x4,0x24,0x9,
+    0x0,0x7c,0x9,0x4,0xd,0x48,0x5b,0x40,0x6e,0x57,0x2,0xa1,0xb2,0x57,0x0,0x69,
+    0x57,0x6,0xaf,0x8,0x49,0x4a,0x6e,0x4b,0x7,0x52,0x4b,0xd,0x17,0xea,0x27,0x0,
+    0x58,0x31,0x4,0x15,0x9,0x0,0x5e,0xe7,0x40,0xf7,0x44,0x0,0x20,0xd,0x2,0x11,
+    0x48,0x80,0x6e,0x7d,0xde,0xbd,0x0,0xf,0x49,0x8a,0x6e,0xe4,0x51,0x8,0x57,0x80,
+    0x6e,0x43,0x9,0x4,0xa,0x9,0x0,0x49,0x9,0x4,0xdf,0x8,0x48,0xc0,0x6e,0xcb,
+    0x25,0x0,0x6,0x49,0x57,0xca,0x6e,0xd1,0x11,0x4,0x3,0x11,0x0,0x30,0x9,0x4,
+    0xf5,0x1,0x9,0x0,0x36,0x4f,0xc,0x65,0x48,0x0,0x6f,0x7d,0xb6,0x29,0x0,0x63,
+    0x49,0xa,0x6f,0xbc,0x1f,0x4,0x55,0x61,0x11,0x0,0x1b,0x9,0x4,0x5e,0x9,0x0,
+    0x21,0x9,0x4,0xff,0x5d,0x48,0x20,0x60,0x20,0x0,0x24,0x30,0x6f,0x2,0xf0,0xe4,
+    0xfd,0x7,0x2,0x60,0x65,0x5,0x2,0x35,0xa0,0x5,0x4,0xe0,0x5,0x4,0x20,0x66,
+    0x17,0x4,0x5,0x4,0x35,0xa0,0x5,0x4,0xe0,0x5,0x4,0x20,0x67,0x17,0x4,0x5,
+    0x0,0xfe,0xe9,0x4,0x0,0x11,0x0,0x8,0x28,0x29,0xd8,0xff,0x1,0xa2,0x12,0x5c,
+    0x97,0x44,0x8,0xe,0xff,0x14,0x2c,0x26,0x1a,0x32,0x20,0x42,0x0,0x7f,0x44,0x48,
+    0x40,0x6d,0x13,0xe0,0x42,0xb3,0x1,0x77,0x10,0xe0,0x41,0x57,0x1,0xd,0xe0,0x3f,
+    0xf5,0x0,0x77,0xa,0xe0,0x3e,0xab,0x0,0x7,0xe0,0x3c,0xd7,0x0,0x77,0x4,0xe0,
+    0x3b,0x43,0x1,0x1,0xe0,0x39,0x93,0x0,0xf7,0x2,0x68,0xd2,0x27,0x1,0x0,0x28,
+    0x5,0xd1,0xdf,0x2,0xbd,0x35,0x48,0x40,0xf,0x8,0x19,0x20,0xef,0x2,0xbd,0x0,
+    0x0,0xad,0x2,0x0,0x20,0xe0,0xff,0x75,0x20,0x77,0xfe,0x20,0x0,0x2,0xe0,0x7f,
+    0x83,0x20,0x0,0x0,0xf0,0x25,0xf8,0x5,0x2,0xfb,0xc7,0xf8,0xf1,0x0,0xbd,0xf2,
+    0xb4,0x11,0x68,0xff,0xc3,0x7d,0x99,0x42,0x0,0xd8,0xb,0x0,0xff,0x1,0x2b,0x8,
+    0xdb,0x0,0x9c,0x5,0x1d,0xff,0x1e,0x0,0x2f,0x88,0x27,0x80,0xad,0x1c,0xff,0xa4,
+    0x1c,0x76,0x1e,0xf9,0xd1,0xdb,0xb2,0xff,0x0,0x24,0x4,0xe0,0x0,0x9d,0x5e,0x0,
+    0xff,0xac,0x53,0x5b,0x1c,0xdb,0xb2,0x8b,0x42,0xff,0xf8,0xd3,0xc0,0x7d,0x10,0x60,
+    0x0,0x20,0xff,0xf2,0xbc,0x70,0x47,0xf1,0xb5,0xc,0x0,0xff,0x15,0x0,0x1d,0x20,
+    0x0,0x99,0x88,0x75,0xff,0x0,0x2c,0x2a,0xd0,0x0,0x2d,0x28,0xd0,0xff,0x0,0x20,
+    0x0,0x21,0x0,0x26,0x78,0x4a,0xff,0x4b,0x0,0xd2,0x18,0x13,0x88,0x5,0xe0,0xff,
+    0x77,0x0,0xe7,0x5b,0xbb,0x42,0x7,0xd0,0xff,0x76,0x1c,0xf6,0xb2,0xae,0x42,0xf7,
+    0xd3,0xff,0x2,0xd1,0x71,0x4b,0x4e,0x0,0x98,0x53,0xff,0x49,0x1c,0xc9,0xb2,0x0,
+    0x9a,0x92,0x7d,0xff,0x91,0x42,0xe7,0xdb,0x0,0x26,0xa,0xe0,0xff,0x70,0x0,0x20,
+    0x5a,0x0,0x28,0x1,0xd0,0xff,0x20,0x28,0x2,0xdb,0x5,0x20,0x1,0xf0,0x7b,0x9b,
+    0xfb,0x31,0x6,0xf2,0xd3,0xf1,0xbd,0x9f,0x3,0xdf,0xe0,0x4c,0x3,0x0,0x70,0xcf,
+    0x0,0x26,0x8c,0xff,0x0,0x25,0x2,0xe0,0x60,0x67,0x76,0x10,0xff,0x6d,0x1c,0x0,
+    0x2e,0x26,0xd0,0xf0,0x7,0xbf,0xf9,0xd5,0xa0,0x69,0xe9,0xb2,0xf7,0x0,0x68,0xf6,
+    0x7,0x3,0x1,0xd1,0x63,0x3,0xe9,0xb2,0x8,0x29,0xfd,0xed,0x59,0x1,0x52,0x56,
+    0x97,0x44,0x0,0xbf,0xff,0xa,0xe,0x12,0x16,0x1a,0x1e,0x22,0x26,0xff,0xd2,0x0,
+    0x60,0x65,0xe2,0xe7,0xa0,0x65,0xff,0xe0,0xe7,0xe0,0x65,0xde,0xe7,0x20,0x66,0xff,
+    0xdc,0xe7,0xa0,0x66,0xda,0xe7,0x60,0x66,0xff,0xd8,0xe7,0x20,0x67,0xd6,0xe7,0xe0,
+    0x66,0xff,0xd4,0xe7,0x70,0xbd,0x10,0xb4,0x1,0x8c,0xff,0x0,0x22,0x4,0xe0,0x3,
+    0x0,0x24,0x33,0xff,0x43,0x67,0x49,0x10,0x52,0x1c,0x0,0x29,0xf7,0x2d,0xd0,0xcb,
+    0x65,0x0,0xd3,0xb2,0x8,0x2b,0x7f,0xf6,0xd8,0x1,0xa4,0xe4,0x56,0xa7,0x53,0x2,
+    0xff,0x12,0x1a,0x22,0x2a,0x32,0x3a,0x42,0xe0,0xdd,0x0,0x29,0x4,0x65,0xe9,0xe7,
+    0x7,0x2,0x83,0x65,0xdd,0xe5,0x7,0x4,0xc3,0x65,0xe1,0x7,0x4,0x3,0x66,0xed,
+    0xdd,0x17,0x6,0x66,0xd9,0x7,0x4,0x43,0x66,0xd5,0xf6,0x17,0x6,0x67,0xd1,0x27,
+    0x6,0x66,0xcd,0xe7,0x10,0xfc,0x49,0x1,0xd9,0x2,0x2b,0x4e,0x2b,0x4d,0x19,0xe0,
+    0xef,0x40,0x0,0x31,0x5a,0xa1,0x3,0x53,0xf8,0x0,0xff,0x28,0xf,0xd0,0xa0,0x69,
+    0x0,0x28,0x22,0xff,0xd0,0x1,0x68,0x9,0x69,0x88,0x47,0x20,0xbf,0x84,0xe1,0x8b,
+    0x8,0x42,0x13,0x13,0x4,0x2,0xf6,0x13,0x0,0x89,0x68,0x13,0x0,0x7f,0x40,0x1c,
+    0x20,0xff,0x77,0xe0,0x8b,0xa8,0x42,0x3,0xd0,0x20,0xff,0x7f,0xa1,0x7d,0x88,0x42,
+    0xde,0xd3,0x2,0xff,0x20,0xfc,0xf7,0x16,0xfc,0x70,0xbd,0x20,0x7f,0x0,0xff,0xf7,
+    0x66,0xff,0xa0,0x69,0x29,0x0,0xff,0x6b,0x88,0x47,0x70,0xbd,0x2,0x21,0x40,0x9f,
+    0x20,0x2,0xf0,0x69,0xf8,0xe3,0x0,0x6d,0x0,0x0,0xbf,0x29,0x8,0xd1,0xff,0xf7,
+    0x88,0x1f,0x0,0x0,0xfb,0x28,0x11,0x4d,0x8,0xd,0xe0,0xe0,0x8b,0x21,0xff,0x8c,
+    0x1,0x43,0xe1,0x83,0xe0,0x7d,0x41,0xff,0x1c,0xe1,0x75,0x6,0x49,0x22,0x7f,0x52,
+    0xff,0x0,0x89,0x5a,0x40,0x0,0x20,0x18,0x81,0xf9,0x80,0x6b,0x6,0x55,0x2,0xa8,
+    0xff,0x10,0xbd,0x0,0xbf,0x0,0x0,0x20,0xff,0xff,0x0,0x93,0x5,0x1,0xff,0x26,
+    0x49,0x1e,0x1e,0x29,0x0,0xd9,0x79,0xff,0xe1,0x2,0xa0,0x49,0x0,0x40,0x5a,0x87,
+    0xfe,0x1f,0x1,0x3e,0x0,0x56,0x0,0x6e,0x0,0x86,0xff,0x0,0xa0,0x0,0xb8,0x0,
+    0xce,0x0,0xe4,0xff,0x0,0xfa,0x0,0x10,0x1,0x26,0x1,0x3c,0xff,0x1,0x52,0x1,
+    0x6a,0x1,0x80,0x1,0xb0,0xff,0x1,0xc6,0x1,0xde,0x1,0xf8,0x1,0xe,0xff,0x2,
+    0x24,0x2,0x3a,0x2,0x50,0x2,0x66,0xef,0x2,0x7a,0x2,0xea,0x1,0x0,0x8e,0x2,
+    0xa4,0xff,0x2,0xb8,0x2,0xd0,0x2,0xad,0x49,0xd4,0xfe,0xab,0x0,0xe7,0xfc,0x0,
+    0x28,0x0,0xd1,0x4c,0xff,0xe1,0x0,0x22,0x1,0x21,0x2,0xf0,0x34,0xaf,0xfd,0x47,
+    0xe1,0xa7,0x17,0x4,0xdb,0x17,0x4,0x40,0xfe,0x17,0x4,0x3,0xf0,0xf4,0xf9,0x3b,
+    0xe1,0xa1,0xea,0x17,0x4,0xcf,0x17,0x4,0x34,0x17,0x8,0x40,0xfa,0x2f,0xff,0xe1,
+    0x9b,0x49,0x88,0x20,0x40,0x0,0x2,0xab,0xf0,0xc2,0x19,0x4,0x27,0x19,0x0,0x2,
+    0x19,0x0,0xf,0xbf,0xff,0x22,0xe1,0x94,0x49,0xf0,0x31,0x0,0xb6,0xfa,0x17,0x4,
+    0x1b,0x31,0x4,0x4,0xf0,0x31,0xfa,0x16,0xaf,0xe1,0x8e,0x49,0x90,0x17,0x0,0xaa,
+    0x17,0x4,0xf,0xff,0xe1,0x1,0x21,0x5,0xf0,0x58,0xf8,0xb,0xaf,0xe1,0x89,0x49,
+    0x60,0x15,0x0,0x9f,0x15,0x4,0x4,0xfb,0xe1,0x2,0x15,0x0,0xe9,0xfb,0x0,0xe1,
+    0x83,0x6b,0x49,0x9c,0x15,0x0,0x94,0x15,0x4,0xf9,0xe0,0x15,0x2,0xdf,0xf4,0xfd,
+    0xf5,0xe0,0x7e,0x73,0x0,0x2,0xf0,0xf5,0x89,0x15,0x4,0xee,0x15,0x4,0xd9,0xfe,
+    0xea,0xe0,0x57,0x78,0x49,0xe4,0x15,0x0,0x7e,0x15,0x4,0xe3,0x15,0x4,0x5f,0x62,
+    0xff,0xdf,0xe0,0x73,0x6d,0x4,0x73,0x15,0x4,0xff,0xd8,0xe0,0x0,0x21,0x6,0xf0,
+    0x19,0xf8,0x5f,0xd4,0xe0,0x6d,0x49,0x84,0x15,0x0,0x68,0x15,0x4,0xf7,0xcd,0xe0,
+    0x1,0x15,0x0,0x2e,0xfc,0xc9,0xe0,0xb5,0x68,0xb1,0x4,0x5d,0x15,0x4,0xc2,0xe0,
+    0xb1,0x2,0x6,0xff,0xf0,0x86,0xff,0xbd,0xe0,0x62,0x49,0x94,0xea,0x17,0x0,0x51,
+    0x17,0x4,0xb6,0x59,0x0,0x7,0xf0,0xa5,0xff,0xfc,0xb2,0xe0,0x0,0x20,0x21,0x1d,
+    0x1,0xff,0xe0,0x40,0x1c,0x89,0x1c,0xe2,0x7d,0x90,0xff,0x42,0x4,0xda,0xa,0x88,
+    0x1a,0x2a,0xf7,0xff,0xd1,0x0,0x26,0xaa,0xe0,0x56,0x49,0x8c,0xea,0x2f,0x0,0x39,
+    0x2f,0x4,0x9e,0x73,0x0,0x8,0xf0,0xb,0xaf,0xf8,0x9a,0xe0,0x50,0xe1,0x4,0x2e,
+    0x15,0x4,0x93,0xfe,0x45,0x0,0x8,0xf0,0xd0,0xfb,0x8f,0xe0,0x4b,0xeb,0x49,0xcc,
+    0x15,0x0,0x23,0x15,0x4,0x88,0xe0,0x5,0xfb,0x22,0x3,0x17,0x0,0xe4,0xfd,0x83,
+    0xe0,0x45,0xeb,0x49,0x8e,0x57,0x5,0x16,0x19,0x0,0x7c,0xd0,0x4,0x7d,0x23,0x19,
+    0x6,0x7f,0xff,0x76,0xe0,0x3e,0xd1,0x4,0xfd,0xa,0x17,0x0,0x70,0xd0,0x6,0x22,
+    0x7,0x21,0xff,0x9,0xf0,0xe4,0xf9,0x6b,0xe0,0x39,0x49,0xfd,0xb0,0x15,0x0,0xff,
+    0xfb,0x0,0x28,0x65,0xd0,0xf7,0x4,0x22,0x5,0x15,0x0,0xa3,0xfb,0x60,0xe0,0x57,
+    0x33,0x49,0xb4,0x15,0x0,0xf4,0x15,0x0,0x5a,0x2b,0x8,0x9f,0x60,0xfd,0x55,0xe0,
+    0x2e,0x29,0x5,0x5f,0x1,0x28,0xfd,0x4f,0x15,0x8,0xd1,0xff,0x4a,0xe0,0x28,0x49,
+    0xb5,0xa8,0x15,0x0,0xde,0x15,0x0,0x44,0xd0,0x6d,0x2,0xa,0xbf,0xf0,0xa4,0xfb,
+    0x3f,0xe0,0x23,0x6b,0x5,0xd3,0xee,0x15,0x0,0x39,0xd0,0x2,0x13,0x0,0x0,0xfe,
+    0x35,0xeb,0xe0,0x1e,0xf,0x5,0xc9,0x13,0x0,0x2f,0xd0,0x0,0xff,0x21,0xb,0xf0,
+    0x42,0xf8,0x2b,0xe0,0x19,0x6b,0x49,0xc4,0x13,0x0,0xbf,0x13,0x0,0x25,0xd0,0x39,
+    0x3,0xff,0xb,0xf0,0x11,0xfc,0x20,0xe0,0x13,0x49,0xd5,0x78,0x15,0x0,0xb4,0x15,
+    0x0,0x1a,0x3d,0x0,0xc,0xf0,0x7f,0x2d,0xf8,0x16,0xe0,0xe,0x49,0x92,0xd9,0x4,
+    0xf5,0xa9,0x15,0x0,0xf,0x7f,0x4,0xc,0xf0,0xaf,0xfa,0x5f,0xa,0xe0,0x8,0x49,
+    0x9a,0x17,0x4,0x9d,0x17,0x0,0xfd,0x3,0x17,0x8,0x4f,0xff,0xa0,0x61,0x2,0xe0,
+    0xff,0x0,0x25,0x0,0x26,0xa5,0x61,0x30,0x0,0xff,0x70,0xbd,0x5c,0x4e,0x3,0x0,
+    0x0,0x21,0xff,0x2,0x0,0x44,0x32,0x90,0x42,0x0,0xd2,0xbf,0x9,0xe0,0x1,0x20,
+    0x70,0x47,0xf,0x2,0x5c,0xfa,0xf,0x4,0x1,0xf,0x4,0x3,0x68,0xc9,0x18,0x0,
+    0xff,0x1d,0x90,0x42,0xfa,0xd3,0x48,0x1e,0x80,0x67,0x41,0xc0,0xf,0x21,0x6,0x31,
+    0x6,0xf0,0xe7,0x21,0x2,0xff,0x10,0xb5,0x4,0x0,0xd,0xd0,0xf0,0xf7,0xff,0x53,
+    0xfa,0x44,0x28,0x9,0xd1,0x20,0x0,0x7f,0xf0,0xf7,0x57,0xfa,0xd,0x28,0x4,0x9,
+    0x0,0xff,0xff,0xf7,0xd0,0xff,0x0,0x28,0x1,0xd1,0xff,0x0,0x20,0x10,0xbd,0x20,
+    0x0,0x10,0xbd,0xee,0x29,0xa,0x4b,0xfa,0x5c,0x29,0x8,0x47,0xfa,0x11,0xea,0x29,
+    0x8,0xc3,0x29,0x24,0x3b,0x53,0xc,0x37,0xfa,0xf,0xfa,0x29,0x8,0xbf,0x29,0x14,
+    0xf4,0xb5,0x7,0x0,0xe,0xff,0x0,0x1c,0x0,0x0,0x2f,0x18,0xd1,0x0,0xff,0x25,
+    0x21,0x0,0x18,0x31,0xa,0x0,0x3,0xff,0x23,0x15,0x60,0x12,0x1d,0x5b,0x1e,0xfb,
+    0xff,0xd1,0x40,0x1c,0xc,0x31,0x3,0x28,0xf5,0xff,0xdb,0x20,0x0,0xc,0x30,0xd,
+    0xf0,0xf0,0xaf,0xfc,0x20,0x0,0xb4,0x7,0x0,0xf3,0x7,0x0,0x9c,0xff,0x30,0x45,
+    0x63,0x1a,0xe0,0x20,0x0,0x18,0xf7,0x30,0x39,0x0,0x23,0x0,0x22,0x3,0x23,0xd,
+    0xbf,0x68,0x5,0x60,0x9,0x1d,0x0,0x37,0x0,0xf9,0xcf,0xd1,0x52,0x1e,0xf6,0x6b,
+    0x0,0x33,0x2,0xd6,0xfc,0xff,0x21,0x0,0xb4,0x31,0x38,0x0,0x30,0x30,0xff,0x2c,
+    0xc8,0x2c,0xc1,0xf8,0x6b,0xd0,0x21,0xbf,0x60,0x50,0x21,0x0,0xa8,0x31,0x45,0x1,
+    0x2e,0xbd,0x1f,0x23,0x0,0x9c,0x30,0xc5,0x63,0x5,0x2,0x5,0xfd,0x64,0x53,0x4,
+    0x64,0x8,0x0,0xd,0xf0,0xc3,0x4a,0x5f,0x4,0x5,0x17,0x0,0x48,0x41,0x0,0xd,
+    0x2,0x3c,0x7,0x0,0xfd,0xcf,0x15,0x4,0x85,0x60,0x9c,0x20,0x25,0x50,0xfe,0x2b,
+    0x4,0x60,0x24,0xe0,0xf0,0x6c,0xd8,0x22,0xdf,0xa0,0x50,0x30,0x6d,0xdc,0x5,0x0,
+    0x70,0x6d,0xf9,0xe0,0xb,0x2,0x2b,0x0,0xc,0xc8,0xc,0xc1,0x2,0xbf,0x68,0xa,
+    0x60,0xb0,0x6c,0xcc,0x6d,0x0,0x31,0xf4,0x9f,0x0,0x49,0x6,0xb5,0x49,0x8,0xaa,
+    0xfc,0xb0,0x6b,0xdd,0xa4,0x19,0x0,0x30,0x6b,0x9c,0x5,0x0,0x70,0x6b,0xfd,0xa0,
+    0x5,0x0,0x26,0x0,0xc0,0x36,0x0,0x98,0x57,0x0,0x28,0xe,0x93,0x0,0x78,0x23,
+    0x0,0x88,0x2b,0x0,0x5d,0x6c,0x7,0x0,0x76,0xfc,0x30,0x91,0x0,0x7a,0x7b,0x6,
+    0x9f,0x63,0x11,0xe0,0x1,0x46,0x4d,0x2,0x21,0x2,0x8e,0xfe,0x21,0x8,0x65,0xfc,
+    0x0,0x98,0x30,0x30,0xe,0xff,0xc8,0xe,0xc6,0x0,0x98,0xc0,0x6b,0xd4,0xfe,0x4b,
+    0x0,0xa,0x20,0x60,0x80,0xe8,0x20,0x20,0xff,0x80,0xb8,0x68,0xa0,0x60,0x9c,0x34,
+    0xa5,0xfb,0x64,0xf1,0x65,0x1,0xb0,0xb0,0x4,0x0,0x0,0xff,0x27,0x0,0x25,0x2,
+    0x97,0x1,0x97,0xe8,0xff,0x29,0x0,0xd2,0xdf,0xe0,0x20,0x68,0x0,0xff,0x28,0x5,
+    0xd0,0x61,0x68,0x4,0x29,0x2,0xff,0xd3,0xff,0xf7,0xfc,0xfe,0x5,0x0,0xa0,0xfa,
+    0x11,0x4,0xe1,0x11,0x8,0x8,0xff,0x2,0x90,0x20,0xf5,0x69,0x23,0x4,0x69,0x11,
+    0x6,0x14,0xff,0x1,0x90,0xff,0x0,0x2d,0x0,0xd1,0xc1,0xe0,0x30,0x9b,0xdf,0x1,
+    0x9a,0x2,0x99,0x28,0xcd,0x1,0x1f,0xff,0xed,0xa0,0x23,0x2,0xd1,0xe0,0x5,0x0,
+    0x2,0xd1,0x20,0xff,0x6a,0x0,0x28,0x3a,0xd0,0x6,0x97,0x5,0xff,0x97,0x4,0x97,
+    0x80,0x20,0xc0,0x5,0x3,0xff,0x90,0x6,0xa8,0x0,0x90,0x5,0xab,0x4,0xff,0xaa,
+    0x3,0xa9,0x7,0xa8,0xeb,0xf7,0xc,0xff,0xfb,0x66,0x6a,0xa1,0x69,0xe2,0x69,0x23,
+    0xff,0x6a,0x7,0x96,0x8,0x91,0x9,0x92,0xa,0xbf,0x93,0xf0,0xf7,0xf4,0xf8,0xb,
+    0x1b,0x0,0xd,0xff,0xf0,0x33,0xfc,0xc,0x35,0x3,0x95,0xb,0xff,0xad,0x26,0xae,
+    0x3,0x20,0x0,0x90,0x2a,0xf7,0x0,0x3,0x99,0xf9,0x2,0xcf,0xfc,0xc,0x36,0xff,
+    0xc,0x35,0x0,0x98,0x40,0x1e,0x0,0x90,0xff,0xf4,0xd1,0x30,0x98,0x18,0x30,0x26,
+    0xa9,0xd6,0xed,0x7,0xed,0x11,0xef,0xb,0xf8,0xef,0x1,0xf5,0xd1,0x1d,0x1,0x3d,
+    0x1,0x2f,0xd0,0xa0,0x81,0x0,0x8d,0x0,0x5,0x0,0xde,0x8d,0x0,0x6b,0x0,0x28,
+    0x26,0x8d,0x30,0xc5,0xfa,0xff,0x65,0x6b,0xa3,0x6a,0xe1,0x6a,0x22,0x6b,0xff,0x7,
+    0x95,0x8,0x93,0x9,0x91,0xa,0x92,0xf7,0xf0,0xf7,0xad,0x8d,0x8,0xec,0xfb,0xb,
+    0xaa,0xdf,0x1,0x99,0xc,0x31,0x1d,0xb,0x0,0xb4,0xfc,0xef,0x1d,0xa9,0x30,0x98,
+    0x73,0x3,0xd4,0xfb,0x2,0x20,0x65,0x6,0x59,0x0,0x65,0x0,0x5,0x0,0x65,0x0,
+    0x6c,0x65,0x2,0x63,0x2,0xdd,0x3,0x65,0x4,0x1,0x90,0x5,0x65,0x0,0x4,0xab,
+    0xdf,0x3,0xaa,0x1,0xa9,0x6,0x65,0x0,0x92,0xfa,0xff,0x65,0x6c,0xa2,0x6b,0xe1,
+    0x6b,0x23,0x6c,0xcf,0x6,0x95,0x7,0x92,0xf5,0x0,0xf3,0x0,0x7a,0xf8,0xfd,0xa,
+    0x1b,0x0,0xd,0xf0,0xb9,0xfb,0xa,0xaa,0x75,0x2,0x65,0x0,0x14,0xb,0x0,0x81,
+    0xfc,0x14,0x65,0x0,0xfd,0x48,0x65,0x0,0xa1,0xfb,0x30,0x98,0xe8,0x30,0xff,0x30,
+    0x99,0x81,0x42,0x4,0xd2,0xa,0x68,0xff,0xbf,0x18,0x9,0x1d,0x81,0x42,0xfa,0xd3,
+    0xff,0x78,0x42,0x30,0x99,0xe4,0x31,0x8,0x60,0xff,0x30,0x98,0x0,0x88,0xe8,0x28,
+    0x2,0xd0,0xff,0xc,0x20,0xc0,0x43,0x0,0xe0,0x0,0x20,0xff,0x31,0xb0,0xf0,0xbd,
+    0x0,0x0,0xf0,0xb5,0xff,0x83,0xb0,0xc,0x0,0x16,0x0,0xc1,0x17,0xff,0x22,0x0,
+    0xe3,0x17,0xf0,0xf7,0x5f,0xff,0xff,0x4,0x0,0xd,0x0,0x1,0x2e,0x1a,0xdb,0xff,
+    0x40,0x2e,0x1,0xdb,0xe8,0x17,0x19,0xe0,0xff,0x6f,0x46,0x32,0x0,0xf7,0xf7,0x3f,
+    0xfe,0xff,0x3,0xc7,0x20,0x0,0x29,0x0,0x72,0x1e,0xff,0xf7,0xf7,0x39,0xfe,0x1,
+    0x22,0x0,0x23,0xff,0x2,0x40,0x5,0xd0,0x6a,0x46,0x68,0x46,0xff,0x3,0xc8,0x40,
+    0x1c,0x59,0x41,0x3,0xc2,0xfe,0x9,0x2,0x2,0xe0,0x72,0x42,0xf7,0xf7,0x17,0xfb,
+    0xfe,0x3,0x5b,0x0,0x80,0xb5,0x0,0x90,0x2,0xfb,0x22,0x1,0x21,0x0,0xd,0xf0,
+    0x3f,0xfc,0x0,0xff,0x68,0x2,0xbd,0xf0,0xb5,0x8d,0xb0,0x6,0xfe,0x5d,0x0,0x0,
+    0x24,0x4,0x94,0x3,0x94,0x2,0xff,0x94,0x80,0x27,0xff,0x5,0x1,0x97,0x4,0xae,
+    0xf5,0x0,0x3,0xab,0x2,0xf5,0x0,0x9,0xf5,0x0,0x17,0x7f,0xfa,0xf2,0x68,0x1e,
+    0x21,0x1e,0x20,0xf3,0x1,0xef,0xfa,0x9,0x90,0x32,0xb,0x8,0x6,0xfa,0xa,0xfb,
+    0x90,0x72,0xb,0x8,0x0,0xfa,0xb,0x90,0xb2,0x9e,0xb,0x8,0xfa,0xf9,0xc,0x90,
+    0x4b,0x6,0x47,0x12,0x5,0xee,0x47,0x0,0xf3,0xf9,0xea,0x23,0x8,0xe8,0xf9,0x5,
+    0xfb,0x90,0x2a,0xb,0x8,0xe2,0xf9,0x6,0x90,0x6a,0xbe,0xb,0x8,0xdc,0xf9,0x7,
+    0x90,0xaa,0xb,0x8,0xd6,0xef,0xf9,0x8,0x90,0x5,0x7f,0x0,0xf5,0xf7,0xc0,0xef,
+    0xfc,0x40,0x0,0xd,0xbd,0x0,0x30,0xb5,0xb9,0xff,0xb0,0x4,0x0,0x0,0x29,0x6,
+    0xd0,0x4,0xff,0x2a,0x4,0xd3,0x8,0x0,0xef,0xf7,0x9c,0xff,0xff,0x5,0x0,0x1,
+    0xd1,0x0,0x20,0x16,0xef,0xe0,0x68,0x46,0xc0,0x1,0x0,0xc,0x35,0x29,0xfe,0x15,
+    0x0,0x30,0xff,0x0,0x20,0x1,0x2c,0x4,0xfb,0xd0,0x2,0x3,0x0,0x4,0x2c,0x7,
+    0xd0,0x7,0xff,0xe0,0x31,0x98,0x5,0xe0,0x32,0x98,0x0,0xef,0x17,0x64,0x21,0x48,
+    0x67,0x1,0x30,0x98,0x39,0xfb,0xb0,0x30,0xb,0x1,0xa,0x0,0x1,0x0,0x1,0xbf,
+    0x20,0xff,0xf7,0xd3,0xff,0x2,0xd,0x8,0x4,0xaa,0xd,0x0,0xcc,0xd,0xc,0x2,
+    0xd,0x0,0xc5,0xd,0x0,0x0,0xff,0x20,0xaa,0x49,0x8,0x70,0x70,0x47,0x80,0xef,
+    0xb5,0xd,0xf0,0x3a,0xf,0x0,0xf2,0xb5,0x6,0xff,0x0,0x17,0x0,0x1d,0x0,0xa5,
+    0x4c,0xa6,0xff,0x48,0x20,0x18,0x1,0x78,0x0,0x29,0x13,0xbf,0xd1,0x1,0x21,0x1,
+    0x70,0x20,0xba,0x1,0x3d,0x7f,0xf8,0x2b,0x0,0x3a,0x0,0x0,0x99,0xb,0x2,0xff,
+    0x50,0xf8,0x5,0x0,0x9,0xd5,0x21,0x0,0xff,0x20,0x0,0xe,0xf0,0x67,0xf9,0x0,
+    0x20,0xdf,0x30,0x60,0x3,0xe0,0x14,0xe9,0x1,0xf2,0xbd,0xff,0x34,0x60,0x28,0x0,
+    0xf2,0xbd,0x10,0xb5,0xdf,0x95,0x4c,0x84,0x42,0x10,0xbf,0x0,0x94,0x49,0xe7,0x60,
+    0x54,0x94,0x4b,0x0,0xc3,0x2,0x80,0x20,0xc0,0x5d,0x0,0x9,0x6,0xed,0x20,0x80,
+    0x9,0x8,0x10,0xb9,0x3,0x77,0xf0,0x79,0xf8,0x99,0x2,0x0,0xf0,0xd4,0x7,0x8,
+    0xed,0xb1,0x7,0x8,0xd,0xf9,0x7,0x2,0x8b,0xe1,0x10,0xfd,0xb5,0x1d,0x1,0x1d,
+    0xe,0xf0,0x4f,0xf9,0x20,0xff,0x0,0xb4,0x30,0xe,0xf0,0x4b,0xf9,0xb2,0xfb,0x20,
+    0x40,0x41,0x0,0xd,0xf0,0xe0,0xfb,0x89,0xfd,0x20,0xea,0x0,0x18,0xe,0xf0,0xce,
+    0xfa,0xb8,0xfe,0x67,0x0,0xe,0xf0,0xea,0xfe,0x20,0x0,0x10,0xff,0xbd,0x70,0xb5,
+    0xb8,0xb0,0x5,0x0,0xc,0xff,0x0,0x16,0x0,0x0,0x20,0x28,0x60,0x4,0xff,0x20,
+    0xb2,0x49,0x68,0x54,0x0,0x2e,0x9,0x5f,0xd0,0x4,0x2b,0x7,0xd3,0x51,0x7,0x31,
+    0x4f,0x1,0x7f,0x73,0xfe,0x0,0x28,0x2,0xd0,0xc,0xb9,0x0,0xff,0x35,0xe0,0x2a,
+    0x98,0x1,0x0,0x6a,0x46,0xff,0xac,0x32,0x2,0x23,0x16,0x68,0x86,0x42,0xdf,0x0,
+    0xdb,0x30,0x46,0xb1,0x5,0x0,0x31,0x46,0xff,0x12,0x1d,0x5b,0x1e,0xf5,0xd1,0x80,
+    0x22,0xff,0x12,0x6,0x91,0x42,0x1,0xd1,0xd1,0x43,0xff,0x8,0xe0,0xca,0x17,0x51,
+    0x40,0x89,0x1a,0x7f,0xc3,0x17,0x58,0x40,0xc0,0x1a,0x88,0x23,0x0,0xff,0x1,0x0,
+    0x89,0x11,0x0,0x2c,0xb,0xd0,0xff,0x60,0x78,0x0,0x2,0x22,0x78,0x10,0x43,0x5f,
+    0xe0,0x28,0x5,0xd1,0xe0,0xb,0x0,0xa2,0xb,0x0,0xdf,0x3,0x28,0x3,0xd0,0x28,
+    0x31,0x1,0x34,0xf9,0xbf,0x4,0xe0,0xa,0x0,0x21,0x1d,0xb,0x2,0xd6,0xbf,0xf9,
+    0x38,0xb0,0x70,0xbd,0xf8,0xd3,0x0,0xd,0xfe,0x6d,0x1,0x0,0x20,0x20,0x60,0x68,
+    0x68,0x1,0xff,0x28,0x2,0xda,0x29,0x68,0x0,0x29,0x31,0xfd,0xd0,0x5,0x2,0x1,
+    0xd1,0x1,0x28,0x1,0xdb,0xed,0x1,0x19,0x0,0x2,0x26,0x1b,0x4,0xdb,0x20,0x68,
+    0xaf,0x30,0x43,0x20,0x60,0x5,0x0,0x40,0x4f,0x0,0x68,0xff,0xc0,0x21,0x1,0x43,
+    0x29,0x60,0x20,0x78,0xbf,0xc0,0x7,0x7,0xd5,0x38,0x68,0xc3,0x2,0x7b,0xff,0x49,
+    0x88,0x42,0x1,0xdb,0x7a,0x48,0x38,0x7f,0x60,0x3b,0x0,0x2c,0x33,0x29,0x0,0x1f,
+    0xb,0xff,0x32,0xfc,0x20,0x68,0x6,0x40,0x6,0xd0,0xff,0xcc,0x48,0x20,0x58,0x3a,
+    0x0,0x69,0x68,0xff,0x3,0x68,0xdb,0x68,0x98,0x47,0x0,0x20,0x75,0xf2,0x21,0x1,
+    0x82,0x21,0x1,0xe,0x0,0x14,0x81,0x0,0x7f,0x18,0x60,0x20,0x60,0x60,0x60,0x28,
+    0x49,0x0,0xbf,0x10,0xd0,0x0,0x94,0xf2,0x6a,0x3d,0x2,0x28,0xfe,0x3d,0x0,0xb3,
+    0xfc,0x28,0x78,0x80,0x7,0x6,0xff,0xd5,0xbc,0x48,0x28,0x58,0x22,0x1d,0x31,0x5f,
+    0x0,0x3,0x68,0x9b,0x69,0x3d,0x2,0x76,0x3d,0x0,0xfa,0xbd,0x2,0x20,0x31,0x0,
+    0x2f,0xd0,0xc0,0x7,0x16,0xfd,0xd5,0xb5,0x2,0xa,0xd0,0xb3,0x4e,0xb1,0x42,0xb7,
+    0x7,0xda,0x20,0xa9,0x1,0x51,0xf9,0xc7,0x4,0xd0,0xaf,0xb1,0x42,0x4,0xdb,0xe1,
+    0x2,0x17,0x63,0x1,0x70,0xbd,0xbd,0xbd,0x7,0x43,0xf9,0xea,0x6a,0xa1,0xe,0xb2,
+    0xbf,0xfc,0x0,0x28,0xa,0xd1,0x20,0x67,0x0,0xa,0xfb,0xd5,0xa2,0xa5,0x0,0x29,
+    0x0,0x2,0x68,0x12,0xf7,0x69,0x90,0x47,0xd5,0x2,0x0,0x21,0x21,0x60,0xef,0x70,
+    0xbd,0x0,0x20,0x3,0x0,0x0,0xc0,0x1e,0xfe,0x6e,0x0,0x10,0x0,0x20,0x58,0xe,
+    0x0,0x0,0xff,0x54,0x7,0x0,0x0,0xfb,0xb5,0x90,0xb0,0xbe,0xbb,0x2,0x20,0x60,
+    0x10,0x98,0x0,0x87,0x0,0x3,0xef,0xd0,0x11,0x98,0x0,0x11,0x1,0x1,0xd4,0x3,
+    0xdf,0x20,0x67,0xe0,0x18,0x21,0xd,0x0,0x69,0xf4,0x5f,0xf7,0x32,0xfc,0x1,0x90,
+    0xb,0x2,0x40,0xb,0x0,0xd7,0x2c,0xfc,0x2,0xb,0x4,0x80,0xb,0x0,0x26,0xfc,
+    0xff,0x3,0x90,0x0,0x25,0x1,0xae,0x3,0x27,0xff,0x30,0x68,0x1,0x0,0xf5,0xf7,
+    0x11,0xff,0xfd,0x29,0x5,0x0,0x6f,0xfc,0x5,0x0,0x36,0x1d,0xff,0x7f,0x1e,0xf4,
+    0xd1,0xf5,0xf7,0xd5,0xfe,0xff,0x5,0x0,0x0,0x95,0xa,0xaa,0x69,0x46,0x7c,0x5f,
+    0x0,0xd1,0x0,0x64,0xf8,0x0,0x95,0x4,0xd,0x4,0xfe,0xc3,0x2,0x5d,0xf8,0x68,
+    0x46,0x0,0x7c,0xa,0xff,0xa9,0x48,0x73,0x12,0x98,0x0,0x90,0x23,0xff,0x0,0x8,
+    0x33,0xa,0xaa,0x11,0x99,0x10,0xff,0x98,0xb2,0x25,0x6d,0x0,0x40,0x19,0xd,0xfb,
+    0xf0,0x94,0xd5,0x0,0x3,0xd1,0x21,0x68,0x1,0xff,0x22,0xa,0x43,0x22,0x60,0x2,
+    0x25,0x10,0xff,0x99,0x9,0x68,0x29,0x40,0x15,0xd0,0x10,0xff,0x99,0xf,0x4a,0x89,
+    0x18,0x0,0x28,0x1,0xff,0xd1,0x60,0x7b,0x8,0x70,0x48,0x68,0x12,0xff,0x9a,0x0,
+    0x92,0x23,0x0,0x20,0x33,0xa,0xff,0x78,0x11,0x99,0x6,0x68,0x76,0x69,0xb0,0xfe,
+    0xf7,0x2,0xd1,0x20,0x68,0x5,0x43,0x25,0x60,0xfe,0xb5,0x0,0x68,0x60,0x60,0x0,
+    0x20,0x12,0x99,0xdf,0x8,0x70,0x13,0xb0,0xf0,0x3,0x1,0x74,0xb,0xff,0x0,0x0,
+    0x88,0x8,0x0,0x0,0x41,0x9c,0xf7,0x0,0x0,0x40,0x3,0x0,0x3,0x78,0xdb,0x7,
+    0x7f,0x4,0xd5,0xb2,0x23,0x5b,0x0,0xc0,0x49,0x1,0xff,0x50,0xfd,0x0,0x20,0x2,
+    0xbd,0xf3,0xb5,0xff,0x97,0xb0,0x89,0x21,0x9,0x1,0x40,0x18,0xff,0x1,0x90,0x17,
+    0x99,0x4e,0x4a,0x88,0x50,0xff,0x84,0x4a,0x1e,0x21,0x1e,0x20,0xea,0xf7,0xff,0x82,
+    0xfe,0x4,0x0,0x82,0x4a,0x1f,0x21,0xfd,0x1f,0xb,0x0,0x7c,0xfe,0x3,0x90,0x80,
+    0x4f,0xfb,0x3a,0x0,0xd,0x6,0x75,0xfe,0x2,0x90,0x7d,0xeb,0x4e,0x32,0xd,0x8,
+    0x6e,0xf9,0x0,0x1e,0x21,0x20,0xff,0x0,0xf4,0xf7,0x93,0xfb,0x0,0x90,0x1f,0xff,
+    0x21,0x3,0x98,0xf4,0xf7,0x8e,0xfb,0x4,0xba,0x1d,0x0,0x28,0x13,0x0,0x89,0xfb,
+    0x5,0x9,0x0,0x2,0xfe,0x13,0x0,0x84,0xfb,0x8,0x94,0x9,0x95,0x0,0xff,0x99,
+    0xa,0x91,0xb,0x90,0x8,0xa8,0x0,0xff,0x90,0x9,0xab,0xa,0xaa,0xb,0xa9,0x17,
+    0xfe,0x2d,0x1,0xd,0xf0,0x8f,0xff,0x0,0x28,0x57,0x57,0xd1,0xba,0x8,0x79,0x6,
+    0x45,0x79,0x0,0x66,0x79,0x8,0xef,0x3f,0xfe,0x0,0x90,0x77,0xa,0x39,0xfe,0x7,
+    0x75,0x0,0x75,0xa,0x33,0x75,0xc,0x58,0xfb,0x6,0x13,0x0,0x55,0x0,0x61,0x0,
+    0x53,0x75,0xc,0x4e,0x75,0x4,0x38,0x9,0x0,0xff,0x49,0xfb,0x4,0x94,0x5,0x95,
+    0x6,0x96,0xf7,0x7,0x90,0x4,0x73,0x0,0x5,0xab,0x6,0xaa,0x7d,0x7,0x73,0x0,
+    0xb4,0x30,0xd,0xf0,0x55,0x73,0x0,0xff,0x1d,0xd1,0xc,0xa8,0xe,0xf0,0xee,0xf8,
+    0xff,0xc,0xa9,0x1,0x98,0xe,0xf0,0xea,0xf9,0x77,0x0,0x28,0x14,0x11,0x4,0x5,
+    0xfd,0xc,0x25,0x0,0xff,0x46,0x4a,0x80,0x18,0xe,0xf0,0xff,0xfd,0xff,0x0,0x28,
+    0x9,0xd1,0x18,0x9a,0x0,0x21,0xeb,0x17,0x98,0x3b,0xb,0xe6,0x29,0x0,0x1,0xd0,
+    0x3,0xef,0x20,0xc0,0x43,0x19,0x69,0x5,0x0,0x0,0x8c,0xfe,0x67,0x1,0x9d,0xad,
+    0x0,0x0,0xf5,0xb5,0x89,0xfb,0xb0,0xf,0x99,0x0,0x78,0x68,0xf4,0xf7,0xb,0xea,
+    0x99,0x4,0xb8,0x9,0x0,0x6,0x99,0x4,0x38,0x69,0xf4,0xeb,0xf7,0x1,0x99,0x4,
+    0xf8,0x13,0x0,0xfc,0xfa,0x5,0xff,0x94,0x6,0x95,0x7,0x96,0x8,0x90,0x5,0xfe,
+    0x99,0x0,0x6,0xab,0x7,0xaa,0x8,0xa9,0x9,0x9a,0xd,0x5,0x8,0x99,0x0,0x40,
+    0xd1,0x43,0x0,0x2f,0x0,0xe9,0xd9,0xfa,0x43,0x4,0x9,0x0,0xe4,0xfa,0x43,0x4,
+    0x6a,0xf4,0xe7,0xf7,0xdf,0xfa,0x43,0x4,0x13,0x0,0xda,0xfa,0x1,0xff,0x94,0x2,
+    0x95,0x3,0x96,0x4,0x90,0x1,0x3e,0x43,0x0,0x2,0xab,0x3,0xaa,0x4,0x43,0x0,
+    0xdd,0x2,0xff,0xe6,0xfe,0x0,0x28,0x1e,0xd1,0x38,0x68,0xee,0xbb,0x0,0x98,0x2,
+    0xd1,0xe1,0x3,0x0,0xe0,0x12,0xff,0x49,0x40,0x18,0x9,0x99,0x12,0x4a,0x89,0xff,
+    0x18,0x8,0x60,0x39,0x0,0xb4,0x31,0x2,0xff,0x68,0x92,0x68,0x90,0x47,0x0,0x28,
+    0xa,0xff,0xd1,0xa,0x9a,0x24,0x37,0x39,0x0,0x9,0xea,0xdf,0xc,0x76,0xdf,0xc,
+    0xb,0xdf,0x0,0x5c,0x8f,0xc2,0xff,0x5,0xaf,0x94,0x65,0x0,0x71,0x3d,0xa,0xff,
+    0x17,0x66,0x66,0x66,0x26,0x95,0xd4,0x9,0xf7,0x0,0x74,0xb,0xf3,0x6,0xf0,0xb5,
+    0x83,0xb0,0xff,0x7,0x0,0x0,0x24,0xb3,0x4d,0xac,0x70,0xff,0xec,0x70,0x0,0x22,
+    0xb2,0x49,0x28,0x0,0x7f,0x10,0x30,0xe,0xf0,0xd9,0xff,0x78,0x7b,0x0,0xff,0x1,
+    0xd1,0xb9,0x48,0x0,0xe0,0xb9,0x48,0xf7,0xe8,0x60,0x38,0x2a,0x0,0x95,0xf9,0x6,
+    0x0,0xfd,0xa8,0x15,0x0,0x2,0xd0,0xf,0xf0,0xab,0xf8,0xbf,0xac,0x60,0x78,0x6a,
+    0x0,0x90,0x67,0x2,0xef,0xff,0xf7,0x7a,0xfc,0x1,0x90,0x69,0x46,0x28,0xff,0x0,
+    0x8,0x30,0xf,0xf0,0x82,0xf8,0xc,0xff,0x21,0xc9,0x43,0x88,0x42,0x1,0xd1,0x4,
+    0xf7,0x21,0x4,0xe0,0x1f,0x0,0xd5,0x5,0x21,0x0,0xff,0xe0,0x0,0x21,0x0,0x2e,
+    0x1,0xd0,0x30,0x7f,0x0,0x5,0xe0,0x0,0x29,0x1,0xd0,0x78,0x0,0xff,0xe0,0x0,
+    0x20,0x1,0x24,0x2c,0x70,0x4a,0xff,0x1e,0x92,0x41,0xd2,0xf,0x6a,0x70,0x3,0xfe,
+    0xa7,0x0,0x10,0xb5,0x82,0xb0,0x1,0x0,0x0,0xbf,0x20,0x0,0x90,0x90,0x48,0x40,
+    0x67,0x0,0x4,0xff,0xd1,0x5,0x21,0x38,0x20,0x1,0xf0,0x91,0xff,0xf8,0x4,0xe0,
+    0x6b,0x46,0xc0,0x22,0xe7,0xff,0xf7,0x65,0xff,0x4,0x0,0x0,0x2c,0x1,0xbf,0xd1,
+    0x0,0x20,0x16,0xbd,0x3,0x3,0x0,0x86,0xff,0x49,0x88,0x70,0x70,0x47,0x38,0xb5,
+    0x5,0xaf,0x0,0x83,0x4c,0x60,0x31,0x4,0x4,0x31,0x4,0x78,0xff,0xf8,0x31,0xbd,
+    0xa,0x0,0x29,0x0,0xe7,0xef,0xf7,0x50,0xff,0x68,0x17,0x0,0x11,0xd1,0xe8,0xfe,
+};
+
+static const uint8_t dfuStream_1_7_0_390_page3[30000] PROGMEM = {
+    0x5,0x0,0xe,0xd1,0x68,0x69,0x0,0x28,0xb,0xbb,0xd1,0xa8,0x5,0x0,0x8,0xd1,
+    0xe8,0x5,0x0,0x5,0xb7,0xd1,0x28,0x6a,0xcf,0x0,0xd1,0x68,0x5,0x0,0xa,0xff,
+    0xd0,0xe0,0x78,0x0,0x28,0x10,0xd1,0x7e,0xef,0x4a,0xe1,0x68,0x20,0x3,0x5,0x5e,
+    0xff,0x1,0xb7,0x20,0x7,0xe0,0x15,0x2,0x5,0xd0,0x11,0x6,0x66,0xff,0xff,0x0,
+    0x20,0xe0,0x70,0x31,0xbd,0x80,0x7f,0xb5,0xb9,0x49,0x4a,0x68,0x0,0x2a,0x6f,0xa,
+    0x7f,0x40,0xf8,0x1,0xbd,0x1,0x0,0x10,0x6f,0x0,0xf7,0x1c,0xff,0x1,0x1d,0x0,
+    0xb2,0x4a,0x53,0x68,0x5f,0x0,0x2b,0x4,0xd1,0x3,0x1d,0x4,0x31,0x1d,0x0,0x5f,
+    0xa,0x0,0x1,0x0,0x18,0x1f,0x0,0x10,0x1f,0x0,0xff,0x70,0xb5,0xea,0xb0,0xc,
+    0x0,0x16,0x0,0xff,0xa8,0x4d,0xa8,0x78,0xc0,0x7,0x2a,0xd5,0xff,0x7,0xa8,0x0,
+    0x22,0xc0,0x23,0xc2,0x54,0xff,0x6,0x71,0xf1,0xb2,0x0,0x29,0x17,0xd0,0xff,0x2,
+    0x29,0x15,0xd0,0x8,0x29,0x13,0xd0,0xff,0x1,0x29,0xa,0xd1,0x21,0x68,0x7,0x91,
+    0xff,0xa1,0x88,0xc1,0x80,0xe1,0x88,0x1,0x81,0xff,0x21,0x89,0x41,0x81,0x61,0x89,
+    0x81,0x81,0xdf,0xe,0xe0,0x9,0x29,0xc,0x19,0x4,0x1,0x21,0xef,0xc1,0x80,0x7,
+    0xe0,0x23,0x1a,0x0,0x21,0xfb,0xff,0xf7,0x55,0xfa,0x28,0x78,0x1,0x28,0x4f,0xff,
+    0xd1,0x30,0x0,0x6,0xd0,0x1,0x2e,0x10,0xff,0xd0,0x2,0x2e,0x1d,0xd0,0x9,0x2e,
+    0x27,0xff,0xd0,0x2d,0xe0,0x8,0x20,0x20,0x5e,0x0,0xff,0x90,0x6,0x20,0x23,0x5e,
+    0x4,0x20,0x22,0xff,0x5e,0x21,0x68,0x68,0x68,0xe7,0xf7,0xe8,0x6f,0xfe,0x21,0xe0,
+    0xa,0x17,0x0,0x1,0x90,0x1d,0x22,0xf7,0xe0,0xfe,0x12,0x35,0x24,0xdc,0xfe,0x6,
+    0xe0,0xbf,0x6,0x20,0x0,0xf0,0x47,0xfa,0xf,0x6,0xdb,0xff,0xfe,0x1,0x20,0x38,
+    0xa9,0xc0,0x31,0x8,0xdf,0x70,0x0,0x21,0xc9,0x43,0x11,0x2,0x9d,0xfe,0xef,0x2,
+    0xaa,0x38,0xa9,0x9,0x2,0xd1,0xfe,0x7,0xde,0x29,0x0,0x32,0xfa,0x38,0x98,0xa5,
+    0x1,0xd0,0x68,0xff,0x46,0x1,0x7a,0x38,0xa8,0xfb,0xf7,0x2,0xfb,0xfa,0x68,0xa5,
+    0x0,0x11,0xd1,0x8,0x2e,0xf,0xf7,0xd1,0x3,0xa8,0x7d,0x1e,0xa8,0x68,0xe,0xf0,
+    0xff,0x82,0xff,0x3,0xa8,0xc0,0x46,0xc0,0x46,0xd7,0x6a,0xb0,0x70,0x59,0x1,0x5b,
+    0x59,0x5,0x8,0xd0,0xf6,0x4f,0xb,0x7b,0xfe,0x9d,0x3,0x6,0x20,0x2,0xbd,0xdd,
+    0x6,0x6b,0x1,0x0,0xf0,0x7b,0xa1,0x1,0x2,0xbd,0xff,0x0,0x0,0xb4,0x46,0x0,
+    0x20,0xc9,0xc5,0xdf,0x1,0x0,0x80,0xb5,0x4f,0xa9,0x5,0x7,0xd0,0xaa,0x9f,0x7,
+    0x6b,0x2f,0xc,0x7,0x2f,0x4,0x63,0x2f,0x8,0x60,0xbf,0xea,0x0,0x0,0xe0,0x93,
+    0x4,0x2f,0x0,0x43,0xaa,0x2f,0x14,0x4f,0x2f,0xc,0x8,0x2f,0x4,0x4b,0x2f,0x4,
+    0x10,0xaf,0xb5,0x0,0x24,0x39,0x27,0x14,0x43,0x27,0x0,0x2,0xff,0xd0,0x8,0x24,
+    0x0,0xe0,0x7,0x24,0x20,0xff,0x0,0x10,0xbd,0xf0,0xb5,0x97,0xb0,0x4,0x7f,0x0,
+    0x30,0x4f,0x78,0x68,0x0,0x25,0x19,0x2,0xff,0xe7,0xf7,0x1,0xfe,0x7d,0x60,0x68,
+    0x46,0xff,0xe7,0xf7,0xd8,0xfd,0x20,0x68,0x0,0x90,0xff,0x6e,0x46,0x61,0x68,0xb1,
+    0x60,0x0,0x28,0xff,0x1,0xd0,0xef,0xf7,0xdb,0xfa,0x1,0x90,0xfb,0x60,0x68,0x67,
+    0x2,0x1,0x78,0x42,0x78,0x12,0xff,0x6,0x12,0xc,0x11,0x43,0x0,0xe0,0x0,0xff,
+    0x21,0xf1,0x60,0x21,0x48,0x30,0x61,0x75,0xff,0x61,0xa0,0x89,0x30,0x85,0x20,0x69,
+    0xf0,0xff,0x62,0x60,0x69,0x30,0x63,0x20,0x7e,0x34,0xff,0x21,0x70,0x54,0x28,0x20,
+    0x20,0x5c,0x58,0x7f,0x36,0x30,0x70,0xa1,0x68,0x0,0x29,0x4d,0x3,0xff,0x18,0x30,
+    0x10,0x22,0xef,0xf7,0x13,0xfe,0xeb,0xe1,0x69,0xf,0x6,0x38,0xf,0x4,0xb,0xfe,
+    0x21,0xf5,0x6a,0xf,0x6,0x48,0xf,0x4,0x3,0xfe,0x69,0x46,0x7f,0x38,0x1d,0xe7,
+    0xf7,0x9b,0xfd,0xc,0x9f,0x1,0xff,0x88,0x42,0x1,0xd1,0x1,0x20,0x4,0xe0,0xee,
+    0x83,0x0,0xd5,0x2,0x20,0x6f,0x0,0x20,0x17,0xb0,0xf5,0xf0,0x61,0x1,0x4,0xe5,
+    0x0,0x5e,0xf9,0x3,0x48,0xbf,0x1,0x49,0xc8,0x60,0x1,0xbd,0x47,0x3,0xe9,0x3b,
+    0xc6,0x1,0x1b,0x5,0x70,0xb5,0x84,0xd3,0x0,0xbd,0x2,0xff,0x60,0x68,0x1,0x90,
+    0xa0,0x68,0x2,0x90,0xff,0xfa,0x25,0xed,0x0,0x6e,0x1e,0x1,0xe0,0xff,0x2,0x95,
+    0xd,0x0,0x68,0x46,0xfe,0xf7,0xdb,0xc4,0xfb,0x5,0x2,0x2b,0xfc,0x5,0x2,0x52,
+    0xfc,0xff,0x0,0x20,0x0,0x99,0x49,0x1e,0xb1,0x42,0x7f,0x1,0xd2,0x0,0x95,0x1,
+    0x20,0x1,0xb,0x8,0xfd,0x1,0xb,0x0,0xfa,0x21,0x49,0x0,0x69,0x18,0xff,0x2,
+    0x9a,0x52,0x1e,0xb2,0x42,0xe0,0xd3,0xff,0xd,0x0,0x0,0x28,0xdf,0xd1,0xe0,0x68,
+    0xff,0x3d,0x4d,0x1,0x28,0xc,0xdb,0x1,0x9e,0xff,0x31,0x0,0xef,0xf7,0x71,0xff,
+    0xe8,0x63,0xfe,0x37,0x3,0x70,0x43,0xe0,0x60,0x2,0xe0,0xe6,0xf7,0x60,0x1,0x20,
+    0xf,0x0,0x98,0x20,0x60,0x1,0xbf,0x98,0x60,0x60,0x2,0x98,0xa0,0x49,0x1,0xfe,
+    0xeb,0xf7,0x91,0x6d,0x4,0xf8,0x5,0x4,0x1f,0xfc,0x60,0xff,0x68,0xa1,0x68,0x88,
+    0x42,0x2,0xd1,0xfe,0xff,0xf7,0xf3,0xfb,0x1,0xe0,0xfe,0xf7,0x86,0xff,0xfb,0x28,
+    0x73,0xe0,0x68,0x1,0x28,0x8,0xfd,0xdb,0x5b,0x3,0x2,0xd0,0xfe,0xf7,0xe7,0xfb,
+    0xfd,0x3,0x17,0x0,0x7a,0xfb,0x0,0xe0,0xff,0x20,0xff,0x68,0x73,0x68,0x46,0xe,
+    0xc8,0xe,0xc5,0xff,0x4,0xb0,0x70,0xbd,0x38,0xb5,0x4,0x0,0xff,0x8,0x0,0x1e,
+    0x49,0xa2,0x0,0x8d,0x18,0xff,0x28,0x61,0x8,0x7b,0xa0,0x42,0x4,0xd1,0xff,0x2,
+    0x22,0x18,0x31,0x6,0x20,0xfb,0xf7,0xff,0xbe,0xfb,0x22,0x0,0x10,0x35,0x29,0x0,
+    0xfd,0x4,0xb,0x0,0xb8,0xfb,0x31,0xbd,0x30,0xb5,0xff,0x83,0xb0,0x13,0x49,0x6a,
+    0x46,0x38,0xc9,0xef,0x38,0xc2,0xc,0x39,0x57,0x2,0x48,0x68,0x41,0xf7,0x42,0x1,
+    0x91,0x83,0x2,0xb3,0xfb,0x3,0xb0,0xff,0x30,0xbd,0x10,0xb5,0xb,0x4c,0x60,0x7b,
+    0xff,0x90,0x42,0x12,0xd1,0xe0,0x6b,0x22,0x6c,0xff,0x90,0x42,0x0,0xd2,0x20,0x64,
+    0x20,0x6c,0xff,0x40,0x1e,0x20,0x64,0x9,0xd1,0x8,0x68,0xff,0x60,0x63,0x9,0x22,
+    0x21,0x0,0x34,0x31,0xfd,0x7,0x4f,0x0,0x90,0xfb,0xe0,0x6b,0x20,0x64,0xff,0x10,
+    0xbd,0xac,0x3f,0x0,0x20,0x80,0xb5,0xfe,0x2d,0x1,0xf0,0x2,0xf8,0x0,0x20,0x2,
+    0xbd,0xff,0xf0,0xb5,0x87,0xb0,0xef,0xf3,0x10,0x80,0xff,0x0,0x90,0x72,0xb6,0xe,
+    0xf0,0x52,0xfe,0x7f,0xe,0xf0,0x18,0xff,0xe,0xf0,0x50,0x3,0x0,0xff,0xfa,0xff,
+    0xf,0xf0,0x90,0xf8,0xf,0xf0,0xff,0x94,0xf9,0xf,0xf0,0x4,0xfb,0xf,0xf0,0xff,
+    0x2e,0xfd,0xf,0xf0,0xf6,0xfd,0xc0,0x46,0xdf,0xc0,0x46,0x1,0xf0,0x60,0x13,0x0,
+    0xa,0xff,0xff,0x0,0x25,0x4d,0x4c,0x0,0x20,0x20,0x70,0xff,0x4,0x21,0xf,0xf0,
+    0x33,0xf8,0x0,0x21,0xff,0x0,0x20,0xfa,0xf7,0x11,0xfd,0x0,0x28,0xff,0x4,0xd0,
+    0x1,0x22,0xa,0x21,0x4,0x20,0xdf,0xe,0xf0,0x7b,0xfe,0x62,0x55,0x0,0x9,0xff,
+    0xff,0xa,0x27,0x2,0xe0,0x0,0x98,0x80,0xf3,0x3f,0x10,0x88,0xf,0xf0,0x9e,0xfe,
+    0xc9,0x2,0x27,0x3,0xff,0x58,0xd0,0x20,0x78,0x1,0x28,0x1e,0xd1,0xff,0x1,0x97,
+    0x1,0xa9,0x2,0xa8,0xfa,0xf7,0x7d,0x7,0x3b,0x14,0x5d,0xfe,0xf,0xf0,0x74,0x11,
+    0x0,0xd7,0x6,0xd0,0x10,0x15,0x0,0x2,0x15,0x8,0x52,0xfe,0xfd,0x2,0x71,0x0,
+    0xf,0xf0,0x53,0xff,0x4,0x21,0xcd,0x2,0xf,0x0,0xf7,0xff,0xbd,0xa,0x51,0x2,
+    0xf,0xd0,0xfb,0x65,0x60,0x67,0x6,0xe,0xf0,0xd8,0xfe,0xfa,0xff,0xf7,0x22,0xfc,
+    0x6,0x0,0xe,0xf0,0xd3,0xfe,0x49,0x0,0x63,0xfe,0x0,0x2e,0x3,0xd0,0xf5,0xed,
+    0xe7,0x1d,0xa,0xc9,0xfe,0x37,0xa,0xf,0xf0,0x49,0xba,0x91,0x0,0xaf,0x91,0x4,
+    0xac,0xd1,0xa0,0x45,0x4,0xa5,0xae,0x45,0x8,0xf,0xf0,0x1a,0x93,0x4,0x3,0x7d,
+    0x8,0x13,0xfe,0x1f,0x1,0xac,0xfe,0x9c,0xe7,0xe,0xf0,0x85,0xbe,0x21,0x1,0xa7,
+    0xfe,0x94,0xe7,0x2,0xcb,0x0,0x4,0xfe,0x21,0x0,0x70,0x47,0x1,0x20,0x9,0x49,
+    0x8,0xbd,0x70,0x7,0x2,0x7,0x49,0x88,0x60,0x7,0x2,0x5,0xfb,0x49,0x48,0x7,
+    0x0,0xbf,0xf3,0x4f,0x8f,0x4,0xdf,0x48,0x4,0x49,0x8,0x60,0x9,0x2,0xfe,0xe7,
+    0xff,0x0,0x0,0x60,0x49,0x0,0x20,0x4,0x0,0xff,0xfa,0x5,0xc,0xed,0x0,0xe0,
+    0x38,0xb5,0xff,0x58,0x4d,0x62,0xa1,0x80,0x20,0x40,0x0,0xff,0x28,0x18,0x10,0xf0,
+    0x82,0xf9,0x67,0xa1,0xfd,0xc2,0xb,0x8,0x8c,0xf9,0x6c,0xa1,0x82,0x20,0x7d,0x80,
+    0xb,0x4,0x76,0xf9,0x71,0xa1,0xa3,0xb,0x8,0xdf,0x80,0xf9,0x76,0xa1,0xc4,0xb,
+    0x8,0x8a,0xf9,0xf7,0x49,0x49,0xe5,0xb,0x8,0x64,0xf9,0x78,0xa1,0xf7,0x83,0x20,
+    0xc0,0xb,0x4,0x6e,0xf9,0x44,0x49,0xab,0x45,0x48,0x9,0x2,0x79,0x9,0x0,0xa4,
+    0x15,0x8,0x63,0xbf,0xf9,0x0,0xbf,0x77,0xa1,0x41,0x17,0x4,0x5d,0xaf,0xf9,0x40,
+    0x49,0xc5,0x17,0x8,0x77,0x17,0x0,0x79,0xfb,0xa1,0x3d,0x17,0x4,0xd9,0xf9,0x3c,
+    0x49,0x3c,0xbe,0x9,0x4,0x90,0xfa,0x3b,0x49,0xf8,0x21,0x8,0x66,0xef,0xf9,0x79,
+    0xa1,0xac,0x15,0x4,0x97,0xfa,0xab,0xfb,0x49,0xab,0x9,0x4,0x92,0xfa,0xb2,0x49,
+    0xb3,0xbe,0x9,0x4,0xe2,0xf9,0xb2,0x49,0xb2,0x9,0x4,0xdd,0xef,0xf9,0x77,0xa1,
+    0xb8,0x9,0x4,0xd8,0xf9,0xbb,0xfb,0x49,0xbb,0x9,0x4,0xd3,0xf9,0xbd,0x49,0xbe,
+    0xea,0x9,0x4,0xe0,0x7f,0x4,0xc0,0xb,0x4,0xe9,0xf9,0xbf,0xfb,0x49,0xbf,0x9,
+    0x4,0xf8,0xf9,0xbe,0x49,0xc9,0xd6,0x9,0x4,0x2,0xfa,0x1f,0x2,0xc7,0xb,0x4,
+    0xb,0xfa,0xf7,0xc6,0x49,0xc6,0x9,0x4,0x19,0xfa,0xcd,0x49,0xf5,0xd1,0x9,0x4,
+    0x23,0x1f,0x4,0x28,0x0,0x10,0xf0,0xfb,0x62,0xfa,0x11,0x0,0x60,0x2c,0x0,0x80,
+    0x34,0xd7,0xd2,0x49,0x20,0xf,0x0,0x5a,0xf,0x0,0x20,0x60,0xf7,0xd1,0x49,0xd2,
+    0x27,0x4,0x1d,0xfb,0x0,0xbf,0xf7,0x75,0xa1,0xd0,0xb,0x4,0x25,0xfb,0x31,0xbd,
+    0xff,0x7c,0x0,0x0,0x20,0xa8,0x34,0x3,0x0,0x7d,0xc8,0x3,0x0,0x9c,0x4,0x0,
+    0x0,0xe8,0x7,0x0,0xff,0xa4,0x5,0x0,0x0,0x8,0x35,0x3,0x0,0xdf,0xb4,0x6,
+    0x0,0x0,0x28,0x7,0x0,0x34,0x7,0xf7,0x0,0x0,0x48,0x7,0x0,0x14,0x1,0x1,
+    0xe3,0x2d,0x0,0x0,0x8,0x1f,0x1,0x7,0x6,0x1,0x1,0x0,0x0,0x2,0xbd,0x88,
+    0x37,0x0,0x1,0x1,0x2,0xe3,0xd,0x2,0x8,0xe3,0x0,0x10,0x1f,0xc,0x0,0xa,
+    0x1f,0x2,0x16,0x1,0x8,0xba,0x3f,0x16,0x2,0x3f,0x0,0x2,0x1,0x2,0x7,0x2,
+    0x8a,0xde,0x1f,0x0,0x3,0x1,0x9,0xe3,0xa,0x0,0x0,0x4,0xf0,0x3f,0xa,0xc,
+    0x2,0x1d,0x2,0x1f,0x8,0xf,0x1,0xa,0xe3,0xde,0x6e,0x2,0x4,0x4,0x10,0x10,
+    0x1f,0x22,0x2,0x1,0x5b,0x6,0xe3,0xc2,0x0,0x0,0x9,0x3f,0x2,0x3,0x9c,0x4,
+    0xf4,0xa0,0x6,0x7,0x0,0x9c,0x1f,0x0,0x6,0x1,0x4,0xe3,0xc5,0x8,0x9f,0x8,
+    0x17,0x1f,0xa,0x0,0x8,0x1f,0x2,0x13,0x1,0x85,0x17,0x9f,0xc,0x10,0x1f,0x2,
+    0x8b,0x4,0x24,0x6,0x1f,0x2,0xa,0xb,0x1,0xe,0x1f,0x4,0x14,0xbf,0xa,0x23,
+    0x2,0xb6,0x0,0x7,0x2,0x1d,0x8c,0x1f,0x0,0xe,0x1,0x12,0x1f,0x4,0x2e,0x1,
+    0x1f,0x6,0xd8,0x47,0x1,0x3,0x0,0x1,0x2,0x0,0x92,0x1f,0x0,0x19,0x1,0xb9,
+    0x18,0x5f,0xe,0x3f,0x21,0x1b,0x1,0x1a,0x1f,0x34,0x10,0xeb,0x1,0x13,0x1f,0x1c,
+    0x7f,0x1f,0x10,0x1e,0x1,0x1c,0xa8,0x1f,0xe,0x1b,0x3,0x0,0x0,0x64,0x1f,0x8,
+    0xa4,0x1f,0x0,0x80,0xff,0xb5,0xb8,0x48,0x0,0xf0,0x7e,0xf9,0x1,0xaf,0xbd,0x0,
+    0x0,0x4c,0x8,0x1,0x68,0xd3,0x1,0xcc,0xfe,0x7,0x0,0x1,0x78,0x21,0x29,0x0,
+    0xdb,0x70,0xff,0x47,0x80,0xb5,0xb7,0x4a,0x89,0x0,0x52,0xbf,0x58,0x0,0x2a,0x3,
+    0xd0,0x1,0x23,0x1,0x10,0xeb,0xf0,0x6a,0x2b,0x4,0x88,0x27,0x0,0x4c,0x9,0x0,
+    0xf3,0x0,0xa8,0x2f,0x2,0x7,0x0,0x80,0xb5,0x21,0x28,0xff,0x7,0xda,0xac,0x49,
+    0x80,0x0,0x8,0x58,0xff,0x0,0x28,0x2,0xd0,0xc,0x30,0xc0,0x46,0xef,0x2,0xbd,
+    0x0,0x20,0x3,0x0,0x0,0x4c,0xa,0xee,0x1f,0x2,0x1,0x0,0x9d,0x69,0x0,0x6c,
+    0xf9,0x40,0xa5,0x7a,0x13,0x2,0xc8,0x37,0x2,0x17,0x8,0x97,0x17,0x0,0xa3,0xaa,
+    0x55,0x0,0xe8,0x53,0x2,0xb,0x13,0x2,0xa,0xa1,0x0,0x92,0xd6,0x15,0x0,0x50,
+    0xfa,0x6b,0x2,0xcc,0x13,0x0,0x8,0x36,0xde,0x1b,0x0,0xc,0x0,0x0,0x28,0x7,
+    0x0,0x10,0xb5,0xff,0xab,0x4c,0xe5,0x20,0x80,0x0,0x20,0x18,0xff,0x80,0x68,0xc0,
+    0x46,0x0,0x28,0x7,0xd1,0xf7,0x80,0x20,0x40,0xd,0xc,0x0,0xd1,0xec,0xe2,0xe7,
+    0x1,0x20,0x10,0x37,0x2,0x2f,0x0,0x4c,0xd,0x0,0xeb,0x0,0x48,0x33,0x0,0xcc,
+    0x7,0x0,0x70,0xb5,0x6,0xff,0x0,0xe8,0xe2,0x38,0xb5,0xf8,0xe2,0x82,0xb6,0xa7,
+    0x8,0x0,0xd1,0xe1,0x2,0xc0,0x6b,0xab,0x4,0x0,0xe9,0xa8,0x27,0x0,0x8f,0x2,
+    0x73,0x79,0x0,0xff,0xfa,0x2,0xb7,0xbd,0x4c,0xe,0x8b,0x2,0x13,0x0,0x8d,0x2,
+    0x6e,0xfa,0x13,0x0,0x1d,0xa3,0x0,0x78,0x4b,0x3,0x0,0x72,0xae,0x3d,0x4,0x43,
+    0xe1,0x68,0x2f,0x0,0x8c,0xf,0x0,0x88,0xfc,0x5f,0x2,0x2b,0x0,0x4c,0xf,0x0,
+    0x0,0x38,0xb5,0xff,0x4,0x0,0xc0,0x20,0x20,0x5c,0x0,0x28,0xff,0x11,0xd1,0x20,
+    0x79,0x0,0x28,0x3,0xd0,0xff,0x2,0x28,0x4,0xd0,0x6,0xd3,0x31,0xbd,0xbf,0x21,
+    0x0,0x88,0x48,0x4,0xe0,0x5,0x2,0x1,0xfe,0x5,0x0,0x87,0x48,0x10,0xf0,0x85,
+    0xf9,0x31,0xff,0xbd,0x1,0x28,0x42,0xd1,0x77,0x4d,0x21,0xfb,0x0,0xc2,0xc1,0x0,
+    0x28,0x18,0x10,0xf0,0xfd,0xbf,0xf9,0x21,0x0,0x83,0x20,0xc0,0xb,0x4,0xf7,0xd2,
+    0xb,0x0,0xa3,0xe7,0x0,0xb,0x2,0xf1,0xb,0x0,0x7b,0x48,0xbe,0x9,0x2,0x95,
+    0xfa,0x21,0x0,0xc4,0x15,0x8,0x8f,0xaa,0xb,0x0,0xa4,0x2d,0x8,0xe0,0x21,0x0,
+    0x74,0x21,0x4,0xdb,0xfa,0x9,0x0,0xc5,0x15,0x8,0x34,0xfb,0x21,0x0,0xf8,0xea,
+    0xb,0x8,0x2e,0xb,0x0,0x6c,0x21,0x4,0xc0,0xfb,0x20,0xff,0x78,0x0,0x6,0x2a,
+    0xd5,0x21,0x0,0x69,0xfe,0xf,0x0,0xf,0xf0,0x85,0xff,0x31,0xbd,0x2,0xff,0x28,
+    0x22,0xd1,0x60,0x7a,0x0,0x28,0x6,0xfa,0xb1,0x0,0xc,0xb1,0x0,0x4,0x28,0xf,
+    0xd0,0xb,0x6a,0xb7,0x4,0x61,0xb1,0x4,0x61,0xb1,0x0,0x1b,0xfc,0xf,0x2,0xf7,
+    0x5f,0x48,0xb,0xf,0x0,0x5f,0x48,0x8,0xe0,0x75,0x49,0xb9,0x0,0x5e,0x41,0x8,
+    0x21,0x0,0xaf,0x9,0x4,0xfd,0x80,0x4b,0x0,0x10,0xb5,0x84,0xb0,0x42,0x4c,0xdf,
+    0x1,0x0,0x58,0x48,0x20,0x11,0x0,0x89,0xff,0xff,0x68,0x46,0x10,0x21,0xef,0xf7,
+    0x6d,0xf9,0x7f,0x12,0x20,0x69,0x46,0x8,0x70,0xa6,0x15,0x0,0xff,0x0,0xf0,0x5a,
+    0xf8,0x4,0xb0,0x10,0xbd,0x7a,0x6f,0x3,0xa3,0x59,0x0,0x47,0xfc,0x1,0xbd,0x3b,
+    0x3,0xfd,0x34,0x51,0x0,0x28,0x0,0x80,0x30,0x10,0xf0,0x5f,0x93,0xfc,0x21,0x0,
+    0x9e,0xad,0x4,0xd0,0x75,0x0,0xfe,0x27,0x2,0x9b,0x48,0xf,0xf0,0x72,0xff,0x1,
+    0xaa,0xb,0x4,0x99,0xb,0x0,0x80,0xb,0x8,0x97,0xb,0x0,0x89,0xaa,0xb,0x8,
+    0x95,0xb,0x0,0x92,0xb,0x8,0x93,0xb,0x0,0x9f,0x5e,0xb,0x0,0x60,0x10,0x0,
+    0x20,0xf,0x2,0x90,0x67,0x0,0xa9,0xfd,0x67,0x0,0xb,0x2,0x8e,0x1b,0x0,0xb5,
+    0x1b,0x0,0xc8,0xde,0xbb,0x1,0x30,0xb5,0x85,0xb0,0xa1,0x6,0x1c,0xf9,0xff,0x0,
+    0x24,0x89,0x4d,0x68,0x46,0x4,0x70,0xff,0x28,0x68,0x0,0x28,0x2,0xd0,0x69,0x46,
+    0xff,0xf,0xf0,0xf2,0xff,0x64,0x1c,0x2d,0x1d,0xff,0x20,0x2c,0xf3,0xdb,0x5,0xb0,
+    0x30,0xbd,0xff,0x8,0x78,0x21,0x28,0x0,0xdb,0x70,0x47,0xff,0x80,0xb5,0x7f,0x4a,
+    0x80,0x0,0x10,0x58,0x7f,0x0,0x28,0x1,0xd0,0xf,0xf0,0xe0,0x71,0x4,0xff,0x21,
+    0x29,0x4,0xda,0x79,0x48,0x89,0x0,0xfd,0x40,0x15,0x2,0xd1,0x0,0x20,0x2,0xbd,
+    0xc,0xff,0x30,0xc0,0x46,0x2,0xbd,0x7c,0x0,0x0,0xfb,0x20,0x73,0x17,0x8,0x2,
+    0xd1,0x90,0x71,0x98,0xff,0x71,0x70,0x47,0x1,0x6c,0x91,0x60,0x81,0xff,0x6c,0xd1,
+    0x60,0x1,0x21,0x91,0x71,0x42,0xff,0x6c,0x9a,0x60,0xc0,0x6c,0xd8,0x60,0x99,0xfe,
+    0x17,0x0,0x7c,0x1,0x0,0x20,0x84,0x2,0x0,0xff,0x20,0x10,0x4,0x0,0x20,0x9c,
+    0x4,0x0,0xff,0x0,0xa4,0x5,0x0,0x0,0x34,0x7,0x0,0xff,0x0,0xb4,0x6,0x0,
+    0x0,0xc8,0x8,0x0,0xbf,0x20,0x48,0x9,0x0,0x20,0xc8,0x3,0x0,0x48,0xff,0xa,
+    0x0,0x20,0x4c,0xa,0x0,0x0,0x4c,0xff,0xb,0x0,0x0,0x0,0x21,0x1,0x64,0x41,
+    0xff,0x64,0x81,0x64,0xc1,0x64,0x70,0x47,0x70,0xbf,0xb5,0xc,0x0,0x4f,0x4d,0x59,
+    0x37,0x1,0x80,0xff,0x68,0xc0,0x46,0xa0,0x60,0xc4,0x20,0x80,0x7c,0xfb,0x1,0xb,
+    0x2,0x20,0x61,0xc2,0x20,0x40,0xb,0xa,0xef,0x60,0x83,0x20,0xc0,0xb,0x8,0x60,
+    0x60,0xa3,0xee,0x23,0xc,0xe0,0x60,0xa4,0x17,0xc,0xa0,0x61,0x9f,0x66,0x45,0x8,
+    0x60,0x61,0x87,0x3,0x37,0x4,0x62,0xc5,0x1f,0xc,0xb7,0xe0,0x61,0xf8,0x43,0xe,
+    0x62,0x96,0x21,0x8,0xe0,0xdb,0x62,0x95,0x7b,0xa,0x63,0x93,0x35,0xa,0x63,0x9d,
+    0xb6,0x1d,0xa,0x63,0x9b,0x53,0xa,0x63,0x9a,0x27,0xa,0x62,0xb6,0x5d,0xa,0xa0,
+    0x66,0x27,0xa,0x60,0x64,0x27,0xa,0xe0,0xdd,0x64,0x27,0xa,0x20,0x65,0x98,0x1d,
+    0xa,0x65,0x97,0x76,0x31,0xa,0x65,0xa1,0x27,0xa,0x66,0x28,0x0,0x25,0x4,0x75,
+    0x64,0x7,0x0,0x30,0x9,0x2,0x6,0x0,0xe,0x1b,0x8,0xff,0x0,0x28,0x3,0xd0,
+    0x0,0x2e,0x1,0xd0,0xff,0x86,0x42,0x0,0xe0,0xb0,0x42,0x0,0xd3,0xdf,0x6,0x0,
+    0x66,0x66,0x94,0x1b,0x2,0x6a,0xc0,0xff,0x68,0x20,0x66,0x0,0x20,0xa0,0x64,0x70,
+    0xed,0xbd,0x45,0x1,0x0,0xcc,0x4f,0x1,0xe4,0xf,0x0,0xfd,0x0,0xaf,0x3,0xcc,
+    0xe,0x0,0x0,0x48,0xc,0xcc,0x6b,0x1,0x3,0x0,0x48,0xd,0x7,0x0,0x3,0x0,
+    0x48,0xe,0x72,0x7,0x0,0xf,0x3,0x0,0x7,0x2,0x36,0x3,0x0,0x9f,0x3,0xfe,
+    0x6f,0x3,0x16,0x0,0x82,0x4d,0x31,0x68,0x80,0x7e,0x5d,0x5,0xf,0xf0,0xff,0xfe,
+    0x21,0x68,0x69,0x7,0x7f,0xf,0xf0,0xf9,0xfe,0x71,0x68,0xe5,0x5d,0x5,0xbf,0xf,
+    0xf0,0xf3,0xfe,0x61,0x68,0x75,0x7,0xf,0xbf,0xf0,0xed,0xfe,0xa1,0x68,0x76,0x81,
+    0x0,0xf,0xbf,0xf0,0xe8,0xfe,0xb1,0x68,0x82,0x21,0x8,0xe2,0xf7,0xfe,0xe1,0x68,
+    0x8b,0x7,0xf,0xf0,0xdc,0xfe,0xfb,0x21,0x69,0xbb,0x7,0xf,0xf0,0xd6,0xfe,0xa1,
+    0xfd,0x69,0x97,0x7,0xf,0xf0,0xd0,0xfe,0x61,0x69,0xbd,0x39,0x39,0x4,0xcb,0xfe,
+    0xe1,0x69,0x8d,0x7,0xf,0xbf,0xf0,0xc5,0xfe,0xa1,0x6a,0x46,0x15,0x4,0xc0,0xef,
+    0xfe,0x21,0x6a,0x32,0x9,0x4,0xbb,0xfe,0x61,0xfd,0x6a,0xa1,0x7,0xf,0xf0,0xb5,
+    0xfe,0xa1,0x6e,0xbd,0x45,0x15,0x4,0xb0,0xfe,0x61,0x6e,0x21,0x3,0xf,0xeb,0xf0,
+    0xab,0x9,0x0,0x56,0x13,0x4,0xa6,0xfe,0x21,0xff,0x6c,0x28,0x0,0xf,0xf0,0xa2,
+    0xfe,0x61,0xfb,0x6c,0x3c,0x11,0x4,0x9d,0xfe,0xe1,0x6c,0x3b,0xde,0x9,0x4,0x98,
+    0xfe,0x21,0x6d,0x6f,0x6,0x93,0xfe,0xf7,0x61,0x6d,0x38,0x9,0x4,0x8e,0xfe,0xa1,
+    0x6d,0x7d,0x36,0x9,0x4,0x89,0xfe,0xe1,0x6e,0x41,0x9,0x4,0xff,0x84,0xfe,0x40,
+    0x48,0x2e,0x18,0xe1,0x6d,0xfd,0x30,0x47,0x0,0x7e,0xfe,0x21,0x6e,0x30,0x0,0x7f,
+    0x10,0xf0,0xed,0xfb,0xe1,0x6a,0x10,0x1d,0x4,0xef,0x75,0xfe,0x21,0x6b,0x9,0x6,
+    0x70,0xfe,0x61,0xab,0x6b,0x1a,0x9,0x4,0x6b,0x9,0x0,0x37,0x9,0x4,0x66,0xef,
+    0xfe,0xa1,0x6b,0x7,0x9,0x4,0x61,0xfe,0xe1,0xfb,0x6b,0x12,0x9,0x4,0x5c,0xfe,
+    0x70,0xbd,0xa4,0xff,0x5,0x0,0x0,0x34,0x7,0x0,0x0,0x4c,0x79,0x8,0x9b,0x1,
+    0x3,0x0,0x4c,0x9,0x0,0x0,0x2b,0x3,0xfd,0x20,0xd5,0x5,0x40,0x1e,0x80,0x41,
+    0xc0,0x43,0xff,0xc0,0xf,0x10,0xbd,0x26,0x4c,0x21,0x25,0x7f,0x20,0x68,0x0,0x28,
+    0x2,0xd0,0x31,0x7d,0x0,0xff,0x5f,0xfe,0x24,0x1d,0x6d,0x1e,0xf6,0xd1,0xd7,0x70,
+    0xbd,0xcc,0x2f,0x0,0x4c,0xd3,0x1,0xb4,0x6,0xf7,0x0,0x0,0x1d,0x23,0x8,0x1,
+    0xd0,0x41,0x68,0xbb,0x81,0x60,0x21,0x2,0xf7,0xd1,0x31,0xf5,0x1,0x4c,0x99,0xb,
+    0x5b,0x0,0x3,0x0,0x4c,0xc,0x7,0x0,0x3,0x0,0x4c,0xf9,0xd,0x7,0x0,0x3,
+    0x0,0xf8,0xb5,0xf,0x0,0x0,0xbf,0x24,0x10,0x4d,0x2e,0x0,0x30,0x35,0x0,0x8,
+    0xff,0xd0,0x0,0x6b,0x40,0x88,0xb8,0x42,0x4,0xff,0xd1,0xa0,0x0,0x28,0x58,0x0,
+    0x6b,0xc0,0xff,0x46,0xf2,0xbd,0x64,0x1c,0xe4,0xb2,0x36,0xff,0x1d,0x21,0x2c,0xee,
+    0xdb,0x0,0x20,0xf2,0xe7,0xbd,0x4c,0xe,0x3b,0x0,0x32,0x0,0x7c,0x0,0x0,0xa7,
+    0x20,0x9c,0x4,0x43,0x0,0xf,0x0,0xcc,0x7b,0x0,0xc8,0xff,0x36,0x3,0x0,0x80,
+    0xb5,0xa,0x0,0x1,0xff,0x0,0x2,0x20,0xe,0xf0,0x7c,0xf8,0x1,0xfe,0x73,0x0,
+    0x10,0xb5,0x4,0x0,0xa0,0x79,0xc0,0xff,0x1e,0x7,0x28,0x0,0xd9,0x97,0xe0,0x2,
+    0xff,0xa1,0x9,0x5c,0x49,0x0,0x8f,0x44,0x0,0xff,0xbf,0x4,0xa,0x38,0x6b,0x71,
+    0x81,0x87,0xff,0x8d,0xa2,0x88,0x21,0x68,0x3,0x20,0xfd,0x5f,0xf7,0xa5,0xfc,0x10,
+    0xbd,0xb,0x2,0x4,0xb,0x0,0xfb,0xf6,0xfc,0x9,0x2,0xa0,0x79,0xfd,0xf7,0x5b,
+    0x55,0xfd,0x9,0xa,0x7c,0x9,0xc,0xa3,0x9,0xc,0xbc,0x9,0xc,0xd5,0xcc,0x9,
+    0xc,0xda,0x9,0xc,0xea,0x9,0xc,0x8,0xfd,0xaa,0x5b,0x6,0x5,0x5b,0x0,0xc3,
+    0x5b,0xc,0x28,0x1f,0xc,0x49,0xaa,0x9,0xc,0x70,0x9,0xc,0x89,0x9,0xc,0x99,
+    0x9,0xc,0xa7,0x7a,0x9,0xc,0xb7,0x9,0x8,0xfa,0xf7,0xcb,0xfa,0x13,0xa,0xd5,
+    0xca,0xc1,0x8,0x6,0x65,0x0,0x2a,0x71,0x8,0x7,0x20,0xef,0xff,0xf7,0x3b,0xf9,
+    0x21,0x6,0xfe,0xf7,0x47,0xed,0xff,0x35,0xa,0xb8,0xfa,0x1f,0x6,0x8,0x20,0xfa,
+    0xfb,0xf7,0x93,0xb,0x8,0x9,0x20,0xd,0xf0,0x9f,0xd5,0xfe,0xb,0x6,0xa,0x43,
+    0x0,0x51,0x4f,0x0,0x4,0x21,0x7d,0x4,0x41,0x0,0x55,0xff,0x10,0xbd,0x1c,0x47,
+    0x1,0xff,0x0,0x20,0x1,0x90,0x6a,0x46,0x10,0x70,0xff,0x1,0xa8,0x10,0xf0,0xc3,
+    0xfa,0x1,0x98,0xff,0x40,0x0,0x6a,0x46,0x0,0x21,0x51,0x56,0xff,0xf0,0xf7,0x13,
+    0xfe,0x40,0x10,0x20,0x60,0xdf,0x20,0x0,0x16,0xbd,0x88,0xb7,0x1,0x0,0x21,0xff,
+    0x38,0x30,0x1,0x70,0x1,0x20,0x70,0x47,0xfd,0x0,0x3,0x2,0x21,0x3,0x22,0x1,
+    0x60,0x0,0xff,0x1d,0x52,0x1e,0xfb,0xd1,0x70,0x47,0xf2,0xfb,0xb5,0x6,0xeb,0x1,
+    0x35,0x0,0xa,0x4f,0x0,0xff,0x98,0x2,0x68,0x0,0x2a,0x1,0xd1,0x2f,0xff,0x60,
+    0x8,0xe0,0x28,0x68,0xc1,0x17,0x9,0xff,0x5,0x3,0xb,0x19,0x43,0x0,0x5,0xef,
+    0xff,0xf7,0xf7,0xfe,0x28,0x60,0x64,0x1c,0x2d,0xff,0x1d,0x3,0x2c,0xec,0xdb,0x30,
+    0x0,0xf2,0xff,0xbd,0xff,0xff,0xff,0x7f,0x10,0xb4,0x0,0xff,0x22,0x3,0x0,0xc,
+    0x68,0xa4,0x3,0x1c,0xff,0x60,0x52,0x1c,0x9,0x1d,0x1b,0x1d,0x3,0x7f,0x2a,0xf7,
+    0xdb,0x10,0xbc,0x70,0x47,0x71,0x6,0xbd,0x88,0x71,0x14,0x1,0x60,0x41,0x60,0x7,
+    0x2,0x8,0xa9,0x30,0x7b,0x12,0xc3,0x1a,0xdd,0xc3,0x0,0xc0,0xc3,0xc,0x7c,0xeb,
+    0xfd,0xc0,0xc3,0x8,0xf8,0x27,0x0,0x8,0x0,0x85,0xff,0x18,0xc1,0x17,0x89,0x7,
+    0x82,0x8,0x11,0xff,0x43,0x80,0x7,0x0,0x2d,0x1,0xd1,0xe,0xff,0x48,0x10,0xe0,
+    0xce,0x17,0xcf,0x17,0xea,0xff,0x17,0x13,0x0,0x6b,0x40,0x9a,0x1a,0x70,0xff,0x40,
+    0x79,0x40,0x3b,0x0,0x80,0x1b,0x99,0xff,0x41,0xef,0xf7,0xa8,0xfe,0xe9,0x17,0x71,
+    0xff,0x40,0x48,0x40,0x40,0x1a,0x20,0x60,0x21,0xff,0x68,0x48,0x42,0x60,0x60,0x24,
+    0x1d,0x80,0xff,0x21,0xc9,0x5,0x40,0x18,0x20,0x60,0xf1,0xfe,0xbf,0x4,0xf2,0xb5,
+    0x82,0xb0,0x7,0x0,0xc,0xff,0x46,0x3e,0x0,0x8,0x36,0x3,0x25,0x20,0xfe,0xef,
+    0x0,0x7a,0x68,0xd3,0x17,0xef,0xf7,0x59,0xbf,0xf9,0x0,0x90,0x1,0x91,0x30,0xf,
+    0x0,0x3a,0xfe,0xf,0x4,0x51,0xf9,0x0,0x9a,0x1,0x9b,0x80,0xff,0x18,0x59,0x41,
+    0x80,0xf,0x8a,0x0,0x10,0xff,0x43,0x30,0x60,0x36,0x1d,0x24,0x1d,0x6d,0xff,0x1e,
+    0xe5,0xd1,0x2,0x98,0x8,0x37,0xe,0x3f,0xcf,0xe,0xc0,0x3,0xb0,0xf0,0xa1,0x0,
+    0x4b,0x0,0xff,0x0,0x38,0x68,0x40,0x10,0x21,0x68,0x4d,0xf7,0x10,0xc1,0x17,0x79,
+    0x2,0xf0,0xf7,0x91,0xfc,0xff,0x6,0x0,0xe8,0x17,0x45,0x40,0x28,0x1a,0xff,0x9,
+    0x25,0xf0,0xf7,0x8a,0xfc,0x28,0x1a,0xff,0xa9,0x1b,0x88,0x42,0x0,0xda,0x8,0x0,
+    0xdf,0x7,0x21,0xe,0x1a,0x31,0x2f,0x0,0xee,0xf7,0x7f,0x0,0xfa,0x5,0x0,0x31,
+    0x0,0x20,0x9,0x0,0xbf,0xfb,0xf9,0x1,0x0,0x28,0x0,0xf7,0x2,0xf2,0xc2,0xb5,
+    0x9,0x70,0x43,0x13,0x91,0x0,0x55,0x2,0x9,0x2,0x9,0x68,0xbf,0x4a,0x11,0x90,
+    0x42,0x1,0xda,0x1b,0x2,0x82,0xfc,0x7,0x0,0x1f,0x2,0xc8,0x6,0xc0,0xe,0x40,
+    0x1e,0xff,0x80,0x41,0xc0,0x43,0xc0,0xf,0x70,0x47,0xff,0x12,0x68,0x93,0x14,0x92,
+    0x3,0x0,0xd5,0x7f,0x5b,0x1c,0x9,0x68,0xc9,0x18,0x1,0x7b,0x1,0xd5,0xf1,0xef,
+    0x0,0x8,0x43,0x0,0x12,0xd5,0x4,0xe6,0xf8,0xff,0x4,0x0,0xd,0x0,0x22,0xe,
+    0x28,0x2,0xff,0x2,0x43,0x2b,0x16,0x1d,0xa0,0x3,0xc8,0xff,0x8b,0x42,0x2,0xdc,
+    0x31,0xdb,0x82,0x42,0xff,0x2f,0xd3,0x0,0x27,0xbb,0x42,0xb,0xdc,0xfd,0x1,0xb,
+    0x0,0x8,0xd2,0xc6,0x43,0xbb,0x42,0xff,0x7,0xdb,0x1,0xdc,0xb2,0x42,0x4,0xd3,
+    0xff,0x8,0xa,0x20,0x40,0x1,0xd0,0x48,0x8,0xff,0x1e,0xe0,0x68,0x46,0xc,0xc0,
+    0x80,0x20,0xff,0x0,0x4,0x20,0x40,0x5,0xd0,0x6e,0x46,0xff,0x68,0x46,0x3,0xc8,
+    0x40,0x1c,0x79,0x41,0xfb,0x3,0xc6,0x9,0x2,0x0,0x29,0x1,0xd1,0x0,0xf7,0x28,
+    0xc,0xd0,0x7,0x0,0xdb,0x1,0x26,0x0,0x77,0xe0,0x0,0x26,0xab,0x1,0xdb,0x1,
+    0x24,0x9,0x0,0xff,0x24,0xa6,0x42,0x0,0xd0,0x10,0x0,0x2,0xdf,0x99,0x8,0x60,
+    0x2,0x98,0x35,0x3,0x0,0x0,0xfb,0x0,0x80,0x8b,0x1,0xff,0xf9,0xb4,0x82,0xb0,
+    0xff,0xc,0xc9,0xd4,0x9,0x58,0x6,0x4,0x43,0xd7,0xdd,0x11,0x1e,0x8d,0x0,0x8d,
+    0x8d,0x0,0x30,0xdb,0x57,0x84,0x42,0x2e,0x8d,0x0,0xbd,0x8d,0x4,0x84,0x8d,0x4,
+    0x75,0xbd,0x8d,0x4,0xb4,0x8d,0x0,0x7f,0x20,0x10,0x8d,0x4,0x9d,0x1d,0x8d,0x0,
+    0x30,0xc0,0x40,0xd,0x0,0x8b,0x44,0x2b,0x5a,0x9,0x0,0x22,0x9,0x0,0x22,0x96,
+    0x8b,0x0,0x20,0x8b,0x8,0x2f,0x4,0xb0,0xf0,0xbc,0x57,0x1,0xbf,0x8f,0xa,0x2b,
+    0x17,0xfd,0x50,0x2b,0x5,0xe2,0xe,0x68,0x1,0x2,0x43,0xad,0xeb,0x2b,0x49,0x48,
+    0x9,0x2b,0x17,0xc0,0x2b,0x8d,0x9,0xbf,0x68,0x0,0x68,0x82,0x13,0x91,0xfd,0x9,
+    0x8a,0xde,0xfd,0x9,0x80,0x4,0x80,0xc,0xfd,0xf,0x88,0x42,0xff,0x4,0xd1,0x0,
+    0x21,0x80,0x30,0x1,0x70,0xe8,0x23,0x2,0x1f,0x2,0x11,0x6,0xf0,0x11,0x10,0x0,
+    0x21,0x3,0xff,0x22,0x1,0x60,0x0,0x1d,0x52,0x1e,0xfb,0xff,0xd1,0x70,0x47,0x30,
+    0xb4,0x3,0x0,0x3,0xff,0x24,0xd,0x68,0x1d,0x60,0x9,0x1d,0x1b,0xef,0x1d,0x64,
+    0x1e,0xf9,0x2d,0x0,0x3,0x68,0x14,0xff,0x68,0x1b,0x1b,0x3,0x60,0x49,0x1c,0x12,
+    0xff,0x1d,0x0,0x1d,0x3,0x29,0xf6,0xdb,0x30,0xfe,0x25,0x1,0xf0,0xb5,0x83,0xb0,
+    0x0,0x21,0x1,0xfd,0x91,0xab,0x0,0x27,0x4,0x0,0x3,0x25,0x20,0xff,0x68,0x40,
+    0x10,0xc1,0x17,0x2,0x0,0xb,0xff,0x0,0xee,0xf7,0xbb,0xff,0x80,0x19,0x79,0xff,
+    0x41,0x6,0x0,0xf,0x0,0x24,0x1d,0x6d,0xff,0x1e,0xf1,0xd1,0x2,0x20,0x0,0x90,
+    0x32,0xff,0x0,0x3b,0x0,0x1,0xa8,0xf6,0xf7,0xb5,0xfb,0xfe,0x1,0xc7,0x4,0x10,
+    0xb4,0x0,0x22,0x3,0xff,0x0,0xc,0x68,0xa4,0x1,0x1c,0x60,0x52,0x7d,0x1c,0x6d,
+    0x2,0x3,0x2a,0xf7,0xdb,0x10,0x59,0x0,0xff,0xfc,0xb5,0x5,0x0,0xe,0x0,0x14,
+    0x0,0x5f,0xb0,0x68,0x47,0x42,0x70,0x7d,0x1,0xa2,0x7d,0x1,0xff,0xee,0xf7,0x91,
+    0xff,0x0,0x90,0x1,0x91,0xdf,0x38,0x0,0xc1,0x17,0x62,0xf,0x4,0x89,0xff,0xff,
+    0x0,0x9a,0x1,0x9b,0x80,0x18,0x59,0x41,0xff,0x80,0xf,0x8a,0x0,0x10,0x43,0x28,
+    0x60,0x55,0x30,0x2f,0x0,0xb0,0x2f,0x0,0x22,0x1f,0x4,0x79,0x2f,0xc,0xfa,0x3f,
+    0x6,0x71,0x2f,0x18,0x68,0x60,0x71,0x68,0x48,0xcf,0x42,0x0,0x90,0x30,0x31,0x0,
+    0x51,0x6,0x60,0xff,0x96,0xb1,0x2,0x0,0x98,0x41,0xa,0x58,0xc5,0x4,0x2d,0x6,
+    0xa8,0xfb,0x60,0xf3,0x79,0x1,0x10,0xb4,0x55,0x48,0x1,0xff,0x68,0x8,0x22,0xa,
+    0x43,0x2,0x60,0x53,0xff,0x49,0x54,0x4a,0x11,0x80,0x54,0x49,0x1,0xff,0x22,0xa,
+    0x60,0xc3,0xb,0xc,0x68,0x14,0xff,0x40,0xfc,0xd1,0xc,0x8a,0x1c,0x42,0xf9,0xff,
+    0xd1,0x50,0x4a,0xa,0x60,0x42,0xb,0x4a,0xff,0x60,0x0,0x22,0x8a,0x72,0xb,0x68,
+    0xc0,0xff,0x24,0xa4,0x5,0x1c,0x43,0xc,0x60,0x4b,0xf7,0x49,0xa,0x70,0x3b,0x2,
+    0x91,0x43,0x1,0x60,0xfe,0xe5,0x2,0x70,0xb5,0x82,0xb0,0x6,0x0,0x46,0xff,0x4c,
+    0x20,0x78,0x0,0x28,0x4,0xd0,0x1,0xff,0x22,0x7,0x21,0x4,0x20,0xd,0xf0,0xee,
+    0xff,0xfc,0xf0,0x7b,0x60,0x60,0x70,0x68,0xa0,0xff,0x60,0xb0,0x68,0xe0,0x60,0x1,
+    0x20,0x20,0xff,0x70,0x30,0x7b,0x60,0x70,0x26,0x61,0x0,0xef,0x25,0x75,0x74,0x36,
+    0x7b,0xc,0x2,0x21,0x0,0xfe,0x2b,0x0,0x94,0xfe,0x30,0x7b,0x10,0xf0,0xfa,0xff,
+    0xf8,0x0,0x28,0x6,0xd0,0x3,0x20,0x70,0xff,0x74,0x25,0x70,0x30,0x0,0xf9,0xf7,
+    0x6f,0xff,0xfe,0x73,0xbd,0x2e,0x48,0x1,0x8b,0x6a,0xff,0x46,0x11,0x70,0x80,0x21,
+    0x49,0x0,0x2e,0xff,0x4a,0x11,0x60,0x4,0x22,0x42,0x73,0xca,0xff,0x1,0x3,0x8a,
+    0x13,0x42,0xfc,0xd1,0x3,0x7f,0x68,0x2,0x25,0x1d,0x43,0x5,0x60,0xd,0x6,0xff,
+    0xa2,0x68,0x13,0x78,0x3,0x83,0x52,0x1c,0xff,0xa2,0x60,0x25,0x48,0x1,0x60,0x73,
+    0xbd,0xff,0x38,0xb5,0x1f,0x4c,0xa1,0x7b,0x4,0x20,0xff,0x1,0x42,0x32,0xd0,0x1f,
+    0x4d,0xe9,0x68,0xff,0x0,0x29,0x4,0xd0,0x22,0x8b,0xa,0x70,0x7f,0x49,0x1c,0xe9,
+    0x60,0x2,0xe0,0x21,0x55,0x4,0xff,0x69,0x68,0x49,0x1e,0x69,0x60,0x1d,0xd1,0xff,
+    0x20,0x73,0x68,0x78,0x10,0xf0,0xca,0xf8,0xff,0x20,0x68,0x2,0x21,0x88,0x43,0x20,
+    0x60,0xdf,0x88,0x3,0x21,0x8a,0x1,0x53,0x0,0xc0,0x9,0xff,0x13,0x49,0x8,0x60,
+    0x28,0x69,0xf9,0xf7,0xff,0x29,0xfe,0x0,0x20,0x28,0x70,0x2,0x21,0x9d,0x2,0xad,
+    0x0,0x3d,0xfe,0x6,0xbf,0x4,0xff,0x2,0x31,0xff,0xbd,0xa8,0x68,0x1,0x78,0x21,
+    0x83,0x40,0xfb,0x1c,0xa8,0xb,0x0,0x0,0x0,0x20,0x4,0x0,0xff,0x40,0xe,0x41,
+    0x0,0x0,0x2,0xc,0x0,0xff,0x40,0x0,0xc,0x0,0x42,0x8c,0x0,0x30,0xff,0x0,
+    0xac,0x48,0x0,0x20,0x80,0xe2,0x0,0xbf,0xe0,0x0,0xe1,0x0,0xe0,0x80,0x3,0x0,
+    0xc,0xff,0xe0,0x0,0xbf,0x52,0x49,0x1,0x60,0x0,0xff,0x21,0x81,0x81,0x1,0x61,
+    0x41,0x61,0xff,0xff,0x22,0x2,0x76,0x28,0x23,0xc2,0x54,0xc1,0xbf,0x61,0x70,0x47,
+    0x4c,0x4a,0x2,0x6d,0x1,0x82,0xbf,0x81,0x2,0x61,0x42,0x61,0x1,0x15,0x0,0xc1,
+    0x5b,0x54,0xc2,0x15,0x0,0x0,0x20,0x3,0x2e,0x7,0xb,0x10,0xff,0x80,0xb5,0x0,
+    0x22,0x0,0x21,0xa,0x20,0x3f,0xfa,0xf7,0x18,0xf9,0x1,0xbd,0x99,0x1,0x1,0x4,
+    0xff,0x10,0xb5,0x4,0x0,0x20,0x34,0xa1,0x72,0x7f,0x2,0x99,0xe1,0x72,0x22,0x60,
+    0x63,0x77,0x0,0xaf,0x21,0x73,0x9,0xe0,0x15,0xa,0xe3,0x13,0x0,0x0,0xff,0x21,
+    0x61,0x60,0x1,0x22,0x22,0x73,0x61,0xff,0x73,0x1c,0x30,0xfd,0xf7,0x36,0xf8,0x10,
+    0xff,0xbd,0x10,0xb5,0x3,0x0,0x20,0x33,0x0,0xff,0x24,0x9c,0x72,0xda,0x72,0x19,
+    0x60,0x59,0xfe,0xa7,0x1,0x19,0x73,0x5c,0x73,0xef,0xe7,0x0,0x7f,0x29,0x0,0xd5,
+    0x0,0x21,0x0,0x2a,0x5,0x0,0xff,0x22,0x0,0x29,0x3,0xd0,0x0,0x2a,0x2,0xff,
+    0xd0,0x91,0x42,0x0,0xdd,0x11,0x0,0x8,0xfd,0x0,0x7f,0x2,0x81,0x60,0x53,0x0,
+    0x9a,0x18,0xff,0x89,0x18,0x41,0x60,0x0,0xf0,0x1,0xf8,0xdd,0x1,0x47,0x0,0x4,
+    0x1d,0x21,0x7b,0x1,0x2,0xd0,0xff,0x62,0x68,0x91,0x42,0x1,0xd1,0x0,0x20,0xff,
+    0x10,0xbd,0x53,0x1c,0x1,0x0,0x2a,0x31,0xff,0x12,0x78,0xa,0x70,0x2,0x22,0x4a,
+    0x70,0xff,0xe3,0x61,0x0,0x22,0x22,0x62,0x1,0x23,0xff,0x8b,0x70,0xca,0x70,0x1c,
+    0x30,0xfc,0xf7,0xff,0xf7,0xff,0x60,0x68,0xc0,0x1c,0x60,0x60,0xad,0x1,0x29,0x0,
+    0xa,0x48,0x69,0x0,0xd1,0xc1,0x0,0xb4,0xff,0xfa,0x23,0xdb,0x0,0xc,0x68,0x84,
+    0x42,0xff,0x2,0xda,0x9c,0x42,0x0,0xdb,0x20,0x0,0xff,0x9,0x1d,0x52,0x1e,0xf6,
+    0xd1,0x10,0xbc,0xfe,0xf7,0x0,0x0,0x54,0x48,0x3,0x0,0xff,0xff,0xff,0xff,0x7f,
+    0xfa,0x20,0xc0,0x0,0x81,0x42,0x37,0x0,0xda,0x1,0x8b,0x4,0x0,0x0,0xe1,0x2,
+    0x71,0x1,0xff,0x47,0x20,0x0,0x10,0xf0,0x5,0xf8,0x0,0xff,0x28,0x4,0xd1,0x3,
+    0x48,0x0,0x68,0x1,0x7b,0x0,0xf5,0x85,0x4,0x0,0xbf,0xd8,0x49,0x33,0x1,0xff,
+    0xb5,0x67,0xe0,0xf0,0xb5,0x1,0x24,0xa2,0xfe,0x19,0x2,0x26,0x86,0x40,0xa1,0x4d,
+    0xa2,0x4f,0xff,0xa2,0x48,0x70,0x43,0x39,0x0,0xee,0xf7,0xdf,0xe8,0xfb,0x28,0x80,
+    0xa0,0xb,0x8,0xe2,0xfb,0xf7,0x68,0x80,0xc0,0xb,0x8,0xdc,0xfb,0xa8,0x80,0xbf,
+    0xbe,0x48,0x46,0x43,0x30,0x0,0xd,0x2,0xd5,0xef,0xfb,0xe8,0x80,0xbc,0x3d,0x0,
+    0x84,0x40,0xfa,0xff,0x26,0xb6,0x0,0xba,0x48,0x60,0x43,0x31,0xbe,0x15,0x0,0xca,
+    0xfb,0x28,0x81,0xb8,0xb,0x8,0xc4,0xef,0xfb,0x68,0x81,0xb6,0xb,0x8,0xbe,0xfb,
+    0xa8,0x7f,0x81,0xb4,0x48,0x44,0x43,0x20,0x0,0xd,0x2,0xff,0xb7,0xfb,0xe8,0x81,
+    0xf0,0xbd,0x38,0xb5,0xdf,0x0,0xbf,0x4,0x0,0x15,0xa5,0x0,0xe,0xf8,0xff,0xd,
+    0xa1,0x20,0x0,0x30,0x30,0x10,0xf0,0xef,0x29,0xf8,0xac,0x48,0xc7,0x0,0x31,0x21,
+    0x60,0xef,0x78,0x30,0x20,0x63,0x6a,0x1,0x0,0x20,0x0,0xfd,0x60,0x17,0x0,0x4f,
+    0xf8,0x0,0x20,0x3c,0x21,0xff,0x60,0x54,0x22,0x0,0x0,0x21,0x20,0x0,0xff,0x48,
+    0x30,0xd,0xf0,0xba,0xf9,0x20,0x0,0xff,0x32,0xbd,0x2,0x1,0x68,0x69,0x0,0x0,
+    0xe7,0x75,0x70,0x0,0x0,0x0,0x4b,0x2,0x1e,0x0,0xf,0xcf,0xf0,0xe7,0xff,0x31,
+    0x35,0x0,0x4d,0x2,0x2,0xf8,0xd5,0x98,0x4d,0x24,0x28,0x4d,0x1c,0x93,0x4d,0x0,
+    0x70,0xbd,0xff,0x2,0x7e,0x91,0x42,0x6,0xd0,0x78,0x22,0xdb,0x82,0x5c,0xb3,0x3,
+    0x60,0x30,0x4d,0x1,0x20,0x70,0xff,0x47,0x1,0x0,0x1,0x20,0xa,0x7e,0x1,0xff,
+    0x23,0x93,0x40,0x78,0x31,0x9,0x78,0x88,0x5f,0x40,0x18,0x43,0x80,0xb2,0x67,0x3,
+    0xf2,0x67,0x1,0xff,0x27,0x0,0x3c,0x37,0x0,0x20,0xb8,0x70,0xff,0xf8,0x70,0x78,
+    0x60,0x26,0x0,0xb2,0x36,0xff,0x3a,0x20,0x30,0x71,0x1f,0x20,0xf0,0x75,0xff,0x19,
+    0x20,0x70,0x76,0x4,0x23,0x4c,0x4a,0xfb,0x69,0x46,0x85,0x3,0x37,0xf8,0x5,0x0,
+    0x0,0xff,0xbf,0x18,0xa0,0x40,0x19,0x40,0x78,0x30,0xff,0x77,0x18,0xa0,0x69,0x0,
+    0x40,0x18,0x41,0xff,0x88,0x1,0x20,0x43,0x4a,0x12,0x68,0x90,0xff,0x40,0x48,0x43,
+    0x9d,0x21,0x49,0x0,0x48,0xff,0x43,0x41,0x49,0xee,0xf7,0x2a,0xfb,0x30,0xfb,0x80,
+    0x13,0x1f,0x4,0x40,0x88,0x70,0x80,0x1,0xff,0x21,0x20,0x7e,0xf,0xf0,0xd3,0xfe,
+    0x38,0xff,0x78,0x5,0x28,0x9,0xd1,0x7,0x20,0x38,0xff,0x70,0x2,0x23,0x22,0x0,
+    0xc9,0x32,0xf1,0xff,0x7d,0x20,0x0,0xff,0xf7,0x9a,0xfe,0x1,0xfb,0xe0,0x6,0x13,
+    0x0,0x0,0x2d,0x1,0xd5,0x2,0xef,0x20,0xf2,0xbd,0x0,0x3,0x0,0x18,0x0,0x8,
+    0xfb,0x10,0x18,0xb,0x1,0xd0,0x7,0xfa,0x0,0xf4,0x7f,0x1,0xe8,0x3,0xd0,0x7,
+    0x0,0x0,0xbf,0x0,0xee,0x1,0x8,0x0,0x0,0xf4,0xb3,0x0,0x78,0x20,0x20,0xff,
+    0x5c,0x81,0x42,0x44,0xd1,0x0,0x2b,0x0,0xff,0xd1,0x28,0x23,0xdb,0x1c,0x26,0x0,
+    0xac,0xff,0x36,0x58,0x10,0x80,0xf,0xc0,0x18,0x80,0xbf,0x10,0xb0,0x77,0x4,0x23,
+    0x77,0xb5,0x4,0xf,0xbf,0xf0,0xdc,0xff,0x5,0x0,0x1f,0xb3,0x4,0xcf,0xfe,0x2b,
+    0x1,0x30,0x70,0xfa,0x27,0xbf,0x0,0x1d,0xfa,0x9b,0x8,0x39,0xc5,0x1,0xd1,0xfa,
+    0x1,0x21,0x3b,0x7a,0xc1,0x0,0x91,0xc1,0x0,0x6b,0x49,0x48,0x43,0x13,0x2,0xdf,
+    0xca,0xfa,0x70,0x80,0x17,0x23,0x8,0xb0,0x80,0x1d,0x3c,0x69,0x0,0x6,0x28,0xa,
+    0xb9,0x0,0x6d,0x3,0xbb,0x6,0xfb,0x71,0x7f,0xbb,0x2,0x3c,0xfe,0x2,0xe0,0x5,
+    0xff,0x20,0x3c,0x34,0x20,0x70,0xe8,0xf,0xf2,0xfb,0xbd,0x6,0xbd,0x2,0x0,0x78,
+    0x4d,0x3,0x0,0xff,0x40,0x49,0x0,0x20,0x50,0x46,0x0,0x0,0xff,0xf6,0xcb,0x1,
+    0x0,0xec,0x97,0x3,0x0,0xfe,0xcf,0xa,0x80,0x3e,0xd0,0x7,0xa0,0xf,0x40,0xbf,
+    0x1f,0x80,0x3e,0x0,0x0,0x2,0xcd,0x8,0x2,0xfe,0x17,0x2,0xb5,0xa,0x0,0x1,
+    0x7e,0x3,0x68,0xdf,0x9b,0x6d,0x98,0x47,0x2,0x43,0x0,0x10,0xb5,0xfd,0x14,0x17,
+    0x0,0x78,0x32,0x3,0x7e,0x99,0x42,0xff,0x15,0xd1,0x1,0x21,0x21,0x71,0xcd,0x23,
+    0xff,0x1b,0x1,0xe3,0x80,0x53,0x8f,0xe3,0x60,0xff,0x92,0x8f,0x22,0x61,0xa1,0x61,
+    0x42,0x49,0xff,0x61,0x61,0x0,0xbf,0x13,0xa1,0x21,0x60,0xf7,0xfa,0x21,0x89,0x89,
+    0x0,0x60,0xfe,0xa0,0x60,0xff,0x0,0x20,0x10,0xbd,0x13,0x78,0x99,0x42,0xfd,0x8,
+    0x31,0x4,0xff,0x23,0xce,0x33,0xe3,0x80,0xff,0xd3,0x8e,0xe3,0x60,0x12,0x8f,0xe5,
+    0xe7,0xfd,0x7,0x1b,0x0,0x0,0x0,0xd8,0x2f,0x7,0x0,0xdf,0xc8,0xf,0xa,0x0,
+    0x74,0xa3,0x0,0xea,0x72,0x7f,0x0,0x0,0xd4,0xe5,0x0,0x0,0xa8,0xa3,0x0,0xff,
+    0xe0,0x64,0x2,0x0,0x14,0x3c,0x3,0x0,0xbf,0x49,0x6e,0x76,0x65,0x6e,0x73,0x2,
+    0x2,0x20,0xff,0x4d,0x50,0x55,0x36,0x35,0x30,0x30,0x0,0xff,0x0,0xf8,0xb5,0x7,
+    0x0,0xc,0x0,0x0,0xff,0x20,0x0,0x26,0x21,0x68,0x1,0x29,0x1,0xff,0xda,0x60,
+    0x60,0xf2,0xbd,0x60,0x68,0x0,0xff,0x28,0xc,0xd5,0x39,0x6c,0x21,0x4a,0x4a,0xff,
+    0x43,0x90,0x42,0x0,0xd0,0x5,0x26,0xfa,0xff,0x25,0xad,0x0,0x69,0x43,0x21,0x60,
+    0x48,0xff,0x42,0x60,0x60,0x2e,0xe0,0x1,0x28,0x4,0xff,0xdb,0x88,0x42,0x1,0xda,
+    0x20,0x60,0x0,0x77,0xe0,0x61,0x60,0x1b,0x2,0x20,0x68,0x29,0x57,0x1,0xff,0x1b,
+    0xfa,0x68,0x43,0xa8,0x42,0x2,0xda,0xff,0x28,0x0,0x4,0x26,0x3,0xe0,0x13,0x49,
+    0xff,0x88,0x42,0x0,0xdb,0x48,0x1e,0x20,0x60,0xbf,0x60,0x68,0x1,0x28,0xe,0xda,
+    0x23,0x6,0x9,0xff,0xfa,0x69,0x46,0x8,0x80,0x8,0x23,0xc,0xfb,0x4a,0x38,0xbd,
+    0x1,0x16,0xff,0x68,0x46,0x0,0xef,0x88,0x45,0x43,0x25,0x23,0x4,0x1,0xdb,0x20,
+    0x5f,0x68,0x60,0x60,0x30,0x0,0x67,0x3,0x48,0x63,0x1,0xff,0x4e,0x26,0x0,0x0,
+    0xff,0x7f,0x0,0x0,0xff,0x18,0xfc,0xff,0xff,0x1,0xe8,0x3,0x0,0xf7,0x30,0xe7,
+    0x1,0xaf,0x0,0x4,0x0,0xe,0x0,0xff,0x35,0x68,0x77,0x68,0x22,0x68,0xd2,0x69,
+    0xff,0x90,0x47,0x0,0x28,0x41,0xd1,0x30,0x68,0xff,0x85,0x42,0x2,0xd1,0x71,0x68,
+    0x8f,0x42,0xf7,0x1,0xd0,0x5,0xa5,0x1,0x25,0x0,0x3c,0x35,0xff,0x0,0x28,0x1,
+    0xd1,0xe8,0x70,0x12,0xe0,0xff,0x3,0xd5,0x5,0x20,0xe8,0x70,0x0,0x20,0xfb,0xd,
+    0xe0,0xdd,0x0,0xdb,0x3,0x21,0x4,0xe0,0xff,0x0,0x29,0x1,0xd5,0x4,0x21,0x0,
+    0xe0,0xef,0x2,0x21,0xe9,0x70,0x5d,0x3,0xee,0xf7,0xbf,0xff,0xf9,0xa8,0x60,0x28,
+    0x78,0xc,0x28,0x6,0xff,0xd1,0xe8,0x78,0x0,0x28,0x16,0xd0,0x20,0xff,0x0,0x0,
+    0xf0,0xa9,0xf9,0x14,0xe0,0x13,0xfb,0x28,0x12,0x11,0x0,0xa9,0x78,0x88,0x42,0x3,
+    0xff,0xd1,0x69,0x68,0xaa,0x68,0x91,0x42,0x8,0xff,0xd0,0x69,0x78,0x5,0x29,0x7,
+    0xd1,0x5,0xfb,0x28,0x3,0x25,0x4,0x82,0xf9,0x1,0xe0,0x6,0xee,0x5f,0x4,0xf2,
+    0xbd,0x38,0x99,0x0,0x25,0x0,0x30,0xff,0x35,0x28,0x7b,0x0,0x28,0x1a,0xd1,0x28,
+    0xbf,0x0,0x29,0x68,0xc9,0x68,0x88,0x9f,0x0,0xf,0xff,0xd0,0x29,0x7a,0x20,0x0,
+    0x29,0x30,0x1,0xff,0x70,0x68,0x7a,0xc6,0x21,0x60,0x54,0x0,0xff,0x22,0x64,0x21,
+    0x48,0x34,0x20,0x0,0xc,0xff,0xf0,0xb2,0xff,0x3,0x20,0x28,0x73,0x31,0xff,0xbd,
+    0x0,0x22,0x0,0x21,0xa,0x20,0xf9,0xff,0xf7,0xc,0xfe,0x31,0xbd,0xf8,0xb5,0x5,
+    0xff,0x0,0x2e,0x0,0x18,0x36,0x30,0x78,0x98,0xff,0x42,0x4,0xd0,0x78,0x21,0x69,
+    0x5c,0x99,0xfe,0x81,0x1,0xe0,0xe0,0x2c,0x0,0x38,0x34,0x21,0xff,0x79,0x49,0x1e,
+    0x13,0x29,0x0,0xd9,0xd9,0xff,0xe0,0x2,0xa2,0x52,0x5c,0x52,0x0,0x97,0xdf,0x44,
+    0x0,0xbf,0xa,0xd5,0x0,0x2,0xd2,0x3d,0xff,0x43,0x49,0x52,0xd5,0x5f,0xd5,0x68,
+    0x7d,0xff,0x87,0x90,0xd5,0xa5,0x28,0x0,0x2d,0x30,0xfd,0x0,0xc9,0x0,0xf,0xd1,
+    0x29,0x0,0xc7,0x31,0xff,0x28,0x0,0x30,0x30,0xb2,0x69,0x92,0x68,0x7e,0x2b,0x3,
+    0x6,0xd0,0x0,0x22,0x29,0x0,0x6b,0x2,0xbf,0xd6,0xfd,0x4,0x20,0xa1,0xe0,0x1b,
+    0x2,0xb1,0x3d,0x69,0xa7,0x6,0xe,0xd0,0x21,0x78,0xb5,0x0,0xa7,0x0,0xff,0x61,
+    0x78,0x2b,0x0,0xc6,0x33,0x19,0x70,0xff,0x3,0x20,0x0,0x90,0x1a,0x0,0x28,0x0,
+    0xff,0xff,0xf7,0xac,0xfc,0xf1,0xbd,0x2,0x20,0xfb,0x20,0x71,0xa9,0xa,0xb7,0xfd,
+    0xf1,0xbd,0x9,0xfe,0xf,0x0,0x2,0x23,0x4a,0xa2,0x69,0x21,0x48,0xfb,0xe0,0xa,
+    0xb,0x4,0x48,0xa2,0x38,0x21,0x42,0xb7,0xe0,0xe0,0x79,0x4b,0x0,0xd1,0xb,0x11,
+    0x0,0x3,0xbf,0x23,0x0,0xbf,0x44,0xa2,0x38,0x11,0x4,0x5,0xfb,0xd1,0xc,0x3f,
+    0x2,0x20,0x60,0x71,0xa0,0x71,0xfd,0x73,0x77,0x0,0x0,0xf0,0xf8,0xf8,0xf1,0xbd,
+    0x7d,0xe,0x53,0x4,0x28,0x21,0x48,0x35,0x28,0xf,0x1,0x7f,0x2a,0xff,0xf1,0xbd,
+    0xa0,0x79,0x3,0x2b,0x0,0xf5,0x12,0x4f,0x4,0x37,0x4f,0x0,0x1a,0xe0,0x10,0x21,
+    0xff,0x5,0x28,0x21,0x71,0x3,0xd1,0x2,0x23,0x7d,0x32,0xf,0x0,0x12,0xe0,0x2,
+    0x23,0x31,0x7,0x0,0x5f,0xe,0xe0,0xa0,0x79,0x5,0xb1,0x1,0x11,0x29,0x4,0xb7,
+    0x0,0xbf,0x2d,0x87,0x0,0x4,0xe0,0x37,0x6,0x2b,0xd7,0xa2,0x6b,0x21,0xb5,0x2,
+    0x5c,0xb5,0x0,0x61,0x79,0xff,0x1,0x29,0x5,0xd1,0xf,0xf0,0x63,0xfc,0xff,0x1,
+    0x21,0x30,0x78,0xf,0xf0,0x67,0xfc,0x6d,0xe0,0x37,0x0,0x5,0xd1,0x3d,0x2,0x2,
+    0xd0,0x87,0x2,0x7f,0xa0,0xf8,0xa0,0x79,0x60,0x71,0x1a,0x93,0x4,0xff,0x6,0xf9,
+    0xe0,0x79,0x6,0x28,0x14,0xd0,0xdf,0x0,0x28,0x24,0xd0,0x62,0x21,0x2,0xd1,0x5,
+    0xff,0x2a,0xb,0xd0,0x1e,0xe0,0x5,0x2a,0x2,0xfb,0xd1,0x4,0x3d,0x1,0x19,0xe0,
+    0xa6,0x68,0xe7,0xff,0x68,0xbe,0x42,0x15,0xd1,0x82,0x42,0x4,0x3f,0xd1,0x6,0x20,
+    0xe0,0x71,0x13,0x71,0x0,0x1b,0x1,0xfc,0x1f,0x0,0xb7,0x2,0x9,0xe0,0x3,0x2a,
+    0x7,0xd0,0x65,0x2,0x9,0x0,0x60,0x19,0x4,0x21,0x2,0xf1,0xbd,0x59,0x2,0x7d,
+    0x6d,0xed,0x0,0x69,0x0,0x0,0x0,0x38,0x3,0x0,0xbf,0x6b,0x40,0x3f,0x0,0x38,
+    0x40,0xb,0x0,0x1,0xef,0x0,0x0,0x69,0xc0,0xf,0x0,0x20,0x10,0xb5,0x7f,0x82,
+    0xb0,0x1,0x7e,0x99,0x42,0x3,0xf1,0x1,0xfd,0x41,0xf1,0x1,0x1d,0xd1,0x4,0x0,
+    0x3c,0x34,0xff,0x21,0x78,0x13,0x29,0x18,0xd1,0x61,0x78,0xe9,0x5,0xc1,0x0,0x79,
+    0x3,0x8,0x79,0x1,0xfa,0xfc,0x13,0xff,0xbd,0x3,0x29,0x1,0xd1,0x10,0x21,0x0,
+    0xff,0xe0,0x8,0x21,0x12,0x68,0x22,0x62,0x2,0xff,0x0,0xb6,0x32,0x0,0x91,0x13,
+    0x0,0x11,0xff,0x78,0xff,0xf7,0xd8,0xfb,0x14,0x20,0x20,0xe7,0x70,0x13,0xbd,0x4f,
+    0x2,0x41,0x0,0x20,0x20,0x5c,0x9f,0x3,0x28,0xb,0xd1,0x23,0xcd,0x1,0xc9,0x3,
+    0x19,0xfb,0x78,0x20,0x15,0x1,0xc6,0xfb,0x1,0x20,0x3c,0xf5,0x34,0x25,0x2,0xe,
+    0x1b,0x0,0xf,0x20,0x3c,0x21,0xff,0x60,0x54,0x7,0x23,0x22,0x0,0xcb,0x32,0xbf,
+    0x20,0x0,0xc6,0x30,0x41,0x79,0x23,0x2,0xbf,0xff,0xfb,0x13,0xbd,0x0,0x0,0x6d,
+    0xa0,0x70,0xff,0x47,0x5c,0x20,0x70,0x47,0x78,0x30,0x0,0xbf,0x78,0x81,0x42,0x1,
+    0xd1,0x80,0xf,0x0,0x0,0xf2,0xf,0x10,0x44,0xb,0x0,0xf,0x2,0x10,0xb5,0x4,
+    0x0,0xff,0x0,0x21,0x20,0x7e,0xf,0xf0,0xb8,0xfb,0xff,0x20,0x0,0x3c,0x30,0x1,
+    0x21,0x41,0x70,0x2f,0x8,0x21,0x1,0x70,0xff,0x3,0x84,0x8b,0x1,0x51,0x2,0xdf,
+    0x96,0xfb,0x10,0xbd,0x70,0x95,0x0,0x5,0x0,0xff,0x2e,0x0,0x3c,0x36,0xb0,0x68,
+    0x69,0x46,0xff,0x8,0x80,0x2c,0x0,0xcc,0x34,0xf0,0x78,0xff,0x3,0x28,0xf,0xd1,
+    0x6,0x23,0x88,0xa2,0xff,0x28,0x0,0xf,0xf0,0xf5,0xfc,0x82,0xa1,0xff,0x9,0x18,
+    0x49,0x78,0x21,0x71,0x82,0xa1,0xff,0x8,0x18,0x40,0x78,0x60,0x70,0xb0,0x68,0x5f,
+    0x40,0x1e,0x2,0xe0,0x8,0x4b,0x1,0x0,0xd9,0x0,0xef,0xf0,0x78,0x5,0x28,0xfb,
+    0x0,0x20,0x1,0xe0,0xdf,0xac,0x20,0x28,0x5c,0xe0,0xf,0x8,0x7,0x20,0x7f,0x10,
+    0xe0,0x2,0x28,0x1,0xd0,0x4,0xcf,0x0,0xee,0x59,0x6,0x8,0x23,0x69,0x4f,0x4,
+    0xe6,0xfc,0x6b,0xfe,0x47,0x4,0x0,0xe0,0x0,0x20,0x60,0x71,0xf0,0xff,0x78,0xb0,
+    0x70,0x6,0x20,0xf0,0x70,0x1,0xfb,0x20,0x70,0x57,0x0,0x70,0x60,0xd,0x20,0x30,
+    0xf3,0x70,0xb0,0x7f,0x0,0xbb,0x1,0x23,0x5c,0xa2,0x2,0xd5,0xe0,0xaf,0x2,0x59,
+    0xaf,0x0,0x28,0xaf,0x0,0x3e,0xfb,0xd7,0x73,0xbd,0x38,0xd7,0x0,0x3d,0x43,0x1,
+    0x2,0x28,0xff,0x23,0xd0,0x51,0xd3,0x4,0x28,0x27,0xd0,0xff,0x4e,0xd2,0x25,0x0,
+    0x9c,0x35,0xe0,0x6d,0xff,0x68,0x60,0x20,0x0,0xbc,0x30,0x1,0x79,0xff,0x9,0x2,
+    0x42,0x79,0x11,0x43,0x29,0x81,0xf5,0x81,0x9,0x0,0xc2,0x9,0x0,0x69,0x81,0x1,
+    0x7a,0xfe,0x13,0x0,0x7a,0x11,0x43,0xa9,0x81,0x81,0x78,0xff,0x9,0x2,0xc0,0x78,
+    0x1,0x43,0xe9,0x81,0x7f,0x22,0x7e,0x21,0x0,0xa0,0x31,0x7,0xbd,0x1,0xff,0x1b,
+    0xfc,0x21,0x0,0x5c,0x31,0x8,0x68,0xdb,0x88,0x63,0x47,0x2,0x10,0xe0,0x5,0x2,
+    0x13,0x48,0x7f,0x28,0x81,0x68,0x81,0xa8,0x81,0xe8,0x27,0x10,0xfd,0x7,0x27,0xc,
+    0x28,0x7f,0x0,0x2,0x6a,0x7f,0x5f,0x10,0x43,0x88,0x87,0xa8,0x9,0x0,0xea,0x9,
+    0x0,0xfb,0xc8,0x87,0x7b,0x2,0x2,0x78,0x12,0x2,0x40,0xff,0x78,0x2,0x43,0x2a,
+    0x80,0xa,0x7f,0x94,0xf7,0x34,0x21,0x0,0x35,0x2,0xec,0xfb,0x31,0xbd,0xff,0xff,
+    0x7f,0x0,0x0,0x5c,0x0,0x11,0x0,0xff,0x28,0xa,0xe2,0x25,0xdd,0x55,0x22,0xaa,
+    0xcf,0x5c,0xe8,0x22,0x0,0x0,0x12,0xf,0x2a,0xb0,0x12,0xff,0x31,0x0,0xd1,0x22,
+    0xdb,0x1,0x96,0x8,0xfb,0x71,0x0,0x3,0xa,0xea,0x2b,0xd0,0x45,0x29,0xf7,0x5c,
+    0x8f,0x2,0x1e,0x0,0x40,0xdd,0x24,0x6,0xff,0x1,0x58,0xea,0xbc,0xa2,0x44,0x0,
+    0xd,0xdf,0x0,0xf9,0x48,0xea,0xd9,0x5b,0x2,0xf6,0x9c,0xfa,0x4a,0x14,0x0,0xf,
+    0x22,0x59,0x4,0xe,0x7,0xe5,0xff,0x3d,0x8,0x7,0x1c,0x16,0x66,0xd,0x52,0xff,
+    0x44,0x7a,0x4e,0x58,0xed,0xed,0x11,0x6b,0xff,0x0,0x3f,0x0,0x6b,0x0,0x7,0x0,
+    0x6b,0xfd,0x1,0x24,0x0,0x1,0x80,0x0,0x40,0x0,0x20,0xff,0x0,0x10,0x0,0x8,
+    0x0,0x4,0x0,0x2,0xff,0x0,0xb,0x4,0x5,0x6,0x7,0x8,0x9,0x7b,0xa,0xb,
+    0x1a,0x0,0x6,0x1,0x2,0x3,0xe,0x0,0xfe,0x7,0xc,0x2,0x0,0x5,0x0,0xa,
+    0x0,0x16,0xff,0x0,0x32,0x0,0x64,0x0,0x10,0xb5,0x0,0xff,0xbf,0x4,0x0,0x0,
+    0xbf,0x6,0xa3,0xff,0xff,0xf7,0xeb,0xfa,0x4,0x48,0x1,0x0,0x8,0x7f,0x31,0x21,
+    0x60,0x78,0x30,0x20,0x63,0x4b,0x0,0xff,0xbd,0x0,0x0,0x9c,0x3c,0x3,0x0,0x2,
+    0x7f,0x1,0x68,0x69,0x0,0x0,0x75,0x74,0x8b,0x2,0xff,0xf0,0xb5,0x1,0x24,0xab,
+    0x48,0x0,0x68,0xff,0x1,0x26,0x86,0x40,0xaa,0x4d,0xab,0x4f,0xff,0xab,0x48,0x70,
+    0x43,0x39,0x0,0xed,0xf7,0xdf,0xc4,0xfe,0x28,0x80,0xa9,0xb,0x8,0xbe,0xfe,0xf7,
+    0x68,0x80,0xa7,0xb,0x8,0xb8,0xfe,0xa8,0x80,0xbf,0xa5,0x48,0x46,0x43,0x30,0x0,
+    0xd,0x2,0xb1,0xef,0xfe,0xe8,0x80,0xa3,0x3d,0x0,0x84,0x40,0xfa,0xff,0x26,0xb6,
+    0x0,0xa1,0x48,0x60,0x43,0x31,0xbe,0x15,0x0,0xa6,0xfe,0x28,0x81,0x9f,0xb,0x8,
+    0xa0,0xef,0xfe,0x68,0x81,0xbf,0xb,0x8,0x9a,0xfe,0xa8,0x7f,0x81,0xbd,0x48,0x44,
+    0x43,0x20,0x0,0xd,0x2,0x7f,0x93,0xfe,0xe8,0x81,0xf0,0xbd,0x38,0xaf,0x4,0xff,
+    0x15,0x0,0xf,0xf0,0xea,0xfa,0xe,0xa1,0xff,0x20,0x0,0x30,0x30,0xf,0xf0,0x5,
+    0xfb,0x5d,0xb5,0xb7,0x10,0x22,0x0,0x29,0x7,0x1,0x60,0x17,0x0,0xff,0x2b,0xfb,
+    0x0,0x20,0xc7,0x22,0xa0,0x54,0xef,0x3c,0x21,0x60,0x54,0x9d,0x1,0x21,0x20,0x0,
+    0xff,0x48,0x30,0xc,0xf0,0x94,0xfc,0x20,0x0,0xeb,0x32,0xbd,0xd3,0x8,0x68,0xd3,
+    0x2,0x2,0x7e,0x91,0xff,0x42,0x6,0xd0,0x78,0x22,0x82,0x5c,0x91,0xff,0x42,0x1,
+    0xd1,0x60,0x30,0x70,0x47,0x0,0xff,0x20,0x70,0x47,0x1,0x0,0x1,0x20,0xa,0xff,
+    0x7e,0x1,0x23,0x93,0x40,0x78,0x31,0x9,0xff,0x78,0x88,0x40,0x18,0x43,0x80,0xb2,
+    0x70,0xef,0x47,0xf8,0xb5,0x4,0xb9,0x1,0x3e,0x30,0x0,0xff,0x21,0x1,0x70,0x41,
+    0x70,0x21,0x64,0x26,0xff,0x0,0xb0,0x36,0xf0,0x7d,0x0,0x28,0x5,0xef,0xd1,0x9,
+    0x22,0x44,0x8f,0x0,0xc7,0x30,0xed,0xfb,0xf7,0x63,0x61,0x0,0x0,0xf0,0x84,0xfb,
+    0x27,0xff,0x0,0xc,0x37,0x1,0x21,0x38,0x7b,0xf,0xff,0xf0,0xe8,0xf9,0x3d,0x80,
+    0x4,0x23,0x5e,0xfb,0x4a,0x39,0x99,0x0,0xf,0xf0,0x26,0xfb,0x4,0xff,0x0,0xf,
+    0xa0,0x0,0x19,0x40,0x78,0xb0,0xfb,0x76,0x65,0x7b,0x1,0xe,0xa0,0x40,0x19,0x41,
+    0xff,0x88,0x39,0x80,0x1,0x20,0x55,0x4a,0x12,0xff,0x68,0x90,0x40,0x48,0x43,0x9d,
+    0x21,0x49,0xff,0x0,0x48,0x43,0x53,0x49,0xed,0xf7,0x18,0xef,0xfe,0x30,0x80,0x9,
+    0x1f,0x0,0x40,0x88,0x70,0xff,0x80,0x0,0x2c,0x1,0xd5,0x2,0x20,0xf2,0xfb,0xbd,
+    0x0,0x3,0x0,0x18,0x0,0x8,0x10,0x18,0xfe,0xbb,0x0,0xd0,0x7,0xfa,0x0,0xf4,
+    0x1,0xe8,0x9f,0x3,0xd0,0x7,0x0,0x0,0xb1,0x0,0x1,0x8,0x0,0xff,0x0,0xf4,
+    0xb5,0x6,0x0,0x1f,0x0,0x35,0xff,0x0,0x78,0x35,0x28,0x78,0x81,0x42,0x39,0xff,
+    0xd1,0x34,0x0,0xc7,0x34,0x20,0x78,0x0,0xeb,0x28,0x4,0xa7,0x0,0x1a,0xa7,0x0,
+    0xed,0xf7,0x10,0xff,0xfc,0x0,0x2f,0x0,0xd1,0x28,0x27,0xff,0xff,0x1c,0x78,0x10,
+    0x80,0xf,0xc0,0x19,0x80,0xff,0x10,0xe0,0x71,0x4,0x23,0x63,0x4a,0x69,0xfb,0x46,
+    0x30,0xa3,0x0,0xd4,0xfa,0x6,0x0,0x13,0xfb,0xa0,0x80,0xa3,0x0,0x60,0x72,0x74,
+    0x0,0xfa,0xab,0x27,0xbf,0xa7,0x0,0x11,0xb3,0x2,0x88,0xc7,0x3,0xca,0xaf,0xfd,
+    0x1,0x21,0x31,0xab,0x0,0x91,0xab,0x0,0x58,0xfb,0x49,0x48,0xe9,0x5,0xc3,0xfd,
+    0xa8,0x86,0x0,0xfb,0xbf,0xb,0x23,0x4,0xe8,0x86,0xf0,0xf,0xf2,0xfb,0xbd,0x6,
+    0xa7,0x0,0x19,0x7,0x3,0x18,0xa,0xef,0x0,0x0,0x8,0x2,0x93,0x0,0x1a,0x2,
+    0xa,0xfb,0x12,0x1a,0x7,0x0,0x80,0x3e,0xd0,0x7,0xa0,0x1f,0xf,0x40,0x1f,0x80,
+    0x3e,0x7b,0x1,0xb1,0x8,0x1f,0x2,0xff,0x80,0xb5,0xa,0x0,0x1,0x7e,0x3,0x68,
+    0xff,0x9b,0x6d,0x98,0x47,0x2,0xbd,0x0,0x0,0xff,0x3,0x0,0x78,0x33,0x0,0x7e,
+    0x81,0x42,0xff,0x11,0xd1,0x1,0x20,0x10,0x71,0x3f,0x49,0xff,0xd1,0x80,0x19,0x8f,
+    0xd1,0x60,0x59,0x8f,0xff,0x11,0x61,0x90,0x61,0x3c,0x48,0x50,0x61,0xff,0x13,0xa0,
+    0x10,0x60,0xfa,0x20,0x80,0x0,0xab,0x90,0x60,0xaf,0x3,0x18,0xe7,0x0,0x7,0x29,
+    0x4,0x41,0xff,0x2,0xd1,0x80,0x99,0x8e,0xd1,0x60,0xd9,0xef,0x8e,0xe9,0xe7,0x7,
+    0x19,0x0,0x78,0x4d,0x3,0xff,0x0,0x30,0x49,0x0,0x20,0x50,0x46,0x0,0xff,0x0,
+    0xf6,0xcb,0x1,0x0,0xec,0x97,0x3,0xff,0x0,0xd8,0x2f,0x7,0x0,0xc8,0xf,0xa,
+    0xfb,0x0,0x74,0x1b,0x0,0xea,0x72,0x0,0x0,0xd4,0xff,0xe5,0x0,0x0,0x49,0x6e,
+    0x76,0x65,0x6e,0xfd,0x73,0x2,0x2,0x20,0x4d,0x50,0x55,0x36,0x30,0xff,0x35,0x30,
+    0x0,0x0,0x70,0xb5,0xc,0x0,0xff,0x0,0x21,0x0,0x25,0x22,0x68,0x1,0x2a,0xf7,
+    0x2,0xda,0x61,0x69,0x2,0xbd,0x61,0x68,0x0,0xff,0x29,0xc,0xd5,0x0,0x6c,0x1c,
+    0x4a,0x42,0xff,0x43,0x91,0x42,0x0,0xd0,0x5,0x25,0xfa,0xff,0x26,0xb6,0x0,0x70,
+    0x43,0x20,0x60,0x41,0xff,0x42,0x61,0x60,0x1c,0xe0,0x1,0x29,0x4,0xff,0xdb,0x91,
+    0x42,0x1,0xda,0x21,0x60,0x0,0x77,0xe0,0x62,0x60,0x1b,0x2,0x20,0x68,0x31,0x21,
+    0x1,0xff,0x2f,0xfd,0x70,0x43,0xb0,0x42,0x2,0xda,0xff,0x30,0x0,0x4,0x25,0x3,
+    0xe0,0xe,0x49,0xff,0x88,0x42,0x0,0xdb,0x48,0x1e,0x20,0x60,0xff,0x60,0x68,0x1,
+    0x28,0x1,0xdb,0x20,0x68,0x5f,0x60,0x60,0x28,0x0,0x70,0xf7,0x0,0xa8,0xa3,0x0,
+    0xff,0xe0,0x64,0x2,0x0,0x8c,0x3b,0x3,0x0,0xfd,0x38,0xb7,0x0,0x4e,0x26,0x0,
+    0x0,0x6a,0xe,0xff,0x0,0x0,0xff,0x7f,0x0,0x0,0x18,0xfc,0xfb,0xff,0xff,0xee,
+    0x1,0x0,0xf8,0xb5,0x4,0x0,0xff,0xe,0x0,0x35,0x68,0x77,0x68,0x22,0x68,0xff,
+    0xd2,0x69,0x90,0x47,0x0,0x28,0x3f,0xd1,0xff,0x30,0x68,0x85,0x42,0x2,0xd1,0x71,
+    0x68,0xdf,0x8f,0x42,0x1,0xd0,0x5,0x7b,0x1,0x25,0x0,0xff,0x3c,0x35,0x0,0x28,
+    0x1,0xd1,0xe8,0x70,0xff,0x12,0xe0,0x3,0xd5,0x5,0x20,0xe8,0x70,0xf7,0x0,0x20,
+    0xd,0x9d,0x0,0x1,0xdb,0x3,0x21,0xff,0x4,0xe0,0x0,0x29,0x1,0xd5,0x4,0x21,
+    0xff,0x0,0xe0,0x2,0x21,0xe9,0x70,0xfa,0x21,0xfd,0x89,0x9f,0x0,0xdf,0xfc,0xa8,
+    0x60,0x28,0x78,0xff,0x3,0x28,0x6,0xd1,0xe8,0x78,0x0,0x28,0xff,0xd,0xd0,0x20,
+    0x0,0x0,0xf0,0x35,0xfa,0xdf,0x12,0xe0,0x11,0x28,0x10,0x11,0x0,0xa9,0x78,0xff,
+    0x88,0x42,0x6,0xd1,0x68,0x68,0xa9,0x68,0xf5,0x88,0x65,0x0,0x6,0x4d,0x0,0x5,
+    0xe0,0x68,0x78,0xef,0x5,0x28,0x2,0xd1,0x27,0x2,0xd,0xfa,0x0,0xfa,0x71,0x0,
+    0x0,0x97,0x0,0x5,0x0,0x2e,0x0,0x18,0xff,0x36,0x30,0x78,0x98,0x42,0x4,0xd0,
+    0x78,0xef,0x20,0x28,0x5c,0x98,0x21,0x1,0x4a,0xe1,0x2c,0xff,0x0,0x38,0x34,0x20,
+    0x79,0x80,0x1e,0x10,0xff,0x28,0x0,0xd9,0x43,0xe1,0x2,0xa1,0x40,0xff,0x0,0x9,
+    0x5a,0x8f,0x44,0x0,0xbf,0x22,0xbf,0x0,0x7e,0x2,0x8a,0x0,0xa2,0x5,0x0,0xb2,
+    0xef,0x0,0xca,0x0,0xe,0x8,0x1,0x42,0x1,0x5c,0xff,0x1,0x92,0x1,0xbe,0x1,
+    0x7e,0x2,0xce,0xfe,0x3,0x0,0xd8,0x1,0x28,0x0,0x2d,0x30,0x0,0xfe,0x8f,0x0,
+    0xf,0xd1,0x29,0x0,0xc5,0x31,0x28,0x7f,0x0,0x30,0x30,0xb2,0x69,0x92,0x68,0xf1,
+    0x2,0xff,0x6,0xd0,0x0,0x22,0x29,0x0,0xa,0x20,0xff,0xf9,0xf7,0x13,0xf9,0x0,
+    0x20,0xe6,0xe0,0xbe,0x1b,0x2,0xb1,0x69,0xc9,0x68,0x88,0x1b,0x0,0x10,0xff,0xd0,
+    0x21,0x78,0x28,0x0,0x29,0x30,0x1,0xff,0x70,0x61,0x78,0x2b,0x0,0xb4,0x33,0x19,
+    0xff,0x74,0x2a,0x0,0xc4,0x32,0x3,0x20,0x0,0xff,0x90,0x13,0x0,0x28,0x0,0xfe,
+    0xf7,0xe7,0xff,0xff,0xf1,0xbd,0x20,0x71,0x0,0x22,0x0,0xfd,0x21,0x3f,0x2,0xf3,
+    0xf8,0xf1,0xbd,0xe0,0x79,0xbf,0x0,0x28,0x4,0xd1,0x3,0x20,0x15,0x0,0x20,0xf7,
+    0x60,0x71,0xee,0x4d,0x0,0x0,0xf0,0xb6,0xf9,0xff,0xf1,0xbd,0x0,0x22,0x1e,0x21,
+    0x48,0x35,0xff,0x28,0x0,0xc,0xf0,0x7e,0xfa,0x6,0x20,0xfb,0xb3,0xe0,0x4d,0x2,
+    0xd9,0x7c,0x19,0x70,0x9,0xfa,0x4b,0x0,0x1a,0x4b,0x4,0xc1,0xff,0x8,0x20,0xa7,
+    0xee,0x17,0x4,0x18,0x7d,0x59,0x25,0x1,0x57,0xd1,0x58,0xfb,0x7d,0x99,0x7,0x0,
+    0x53,0xd1,0x98,0x7d,0xd9,0xfe,0x7,0x0,0x4f,0xd1,0xd8,0x7d,0x19,0x79,0x88,0xbf,
+    0x42,0x4b,0xd1,0x98,0x7e,0xd9,0x7,0x0,0x47,0xff,0xd1,0xd8,0x7e,0x19,0x7a,0x88,
+    0x42,0x43,0x7f,0xd1,0x2,0x23,0x5f,0xa2,0x37,0x21,0x43,0x2,0xdf,0xaa,0xff,0x9,
+    0x20,0x85,0x43,0x4,0x37,0x20,0xe7,0x18,0x70,0x4,0x5b,0x4,0x19,0x6,0x92,0xff,
+    0xa,0xbb,0x20,0x78,0x8d,0x0,0xb4,0x30,0x40,0x5,0x1,0x29,0xee,0x33,0x0,0x53,
+    0xa2,0x69,0x19,0x4,0x90,0xff,0xb,0xcb,0x20,0x6b,0x33,0x4,0x69,0x33,0xc,0x19,
+    0x6,0x78,0xff,0xd7,0xc,0x20,0x5e,0x33,0x8,0x1,0x39,0x1,0xa0,0x79,0xf7,0x5,
+    0x28,0x3,0x39,0x0,0x0,0xbf,0x45,0xa2,0xbb,0x2,0xe0,0x7,0x2,0x44,0xa2,0x38,
+    0x29,0x4,0x6e,0xff,0xff,0xd,0x20,0x49,0xe0,0xe0,0x79,0x6,0xfb,0x28,0x3d,0x25,
+    0x0,0xe0,0x71,0x3a,0xe0,0xa0,0xeb,0x79,0x2,0x2b,0x0,0x3,0x23,0x0,0x3d,0xa2,
+    0x8,0x49,0xe0,0x37,0x2,0xb,0x2,0x39,0x37,0x0,0x7,0x6,0x6b,0x37,0x4,0xff,
+    0x52,0xff,0xe,0x20,0x2d,0xe0,0x0,0x22,0x7d,0x32,0x1b,0x9,0xf0,0xf9,0xf,0x20,
+    0x25,0x33,0x5,0xb5,0x4c,0x9,0x0,0x20,0x9,0x4,0x47,0xf9,0x57,0x2,0x19,0xfd,
+    0xd0,0xbb,0x1,0xd0,0x62,0x79,0x13,0x0,0x5,0xff,0x28,0x2,0xd1,0x5,0x2a,0x9,
+    0xd1,0xe,0xbf,0xe0,0x5,0x2a,0x2,0xd1,0x4,0x6d,0x1,0x3c,0xff,0xe0,0xa6,0x68,
+    0xe7,0x68,0xbe,0x42,0x3,0xf5,0xd0,0x2f,0x2,0xeb,0x85,0x1,0x82,0x42,0x4,0xd1,
+    0xdf,0x6,0x20,0xe0,0x71,0x11,0x87,0x1,0xf1,0xbd,0xdf,0x2,0x2a,0xc,0xd1,0x3,
+    0xf3,0x0,0xa0,0x71,0xe9,0xe,0xf,0x0,0x7f,0x2,0x19,0x7f,0x8,0x12,0xff,0x1e,
+    0x6f,0xe0,0x3,0x2a,0xb,0x19,0x0,0x60,0x71,0x2f,0x2,0x4a,0x1f,0x2,0x11,0x1b,
+    0x8,0x4,0xdb,0x1,0xc3,0x2,0x60,0x45,0x4,0xeb,0x8,0xe0,0x3b,0xa,0xa,0x1f,
+    0x8,0xf4,0xfe,0xe0,0xfb,0x79,0xa0,0x35,0x4,0xf1,0xbd,0x37,0x0,0x0,0x7f,0x0,
+    0x69,0x1,0x0,0x0,0x38,0x40,0x3,0x0,0x7e,0x7,0x0,0x6b,0x28,0x87,0x0,0x6b,
+    0x0,0x3,0x0,0xff,0x1,0x80,0x0,0x10,0xb5,0x82,0xb0,0x1,0xfb,0x7e,0x99,0x9d,
+    0x0,0x78,0x21,0x41,0x5c,0x99,0xff,0x42,0x24,0xd1,0x4,0x0,0x3c,0x34,0x61,0xff,
+    0x78,0x3,0x29,0x1,0xd1,0x10,0x21,0x0,0xff,0xe0,0x8,0x21,0x12,0x68,0x22,0x62,
+    0x22,0xff,0x78,0xf,0x2a,0xa,0xd1,0x2,0x0,0xb4,0xff,0x32,0x3a,0x23,0x13,0x70,
+    0x0,0x91,0x13,0xff,0x0,0x3a,0x21,0xfe,0xf7,0xb7,0xfe,0x10,0xef,0x20,0xb,0xe0,
+    0x11,0x19,0x20,0xaa,0xfe,0x12,0xff,0x20,0x20,0x70,0x13,0xbd,0x38,0xb5,0x4,0xbf,
+    0x0,0x25,0x0,0x3c,0x35,0x28,0xa1,0x1,0xa,0xbf,0xd1,0x23,0x0,0xc4,0x33,0x3,
+    0xc1,0x5,0x19,0xfb,0x78,0x20,0xa3,0x0,0x97,0xfe,0x2,0x20,0x28,0xff,0xe0,0x6,
+    0x28,0x8,0xd1,0x9,0x23,0x22,0xdf,0x0,0xc7,0x32,0x19,0x21,0x15,0x6,0x7,0x20,
+    0xf7,0x1d,0xe0,0x10,0xdb,0x0,0xa8,0x78,0x68,0x70,0xff,0x12,0x20,0x17,0xe0,0xf,
+    0x28,0x16,0xd1,0xfd,0x68,0x41,0x0,0x6,0xd1,0x20,0x7e,0xe,0xf0,0xef,0x94,0xfe,
+    0x1,0x21,0x7,0x2,0x98,0xfe,0xe8,0xcf,0x78,0x5,0x28,0x5,0x25,0x0,0x73,0x1,
+    0xd0,0x20,0xf6,0x5b,0x1,0x3d,0xf8,0x31,0x2,0x11,0x20,0x28,0x70,0xff,0x31,0xbd,
+    0x6d,0xa0,0x70,0x47,0x5c,0x20,0xff,0x70,0x47,0x78,0x30,0x0,0x78,0x81,0x42,0x57,
+    0x1,0xd1,0x80,0xf,0x0,0x0,0xf,0x10,0x44,0xb,0x0,0xfc,0xf,0x2,0xa1,0x6,
+    0x30,0x35,0x28,0x7b,0x0,0x28,0xff,0x1a,0xd1,0x28,0x0,0x29,0x68,0xc9,0x68,0xfb,
+    0x88,0x47,0xcd,0x3,0x29,0x7a,0x20,0x0,0x29,0xff,0x30,0x1,0x70,0x68,0x7a,0xc4,
+    0x21,0x60,0xff,0x54,0x0,0x22,0x64,0x21,0x48,0x34,0x20,0xff,0x0,0xc,0xf0,0xed,
+    0xf8,0x1,0x20,0x28,0xff,0x73,0x31,0xbd,0x0,0x22,0x0,0x21,0xa,0x9f,0x20,0xf8,
+    0xf7,0x47,0xff,0xb,0x0,0x47,0x1,0x4,0x5b,0x0,0x0,0x97,0x4,0x4c,0xfe,0x87,
+    0x3,0x75,0x87,0x1,0xbe,0xcd,0x2,0x30,0xfe,0x3c,0x34,0x4,0xb,0x1,0x1,0x2f,
+    0x20,0x60,0x70,0x10,0x27,0x0,0x70,0x6f,0x1,0x13,0x7,0xff,0xa8,0x68,0x69,0x46,
+    0x8,0x80,0x26,0x0,0xfb,0xc8,0x36,0xc7,0x2,0x2,0xd1,0x2,0x20,0x70,0xef,0x70,
+    0xa,0xe0,0x6,0x3b,0x0,0x6a,0xa2,0x20,0xff,0x0,0xe,0xf0,0x85,0xff,0x65,0xa1,
+    0x8,0xff,0x18,0x40,0x78,0x70,0x70,0x30,0x7a,0xf0,0xff,0x70,0xe8,0x78,0xa8,0x70,
+    0x6,0x20,0xe8,0xfe,0x47,0x0,0x68,0x70,0xa8,0x68,0x40,0x1e,0x30,0xbe,0x5,0x0,
+    0x68,0x60,0x3,0x23,0x5e,0x67,0x8,0xfc,0xeb,0xfd,0x5,0xf7,0x0,0x73,0x71,0x5,
+    0x3d,0x20,0x20,0xff,0x5c,0x2,0x28,0x29,0xd0,0x54,0xd3,0x4,0xff,0x28,0x2d,0xd0,
+    0x5,0xd3,0x5,0x28,0x4f,0xfd,0xd1,0xad,0x2,0x8,0x20,0x49,0xe0,0x25,0x0,0xff,
+    0x9c,0x35,0xe0,0x6d,0x68,0x60,0x20,0x0,0xff,0xbc,0x30,0x81,0x78,0x9,0x2,0xc2,
+    0x78,0xff,0x11,0x43,0x29,0x81,0x1,0x79,0x9,0x2,0x7f,0x42,0x79,0x11,0x43,0x69,
+    0x81,0x81,0x9,0x0,0xdd,0xc2,0x9,0x0,0xa9,0x81,0x1,0x1d,0x0,0x40,0x78,0xff,
+    0x1,0x43,0xe9,0x81,0x22,0x7e,0x21,0x0,0xf7,0xa0,0x31,0x7,0xeb,0x0,0xd1,0xfe,
+    0x20,0x0,0xbf,0x5c,0x30,0x1,0x68,0x81,0x63,0x47,0x2,0xf,0xfe,0x4d,0x4,0x12,
+    0x48,0x28,0x81,0x68,0x81,0xa8,0xfa,0x25,0x10,0xbe,0x25,0xc,0xa9,0x7e,0x9,0x2,
+    0xea,0xff,0x7e,0x11,0x43,0x81,0x87,0x29,0x7f,0x9,0xff,0x2,0x6a,0x7f,0x11,0x43,
+    0xc1,0x87,0xa9,0xfa,0x9,0x0,0xea,0x9,0x0,0x29,0x80,0x2,0x7f,0x94,0xb7,0x34,
+    0x21,0x0,0x31,0x2,0xa5,0xfe,0x43,0x3,0xff,0xff,0x7f,0x0,0x0,0x5c,0x0,0x11,
+    0x0,0x94,0xff,0xe0,0x5d,0xb6,0xdd,0x55,0x22,0xaa,0x5e,0xe7,0xdf,0x22,0x0,0x0,
+    0x12,0xf,0x26,0x7b,0xcf,0x30,0xff,0x30,0x30,0x0,0xd1,0x22,0xdb,0x1,0xab,0xf7,
+    0x70,0x28,0x0,0x3,0xa,0xbe,0x30,0xbe,0x45,0xef,0x29,0x5c,0x8f,0x2,0x20,0x0,
+    0x40,0xdd,0x24,0xff,0x6,0x1,0x53,0xd4,0xb2,0x43,0x44,0x0,0xbf,0xd,0x0,0xf9,
+    0x48,0xea,0xd9,0x5b,0x2,0xf6,0xf5,0x9c,0x4a,0x14,0x0,0xf,0x22,0x59,0x4,0xe,
+    0x7,0xff,0xe5,0x3d,0x8,0x7,0x1c,0x16,0x66,0xd,0xff,0x52,0x44,0x7a,0x4e,0x58,
+    0xed,0xed,0x11,0xff,0x6b,0x40,0xbf,0x0,0x6,0x1,0x2,0x3,0xff,0x4,0x5,0x6,
+    0x0,0x6b,0x0,0x87,0x0,0xff,0x2,0x0,0x5,0x0,0xa,0x0,0x16,0x0,0xff,0x32,
+    0x0,0x64,0x0,0x38,0xb5,0x0,0xbf,0xf7,0x4,0x0,0x15,0x8d,0x1,0xf2,0xfc,0xb,
+    0xa1,0xff,0x20,0x0,0x30,0x30,0xe,0xf0,0x29,0xfe,0xff,0x5e,0x48,0x1,0x0,0x8,
+    0x31,0x21,0x60,0xff,0x60,0x30,0x20,0x63,0x22,0x0,0x29,0x0,0xf7,0x20,0x0,0x84,
+    0x17,0x0,0xdf,0xfe,0x0,0x20,0xdf,0x78,0x21,0x60,0x54,0x3d,0x3,0x0,0x20,0x0,
+    0xff,0x32,0xbd,0x2,0x1,0x1d,0x1e,0x0,0x0,0xfb,0xf,0x49,0x7b,0x2,0x2,0x7e,
+    0x91,0x42,0x6,0xff,0xd0,0x9c,0x22,0x82,0x5c,0x91,0x42,0x1,0xff,0xd1,0x84,0x30,
+    0x70,0x47,0x0,0x20,0x70,0xff,0x47,0x1,0x0,0x1,0x20,0xa,0x7e,0x1,0xff,0x23,
+    0x93,0x40,0x9c,0x31,0x9,0x78,0x88,0xff,0x40,0x18,0x43,0x80,0xb2,0x70,0x47,0xf8,
+    0xfe,0xef,0x1,0x0,0x27,0x21,0x0,0x3c,0x31,0xf,0xff,0x76,0x2,0x26,0x3c,0x30,
+    0x46,0x70,0x3,0x7f,0x25,0x20,0x0,0x3c,0x30,0x85,0x70,0x1b,0x1,0xff,0x21,0x20,
+    0x0,0x40,0x30,0xb,0xf0,0x8d,0xef,0xff,0x5,0x22,0x10,0x8f,0x0,0x78,0x30,0xec,
+    0xbf,0xf7,0x9b,0xff,0x70,0x20,0x5d,0x73,0x4,0x7d,0xff,0x30,0x32,0x21,0x1,0x70,
+    0x87,0x70,0x1,0xff,0x21,0x20,0x7e,0xe,0xf0,0x9,0xfd,0x3c,0xff,0x20,0x20,0x5c,
+    0x1,0x28,0x6,0xd1,0x2,0xef,0x23,0x32,0x4a,0x92,0x39,0x0,0xfe,0xf7,0xd2,0xff,
+    0xfc,0x0,0xe0,0x2,0x25,0x3c,0x34,0x25,0xef,0x70,0x0,0x20,0xf2,0x9f,0x1,0x23,
+    0x4,0x70,0xfd,0x60,0x9f,0x2,0x8,0xa0,0x8,0x60,0x1,0x20,0xff,0x8,0x71,0x29,
+    0x4a,0x8a,0x60,0x9a,0x22,0xff,0x52,0x0,0xca,0x80,0x96,0x22,0xd2,0x1,0xff,0xca,
+    0x60,0x8,0x61,0x26,0x4a,0x4a,0x61,0xfb,0x88,0x61,0xad,0x2,0x53,0x54,0x4d,0x69,
+    0x63,0xff,0x72,0x6f,0x65,0x6c,0x65,0x63,0x74,0x72,0xff,0x6f,0x6e,0x69,0x63,0x73,
+    0x20,0x4c,0x53,0xff,0x4d,0x33,0x30,0x33,0x44,0x0,0x0,0x70,0xff,0xb5,0x82,0xb0,
+    0x6,0x0,0xc,0x0,0x20,0xff,0x68,0x1,0x28,0x2,0xda,0x0,0x20,0xa0,0xef,0x60,
+    0x76,0xbd,0xa0,0xb,0x0,0x19,0xdb,0x0,0xff,0x90,0x6,0x23,0x0,0xbf,0x15,0xa2,
+    0x69,0xff,0x46,0x30,0x0,0xf,0xf0,0xbb,0xf9,0x5,0xff,0x0,0x0,0x98,0xa0,0x60,
+    0x17,0xa0,0x40,0xff,0x19,0x40,0x78,0x5c,0x21,0x70,0x54,0xd,0xff,0x48,0xa1,0x68,
+    0x81,0x42,0x7,0xd1,0x21,0xff,0x68,0x42,0x1c,0x91,0x42,0x3,0xdb,0x20,0xf7,0x60,
+    0x1,0xe0,0x3f,0x2,0x21,0x0,0x84,0x36,0xff,0x30,0x0,0xe,0xf0,0x82,0xfe,0x0,
+    0x28,0xff,0x2,0xd1,0x0,0x2d,0x0,0xd5,0x4,0x20,0xff,0x76,0xbd,0xfc,0x46,0x3,
+    0x0,0xd8,0xf7,0xff,0x1,0x0,0x10,0x27,0x0,0x0,0xff,0x7f,0xfa,0xb8,0x0,0xe2,
+    0x2b,0x1,0x71,0x2,0x0,0x80,0x38,0x77,0x1,0x0,0x40,0xdf,0x1,0x20,0x4e,0x0,
+    0x1b,0x4,0xff,0x74,0x60,0x64,0x68,0x6c,0x70,0x74,0x0,0xfe,0x4b,0x3,0xe,0x0,
+    0x35,0x68,0xb7,0x68,0x22,0xff,0x68,0xd2,0x69,0x90,0x47,0x0,0x28,0x21,0xff,0xd1,
+    0xb0,0x68,0x87,0x42,0x2,0xd1,0x30,0xbf,0x68,0x85,0x42,0x1,0xd0,0x5,0x5,0x1,
+    0x20,0xff,0x0,0x3d,0x30,0xc1,0x7f,0x5d,0x22,0xa1,0xff,0x54,0xb1,0x68,0x1,0x29,
+    0x1,0xdb,0x8,0xff,0x21,0x0,0xe0,0x3,0x21,0x41,0x70,0x1,0xff,0x78,0x3,0x29,
+    0x5,0xd1,0x40,0x78,0x8,0xfe,0x7f,0x0,0x20,0x0,0x0,0xf0,0xa9,0xf9,0x31,0x6f,
+    0x0,0x84,0x34,0x20,0x93,0x0,0x62,0xfe,0x3b,0x3,0xfe,0xf3,0x2,0x5,0x0,0x2e,
+    0x0,0x18,0x36,0x30,0xff,0x78,0x98,0x42,0x0,0xd0,0x3,0xe1,0x2c,0xff,0x0,0x38,
+    0x34,0x21,0x79,0x3,0x29,0x7,0xbe,0x71,0x1,0x7f,0x4a,0xa6,0x21,0x28,0x71,0x1,
+    0x19,0xff,0xfc,0x4,0x20,0x27,0xe0,0x4,0x29,0x8,0xbe,0x13,0x0,0x0,0xbf,0x7a,
+    0xa2,0xb0,0x15,0x4,0xe,0xff,0xfc,0x5,0x20,0x1c,0xe0,0x5,0x29,0xa,0xff,0xd1,
+    0x2a,0x0,0x7d,0x32,0x3,0x23,0x10,0xdf,0x78,0x80,0x21,0x1,0x43,0x19,0x2,0x1,
+    0xfc,0xff,0x6,0x20,0xf,0xe0,0x6,0x29,0xf,0xd1,0x7f,0xa0,0x79,0x8,0x28,0x3,
+    0xd1,0x28,0x79,0x0,0xff,0x6c,0xf9,0x1,0xe0,0x3,0x20,0x60,0x71,0xf7,0x84,0x35,
+    0x28,0x7d,0x0,0xf3,0xff,0x0,0x20,0xff,0x20,0x71,0x73,0xbd,0x61,0x79,0x9,0x29,
+    0xff,0x0,0xd9,0xc4,0xe0,0x1,0xa2,0x52,0x5c,0xff,0x52,0x0,0x97,0x44,0xc4,0x4,
+    0xc4,0xc4,0xff,0x3c,0x44,0xc4,0x63,0xc4,0x85,0x28,0x0,0xff,0x2d,0x30,0x0,0x78,
+    0x0,0x28,0xf,0xd1,0xff,0x29,0x0,0x81,0x31,0x28,0x0,0x30,0x30,0xef,0xb2,0x69,
+    0x92,0x68,0xfd,0x2,0x6,0xd0,0x0,0xff,0x22,0x29,0x0,0xa,0x20,0xf8,0xf7,0xd5,
+    0xdf,0xfc,0x0,0x20,0xa4,0xe0,0x1b,0x2,0xb1,0x69,0xf7,0xc9,0x68,0x88,0x1b,0x0,
+    0x14,0xd0,0x21,0x78,0xbf,0x28,0x0,0x29,0x30,0x1,0x70,0x7,0x2,0x84,0x7f,0x30,
+    0xe,0xf0,0xba,0xff,0x60,0x78,0x9f,0x2,0xff,0xd0,0x70,0x2b,0x0,0x80,0x33,0x3,
+    0x21,0xef,0x0,0x91,0x1a,0x0,0xa7,0x2,0x7e,0xe0,0x0,0xd7,0x22,0x0,0x21,0x45,
+    0x2,0xb2,0x45,0x0,0x81,0xe0,0x7f,0xa0,0x79,0x3,0x28,0x0,0xd1,0x7d,0x4d,0x0,
+    0xff,0x0,0xf0,0x16,0xf9,0x73,0xbd,0xe,0xf0,0xff,0xab,0xfb,0x1,0x21,0x30,0x78,
+    0xe,0xf0,0xff,0xaf,0xfb,0x5,0x20,0x20,0x77,0x0,0x20,0xf7,0x60,0x77,0x6,0xbf,
+    0x0,0x0,0x22,0xa5,0x21,0xff,0x49,0x0,0x28,0x0,0x40,0x30,0xb,0xf0,0xfb,0x33,
+    0xfe,0x1f,0x2,0xad,0xfb,0x0,0x28,0x67,0xff,0xd0,0x32,0x78,0x58,0x35,0x29,0x0,
+    0x4,0xfe,0x4f,0x0,0x8a,0xfc,0x73,0xbd,0xa1,0x79,0x8,0xfb,0x29,0x27,0xb9,0x0,
+    0x5d,0x31,0xe,0x7d,0xe,0xfb,0xf0,0x9c,0x21,0x0,0x3,0xd1,0xf,0x2e,0x4,0xff,
+    0xd0,0x0,0x2e,0x2,0xd0,0x60,0x7f,0x4,0xf7,0x28,0x31,0xdb,0x4f,0x2,0x20,0x7f,
+    0x0,0x28,0x5f,0x40,0xd0,0x40,0x1e,0x20,0x59,0x10,0x40,0x1f,0x1,0xaf,0xb,0xf0,
+    0x6,0xfe,0x43,0x6,0x5,0x43,0x4,0x4a,0xff,0x7f,0xb,0x78,0x9a,0x42,0xb,0xd0,
+    0x0,0xdf,0x21,0xe,0xf0,0x68,0xfb,0x83,0x3,0x8b,0xa2,0x7e,0x99,0x7,0x4c,0xfb,
+    0x4,0x20,0x23,0xe0,0x63,0x2,0xd5,0x6a,0x63,0x8,0x16,0x63,0x0,0x14,0x63,0x4,
+    0x11,0xda,0xff,0x60,0x7f,0x40,0x1c,0x60,0x77,0x7,0x20,0xfe,0x43,0x2,0xc8,0x74,
+    0x8,0x20,0x0,0x90,0x2b,0xff,0x0,0x70,0x33,0x2a,0x0,0x70,0x32,0x87,0x9e,0x3d,
+    0x4,0x22,0xfb,0x73,0xbd,0x87,0x2,0xf3,0x2,0xae,0xfb,0xf8,0x8,0x83,0x0,0x73,
+    0xbd,0x1,0x21,0x34,0xef,0x20,0xfd,0xf7,0xbd,0x7f,0x0,0xd4,0xf7,0x1,0xff,0x0,
+    0x30,0x2a,0x1,0x0,0x3d,0x31,0xa,0xff,0x78,0x6,0x2a,0x0,0xd0,0x70,0x47,0x80,
+    0xff,0xb5,0x7,0x22,0xa,0x70,0xcb,0x7d,0x5,0xff,0x2b,0x1,0xda,0x5b,0x1c,0xcb,
+    0x75,0x70,0xaf,0x21,0x42,0x54,0x8,0x51,0x1,0x3,0x55,0x0,0x2,0xfe,0x55,0x4,
+    0xfe,0xf7,0xf8,0xfa,0x1,0xbd,0x38,0xff,0xb5,0x4,0x0,0x20,0x7e,0x98,0x42,0x27,
+    0xff,0xd1,0x20,0x0,0x6c,0x30,0x11,0x68,0x1,0xff,0x60,0x3d,0x21,0x61,0x5c,0x8,
+    0x29,0xf,0x5f,0xd1,0x7,0x21,0x1,0x71,0x87,0x2,0x23,0x31,0x0,0xf5,0x22,0x31,
+    0x4,0x20,0x87,0x0,0xde,0xfa,0x9,0x20,0xff,0x3d,0x34,0x20,0x70,0x31,0xbd,0x6,
+    0x29,0xdf,0xd,0xd1,0x7,0x25,0x5,0x23,0x20,0xcc,0xfa,0x77,0x3d,0x34,0x25,0x21,
+    0x0,0x0,0x0,0x10,0x5d,0x0,0xff,0x7e,0x20,0x21,0x54,0x3c,0x20,0x20,0x5c,0xef,
+    0x2,0x28,0x8,0xd1,0xf,0x3,0x48,0xa2,0x92,0xfe,0x25,0x4,0xc4,0xfa,0x3,0x20,
+    0x0,0xe0,0x1,0xeb,0x20,0x3c,0x4d,0x0,0x10,0x2b,0x0,0x30,0xa0,0x70,0xdf,0x47,
+    0x44,0x20,0x70,0x47,0x91,0x2,0x25,0x0,0xff,0x30,0x35,0x68,0x7b,0x0,0x28,0x25,
+    0xd1,0xff,0x28,0x0,0x29,0x68,0xc9,0x68,0x88,0x47,0xff,0x0,0x28,0x1a,0xd0,0x29,
+    0x7a,0x20,0x0,0xef,0x29,0x30,0x1,0x70,0x7,0x2,0x84,0x30,0xe,0xff,0xf0,0xa2,
+    0xfe,0x22,0x0,0x80,0x32,0x80,0xff,0x21,0x68,0x7a,0x80,0x23,0x3,0x43,0x13,0xdf,
+    0x70,0x1,0x20,0x68,0x73,0x53,0x0,0x90,0x13,0xdf,0x0,0x10,0x78,0x1,0x43,0x63,
+    0x2,0x87,0xfa,0xde,0x85,0x0,0x22,0x0,0x21,0xa,0xeb,0x1,0x94,0xfb,0xfb,0x31,
+    0xbd,0x8f,0x2,0x5d,0x30,0x1,0x78,0x41,0xff,0x77,0x5,0x23,0x22,0x0,0x78,0x32,
+    0xc0,0x77,0x7e,0x80,0x21,0x29,0x6,0x7d,0xfa,0x5,0xd7,0x4,0xfd,0x10,0x23,0x0,
+    0x1,0x0,0x18,0x31,0x2,0x0,0xff,0x64,0x32,0x93,0x68,0x8b,0x64,0xd3,0x7b,0xff,
+    0x1b,0x2,0x94,0x7b,0x23,0x43,0x13,0x80,0xff,0x53,0x7c,0x1b,0x2,0x14,0x7c,0x23,
+    0x43,0xd7,0x53,0x80,0xd3,0x9,0x0,0x94,0x9,0x0,0x93,0x80,0x7f,0xa,0x78,0x60,
+    0x30,0x1,0x0,0x7,0x5d,0x0,0xfb,0x65,0xfb,0xc3,0x2,0x44,0x0,0xf,0x0,0xb1,
+    0xff,0x1f,0x2f,0xe,0xdd,0x55,0x22,0xaa,0x2d,0xe7,0x3e,0x5,0x0,0x0,0x12,0xf,
+    0x22,0xdd,0x24,0x6,0xfd,0x1,0x3,0xa,0x9d,0x85,0x3d,0x5,0x73,0xdb,0xff,0x3f,
+    0x3f,0x26,0x2,0x0,0x0,0x12,0x8,0xff,0x0,0x0,0x70,0xb5,0x1,0x24,0xa6,0x48,
+    0xff,0x1,0x68,0x1,0x20,0x88,0x40,0xc3,0x4d,0x7f,0x1d,0x21,0x41,0x43,0x29,0x80,
+    0x3a,0x5,0x0,0xff,0x69,0x80,0x75,0x21,0x48,0x43,0xa8,0x80,0xff,0xbf,0x48,0x0,
+    0x68,0x84,0x40,0xbf,0x4e,0xff,0xbf,0x48,0x60,0x43,0x31,0x0,0xec,0xf7,0xdf,0x96,
+    0xfe,0x28,0x81,0xbd,0xb,0x8,0x90,0xfe,0x9f,0x68,0x81,0xbb,0x48,0x44,0xd9,0x0,
+    0xd,0x2,0x89,0xef,0xfe,0xa8,0x81,0x70,0xe9,0x1,0x0,0xbf,0x4,0xff,0x0,0x15,
+    0x0,0xe,0xf0,0xe0,0xfa,0xd,0xef,0xa1,0x20,0x0,0x30,0x41,0x1,0xfb,0xfa,0xb3,
+    0xff,0x48,0x1,0x0,0x8,0x31,0x21,0x60,0x78,0xff,0x30,0x20,0x63,0x22,0x0,0x29,
+    0x0,0x20,0xdb,0x0,0x7c,0x17,0x0,0x21,0xfb,0x97,0x1,0x21,0x60,0xff,0x54,0x20,
+    0x0,0xd9,0x30,0xa7,0x21,0x1,0xff,0x70,0x95,0x21,0x1,0x72,0x20,0x0,0x32,0xff,
+    0xbd,0x2,0x1,0x6a,0x6b,0x0,0x0,0xf,0xfd,0x68,0xbf,0x2,0x2,0x7e,0x91,0x42,
+    0x6,0xd0,0xff,0x94,0x22,0x82,0x5c,0x91,0x42,0x1,0xd1,0xdf,0x7c,0x30,0x70,0x47,
+    0x0,0xbd,0x1,0x1,0x0,0xff,0x1,0x20,0xa,0x7e,0x1,0x23,0x93,0x40,0xff,0x94,
+    0x31,0x9,0x78,0x88,0x40,0x18,0x43,0xef,0x80,0xb2,0x70,0x47,0x77,0x3,0x3d,0x30,
+    0x2,0xbf,0x21,0x81,0x70,0x41,0x70,0x1,0x4f,0x0,0x22,0xff,0x0,0x0,0x21,0x20,
+    0x0,0x48,0x30,0xb,0xff,0xf0,0x60,0xfc,0x0,0x20,0x20,0x64,0xc,0xfb,0x20,0xd7,
+    0x7b,0x5,0x2,0xb5,0x69,0x46,0x0,0xff,0xf0,0x7e,0xf8,0x2,0xbd,0x4,0xb5,0x1a,
+    0xff,0x0,0x94,0x23,0xc3,0x5c,0x99,0x42,0x3,0x75,0xd1,0x13,0x2,0x4,0x13,0x0,
+    0x6,0x20,0x2,0x63,0x1,0xfd,0xf8,0x4b,0x0,0xd,0x0,0x16,0x0,0x6,0x22,0xff,
+    0x0,0xbf,0x2e,0xa1,0xc7,0x30,0xec,0xf7,0xab,0x3e,0xfc,0xb,0x2,0x2d,0xd3,0x0,
+    0xd1,0xd,0x0,0x37,0xff,0xfc,0x0,0x2e,0x1,0xd1,0x5,0x20,0x4,0xff,0xe0,0xf6,
+    0x1d,0xb0,0x10,0x40,0xf,0x80,0xff,0x19,0xc0,0x10,0x21,0x0,0xd3,0x31,0x8,0xff,
+    0x70,0x48,0x70,0x88,0x70,0x27,0x0,0xc,0xff,0x37,0x28,0x88,0x38,0x80,0x3,0x23,
+    0x6e,0xfb,0x4a,0x39,0xed,0x0,0xe,0xf0,0xf2,0xfa,0x5,0xfe,0x7,0x0,0x5e,0x30,
+    0xc9,0x49,0x4a,0x19,0x52,0xff,0x78,0x2,0x71,0x26,0x0,0xb2,0x36,0x3a,0xff,0x88,
+    0x32,0x80,0x1b,0xa2,0x6b,0x0,0xd2,0xff,0x18,0x52,0x88,0x72,0x80,0x6a,0x1c,0x2,
+    0xff,0x70,0x33,0x7e,0xe7,0x20,0x18,0x40,0xd2,0xff,0xb2,0x89,0x5c,0xc9,0x0,0x18,
+    0x22,0xa,0xff,0x40,0x2,0x43,0x32,0x76,0x1,0x21,0x38,0xff,0x7b,0xe,0xf0,0x8d,
+    0xf9,0x3c,0x20,0x20,0xff,0x5c,0x1,0x28,0x1,0xd1,0x3,0x20,0x10,0xff,0xe0,0x4,
+    0x28,0x10,0xd1,0x20,0x0,0xff,0xff,0xf7,0x86,0xff,0x30,0x7f,0xc0,0x6,0xc0,0xff,
+    0xe,0x30,0x77,0x4,0x23,0x22,0x0,0xcd,0xfb,0x32,0x10,0xef,0x0,0xfe,0xf7,0x4a,
+    0xf9,0x5,0xfb,0x20,0x3c,0xe9,0x0,0xe8,0xf,0xf2,0xbd,0x1e,0xff,0x38,0x38,0x58,
+    0x0,0x44,0x0,0x0,0x6,0x1d,0x2a,0x4c,0x1,0x83,0x0,0x0,0x39,0x1,0x1,0x4,
+    0xdf,0x6,0xff,0x27,0x0,0xcd,0x37,0x4,0x22,0x27,0xa1,0xfd,0x38,0xbf,0x1,0xce,
+    0xfb,0x3,0x23,0xa3,0x4a,0xee,0x9b,0x3,0xe,0xf0,0x9b,0xad,0x0,0x0,0xbf,0x22,
+    0xbf,0xa0,0x40,0x19,0x40,0x78,0x63,0xa1,0x1,0x26,0xff,0x0,0xb6,0x36,0x1,0x21,
+    0x3c,0x4a,0x12,0xff,0x68,0x91,0x40,0x48,0x43,0x9d,0x21,0x49,0xff,0x0,0x48,0x43,
+    0x3a,0x49,0xec,0xf7,0x8f,0xff,0xfd,0x30,0x80,0x0,0xbf,0x19,0xa0,0x69,0xff,0x0,
+    0x40,0x18,0x40,0x88,0x70,0x80,0x31,0x3e,0xbf,0x0,0x8,0x40,0x63,0x21,0x61,0xbf,
+    0x10,0xb7,0xa,0x7f,0x4,0x20,0xf,0xe0,0x3,0x28,0xf,0xb7,0x4,0xef,0x2a,0xff,
+    0x30,0x7e,0xb7,0x4,0x76,0x4,0x23,0xdb,0x3a,0x0,0xb5,0x6,0xef,0xf8,0xb5,0x6,
+    0x0,0x2d,0x7f,0x1,0xd5,0x2,0x20,0xf2,0xbd,0x0,0x3,0x2,0xff,0x0,0x74,0x4d,
+    0x3,0x0,0x10,0x58,0x4,0xdf,0x0,0x3,0x0,0x1,0x3,0xbb,0xa,0x80,0xb5,0xff,
+    0xa,0x0,0x1,0x7e,0x3,0x68,0x9b,0x6d,0xfb,0x98,0x47,0xab,0x3,0x10,0xb5,0x14,
+    0x0,0x2,0xff,0x0,0x94,0x32,0x13,0x78,0x99,0x42,0x16,0xff,0xd1,0x1,0x21,0x21,
+    0x71,0xa9,0x23,0x5b,0xff,0x0,0xe3,0x80,0xd3,0x8b,0xe3,0x60,0x12,0xff,0x8c,0x22,
+    0x61,0x6e,0x4a,0x62,0x61,0xa1,0x7f,0x61,0x0,0xbf,0x12,0xa1,0x21,0x60,0xc3,0x3,
+    0xff,0x38,0xa1,0xfe,0xf7,0xa,0xf9,0xa0,0x60,0xff,0x0,0x20,0x10,0xbd,0x3,0x7e,
+    0x99,0x42,0xfd,0x7,0x33,0x4,0xb,0x3,0xe3,0x80,0x53,0x8c,0x7f,0xe3,0x60,0x92,
+    0x8c,0xe5,0xe7,0x7,0x19,0x0,0x7f,0x0,0x0,0x20,0x49,0x0,0x20,0x78,0x7f,0x0,
+    0xff,0x50,0x46,0x0,0x0,0x82,0x2c,0x1,0x0,0xff,0x48,0x65,0x2,0x0,0x18,0x5,
+    0xb,0x0,0xff,0x7c,0x3a,0x3,0x0,0x53,0x54,0x4d,0x69,0xff,0x63,0x72,0x6f,0x65,
+    0x6c,0x65,0x63,0x74,0xff,0x72,0x6f,0x6e,0x69,0x63,0x73,0x20,0x4c,0xff,0x53,0x4d,
+    0x36,0x44,0x53,0x30,0x0,0x0,0xff,0x38,0xb5,0x5,0x0,0xc,0x0,0x20,0x68,0xff,
+    0x1,0x28,0x2,0xda,0x0,0x20,0x60,0x60,0xff,0x32,0xbd,0x61,0x68,0x1,0x29,0x10,
+    0xdb,0xff,0x81,0x42,0x1,0xda,0x21,0x60,0x0,0xe0,0xff,0x60,0x60,0x60,0x68,0x0,
+    0x90,0x6,0x23,0xdf,0x10,0xa2,0x69,0x46,0x28,0x6d,0x3,0xfd,0x0,0x7f,0x99,0x61,
+    0x60,0x0,0x99,0xd,0xe0,0x15,0x2,0xeb,0x0,0xbf,0x17,0xa,0x8f,0x17,0x0,0x62,
+    0x68,0x0,0xff,0x2a,0x1,0xd5,0x4a,0x42,0x62,0x60,0x21,0xff,0x60,0x41,0x1c,0x5c,
+    0x35,0x29,0x70,0x0,0x3f,0x28,0x1,0xd5,0x4,0x20,0x32,0x1f,0x1,0x3,0x0,0xff,
+    0x0,0x2a,0x6,0x1,0x0,0xa6,0x41,0x0,0xff,0x0,0xd3,0x20,0x0,0x0,0x69,0x10,
+    0x0,0xff,0x0,0x34,0x8,0x0,0x0,0x1a,0x4,0x0,0x7f,0x0,0xa0,0x86,0x1,0x0,
+    0x20,0x4e,0x17,0x1e,0xfd,0xf8,0x9b,0x0,0xe,0x0,0x34,0x68,0x77,0x68,0xff,0x2a,
+    0x68,0xd2,0x69,0x90,0x47,0x69,0x46,0xff,0x8,0x70,0x68,0x46,0x0,0x78,0x0,0x28,
+    0xff,0x41,0xd1,0x30,0x68,0x84,0x42,0x2,0xd1,0x7f,0x71,0x68,0x8f,0x42,0x1,0xd0,
+    0x5,0x7d,0x1,0xef,0x2c,0x0,0x3c,0x34,0x6d,0x0,0xd1,0x2,0x20,0xff,0x1,0xe0,
+    0x3,0xd5,0x7,0x20,0xa0,0x70,0xff,0x0,0x20,0x9,0xe0,0x1,0x29,0x1,0xdb,0xff,
+    0x5,0x21,0x4,0xe0,0x0,0x29,0x1,0xd5,0xff,0x6,0x21,0x0,0xe0,0x4,0x21,0xa1,
+    0x70,0xff,0xa0,0x60,0x20,0x78,0xb,0x28,0x6,0xd1,0xff,0xa0,0x78,0x2,0x28,0xd,
+    0xd0,0x28,0x0,0xff,0x0,0xf0,0x97,0xfa,0x19,0xe0,0x13,0x28,0xfd,0x17,0x11,0x0,
+    0xe1,0x78,0x88,0x42,0x6,0xd1,0x5f,0x61,0x68,0xa2,0x68,0x91,0x5d,0x0,0x0,0x45,
+    0x0,0xff,0xc,0xe0,0x61,0x78,0x7,0x29,0x9,0xd1,0xff,0xe0,0x70,0x3,0x20,0x60,
+    0x70,0x2,0x22,0xf7,0x7,0x49,0x28,0xff,0x1,0x19,0xf8,0xc,0x20,0xf9,0x20,0x8b,
+    0x4,0xf7,0x3,0x9c,0x2,0x2,0x0,0x28,0xfe,0x7f,0x1,0xff,0x7f,0x0,0x0,0x40,
+    0x4,0x2,0xfe,0x53,0x1,0x4,0x0,0x25,0x0,0x30,0x35,0x28,0xff,0x0,0x29,0x68,
+    0xc9,0x68,0x88,0x47,0x0,0xff,0x28,0x12,0xd0,0x29,0x7a,0x20,0x0,0x29,0xff,0x30,
+    0x1,0x70,0x69,0x7a,0x22,0x0,0xc4,0xff,0x32,0x80,0x20,0x8,0x43,0x10,0x70,0x2,
+    0xff,0x20,0x28,0x73,0x3,0x20,0x0,0x90,0x13,0xff,0x0,0x20,0x0,0xfd,0xf7,0xba,
+    0xff,0x31,0xff,0xbd,0x0,0x22,0x0,0x21,0xa,0x20,0xf8,0xf7,0xf7,0xc7,0xf8,0xb,
+    0x0,0x0,0x70,0xb5,0x82,0xff,0xb0,0x4,0x0,0x26,0x0,0x18,0x36,0x30,0xff,0x78,
+    0x98,0x42,0x0,0xd0,0x76,0xe1,0x25,0xff,0x0,0x38,0x35,0x29,0x79,0x89,0x1e,0x12,
+    0xff,0x29,0x0,0xd9,0x6b,0xe1,0x1,0xa2,0x49,0xff,0x0,0x52,0x5a,0x97,0x44,0x24,
+    0x0,0xce,0xff,0x2,0xce,0x2,0x90,0x0,0xae,0x0,0xe6,0xff,0x0,0x4,0x1,0x42,
+    0x1,0x64,0x1,0xce,0xff,0x2,0xa6,0x2,0xce,0x1,0xe2,0x1,0xf0,0xee,0x9,0x0,
+    0xce,0x2,0x1c,0x3,0x0,0x4c,0x2,0x20,0xf7,0x0,0x2d,0x30,0x3b,0x3,0xf,0xd1,
+    0x21,0x0,0xff,0xc5,0x31,0x20,0x0,0x30,0x30,0xb2,0x69,0xf7,0x92,0x68,0x90,0x9d,
+    0x0,0x6,0xd0,0x0,0x22,0xfb,0x21,0x0,0x77,0x2,0x8b,0xf8,0x1,0x20,0xfc,0xad,
+    0xe0,0x1b,0x2,0xb1,0x69,0xb9,0xc,0x78,0xb9,0x8,0x78,0x7e,0xb5,0x2,0x22,0x0,
+    0xb0,0x32,0x10,0x75,0xc3,0x2,0xae,0xb9,0xe,0x5d,0xff,0x73,0xb9,0xc,0x6a,0x41,
+    0x0,0xdb,0xfe,0x41,0x0,0xb0,0x30,0x41,0x7f,0x81,0x72,0x23,0xef,0x0,0xba,0x33,
+    0x4,0x27,0x0,0x1a,0x0,0x10,0x7d,0x21,0x29,0x2,0x48,0xff,0x6,0x20,0xcc,0x1d,
+    0x4,0xff,0x81,0x7f,0xc2,0x7a,0x91,0x42,0x7a,0xd1,0xff,0xc1,0x7f,0x2,0x7b,0x91,
+    0x42,0x76,0xd1,0xdf,0xd0,0x21,0x61,0x5c,0x42,0x9,0x0,0x71,0xd1,0xff,0x81,0x7e,
+    0xc9,0x6,0xc9,0xe,0x81,0x76,0x7f,0x6,0x23,0x22,0x0,0xc7,0x32,0x1e,0x37,0x4,
+    0xdf,0x37,0xff,0x7,0x20,0xb0,0x37,0x4,0xc1,0x7d,0xf2,0x55,0x6,0x6,0x55,0x4,
+    0x1d,0x6,0x1d,0xff,0x8,0x20,0xed,0xa1,0x1d,0x4,0x1,0x7e,0x55,0x2,0x4f,0xd1,
+    0x41,0xe5,0x7e,0x55,0x2,0x4b,0x4b,0x0,0x53,0x2,0x47,0xd1,0xc1,0xfb,0x7e,0x82,
+    0x7,0x0,0x43,0xd1,0x1,0x7f,0xc0,0xdf,0x7b,0x81,0x42,0x3f,0xd1,0x5b,0x2,0xd1,
+    0x32,0x7d,0x6,0x3d,0x4,0x9,0xff,0x9,0x20,0x82,0x3d,0x0,0xff,0xd0,0x30,0x40,
+    0x78,0x21,0x0,0xb0,0x31,0xf9,0x88,0x5f,0x10,0x21,0x6,0xed,0xfe,0xa,0x20,0x71,
+    0xef,0xe0,0x21,0x0,0xd0,0x35,0x1,0xb0,0x30,0x8a,0xff,0x78,0xc3,0x7a,0x9a,0x42,
+    0x1d,0xd1,0xca,0xff,0x78,0x3,0x7b,0x9a,0x42,0x19,0xd1,0xa,0xfb,0x79,0x43,0x7,
+    0x0,0x15,0xd1,0x4a,0x79,0x83,0xde,0x7,0x0,0x11,0xd1,0x89,0x79,0x63,0x2,0xd,
+    0xd1,0xff,0xa8,0x79,0x2,0x28,0x0,0xd0,0x94,0xe0,0xff,0xe8,0x71,0x3,0x20,0x68,
+    0x71,0x2,0x22,0xfb,0xb1,0x49,0x4b,0x2,0xfc,0xfe,0xc,0x20,0x4b,0x6c,0x1,0x9,
+    0xe7,0x4,0x77,0x4,0x8b,0x0,0xcd,0x32,0x1f,0x7,0xff,0xc3,0xfe,0x5,0x20,0x3c,
+    0xe0,0xe8,0x68,0xff,0xa8,0x60,0x20,0x0,0x5c,0x30,0x1,0x78,0xff,0x41,0x70,0x20,
+    0x0,0x0,0xf0,0x6f,0xf9,0xfb,0x73,0xbd,0x7,0x2,0x97,0xf9,0xb0,0x34,0x21,0xff,
+    0x78,0x61,0x70,0x73,0xbd,0xd,0xf0,0xd1,0xff,0xfe,0x0,0x28,0x1,0xd0,0x10,0x20,
+    0x33,0xff,0xe0,0x30,0x78,0xd,0xf0,0xb4,0xfe,0x1,0x7d,0x21,0x7,0x2,0xb8,0xfe,
+    0xb0,0x34,0x60,0xe3,0x1,0xff,0x19,0xd1,0x13,0x20,0x28,0x71,0xe8,0x79,0xeb,0x68,
+    0x71,0x2b,0x2,0xbb,0x2b,0x0,0xa,0xd0,0x22,0xaf,0x0,0xd9,0x32,0x8,0xb3,0x5,
+    0x27,0x6b,0x4,0x82,0xff,0xfe,0x12,0x20,0x6,0xe0,0xb0,0x34,0x61,0xff,0x78,0x49,
+    0x1e,0x61,0x70,0x9,0x6,0xe5,0xb3,0xd0,0x11,0x33,0x0,0x69,0x6,0xac,0xf9,0x4d,
+    0x2,0x9f,0xfe,0x37,0x0,0x20,0xd0,0x68,0x79,0x7,0x28,0x8,0xfb,0xd1,0x15,0x1b,
+    0x0,0x0,0x22,0x64,0x21,0x48,0xbf,0x34,0x20,0x0,0xb,0xf0,0x15,0x91,0x0,0x14,
+    0xff,0x26,0x5,0x28,0x6,0xd1,0x22,0x0,0xe1,0x7b,0x32,0xf,0x55,0x4,0x15,0x21,
+    0x5,0xe0,0x63,0x1a,0xd7,0x50,0xfe,0x2e,0x51,0x8,0xf3,0xc3,0x4,0xfd,0xf7,0x75,
+    0x85,0x53,0x0,0x12,0x1b,0x5,0x7,0xd1,0xb,0x53,0x0,0x7d,0x2,0x1b,0x1,0xe8,
+    0x71,0x0,0x20,0xa8,0x27,0x8,0xff,0xd1,0xf8,0x73,0xbd,0x1,0x21,0x9,0x20,0xf7,
+    0xfd,0xf7,0xda,0x31,0x0,0x38,0xb5,0x1,0x0,0xff,0x14,0x31,0xc,0x79,0x9c,0x42,
+    0x28,0xd1,0xff,0x12,0x68,0xa,0x60,0x5,0x0,0x3c,0x35,0xff,0x29,0x78,0x11,0x29,
+    0x2,0xd0,0x13,0x29,0xff,0xb,0xd0,0x31,0xbd,0x3,0x0,0xd9,0x33,0xdf,0x8,0x21,
+    0x0,0x91,0x1a,0x6f,0x0,0xfd,0xf7,0xfd,0x19,0xd1,0x0,0x28,0x70,0x31,0xbd,0x14,
+    0x24,0x7f,0x69,0x78,0x5,0x29,0x6,0xd1,0x2,0x9b,0x2,0xb8,0x1d,0x0,0x9b,0x6,
+    0x2b,0x16,0x3,0xfe,0x2c,0x29,0x0,0x70,0xff,0xb5,0x82,0xb0,0x4,0x0,0x26,0x0,
+    0x3c,0xff,0x36,0x30,0x78,0x10,0x28,0xb,0xd1,0x23,0xf8,0x23,0x2,0xf9,0x5,0xbf,
+    0x6,0xf0,0xfd,0xf,0x20,0x30,0xfe,0x6f,0x1,0x15,0x28,0x1d,0xd1,0x20,0x7e,0xd,
+    0xfb,0xf0,0x16,0xbd,0x0,0x15,0xd0,0x14,0x25,0x70,0x39,0x78,0xfb,0x1e,0x3b,0x1a,
+    0xd2,0xfd,0x35,0x39,0x0,0xd3,0x2,0xfd,0x75,0xc9,0x0,0x0,0xa0,0x70,0x47,0x5c,
+    0x0,0xff,0x11,0x0,0x7f,0xf2,0xd4,0x92,0xdd,0x55,0x3f,0x22,0xaa,0x9e,0x8,0x28,
+    0x0,0x0,0x12,0xf,0x26,0xfb,0xe0,0xfe,0x4,0x0,0x4,0xa4,0x70,0x3d,0x3a,0xef,
+    0xf6,0x18,0x9a,0x0,0x3,0xa,0x4e,0x9c,0x10,0xdf,0x50,0x29,0x5c,0x8f,0x2,0x1b,
+    0x0,0x40,0x81,0xff,0x5c,0x13,0x1,0xf0,0x8c,0xe0,0xef,0x5c,0xff,0x20,0x70,0x47,
+    0x94,0x30,0x0,0x78,0x81,0xaf,0x42,0x1,0xd1,0x1,0x6b,0x0,0x0,0xf,0x0,0x44,
+    0x7f,0x0,0xd,0x0,0x1d,0xcd,0x24,0xff,0x6f,0x2,0xeb,0x90,0xa0,0x5e,0x14,0x0,
+    0xf,0x22,0x43,0xd1,0xc5,0xfd,0xc,0x3,0xa,0x60,0x76,0x47,0x50,0xe9,0x10,0xcb,
+    0x11,0xe0,0x53,0xa,0x44,0x4f,0x0,0x53,0x2,0x40,0x4,0x7f,0x2,0x0,0x38,0xb5,
+    0x4,0x0,0x25,0x89,0x1,0xef,0xa8,0x78,0xe8,0x70,0xb9,0x1,0x70,0x3,0x20,0xff,
+    0x68,0x70,0x20,0x0,0xd8,0x30,0x1,0x78,0xff,0xea,0x78,0x7,0x2a,0x3,0xd1,0xfe,
+    0x22,0x7f,0xa,0x40,0x40,0x21,0x2,0xe0,0xbf,0x7,0x0,0xff,0x1,0x21,0x11,0x43,
+    0x1,0x70,0x0,0x21,0xfe,0x3d,0x3,0x69,0xfd,0x2,0x23,0x22,0x0,0xd7,0xbb,0x32,
+    0xc,0x1f,0x5,0x4d,0xfd,0xd,0xad,0x5,0x0,0xfe,0x4f,0x0,0x1,0x0,0xb0,0x31,
+    0x8a,0x7f,0xd2,0xff,0x6,0xd2,0xe,0x4,0x0,0x3c,0x34,0xe3,0xff,0x78,0x5,0x2b,
+    0x2,0xd0,0x8a,0x77,0x0,0xff,0x22,0xb,0xe0,0xa,0xa3,0x5d,0x25,0x45,0xff,0x5d,
+    0x5b,0x5d,0x5b,0x1,0x13,0x43,0x8b,0xff,0x77,0x0,0xbf,0x8,0xa2,0x5d,0x23,0xc3,
+    0xff,0x5c,0xd2,0x5c,0xa,0x70,0x2,0x23,0x2,0xef,0x0,0xcd,0x32,0x10,0xcb,0x1,
+    0x28,0xfd,0xe,0xfb,0x20,0x20,0x49,0x0,0x6,0x1,0x2,0x3,0x4,0xff,0x5,0x6,
+    0x0,0x12,0x2,0xd,0xe,0xf,0xef,0x12,0x0,0x0,0x70,0x57,0x0,0x3c,0x31,0xca,
+    0xff,0x78,0x4,0x2a,0xf,0xd0,0x37,0xd3,0x6,0xff,0x2a,0xc,0xd0,0x2e,0xd3,0x7,
+    0x2a,0x32,0xff,0xd1,0x3,0x0,0xb0,0x33,0x27,0x22,0x9a,0xff,0x76,0xda,0x7e,0x1,
+    0x24,0x14,0x43,0xdc,0xdf,0x76,0x0,0x22,0x20,0xe0,0x13,0x2,0x2,0x0,0xff,0x5d,
+    0x32,0x9d,0x7e,0xe7,0x24,0x2c,0x40,0xff,0x0,0xbf,0x14,0xa5,0x56,0x78,0xad,0x5d,
+    0xff,0xee,0x0,0x18,0x25,0x35,0x40,0x25,0x43,0xff,0x9d,0x76,0xec,0x6,0xe4,0xe,
+    0x7a,0xa5,0x7d,0x16,0x13,0x0,0x6d,0x1,0x25,0x43,0xfb,0x23,0x0,0xff,0x9c,0x76,
+    0xdc,0x7e,0xfe,0x25,0x25,0x40,0xff,0xdd,0x76,0x76,0xa4,0x12,0x78,0xa2,0x5c,0xb7,
+    0x1a,0x70,0x5,0x45,0x4,0x9a,0x7e,0xc7,0x2,0x9a,0xbf,0x76,0xf,0x22,0xa,0x70,
+    0x6,0xa3,0x0,0xc7,0xfb,0x32,0x1e,0xa3,0x0,0xd6,0xfc,0x70,0xbd,0x3,0xef,0x0,
+    0x2,0x3,0xf8,0x3b,0x1,0x3d,0x20,0x20,0xff,0x5c,0x4,0x28,0x4a,0xd0,0x64,0xd3,
+    0x6,0xff,0x28,0x38,0xd0,0x5,0xd3,0x7,0x28,0x5f,0xff,0xd1,0x0,0x22,0x0,0x21,
+    0x8,0x20,0x59,0xff,0xe0,0x26,0x0,0x64,0x36,0x27,0x0,0x14,0xff,0x37,0x38,0x68,
+    0xf0,0x60,0x25,0x0,0xdb,0xff,0x35,0xa8,0x7a,0x0,0x2,0x69,0x7a,0x8,0xff,0x43,
+    0x30,0x82,0x28,0x7b,0x0,0x2,0xe9,0xee,0x9,0x0,0x70,0x82,0xa8,0x9,0x0,0x69,
+    0x7b,0x8,0xef,0x43,0xb0,0x82,0x28,0x1d,0x0,0xe9,0x79,0x8,0xff,0x43,0xf0,0x82,
+    0x3a,0x79,0x21,0x0,0x70,0xff,0x31,0x7,0x20,0xf7,0xf7,0xa9,0xfd,0x38,0x9f,0x68,
+    0x30,0x60,0x28,0x7c,0x19,0x0,0x23,0x2,0x80,0xed,0xa8,0x9,0x0,0x69,0x7c,0x23,
+    0x0,0x80,0x28,0x7d,0xf6,0x13,0x0,0x7c,0x21,0x63,0x4,0x14,0x48,0x30,0x82,0xff,
+    0x70,0x82,0xb0,0x82,0xf0,0x82,0x20,0x0,0xb7,0x14,0x30,0x2,0x3d,0xc,0x8a,0xfd,
+    0x1d,0x2,0x60,0xfb,0x69,0x30,0x7d,0x4,0x68,0x78,0x0,0x2,0x29,0xd5,0x78,0x45,
+    0x2,0xe8,0x9,0x0,0xa9,0x9,0x0,0xf0,0x80,0xf3,0x68,0x79,0x13,0x0,0x73,0x0,
+    0x30,0x81,0x94,0x34,0xef,0x22,0x78,0x31,0x0,0x35,0x2,0x6f,0xfd,0xf1,0xbe,0xc7,
+    0x1,0xff,0x7f,0x0,0x0,0xd0,0xdf,0x0,0x3c,0xff,0x34,0xa2,0x78,0x0,0x2a,0x4e,
+    0xd0,0x11,0xfe,0x28,0x0,0x25,0xd0,0x63,0x78,0x7,0x29,0xe,0xff,0xd1,0x7,0x2b,
+    0x3,0xd1,0x0,0x20,0xa0,0xff,0x70,0x13,0x20,0x43,0xe0,0xe2,0x70,0x3,0xff,0x21,
+    0x61,0x70,0x2,0x22,0x24,0xa1,0xfd,0xff,0xf7,0x74,0xfc,0xc,0x20,0x3a,0xe0,0x7,
+    0xbf,0x2b,0xd,0xd1,0x6,0x29,0x2,0x21,0x4,0xd0,0xd5,0xbd,0x1f,0xa,0x1c,0x1f,
+    0x0,0x64,0x1f,0x0,0x2a,0xe0,0xff,0x66,0x68,0xa7,0x68,0xbe,0x42,0x9,0xd0,0xae,
+    0x19,0xa,0x0,0xbf,0x15,0x1b,0x0,0x56,0x1b,0x0,0x1c,0xf7,0xe0,0x93,0x42,0x37,
+    0x6,0x16,0xe0,0x4,0x2b,0xfd,0x8,0x47,0x1,0x5,0x29,0xa2,0x70,0x1a,0xd1,0xfe,
+    0x27,0x2,0x5,0x21,0xe1,0x70,0x13,0xe0,0x5,0xff,0x2b,0x5,0xd1,0x0,0x21,0xb1,
+    0x22,0x81,0xff,0x54,0xa1,0x78,0xe1,0x70,0x9,0xe0,0x4,0xbf,0x29,0x4,0xd1,0x4,
+    0x20,0x60,0x89,0x0,0x20,0xf2,0x6b,0x0,0x5,0xd,0x0,0x55,0x6,0xff,0xf7,0xbb,
+    0xfe,0xff,0xd0,0xbd,0x10,0x10,0x0,0x20,0x20,0x0,0xff,0x0,0x0,0x6,0x1,0x2,
+    0x3,0x4,0x5,0xff,0x6,0x0,0xe,0x0,0x0,0x2,0x4,0x7,0xff,0xe,0x0,0x70,
+    0xb5,0x1,0x24,0x74,0x48,0xff,0x0,0x68,0x84,0x40,0x74,0x4d,0x74,0x4e,0xff,0x75,
+    0x48,0x60,0x43,0x31,0x0,0xec,0xf7,0xdf,0x65,0xf8,0x28,0x80,0x73,0xb,0x8,0x5f,
+    0xf8,0xff,0x68,0x80,0x71,0x48,0x44,0x43,0x20,0x0,0xbe,0xd,0x2,0x58,0xf8,0xa8,
+    0x80,0x70,0x13,0x1,0x10,0xff,0xb5,0x0,0xbf,0x4,0x0,0xfd,0xf7,0x93,0xff,0xfb,
+    0x0,0xbf,0x8,0xa1,0x20,0x0,0x30,0xff,0x30,0xd,0xf0,0xc9,0xfc,0x68,0x48,0x1,
+    0xff,0x0,0x8,0x31,0x21,0x60,0x60,0x30,0x20,0xff,0x63,0x0,0x20,0x85,0x21,0x60,
+    0x54,0x3c,0xfe,0x3,0x0,0x20,0x0,0x10,0xbd,0x2,0x1,0x6a,0xdf,0x6b,0x0,0x0,
+    0xf,0xd7,0x82,0x0,0x0,0x2,0xff,0x7e,0x91,0x42,0x0,0xd0,0x0,0x20,0x70,0xff,
+    0x47,0x1,0x0,0x1,0x20,0x9,0x7e,0x88,0xff,0x40,0x80,0xb2,0x70,0x47,0x0,0x0,
+    0xf8,0xfe,0x63,0x1,0x68,0x46,0x1,0x80,0x2,0x27,0x21,0xff,0x0,0x3c,0x31,0x4f,
+    0x70,0x22,0x0,0x0,0xff,0x21,0x20,0x0,0x40,0x30,0xa,0xf0,0x42,0xeb,0xfe,0x6,
+    0x1b,0x1,0x2d,0x67,0x0,0x85,0x30,0xeb,0xbf,0xf7,0x3b,0xfe,0x0,0xbf,0x2c,0xb,
+    0x0,0x8b,0xff,0x30,0xa,0x78,0x2,0x70,0x4a,0x78,0x42,0xff,0x70,0x0,0x26,0x20,
+    0x0,0x3c,0x30,0x86,0xef,0x61,0xf,0x20,0x60,0x6f,0x0,0x3,0x23,0x41,0xff,0x4a,
+    0x69,0x46,0x20,0x0,0xd,0xf0,0xf9,0xff,0xfc,0x5,0x0,0x20,0x0,0x89,0x30,0x2,
+    0xff,0x78,0xf0,0x21,0x11,0x40,0x20,0xa2,0x52,0xff,0x19,0x52,0x78,0x12,0x1,0xa,
+    0x43,0x2,0xff,0x70,0x1e,0xa0,0x69,0x0,0x40,0x18,0x41,0xff,0x88,0x20,0x0,0x60,
+    0x30,0x41,0x80,0x1,0xff,0x20,0x33,0x4a,0x12,0x68,0x90,0x40,0x48,0xff,0x43,0x9d,
+    0x21,0x49,0x0,0x48,0x43,0x32,0xff,0x49,0xeb,0xf7,0xe3,0xff,0xa0,0x81,0x0,0xfb,
+    0xbf,0x16,0x27,0x4,0x40,0x88,0x21,0x0,0x60,0xf7,0x31,0x88,0x80,0x8f,0x2,0xc,
+    0x30,0x0,0x7b,0xff,0xd,0xf0,0x6f,0xfb,0x2,0x23,0x2d,0x4a,0xfd,0xa0,0xf,0x0,
+    0xfd,0xf7,0x54,0xfb,0x3,0x20,0xbe,0xe7,0x2,0x1,0x21,0xc,0x34,0x20,0x1b,0x0,
+    0x79,0xff,0xfb,0x0,0x2d,0x1,0xd5,0x2,0x20,0xf2,0xfb,0xbd,0x0,0x3,0x2,0x0,
+    0x20,0xf,0x0,0x8,0xed,0xa0,0xf7,0x0,0x39,0x1,0xb,0x0,0x0,0x10,0x20,0xff,
+    0xd0,0x7,0xf5,0x0,0xf4,0x1,0xd0,0x7,0xfc,0xfd,0x0,0x1,0x4,0x38,0xb5,0x5,
+    0x0,0xc,0x0,0xff,0x84,0x20,0x28,0x5c,0x0,0x28,0xa,0xd0,0x7f,0x0,0xbf,0x19,
+    0xa0,0x20,0x60,0x4,0xef,0x0,0xf7,0x45,0xa1,0x28,0x5d,0x0,0x77,0xfb,0xc0,0x21,
+    0x57,0x8,0xe0,0x1b,0x13,0x0,0x7,0x13,0x0,0x46,0x13,0x4,0xff,0x6d,0xfb,0xa0,
+    0x21,0x49,0x1,0xa0,0x60,0xfd,0xe1,0xb9,0x0,0x20,0x71,0xa9,0x89,0xe1,0x60,0xff,
+    0x64,0x35,0x29,0x88,0x21,0x61,0xa,0x49,0xff,0x61,0x61,0xa0,0x61,0x0,0x20,0x32,
+    0xbd,0xff,0x78,0x4d,0x3,0x0,0xb4,0x49,0x0,0x20,0xff,0x50,0x46,0x0,0x0,0x82,
+    0xc9,0x1,0x0,0xff,0x34,0xfd,0x5,0x0,0xc0,0x7f,0xb,0x0,0xff,0x5c,0x44,0x3,
+    0x0,0xc4,0xb,0x2,0x0,0xff,0xff,0x7f,0x0,0x0,0x53,0x54,0x4d,0x69,0xff,0x63,
+    0x72,0x6f,0x65,0x6c,0x65,0x63,0x74,0xff,0x72,0x6f,0x6e,0x69,0x63,0x73,0x20,0x4c,
+    0x9f,0x33,0x47,0x44,0x32,0x30,0xab,0x0,0x1b,0x2c,0x48,0xff,0x0,0x0,0x70,0xb5,
+    0x82,0xb0,0xc,0x0,0xff,0x61,0x68,0x0,0x29,0x37,0xd0,0x6,0x0,0xff,0x54,0x36,
+    0x0,0x29,0x9,0xd5,0x8,0x0,0xff,0xfa,0x21,0x89,0x0,0xeb,0xf7,0x45,0xff,0xff,
+    0x31,0x68,0x88,0x42,0x2b,0xd0,0x5,0x20,0xff,0x76,0xbd,0x0,0x91,0xf,0x25,0x84,
+    0x21,0xff,0x41,0x5c,0x0,0x29,0xe,0xd0,0x4,0x23,0xff,0x0,0xbf,0x11,0xa2,0x69,
+    0x46,0xd,0xf0,0xff,0xe6,0xff,0x0,0x99,0x61,0x60,0x12,0xa1,0xff,0x9,0x18,0x49,
+    0x78,0xd,0x43,0xb5,0x74,0x7f,0x0,0x21,0xf,0xe0,0x7,0x23,0x10,0x1b,0x4,0xb5,
+    0xd8,0x1b,0x4,0x14,0x1b,0xe,0xbf,0x13,0xb,0x4,0xf1,0x3f,0x74,0x0,0x28,0x1,
+    0xd5,0x4,0x53,0x2,0x3,0x0,0xff,0x1e,0x29,0x0,0x0,0x8f,0x14,0x0,0x0,0xff,
+    0x47,0xa,0x0,0x0,0x23,0x5,0x0,0x0,0xdf,0xc0,0x0,0x40,0x80,0xc0,0xb3,0x0,
+    0x41,0x48,0xff,0x1,0x0,0xd2,0xa4,0x0,0x0,0x95,0x52,0x57,0x0,0x0,0x3f,0x23,
+    0x0,0x9f,0x23,0x0,0x4f,0x23,0x0,0xf5,0x27,0x23,0x0,0xf0,0x23,0x0,0x10,0x70,
+    0xb0,0xf0,0xf7,0x0,0x1,0x1,0x85,0x1,0x0,0x0,0xf8,0xb5,0xff,0x4,0x0,0xe,
+    0x0,0x75,0x68,0x22,0x68,0xff,0xd2,0x69,0x90,0x47,0x7,0x0,0x1e,0xd1,0xdf,0x70,
+    0x68,0x85,0x42,0x1,0xb7,0x0,0xf2,0xbd,0xff,0x25,0x0,0x3c,0x35,0x1,0x28,0x17,
+    0xdb,0xef,0x9,0x21,0x69,0x70,0xd5,0x6,0xda,0xfe,0xa8,0xff,0x61,0x20,0x0,0x60,
+    0x30,0x81,0x79,0x1,0xff,0x70,0xc1,0x79,0x41,0x70,0x28,0x78,0x2,0xff,0x28,0x5,
+    0xd1,0x68,0x78,0x9,0x28,0x2,0x7b,0xd1,0x20,0x5c,0x0,0x91,0xf9,0x38,0x0,0xe9,
+    0x1,0xfb,0x28,0x2,0xa3,0x0,0x68,0x70,0xf8,0xe7,0x2,0x7e,0x5,0x0,0x0,0x20,
+    0xa8,0x61,0xf3,0xe7,0x67,0x2,0xff,0x27,0x0,0x18,0x37,0x38,0x78,0x98,0x42,0xff,
+    0x0,0xd0,0xec,0xe0,0x25,0x0,0x38,0x35,0xff,0x29,0x79,0xa,0x29,0x0,0xd9,0xe2,
+    0xe0,0xff,0x1,0xa2,0x52,0x5c,0x52,0x0,0x97,0x44,0xff,0xe2,0x5,0xe2,0x4f,0xe2,
+    0x61,0x5d,0xe2,0xff,0x81,0xe2,0xa2,0x0,0x20,0x0,0x2d,0x30,0xff,0x0,0x78,0x0,
+    0x28,0x12,0xd1,0x21,0x0,0xff,0x8e,0x31,0x20,0x0,0x30,0x30,0xba,0x69,0xff,0x92,
+    0x68,0x90,0x47,0x0,0x28,0x9,0xd0,0xff,0x0,0x22,0x21,0x0,0xa,0x20,0xf7,0xf7,
+    0xff,0x24,0xfb,0x0,0x20,0x28,0x71,0x84,0x34,0xef,0x20,0x70,0xf1,0xbd,0x2f,0xa,
+    0xe,0xd1,0x26,0xff,0x0,0x84,0x36,0xb0,0x7a,0xd4,0x28,0x9,0x75,0xd1,0x27,0xa,
+    0x10,0x27,0x4,0x1,0x20,0x30,0x27,0x4,0x7f,0x30,0x30,0xb9,0x69,0xc9,0x68,0x88,
+    0x49,0x0,0xff,0xf,0xd0,0x29,0x78,0x20,0x0,0x29,0x30,0xef,0x1,0x70,0x68,0x78,
+    0x35,0x2,0x70,0x72,0x23,0xff,0x0,0x8d,0x33,0x3,0x21,0x0,0x91,0x1a,0xff,0x0,
+    0x80,0x21,0x1,0x43,0x89,0xe0,0x0,0xf7,0x22,0x0,0x21,0x41,0x2,0xef,0xfa,0x0,
+    0x20,0xff,0x8c,0xe0,0x68,0x79,0x2,0x28,0x0,0xd1,0xff,0x88,0xe0,0x4,0x28,0x3,
+    0xd1,0x28,0x71,0xbf,0x0,0x22,0xe9,0x69,0x43,0xe0,0xf5,0x2,0x16,0xdd,0xf9,0x57,
+    0x2,0x0,0xf0,0x24,0x7,0x0,0xd,0xf0,0xff,0xde,0xf9,0x1,0x21,0x38,0x78,0xd,
+    0xf0,0xff,0xe2,0xf9,0x26,0x0,0x60,0x36,0x18,0x20,0x7f,0x30,0x72,0x0,0x20,0x70,
+    0x72,0x7,0x81,0x0,0xff,0x0,0x22,0x19,0x21,0x20,0x0,0x40,0x30,0xef,0xa,0xf0,
+    0x65,0xfc,0x21,0x2,0xdf,0xf9,0x0,0xff,0x28,0x67,0xd0,0x3a,0x78,0x58,0x34,0x21,
+    0xfb,0x0,0x4,0x65,0x0,0xbc,0xfa,0xf1,0xbd,0x69,0xdf,0x79,0x2,0x29,0x28,0xd0,
+    0x39,0x2,0xd,0xf0,0xfd,0xcf,0x1f,0x0,0x4,0xd1,0x30,0x7b,0xf,0x28,0xfb,0x4,
+    0xd0,0x53,0x1,0xd0,0x70,0x7a,0x4,0x28,0xfb,0x31,0xdb,0x4d,0x2,0x30,0x7a,0x0,
+    0x28,0x43,0xef,0xd0,0x40,0x1e,0x30,0x57,0xc,0x40,0x34,0x20,0xdf,0x0,0xa,0xf0,
+    0x39,0xfc,0x41,0x2,0x9,0x29,0xfd,0x7,0x5,0x1,0x60,0x36,0x21,0x0,0x84,0x31,
+    0xff,0x89,0x78,0x32,0x78,0x91,0x42,0xa,0xd0,0xff,0x0,0x21,0xd,0xf0,0x99,0xf9,
+    0x2,0x23,0xf7,0xa0,0xa2,0xa0,0x83,0x0,0xfd,0xf7,0x7e,0xf9,0x7f,0x3,0x20,0x23,
+    0xe0,0xd,0xf0,0x9d,0x63,0xc,0xb5,0x16,0x63,0x0,0x14,0x63,0x4,0x11,0xda,0x3d,
+    0x2,0x70,0xff,0x7a,0x40,0x1c,0x70,0x72,0x26,0x20,0xb0,0xff,0x72,0x9,0x20,0x0,
+    0x90,0x23,0x0,0x6a,0xbf,0x33,0x22,0x0,0x6a,0x32,0xa6,0x3d,0x4,0x54,0xb8,0xe9,
+    0x0,0x87,0x2,0xf5,0x2,0xbc,0xf8,0x9,0x83,0x0,0xf1,0xbb,0xbd,0x1,0x29,0x1,
+    0xfc,0xf7,0xef,0x81,0x0,0x1,0xfb,0x7e,0x99,0xe3,0x1,0x70,0x47,0x10,0xb5,0x82,
+    0xff,0xb0,0x11,0x68,0x80,0x23,0xc1,0x50,0x4,0xff,0x0,0x3c,0x34,0x21,0x78,0x9,
+    0x29,0xf,0xff,0xd1,0x11,0x68,0xe1,0x61,0x26,0x21,0x6a,0xaf,0x22,0x81,0x54,0x9,
+    0x67,0x1,0x3,0x55,0x0,0x2,0xfe,0x55,0x4,0xfd,0xf7,0x2a,0xf9,0xa,0x20,0xe,
+    0xdf,0xe0,0x7,0x29,0xd,0xd1,0x1f,0x26,0x1a,0xf9,0xff,0x8,0x20,0x20,0x70,0x13,
+    0xbd,0x38,0xb5,0xff,0x4,0x0,0x25,0x0,0x3c,0x35,0x28,0x78,0xff,0x7,0x28,0x15,
+    0xd1,0x8,0x20,0x28,0x70,0xff,0x20,0x0,0x68,0x30,0x1,0x78,0x18,0x29,0xff,0x1,
+    0xda,0x49,0x1c,0x1,0x70,0x26,0x21,0xfb,0x81,0x70,0xb1,0x1e,0xfb,0xf8,0x31,0xbd,
+    0x4,0xf7,0x28,0x13,0xd1,0xb1,0x2,0x63,0xf8,0x68,0x78,0xe9,0x9,0xc3,0x1,0xb,
+    0x2,0x38,0x17,0x0,0x2,0x28,0x1,0xff,0xd1,0x28,0x70,0x31,0xbd,0x0,0x22,0xa9,
+    0xed,0x69,0x47,0x7,0x95,0xfb,0xd,0x0,0x0,0x3e,0xa0,0xbf,0x70,0x47,0x5c,0x20,
+    0x70,0x47,0x71,0x6,0x30,0xff,0x35,0x28,0x7b,0x0,0x28,0x1e,0xd1,0x28,0xff,0x0,
+    0x29,0x68,0xc9,0x68,0x88,0x47,0x0,0xff,0x28,0x13,0xd0,0x29,0x7a,0x20,0x0,0x29,
+    0xff,0x30,0x1,0x70,0x22,0x0,0x8d,0x32,0x68,0xff,0x7a,0x10,0x70,0x1,0x20,0x28,
+    0x73,0x3,0xfe,0x7b,0x0,0x13,0x0,0x10,0x78,0x80,0x21,0x1,0x75,0x43,0x79,0x2,
+    0xbe,0x61,0x0,0x0,0x22,0x0,0x1d,0x1,0x7f,0xf7,0xf7,0xcb,0xf9,0x31,0xbd,0x10,
+    0x4d,0x0,0xff,0x22,0x0,0x8b,0x32,0x61,0x20,0x20,0x5c,0xef,0x50,0x70,0x2,0x23,
+    0x29,0xe,0xb4,0xf8,0x6,0xbf,0x20,0x3c,0x34,0x20,0x70,0x10,0x23,0x8,0x85,0xeb,
+    0x32,0x60,0x23,0x4,0x6,0x23,0x10,0xa2,0xf8,0x5,0xfe,0x23,0x8,0x0,0x0,0x10,
+    0xb5,0x1,0x0,0x74,0xff,0x31,0x2,0x0,0x3c,0x32,0x13,0x78,0xa,0xff,0x2b,0x18,
+    0xd1,0xd3,0x69,0x13,0x62,0xca,0xff,0x68,0xa,0x60,0x2,0x0,0x6b,0x32,0xd3,0xff,
+    0x78,0x1b,0x2,0x94,0x78,0x23,0x43,0x8b,0xff,0x80,0x53,0x79,0x1b,0x2,0x14,0x79,
+    0x23,0xaf,0x43,0xcb,0x80,0xd3,0x9,0x0,0x94,0x9,0x0,0xb,0xff,0x81,0x12,0x78,
+    0x52,0xb2,0x4a,0x81,0x3,0xff,0xe0,0x5,0x4a,0x8a,0x80,0xca,0x80,0xa,0x6f,0x81,
+    0x2,0x7e,0x7,0x9d,0x0,0x7c,0xf9,0x55,0x2,0xff,0x0,0x0,0xff,0x7f,0x0,0x0,
+    0x5c,0x0,0xff,0x11,0x0,0x38,0xd7,0x66,0x34,0xdd,0x55,0x1f,0x22,0xaa,0x9e,0x8,
+    0x28,0x16,0x2,0x0,0xc,0xf,0x30,0xff,0xc0,0xa4,0x70,0x3d,0x3a,0xa4,0x54,0xb6,
+    0xfd,0x0,0x3,0xa,0x4e,0x9c,0x10,0x50,0x29,0x5c,0xfb,0x8f,0x2,0x1b,0x0,0x40,
+    0x6f,0x2,0xad,0x0,0xcf,0x3f,0x4f,0x40,0x91,0x77,0x1,0xbb,0x0,0x0,0xbf,0xff,
+    0x4,0x0,0xfc,0xf7,0xf7,0xff,0x0,0xbf,0xff,0x7,0xa1,0x20,0x0,0x30,0x30,0xd,
+    0xf0,0xff,0x2d,0xf9,0x30,0x48,0x1,0x0,0x8,0x31,0xff,0x21,0x60,0x60,0x30,0x20,
+    0x63,0x0,0x20,0xff,0x4e,0x21,0x60,0x54,0x20,0x0,0x10,0xbd,0xff,0x4,0x2,0xc,
+    0xd,0xe,0xf,0x0,0x48,0xff,0x1,0x99,0x0,0x0,0x2,0x7e,0x91,0x42,0xf7,0x0,
+    0xd0,0x0,0x95,0x1,0x1,0x0,0x1,0x20,0xff,0x9,0x7e,0x88,0x40,0x80,0xb2,0x70,
+    0x47,0xfb,0x0,0x0,0xa3,0x3,0xd,0x0,0x4e,0x30,0x2,0xff,0x21,0x1,0x70,0x3,
+    0x21,0x41,0x70,0x0,0xff,0x20,0x20,0x65,0x20,0x0,0xc,0x30,0x5,0xff,0x80,0x1,
+    0x21,0x0,0x7b,0xd,0xf0,0x33,0x7f,0xf8,0x2,0x23,0x95,0xa2,0xa,0x21,0x43,0x3,
+    0xff,0x0,0xf8,0x17,0x48,0x85,0x42,0x1,0xdb,0xdf,0x3,0x20,0x32,0xbd,0x0,0x3,
+    0x0,0x8,0xa0,0xff,0x8,0x60,0x1,0x20,0x8,0x71,0x12,0x4a,0xff,0x8a,0x60,0xff,
+    0x22,0x20,0x32,0xca,0x80,0xff,0x11,0x4a,0xca,0x60,0x3,0x22,0xa,0x61,0xbf,0x88,
+    0x61,0xf,0x48,0x48,0x61,0x6d,0x2,0x41,0xff,0x4b,0x4d,0x20,0x41,0x4b,0x38,0x39,
+    0x36,0xff,0x33,0x0,0x0,0x88,0x68,0x1,0x28,0x2,0xbf,0xda,0x0,0x20,0x0,0x22,
+    0x5,0x41,0x1,0x90,0xff,0x42,0x1,0xda,0x4,0x20,0x0,0xe0,0x0,0xff,0x20,0x8a,
+    0x60,0x70,0x47,0xc,0x43,0x3,0xd7,0x0,0xe1,0xbf,0xdf,0x0,0x27,0xe4,0x0,0x33,
+    0x1,0xfa,0x4b,0x5,0x70,0x9b,0x0,0xe,0x0,0xb5,0x68,0x22,0xff,0x68,0xd2,0x69,
+    0x90,0x47,0x0,0x28,0x2a,0xf7,0xd1,0xb0,0x68,0x7f,0x0,0xd0,0x5,0x20,0x70,0xff,
+    0xbd,0xfa,0x21,0x89,0x0,0xeb,0xf7,0x2e,0xff,0xfc,0x20,0x65,0x0,0x28,0x1,0xd1,
+    0x7,0xfe,0x47,0x0,0xa,0x20,0x25,0x0,0x4e,0x35,0x68,0xff,0x70,0x68,0x78,0xa,
+    0x28,0x14,0xd1,0x28,0xff,0x78,0x3,0x28,0x7,0xd1,0x2,0x23,0xbc,0xfe,0xbb,0x4,
+    0xfc,0xf7,0xa2,0xff,0x4,0x20,0x8,0xeb,0xe0,0x7,0x13,0x4,0xb8,0x13,0x8,0x98,
+    0xff,0x9,0xeb,0x20,0x28,0xf1,0x0,0x70,0xbd,0x1,0x70,0xb5,0x82,0xff,0xb0,0x5,
+    0x0,0x2e,0x0,0x18,0x36,0x30,0xfb,0x78,0x98,0x29,0x1,0xaf,0xe0,0x2c,0x0,0x38,
+    0xff,0x34,0xa1,0x7d,0x49,0x1e,0xa,0x29,0x0,0xff,0xd9,0xa8,0xe0,0x1,0xa2,0x52,
+    0x5c,0x52,0xff,0x0,0x97,0x44,0x5,0x35,0xa4,0x37,0x45,0xff,0x56,0xa4,0x96,0x5e,
+    0xa4,0x66,0x0,0x28,0xff,0x0,0x2d,0x30,0x0,0x78,0x0,0x28,0xf,0xbf,0xd1,0x29,
+    0x0,0x46,0x31,0x28,0x8b,0x1,0xb2,0xf7,0x69,0x92,0x68,0xa9,0x2,0x6,0xd0,0x0,
+    0x22,0xff,0x29,0x0,0xa,0x20,0xf7,0xf7,0x6e,0xf8,0xef,0x0,0x20,0x88,0xe0,0x1b,
+    0x2,0xb1,0x69,0xc9,0xfb,0x68,0x88,0x1b,0x0,0xc,0xd0,0x21,0x78,0x28,0xff,0x0,
+    0x29,0x30,0x1,0x70,0x61,0x78,0x61,0xff,0x73,0x3,0x20,0x0,0x90,0x2b,0x0,0x45,
+    0xff,0x33,0x2a,0x0,0x45,0x32,0x45,0xe0,0x0,0xd7,0x22,0x0,0x21,0x35,0x2,0x53,
+    0x35,0x0,0x6d,0xe0,0xff,0x3,0x20,0x6b,0xe0,0x10,0x20,0x20,0x71,0xf4,0x25,0x1,
+    0x23,0x0,0x3c,0x23,0x0,0x3c,0x32,0x10,0x21,0xfd,0x28,0xb9,0x0,0x30,0xff,0x5,
+    0x20,0x5d,0xe0,0x7f,0x60,0x79,0x80,0x38,0x20,0x82,0xa0,0x5,0x0,0xf7,0x60,0x82,
+    0xe0,0x5,0x0,0xa0,0x82,0x2,0x23,0xf9,0x2a,0xdb,0x0,0x21,0x2,0x2a,0xff,0x6,
+    0x20,0x4c,0xaf,0xe0,0x2,0x23,0x7d,0xf,0x8,0x22,0xeb,0x0,0x44,0xff,0xe0,0xc,
+    0xf0,0x2b,0xff,0x1,0x21,0x30,0xff,0x78,0xc,0xf0,0x2f,0xff,0x30,0x78,0x18,0x5c,
+    0x97,0x0,0xc1,0x6,0xc,0xd0,0x2,0x67,0x0,0x9,0x67,0x10,0xfd,0x2,0x35,0x4,
+    0xfc,0xfe,0x73,0xbd,0x28,0x0,0xff,0x0,0xf0,0x70,0xf8,0x30,0x78,0xe1,0x7d,0xff,
+    0xa,0x29,0xb,0xd1,0xc,0xf0,0x20,0xff,0xff,0x0,0x28,0x5,0xd0,0x32,0x78,0x14,
+    0x35,0xff,0x29,0x0,0x4,0x20,0xf6,0xf7,0xfd,0xff,0xff,0xa,0x20,0x17,0xe0,0x0,
+    0x21,0xc,0xf0,0xdf,0x5,0xff,0x2,0x23,0xa,0x6f,0x8,0xea,0xfe,0xff,0x8,0x20,
+    0xc,0xe0,0xe0,0x7d,0xa,0x28,0xdd,0x8,0x71,0x1,0x0,0xbf,0x5b,0x17,0x8,0xde,
+    0xfe,0xfe,0x65,0x0,0xe0,0x7,0x20,0xa0,0x75,0x73,0xbd,0xf7,0xa,0x10,0x10,0x75,
+    0x1,0x1,0x0,0x14,0x31,0xff,0xc,0x79,0x9c,0x42,0x11,0xd1,0x4,0x0,0xff,0x3c,
+    0x34,0xa3,0x7c,0xa,0x2b,0xc,0xd1,0xff,0x12,0x68,0xa,0x60,0x2,0x21,0x21,0x70,
+    0xdf,0x9,0x21,0x0,0x91,0x23,0x14,0x1,0x2,0x21,0xff,0xfc,0xf7,0xb6,0xfe,0xb,
+    0x20,0xa0,0x74,0xfd,0x13,0xab,0x1,0x36,0xa0,0x70,0x47,0x44,0x20,0xff,0x70,0x47,
+    0x38,0xb5,0x4,0x0,0x25,0x0,0xff,0x30,0x35,0xa8,0x7f,0x0,0x28,0x1d,0xd1,0xfa,
+    0x53,0x1,0x68,0x61,0x7,0x12,0xd0,0x29,0x7a,0x20,0xfe,0x61,0x5,0x68,0x7a,0x68,
+    0x75,0x1,0x20,0xa8,0xd5,0x77,0x65,0x3,0x23,0x65,0x1,0x22,0x65,0x1,0x69,0x7d,
+    0xde,0xfb,0x3,0x8f,0xfe,0x31,0xbd,0x6d,0x7,0xf6,0xf7,0xff,0x9c,0xff,0x31,0xbd,
+    0xf8,0xb5,0x1,0x0,0xff,0x54,0x31,0x2,0x0,0x14,0x32,0x13,0x68,0xff,0xb,0x60,
+    0x3e,0x30,0x83,0x79,0x1b,0x7,0xff,0x3,0xd5,0x1b,0x48,0x88,0x80,0xc8,0x80,0xff,
+    0x2b,0xe0,0x43,0x78,0x1c,0x2,0x3,0x78,0xff,0x1c,0x43,0x8c,0x80,0xc3,0x78,0x1d,
+    0x2,0xff,0x83,0x78,0x1d,0x43,0xcd,0x80,0x43,0x79,0xff,0x1b,0x2,0x6,0x79,0x33,
+    0x43,0xb,0x81,0xff,0x24,0xb2,0xa,0x26,0x86,0x5f,0x66,0x43,0xff,0xf7,0x11,0x3f,
+    0xe,0xbe,0x19,0x36,0x12,0xff,0xa4,0x19,0x8c,0x80,0x2d,0xb2,0xc,0x24,0xff,0x4,
+    0x5f,0x6c,0x43,0xe6,0x11,0x36,0xe,0xff,0x34,0x19,0x24,0x12,0x2c,0x19,0xcc,0x80,
+    0xff,0x1b,0xb2,0xe,0x24,0x0,0x5f,0x58,0x43,0xff,0xc4,0x11,0x24,0xe,0x20,0x18,
+    0x0,0x12,0x7f,0x18,0x18,0x8,0x81,0x12,0x79,0x7,0x81,0x0,0xf7,0x5b,0xff,0xf1,
+    0xd7,0x0,0x0,0x80,0xff,0xff,0xff,0x44,0x0,0xf,0x0,0x57,0xfd,0x1c,0xc4,0x7f,
+    0xdd,0x55,0x22,0xaa,0xe9,0x26,0x31,0x14,0x0,0xbc,0x0,0xe,0xf,0x22,0x79,0xe9,
+    0x26,0x1,0x3,0xa,0xff,0xff,0xff,0xff,0x7f,0x63,0x7b,0xa9,0xd,0xa,0xff,0x1f,
+    0x0,0x0,0xa,0x16,0x0,0x0,0x10,0xff,0xb5,0x0,0xbf,0x4,0x0,0x0,0xbf,0x72,
+    0xff,0xa2,0xd,0xf0,0x65,0xfb,0x1f,0x48,0x1,0xff,0x0,0x8,0x31,0x21,0x60,0x68,
+    0x30,0x20,0xbf,0x63,0x20,0x0,0x10,0xbd,0x70,0x3d,0x1,0xe,0xfb,0x0,0x15,0x4,
+    0x1,0x0,0x21,0x88,0x30,0xa,0xff,0xf0,0xb0,0xf8,0x0,0x20,0xe0,0x67,0x2a,0xff,
+    0x0,0x31,0x0,0x20,0x0,0xd,0xf0,0x73,0xff,0xfb,0x70,0xbd,0x10,0xb4,0x2,0x0,
+    0x0,0xff,0x23,0x0,0x20,0x8c,0x68,0x1,0x2c,0x1,0xff,0xda,0x8b,0x60,0x4,0xe0,
+    0xf,0x4b,0x9c,0xfd,0x42,0x9,0x4,0x20,0x1,0x21,0x61,0x32,0x11,0x5f,0x70,0x10,
+    0xbc,0x70,0x47,0x67,0x2,0xc,0x31,0x0,0xff,0x87,0xfb,0x55,0xa0,0x20,0x60,0x6,
+    0x48,0xfd,0xa0,0x3,0x0,0xe0,0x80,0xa,0x20,0x20,0x61,0xff,0x1,0x20,0xa0,0x61,
+    0x4,0x48,0x60,0x61,0xff,0x0,0x20,0x10,0xbd,0x48,0x40,0x3,0x0,0xff,0xe0,0x2e,
+    0x0,0x0,0x9a,0x9,0x0,0x0,0x55,0xff,0x9f,0x0,0x39,0xc3,0x9,0x4b,0x7,0x0,
+    0xf8,0x89,0x0,0xfd,0xf,0x89,0x0,0x1e,0x0,0x10,0x30,0x1,0x7a,0xff,0xb1,0x42,
+    0x2a,0xd1,0x21,0x0,0x50,0x31,0xff,0xa,0x78,0xa,0x2a,0x4,0xd0,0xc,0x2a,0xff,
+    0x16,0xd0,0xd,0x2a,0xb,0xd0,0x1a,0xe0,0xff,0xb,0x22,0xa,0x70,0x0,0x68,0xfa,
+    0x21,0xff,0x89,0x0,0xeb,0xf7,0x32,0xfa,0x2,0x0,0xff,0x1,0x0,0x88,0x34,0x4,
+    0xe0,0xe,0x20,0xff,0x8,0x70,0x0,0x22,0x9,0x21,0x68,0x34,0xff,0x20,0x0,0xa,
+    0xf0,0x55,0xf8,0xf1,0xbd,0xff,0x48,0x78,0x7,0x28,0x3,0xd1,0x20,0x0,0xfe,0xd3,
+    0x2,0x5e,0xf8,0x33,0x0,0x2a,0x0,0x39,0xbe,0xd1,0x4,0x74,0xfb,0xf1,0xbd,0x38,
+    0x69,0x0,0x50,0xbf,0x20,0x20,0x5c,0xb,0x28,0xe,0x21,0x4,0x81,0xff,0x42,0x1c,
+    0xd1,0xd,0x20,0x50,0x21,0x60,0xff,0x54,0x2,0x23,0x22,0x0,0x80,0x32,0x31,0xff,
+    0x21,0x20,0x0,0xfc,0xf7,0x8c,0xfd,0x31,0xaf,0xbd,0xe,0x28,0xf,0x21,0x0,0x68,
+    0x21,0x0,0xb,0xff,0xd1,0x25,0x0,0x14,0x35,0xb,0xf0,0x88,0xff,0xfa,0x28,0x60,
+    0x2b,0x79,0x2a,0x0,0x4,0x7e,0x23,0x0,0xd,0xf0,0x16,0xfc,0x31,0xbd,0x7,0x2,
+    0xfd,0x2e,0x7,0x0,0x70,0x47,0x1,0x0,0x4a,0x31,0xff,0x41,0x30,0x2,0x78,0x52,
+    0x0,0xa,0x80,0xfd,0x42,0x5,0x0,0x4a,0x80,0x80,0x78,0x40,0x0,0xf3,0x88,0x80,
+    0xe3,0x0,0xd9,0x0,0x5b,0xa1,0x2d,0xf6,0xce,0xcf,0x3,0xa6,0x9b,0xc4,0xbf,0x15,
+    0xf,0x22,0x80,0xb7,0xf3,0x40,0x2,0x3,0xa,0xcf,0x3,0x13,0xf,0x91,0xd6,0xff,
+    0x41,0x4b,0x4d,0x20,0x41,0x4b,0x30,0x39,0xff,0x39,0x31,0x31,0x0,0x2,0x2,0xc,
+    0xd,0xae,0x2a,0x0,0x48,0x1,0x5,0xdf,0xf,0x44,0xdf,0x1,0x75,0xfb,0xfa,0x1c,
+    0xdf,0x19,0x0,0x0,0x38,0xb5,0x5,0xff,0x0,0xc,0x0,0xa0,0x68,0x0,0x90,0x0,
+    0xff,0x28,0x12,0xd0,0x4,0x23,0x36,0xa2,0x69,0xfb,0x46,0x28,0xb3,0x0,0x45,0xfa,
+    0x0,0x99,0xa1,0xff,0x60,0x0,0xbf,0x30,0xa1,0x9,0x18,0x49,0xff,0x78,0x61,0x35,
+    0x29,0x70,0x0,0x28,0x1,0x3f,0xd5,0x4,0x20,0x32,0xbd,0x0,0x3,0x2,0xcf,0x9,
+    0xd7,0x9f,0xfa,0x25,0xcf,0x1,0x7,0xcf,0x1,0x80,0x20,0xdf,0xc0,0x0,0xe0,0x80,
+    0x3,0xd1,0x19,0x0,0x0,0xed,0xc0,0xd3,0x1,0x10,0x27,0xcf,0x1,0x7f,0x0,0x0,
+    0x65,0x9,0xcf,0x9,0x21,0x7,0x0,0xd,0xb,0x80,0x3a,0xd,0x3,0xdb,0x80,0x3a,
+    0xd,0x3,0x80,0x38,0xd,0x3,0x0,0x0,0xde,0xf,0x3,0x80,0x84,0x4c,0x8a,0xf,
+    0x3,0xe9,0x26,0x39,0x31,0xff,0x14,0xf,0x22,0xe0,0xbe,0xe,0x3,0xc,0xf,0x3,
+    0xef,0x5,0x74,0xc2,0x4a,0xf,0xf,0x32,0x0,0x8,0xef,0x2,0x4,0x6,0x8,0x2b,
+    0x0,0xa0,0x86,0x1,0x7f,0x0,0x50,0xc3,0x0,0x0,0x20,0x4e,0xbf,0x0,0x1a,0x93,
+    0x0,0x4,0x27,0x1,0xe,0xf,0x27,0x1,0x20,0x1,0x27,0x3,0xff,0x86,0xb0,0x4,
+    0x0,0x3c,0xa0,0x4,0x90,0xff,0x4,0x20,0x3,0x90,0xa,0x48,0x2,0x90,0xff,0x80,
+    0x20,0x40,0x1,0x1,0x90,0x0,0x20,0xff,0x0,0x90,0xa0,0x23,0xdb,0x0,0xa,0x22,
+    0xae,0xcb,0x3,0xe7,0xfb,0x5,0x43,0x9,0x64,0x43,0x5,0x6,0xff,0xb0,0x10,0xbd,
+    0xfe,0x1f,0x0,0x0,0xb0,0x39,0x41,0xe7,0x0,0x13,0x5,0x34,0xfc,0x27,0x13,0x1,
+    0xfd,0x2,0xfd,0x14,0xef,0x8,0x10,0xb4,0x1,0x0,0x4c,0x31,0xfd,0x3d,0xed,0x0,
+    0xd2,0x0,0xfe,0x23,0x9b,0x0,0xfb,0x13,0x40,0xff,0x1,0x9,0x13,0x43,0xb,0x80,
+    0xff,0xfe,0x22,0x52,0x1,0x83,0x78,0x9b,0x1,0xff,0x13,0x40,0xc4,0x78,0xa4,0x8,
+    0x23,0x43,0x6f,0x4b,0x80,0x3,0x79,0xd,0x2,0x44,0x79,0xd,0x2,0xf7,0x8b,0x80,
+    0x83,0xd,0x0,0x1a,0x40,0xc0,0x79,0xff,0x80,0x8,0x2,0x43,0xca,0x80,0x10,0xbc,
+    0xbc,0x4f,0x0,0x1b,0x1,0x18,0x59,0xa0,0x9d,0x1b,0x3,0xc6,0x73,0x6d,0x34,0xb,
+    0x15,0xf,0x22,0x6f,0x12,0x83,0x3,0xc,0xfe,0x1b,0x3,0x29,0xd0,0x7,0x36,0x59,
+    0x61,0x6d,0xff,0x61,0x68,0x61,0x20,0x59,0x41,0x53,0x35,0xbb,0x33,0x33,0x27,0x0,
+    0x1,0x1,0x2e,0x5,0x0,0x80,0xfd,0x2,0x33,0x2,0xf0,0xb5,0x1,0x24,0x86,0x48,
+    0xff,0x0,0x68,0x84,0x40,0x86,0x4d,0xfa,0x26,0xff,0xb6,0x0,0x85,0x48,0x60,0x43,
+    0x31,0x0,0x7f,0xeb,0xf7,0x8e,0xf8,0xa8,0x81,0x83,0xb,0x8,0xdf,0x88,0xf8,0xe8,
+    0x81,0x81,0xb,0x8,0x82,0xf8,0xf7,0x28,0x82,0xc0,0xb,0x8,0x7c,0xf8,0x68,0x82,
+    0xf7,0xbe,0x4e,0xbf,0xd,0x8,0x75,0xf8,0x7,0x0,0xf7,0x2f,0x80,0xbc,0xd,0x0,
+    0xbc,0x49,0xeb,0xf7,0x5f,0x6e,0xf8,0x68,0x80,0xbb,0xb,0x0,0xbb,0xb,0x0,0xff,
+    0x68,0xf8,0xa8,0x80,0xba,0x48,0x44,0x43,0xfb,0x20,0x0,0x27,0x2,0x61,0xf8,0xe8,
+    0x80,0x2f,0xf7,0x81,0xf0,0xbd,0x83,0x7,0x4,0x0,0xfc,0xf7,0xff,0x9b,0xfb,0x0,
+    0xbf,0xa,0xa1,0x20,0x0,0x7f,0x30,0x30,0xc,0xf0,0xd1,0xfc,0xb1,0x6f,0x9,0xfd,
+    0x60,0x6f,0x1,0x0,0x20,0x3c,0x21,0x60,0x54,0xff,0x22,0x0,0x0,0x21,0x20,0x0,
+    0x40,0x30,0xff,0x9,0xf0,0x68,0xfe,0x20,0x0,0x10,0xbd,0xff,0x4,0x1,0x10,0x11,
+    0x18,0x19,0x0,0xfb,0xfe,0xbf,0x2,0x2,0x7e,0x91,0x42,0x0,0xd0,0x0,0xfe,0x75,
+    0x1,0x1,0x0,0x1,0x20,0x9,0x7e,0x88,0xff,0x40,0x80,0xb2,0x70,0x47,0x0,0x0,
+    0xf8,0xff,0xb5,0x4,0x0,0xd,0x0,0x17,0x0,0x0,0xff,0x26,0x21,0x0,0x6a,0x31,
+    0xe,0x71,0x5,0xfe,0x49,0x4,0x2,0x20,0x21,0x0,0x3c,0x31,0x48,0xef,0x70,0xf,
+    0x22,0x2f,0x6f,0x0,0x80,0x30,0xea,0xbf,0xf7,0x53,0xfe,0x6,0x22,0x30,0xb,0x0,
+    0x7a,0xfe,0xb,0x0,0x39,0xfe,0x0,0x2f,0x1,0xd1,0xa,0xff,0x20,0x4,0xe0,0xff,
+    0x1c,0x78,0x10,0x80,0xdf,0xf,0xc0,0x19,0x80,0x10,0x3d,0x2,0x48,0x75,0xff,0x20,
+    0x0,0x3c,0x30,0xc6,0x61,0xb,0x20,0xfd,0x69,0x43,0x0,0x27,0x0,0xc,0x37,0x3d,
+    0x80,0xff,0x3a,0x4e,0x4,0x23,0x32,0x0,0xc,0x32,0xff,0x39,0x0,0x20,0x0,0xc,
+    0xf0,0xef,0xfc,0xff,0x5,0x0,0x0,0xbf,0x20,0xa0,0x40,0x19,0xfb,0x40,0x78,0x31,
+    0x2,0x8,0x76,0x1f,0xa0,0x69,0xff,0x0,0x40,0x18,0x40,0x88,0x38,0x80,0xfa,0xff,
+    0x21,0x89,0x0,0xea,0xf7,0xe3,0xff,0x1,0xff,0x21,0x2c,0x4a,0x12,0x68,0x91,0x40,
+    0x48,0xdf,0x43,0x79,0x49,0x48,0x43,0x15,0x6,0xdb,0xff,0x7f,0x6a,0x21,0x60,0x52,
+    0x68,0x0,0x30,0x29,0x0,0xfe,0x69,0x4,0x80,0x0,0x21,0x38,0x7b,0xc,0xf0,0x7f,
+    0x6a,0xfb,0x2,0x23,0x71,0x4a,0x11,0xf5,0x0,0xef,0xfc,0xf7,0x4f,0xfb,0xbb,0x0,
+    0x34,0x20,0x70,0x7d,0x1,0x19,0x4,0x75,0xfb,0xe8,0xf,0xf2,0x3b,0x1,0xff,0xf,
+    0xf,0x3,0x10,0x10,0xb,0x11,0x11,0xff,0x0,0x12,0x12,0x0,0x13,0x13,0x0,0x0,
+    0xff,0x27,0x27,0x1,0x28,0x28,0xb,0x0,0x0,0xdf,0xc,0x3,0x5,0x8,0xc,0xdd,
+    0x3,0x3e,0xd0,0xff,0x7,0xa0,0xf,0x40,0x1f,0x80,0x3e,0x0,0xff,0x0,0x13,0xa2,
+    0xa,0x60,0x1,0x22,0xa,0xff,0x71,0xfa,0x22,0x12,0x2,0x8a,0x60,0x52,0xfd,0x8,
+    0x3,0x1e,0x86,0x22,0xca,0x80,0x6a,0x30,0xff,0x2,0x88,0xca,0x60,0x40,0x88,0x8,
+    0x61,0xff,0x53,0x48,0x48,0x61,0x10,0x20,0x88,0x61,0xfe,0x55,0x3,0x74,0x4d,0x3,
+    0x0,0xfc,0x48,0x0,0xff,0x20,0xea,0x72,0x0,0x0,0xd4,0xe5,0x0,0xff,0x0,0xa8,
+    0xcb,0x1,0x0,0x42,0x6f,0x73,0xff,0x63,0x68,0x20,0x53,0x65,0x6e,0x73,0x6f,0xff,
+    0x72,0x74,0x65,0x63,0x20,0x42,0x4d,0x49,0xbf,0x30,0x35,0x35,0x0,0x0,0x38,0x73,
+    0x5,0x28,0xff,0x68,0x1,0x28,0x12,0xdb,0x0,0x90,0x7,0xff,0x23,0x9,0xa2,0x69,
+    0x46,0x20,0x0,0xd,0xff,0xf0,0x17,0xf8,0x0,0x99,0x29,0x60,0x0,0xff,0xbf,0xc,
+    0xa1,0x9,0x18,0x49,0x78,0x68,0xff,0x34,0x21,0x70,0x0,0x28,0x1,0xd5,0x4,0xef,
+    0x20,0x32,0xbd,0x0,0x3,0x2,0x0,0x0,0xfa,0xfa,0x3,0x0,0x7d,0xb3,0x2,0x0,
+    0x0,0x40,0x1f,0x0,0xff,0x0,0xa0,0xf,0x0,0x0,0xd0,0x7,0x0,0xf7,0x0,0xe8,
+    0x3,0xe7,0x0,0x8,0x9,0xa,0xb,0xb7,0xc,0xd,0xe,0x12,0x0,0x0,0x70,0x5f,
+    0x0,0xe,0xff,0x0,0x35,0x68,0x22,0x68,0xd2,0x69,0x90,0xff,0x47,0x0,0x28,0x3a,
+    0xd1,0x30,0x68,0x85,0xff,0x42,0x1,0xd0,0x5,0x20,0x70,0xbd,0x25,0xf7,0x0,0x3c,
+    0x35,0x53,0x7,0x2e,0xff,0xe8,0x61,0xff,0x20,0x0,0x68,0x30,0x1,0x78,0x41,0x70,
+    0x9d,0x30,0x8b,0x0,0x1,0xdb,0xd,0xd1,0x1,0x71,0x2,0x15,0xff,0x20,0x0,0xe0,
+    0x2,0x20,0x68,0x70,0x28,0xbf,0x78,0x2,0x28,0xa,0xd1,0x68,0x5,0x0,0x18,0xef,
+    0xd0,0x2,0x23,0xcd,0x67,0x9,0x9b,0xfa,0x3,0xbf,0x20,0xf,0xe0,0x15,0x28,0xe,
+    0x19,0x0,0x15,0xff,0x28,0xb,0xd0,0x0,0x21,0x20,0x7e,0xc,0xff,0xf0,0xa5,0xfa,
+    0x2,0x23,0xc5,0x4a,0x16,0x7e,0x21,0x4,0x8a,0xfa,0x16,0x20,0x28,0x70,0x15,0x1,
+    0xfe,0xb3,0x0,0x2e,0x8b,0x2,0x0,0x80,0x96,0x98,0xff,0x0,0xc4,0xab,0xb,0x0,
+    0x60,0x9,0x92,0xff,0x0,0x0,0xca,0x9a,0x3b,0x6a,0x2d,0x1d,0xff,0x0,0x0,0xe1,
+    0xf5,0x5,0xe2,0xd5,0x5,0xff,0x0,0x1c,0x46,0x3,0x0,0x4e,0x26,0x0,0x7f,0x0,
+    0x44,0x1c,0x2,0x0,0xf0,0x7f,0xbb,0x2,0xff,0x82,0xb0,0x5,0x0,0x2e,0x0,0x18,
+    0x36,0xff,0x30,0x78,0x98,0x42,0x0,0xd0,0x5c,0xe1,0xff,0x2c,0x0,0x38,0x34,0x21,
+    0x79,0x16,0x29,0xff,0x0,0xd9,0x52,0xe1,0x2,0xa2,0x49,0x0,0xff,0x52,0x5a,0x97,
+    0x44,0x0,0xbf,0xa4,0x2,0xff,0x2e,0x0,0xa4,0x2,0x86,0x0,0x9c,0x2,0xff,0x7c,
+    0x1,0xb2,0x0,0xe6,0x0,0x0,0x1,0x7f,0x96,0x0,0x36,0x1,0xa4,0x2,0x5c,0x3,
+    0x0,0xff,0xc6,0x1,0xd4,0x1,0x9c,0x2,0xee,0x1,0xff,0xfe,0x1,0x18,0x2,0x3a,
+    0x2,0xa4,0x2,0xff,0x82,0x2,0x28,0x0,0x2d,0x30,0x0,0x78,0xff,0x0,0x28,0xb,
+    0xd1,0x29,0x0,0x69,0x31,0xff,0x8,0x7a,0xfa,0x28,0x1,0xd0,0xfb,0x28,0xff,0x4,
+    0xd1,0x0,0x20,0x60,0x71,0x0,0x21,0xff,0x30,0x78,0x19,0xe1,0x28,0x0,0x30,0x30,
+    0xdf,0xb1,0x69,0xc9,0x68,0x88,0x2f,0x1,0xb,0xd0,0xff,0x21,0x78,0x28,0x0,0x29,
+    0x30,0x1,0x70,0x57,0x2,0x23,0x8f,0xf5,0x0,0x28,0xd3,0x0,0x20,0xf5,0x0,0xff,
+    0x10,0xe1,0x0,0x22,0x0,0x21,0xa,0x20,0xaf,0xf6,0xf7,0x21,0xfb,0x39,0x2,0x8,
+    0xf,0x0,0x4,0xff,0x21,0x40,0x35,0x28,0x0,0x9,0xf0,0xb6,0xef,0xfc,0x4,0x20,
+    0x0,0x45,0x0,0xfc,0xf7,0x3e,0xff,0xfa,0x0,0x28,0x0,0xd0,0x0,0xe1,0x2,0xef,
+    0x23,0x82,0xa2,0x20,0x3b,0x4,0x2,0xfa,0x6,0xff,0x20,0xf2,0xe0,0x61,0x79,0x15,
+    0x29,0xb,0xfd,0xd0,0x7f,0x4,0x78,0x8,0x77,0x5,0x22,0x29,0xf7,0x0,0x80,0x31,
+    0x1d,0x2,0x1d,0xfa,0x7,0x20,0x7f,0xe3,0xe0,0x0,0x21,0xc,0xf0,0x3,0x43,0x1,
+    0xf9,0x74,0x43,0x1,0x15,0x2,0xe8,0xf9,0xe,0x20,0xd8,0xf5,0xe0,0x9,0x2,0x16,
+    0x4f,0x4,0xd8,0xe0,0x3,0x22,0xfb,0x6f,0xa1,0xf,0x2,0x5,0xfa,0x8,0x20,0xcb,
+    0xfa,0x19,0x4,0x9,0x19,0x4,0xcb,0xe0,0x30,0x78,0xc,0xef,0xf0,0xdd,0xf9,0x1,
+    0xc7,0x0,0xc,0xf0,0xe1,0xfd,0xf9,0x61,0x2,0x0,0x20,0x88,0x71,0x3,0x20,0xdf,
+    0x48,0x71,0x0,0x22,0xb4,0x9f,0x8,0x66,0xfc,0xf7,0xb,0x20,0xb0,0x83,0x0,0xd,
+    0x29,0x0,0xd0,0xfb,0xa1,0xe0,0x23,0x2,0x48,0x79,0x0,0x28,0x14,0x57,0xd0,0x40,
+    0x1e,0x25,0x12,0x53,0x25,0x0,0x9d,0x25,0x8,0x7d,0x8e,0x25,0x4,0xa,0x7f,0x9,
+    0x78,0x8a,0x87,0x1,0xfd,0x87,0x71,0x0,0x0,0xf0,0x58,0xf9,0xd,0x20,0xef,0x8d,
+    0xe0,0x60,0x79,0x50,0x1,0xd1,0x89,0xe0,0x9f,0x0,0x28,0x6,0xd1,0x0,0xc7,0x0,
+    0x11,0x3,0x98,0xff,0xfa,0x0,0x20,0x80,0xe0,0xd,0x28,0x2,0xcb,0xd0,0x15,0x93,
+    0x0,0x81,0x3b,0x4,0xe7,0x2,0x2,0x23,0x7d,0x3f,0x41,0x9,0x7f,0xf9,0x3,0x20,
+    0x20,0x6b,0x0,0xfe,0x31,0xb,0x1d,0xfc,0x73,0xbd,0x5,0x22,0x3d,0xbe,0xd3,0x4,
+    0x9b,0xf9,0xf,0x20,0x61,0xd3,0x4,0x9f,0xaf,0xf9,0x0,0x28,0x62,0x55,0x0,0x4b,
+    0x25,0x8,0xa,0xbf,0xfc,0x10,0x20,0x54,0xe0,0x2,0x65,0x0,0x7a,0xbe,0x2d,0x5,
+    0x86,0xf9,0x12,0x20,0x4c,0x29,0x4,0x8a,0xfe,0x29,0x0,0x4d,0xd1,0x3,0x22,0x0,
+    0xbf,0x30,0xbe,0x43,0x4,0x79,0xf9,0x13,0x20,0x3f,0x19,0x4,0x7d,0xf6,0x19,0x0,
+    0x40,0xd1,0x8f,0x1,0x90,0x2b,0x0,0x70,0xbf,0x33,0x0,0xbf,0x2b,0xa2,0x1e,0x81,
+    0x4,0x33,0x6f,0xf9,0x14,0x20,0x2e,0x87,0x5,0xa,0xd0,0x6f,0x3,0xbf,0x4b,0xf9,
+    0x2,0x23,0x9f,0xa2,0x6f,0x7,0x30,0xff,0xf9,0x16,0x20,0x20,0xe0,0xc,0xf0,0x39,
+    0xfe,0x47,0x9,0x3d,0xf9,0x69,0x35,0xe8,0x7b,0x40,0xf7,0x7,0x4,0xd4,0xd,0x2,
+    0x44,0xf9,0x1,0x28,0xdd,0x4,0x95,0x0,0x0,0x21,0x8,0xeb,0x0,0x22,0xfa,0xd7,
+    0x15,0x20,0xa,0xb1,0x5,0x2a,0x41,0x0,0x0,0xbf,0xbb,0x88,0xa2,0xe1,0x6,0xe,
+    0xf9,0x5,0xe1,0x0,0x73,0xff,0xbd,0x1,0x21,0x9,0x20,0xfb,0xf7,0xa4,0xfe,0xdf,
+    0x0,0x0,0x0,0x48,0x1c,0x2,0x0,0x5c,0xfe,0x3,0x0,0x20,0x9,0x0,0x0,0x16,
+    0x16,0x0,0xbf,0x17,0x17,0x10,0x18,0x18,0x0,0x0,0x0,0xf,0xff,0xf,0x3,0x10,
+    0x10,0x8,0x11,0x11,0x0,0xdf,0x12,0x12,0x0,0x13,0x13,0x1b,0x2,0x7,0x17,0xeb,
+    0x17,0x0,0x1b,0x6,0x9e,0x3,0x0,0x38,0xb5,0x4,0xff,0x0,0x20,0x7e,0x98,0x42,
+    0x31,0xd1,0x25,0xff,0x0,0x3c,0x35,0x28,0x78,0xd,0x28,0x5,0xff,0xd1,0x10,0x68,
+    0xa8,0x61,0xc,0x20,0x28,0xff,0x70,0xa,0x20,0x5,0xe0,0xb,0x28,0xd,0xba,0xf,
+    0x4,0xa,0xf,0x0,0x0,0x90,0x23,0xe7,0x4,0x6e,0xef,0xa2,0x2,0x21,0x20,0x87,
+    0x0,0xbf,0xf8,0x31,0xef,0xbd,0x15,0x28,0x14,0xaf,0xc,0xca,0xf9,0x68,0xef,0x78,
+    0x15,0x28,0xb,0xf3,0x0,0x20,0x7e,0xc,0x97,0xf0,0xd0,0xf8,0xb3,0x2,0x61,0xf7,
+    0x0,0x2b,0x2,0xb4,0x9b,0xf8,0x16,0x41,0x0,0x31,0xbd,0x6f,0x2,0x69,0x6,0xb,
+    0xff,0x28,0x25,0xd1,0x20,0x0,0x6e,0x30,0x1,0xff,0x78,0x3,0x29,0x1,0xda,0x49,
+    0x1c,0x1,0xff,0x70,0x41,0x78,0x49,0x1c,0x41,0x70,0xc9,0x5f,0xb2,0x2,0x29,0xc,
+    0xd1,0x43,0x6,0xae,0x43,0x4,0xf9,0x4a,0xf7,0x0,0x43,0x2,0x92,0xf8,0x5,0x20,
+    0x2b,0xd3,0xe0,0xa,0x6f,0x1,0x87,0x6,0x4c,0x87,0x8,0x7b,0xf8,0xff,0xa,0x20,
+    0x1f,0xe0,0x10,0x28,0x7,0xd1,0xf7,0x2,0x23,0x46,0x2b,0x8,0x7c,0xf8,0x11,0x20,
+    0xf7,0x15,0xe0,0x4,0x9d,0x0,0x68,0x78,0x1,0x28,0x37,0xa,0xd1,0x2,0x35,0x8,
+    0x39,0xa2,0x59,0x0,0x1f,0x0,0xf7,0x61,0xf8,0x1,0xdd,0x0,0x3,0x22,0x36,0xa1,
+    0xee,0xd,0x2,0x8f,0xf8,0x9,0x9d,0x4,0x0,0x0,0x1e,0x7f,0xa0,0x70,0x47,0x44,
+    0x20,0x70,0x47,0xa7,0x6,0xff,0x30,0x35,0x28,0x0,0x29,0x68,0xc9,0x68,0xff,0x88,
+    0x47,0x29,0x7a,0x20,0x0,0x29,0x30,0xeb,0x1,0x70,0x8f,0x2,0x27,0x63,0x8,0x4a,
+    0xf8,0x3,0x7f,0x20,0x28,0x73,0x1,0x20,0x68,0x73,0xd7,0x2,0xff,0x1,0x0,0x18,
+    0x31,0xca,0x6b,0x4a,0x64,0xff,0x2,0x0,0x60,0x32,0xf0,0x23,0x94,0x7c,0xff,0x24,
+    0x2,0x55,0x7c,0x1d,0x40,0x25,0x43,0x7f,0x15,0x80,0x14,0x7d,0x24,0x2,0xd5,0xb,
+    0x4,0xf7,0x55,0x80,0x94,0xb,0x0,0x55,0x7d,0x2b,0x40,0xff,0x23,0x43,0x93,0x80,
+    0xa,0x78,0x5c,0x30,0xb7,0x1,0x0,0x7,0x39,0x1,0x2d,0xf9,0x7b,0x2,0x44,0xff,
+    0x0,0xd,0x0,0xb4,0x46,0x65,0xd1,0xdd,0x1f,0x55,0x22,0xaa,0xcd,0x9c,0xa1,0x3,
+    0x0,0xe,0xf,0x22,0xef,0xbf,0x6e,0x89,0x7,0x3,0xa,0x9a,0xc9,0x65,0xff,0x4e,
+    0xed,0x76,0x67,0x1f,0x11,0x20,0x0,0xeb,0x0,0x11,0x1f,0x0,0x80,0x3,0x0,0x19,
+    0x19,0x4,0x5f,0x1a,0x1a,0x1,0x1b,0x1b,0x2f,0x2,0x16,0x3,0x0,0xdf,0x11,0x5a,
+    0x0,0x0,0x82,0x43,0x10,0x70,0xb5,0xff,0x1,0x24,0xa5,0x48,0x0,0x68,0x84,0x40,
+    0xff,0xa5,0x4d,0xa5,0x4e,0xa6,0x48,0x60,0x43,0xff,0x31,0x0,0xea,0xf7,0x59,0xfc,
+    0x28,0x80,0x7d,0xa4,0xb,0x8,0x53,0xfc,0x68,0x80,0xa2,0xb,0x8,0xdf,0x4d,0xfc,
+    0xa8,0x80,0xa0,0xb,0x8,0x47,0xfc,0xff,0xe8,0x80,0x9e,0x48,0x44,0x43,0x20,0x0,
+    0xbe,0xd,0x2,0x40,0xfc,0x28,0x81,0x70,0xbf,0x0,0x10,0xff,0xb5,0x0,0xbf,0x4,
+    0x0,0xfb,0xf7,0x7b,0xef,0xff,0x0,0xbf,0xa,0x57,0x1,0x30,0x30,0xc,0xff,0xf0,
+    0xb1,0xf8,0x95,0x48,0x1,0x0,0x8,0xff,0x31,0x21,0x60,0x60,0x30,0x20,0x63,0x0,
+    0x7f,0x20,0x3c,0x21,0x60,0x54,0x22,0x0,0x83,0x3,0xff,0x40,0x30,0x9,0xf0,0x48,
+    0xfa,0x20,0x0,0xbf,0x10,0xbd,0x2,0x1,0x68,0x69,0x8e,0x0,0xf,0xfe,0x93,0x2,
+    0x2,0x7e,0x91,0x42,0x0,0xd0,0x0,0xfe,0x81,0x1,0x1,0x0,0x1,0x20,0x9,0x7e,
+    0x88,0xff,0x40,0x80,0xb2,0x70,0x47,0x0,0x0,0xf8,0xfe,0x8f,0x1,0xd,0x0,0x0,
+    0x26,0x21,0x0,0x6a,0xff,0x31,0xe,0x71,0x2,0x27,0x21,0x0,0x3c,0xff,0x31,0x4f,
+    0x70,0x9,0x22,0x26,0xa1,0x79,0xef,0x30,0xea,0xf7,0x24,0x47,0x0,0x3c,0x30,0xc6,
+    0xef,0x61,0x7,0x20,0x69,0x5f,0x0,0x6a,0x20,0x25,0xdf,0x52,0x5,0x23,0x70,0x4a,
+    0x2b,0x2,0x20,0x0,0xff,0xc,0xf0,0xe8,0xf8,0x5,0x0,0x1f,0xa0,0xef,0x40,0x19,
+    0x40,0x78,0x11,0x2,0x48,0x74,0x1e,0xff,0xa0,0x69,0x0,0x40,0x18,0x41,0x88,0x6a,
+    0xff,0x20,0x21,0x52,0x1,0x20,0x65,0x4a,0x12,0xff,0x68,0x90,0x40,0x48,0x43,0x9d,
+    0x21,0x49,0xff,0x0,0x48,0x43,0x63,0x49,0xea,0xf7,0xd8,0x6f,0xfb,0xa0,0x81,0x18,
+    0x23,0x4,0x40,0x88,0x31,0x4,0xfd,0x80,0xaf,0x2,0xc,0x30,0x0,0x7b,0xb,0xf0,
+    0xbf,0x65,0xff,0x2,0x23,0x61,0x4a,0xff,0x3,0xfb,0xef,0xf7,0x4a,0xff,0x3,0xcf,
+    0x4,0x1,0x21,0xc,0xfb,0x34,0x20,0x1b,0x0,0x6f,0xff,0x0,0x2d,0x1,0xbf,0xd5,
+    0x2,0x20,0xf2,0xbd,0x0,0x3,0x2,0x0,0x7f,0xf,0xf,0x0,0x10,0x10,0x7,0x11,
+    0x8e,0x3,0xbf,0x0,0x0,0x4,0x3,0x2,0x1,0x6,0x0,0xd0,0xff,0x7,0x7d,0x0,
+    0xfa,0x0,0xf4,0x1,0xe8,0xe7,0x3,0xd0,0x7,0xe1,0x0,0x1,0xc,0xb,0xa2,0xa,
+    0xff,0x60,0x1,0x22,0xa,0x71,0xbe,0x4b,0x8b,0xf7,0x60,0x5b,0x8,0x3,0x6,0xa0,
+    0x23,0x5b,0x1,0xff,0xcb,0x80,0x83,0x89,0xcb,0x60,0x6c,0x30,0xff,0x0,0x88,0x8,
+    0x61,0xb8,0x48,0x48,0x61,0xfb,0x8a,0x61,0x1b,0x3,0x0,0x0,0x42,0x6f,0x73,0xff,
+    0x63,0x68,0x20,0x53,0x65,0x6e,0x73,0x6f,0xff,0x72,0x74,0x65,0x63,0x20,0x42,0x4d,
+    0x49,0xff,0x30,0x35,0x35,0x0,0x0,0x38,0xb5,0x5,0xff,0x0,0xc,0x0,0x60,0x68,
+    0x1,0x28,0x12,0xff,0xdb,0x0,0x90,0x5,0x23,0x9,0xa2,0x69,0xfb,0x46,0x28,0x3,
+    0x1,0x1d,0xfc,0x0,0x99,0x61,0xfd,0x60,0x97,0x3,0x9,0x18,0x49,0x78,0x68,0x35,
+    0xff,0x29,0x70,0x0,0x28,0x1,0xd5,0x4,0x20,0xf9,0x32,0xab,0x0,0x3,0x0,0x0,
+    0x10,0x27,0x0,0x0,0xff,0x88,0x13,0x0,0x0,0xc4,0x9,0x0,0x0,0xf7,0xe8,0x3,
+    0x0,0xa1,0x0,0x0,0x0,0x1,0x7,0xf5,0x6,0xb4,0x4,0x70,0x7b,0x5,0x6e,0x68,
+    0x22,0x68,0xff,0xd2,0x69,0x90,0x47,0x0,0x28,0x2e,0xd1,0xff,0x68,0x68,0x86,0x42,
+    0x1,0xd0,0x5,0x20,0xff,0x70,0xbd,0x26,0x0,0x3c,0x36,0xfa,0x21,0xff,0x89,0x0,
+    0xea,0xf7,0x3a,0xfb,0xf0,0x61,0xff,0x20,0x0,0x68,0x30,0x1,0x78,0x41,0x70,0xfd,
+    0x68,0x7f,0x0,0x1,0xdb,0xc,0x20,0x4,0xe0,0xfe,0x65,0x2,0xe,0x20,0x0,0xe0,
+    0x2,0x20,0x70,0xff,0x70,0x30,0x78,0x2,0x28,0x1,0xd0,0xe,0xff,0x28,0xd,0xd1,
+    0x70,0x78,0xc,0x28,0x7,0xef,0xd1,0x2,0x23,0x85,0x49,0x9,0xa5,0xfe,0x4,0xff,
+    0x20,0x1,0xe0,0x2,0x28,0x0,0xd1,0x30,0xf9,0x70,0xdf,0x0,0x8f,0x0,0x78,0x4d,
+    0x3,0x0,0x84,0xff,0x49,0x0,0x20,0x50,0x46,0x0,0x0,0x98,0xff,0xe6,0x0,0x0,
+    0xf6,0xcb,0x1,0x0,0xec,0xff,0x97,0x3,0x0,0xd8,0x2f,0x7,0x0,0xc8,0xff,0xf,
+    0xa,0x0,0x8c,0x46,0x3,0x0,0xd4,0xfb,0x22,0x2,0x9b,0x0,0x5,0x0,0x2e,0x0,
+    0x18,0xff,0x36,0x30,0x78,0x98,0x42,0x0,0xd0,0xdb,0xff,0xe0,0x2c,0x0,0x38,0x34,
+    0x21,0x79,0xe,0xff,0x29,0x0,0xd9,0xd1,0xe0,0x1,0xa2,0x52,0xff,0x5c,0x52,0x0,
+    0x97,0x44,0xd1,0x7,0xd1,0xff,0xab,0x3e,0xcd,0x46,0x54,0x60,0x6e,0xd1,0xff,0x80,
+    0xd1,0x92,0xd1,0x0,0x28,0x0,0x2d,0xff,0x30,0x0,0x78,0x0,0x28,0x16,0xd1,0x29,
+    0xff,0x0,0x70,0x31,0x28,0x0,0x30,0x30,0xb2,0xf7,0x69,0x92,0x68,0xd9,0x2,0xd,
+    0xd0,0x0,0x20,0xff,0x60,0x71,0x0,0x21,0x30,0x78,0xb,0xf0,0x5f,0x70,0xfe,0x2,
+    0x23,0xb7,0x9f,0x0,0x28,0x9f,0x0,0xbf,0x55,0xfe,0x3,0x20,0xa7,0xe0,0x29,0x2,
+    0xb1,0xef,0x69,0xc9,0x68,0x88,0x29,0x0,0xb,0xd0,0x21,0xff,0x78,0x28,0x0,0x29,
+    0x30,0x1,0x70,0x2,0xeb,0x23,0x53,0x25,0x8,0x42,0xc5,0x0,0x94,0xe0,0x0,0xff,
+    0x22,0x0,0x21,0xa,0x20,0xf5,0xf7,0x43,0xf5,0xff,0x4b,0x2,0x8c,0xf,0x0,0x28,
+    0x21,0x40,0x35,0xff,0x28,0x0,0x9,0xf0,0xd8,0xf8,0x5,0x20,0xbd,0x84,0x45,0x0,
+    0xfb,0xf7,0x60,0xfe,0x84,0x0,0xd0,0x7f,0x84,0xe0,0x2,0x23,0x45,0xa2,0x16,0x3b,
+    0x4,0xff,0x24,0xfe,0x7,0x20,0x76,0xe0,0x29,0x0,0xff,0x69,0x31,0x8,0x78,0x48,
+    0x75,0x3,0x22,0xe7,0x29,0x0,0x79,0x99,0x0,0x53,0x2,0x8,0x20,0x6a,0xea,0x33,
+    0x4,0x46,0x33,0x0,0x6b,0x33,0x1,0x0,0xbf,0xb0,0xfb,0xa2,0x15,0x33,0x4,0xa,
+    0xfe,0x9,0x20,0x5c,0xbf,0xe0,0xb,0xf0,0x13,0xfe,0x1,0xb1,0x4,0x17,0x7c,0xa5,
+    0x0,0x41,0x2,0x48,0x71,0x0,0x22,0x1e,0x73,0x8,0xff,0x9e,0xf8,0xa,0x20,0x4a,
+    0xe0,0x61,0x79,0xe7,0xc,0x29,0x17,0xed,0x0,0x1b,0x0,0x79,0x0,0x28,0xaf,0x1d,
+    0xd0,0x40,0x1e,0x23,0x12,0x8c,0x23,0x0,0x38,0xfa,0x23,0x4,0x5,0x23,0x4,0x4a,
+    0x7d,0x9,0x78,0x8a,0xff,0x42,0xa,0xd0,0x0,0x21,0xb,0xf0,0xed,0xdf,0xfd,0x2,
+    0x23,0x8e,0xa2,0xdf,0x6,0xd2,0xfd,0xf7,0x3,0x20,0x24,0x8b,0x0,0x0,0xf0,0xba,
+    0xf8,0xff,0xc,0x20,0x1f,0xe0,0x60,0x79,0x2,0x28,0xeb,0x1c,0xd0,0xc9,0x7,0x86,
+    0x23,0x8,0xc0,0xfd,0x4,0xff,0x20,0x12,0xe0,0xe,0x28,0x8,0xd1,0x0,0xdf,0x22,
+    0x20,0x6a,0x41,0x42,0x61,0x6,0x5b,0xf8,0xcf,0xe,0x20,0x7,0xe0,0x35,0x1,0x15,
+    0x0,0x29,0x0,0xfe,0x1d,0x3,0xb4,0xfe,0x0,0x20,0x20,0x71,0x70,0xd3,0xbd,0x1,
+    0x2b,0x1,0xe5,0x0,0xf9,0xf3,0x3,0x10,0x27,0x7f,0x0,0x0,0xff,0x7f,0x0,0x0,
+    0xd8,0xd7,0x1,0x7f,0x16,0x6,0x0,0x0,0x1,0x7e,0x99,0xd3,0x1,0xff,0x70,0x47,
+    0x80,0xb5,0x1,0x0,0x3c,0x31,0xff,0xb,0x78,0xc,0x2b,0x3,0xd1,0x12,0x68,0xff,
+    0x8a,0x61,0xd,0x22,0x4,0xe0,0xa,0x2b,0xfd,0xb,0xb,0x4,0xb,0x22,0xa,0x70,
+    0xa,0x21,0xff,0x0,0x91,0x3,0x0,0x6f,0x33,0x6b,0xa2,0x7f,0x2,0x21,0xfb,0xf7,
+    0x74,0xfd,0x1,0x4b,0x0,0xff,0x38,0xb5,0x4,0x0,0x25,0x0,0x3c,0x35,0xff,0x28,
+    0x78,0xa,0x28,0x12,0xd1,0xb,0x20,0xff,0x28,0x70,0x6e,0x20,0x20,0x5c,0x3,0x28,
+    0xff,0x2,0xda,0x40,0x1c,0x6e,0x21,0x60,0x54,0x5f,0xa,0x20,0x0,0x90,0x23,0x33,
+    0x0,0x5e,0x33,0x0,0xfd,0x20,0xb7,0x0,0x59,0xfd,0x31,0xbd,0x5,0x28,0x5f,0x15,
+    0xd1,0x68,0x78,0x1,0xa5,0x0,0x2,0x1d,0x8,0xdf,0x0,0xbf,0x51,0xa2,0x0,0x1f,
+    0x4,0x49,0xfd,0xff,0x1,0x20,0x18,0xe0,0x3,0x22,0x4e,0xa1,0xbe,0xd,0x2,0x77,
+    0xfd,0x6,0x20,0x11,0xe5,0x0,0x18,0xfb,0xd1,0x20,0xd,0x1,0x33,0xf8,0x68,0x78,
+    0x2,0x2b,0x28,0x9,0x9,0x1,0x9,0x9f,0x5,0x43,0xb,0x1,0x25,0x2,0xfd,0x3a,
+    0xb,0x1,0x28,0x70,0x31,0xbd,0x0,0x22,0xfb,0xe8,0x69,0x9,0x1,0x34,0x20,0x0,
+    0x8,0xf0,0xff,0xd6,0xff,0x31,0xbd,0x23,0xa0,0x70,0x47,0xaf,0x5c,0x20,0x70,0x47,
+    0xa3,0x6,0x30,0x21,0x1,0x29,0xff,0x68,0xc9,0x68,0x88,0x47,0x29,0x7a,0x20,0x5f,
+    0x0,0x29,0x30,0x1,0x70,0x43,0x2,0x32,0x43,0x8,0xfd,0x18,0x43,0x2,0x73,0x1,
+    0x20,0x68,0x73,0x31,0xfb,0xbd,0x10,0x7,0x5,0xa,0x78,0xe,0x2a,0x4,0xff,0xd1,
+    0x11,0x4a,0x8a,0x84,0xca,0x84,0xa,0xff,0x85,0x14,0xe0,0x8a,0x69,0xa,0x62,0x2,
+    0xff,0x0,0x70,0x32,0x53,0x78,0x1b,0x2,0x14,0xbf,0x78,0x23,0x43,0x8b,0x84,0xd3,
+    0x9,0x0,0x94,0xfe,0x9,0x0,0xcb,0x84,0x53,0x79,0x1b,0x2,0x12,0xff,0x79,0x13,
+    0x43,0xb,0x85,0x0,0x22,0x4a,0xff,0x85,0x2,0x7e,0x5c,0x30,0x1,0x0,0x7,0x2e,
+    0x7d,0x1,0xf5,0xfd,0x10,0x23,0x1,0xd4,0x67,0x1,0x6f,0x3,0xff,0x5c,0x0,0x11,
+    0x0,0x8c,0xa7,0x24,0xbe,0xff,0xdd,0x55,0x22,0xaa,0x5e,0xdf,0x22,0x0,0xf4,0x0,
+    0x12,0xf,0x26,0x28,0xa,0x2,0x20,0x8f,0xc2,0xf5,0xdf,0x28,0x43,0x30,0xe0,0x0,
+    0x3,0xa,0xbe,0x30,0xbf,0xbe,0x45,0x29,0x5c,0x8f,0x2,0x1b,0x0,0x40,0xff,0xa,
+    0xd7,0xa3,0x0,0xd8,0xac,0x8f,0xc2,0xd5,0x11,0x20,0x1,0x11,0x10,0x0,0x80,0x3,
+    0x0,0x17,0x17,0xbf,0x0,0x18,0x18,0x80,0x19,0x19,0x3c,0x2,0x15,0xfa,0x10,0x0,
+    0x82,0x57,0x10,0xf0,0xb5,0x1,0x24,0x95,0xff,0x48,0x0,0x68,0x1,0x26,0x86,0x40,
+    0x94,0xff,0x4d,0x95,0x4f,0x95,0x48,0x70,0x43,0x39,0xff,0x0,0xea,0xf7,0x12,0xf9,
+    0x28,0x80,0x93,0xbe,0xb,0x8,0xc,0xf9,0x68,0x80,0xb9,0xb,0x8,0x6,0xef,0xf9,
+    0xa8,0x80,0xb7,0xb,0x8,0x0,0xf9,0xe8,0x7f,0x80,0xb5,0x48,0x46,0x43,0x30,0x0,
+    0xd,0x2,0xdf,0xf9,0xf8,0x28,0x81,0xb3,0x49,0x0,0x84,0x40,0xff,0xfa,0x26,0xb6,
+    0x0,0xb1,0x48,0x60,0x43,0x7d,0x31,0x15,0x0,0xee,0xf8,0xa8,0x81,0xaf,0xb,0x8,
+    0xdf,0xe8,0xf8,0xe8,0x81,0xad,0xb,0x8,0xe2,0xf8,0xff,0x28,0x82,0xc9,0x48,0x44,
+    0x43,0x20,0x0,0xfe,0xd,0x2,0xdb,0xf8,0x68,0x82,0xf0,0xbd,0x38,0xff,0xb5,0x0,
+    0xbf,0x4,0x0,0x15,0x0,0xb,0xef,0xf0,0x32,0xfd,0xd,0xef,0x1,0x30,0x30,0xb,
+    0xff,0xf0,0x4d,0xfd,0xc1,0x48,0x1,0x0,0x8,0xff,0x31,0x21,0x60,0x78,0x30,0x20,
+    0x63,0x22,0xbf,0x0,0x29,0x0,0x20,0x0,0x60,0x17,0x0,0x73,0xfb,0xfd,0xc,0xa7,
+    0x1,0xcb,0x30,0xe9,0xf7,0xd0,0xff,0xfe,0x0,0x20,0x3c,0x21,0x60,0x54,0x20,0x7b,
+    0x0,0x32,0x5b,0x1,0x2,0x1,0x68,0x69,0xd6,0x0,0xfd,0xd1,0xdb,0x2,0x2,0x7e,
+    0x91,0x42,0x6,0xd0,0xff,0x78,0x22,0x82,0x5c,0x91,0x42,0x1,0xd1,0xdf,0x60,0x30,
+    0x70,0x47,0x0,0xfd,0x1,0x1,0x0,0xff,0x1,0x20,0xa,0x7e,0x1,0x23,0x93,0x40,
+    0xff,0x78,0x31,0x9,0x78,0x88,0x40,0x18,0x43,0xff,0x80,0xb2,0x70,0x47,0xf8,0xb5,
+    0x4,0x0,0xff,0xe,0x0,0x3e,0x30,0x0,0x25,0x0,0x21,0xdf,0x1,0x70,0x41,0x70,
+    0x22,0x67,0x0,0x48,0x30,0xff,0x8,0xf0,0xb3,0xfe,0x25,0x64,0x25,0x0,0xff,0xb0,
+    0x35,0xe8,0x7e,0x0,0x28,0x5,0xd1,0x67,0xc,0x22,0x4f,0x97,0x0,0x75,0x2,0xa7,
+    0xfe,0x60,0x1,0xff,0xf0,0x92,0xfb,0x27,0x0,0xc,0x37,0x1,0xff,0x21,0x38,0x7b,
+    0xb,0xf0,0x2c,0xfc,0x3e,0xbf,0x80,0x5,0x23,0x43,0x4a,0x39,0x39,0x0,0xb,0xff,
+    0xf0,0x6a,0xfd,0x6,0x0,0xf,0xa0,0x80,0xff,0x19,0x40,0x78,0xd6,0x34,0x20,0x70,
+    0x74,0xff,0x0,0xe,0xa0,0x0,0x19,0x41,0x88,0x39,0xff,0x80,0x1,0x20,0x3a,0x4a,
+    0x12,0x68,0x90,0xff,0x40,0x48,0x43,0x9d,0x21,0x49,0x0,0x48,0xff,0x43,0x38,0x49,
+    0xea,0xf7,0x5c,0xf8,0x28,0xfb,0x80,0x9,0x1f,0x0,0x40,0x88,0x68,0x80,0x0,0xff,
+    0x2e,0x1,0xd5,0x2,0x20,0xf2,0xbd,0x0,0xde,0x3,0x2,0x4,0x3,0x2,0x1,0xc7,
+    0x0,0xd0,0x7,0xff,0x7d,0x0,0xfa,0x0,0xf4,0x1,0xe8,0x3,0xd3,0xd0,0x7,0xbd,
+    0x0,0x1,0xc,0xf4,0xb3,0x0,0x1d,0x0,0xff,0x78,0x20,0x20,0x5c,0x81,0x42,0x45,
+    0xd1,0xe9,0xcb,0x7,0x0,0xa3,0x6,0x26,0xa3,0x8,0x55,0xfe,0x4,0x5f,0x23,0x72,
+    0x4a,0x69,0x46,0x8f,0x2,0x22,0x8f,0x0,0xf5,0x23,0x8f,0x4,0xec,0x2b,0x1,0xfa,
+    0x27,0xbf,0x0,0xff,0x0,0xbf,0x21,0xa0,0x71,0x0,0x40,0x18,0xfb,0x40,0x88,0xbd,
+    0x3,0x17,0xf8,0x1,0x21,0x43,0xba,0x99,0x0,0x91,0x99,0x0,0x66,0x49,0x48,0xdf,
+    0x5,0x10,0xff,0xf8,0x21,0x0,0x78,0x31,0x88,0x86,0x1a,0x7c,0x27,0x8,0xd,0x2,
+    0xc8,0x86,0x12,0x22,0x19,0x5f,0x0,0xfd,0xd7,0x5f,0x0,0x25,0xfe,0x0,0x2d,0x0,
+    0xd1,0xff,0xc8,0x25,0xed,0x1c,0x68,0x10,0x80,0xf,0xff,0x40,0x19,0x80,0x10,0xcb,
+    0x34,0x60,0x74,0xdf,0xf0,0xf,0xf2,0xbd,0x6,0xbd,0x2,0x0,0x78,0xff,0x4d,0x3,
+    0x0,0xc0,0x48,0x0,0x20,0x50,0xff,0x46,0x0,0x0,0x24,0xe4,0x0,0x0,0xf6,0xff,
+    0xcb,0x1,0x0,0x40,0x40,0x28,0x41,0x41,0xff,0x8,0x42,0x42,0x28,0x43,0x43,0x0,
+    0xc,0xef,0x3,0x5,0x8,0xc,0xdf,0x0,0x80,0x3e,0xd0,0x7f,0x7,0xa0,0xf,0x40,
+    0x1f,0x80,0x3e,0xb3,0x1,0xfa,0xdb,0x8,0x2,0x17,0x0,0x5f,0x5f,0xd,0x60,0x60,
+    0xff,0x1,0x6c,0x6c,0x4,0x57,0x57,0x4,0x56,0xdf,0x56,0x8,0x7e,0x7e,0x12,0x2b,
+    0x0,0xb5,0xa,0xff,0x0,0x1,0x7e,0x3,0x68,0x9b,0x6d,0x98,0xbb,0x47,0x2,0x63,
+    0x0,0x10,0xb5,0x14,0x2b,0x0,0x78,0xff,0x32,0x3,0x7e,0x99,0x42,0x12,0xd1,0x1,
+    0xff,0x21,0x21,0x71,0x38,0x4b,0xe3,0x80,0x13,0xff,0x8f,0xe3,0x60,0x52,0x8f,0x22,
+    0x61,0x36,0xff,0x4a,0x62,0x61,0xa1,0x61,0x11,0xa1,0x21,0xff,0x60,0x34,0x49,0xfb,
+    0xf7,0x97,0xfb,0xa0,0xff,0x60,0x0,0x20,0x10,0xbd,0x13,0x78,0x99,0xfb,0x42,0x7,
+    0x2b,0x4,0xb9,0x23,0xe3,0x80,0x93,0xff,0x8e,0xe3,0x60,0xd2,0x8e,0xe8,0xe7,0x7,
+    0xfe,0x19,0x0,0x0,0x0,0xec,0x97,0x3,0x0,0xd8,0xff,0x2f,0x7,0x0,0xc8,0xf,
+    0xa,0x0,0x74,0xfe,0xbf,0x0,0xea,0x72,0x0,0x0,0xd4,0xe5,0x0,0xfb,0x0,0xa8,
+    0xbb,0x0,0x42,0x6f,0x73,0x63,0x68,0xff,0x20,0x53,0x65,0x6e,0x73,0x6f,0x72,0x74,
+    0xff,0x65,0x63,0x20,0x42,0x4d,0x49,0x31,0x36,0xdf,0x30,0x0,0x0,0x38,0xb5,0xc5,
+    0x0,0x21,0x0,0xff,0x25,0x22,0x68,0x1,0x2a,0x2,0xda,0x61,0xfe,0x63,0x0,0x32,
+    0xbd,0x61,0x68,0x0,0x29,0x7,0xff,0xd5,0x0,0x6c,0x42,0x42,0x91,0x42,0x0,0xff,
+    0xd0,0x5,0x25,0x20,0x60,0x62,0x60,0x17,0xff,0xe0,0x1,0x29,0x4,0xdb,0x91,0x42,
+    0x1,0xff,0xda,0x21,0x60,0x0,0xe0,0x62,0x60,0x21,0xbf,0x68,0x0,0x91,0x5,0x23,
+    0xf,0xa1,0x1,0xc,0xff,0xf0,0x9,0xf8,0x0,0x99,0x21,0x60,0x61,0x7f,0x68,0x1,
+    0x29,0x1,0xdb,0x21,0x68,0x43,0x0,0xff,0x28,0x0,0xd5,0x4,0x25,0x28,0x0,0x32,
+    0xfe,0x93,0x0,0xe0,0x64,0x2,0x0,0xd4,0x37,0x3,0xfb,0x0,0xcc,0x4b,0x1,0x4e,
+    0x26,0x0,0x0,0x67,0xff,0x3,0x0,0x0,0xff,0x7f,0x0,0x0,0xc4,0xff,0x9,0x0,
+    0x0,0xc8,0x2d,0x2,0x0,0xf8,0xff,0xb5,0x4,0x0,0xe,0x0,0x35,0x68,0x77,0xff,
+    0x68,0x22,0x68,0xd2,0x69,0x90,0x47,0x0,0xff,0x28,0x3b,0xd1,0x30,0x68,0x85,0x42,
+    0x2,0xff,0xd1,0x72,0x68,0x97,0x42,0x1,0xd0,0x5,0xfe,0x8d,0x1,0x21,0x0,0x3c,
+    0x31,0x0,0x28,0x1,0xff,0xd1,0xc8,0x70,0xe,0xe0,0x3,0xd5,0x5,0xff,0x20,0xc8,
+    0x70,0x0,0x20,0x9,0xe0,0x1,0xff,0x2a,0x1,0xdb,0x3,0x22,0x4,0xe0,0x0,0xff,
+    0x2a,0x1,0xd5,0x4,0x22,0x0,0xe0,0x2,0xff,0x22,0xca,0x70,0x88,0x60,0x8,0x78,
+    0x3,0xff,0x28,0x6,0xd1,0xc8,0x78,0x0,0x28,0xd,0xff,0xd0,0x20,0x0,0x0,0xf0,
+    0x33,0xfa,0x12,0xef,0xe0,0x14,0x28,0x10,0x11,0x0,0x8a,0x78,0x90,0xff,0x42,0x6,
+    0xd1,0x48,0x68,0x8a,0x68,0x90,0xfa,0x5d,0x0,0x6,0x45,0x0,0x5,0xe0,0x48,0x78,
+    0x5,0x77,0x28,0x2,0xd1,0x27,0x2,0xb,0xfa,0x0,0xf7,0x5,0xff,0xf8,0xb5,0x5,
+    0x0,0x2e,0x0,0x18,0x36,0xff,0x30,0x78,0x98,0x42,0x4,0xd0,0x78,0x20,0xf7,0x28,
+    0x5c,0x98,0x3,0x1,0x65,0xe1,0x2c,0x0,0xff,0x38,0x34,0x20,0x79,0x40,0x1e,0x14,
+    0x28,0xff,0x0,0xd9,0x5e,0xe1,0x2,0xa1,0x40,0x0,0xff,0x9,0x5a,0x8f,0x44,0x0,
+    0xbf,0x2a,0x0,0xff,0x2a,0x0,0xb4,0x2,0xbc,0x0,0xd4,0x0,0xf5,0xec,0x7,0x0,
+    0xfc,0x3,0x0,0xc,0x1,0x34,0x1,0xff,0x68,0x1,0x8e,0x1,0xb4,0x2,0xb4,0x2,
+    0xd7,0xc0,0x1,0xf4,0x7,0x0,0xe,0x9,0x0,0x18,0x2,0xdf,0x28,0x0,0x2d,0x30,
+    0x0,0x97,0x0,0x11,0xd0,0xff,0x28,0x0,0x30,0x30,0xb1,0x69,0xc9,0x68,0xfd,0x88,
+    0xed,0x0,0xa,0xd0,0x21,0x78,0x28,0x0,0xff,0x29,0x30,0x1,0x70,0x61,0x78,0x80,
+    0x20,0xff,0x8,0x43,0x2a,0x0,0xd6,0x32,0xd0,0x74,0xbf,0x21,0xe0,0x29,0x0,0xea,
+    0x31,0x27,0x2,0xb2,0xf7,0x69,0x92,0x68,0x15,0x3,0x4,0xd1,0x2f,0x0,0xdf,0xd6,
+    0x37,0x38,0x7d,0xd0,0x9,0x0,0x0,0x20,0xff,0x20,0x71,0x0,0x22,0x29,0x0,0x1a,
+    0xe0,0xfa,0x49,0x12,0x10,0x49,0x18,0xf8,0x74,0x2a,0x0,0xe9,0xbf,0x32,0x3,0x20,
+    0x0,0x90,0x13,0x90,0x1,0xfb,0xdf,0xf7,0x2,0xfa,0xf1,0xbd,0x37,0x2,0x0,0x21,
+    0xff,0xa,0x20,0xf5,0xf7,0xe,0xfb,0xf1,0xbd,0xdb,0xe0,0x79,0x35,0x0,0xd1,0x5,
+    0x4d,0x0,0x2,0x23,0x6f,0x7b,0xa2,0x7e,0x21,0x25,0x2,0xfa,0xf9,0x17,0x6,0xf7,
+    0x4,0xd1,0x3,0x65,0x2,0x20,0x60,0x71,0xe4,0xee,0x65,0x0,0x0,0xf0,0x8f,0x17,
+    0x0,0x0,0x22,0x5,0xff,0x21,0x48,0x35,0x28,0x0,0x8,0xf0,0x8d,0xff,0xfc,0x7,
+    0x20,0xad,0xe0,0x0,0x22,0x5a,0xbe,0xf,0x8,0x85,0xfc,0x9,0x20,0xa5,0x27,0x0,
+    0xfb,0xf7,0xf7,0xd,0xfa,0x6c,0x0,0xd0,0xcd,0xe0,0x2b,0xdf,0x0,0xb4,0x33,0xd9,
+    0x7d,0x87,0x2,0x18,0x70,0xf5,0x5,0x83,0x0,0x1a,0x83,0x4,0xc0,0xf9,0xb,0x20,
+    0xfd,0x91,0x1b,0x4,0x58,0x7e,0x59,0x78,0x88,0x42,0xdf,0x39,0xd1,0x18,0x7f,0x99,
+    0x7,0x0,0x35,0xd1,0x77,0xd8,0x7f,0xd9,0x7,0x0,0x31,0xd1,0xd6,0x71,0x1,0xff,
+    0x19,0x79,0x88,0x42,0x2c,0xd1,0x5,0x22,0xfb,0x57,0xa1,0x33,0x2,0xdb,0xf9,0xc,
+    0x20,0x77,0xd6,0x5b,0x4,0xdf,0xf9,0x5b,0x2,0x9f,0x3f,0x4,0xd3,0x20,0xfa,0x57,
+    0xa,0x53,0xb7,0x4,0x93,0xf9,0xd,0x20,0x64,0xfe,0x25,0x0,0xb4,0x30,0x40,0x78,
+    0xb0,0x28,0xd,0xf7,0xd1,0xa0,0x79,0xd9,0x3,0x3,0x22,0x4a,0xa1,0x7f,0x2,0xe0,
+    0x3,0x22,0x0,0xbf,0x4b,0x4b,0x4,0xff,0xb5,0xf9,0x10,0x20,0x51,0xe0,0xe0,0x79,
+    0x77,0x6,0x28,0x45,0x21,0x0,0xe0,0x71,0x42,0x57,0x4,0xf5,0xb3,0x57,0x0,0x74,
+    0xf,0x0,0x2,0x28,0x3,0xd1,0x7d,0x4,0x2b,0x0,0x43,0xa1,0x8,0xe0,0x5,0xb,
+    0x0,0x7d,0x6,0x63,0x1,0xd7,0x31,0x2,0xe0,0x6,0x13,0x0,0x7d,0x41,0x3f,0x4,
+    0x95,0xf9,0x11,0x20,0x31,0x33,0x4,0x7d,0x99,0x33,0x0,0x5a,0xd1,0x0,0x22,0x3c,
+    0x1,0x9,0xdf,0x4,0xfc,0x12,0x20,0x24,0x29,0x5,0x2d,0xf9,0xb7,0x12,0x20,0x1f,
+    0x9,0x4,0x28,0xf9,0x69,0x2,0x18,0xbf,0xd0,0x0,0x28,0xe,0xd0,0x62,0x8f,0x4,
+    0x5,0xff,0x2a,0x9,0xd1,0xe,0xe0,0x5,0x2a,0x2,0xfb,0xd1,0x4,0x61,0x1,0x38,
+    0xe0,0xa6,0x68,0xe7,0xdf,0x68,0xbe,0x42,0x3,0xd0,0x2d,0x2,0xca,0xf8,0xff,0xf1,
+    0xbd,0x82,0x42,0x4,0xd1,0x6,0x20,0xf7,0xe0,0x71,0x14,0x7b,0x1,0xf1,0xbd,0x2,
+    0x2a,0xff,0xa,0xd1,0x3,0x28,0x25,0xd1,0xa0,0x71,0xdd,0x11,0xf,0x0,0x6,0x22,
+    0x20,0x83,0x4,0x53,0xf9,0xdf,0x1c,0xe0,0x3,0x2a,0xb,0x15,0x0,0x60,0x71,0x5c,
+    0x2b,0x2,0x1b,0x2,0x4,0x22,0x16,0x1b,0x4,0x45,0xa5,0x1,0x5a,0xc5,0x2,0x60,
+    0x41,0x4,0x6,0xe0,0x37,0x6,0x12,0x1b,0x4,0xe5,0x37,0x8d,0x0,0xa0,0x31,0x4,
+    0xc9,0x1,0x0,0x7e,0x14,0xff,0x0,0x0,0x53,0x53,0xb0,0x54,0x54,0x1,0xff,0x55,
+    0x55,0x0,0x56,0x56,0x8,0x57,0x57,0xff,0x4,0x0,0x50,0x50,0x7,0x51,0x51,0x0,
+    0xa7,0x52,0x52,0x0,0x0,0x0,0xb,0x4,0x10,0xb,0x6,0x6c,0xfb,0x6c,0x4,0x24,
+    0x6,0x7e,0x7e,0x12,0x6c,0x6c,0x3f,0x14,0x5f,0x5f,0xd,0x60,0x60,0x36,0x8,0x11,
+    0x0,0xff,0x0,0x0,0x10,0xb5,0x82,0xb0,0x1,0x7e,0xfd,0x99,0xc7,0x0,0x78,0x21,
+    0x41,0x5c,0x99,0x42,0xff,0x20,0xd1,0x4,0x0,0x3c,0x34,0x11,0x68,0xff,0x21,0x62,
+    0x21,0x78,0x12,0x29,0xb,0xd1,0xfd,0x3,0xaf,0x1,0x8c,0x21,0x19,0x70,0x17,0x21,
+    0xff,0x0,0x91,0x1a,0x0,0xc,0x21,0xfb,0xf7,0x7f,0xbc,0xf8,0x13,0x20,0xc,0xe0,
+    0x14,0x1b,0x24,0x7f,0xae,0xf8,0x15,0x20,0x20,0x70,0x13,0xa3,0x0,0xff,0x38,0xb5,
+    0x4,0x0,0x25,0x0,0x3c,0x35,0xdf,0x28,0x78,0x9,0x28,0x7,0x99,0x1,0x21,0x0,
+    0xf7,0xcb,0x31,0x20,0xc9,0x0,0xd2,0xf8,0xa,0x20,0xf7,0x2d,0xe0,0x7,0xe5,0x1,
+    0x2,0x23,0x16,0xa2,0xfb,0x7e,0x21,0x13,0x2,0x9e,0xf8,0x0,0x22,0x5a,0xef,0x21,
+    0x48,0x34,0x20,0x8b,0x1,0x3e,0xfb,0x9,0xef,0x20,0x1d,0xe0,0x13,0x7,0x1,0xa8,
+    0x78,0x68,0xff,0x70,0x15,0x20,0x17,0xe0,0x12,0x28,0x16,0xff,0xd1,0x68,0x78,0x1,
+    0x28,0x6,0xd1,0x20,0x7f,0x7e,0xb,0xf0,0x95,0xf8,0x1,0x21,0x7,0x2,0x7f,0x99,
+    0xf8,0xe8,0x78,0x5,0x28,0x5,0x25,0x0,0xb6,0x9b,0x1,0xd0,0x20,0x83,0x1,0x8,
+    0xf8,0x31,0x2,0x14,0xaf,0x20,0x28,0x70,0x31,0x23,0x3,0x17,0xdb,0x2,0x4,0xfb,
+    0x0,0x0,0x2d,0x4,0x82,0xf8,0x2,0x23,0x0,0xfb,0xbf,0x8f,0x6f,0x8,0x66,0xf8,
+    0x3c,0x34,0x4,0xbe,0xa7,0x0,0x1,0x20,0x60,0x70,0x10,0x2b,0x0,0x70,0xfe,0x3,
+    0x1,0x5,0x0,0x2e,0x0,0x3c,0x36,0xb0,0xff,0x68,0x0,0x90,0x2c,0x0,0xcd,0x34,
+    0xf0,0xee,0x55,0x0,0x3,0xd1,0x2a,0x23,0x0,0x3,0x20,0x10,0xfb,0xe0,0x5,0x3b,
+    0x0,0x86,0xa2,0x69,0x46,0x28,0xff,0x0,0xb,0xf0,0x71,0xfd,0x0,0xbf,0x7e,0xff,
+    0xa1,0x9,0x18,0x49,0x78,0x21,0x70,0x7e,0xff,0xa1,0x8,0x18,0x40,0x78,0xa0,0x71,
+    0xe0,0xff,0x7f,0xe0,0x70,0xf0,0x78,0xb0,0x70,0x6,0xfb,0x24,0xf4,0x53,0x0,0x70,
+    0x70,0xb0,0x68,0x70,0xe5,0x60,0x6f,0x2,0x78,0x6f,0x0,0xbd,0x3,0x2e,0xf8,0x34,
+    0xf7,0x70,0x73,0xbd,0x11,0x3,0x3d,0x20,0x20,0x5c,0xff,0x2,0x28,0x30,0xd0,0x4c,
+    0xd3,0x4,0x28,0xff,0x27,0xd0,0x5,0xd3,0x5,0x28,0x47,0xd1,0xff,0x0,0x22,0x0,
+    0x21,0x8,0x20,0x41,0xe0,0xff,0x20,0x0,0x9c,0x30,0xe1,0x6d,0x41,0x60,0xff,0x81,
+    0x7e,0x9,0x2,0x42,0x7e,0x11,0x43,0x7f,0x1,0x81,0x1,0x7f,0x9,0x2,0xc2,0x9,
+    0x0,0xf7,0x41,0x81,0x81,0x9,0x0,0x42,0x7f,0x11,0x43,0xff,0x81,0x81,0x21,0x0,
+    0xbc,0x31,0x8a,0x7b,0xff,0x12,0x2,0x49,0x7b,0xa,0x43,0xc2,0x81,0xff,0x22,0x7e,
+    0x21,0x0,0xa0,0x31,0x7,0x20,0xbf,0xf5,0xf7,0x4,0xf9,0x5,0xe0,0xd,0xe,0xfd,
+    0xff,0xf8,0x22,0x0,0x5c,0x32,0x10,0x68,0x90,0xf9,0x63,0x55,0x2,0x33,0x2,0xb,
+    0x78,0x1b,0x2,0xc5,0xbf,0x7f,0x2b,0x43,0x93,0x87,0x8b,0x9,0x0,0x4d,0xff,0x78,
+    0x2b,0x43,0xd3,0x87,0xb,0x79,0x1b,0xff,0x2,0xc9,0x78,0xb,0x43,0x3,0x80,0x12,
+    0xdf,0x7f,0x94,0x34,0x21,0x0,0x39,0x2,0xe0,0xf8,0xfe,0x3d,0x3,0x0,0x0,0x1c,
+    0xa0,0x70,0x47,0x5c,0xff,0x20,0x70,0x47,0x78,0x30,0x0,0x78,0x81,0xaf,0x42,0x1,
+    0xd1,0x2f,0xf,0x0,0x0,0xf,0x10,0x44,0xf8,0xb,0x0,0xf,0x2,0xe7,0x7,0x30,
+    0x35,0x28,0x7b,0x0,0xff,0x28,0x1c,0xd1,0x28,0x0,0x29,0x68,0xc9,0xff,0x68,0x88,
+    0x47,0x0,0x28,0x11,0xd0,0x29,0xff,0x7a,0x20,0x0,0x29,0x30,0x1,0x70,0x23,0xbf,
+    0x0,0xe9,0x33,0x80,0x20,0x18,0x19,0x1,0x28,0xff,0x73,0x3,0x20,0x0,0x90,0x1a,
+    0x0,0x69,0x9e,0x19,0x0,0xfa,0xf7,0x98,0xff,0x69,0x0,0xfb,0x0,0xa,0xfa,0x75,
+    0x0,0xa5,0x75,0x4,0x5c,0x0,0x11,0x0,0x30,0xff,0x4c,0xf7,0x84,0xdd,0x55,0x22,
+    0xaa,0x5c,0xe3,0xe8,0x22,0x86,0x2,0x0,0xc,0xf,0x2a,0xb0,0x12,0x31,0xff,0x0,
+    0xd1,0x22,0xdb,0x1,0xab,0x19,0x65,0xfd,0x0,0x3,0xa,0xea,0x2b,0xd0,0x45,0x29,
+    0x5c,0xfb,0x8f,0x2,0x1e,0x0,0x40,0x14,0xae,0x47,0x1,0xff,0xda,0xeb,0x89,0x43,
+    0x44,0x0,0xd,0x0,0x6f,0x5,0x86,0x4d,0xfe,0x5b,0x2,0xcd,0x9c,0x4a,0x14,0xbd,
+    0x0,0xf,0x22,0xe6,0x94,0x8,0x3,0x3,0xa,0x9a,0xff,0xc9,0x65,0x4e,0x27,0xc5,
+    0x1,0x0,0x7e,0xff,0x10,0x0,0x0,0x2a,0x6,0x17,0x28,0x29,0x6d,0x2a,0x7,0x0,
+    0x26,0x27,0x7,0x4,0x7e,0x11,0x64,0x0,0xfe,0x2f,0x0,0x20,0x4e,0x0,0x0,0x10,
+    0x27,0x0,0x7f,0x0,0x88,0x13,0x0,0x0,0xc4,0x9,0xb,0x0,0xef,0xb5,0x0,0xbf,
+    0x4,0xe5,0x0,0xed,0xfe,0x0,0xff,0xbf,0xa,0xa1,0x20,0x0,0x30,0x30,0xb,0xff,
+    0xf0,0x23,0xf8,0xc2,0x48,0x1,0x0,0x8,0x7f,0x31,0x21,0x60,0x60,0x30,0x20,0x63,
+    0xbf,0x0,0xff,0x21,0x20,0x0,0x40,0x30,0x8,0xf0,0xbd,0xff,0xf9,0x0,0x20,0x3c,
+    0x21,0x60,0x54,0x20,0xff,0x0,0x10,0xbd,0x4,0x1,0x10,0x11,0x12,0xf7,0x13,0x40,
+    0x32,0x87,0x2,0x2,0x7e,0x91,0x42,0xfb,0x0,0xd0,0x65,0x3,0x1,0x0,0x1,0x20,
+    0x9,0xff,0x7e,0x88,0x40,0x80,0xb2,0x70,0x47,0xf8,0xfe,0x71,0x1,0xe,0x0,0x4,
+    0x20,0x21,0x0,0x3c,0xff,0x31,0x48,0x70,0x27,0x0,0x10,0x37,0x0,0xff,0x25,0x3d,
+    0x60,0x0,0x21,0x38,0x7a,0xa,0xff,0xf0,0xe,0xff,0x2,0x23,0xaa,0x4a,0x4b,0xfe,
+    0x57,0x0,0xfa,0xf7,0xf3,0xfe,0x5,0x20,0x3c,0xef,0x34,0x20,0x70,0x1,0x19,0x4,
+    0x19,0xff,0xa5,0xff,0x48,0x86,0x42,0x1,0xdb,0x3,0x20,0xf2,0xfb,0xbd,0x0,0x3,
+    0x0,0x8,0xa0,0x8,0x60,0x1,0xff,0x20,0x8,0x71,0xa0,0x4a,0x8a,0x60,0xaf,0xff,
+    0x22,0xca,0x80,0xc2,0x4,0xca,0x60,0x5,0xff,0x22,0xa,0x61,0x9d,0x4a,0x4a,0x61,
+    0x88,0xfd,0x61,0x73,0x2,0x0,0x0,0x42,0x6f,0x73,0x63,0xff,0x68,0x20,0x53,0x65,
+    0x6e,0x73,0x6f,0x72,0xff,0x74,0x65,0x63,0x20,0x42,0x4d,0x4d,0x31,0xfb,0x35,0x30,
+    0xe3,0x0,0x68,0x1,0x28,0x2,0xda,0xff,0x0,0x20,0x88,0x60,0x70,0x47,0x90,0x4a,
+    0x7f,0x90,0x42,0x2,0xda,0x8a,0x60,0x4,0x31,0x2,0xfa,0x3,0x0,0x70,0x9d,0x4,
+    0xb5,0x68,0x22,0x68,0xd2,0xff,0x69,0x90,0x47,0x0,0x28,0x1f,0xd1,0xb0,0xff,0x68,
+    0x85,0x42,0x1,0xd0,0x5,0x20,0x70,0xff,0xbd,0x25,0x0,0x3c,0x35,0xe8,0x61,0xb0,
+    0xfe,0x3d,0x0,0x1,0xdb,0xb,0x20,0x0,0xe0,0x4,0xff,0x20,0x68,0x70,0x28,0x78,
+    0x4,0x28,0x1,0xff,0xd0,0x0,0x28,0xa,0xd1,0x68,0x78,0xb,0xbf,0x28,0x7,0xd1,
+    0x2,0x23,0x7e,0xbf,0x8,0x93,0xdf,0xfe,0x6,0x20,0x28,0x70,0x53,0x0,0xbd,0x70,
+    0xff,0xb5,0x82,0xb0,0x5,0x0,0x2e,0x0,0x10,0xef,0x36,0x30,0x7a,0x98,0x11,0x1,
+    0xdf,0xe0,0x2c,0xff,0x0,0x38,0x34,0x20,0x79,0x40,0x1e,0xe,0xff,0x28,0x0,0xd9,
+    0xd8,0xe0,0x1,0xa1,0x9,0xff,0x5c,0x49,0x0,0x8f,0x44,0x26,0x7,0xd4,0xff,0xd4,
+    0xbf,0x5d,0xd4,0x65,0x6f,0x7c,0xd4,0xff,0x8b,0xd4,0x8d,0x98,0x0,0x28,0x0,0x2d,
+    0xef,0x30,0x0,0x78,0x0,0x55,0x0,0x0,0x22,0x6,0xff,0x21,0x40,0x35,0x28,0x0,
+    0x8,0xf0,0xe,0xbf,0xf9,0x3,0x20,0xbe,0xe0,0x28,0x8f,0x1,0x31,0xef,0x6a,0xc9,
+    0x68,0x88,0xa1,0x0,0x39,0xd0,0x21,0xff,0x78,0x28,0x0,0x29,0x30,0x1,0x70,0x2,
+    0xeb,0x23,0x5f,0x7b,0x0,0x28,0x7b,0x0,0x55,0xfe,0x73,0xfd,0xbd,0x3d,0xa,0x16,
+    0xd1,0x29,0x0,0x69,0x31,0x5e,0x31,0x2,0x32,0x6a,0x92,0x68,0xd3,0x2,0xd,0x93,
+    0x1,0xdf,0x60,0x71,0x0,0x21,0x30,0x57,0x1,0x55,0xfe,0x57,0x2,0x23,0x4d,0x35,
+    0x8,0x3a,0x71,0x1,0x90,0x5b,0x14,0xf5,0xb,0x5b,0x10,0x48,0x25,0x8,0x27,0xfe,
+    0x2,0x20,0xff,0x7d,0xe0,0x0,0x22,0x0,0x21,0xa,0x20,0x2f,0xf4,0xf7,0x28,0xff,
+    0x4b,0x2,0x75,0xf,0x0,0xa1,0xa,0xdf,0xbd,0xf8,0x7,0x20,0x6d,0x45,0x0,0x0,
+    0xf0,0xbf,0xb9,0xf9,0x2,0x22,0x3b,0xa1,0x33,0x2,0x37,0xef,0xfe,0x9,0x20,0x63,
+    0x13,0x0,0xfa,0xf7,0x3b,0xef,0xfe,0x0,0x28,0x5f,0x25,0x1,0x37,0xa2,0x4e,0xfe,
+    0x4d,0x4,0x0,0xfe,0xa,0x20,0x56,0xe0,0xb,0xff,0x20,0x20,0x71,0x20,0x6a,0x30,
+    0x60,0xfa,0xff,0x21,0x89,0x0,0xe9,0xf7,0x6d,0xfa,0x2,0xfb,0x0,0x0,0x4d,0x8,
+    0x96,0xf8,0x73,0xbd,0xd,0xff,0x20,0x45,0xe0,0x9,0x20,0x0,0x90,0x2b,0xbf,0x0,
+    0x68,0x33,0x3d,0xa2,0x42,0x37,0x4,0xd9,0xef,0xfd,0xf,0x20,0x3a,0x65,0x4,0xca,
+    0xf8,0x60,0xff,0x79,0xb,0x28,0x10,0xd1,0x20,0x6a,0x31,0x5f,0x68,0x81,0x42,0xa,
+    0xd0,0x45,0xa,0x4a,0x45,0x0,0xfb,0x11,0x0,0x45,0x6,0x73,0xf8,0xb,0x20,0x23,
+    0x7e,0x2d,0x0,0x40,0x30,0x8,0xf0,0x7e,0xf8,0xf9,0x6,0xdf,0xd8,0xfd,0x2,0x23,
+    0xf,0xd3,0x8,0xbd,0xfd,0xff,0x5,0x20,0x13,0xe0,0x60,0x79,0x4,0x28,0xfd,0x10,
+    0xcb,0x1,0x6,0xd1,0x20,0x71,0x0,0x22,0xeb,0x29,0x0,0xdf,0x2,0xb8,0x49,0x1,
+    0x2,0x23,0x0,0x77,0xbf,0xd2,0xa2,0x29,0x6,0xa8,0xfd,0x6,0xab,0x0,0xff,0x73,
+    0xbd,0x7c,0x43,0x3,0x0,0x34,0x34,0xff,0x2,0x0,0x1,0x50,0x0,0x0,0x10,0x27,
+    0xdf,0x0,0x0,0xff,0x7f,0x0,0xd3,0x1,0x2,0x0,0xff,0x51,0x51,0x4,0x52,0x52,
+    0xe,0x0,0x0,0xfb,0x4e,0x84,0xf,0x0,0xb5,0x4,0x0,0x20,0x7e,0xff,0x98,0x42,
+    0x1f,0xd1,0x25,0x0,0x3c,0x35,0xf7,0x28,0x78,0xd,0xa5,0x0,0x10,0x68,0xa8,0x61,
+    0xff,0x0,0x21,0x20,0x7e,0xa,0xf0,0x98,0xfd,0xaa,0xd3,0x2,0x23,0xd3,0x0,0x8,
+    0xd3,0x0,0x20,0x5b,0x0,0x6f,0xce,0xd3,0x0,0x8,0xe0,0xc,0xef,0x1,0x25,0xe,
+    0x85,0xfd,0xff,0xe,0x20,0x28,0x70,0x31,0xbd,0xc2,0x0,0xfe,0x0,0xe,0x10,0xb5,
+    0x82,0xb0,0x4,0x0,0x3c,0x7f,0x20,0x20,0x5c,0xb,0x28,0xf,0xd1,0x25,0x2,0xd7,
+    0x6a,0xfd,0x1,0x2d,0x4,0x6e,0xd3,0x0,0x0,0xbf,0xf7,0xa8,0xa2,0x4c,0x4f,0x4,
+    0x52,0xfd,0xc,0x20,0x7f,0x1a,0xe0,0x7,0x28,0xb,0xd1,0x16,0x69,0x8,0xdf,0x0,
+    0xbf,0xa2,0xa2,0x5d,0x1b,0x4,0x39,0xfd,0xff,0x8,0x20,0xc,0xe0,0x3,0x28,0xc,
+    0xd1,0xdd,0x2,0x1b,0xc,0xa1,0xa2,0x40,0x1b,0x4,0x2b,0xfd,0xff,0x1,0x20,0x3c,
+    0x34,0x20,0x70,0x13,0xbd,0xff,0x0,0x0,0x82,0xa0,0x70,0x47,0x44,0x20,0xfb,0x70,
+    0x47,0xcb,0x2,0x25,0x0,0x30,0x35,0x1,0xff,0x20,0x68,0x73,0x28,0x0,0x29,0x68,
+    0xc9,0xff,0x68,0x88,0x47,0x29,0x7a,0x20,0x0,0x29,0x97,0x30,0x1,0x70,0x73,0x2,
+    0x8a,0x1f,0x1,0x3b,0x2,0x18,0xff,0xfd,0x2,0x20,0x28,0x73,0x31,0xbd,0xf8,0xfe,
+    0x2f,0x0,0x18,0x30,0xc0,0x6b,0x21,0x0,0x18,0xff,0x31,0x48,0x64,0x25,0x0,0x60,
+    0x35,0x28,0xff,0x7b,0x0,0x6,0xc0,0x14,0xe9,0x7a,0xc9,0xff,0x8,0x8,0x43,0x69,
+    0x46,0x8,0x80,0xa8,0xfe,0xf,0x0,0x47,0x14,0x68,0x7b,0x40,0x8,0x7,0xff,0x43,
+    0x28,0x7c,0x86,0x1,0xe8,0x7b,0x80,0xff,0x8,0x6,0x43,0x0,0x23,0x32,0x0,0xa8,
+    0xff,0x7a,0x0,0x6,0xc1,0x14,0x68,0x7a,0xc0,0xef,0x8,0x1,0x43,0x20,0xe1,0x1,
+    0x16,0xf8,0x28,0x7b,0x80,0x1,0x17,0x0,0x0,0x99,0x9,0xb2,0xf,0x2,0x7f,0xe,
+    0xf8,0x68,0x80,0x32,0x0,0x39,0xb,0x4,0xff,0x49,0xf8,0xa8,0x80,0x22,0x7e,0x5c,
+    0x34,0xf7,0x21,0x0,0x7,0xad,0x1,0xe1,0xfd,0xf1,0xbd,0xff,0xf0,0xb5,0xc,0x0,
+    0x39,0x49,0x8c,0x42,0xff,0x1,0xd1,0x38,0x48,0x37,0xe0,0x82,0x30,0xff,0x5,0x0,
+    0x0,0x2b,0x3,0xd0,0x2,0x20,0x7f,0x2e,0x56,0x3,0x20,0x2,0xe0,0x0,0x7,0x0,
+    0xff,0x1,0x20,0x2f,0x56,0xe9,0x89,0x88,0x3,0xff,0x0,0x2a,0x0,0xd0,0x11,0x0,
+    0xe9,0xf7,0xff,0x35,0xf9,0x80,0x21,0xc9,0x1,0x42,0x1a,0xff,0x12,0xb2,0x10,0x0,
+    0x50,0x43,0x29,0x79,0xff,0xc9,0x1,0x51,0x43,0x82,0x11,0x52,0xe,0xff,0x10,0x18,
+    0xc0,0x11,0x5,0x22,0xaa,0x56,0xff,0x50,0x43,0x8,0x18,0x1,0x12,0xc9,0xd,0xff,
+    0x8,0x18,0x40,0x12,0x80,0x21,0x49,0x3,0xff,0x40,0x18,0xa0,0x37,0x78,0x43,0xc1,
+    0x12,0xfd,0x9,0x11,0x0,0x0,0x13,0x60,0x43,0x1f,0x49,0xff,0xe9,0xf7,0x13,0xf9,
+    0x0,0xb2,0xf1,0x0,0xff,0x40,0x18,0x0,0xb2,0xf0,0xbd,0x30,0xb5,0xdf,0x13,0x0,
+    0x1b,0x4a,0x91,0x81,0x0,0x18,0x48,0xff,0x28,0xe0,0x1b,0xb2,0x88,0x30,0x2,0x0,
+    0xff,0x4,0x20,0x14,0x5e,0x10,0x89,0x0,0xb2,0xff,0x18,0x1a,0x60,0x43,0x80,0x24,
+    0x24,0x2,0xff,0x15,0x88,0x5b,0x0,0x6b,0x43,0x1b,0x19,0xff,0x6,0x25,0x55,0x5f,
+    0x49,0x1b,0xc9,0x3,0xff,0x45,0x10,0xad,0xf,0x28,0x18,0x80,0x10,0xff,0x8,0x1a,
+    0xd9,0x13,0x9,0xc,0xc9,0x18,0xff,0x9,0x14,0x52,0x88,0x89,0x18,0x9,0xb2,0xff,
+    0xe9,0xf7,0xe6,0xf8,0xa0,0x42,0x1,0xdb,0xff,0x60,0x1e,0x3,0xe0,0x7,0x49,0x88,
+    0x42,0x7f,0x0,0xda,0x8,0x0,0x0,0xb2,0x30,0x99,0x1,0xfe,0x0,0x0,0xf0,0xff,
+    0xff,0x0,0x80,0xff,0xff,0x7d,0x4,0x8,0x1,0x0,0xc0,0xff,0xff,0x1,0xb,0x0,
+    0xff,0x1,0x0,0x69,0x31,0xa,0x78,0x4a,0x76,0xff,0xca,0x79,0x8a,0x76,0x4a,0x78,
+    0xca,0x76,0xff,0xa,0x7a,0xa,0x77,0xa,0x7d,0x4a,0x77,0xff,0xca,0x7c,0x8a,0x77,
+    0x88,0x30,0x8a,0x7b,0xff,0x12,0x2,0x4b,0x7b,0x1a,0x43,0x2,0x80,0xff,0xa,0x7b,
+    0x12,0x6,0x12,0x14,0xcb,0x7a,0xbf,0x1a,0x43,0x42,0x80,0x8a,0x7c,0xb,0x2,0x4b,
+    0x7f,0x7c,0x1a,0x43,0x82,0x80,0x8a,0x79,0xb,0x4,0xff,0x79,0x1a,0x43,0xc2,0x80,
+    0xa,0x7c,0x52,0xff,0x6,0x52,0xc,0xc9,0x7b,0xa,0x43,0x2,0xff,0x81,0x70,0x47,
+    0x0,0x0,0x44,0x0,0xf,0xff,0x0,0x71,0x5c,0x33,0xe4,0xdd,0x55,0x22,0x8f,0xaa,
+    0xe1,0x7a,0x14,0x82,0x4,0x0,0xa,0xf,0x22,0x4c,0xf7,0x37,0x89,0x1,0x3,0xa,
+    0xff,0xff,0xff,0x7f,0xdf,0xe8,0x36,0xc2,0xec,0x4b,0x1b,0x0,0x4b,0x1,0x7f,0x0,
+    0x0,0x4c,0x2,0x0,0x0,0xdd,0x31,0x14,0xfa,0x0,0xe,0xc0,0x3,0x0,0xf8,0xb5,
+    0x1,0x24,0x88,0xff,0x48,0x0,0x68,0x84,0x40,0x88,0x48,0x60,0xff,0x43,0x0,0x90,
+    0x87,0x4d,0xfa,0x26,0xb6,0xfb,0x0,0x31,0xad,0x1,0x61,0xf8,0xa8,0x81,0x85,0xfc,
+    0x13,0x0,0xb,0x2,0x5b,0xf8,0xe8,0x81,0x83,0x4f,0xf7,0x67,0x43,0x38,0x19,0x4,
+    0x54,0xf8,0x28,0x82,0xfd,0x80,0x19,0x8,0x4e,0xf8,0x68,0x82,0x7e,0x4e,0xfe,0x17,
+    0x6,0x48,0xf8,0x7,0x0,0x2f,0x80,0x7c,0xfe,0x19,0x8,0x41,0xf8,0x68,0x80,0xca,
+    0x48,0x44,0xfb,0x43,0x20,0x1b,0x4,0x3a,0xf8,0xa8,0x80,0x0,0xfd,0x98,0x9,0x2,
+    0x35,0xf8,0xe8,0x80,0x2f,0x81,0xfd,0xf1,0x59,0x1,0x10,0xb5,0x0,0xbf,0x4,0x0,
+    0xff,0xfa,0xf7,0x6f,0xfb,0x0,0xbf,0x8,0xa1,0xff,0x20,0x0,0x30,0x30,0xa,0xf0,
+    0xa5,0xfc,0xff,0xbe,0x48,0x1,0x0,0x8,0x31,0x21,0x60,0xff,0x60,0x30,0x20,0x63,
+    0x0,0x20,0x7a,0x21,0xf7,0x60,0x54,0x3c,0x3,0x0,0x20,0x0,0x10,0xbd,0xff,0x2,
+    0x1,0x18,0x19,0x0,0x0,0xf,0x33,0xfe,0xbb,0x2,0x2,0x7e,0x91,0x42,0x0,0xd0,
+    0x0,0xff,0x20,0x70,0x47,0x1,0x0,0x1,0x20,0x9,0xdf,0x7e,0x88,0x40,0x80,0xb2,
+    0x3b,0x3,0xf8,0xb5,0xff,0x4,0x0,0xe,0x0,0x15,0x0,0x0,0x20,0xff,0x6a,0x46,
+    0x10,0x70,0x8,0x21,0x3c,0x22,0xff,0xa1,0x54,0x2,0x21,0x22,0x0,0x3c,0x32,0xff,
+    0x51,0x70,0x21,0x0,0x3c,0x31,0x48,0x60,0xff,0x0,0x21,0x20,0x0,0xc,0x30,0x0,
+    0x7b,0xff,0xa,0xf0,0x8b,0xfb,0x6,0x23,0xa3,0x4a,0x7d,0xa0,0xf,0x0,0xfa,0xf7,
+    0x70,0xfb,0x1,0x17,0xc,0xef,0x97,0xfb,0x22,0x0,0x25,0x2,0x48,0x30,0x7,0xff,
+    0xf0,0x3,0xfe,0x7a,0x20,0x20,0x5c,0x0,0xbf,0x28,0xb,0xd1,0x7,0x22,0x2c,0xa3,
+    0x0,0x7a,0xff,0x30,0xe8,0xf7,0xf9,0xfd,0x3,0x22,0x2b,0xfa,0xb,0x0,0x81,0xb,
+    0x0,0xf3,0xfd,0x0,0x2d,0x1,0xff,0xd1,0x3,0x20,0x4,0xe0,0xe,0x35,0x28,0xff,
+    0x0,0xf,0x21,0xe8,0xf7,0xc2,0xff,0x21,0xff,0x0,0x7a,0x31,0x8,0x72,0xa6,0x81,
+    0x34,0xff,0x4d,0x4,0x23,0x2a,0x0,0xc,0x32,0x21,0xff,0x0,0xc,0x31,0x20,0x0,
+    0xa,0xf0,0xb0,0xff,0xfc,0x6,0x0,0x1e,0xa0,0x80,0x19,0x40,0xfd,0x78,0x21,0x2,
+    0x48,0x73,0x1d,0xa0,0x71,0x0,0xff,0x40,0x18,0x40,0x88,0xa0,0x81,0x1,0x27,0xff,
+    0xfa,0x21,0x89,0x0,0xe8,0xf7,0xa4,0xff,0xff,0x25,0x49,0xa,0x68,0x1,0x21,0x91,
+    0x40,0xbf,0x48,0x43,0x2a,0x49,0x48,0x43,0x15,0x6,0x9c,0x3c,0x51,0x0,0xb9,0x0,
+    0x86,0x70,0x0,0x28,0x2d,0x0,0xb,0x2,0x7b,0x88,0x86,0x89,0x2,0x0,0x79,0x0,
+    0x7,0x72,0x0,0xfe,0x4b,0x0,0x49,0x7b,0x9,0x1,0x1,0x43,0x7a,0xff,0x34,0x21,
+    0x71,0x0,0x2e,0x1,0xd5,0x68,0xff,0x46,0x7,0x70,0x68,0x46,0x0,0x78,0xf2,0xbe,
+    0x63,0x1,0x20,0x57,0x21,0x10,0x88,0x2f,0x1,0x32,0xff,0xb,0x0,0x0,0x3,0x0,
+    0x1,0x2,0x3,0xfe,0xb,0x0,0x80,0x3e,0xd0,0x7,0xa0,0xf,0x40,0xff,0x1f,0x80,
+    0x3e,0x0,0x0,0x11,0xa2,0xa,0xff,0x60,0x1,0x22,0xa,0x71,0xc8,0x23,0x9b,0xff,
+    0x0,0x8b,0x60,0xc,0x23,0xcb,0x80,0x6e,0xff,0x30,0x3,0x88,0xcb,0x60,0x40,0x88,
+    0x8,0x7f,0x61,0x5d,0x48,0x48,0x61,0x8a,0x61,0x63,0x3,0xff,0x0,0x0,0x74,0x4d,
+    0x3,0x0,0xea,0x72,0xff,0x0,0x0,0xd4,0x48,0x0,0x20,0xd4,0xe5,0xff,0x0,0x0,
+    0xa8,0xcb,0x1,0x0,0xe0,0x64,0xff,0x2,0x0,0x40,0x42,0xf,0x0,0x4e,0x26,0xff,
+    0x0,0x0,0x53,0x54,0x4d,0x69,0x63,0x72,0xff,0x6f,0x65,0x6c,0x65,0x63,0x74,0x72,
+    0x6f,0xff,0x6e,0x69,0x63,0x73,0x20,0x4c,0x49,0x53,0xf7,0x33,0x44,0x48,0x6f,0x0,
+    0x70,0xb5,0x82,0xb0,0xfd,0x5,0x95,0x1,0x0,0x24,0x30,0x68,0x1,0x28,0xff,0x1,
+    0xda,0x0,0x20,0x76,0xbd,0x0,0x90,0x7f,0x8,0x23,0x8,0xa2,0x69,0x46,0x28,0x17,
+    0x1,0xff,0xdb,0xff,0x0,0x99,0x31,0x60,0x0,0xbf,0xff,0xc,0xa1,0x9,0x18,0x49,
+    0x78,0x88,0x35,0xfd,0x29,0xe8,0x0,0x0,0xd5,0x1,0x24,0x20,0x0,0xfb,0x76,0xbd,
+    0x5f,0x2,0xa0,0x86,0x1,0x0,0x40,0xfd,0x9c,0xcb,0x0,0x4e,0x0,0x0,0x10,0x27,
+    0x0,0x7f,0x0,0x88,0x13,0x0,0x0,0xc4,0x9,0xf,0x0,0x7a,0xcc,0x0,0x9,0xd2,
+    0x0,0x4,0x5,0x6,0x7,0xe,0x0,0xfe,0xfb,0x9,0x35,0x68,0x22,0x68,0xd2,0x69,
+    0x90,0xff,0x47,0x7,0x0,0x51,0xd1,0x30,0x68,0x85,0xff,0x42,0x1,0xd0,0x5,0x20,
+    0xf2,0xbd,0x25,0xf7,0x0,0x3c,0x35,0x4d,0x7,0xf2,0xfe,0xa8,0x60,0xfe,0x87,0x4,
+    0xdb,0x9,0x21,0x4,0xe0,0x0,0x28,0xff,0x1,0xd5,0x14,0x21,0x0,0xe0,0x2,0x21,
+    0xff,0x69,0x70,0x29,0x78,0x2,0x29,0x4,0xd0,0xff,0x9,0x29,0x1d,0xd0,0x14,0x29,
+    0x12,0xd0,0x7f,0x32,0xe0,0x69,0x78,0x9,0x29,0x13,0xb,0x0,0xff,0x2d,0xd1,0x0,
+    0x21,0x20,0x7e,0xa,0xf0,0xff,0x73,0xfa,0x2,0x23,0x19,0x4a,0xb0,0x21,0xff,0x20,
+    0x0,0xfa,0xf7,0x58,0xfa,0xb,0x20,0x77,0x28,0x70,0x20,0x23,0x0,0x2,0x29,0x11,
+    0x33,0x0,0xff,0x1b,0xd1,0x14,0x49,0x8,0x60,0x3,0x20,0xd5,0xc,0x11,0x4,0x8,
+    0x35,0x0,0x6,0x15,0x0,0x10,0xd1,0xfd,0xe,0xcf,0x1,0x82,0x42,0xc,0xd0,0x8,
+    0x60,0xf9,0x8,0x2f,0x0,0x47,0x6,0x4f,0xfa,0x6,0x23,0x5,0x7b,0x4a,0xa0,0x47,
+    0x4,0x34,0xfa,0x38,0x0,0xa7,0x3,0xff,0x9c,0x4c,0x0,0x0,0xec,0x43,0x3,0x0,
+    0xff,0x54,0x3c,0x2,0x0,0xff,0x7f,0x0,0x0,0xbd,0x5c,0x7,0x0,0xd4,0x49,0x0,
+    0x20,0xd3,0x2,0x27,0xff,0x0,0x18,0x37,0x38,0x78,0x98,0x42,0x0,0xff,0xd0,0x4c,
+    0xe1,0x25,0x0,0x38,0x35,0x29,0xff,0x79,0x49,0x1e,0x14,0x29,0x0,0xd9,0x45,0xff,
+    0xe1,0x2,0xa2,0x49,0x0,0x52,0x5a,0x97,0xff,0x44,0x0,0xbf,0x2a,0x0,0x82,0x2,
+    0x50,0xeb,0x1,0x90,0x5,0x0,0xae,0x3,0x0,0x42,0x1,0x82,0xff,0x2,0xf2,0x0,
+    0x8e,0x1,0x9e,0x1,0xae,0xfe,0x9,0x0,0xbe,0x1,0xce,0x1,0xe8,0x1,0xfa,0xff,
+    0x1,0x1a,0x2,0x82,0x2,0x6a,0x2,0x20,0xff,0x0,0x2d,0x30,0x0,0x78,0x0,0x28,
+    0xf,0xff,0xd1,0x21,0x0,0x85,0x31,0x20,0x0,0x30,0xff,0x30,0xba,0x69,0x92,0x68,
+    0x90,0x47,0x0,0xff,0x28,0x6,0xd0,0x0,0x22,0x21,0x0,0xa,0xff,0x20,0xf4,0xf7,
+    0xf1,0xfa,0x0,0x20,0x8,0x7d,0xe1,0x1b,0x2,0xb9,0x69,0xc9,0x68,0x88,0x1b,0x0,
+    0xff,0xf,0xd0,0x29,0x78,0x20,0x0,0x29,0x30,0xff,0x1,0x70,0x68,0x78,0x26,0x0,
+    0x6c,0x36,0xff,0x30,0x76,0x22,0x0,0x84,0x32,0x3,0x21,0xff,0x0,0x91,0x13,0x0,
+    0x80,0x21,0x1,0x43,0xbf,0x5b,0xe0,0x0,0x22,0x0,0x21,0x3b,0x2,0xd3,0xfe,0x3b,
+    0x0,0xea,0xe0,0xa,0xf0,0xd4,0xf9,0x1,0xff,0x21,0x38,0x78,0xa,0xf0,0xd8,0xf9,
+    0x5,0xf7,0x20,0x28,0x71,0x33,0x4,0x70,0x0,0x20,0x70,0xff,0x77,0x0,0x22,0x16,
+    0xe0,0x69,0x79,0x9,0xdf,0x29,0x0,0xd0,0xd9,0xe0,0x15,0x2,0xa,0xf0,0xff,0xd5,
+    0xf9,0x0,0x28,0x2,0xd0,0x70,0x7f,0xaf,0x5,0x28,0x2a,0xdb,0x21,0x2,0x30,0x9d,
+    0x0,0xa,0xdf,0xd0,0x40,0x1e,0x30,0x70,0x39,0x2,0x0,0x22,0xff,0xb,0x21,0x48,
+    0x34,0x20,0x0,0x7,0xf0,0xff,0x44,0xfc,0xf1,0xbd,0x20,0x0,0x0,0xf0,0x5f,0x61,
+    0xf9,0x9,0x20,0xb9,0x43,0x8,0xb7,0x43,0x4,0x7f,0xf1,0x7b,0x9,0x9,0x32,0x7f,
+    0x91,0x21,0x1,0xf5,0xaf,0x79,0x0,0xad,0x4f,0x0,0x5,0xd1,0x70,0x77,0xea,0x2b,
+    0x2,0x4b,0x2b,0x0,0xa3,0x23,0x4,0x70,0x7f,0x40,0xff,0x1c,0x70,0x77,0x27,0x20,
+    0xb0,0x71,0x8,0xff,0x20,0x0,0x90,0x23,0x0,0x72,0x33,0x22,0xef,0x0,0x72,0x32,
+    0xa7,0x85,0x5,0x66,0xf9,0xf1,0xff,0xbd,0x69,0x79,0x2,0x29,0x1,0xd1,0x2,0xd7,
+    0x20,0x8c,0xe0,0xf5,0x1,0xd1,0x31,0x2,0xf0,0x7b,0xff,0x0,0x7,0x0,0xf,0x31,
+    0x7f,0x9,0x1,0xff,0x1,0x43,0xf1,0x73,0x7,0x23,0x22,0x0,0xcf,0x7a,0x32,0xb0,
+    0x7b,0xed,0x2,0x33,0x2,0x57,0xf9,0xef,0x4,0x20,0x76,0xe0,0xf3,0x0,0xf0,0x67,
+    0xf9,0xdf,0x2,0x23,0xad,0xa2,0xb0,0x49,0x4,0x4c,0xf9,0xff,0xb,0x20,0x6b,0xe0,
+    0x6,0x23,0xa7,0xa2,0xbe,0xdf,0x7,0x44,0xf9,0xc,0x20,0x63,0xf,0x0,0xa6,0x5e,
+    0xf,0x8,0x3c,0xf9,0xd,0x20,0x2b,0x3,0x64,0xd3,0x8,0xff,0xda,0xfb,0xe,0x20,
+    0x53,0xe0,0x4,0x23,0xfd,0xa0,0x1f,0x8,0x2c,0xf9,0x10,0x20,0x4b,0xe0,0xfd,0x3,
+    0x6b,0x0,0x81,0x32,0x20,0x0,0x6c,0x30,0xfb,0x40,0x7d,0x6f,0xa,0x1f,0xf9,0x11,
+    0x20,0x3e,0xbf,0xe0,0x2,0x23,0x0,0xbf,0x96,0x6b,0x8,0x16,0xff,0xf9,0x12,0x20,
+    0x35,0xe0,0x31,0x20,0x21,0xbf,0x0,0x6c,0x31,0x88,0x71,0x4,0xd5,0x8,0x0,0xef,
+    0xbf,0x90,0xa2,0x31,0x1f,0x4,0xfb,0xf8,0x13,0xff,0x20,0x25,0xe0,0x68,0x79,0x14,
+    0x28,0xc,0x75,0xd0,0x37,0x2,0x84,0x37,0x8,0xfa,0xf8,0x0,0x99,0x5,0x67,0xb,
+    0xf9,0x15,0x5f,0x1,0x9,0x2,0xfe,0xf8,0xab,0x7,0xff,0x2,0xf9,0x6c,0x34,0xe0,
+    0x79,0x40,0x6,0x6b,0x4,0xd4,0xd,0x2,0x9,0x47,0x1,0x4,0xd0,0xd7,0x3,0xdd,
+    0x8,0xd7,0x1,0xe7,0xf9,0x14,0x2d,0x0,0xf1,0xbd,0xf9,0x8,0x93,0x3,0x2d,0x4,
+    0xeb,0xf8,0x6,0x23,0x6d,0xfe,0xb7,0x8,0xd0,0xf8,0xf1,0xbd,0x1,0x7e,0x99,0xfe,
+    0x81,0x1,0x70,0x47,0x10,0xb5,0x82,0xb0,0x4,0xff,0x0,0x3c,0x34,0x11,0x68,0x21,
+    0x62,0x21,0xff,0x78,0x5,0x29,0x4,0xd0,0x9,0x29,0x11,0xff,0xd0,0x14,0x29,0x1e,
+    0xd0,0x13,0xbd,0x6,0xff,0x21,0x21,0x70,0x27,0x21,0x72,0x22,0x81,0xbf,0x54,0x8,
+    0x21,0x0,0x91,0x3,0xaf,0x0,0x2,0x7e,0x85,0x5,0xfa,0xf7,0xa4,0xf8,0x13,0xbd,
+    0x19,0x26,0xff,0x97,0xf8,0xa,0x20,0x20,0x70,0x13,0xbd,0xde,0x89,0xa,0xa2,0xf9,
+    0x13,0xbd,0x63,0x8,0x20,0x20,0xff,0x5c,0x5,0x28,0x2,0xd0,0xe,0x28,0x17,0xbe,
+    0x5b,0x2,0x20,0x3c,0x21,0x60,0x54,0x35,0x3,0x1,0xbe,0x75,0x0,0x1,0xda,0x49,
+    0x1c,0x1,0x6b,0x0,0x81,0xea,0xef,0x21,0x6e,0x6b,0x0,0x25,0x37,0x1d,0x41,0xa2,
+    0x25,0x7e,0x1d,0x4,0x5f,0xf8,0xf,0x20,0x3c,0x34,0x71,0x4,0xff,0x0,0x24,0xa0,
+    0x70,0x47,0x44,0x20,0x70,0xff,0x47,0x38,0xb5,0x4,0x0,0x25,0x0,0x30,0xff,0x35,
+    0x28,0x7b,0x0,0x28,0x1e,0xd1,0x28,0xff,0x0,0x29,0x68,0xc9,0x68,0x88,0x47,0x0,
+    0xff,0x28,0x13,0xd0,0x29,0x7a,0x20,0x0,0x29,0xff,0x30,0x1,0x70,0x22,0x0,0x84,
+    0x32,0x68,0xff,0x7a,0x10,0x70,0x1,0x20,0x28,0x73,0x3,0xde,0x53,0x0,0x13,0x0,
+    0x10,0x78,0xbb,0xb,0x36,0xf8,0xb5,0x31,0xbd,0x4,0xa,0xbd,0x0,0x43,0xf9,0xb,
+    0x0,0x0,0xff,0x10,0xb5,0x1,0x0,0x18,0x31,0x4a,0x6c,0xff,0x8a,0x64,0x2,0x0,
+    0x64,0x32,0x53,0x7c,0xff,0x1b,0x2,0x14,0x7c,0x23,0x43,0x13,0x80,0xf5,0xd3,0x9,
+    0x0,0x94,0x9,0x0,0x53,0x80,0x53,0x7d,0xfe,0x13,0x0,0x7d,0x23,0x43,0x93,0x80,
+    0xa,0x78,0xdf,0x60,0x30,0x1,0x0,0x7,0x3b,0x0,0x25,0xf9,0xfd,0x10,0x3b,0x0,
+    0x44,0x0,0xd,0x0,0x68,0x28,0xff,0x41,0x3c,0xdd,0x55,0x22,0xaa,0x90,0xa0,0x79,
+    0x0,0x0,0x14,0xf,0x22,0xd,0x45,0x17,0x33,0x3,0xa,0xff,0x60,0x76,0x47,0x50,
+    0x40,0x5a,0x0,0x30,0xd7,0x20,0x0,0x21,0x1f,0x4,0x30,0x3,0x0,0x20,0x7f,0xf7,
+    0x21,0x10,0x88,0x7,0x2,0x2e,0x21,0x40,0x30,0xbb,0x2a,0x0,0xe7,0x0,0x0,0x0,
+    0x31,0x3,0x0,0x10,0xff,0xb5,0x0,0xbf,0x4,0x0,0xf9,0xf7,0x9f,0xff,0xff,0x0,
+    0xbf,0x8,0xa1,0x20,0x0,0x30,0xff,0x30,0xa,0xf0,0xd5,0xf8,0x5,0x48,0x1,0xff,
+    0x0,0x8,0x31,0x21,0x60,0x60,0x30,0x20,0xfb,0x63,0x0,0x71,0x9,0x10,0xbd,0x3c,
+    0x45,0x3,0xff,0x0,0x2,0x1,0x1c,0x1e,0x0,0x0,0xf,0xfd,0x3d,0x57,0x2,0x2,
+    0x7e,0x91,0x42,0x0,0xd0,0xfd,0x0,0x39,0x1,0x1,0x0,0x1,0x20,0x9,0x7e,0xff,
+    0x88,0x40,0x80,0xb2,0x70,0x47,0x0,0x0,0xfd,0xf8,0x47,0x1,0xd,0x0,0x0,0x27,
+    0xc,0x30,0x7f,0x47,0x60,0x6,0x22,0x0,0xbf,0x20,0x57,0x0,0xff,0x4e,0x30,0xe8,
+    0xf7,0x4f,0xfa,0xa5,0x81,0xff,0x4,0x23,0x0,0xbf,0x1e,0xa2,0x21,0x0,0xff,0xc,
+    0x31,0x20,0x0,0xa,0xf0,0x19,0xf9,0xff,0x6,0x0,0x0,0xbf,0x1c,0xa0,0x80,0x19,
+    0xff,0x40,0x78,0x21,0x0,0x3c,0x31,0x8,0x75,0xff,0xa0,0x89,0xa,0x21,0xe8,0xf7,
+    0x12,0xfc,0xbb,0x0,0x1,0xf,0x2,0x88,0x80,0x1,0xc1,0x1,0x3c,0xef,0x31,0xc8,
+    0x80,0x2,0x7,0x4,0x48,0x70,0x0,0xfe,0xbd,0x1,0xc,0x30,0x0,0x7b,0x9,0xf0,
+    0x9e,0xbb,0xff,0x2,0x4b,0x0,0xad,0xa2,0x22,0x11,0x0,0xf9,0xff,0xf7,0x82,0xff,
+    0x3,0x25,0x3c,0x20,0x25,0xbf,0x54,0x1,0x21,0xc,0x34,0x20,0x1d,0x0,0xa7,0xff,
+    0xff,0x0,0x2e,0x1,0xd5,0x3,0x20,0xf2,0xfb,0xbd,0x0,0x3,0x2,0x0,0x60,0x1c,
+    0x60,0x0,0xff,0x0,0x40,0x0,0x0,0xa0,0xf,0x40,0x1f,0xff,0xe0,0x2e,0x80,0x3e,
+    0x60,0x0,0x20,0x40,0xfc,0x11,0x0,0xff,0x0,0x82,0xb0,0xc,0x0,0xa1,0x68,0xff,
+    0x1,0x29,0x2,0xda,0x0,0x20,0xa0,0x60,0xdf,0x16,0xbd,0x0,0x91,0x8,0x57,0x0,
+    0xbe,0xa2,0xff,0x69,0x46,0xa,0xf0,0x80,0xfc,0x0,0x99,0xff,0xa1,0x60,0x0,0x28,
+    0x1,0xd5,0x4,0x20,0xf4,0x19,0x0,0x3,0x0,0x70,0xdb,0x0,0xe,0x0,0xb5,0x68,
+    0xff,0x22,0x68,0xd2,0x69,0x90,0x47,0x0,0x28,0xff,0x2d,0xd1,0xb0,0x68,0x85,0x42,
+    0x1,0xd0,0xff,0x5,0x20,0x70,0xbd,0x20,0x61,0x25,0x0,0xff,0x3c,0x35,0x0,0x28,
+    0xd,0xd0,0x8,0x23,0xf5,0xae,0xe3,0x0,0x10,0xe3,0x4,0x5e,0xfc,0xb3,0xa1,0xff,
+    0x8,0x18,0x40,0x78,0xa8,0x70,0x20,0x69,0xfe,0x49,0x0,0xd1,0x2,0x20,0x0,0xe0,
+    0x5,0x20,0xff,0x68,0x70,0x28,0x78,0x2,0x28,0xd,0xd1,0xff,0x68,0x78,0x5,0x28,
+    0xa,0xd1,0xa8,0x78,0xff,0xe8,0x74,0x6,0x23,0x22,0x0,0x4e,0x32,0xfd,0xa0,0xcd,
+    0x4,0x1b,0xff,0x4,0x20,0x28,0x70,0xf6,0x59,0x1,0xbd,0x38,0x6f,0x0,0x25,0x0,
+    0x30,0x35,0xff,0x28,0x7b,0x0,0x28,0x1e,0xd1,0x28,0x0,0xdf,0x29,0x68,0xc9,0x68,
+    0x88,0x77,0x0,0x13,0xd0,0xff,0x29,0x7a,0x20,0x0,0x29,0x30,0x1,0x70,0xff,0x69,
+    0x7a,0x48,0x6,0x40,0xe,0x28,0x75,0xff,0x3,0x20,0x0,0x90,0x23,0x0,0x44,0x33,
+    0xef,0x22,0x0,0x44,0x32,0x43,0x2,0xee,0xfe,0x1,0xff,0x20,0x28,0x73,0x31,0xbd,
+    0x0,0x22,0x0,0x7f,0x21,0xa,0x20,0xf3,0xf7,0xf9,0xff,0xb,0x0,0xfb,0x0,0x70,
+    0xef,0x0,0x5,0x0,0x2e,0x0,0x18,0xef,0x36,0x30,0x78,0x98,0xbd,0x1,0x80,0xe0,
+    0x2c,0xff,0x0,0x38,0x34,0x21,0x79,0x6,0x29,0x77,0xff,0xd8,0x1,0xa2,0x52,0x5c,
+    0x97,0x44,0x0,0xff,0xbf,0xf0,0x24,0xf0,0x8,0x8e,0xf0,0xb4,0xff,0x0,0x60,0x79,
+    0x2,0x28,0x6a,0xd0,0xa0,0xbf,0x79,0xe0,0x75,0x6,0x23,0x2a,0x9b,0x4,0x28,0xfe,
+    0x57,0x0,0xcd,0xfe,0x4,0x20,0x5f,0xe0,0x28,0xff,0x0,0x2d,0x30,0x0,0x78,0x0,
+    0x28,0xf,0xff,0xd1,0x29,0x0,0x45,0x31,0x28,0x0,0x30,0xdf,0x30,0xb2,0x69,0x92,
+    0x68,0x11,0x3,0x6,0xd0,0xef,0x0,0x22,0x29,0x0,0x71,0x2,0xc0,0xff,0x0,0x7b,
+    0x20,0x4a,0x29,0x0,0x30,0x30,0xb1,0x69,0xb5,0x6,0xcf,0x11,0xd0,0x21,0x78,0xc3,
+    0x0,0xb5,0x0,0x61,0x78,0xbf,0x80,0x20,0x8,0x43,0x20,0x73,0xb5,0x2,0x2b,0x72,
+    0xb5,0x0,0x2a,0xb5,0x0,0x5d,0x2,0x93,0xfe,0x73,0xb1,0xc,0xfd,0xa0,0x3f,0x0,
+    0x2a,0xe0,0x9,0xf0,0xa1,0xfe,0xff,0x1,0x21,0x30,0x78,0x9,0xf0,0xa5,0xfe,0xfe,
+    0x5,0x2,0xb0,0xfe,0x0,0x28,0x5,0xd0,0x32,0xbf,0x78,0x14,0x35,0x29,0x0,0x4,
+    0x25,0x0,0x8d,0xef,0xff,0x5,0x20,0x17,0x65,0x0,0x0,0xf0,0x56,0xfd,0xf8,0xb1,
+    0x2,0x5,0xd0,0xe0,0x7d,0x1c,0x21,0xff,0x1,0x40,0xa0,0x79,0x81,0x42,0xf1,0xd0,
+    0xdd,0x0,0x39,0x4,0x88,0xfe,0x2,0xd3,0x1,0x22,0xa2,0xfd,0x22,0xc1,0x4,0x6c,
+    0xfe,0x3,0x20,0x20,0x71,0xff,0x73,0xbd,0x1,0x21,0x34,0x20,0xf9,0xf7,0xdf,0x2,
+    0xfa,0x73,0xbd,0x10,0x15,0x1,0x1,0x0,0xff,0x14,0x31,0xc,0x79,0x9c,0x42,0x13,
+    0xd1,0xff,0x4,0x0,0x3c,0x34,0x23,0x78,0x5,0x2b,0xff,0xe,0xd1,0x12,0x68,0xa,
+    0x60,0x68,0x21,0xff,0xe1,0x72,0x7,0x21,0x0,0x91,0x3,0x0,0xff,0x47,0x33,0x2,
+    0x0,0x47,0x32,0xa8,0x21,0xff,0xf9,0xf7,0x40,0xfe,0x6,0x20,0x20,0x70,0xfd,0x13,
+    0x4f,0x1,0x2d,0xa2,0xa,0x60,0x1,0x22,0xff,0xa,0x71,0x7,0x4b,0x8b,0x60,0xff,
+    0x23,0xff,0x16,0x33,0xcb,0x80,0x40,0x30,0x3,0x88,0xff,0xcb,0x60,0x40,0x88,0x8,
+    0x61,0x8a,0x61,0xef,0x3,0x48,0x48,0x61,0xc5,0x1,0x47,0x0,0x0,0xff,0xd4,0x30,
+    0x0,0x0,0xff,0x7f,0x0,0x0,0xdf,0x10,0xa0,0x70,0x47,0x44,0x11,0x0,0x22,0x3,
+    0xff,0x10,0xb5,0x1,0x0,0x48,0x31,0x2,0x0,0xff,0x14,0x32,0x13,0x68,0xcb,0x60,
+    0x4b,0x78,0xff,0x1b,0x2,0xc,0x78,0x23,0x43,0xb,0x82,0xf5,0xcb,0x9,0x0,0x8c,
+    0x9,0x0,0x4b,0x82,0x4b,0x79,0xfe,0x13,0x0,0x79,0x23,0x43,0x8b,0x82,0x12,0x79,
+    0xdf,0x54,0x30,0x1,0x0,0x7,0xed,0x0,0x16,0xff,0xff,0x10,0xbd,0x44,0x0,0xf,
+    0x0,0x20,0x30,0xff,0xe0,0x39,0xdd,0x55,0x22,0xaa,0xc,0xca,0x73,0x4,0x0,0x0,
+    0x12,0xf,0x22,0xac,0xc5,0xa7,0x3,0x4,0xff,0x45,0xf5,0xd6,0x0,0xeb,0x23,0xa0,
+    0x4c,0xff,0x13,0x77,0x19,0xcd,0x53,0x54,0x4d,0x69,0xff,0x63,0x72,0x6f,0x65,0x6c,
+    0x65,0x63,0x74,0xff,0x72,0x6f,0x6e,0x69,0x63,0x73,0x20,0x4c,0xbf,0x49,0x53,0x33,
+    0x4d,0x44,0x4c,0x34,0x0,0x6a,0xff,0x18,0x0,0x0,0x35,0xc,0x0,0x80,0x1a,0xff,
+    0x6,0x0,0x40,0xd,0x3,0x0,0xa0,0x86,0xff,0x1,0x0,0x50,0xc3,0x0,0x0,0xa8,
+    0x61,0xfe,0xc7,0x6,0x1c,0x0,0x4,0x8,0xc,0x10,0x14,0xfb,0x18,0x1c,0x2a,0x0,
+    0x38,0xb5,0x0,0xbf,0x4,0xff,0x0,0x15,0x0,0xb,0xf0,0xb4,0xfa,0xcd,0xff,0xa1,
+    0x20,0x0,0x68,0x30,0x9,0xf0,0xb5,0xff,0xfe,0x4d,0x48,0x1,0x0,0x8,0x31,0x21,
+    0xff,0x60,0x78,0x30,0xa0,0x66,0x22,0x0,0x29,0xef,0x0,0x20,0x0,0x8c,0x17,0x0,
+    0xdb,0xfe,0x0,0xff,0x20,0x74,0x21,0x60,0x54,0x20,0x0,0x32,0xff,0xbd,0x2,0x7e,
+    0x91,0x42,0x6,0xd0,0xa4,0xff,0x22,0x82,0x5c,0x91,0x42,0x1,0xd1,0x8c,0xf9,0x30,
+    0x23,0x1,0x15,0x1,0x1,0x0,0x1,0x20,0xa,0xff,0x7e,0x1,0x23,0x93,0x40,0xa4,
+    0x31,0x9,0xff,0x78,0x88,0x40,0x18,0x43,0x80,0xb2,0x70,0xff,0x47,0x38,0xb5,0x4,
+    0x0,0x25,0x0,0x10,0xff,0x35,0x29,0x7a,0xb,0xf0,0x90,0xfa,0x0,0xff,0x28,0x12,
+    0xd1,0x22,0x0,0x0,0x21,0x20,0xff,0x0,0x78,0x30,0x7,0xf0,0x25,0xf8,0x0,0xff,
+    0x20,0x28,0x60,0x21,0x0,0xc0,0x31,0x20,0xbe,0x83,0x0,0x99,0xfa,0x74,0x34,0x2,
+    0x99,0x1,0x7,0xff,0x20,0x60,0x70,0x0,0x20,0x32,0xbd,0x80,0xbb,0xb5,0x1a,0x15,
+    0x0,0x76,0xfa,0x2,0x9,0x0,0xa,0xff,0x0,0x1,0x7e,0x3,0x68,0x9b,0x6d,0x98,
+    0xfb,0x47,0x2,0xb7,0x1,0x3,0x7e,0x99,0x42,0xe,0xff,0xd1,0x1,0x20,0x10,0x71,
+    0x5,0x20,0xd0,0xff,0x80,0x22,0x48,0xd0,0x60,0x80,0x20,0x40,0xff,0x1,0x10,0x61,
+    0x93,0xa0,0x10,0x60,0x1f,0xf7,0x48,0x90,0x60,0x8d,0x2,0xa4,0x30,0x0,0x78,0xd7,
+    0x81,0x42,0x7,0x25,0x4,0x2,0x25,0x0,0x82,0x21,0x7f,0x89,0x1,0xd1,0x60,0xec,
+    0xe7,0x7,0x1b,0x0,0xfd,0xf8,0x93,0x0,0xd,0x0,0x0,0x26,0xaa,0x68,0xff,0x29,
+    0x68,0xf9,0xf7,0x5e,0xfd,0x20,0x61,0xff,0x0,0x28,0x1,0xd1,0x7,0x21,0x5,0xe0,
+    0xff,0x4,0x21,0xf,0x4a,0x90,0x42,0x1,0xda,0xff,0x22,0x61,0x4,0x26,0x27,0x0,
+    0x74,0x37,0xff,0x79,0x70,0x20,0x69,0xa8,0x60,0x20,0x69,0xff,0x28,0x60,0x38,0x78,
+    0x7,0x28,0xa,0xd1,0xfd,0x78,0x5,0x0,0x7,0xd0,0x2,0x22,0x0,0xbf,0xfd,0x7f,
+    0x2f,0x1,0xf9,0xf7,0x4f,0xfd,0x3,0x20,0xff,0x38,0x70,0x30,0x0,0xf2,0xbd,0x5c,
+    0x38,0xfd,0x3,0x51,0x1,0xc0,0x44,0xe0,0xab,0x0,0x0,0xff,0x70,0xb5,0x82,0xb0,
+    0x5,0x0,0x2e,0x0,0xff,0x10,0x36,0x30,0x7a,0x83,0x42,0x55,0xd1,0xff,0x2c,0x0,
+    0x70,0x34,0x20,0x79,0x1,0x28,0xff,0x8,0xd0,0x2,0x28,0x3a,0xd0,0x3,0x28,0xff,
+    0x4d,0xd0,0x5,0x28,0x5d,0xd0,0x6,0x28,0x7f,0x68,0xd0,0x73,0xbd,0x28,0x0,0x2d,
+    0xa9,0x0,0xff,0x0,0x28,0xf,0xd1,0x29,0x0,0xc8,0x31,0xfd,0x28,0x83,0x1,0xb2,
+    0x6d,0x92,0x68,0x90,0x47,0xff,0x0,0x28,0x6,0xd0,0x0,0x22,0x29,0x0,0xff,0xa,
+    0x20,0xf3,0xf7,0xfa,0xfd,0x0,0x20,0xfb,0x31,0xe0,0x1b,0x2,0xb1,0x6d,0xc9,0x68,
+    0x88,0xfe,0x1b,0x0,0x10,0xd0,0x21,0x78,0x28,0x0,0x29,0xff,0x30,0x1,0x70,0x61,
+    0x78,0x2b,0x0,0xc7,0xff,0x33,0x80,0x20,0x8,0x43,0x18,0x70,0x3,0xbf,0x20,0x0,
+    0x90,0x1a,0x0,0x28,0x97,0x0,0xce,0x7f,0xfc,0x73,0xbd,0x0,0x22,0x0,0x21,0x3d,
+    0x2,0xf5,0xdb,0x3d,0x0,0x12,0x3d,0x0,0xb,0xf0,0x2,0xfa,0xff,0x1,0x28,0xe,
+    0xd0,0x0,0x21,0xc9,0x43,0xff,0x88,0x42,0xa,0xd0,0x60,0x79,0x7,0x28,0xed,0x20,
+    0xcb,0x4,0x4c,0xa1,0x33,0x2,0xe9,0xfc,0x3,0xf7,0x20,0x20,0x71,0x91,0x2,0xf9,
+    0xf7,0xec,0xfc,0xff,0x0,0x28,0xf9,0xd1,0x30,0x68,0xfa,0x21,0xff,0x89,0x0,0xe8,
+    0xf7,0x29,0xf9,0x1,0x0,0xff,0x0,0x22,0x78,0x35,0x28,0x0,0x6,0xf0,0xff,0x52,
+    0xff,0x4,0x20,0xeb,0xe7,0x28,0x0,0xef,0x0,0xf0,0x53,0xf8,0x41,0x2,0xec,0xd1,
+    0x1,0xfb,0x22,0x3b,0x3f,0x4,0xc9,0xfc,0x6,0x20,0xde,0x6e,0x19,0x0,0xf9,0xf7,
+    0xcd,0x3d,0x0,0xda,0xd1,0x1d,0x2,0xdf,0xcf,0xd1,0xd5,0xe7,0x10,0xd,0x1,0x4,
+    0x0,0xff,0x74,0x20,0x20,0x5c,0x4,0x28,0x10,0xd1,0xff,0x8,0xf0,0x92,0xf9,0x60,
+    0x61,0x23,0x0,0x9f,0xc0,0x33,0xf7,0x20,0x18,0xeb,0x1,0xb1,0x2,0xf7,0xfd,0x21,
+    0x4b,0x3,0x74,0xfc,0x5,0x20,0x74,0x34,0xdf,0x20,0x70,0x13,0xbd,0x38,0x9f,0x1,
+    0x25,0x0,0xff,0x68,0x35,0x28,0x7b,0x0,0x28,0x1e,0xd1,0xfa,0xe7,0x0,0x68,0xf5,
+    0x6,0x13,0xd0,0x29,0x7a,0x20,0xfa,0xf5,0x4,0x23,0xf3,0x0,0x68,0x7a,0x80,0x21,
+    0x1,0x7f,0x43,0x19,0x70,0x1,0x20,0x28,0x73,0xf9,0x6,0x7d,0x69,0x1d,0x0,0xf9,
+    0xf7,0x50,0xfc,0x31,0xfb,0xc,0xf7,0x5d,0xfd,0x31,0x4d,0x8,0xc1,0x35,0xe8,0x78,
+    0xff,0x0,0x4,0x29,0x79,0x9,0x2,0x1,0x43,0x7f,0x68,0x79,0x8,0x43,0x1,0x9,
+    0x20,0x11,0x1,0xff,0xf0,0xf9,0x29,0x78,0x9,0x4,0x6a,0x78,0xff,0x12,0x2,0xa,
+    0x43,0xa9,0x78,0x11,0x43,0x6f,0xa,0x9,0x1,0x0,0x17,0x2,0x11,0xfa,0x43,0x0,
+    0xff,0x0,0x42,0x6f,0x73,0x63,0x68,0x20,0x53,0xff,0x65,0x6e,0x73,0x6f,0x72,0x74,
+    0x65,0x63,0xff,0x20,0x42,0x4d,0x50,0x32,0x38,0x30,0x0,0xff,0x0,0xf4,0x74,0xa8,
+    0x0,0xf5,0x75,0x10,0xfb,0xf4,0x74,0xeb,0x1,0x2,0x1,0x76,0x77,0x0,0xe7,0x0,
+    0xd0,0x58,0xfc,0x1,0xf7,0x1,0x0,0xbf,0x4,0xef,0x0,0x15,0x0,0x1e,0x41,0x0,
+    0xb,0xf9,0x0,0xef,0xbf,0xd,0xa1,0x20,0xb3,0x1,0x9,0xf0,0xb,0xff,0xfd,0x73,
+    0x48,0x1,0x0,0x8,0x31,0x21,0xff,0x60,0x78,0x30,0xa0,0x66,0x22,0x0,0x29,0xfa,
+    0x63,0x0,0x98,0x17,0x0,0x31,0xfd,0x22,0x0,0x31,0xea,0xb,0x0,0xcc,0xb,0x0,
+    0x2b,0xa5,0x1,0x74,0x21,0x60,0x5f,0x54,0x20,0x0,0x70,0xbd,0x53,0x8,0x60,0x53,
+    0x2,0xff,0x2,0x7e,0x91,0x42,0xc,0xd0,0xb0,0x22,0xff,0x82,0x5c,0x91,0x42,0x1,
+    0xd1,0x98,0x30,0xd7,0x70,0x47,0xe4,0xb,0x8,0xcc,0xb,0x0,0x0,0x20,0xff,0x70,
+    0x47,0x10,0xb4,0x1,0x0,0x1,0x20,0xff,0xa,0x7e,0x1,0x23,0x93,0x40,0xb0,0x22,
+};
+
+static const uint8_t dfuStream_1_7_0_390_page4[30000] PROGMEM = {
+    0xff,0x8a,0x5c,0x1,0x24,0x94,0x40,0x1c,0x43,0xff,0xe4,0x31,0x9,0x78,0x88,0x40,
+    0x20,0x43,0xbf,0x80,0xb2,0x10,0xbc,0x70,0x47,0x3,0x7,0x10,0xff,0x35,0x29,0x7a,
+    0xb,0xf0,0xcd,0xf8,0x0,0xbf,0x28,0x19,0xd1,0x22,0x0,0x0,0x75,0x1,0x78,0xff,
+    0x30,0x6,0xf0,0x62,0xfe,0x0,0x20,0x28,0xff,0x60,0x88,0x20,0x40,0x0,0x23,0x18,
+    0xa1,0xf4,0x93,0x1,0x4b,0x7,0xa1,0x93,0x5,0xaa,0xfb,0x74,0x34,0xff,0x2,0x20,
+    0x20,0x70,0x9,0x20,0x60,0x70,0xff,0x0,0x20,0x32,0xbd,0x10,0xb5,0x1a,0x0,0xff,
+    0x3,0x0,0xe4,0x33,0x1c,0x78,0xa1,0x42,0xff,0x7,0xd1,0x0,0x2a,0x1,0xd0,0x10,
+    0x68,0xff,0x0,0xe0,0x0,0x20,0x98,0x62,0x0,0x20,0xff,0x10,0xbd,0xb,0xf0,0x9f,
+    0xf8,0x10,0xbd,0xff,0x80,0xb5,0xa,0x0,0x1,0x7e,0x3,0x68,0xff,0x9b,0x6d,0x98,
+    0x47,0x2,0xbd,0x3,0x7e,0xff,0x99,0x42,0xe,0xd1,0x1,0x20,0x10,0x71,0xff,0x5,
+    0x20,0xd0,0x80,0x32,0x48,0xd0,0x60,0xff,0x80,0x20,0x40,0x1,0x10,0x61,0xf,0xa0,
+    0xbf,0x10,0x60,0x2f,0x48,0x90,0x60,0xc1,0x2,0xe4,0x4f,0x23,0xc3,0x5c,0x99,0x4f,
+    0x0,0x25,0x2,0x3,0x25,0x0,0xff,0xc8,0x21,0xc9,0x1,0xd1,0x60,0xec,0xe7,0x5f,
+    0xb0,0x30,0x0,0x78,0x81,0x17,0x8,0x2,0x17,0x0,0x77,0x82,0x21,0x89,0x17,0x0,
+    0xe0,0xe7,0x7,0x33,0x0,0xea,0x9b,0x1f,0x45,0x9b,0x5,0xf8,0xe9,0x0,0xe,0x0,
+    0x0,0xff,0x25,0xb2,0x68,0x71,0x68,0xf9,0xf7,0x70,0x7f,0xfb,0x20,0x61,0x2,0x0,
+    0x31,0x68,0xcb,0x2,0xfd,0x6a,0xb,0x0,0x0,0x28,0x1,0xd1,0x9,0x20,0xff,0x5,
+    0xe0,0x11,0x49,0x88,0x42,0x1,0xda,0xff,0x21,0x61,0x4,0x25,0x6,0x20,0x27,0x0,
+    0xff,0x74,0x37,0x78,0x70,0x20,0x69,0x70,0x60,0xf7,0x20,0x69,0xb0,0x3,0x0,0x30,
+    0x60,0x38,0x78,0xdf,0x9,0x28,0xa,0xd1,0x78,0x5,0x0,0x7,0xd0,0xdf,0x3,0x22,
+    0x0,0xbf,0xbe,0xc7,0x1,0xf9,0xf7,0xff,0x59,0xfb,0x5,0x20,0x38,0x70,0x28,0x0,
+    0xdf,0xf2,0xbd,0x4c,0x37,0x3,0x99,0x1,0xc0,0x44,0xfd,0xe0,0xff,0x1,0x70,0xb5,
+    0x82,0xb0,0x5,0x0,0xff,0x2e,0x0,0x10,0x36,0x30,0x7a,0x83,0x42,0xff,0x0,0xd0,
+    0x8c,0xe0,0x2c,0x0,0x70,0x34,0xff,0x20,0x79,0x40,0x1e,0x7,0x28,0x0,0xd9,0xff,
+    0x85,0xe0,0x1,0xa1,0x9,0x5c,0x49,0x0,0xff,0x8f,0x44,0x3,0x3a,0x4c,0x6e,0x82,
+    0x81,0xdf,0x94,0xa1,0x28,0x0,0x2d,0xd5,0x0,0x0,0x28,0xf7,0x10,0xd1,0x8d,0x71,
+    0x1,0x29,0x18,0x28,0x0,0xff,0x68,0x30,0xb2,0x6d,0x92,0x68,0x90,0x47,0xff,0x0,
+    0x28,0x6,0xd0,0x0,0x22,0x29,0x0,0xff,0xa,0x20,0xf3,0xf7,0x1,0xfc,0x0,0x20,
+    0xfb,0x66,0xe0,0x1b,0x2,0xb1,0x6d,0xc9,0x68,0x88,0xfe,0x1b,0x0,0x12,0xd0,0x21,
+    0x78,0x28,0x0,0x29,0xdf,0x30,0x1,0x70,0x61,0x78,0x41,0x1,0x0,0x28,0xff,0x18,
+    0x41,0x76,0xff,0x20,0x1a,0x30,0x2b,0xf5,0x18,0xaf,0x7,0x28,0xa1,0x0,0xd3,0xfa,
+    0x73,0xbd,0xbf,0x20,0x71,0x0,0x22,0x0,0x21,0x43,0x2,0xdf,0xf7,0xfb,0x73,0xbd,
+    0x29,0x8,0x7c,0x1,0x70,0xe1,0x77,0x21,0x1,0x74,0xe3,0x3,0x2a,0x18,0x8,0x2f,
+    0x0,0xfd,0x13,0x2f,0x4,0xbb,0xfa,0x3,0x20,0x33,0xe0,0xfe,0x23,0x6,0x81,0x7c,
+    0x9,0x2,0x42,0x7c,0x11,0xff,0x43,0x41,0x80,0xc1,0x7c,0x1,0x71,0x41,0xff,0x7d,
+    0x2,0x7d,0x12,0x6,0x12,0x15,0xb,0xff,0x7,0x1b,0xf,0x13,0x43,0xc3,0x80,0x82,
+    0xfe,0xd,0x4,0x9,0x9,0xa,0x43,0x2,0x81,0xc1,0xe7,0x7d,0x81,0x72,0x49,0x2,
+    0xbb,0x2,0xa,0xf0,0xbe,0xef,0xff,0x4,0x20,0x11,0xa9,0x0,0xa,0xf0,0xd3,0xff,
+    0xff,0x1,0x28,0xd,0xd0,0x0,0x21,0xc9,0xff,0x43,0x88,0x42,0x9,0xd0,0x60,0x79,
+    0x9,0xcb,0x28,0x1f,0x3d,0x1,0x6f,0xf1,0x0,0x69,0x2,0x5,0x20,0xef,0x20,0x71,
+    0x73,0xbd,0xb,0x2,0xbe,0xfa,0x0,0xff,0x28,0xf9,0xd1,0x30,0x68,0xfa,0x21,0x89,
+    0xff,0x0,0xe7,0xf7,0xfb,0xfe,0x1,0x0,0x0,0xff,0x22,0x78,0x35,0x28,0x0,0x6,
+    0xf0,0x24,0xff,0xfd,0x6,0x20,0xeb,0xe7,0x28,0x0,0x0,0xf7,0xf0,0x55,0xf8,0x3f,
+    0x2,0xec,0xd1,0x1,0x22,0x7d,0x5e,0x3f,0x4,0x9b,0xfa,0x8,0x20,0xde,0x19,0x0,
+    0xb7,0xf9,0xf7,0x9f,0x3d,0x0,0xda,0xd1,0x1d,0x2,0xd0,0xef,0xd1,0xd5,0xe7,0x10,
+    0x7d,0x1,0x4,0x0,0x74,0xff,0x20,0x20,0x5c,0x6,0x28,0x11,0xd1,0x7,0xdf,0xf0,
+    0x64,0xff,0x60,0x61,0x9b,0x2,0x23,0x18,0xdf,0xf7,0x20,0x18,0x70,0x9,0x19,0x5,
+    0xf7,0x21,0xfe,0xbd,0x3,0x45,0xfa,0x7,0x20,0x74,0x34,0x20,0xff,0x70,0x13,0xbd,
+    0x38,0xb5,0x4,0x0,0x25,0xff,0x0,0x68,0x35,0x28,0x7b,0x0,0x28,0x1f,0xf5,0xd1,
+    0x53,0x1,0x68,0x61,0x7,0x14,0xd0,0x29,0x7a,0xf9,0x20,0x61,0x5,0x57,0x3,0x23,
+    0x18,0x68,0x7a,0x80,0xff,0x21,0x1,0x43,0x19,0x70,0x1,0x20,0x28,0xf5,0x73,0x63,
+    0x7,0x69,0x1f,0x0,0xf9,0xf7,0x20,0xfa,0xfb,0x31,0xbd,0x63,0xb,0x2d,0xfb,0x31,
+    0xbd,0x70,0xfa,0x4f,0x0,0x82,0x73,0x0,0x25,0x18,0x28,0x7c,0x0,0xfb,0x4,0x69,
+    0x47,0x1,0x1,0x43,0xa8,0x7c,0x8,0xfb,0x43,0x1,0x7e,0x0,0xa,0xf0,0xbf,0xff,
+    0x6,0x7f,0x0,0x68,0x7b,0x0,0x4,0xa9,0x7b,0x17,0x2,0xff,0xe8,0x7b,0x8,0x43,
+    0x2,0x9,0x31,0x0,0xfe,0x19,0x2,0xdf,0xff,0x25,0x48,0x31,0x18,0x20,0xff,0x0,
+    0xe4,0x30,0xea,0x7c,0x12,0x2,0x2b,0xff,0x7d,0x13,0x43,0x9a,0x3,0x2,0x23,0xeb,
+    0xbf,0x5e,0x1b,0x5,0xd2,0x1a,0x4,0x7,0x0,0x4b,0xff,0x43,0xd2,0x1a,0x80,0x23,
+    0xdb,0x1,0xd2,0xff,0x18,0xd2,0x13,0x6,0x23,0xeb,0x56,0x4b,0xff,0x43,0x9b,0x12,
+    0x2e,0x78,0x71,0x43,0xc9,0xff,0x12,0x80,0x26,0x36,0x2,0x89,0x19,0x4b,0xff,0x43,
+    0x99,0x12,0xb3,0x1,0xc9,0x18,0x1e,0xff,0x23,0xc3,0x5e,0x59,0x43,0xb3,0x8,0xc9,
+    0xff,0x18,0x89,0x13,0x4a,0x43,0xd1,0x13,0xb,0xff,0x0,0x4b,0x43,0xd9,0x11,0x3,
+    0x7f,0x59,0xff,0x43,0x9,0x11,0x51,0x1a,0x13,0xd5,0x0,0xff,0x21,0x8a,0x13,0x21,
+    0x0,0x14,0x31,0xb,0xff,0x68,0x8b,0x67,0x21,0x0,0x90,0x31,0xa,0xff,0x80,0xa,
+    0x88,0xab,0x68,0xd2,0x18,0xa,0xff,0x80,0x2,0x78,0x8c,0x34,0x21,0x0,0x7,0xfe,
+    0xc7,0x0,0xc9,0xfa,0x70,0xbd,0x3,0x4a,0x91,0xff,0x42,0xe9,0xdb,0x92,0xb,0xe8,
+    0xe7,0x0,0xf7,0xd4,0xfe,0xff,0x95,0x1,0x19,0xf4,0x74,0x68,0xff,0x0,0xf5,0x75,
+    0x10,0xf2,0x72,0x1,0xf4,0xff,0x74,0x6b,0x0,0x0,0x0,0x38,0xb5,0x0,0xff,0xbf,
+    0x4,0x0,0x15,0x0,0x9,0xf0,0x82,0xff,0xfa,0xa,0xa1,0x20,0x0,0x30,0x30,0x9,
+    0xff,0xf0,0x9d,0xfa,0x5e,0x48,0x1,0x0,0x8,0xff,0x31,0x21,0x60,0x78,0x30,0x20,
+    0x63,0x22,0xeb,0x0,0x29,0xdb,0x0,0x5c,0x17,0x0,0xc3,0xfa,0x0,0xff,0x20,0x40,
+    0x21,0x60,0x54,0x20,0x0,0x32,0xff,0xbd,0x2,0x1,0x44,0x45,0x0,0x0,0xe,0xfe,
+    0x41,0x0,0x0,0x0,0x2,0x7e,0x91,0x42,0x6,0xff,0xd0,0x74,0x22,0x82,0x5c,0x91,
+    0x42,0x1,0xff,0xd1,0x5c,0x30,0x70,0x47,0x0,0x20,0x70,0xff,0x47,0x1,0x0,0x1,
+    0x20,0xa,0x7e,0x1,0xff,0x23,0x93,0x40,0x74,0x31,0x9,0x78,0x88,0xff,0x40,0x18,
+    0x43,0x80,0xb2,0x70,0x47,0x38,0xff,0xb5,0x5,0x0,0x40,0x35,0x3,0x21,0x69,0xff,
+    0x70,0x4,0x0,0x10,0x34,0x0,0x21,0x21,0xff,0x60,0x6,0x23,0x5,0xa2,0x3,0x21,
+    0xf9,0xff,0xf7,0x69,0xf9,0x2,0x20,0x28,0x70,0x3,0xff,0x21,0x20,0x7a,0x9,0xf0,
+    0x90,0xf9,0x0,0xff,0x20,0x32,0xbd,0x3,0xff,0x0,0xff,0xf,0xfe,0x5f,0x0,0x58,
+    0x30,0x2,0x7f,0x91,0x42,0x7,0xff,0xd1,0x0,0x2b,0x1,0xd0,0x19,0x68,0x0,0x5f,
+    0xe0,0x0,0x21,0x1,0x60,0x61,0x2,0x6,0x3,0x0,0xff,0xab,0xa0,0x8,0x60,0x1,
+    0x20,0x8,0x71,0xff,0xa7,0x48,0x88,0x60,0x52,0x20,0xc8,0x80,0xff,0x80,0x20,0xc0,
+    0x0,0xc8,0x60,0x10,0x20,0xfb,0x8,0x61,0x21,0x2,0x0,0x0,0x80,0xb5,0xb,0xfb,
+    0x0,0x11,0xa1,0x0,0x93,0x42,0x3,0xd1,0x2,0xff,0x68,0xd2,0x6a,0x90,0x47,0x2,
+    0xbd,0x74,0xff,0x30,0x0,0x78,0x83,0x42,0x1,0xd0,0x7,0xaf,0x20,0x2,0xbd,0x9b,
+    0x3f,0x8,0x97,0x3f,0x0,0x63,0xbe,0x3f,0x4,0x0,0x3,0xc8,0x60,0x86,0x3f,0x4,
+    0x2,0xff,0xbd,0x0,0x0,0xf8,0xb5,0x4,0x0,0xd,0xff,0x0,0x0,0x27,0x2a,0x69,
+    0xe9,0x68,0xf9,0xff,0xf7,0x32,0xf9,0x26,0x0,0x10,0x36,0x30,0xff,0x60,0x0,0x28,
+    0x1,0xd1,0x3,0x20,0x5,0xef,0xe0,0x8a,0x49,0x88,0x47,0x0,0x31,0x60,0x4,0xff,
+    0x27,0x6,0x20,0x21,0x0,0x40,0x31,0x48,0xff,0x70,0x30,0x68,0xe8,0x60,0x30,0x68,
+    0x28,0xff,0x61,0x40,0x20,0x20,0x5c,0x3,0x28,0x15,0xff,0xd1,0x20,0x0,0x40,0x30,
+    0x40,0x78,0x6,0xef,0x28,0x10,0xd1,0x30,0xd7,0x0,0x4,0xf9,0x1,0xfd,0x21,0x7,
+    0x2,0x8,0xf9,0x3,0x23,0x0,0xbf,0xff,0x82,0xa2,0x1,0x21,0x20,0x0,0xf9,0xf7,
+    0xff,0xec,0xf8,0x5,0x20,0x40,0x34,0x20,0x70,0xff,0x38,0x0,0xf2,0xbd,0xbc,0x3e,
+    0x3,0x0,0xff,0x70,0xb5,0x82,0xb0,0x5,0x0,0x2e,0x0,0xf7,0x18,0x36,0x30,0xa7,
+    0x0,0x72,0xd1,0x2c,0x0,0xff,0x38,0x34,0x21,0x7a,0x1,0x29,0xa,0xd0,0xff,0x2,
+    0x29,0x30,0xd0,0x4,0x29,0x4b,0xd0,0xff,0x5,0x29,0x65,0xd0,0x7,0x29,0x49,0xd0,
+    0xff,0x8,0x29,0x61,0xd0,0x73,0xbd,0x28,0x0,0x7d,0x2d,0xd1,0x0,0x0,0x28,0x1b,
+    0xd0,0x28,0xbf,0x1,0xff,0xb1,0x69,0xc9,0x68,0x88,0x47,0x0,0x28,0xff,0xd,0xd0,
+    0x21,0x78,0x28,0x0,0x29,0x30,0xff,0x1,0x70,0x3,0x20,0x0,0x90,0x2b,0x0,0x7f,
+    0x3c,0x33,0x68,0xa2,0xe,0x21,0x28,0x6f,0x0,0xff,0xa9,0xf8,0x73,0xbd,0x0,0x22,
+    0x0,0x21,0xdf,0xa,0x20,0xf3,0xf7,0xb6,0x69,0x1,0x40,0xe0,0xaf,0x0,0x22,0x29,
+    0x0,0xd,0x2,0xaf,0xd,0x0,0x39,0xff,0xe0,0x61,0x7a,0x3,0x29,0xb,0xd1,0x0,
+    0x5f,0x21,0x9,0xf0,0xb4,0xf8,0xa7,0x2,0x57,0xa7,0x0,0xfe,0x37,0x2,0x98,0xf8,
+    0x4,0x20,0x2a,0xe0,0x9,0xf7,0xf0,0xa1,0xf8,0xc5,0x0,0x78,0x9,0xf0,0xa5,0xea,
+    0x1d,0x0,0x51,0x1b,0x8,0x8a,0xc3,0x0,0x1c,0xe0,0x3,0xab,0x20,0x1a,0x3d,0x4,
+    0xa,0x3d,0x4,0x95,0x1f,0x0,0x48,0xfa,0x1f,0x8,0x7a,0x3b,0x0,0xc,0xe0,0x28,
+    0x0,0x0,0xef,0xf0,0x4a,0xf8,0x2,0x53,0x0,0x44,0xa2,0x2,0xfe,0x17,0x4,0x6e,
+    0xf8,0x8,0x20,0x0,0xe0,0x6,0xbf,0x20,0x20,0x72,0x73,0xbd,0x10,0xf7,0x0,0x1,
+    0xff,0x0,0x14,0x31,0xc,0x79,0xa3,0x42,0x11,0xff,0xd1,0x4,0x0,0x3c,0x34,0x23,
+    0x79,0x6,0xff,0x2b,0xc,0xd1,0x12,0x68,0xa,0x60,0x8,0xff,0x21,0x21,0x70,0x4,
+    0x21,0x0,0x91,0x23,0xfe,0xb8,0x0,0x8,0x21,0xf9,0xf7,0x47,0xf8,0x7,0xbf,0x20,
+    0x20,0x71,0x13,0xbd,0x38,0x9f,0x1,0x25,0x5f,0x0,0x30,0x35,0x28,0x7c,0xff,0x0,
+    0xd1,0xef,0x0,0x7d,0x68,0xfd,0x6,0x10,0xd0,0x29,0x7a,0x20,0xfd,0x4,0xaf,0x1,
+    0x20,0x28,0x74,0x1,0x3,0x23,0x1,0x1,0x0,0x73,0xbf,0x27,0x3,0x1,0x73,0x3,
+    0x27,0xf8,0x31,0x3,0xd,0xdf,0x34,0xf9,0x31,0xbd,0x70,0x47,0x0,0x3d,0x30,0xff,
+    0x1,0x78,0x82,0x78,0x12,0x7,0x12,0xd,0xff,0x45,0x78,0x15,0x43,0x0,0x29,0x7,
+    0xd0,0xff,0xc8,0x5,0xf6,0xf7,0x31,0xff,0x13,0x22,0xff,0x40,0x21,0xf6,0xf7,0x0,
+    0xff,0x0,0xe0,0xff,0xf,0x48,0x26,0x0,0x48,0x36,0xb0,0x81,0xff,0xe8,0x1,0x70,
+    0x60,0x70,0x68,0x31,0x69,0xff,0x40,0x18,0x70,0x60,0x20,0x0,0x14,0x30,0xff,0x1,
+    0x68,0xb1,0x60,0x31,0x60,0x2,0x79,0xdf,0x21,0x0,0x50,0x31,0x7,0x51,0x0,0xb,
+    0xf9,0xbf,0x74,0x34,0x22,0x78,0x31,0x0,0xb,0x2,0x5,0xff,0xf9,0x70,0xbd,0x0,
+    0x0,0xa0,0x86,0x1,0xff,0x0,0xff,0x7f,0x0,0x0,0x49,0x6e,0x74,0xff,0x65,0x72,
+    0x73,0x69,0x6c,0x20,0x49,0x53,0xff,0x4c,0x32,0x39,0x30,0x32,0x39,0x0,0x0,0xfb,
+    0x0,0x1,0x1,0x2,0xb6,0x1,0x0,0x2,0x1,0xf7,0x0,0x0,0xe,0xf,0x0,0x38,
+    0xb5,0x0,0xbf,0xff,0x4,0x0,0x15,0x0,0x9,0xf0,0xb8,0xf8,0xf7,0xa,0xa1,0x20,
+    0xd3,0x1,0x9,0xf0,0xd3,0xf8,0xff,0x5a,0x48,0x1,0x0,0x8,0x31,0x21,0x60,0xff,
+    0x78,0x30,0x20,0x63,0x22,0x0,0x29,0x0,0xf7,0x20,0x0,0x7c,0x17,0x0,0xf9,0xf8,
+    0x0,0x20,0xff,0x43,0x21,0x60,0x54,0x20,0x0,0x32,0xbd,0xb7,0x1,0x1,0x70,0x3d,
+    0x0,0xff,0x7,0x4,0x0,0x0,0xff,0x2,0x7e,0x91,0x42,0x6,0xd0,0x94,0x22,0xff,
+    0x82,0x5c,0x91,0x42,0x1,0xd1,0x7c,0x30,0xbf,0x70,0x47,0x0,0x20,0x70,0x47,0x67,
+    0x0,0x20,0xff,0xa,0x7e,0x1,0x23,0x93,0x40,0x94,0x31,0xff,0x9,0x78,0x88,0x40,
+    0x18,0x43,0x80,0xb2,0xfb,0x70,0x47,0x43,0x7,0x43,0x35,0x6,0x20,0x68,0xff,0x70,
+    0x0,0x20,0x20,0x61,0x0,0x2a,0x0,0xff,0xd0,0x10,0x68,0x60,0x67,0x22,0x0,0x0,
+    0x7e,0x2b,0x1,0x48,0x30,0x6,0xf0,0x3a,0xfa,0xb3,0x3,0xf7,0xbb,0xa2,0x80,0xf,
+    0x0,0xf8,0xf7,0x94,0xff,0xf7,0x3,0x20,0x28,0x29,0x0,0x32,0xbd,0x78,0x30,0xff,
+    0x2,0x7f,0x91,0x42,0x7,0xd1,0x0,0x2b,0xff,0x1,0xd0,0x19,0x68,0x0,0xe0,0x0,
+    0x21,0xeb,0x1,0x60,0x67,0x2,0x6,0x3,0x0,0x0,0x0,0xaa,0xff,0xa0,0x8,0x60,
+    0x1,0x20,0x8,0x71,0x2c,0xff,0x48,0x88,0x60,0x5,0x20,0xc8,0x80,0xc8,0xff,0x20,
+    0x80,0x1,0xc8,0x60,0x2,0x20,0x8,0xfd,0x61,0x23,0x2,0x0,0x0,0x80,0xb5,0xb,
+    0x0,0xfd,0x11,0xa9,0x0,0x93,0x42,0x3,0xd1,0x2,0x68,0xff,0xd2,0x6a,0x90,0x47,
+    0x2,0xbd,0x94,0x30,0xff,0x0,0x78,0x83,0x42,0x1,0xd0,0x7,0x20,0x57,0x2,0xbd,
+    0x9a,0x3f,0x8,0x1c,0x3f,0xc,0xc0,0x3f,0x0,0xf5,0x3,0x3f,0x4,0x2,0x53,0x1,
+    0xf8,0xb5,0x5,0x0,0xff,0xc,0x0,0x0,0x26,0xa2,0x68,0x61,0x68,0xff,0xf8,0xf7,
+    0x64,0xff,0x28,0x61,0x0,0x28,0xff,0x1,0xd1,0x6,0x20,0x5,0xe0,0x10,0x49,0xff,
+    0x88,0x42,0x1,0xda,0x29,0x61,0x4,0x26,0xff,0x7,0x20,0x2f,0x0,0x43,0x37,0x78,
+    0x70,0xff,0x28,0x69,0x60,0x60,0x28,0x69,0xa0,0x60,0xff,0x38,0x78,0x6,0x28,0xb,
+    0xd1,0x78,0x78,0xef,0x7,0x28,0x8,0xd1,0xd3,0x2,0x87,0xa2,0x78,0xfb,0x21,0x28,
+    0xd3,0x0,0x2a,0xff,0x8,0x20,0x38,0xef,0x70,0x30,0x0,0xf2,0x57,0x0,0x34,0x3e,
+    0x3,0xbf,0x0,0xf0,0x49,0x2,0x0,0x70,0x17,0x1,0x26,0xff,0x0,0x10,0x36,0x30,
+    0x7a,0x83,0x42,0x69,0xfd,0xd1,0x21,0x3,0x28,0x78,0x1,0x28,0x8,0xd0,0xff,0x2,
+    0x28,0x14,0xd0,0x3,0x28,0x2d,0xd0,0xff,0x8,0x28,0x37,0xd0,0xa,0x28,0x3e,0xd0,
+    0xdf,0x70,0xbd,0x20,0x0,0x2d,0xb7,0x0,0x0,0x28,0xf7,0x1c,0xd1,0x2,0x19,0x1,
+    0x3,0x22,0x21,0x0,0xfb,0x5c,0x31,0x29,0x3,0xe,0xff,0x70,0xbd,0xe8,0xff,0x7e,
+    0x80,0x6,0x80,0xe,0xe8,0x76,0x21,0xfb,0x0,0x5e,0x13,0x0,0x30,0x30,0x32,0x6a,
+    0x92,0xff,0x68,0x90,0x47,0x0,0x28,0x6,0xd0,0x0,0xfe,0x27,0x0,0xa,0x20,0xf2,
+    0xf7,0xf4,0xff,0x0,0x7f,0x20,0x26,0xe0,0x0,0x22,0x0,0x21,0xd,0x2,0xad,0xed,
+    0xd,0x0,0x1f,0xe0,0x51,0x6,0x1,0xcf,0x0,0x4,0xfa,0xcf,0x0,0x5,0x6f,0x3,
+    0x22,0x2,0x21,0x3,0xe0,0xfd,0x9,0x9,0x4,0xf,0x21,0x48,0x34,0x20,0x0,0x7f,
+    0x6,0xf0,0x75,0xf9,0x70,0xbd,0x68,0xd1,0x0,0xb5,0x9,0xcb,0x4,0x53,0x9f,0x9,
+    0xc4,0xfe,0x9f,0x3,0x70,0xfb,0xbd,0x7,0x5,0x0,0x30,0x68,0xfa,0x21,0x89,0xff,
+    0x0,0xe7,0xf7,0x31,0xfb,0xf,0x38,0x1,0xf7,0x0,0x0,0x22,0xcf,0x7,0x59,0xf9,
+    0x20,0x0,0xbf,0x0,0xf0,0x51,0xf8,0x70,0xbd,0xfb,0xb,0x28,0xfb,0x78,0x4,0x91,
+    0x0,0x5,0x28,0xd,0xd0,0x7,0x6f,0x28,0x1a,0xd0,0x9,0x7,0x0,0x31,0xbd,0x53,
+    0x2,0xb5,0x3e,0x53,0x8,0x9a,0x53,0x0,0x16,0xe0,0x6b,0x2,0xb,0xaf,0xd1,0x12,
+    0xe0,0x7,0xb9,0x0,0x3c,0xe1,0x4,0x9d,0xff,0xfe,0x7,0xf0,0x93,0xfb,0x60,0x61,
+    0xa,0x97,0x20,0x7,0xe0,0x2f,0x2,0x33,0x4f,0x1,0x17,0x2,0x82,0xeb,0xfe,0x8,
+    0x7d,0x0,0x31,0x5f,0x8,0x30,0x35,0xe8,0xff,0x7c,0x0,0x28,0x17,0xd1,0x28,0x0,
+    0x29,0xef,0x68,0xc9,0x68,0x88,0xfd,0x0,0xc,0xd0,0x29,0xff,0x7a,0x20,0x0,0x29,
+    0x30,0x1,0x70,0x1,0xff,0x20,0xe8,0x74,0x2,0x23,0x23,0xa2,0xef,0xde,0x37,0x4,
+    0x66,0xfe,0x31,0xbd,0x9,0xb,0x68,0xff,0xf7,0x31,0xbd,0x10,0x3f,0x0,0x22,0x0,
+    0x3d,0x32,0xff,0x10,0x78,0x1,0x2,0x50,0x78,0x8,0x43,0xff,0x21,0x0,0x64,0x31,
+    0xd3,0x78,0x1b,0x2,0xff,0x12,0x79,0x1a,0x43,0xc8,0x23,0xdb,0x1,0xff,0x5a,0x43,
+    0x12,0xc,0x4b,0x69,0xd2,0x18,0xff,0x8a,0x81,0xaf,0x22,0xd2,0x1,0x50,0x43,0xff,
+    0xc2,0x13,0x12,0xc,0x10,0x18,0x0,0x14,0xff,0xa,0x69,0x80,0x18,0xb4,0x22,0x52,
+    0x1,0xff,0x80,0x1a,0x88,0x80,0x20,0x0,0x14,0x30,0xff,0x2,0x68,0x8a,0x60,0xa,
+    0x60,0x2,0x79,0xfd,0x7,0x57,0x0,0x3c,0xff,0x94,0x20,0x22,0x5c,0xef,0x6c,0x34,
+    0x21,0x0,0xd,0x2,0x35,0xff,0x10,0xfe,0xf3,0x1,0x53,0x65,0x6e,0x73,0x69,0x72,
+    0x69,0xff,0x6f,0x6e,0x20,0x53,0x48,0x54,0x43,0x31,0xff,0x0,0xef,0xc8,0x0,0x0,
+    0x80,0x5d,0x0,0xff,0x0,0x78,0x66,0x0,0x0,0x38,0xb5,0x0,0xff,0xbf,0x4,0x0,
+    0x15,0x0,0x8,0xf0,0xf0,0xf7,0xfe,0xa,0xa1,0xc3,0x3,0x8,0xf0,0xb,0xff,0xff,
+    0x8e,0x48,0x1,0x0,0x8,0x31,0x21,0x60,0xff,0x78,0x30,0x20,0x63,0x22,0x0,0x29,
+    0x0,0xd7,0x20,0x0,0x80,0x17,0x0,0x31,0xbd,0x1,0x5a,0x21,0xff,0x60,0x54,0x20,
+    0x0,0x32,0xbd,0x1,0x1,0xbf,0x60,0x0,0x0,0x0,0xc,0x86,0x4,0x0,0x0,0xff,
+    0x2,0x7e,0x91,0x42,0x6,0xd0,0x98,0x22,0xff,0x82,0x5c,0x91,0x42,0x1,0xd1,0x80,
+    0x30,0xff,0x70,0x47,0x0,0x20,0x70,0x47,0x1,0x0,0xff,0x1,0x20,0xa,0x7e,0x1,
+    0x23,0x93,0x40,0xff,0x98,0x31,0x9,0x78,0x88,0x40,0x18,0x43,0xef,0x80,0xb2,0x70,
+    0x47,0x33,0x7,0x5a,0x35,0x2,0xff,0x20,0x68,0x70,0x0,0x20,0x20,0x61,0x21,0xff,
+    0x0,0x7c,0x31,0x8,0x70,0x48,0x70,0x88,0xaf,0x70,0x22,0x0,0x0,0x25,0x1,0x3c,
+    0xc1,0x1,0x71,0xfd,0xf8,0x7,0x6,0x85,0xf8,0x3,0x23,0x6c,0x4a,0xbe,0x15,0x2,
+    0xf8,0xf7,0xc8,0xfd,0xa,0x73,0x1,0x0,0xf7,0x20,0x32,0xbd,0x67,0x6,0x7,0xd1,
+    0x0,0x2b,0xff,0x1,0xd0,0x19,0x68,0x0,0xe0,0x0,0x21,0xeb,0x81,0x67,0x6f,0x2,
+    0x6,0x3,0x0,0x0,0x0,0x15,0xff,0xa0,0x8,0x60,0x1,0x20,0x8,0x71,0x5f,0xff,
+    0x4a,0x8a,0x60,0x52,0x22,0xca,0x80,0xa0,0x9f,0x22,0xca,0x60,0x8,0x61,0x1f,0x2,
+    0xf3,0x0,0xb5,0xf7,0xb,0x0,0x11,0xad,0x0,0x93,0x42,0x3,0xd1,0xff,0x2,0x68,
+    0xd2,0x6a,0x90,0x47,0x2,0xbd,0xff,0x98,0x30,0x0,0x78,0x83,0x42,0x1,0xd0,0xdf,
+    0x7,0x20,0x2,0xbd,0x6,0x3b,0x8,0x50,0x48,0xff,0x88,0x60,0x63,0x20,0xc8,0x80,
+    0x4f,0x48,0xef,0xc8,0x60,0x14,0x20,0x3d,0x2,0x2,0xbd,0x43,0xff,0x61,0x70,0x65,
+    0x6c,0x6c,0x61,0x20,0x43,0x3f,0x4d,0x33,0x36,0x36,0x38,0x36,0x37,0x1,0xc7,0x6,
+    0xbf,0x68,0x78,0x2,0x28,0xc,0xd1,0xaf,0x6,0x2d,0xea,0xaf,0x0,0x40,0xaf,0x8,
+    0x70,0xaf,0x4,0x31,0xbd,0x28,0xef,0x78,0x6,0x28,0x1b,0x1f,0x0,0x7c,0x30,0x1,
+    0xef,0x78,0x0,0x29,0x8,0x67,0x0,0x28,0x70,0x3,0xff,0x20,0x0,0x90,0x23,0x0,
+    0x57,0x33,0x8,0xff,0xa2,0x9,0x21,0xa,0xe0,0x40,0x78,0x0,0xef,0x28,0xa,0xd0,
+    0x8,0x17,0xc,0x54,0x33,0x8c,0xfb,0xa2,0x8,0x43,0x4,0x43,0xfd,0x31,0xbd,0x9,
+    0xff,0x0,0xf8,0xb5,0x5,0x0,0xf,0x0,0x0,0xff,0x26,0x69,0x46,0xe,0x70,0x2c,
+    0x0,0x7c,0xff,0x34,0x20,0x78,0x88,0x70,0x68,0x46,0x61,0xff,0x78,0x41,0x70,0xf8,
+    0x68,0x1,0x28,0x1,0xf7,0xdb,0x1,0x20,0x3,0x1,0x20,0x20,0x70,0x38,0xfd,0x69,
+    0xd,0xe,0x60,0x70,0x3a,0x69,0xf9,0x68,0xfd,0x28,0x43,0x0,0x47,0xfd,0x28,0x61,
+    0x0,0x28,0xff,0x1,0xd1,0x2,0x21,0x7,0xe0,0x1a,0x49,0xff,0x88,0x42,0x3,0xda,
+    0x29,0x61,0x4,0x20,0xff,0x69,0x46,0x8,0x70,0x6,0x21,0x28,0x0,0xdf,0x5a,0x30,
+    0x41,0x70,0x21,0x97,0x0,0x0,0xd0,0xdf,0x29,0x69,0xf9,0x60,0x61,0x9,0x8,0x39,
+    0x61,0x7f,0x1,0x78,0x2,0x29,0x7,0xd1,0x40,0xbb,0x0,0xff,0x4,0xd1,0x28,0x0,
+    0x0,0xf0,0xf8,0xf8,0xff,0xa6,0x70,0xe,0xe0,0x20,0x78,0x69,0x46,0xf7,0x89,0x78,
+    0x88,0x2d,0x1,0x1,0x28,0x6,0xd0,0xd5,0x60,0xd,0x0,0x49,0xd,0x0,0x2,0xd,
+    0x0,0x0,0xd1,0xfd,0xa0,0x93,0x0,0x0,0x78,0xf2,0xbd,0xf4,0x39,0xff,0x3,0x0,
+    0x0,0x55,0x2,0x0,0x80,0x38,0xff,0x1,0x0,0x0,0x78,0x14,0x0,0x70,0xb5,0xff,
+    0x82,0xb0,0x5,0x0,0x10,0x30,0x1,0x7a,0xff,0x8b,0x42,0x1d,0xd1,0x2c,0x0,0x51,
+    0x34,0xff,0x61,0x7a,0x49,0x1e,0x9,0x29,0x17,0xd8,0xff,0x2,0xa2,0x52,0x5c,0x52,
+    0x0,0x97,0x44,0xff,0x0,0xbf,0x8b,0x13,0x5,0x14,0x1b,0x13,0xff,0x29,0x42,0x66,
+    0x61,0x29,0x0,0x60,0x31,0xff,0x49,0x7f,0x0,0x29,0x10,0xd0,0x4,0x20,0xff,0x60,
+    0x72,0x3,0x23,0x0,0xbf,0x91,0xa2,0x79,0x3,0xa7,0x0,0xff,0x1,0xfc,0x73,0xbd,
+    0x5,0x13,0x8,0xff,0x8d,0xa2,0x4,0x21,0xf4,0xe7,0x6,0x21,0xff,0x61,0x72,0x0,
+    0x68,0xfa,0x21,0x89,0x0,0xff,0xe7,0xf7,0x30,0xf9,0x2,0x0,0x1,0x0,0xff,0x3c,
+    0x35,0x28,0x0,0x5,0xf0,0x59,0xff,0xff,0x73,0xbd,0x2e,0x0,0x60,0x36,0x7,0xf0,
+    0xff,0xb5,0xf9,0x30,0x60,0x70,0x7f,0x0,0x28,0xff,0x3,0xd1,0xa0,0x7a,0x2,0x28,
+    0x15,0xd1,0xa7,0x19,0xe0,0x8,0x41,0x2,0x65,0x1,0x2b,0x65,0x1,0x0,0xd3,0xbf,
+    0x32,0x67,0x1,0x5b,0x2,0x8f,0x5b,0x0,0x7,0xf0,0xdb,0x9e,0xf9,0x7d,0x2,0x48,
+    0x60,0x2b,0x2,0x4,0xd0,0x7f,0x28,0x0,0x60,0x30,0x80,0x7f,0x1,0xdb,0x1,0xfd,
+    0x28,0xdb,0x1,0x5,0xf0,0x3f,0xff,0x3,0x23,0x77,0x71,0xa2,0x0,0x2f,0x4,0x82,
+    0xfc,0xa,0x47,0x0,0xfb,0x73,0xbd,0x19,0x3,0x88,0xf8,0x6,0x20,0xf8,0x7b,0xe7,
+    0x9,0x99,0x4,0x68,0xa2,0xa8,0xe7,0x79,0x2,0xdd,0xb0,0x37,0x0,0x1d,0xd1,0x30,
+    0x79,0x0,0xd,0xd0,0xba,0xaf,0x2,0x5f,0x37,0x8,0x66,0xfc,0x3,0x27,0x0,0x6,
+    0xff,0x20,0xa0,0x72,0x0,0x20,0xb0,0x77,0x73,0xd5,0xbd,0x9b,0x2,0x7,0x21,0x0,
+    0x58,0xe3,0x8,0x56,0xfc,0x7f,0x4,0x20,0xee,0xe7,0x2,0x20,0xd0,0x3,0x0,0xff,
+    0xce,0xe7,0x28,0x0,0x2d,0x30,0x0,0x78,0xff,0x0,0x28,0x9,0xd1,0x20,0x78,0x86,
+    0x28,0xff,0x6,0xd1,0x0,0x22,0x29,0x0,0xa,0x20,0xff,0xf2,0xf7,0x4b,0xfd,0x2,
+    0x20,0xbf,0xe7,0xef,0x0,0x22,0x0,0x21,0xd,0x2,0x44,0xfd,0x0,0xff,0x20,0xb8,
+    0xe7,0x0,0x0,0x8,0x0,0x0,0xff,0x0,0x38,0xb5,0x4,0x0,0x5a,0x20,0x20,0xff,
+    0x5c,0x0,0x28,0x1e,0xd1,0x25,0x0,0x30,0xfe,0xd,0x1,0x29,0x68,0xc9,0x68,0x88,
+    0x47,0x0,0xff,0x28,0x11,0xd0,0x29,0x7a,0x20,0x0,0x29,0xff,0x30,0x1,0x70,0x1,
+    0x20,0x5a,0x21,0x60,0xbb,0x54,0x2,0x3,0x1,0x23,0x0,0x50,0x3,0x1,0x37,0xef,
+    0xa2,0xc,0x21,0x20,0x7b,0x0,0xd,0xfc,0x31,0x7d,0xbd,0x53,0xa,0x1a,0xfd,0x31,
+    0xbd,0x10,0x4b,0x0,0x7f,0x7c,0x30,0x1,0x78,0x0,0x29,0x8,0xc3,0x4,0xe9,0x2e,
+    0xc3,0x0,0x27,0x2,0x4,0xc3,0x0,0xa,0xe0,0x40,0xe4,0x97,0x2,0x17,0x4,0x29,
+    0xbb,0x0,0x17,0x2,0xf8,0xfb,0x4,0x7f,0x20,0x5a,0x34,0x20,0x70,0x10,0xbd,0x85,
+    0x2,0xdf,0x25,0x0,0x60,0x35,0x68,0xdd,0x0,0x23,0xd0,0xe7,0x20,0x0,0x55,0x45,
+    0x0,0x2f,0x0,0x2,0x8,0x43,0xff,0x8,0x28,0x1,0xda,0x8,0x20,0x4,0xe0,0xff,
+    0x80,0x21,0x9,0x1,0x88,0x42,0x0,0xdb,0xff,0x48,0x1e,0x0,0x4,0x81,0x10,0x49,
+    0xf,0xff,0x8,0x18,0xc0,0x10,0xc0,0x1,0xf6,0xf7,0xff,0xea,0xfa,0x13,0x22,0xa,
+    0x21,0xf6,0xf7,0xff,0xb9,0xfa,0xa8,0x82,0x68,0x68,0x28,0x61,0x7f,0x22,0x7e,0x21,
+    0x0,0x70,0x31,0x7,0x91,0x0,0xd7,0xd1,0xfc,0x28,0x4d,0x0,0x16,0x4d,0x4,0x0,
+    0x22,0xff,0x14,0x21,0xc3,0x78,0x0,0x79,0x0,0x2,0xff,0x18,0x43,0xf6,0xf7,0xa3,
+    0xfa,0xe8,0x60,0xff,0xa9,0x69,0x40,0x18,0xe8,0x60,0x28,0x68,0xff,0xa8,0x60,0x98,
+    0x20,0x22,0x5c,0x68,0x34,0x6b,0x21,0x0,0x33,0x2,0xb7,0xd1,0x2,0x0,0xc,0x17,
+    0x1,0xff,0x0,0x2,0x0,0x0,0x3,0xc4,0x3,0x0,0x8d,0x4,0x8,0x0,0x3,0x1,
+    0xf,0x0,0x3,0x0,0xa5,0x2,0x15,0xff,0x0,0x8,0xf0,0x75,0xfc,0x0,0xbf,0x14,
+    0xff,0xa1,0x20,0x0,0x30,0x30,0x8,0xf0,0x8f,0xff,0xfc,0xb7,0x48,0x1,0x0,0x8,
+    0x31,0x21,0xff,0x60,0x78,0x30,0x20,0x63,0x62,0x20,0x25,0xff,0x54,0x22,0x0,0x29,
+    0x0,0x20,0x0,0x64,0xfe,0x1b,0x0,0xb3,0xfc,0x20,0x0,0x3c,0x30,0x0,0xff,0x21,
+    0x41,0x70,0x81,0x70,0xc1,0x70,0x1,0xff,0x71,0x81,0x60,0xff,0x21,0x1,0x70,0x14,
+    0xfe,0xfb,0x0,0xa4,0x30,0xe6,0xf7,0x8,0xfe,0x20,0xfa,0x9,0x0,0xc4,0x9,0x0,
+    0x3,0xfe,0x20,0x0,0x32,0xae,0x77,0x0,0x1,0x1,0x39,0x68,0x0,0x12,0x4,0x2,
+    0x0,0xff,0x2,0x7e,0x91,0x42,0x6,0xd0,0x7c,0x22,0xff,0x82,0x5c,0x91,0x42,0x1,
+    0xd1,0x64,0x30,0xff,0x70,0x47,0x0,0x20,0x70,0x47,0x1,0x0,0xff,0x1,0x20,0xa,
+    0x7e,0x1,0x23,0x93,0x40,0xff,0x7c,0x31,0x9,0x78,0x88,0x40,0x18,0x43,0x5f,0x80,
+    0xb2,0x70,0x47,0xf8,0x97,0x0,0x19,0x19,0x0,0xff,0x1,0x23,0x1,0x26,0x25,0x0,
+    0x3c,0x35,0xff,0x0,0x2a,0x3,0xd0,0x17,0x68,0xef,0x65,0xff,0x52,0x68,0x1,0xe0,
+    0xea,0x65,0xc2,0x3,0xff,0x2a,0x66,0x0,0x29,0xe,0xd0,0xa,0x68,0xff,0x16,0x2a,
+    0x3,0xd1,0x4a,0x68,0x3,0x2a,0x7f,0x8,0xd1,0x5,0xe0,0x1b,0x2a,0x5,0xb,0x4,
+    0xff,0x2,0xd1,0x0,0x26,0x8b,0x68,0x3,0x40,0xff,0x2a,0x78,0xff,0x2a,0x1,0xd1,
+    0x2e,0x70,0xff,0x2,0xe0,0xb2,0x42,0x0,0xd0,0x1,0x23,0xff,0x22,0x0,0xa0,0x32,
+    0x8,0x26,0x2f,0x78,0xff,0x0,0x2f,0x16,0x70,0x50,0x70,0x5,0xd0,0xff,0x0,0x2b,
+    0x9,0xd0,0x14,0x22,0x0,0xbf,0x7f,0x13,0xa1,0x6,0xe0,0x0,0x2b,0x3,0xb,0x4,
+    0xbf,0x15,0xa1,0x0,0xe0,0x14,0x22,0xcd,0x6,0xc5,0xfd,0xfd,0xd3,0x1,0x7e,0x8,
+    0xf0,0x3b,0xfb,0x68,0xff,0x78,0x3,0x28,0x2,0xd1,0x5,0x20,0x68,0xff,0x70,0xe,
+    0xe0,0x4,0x28,0xc,0xd1,0x6,0xfe,0x9,0x0,0x81,0x20,0x28,0x73,0xed,0x20,0x68,
+    0xbb,0x73,0x2,0x57,0x0,0x48,0x32,0x81,0xfd,0x5,0xf9,0xbf,0xfa,0x0,0x20,0xf2,
+    0xbd,0x16,0xeb,0x0,0x3,0xc8,0x5e,0x7,0x35,0x1,0x0,0x6,0x1b,0x13,0x20,0xe3,
+    0x2,0x1,0x22,0xff,0x1,0x26,0x1,0x20,0x62,0x25,0x65,0x5d,0xff,0xa9,0x42,0x56,
+    0xd1,0x27,0x0,0xb8,0x37,0xfe,0x89,0x2,0x19,0x68,0x39,0x60,0x59,0x68,0x2,0xff,
+    0xe0,0x0,0x21,0x39,0x60,0xc1,0x3,0x79,0xf7,0x60,0x6,0x99,0xed,0x2,0xb,0x68,
+    0x16,0x2b,0xbf,0x3,0xd1,0x4b,0x68,0x6,0x2b,0xed,0x4,0x2b,0xf9,0x5,0xb,0x4,
+    0xed,0x0,0x20,0x8e,0x68,0x16,0x40,0xfe,0x25,0x3,0x2b,0x78,0xff,0x2b,0x1,0xd1,
+    0x28,0xea,0xf1,0x0,0x83,0xf1,0x2,0x26,0x8b,0x3,0x2b,0x78,0x0,0xff,0x2b,0x7,
+    0xd0,0x34,0x23,0x3b,0x72,0x7a,0xff,0x72,0x0,0x2e,0xa,0xd0,0x20,0x22,0x12,0xaf,
+    0xa1,0x8,0xe0,0x14,0xf,0x8,0x2,0xf,0x0,0x16,0x7e,0xf3,0x0,0x20,0x22,0xe6,
+    0xf7,0x4d,0xfd,0xe7,0x6,0x55,0x4,0xe7,0x4,0x5,0xe7,0x30,0x85,0xe7,0x4,0x6,
+    0xeb,0x8,0xd5,0x6,0xd7,0x8,0xea,0x4,0x0,0xe8,0xe4,0x0,0x46,0x7,0x3e,0xb,
+    0x0,0x2,0x0,0x0,0xb,0x5,0xf7,0x6,0x1f,0xa,0x94,0x1b,0x2,0x3,0x2,0xd6,
+    0x10,0x0,0x76,0x1f,0x0,0xb,0x2,0x3c,0xff,0x30,0x2,0x78,0x0,0x2a,0x1,0xd0,
+    0x1b,0xff,0xa2,0x0,0xe0,0x1e,0xa2,0xa,0x60,0x1,0xff,0x22,0xa,0x71,0x4a,0x4a,
+    0x8a,0x60,0xc7,0xff,0x22,0xca,0x80,0x42,0x6f,0x12,0x1,0xca,0xff,0x60,0x40,0x6f,
+    0x8,0x61,0x0,0x20,0x70,0xff,0x47,0x0,0x0,0x80,0xb5,0xb,0x0,0x11,0xff,0x0,
+    0x2,0x7e,0x93,0x42,0x3,0xd1,0x2,0xff,0x68,0xd2,0x6a,0x90,0x47,0x2,0xbd,0x62,
+    0xff,0x22,0x82,0x5c,0x93,0x42,0x1,0xd0,0x7,0xff,0x20,0x2,0xbd,0x3c,0x30,0x0,
+    0x78,0x0,0xff,0x28,0x1,0xd0,0x8,0xa0,0x0,0xe0,0xb,0xff,0xa0,0x8,0x60,0x1,
+    0x20,0x8,0x71,0x37,0xde,0x4b,0x8,0xc2,0x4,0xca,0x60,0x47,0x2,0x2,0xbd,0xff,
+    0x0,0x0,0xac,0x3d,0x3,0x0,0x41,0x56,0xff,0x41,0x47,0x4f,0x20,0x41,0x50,0x44,
+    0x53,0xff,0x39,0x39,0x33,0x30,0x0,0x0,0x41,0x4d,0xff,0x53,0x20,0x54,0x4d,0x44,
+    0x32,0x37,0x37,0xfb,0x32,0x33,0x9b,0x7,0x5,0x0,0xe,0x0,0x0,0xff,0x24,0x0,
+    0x27,0x32,0x69,0xf1,0x68,0xf8,0xf7,0xf7,0x27,0xfa,0x59,0x0,0xd1,0x0,0x21,0x10,
+    0xff,0xe0,0x24,0x49,0x88,0x42,0x1,0xda,0x4,0xff,0x27,0xb,0xe0,0x20,0x4a,0x90,
+    0x42,0x8,0xef,0xdb,0x53,0x0,0x98,0xf,0x0,0x11,0x0,0x3,0xfb,0xe0,0x1e,0x19,
+    0x0,0x0,0xda,0x19,0x0,0x28,0xff,0x0,0x44,0x30,0x1,0x60,0x29,0x0,0x3d,0xff,
+    0x31,0x1,0x22,0x8a,0x70,0xcc,0x70,0x33,0xff,0x69,0x1,0x2b,0x2,0xdb,0xca,0x70,
+    0x2,0xff,0x68,0x32,0x61,0xf2,0x68,0x1,0x2a,0x5,0xff,0xdb,0xca,0x78,0x2,0x23,
+    0x13,0x43,0xcb,0xfe,0x11,0x0,0xf2,0x60,0x4a,0x78,0xcb,0x78,0x9a,0xff,0x42,0x7,
+    0xd1,0x2a,0x69,0x3,0x68,0x9a,0xfa,0xd9,0x0,0x8c,0x31,0x0,0x4,0x60,0xf,0xe0,
+    0xa,0xfb,0x78,0xc,0x17,0x1,0xd,0x2a,0xa,0xd1,0xa,0xff,0x22,0xa,0x70,0x80,
+    0x21,0x1,0x71,0x44,0xaf,0x71,0x2,0x23,0x2a,0x83,0x1,0x28,0x81,0x1,0xc4,0xef,
+    0xf9,0x38,0x0,0xf2,0xcb,0x0,0xa0,0x86,0x1,0xfe,0xe8,0x1,0x1,0x0,0x20,0xa1,
+    0x7,0x0,0x38,0xff,0xb5,0x4,0x0,0x25,0x0,0x30,0x35,0x28,0xff,0x0,0x29,0x68,
+    0xc9,0x68,0x88,0x47,0x0,0xef,0x28,0x11,0xd0,0x1,0xb9,0x1,0x29,0x7a,0x20,0xff,
+    0x0,0x29,0x30,0x1,0x70,0x92,0x20,0x28,0xff,0x76,0x2,0x20,0x0,0x90,0x23,0x0,
+    0x4b,0xef,0x33,0x0,0x22,0x92,0xc9,0x5,0x95,0xf9,0x31,0xff,0xbd,0x0,0x22,0x0,
+    0x21,0xa,0x20,0xf2,0xff,0xf7,0xa2,0xfa,0x31,0xbd,0x70,0xb5,0x82,0xff,0xb0,0x5,
+    0x0,0x2e,0x0,0x10,0x36,0x30,0xff,0x7a,0x83,0x42,0x0,0xd0,0xe0,0xe0,0x2c,0xff,
+    0x0,0x38,0x34,0x61,0x79,0x49,0x1e,0x10,0xff,0x29,0x0,0xd9,0xd9,0xe0,0x1,0xa2,
+    0x52,0x7f,0x5c,0x52,0x0,0x97,0x44,0x8,0xd5,0x0,0x0,0xff,0x37,0x42,0xa5,0x77,
+    0x4d,0x62,0xd5,0xd5,0xaf,0x6f,0x82,0x92,0xa2,0xf5,0x0,0x2d,0x7f,0x5,0xd,0xff,
+    0xd1,0x29,0x0,0x4c,0x31,0x28,0x0,0x30,0xbf,0x30,0x32,0x6a,0x92,0x68,0x90,0x85,
+    0x0,0x4,0xff,0xd0,0x3,0x20,0x60,0x71,0x0,0x22,0x29,0xb7,0x0,0x17,0xe0,0x17,
+    0x2,0x31,0x6a,0x9d,0x6,0xc,0x67,0xd0,0x21,0x78,0xab,0x0,0x99,0x4,0x20,0x74,
+    0x99,0x2,0x9d,0x2b,0x99,0x8,0xa2,0xe0,0x2,0x31,0x4,0x97,0x6,0x56,0xef,0xfa,
+    0x73,0xbd,0x7,0xf,0x0,0xa0,0x20,0x28,0x7f,0x5c,0x8e,0x21,0x21,0x74,0x60,0x74,
+    0x7,0x7,0xd7,0x6c,0xe0,0x8,0x15,0x0,0x8f,0x3b,0x0,0x20,0x20,0xfe,0x13,0xa,
+    0x8f,0x21,0x61,0xe0,0x20,0x7a,0xa0,0xff,0x71,0xe0,0x68,0x30,0x60,0x0,0x20,0x0,
+    0xff,0x21,0xe1,0x71,0x21,0x72,0xe0,0x60,0xa0,0xbf,0x79,0x0,0x28,0x5,0xd0,0xb,
+    0x2d,0x0,0x28,0xff,0x0,0x0,0xf0,0xbc,0xf8,0x73,0xbd,0xc,0xee,0xb,0x0,0x8,
+    0xe0,0x9,0x11,0x8,0x98,0xf8,0x30,0x7f,0x7a,0x8,0xf0,0x27,0xf9,0x1,0x21,0x7,
+    0x2,0xff,0x2b,0xf9,0x73,0xbd,0x62,0x7d,0x21,0x7d,0xfe,0x19,0x2,0xd1,0xf8,0xa0,
+    0x79,0x80,0x7,0x50,0x53,0xd4,0x11,0x8f,0x2,0x69,0x0,0xe7,0x69,0x0,0x1,0x69,
+    0x4,0xff,0x0,0x21,0x2c,0xe0,0x20,0x7d,0x61,0x7d,0x7f,0x9,0x2,0x40,0x18,0x20,
+    0x85,0x10,0x1f,0x0,0xf5,0xb6,0x1f,0x0,0x3,0xc5,0xc,0xb6,0x21,0x3f,0xe0,0xf6,
+    0x45,0xa,0xdb,0xf8,0x3f,0x22,0xc,0xe0,0xe1,0x79,0x5f,0x0,0x29,0xd,0xd0,0xa,
+    0x1b,0x0,0x80,0x1b,0x0,0xad,0x0,0xc5,0xc,0x80,0x21,0xe3,0x3,0xd2,0xa7,0x0,
+    0x8,0xff,0xf0,0xf2,0xf8,0x0,0x28,0x2,0xd0,0xd,0xfe,0x23,0x0,0x73,0xbd,0xa0,
+    0x79,0xc0,0x7,0xa,0xeb,0xd5,0xe,0xb,0x0,0xb8,0x6b,0x14,0xb8,0x21,0x9,0xab,
+    0xe0,0xf,0x15,0x0,0xb4,0x15,0x14,0xb4,0x45,0x4,0xa4,0xfa,0x45,0x0,0x10,0xd5,
+    0x1,0x1,0x0,0x14,0x31,0xc,0xff,0x79,0xa3,0x42,0x20,0xd1,0x3,0x0,0x3d,0xff,
+    0x33,0x1c,0x78,0xd,0x2c,0x1b,0xd1,0x12,0xbf,0x68,0xa,0x60,0x59,0x78,0xc9,0x53,
+    0x2,0x21,0xff,0x19,0x70,0xb8,0x21,0xd9,0x72,0x3,0x21,0xa7,0x0,0x91,0x3,0x53,
+    0xe,0x15,0x0,0xb4,0x15,0x14,0xb4,0xff,0x21,0xf8,0xf7,0x7b,0xf8,0x13,0xbd,0x80,
+    0xff,0xb5,0x1,0x0,0x3e,0x31,0xa,0x78,0x0,0xff,0x2a,0xa,0xd0,0x93,0x7,0x9b,
+    0xf,0x3,0xff,0x2b,0x1,0xd1,0x1f,0x22,0x4,0xe0,0xd2,0xff,0x7,0x1,0xd5,0x2d,
+    0x22,0x0,0xe0,0x1b,0xff,0x22,0x80,0x23,0x8b,0x72,0xca,0x72,0x2,0xfb,0x23,0x2,
+    0xcf,0x4,0xf8,0xf7,0x6b,0xf8,0x1,0xfe,0x87,0x0,0xff,0x21,0x2,0x69,0x4d,0x4b,
+    0x9a,0xff,0x42,0x1,0xd1,0xe8,0x21,0xd,0xe0,0x4c,0x7e,0x9,0x4,0xdc,0x21,0x8,
+    0xe0,0x5b,0x0,0x9,0x2,0xdf,0xb7,0x21,0x3,0xe0,0x48,0x13,0x0,0x0,0xd1,0xff,
+    0x49,0x21,0x2,0x0,0x3e,0x32,0x13,0x78,0x7d,0xdc,0x4f,0x0,0xc9,0x1c,0xc9,0xb2,
+    0x9b,0x7,0x0,0xff,0x14,0x31,0xc9,0xb2,0x83,0x23,0x93,0x72,0xf5,0xd1,0x55,0x8,
+    0x83,0x55,0x0,0x40,0xf8,0x10,0xbd,0xff,0x38,0xb5,0x4,0x0,0x10,0x2,0x8,0x18,
+    0xff,0x25,0x0,0xa0,0x35,0x29,0x78,0x6a,0x78,0xff,0x51,0x43,0x88,0x42,0x0,0xd2,
+    0x8,0x0,0xff,0x0,0x4,0xe6,0xf7,0xaa,0xfc,0xc0,0x1,0xff,0xf5,0xf7,0x41,0xff,
+    0x13,0x22,0x29,0x69,0xff,0xf5,0xf7,0x10,0xff,0x1,0x0,0x20,0x0,0xff,0x54,0x30,
+    0x82,0x6c,0x51,0x43,0x8a,0x13,0xff,0x52,0xc,0x51,0x18,0xc9,0x13,0x42,0x6c,0xff,
+    0x89,0x18,0x1,0x80,0x20,0x0,0x14,0x30,0xff,0x1,0x68,0xc1,0x63,0x2,0x79,0x50,
+    0x34,0xff,0x21,0x0,0x7,0x20,0xf2,0xf7,0x1b,0xf9,0xf7,0x31,0xbd,0xf8,0x59,0x8,
+    0x80,0xb2,0x25,0x0,0xff,0x60,0x35,0x2b,0x88,0x21,0x0,0xc0,0x31,0xff,0x4a,0x69,
+    0x5a,0x43,0x8e,0x69,0x46,0x43,0xff,0x92,0x1b,0xce,0x69,0x5e,0x43,0xb,0x6a,0xff,
+    0x43,0x43,0xf0,0x1a,0x0,0x2a,0x0,0xd5,0xff,0x0,0x22,0x82,0x42,0x0,0xda,0x2,
+    0x0,0xff,0x26,0x0,0x14,0x36,0x17,0x0,0x8,0x69,0xff,0xa,0x78,0x50,0x43,0x80,
+    0x2,0x49,0x78,0xff,0x15,0x4a,0x51,0x43,0xe6,0xf7,0x63,0xfc,0xff,0x3a,0x0,0x42,
+    0x43,0x10,0x0,0xd1,0x17,0xff,0xea,0x6d,0xd3,0x17,0xe6,0xf7,0x33,0xfe,0xff,0x80,
+    0x22,0x12,0x2,0x0,0x23,0xeb,0xf7,0xbf,0x3,0xf9,0xfa,0x22,0x92,0x0,0x9,0x2,
+    0xfe,0xff,0xf8,0x80,0x8,0x8a,0x7,0x10,0x43,0xaa,0xff,0x6d,0x12,0x18,0xb2,0x64,
+    0x30,0x68,0x70,0xef,0x64,0xaa,0x78,0x58,0x8d,0x8,0xd4,0xf8,0xf1,0x7f,0xbd,0xd0,
+    0x1,0x1,0x0,0xa0,0x86,0xc1,0x0,0xff,0xa1,0x7,0x0,0x9e,0xca,0x0,0x0,0x38,
+    0xff,0xb5,0x0,0xbf,0x4,0x0,0x15,0x0,0x8,0xff,0xf0,0x96,0xf8,0xd,0xa1,0x20,
+    0x0,0x30,0xff,0x30,0x8,0xf0,0xb1,0xf8,0x94,0x48,0x1,0xff,0x0,0x8,0x31,0x21,
+    0x60,0x78,0x30,0x20,0xff,0x63,0x20,0x0,0x3c,0x30,0x0,0x21,0x1,0xff,0x70,0x41,
+    0x70,0x81,0x70,0xc1,0x70,0x41,0xaf,0x60,0x22,0x0,0x29,0xff,0x0,0x74,0x27,0x0,
+    0xcf,0xff,0xf8,0x20,0x0,0x32,0xbd,0x0,0x0,0x2,0x3f,0x1,0x5c,0x5d,0x0,0x0,
+    0xf,0x9,0x0,0xb,0x0,0xff,0x7e,0x91,0x42,0x6,0xd0,0x8c,0x22,0x82,0xfb,0x5c,
+    0x91,0x8b,0x1,0x74,0x30,0x70,0x47,0x0,0xff,0x20,0x70,0x47,0x1,0x0,0x1,0x20,
+    0xa,0xff,0x7e,0x1,0x23,0x93,0x40,0x8c,0x31,0x9,0xff,0x78,0x88,0x40,0x18,0x43,
+    0x80,0xb2,0x70,0xfd,0x47,0x73,0x3,0x25,0x0,0x30,0x35,0x28,0x0,0xff,0x29,0x68,
+    0xc9,0x68,0x88,0x47,0x0,0x28,0xff,0x12,0xd0,0x2,0x20,0x28,0x73,0x29,0x7a,0xff,
+    0x20,0x0,0x29,0x30,0x1,0x70,0xf,0x20,0xff,0x69,0x21,0x60,0x54,0x2,0x20,0x0,
+    0x90,0xff,0x23,0x0,0x69,0x33,0x0,0x22,0xf,0x21,0xff,0x20,0x0,0xf7,0xf7,0x5e,
+    0xff,0x31,0xbd,0xdf,0x0,0x22,0x0,0x21,0xa,0xd1,0x0,0x6b,0xf8,0xf7,0x31,0xbd,
+    0x70,0x45,0x0,0x26,0x0,0x3c,0x36,0xfe,0x4a,0x0,0x2a,0x3,0xd0,0x10,0x68,0xb0,
+    0x61,0xbf,0x50,0x68,0x2,0xe0,0xb5,0x61,0x8e,0x1,0x2,0xff,0xf0,0x61,0x2,0x21,
+    0x20,0x7e,0x7,0xf0,0xff,0x7c,0xff,0x22,0x0,0x64,0x32,0xa2,0x20,0xff,0x10,0x70,
+    0x80,0x20,0x50,0x70,0x1,0x20,0xff,0x90,0x70,0x20,0x20,0xd0,0x70,0x15,0x71,0xff,
+    0xa8,0x20,0xd0,0x71,0x30,0x78,0x5,0x28,0xff,0x7,0xd1,0x6,0x20,0x30,0x70,0x3,
+    0x23,0xfb,0x11,0x78,0x61,0x2,0x38,0xff,0x1,0xe0,0x4,0xdc,0xf,0x0,0xb9,0x0,
+    0xbd,0x80,0xb5,0xcb,0x6,0x1d,0xd1,0xff,0x1,0x0,0x3c,0x31,0x0,0x2b,0x3,0xd0,
+    0xff,0x1a,0x68,0xa,0x62,0x5a,0x68,0x3,0xe0,0xef,0x0,0x22,0xa,0x62,0x7f,0x3,
+    0x4a,0x62,0xa,0xff,0x78,0x4,0x2a,0x9,0xd1,0x6,0x22,0xa,0xfa,0x41,0x0,0x2,
+    0x67,0x0,0x64,0x21,0x41,0x5c,0xf7,0xbb,0xf7,0x15,0x45,0x0,0x5,0x20,0x8,0x45,
+    0x0,0x2,0xfb,0xbd,0x6,0x3,0x0,0xf8,0xb5,0x7,0x0,0xd,0xff,0x0,0x0,0x24,
+    0x0,0x26,0xaa,0x68,0x29,0xff,0x68,0xf7,0xf7,0x20,0xff,0x0,0x28,0x1,0xff,0xd1,
+    0x0,0x21,0x10,0xe0,0x9a,0x49,0x88,0xff,0x42,0x1,0xda,0x4,0x26,0xb,0xe0,0x4a,
+    0xff,0x0,0x90,0x42,0x8,0xdb,0x97,0x4b,0x98,0xbe,0xf,0x0,0x11,0x0,0x3,0xe0,
+    0x96,0x19,0x0,0x0,0xef,0xda,0x19,0x0,0x38,0x83,0x1,0x41,0x60,0x1,0xff,0x21,
+    0x81,0x70,0xc4,0x70,0x2a,0x68,0x1,0xf7,0x2a,0x2,0xdb,0x89,0x1,0x68,0x29,0x60,
+    0xa9,0xff,0x68,0x1,0x29,0x5,0xdb,0xc1,0x78,0x2,0xef,0x22,0xa,0x43,0xc2,0x11,
+    0x0,0xa9,0x60,0x41,0xff,0x78,0xc2,0x78,0x91,0x42,0x7,0xd1,0x39,0xff,0x69,0x42,
+    0x68,0x91,0x42,0x3,0xd1,0x84,0xfe,0x31,0x0,0x44,0x60,0x9,0xe0,0x1,0x78,0x9,
+    0xff,0x29,0x1,0xd0,0xa,0x29,0x4,0xd1,0x7,0xfe,0xcb,0x1,0x38,0x0,0x0,0xf0,
+    0xd0,0xf8,0x30,0xff,0x0,0xf2,0xbd,0xab,0xa0,0x8,0x60,0x1,0xff,0x20,0x8,0x71,
+    0x79,0x4a,0x8a,0x60,0x7a,0xff,0x22,0xca,0x80,0x7a,0x4a,0xca,0x60,0x2,0xff,0x2,
+    0xa,0x61,0x79,0x4a,0x4a,0x61,0x88,0xfd,0x61,0xbb,0x3,0x0,0x0,0x80,0xb5,0xb,
+    0x0,0xf5,0x11,0xd9,0x1,0x93,0x4f,0x0,0x2,0x68,0xd2,0x6a,0xff,0x90,0x47,0x2,
+    0xbd,0x8c,0x30,0x0,0x78,0x5f,0x83,0x42,0x1,0xd0,0x7,0xd9,0x0,0x9a,0x43,0x8,
+    0xfd,0x68,0x43,0x8,0xa0,0x22,0x92,0x1,0xca,0x60,0xf6,0x1f,0x1,0x61,0x69,0x45,
+    0x8,0x2,0xbd,0xe4,0x38,0xbf,0x3,0x0,0x70,0xb5,0x82,0xb0,0xab,0x3,0x14,0xff,
+    0x36,0x30,0x79,0x83,0x42,0x74,0xd1,0x25,0xff,0x0,0x38,0x35,0x28,0x79,0x2,0x28,
+    0x8,0xff,0xd0,0x6,0x28,0x50,0xd0,0x7,0x28,0x31,0xff,0xd0,0x8,0x28,0x32,0xd0,
+    0xb,0x28,0x44,0xbf,0xd0,0x73,0xbd,0x20,0x0,0x2d,0x61,0x0,0x0,0xff,0x28,0xd,
+    0xd1,0x21,0x0,0x6a,0x31,0x20,0xff,0x0,0x30,0x30,0xf2,0x69,0x92,0x68,0x90,0xff,
+    0x47,0x0,0x28,0x4,0xd0,0x3,0x20,0x28,0x7f,0x71,0x0,0x22,0x21,0x0,0x15,0xe0,
+    0x17,0x2,0xdf,0xf1,0x69,0xc9,0x68,0x88,0x17,0x0,0xa,0xd0,0xfd,0x29,0xbd,0x1,
+    0x29,0x30,0x1,0x70,0x2,0x20,0xff,0x0,0x90,0x23,0x0,0x69,0x33,0x0,0x22,0xdf,
+    0xf,0x21,0x3e,0xe0,0x1,0x2d,0x4,0x0,0x21,0xff,0xa,0x20,0xf1,0xf7,0x53,0xff,
+    0x73,0xbd,0xfd,0x8,0xf,0x0,0x2c,0xe0,0xa8,0x79,0x0,0x28,0x77,0x16,0xd1,0x68,
+    0x5,0x0,0x6,0xd0,0xa,0x11,0x0,0xff,0x30,0x79,0x7,0xf0,0x49,0xfe,0x1,0x21,
+    0x97,0x2,0xe0,0x9,0x2f,0x2,0x21,0xf,0x6,0x87,0x2,0x0,0xd7,0xf0,0x71,0xf8,
+    0x2d,0x2,0x5,0xeb,0x0,0x28,0x71,0xde,0xf,0x2,0x33,0xf8,0x73,0xbd,0x1f,0x2,
+    0x47,0xfe,0x77,0x0,0x28,0x2,0x3d,0x4,0x73,0xbd,0xb,0x5,0x0,0x7f,0x6,0xf0,
+    0x22,0xfb,0x30,0x60,0x6,0x7d,0x4,0xfd,0x6b,0x7d,0x0,0x6b,0x20,0x21,0x5c,0x20,
+    0x0,0xd7,0xf7,0xf7,0x5,0x47,0x0,0x10,0xfb,0x0,0x1,0x0,0xff,0x14,0x31,0xc,
+    0x79,0xa3,0x42,0x11,0xd1,0xff,0x3c,0x23,0xc3,0x5c,0xa,0x2b,0xd,0xd1,0xff,0xb,
+    0x23,0x3c,0x24,0x3,0x55,0x12,0x68,0x7f,0xa,0x60,0x6,0x21,0x0,0x91,0x3,0x35,
+    0x6,0xff,0x21,0x41,0x5c,0xf7,0xf7,0xeb,0xfd,0x13,0xfe,0x33,0x0,0x2,0x0,0x67,
+    0x32,0x1,0x0,0x3d,0xff,0x31,0x8b,0x78,0x0,0x2b,0x12,0xd0,0x84,0xff,0x23,0x53,
+    0x70,0x3,0x6c,0xf,0x4c,0xa3,0xff,0x42,0x1,0xd1,0xc4,0x23,0xa,0xe0,0x64,0x7d,
+    0x0,0x9,0x2,0xb4,0x23,0x5,0xe0,0xb,0x13,0x4,0xdf,0xa4,0x23,0x0,0xe0,0x94,
+    0x23,0x0,0x8b,0x78,0xfd,0xb,0x27,0x0,0x3,0x61,0x0,0x23,0x4b,0x70,0xff,0x8b,
+    0x70,0x3,0x64,0x2,0x23,0x11,0x78,0xff,0xf7,0xf7,0xcd,0xfd,0x10,0xbd,0x0,0x0,
+    0xff,0x40,0x9c,0x0,0x0,0x98,0x2e,0x2,0x0,0xff,0x40,0x42,0xf,0x0,0x0,0x0,
+    0xc0,0x4e,0xef,0xff,0xff,0x7f,0x0,0x2,0x0,0x0,0x38,0xb5,0xff,0x4,0x0,0x3d,
+    0x20,0x20,0x5c,0xc0,0x7,0xff,0x27,0xd5,0x25,0x0,0x44,0x35,0x20,0x0,0xff,0x6c,
+    0x30,0x1,0x78,0x42,0x78,0x12,0x2,0xff,0x89,0x18,0x80,0x78,0x0,0x4,0x8,0x18,
+    0xff,0xc1,0x17,0x9,0x5,0x2,0xb,0x11,0x43,0xff,0x0,0x5,0x80,0x22,0x52,0x1,
+    0x0,0x23,0xff,0xea,0xf7,0xc8,0xfe,0x6a,0x69,0xd3,0x17,0xff,0xe6,0xf7,0xef,0xfb,
+    0xc0,0xb,0x4a,0x4,0xff,0x10,0x43,0x2a,0x69,0x12,0x18,0x6a,0x60,0xff,0x20,0x0,
+    0x14,0x30,0x1,0x68,0x29,0x60,0xdf,0x2,0x79,0x29,0x0,0x7,0x73,0x1,0x99,0xfe,
+    0xee,0x57,0x2,0x80,0x7,0x1f,0x57,0xc,0xc1,0x78,0x0,0xff,0x79,0x0,0x2,0x8,
+    0x18,0x0,0x4,0x40,0xff,0x12,0xf0,0x21,0x49,0x0,0xe6,0xf7,0xf6,0xff,0xf9,0xe9,
+    0x69,0x48,0x43,0xc0,0x13,0xa9,0xff,0x69,0x40,0x18,0xaa,0x21,0x49,0x1,0x40,0xff,
+    0x18,0xa8,0x81,0x60,0x69,0xa8,0x60,0x8c,0xbf,0x20,0x22,0x5c,0x4c,0x34,0x21,0x47,
+    0x4,0x75,0xfb,0xfe,0x31,0xbf,0x0,0x53,0x54,0x4d,0x69,0x63,0xff,0x72,0x6f,0x65,
+    0x6c,0x65,0x63,0x74,0x72,0xff,0x6f,0x6e,0x69,0x63,0x73,0x20,0x4c,0x50,0xef,0x53,
+    0x32,0x35,0x48,0xcd,0x0,0x10,0xb5,0x0,0xfb,0xbf,0x4,0x6f,0x1,0x15,0xfd,0x0,
+    0xbf,0x46,0xff,0xa1,0x20,0x0,0x30,0x30,0x7,0xf0,0x4b,0xff,0xfe,0x28,0x48,0x1,
+    0x0,0x8,0x31,0x21,0xff,0x60,0x64,0x30,0x20,0x63,0x0,0x20,0x4a,0xff,0x21,0x60,
+    0x54,0x20,0x0,0x10,0xbd,0x2,0xff,0x7e,0x91,0x42,0x0,0xd0,0x0,0x20,0x70,0xff,
+    0x47,0x1,0x0,0x1,0x20,0x9,0x7e,0x88,0xff,0x40,0x80,0xb2,0x70,0x47,0x38,0xb5,
+    0x5,0xff,0x0,0xc,0x0,0x2a,0x0,0x0,0x21,0x60,0xdf,0x30,0x4,0xf0,0xd3,0xff,
+    0x9,0x2,0x28,0x0,0xdd,0x74,0xb,0x0,0xcd,0xff,0x6,0x3b,0x0,0x68,0x54,0xff,
+    0x0,0x20,0xe8,0x64,0xac,0x81,0x14,0x48,0xff,0x84,0x42,0x1,0xdb,0x3,0x20,0x32,
+    0xbd,0xfd,0x0,0x3,0x2,0x22,0x0,0x20,0x8b,0x68,0x1,0xff,0x2b,0x1,0xda,0x8a,
+    0x60,0x70,0x47,0xe,0xd7,0x4a,0x93,0x42,0x9,0x2,0x4,0x5b,0x0,0x0,0x0,0xff,
+    0xd,0xa0,0x8,0x60,0x1,0x20,0x8,0x71,0xff,0x8,0x4a,0x8a,0x60,0x15,0x22,0xca,
+    0x80,0xff,0x7,0x4a,0xca,0x60,0x5,0x22,0xa,0x61,0xbf,0x88,0x61,0x6,0x48,0x48,
+    0x61,0x7f,0x2,0x0,0x7f,0x0,0x24,0x42,0x3,0x0,0xd9,0xd6,0xbf,0x0,0xad,0x27,
+    0x91,0x1,0x57,0x1,0x8f,0x5,0x41,0xd5,0x0,0x20,0xff,0x48,0x53,0x43,0x44,0x54,
+    0x44,0x38,0x30,0xff,0x31,0x41,0x0,0x0,0xa0,0x70,0x47,0x44,0xff,0x0,0xf,0x0,
+    0x1d,0x7,0x30,0x52,0xdd,0x3f,0x55,0x22,0xaa,0xd3,0x4d,0x62,0xf1,0x0,0x0,0xe,
+    0xae,0xf,0x22,0xa6,0x9b,0xc4,0x3,0xc,0xff,0xe8,0x1,0x58,0x6f,0xe6,0x29,0x80,
+    0x44,0xf1,0x2,0x2,0xc,0x22,0x2,0xbf,0x49,0x1,0x18,0x0,0x0,0x70,0xf7,0x1,
+    0xe,0xff,0x0,0xb5,0x68,0x22,0x68,0xd2,0x69,0x90,0xff,0x47,0x0,0x28,0x1c,0xd1,
+    0xb0,0x68,0x85,0xff,0x42,0x1,0xd0,0x5,0x20,0x70,0xbd,0x20,0xff,0x65,0x0,0x28,
+    0x1,0xd1,0x6,0x20,0x0,0xff,0xe0,0xa,0x20,0x25,0x0,0x4a,0x35,0x68,0xff,0x70,
+    0x68,0x78,0xa,0x28,0xa,0xd1,0x28,0xff,0x78,0x6,0x28,0x7,0xd1,0x2,0x23,0xba,
+    0xef,0xa2,0x10,0x21,0x20,0x6f,0x1,0xa0,0xfc,0x2,0xe7,0x20,0x28,0x70,0xcb,0x0,
+    0x9f,0x1,0x70,0xb5,0x82,0xff,0xb0,0x5,0x0,0x2e,0x0,0x10,0x36,0x30,0xfb,0x7a,
+    0x98,0x61,0x1,0xa9,0xe0,0x2c,0x0,0x38,0xff,0x34,0xa0,0x7c,0x40,0x1e,0xd,0x28,
+    0x0,0xff,0xd9,0xa2,0xe0,0x1,0xa1,0x9,0x5c,0x49,0xff,0x0,0x8f,0x44,0x6,0x38,
+    0x4e,0x9e,0x41,0xff,0x9e,0x96,0x9e,0x53,0x9e,0x69,0x5e,0x9e,0xff,0x60,0x28,0x0,
+    0x2d,0x30,0x0,0x78,0x0,0xff,0x28,0xf,0xd1,0x29,0x0,0x48,0x31,0x28,0xde,0xb9,
+    0x1,0x32,0x6a,0x92,0x68,0x8f,0x2,0x6,0xd0,0xdf,0x0,0x22,0x29,0x0,0xa,0xff,
+    0x3,0xfd,0x0,0xf7,0x20,0x81,0xe0,0x1b,0x2,0x31,0x6a,0xc9,0x68,0xfd,0x88,0x1b,
+    0x0,0xe,0xd0,0x21,0x78,0x28,0x0,0xff,0x29,0x30,0x1,0x70,0x61,0x78,0x80,0x20,
+    0xff,0x8,0x43,0xe0,0x73,0x3,0x20,0x0,0x90,0xff,0x2b,0x0,0x47,0x33,0x2a,0x0,
+    0x47,0x32,0xab,0x4c,0xe0,0x97,0x1,0x21,0x39,0x2,0x58,0x39,0x0,0x64,0xff,0xe0,
+    0x3,0x20,0xa0,0x74,0x2,0x23,0x8e,0xfb,0xa2,0x14,0xd1,0x1,0xf7,0xf7,0x46,0xfc,
+    0x73,0xff,0xbd,0x60,0x79,0x40,0x7,0x9,0xd5,0xa0,0x3f,0x69,0x30,0x60,0x2,0x23,
+    0x86,0xcb,0x0,0x17,0x2,0x7f,0x3a,0xfc,0x9,0x20,0x4e,0xe0,0x4,0x2b,0x0,0xdf,
+    0x0,0x22,0x8,0x21,0x10,0xf9,0x0,0xa0,0x74,0xff,0x30,0x68,0xfa,0x21,0x89,0x0,
+    0xe6,0xf7,0xff,0xa3,0xf8,0x2,0x0,0x1,0x0,0x60,0x35,0xd7,0x6,0xe0,0xd,0x13,
+    0x1,0xf,0x23,0x4,0x2,0x21,0xff,0x74,0x35,0x28,0x0,0x4,0xf0,0xc4,0xfe,0xff,
+    0x73,0xbd,0xe0,0x7c,0x6,0x28,0x3,0xd1,0xff,0x28,0x0,0x60,0x30,0x4,0xf0,0xcd,
+    0xfe,0xfe,0xd3,0xa,0xc,0xd0,0x2,0x20,0x20,0x71,0xb,0xba,0x99,0x4,0x3c,0x99,
+    0x0,0x3c,0x32,0x2,0x69,0x4,0xfa,0xff,0xfb,0x73,0xbd,0x28,0x0,0x0,0xf0,0xa4,
+    0xff,0xf8,0xe0,0x7c,0xa,0x28,0x5,0xd1,0xa0,0xff,0x69,0x31,0x68,0x88,0x42,0x1,
+    0xd1,0xa,0xbf,0x20,0xe,0xe0,0x2,0x23,0x61,0x8f,0x8,0xf2,0xcf,0xfb,0x7,0x20,
+    0x6,0xc9,0x0,0x67,0xa,0x90,0xfe,0xdd,0x8,0x77,0x0,0x73,0xbd,0x38,0xb7,0x1,
+    0x25,0x0,0xff,0x3c,0x35,0xa8,0x7b,0xa,0x28,0xc,0xd1,0xfd,0x20,0x73,0x0,0x81,
+    0x42,0x55,0xd1,0xe,0x20,0x9f,0xa8,0x73,0x2,0x23,0x57,0xe3,0x0,0x97,0x3,0xd4,
+    0xaf,0xfb,0x31,0xbd,0xf,0x1d,0x4,0x74,0x1d,0x0,0x46,0xee,0xb1,0x1,0x0,0xbf,
+    0x4f,0x1b,0x8,0xc6,0xfb,0xc,0xbf,0x20,0x3c,0xe0,0xd,0x28,0x14,0x1d,0x8,0x37,
+    0xff,0xd1,0x6,0xf0,0xc3,0xf8,0x21,0x0,0x10,0xe7,0x31,0x48,0x60,0xcd,0x3,0xaf,
+    0x6,0x2a,0x0,0x2,0xfe,0x2d,0x4,0xa4,0xfb,0xb,0x20,0x25,0xe0,0x4,0x1c,0x9f,
+    0x1,0x2d,0x6,0x20,0xd1,0x5,0x69,0x2,0xf5,0x3,0x25,0x10,0xdd,0x91,0x6f,0x0,
+    0x8,0x28,0x12,0x23,0x8,0xe,0xd1,0xfd,0xe8,0x9b,0x0,0x9,0xd1,0x68,0x69,0x20,
+    0x61,0xe7,0x2,0x23,0x2e,0xcf,0x0,0x23,0x2,0x8a,0xfb,0x9,0x7a,0x3b,0x1,0x6,
+    0x3d,0x0,0x31,0xbd,0x70,0x47,0xc5,0x6,0x7f,0x30,0x35,0xa8,0x7e,0x0,0x28,0x1d,
+    0x39,0x1,0xfb,0x29,0x68,0xd9,0x7,0x12,0xd0,0x29,0x7a,0x20,0xfe,0xd9,0x5,0x68,
+    0x7a,0xe8,0x75,0x1,0x20,0xa8,0xd5,0x76,0xd9,0x3,0x23,0xd9,0x1,0x22,0xd9,0x1,
+    0xe9,0x7d,0xb2,0x49,0x2,0x5a,0x6d,0x0,0xe1,0xb,0x67,0xfc,0xb,0x0,0x0,0xff,
+    0x10,0xb5,0x1,0x0,0x54,0x31,0x2,0x0,0xff,0x14,0x32,0x13,0x68,0xb,0x60,0x3d,
+    0x30,0xff,0x3,0x78,0xab,0x24,0x1c,0x40,0x9,0x2c,0xff,0xf,0xd1,0xc3,0x78,0x1b,
+    0x2,0x84,0x78,0xff,0x23,0x43,0x8b,0x80,0x43,0x79,0x1b,0x2,0x7f,0x4,0x79,0x23,
+    0x43,0xcb,0x80,0xc3,0x9,0x0,0xff,0x80,0x79,0x3,0x43,0xb,0x81,0x3,0xe0,0xff,
+    0x5,0x48,0x88,0x80,0xc8,0x80,0x8,0x81,0x77,0x12,0x79,0x7,0x4d,0x0,0x40,0xfc,
+    0x10,0x4d,0x0,0xbe,0x0,0x0,0x80,0xff,0xff,0x10,0x10,0x57,0x0,0x11,0x96,0x3,
+    0x6,0x14,0x80,0x3,0x0,0x1,0x3,0x0,0x13,0x0,0x1,0xff,0x20,0x77,0x49,0x9,
+    0x68,0x88,0x40,0x76,0xff,0x49,0x1d,0x22,0x42,0x43,0xa,0x80,0x31,0xfe,0x5,0x0,
+    0x4a,0x80,0x2,0x1,0x12,0x18,0x92,0xef,0x0,0x8a,0x80,0x75,0xd,0x0,0xca,0x80,
+    0xc4,0xff,0x22,0x50,0x43,0x8,0x81,0x70,0x47,0x10,0xef,0xb5,0x0,0xbf,0x4,0xb1,
+    0x0,0xc9,0xfa,0x0,0xff,0xbf,0x8,0xa1,0x20,0x0,0x30,0x30,0x7,0xff,0xf0,0xff,
+    0xfb,0x69,0x48,0x1,0x0,0x8,0xff,0x31,0x21,0x60,0x60,0x30,0x20,0x63,0x0,0xbf,
+    0x20,0x3c,0x21,0x60,0x54,0x6c,0x3,0x0,0x20,0xff,0x0,0x10,0xbd,0x2,0x1,0x1d,
+    0x1e,0x0,0xf7,0x0,0xf,0x3f,0x82,0x2,0x2,0x7e,0x91,0x42,0x7f,0x0,0xd0,0x0,
+    0x20,0x70,0x47,0x1,0x73,0x0,0xff,0x9,0x7e,0x88,0x40,0x80,0xb2,0x70,0x47,0xf7,
+    0x0,0x0,0xf8,0x39,0x1,0xf,0x0,0x16,0x0,0xff,0x6,0x20,0x3c,0x22,0xa0,0x54,
+    0x21,0x0,0x7f,0x3c,0x31,0x48,0x70,0x22,0x0,0x0,0x63,0x1,0xff,0x48,0x30,0x4,
+    0xf0,0x76,0xfd,0x0,0x20,0x7e,0x13,0x4,0x60,0x6,0x22,0x0,0xbf,0x36,0x73,0x0,
+    0xff,0x81,0x30,0xe5,0xf7,0x6b,0xfd,0x6,0x22,0xf5,0x35,0xb,0x0,0x8c,0xb,0x0,
+    0x79,0xfd,0x25,0x0,0xff,0x6e,0x35,0x25,0x20,0x68,0x74,0x10,0x20,0xff,0xa8,0x74,
+    0xa7,0x20,0x28,0x71,0xdf,0x20,0xff,0xe8,0x73,0x20,0x0,0x88,0x30,0x21,0x0,0xff,
+    0x81,0x31,0x1,0x60,0x0,0x2e,0x1,0xd1,0xff,0x3,0x21,0x4,0xe0,0xf,0x36,0xf1,
+    0x10,0xff,0x9,0xf,0x89,0x19,0x9,0x11,0x41,0x71,0xff,0xa7,0x81,0x5,0x23,0x3a,
+    0x4a,0x21,0x0,0xff,0xc,0x31,0x20,0x0,0x7,0xf0,0x17,0xfc,0xff,0x7,0x0,0x39,
+    0x4e,0xf0,0x19,0x40,0x78,0xf7,0x21,0x0,0x5d,0x7d,0x0,0x0,0xbf,0x20,0xa0,0xff,
+    0x79,0x0,0x40,0x18,0x40,0x88,0xa0,0x81,0xff,0xfa,0x21,0x89,0x0,0xe5,0xf7,0xb,
+    0xff,0xff,0x1,0x21,0x2d,0x4a,0x12,0x68,0x91,0x40,0xbf,0x48,0x43,0x2f,0x49,0x48,
+    0x43,0x15,0x6,0x3,0xbf,0xff,0x28,0x80,0x0,0xbf,0x18,0x2b,0x8,0x68,0xff,0x80,
+    0x7f,0x1c,0x5d,0x20,0x27,0x54,0x29,0xff,0x7e,0xc7,0x20,0x8,0x40,0xff,0xb2,0xf1,
+    0xff,0x5d,0xc9,0x0,0x38,0x22,0xa,0x40,0x2,0xef,0x43,0x2a,0x76,0x2,0x15,0x5,
+    0x2,0x23,0x22,0xdf,0x0,0x7f,0x32,0x69,0x7c,0xf3,0x3,0x6b,0xfa,0xff,0x1,0x21,
+    0xc,0x34,0x20,0x7b,0x7,0xf0,0xdf,0x93,0xfa,0x0,0x20,0xf2,0xa5,0x1,0x20,0x8,
+    0x57,0x0,0x0,0x40,0x27,0x1,0x57,0x3,0x0,0x3,0x9b,0x1,0xff,0x80,0x3e,0xd0,
+    0x7,0xa0,0xf,0x70,0x17,0x3f,0x40,0x1f,0x80,0x3e,0x2,0x0,0x33,0x1,0x1,0x4,
+    0xff,0x2,0x0,0x6c,0x30,0x2,0x78,0x0,0x2a,0xff,0x1,0xd0,0x10,0xa2,0x0,0xe0,
+    0x19,0xa2,0xff,0xa,0x60,0x1,0x22,0xa,0x71,0xb,0x4b,0xff,0x8b,0x60,0xe6,0x23,
+    0xcb,0x80,0x43,0x88,0xff,0xcb,0x60,0x80,0x88,0x8,0x61,0x8,0x48,0xef,0x48,0x61,
+    0x8a,0x61,0x6b,0x3,0x0,0x0,0x74,0xff,0x4d,0x3,0x0,0x78,0x49,0x0,0x20,0xcc,
+    0xff,0x44,0x3,0x0,0x44,0x6d,0x2,0x0,0x4e,0xff,0x26,0x0,0x0,0xc4,0x9,0x0,
+    0x0,0xff,0xff,0x7f,0x0,0x0,0x53,0x54,0x4d,0x69,0x63,0xff,0x72,0x6f,0x65,0x6c,
+    0x65,0x63,0x74,0x72,0xff,0x6f,0x6e,0x69,0x63,0x73,0x20,0x4c,0x53,0xff,0x4d,0x33,
+    0x33,0x30,0x20,0x41,0x63,0x63,0xfe,0x15,0x0,0x72,0x6f,0x6d,0x65,0x74,0x65,0x72,
+    0x7e,0x27,0x24,0x49,0x53,0x33,0x44,0x53,0x48,0x28,0x18,0xfa,0x0,0x0,0x38,0xcf,
+    0x1,0x25,0x0,0x30,0x35,0x28,0xff,0x0,0x29,0x68,0xc9,0x68,0x88,0x47,0x0,0xff,
+    0x28,0x14,0xd0,0x29,0x7a,0x20,0x0,0x29,0xff,0x30,0x1,0x70,0x68,0x7a,0x80,0x21,
+    0x1,0xff,0x43,0x7a,0x20,0x21,0x54,0x1,0x20,0x28,0xff,0x73,0x3,0x20,0x0,0x90,
+    0x23,0x0,0x7a,0xdf,0x33,0x22,0x0,0x7a,0x32,0x13,0x3,0xd6,0xf9,0xff,0x31,0xbd,
+    0x0,0x22,0x0,0x21,0xa,0x20,0xcf,0xf1,0xf7,0xe3,0xfa,0xb,0x0,0x4b,0x4,0xd,
+    0x0,0xff,0x28,0x68,0x1,0x28,0xf,0xdb,0x0,0x90,0xbf,0x9,0x23,0x7,0xa2,0x69,
+    0x46,0xb1,0x3,0xf5,0xff,0xfe,0x0,0x99,0x29,0x60,0x41,0x1c,0x5c,0xff,0x34,0x21,
+    0x70,0x0,0x28,0x1,0xd5,0x4,0xef,0x20,0x32,0xbd,0x0,0x3,0x2,0xe2,0x4,0x0,
+    0xff,0x0,0x71,0x2,0x0,0x80,0x38,0x1,0x0,0xfb,0x40,0x9c,0x53,0x1,0x4e,0x0,
+    0x0,0x10,0x27,0xec,0xef,0x6,0x1a,0x8,0x0,0x70,0x53,0x0,0xe,0x0,0x35,0xbf,
+    0x68,0x22,0x68,0xd2,0x69,0x90,0x9d,0x0,0x2e,0xff,0xd1,0x30,0x68,0x85,0x42,0x1,
+    0xd0,0x5,0x7f,0x20,0x70,0xbd,0x25,0x0,0x3c,0x35,0x4f,0x0,0xff,0xd1,0x6,0x20,
+    0x1,0xe0,0x2,0xd5,0xd,0xff,0x20,0x68,0x70,0x6,0xe0,0xb,0x21,0x69,0xfd,0x70,
+    0xef,0x7,0x8,0xfe,0xa8,0x60,0x28,0x78,0xff,0x6,0x28,0xc,0xd1,0x68,0x78,0xb,
+    0x28,0xff,0x3,0xd1,0x20,0x0,0x0,0xf0,0x50,0xf9,0xdf,0xd,0xe0,0xd,0x28,0xb,
+    0xb,0x4,0x94,0xf9,0xf5,0x7,0xb,0x0,0x5,0x1d,0x0,0xd,0x28,0x2,0xd0,0xe6,
+    0x11,0x2,0x6e,0xf9,0x83,0x1,0xc7,0x0,0x70,0xb5,0x82,0xff,0xb0,0x4,0x0,0x26,
+    0x0,0x18,0x36,0x30,0xff,0x78,0x98,0x42,0x0,0xd0,0xd9,0xe0,0x25,0xff,0x0,0x38,
+    0x35,0x29,0x79,0x49,0x1e,0xe,0xff,0x29,0x0,0xd9,0xce,0xe0,0x1,0xa2,0x52,0xff,
+    0x5c,0x52,0x0,0x97,0x44,0x7,0x52,0x5d,0xff,0x66,0x6e,0xca,0xaa,0x71,0xca,0x7c,
+    0xca,0xff,0xba,0xca,0xc1,0x95,0x0,0x20,0x0,0x2d,0xff,0x30,0x0,0x78,0x0,0x28,
+    0x13,0xd1,0x21,0xff,0x0,0x7b,0x31,0x20,0x0,0x30,0x30,0xb2,0xf7,0x69,0x92,0x68,
+    0xb5,0x2,0xa,0xd0,0x0,0x26,0xff,0x21,0x0,0x5c,0x31,0xe,0x74,0x0,0x22,0xfb,
+    0x21,0x0,0x31,0x3,0x4a,0xfa,0x2e,0x71,0x73,0xf5,0xbd,0x31,0xa,0xd,0x91,0x0,
+    0x5c,0x30,0xc1,0x7f,0x7f,0x40,0x29,0x8,0xd1,0x1,0x21,0x1,0x25,0xc,0xbf,0x37,
+    0xfa,0x0,0x20,0x94,0xe0,0x49,0x2,0xb1,0x3d,0x69,0x9d,0x7,0x10,0xd0,0x29,0x78,
+    0x9d,0x7,0x8f,0x17,0xef,0x5c,0x30,0x81,0x7f,0x95,0x3,0xb,0xf9,0x73,0xfa,0x95,
+    0xd,0x18,0x3d,0x0,0x75,0xe0,0x6,0x23,0x22,0xbb,0x0,0x8c,0x21,0x0,0x82,0x30,
+    0x81,0xd7,0x1,0xf7,0xff,0xf7,0x5,0xf9,0x3,0x20,0x6a,0xe0,0x3,0x7f,0x23,0x0,
+    0xbf,0xb9,0xa2,0x40,0x21,0x11,0x2,0xff,0xfc,0xf8,0x4,0x20,0x61,0xe0,0x5,0x23,
+    0xf7,0xb6,0xa2,0x1b,0xf,0x4,0xf4,0xf8,0x5,0x20,0xff,0x59,0xe0,0x6,0x20,0x68,
+    0x71,0x2f,0xe0,0xff,0x7,0xf0,0xfa,0xf8,0x1,0x21,0x30,0x78,0xe7,0x7,0xf0,0xfe,
+    0x25,0x0,0xc3,0x2,0xc8,0x70,0xe,0xbf,0xe0,0x68,0x79,0xb,0x28,0x21,0xb3,0x6,
+    0x78,0xf7,0x0,0x29,0x4,0x4f,0x5,0xd,0xf9,0xb,0x20,0xff,0x3e,0xe0,0x49,0x1e,
+    0xc1,0x70,0x9,0x20,0xff,0x28,0x71,0x0,0x22,0xff,0x21,0x14,0x31,0xff,0x48,0x34,
+    0x20,0x0,0x4,0xf0,0x72,0xfb,0xfb,0x73,0xbd,0x31,0x2,0x8,0xd1,0x82,0x20,0x20,
+    0xff,0x5c,0x0,0x9,0x9e,0xa1,0x5c,0x22,0xa2,0xbf,0x5c,0x89,0x5c,0x88,0x42,0x3,
+    0x77,0x5,0xb2,0xfd,0xf8,0x9,0x3,0x0,0xf0,0xec,0xf8,0xb,0x20,0x7d,0x1d,0x5b,
+    0x0,0x6,0x28,0x1a,0xd0,0xb,0x93,0x1,0xaf,0xd,0x28,0x4,0xd0,0x19,0x6,0x74,
+    0x21,0x8,0xba,0xee,0x7,0x0,0x7,0xf0,0xb1,0x91,0x8,0xb5,0xf8,0x5,0xdc,0x2d,
+    0x0,0xbd,0xb,0x8f,0xf8,0xd,0x77,0x0,0x73,0xbd,0xff,0x1,0x21,0x9,0x20,0xf6,
+    0xf7,0x2f,0xfc,0xf7,0x73,0xbd,0x10,0xc7,0x5,0x14,0x30,0x1,0x79,0xff,0x99,0x42,
+    0x33,0xd1,0x3c,0x21,0x61,0x5c,0xbf,0x9,0x29,0x11,0xd0,0xb,0x29,0x59,0x0,0x29,
+    0xff,0x18,0xd0,0x13,0xbd,0x11,0x68,0x1,0x60,0xdf,0x22,0x0,0x72,0x32,0x8,0x49,
+    0x1,0x13,0x0,0xfd,0x11,0x57,0x1,0xf7,0xf7,0x6b,0xf8,0xf,0x20,0xfb,0x1b,0xe0,
+    0x15,0x1a,0x60,0xf8,0xa,0x20,0x10,0x75,0xe0,0x57,0x3,0x8,0x57,0x1,0x6c,0xf9,
+    0x2,0x7b,0x5,0xff,0x7d,0x33,0x0,0x22,0x20,0x0,0x72,0x30,0xfd,0xc1,0x57,0x5,
+    0x4e,0xf8,0xe,0x20,0x3c,0x34,0x7f,0x20,0x70,0x13,0xbd,0x3c,0x21,0x41,0x69,0x0,
+    0xff,0x0,0xd0,0x70,0x47,0x80,0xb5,0xa,0x21,0xff,0x3c,0x22,0x81,0x54,0x1,0x0,
+    0x5f,0x31,0xff,0xa,0x78,0x4,0x2a,0x1,0xda,0x52,0x1c,0xff,0xa,0x70,0x8,0x22,
+    0x0,0x92,0x3,0x0,0xf7,0x72,0x33,0x2,0x65,0x0,0xc9,0x7c,0xf7,0xf7,0xff,0x31,
+    0xf8,0x1,0xbd,0x45,0xa0,0x70,0x47,0xff,0x44,0x20,0x70,0x47,0x38,0xb5,0x4,0x0,
+    0xff,0x3c,0x34,0x61,0x78,0xb,0x29,0x25,0xd1,0xdf,0x2,0x0,0x81,0x32,0x1,0x71,
+    0x1,0x52,0xa3,0xff,0xd,0x78,0x5b,0x5d,0x1b,0x1,0xf,0x25,0x7f,0x1d,0x43,0x55,
+    0x70,0x13,0x79,0xa8,0x7,0x0,0xff,0x15,0x71,0x53,0x79,0x9b,0x6,0x9b,0xe,0xfd,
+    0x80,0x13,0x2,0x71,0xc7,0x23,0x2b,0x40,0x0,0xff,0xbf,0x4b,0xa5,0x49,0x78,0x69,
+    0x5c,0xc9,0xdf,0x0,0x38,0x25,0xd,0x40,0x15,0x2,0x6,0x23,0xff,0x11,0x78,0xf7,
+    0xf7,0xd,0xf8,0x8,0x20,0xf7,0x20,0x70,0x31,0xd,0x1,0x4,0x0,0x82,0x30,0xff,
+    0x1,0x78,0x9,0x22,0xa,0x40,0x2,0x70,0xff,0xfe,0x21,0x42,0x78,0xa,0x40,0x42,
+    0x70,0xff,0x82,0x78,0x11,0x40,0x81,0x70,0xc1,0x78,0xfd,0x77,0x15,0x0,0xc2,0x70,
+    0x88,0x20,0x22,0x58,0xfd,0x5,0x35,0x0,0x20,0x0,0xf6,0xf7,0xf1,0xff,0xf5,0x7,
+    0xcf,0x4,0x10,0x39,0x4,0x0,0x21,0x20,0x7e,0xdf,0x6,0xf0,0xfc,0xff,0x22,0x93,
+    0x0,0x5f,0x20,0xff,0x50,0x70,0x90,0x78,0x1,0x21,0x1,0x43,0xdf,0x91,0x70,0x10,
+    0x79,0x6c,0x7,0x0,0x11,0x71,0xff,0x50,0x79,0xc7,0x21,0x1,0x40,0xc0,0x20,0xe7,
+    0x8,0x43,0x50,0x77,0x4,0x41,0x2,0xd0,0xff,0xc,0xfe,0x41,0xc,0x1,0x0,0x14,
+    0x31,0xa,0x68,0xca,0xff,0x64,0x2,0x0,0x64,0x32,0x53,0x7c,0x1b,0xff,0x2,0x14,
+    0x7c,0x23,0x43,0x13,0x80,0xd3,0x7a,0x9,0x0,0x94,0x9,0x0,0x53,0x80,0x53,0x7d,
+    0x13,0x0,0xff,0x7d,0x23,0x43,0x93,0x80,0xa,0x79,0x60,0xef,0x30,0x1,0x0,0x7,
+    0x67,0x1,0xb8,0xf8,0x10,0xff,0xbd,0x44,0x0,0xd,0x0,0x1,0x14,0x64,0xff,0x44,
+    0xdd,0x55,0x22,0xaa,0xb6,0x9c,0x0,0xbc,0x0,0x14,0xf,0x22,0x7e,0x98,0xf7,0x4,
+    0x3,0xa,0x30,0xff,0x3a,0x5a,0x4e,0x12,0xbc,0x29,0xb4,0x40,0xff,0x5,0x11,0x0,
+    0x1b,0x35,0x7f,0x7f,0x35,0xfe,0x23,0x0,0x9,0x1,0x2,0x3,0x4,0x5,0x6,0x7f,
+    0x7,0x8,0x9,0x0,0x0,0x4,0x0,0xc,0x2,0xff,0x0,0x0,0xf0,0xb5,0x1,0x24,
+    0xba,0x48,0xff,0x0,0x68,0x1,0x26,0x86,0x40,0xb9,0x4d,0xff,0xfa,0x27,0xbf,0x0,
+    0xb9,0x48,0x70,0x43,0xff,0x39,0x0,0xe5,0xf7,0xe9,0xfb,0xa8,0x81,0x7d,0xb7,0xb,
+    0x8,0xe3,0xfb,0xe8,0x81,0xb5,0xb,0x8,0xff,0xdd,0xfb,0x28,0x82,0xb3,0x48,0x46,
+    0x43,0xfb,0x30,0x0,0xd,0x2,0xd6,0xfb,0x68,0x82,0xb0,0xfe,0x3f,0x0,0x84,0x40,
+    0xb0,0x4e,0xb0,0x48,0x60,0xfb,0x43,0x31,0x13,0x0,0xcc,0xfb,0x28,0x80,0xae,0xbe,
+    0xb,0x8,0xc6,0xfb,0x68,0x80,0xac,0xb,0x8,0xc0,0xef,0xfb,0xa8,0x80,0xaa,0xb,
+    0x8,0xba,0xfb,0xe8,0x7f,0x80,0xa8,0x48,0x44,0x43,0x20,0x0,0xd,0x2,0xbf,0xb3,
+    0xfb,0x28,0x81,0xf0,0xbd,0xff,0x3,0x15,0xff,0x0,0x7,0xf0,0xb,0xf8,0x0,0xbf,
+    0x18,0xff,0xa1,0x20,0x0,0x30,0x30,0x7,0xf0,0x25,0xff,0xf8,0xa0,0x48,0x1,0x0,
+    0x8,0x31,0x21,0xff,0x60,0x78,0x30,0x20,0x63,0x20,0x0,0x3c,0x7f,0x30,0x0,0x21,
+    0x1,0x70,0x41,0x70,0xb7,0x1,0xff,0x70,0x41,0x60,0x81,0x86,0xc1,0x86,0x22,0xbf,
+    0x0,0x29,0x0,0x20,0x0,0x90,0x2b,0x0,0x41,0xff,0xf8,0x3,0x21,0x20,0x0,0x78,
+    0x30,0xe5,0xd7,0xf7,0xa0,0xf9,0x9,0x2,0x7e,0x9,0x0,0x99,0xf9,0xa7,0x20,0x0,
+    0x76,0x33,0x8,0x13,0x2,0x7b,0x13,0x0,0x8f,0xfe,0x13,0x0,0x32,0xbd,0x0,0x0,
+    0x2,0x1,0x6a,0xdf,0x6b,0x0,0x0,0xf,0x69,0x3f,0x3,0x2,0x7e,0xff,0x91,0x42,
+    0x6,0xd0,0xa8,0x22,0x82,0x5c,0xff,0x91,0x42,0x1,0xd1,0x90,0x30,0x70,0x47,0xff,
+    0x0,0x20,0x70,0x47,0x1,0x0,0x1,0x20,0xff,0xa,0x7e,0x1,0x23,0x93,0x40,0xa8,
+    0x31,0xff,0x9,0x78,0x88,0x40,0x18,0x43,0x80,0xb2,0xfb,0x70,0x47,0xa7,0x2,0x25,
+    0x0,0x30,0x35,0x28,0xff,0x0,0x29,0x68,0xc9,0x68,0x88,0x47,0x0,0xff,0x28,0x11,
+    0xd0,0x2,0x20,0x28,0x73,0x29,0xff,0x7a,0x20,0x0,0x29,0x30,0x1,0x70,0x23,0xff,
+    0x0,0x81,0x33,0xf,0x20,0x18,0x70,0x2,0xee,0x96,0x0,0x0,0x22,0xf,0x75,0x0,
+    0xf6,0xf7,0xbd,0xff,0xfe,0x31,0xbd,0x0,0x22,0x0,0x21,0xa,0xff,0x20,0xf0,0xf7,
+    0xca,0xff,0x31,0xbd,0xf8,0xfe,0x43,0x0,0x26,0x0,0x3c,0x36,0xb1,0x86,0x5,0xff,
+    0x23,0x5b,0x4a,0x21,0x0,0x70,0x31,0x7,0xff,0xf0,0x28,0xf8,0x47,0xb2,0x0,0x2f,
+    0x0,0xff,0xd5,0x5,0x27,0xb0,0x8e,0x40,0x0,0x3,0xff,0x21,0xe5,0xf7,0x24,0xfb,
+    0xb0,0x86,0x25,0xff,0x0,0x74,0x35,0x0,0xbf,0xb,0xa0,0xc0,0xff,0x5d,0x28,0x70,
+    0x1,0x21,0x20,0x7e,0x6,0xff,0xf0,0xcf,0xfe,0x30,0x78,0x4,0x28,0x9,0xff,0xd1,
+    0x6,0x20,0x30,0x70,0x2,0x23,0x22,0xdf,0x0,0x76,0x32,0xa9,0x78,0x63,0x2,0x96,
+    0xfe,0xf7,0x1,0xe0,0x5,0x13,0x0,0x0,0x20,0xf2,0xbd,0x9f,0x2,0x0,0x4,0x8,
+    0xc,0xd7,0x0,0x67,0x2,0xa8,0xff,0x20,0x20,0x5c,0x81,0x42,0x4f,0xd1,0x0,0x7d,
+    0x26,0x3f,0x3,0xc2,0x86,0x4,0x23,0xcb,0x71,0x0,0xff,0x72,0x31,0x20,0x0,0x6,
+    0xf0,0xee,0xff,0xff,0x45,0xb2,0x0,0x2d,0x0,0xd5,0x4,0x25,0xfa,0x1b,0x2,0xc0,
+    0x77,0x8,0xe8,0xfa,0x21,0x0,0x3c,0xff,0x31,0xc8,0x86,0x27,0x0,0x75,0x37,0x0,
+    0xff,0xbf,0x1b,0xa0,0x40,0x5d,0x38,0x70,0x68,0xff,0x46,0x0,0x78,0x0,0x28,0x1,
+    0xd1,0x2,0xd7,0x25,0x8,0xe0,0xb,0x2,0x1f,0x27,0x0,0xd4,0xfa,0xff,0xc5,0xb2,
+    0x40,0x2d,0x0,0xdb,0x3f,0x25,0xf7,0x22,0x0,0x0,0xe7,0x0,0x5c,0x30,0x4,0xf0,
+    0xff,0xf2,0xf8,0x10,0x20,0xf8,0x70,0xd,0x20,0xff,0x78,0x72,0x5b,0x20,0x78,0x70,
+    0xbd,0x70,0xdf,0x5e,0x20,0xb8,0x71,0x3c,0x81,0x0,0x5,0x28,0xbd,0xa,0xb1,0x0,
+    0x3c,0x21,0x60,0x54,0xb3,0x6,0x79,0xfe,0xb3,0x4,0x3c,0xfe,0x4,0xe0,0x4,0x20,
+    0x3c,0xff,0x34,0x20,0x70,0x0,0xe0,0x6,0x26,0x30,0xfb,0x0,0xf2,0x97,0x1,0x0,
+    0x8,0xc,0x4,0xf8,0xf7,0xb5,0x7,0x0,0xbf,0x0,0x25,0x0,0x26,0x21,0xff,0x68,
+    0x0,0x29,0x1f,0xd4,0x62,0x68,0xf6,0xff,0xf7,0x41,0xfe,0x0,0x90,0x1,0x28,0x1a,
+    0xff,0xdb,0x6,0x23,0x0,0xbf,0xba,0xa2,0x69,0xff,0x46,0x38,0x0,0x7,0xf0,0x45,
+    0xfb,0x0,0x7f,0x28,0x2,0xd5,0x4,0x26,0xac,0x48,0x6b,0x1,0xff,0x98,0x20,0x60,
+    0x60,0x68,0x0,0x28,0x3,0xff,0xd5,0x0,0x98,0x41,0x42,0x61,0x60,0x5,0xff,0xe0,
+    0x1,0x28,0x2,0xdb,0x0,0x98,0x60,0xdf,0x60,0x0,0xe0,0x65,0x60,0x5b,0x6,0x74,
+    0x4d,0xff,0x3,0x0,0xe8,0x48,0x0,0x20,0xea,0x72,0xff,0x0,0x0,0xd4,0xe5,0x0,
+    0x0,0xa8,0xcb,0x7f,0x1,0x0,0x50,0x97,0x3,0x0,0x78,0x17,0x0,0xbf,0x50,0x46,
+    0x0,0x0,0xea,0xe2,0x17,0x0,0xc5,0xf7,0x1,0x0,0xec,0x13,0x0,0xd8,0x2f,0x7,
+    0x0,0xff,0xb0,0x5f,0xe,0x0,0x4,0x3b,0x3,0x0,0xef,0xf1,0xb5,0x82,0xb0,0x8f,
+    0x0,0x27,0x69,0x46,0xff,0xf,0x71,0x2,0x9d,0x3c,0x35,0x1,0x20,0xff,0xa8,0x70,
+    0xef,0x70,0x2,0x9e,0x74,0x36,0xfd,0x20,0x71,0x0,0xc,0xd5,0x77,0x71,0xb7,0x71,
+    0xff,0x20,0x68,0x68,0x60,0x70,0x79,0x10,0x21,0x7f,0x1,0x43,0x71,0x71,0xe8,0x78,
+    0x8,0x7,0x0,0xff,0xe9,0x70,0x3e,0xe0,0x70,0x78,0x70,0x71,0xff,0x30,0x78,0xb0,
+    0x71,0x62,0x68,0x21,0x68,0xbf,0x2,0x98,0xf6,0xf7,0xde,0xfd,0xc5,0x2,0x34,0xfa,
+    0xc5,0x0,0x89,0xc3,0x0,0x2,0x98,0x7,0xf0,0xe3,0xff,0xfa,0x0,0x28,0x5,0xd5,
+    0x4,0x20,0x69,0xff,0x46,0x8,0x71,0x5,0x20,0x7a,0x49,0x0,0xff,0x91,0x0,0x99,
+    0x21,0x60,0x0,0x99,0x69,0xff,0x60,0xe9,0x78,0x1,0x22,0xa,0x43,0xea,0xff,0x70,
+    0x0,0xbf,0x1c,0xa1,0x8,0x5c,0x71,0xd5,0x79,0x59,0x2,0x61,0xf,0x1,0x7,0xe1,
+    0x8,0xe8,0x78,0xfd,0x4,0x65,0x4,0xe,0xe0,0x1,0x29,0x9,0xdb,0xd7,0x0,0x99,
+    0x61,0x31,0x0,0x2,0x31,0x4,0xb1,0x79,0x7f,0x8,0x43,0xb0,0x71,0x2,0xe0,0x67,
+    0xfb,0x0,0xff,0x6f,0x60,0x68,0x78,0xe9,0x78,0x88,0x42,0xff,0x8,0xd1,0x2,0x98,
+    0x0,0x69,0x69,0x68,0xdf,0x88,0x42,0x3,0xd1,0xaf,0xbd,0x0,0x6f,0x60,0xff,0x9,
+    0xe0,0x28,0x78,0xc,0x28,0x1,0xd0,0xff,0xe,0x28,0x4,0xd1,0x8,0x20,0x28,0x70,
+    0xee,0x1f,0x0,0xf0,0xc5,0xf9,0xdd,0x1,0x79,0x3,0xb0,0xff,0xf0,0xbd,0x10,0x20,
+    0x30,0x40,0x50,0x60,0xfe,0x8f,0x1,0xa0,0x70,0x47,0x5c,0x0,0x11,0x0,0xff,0x57,
+    0x5b,0xca,0xca,0xdd,0x55,0x22,0xaa,0xc7,0x9e,0x8,0x28,0x14,0x0,0x0,0xe,0xf,
+    0x30,0x4,0xa4,0x7f,0x70,0x3d,0x3a,0xbc,0x9d,0x38,0x0,0x3,0xa,0xff,0x4e,0x9c,
+    0x10,0x50,0x29,0x5c,0x8f,0x2,0xfe,0x1b,0x0,0x40,0xb1,0x13,0x3b,0x1,0x96,0xde,
+    0xff,0xc7,0xb7,0xa8,0x30,0x0,0x78,0x81,0x42,0xf7,0x1,0xd1,0x1,0x67,0x0,0x0,
+    0x20,0x70,0x47,0xff,0x44,0x0,0xd,0x0,0x99,0x96,0xbe,0xac,0xd6,0x6b,0x2,0xd2,
+    0x9c,0x5a,0x14,0x0,0xf,0x22,0x1e,0x37,0xfb,0x47,0x1,0x3,0xa,0xfb,0x8d,0x68,
+    0x4e,0x7b,0x4f,0x9,0xd2,0x56,0x5c,0x47,0x0,0x57,0xa,0x44,0xb,0x0,0xde,0x57,
+    0x2,0x70,0xb5,0x6,0x0,0xc3,0x1,0xbf,0x24,0xff,0xa0,0x20,0x60,0x1,0x25,0x25,
+    0x71,0x6,0xff,0x22,0x0,0xbf,0x28,0xa1,0x30,0x0,0xf6,0xff,0xf7,0x4b,0xfd,0xa0,
+    0x60,0x1d,0x48,0xe0,0xff,0x80,0x70,0x36,0x30,0x88,0xe0,0x60,0xc0,0xff,0xb,0x20,
+    0x61,0x1a,0x48,0x60,0x61,0xa5,0x7d,0x61,0x35,0x0,0xbd,0x0,0x0,0xf4,0x48,0x7,
+    0x0,0xff,0xb5,0x5,0x0,0x14,0x0,0x28,0x7e,0x81,0xff,0x42,0x5,0xd1,0x21,0x0,
+    0x28,0x0,0x2a,0xff,0x68,0xd2,0x6a,0x90,0x47,0x70,0xbd,0xa8,0xb7,0x20,0x28,0x5c,
+    0x63,0x0,0xd0,0x7,0x29,0x0,0xe,0x76,0x57,0x2,0x26,0x26,0x57,0x4,0x12,0xa1,
+    0x28,0x57,0x0,0xfd,0x1f,0x57,0x0,0x47,0x20,0xe0,0x80,0x72,0x35,0xd5,0x28,0x57,
+    0x8,0x4,0x57,0x0,0xa6,0x57,0x8,0x63,0x9,0xff,0x0,0x0,0x99,0x3,0x0,0x0,
+    0xff,0x7f,0xff,0x0,0x0,0x53,0x54,0x4d,0x69,0x63,0x72,0xff,0x6f,0x65,0x6c,0x65,
+    0x63,0x74,0x72,0x6f,0xff,0x6e,0x69,0x63,0x73,0x20,0x4c,0x53,0x4d,0xff,0x36,0x44,
+    0x53,0x33,0x0,0x0,0x7b,0x2c,0xef,0x1,0x0,0x3d,0x96,0xe7,0x0,0x4b,0x0,0x0,
+    0xbf,0x8f,0x25,0x0,0x0,0xc7,0x12,0x3b,0x6,0x70,0xff,0xb5,0x82,0xb0,0x4,0x0,
+    0x26,0x0,0x18,0xff,0x36,0x30,0x78,0x83,0x42,0x0,0xd0,0xa9,0xff,0xe0,0x25,0x0,
+    0x38,0x35,0x29,0x79,0x89,0xff,0x1e,0xb,0x29,0x0,0xd9,0xa2,0xe0,0x1,0xff,0xa2,
+    0x52,0x5c,0x52,0x0,0x97,0x44,0x5,0xff,0x9e,0x9e,0x9e,0x36,0x8d,0x3c,0x4f,0x63,
+    0xbf,0x73,0x9e,0x87,0x20,0x0,0x2d,0x15,0x1,0x0,0xfb,0x28,0xd,0xc5,0x0,0x82,
+    0x31,0x20,0x0,0x30,0xff,0x30,0xb2,0x69,0x92,0x68,0x90,0x47,0x0,0xff,0x28,0x4,
+    0xd0,0x3,0x20,0x28,0x71,0x0,0xdf,0x22,0x21,0x0,0x19,0xe0,0x17,0x2,0xb1,0x69,
+    0xf7,0xc9,0x68,0x88,0x17,0x0,0xe,0xd0,0x29,0x78,0xff,0x20,0x0,0x29,0x30,0x1,
+    0x70,0xf,0x20,0xff,0x21,0x0,0x7b,0x31,0x88,0x71,0x2,0x20,0xff,0x0,0x90,0x23,
+    0x0,0x81,0x33,0x0,0x22,0xdf,0xf,0x21,0x40,0xe0,0x1,0x35,0x4,0x0,0x21,0xff,
+    0xa,0x20,0xf0,0xf7,0x5d,0xfd,0x73,0xbd,0xfd,0x7,0xf,0x0,0xa,0x23,0x9c,0xa2,
+    0x12,0x21,0xff,0x22,0xe0,0xa8,0x79,0x0,0x28,0x4f,0xd1,0xfd,0x9,0x11,0x0,0x20,
+    0x0,0x7b,0x30,0x69,0x79,0xef,0x9,0x7,0x1,0xd5,0x44,0x0,0xe0,0x0,0x21,0xff,
+    0x41,0x70,0x81,0x70,0x3,0x23,0x2,0x0,0x5f,0x1,0x78,0xf,0xe0,0xa,0x1f,0xc,
+    0xc9,0x1f,0x0,0xfd,0x1,0x1f,0x4,0x1,0x71,0x41,0x71,0x3,0x23,0xdf,0x22,0x0,
+    0x7e,0x32,0xc1,0x7d,0x0,0xf6,0xf7,0x9f,0x28,0xfc,0x73,0xbd,0xb,0x27,0x2,0x83,
+    0x8,0xf,0xd6,0x83,0xc,0x20,0x21,0x1f,0x2,0xd,0x1f,0x0,0xa9,0x79,0xff,0x0,
+    0x29,0x16,0xd1,0x6,0xf0,0x35,0xfc,0xdf,0x0,0x28,0x1d,0xd1,0xc,0x2d,0x0,0x30,
+    0x78,0xfd,0x69,0x13,0x0,0x3,0xd0,0x6,0xf0,0x15,0xfc,0x7f,0x1,0x21,0x30,0x78,
+    0x6,0xf0,0x19,0x27,0x0,0xbf,0x20,0x0,0x0,0xf0,0x7c,0xf8,0x9b,0x2,0x5,0xfb,
+    0xd0,0x8,0x7b,0x4,0x0,0xf0,0x4a,0xf8,0x73,0xb5,0xbd,0x1f,0x2,0x17,0x3b,0x0,
+    0x3,0xd0,0x11,0x2,0x54,0xfc,0x11,0x0,0x43,0x2,0x73,0xbd,0x10,0xb5,0x4,0x0,
+    0x7f,0x14,0x30,0x1,0x79,0x8b,0x42,0x1c,0x35,0x1,0xff,0x3c,0x31,0xb,0x78,0xc,
+    0x2b,0x17,0xd1,0xff,0x4b,0x78,0x1b,0x7,0xd,0xd5,0xe,0x20,0xeb,0x8,0x70,0xfd,
+    0x2,0x8,0xfd,0x0,0xde,0xfc,0x4d,0xff,0x22,0x4d,0x21,0x5c,0x34,0x20,0x0,0x3,
+    0xff,0xf0,0x76,0xfe,0x10,0xbd,0xd,0x23,0xb,0xdf,0x70,0x11,0x68,0x1,0x60,0x4d,
+    0x2,0x2d,0xf8,0xfd,0x10,0x47,0x4,0x3c,0x20,0x20,0x5c,0xe,0x28,0xff,0x11,0xd1,
+    0x20,0x7e,0x6,0xf0,0xe1,0xfb,0xdc,0x81,0x2,0x3d,0xa,0xbf,0xfc,0x10,0x6f,0x0,
+    0x3c,0x21,0x6b,0x60,0x54,0x41,0x6,0x66,0x41,0x0,0x80,0xb5,0xf9,0x1,0xff,0x31,
+    0x8a,0x78,0xa,0x70,0x2,0x6c,0x2,0xff,0x61,0x0,0x22,0x4a,0x70,0x8a,0x70,0x2,
+    0xfd,0x64,0x37,0x3,0x78,0x32,0x78,0x21,0x41,0x5c,0x5f,0xf6,0xf7,0x9c,0xfb,0x1,
+    0x25,0x0,0x3,0x9,0x1,0xdd,0x3d,0xf,0x0,0x89,0x7,0x6,0x5f,0x1,0x19,0x70,
+    0xef,0xf,0x21,0x0,0x91,0x19,0x3,0x5,0xe0,0x28,0xfa,0xd,0x0,0x7,0xd,0x4,
+    0x28,0x21,0xf6,0xf7,0x7a,0xea,0x2d,0x0,0xf8,0x85,0x0,0x3d,0x85,0x0,0x81,0x7,
+    0x32,0xff,0xd5,0x25,0x0,0x44,0x35,0x27,0x0,0x14,0xff,0x37,0x38,0x68,0x28,0x60,
+    0x26,0x0,0x82,0xff,0x36,0x70,0x7a,0x0,0x2,0x31,0x7a,0x8,0xaf,0x43,0xa8,0x80,
+    0xf0,0x9,0x0,0xb1,0x9,0x0,0xe8,0xf7,0x80,0x70,0x7b,0x13,0x0,0x7b,0x8,0x43,
+    0x28,0xff,0x81,0xa8,0x20,0x22,0x5c,0x29,0x0,0x7,0xfe,0xab,0x0,0x69,0xfc,0x38,
+    0x68,0xe8,0x60,0xf0,0x75,0x78,0x23,0x0,0x78,0x19,0x0,0x82,0x70,0x79,0x23,0x0,
+    0xbf,0x79,0x8,0x43,0x68,0x82,0xf0,0x9,0x0,0xb1,0xae,0x9,0x0,0xa8,0x82,0x70,
+    0x1d,0x0,0x31,0x1d,0x2,0xe0,0x7,0xc0,0x7,0x2d,0x69,0x1e,0x1d,0x8,0x69,0x0,
+    0x45,0x8,0x69,0x0,0xec,0x45,0x8,0x69,0x12,0x34,0xfc,0xab,0x2,0x40,0x7,0xc,
+    0xfd,0xd5,0x71,0x2,0x6,0x48,0x28,0x82,0x68,0x82,0xff,0xa8,0x82,0xe8,0x82,0x3a,
+    0x79,0x50,0x34,0xfd,0x21,0x21,0x4,0x23,0xfc,0xf1,0xbd,0x0,0x0,0x7f,0xff,0x7f,
+    0x0,0x0,0x12,0x44,0x0,0x0,0x2,0xff,0x38,0x38,0x8,0x0,0x0,0x10,0xb5,0x0,
+    0xff,0xbf,0x4,0x0,0xf6,0xf7,0xc9,0xfa,0x0,0xff,0xbf,0x9,0xa1,0x20,0x0,0x30,
+    0x30,0x6,0xff,0xf0,0xff,0xfb,0x68,0x48,0x1,0x0,0x8,0xff,0x31,0x21,0x60,0x60,
+    0x30,0x20,0x63,0x20,0xff,0x0,0x3c,0x30,0x1,0x21,0x1,0x70,0x0,0xef,0x21,0x41,
+    0x70,0x41,0xa3,0x1,0x10,0xbd,0x1,0xeb,0x1,0x30,0x3e,0x0,0x20,0x3d,0x0,0x0,
+    0x0,0x2,0xff,0x7e,0x91,0x42,0x0,0xd0,0x0,0x20,0x70,0xff,0x47,0x1,0x0,0x1,
+    0x20,0x9,0x7e,0x88,0xbf,0x40,0x80,0xb2,0x70,0x47,0x38,0x3b,0x1,0x25,0xff,0x0,
+    0x30,0x35,0x28,0x0,0x29,0x68,0xc9,0xff,0x68,0x88,0x47,0x0,0x28,0xf,0xd0,0x3,
+    0xff,0x20,0x28,0x73,0x29,0x7a,0x20,0x0,0x29,0xff,0x30,0x1,0x70,0x2,0x20,0x0,
+    0x90,0x23,0xd7,0x0,0x70,0x33,0x7b,0x3,0x20,0x7d,0x0,0xc2,0xfa,0xeb,0x31,0xbd,
+    0xdf,0x3,0xa,0xa7,0x0,0xcf,0xfb,0x31,0xfb,0xbd,0x10,0x3f,0x0,0x22,0x0,0x0,
+    0x21,0x58,0xff,0x30,0x3,0xf0,0x5e,0xfd,0x20,0x0,0x6c,0xeb,0x30,0x7,0x81,0x0,
+    0x10,0x81,0x0,0x8,0x21,0x81,0xff,0x70,0x1,0x21,0xc1,0x70,0x5,0x20,0x3c,0xff,
+    0x21,0x60,0x54,0x0,0x22,0x32,0x21,0x58,0xff,0x34,0x20,0x0,0x3,0xf0,0x52,0xfd,
+    0x0,0xbf,0x20,0x10,0xbd,0x70,0xb5,0xc,0x35,0x0,0x0,0xff,0x25,0xa0,0x68,0x1,
+    0x28,0x10,0xdb,0x37,0xff,0x49,0x88,0x42,0x2,0xda,0x8,0x0,0x4,0xef,0x25,0x3,
+    0xe0,0x35,0xb,0x0,0x0,0xdb,0x48,0xff,0x1e,0xfa,0x26,0xb6,0x0,0x31,0x0,0xe4,
+    0xff,0xf7,0xb,0xff,0x1,0x0,0x71,0x43,0xa1,0xff,0x60,0x28,0x0,0x70,0xbd,0x38,
+    0xb5,0x5,0xff,0x0,0xc,0x0,0x2a,0x68,0xd2,0x69,0x90,0xef,0x47,0xa1,0x68,0x28,
+    0xef,0x0,0x41,0x60,0x1,0xff,0x29,0x1,0xdb,0x13,0x22,0x0,0xe0,0x12,0xff,0x22,
+    0x42,0x70,0x2a,0x69,0x8a,0x42,0x3,0xfd,0xd1,0xff,0x6,0x7,0xe0,0x1,0x78,0x12,
+    0x29,0xf7,0x4,0xd1,0x11,0x8f,0x0,0x28,0x0,0x0,0xf0,0xdf,0xa1,0xf9,0x0,0x20,
+    0x32,0x57,0x1,0x0,0xa0,0xff,0x70,0x47,0x44,0x0,0xf,0x0,0x2e,0x78,0x3f,0x43,
+    0xdf,0xdd,0x55,0x22,0xaa,0x1f,0x1,0x64,0x5,0xfc,0x0,0xe,0xf,0x16,0x4c,0x8e,
+    0x2a,0x0,0x99,0x53,0xfd,0x67,0x3,0x4,0x30,0x69,0x89,0x0,0xff,0xff,0x7f,0xff,
+    0x7f,0x4,0x93,0xc8,0xf4,0x44,0x49,0x1,0xff,0xc,0xa0,0x8,0x60,0x1,0x20,0x8,
+    0x71,0xff,0x7,0x4a,0x8a,0x60,0xa3,0x22,0xca,0x80,0xff,0x96,0x22,0x52,0x2,0xca,
+    0x60,0x8,0x61,0xbf,0x5,0x4a,0x4a,0x61,0x88,0x61,0x6b,0x3,0x0,0xff,0x0,0xac,
+    0x45,0x3,0x0,0x10,0x27,0x0,0xef,0x0,0x41,0xd,0x3,0x3b,0x0,0x0,0x0,0x4d,
+    0xff,0x65,0x6d,0x73,0x69,0x63,0x20,0x4d,0x4d,0xff,0x43,0x33,0x35,0x32,0x34,0x30,
+    0x0,0xf8,0xfe,0x41,0x1,0x27,0x0,0x10,0x37,0x38,0x7a,0x83,0xfe,0x9f,0x1,0xd9,
+    0xe0,0x25,0x0,0x38,0x35,0x28,0xff,0x79,0xc0,0x1e,0x13,0x28,0x0,0xd9,0xd2,0xff,
+    0xe0,0x2,0xa1,0x9,0x5c,0x49,0x0,0x8f,0xff,0x44,0x0,0xbf,0xa,0xce,0xce,0x37,
+    0x3d,0xff,0x40,0x43,0x48,0x3d,0x55,0x58,0x5d,0x3d,0xff,0xb6,0x6d,0xce,0x92,0xce,
+    0x98,0xb3,0x20,0xff,0x0,0x2d,0x30,0x0,0x78,0x0,0x28,0xd,0xff,0xd1,0x21,0x0,
+    0x71,0x31,0x20,0x0,0x30,0xbf,0x30,0x3a,0x6a,0x92,0x68,0x90,0xc5,0x1,0x4,0xff,
+    0xd0,0x4,0x20,0x28,0x71,0x0,0x22,0x21,0xb7,0x0,0x15,0xe0,0x17,0x2,0x39,0x6a,
+    0xdd,0x7,0xa,0x77,0xd0,0x29,0x78,0xd9,0x1f,0x7f,0xe0,0x2,0x2d,0x4,0xbe,0xd7,
+    0x7,0xe3,0xfa,0xf1,0xbd,0x8,0xf,0x0,0x30,0xdb,0x20,0x6d,0xb9,0x1,0x89,0xe0,
+    0xbb,0x3,0x45,0xe0,0xdd,0x9,0x11,0x0,0x7d,0xe0,0xa,0x27,0x4,0xa,0x21,0xff,
+    0x3d,0xe0,0x26,0x0,0x6d,0x36,0xb0,0x7a,0xef,0xc0,0x7,0x1c,0xd5,0x2f,0x1,0xf0,
+    0xbe,0xf8,0xfd,0xc,0x19,0x0,0x50,0x20,0x30,0x70,0x71,0xe0,0x5d,0xd,0x9,0x0,
+    0x68,0xe0,0xe,0x29,0x8,0x28,0x29,0xc,0xdd,0x7,0x29,0x4,0xa9,0xf8,0x10,0x5b,
+    0x4,0x30,0x70,0xfd,0x5c,0x59,0x0,0xa,0x21,0x18,0xe0,0x38,0x68,0x9f,0x1,0x28,
+    0x1a,0xdb,0x13,0x15,0x0,0x29,0x2,0x30,0xff,0x78,0x1,0x21,0x1,0x43,0x31,0x70,
+    0x2,0xff,0x23,0x22,0x0,0x6c,0x32,0x7,0x21,0x20,0xff,0x0,0xf6,0xf7,0x92,0xf9,
+    0x38,0x68,0xfa,0xff,0x21,0x89,0x0,0xe4,0xf7,0x4,0xfe,0x2,0xff,0x0,0x1,0x0,
+    0x58,0x34,0x20,0x0,0x3,0x3f,0xf0,0x2d,0xfc,0xf1,0xbd,0x12,0x35,0x0,0xd,0x6,
+    0xb9,0x37,0xd,0x0,0x49,0x2,0x38,0xdb,0x14,0x13,0x0,0xf1,0xff,0xbd,0x20,0x0,
+    0x6d,0x30,0x0,0x79,0xc0,0xef,0x7,0xb,0xd5,0x16,0xf,0x0,0x4,0xf0,0x77,0xef,
+    0xfe,0x78,0x60,0x7,0xf3,0xc,0x0,0x21,0x5,0xf4,0xf3,0x0,0xd,0xa,0x6,0x65,
+    0x4,0x54,0xf9,0xf1,0xbd,0x7f,0x68,0x79,0x0,0x28,0x5,0xd0,0x11,0x31,0x0,0x9e,
+    0xab,0x2,0x87,0xf8,0xf1,0xbd,0x97,0x2,0xb,0x2,0x93,0xf5,0xf8,0x9d,0x2a,0x43,
+    0x37,0x0,0x80,0xb5,0x3c,0x21,0xff,0x41,0x5c,0x5,0x29,0xc,0xd0,0x7,0x29,0xff,
+    0x12,0xd0,0xa,0x29,0x22,0xd0,0xb,0x29,0xff,0x10,0xd0,0xe,0x29,0x1e,0xd0,0xf,
+    0x29,0xff,0x11,0xd0,0x14,0x29,0x21,0xd0,0x1,0xbd,0xff,0x6,0x21,0x3c,0x22,0x81,
+    0x54,0x2,0x23,0xff,0x2,0x0,0x6e,0x32,0x8,0x21,0x10,0xe0,0xf5,0x8,0x83,0x0,
+    0xc,0x13,0x4,0x50,0x21,0x3,0xe0,0x9d,0x10,0x9,0x4,0x30,0x21,0x6d,0x23,0x8,
+    0x5d,0x2,0x55,0xee,0x23,0x0,0x0,0x91,0x3,0xb1,0x8,0x8,0xe0,0x15,0xfc,0x41,
+    0x6,0x13,0xc,0x6,0x21,0xf6,0xf7,0xf9,0xf8,0xff,0x1,0xbd,0x1,0x0,0x3c,0x31,
+    0xa,0x78,0xff,0xa,0x2a,0x12,0xd1,0x71,0x30,0x42,0x78,0xff,0x13,0x2,0x2,0x78,
+    0x1a,0x43,0x52,0x8,0xd7,0xa,0x81,0xc2,0xb,0x0,0x82,0xb,0x4,0x4a,0x81,0xff,
+    0x42,0x79,0x12,0x2,0x0,0x79,0x10,0x43,0x7f,0x40,0x8,0x19,0xe0,0xe,0x2a,0x18,
+    0x29,0x10,0xbf,0xb,0x89,0x52,0x8,0x9a,0x18,0x2d,0xe,0x4b,0xfc,0xf,0x4,0x31,
+    0xe,0x8a,0x89,0x40,0x8,0x10,0x18,0xff,0x88,0x81,0x70,0x47,0x80,0xb5,0x1,0x6c,
+    0x7f,0x1,0x61,0x0,0x21,0x1,0x64,0x3d,0x87,0x0,0xed,0x10,0xab,0x4,0xff,0xe7,
+    0xad,0xa,0xf6,0xf7,0xbe,0xfe,0x8b,0x0,0x70,0xb5,0x2,0x0,0x14,0x32,0x11,0xff,
+    0x68,0x91,0x63,0x1,0x0,0x54,0x31,0x3,0xff,0x0,0x74,0x33,0x1c,0x78,0x24,0x2,
+    0xcd,0xff,0x7f,0x2c,0x43,0x55,0x8e,0x64,0x1b,0x24,0xff,0xb2,0x9d,0x78,0x2d,0x2,
+    0x5b,0x78,0x1d,0xff,0x43,0x93,0x8e,0xeb,0x1a,0x1b,0xb2,0x8d,0xff,0x7f,0x2d,0x2,
+    0x4e,0x7f,0x35,0x43,0x16,0xff,0x8e,0xad,0x1b,0x95,0x87,0xe5,0x1a,0x2e,0xff,0xb2,
+    0xb5,0x42,0x4,0xd0,0xed,0x17,0xee,0xff,0x43,0xed,0x3,0x76,0xc,0x35,0x43,0xd5,
+    0xff,0x87,0xe4,0x18,0x63,0x42,0x1c,0xb2,0xa3,0xfe,0x15,0x0,0xdb,0x17,0xdc,0x43,
+    0xdb,0x3,0x64,0xff,0xc,0x23,0x43,0xb,0x80,0x12,0x79,0x4c,0xff,0x30,0x1,0x0,
+    0x7,0x20,0xf0,0xf7,0x8c,0xff,0xf9,0x70,0xbd,0x38,0xb5,0x4,0x0,0x15,0xff,0x0,
+    0x6,0xf0,0x57,0xf9,0x0,0xbf,0x11,0xff,0xa1,0x20,0x0,0x30,0x30,0x6,0xf0,0x71,
+    0xff,0xf9,0xc4,0x48,0x1,0x0,0x8,0x31,0x21,0xff,0x60,0x78,0x30,0x20,0x63,0x20,
+    0x0,0x3c,0xfd,0x30,0xb7,0x0,0x70,0x41,0x70,0x81,0x70,0xc1,0xff,0x70,0x41,0x60,
+    0x1,0x72,0x41,0x72,0x41,0xff,0x81,0x81,0x81,0x22,0x0,0x29,0x0,0x20,0xbb,0x0,
+    0xf0,0x2f,0x0,0x8b,0xf9,0x28,0xcd,0x1,0xa8,0xff,0x30,0xe4,0xf7,0xea,0xfa,0x20,
+    0x0,0x32,0xff,0xbd,0x1,0x1,0x38,0x0,0x0,0x0,0x92,0xfd,0xe0,0x4,0x0,0x0,
+    0x2,0x7e,0x91,0x42,0x7,0xff,0xd0,0x84,0x22,0x52,0x0,0x82,0x5c,0x91,0xff,0x42,
+    0x1,0xd1,0xf0,0x30,0x70,0x47,0x0,0xff,0x20,0x70,0x47,0x1,0x21,0x2,0x7e,0x1,
+    0xf7,0x23,0x93,0x40,0x19,0x2,0x80,0x5c,0x81,0x40,0xbf,0x19,0x43,0x88,0xb2,0x70,
+    0x47,0x8d,0x2,0x25,0xff,0x0,0x30,0x35,0x28,0x0,0x29,0x68,0xc9,0xff,0x68,0x88,
+    0x47,0x0,0x28,0x11,0xd0,0x2,0xff,0x20,0x28,0x73,0x29,0x7a,0x20,0x0,0x29,0xff,
+    0x30,0x1,0x70,0x23,0x0,0xe2,0x33,0x92,0xff,0x20,0x18,0x70,0x2,0x20,0x0,0x90,
+    0x0,0xfb,0x22,0x92,0x75,0x0,0xf6,0xf7,0x16,0xf8,0x31,0x75,0xbd,0xe3,0x3,0xa,
+    0xd1,0x0,0x23,0xf9,0x31,0xd1,0x4,0xff,0x25,0x0,0x3c,0x35,0x0,0x2a,0x3,0xd0,
+    0xff,0x10,0x68,0xe8,0x65,0x50,0x68,0x3,0xe0,0xff,0x0,0x20,0xe8,0x65,0x80,0x20,
+    0x0,0x2,0xff,0x28,0x66,0x0,0x2b,0x8,0xd0,0x18,0x68,0xff,0x1e,0x28,0x5,0xd1,
+    0x58,0x68,0x8,0x28,0xff,0x2,0xd1,0x28,0x22,0x19,0x0,0x1,0xe0,0xaf,0x28,0x22,
+    0xae,0x49,0xc1,0x6,0xad,0xc1,0x0,0xa0,0xff,0x30,0x41,0x8d,0x1,0x80,0x21,0x0,
+    0xd6,0xff,0x31,0x0,0x22,0xa,0x70,0x4a,0x70,0x1,0xff,0x22,0x8a,0x70,0x20,0x22,
+    0x8a,0x71,0x1,0xff,0x88,0x20,0x0,0x0,0xf0,0x1a,0xfb,0x3,0xff,0x21,0x20,0x7e,
+    0x6,0xf0,0x12,0xf8,0x28,0xff,0x78,0x5,0x28,0xc,0xd1,0x6,0x20,0x28,0xfd,0x70,
+    0x17,0x2,0x52,0xfa,0x5,0x23,0x22,0x0,0xf7,0xd0,0x32,0x4f,0x95,0x0,0xf5,0xf7,
+    0xd6,0xff,0x77,0x1,0xe0,0x4,0x19,0x0,0x0,0x20,0x32,0xd7,0x1,0xff,0x4,0x0,
+    0x84,0x20,0x40,0x0,0x20,0x5c,0xff,0x81,0x42,0x48,0xd1,0x21,0x0,0x64,0x31,0x9f,
+    0x2,0x20,0x8,0x70,0x48,0x35,0x0,0x59,0x1,0x25,0xff,0x0,0x2b,0x3,0xd0,0x1a,
+    0x68,0x2,0x62,0xff,0x5a,0x68,0x2,0xe0,0x5,0x62,0x80,0x22,0xff,0x12,0x2,0x42,
+    0x62,0xff,0x22,0x2a,0x32,0xff,0x4a,0x60,0x8a,0x4a,0x8a,0x60,0x9a,0x32,0xff,0xca,
+    0x60,0xc9,0x22,0xd2,0x0,0xa,0x61,0xff,0x88,0x4a,0x4a,0x61,0x88,0x3a,0x8a,0x61,
+    0xff,0x53,0x3a,0xca,0x61,0x4e,0x3a,0xa,0x62,0xfd,0x8b,0x15,0x0,0x4a,0x62,0x83,
+    0x4a,0x8a,0x62,0xff,0x7e,0x3a,0xca,0x62,0x62,0x3a,0xa,0x63,0xff,0x26,0x0,0xd0,
+    0x36,0x4f,0x21,0x31,0x70,0xff,0x75,0x70,0xb5,0x70,0xff,0x21,0xf1,0x70,0xff,0x31,
+    0x71,0x1,0x78,0x4,0x29,0xb,0xd1,0x69,0x6,0xbd,0x1,0xa1,0x2,0x1,0xa1,0x0,
+    0x32,0x0,0x9f,0x6,0x65,0x86,0x9f,0x0,0x5,0x17,0x0,0x8b,0x1,0xbd,0x6,0x3,
+    0x0,0xff,0xf1,0xb5,0x84,0xb0,0xd,0x0,0x0,0x27,0xff,0x69,0x46,0xf,0x73,0x4,
+    0x9c,0x3c,0x34,0xff,0x1,0x20,0xa0,0x70,0xe7,0x70,0x4,0x98,0xfb,0xda,0x30,0x69,
+    0x1,0x78,0x30,0x21,0x1,0x40,0xff,0x0,0x98,0x1,0x70,0x29,0x69,0x68,0x48,0xff,
+    0x81,0x42,0xd,0xd1,0xe1,0x78,0x4,0x22,0xff,0xa,0x43,0xe2,0x70,0x67,0x60,0x0,
+    0x99,0xf7,0x9,0x78,0x41,0xb,0x0,0x0,0x99,0xa,0x70,0xff,0xef,0x60,0x28,0x61,
+    0x4e,0xe0,0x0,0x29,0xff,0x0,0xd5,0x2f,0x61,0xe8,0x68,0x0,0x28,0xff,0x0,0xd5,
+    0xef,0x60,0xea,0x68,0x29,0x69,0xff,0x4,0x98,0xf5,0xf7,0x69,0xff,0x1,0x90,0xff,
+    0x1,0x28,0x3e,0xdb,0xe8,0x68,0x1,0x28,0xff,0x4,0xdb,0x0,0xbf,0x2c,0xa2,0x2,
+    0x26,0xff,0x2d,0xa0,0x2,0xe0,0x2d,0xa2,0x4,0x26,0xff,0x30,0xa0,0x2,0x90,0x33,
+    0x0,0x1,0xa9,0xff,0x4,0x98,0x6,0xf0,0x63,0xfc,0x3,0xd5,0xff,0x4,0x20,0x69,
+    0x46,0x8,0x73,0x70,0x1e,0xff,0xe9,0x68,0x1,0x29,0xb,0xdb,0xe1,0x78,0xe9,0x2,
+    0x6b,0x4,0x69,0x2,0x80,0x69,0x8,0x1,0x99,0xe9,0x57,0x60,0x29,0x69,0x1d,0x6,
+    0x1,0x1d,0xc,0x40,0x1d,0xc,0xdf,0x29,0x61,0x1,0x99,0x61,0x9b,0x4,0x2,0x9a,
+    0xdf,0x40,0xb2,0x10,0x5c,0x8,0x17,0x0,0x8,0x70,0xff,0x0,0xe0,0x67,0x60,0x60,
+    0x78,0xe1,0x78,0xff,0x88,0x42,0x8,0xd1,0x4,0x98,0x0,0x69,0x7f,0x61,0x68,0x88,
+    0x42,0x3,0xd1,0xa7,0xe7,0x0,0xff,0x67,0x60,0x9,0xe0,0x20,0x78,0xc,0x28,0xff,
+    0x1,0xd0,0xb,0x28,0x4,0xd1,0x7,0x20,0xfd,0x20,0xf9,0x0,0x0,0xf0,0xd1,0xf9,
+    0x68,0x46,0xff,0x0,0x7b,0x5,0xb0,0xf0,0xbd,0x0,0x0,0xff,0x24,0x3d,0x3,0x0,
+    0x80,0x1a,0x6,0x0,0x7f,0xa0,0x86,0x1,0x0,0x9,0x6,0x0,0xb,0xc,0xff,0x40,
+    0x9c,0x0,0x0,0x10,0x27,0x0,0x0,0xff,0x4,0x3,0x2,0x1,0x26,0xa2,0xa,0x60,
+    0xfe,0x8d,0x0,0x71,0x20,0x4b,0x8b,0x60,0x3d,0x23,0xff,0xcb,0x80,0x45,0x30,0x0,
+    0x78,0x2,0x28,0xff,0x1,0xd1,0x0,0x20,0x0,0xe0,0x50,0x20,0xff,0xc8,0x60,0xa,
+    0x61,0x1b,0x48,0x48,0x61,0xfb,0x8a,0x61,0x73,0x1,0x47,0x70,0xb5,0x14,0x0,0xff,
+    0x2,0x7e,0x91,0x42,0x4,0xd1,0x21,0x0,0xff,0x2,0x68,0xd2,0x6a,0x90,0x47,0x70,
+    0xbd,0xff,0x84,0x22,0x52,0x0,0x82,0x5c,0x91,0x42,0xf7,0x1,0xd0,0x7,0x91,0x1,
+    0x0,0xbf,0x12,0xa1,0xff,0x21,0x60,0x1,0x25,0x25,0x71,0xe,0x49,0xff,0xa1,0x60,
+    0x5c,0x21,0xe1,0x80,0xd,0x4e,0xf7,0x0,0x22,0x31,0xc7,0x1,0x96,0xfa,0xe0,0x60,
+    0x9f,0x25,0x61,0x66,0x61,0xa5,0x49,0x2,0x9b,0x0,0x8,0xff,0x81,0x2,0x0,0xae,
+    0x2,0x0,0x0,0x6a,0x2f,0x3,0x0,0x0,0x51,0x7,0x0,0x1,0x9e,0x0,0x93,0x2,
+    0xf7,0xff,0xf,0x0,0xa3,0x4,0xff,0xff,0x0,0x0,0xff,0x52,0x6f,0x68,0x6d,0x20,
+    0x52,0x50,0x52,0xef,0x2d,0x30,0x35,0x32,0x43,0x0,0x0,0x70,0xb5,0xff,0x82,0xb0,
+    0x4,0x0,0x26,0x0,0x18,0x36,0xff,0x30,0x78,0x83,0x42,0x0,0xd0,0x97,0xe0,0xff,
+    0x25,0x0,0x38,0x35,0x29,0x79,0x89,0x1e,0xff,0xc,0x29,0x0,0xd9,0x90,0xe0,0x1,
+    0xa2,0xff,0x52,0x5c,0x52,0x0,0x97,0x44,0x6,0x8c,0xff,0x8c,0x8c,0x33,0x39,0x59,
+    0x5b,0x7a,0x8c,0xd7,0x8c,0x8d,0x9a,0xc8,0x0,0x2d,0xd3,0x0,0x0,0x28,0xfd,0xd,
+    0xb5,0x0,0xe3,0x31,0x20,0x0,0x30,0x30,0xff,0xb2,0x69,0x92,0x68,0x90,0x47,0x0,
+    0x28,0xff,0x4,0xd0,0x3,0x20,0x28,0x71,0x0,0x22,0xef,0x21,0x0,0x15,0xe0,0x17,
+    0x2,0xb1,0x69,0xc9,0xfb,0x68,0x88,0x17,0x0,0xa,0xd0,0x29,0x78,0x20,0xff,0x0,
+    0x29,0x30,0x1,0x70,0x2,0x20,0x0,0xff,0x90,0x23,0x0,0xe2,0x33,0x0,0x22,0x92,
+    0xef,0x21,0x5d,0xe0,0x1,0x2d,0x4,0x0,0x21,0xa,0xff,0x20,0xef,0xf7,0x48,0xff,
+    0x73,0xbd,0x7,0xfa,0xf,0x0,0x20,0xdb,0x0,0x5,0xf9,0x73,0xbd,0x8,0xfe,0xb,
+    0x4,0xdc,0x30,0x2,0x78,0xfc,0x21,0x11,0xff,0x40,0x1,0x70,0x6a,0x79,0x0,0x2a,
+    0xc,0x7f,0xd0,0x5,0x23,0x1a,0x42,0x2,0xd0,0xed,0x3,0x7f,0x2,0x70,0x2,0x21,
+    0x6a,0x79,0xa,0xd,0x0,0xef,0x2,0x78,0x11,0x43,0x59,0x0,0x23,0x22,0x0,0xff,
+    0xdb,0x32,0x4a,0x21,0x20,0x0,0xf5,0xf7,0xff,0x1a,0xfe,0x73,0xbd,0x9,0x20,0x26,
+    0xe0,0x7f,0xa8,0x79,0x0,0x28,0x41,0xd1,0x68,0x5,0x0,0xf7,0x3,0xd1,0xb,0x6b,
+    0x2,0x21,0x10,0xe0,0x5,0xbf,0x21,0x8,0x42,0x7,0xd0,0xa,0xd,0x2,0x20,0xfb,
+    0x68,0x73,0x6d,0x2,0xf2,0xf8,0x1,0xe0,0xc,0xfe,0xf,0x0,0x30,0x78,0x5,0xf0,
+    0xa,0xfe,0x1,0xf5,0x21,0x7,0x2,0xe,0x41,0x0,0xa9,0x79,0x0,0x29,0xff,0x22,
+    0xd1,0x5,0xf0,0x16,0xfe,0x0,0x28,0x27,0x34,0xd1,0xd,0x21,0x0,0xbd,0x6,0xe4,
+    0xbd,0x0,0x67,0x6,0xdf,0xdb,0xfd,0x73,0xbd,0xe,0xa7,0x8,0x41,0x7a,0xff,0x40,
+    0x22,0xa,0x40,0x80,0x20,0x1,0x40,0xde,0x53,0x2,0xf1,0xf8,0x73,0xbd,0x7,0x2,
+    0x54,0xf9,0xd2,0x83,0x2,0x5,0xcb,0x1,0xd9,0x6,0xaa,0x17,0x4,0xdc,0x30,0x3f,
+    0x40,0x7a,0x0,0x6,0x5,0xd5,0x85,0x2,0x15,0x2,0xf9,0xb1,0x15,0x0,0x75,0x2,
+    0xe1,0xfd,0x0,0x28,0xca,0xfd,0xd0,0x8b,0x2,0x73,0xbd,0x38,0xb5,0x14,0x0,0xf7,
+    0x5,0x0,0x14,0x8d,0x1,0x8b,0x42,0x10,0xd1,0xff,0x3c,0x21,0x41,0x5c,0xc,0x29,
+    0xc,0xd1,0xff,0xd,0x21,0x3c,0x22,0x81,0x54,0x2,0x21,0xf7,0x0,0x91,0x3,0x87,
+    0x8,0xf5,0xf7,0x98,0xfd,0xff,0x20,0x68,0x28,0x60,0x31,0xbd,0x0,0x0,0xf5,0x1e,
+    0xd3,0x1,0x8,0x3,0x0,0x50,0x0,0xa0,0x0,0xf7,0xc8,0x0,0x28,0x7,0x0,0x78,
+    0x0,0x9f,0xf,0xff,0xac,0xd,0xc8,0x0,0x96,0x0,0x64,0x0,0xef,0x2c,0x1,0x2c,
+    0x1,0x1c,0x0,0x2,0x0,0x0,0xff,0xf8,0xb5,0x4,0x0,0x25,0x0,0xcc,0x35,0xff,
+    0x28,0x78,0x0,0x1,0x30,0x21,0x1,0x40,0xff,0x68,0x46,0x1,0x70,0x21,0xa6,0x3,
+    0x23,0xff,0x32,0x0,0x69,0x46,0x20,0x0,0x7,0xf0,0xaf,0x19,0xfc,0x40,0xb2,0x3e,
+    0x0,0xd5,0xef,0x0,0xbf,0xff,0x1c,0xa1,0x9,0x5c,0xa4,0x22,0xa1,0x54,0xff,0x29,
+    0x7b,0x30,0x5c,0x8,0x43,0x28,0x73,0xff,0x4,0x23,0x0,0xbf,0x19,0xa2,0x21,0x0,
+    0xdd,0x64,0xf9,0x1,0x7,0xf0,0x4,0x29,0x0,0x3,0x26,0xfa,0x2b,0x2,0x3,0x2b,
+    0x0,0x12,0xa7,0xe9,0x7a,0x38,0x7f,0x5c,0x80,0x0,0x8,0x43,0xe8,0x72,0x27,0x2,
+    0xb5,0xf,0x27,0x0,0x65,0x27,0x4,0xf0,0xfb,0x51,0x6,0x3,0xf9,0x20,0x21,0x2,
+    0x1f,0x2,0x69,0x78,0xe,0x40,0x6,0xff,0x43,0xee,0x72,0xa9,0x7a,0xaa,0x78,0x30,
+    0xff,0x20,0x10,0x40,0x8,0x43,0xa8,0x72,0xa8,0xff,0x73,0xf1,0xbd,0x0,0x10,0x20,
+    0x0,0x1,0xff,0x2,0x4,0x0,0x0,0x4,0x8,0xc,0x1,0xff,0x2,0x40,0x80,0x80,
+    0xb5,0x1,0x0,0x3d,0xff,0x31,0x8a,0x78,0xa,0x70,0x2,0x6c,0x2,0xfd,0x61,0xf1,
+    0x0,0x70,0x8a,0x70,0x2,0x64,0x4,0xbf,0x23,0x2,0x0,0xd5,0x32,0x41,0xfd,0x0,
+    0x24,0x57,0xfd,0x1,0xbd,0x23,0x26,0x2,0x23,0x0,0xd9,0x23,0x4,0xfd,0x12,0x23,
+    0x4,0x45,0x21,0x42,0x5c,0x1,0x0,0xff,0xde,0x31,0x0,0x2a,0x5,0xd1,0xa,0x70,
+    0xff,0x4a,0x70,0xff,0x22,0x8a,0x70,0xf,0x22,0xff,0x13,0xe0,0x3,0x0,0x46,0x33,
+    0x1,0x2a,0xff,0x7,0xd1,0x1a,0x88,0xa,0x70,0x1a,0x88,0xdf,0x12,0xa,0x4a,0x70,
+    0x0,0x19,0x0,0x7,0xe0,0xf7,0xff,0x22,0xa,0x1f,0x0,0x4a,0x70,0x5a,0x88,0x7d,
+    0x8a,0x3,0x0,0x12,0xa,0xca,0x70,0x5,0x51,0x0,0xb7,0xdd,0x32,0x4b,0x51,0x0,
+    0xe9,0xfc,0x51,0x2,0x0,0xdf,0x29,0xc,0xd0,0x4,0x23,0x9b,0x3,0x19,0x42,0xff,
+    0x1,0xd0,0x43,0x21,0x7,0xe0,0x44,0x21,0xff,0x3,0x23,0x0,0x2a,0x3,0xd0,0x7,
+    0x23,0xff,0x1,0xe0,0x46,0x21,0x5,0x23,0x0,0x93,0x77,0x3,0x0,0xe6,0xa7,0x1,
+    0xf5,0xf7,0xc5,0x31,0x0,0xff,0x2,0x0,0x46,0x32,0xb0,0x30,0x83,0x8a,0xff,0x8b,
+    0x42,0x4,0xd3,0x3,0x88,0xcb,0x18,0x7f,0x13,0x80,0xc3,0x88,0xb,0xe0,0xc3,0xf,
+    0x4,0x7d,0x43,0xf,0x4,0x3,0x89,0x3,0xe0,0x83,0x9,0x4,0xff,0x43,0x89,0xc9,
+    0x18,0x51,0x80,0x81,0x89,0xff,0x13,0x88,0x99,0x42,0x2,0xd2,0x11,0x80,0x9f,0xc0,
+    0x89,0x4,0xe0,0x1,0x29,0x0,0xb,0x2,0x40,0xbf,0x8a,0x50,0x80,0x70,0x47,0x38,
+    0xf5,0x0,0xe7,0xff,0x31,0x4a,0x78,0x8b,0x78,0x1b,0x2,0xd4,0xff,0x18,0x5,0x0,
+    0xa0,0x35,0x2a,0x88,0xa2,0xff,0x42,0x1,0xd2,0xa2,0x1a,0x0,0xe0,0x12,0xff,0x1b,
+    0x9,0x78,0xc0,0x23,0x19,0x42,0x3,0xff,0xd1,0x29,0x8d,0x92,0xb2,0x91,0x42,0x3,
+    0xff,0xd2,0x2,0x21,0x44,0x30,0x1,0x70,0x6,0xff,0xe0,0x1,0x21,0x44,0x22,0x81,
+    0x54,0x2c,0xff,0x80,0x29,0x88,0xff,0xf7,0xb7,0xff,0x6c,0xff,0x80,0x8,0x20,0xef,
+    0xf7,0xbf,0xfb,0x31,0xff,0xbd,0xf8,0xb5,0x4,0x0,0x26,0x0,0x3d,0xff,0x36,0x30,
+    0x78,0x41,0x7,0xb,0xd5,0x20,0xff,0x0,0xff,0xf7,0xcf,0xff,0x70,0x78,0x0,0xff,
+    0x28,0x60,0xd1,0x1,0x20,0x70,0x70,0x0,0xff,0x20,0xb0,0x70,0x20,0x64,0xf1,0xbd,
+    0x27,0xff,0x0,0xcf,0x37,0xb9,0x7d,0x9,0x6,0x30,0xff,0xd5,0xc0,0x7,0x2e,0xd5,
+    0x2,0x20,0x0,0xff,0x90,0x39,0x7e,0x7a,0x7e,0x12,0x2,0x89,0xff,0x18,0x89,0xb2,
+    0x25,0x0,0x40,0x35,0x6a,0xff,0x79,0x0,0x2a,0x4,0xd1,0xea,0x88,0x8a,0xff,0x42,
+    0x9,0xdb,0x1,0x20,0x7,0xe0,0x2a,0xef,0x89,0x8a,0x42,0x1,0x9,0x0,0x2,0xe0,
+    0xea,0xff,0x88,0x91,0x42,0x0,0xdb,0x68,0x71,0x20,0xff,0x0,0x14,0x30,0x2,0x68,
+    0xea,0x60,0x3a,0xff,0x78,0xd2,0x7,0x5,0xd4,0x69,0x79,0x2,0xff,0x29,0x1,0xd1,
+    0x0,0x21,0x0,0xe0,0x50,0xff,0x21,0x29,0x82,0x2,0x79,0x21,0x0,0x4c,0xfb,0x31,
+    0x7,0x91,0x0,0x41,0xfd,0x1,0xe0,0x0,0xfe,0x5d,0x0,0xb8,0x7d,0x40,0x6,0x1f,
+    0xd5,0x30,0xff,0x78,0x80,0x7,0x1c,0xd5,0x0,0x98,0x20,0x7f,0x18,0xe7,0x30,0x1,
+    0x78,0x42,0x78,0x6f,0x2,0xff,0x82,0x78,0xc0,0x78,0x0,0x2,0x12,0x18,0xfe,0x75,
+    0x2,0x60,0x69,0x68,0x61,0x92,0xb2,0x89,0xff,0xb2,0x20,0x0,0x0,0xf0,0xa,0xf8,
+    0xa8,0xff,0x61,0x84,0x20,0x40,0x0,0x22,0x5c,0x54,0x77,0x34,0x21,0x0,0x4b,0x2,
+    0x1b,0xfd,0xf1,0xdd,0x4,0xff,0x8,0x0,0x16,0x0,0x27,0x0,0x5c,0x37,0xff,0x39,
+    0x7a,0xe4,0xf7,0x80,0xf8,0x85,0xb2,0xf7,0x30,0x0,0x79,0x9,0x0,0x7b,0xf8,0x86,
+    0xb2,0xff,0x0,0x2d,0x17,0xd0,0xb0,0x2,0x29,0x0,0xff,0xe4,0xf7,0x74,0xf8,0x0,
+    0x90,0x4,0x23,0xff,0x22,0x0,0x68,0x32,0x69,0x46,0x20,0x0,0xff,0x7,0xf0,0xab,
+    0xfa,0x0,0x6,0x9,0xd4,0xff,0x80,0x15,0x20,0x18,0x78,0x30,0x1,0x68,0xff,0x4d,
+    0x43,0x0,0x69,0x46,0x43,0xa8,0x1b,0xfb,0x0,0x21,0x9d,0x4,0x21,0x7a,0x68,0xd3,
+    0x17,0xff,0xe4,0xf7,0x32,0xfa,0x80,0x22,0x12,0x2,0xff,0x0,0x23,0xe8,0xf7,0x2,
+    0xfd,0x80,0x8,0xff,0x8a,0x7,0x10,0x43,0x3a,0x68,0x10,0x18,0xdf,0xf2,0xbd,0x0,
+    0x0,0x70,0x75,0x0,0x16,0x0,0xff,0x5,0xf0,0xab,0xfc,0x0,0xbf,0x13,0xa1,0xff,
+    0x20,0x0,0x30,0x30,0x5,0xf0,0xc5,0xfc,0xff,0xab,0x48,0x1,0x0,0x8,0x31,0x21,
+    0x60,0xff,0x78,0x30,0x20,0x63,0x0,0x25,0xcc,0x21,0xff,0x65,0x54,0x20,0x0,0xf8,
+    0x30,0x5,0x70,0x7f,0x85,0x80,0x22,0x0,0x31,0x0,0x80,0xbb,0x0,0xff,0x20,0x18,
+    0x5,0xf0,0xe3,0xfc,0x67,0x20,0xff,0x25,0x54,0x28,0x21,0x20,0x0,0xd0,0x30,0x5f,
+    0xe3,0xf7,0x40,0xfe,0x18,0x9,0x0,0x71,0x9,0x0,0xdf,0x39,0xfe,0x20,0x0,0x70,
+    0x5b,0x0,0x1,0x1,0xbf,0x23,0x0,0x0,0x0,0x86,0x92,0x4,0x0,0x0,0xff,0x2,
+    0x7e,0x91,0x42,0x9,0xd0,0x8c,0x22,0xef,0x52,0x0,0x82,0x5c,0xeb,0x1,0xd1,0x80,
+    0x21,0xff,0x49,0x0,0x40,0x18,0x70,0x47,0x0,0x20,0xff,0x70,0x47,0x1,0x21,0x2,
+    0x7e,0x1,0x23,0xfb,0x93,0x40,0x1d,0x2,0x80,0x5c,0x81,0x40,0x19,0xff,0x43,0x88,
+    0xb2,0x70,0x47,0x70,0xb5,0x82,0xfd,0xb0,0xef,0x3,0x30,0x36,0x30,0x0,0x31,0x68,
+    0xff,0xc9,0x68,0x88,0x47,0x0,0x28,0x13,0xd0,0xff,0x25,0x0,0x60,0x35,0x1,0x20,
+    0xe8,0x71,0xff,0x31,0x7a,0x20,0x0,0x29,0x30,0x1,0x70,0xef,0x86,0x20,0x28,0x70,
+    0xe3,0x3,0x23,0x0,0x63,0xef,0x33,0x0,0x22,0x86,0x81,0x0,0xf5,0xf7,0x61,0xff,
+    0xfb,0x73,0xbd,0x0,0x22,0x0,0x21,0xa,0xee,0x59,0x1,0x6e,0xfc,0x73,0x59,0x5,
+    0x17,0x0,0x0,0xff,0x2b,0x8,0xd0,0x18,0x68,0x1f,0x28,0x5,0xff,0xd1,0x58,0x68,
+    0x8,0x28,0x2,0xd1,0x28,0xff,0x22,0x19,0x0,0x1,0xe0,0x28,0x22,0x9e,0xfd,0x49,
+    0xbf,0x6,0x4,0xfe,0xf2,0x20,0x20,0x5a,0xff,0x21,0x0,0xf2,0x31,0x8,0x81,0x26,
+    0x0,0xff,0x60,0x36,0x6,0x20,0x30,0x72,0x0,0x25,0xbf,0x20,0x0,0x18,0x30,0x45,
+    0x62,0x5,0x2,0xc5,0xda,0x5,0x4,0x85,0x5,0x4,0x5,0x63,0x27,0x2,0xcd,0x71,
+    0xff,0x0,0x2f,0x5,0xd0,0x38,0x68,0x21,0x0,0xff,0x88,0x31,0x88,0x63,0x78,0x68,
+    0x4,0xe0,0xff,0x20,0x0,0x88,0x30,0x85,0x63,0x80,0x20,0xfb,0x0,0x2,0x13,0x2,
+    0xc8,0x63,0x70,0x7c,0x0,0xff,0x28,0x6,0xd1,0x18,0x22,0x0,0xbf,0x46,0x7c,0x5b,
+    0x1,0x1b,0x3,0xbd,0xfd,0x20,0x0,0xf2,0xd6,0x1,0xbf,0xf0,0x74,0xb5,0x75,0x75,
+    0x76,0xb,0x2,0xc0,0xbf,0x78,0x88,0x21,0x60,0x54,0xc,0x23,0x0,0x15,0xea,0x23,
+    0x0,0x89,0x23,0x0,0xab,0x23,0x4,0x1,0x89,0x20,0xff,0x0,0x0,0xf0,0xc9,0xfc,
+    0x22,0x0,0x0,0xfe,0xd5,0x0,0x4c,0x30,0x2,0xf0,0x9f,0xfd,0x3,0xff,0x21,0x20,
+    0x7e,0x5,0xf0,0x29,0xfb,0xf0,0x9f,0x79,0x4,0x28,0xe,0xd1,0x17,0x0,0xd,0x0,
+    0xa,0xff,0xfb,0x80,0x20,0x30,0x70,0x75,0x70,0x2,0xef,0x23,0x32,0x0,0x80,0xff,
+    0x4,0xec,0xfa,0x14,0xff,0x20,0x0,0xe0,0x5,0x20,0xf0,0x71,0x0,0xfd,0x20,0xe3,
+    0x3,0x90,0x90,0x0,0x91,0x91,0x0,0xbf,0x92,0x92,0x0,0x93,0x93,0x0,0xb,0x3,
+    0x8c,0x7e,0xbf,0x3,0x5c,0x81,0x42,0x1,0xd0,0x6,0x1f,0x0,0x6f,0x27,0x0,0xb0,
+    0x37,0x66,0x1,0x2b,0x3,0x1d,0x1,0xff,0x38,0x60,0x58,0x68,0x2,0xe0,0x3e,0x60,
+    0xfe,0xc1,0x2,0x78,0x60,0x3e,0x81,0xa9,0x48,0x78,0x5f,0x81,0xd,0x20,0x38,0x73,
+    0x75,0x3,0x68,0xcb,0xc,0xfd,0x13,0xcb,0x8,0x57,0xfd,0x38,0x89,0x28,0x77,0xff,
+    0x38,0x89,0x0,0xa,0xe8,0x77,0x20,0x0,0xff,0x82,0x30,0x79,0x89,0x1,0x70,0x79,
+    0x89,0x7f,0x9,0xa,0xc1,0x70,0xe8,0x79,0x5,0x9f,0xc,0x57,0xba,0xfa,0x80,0xa3,
+    0x1,0x6e,0x9f,0x0,0x2a,0x9f,0x8,0xe5,0x9c,0x9f,0x4,0x4,0xc5,0x1,0x9f,0x6,
+    0x83,0x83,0x0,0xff,0x94,0x94,0x0,0x95,0x95,0x0,0x97,0x97,0xff,0x0,0x98,0x98,
+    0x0,0x99,0x99,0x0,0x9a,0xff,0x9a,0x0,0x82,0x82,0x0,0x38,0xa2,0xa,0xff,0x60,
+    0x1,0x22,0xa,0x71,0x88,0x4b,0x8b,0xff,0x60,0x52,0x23,0xcb,0x80,0xcc,0x30,0x0,
+    0xbf,0x78,0x1,0x28,0x1,0xd1,0x0,0x3d,0x0,0x50,0xff,0x20,0xc8,0x60,0xa,0x61,
+    0x0,0x20,0x70,0xff,0x47,0x0,0x0,0x6c,0x39,0x3,0x0,0x38,0xff,0xb5,0x14,0x0,
+    0x2,0x7e,0x91,0x42,0x4,0xff,0xd1,0x21,0x0,0x2,0x68,0xd2,0x6a,0x90,0xff,0x47,
+    0x32,0xbd,0x8c,0x22,0x52,0x0,0x82,0xfb,0x5c,0x91,0xe7,0x0,0x7,0x20,0x32,0xbd,
+    0x0,0xff,0xbf,0x24,0xa1,0x21,0x60,0x1,0x21,0x21,0xff,0x71,0x74,0x49,0xa1,0x60,
+    0x63,0x21,0xe1,0xdf,0x80,0x1,0x6c,0x73,0x4a,0x1d,0x0,0xd2,0x5,0xff,0x22,0x0,
+    0xe0,0xa,0x22,0x70,0x30,0x5,0xff,0x0,0x28,0x78,0x70,0x21,0x1,0x40,0x10,0xff,
+    0x29,0x13,0xd0,0x20,0x29,0xf,0xd0,0x30,0xff,0x29,0xb,0xd0,0x60,0x29,0x5,0xd0,
+    0x70,0xff,0x29,0xc,0xd1,0x50,0x0,0x82,0x18,0x52,0xf7,0x1,0x8,0xe0,0x7,0x2,
+    0x12,0x1,0x4,0xe0,0xff,0xd2,0x0,0x2,0xe0,0x92,0x0,0x0,0xe0,0xef,0x52,0x0,
+    0x63,0x48,0xec,0x1,0x23,0xe8,0xf7,0xff,0x74,0xfb,0x6a,0x6c,0xd3,0x17,0xe4,0xf7,
+    0xff,0x7c,0xf8,0xc0,0xb,0x4a,0x4,0x10,0x43,0xff,0xc9,0xb,0x9,0x2,0x2,0xe,
+    0x11,0x43,0xef,0x0,0x2,0x5b,0x4a,0x1f,0x2,0x64,0xfb,0x29,0x8f,0x6c,0x40,0x18,
+    0xe0,0x5b,0x1,0x7d,0x1,0xb9,0x0,0x32,0xff,0xbd,0x14,0x8e,0x2,0x0,0x4c,0x54,
+    0x52,0xff,0x2d,0x35,0x35,0x39,0x0,0xf2,0xb5,0x82,0xff,0xb0,0x4,0x0,0x0,0x25,
+    0x69,0x46,0xd,0xff,0x70,0x2,0x98,0xc1,0x68,0x3,0x69,0x18,0xff,0x0,0x8,0x43,
+    0x1,0xd1,0x6,0x20,0xc,0xf7,0xe0,0x48,0x48,0xab,0x1,0xda,0x0,0x29,0x3,0xff,
+    0xd1,0x83,0x42,0x4,0xda,0x0,0x2b,0x2,0xff,0xd0,0x4,0x20,0x6a,0x46,0x10,0x70,
+    0x7,0xff,0x20,0x26,0x0,0x60,0x36,0x30,0x72,0x44,0xfd,0x48,0x17,0x0,0xd1,0x1,
+    0x22,0x43,0x48,0x8,0xff,0x27,0x37,0x72,0x1a,0xe0,0x0,0x22,0x1,0xbd,0x2b,0x2f,
+    0x0,0x20,0x14,0xe0,0x3f,0x19,0x0,0x1,0xff,0xda,0x38,0x48,0xf,0xe0,0x38,0x4f,
+    0xbb,0xff,0x42,0xc,0xdb,0x78,0x0,0x83,0x42,0x8,0xeb,0xdb,0x3a,0xb,0x0,0x6,
+    0xb,0x4,0x2,0xdb,0x47,0xff,0x0,0xbb,0x42,0x0,0xdb,0x38,0x0,0x3,0xff,0x0,
+    0xf9,0x27,0xe2,0x55,0x22,0x0,0x18,0xff,0x32,0xd0,0x62,0x2,0x98,0x3,0x61,0x1,
+    0xfd,0x29,0x41,0x0,0x27,0x11,0xe0,0x2a,0x4f,0xb9,0xfe,0x41,0x0,0x7f,0x8,0xc,
+    0xe0,0x78,0x0,0x81,0xaf,0x42,0x9,0xdb,0x2b,0xf,0x0,0x5,0x3b,0x0,0x81,0xfb,
+    0x42,0x3,0x3b,0x0,0xb9,0x42,0x0,0xda,0x7,0xfe,0x8e,0x1,0x18,0x30,0x47,0x62,
+    0x2,0x99,0xcf,0xff,0x60,0xf0,0x79,0x6,0x28,0xc,0xd1,0x30,0xff,0x7a,0x7,0x28,
+    0x1,0xd0,0x8,0x28,0x7,0xff,0xd1,0x19,0x20,0xf0,0x71,0x8,0x22,0x21,0xf7,0x0,
+    0x71,0x31,0xf7,0x3,0xca,0xf9,0xf0,0x79,0x77,0x7,0x28,0x23,0x1f,0x0,0x6,0x28,
+    0x11,0x1f,0x0,0xfb,0xf,0xd0,0x39,0x2,0x40,0x6a,0x21,0x0,0x18,0x7f,0x31,0x89,
+    0x6a,0x88,0x42,0x7,0xd1,0xf,0x2,0xfd,0xc0,0xf,0x4,0x9,0x6b,0x88,0x42,0xe,
+    0xd0,0xff,0x0,0x21,0x20,0x7e,0x5,0xf0,0x99,0xf9,0xff,0x80,0x20,0x30,0x70,0x75,
+    0x70,0x2,0x23,0xef,0x32,0x0,0x80,0x21,0x49,0x2,0x7b,0xf9,0x14,0xfe,0x59,0x0,
+    0x68,0x46,0x0,0x78,0x3,0xb0,0xf0,0xff,0xbd,0xff,0xff,0x0,0x0,0x50,0xc3,0x0,
+    0xff,0x0,0xa0,0x86,0x1,0x0,0xea,0x4a,0x13,0xff,0xb5,0x10,0x27,0x0,0x0,0x1,
+    0x0,0x0,0xff,0x80,0x70,0x11,0x1,0x0,0x20,0xa1,0x7,0xff,0x0,0xf8,0xb5,0x5,
+    0x0,0x2e,0x0,0x18,0xff,0x36,0x30,0x78,0x83,0x42,0x0,0xd0,0xc4,0xff,0xe1,0x2c,
+    0x0,0x60,0x34,0xe1,0x79,0x49,0xff,0x1e,0x1b,0x29,0x0,0xd9,0xb9,0xe1,0x2,0xff,
+    0xa2,0x49,0x0,0x52,0x5a,0x97,0x44,0x0,0xdf,0xbf,0x38,0x0,0x6a,0x3,0x1,0x12,
+    0x78,0x1,0xff,0xa4,0x1,0xc2,0x1,0xc6,0x2,0xea,0x2,0xff,0x84,0x2,0xa2,0x2,
+    0x36,0x1,0x6a,0x3,0xfd,0x32,0x3,0x0,0x6e,0x0,0x86,0x0,0x48,0x1,0xff,0x72,
+    0x1,0xd8,0x0,0xac,0x0,0xc4,0x0,0xff,0xec,0x0,0x3e,0x2,0x28,0x0,0x2d,0x30,
+    0xff,0x0,0x78,0x0,0x28,0xd,0xd1,0x29,0x0,0xff,0x64,0x31,0x28,0x0,0x30,0x30,
+    0xb2,0x69,0xff,0x92,0x68,0x90,0x47,0x0,0x28,0x4,0xd0,0xff,0x3,0x20,0xe0,0x71,
+    0x0,0x22,0x29,0x0,0xf7,0x3,0xe0,0x2,0x9,0x4,0x0,0x21,0xa,0x20,0xff,0xef,
+    0xf7,0x23,0xfa,0xf1,0xbd,0x0,0x20,0x7f,0xb0,0x62,0x81,0x21,0x21,0x70,0x60,0xd7,
+    0x0,0xf7,0x22,0x0,0x28,0xd5,0x0,0x10,0xf9,0x15,0x20,0x7f,0x6a,0xe1,0x0,0x20,
+    0x30,0x63,0x6,0x2b,0x0,0xf5,0x20,0x45,0x1,0x2,0x25,0x1,0x0,0xd0,0x6b,0xe1,
+    0xd5,0x19,0xf,0x0,0x8,0x45,0x0,0x71,0x5d,0x0,0xf5,0xf7,0x6f,0x26,0xf9,0xf1,
+    0xbd,0x7,0x2,0x2b,0xf9,0x36,0x0,0xef,0xd0,0x5c,0xe1,0x1a,0x59,0x2,0x20,0xcc,
+    0x21,0xaf,0x68,0x54,0xb8,0xe0,0x17,0x2,0x1f,0x17,0x4,0x50,0xbf,0xe1,0x28,0x0,
+    0x0,0xf0,0xfa,0x2b,0x0,0x1b,0x7e,0x1f,0x0,0x9e,0x20,0x20,0x70,0x0,0x20,0x6b,
+    0x6,0xff,0x9e,0x21,0x3e,0xe0,0x5,0xf0,0xe6,0xf8,0xff,0x1,0x21,0x30,0x78,0x5,
+    0xf0,0xea,0xf8,0xff,0x30,0x6b,0xf1,0x6a,0x81,0x42,0xb,0xd0,0x5f,0x0,0x29,0x9,
+    0xd0,0x12,0x2b,0x0,0x81,0x2b,0x0,0xfd,0x3,0x2b,0x8,0x81,0x21,0x28,0xe0,0xb1,
+    0x6a,0xff,0x72,0x6a,0x8a,0x42,0x1,0xd0,0x0,0x2a,0xff,0x18,0xd1,0x0,0x29,0x0,
+    0xd0,0x17,0xe1,0xfe,0x5f,0x0,0xd1,0xff,0xe0,0x13,0xe1,0x13,0x20,0xf7,0x0,0xe0,
+    0x11,0xd7,0x4,0xa,0x21,0x4c,0x35,0xff,0x28,0x0,0x2,0xf0,0x54,0xfb,0xf1,0xbd,
+    0x7f,0xf0,0x6a,0x30,0x63,0x70,0x6a,0xb1,0xd1,0x1,0xdf,0x0,0xd1,0xfc,0xe0,0x10,
+    0x1f,0x0,0x28,0x0,0xdf,0xa4,0x30,0x0,0x7e,0x80,0xed,0x14,0x99,0xf8,0xff,0xf1,
+    0xbd,0x70,0x6a,0xb0,0x62,0xeb,0xe0,0xff,0x20,0x79,0x20,0x74,0x81,0x7,0x89,0xf,
+    0x5f,0x3,0x29,0xa,0xd1,0xa,0x2d,0x0,0x8d,0x7f,0x0,0xff,0x2,0x20,0x0,0x90,
+    0x2b,0x0,0x63,0x33,0xff,0x0,0x22,0x8d,0x21,0xa3,0xe0,0xc,0x21,0x7f,0x1,0x40,
+    0xc,0x29,0x65,0xd0,0xda,0x2b,0x0,0x7f,0x29,0x0,0xa4,0x31,0x8,0x81,0xb,0x27,
+    0x0,0xdd,0x8e,0x27,0x14,0x8e,0x21,0x8f,0x1d,0x0,0x2a,0x0,0xff,0xa4,0x32,0x11,
+    0x89,0x40,0x7,0x43,0xd,0xff,0xb,0x43,0x13,0x81,0x91,0x8c,0x28,0x0,0xff,0xcc,
+    0x30,0x7,0x78,0x0,0x2f,0x3,0xd1,0xff,0x99,0x42,0x8,0xd2,0x1,0x21,0x7,0xe0,
+    0xff,0x8b,0x42,0x1,0xd3,0x1,0x21,0x3,0xe0,0xfb,0xd1,0x8c,0x9,0x0,0xd2,0x2,
+    0x21,0x1,0x70,0x5f,0x29,0x0,0xf7,0x31,0x8f,0x23,0x2,0xd0,0x31,0x3,0xff,0x3a,
+    0xfa,0x13,0xe0,0x9,0x78,0xc9,0x7,0xff,0x1,0xd5,0x13,0x80,0x6,0xe0,0x0,0x78,
+    0xdf,0x1,0x28,0x1,0xd1,0x0,0xe7,0x0,0x50,0x20,0xff,0x10,0x80,0xe0,0x68,0x20,
+    0x64,0x32,0x78,0xdf,0x29,0x0,0xa0,0x31,0x7,0xc5,0x1,0x40,0xf9,0x9d,0x1c,0xdb,
+    0x4,0x0,0xf0,0x4d,0xcf,0x1,0xd3,0x2,0x62,0xfd,0xf8,0x79,0x3,0x93,0xe0,0x20,
+    0x7a,0x6,0x28,0xed,0x6f,0xbb,0x1,0x6d,0xd0,0x7,0x7,0x69,0xd1,0xf0,0xff,0x6a,
+    0x31,0x6b,0x88,0x42,0x65,0xd1,0x20,0x5d,0x7c,0xcb,0x6,0x70,0xd1,0xe,0x3b,0x0,
+    0x88,0xc1,0x14,0x77,0x88,0x21,0x2e,0xdf,0x8,0xc8,0x80,0xf,0x1d,0x0,0xbd,0x89,
+    0x1d,0x14,0x89,0x21,0x1f,0xe0,0xdd,0x2,0xd0,0xff,0x88,0x21,0x79,0x9,0x2,0x1,
+    0x43,0xd1,0xeb,0x80,0xc,0x23,0x0,0x8a,0x23,0x14,0x8a,0x21,0xd,0xae,0x41,0x8,
+    0x88,0x80,0xd,0x1d,0x0,0x8b,0x1d,0x14,0x8b,0xff,0x21,0x28,0x0,0xf4,0xf7,0xd2,
+    0xff,0xf1,0xfd,0xbd,0x27,0x7,0x93,0x88,0x1,0x2,0x19,0x43,0xef,0x91,0x80,0xd2,
+    0x88,0xc3,0x2,0xfe,0xf8,0xe0,0xff,0x63,0xe0,0x68,0xa0,0x63,0x8c,0x20,0x40,0xbf,
+    0x0,0x2a,0x5c,0x29,0x0,0x98,0xe3,0x4,0xce,0x55,0xf8,0xcb,0x2,0x9,0xcb,0x0,
+    0x7,0xcb,0x8,0x3,0xcb,0x8,0xff,0xf,0xd0,0x0,0x21,0x30,0x78,0x4,0xf0,0xb7,
+    0xca,0xff,0x80,0x65,0x0,0x0,0x20,0xd9,0x7,0x80,0x7e,0x63,0x4,0xab,0xff,0x14,
+    0x20,0x5,0xe0,0x1d,0x2,0x7f,0xc9,0xff,0x0,0x28,0x2,0xd0,0x7,0x8b,0x0,0x77,
+    0xf1,0xbd,0x0,0x1b,0x0,0x0,0xf0,0x98,0xf7,0x1,0xff,0x1,0x21,0x3d,0x20,0xf4,
+    0xf7,0x35,0xfb,0xff,0xf1,0xbd,0x38,0xb5,0x4,0x0,0x20,0x7e,0xff,0x83,0x42,0x18,
+    0xd1,0x25,0x0,0x60,0x35,0xff,0xe8,0x79,0x7,0x28,0x13,0xd1,0x0,0x2a,0xff,0x1,
+    0xd0,0x10,0x68,0x1,0xe0,0x3,0xf0,0xff,0x8e,0xfc,0xe8,0x60,0x9,0x20,0xe8,0x71,
+    0xd7,0x8c,0x20,0x28,0xc7,0x4,0x23,0xc7,0x4,0x8c,0x21,0xfd,0x20,0x63,0x0,0x6e,
+    0xff,0x31,0xbd,0x80,0xb5,0xff,0x2,0x0,0x60,0x32,0xd1,0x79,0x11,0x29,0xff,0x24,
+    0xd1,0x17,0x21,0xd1,0x71,0x1,0x0,0x7f,0x3c,0x31,0x9,0x68,0x26,0x4b,0x99,0xd9,
+    0x1,0xbf,0x8,0x21,0x14,0xe0,0x5b,0x0,0x9,0x2,0x1,0xef,0x21,0xf,0xe0,0x22,
+    0x13,0x4,0x2,0x21,0xa,0xee,0x13,0x8,0x3,0x21,0x5,0x9,0x8,0x4,0x21,0x0,
+    0xff,0xe0,0x5,0x21,0x85,0x23,0x13,0x70,0x51,0xfe,0xc1,0x0,0x85,0x21,0x2a,0xe0,
+    0x13,0x29,0x2a,0xbb,0xd1,0x16,0x4d,0x8,0x89,0x68,0x15,0x39,0x4,0x0,0xaf,0x21,
+    0x19,0xe0,0x10,0x9,0x4,0x1,0x57,0xc,0x2,0xaa,0x57,0x0,0xc,0x13,0x4,0x3,
+    0x57,0xc,0x4,0x57,0xc,0x5,0xee,0x57,0x0,0x6,0x21,0x84,0x57,0x8,0x84,0x21,
+    0xf4,0xff,0xf7,0x20,0xff,0x1,0xbd,0xa0,0x86,0x1,0xff,0x0,0x20,0xa1,0x7,0x0,
+    0x70,0x11,0x1,0xbf,0x0,0x1f,0x0,0x0,0x0,0x8,0x3,0x0,0x20,0xff,0x0,0x18,
+    0x0,0x15,0x0,0x1a,0x0,0x16,0xff,0x0,0x13,0x0,0x6c,0x7,0xdc,0x5,0xc8,0xff,
+    0x0,0x96,0x0,0x5a,0x0,0x2c,0x1,0x2c,0x9d,0x1,0x1c,0x0,0x7e,0x1,0x0,0x23,
+    0x3,0x1d,0x3,0x0,0xaf,0x29,0x1,0xd0,0x8,0x17,0x5,0x2,0x17,0x31,0xe2,0xed,
+    0xfe,0x17,0x3,0x0,0x23,0xbd,0x2,0x8a,0x68,0x0,0xff,0x2a,0x0,0xd0,0x1,0x23,
+    0x9,0x68,0x0,0xff,0x29,0x2,0xd0,0x19,0x0,0x2,0x23,0xb,0xf5,0x43,0x31,0x3,
+    0x18,0xdd,0x0,0x8f,0x21,0x11,0x70,0xfd,0x53,0x99,0x0,0xf4,0xf7,0xd4,0xfe,0x1,
+    0xbd,0xff,0x74,0xb5,0x6,0x0,0xd,0x0,0x30,0x6c,0xf7,0x3e,0x49,0x88,0xbb,0x2,
+    0x24,0x0,0xe0,0xa,0xff,0x24,0x70,0x20,0x30,0x5c,0x70,0x21,0x1,0xbf,0x40,0x10,
+    0x29,0x8,0xd0,0x20,0x3,0x0,0x30,0xfa,0x3,0x0,0x60,0x3,0x0,0x70,0x29,0xa,
+    0xd0,0xc,0xff,0xe0,0x64,0x0,0xa,0xe0,0xa4,0x0,0x8,0xff,0xe0,0xe4,0x0,0x6,
+    0xe0,0x60,0x0,0x4,0xef,0x19,0x24,0x1,0x2,0x7,0x4,0x64,0x1,0x10,0xff,0x46,
+    0x28,0x43,0x1,0xd1,0x0,0x21,0x40,0xff,0xe0,0x11,0x46,0x64,0x20,0x48,0x43,0xa9,
+    0xff,0x18,0xe3,0xf7,0x19,0xfb,0xc1,0x17,0x0,0xff,0x29,0x8,0xd8,0x2d,0x28,0x6,
+    0xd2,0x26,0xff,0x4a,0x6a,0x43,0xd3,0x17,0x68,0x46,0x1,0xff,0x88,0x25,0x48,0x1f,
+    0xe0,0x25,0xa2,0xc,0xff,0xca,0x12,0x18,0x4b,0x41,0x0,0x2b,0xc,0xff,0xd8,0x13,
+    0x2a,0xa,0xd2,0x23,0x48,0x68,0xff,0x43,0xc1,0x17,0x6a,0x46,0x13,0x88,0x21,0xfb,
+    0x4a,0x5a,0x27,0x0,0x80,0x1a,0x99,0x41,0x10,0xff,0xe0,0x0,0x22,0x40,0x38,0x91,
+    0x41,0x0,0xff,0x29,0x14,0xd8,0x15,0x28,0x12,0xd2,0x1c,0xee,0x41,0xc,0x1a,0x48,
+    0x48,0x2d,0x0,0x80,0x18,0x59,0xff,0x41,0xa,0x22,0x0,0x23,0xe3,0xf7,0xbd,0xff,
+    0xfc,0x22,0x0,0x0,0x23,0xe7,0xf7,0xad,0xf7,0xff,0x1,0xe0,0x58,0x1,0x21,0x32,
+    0x0,0x70,0xff,0x32,0x52,0x6c,0xd3,0x17,0xe3,0xf7,0xb0,0xff,0xfc,0xc0,0xb,0x4a,
+    0x4,0x10,0x43,0xc9,0xff,0xb,0x9,0x2,0x2,0xe,0x11,0x43,0x0,0xf7,0x2,0xc,
+    0x4a,0x29,0x2,0x98,0xff,0x70,0x36,0xdf,0x31,0x6c,0x40,0x18,0x72,0x9b,0x5,0x4f,
+    0x45,0xff,0x0,0x0,0x33,0x2b,0x0,0x0,0xd3,0xff,0xfe,0x0,0x6,0x21,0xa7,0x0,
+    0x0,0x5c,0x4c,0x0,0xff,0x0,0x26,0x17,0x0,0x0,0xa1,0x4,0x0,0xff,0x0,0x10,
+    0x27,0x0,0x0,0xc8,0x30,0xa,0xff,0x0,0x83,0x8c,0x8b,0x42,0x5,0xd3,0x1,0xff,
+    0x8a,0x51,0x43,0x9,0x11,0x1,0x80,0xc1,0xaf,0x8a,0xd,0xe0,0xc3,0x11,0x4,0x41,
+    0x11,0x8,0x1,0xef,0x8b,0x4,0xe0,0x81,0xb,0x8,0x41,0x8b,0x4a,0xff,0x43,0x11,
+    0x11,0x41,0x80,0x81,0x8b,0x2,0x9f,0x88,0x91,0x42,0x2,0xd2,0x2f,0x0,0x1d,0x0,
+    0x1,0xfb,0x8c,0x8a,0xb,0x4,0x41,0x8c,0x41,0x80,0x70,0xff,0x47,0x70,0xb5,0x5,
+    0x0,0x2e,0x0,0xac,0xff,0x36,0x31,0x88,0x2c,0x0,0xf0,0x34,0x60,0xff,0x89,0x8,
+    0x1a,0x0,0xd5,0x40,0x42,0x22,0xff,0x88,0x82,0x42,0x6,0xdb,0x1,0x20,0x20,0xff,
+    0x72,0x61,0x81,0x28,0x0,0xff,0xf7,0xc2,0xfa,0xd5,0x0,0x2,0xd,0x0,0x30,0x88,
+    0xa0,0x81,0x8,0xff,0x20,0xee,0xf7,0x34,0xfd,0x28,0x0,0x3c,0xbf,0x30,0x0,0x21,
+    0x81,0x60,0x2,0xe9,0x1,0x4,0xff,0xd1,0x40,0x68,0x0,0x28,0x1,0xd1,0x6,0xff,
+    0x20,0x0,0xe0,0x7,0x20,0x68,0x35,0x28,0xff,0x70,0x61,0x72,0x70,0xbd,0x80,0xb5,
+    0x68,0xff,0x21,0x41,0x5c,0x8,0x29,0x6,0xd0,0x7,0xff,0x29,0x22,0xd1,0x2,0x0,
+    0xc8,0x32,0x13,0xff,0x79,0x0,0x2b,0x8,0xd1,0x1,0x0,0x8b,0xff,0x31,0x0,0x22,
+    0xa,0x70,0xca,0x70,0xff,0x7f,0x22,0x8a,0x71,0x7,0x22,0x13,0xe0,0x11,0x2,0xfd,
+    0x1,0x19,0x0,0xff,0x23,0xb,0x70,0x7,0x23,0xff,0xcb,0x70,0x53,0x88,0x8b,0x71,
+    0x52,0x88,0xff,0x12,0xa,0x6,0xe0,0x13,0x88,0xb,0x70,0xdd,0x12,0x9,0x0,0xca,
+    0x70,0x0,0x2b,0x0,0x4a,0x72,0xff,0x4,0x22,0x1,0x0,0x89,0x31,0xf4,0xf7,0xff,
+    0xe1,0xfd,0x1,0xbd,0x0,0x21,0x3,0x22,0xff,0x1,0x60,0x0,0x1d,0x52,0x1e,0xfb,
+    0xd1,0xfb,0x70,0x47,0xd,0x16,0x30,0xb4,0x0,0x21,0x0,0xff,0x22,0x3,0x0,0x1c,
+    0x0,0x3,0x25,0x21,0xef,0x60,0x24,0x1d,0x6d,0x15,0x0,0x52,0x1c,0xc,0x7f,0x33,
+    0x3,0x2a,0xf5,0xdb,0x30,0xbc,0x2d,0x1e,0xff,0x3,0x23,0x3,0x24,0xd,0x68,0x5,
+    0x60,0xff,0x9,0x1d,0x0,0x1d,0x64,0x1e,0xf9,0xd1,0xef,0x5b,0x1e,0xf6,0xd1,0x27,
+    0x2,0xf0,0xb5,0x8d,0xff,0xb0,0x4,0x0,0xd,0x0,0x26,0x68,0xf7,0xff,0x17,0x30,
+    0x0,0x39,0x0,0x32,0x0,0x3b,0xff,0x0,0xe3,0xf7,0xc7,0xfb,0xc0,0xf,0x4a,0xff,
+    0x0,0x10,0x43,0x2,0x90,0xa,0xaa,0x60,0xdf,0x68,0xc1,0x17,0x3,0xc2,0x1b,0x2,
+    0xa,0xaa,0xdf,0xc,0xca,0xe3,0xf7,0xb9,0x1b,0x8,0x7,0x90,0x57,0x8,0xaa,0xa0,
+    0x1b,0xc,0x8,0x1b,0x4,0xab,0x1b,0x8,0x5f,0x6,0x90,0x4,0xaa,0xe0,0x1b,0xc,
+    0x4,0x1b,0x4,0xfd,0x9d,0x1b,0x8,0x3,0x90,0xa,0xa8,0x3,0xc8,0x4a,0x4b,0x6,
+    0x93,0x13,0x8,0x1,0x13,0x4,0x43,0x6,0x89,0x13,0x8,0xd3,0x4,0x0,0x13,0x2,
+    0x3b,0x6,0x7f,0x73,0xa,0x0,0x8,0x9a,0x27,0xc,0x75,0x13,0x8,0x0,0x90,0x13,
+    0x2,0x27,0x6,0x6b,0xd6,0x7f,0xa,0x0,0x4,0x13,0xc,0x61,0xcb,0xa,0x99,0x1,
+    0xff,0x9a,0x89,0x18,0x0,0x9a,0x89,0x1a,0x9,0xff,0x1a,0x49,0x11,0x29,0x60,0x3,
+    0x9a,0xa1,0xff,0x1a,0x9,0x11,0x69,0x60,0x6,0x9a,0xb9,0xff,0x18,0x9,0x11,0xa9,
+    0x60,0x3,0x99,0x64,0x5f,0x18,0x21,0x11,0xe9,0x60,0x27,0x4,0x1a,0x27,0x0,0xbd,
+    0x18,0x27,0x4,0x61,0x7,0x9a,0xb1,0x27,0x2,0x61,0xff,0x6,0x99,0x7f,0x1a,0x39,
+    0x11,0xa9,0x61,0xff,0x7,0x99,0x76,0x18,0x31,0x11,0xe9,0x61,0xfe,0x27,0xc,0x1a,
+    0x9,0x18,0x48,0x11,0x28,0x62,0xff,0xd,0xb0,0xf0,0xbd,0xf5,0xb5,0x83,0xb0,0xff,
+    0xe,0x0,0x2,0x90,0x3,0x27,0x0,0x20,0xff,0x0,0x21,0x4,0x9c,0x3,0x25,0x0,
+    0x90,0xf7,0x1,0x91,0x30,0x9,0x1,0x22,0x68,0xd3,0x17,0xff,0xe3,0xf7,0x1b,0xfb,
+    0x0,0x9a,0x1,0x9b,0xbf,0x80,0x18,0x59,0x41,0xc,0x36,0xb3,0x3,0xef,0xdf,0xd1,
+    0x40,0xc,0xca,0x3,0x9b,0x2,0x8,0x60,0xff,0x2,0x98,0x0,0x1d,0x2,0x90,0x20,
+    0x3e,0x7f,0x7f,0x1e,0xe0,0xd1,0x3,0x98,0x5,0x4d,0x0,0xff,0xf2,0xb5,0x7,0x0,
+    0x15,0x0,0x3e,0x0,0xff,0x3,0x24,0x2a,0x0,0x0,0x99,0x30,0x0,0xff,0x6,0xf0,
+    0x7b,0xfb,0xc,0x36,0xc,0x35,0xfd,0x64,0xbb,0x1,0x38,0x0,0xf2,0xbd,0xf8,0xb5,
+    0xff,0x6,0x0,0xc,0x0,0x17,0x0,0x9,0x25,0xff,0x20,0x0,0xe4,0xf7,0x4b,0xfe,
+    0x28,0x1a,0xff,0xc1,0x7,0xc9,0xf,0x45,0x18,0x8,0x20,0xff,0x41,0x1b,0x20,0x0,
+    0xe2,0xf7,0xc3,0xfb,0xff,0x39,0x0,0xe5,0xf7,0xef,0xf8,0x5,0x21,0xff,0xc9,0x43,
+    0x6a,0x10,0x89,0x1a,0xe2,0xf7,0xdf,0xba,0xfb,0x30,0x60,0x30,0x39,0x0,0xf0,0xb4,
+    0xff,0x3a,0x48,0x3a,0x49,0x1,0x60,0x95,0x4c,0xff,0x44,0x60,0x95,0x49,0x81,0x60,
+    0xc1,0x60,0xff,0x1,0x61,0x44,0x61,0x81,0x61,0x93,0x4a,0xff,0xc2,0x61,0x1,0x62,
+    0x41,0x62,0x81,0x62,0xff,0x92,0x4b,0xc3,0x62,0x1,0x63,0x91,0x4e,0xff,0x46,0x63,
+    0xfd,0x25,0xad,0x5,0x85,0x63,0xff,0x90,0x4f,0xc7,0x63,0x1,0x64,0x8f,0x4b,0xff,
+    0x43,0x64,0x81,0x64,0xc6,0x64,0x3,0x65,0xff,0x8e,0x4b,0x43,0x65,0x81,0x65,0x0,
+    0x23,0xff,0xc3,0x65,0x6,0x66,0x41,0x66,0x81,0x66,0xff,0xc1,0x66,0x8a,0x4e,0x6,
+    0x67,0x41,0x67,0xff,0xfa,0x26,0xb6,0x5,0x86,0x67,0x88,0x4e,0xff,0xc6,0x67,0x80,
+    0x26,0x87,0x51,0x6,0x0,0xff,0x84,0x36,0x34,0x60,0x86,0x4c,0x74,0x60,0xdf,0xb5,
+    0x60,0x85,0x4c,0xf4,0x3,0x0,0x34,0x61,0xff,0x85,0x4d,0x75,0x61,0xb5,0x61,0xf5,
+    0x61,0x7f,0x34,0x62,0x73,0x62,0x83,0x4c,0xb4,0x3,0x0,0xff,0xf4,0x62,0x34,0x63,
+    0x74,0x63,0x82,0x4d,0xf7,0xb5,0x63,0xf1,0x5,0x0,0x35,0x64,0x82,0x49,0xfd,0x71,
+    0x3,0x0,0xb1,0x64,0xf4,0x64,0x81,0x4f,0xff,0x37,0x65,0x73,0x65,0xb5,0x65,0x80,
+    0x4d,0xff,0xf5,0x65,0xc5,0x4d,0x35,0x66,0x74,0x66,0xdf,0xb3,0x66,0xc4,0x4b,0xf3,
+    0x3,0x0,0x33,0x67,0xff,0x74,0x67,0xb4,0x67,0xc3,0x4c,0xf4,0x67,0xff,0x82,0x24,
+    0x64,0x0,0x0,0x19,0x3,0x60,0xdf,0x42,0x60,0xc1,0x4a,0x82,0xc9,0x0,0xc0,0x49,
+    0xdf,0x1,0x61,0xc0,0x49,0x41,0x3,0x0,0x81,0x61,0xff,0xf0,0xbc,0x70,0x47,0x3c,
+    0x3a,0x0,0x20,0xff,0x66,0x66,0x26,0x3f,0x10,0xb5,0x4,0x0,0xff,0x34,0x30,0x0,
+    0x21,0x1,0x60,0x81,0x60,0xaf,0x20,0x0,0x40,0x30,0x7,0x6,0x54,0x7,0x4,0xc1,
+    0xff,0x60,0x92,0x20,0x80,0x0,0x20,0x18,0x1,0xef,0x60,0x41,0x60,0x94,0x9,0x4,
+    0x6,0xf0,0xee,0xfb,0xfa,0xa7,0x9,0x4,0xec,0xf7,0x94,0xfd,0xb7,0xfb,0x20,0xc0,
+    0x9,0x0,0xef,0xf7,0xe4,0xfa,0xbe,0xfe,0x9,0x4,0x6,0xf0,0x93,0xfc,0x20,0x0,
+    0x10,0xfb,0xbd,0xf4,0x53,0x0,0xf,0x0,0x0,0x25,0x65,0xff,0x70,0x25,0x70,0x0,
+    0x20,0xc0,0x43,0x60,0xfb,0x61,0xe0,0x1f,0x6,0x21,0x5,0x60,0x0,0x1d,0xff,0x49,
+    0x1e,0xfb,0xd1,0xfe,0x20,0x80,0x5,0xff,0x9f,0x49,0x60,0x50,0x5,0x20,0xd,0x31,
+    0xd7,0x60,0x54,0xdf,0x1d,0x4,0x1,0x83,0x0,0x9b,0x49,0xff,0x41,0x60,0x0,0x2f,
+    0x4,0xd1,0x0,0x99,0xff,0x20,0x0,0x0,0xf0,0x3d,0xfc,0xf2,0xbd,0xfd,0x91,0x6d,
+    0x0,0x26,0x18,0x78,0x68,0x0,0x28,0xf7,0xf,0xd0,0x70,0x5,0x0,0x3,0xd0,0x1,
+    0x68,0x7f,0x9,0x68,0x88,0x47,0x75,0x60,0xb0,0xd,0x0,0xff,0x17,0xd1,0x20,0x0,
+    0x64,0x30,0x13,0xd0,0x3f,0xec,0xf7,0x5,0xf8,0x10,0xe0,0x11,0x2,0x1f,0xa,0xeb,
+    0xb5,0x60,0x2d,0x2,0x7,0x1f,0x4,0x1,0xd0,0x7,0xff,0xf0,0x93,0xf8,0x70,0x60,
+    0x0,0xe0,0xb0,0xfe,0x15,0x4,0x0,0xd0,0x1,0x25,0xe5,0x70,0xe1,0xff,0x78,0x0,
+    0x29,0x0,0xd1,0xb0,0x68,0x30,0xff,0x60,0x39,0x1d,0x2,0x68,0x92,0x68,0x90,0xff,
+    0x47,0x0,0x28,0x25,0xd1,0x0,0x9a,0x39,0xf7,0x0,0xc,0x31,0xed,0xa,0x88,0xfa,
+    0x0,0x28,0xed,0x1b,0x13,0x4,0x14,0x31,0xf7,0xa,0xc4,0xfd,0x0,0x7f,0x28,0x11,
+    0xd1,0x39,0x0,0x74,0x31,0xff,0xa,0xb5,0x79,0x25,0x0,0x8,0x11,0x0,0x7c,0x31,
+    0x7,0xb,0x27,0xbf,0xfc,0x0,0x28,0x2,0xd0,0x3,0xfb,0x0,0xf2,0xff,0xbd,0x38,
+    0x68,0xa0,0x61,0x0,0x20,0xf2,0xff,0xbd,0x0,0x0,0xcd,0xcc,0x4c,0x3d,0xa,0x7f,
+    0xd7,0xa3,0x3c,0x33,0x33,0x33,0x3f,0x7,0x0,0xfe,0xb,0x0,0x23,0x3d,0xec,0x51,
+    0xb8,0x3d,0xcd,0xfb,0xcc,0xcc,0x3,0x0,0x4c,0x3f,0x9a,0x99,0x59,0xfe,0x3,0x0,
+    0x19,0x3e,0x29,0x5c,0x8f,0x3d,0x8f,0xff,0xc2,0xf5,0x3d,0xc3,0x64,0xaa,0x3b,0xe7,
+    0xff,0x1d,0xa7,0x3b,0xe3,0xa5,0x3b,0x3f,0x30,0xff,0x4c,0xa6,0x3c,0x56,0x9f,0xab,
+    0x3d,0x56,0xff,0x9f,0x2b,0x3d,0x1c,0xeb,0x42,0x3f,0xec,0xff,0x2f,0xbb,0x3d,0xf4,
+    0x6c,0xd6,0x3d,0x3b,0xff,0xdf,0xcf,0x3d,0xfa,0xb5,0x8d,0xb0,0x4,0xff,0x0,0x17,
+    0x0,0x0,0x20,0x20,0x70,0x4b,0xff,0x4d,0x65,0x62,0xa5,0x62,0xd,0x98,0x1,0xff,
+    0x68,0xff,0x20,0xfc,0x30,0x8,0x40,0xd,0xff,0x99,0x8,0x60,0x0,0xf0,0x4,0xfc,
+    0x20,0xff,0x70,0x41,0x1e,0x89,0x41,0xc9,0x43,0xc9,0xff,0xf,0x61,0x70,0x20,0x78,
+    0x69,0x46,0xc2,0xbf,0x7,0xd2,0xf,0xca,0x70,0x82,0x5,0x0,0xa,0xfb,0x70,0x2,
+    0x5,0x0,0x8a,0x70,0x41,0x7,0xc9,0xff,0xf,0x6a,0x46,0xc3,0x6,0xdb,0xf,0x53,
+    0x7f,0x70,0x68,0x46,0x0,0x78,0xa0,0x70,0xdf,0x6,0xff,0x0,0x29,0x9,0xd0,0x3a,
+    0x0,0x61,0x6a,0xff,0xef,0xf7,0x1e,0xfa,0x6,0x0,0x20,0x0,0xff,0x24,0x30,0xef,
+    0xf7,0xfc,0xfa,0x3,0xe0,0xdf,0x3a,0x0,0xef,0xf7,0x15,0x11,0x0,0x0,0x2e,0xbf,
+    0x1,0xd0,0x30,0x0,0x44,0xe0,0xa9,0x3,0x20,0xff,0x58,0x69,0x46,0xc9,0x78,0x2,
+    0x68,0xd2,0xee,0x4d,0x1,0x68,0x46,0x2,0x67,0x0,0x89,0x78,0x11,0xfd,0x43,0x4d,
+    0xb,0xe,0xfa,0x68,0x46,0x1,0x78,0x7e,0x47,0xb,0x12,0xfe,0x68,0x46,0x41,0x78,
+    0x31,0x7,0xff,0x1,0x71,0xc0,0x46,0x38,0x68,0x1,0x28,0xff,0x0,0xda,0x3d,0x60,
+    0x68,0x46,0x40,0x78,0x7f,0x0,0x28,0x5,0xd0,0xe,0x98,0x0,0x11,0x0,0xff,0x1,
+    0xda,0xe,0x98,0x5,0x60,0xe,0x9b,0xff,0x3a,0x0,0x0,0x21,0x20,0x0,0x0,0xf0,
+    0xff,0xc8,0xfb,0x23,0x0,0x28,0x33,0x22,0x0,0xf7,0x24,0x32,0x1,0xf,0x4,0xc0,
+    0xfb,0xd,0x98,0xff,0x0,0x90,0x1,0xab,0x0,0x22,0x2,0xa9,0xfe,0xf,0x2,0x19,
+    0xf8,0x0,0x20,0xf,0xb0,0xf0,0xef,0xbd,0x57,0xec,0x4f,0x63,0x1,0x23,0x3e,0x7a,
+    0xff,0x36,0xab,0x3c,0x4,0xe7,0x5c,0x3f,0xd3,0xff,0xde,0x20,0x3e,0xa9,0x13,0x50,
+    0x3d,0xe0,0xff,0x9c,0x91,0x3d,0x6c,0x9,0x49,0x3f,0x14,0xff,0x7,0x0,0x0,0x8f,
+    0xc2,0x75,0x3d,0xff,0xff,0xff,0xff,0x7f,0x81,0xb0,0x81,0x69,0x19,0xff,0x60,0x1,
+    0x99,0x0,0x22,0xa,0x60,0x2,0xbf,0x78,0xd2,0x7,0x1,0xd5,0xd8,0x9,0x4,0x92,
+    0xff,0x7,0x3,0xd5,0xa,0x68,0x12,0x23,0x13,0xab,0x43,0xb,0xd,0x0,0x12,0xd,
+    0x4,0x10,0xd,0x8,0x52,0xfa,0xd,0x4,0x20,0xd,0x4,0x0,0x78,0xc0,0x6,0x4,
+    0xff,0xd5,0x8,0x68,0x80,0x22,0x52,0x0,0x2,0xdf,0x43,0xa,0x60,0x8,0x68,0xfd,
+    0x3,0x1,0x22,0xfe,0xb,0x2,0x0,0x20,0x1,0xb0,0x70,0x47,0x70,0xbf,0xb5,0x4,
+    0x0,0x15,0x0,0x60,0xd7,0x0,0x45,0xff,0xd0,0x8,0x68,0x62,0x6a,0x82,0x42,0x9,
+    0xff,0xdb,0x0,0x28,0x7,0xd0,0x22,0x78,0xd2,0xff,0x6,0x9,0xd5,0xa2,0x6a,0xaa,
+    0x42,0x1,0xff,0xdb,0x0,0x2d,0x4,0xd1,0x0,0x20,0x60,0xff,0x70,0x17,0x20,0xc0,
+    0x43,0x70,0xbd,0x20,0xbd,0x62,0x7d,0x7,0xef,0xf7,0x79,0xf9,0x59,0x7,0x21,0x7d,
+    0x6a,0x57,0x1,0x69,0x90,0x47,0x21,0x6a,0x4f,0xb,0xef,0xe2,0xf9,0x21,0x6a,0x4d,
+    0xb,0xce,0xfd,0x29,0xfd,0x0,0x4b,0x7,0x6,0xf0,0x31,0xfb,0x25,0x6a,0xff,0xe5,
+    0x61,0xa0,0x69,0xea,0xf7,0x22,0xf9,0xff,0x6,0x0,0x28,0x0,0xea,0xf7,0x1e,0xf9,
+    0xff,0x1,0x0,0x30,0x0,0xe8,0xf7,0x5c,0xfd,0xff,0x7,0xf0,0xe7,0xfa,0xed,0xf7,
+    0x52,0xfb,0xfd,0x60,0x99,0x0,0xa0,0x60,0x70,0xbd,0xf4,0xb5,0x7f,0x86,0xb0,0x4,
+    0x0,0xd,0x0,0x1e,0x9d,0x4,0xff,0x0,0xd1,0xe7,0xe0,0x0,0x27,0xc,0x99,0xff,
+    0xf,0x70,0x0,0x2d,0x4a,0xd0,0x28,0x78,0xdf,0xc0,0x7,0x47,0xd5,0x20,0x5,0x0,
+    0x10,0xd5,0xbf,0x6,0x98,0x0,0x28,0xd,0xd0,0x89,0x6,0x29,0xcf,0x0,0x2,0x68,
+    0x52,0x89,0x0,0xd,0x6,0x6,0x99,0xf7,0x2,0x68,0x92,0xd,0x0,0x3,0x23,0x4,
+    0x22,0xff,0x66,0x49,0x1,0xa8,0xe7,0xf7,0xaa,0xfb,0xff,0x18,0x21,0x28,0x69,0xe6,
+    0xf7,0x33,0xff,0xdf,0x1,0x90,0x18,0x21,0x68,0x9,0x0,0x2e,0xff,0xf5,0x2,0x9,
+    0x0,0xa8,0x9,0x0,0x29,0xff,0x3,0x90,0x7b,0x29,0x0,0xc1,0xa,0x9,0xf9,0x29,
+    0x0,0xc1,0xa,0xff,0xe,0xfd,0x6b,0x46,0x22,0x0,0x4c,0x32,0xfb,0x29,0x0,0xf9,
+    0xa,0x39,0xf9,0x60,0x69,0x0,0xff,0x21,0xc9,0x43,0x88,0x42,0x1,0xd1,0x68,0xff,
+    0x68,0x60,0x61,0xa0,0x68,0x40,0x1c,0xa0,0xff,0x60,0xa0,0x68,0x61,0x68,0x88,0x42,
+    0x0,0xff,0xd0,0x92,0xe0,0xa7,0x60,0x20,0x0,0x14,0xff,0x30,0x69,0x68,0x2,0x68,
+    0x8a,0x1a,0x0,0xf7,0x92,0x1,0x60,0x27,0x9,0x0,0x2c,0x31,0x2,0xbb,0x68,0x12,
+    0x29,0x3,0x0,0x34,0x31,0x69,0xa,0x62,0xdf,0xf9,0x21,0x0,0x40,0x31,0x6b,0x6,
+    0xed,0xf7,0xfb,0x93,0xfa,0x63,0xa,0x8d,0xf9,0x4c,0x21,0x60,0xdf,0x54,0x21,0x0,
+    0x54,0x31,0x3d,0xb,0x78,0xfb,0xff,0x20,0x0,0x2c,0x30,0x0,0x7b,0x69,0x46,0xfb,
+    0x8,0x74,0x9,0x4,0x7e,0x48,0x74,0x2c,0x20,0x3f,0x27,0x5c,0x68,0x46,0x0,0x7c,
+    0xb3,0x3,0x7,0x2,0xff,0x3,0x28,0x3,0xd0,0x0,0x2f,0x1,0xd0,0xff,0x1,0x2f,
+    0x1,0xd1,0x1,0x20,0x4,0xe0,0xf7,0x68,0x46,0x40,0x1b,0x0,0x3,0xd1,0x2,0x20,
+    0xff,0xdf,0x21,0xc9,0x0,0x60,0x50,0x0,0x98,0xff,0xea,0xf7,0x70,0xf8,0x1,0x0,
+    0xa7,0x48,0x7f,0xe8,0xf7,0xa3,0xf9,0x5,0x90,0xe0,0x5b,0x4,0xf7,0x3,0x90,0xdf,
+    0x7,0x2,0x58,0x2,0x90,0x4c,0xff,0x20,0x20,0x5c,0x1,0x90,0x5,0xa8,0x0,0xff,
+    0x90,0x3b,0x0,0x68,0x46,0x42,0x7c,0x1,0xff,0x7c,0x20,0x0,0x0,0xf0,0x56,0xf8,
+    0x9c,0xff,0x48,0x9c,0x49,0x61,0x5c,0x40,0x5c,0x30,0xfb,0x71,0x2c,0x21,0x0,0x0,
+    0x28,0x1,0xd1,0x8,0xaf,0x20,0x8,0xe0,0x1,0x7,0x0,0x7,0x65,0x0,0x2,0xfe,
+    0x7,0x0,0x3,0x20,0x0,0xe0,0x4,0x20,0x70,0xef,0x71,0x70,0x79,0x20,0x9d,0x0,
+    0x0,0xf0,0x27,0xbf,0xf9,0x30,0x0,0xc,0x30,0xe3,0x75,0x0,0x61,0xff,0x18,0x9,
+    0x22,0xb,0x78,0x3,0x70,0x49,0xbf,0x1c,0x40,0x1c,0x52,0x1e,0xf9,0x31,0x1,0x30,
+    0xfe,0xe3,0x1,0x0,0xe0,0x3,0x20,0x7,0xb0,0xf0,0xff,0xbd,0x6b,0xca,0x0,0x0,
+    0x10,0xb5,0x3,0xff,0x7c,0xbe,0x24,0xe4,0x0,0x0,0x19,0x6,0xff,0xf0,0x2b,0xfa,
+    0x0,0x20,0x10,0xbd,0x0,0xbf,0xbf,0xff,0x21,0xfc,0x31,0x1,0x27,0x0,0x70,0xff,
+    0x47,0x0,0x29,0x11,0xd0,0x3,0x29,0x1,0x3d,0xd1,0x5d,0x0,0x47,0x1,0x2b,0x1,
+    0xcb,0x0,0x13,0x0,0xaa,0x7,0x0,0x3,0x7,0x0,0x3,0x7,0x0,0x1,0xf,0x2,
+    0x2a,0xeb,0x1,0xd1,0x2b,0x2,0x5,0x3,0x0,0xf1,0xb5,0xd6,0xff,0xb0,0xf,0x0,
+    0x16,0x0,0x1d,0x0,0x5c,0xff,0x98,0x0,0x68,0xac,0x49,0xe7,0xf7,0x1f,0xff,0xff,
+    0x0,0xd2,0xd2,0xe0,0xec,0xf7,0x35,0xff,0xfa,0xea,0xf7,0x1,0xf8,0xc4,0xb2,0x2,
+    0xff,0x2c,0x1,0xda,0x1,0x24,0x2,0xe0,0x3c,0xff,0x2c,0x0,0xdb,0x3c,0x24,0x2b,
+    0x0,0x32,0xff,0x0,0x39,0x0,0x56,0x98,0xff,0xf7,0xca,0xff,0xff,0x1,0x90,0x56,
+    0x98,0xa1,0x49,0x45,0xf7,0x18,0x5d,0x98,0xe3,0x0,0xd0,0x9f,0x4a,0x9,0xef,0xe0,
+    0x29,0x68,0x9f,0x2b,0x1,0xd,0xf9,0x2,0xfb,0x0,0x9e,0x49,0x0,0xfa,0xfe,0x0,
+    0xd2,0xa,0xff,0x0,0x2a,0x60,0x0,0x94,0xfe,0x26,0xb6,0xff,0x5,0x30,0x0,0x11,
+    0x0,0xe7,0xf7,0x98,0xff,0xfe,0x4,0x0,0x0,0x9d,0x0,0x2d,0x1,0xff,0xd5,0x68,
+    0x42,0x5,0x0,0x37,0x0,0x4,0xff,0xe0,0x20,0x0,0x21,0x0,0xe8,0xf7,0xf3,0xff,
+    0xf8,0x4,0x0,0xe8,0x7,0x4,0xd5,0x38,0xfe,0xd,0x4,0xec,0xf8,0x7,0x0,0x6d,
+    0x8,0xf1,0xeb,0xd1,0x0,0x59,0x0,0xc,0x13,0x0,0x0,0x21,0xe7,0xff,0xf7,0xe7,
+    0xfe,0x2,0xd1,0xff,0x27,0xff,0xef,0x5,0x4,0xe0,0x30,0x81,0x0,0xe8,0xf7,0xd9,
+    0xf7,0xfb,0x7,0x0,0x9,0x2,0xe7,0xf7,0x6e,0xfe,0xff,0xb6,0x49,0xe8,0xf7,0xd1,
+    0xfb,0x0,0x21,0xff,0x32,0xaa,0x6,0x24,0x13,0x0,0x6,0x25,0xff,0x18,0x60,0x1b,
+    0x1d,0x6d,0x1e,0xfb,0xd1,0xff,0x49,0x1c,0x18,0x32,0x6,0x29,0xf5,0xdb,0xff,0x32,
+    0xa8,0x6,0x21,0x7,0x60,0x1c,0x30,0xfd,0x49,0x13,0x0,0x5f,0x9a,0x32,0xa9,0x8,
+    0xa8,0xff,0x7,0xf0,0x5f,0xf9,0x5f,0x98,0x8,0xa9,0xff,0x18,0x22,0xe2,0xf7,0x22,
+    0xfb,0xa7,0x48,0xff,0x5e,0x99,0x1,0x29,0xe,0xa9,0xa,0xd1,0xff,0x6,0x22,0x6,
+    0x23,0x5,0x68,0xd,0x60,0xdf,0x0,0x1d,0x9,0x1d,0x5b,0x7f,0x1,0x52,0x1e,0xbf,
+    0xb,0xd0,0xf5,0xe7,0x90,0x30,0x17,0x1e,0xf6,0xff,0xd1,0x2,0xa8,0xe,0xa9,0x1,
+    0x9a,0x53,0xff,0x0,0x9a,0x18,0xd2,0x0,0x89,0x18,0x6,0xff,0x22,0xb,0x68,0x3,
+    0x60,0x9,0x1d,0x0,0xfd,0x1d,0xb7,0x3,0x0,0x25,0x5f,0x9e,0x2,0xaf,0xff,0x31,
+    0x68,0x38,0x68,0xe8,0xf7,0x85,0xf8,0xff,0x30,0x60,0x6d,0x1c,0x3f,0x1d,0x36,0x1d,
+    0xff,0x6,0x2d,0xf5,0xdb,0x0,0x26,0x5f,0x9f,0x7f,0x38,0x68,0x40,0x0,0x40,0x8,
+    0x31,0xbb,0x0,0xff,0xd8,0xfd,0x6,0x0,0x3f,0x1d,0x64,0x1e,0xeb,0xf5,0xd1,0x15,
+    0x2,0x31,0xd7,0x0,0x6d,0xfb,0x38,0x7b,0x60,0x64,0x2d,0x0,0x6,0x2c,0xf6,0xdb,
+    0xf9,0x1,0xff,0x22,0x5f,0x9b,0x56,0x99,0x8,0x4c,0xc,0xff,0x19,0x19,0x68,0xe7,
+    0xf7,0x51,0xfe,0x1,0xff,0xd2,0x8,0x0,0x22,0x70,0x52,0x1c,0x1b,0xff,0x1d,0x6,
+    0x2a,0xf5,0xdb,0x57,0xb0,0xf0,0xff,0xbd,0xbd,0x37,0x86,0x35,0x30,0x9c,0x2,0xff,
+    0x0,0x21,0x7,0x0,0x0,0x0,0x1,0x7,0x7b,0x8,0x3,0x60,0x1,0xf0,0xb5,0x83,
+    0xb0,0xe,0x0,0xff,0x20,0x0,0x90,0x1,0xac,0xe0,0x20,0xc0,0xff,0x0,0x3e,0x18,
+    0x6,0x25,0x31,0x68,0x6f,0xfe,0x9b,0x1,0x3f,0xf8,0x0,0x21,0xe8,0xf7,0xff,0xff,
+    0xf9,0x2,0xd8,0xfc,0x21,0x89,0x5,0x1,0xff,0xe0,0xbf,0x21,0x9,0x6,0xe7,0xf7,
+    0x95,0xff,0xfd,0xec,0xf7,0x3d,0xf9,0xe9,0xf7,0x9,0xff,0xff,0x20,0x70,0x0,0x98,
+    0x21,0x78,0x40,0xff,0x18,0xc0,0xb2,0x0,0x90,0x36,0x1d,0x64,0xff,0x1c,0x6d,0x1e,
+    0xe2,0xd1,0x64,0x38,0x1e,0xff,0xd0,0x61,0x49,0x7c,0x18,0xa1,0x79,0x5,0xff,0x29,
+    0x6,0xd0,0x1,0xa9,0x4a,0x79,0x90,0xff,0x42,0x2,0xda,0x10,0x1a,0x48,0x71,0x12,
+    0xff,0xe0,0x0,0x22,0x1,0xa9,0xa3,0x79,0x9a,0xff,0x42,0x8,0xd0,0xb,0x78,0x98,
+    0x42,0x5,0xff,0xda,0x1,0xa9,0x89,0x18,0xa,0x78,0x10,0xff,0x1a,0x8,0x70,0x4,
+    0xe0,0x52,0x1c,0xd2,0xff,0xb2,0x49,0x1c,0x6,0x2a,0xee,0xdb,0x1b,0xff,0xa0,0x1,
+    0xa9,0x6,0x22,0xe3,0x25,0xed,0xff,0x0,0xb,0x78,0x4,0x78,0x3c,0x19,0x63,0xff,
+    0x55,0x49,0x1c,0x40,0x1c,0x52,0x1e,0xf7,0xff,0xd1,0xe8,0x1c,0x3c,0x18,0xe0,0x78,
+    0x21,0xff,0x79,0x40,0x18,0x20,0x70,0x4c,0x37,0x38,0xff,0x78,0x64,0x21,0x48,0x43,
+    0xa0,0x70,0x79,0x7f,0x69,0x44,0x48,0xe7,0xf7,0xe9,0xff,0xab,0x2,0xf5,0xa9,0xab,
+    0x18,0x3f,0xab,0x0,0xe7,0xf8,0xe9,0xf7,0xdf,0xb3,0xfe,0x60,0x71,0x3,0xff,0x0,
+    0x1,0x0,0xff,0x0,0x34,0xfc,0x6,0x0,0x0,0xcd,0xcc,0xff,0xcc,0x3e,0x33,0x33,
+    0x73,0x3f,0x8f,0xc2,0x3f,0x75,0x3d,0x1,0x2,0x6,0x7,0x6,0x1,0x7,0x1,0xff,
+    0xa3,0xb0,0x4,0x0,0xf,0x0,0x0,0x25,0xff,0x0,0x95,0x4,0x20,0x1,0x90,0x4,
+    0xa8,0xff,0x5,0xf0,0x95,0xfe,0xb,0xa8,0xec,0xf7,0xff,0x18,0xfa,0x2,0xa8,0xee,
+    0xf7,0x6e,0xfe,0xff,0x6,0xa8,0x6,0xf0,0x59,0xf8,0x91,0x20,0xff,0x80,0x0,0x26,
+    0x18,0xb0,0x68,0x0,0x28,0xff,0x3,0xd0,0x1,0x68,0x9,0x68,0x88,0x47,0xf7,0xb5,
+    0x60,0x70,0xd,0x0,0x5,0xd1,0x20,0x0,0xff,0x64,0x30,0x1,0xd0,0x6,0xf0,0x56,
+    0xfc,0xfd,0x70,0x11,0x4,0x0,0xd0,0x1,0x25,0xe5,0x70,0xff,0xe1,0x78,0x0,0x29,
+    0x0,0xd1,0xb0,0x68,0xff,0x30,0x60,0x69,0x46,0x2,0x68,0x92,0x68,0xff,0x90,0x47,
+    0x0,0x28,0x21,0xd1,0x3a,0x0,0xf7,0x4,0xa9,0x94,0x49,0x0,0x20,0x18,0x5,0xf0,
+    0xdf,0x4e,0xfe,0x0,0x28,0x18,0x11,0x0,0xb,0xa9,0xfd,0xa7,0x11,0x4,0xec,0xf7,
+    0x8b,0xf9,0x0,0x28,0xdf,0xf,0xd1,0x2,0xa9,0xb7,0x8f,0x1,0x20,0x18,0xf7,0xee,
+    0xf7,0x41,0x21,0x0,0x7,0xd1,0x6,0xa9,0xfd,0xbe,0xf,0x4,0x5,0xf0,0xf0,0xff,
+    0x0,0x28,0xff,0x2,0xd0,0x3,0x20,0xc0,0x43,0x2,0xe0,0x7f,0x6,0x48,0xa0,0x61,
+    0x0,0x20,0x23,0xdd,0x0,0xbe,0xc4,0x0,0x0,0xa0,0x40,0x3c,0x3a,0xcb,0x1,0x0,
+    0xf7,0xc8,0x42,0x1b,0xd4,0x1,0x40,0x42,0xf,0x0,0xfe,0xf3,0x0,0x20,0x0,0x29,
+    0x23,0xd0,0xc8,0x22,0xfb,0xa,0x40,0x91,0x0,0x20,0x8a,0x6,0x2,0xd5,0xff,0x2,
+    0x0,0x4,0x20,0x10,0x43,0x2,0x22,0xfb,0x11,0x42,0x45,0x0,0x0,0x2,0x20,0x18,
+    0x43,0xf5,0x10,0xb,0x8,0x8,0xb,0x0,0xc9,0x5,0x2,0xd5,0xff,0x1,0x0,0x10,
+    0x20,0x8,0x43,0x1,0x0,0xf7,0x11,0x42,0x1,0x33,0x0,0x8,0x43,0xc1,0x7,0xfa,
+    0x13,0x2,0x8,0x9,0x0,0x70,0x47,0xf8,0xb5,0x4,0xff,0x0,0xd,0x0,0x16,0x0,
+    0x1f,0x0,0x20,0xff,0x78,0xc0,0x7,0xb,0xd5,0xe0,0x78,0x0,0xef,0x28,0x4,0xd0,
+    0x31,0xf0,0x0,0x6,0xf0,0xa9,0xf7,0xfd,0x3,0xe0,0x9,0x2,0xeb,0xf7,0x92,0xfd,
+    0xff,0x20,0x78,0xa,0x21,0x8,0x42,0x4,0xd0,0xff,0x32,0x0,0xa1,0x78,0x28,0x0,
+    0x5,0xf0,0xfd,0xf4,0x11,0x0,0xc0,0x6,0x5,0xd5,0x3b,0x0,0xf7,0x32,0x0,0xe1,
+    0x11,0x0,0x6,0xf0,0xd8,0xf8,0xff,0xf1,0xbd,0x10,0xb5,0x88,0x42,0x16,0xd1,0xff,
+    0x0,0x21,0xb,0x4a,0x81,0x54,0xb2,0x21,0xef,0x49,0x0,0x44,0x18,0xe5,0x6,0xc0,
+    0x46,0xc0,0xe1,0x46,0xf,0x7,0x9,0x2,0x2b,0x7,0x9,0x2,0x1,0x20,0x10,0xfb,
+    0xbd,0x0,0x3,0x0,0x58,0xe,0x0,0x0,0x10,0xfe,0x89,0x0,0x0,0x20,0x20,0x60,
+    0x60,0x60,0xa0,0xff,0x60,0xe0,0x60,0x20,0x61,0x60,0x61,0xe0,0xff,0x61,0xe0,0x62,
+    0xe0,0x63,0x20,0x64,0x60,0xff,0x64,0xa0,0x64,0x20,0x0,0x58,0x30,0x6,0xff,0xf0,
+    0xb7,0xff,0x20,0x0,0x10,0xbd,0x7c,0xfe,0x29,0x0,0x8,0x0,0x1d,0x0,0x6,0x99,
+    0x9,0xff,0x68,0x21,0x60,0x0,0x21,0x61,0x60,0xa1,0xff,0x60,0xe1,0x60,0x12,0x68,
+    0x22,0x61,0x2a,0xff,0x68,0x62,0x61,0x0,0x22,0xa2,0x61,0xe1,0xff,0x61,0x22,0x62,
+    0x62,0x62,0xa2,0x62,0xe1,0xff,0x62,0x23,0x0,0x30,0x33,0x3,0x26,0x19,0xff,0x60,
+    0x1b,0x1d,0x76,0x1e,0xfb,0xd1,0xe1,0xff,0x63,0x21,0x64,0x9e,0x21,0xc9,0x5,0x61,
+    0xff,0x64,0xcf,0x21,0x9,0x6,0xa1,0x64,0x21,0xff,0x0,0x4c,0x31,0x1,0x23,0xb,
+    0x70,0x4a,0xff,0x60,0x8a,0x60,0x1,0x22,0x1f,0x21,0x0,0xff,0x68,0xe6,0xf7,0x7f,
+    0xfb,0x0,0x90,0x1,0xf5,0x23,0xd,0x2,0x28,0xd,0x0,0x78,0xfb,0x1,0x90,0xdf,
+    0x69,0x46,0x58,0x34,0x20,0xe1,0x0,0x7f,0xff,0xff,0x76,0xbd,0xf2,0xb5,0x84,0xb0,
+    0x4,0x0,0xff,0x15,0x0,0x8,0x68,0x0,0x90,0xe0,0x69,0xbf,0x1,0x90,0x6a,0x46,
+    0x1,0xa9,0xa2,0x1,0xf0,0xff,0xb2,0xf8,0x20,0x6b,0x1,0x90,0x60,0x6c,0xfe,0x3b,
+    0x0,0x99,0xe7,0xf7,0x79,0xfc,0x1,0xd2,0xff,0x68,0x46,0x0,0xe0,0x1,0xa8,0x0,
+    0x68,0xff,0x60,0x64,0x0,0x26,0x69,0x46,0xe,0x72,0xff,0x60,0x6a,0x40,0x1c,0x60,
+    0x62,0xa1,0x69,0xff,0x88,0x42,0x7,0xd3,0x60,0x6c,0xa0,0x64,0xff,0x7f,0x48,0x1f,
+    0x21,0xe6,0xf7,0x80,0xfb,0xff,0x60,0x64,0x66,0x62,0x27,0x0,0x4c,0x37,0xdf,0xf8,
+    0x6d,0x0,0x90,0x20,0x23,0x0,0x20,0x62,0xff,0x79,0x68,0x81,0x42,0x22,0xd2,0x21,
+    0x6b,0xff,0x20,0x68,0xe7,0xf7,0x54,0xfc,0x1d,0xd2,0xff,0x60,0x6b,0xe7,0xf7,0x50,
+    0xfc,0x19,0xd2,0xf5,0x38,0x9b,0x1,0x16,0xc1,0x1,0x69,0x46,0x8,0x72,0xff,0x2b,
+    0x0,0x8,0x33,0x22,0x0,0x20,0x32,0xd9,0x2,0x7d,0x0,0x19,0x3,0x9e,0xff,0x3f,
+    0x0,0x99,0x88,0xfe,0xf7,0x1,0x20,0x6a,0xa8,0x80,0xa6,0x62,0x5,0xff,0x20,0x68,
+    0x80,0x3e,0x70,0x26,0x62,0x66,0xff,0x6b,0xa1,0x6c,0x66,0x48,0xe7,0xf7,0x3f,0xff,
+    0xfe,0x1,0x0,0x30,0x0,0xe7,0xf7,0x2c,0xfb,0xfc,0xc,0x59,0x0,0xe7,0xf7,0x28,
+    0xfc,0x8,0xbb,0xd2,0xa1,0x7,0x0,0x24,0xfc,0x4,0x57,0x4,0x1,0xff,0xd1,0x1,
+    0x20,0x38,0x70,0x4,0x98,0x0,0xf7,0x68,0xe0,0x62,0xb9,0x0,0x7a,0x28,0x70,0xf8,
+    0xd7,0x6d,0xa8,0x60,0x9,0x4,0x73,0xd,0x3,0x1e,0x21,0xff,0x20,0x6b,0xe6,0xf7,
+    0xf1,0xfa,0x28,0x61,0x7f,0x0,0x20,0x5,0xb0,0xf0,0xbd,0x38,0x83,0x1,0xef,0x61,
+    0x65,0x8,0x46,0x39,0x2,0x4d,0x48,0x8,0xff,0xe0,0xc5,0x17,0x68,0x40,0x42,0x1b,
+    0x4c,0xff,0x48,0x0,0x21,0xe3,0xf7,0x44,0xf9,0x68,0xff,0x40,0x40,0x1b,0xa0,0x61,
+    0x60,0x6d,0xe9,0xff,0xf7,0xc0,0xfc,0x48,0x49,0xe7,0xf7,0x0,0xbf,0xfe,0xe0,0x61,
+    0x25,0x69,0x29,0x7f,0x0,0x5c,0xff,0xfb,0x1,0x0,0x28,0x0,0xe8,0xf7,0xf6,0xff,
+    0xf8,0xa0,0x60,0x1,0x46,0xfe,0x20,0x80,0xff,0x5,0xe7,0xf7,0x52,0xfb,0xfc,0x21,
+    0x89,0xfe,0x7,0x0,0xed,0xfd,0xe0,0x60,0x60,0x69,0xe1,0xff,0x69,0xe8,0xf7,0xe7,
+    0xf8,0xeb,0xf7,0xf1,0xff,0xfe,0xec,0xf7,0xdd,0xfe,0x20,0x65,0x61,0xfd,0x6d,0x7d,
+    0x7,0xf0,0xfe,0x31,0xbd,0xf0,0xb5,0xfd,0x85,0x7d,0x1,0xf,0x0,0xa0,0x68,0x1,
+    0x90,0xff,0xe6,0x68,0x10,0x68,0xe1,0x6a,0xe7,0xf7,0xf7,0x6b,0xfb,0x31,0x57,0x0,
+    0xcf,0xfd,0x5,0x0,0xb7,0x1,0x99,0x60,0x31,0x1,0xca,0xfd,0x67,0x2,0x28,0xdf,
+    0xfb,0x5,0x0,0x38,0x68,0x9,0x2,0xc2,0xfd,0xff,0x2,0x90,0x20,0x0,0x3c,0x30,
+    0x3,0x90,0xff,0x21,0x6c,0x1,0x98,0xe7,0xf7,0xba,0xfd,0xef,0x0,0x90,0x2,0x98,
+    0x33,0x2,0xb5,0xfd,0x1,0xff,0x0,0x0,0x20,0xe7,0xf7,0x12,0xfb,0x0,0xbe,0xb3,
+    0x1,0xf,0xfb,0x9e,0x21,0xc9,0x85,0x0,0x6d,0xff,0xff,0x1,0xd8,0x8,0x0,0x5,
+    0xe0,0x1b,0xbe,0xb7,0x0,0x95,0xfb,0x1,0xd2,0xcf,0x7c,0x0,0x3,0xff,0x99,0x8,
+    0x60,0x26,0x6b,0x3f,0x68,0xa0,0xfd,0x68,0x37,0x2,0x99,0xfd,0x1,0x90,0x20,0x6c,
+    0x95,0x39,0x9,0x0,0x94,0x4b,0x0,0xfc,0xc3,0x0,0xb,0x2,0x8e,0xdb,0xfd,0x2,
+    0x45,0x0,0x8b,0xfd,0x4b,0x2,0xe9,0xfa,0x77,0x1,0x0,0xe0,0x8b,0x0,0x84,0xfd,
+    0x1,0xd,0x0,0xff,0xe2,0xfa,0x61,0x6b,0xa1,0x63,0x66,0x63,0xff,0x20,0x63,0x65,
+    0x60,0xe0,0x6b,0x20,0x64,0xfe,0x3f,0x3,0x0,0x0,0xff,0xff,0xff,0x7f,0xcd,0xff,
+    0xcc,0xcc,0xbd,0x60,0xe3,0x16,0x0,0xbd,0xff,0x37,0x86,0x35,0xfe,0xff,0xff,0xce,
+    0x80,0xbd,0xb5,0xcb,0x3,0x74,0xfe,0x2,0xbd,0x9,0x0,0x31,0xff,0x6,0xf0,0x61,
+    0xfe,0x1,0xbd,0x70,0x47,0xfd,0x10,0x6b,0x1,0x82,0x48,0x20,0x60,0x0,0x20,0xff,
+    0xa0,0x61,0xe0,0x61,0x20,0x62,0x60,0x62,0xff,0xa0,0x62,0xe0,0x62,0x20,0x63,0x21,
+    0x0,0xff,0xd8,0x31,0x8,0x60,0x48,0x60,0x90,0x21,0xaf,0x49,0x0,0x61,0x18,0x9,
+    0x2,0xa6,0x9,0xc,0xc2,0xff,0x20,0x40,0x0,0x20,0x18,0xff,0xf7,0x54,0xef,0xfe,
+    0x8d,0x20,0x80,0x9,0x4,0x4f,0xfe,0x20,0xf7,0x0,0x10,0xbd,0x4b,0x2,0x70,0x4a,
+    0x1e,0x21,0xff,0x1e,0x20,0xdc,0xf7,0x18,0xfd,0x20,0x60,0xdf,0x6e,0x4a,0x1f,0x21,
+    0x1f,0xb,0x0,0x12,0xfd,0xbf,0x60,0x60,0x80,0x22,0x92,0x5,0xd,0x6,0xb,0xaf,
+    0xfd,0xa0,0x60,0x68,0x19,0x8,0x5,0x95,0x1,0x66,0xbe,0xb,0x8,0xff,0xfc,0x20,
+    0x61,0x64,0xb,0x8,0xf9,0x6f,0xfc,0x60,0x61,0x62,0xb,0x8,0xf3,0xfc,0xed,0x1,
+    0xbe,0xb,0x8,0xed,0xfc,0xe0,0x61,0x5e,0x61,0x8,0xe7,0xff,0xfc,0x20,0x62,0xc0,
+    0x20,0x40,0x5,0x60,0xff,0x62,0x0,0x20,0x10,0xbd,0x1,0x29,0x3,0xff,0xda,0x0,
+    0x21,0x1,0x71,0x0,0x20,0x70,0xff,0x47,0x11,0x68,0x56,0x4b,0x99,0x42,0x1,0xff,
+    0xda,0x0,0x29,0x1,0xd1,0x59,0x1e,0x11,0xff,0x60,0x1,0x21,0x2,0x79,0x0,0x2a,
+    0x0,0x77,0xd1,0x41,0x71,0x1f,0x6,0xf0,0xb5,0x83,0xe9,0x1,0xff,0x20,0x79,0x0,
+    0x28,0x0,0xd1,0x83,0xe0,0xdf,0x8,0x68,0x4c,0x49,0x88,0x2d,0x2,0x28,0x4,0xff,
+    0xd1,0x0,0x20,0x20,0x71,0x17,0x20,0xc0,0xff,0x43,0x78,0xe0,0xa0,0x60,0xe9,0xf7,
+    0x90,0xeb,0xfb,0x46,0xa7,0x1,0xd0,0x67,0x0,0x81,0x27,0xff,0xf7,0x5,0xa0,0x69,
+    0x89,0x3,0xc9,0xfc,0x6,0x0,0xbf,0x20,0x6a,0x25,0x0,0xd8,0x35,0xad,0x3,0x23,
+    0xfa,0x8b,0x1,0x30,0x7,0x0,0xbd,0xff,0x28,0x60,0x0,0xff,0x23,0x0,0x22,0x1e,
+    0x21,0xe6,0xf7,0x8d,0xdb,0xf9,0x80,0xeb,0x1,0x40,0x18,0xb,0x2,0xbf,0xf9,0xbf,
+    0x68,0x60,0x2d,0x1d,0x1,0x46,0xc7,0x3,0xe7,0xbf,0xf7,0xab,0xfc,0x28,0x60,0xfe,
+    0x9,0x0,0x21,0xff,0x6a,0xe7,0xf7,0xa4,0xff,0x60,0x62,0xa6,0xfd,0x69,0x33,0x2,
+    0x14,0x21,0x20,0x6a,0xe6,0xf7,0xff,0x72,0xf9,0x5,0x0,0x0,0x23,0x14,0x21,0xff,
+    0x0,0x91,0x1,0x93,0x2,0x93,0x30,0x0,0xfe,0x6b,0x2,0x93,0xfc,0x2,0x9b,0x1,
+    0x9a,0x0,0xff,0x99,0xe6,0xf7,0x63,0xf9,0x2a,0x0,0x1,0x7b,0x0,0x90,0x77,0x5,
+    0x6,0xf0,0x59,0xff,0x39,0x12,0x5d,0x55,0x39,0x14,0x31,0x0,0x38,0x39,0x0,0x76,
+    0x39,0xc,0xf5,0x46,0x39,0x4,0xa6,0x39,0x8,0x3c,0xff,0xa1,0x68,0xde,0xbd,0xb,
+    0x4c,0xfe,0xa1,0x68,0xbf,0xb,0x46,0xfe,0xff,0x0,0x20,0x3,0xb0,0xf0,0xbd,0x8c,
+    0x49,0xff,0x3,0x0,0x5c,0x8f,0xc2,0x5,0xaf,0x94,0xff,0x65,0x0,0x66,0x66,0x66,
+    0x26,0x14,0xae,0xff,0x47,0x1,0xcd,0xcc,0xcc,0xc,0xdc,0x46,0xbf,0x3,0x0,0x9a,
+    0x99,0x99,0x59,0xb,0x0,0x5c,0xff,0x41,0x9c,0x0,0x0,0x9d,0xad,0x0,0x0,0xdf,
+    0xbd,0x37,0x86,0x35,0x0,0x43,0x3,0xd0,0x8,0x77,0x68,0x10,0x60,0x57,0x3,0x30,
+    0xb5,0x8b,0x57,0x1,0xff,0xd,0x0,0x0,0x20,0x2,0x90,0x1,0x90,0xff,0x20,0x71,
+    0x1,0x21,0x61,0x71,0xa0,0x60,0xff,0xe0,0x60,0x3,0x20,0x20,0x61,0x60,0x61,0xfd,
+    0xbc,0x83,0x8,0x24,0xff,0x24,0x21,0x20,0x0,0xff,0x38,0x30,0xe1,0xf7,0x6c,0xfe,
+    0x1f,0x21,0xff,0xe8,0x69,0xe6,0xf7,0x2c,0xf9,0xa0,0x62,0xf7,0x1c,0x21,0x68,0xcb,
+    0x0,0x27,0xf9,0x20,0x63,0xf7,0x1e,0x21,0x28,0x9,0x0,0x22,0xf9,0xe0,0x62,0xfe,
+    0x9,0x0,0x68,0xe6,0xf7,0x1d,0xf9,0xa0,0x61,0xf7,0x1f,0x21,0x68,0x9,0x0,0x18,
+    0xf9,0x1,0x90,0x5c,0x31,0x0,0x9,0x0,0x13,0xf9,0xe0,0x13,0x0,0xa8,0x9,0x0,
+    0xfb,0xe,0xf9,0x6b,0x0,0x98,0x7,0x90,0xe0,0x69,0xff,0x8,0x90,0xa0,0x69,0x9,
+    0x90,0x2,0x98,0xff,0xa,0x90,0x7,0xa8,0x0,0x90,0x8,0xab,0xef,0x9,0xaa,0xa,
+    0xa9,0xeb,0xa,0x14,0xfd,0x0,0xe7,0x28,0x17,0xd1,0x31,0x0,0x6d,0x0,0xf5,0xf8,
+    0x1,0xab,0x90,0x3,0x2f,0x0,0x4,0x2f,0x0,0x5,0x2f,0x0,0x6,0xfb,0x90,0x3,
+    0x2f,0x0,0x4,0xab,0x5,0xaa,0x6,0xfd,0xa9,0xf,0xb,0xfc,0xfc,0x0,0x28,0x2,
+    0xd0,0xff,0x3,0x20,0xc0,0x43,0x5,0xe0,0x60,0x21,0x7f,0x78,0x34,0x20,0x0,0xe1,
+    0xf7,0x15,0x23,0x1,0xff,0xb,0xb0,0x30,0xbd,0xf0,0xb5,0x8d,0xb0,0xff,0x5,0x0,
+    0x2c,0x0,0xc,0x34,0xa0,0x6a,0xff,0x40,0x1c,0xa0,0x62,0x26,0x68,0x28,0x0,0xff,
+    0x98,0x30,0x61,0x6f,0x22,0x6d,0x89,0x1a,0xdf,0x2,0x68,0x89,0x18,0x62,0x7,0x0,
+    0x82,0x69,0xf7,0x89,0x18,0xa2,0x7,0x0,0x0,0x6b,0x8,0x18,0xff,0xe1,0x6d,0x40,
+    0x1a,0x0,0xd1,0x4,0xe1,0xff,0x4,0x23,0x4,0x22,0x8f,0x49,0x5,0xa8,0xfe,0xe5,
+    0x0,0xfd,0x0,0x20,0x5,0x90,0x6,0x90,0xfe,0x6d,0x2,0x2f,0x18,0x39,0x0,0x68,
+    0x46,0xff,0xcf,0xf7,0x35,0xfe,0x0,0xc5,0x0,0xaf,0x2,0x29,0x18,0xfa,0xf,0x2,
+    0x2d,0xf,0x0,0x8,0x90,0x0,0x20,0x9,0xff,0x90,0xa,0x90,0x38,0x0,0xff,0xf7,
+    0x20,0x5f,0xfe,0x7,0x0,0xb,0x97,0x1f,0x2,0x28,0x9f,0x0,0xff,0x19,0xfe,0x0,
+    0x90,0xc,0x90,0x1,0xa8,0xf7,0x0,0x21,0x1,0x79,0x1,0x1,0x22,0x1,0xa9,0xff,
+    0xa,0x70,0x4a,0x70,0x8a,0x70,0x0,0x2f,0xff,0x2,0xd0,0x38,0x0,0x0,0x23,0xb,
+    0x80,0xff,0x0,0x9b,0x83,0x42,0x6,0xd3,0xca,0x70,0xff,0x0,0x9a,0x90,0x42,0x2,
+    0xd2,0x0,0x20,0xff,0x8,0x80,0x88,0x70,0x9e,0x20,0xc0,0x5,0xff,0x2,0x90,0x0,
+    0x22,0x1,0xab,0x5,0xaf,0xff,0x18,0x78,0x0,0x28,0x7,0xd0,0x38,0x68,0xff,0x2,
+    0x99,0xe7,0xf7,0x50,0xf9,0x2,0xd2,0xff,0x2,0x90,0x69,0x46,0xa,0x73,0x52,0x1c,
+    0xff,0x3f,0x1d,0x5b,0x1c,0x4,0x2a,0xef,0xd3,0xff,0x21,0x69,0xa0,0x69,0xe7,0xf7,
+    0x52,0xfb,0xff,0xeb,0xf7,0x5b,0xfc,0xec,0xf7,0x47,0xfc,0xff,0x7,0x0,0x5,0xa8,
+    0x69,0x46,0x9,0x7b,0x5f,0x89,0x0,0x41,0x58,0xe0,0x19,0x0,0x45,0x19,0x0,0xfd,
+    0x4e,0x19,0x0,0x3a,0xfc,0xb8,0x42,0x0,0xd2,0xff,0x38,0x0,0x4,0x90,0x0,0x27,
+    0x1,0xa8,0xff,0x29,0x0,0x5c,0x31,0x2a,0x0,0x80,0x32,0xff,0x0,0x92,0x4,0x22,
+    0x3,0x78,0x0,0x2b,0xff,0x4,0xd0,0x0,0x9b,0x1b,0x68,0xfb,0x18,0xff,0xf,0x68,
+    0xdf,0x1b,0x0,0x9b,0x18,0x33,0xff,0x0,0x93,0x9,0x1d,0x40,0x1c,0x52,0x1e,0xeb,
+    0xf0,0xd1,0xc9,0x6,0x80,0x41,0x1,0xe9,0xf7,0xe8,0xef,0xf9,0x1,0x0,0x60,0x53,
+    0x0,0x1b,0xfb,0x0,0xff,0x90,0xa0,0x68,0x80,0x0,0x9,0xa9,0x9,0xff,0x58,0x3,
+    0x29,0x27,0xd1,0x5,0xa9,0x8,0xfd,0x58,0x9f,0x2,0xe,0xfe,0x21,0x6a,0xe7,0xf7,
+    0xff,0xfd,0xf8,0x1e,0xd2,0x4,0x98,0xa1,0x6a,0x7f,0x88,0x42,0x5e,0xd2,0x0,0x98,
+    0x61,0x11,0x0,0xff,0xf4,0xf8,0x59,0xd2,0x3f,0x6,0x57,0xd0,0xff,0x76,0x1c,0x20,
+    0x6b,0xe0,0x62,0x60,0x6b,0xff,0x20,0x63,0xa0,0x6b,0x60,0x63,0xe0,0x6b,0xff,0xa0,
+    0x63,0x20,0x6c,0xe0,0x63,0x60,0x6c,0xff,0x20,0x64,0xa0,0x6c,0x60,0x64,0xe0,0x6c,
+    0xff,0xa0,0x64,0xa0,0x6a,0xe0,0x64,0x41,0xe0,0xff,0x68,0x46,0x0,0x7b,0xa0,0x60,
+    0xe0,0x6c,0xbf,0x0,0x28,0x13,0xd1,0x1,0xa9,0xa7,0x2,0x4,0xff,0x23,0xe,0x78,
+    0x0,0x2e,0x3,0xd0,0x16,0xfb,0x68,0xb0,0xc5,0x0,0x30,0x0,0x18,0x32,0x49,0x7f,
+    0x1c,0x5b,0x1e,0xf4,0xd1,0x6,0x0,0x31,0x2,0xff,0x0,0x20,0xa0,0x62,0xa0,0x68,
+    0x41,0x0,0xff,0x9,0x18,0xc9,0x0,0x69,0x18,0x80,0x31,0xfd,0x9,0x9b,0x0,0x28,
+    0x18,0xc0,0x6d,0x8,0x1a,0xeb,0x1d,0xd0,0x89,0x6,0x19,0x89,0x8,0xaf,0xf8,0x14,
+    0xed,0xd2,0x83,0x42,0x76,0x1c,0x53,0x6,0x60,0x60,0x20,0xff,0x68,0x86,0x42,0x1,
+    0xd0,0x1,0x20,0x0,0x7f,0xe0,0x0,0x20,0x60,0x66,0x26,0x60,0x67,0x2,0xf7,0x8,
+    0x18,0xc0,0x5f,0x0,0x7c,0x30,0x0,0x88,0xeb,0xa0,0x66,0xf,0xe,0x7a,0xf,0x0,
+    0x20,0x66,0x30,0xff,0x0,0xd,0xb0,0xf0,0xbd,0x6b,0xca,0x0,0xff,0x0,0xfc,0xb5,
+    0x9b,0xb0,0x4,0x0,0xd,0xff,0x0,0x0,0x20,0x22,0x99,0x8,0x70,0x1c,0xff,0x99,
+    0x88,0x80,0x1c,0x99,0x48,0x80,0x68,0xfd,0x68,0x5,0x0,0x61,0x28,0x78,0xc0,0x7,
+    0x2,0xf7,0xd5,0x20,0x79,0xdb,0x1,0xd1,0x0,0x20,0x1c,0xfa,0x1f,0x0,0xe0,0x17,
+    0x0,0x88,0x60,0x3,0x20,0x27,0xff,0xe1,0x18,0x21,0x28,0x69,0xe5,0xf7,0x76,0xbf,
+    0xff,0x2,0x90,0x18,0x21,0x68,0x9,0x0,0x71,0xeb,0xff,0x3,0x9,0x0,0xa8,0x9,
+    0x0,0x6c,0xff,0x4,0xbb,0x90,0x60,0x33,0x0,0x2d,0xd0,0xbc,0x95,0x1,0x20,0xff,
+    0x18,0x6,0xf0,0x52,0xfd,0x20,0x0,0xd8,0xff,0x30,0x1,0x0,0x8,0x31,0x2,0xaa,
+    0x68,0xff,0xca,0x68,0xc1,0x14,0x30,0x2,0xa9,0x2c,0xef,0xc9,0x2c,0xc0,0x90,0x1f,
+    0x8,0x49,0xfd,0xa6,0xfc,0x9,0x4,0x21,0x2,0x3,0x22,0x0,0x23,0xb,0x60,0xff,
+    0x9,0x1d,0x52,0x1e,0xfb,0xd1,0x1,0x0,0xf9,0x14,0xf,0x0,0xd,0xa,0x20,0x30,
+    0x3,0x21,0x2,0xef,0x60,0x0,0x1d,0x49,0xb,0x0,0x63,0x71,0x20,0xff,0x0,0x80,
+    0x30,0x1,0x68,0xe1,0x65,0x81,0xff,0x69,0x21,0x66,0x1,0x6b,0x61,0x66,0x80,0xff,
+    0x6c,0xa0,0x66,0x0,0x25,0x2,0xae,0x3,0xff,0x27,0x31,0x68,0x8,0x0,0xe7,0xf7,
+    0x1c,0xff,0xfa,0x29,0x0,0xe6,0xf7,0x7a,0xff,0x5,0xef,0x0,0x36,0x1d,0x7f,0x83,
+    0x1,0xe7,0xf7,0xe0,0xff,0xf9,0x61,0x79,0x0,0x29,0x8,0xd0,0x8e,0x3f,0x21,0x49,
+    0x0,0x61,0x18,0x1,0x67,0x10,0x11,0x2,0xff,0x60,0x50,0x0,0x90,0x22,0x0,0xc0,
+    0x32,0xf7,0x69,0x46,0xc2,0x8b,0x4,0xff,0xf7,0x5f,0xfb,0x6f,0x5,0xa8,0x2,0xa9,
+    0x7f,0x0,0x68,0x3,0x27,0x0,0xbd,0x0,0x29,0x0,0xf9,0xd1,0x5,0xa9,0xc9,0x2,
+    0x6,0xfb,0xf0,0x8,0xd1,0x0,0x20,0x30,0x0,0x90,0x17,0xed,0xad,0xe3,0x2,0x26,
+    0x18,0x75,0x2,0x0,0x98,0x0,0x7d,0x68,0x65,0x2,0x28,0x60,0x36,0x1d,0x2d,0x73,
+    0x0,0xef,0xf5,0xd1,0x21,0x6a,0x89,0x2,0xd7,0xf9,0xfc,0xff,0x21,0x89,0x5,0xe7,
+    0xf7,0xd3,0xf9,0x0,0xef,0x90,0x14,0xad,0x5,0xa1,0x4,0x0,0x98,0xe7,0xfb,0xf7,
+    0xcb,0x29,0xc,0xf6,0xd1,0xb,0xa8,0x17,0xfe,0x69,0x18,0xb,0xa9,0x8,0xa8,0x6,
+    0xf0,0xf6,0xff,0xfc,0x0,0x25,0x8,0xae,0x14,0xaf,0x31,0xff,0x68,0x38,0x68,0xe6,
+    0xf7,0x13,0xff,0x30,0xff,0x60,0x6d,0x1c,0x3f,0x1d,0x36,0x1d,0x3,0xff,0x2d,0xf5,
+    0xdb,0xfe,0x20,0x80,0x5,0x0,0x7f,0x90,0x11,0xab,0x6a,0x46,0x8,0xa9,0x3f,0x7,
+    0xdf,0x6,0xf0,0xea,0xfc,0x82,0x9,0x0,0x25,0x18,0xfe,0x7f,0x3,0x2,0xd0,0x28,
+    0x0,0x6,0xf0,0x94,0xff,0xfc,0x60,0x6a,0x0,0x90,0x0,0x20,0x1,0xff,0x90,0x11,
+    0xae,0xe,0xaf,0x30,0x68,0x29,0xde,0x47,0x0,0x27,0xff,0x1,0x0,0x81,0x2,0x8a,
+    0xf9,0xff,0x38,0x60,0x30,0x68,0x28,0x60,0x1,0x98,0x9f,0x40,0x1c,0x1,0x90,0x3f,
+    0x8b,0x0,0x59,0x0,0x28,0xff,0xec,0xd3,0x0,0x20,0xe,0xad,0x3,0x26,0xff,0x29,
+    0x68,0x49,0x0,0x49,0x8,0xe6,0xf7,0xff,0xd8,0xfe,0x2d,0x1d,0x76,0x1e,0xf7,0xd1,
+    0xba,0x1f,0x3,0xa8,0x1f,0x1,0x8d,0x20,0x80,0x1f,0x5,0xcf,0xf3,0xfa,0x20,0x59,
+    0x0,0xff,0x2,0x23,0x18,0x6a,0x46,0xef,0x5,0xa9,0x58,0x38,0x81,0x2,0xa9,0xfc,
+    0x1b,0xff,0xa8,0x1,0x78,0x20,0x0,0x22,0x68,0xd2,0xff,0x69,0x90,0x47,0x1c,0x99,
+    0x88,0x60,0x20,0xbf,0x6f,0x1c,0x99,0x8,0x70,0x60,0x5,0x0,0x88,0xff,0x80,0xe0,
+    0x6e,0x1c,0x99,0x48,0x80,0x20,0xff,0x0,0xcc,0x30,0x1,0x78,0x1c,0x9a,0x11,0xf7,
+    0x73,0x40,0x68,0x1b,0x0,0x61,0x0,0x20,0x60,0xff,0x71,0x1d,0xb0,0xf0,0xbd,0x70,
+    0x47,0x10,0xff,0xb5,0x4,0x0,0x81,0x48,0x20,0x60,0x0,0xff,0x20,0xa0,0x61,0xe0,
+    0x61,0x20,0x62,0x60,0xff,0x62,0xa0,0x62,0xe0,0x62,0x20,0x63,0x21,0xff,0x0,0xd8,
+    0x31,0x8,0x60,0x48,0x60,0x90,0x64,0xbb,0x5,0x9,0x2,0xa6,0x9,0xc,0xaf,0xb,
+    0x34,0xfa,0x99,0xa,0xbf,0x2f,0xfa,0x20,0x0,0x10,0xbd,0x4b,0x2,0x6f,0xff,0x4a,
+    0x1e,0x21,0x1e,0x20,0xdc,0xf7,0xf8,0xff,0xf8,0x20,0x60,0x6d,0x4a,0x1f,0x21,0x1f,
+    0xbe,0xb,0x0,0xf2,0xf8,0x60,0x60,0x6b,0xb,0x8,0xec,0xef,0xf8,0xa0,0x60,0x69,
+    0xb,0x8,0xe6,0xf8,0xe0,0xfb,0x60,0x67,0xb,0x8,0xe0,0xf8,0x20,0x61,0x65,0xbe,
+    0xb,0x8,0xda,0xf8,0x60,0x61,0x63,0xb,0x8,0xd4,0xef,0xf8,0xa0,0x61,0x61,0xb,
+    0x8,0xce,0xf8,0xe0,0xff,0x61,0x5f,0x49,0x20,0x0,0x20,0x30,0x1,0xfb,0x60,0x80,
+    0x8b,0x1,0x60,0x62,0x0,0x20,0x10,0xff,0xbd,0x1,0x29,0x3,0xda,0x0,0x21,0x1,
+    0xff,0x71,0x0,0x20,0x70,0x47,0x11,0x68,0x58,0xff,0x4b,0x99,0x42,0x1,0xda,0x0,
+    0x29,0x1,0xff,0xd1,0x59,0x1e,0x11,0x60,0x1,0x21,0x2,0x7f,0x79,0x0,0x2a,0x0,
+    0xd1,0x41,0x71,0x1f,0x6,0x7f,0xf0,0xb5,0x83,0xb0,0x4,0x0,0x20,0xab,0x1,0xff,
+    0x0,0xd1,0x83,0xe0,0x8,0x68,0x4d,0x49,0xfd,0x88,0x2d,0x2,0x28,0x4,0xd1,0x0,
+    0x20,0x20,0xff,0x71,0x17,0x20,0xc0,0x43,0x78,0xe0,0xa0,0xff,0x60,0xe8,0xf7,0x73,
+    0xff,0x48,0x49,0xe7,0xff,0xf7,0xb3,0xf8,0x20,0x62,0x81,0x27,0xff,0xff,0x5,0xa0,
+    0x69,0x39,0x0,0xe7,0xf7,0xac,0xff,0xf8,0x6,0x0,0x20,0x6a,0x25,0x0,0xd8,0xff,
+    0x35,0x31,0x0,0xe6,0xf7,0x6,0xfe,0x1,0xfb,0x0,0x30,0x15,0x0,0xa0,0xfb,0x28,
+    0x60,0x0,0xff,0x23,0x0,0x22,0x1e,0x21,0xe5,0xf7,0x70,0x7f,0xfd,0x80,0x21,0xc9,
+    0x5,0x40,0x18,0xb,0x2,0xff,0xa2,0xfd,0x68,0x60,0x2d,0x1d,0x1,0x46,0xfd,0xfc,
+    0xa7,0x0,0xe7,0xf7,0x8e,0xf8,0x28,0x60,0xfd,0xfe,0x9,0x0,0x21,0x6a,0xe7,0xf7,
+    0x87,0xfb,0xef,0x60,0x62,0xa6,0x69,0x33,0x2,0x14,0x21,0x20,0xff,0x6a,0xe5,0xf7,
+    0x55,0xfd,0x5,0x0,0x0,0xff,0x23,0x14,0x21,0x0,0x91,0x1,0x93,0x2,0xf7,0x93,
+    0x30,0x0,0x6b,0x2,0x76,0xf8,0x2,0x9b,0xff,0x1,0x9a,0x0,0x99,0xe5,0xf7,0x46,
+    0xfd,0xdf,0x2a,0x0,0x1,0x0,0x90,0x71,0x5,0x6,0xf0,0xeb,0x3c,0xfb,0x39,0x12,
+    0x38,0x39,0x14,0x31,0x0,0x38,0xaa,0x39,0x0,0x59,0x39,0xc,0x29,0x39,0x4,0xa6,
+    0x39,0x8,0x1f,0xf7,0xfb,0xa1,0x68,0xb7,0xb,0x2f,0xfa,0xa1,0x68,0xfe,0xb9,0xb,
+    0x29,0xfa,0x0,0x20,0x3,0xb0,0xf0,0xff,0xbd,0x0,0x0,0xb4,0x49,0x3,0x0,0x5c,
+    0xff,0x8f,0xc2,0x5,0xaf,0x94,0x65,0x0,0x48,0xf7,0xe1,0x7a,0x14,0x3,0x0,0x24,
+    0x14,0xae,0x47,0xff,0x1,0x29,0x5c,0x8f,0x2,0xdc,0x46,0x3,0xff,0x0,0x9a,0x99,
+    0x99,0x59,0xcd,0xcc,0xcc,0xff,0x5c,0x41,0x9c,0x0,0x0,0x7a,0xa4,0x0,0xbf,0x0,
+    0xbd,0x37,0x86,0x35,0x0,0x49,0x3,0xd0,0xef,0x8,0x68,0x10,0x60,0x5d,0x3,0x30,
+    0xb5,0x8b,0xfe,0x5d,0x1,0xd,0x0,0x0,0x20,0x2,0x90,0x1,0xff,0x90,0x20,0x71,
+    0x1,0x21,0x61,0x71,0xa0,0xff,0x60,0xe0,0x60,0x3,0x20,0x20,0x61,0x60,0xfb,0x61,
+    0xbc,0x89,0x8,0x4,0xfb,0x24,0x21,0x20,0xff,0x0,0x38,0x30,0xe1,0xf7,0x4c,0xfa,
+    0x1f,0xff,0x21,0xe8,0x69,0xe5,0xf7,0xc,0xfd,0xa0,0xef,0x62,0x1c,0x21,0x68,0xd1,
+    0x0,0x7,0xfd,0x20,0xef,0x63,0x1e,0x21,0x28,0x9,0x0,0x2,0xfd,0xe0,0xfd,0x62,
+    0x9,0x0,0x68,0xe5,0xf7,0xfd,0xfc,0xa0,0xef,0x61,0x1f,0x21,0x68,0x9,0x0,0xf8,
+    0xfc,0x1,0xb9,0x90,0x31,0x0,0x9,0x0,0xf3,0xfc,0xe0,0x13,0x0,0xa8,0xf6,0x9,
+    0x0,0xee,0xfc,0x6b,0x0,0x98,0x7,0x90,0xe0,0xff,0x69,0x8,0x90,0xa0,0x69,0x9,
+    0x90,0x2,0xff,0x98,0xa,0x90,0x7,0xa8,0x0,0x90,0x8,0xdf,0xab,0x9,0xaa,0xa,
+    0xa9,0xf1,0xa,0xf4,0xf8,0x4f,0x0,0x28,0x17,0xd1,0x45,0x0,0x6d,0x0,0xd5,0x45,
+    0x0,0xd5,0x3,0x2f,0x0,0x4,0x2f,0x0,0x5,0x2f,0x0,0x6,0x90,0xfd,0x3,0x2f,
+    0x0,0x4,0xab,0x5,0xaa,0x6,0xa9,0xfa,0x15,0xb,0xdc,0x2f,0x0,0x2,0xd0,0x3,
+    0x20,0xc0,0xff,0x43,0x5,0xe0,0x60,0x21,0x78,0x34,0x20,0xff,0x0,0xe1,0xf7,0xf5,
+    0xf9,0x0,0x20,0xb,0xff,0xb0,0x30,0xbd,0xf0,0xb5,0x8d,0xb0,0x5,0xff,0x0,0x2c,
+    0x0,0xc,0x34,0xa0,0x6a,0x40,0xff,0x1c,0xa0,0x62,0x26,0x68,0x28,0x0,0x98,0xff,
+    0x30,0x62,0x6f,0x23,0x6d,0xd2,0x1a,0x3,0xef,0x68,0xd2,0x18,0x63,0x7,0x0,0x83,
+    0x69,0xd2,0xfb,0x18,0xa3,0x7,0x0,0x0,0x6b,0x10,0x18,0xe2,0xff,0x6d,0x80,0x1a,
+    0x0,0xd1,0xa,0xe1,0x7,0xff,0x29,0x2,0xd0,0x8,0x29,0x0,0xd0,0x5,0xff,0xe1,
+    0x4,0x23,0x4,0x22,0x90,0x49,0x5,0xef,0xa8,0xe6,0xf7,0x2,0x53,0x0,0x5,0x90,
+    0x7,0xfd,0x90,0x77,0x2,0x2f,0x18,0x39,0x0,0x68,0x46,0x9f,0xff,0xf7,0x10,0xfa,
+    0x0,0x93,0x0,0xb9,0x2,0x29,0xf5,0x18,0xf,0x2,0x8,0xf,0x0,0x8,0x90,0x0,
+    0x20,0xff,0x9,0x90,0xb,0x90,0x38,0x0,0xff,0xf7,0xbf,0xfb,0xf9,0x7,0x0,0xa,
+    0x97,0x1f,0x2,0x28,0xfe,0xd9,0x2,0xf9,0x0,0x90,0xc,0x90,0x1,0xa8,0xf7,0x0,
+    0x21,0x1,0x83,0x1,0x1,0x22,0x1,0xa9,0xff,0xa,0x70,0x4a,0x70,0x0,0x2f,0x3,
+    0xd0,0xff,0x38,0x0,0x0,0x23,0xb,0x70,0x0,0xe0,0xff,0x8a,0x70,0x0,0x9b,0x83,
+    0x42,0x6,0xd3,0xff,0xca,0x70,0x0,0x9a,0x90,0x42,0x2,0xd2,0xff,0x0,0x20,0x8,
+    0x80,0x88,0x70,0x9e,0x20,0xff,0xc0,0x5,0x2,0x90,0x0,0x22,0x1,0xab,0xff,0x5,
+    0xaf,0x18,0x78,0x0,0x28,0x7,0xd0,0xff,0x38,0x68,0x2,0x99,0xe6,0xf7,0x2a,0xfd,
+    0xff,0x2,0xd2,0x2,0x90,0x69,0x46,0xa,0x73,0xff,0x52,0x1c,0x3f,0x1d,0x5b,0x1c,
+    0x4,0x2a,0xff,0xef,0xd3,0x21,0x69,0xa0,0x69,0xe6,0xf7,0xff,0x2c,0xff,0xeb,0xf7,
+    0x35,0xf8,0xec,0xf7,0xff,0x21,0xf8,0x7,0x0,0x5,0xa8,0x69,0x46,0x7f,0x9,0x7b,
+    0x89,0x0,0x41,0x58,0xe0,0x19,0x0,0xf5,0x1f,0x19,0x0,0x28,0x19,0x0,0x14,0xf8,
+    0xb8,0x42,0xff,0x0,0xd2,0x38,0x0,0x4,0x90,0x0,0x27,0xff,0x1,0xa8,0x29,0x0,
+    0x5c,0x31,0x2a,0x0,0xff,0x80,0x32,0x0,0x92,0x4,0x22,0x3,0x78,0xff,0x0,0x2b,
+    0x4,0xd0,0x0,0x9b,0x1b,0x68,0xff,0xfb,0x18,0xf,0x68,0xdf,0x1b,0x0,0x9b,0xff,
+    0x18,0x33,0x0,0x93,0x9,0x1d,0x40,0x1c,0xaf,0x52,0x1e,0xf0,0xd1,0xcb,0x6,0x80,
+    0x4d,0x1,0xe8,0xbf,0xf7,0xc2,0xfd,0x1,0x0,0x60,0x53,0x0,0xf5,0xff,0xfe,0x0,
+    0x90,0xa0,0x68,0x80,0x0,0x9,0xff,0xa9,0x9,0x58,0x3,0x29,0x27,0xd1,0x5,0xff,
+    0xa9,0x8,0x58,0x2,0x99,0xe7,0xf7,0xe8,0xff,0xf9,0x21,0x6a,0xe6,0xf7,0xd7,0xfc,
+    0x1e,0xff,0xd2,0x4,0x98,0xa1,0x6a,0x88,0x42,0x5e,0xef,0xd2,0x0,0x98,0x61,0x11,
+    0x0,0xce,0xfc,0x59,0xff,0xd2,0x3f,0x6,0x57,0xd0,0x76,0x1c,0x20,0xff,0x6b,0xe0,
+    0x62,0x60,0x6b,0x20,0x63,0xa0,0xff,0x6b,0x60,0x63,0xe0,0x6b,0xa0,0x63,0x20,0xff,
+    0x6c,0xe0,0x63,0x60,0x6c,0x20,0x64,0xa0,0xff,0x6c,0x60,0x64,0xe0,0x6c,0xa0,0x64,
+    0xa0,0xff,0x6a,0xe0,0x64,0x41,0xe0,0x68,0x46,0x0,0xff,0x7b,0xa0,0x60,0xe0,0x6c,
+    0x0,0x28,0x13,0xf7,0xd1,0x1,0xa9,0xa7,0x2,0x4,0x23,0xe,0x78,0x7f,0x0,0x2e,
+    0x3,0xd0,0x16,0x68,0xb0,0xc5,0x0,0xff,0x30,0x0,0x18,0x32,0x49,0x1c,0x5b,0x1e,
+    0xef,0xf4,0xd1,0x6,0x0,0x31,0x2,0x0,0x20,0xa0,0xff,0x62,0xa0,0x68,0x41,0x0,
+    0x9,0x18,0xc9,0xbf,0x0,0x69,0x18,0x80,0x31,0x9,0x9b,0x0,0x28,0x7f,0x18,0xc0,
+    0x6d,0x8,0x1a,0x1d,0xd0,0x89,0x6,0xbd,0x19,0x89,0x8,0x89,0xfc,0x14,0xd2,0x83,
+    0x42,0x76,0xfd,0x1c,0x53,0x6,0x60,0x60,0x20,0x68,0x86,0x42,0xff,0x1,0xd0,0x1,
+    0x20,0x0,0xe0,0x0,0x20,0xef,0x60,0x66,0x26,0x60,0x67,0x2,0x8,0x18,0xc0,0x7e,
+    0x5f,0x0,0x7c,0x30,0x0,0x88,0xa0,0x66,0xf,0xe,0xfd,0x7a,0xf,0x0,0x20,0x66,
+    0x30,0x0,0xd,0xb0,0xff,0xf0,0xbd,0x6b,0xca,0x0,0x0,0xf4,0xb5,0xff,0x8a,0xb0,
+    0x4,0x0,0xf,0x0,0x1d,0x0,0xff,0x0,0x26,0x10,0x99,0xe,0x70,0xae,0x80,0xff,
+    0x6e,0x80,0x78,0x68,0x68,0x61,0x38,0x78,0xff,0xc0,0x7,0x2,0xd5,0x20,0x79,0x0,
+    0x28,0xff,0x4,0xd1,0x2e,0x70,0xe0,0x68,0xa8,0x60,0xff,0x3,0x20,0xa1,0xe0,0x18,
+    0x21,0x38,0x69,0xff,0xe5,0xf7,0x55,0xfb,0x2,0x90,0x18,0x21,0x5d,0x78,0x9,0x0,
+    0x50,0xfb,0x3,0x9,0x0,0xb8,0x9,0x0,0xdf,0x4b,0xfb,0x4,0x90,0x60,0x2d,0x0,
+    0x1c,0xd0,0xfd,0xbc,0x8b,0x1,0x20,0x18,0x6,0xf0,0x31,0xf9,0xff,0x20,0x0,0xd8,
+    0x30,0x2,0x0,0x8,0x32,0xff,0x2,0xa9,0x88,0xc9,0x88,0xc2,0xb,0x68,0xff,0x13,
+    0x60,0x14,0x30,0x2,0xa9,0x8c,0xc9,0x77,0x8c,0xc0,0x90,0x23,0x8,0x26,0xf9,0xa6,
+    0x9,0x8,0xff,0x21,0xf9,0x66,0x71,0x80,0x20,0x20,0x58,0xff,0xe0,0x65,0x20,0x0,
+    0x98,0x30,0x1,0x68,0xff,0x21,0x66,0x81,0x69,0x61,0x66,0x0,0x6b,0xff,0xa0,0x66,
+    0x0,0x96,0x2,0xaf,0x3,0x20,0xff,0x1,0x90,0x38,0x68,0x1,0x0,0xe6,0xf7,0xff,
+    0xa,0xfe,0x1,0x0,0x0,0x98,0xe6,0xf7,0xff,0x67,0xfb,0x0,0x90,0x3f,0x1d,0x1,
+    0x98,0xbf,0x40,0x1e,0x1,0x90,0xf1,0xd1,0x11,0x2,0xca,0xef,0xfd,0x7,0x0,0x8e,
+    0x4d,0x4,0x61,0x79,0x0,0xff,0x29,0x6,0xd0,0x1,0x0,0x1,0x22,0x0,0xff,0x23,
+    0xb,0x60,0x9,0x1d,0x52,0x1e,0xfb,0xff,0xd1,0x61,0x6a,0x1,0x91,0x0,0x90,0x38,
+    0xff,0x0,0x0,0x99,0x9,0x68,0xe6,0xf7,0x80,0xf9,0xfb,0x1d,0x0,0x33,0x0,0xe3,
+    0xfd,0x5,0x90,0x0,0xff,0x98,0x7,0x60,0x0,0x97,0x22,0x0,0xc0,0xef,0x32,0x69,
+    0x46,0xc2,0x3f,0x4,0xfe,0xf7,0x3b,0xff,0xff,0x6,0xa8,0x2,0xa9,0x3,0x22,0xb,
+    0xeb,0x68,0x3,0x3f,0x0,0x0,0x41,0x0,0xf9,0xd1,0x6,0xfd,0xa9,0xcf,0x2,0x6,
+    0xf0,0xe4,0xf8,0x5,0x98,0xdf,0x0,0x90,0x22,0x0,0x90,0x2f,0x0,0x8d,0x20,0xfd,
+    0x80,0x2f,0x4,0x23,0xff,0xa,0xa8,0x1,0x78,0xff,0x20,0x0,0x22,0x68,0xd2,0x69,
+    0x90,0x47,0xff,0xa8,0x60,0x20,0x6f,0x28,0x70,0x60,0x6f,0xff,0xa8,0x80,0xe0,0x6e,
+    0x68,0x80,0x20,0x0,0xff,0xcc,0x30,0x1,0x78,0x29,0x73,0x40,0x68,0x7f,0x28,0x61,
+    0x66,0x71,0x0,0x20,0xb,0x79,0x1,0xff,0x0,0x0,0x0,0x23,0x3,0x60,0x43,0x60,
+    0xff,0x81,0x60,0xc2,0x60,0x3,0x61,0x70,0x47,0xff,0x70,0xb5,0x4,0x0,0x8,0x0,
+    0x16,0x0,0x7f,0x1,0xf0,0x52,0xfa,0x5,0x0,0x30,0x7,0x0,0xff,0x4e,0xfa,0xff,
+    0xe7,0x2,0x0,0x29,0x0,0xff,0x20,0x0,0x0,0xf0,0x2b,0xf8,0x70,0xbd,0xff,0x80,
+    0xb5,0x0,0xf0,0x62,0xf8,0x0,0x28,0xff,0x1,0xd0,0x0,0xf0,0x76,0xf8,0x1,0xbd,
+    0xfd,0x10,0x31,0x0,0x0,0x20,0x2,0xe0,0x0,0xf0,0xff,0x7d,0xf8,0x1,0x20,0x4c,
+    0x49,0x9,0x68,0xff,0x0,0x29,0x3,0xd0,0x9,0x68,0x9,0x1b,0xef,0x1,0x29,0xf4,
+    0xdb,0x27,0x6,0x62,0xf8,0x10,0xfe,0x37,0x2,0x22,0x1,0x0,0x9,0x20,0xec,0xf7,
+    0xd7,0x3a,0xfe,0xf1,0xb9,0x1,0x1,0x11,0x0,0x8,0x0,0x7f,0xff,0xf7,0xdf,0xff,
+    0x1,0xbd,0x38,0x43,0x0,0xff,0xd,0x0,0x62,0x60,0x1,0xf0,0xeb,0xf9,0xbf,0x40,
+    0x19,0x20,0x60,0x0,0x25,0x6d,0x2,0x2f,0xae,0x65,0x0,0x0,0xd0,0x1,0xb,0x4,
+    0x7,0x71,0x2,0xd1,0xfb,0x0,0x2d,0x4d,0x2,0x3b,0xf8,0x31,0xbd,0xf0,0xfd,0xb4,
+    0x7d,0x1,0x25,0x0,0x20,0x30,0x4a,0x13,0xff,0x68,0x0,0x2b,0x14,0xd0,0x1c,0x0,
+    0xe,0xff,0x68,0x27,0x68,0xf6,0x1b,0x80,0x27,0x3f,0xff,0x6,0xbe,0x42,0x3,0xd2,
+    0x25,0x0,0x24,0xef,0x69,0x0,0x2c,0xf4,0x31,0x0,0x2,0xd1,0xb,0xff,0x61,0x11,
+    0x60,0x5,0xe0,0x2a,0x69,0xa,0xff,0x61,0x29,0x61,0x2,0xe0,0x11,0x60,0xd,0xff,
+    0x61,0x1,0x20,0xf0,0xbc,0x70,0x47,0x10,0xfe,0x43,0x2,0x22,0x0,0x20,0x1f,0x4b,
+    0x1c,0x68,0xff,0x8c,0x42,0x5,0xd1,0x20,0x69,0x18,0x60,0xfd,0xa,0x1b,0x0,0x8,
+    0xe0,0x1c,0x0,0x0,0x2c,0xff,0x5,0xd0,0x23,0x69,0x8b,0x42,0xf9,0xd1,0x7f,0xb,
+    0x69,0x23,0x61,0xa,0x61,0x10,0x2f,0x0,0xf7,0x80,0xb5,0x1,0xe5,0x0,0xa,0xf8,
+    0x13,0x48,0xff,0x0,0x68,0x0,0x28,0x4,0xd0,0x0,0x68,0xff,0x1,0xf0,0x9b,0xf9,
+    0x0,0x28,0xf4,0xd1,0xbe,0x5,0x3,0xd,0x48,0x4,0x68,0x20,0xcf,0x0,0xd4,0xfb,
+    0xff,0x60,0x1d,0x0,0x5,0xd0,0x21,0x68,0x8,0x77,0x18,0x20,0x60,0x11,0x2,0xa9,
+    0xff,0xe0,0x2f,0x4,0xff,0x21,0x0,0x2,0x68,0x12,0x68,0x90,0x47,0xff,0x10,0xbd,
+    0xa1,0x68,0x8,0x0,0x1,0xd0,0xb7,0x20,0x0,0x88,0xb,0x0,0xc8,0x49,0x5a,0x1,
+    0x20,0x7f,0x13,0x49,0x8,0x70,0x70,0x47,0xf8,0x7,0x1,0xff,0xf,0x0,0x11,0x4d,
+    0x2e,0x0,0xe0,0x36,0xff,0x30,0x78,0x0,0x28,0xd,0xd1,0x1,0x20,0xff,0x30,0x70,
+    0x28,0x0,0xe1,0xf7,0xa,0xfc,0xdd,0x39,0xc,0x1,0x0,0xf0,0x1e,0x7,0x1,0x5,
+    0xd5,0xff,0x0,0x25,0x35,0x70,0x2,0xe0,0x14,0x20,0xff,0xc0,0x43,0xf2,0xbd,0x25,
+    0x60,0xf2,0xbd,0xff,0x4,0x49,0x81,0x42,0x2,0xd1,0x0,0x20,0xfb,0xe0,0x31,0x45,
+    0x2,0x0,0x0,0xd0,0x40,0x0,0xff,0x20,0xf0,0x3f,0x0,0x20,0x1c,0xb5,0x5,0xff,
+    0x9c,0x1,0x94,0x4,0x9c,0x0,0x94,0x0,0xff,0xf0,0x21,0xf8,0x16,0xbd,0x30,0xb5,
+    0xb9,0xff,0xb0,0x5,0x0,0xc,0x0,0x68,0x46,0xc0,0xfa,0x1,0x0,0x20,0x95,0x0,
+    0x11,0xd0,0x61,0x68,0x4,0xff,0x29,0xe,0xd3,0xe0,0xf7,0x75,0xfb,0x1,0xff,0x0,
+    0xa,0xd0,0xc,0x31,0x68,0x46,0xe0,0xff,0xf7,0xe,0xfb,0x28,0x0,0x69,0x46,0xdc,
+    0xff,0x22,0xe0,0xf7,0x4,0xff,0x0,0x20,0x1,0xfb,0xe0,0xc,0x69,0x0,0x39,0xb0,
+    0x30,0xbd,0xf0,0xef,0xb5,0x89,0xb0,0x7,0xa9,0x1,0x14,0x0,0x1e,0xf7,0x0,0x2,
+    0xa8,0x43,0x2,0x0,0x21,0x6a,0x46,0xff,0x11,0x71,0x3,0xa9,0xc,0x80,0x4e,0x80,
+    0xff,0xe,0x9a,0x8a,0x80,0x1,0xa9,0x0,0x91,0xdf,0x5,0xab,0x3,0xaa,0x39,0xb3,
+    0x0,0x4,0xf9,0xff,0xf,0x9c,0x25,0x60,0x22,0x1d,0x18,0x21,0xff,0x5,0xa8,0x0,
+    0x1d,0x5,0xf0,0xda,0xff,0xff,0x5,0x98,0xa0,0x60,0x7,0x98,0x41,0x42,0x7f,0xe1,
+    0x60,0x0,0x20,0x9,0xb0,0xf0,0x4f,0x0,0xff,0x83,0xb0,0x60,0x48,0x84,0x7f,0xcd,
+    0x21,0xff,0x60,0x4a,0xdc,0x23,0xdc,0x25,0x65,0x40,0xff,0xc6,0x7f,0xb5,0x42,0x9,
+    0xd1,0x45,0x7f,0xbf,0xcd,0x26,0x6e,0x40,0x17,0x78,0xc9,0x1,0xd1,0xff,0x5,0x2c,
+    0x1,0xda,0x5,0x2d,0x1a,0xdb,0xff,0x0,0x24,0x4,0x77,0x84,0x77,0xc3,0x77,0xff,
+    0x44,0x77,0x11,0x70,0xff,0x21,0x41,0x70,0xff,0x4,0x71,0x4,0x70,0x44,0x80,0x81,
+    0x71,0xff,0x4,0x81,0x44,0x71,0xc4,0x71,0xc1,0x72,0xff,0x84,0x73,0x84,0x72,0x84,
+    0x81,0x1,0x74,0xff,0x44,0x82,0xc4,0x73,0x44,0x74,0x41,0x75,0xff,0x4,0x76,0x4,
+    0x75,0xc4,0x82,0x5,0xf0,0xff,0xad,0xff,0x3,0x28,0xa,0xd1,0x68,0x46,0xf6,0x3f,
+    0x0,0x70,0x4,0x37,0x0,0x2,0x21,0x81,0x70,0x7d,0xc4,0x3d,0x0,0x0,0xf0,0x58,
+    0xf8,0x3,0x83,0x0,0xff,0x1c,0xb5,0x6b,0x46,0x1,0x24,0x1c,0x70,0xff,0x58,0x70,
+    0x0,0x20,0x98,0x70,0xd9,0x70,0xfb,0x1a,0x71,0x2b,0x0,0xf0,0x4a,0xf8,0xf1,0xf7,
+    0xf7,0x7,0xfa,0x13,0xd7,0x1,0x84,0xb0,0x1,0xab,0xf5,0x4,0x1f,0x4,0x9a,0x1d,
+    0x0,0x0,0x20,0x18,0x71,0xff,0xef,0xf3,0x10,0x80,0x0,0x90,0x72,0xb6,0xff,0x1,
+    0xa8,0x0,0xf0,0x36,0xf8,0x0,0x98,0xff,0x80,0xf3,0x10,0x88,0x4,0xb0,0x10,0xbd,
+    0xfb,0x18,0xb5,0x19,0x0,0x81,0x0,0x91,0x72,0xb6,0xff,0x2b,0x4c,0xa1,0x7f,0x62,
+    0x7f,0x91,0x42,0xff,0x1b,0xd0,0x8a,0x0,0x52,0x18,0xa2,0x18,0xff,0x13,0x78,0x3,
+    0x70,0x53,0x78,0x43,0x70,0xff,0x93,0x78,0x83,0x70,0xd3,0x78,0xc3,0x70,0xff,0x13,
+    0x79,0x3,0x71,0x50,0x78,0xff,0x28,0xff,0x12,0xd0,0xff,0x20,0x50,0x70,0x48,0x1c,
+    0xff,0x5,0x21,0xe1,0xf7,0x13,0xf8,0xa1,0x77,0xff,0xa0,0x7f,0xdc,0x21,0x41,0x40,
+    0xe1,0x77,0xff,0x6,0xe0,0x0,0x21,0x1,0x70,0xff,0x22,0xff,0x42,0x70,0x81,0x70,
+    0xc1,0x70,0x1,0x71,0xfa,0x63,0x6,0x11,0x8d,0x0,0x1,0x0,0x14,0x4c,0x60,0xef,
+    0x7f,0x82,0x0,0x12,0x55,0x0,0xb,0x78,0x13,0xff,0x70,0x4b,0x78,0x53,0x70,0x8b,
+    0x78,0x93,0xff,0x70,0xcb,0x78,0xd3,0x70,0x9,0x79,0x11,0xfb,0x71,0x40,0x4b,0x0,
+    0xe0,0xf7,0xed,0xff,0x61,0xff,0x77,0x61,0x7f,0xcd,0x20,0x48,0x40,0xa,0xff,0x4a,
+    0x10,0x70,0xa0,0x7f,0x81,0x42,0xb,0xed,0xd1,0x19,0x6,0xe0,0xff,0x65,0xe,0x20,
+    0x7f,0x40,0xff,0x1c,0x20,0x77,0x10,0xbd,0x0,0x0,0xdc,0xef,0x7f,0x0,0x20,0xfc,
+    0x3,0x0,0x15,0x48,0x16,0xff,0x49,0x8,0x80,0x80,0x20,0x15,0x49,0x8a,0xff,0x79,
+    0x2,0x42,0xfc,0xd1,0x8,0x78,0xf0,0xff,0x22,0x2,0x40,0xb,0x20,0x10,0x43,0x8,
+    0xff,0x70,0x11,0x48,0x0,0x68,0x0,0x5,0x0,0xff,0xf,0x3,0x28,0x4,0xda,0xf,
+    0x48,0x1,0xff,0x88,0x42,0xc,0xa,0x43,0x2,0x80,0x70,0x7f,0x47,0xd,0x48,0x1,
+    0x78,0x2,0x22,0xb,0x0,0xbf,0x70,0x80,0x21,0xc2,0x79,0xa,0x35,0x0,0x70,0xfb,
+    0x47,0x9,0x13,0x0,0x9,0x6,0x1,0xd4,0xa5,0xfe,0x6f,0x1,0x70,0x47,0x0,0x0,
+    0x1,0x42,0x0,0xff,0x0,0x2,0xc,0x0,0x40,0x1,0x10,0x0,0xff,0x40,0x18,0x20,
+    0x0,0x41,0x3c,0x8,0x0,0xeb,0x40,0x0,0xb,0x0,0x7,0x3,0x0,0x70,0xb4,0x1,
+    0xff,0x20,0x45,0x49,0xa,0x8b,0x12,0xa,0x2,0xdf,0x42,0x4,0xd1,0xa,0x7d,0x77,
+    0x0,0xd0,0x42,0xf7,0x4a,0xa,0x80,0x9,0x6,0x4a,0x68,0x1e,0x23,0xff,0x9a,0x43,
+    0x6,0x23,0x13,0x43,0x4b,0x60,0xff,0x3e,0x49,0x4a,0x69,0x3e,0x4b,0x13,0x40,0xff,
+    0x4b,0x61,0x3d,0x4a,0x3,0x2,0x92,0x1c,0xf7,0x53,0x60,0x5b,0x3,0x0,0x3b,0x4b,
+    0x13,0x60,0xff,0x92,0x1e,0x3b,0x4b,0xb,0x81,0x3b,0x4b,0xff,0x3b,0x4c,0x1,0xe0,
+    0x5c,0x68,0x64,0x1e,0xff,0x5c,0x60,0xc,0x68,0x64,0x8,0x4,0x40,0x7f,0x2,0xd1,
+    0x5c,0x68,0x0,0x2c,0xf5,0x5,0x4,0x7f,0x20,0xd0,0x35,0x4c,0x92,0x1c,0x14,0x2b,
+    0x0,0xff,0x84,0x24,0xe4,0x1,0x14,0x80,0x2,0x24,0xff,0xc,0x83,0xc,0x68,0x24,
+    0x9,0x4,0x40,0xfb,0x3,0xd1,0x7,0x0,0xa,0x4,0x40,0xf7,0xd0,0xff,0x2d,0x4c,
+    0xc,0x62,0xc,0x8b,0xc,0x25,0xff,0x25,0x43,0xd,0x83,0x90,0x25,0x6d,0x0,0xff,
+    0xd0,0x24,0xe,0x68,0x26,0x40,0xd0,0x2e,0xff,0x2,0xd0,0xe,0x68,0x2e,0x40,0xf8,
+    0xd0,0xeb,0xc,0x68,0x15,0x2,0x25,0x57,0x8,0xa,0xd1,0x0,0xfe,0x43,0x0,0x21,
+    0x4d,0x92,0x1c,0x15,0x60,0x0,0xef,0x25,0x20,0x4e,0x16,0x5b,0x0,0xc,0x81,0x2,
+    0xf7,0xe0,0x1,0x25,0x17,0x2,0x1d,0x70,0x82,0x23,0xff,0xdb,0x1,0x13,0x80,0x2,
+    0x23,0xb,0x83,0xff,0xb,0x68,0x1b,0x9,0x3,0x40,0xfb,0xd0,0xff,0x18,0x48,0x8,
+    0x62,0x8,0x8b,0xc,0x23,0xff,0x3,0x43,0xb,0x83,0xd0,0x24,0x8,0x68,0xff,0x20,
+    0x40,0xd0,0x28,0xfb,0xd1,0x14,0x48,0xff,0x92,0x1c,0x10,0x60,0x48,0x69,0x80,0x22,
+    0xff,0x2,0x43,0x4a,0x61,0x70,0xbc,0x70,0x47,0xcf,0x8,0x48,0x0,0x78,0x37,0x3,
+    0x25,0x1,0x41,0x45,0xef,0xa5,0x0,0x0,0xc,0x2f,0x1,0xff,0xfc,0xff,0xfd,0xff,
+    0x43,0x5,0x6,0x1,0x0,0x4e,0x5,0x0,0xff,0x0,0xac,0x49,0x0,0x20,0x20,0xa1,
+    0x7,0xff,0x0,0x2,0x5,0x1,0x0,0xb8,0x5,0x3f,0xfb,0x3,0x2,0x13,0x0,0x2,
+    0x3,0x1,0x0,0x6,0xff,0x0,0x3f,0x7,0x0,0x7,0x1,0x0,0x80,0xff,0xb5,0x43,
+    0x48,0x2,0x21,0x1,0x70,0x0,0xff,0x21,0x41,0x60,0x81,0x60,0x41,0x70,0x40,0xff,
+    0x49,0xa,0x78,0xfc,0x23,0x13,0x40,0x1,0xff,0x22,0x1a,0x43,0xa,0x70,0xc9,0x1c,
+    0xca,0xfb,0x69,0x3d,0x4b,0x1,0xcb,0x61,0x0,0x22,0x3c,0xff,0x49,0xc,0x30,0xff,
+    0xf7,0xfb,0xfc,0x1,0xbb,0xbd,0x36,0xb7,0x1,0x0,0x29,0x0,0xc1,0x1,0x10,0xff,
+    0xb5,0x1,0x29,0x5,0xd1,0x36,0x49,0xa,0xfb,0x68,0x4,0x7f,0x1,0xa,0x60,0x6,
+    0xe0,0x2,0xef,0x29,0x4,0xd1,0x32,0xf,0x4,0x13,0x43,0xb,0xff,0x60,0x31,0x4c,
+    0x21,0x68,0x1,0x22,0x91,0xff,0x43,0x21,0x60,0x61,0x68,0x91,0x43,0x61,0xfb,0x60,
+    0xa1,0x5,0x0,0xa1,0x60,0x0,0x22,0xfa,0xfd,0x21,0x4b,0x2,0xdc,0xfc,0xbf,0xf3,
+    0x4f,0x8f,0x37,0x30,0xbf,0x0,0x1,0x4,0x1,0x20,0x2b,0x0,0x29,0x4,0xfd,0x1,
+    0x29,0x4,0x8,0x43,0xa0,0x60,0x10,0xbd,0xff,0x10,0xb4,0x1b,0x4a,0x53,0x68,0x94,
+    0x68,0xff,0x0,0x28,0x3,0xd0,0x2,0x28,0xd,0xd0,0xff,0x5,0xd3,0x12,0xe0,0x1,
+    0x20,0x88,0x40,0xdf,0x3,0x43,0x84,0x43,0xd,0x9,0x4,0x83,0x43,0x7f,0x21,0x0,
+    0x4,0x0,0xc,0x43,0x6,0xd,0x4,0xff,0xc1,0x43,0xb,0x40,0x20,0x0,0xc,0x0,
+    0xff,0x4,0x40,0x94,0x60,0x53,0x60,0x0,0x2b,0xff,0x1,0xd0,0x0,0x20,0x4,0xe0,
+    0x0,0x2c,0xff,0x1,0xd0,0x1,0x20,0x0,0xe0,0x2,0x20,0xdf,0x10,0x70,0x0,0x20,
+    0x10,0x3b,0x1,0x5,0x49,0xff,0x48,0x70,0x70,0x47,0x4,0x48,0x40,0x78,0x3f,0x3,
+    0x28,0x1,0xd1,0x1,0x20,0x47,0x1,0x3,0x2,0xdb,0x0,0xb0,0x7,0x0,0x1,0x4,
+    0x47,0x1,0xff,0xfe,0xff,0xff,0x85,0xb8,0x2,0x0,0x10,0xed,0x0,0xfb,0xe0,0x18,
+    0xf,0x0,0x80,0xb5,0xff,0xf7,0xa7,0xff,0xfe,0x1,0xbd,0x80,0xb5,0x73,0x48,0x1,
+    0xff,0x68,0x80,0x22,0xa,0x43,0x2,0x60,0x71,0xff,0x49,0x9,0x68,0x9,0x5,0x9,
+    0xf,0x3,0xff,0x29,0x4,0xda,0x1,0x68,0xc0,0x22,0x92,0xfd,0x0,0x15,0x2,0x3,
+    0x21,0x2,0x20,0xff,0xf7,0xd7,0xa3,0xff,0x6b,0x27,0x0,0x6,0xfb,0x0,0x1,0x60,
+    0x7f,0x1,0xbd,0x10,0xb5,0x4,0x0,0x67,0xf,0x0,0xdd,0x4,0x37,0x4,0x3,0x21,
+    0x0,0x21,0x0,0x92,0xff,0xf7,0x63,0x48,0x41,0x49,0x0,0xd2,0x2,0xa,0x43,0xff,
+    0x42,0x60,0x1,0x21,0x2,0x7d,0xa,0x42,0xff,0xfc,0xd0,0x61,0x8,0xc1,0x61,0x5e,
+    0x49,0xf7,0x1,0x80,0x10,0x69,0x0,0x1,0x22,0x5b,0x49,0xf7,0xb,0x7d,0x13,0x15,
+    0x0,0x40,0x8,0xc8,0x61,0xff,0x5a,0x48,0x8,0x80,0x48,0x68,0x59,0x4a,0x77,0x2,
+    0x40,0x4a,0x63,0x8,0x71,0xff,0x52,0x53,0x4,0xfe,0x63,0x6,0x54,0x49,0x88,0x42,
+    0x3,0xd3,0x53,0xff,0x4a,0x89,0x18,0x88,0x42,0x1,0xd3,0x4,0xff,0x20,0x1a,0xe0,
+    0x1,0x21,0x4b,0x4a,0x13,0xef,0x7d,0xb,0x42,0xfa,0x3f,0x0,0xd0,0x61,0x4e,0xbf,
+    0x48,0x10,0x80,0x10,0x7d,0x8,0x4d,0x0,0x0,0xfd,0x20,0x15,0x2,0xfc,0xd0,0x13,
+    0x8b,0x9b,0x8,0xfb,0xb,0x42,0x19,0x3,0x4,0xe0,0x12,0x8b,0xd2,0x7b,0x8,0xa,
+    0xb,0x0,0x2,0x20,0xc0,0x43,0xd7,0x1,0xff,0xb4,0x43,0x4a,0x1,0x23,0x14,0x78,
+    0x1c,0xfe,0x25,0x0,0x8,0x80,0x6,0xe0,0x10,0xb4,0x3f,0x7e,0xf,0xe,0x60,0x0,
+    0x20,0x11,0x78,0x19,0x9,0x0,0xdf,0x91,0x88,0x89,0x8,0x19,0x3f,0x8,0x91,0x88,
+    0xf1,0xc9,0xb,0x4,0x3f,0x2,0x5f,0x3,0x80,0xb5,0x2c,0x49,0xfa,0xb5,0x2,0x32,
+    0xb5,0x0,0x1,0x20,0xa,0x7d,0x2,0xfe,0x77,0x2,0xf0,0x35,0xf8,0x2,0xbd,0x2,
+    0x20,0xff,0x24,0x49,0xa,0x68,0x2,0x43,0xa,0x60,0xff,0x82,0x21,0xc9,0x5,0xa,
+    0x68,0x10,0x43,0xfe,0x51,0x2,0xc0,0x43,0x29,0x49,0x8,0x60,0x70,0xff,0x47,0x28,
+    0x4a,0x50,0x60,0x90,0x68,0x80,0xff,0x7,0x80,0xf,0x89,0x0,0x1,0x43,0x91,0xff,
+    0x60,0x50,0x78,0x1,0x21,0x1,0x43,0x51,0xfb,0x70,0x4,0x73,0x0,0x1,0x43,0x11,
+    0x70,0x51,0xff,0x78,0x0,0x29,0xfc,0xd0,0x51,0x78,0x1,0xff,0x42,0x0,0xd0,0xfe,
+    0xe7,0xd1,0x68,0xc8,0x2a,0xad,0x0,0x1c,0x5,0x1,0x2,0x59,0x5,0xe,0x9,0x4,
+    0xf,0x3,0x7e,0xcf,0x3,0x12,0x4a,0x1,0x21,0x13,0x78,0xe9,0x2,0xdb,0x93,0x88,
+    0xe9,0xe,0x92,0x88,0xe9,0x12,0x4,0x40,0x7f,0x0,0x41,0x18,0x20,0x0,0x41,0x1c,
+    0xe3,0x1,0x7e,0x1,0x0,0x41,0x41,0xa5,0x0,0x0,0x40,0x3,0x0,0xff,0xff,0xff,
+    0xfb,0xff,0x0,0xef,0x3,0x0,0x5f,0x0,0x10,0x0,0x0,0x2,0xf,0x0,0x14,0x1b,
+    0x0,0xd5,0x4,0x7,0x0,0xc,0x2b,0x0,0x0,0x3,0x0,0x4,0x0,0xff,0x0,0x41,
+    0x10,0xb4,0xa1,0x49,0xa1,0x48,0xef,0x8,0x61,0xa1,0x48,0xfb,0x1,0x2,0x37,0x23,
+    0xff,0xc2,0x50,0x80,0x23,0x5b,0x4,0x8b,0x61,0xff,0x9e,0x4b,0xb,0x60,0x27,0x21,
+    0x42,0x50,0xff,0x9d,0x49,0x5,0x22,0xca,0x76,0xa,0x76,0xff,0x4a,0x76,0x9c,0x4a,
+    0x3,0x23,0xd3,0x77,0xff,0x9b,0x4c,0x23,0x70,0xa3,0x71,0x93,0x74,0xff,0x3,0x70,
+    0x7,0x23,0xc3,0x70,0x22,0x20,0xff,0x8,0x70,0x48,0x70,0xd0,0x71,0x0,0x20,0xff,
+    0x88,0x71,0x90,0x72,0x10,0x70,0x8,0x71,0xff,0x94,0x49,0x95,0x4a,0x11,0x80,0x95,
+    0x49,0x7f,0x88,0x61,0x1,0x20,0xc8,0x61,0x94,0x59,0x0,0x1d,0x2,0x23,0x0,0x10,
+    0x20,0x92,0x19,0x1,0x3,0x2,0x57,0x3,0xff,0x0,0x23,0x0,0x29,0x0,0xd0,0x4,
+    0x23,0xff,0x0,0x2a,0x1,0xd1,0x1,0x21,0x4,0xe0,0xfd,0x1,0x7,0x0,0x2,0x21,
+    0x0,0xe0,0x3,0x21,0xff,0x19,0x28,0x15,0xd0,0x23,0x28,0x9,0xd0,0xff,0x37,0x28,
+    0x1a,0xd1,0x88,0x48,0x2,0x7d,0xff,0x13,0x43,0x3,0x75,0x87,0x48,0x2,0x68,0xff,
+    0x9,0x7,0x6,0xe0,0x84,0x48,0x2,0x78,0xb6,0xf,0x0,0x70,0x83,0xf,0x2,0x3,
+    0x11,0x1f,0x5,0x74,0xfe,0x13,0x8,0x7e,0x48,0x42,0x68,0x9,0x5,0x11,0xfb,0x43,
+    0x41,0x33,0x3,0x0,0x1,0x0,0x18,0x39,0xff,0x8,0x29,0x8,0xd2,0x7f,0xa1,0x82,
+    0x10,0xff,0x52,0xf,0x12,0x18,0xd2,0x10,0xd2,0x0,0xff,0x80,0x1a,0x8,0x5c,0x5,
+    0xe0,0xc1,0x10,0xff,0x9,0xf,0x9,0x18,0x9,0x11,0x9,0x1,0xf7,0x40,0x1a,0x72,
+    0xc1,0x1,0x12,0xc,0x12,0x4,0x3f,0x1,0x23,0x83,0x40,0x98,0xb2,0xc1,0x3,0x3b,
+    0x2,0xfb,0x10,0xb4,0x3d,0x6,0x9,0xd2,0x0,0xbf,0x6f,0xfe,0x3f,0x34,0x1,0x22,
+    0x82,0x40,0x90,0xb2,0x61,0xff,0x49,0x4b,0x68,0x1b,0xc,0x1b,0x4,0x3,0xff,0x43,
+    0x4b,0x60,0x8b,0x68,0x1c,0xc,0x24,0xff,0x4,0x1a,0x43,0x92,0xb2,0x22,0x43,0x8a,
+    0xa1,0x60,0x5d,0x6,0x57,0x2,0xf3,0x2,0x93,0xa,0x5a,0x53,0x36,0x21,0x67,0x81,
+    0x40,0x4e,0xdf,0x0,0x39,0x2,0x8b,0xb2,0xd9,0x0,0xef,0x60,0xc2,0x68,0x13,0x5d,
+    0x0,0x8a,0x43,0x91,0xef,0xb2,0x19,0x43,0xc1,0xa1,0x0,0x1,0x11,0xc9,0xff,0xe,
+    0x9,0x18,0x49,0x11,0x33,0x4a,0xb,0xff,0x6,0x5b,0xc,0xd2,0x18,0x12,0x6a,0x49,
+    0xfe,0x37,0x0,0xc2,0x40,0xd0,0x7,0xc0,0xf,0x40,0xff,0x1e,0x80,0x41,0xc0,0x43,
+    0xc0,0xf,0x70,0xd7,0x47,0xff,0x28,0x59,0x1,0x20,0x2d,0xe,0x1,0x22,0xff,0x4b,
+    0x1,0xc0,0x1a,0x82,0x40,0x26,0x48,0xff,0x9,0x6,0x49,0xc,0x40,0x18,0x82,0x61,
+    0xa9,0x0,0x1d,0x0,0x25,0x2a,0x1c,0x25,0x8,0x42,0x25,0x4,0x80,0x4f,0x20,0x40,
+    0x4,0x2a,0xb9,0x1,0x9,0x6,0x28,0x9,0x4,0xff,0x48,0x20,0x27,0x49,0x9,0x68,
+    0x89,0x2,0xf7,0x0,0xd5,0x49,0x21,0x0,0x70,0xb5,0x0,0xf0,0xff,0xb9,0xfc,0x6,
+    0x0,0x1e,0x4c,0x60,0x68,0xff,0x25,0x68,0x5,0x40,0x28,0x6,0x3,0xd5,0xff,0x31,
+    0x0,0x0,0x20,0xeb,0xf7,0x62,0xfd,0xeb,0x28,0x7,0xb,0x2,0x1,0xb,0x0,0x5c,
+    0xfd,0xa8,0xf5,0x4,0xb,0x2,0x2,0xb,0x0,0x56,0xfd,0xe8,0x5,0xf7,0x2,0xd5,
+    0x30,0x23,0x0,0xc0,0x46,0x65,0x60,0xff,0x70,0xbd,0x0,0x0,0x0,0x44,0x0,0x41,
+    0xdf,0x0,0x0,0xcf,0x8,0x59,0x7,0x4,0xc7,0x9,0xd5,0x38,0x7,0x0,0xb1,0x3,
+    0x0,0xd1,0x3,0x0,0x3,0x42,0xff,0x0,0x0,0x2,0xc,0x0,0x40,0x0,0x18,0xff,
+    0x0,0x40,0xff,0xff,0x0,0x0,0x80,0xe2,0x7f,0x0,0xe0,0x0,0xe1,0x0,0xe0,0xc3,
+    0x1b,0x0,0x55,0x18,0x13,0x0,0x10,0x3,0x0,0xc,0x3,0x0,0x8,0x3,0x0,0xd5,
+    0x18,0x13,0x0,0x14,0x3,0x0,0x20,0x3,0x0,0xc,0xd,0xff,0xff,0xf,0x8,0xff,
+    0xa,0xb,0xf0,0xb5,0xff,0x85,0xb0,0xca,0x4c,0x0,0x94,0xd4,0x4d,0xff,0x2c,0x60,
+    0x0,0x99,0x8,0x78,0x4a,0x78,0xff,0x12,0x6,0x12,0xc,0x10,0x43,0xd1,0x4f,0x7f,
+    0xb8,0x42,0x1b,0xd1,0x88,0x78,0xca,0xf,0x8,0xff,0x3,0x28,0x14,0xd1,0x8,0x46,
+    0x8,0x30,0xff,0x5,0xf0,0x22,0xfb,0xcb,0x49,0x88,0x42,0xff,0xd,0xd1,0x28,0x0,
+    0xc,0x30,0x0,0x99,0xff,0xc,0x22,0xe0,0xf7,0xe1,0xf9,0x0,0x98,0xfb,0x80,0x21,
+    0xa3,0x1,0x18,0xa8,0x60,0x0,0x98,0xff,0x20,0x30,0x68,0x60,0x80,0x20,0x0,0x1,
+    0xff,0x24,0x18,0x20,0x78,0x61,0x78,0x9,0x6,0xff,0x9,0xc,0x8,0x43,0xb8,0x42,
+    0x21,0xd1,0xf7,0xa0,0x78,0xe1,0xd,0x8,0x3,0x28,0x1a,0xd1,0xbb,0x20,0x0,0x4b,
+    0x2,0xfc,0xfa,0xb8,0x4b,0x0,0x13,0xff,0xd1,0x20,0x1d,0x5,0xf0,0xf6,0xfa,0x29,
+    0xb5,0x69,0x57,0x0,0xd3,0x57,0x2,0x21,0x0,0x57,0x2,0xb5,0x5f,0xf9,0x2c,0x60,
+    0x20,0x0,0x4f,0xa,0x20,0x5d,0x0,0xff,0xad,0x4e,0x68,0x69,0xb0,0x42,0x45,0xd1,
+    0xff,0x2c,0x68,0xc,0x34,0x0,0x26,0x0,0xe0,0xff,0x24,0x1d,0xa8,0x68,0x84,0x42,
+    0x33,0xd2,0xff,0x21,0x88,0xa7,0x4a,0x91,0x42,0xf7,0xd0,0xff,0x61,0x88,0x89,0x0,
+    0x61,0x18,0x9,0x1d,0xff,0x1,0x91,0x61,0x88,0x0,0x29,0x2,0xd0,0xff,0x1,0x99,
+    0x88,0x42,0x5,0xd2,0x0,0x98,0xff,0xff,0xf7,0x2e,0xfd,0x0,0xf0,0xbf,0xf8,0xff,
+    0x8e,0xe0,0x20,0x88,0x5,0xf0,0xcd,0xfa,0xff,0x1,0x28,0x17,0xd0,0x67,0x88,0xff,
+    0xf7,0xff,0xa9,0xfd,0x39,0x0,0x20,0x0,0xff,0xf7,0xf7,0xb4,0xfd,0x6,0x5,0x0,
+    0xcb,0xfd,0xb8,0x0,0xff,0x20,0x58,0x86,0x42,0x8,0xd1,0x2,0xa8,0xff,0x21,0x88,
+    0x1,0x80,0x61,0x88,0x41,0x80,0xff,0x3,0x94,0x3,0xc8,0x5,0xf0,0x84,0xfc,0xff,
+    0x26,0x0,0x1,0x9c,0xc8,0xe7,0x0,0x2e,0xff,0x70,0xd0,0x70,0x88,0x80,0x0,0x36,
+    0x18,0xff,0x23,0x36,0x1f,0x20,0x86,0x43,0x6e,0x60,0x9b,0x68,0xe0,0x5d,0x2,0xff,
+    0xfc,0x63,0x8,0x7,0x1,0x49,0xae,0x68,0x1,0xff,0xf7,0x28,0xb,0x4,0x89,0xb,
+    0x4,0x22,0xaa,0xb,0x0,0xc0,0xb,0x8,0x1c,0x17,0x4,0xc9,0xb,0x4,0x16,0x4a,
+    0xb,0x0,0xa0,0xb,0x8,0x10,0x23,0x4,0xb,0x6,0xa,0xb,0x0,0xed,0xe0,0xb,
+    0x8,0x4,0xfd,0x9f,0x2,0x1,0xfd,0x80,0xef,0x20,0x40,0x0,0x20,0xf,0x0,0xfc,
+    0xfc,0x80,0xbb,0x20,0x80,0x9,0x4,0xf7,0xfc,0xc0,0x9,0x8,0xf2,0xba,0x13,0x0,
+    0xc0,0x9,0x4,0xed,0xfc,0xa0,0x9,0x8,0xe8,0xdc,0x1d,0x0,0x9,0x6,0xe3,0xfc,
+    0xe0,0x9,0x8,0xde,0xfc,0xff,0xaf,0x81,0x3,0x20,0xe8,0x81,0x6e,0x61,0xcf,0x1,
+    0x20,0x28,0x61,0xa9,0x7,0xb9,0x11,0xf0,0x93,0xfd,0xf8,0xc5,0x2,0xb3,0xfc,0x5,
+    0xb0,0xf0,0xbd,0xff,0x33,0xb5,0x83,0xb0,0x15,0x0,0x44,0x4c,0xfe,0x7d,0x2,0x90,
+    0xfc,0x4d,0x48,0x41,0x68,0x3,0xff,0xaa,0x52,0x88,0x52,0x1c,0x12,0x4,0x92,0xbf,
+    0xb,0x89,0x18,0x80,0x68,0x81,0xa9,0x1,0x68,0xbf,0x46,0x80,0x89,0x69,0x46,0x8,
+    0x84,0x0,0x6a,0x7f,0x46,0x50,0x80,0x1,0x90,0x68,0x46,0x2b,0x3,0xff,0xee,0xfb,
+    0x0,0xf0,0xa,0xf8,0x2a,0x0,0xff,0x3,0xa8,0x3,0xc8,0x0,0xf0,0x85,0xf8,0xba,
+    0x41,0x2,0x89,0x53,0x0,0x30,0xbd,0xf0,0x53,0x0,0x0,0xff,0x27,0x0,0x24,0x2e,
+    0x4e,0x39,0x4d,0x28,0xdf,0x68,0xb0,0x42,0x2,0xd1,0xd7,0x3,0x36,0x18,0x29,0x30,
+    0x63,0x4,0xe1,0x2,0x30,0xa5,0x0,0x8b,0xe1,0x4,0x9,0x2,0x49,0x86,0xe1,0x4,
+    0x9,0x2,0x81,0xe1,0x4,0x9,0x2,0x7c,0xe1,0x4,0x92,0x9,0x2,0x77,0xe1,0x4,
+    0x9,0x2,0x72,0xe1,0x4,0x9,0x2,0x6d,0x5f,0xfc,0x2e,0x60,0x6e,0x60,0xd1,0x2,
+    0x70,0xd1,0x0,0x7b,0x30,0x46,0xe1,0x2,0x5,0xe0,0x12,0x1d,0x99,0x2,0xff,0x0,
+    0xf0,0x3f,0xf8,0x64,0x1c,0x5,0xf0,0xff,0x9,0xfc,0xa4,0xb2,0x84,0x42,0x12,0xd2,
+};
+
+static const uint8_t dfuStream_1_7_0_390_page5[30000] PROGMEM = {
+    0xff,0x21,0x0,0x68,0x46,0x5,0xf0,0x5,0xfc,0xff,0x1,0x9a,0x0,0x2a,0x3,0xd0,
+    0x68,0x46,0xff,0x40,0x88,0x2,0x28,0xe9,0xd2,0x69,0x46,0xef,0x4f,0x80,0x1,0x97,
+    0xc9,0x6,0x89,0xfb,0xe7,0xdf,0xe7,0x28,0x69,0x40,0x1c,0x2b,0x1,0xf0,0x5,0xfb,
+    0xf8,0x3,0x15,0x1,0x0,0x0,0x0,0xef,0x3,0xff,0x0,0xf8,0xb5,0x3,0x24,0x8,
+    0x4e,0x35,0xff,0x68,0xa,0x4f,0xe4,0x19,0xa4,0xb2,0xa0,0xff,0x0,0x29,0x18,0x30,
+    0x18,0xc0,0x68,0xff,0xff,0xf7,0x5c,0xfc,0x0,0x2c,0xf5,0xd1,0x28,0xee,0xcd,0x0,
+    0x70,0xfc,0xf1,0x2b,0x0,0x28,0x48,0x0,0xff,0x20,0xe8,0xe8,0x0,0x0,0xe,0x47,
+    0x58,0xff,0xb7,0xff,0xff,0x0,0x0,0xf7,0xb5,0x82,0xff,0xb0,0x2,0xac,0x60,0x88,
+    0x40,0x1c,0x80,0xff,0xb2,0x0,0x90,0x34,0x48,0x46,0x68,0x80,0xff,0x68,0x0,0x99,
+    0x89,0x0,0x71,0x18,0x88,0xff,0x42,0x4,0xd2,0x2,0x22,0x3,0x21,0x4,0xff,0x20,
+    0xff,0xf7,0xba,0xf9,0x0,0x98,0x2,0xff,0x28,0x55,0xd3,0x2d,0x48,0x2d,0x49,0x8,
+    0xff,0x80,0xff,0xf7,0x57,0xfc,0xb1,0x1c,0x60,0xff,0x88,0xff,0xf7,0x25,0xfc,0x31,
+    0x0,0x20,0xfe,0x7,0x0,0x21,0xfc,0x1,0x24,0x0,0x25,0x0,0xff,0x9f,0x7f,0x1e,
+    0x17,0xe0,0xa0,0x0,0x31,0xff,0x18,0x4,0x9a,0x10,0x18,0x0,0x1f,0x0,0xfe,0x7f,
+    0x0,0x1c,0xfc,0x64,0x1c,0xa4,0xb2,0x28,0xff,0x0,0x8,0x30,0x84,0x42,0x1,0xda,
+    0xbc,0xff,0x42,0xef,0xdb,0x84,0x42,0x5,0xd1,0xa8,0x7e,0x19,0x5,0x27,0xfc,0x8,
+    0x35,0xad,0xb2,0x13,0x2,0xff,0x1,0x21,0x2,0xa8,0xff,0xf7,0x3b,0xfc,0xff,0x7,
+    0x0,0x0,0x98,0x3,0x28,0x5,0xd3,0x5f,0x81,0x1e,0x89,0xb2,0x4,0xf7,0x1,0x32,
+    0x11,0x0,0xaf,0xff,0xf7,0x49,0xfc,0x53,0x2,0x38,0x9,0x0,0xf5,0x7d,0xfb,0x39,
+    0x6,0xa,0xfc,0x3,0x96,0x2,0xcb,0x1,0xff,0x5,0xf0,0x1,0xfb,0x0,0x98,0xc0,
+    0x1d,0xff,0x6,0x49,0x49,0x68,0x82,0x10,0x52,0xf,0xff,0x10,0x18,0xc0,0x10,0x40,
+    0x1,0x8,0x18,0x9f,0x2,0x49,0x48,0x60,0x5,0x1b,0x5,0xef,0x2,0x44,0xfd,0xa5,
+    0x23,0x1,0x40,0x0,0x41,0x10,0xb5,0x60,0xff,0x4c,0x0,0x20,0x20,0x70,0x5,0xf0,
+    0x7e,0xf7,0xfb,0xc0,0x46,0x1,0x6,0x5,0xf0,0x34,0xfc,0xff,0x60,0x78,0x0,0x28,
+    0x9,0xd1,0x1,0x20,0xff,0x60,0x70,0xea,0xf7,0xd9,0xff,0x0,0x28,0xff,0x3,0xd0,
+    0x1,0x21,0x1,0x20,0x5,0xf0,0xff,0xb5,0xfd,0xf0,0xf7,0x9,0xfd,0x5,0xf0,0xff,
+    0xbf,0xfd,0x10,0xbd,0x80,0xb5,0x0,0x28,0xff,0x1,0xd0,0x1,0x28,0x1,0xd1,0x1,
+    0x21,0x7f,0x0,0xe0,0x0,0x21,0x4d,0x4a,0x11,0x47,0x0,0xf7,0x9b,0xfe,0x1,0x19,
+    0x2,0x20,0x4a,0x49,0x8,0xfa,0xd,0x0,0x9a,0xd,0x0,0x47,0x48,0x0,0x78,0x70,
+    0xfd,0x47,0x2d,0x2,0x2,0xd0,0x2,0x28,0x4,0xd0,0xff,0x7,0xe0,0x8,0x0,0x5,
+    0xf0,0x9e,0xfe,0xff,0x2,0xbd,0x8,0x0,0xf0,0xf7,0x6,0xfd,0x5f,0x2,0xbd,0x0,
+    0x20,0x2,0x33,0x0,0x1,0x1f,0x4,0x7f,0xe,0xd0,0x13,0xe0,0x8,0x32,0x10,0x21,
+    0x0,0xff,0x91,0xfe,0x1,0x0,0xe,0xd0,0x5,0x28,0x77,0xc,0xd0,0x2,0x7b,0x4,
+    0x77,0xfd,0x5,0x27,0x0,0x5e,0x1b,0x2,0xf0,0xf7,0xd3,0xfc,0x33,0x2,0xb,0x3,
+    0x0,0xff,0x0,0x0,0x31,0xa1,0xc,0xc9,0xc,0xc0,0x6b,0x8,0x38,0x63,0x2,0x68,
+    0xbd,0x0,0x47,0xf9,0x97,0x2,0xfd,0x2,0x1b,0x2,0x98,0xeb,0xf7,0x91,0xfa,0x0,
+    0xff,0x28,0x7,0xd1,0xc0,0x21,0x27,0x48,0x5,0xbb,0xf0,0x46,0x19,0x0,0x4,0xd0,
+    0x4,0x19,0x0,0x5,0xef,0xf0,0xb3,0xf9,0x3,0x7,0x0,0x10,0xb5,0xd4,0xff,0xb0,
+    0x8c,0x21,0x31,0xa8,0xdf,0xf7,0x42,0xff,0xff,0xb,0xa8,0x33,0x90,0x13,0xa8,0x38,
+    0xff,0x90,0xf,0xa8,0x39,0x90,0x2c,0xa8,0x3a,0xff,0x90,0x27,0xa8,0x3b,0x90,0x8,
+    0xa8,0x4a,0xff,0x90,0x2,0xa8,0x4b,0x90,0x17,0xa8,0x4c,0xff,0x90,0x68,0x46,0x4d,
+    0x90,0x4,0xa8,0x50,0xff,0x90,0x31,0xa8,0x5,0xf0,0x23,0xff,0x31,0xff,0xa8,0xeb,
+    0xf7,0x52,0xf8,0x4,0x0,0x1,0x3f,0xd0,0x10,0x2c,0x1,0xd1,0x0,0x1,0x1,0x21,
+    0x7,0x6f,0x9d,0xfc,0x0,0x2c,0x13,0x6,0x1,0x20,0x15,0x1,0xff,0x20,0x8,0x49,
+    0x88,0x70,0x20,0x0,0x54,0xff,0xb0,0x10,0xbd,0x5,0x48,0x81,0x78,0x0,0xff,0x29,
+    0x5,0xd0,0x41,0x78,0x48,0x1e,0x80,0xff,0x41,0xc0,0x43,0xc0,0xf,0x70,0x47,0x0,
+    0xef,0x20,0x70,0x47,0x25,0x8f,0x1,0x1f,0x1f,0x0,0xfd,0x0,0xe9,0x1,0x0,0x6c,
+    0x4d,0x3,0x0,0x84,0xff,0x48,0x1,0x7b,0x0,0x29,0x0,0xd0,0x70,0xff,0x47,0x38,
+    0xb5,0x1,0x24,0x4,0x73,0x9,0xff,0x21,0xdf,0xf7,0xf3,0xfe,0xfa,0x21,0x89,0xff,
+    0x0,0x7f,0x48,0xdf,0xf7,0xee,0xfe,0x7e,0xff,0x48,0x80,0x60,0xc0,0x60,0x0,0x61,
+    0x1,0xff,0x0,0x8,0x31,0x41,0x61,0x4,0x76,0x0,0xff,0x21,0x41,0x76,0x81,0x71,
+    0x1,0x60,0x81,0xff,0x80,0x2,0x0,0x1c,0x32,0x3,0x0,0xdc,0x7f,0x33,0x4,0x0,
+    0x1c,0x34,0x1c,0x60,0x5,0x2,0xfd,0x5c,0x5,0x4,0x9c,0x60,0xdb,0x60,0x18,0x24,
+    0xff,0x1c,0x74,0x59,0x74,0x6,0x24,0x0,0x25,0xff,0x95,0x71,0x11,0x60,0x95,0x80,
+    0x8,0x32,0xfe,0x7,0x2a,0x64,0x1e,0xed,0xd1,0x58,0x61,0x66,0xff,0x4c,0x21,0x0,
+    0x8,0x20,0x0,0xf0,0x5,0xf7,0xf8,0x21,0x0,0xc9,0x0,0xf0,0x1,0xf8,0x31,0xff,
+    0xbd,0x79,0xb5,0x82,0xb0,0x68,0x46,0x0,0xdf,0x7a,0x0,0x28,0x5,0xd0,0x7,0x2,
+    0x9,0x28,0xef,0x1,0xda,0x8,0x0,0xe9,0x0,0x22,0x4,0xe0,0xff,0x57,0x48,0x3,
+    0x7a,0xfa,0x2b,0x5,0xdb,0xff,0x3,0x22,0xb,0x21,0x4,0x20,0xff,0xf7,0xff,0x2a,
+    0xf8,0x23,0xe0,0x6a,0x46,0x12,0x7a,0xff,0x80,0x18,0x0,0x90,0x0,0x78,0x0,0x9a,
+    0xff,0x52,0x1e,0x14,0x78,0x4f,0x4a,0xa5,0x0,0xff,0x55,0x19,0x2,0xe0,0x64,0x1c,
+    0xe4,0xb2,0xff,0x2d,0x1d,0x84,0x42,0x3,0xda,0x2e,0x68,0xff,0x8e,0x42,0xf7,0xd1,
+    0xe,0xe0,0x98,0x42,0xff,0xe,0xdb,0x80,0x0,0x11,0x50,0x0,0x98,0xfb,0x9,0x21,
+    0x35,0x2,0x89,0x1a,0x2,0x78,0x52,0xff,0x1c,0x2,0x70,0x40,0x1c,0x49,0x1e,0xf9,
+    0xff,0xd1,0x4,0xb0,0x70,0xbd,0x9c,0x0,0x14,0xff,0x19,0x1b,0x1a,0x25,0x1f,0x2e,
+    0x68,0x26,0xff,0x60,0x2c,0x0,0x5b,0x1e,0xe7,0xd0,0xf8,0xdf,0xe7,0x0,0x28,0x0,
+    0xd1,0x25,0x3,0x3a,0x4b,0xff,0x8,0x28,0x1,0xdb,0x8,0x33,0x0,0xe0,0xff,0xdc,
+    0x33,0xef,0xf3,0x10,0x84,0x0,0x94,0xff,0x72,0xb6,0x5c,0x7c,0x1d,0x7c,0xac,0x42,
+    0xf7,0x5,0xd3,0x2,0x8f,0x4,0xfe,0xf7,0xe2,0xff,0xfd,0xc,0x77,0x0,0x5c,0x74,
+    0x5c,0x68,0xa0,0x71,0xdf,0x21,0x60,0xa2,0x80,0x8,0x1b,0x1,0xd9,0x68,0xff,0x8c,
+    0x42,0x1,0xd3,0x18,0x68,0x58,0x60,0xff,0x0,0x98,0x80,0xf3,0x10,0x88,0x31,0xbd,
+    0xef,0x27,0x48,0x41,0x7e,0xa3,0x1,0xd1,0xed,0x30,0xb9,0x1,0xa5,0x7,0xa3,0x9,
+    0x80,0xb5,0x21,0x19,0x4,0x4,0xff,0xd0,0x8,0x30,0x0,0xf0,0xa,0xf8,0x1,0xff,
+    0x20,0x2,0xbd,0xed,0x21,0x41,0x5c,0x0,0xff,0x29,0x1,0xd0,0xdc,0x30,0xf5,0xe7,
+    0x0,0xfe,0xf,0x0,0xf8,0xb5,0x4,0x0,0xa0,0x68,0x19,0xff,0x49,0x8,0x60,0xa7,
+    0x68,0x13,0x48,0xb9,0xff,0x79,0x40,0x18,0x41,0x1e,0x9,0x78,0x12,0xff,0x4a,0x8b,
+    0x0,0xd5,0x18,0x0,0x78,0x46,0xff,0x1a,0xf6,0xb2,0x1,0x2e,0x7,0xdb,0xba,0xff,
+    0x88,0x39,0x68,0xb8,0x79,0x2b,0x68,0x98,0x7f,0x47,0x2d,0x1d,0x76,0x1e,0xf7,0xd1,
+    0xaf,0x0,0xff,0x80,0x0,0x90,0x72,0xb6,0x60,0x7c,0x40,0xff,0x1e,0x60,0x74,0xa0,
+    0x68,0x8,0x30,0xa0,0xef,0x60,0xe1,0x68,0x88,0x97,0x0,0x20,0x68,0xa0,0xfe,0x97,
+    0x8,0xf1,0xbd,0x50,0x49,0x0,0x20,0x80,0xff,0x31,0x0,0x20,0xb8,0x3e,0x0,0x20,
+    0x91,0xff,0xc5,0x2,0x0,0xa8,0x3f,0x0,0x20,0xb,0xfd,0x0,0xfd,0x2,0x80,0xb5,
+    0x98,0x47,0x1,0xbd,0xff,0x39,0x48,0x3a,0x49,0x8,0x80,0x1,0x21,0xff,0x39,0x48,
+    0x2,0x88,0xa,0x43,0x2,0x80,0xfe,0x5,0x0,0x42,0xfc,0xd1,0x82,0x7a,0xd2,0x9,
+    0xff,0xf9,0xd1,0x0,0x21,0x1,0x80,0x81,0x21,0xff,0x9,0x2,0x81,0x80,0x41,0x88,
+    0x2,0xc,0xff,0xa,0x43,0x42,0x80,0xc1,0x21,0x81,0x71,0xff,0x2,0x88,0x2,0x23,
+    0x13,0x43,0x3,0x80,0xff,0x0,0x22,0xd2,0x43,0x82,0x61,0x1,0x72,0xc7,0x8,0x20,
+    0x2b,0xb9,0x0,0x3,0x2,0x53,0x0,0x20,0x2a,0xef,0x49,0xa,0x78,0x2,0x41,0x0,
+    0x89,0x1c,0x48,0xff,0x68,0x70,0x47,0x18,0xb4,0x1,0x0,0x0,0xf7,0x20,0x0,0x90,
+    0xab,0x0,0x82,0x0,0x92,0x72,0xff,0xb6,0x80,0x22,0x23,0x4b,0xdc,0x78,0x14,0xfe,
+    0x1f,0x0,0x5b,0x1c,0x9c,0x68,0x5b,0x1e,0xc,0xff,0x1b,0x40,0x2c,0x1,0xd3,0x0,
+    0x2c,0x1,0xdf,0xd5,0x1,0x20,0x7,0xe0,0x19,0xa,0x19,0x61,0xff,0x5b,0x1e,0x1,
+    0x21,0x19,0x70,0x0,0x99,0xed,0x81,0xc3,0x0,0x12,0xbc,0x49,0x1,0xb5,0x41,0xc,
+    0xff,0xc0,0x3,0xfa,0x22,0x92,0x0,0x0,0x23,0xff,0xe4,0xf7,0x3d,0xfc,0x0,0xbd,
+    0x0,0xb5,0xff,0x13,0x48,0x0,0x68,0x0,0x21,0x10,0x4a,0xff,0x0,0x23,0xe0,0xf7,
+    0x40,0xf9,0xc0,0xb,0xff,0x4a,0x4,0x10,0x43,0x0,0xbd,0x10,0xb5,0xff,0xe,0x4c,
+    0xa0,0x78,0xa0,0x70,0xa4,0x1c,0xff,0x20,0x69,0xa4,0x1e,0xfe,0xf7,0xb7,0xfd,0xff,
+    0x1,0x20,0x20,0x70,0x10,0xbd,0x2,0x42,0xff,0x0,0x0,0x2,0xc,0x0,0x40,0x0,
+    0x14,0xff,0x0,0x40,0x80,0xe2,0x0,0xe0,0x0,0xe1,0xd7,0x0,0xe0,0xa,0xb,0x0,
+    0x7,0x3,0x0,0x40,0x42,0xd7,0xf,0x0,0x10,0x7,0x0,0x6,0x3,0x0,0x1c,0xb5,
+    0xff,0x9b,0x4c,0xff,0xf7,0xd,0xfb,0x60,0x77,0xff,0x0,0x22,0x99,0x49,0x20,0x0,
+    0x24,0x30,0xff,0xfe,0xf7,0x61,0xfd,0x98,0x49,0x7,0x20,0xff,0xff,0xf7,0x9c,0xfe,
+    0x60,0x7f,0x78,0x21,0xff,0x78,0x22,0x2,0x40,0x78,0x2a,0x1,0xd0,0xff,0x8,0x42,
+    0x1,0xd1,0x1,0x20,0x16,0xbd,0xde,0x5f,0x0,0x77,0x6,0x21,0x2,0x1f,0x0,0x89,
+    0xf8,0xff,0xff,0xf7,0xe6,0xfa,0x68,0x46,0xff,0xf7,0xff,0xd2,0xfd,0x8c,0x48,0x69,
+    0x46,0x9,0x88,0xfb,0x1,0x71,0x5,0x2,0x9,0xa,0x41,0x71,0xf,0xff,0xa0,0x3,
+    0xc8,0x5,0xf0,0x22,0xff,0x0,0x7f,0x28,0x16,0xd1,0x20,0x7f,0x1,0x28,0x3f,0x0,
+    0xfa,0x3b,0x0,0x3,0x3b,0x0,0x12,0x20,0x20,0x80,0x20,0xff,0x0,0x4c,0x30,0x60,
+    0x60,0x3,0xcc,0x5,0xbf,0xf0,0x35,0xff,0x6,0x21,0x1,0x4b,0x0,0x63,0xae,0x4b,
+    0x0,0xc5,0xfa,0x0,0x23,0x0,0x7,0x3,0x0,0x0,0xff,0x0,0x18,0x0,0x0,0x0,
+    0x40,0x48,0x0,0xbf,0x20,0x70,0xb5,0x86,0xb0,0x5,0x53,0x1,0x8,0xff,0x70,0x71,
+    0x4c,0x20,0x7f,0x2,0x28,0x4,0xef,0xd0,0xa0,0x7f,0x0,0x4d,0x0,0x3,0x20,0x31,
+    0xff,0xe0,0x12,0x21,0x68,0x46,0xdf,0xf7,0xfa,0xff,0xfc,0x68,0x46,0x14,0x21,0xdf,
+    0xf7,0xf6,0xff,0xfc,0x6c,0x4e,0x30,0x0,0x69,0x46,0x14,0xff,0x22,0xdf,0xf7,0x14,
+    0xfd,0x28,0x89,0x80,0xff,0x1c,0x30,0x80,0x2a,0x89,0x29,0x0,0xc,0x7f,0x31,0xb0,
+    0x1c,0xdf,0xf7,0xf7,0xfc,0x37,0x2,0xe9,0x15,0x37,0x0,0x81,0x6,0x66,0x7d,0x0,
+    0x8,0x3c,0x5,0xd7,0xf0,0xf5,0xfe,0x7f,0x6,0x23,0x7f,0x0,0x85,0xfa,0x9f,0x0,
+    0x22,0xfa,0x21,0xc9,0xc0,0x1,0x5,0x3,0xe5,0xff,0xfc,0x25,0x62,0x0,0x20,0x6,
+    0xb0,0x70,0xff,0xbd,0x52,0x48,0x1,0x7f,0x3,0x29,0x1,0xdf,0xd1,0x4,0x21,0x1,
+    0x77,0x9b,0x1,0x0,0x76,0xfb,0xb5,0x84,0x93,0x0,0x68,0x46,0x0,0x8a,0x0,0xef,
+    0x28,0x11,0xd1,0x4b,0x97,0x0,0x3,0x28,0x6,0xff,0xd1,0x60,0x68,0x0,0x28,0x3,
+    0xd0,0x4,0x5e,0x5f,0x0,0x3,0xcc,0x63,0xe0,0xe5,0x6,0x38,0xe5,0x4,0xdf,0x5c,
+    0xe0,0x0,0xbf,0x46,0xf,0x1,0x6a,0x46,0xff,0x3,0xc2,0x5,0x9a,0x10,0x78,0x51,
+    0x78,0x7f,0x9,0x6,0x9,0xc,0x8,0x43,0x1,0xcd,0x0,0xff,0x2,0x28,0x8,0xd0,
+    0x5,0x28,0x10,0xd0,0xff,0x48,0xe0,0x1e,0x20,0x69,0x46,0x8,0x80,0xff,0x3a,0x48,
+    0x1,0x90,0x42,0xe0,0x2,0xa8,0xaf,0xff,0xf7,0x28,0xfd,0x61,0x0,0x89,0x13,0x2,
+    0x3,0xff,0x98,0x1,0x90,0x38,0xe0,0x92,0x1c,0x11,0xff,0x78,0x50,0x78,0x0,0x6,
+    0x0,0xc,0x1,0xff,0x43,0xf0,0x20,0x0,0x1,0x8,0x40,0x13,0xbe,0x49,0x8,0xb,
+    0x43,0x30,0x21,0x19,0xd,0x0,0x54,0xff,0x78,0x24,0x6,0x24,0xc,0x23,0x43,0xf,
+    0xff,0x26,0x33,0x40,0xf,0x2b,0x1,0xd1,0x96,0xf7,0x78,0x5,0xe0,0x15,0xe,0x1e,
+    0x40,0x80,0x22,0xff,0x92,0x0,0x90,0x42,0x13,0xd1,0x1e,0x4c,0xbf,0x30,0x29,0x24,
+    0xd1,0x31,0x0,0xc3,0x3,0xc8,0xfd,0xfc,0x7,0x6,0xc4,0xfc,0x0,0x28,0xb,0xd1,
+    0xdf,0x20,0x72,0x60,0x72,0x2,0x87,0x4,0x8,0x34,0xff,0x1,0x94,0x68,0x46,0x3,
+    0xc8,0x3,0xc5,0xfe,0x1,0x3,0x81,0x88,0x49,0x1c,0x21,0x81,0x81,0xbf,0x88,0x4a,
+    0x1e,0x9,0x30,0x1,0x1f,0x1,0xa,0xef,0x30,0xdf,0xf7,0x4e,0x77,0x1,0x21,0x89,
+    0x1,0xef,0x80,0xe9,0xe7,0x31,0x9f,0x1,0xff,0xf7,0xa3,0xff,0xfc,0x6,0x0,0xb0,
+    0x88,0x42,0x1e,0x31,0xf7,0x0,0x9,0x31,0x21,0x6,0x3d,0xfc,0xb0,0x88,0xef,0x40,
+    0x1c,0x20,0x81,0x4f,0xa,0xd6,0xe7,0x0,0xff,0x0,0x98,0x45,0x0,0x20,0x39,0xcb,
+    0x2,0xab,0x0,0xb3,0x3,0x0,0x3c,0x37,0x0,0x84,0xe3,0x1,0x12,0xfa,0xeb,0x1,
+    0xd0,0x17,0x0,0xf3,0xb5,0x81,0xb0,0x68,0xff,0x46,0x80,0x88,0x92,0xb2,0x90,0x42,
+    0x0,0xff,0xd2,0xbd,0xe0,0xc,0x46,0x20,0x78,0x61,0xfe,0x2b,0x9,0x4,0x28,0x0,
+    0xd1,0x9b,0xe0,0x5,0xff,0x28,0x0,0xd0,0xb1,0xe0,0xa1,0x1c,0x8,0xff,0x78,0x4a,
+    0x78,0x12,0x6,0x12,0xc,0x10,0xff,0x43,0x6a,0x46,0xf0,0x23,0x1b,0x1,0x3,0xf7,
+    0x40,0x13,0x80,0x13,0xe,0x30,0x22,0x2,0x40,0xf7,0xb,0x78,0x48,0x2b,0x5,0x3,
+    0x43,0xf,0x20,0xfd,0x3,0xd,0x1,0x8,0xd1,0x8d,0x78,0xcb,0x78,0xff,0xe,0x79,
+    0x36,0x6,0x36,0xc,0x33,0x43,0xff,0x4f,0x79,0x8e,0x79,0xd,0xe0,0xb,0x78,0xff,
+    0x4d,0x78,0x2d,0x6,0x2d,0xc,0x2b,0x43,0xff,0xf,0x25,0x1d,0x40,0x8b,0x78,0xce,
+    0x78,0xee,0x1d,0x6,0xf,0x79,0x4e,0x27,0x4,0x37,0x43,0x69,0xff,0x46,0x9,0x88,
+    0x80,0x26,0x76,0x0,0xb1,0xbf,0x42,0x8,0xd0,0xc0,0x26,0xb6,0x7,0x0,0x16,0xff,
+    0xd0,0x80,0x26,0x36,0x1,0xb1,0x42,0x3,0xff,0xd0,0x6d,0xe0,0x5,0xf0,0x84,0xfe,
+    0x6a,0xef,0xe0,0xa0,0x78,0xe1,0xa3,0x8,0xc0,0xb2,0x0,0xff,0x28,0x1,0xd0,0x1,
+    0x28,0x2,0xd1,0x5,0xff,0xf0,0x87,0xfe,0x5d,0xe0,0xb,0x22,0x3d,0xff,0xe0,0x6,
+    0x2b,0x59,0xd1,0x30,0x2a,0x1b,0xff,0xd1,0x6e,0x4e,0x2,0x21,0x31,0x70,0x35,0xff,
+    0x72,0xba,0x1e,0x51,0x1c,0xb1,0x80,0xa1,0xef,0x1c,0xb,0x78,0x4c,0x97,0x9,0x18,
+    0x40,0xf,0xff,0x28,0x1,0xd1,0xc9,0x1d,0x0,0xe0,0x89,0xbf,0x1d,0x92,0xb2,0x30,
+    0x0,0x9,0x39,0x1,0xa0,0xef,0xfb,0x32,0x0,0x29,0x97,0x1,0x39,0xe0,0x20,0xbf,
+    0x2a,0x1a,0xd1,0x5f,0x4e,0x1,0x3b,0x50,0x82,0xfe,0x3b,0x4,0x1b,0xe0,0x3,0x22,
+    0x6,0x21,0x4,0xff,0x20,0xfe,0xf7,0xfa,0xfc,0x18,0xe0,0x4f,0xff,0x4e,0x1c,0x21,
+    0x30,0x0,0xdf,0xf7,0x64,0xdf,0xfb,0x1,0x20,0x30,0x70,0xb1,0xe,0x82,0x1e,0xff,
+    0xb2,0x80,0x92,0xb2,0x21,0x1d,0x30,0x0,0x75,0x8,0x39,0x0,0x65,0x39,0x0,0x31,
+    0x7a,0x1,0xcb,0x1,0xff,0xcd,0xfb,0x3,0xb0,0xf0,0xbd,0x38,0xb5,0xff,0x42,0x4c,
+    0x20,0x0,0x24,0x30,0xfe,0xf7,0xff,0x70,0xfb,0x20,0x7f,0x3,0x28,0xc,0xd0,0xff,
+    0x4,0x28,0x28,0xd1,0x6,0x20,0x20,0x77,0xf7,0x6,0x21,0x2,0x59,0x0,0x89,0xfe,
+    0xff,0xf7,0xff,0xe6,0xf8,0x0,0xf0,0x37,0xf8,0x31,0xbd,0xff,0x61,0x68,0x20,0x0,
+    0x4c,0x30,0x81,0x42,0xff,0x1,0xd1,0x0,0x25,0x0,0xe0,0x1,0x25,0xff,0x12,0x20,
+    0x20,0x80,0x61,0x60,0x3,0xcc,0xff,0x8,0x3c,0x5,0xf0,0x43,0xfd,0x6,0x21,0xf5,
+    0x1,0x2f,0x0,0x71,0x2f,0x0,0xd3,0xf8,0x0,0x2d,0xff,0x6,0xd0,0x0,0x22,0xfa,
+    0x21,0xc9,0x0,0xff,0x24,0x34,0x20,0x0,0xfe,0xf7,0x31,0xfb,0xff,0x31,0xbd,0x28,
+    0x48,0x40,0x7f,0x70,0x47,0xef,0x10,0xb5,0x26,0x4c,0x67,0x2,0x2,0xd1,0x4,0xfe,
+    0x63,0x0,0x5,0xe0,0x4,0x28,0x8,0xd1,0x22,0xff,0xa0,0x3,0xc8,0x5,0xf0,0x16,
+    0xfd,0x2,0xff,0x23,0x0,0x22,0x3,0xcc,0xff,0xf7,0xb5,0xff,0xff,0x10,0xbd,0x10,
+    0xb5,0x82,0xb0,0x1b,0xbe,0x29,0x0,0x6,0x28,0x4,0xd0,0x9,0xe5,0x8,0x87,0xbb,
+    0xfc,0x2,0x33,0x0,0x0,0x21,0x62,0x87,0x4,0x82,0xfe,0x87,0x0,0x1,0x22,0x0,
+    0xe0,0x0,0x22,0x61,0xff,0x60,0x21,0x80,0x20,0x6a,0x0,0x2a,0x7,0xff,0xd0,0x1,
+    0x21,0xa1,0x77,0x0,0x28,0x8,0xff,0xd0,0x69,0x46,0xff,0xf7,0xd4,0xfd,0x13,0xff,
+    0xbd,0x21,0x62,0x1,0x0,0x0,0x20,0x5,0xaf,0xf0,0x1b,0xf9,0x13,0x51,0x0,0x7,
+    0x4f,0x0,0x5,0xda,0x4f,0x0,0xa,0x4f,0x8,0x5f,0xfc,0xe7,0x2,0xff,0xf7,0xfd,
+    0xc9,0x6f,0x0,0xf0,0x47,0x0,0x20,0x98,0x45,0xff,0x0,0x20,0x18,0x0,0x0,0x0,
+    0x40,0x48,0xff,0x0,0x20,0x10,0xb5,0x4,0x0,0x0,0xf0,0xff,0x70,0xf9,0x4,0x48,
+    0x20,0x60,0x6,0x21,0xf7,0x20,0x0,0x7c,0x3b,0x1,0xb7,0xfa,0x20,0x0,0xff,0x10,
+    0xbd,0x0,0xbf,0xcc,0x4c,0x3,0x0,0x6a,0x1f,0x6,0x60,0x1f,0x14,0xa7,0x1f,0x8,
+    0xb4,0x4b,0x1f,0xa,0x55,0x50,0x1f,0x14,0x97,0x1f,0x8,0xdc,0x1f,0x0,0x38,0x1f,
+    0x4,0xe7,0x40,0xf9,0x5,0x1f,0x0,0x1d,0x2,0x0,0x21,0x0,0xff,0x22,0x0,0x23,
+    0x0,0x25,0x2e,0xc0,0x20,0xeb,0x0,0x32,0x23,0x0,0xc8,0x23,0x0,0x0,0x21,0x7c,
+    0xbf,0x30,0x1,0x80,0x70,0x47,0xf4,0x2b,0x0,0xe,0xfb,0x0,0x1f,0x74,0x1,0x28,
+    0x35,0xa8,0x69,0x40,0xff,0x1c,0xa8,0x61,0x28,0x68,0x40,0x68,0x0,0xef,0x28,0x21,
+    0xd0,0x20,0x43,0x0,0xa3,0xf9,0x0,0xff,0x28,0x1c,0xd0,0x28,0x6a,0x40,0x1c,0x28,
+    0xf7,0x62,0x31,0x0,0x11,0x2,0x17,0xf8,0x0,0x28,0xff,0x13,0xd0,0x68,0x69,0xc,
+    0x30,0x29,0x68,0xff,0x9,0x78,0x1,0x70,0x29,0x79,0x4a,0x1c,0xff,0x2a,0x71,0x41,
+    0x70,0x86,0x80,0x87,0x70,0xff,0x0,0x21,0xc1,0x70,0x0,0x98,0x28,0x61,0xfb,0x2,
+    0x46,0x95,0x2,0x0,0xf0,0xa6,0xf9,0xf1,0xff,0xbd,0x10,0xb4,0x3,0x0,0x28,0x33,
+    0x1a,0xff,0x68,0x54,0x78,0xa4,0x7,0x15,0xd5,0x9c,0x9f,0x7b,0x0,0x2c,0x4,0xd0,
+    0x79,0x2,0x11,0x1,0x73,0xff,0xd,0xe0,0x7c,0x23,0xc3,0x5a,0xcb,0x1a,0xff,0x0,
+    0xd5,0x5b,0x42,0x54,0x88,0x9b,0xb2,0xff,0x9c,0x42,0x7,0xd2,0x52,0x78,0xd2,0x7,
+    0xfb,0x1,0xd5,0x21,0x2,0x1,0x20,0x10,0xbc,0x70,0x76,0x39,0x1,0xfb,0xe7,0xef,
+    0x6,0xd8,0xf8,0x50,0xcf,0x0,0xcd,0x2,0xef,0x8,0x1f,0xfa,0xd,0x2,0xf3,0x2,
+    0x70,0xb5,0xff,0x5,0x0,0xc,0x0,0xa8,0x6a,0x0,0x78,0xff,0x13,0x28,0xb,0xd1,
+    0x64,0x20,0x26,0x5c,0xf7,0x80,0x22,0x28,0x2f,0x0,0x7d,0xf9,0x3,0x0,0xff,0x62,
+    0x68,0x31,0x0,0x28,0x0,0xff,0xf7,0xe7,0x8c,0xff,0x70,0xa3,0x1,0x45,0x2,0xb5,
+    0xf8,0x3f,0xfe,0x45,0x10,0xfc,0xf9,0x3c,0x48,0xdb,0xe7,0x80,0xff,0xb5,0xb,0x7a,
+    0x4a,0x68,0x9,0x88,0x1f,0xdd,0xe0,0x23,0x6,0xa3,0xf8,0x36,0x23,0x10,0xea,0xf9,
+    0xd7,0x34,0x48,0xc9,0x23,0x0,0xd,0x1d,0x8,0x94,0xf8,0x7d,0x2e,0x1d,0x10,0xdb,
+    0xf9,0x2f,0x48,0xba,0x1d,0x0,0xfb,0x3,0x23,0x41,0x0,0x78,0xff,0xf7,0x57,0xff,
+    0xdd,0x1,0x69,0x8,0x80,0xf8,0x24,0x27,0x10,0xc7,0xf9,0xd7,0x26,0x48,0xa6,0x27,
+    0x0,0xea,0xcd,0x8,0x71,0xf8,0x7d,0x1d,0x1d,0x10,0xb8,0xf9,0x1f,0x48,0x97,0x1d,
+    0x0,0xdd,0xdb,0x1d,0x8,0x62,0xf8,0x15,0x1d,0x10,0xa9,0xf9,0xf7,0x19,0x48,0x88,
+    0x63,0xa,0x68,0x89,0xb2,0xcb,0xee,0x25,0x8,0x4f,0xf8,0xc,0x25,0x10,0x96,0xf9,
+    0x10,0xeb,0x48,0x75,0x25,0x0,0xb9,0x1d,0x8,0x40,0xf8,0x4,0xfe,0x1d,0x10,0x87,
+    0xf9,0xa,0x48,0x66,0xe7,0x0,0xbf,0x0,0x4,0x4c,0x3,0x0,0x2c,0x3,0x0,0x40,
+    0xaa,0x3,0x0,0x18,0x3,0x0,0x54,0x3,0x0,0x68,0x3,0x0,0x7c,0xaa,0x3,0x0,
+    0x90,0x3,0x0,0xa4,0x3,0x0,0xb8,0x3,0x0,0x80,0xef,0xb5,0x95,0xe7,0x38,0x47,
+    0x4,0x1c,0xf8,0x5,0xfe,0x69,0x5,0x7c,0x30,0x0,0x21,0x0,0x22,0x0,0xff,0x23,
+    0x0,0x25,0x2e,0xc0,0x20,0x0,0x32,0x7f,0xbd,0x0,0xbf,0x64,0x4b,0x3,0x0,0x6b,
+    0x6,0x57,0xa,0xf8,0x3,0x23,0xc,0x1,0x95,0x5,0xa0,0x1b,0x0,0xff,0x80,0xb5,
+    0x0,0xf0,0x1,0xf8,0x2,0xbd,0xff,0xf0,0xb4,0x13,0x4a,0x2,0x60,0x0,0x22,0xff,
+    0x42,0x60,0x82,0x60,0x3,0x0,0x14,0x33,0xfb,0x83,0x62,0x83,0x0,0x33,0x1a,0x70,
+    0x59,0x60,0xff,0x1,0x24,0x1c,0x72,0x5c,0x72,0x9a,0x72,0xff,0x4,0x0,0x50,0x34,
+    0x1c,0x61,0x84,0x6a,0xff,0x0,0x25,0x0,0x26,0x0,0x27,0xe0,0xc4,0xff,0x25,0x60,
+    0x9,0x78,0x84,0x6a,0x21,0x70,0xff,0x2,0x21,0x1,0x73,0x10,0x21,0x1,0x82,0xff,
+    0x5a,0x61,0x9a,0x61,0xda,0x61,0x1a,0x62,0x7f,0xf0,0xbc,0x70,0x47,0x0,0x0,0x3c,
+    0x5b,0x0,0xfe,0xf5,0x7,0x60,0x78,0xa9,0x6a,0x48,0x70,0xa8,0xff,0x6a,0x61,0x88,
+    0x41,0x80,0x0,0x26,0x40,0xff,0x78,0x80,0x7,0x80,0xf,0x3,0x28,0x1,0xff,0xd1,
+    0x1,0x20,0x0,0xe0,0x0,0x20,0x36,0xff,0x21,0x68,0x54,0x28,0x0,0x29,0x68,0x89,
+    0xff,0x68,0x88,0x47,0x60,0x68,0x40,0x0,0x40,0xff,0x8,0x68,0x60,0xa8,0x60,0xe0,
+    0x68,0xa9,0xff,0x6a,0xc8,0x60,0x4,0xf0,0xd6,0xff,0xa8,0xff,0x6a,0x86,0x60,0x70,
+    0xbd,0x70,0xb5,0x6,0xff,0x0,0xd,0x0,0x34,0x0,0x8,0x34,0x20,0xff,0x68,0x0,
+    0x28,0x2,0xd1,0x21,0x6a,0x48,0xfe,0x15,0x0,0x0,0x2d,0xc,0xd0,0x69,0x0,0x88,
+    0xff,0x42,0x9,0xd3,0x34,0x36,0x29,0x0,0xdf,0xff,0xf7,0xd2,0xfa,0x30,0x70,0x1,
+    0x20,0x70,0xff,0x70,0x30,0x78,0x45,0x43,0x2,0xe0,0x1,0xff,0x20,0x34,0x36,0x30,
+    0x70,0x20,0x6a,0x45,0xfe,0x29,0x0,0x2,0x29,0x5,0xd1,0x0,0x21,0x41,0xff,0x60,
+    0x81,0x60,0x80,0x6a,0x41,0x60,0x70,0xff,0x47,0x1,0x29,0x6,0xd1,0x81,0x6a,0x49,
+    0xbf,0x78,0xc,0x22,0x11,0x42,0x1,0x19,0x0,0x81,0xfc,0x13,0x0,0x25,0x3,0x28,
+    0x34,0xe0,0x69,0x40,0x1c,0xef,0xe0,0x61,0x20,0x68,0xa7,0x2,0xa,0xd5,0xff,0xff,
+    0xf7,0x35,0xfb,0x21,0x69,0x40,0x1a,0x21,0xff,0x68,0x49,0x68,0x88,0x42,0x80,0x41,
+    0xc0,0xff,0x43,0xc0,0xf,0x10,0xbd,0x20,0x7b,0x61,0xbf,0x7b,0x81,0x42,0x1,0xd2,
+    0x1,0x89,0x0,0x1,0xff,0x20,0x60,0x73,0x10,0xbd,0x49,0x1c,0x61,0xdf,0x73,0x0,
+    0x20,0x10,0xbd,0x43,0x2,0xe0,0x6c,0xfe,0x41,0x0,0x64,0xe0,0x6b,0x42,0x60,0x1,
+    0x81,0xfe,0x69,0x1,0x70,0x21,0x6b,0x9,0x78,0x1,0x73,0xff,0x20,0x6b,0x0,0x78,
+    0xe1,0x6b,0x8,0x77,0xff,0xe0,0x6b,0x4,0xf0,0x9e,0xff,0xe0,0x63,0xff,0x10,0xbd,
+    0x88,0x68,0x10,0x40,0x40,0x1e,0x7e,0x53,0x6,0xc9,0x68,0xa,0x40,0x2,0xd0,0x49,
+    0x1,0xf7,0x43,0x8,0x0,0x89,0x6,0xff,0xf7,0x32,0xff,0xfa,0xaf,0x1b,0x50,0xcb,
+    0x9,0xff,0xf7,0x24,0xff,0x4,0xf6,0x1b,0x0,0x18,0x21,0x1d,0x2,0xdf,0xf7,0x6b,
+    0xf8,0x6e,0x1d,0x2,0x0,0xbf,0xf0,0xcf,0x5,0x6,0x21,0x13,0x2,0xdf,0x61,0xf8,
+    0x1,0xbd,0x7c,0x35,0x1,0xc,0x0,0xdf,0x35,0x0,0x28,0x35,0xa8,0xd5,0x0,0xa8,
+    0x61,0x77,0x28,0x68,0x40,0x3d,0x1,0x37,0xd0,0x30,0x41,0x0,0xff,0x88,0xff,0x0,
+    0x28,0x32,0xd0,0x28,0x6a,0xff,0x40,0x1c,0x28,0x62,0x68,0x46,0xe1,0x88,0xff,0x1,
+    0x80,0x21,0x89,0x41,0x80,0x61,0x89,0xff,0x81,0x80,0x69,0x46,0x30,0x0,0x0,0xf0,
+    0xff,0x26,0xf8,0x0,0x28,0x22,0xd0,0x68,0x69,0xef,0xc,0x30,0x29,0x68,0xbf,0x0,
+    0x70,0x29,0x79,0xff,0x4a,0x1c,0x2a,0x71,0x41,0x70,0xe1,0x88,0xe5,0x81,0x29,0x0,
+    0xc1,0x29,0x0,0xdd,0x2,0x2a,0x68,0x12,0x7f,0x78,0x15,0x2a,0x1,0xd1,0xa2,0x89,
+    0xcb,0x1,0xff,0x22,0x42,0x81,0x3,0x22,0x82,0x70,0xc1,0xff,0x70,0x21,0x68,0xc1,
+    0x60,0x22,0x68,0x2a,0x77,0x61,0x10,0x21,0x69,0x2,0x75,0xff,0x73,0xbf,0x1,0xfe,
+    0x5b,0x3,0x22,0x68,0x53,0x78,0x9b,0x7,0x2b,0xff,0xd5,0xa3,0x7b,0x0,0x2b,0x6,
+    0xd0,0x6,0xfd,0x22,0xa7,0x2,0x1d,0xf8,0x0,0x20,0xa0,0x73,0xff,0x21,0xe0,0xcb,
+    0x5e,0x54,0x25,0x65,0x5f,0xff,0x5d,0x1b,0x0,0xd5,0x6d,0x42,0x53,0x88,0xff,0xab,
+    0x42,0x11,0xdb,0x2,0x25,0x4d,0x5f,0xdf,0x56,0x26,0xa6,0x5f,0xad,0x13,0x4,0xab,
+    0x42,0xf7,0x8,0xdb,0x4,0x11,0x0,0x58,0x26,0xa4,0x5f,0xfd,0x2c,0x11,0x0,0x64,
+    0x42,0xa3,0x42,0x8,0xda,0xbf,0x52,0x78,0xd2,0x7,0x3,0xd5,0x49,0x2,0xde,0x37,
+    0xf7,0xf8,0xff,0xfb,0x1,0xbd,0x0,0x3,0x0,0x3,0x7,0xff,0xde,0xf7,0xdf,0xff,
+    0x1,0xbd,0xf1,0xb5,0xff,0x82,0xb0,0xc,0x0,0x5,0x46,0x28,0x35,0xf7,0x20,0x68,
+    0xa9,0xc5,0x1,0x1,0x40,0x5f,0xd0,0xfe,0xd,0x13,0x58,0xd0,0x2,0x98,0xff,0xf7,
+    0x1,0xfa,0xd,0x1,0x53,0xd,0x9,0xa9,0x68,0x20,0x68,0x4a,0xff,0x68,0x2,0x40,
+    0x1,0x2a,0x8,0xd0,0x2,0xff,0x2a,0x1e,0xd0,0x4,0x2a,0x1f,0xd0,0x8,0xff,0x2a,
+    0x20,0xd0,0x10,0x2a,0x21,0xd0,0x41,0xfd,0xe0,0x69,0x1,0x30,0x6e,0x46,0x2,0x68,
+    0x89,0xff,0x7a,0xa,0x41,0x32,0x80,0x41,0x68,0xaa,0xff,0x68,0x92,0x7a,0x11,0x41,
+    0x71,0x80,0x80,0xbe,0x5d,0x0,0x89,0x7a,0x8,0x41,0xb0,0x3f,0x1,0x2,0xef,0x98,
+    0x0,0xf0,0x2f,0x3f,0x1,0xc,0xd1,0x29,0xfe,0x2f,0x0,0x28,0x30,0xe6,0xe7,0x20,
+    0x0,0x38,0xbb,0x30,0xe3,0x5,0x0,0x1c,0x30,0xe0,0x5,0x0,0x44,0xff,0x30,0xdd,
+    0xe7,0x6f,0x69,0xc,0x37,0x28,0xff,0x68,0x0,0x78,0x38,0x70,0x28,0x79,0x41,0xff,
+    0x1c,0x29,0x71,0x78,0x70,0x30,0x88,0xb8,0xff,0x80,0x70,0x88,0xf8,0x80,0xb0,0x88,
+    0x38,0x7f,0x81,0xa8,0x68,0x42,0x68,0x21,0x0,0x99,0x2,0xff,0xec,0xfe,0xb8,0x70,
+    0x0,0x20,0xf8,0x70,0xed,0x62,0x4f,0x1,0xa,0x21,0x11,0x2,0xcd,0xfe,0x3,0x7b,
+    0xb0,0xf0,0x51,0x2d,0xde,0xf7,0x74,0xff,0x51,0x8b,0x55,0x4f,0x51,0x1d,0x36,0x51,
+    0x5,0x84,0x51,0x19,0x69,0x51,0x15,0xf7,0x62,0xd0,0x4,0xa5,0x0,0x58,0xfe,0x0,
+    0x28,0xfd,0x5d,0x51,0x19,0x80,0x20,0x40,0x0,0x82,0x42,0xfb,0x1d,0xd0,0x5,0x2,
+    0x4f,0xd1,0x22,0x0,0x80,0xff,0x32,0x20,0x0,0x8c,0x30,0x0,0x90,0x1,0xbb,0xaf,
+    0x10,0x3b,0x5,0x38,0x80,0x50,0x45,0x9,0x78,0xfb,0x80,0x90,0x9,0x8,0xb8,0x80,
+    0x1,0xa9,0x4,0xfa,0x4f,0x1,0x3a,0x4f,0x1,0x5,0xd1,0x34,0xe0,0x22,0xeb,0x0,
+    0x68,0x35,0x0,0x74,0x4d,0x1,0x6e,0x69,0xc,0xf5,0x36,0x41,0x3,0x30,0x41,0x9,
+    0x70,0x70,0x38,0x88,0xff,0xb0,0x80,0x78,0x88,0xf0,0x80,0xb8,0x88,0x5f,0x30,0x81,
+    0x0,0x98,0x0,0x41,0x0,0xc9,0x41,0x0,0x15,0x70,0xb,0x0,0x40,0xb,0x8,0xb0,
+    0xb,0x0,0xa9,0x3,0xb,0x2,0xb9,0xf0,0x65,0x9,0xad,0x2,0x39,0xfe,0xb0,0x65,
+    0x1,0xf0,0x76,0x65,0x5,0x10,0x21,0x11,0x2,0x1a,0xfe,0x5,0x65,0x35,0xdb,0xc1,
+    0xfe,0x65,0x8b,0x9c,0xfe,0x65,0xb,0x10,0xb4,0xff,0x7c,0x30,0x0,0x21,0x0,0x22,
+    0x0,0x23,0xff,0x0,0x24,0x1e,0xc0,0x10,0xbc,0x70,0x47,0xff,0xf1,0xb5,0x82,0xb0,
+    0xd,0x0,0x4,0x46,0xdf,0x28,0x34,0x28,0x68,0xa1,0x6b,0x5,0x5a,0xd0,0xdd,0xa0,
+    0x6b,0x1,0xa0,0x61,0x20,0x6b,0x5,0x53,0xd0,0xfd,0x2,0xab,0x0,0xa2,0xfd,0x0,
+    0x28,0x4e,0xd0,0xed,0x20,0x6b,0x1,0x20,0x62,0x27,0xa,0x20,0x29,0x4,0xff,0xd0,
+    0x80,0x20,0x0,0x1,0x81,0x42,0xb,0xff,0xd0,0x40,0xe0,0x2f,0x0,0x50,0x37,0x28,
+    0xbf,0x6e,0x0,0x90,0x39,0x0,0x2,0x4b,0x1,0x3b,0xfa,0x4b,0x5,0x35,0x15,0x0,
+    0xac,0x37,0xbc,0x20,0x28,0xaf,0x58,0xf2,0xe7,0x66,0x4b,0x1,0x20,0x4b,0x5,0x20,
+    0x2,0x4b,0x1,0x21,0x4b,0x3,0x47,0x0,0x7f,0x3,0x51,0x1,0x9,0x8,0x57,0x1,
+    0x4e,0x9,0x8,0x30,0x81,0xf8,0x9,0x8,0x5b,0x3,0xa1,0x59,0x9,0xf5,0xa0,0x4d,
+    0x1,0x29,0x5f,0x0,0xff,0xf7,0x92,0xfd,0x7e,0x4d,0x7,0x6a,0x68,0x22,0x61,0xe,
+    0x21,0x11,0x2,0xf7,0x73,0xfd,0x3,0x4d,0x9,0xd,0x0,0x26,0x0,0xff,0x28,0x36,
+    0x30,0x68,0x40,0x78,0x80,0x7,0xff,0x80,0xf,0x3,0x28,0x19,0xd1,0xb0,0x7b,0xfe,
+    0x8d,0x0,0xd0,0x7c,0x34,0xf,0xcd,0xf,0xc4,0xff,0x0,0x20,0xb0,0x73,0x10,0xe0,
+    0x21,0x0,0xff,0x7c,0x31,0x28,0x0,0xee,0xf7,0x8d,0xfa,0xff,0x31,0x68,0x49,0x88,
+    0x0,0x14,0x80,0xb2,0x6f,0x81,0x42,0x3,0xd2,0x21,0x6,0x1,0xe0,0x29,0x3,0x54,
+    0x31,0x3,0x2d,0x23,0xe,0x2b,0x5,0x30,0x3,0x9,0x42,0x2b,0x15,0x57,0x3b,0xd0,
+    0x0,0x89,0x0,0xc,0x2b,0x1,0x36,0x2b,0x9,0x7f,0x37,0x0,0x98,0x37,0x39,0x0,
+    0x0,0x11,0x1,0xfd,0x2f,0x11,0x1,0x2b,0xd0,0x65,0x69,0xc,0x35,0xaa,0x5,0x3,
+    0x28,0x5,0x9,0x68,0x5,0xd,0xa8,0x5,0xd,0xe8,0xaa,0x5,0xd,0x28,0x5,0xd,
+    0x68,0xfb,0x4,0x31,0x49,0x0,0xff,0xef,0xf7,0x14,0xfd,0xa8,0xfb,0x0,0xe8,0x70,
+    0x72,0x76,0xfb,0x0,0xc,0x21,0x11,0x2,0xf5,0xfc,0xf1,0xf9,0x5c,0xfd,0x10,0xf9,
+    0x34,0x0,0x21,0xc1,0x67,0x70,0x47,0xff,0x70,0xb5,0x6,0x0,0xc,0x0,0x35,0x0,
+    0x77,0x28,0x35,0xa8,0xe5,0x0,0xa8,0x61,0x28,0xe5,0x4,0xff,0x25,0xd0,0x30,0x0,
+    0xff,0xf7,0x99,0xfc,0xdf,0x0,0x28,0x20,0xd0,0x28,0xe5,0x0,0x28,0x62,0x7f,0x21,
+    0x68,0x30,0x0,0x0,0xf0,0x1b,0xe1,0x0,0xff,0x17,0xd0,0x68,0x69,0xc,0x30,0x29,
+    0x68,0xff,0x9,0x78,0x1,0x70,0x29,0x79,0x4a,0x1c,0xff,0x2a,0x71,0x41,0x70,0x21,
+    0x7a,0x81,0x70,0xfe,0x4f,0x0,0x70,0x21,0x68,0xaa,0x68,0x92,0x7a,0xff,0xd1,0x40,
+    0x41,0x60,0x62,0x68,0x2a,0x61,0xfb,0x8,0x21,0x45,0x2,0x98,0xfc,0x70,0xbd,0x30,
+    0xff,0xb4,0x28,0x30,0x2,0x68,0x53,0x78,0x9b,0xff,0x7,0x16,0xd5,0x83,0x7b,0x0,
+    0x2b,0x3,0xff,0xd0,0x41,0x65,0x0,0x21,0x81,0x73,0xf,0xff,0xe0,0x43,0x6d,0xcb,
+    0x1a,0x0,0xd5,0x5b,0xff,0x42,0x54,0x88,0x85,0x68,0x2d,0x7a,0xad,0xff,0x1f,0x2b,
+    0x41,0x9b,0xb2,0x9c,0x42,0x6,0xff,0xd2,0x52,0x78,0xd2,0x7,0x0,0xd5,0x41,0xef,
+    0x65,0x1,0x20,0x30,0x93,0x1,0x0,0x20,0xfb,0x7f,0xe7,0x0,0x21,0x7c,0x30,0x1,
+    0x70,0xb1,0x12,0xea,0xab,0x6,0x1f,0xab,0x4,0x43,0xab,0x0,0x1a,0xd0,0x21,0xd5,
+    0x78,0xa5,0x2,0x18,0xa5,0x0,0x14,0xa5,0x22,0x78,0x1,0xa7,0x71,0x3,0x21,0xa9,
+    0x6,0x9f,0x2,0x5,0x9f,0x4,0x48,0xfe,0x9f,0x0,0x2,0xb4,0x1,0x0,0x28,0x31,
+    0xa,0xee,0xa1,0x4,0x1a,0xd5,0x8b,0xa1,0x0,0x6,0xd0,0x6a,0xbf,0x46,0x7c,0x30,
+    0x13,0x78,0x3,0x87,0x1,0x88,0xfe,0x53,0x1,0x69,0x46,0x9,0x78,0x7c,0x23,0xc3,
+    0xfb,0x5c,0xc9,0xad,0x0,0x49,0x42,0x53,0x88,0x8b,0xff,0x42,0x9,0xda,0x51,0x78,
+    0xc9,0x7,0x3,0xfb,0xd5,0x69,0x27,0x0,0xa,0x78,0x2,0x70,0x1,0x47,0x20,0x1,
+    0xb0,0xa9,0x1a,0xaf,0x11,0x55,0x5,0x20,0x6f,0x0,0xfb,0xee,0xfb,0x55,0x5,0x78,
+    0x31,0x68,0x4a,0x78,0xff,0x92,0x7,0x6,0xd5,0xb2,0x7b,0x0,0x2a,0xbf,0x19,0xd0,
+    0x7c,0x21,0x60,0x54,0xbd,0x3,0x70,0x2a,0xb5,0x0,0x31,0xb5,0x4,0x31,0xb5,0x0,
+    0x32,0xb5,0x0,0xb1,0xa,0x7f,0x69,0x88,0x41,0x60,0x6a,0x69,0x32,0x55,0x1,0xfe,
+    0x45,0x2,0xed,0xfb,0x70,0xbd,0x7c,0x22,0xa2,0xfb,0x5c,0x82,0x8f,0x0,0x52,0x42,
+    0x4b,0x88,0x93,0x6f,0x42,0xf6,0xda,0x49,0x8f,0x0,0xde,0xd5,0x49,0x2,0x4f,0xdb,
+    0xe7,0x0,0x0,0xdf,0xb,0x83,0x16,0x40,0x83,0x4,0xbd,0xac,0x83,0x0,0x3b,0xd0,
+    0xa8,0x68,0x83,0x6,0x5,0xde,0x83,0x4,0x1d,0xd0,0x70,0x65,0x81,0x26,0xa9,0x68,
+    0xeb,0x1,0x81,0x85,0xa,0xa9,0x85,0x0,0x31,0x68,0x0,0xff,0x89,0xf,0x4a,0x2,
+    0x40,0x10,0x2a,0x48,0xff,0x78,0xf,0xd1,0x4,0x22,0x2,0x43,0xe,0xf7,0xe0,0x72,
+    0x6d,0x89,0xa,0x92,0xb2,0x93,0x42,0xfb,0xd,0xd2,0x8b,0x2,0xd9,0xd5,0x70,0x65,
+    0xd7,0x7f,0xe7,0xfb,0x22,0x2,0x40,0x4a,0x70,0xb9,0x2,0xf5,0xc,0xb9,0x4,0x90,
+    0xb9,0x0,0xf0,0xff,0x0,0x0,0xf7,0x80,0xb5,0x18,0x27,0x1,0xde,0xf7,0x2f,0xfc,
+    0xff,0x1,0xbd,0x71,0xb5,0x81,0xb0,0xd,0x0,0xff,0x4,0x46,0x28,0x34,0xa0,0x69,
+    0x40,0x1c,0xf7,0xa0,0x61,0x20,0xab,0x4,0x4e,0xd0,0x1,0x98,0xf7,0xff,0xf7,0x56,
+    0xab,0x0,0x49,0xd0,0x20,0x6a,0xff,0x40,0x1c,0x20,0x62,0x0,0x20,0x0,0x22,0xff,
+    0x0,0x21,0x2b,0x0,0xc,0x33,0x26,0x68,0xff,0xf6,0x68,0xce,0x40,0xf6,0x7,0x4,
+    0xd5,0xff,0x1e,0x78,0xb0,0x42,0x1,0xd2,0x30,0x0,0xff,0xa,0x0,0x49,0x1c,0x5b,
+    0x1c,0x9,0x29,0xff,0xf1,0xd3,0xd2,0xb2,0x29,0x0,0x1,0x98,0xff,0x0,0xf0,0x30,
+    0xf8,0x0,0x28,0x2c,0xd0,0xff,0x66,0x69,0xc,0x36,0x20,0x68,0x0,0x78,0xff,0x30,
+    0x70,0x20,0x79,0x41,0x1c,0x21,0x71,0xdd,0x70,0xd1,0x1,0x30,0x71,0x80,0x3,0x0,
+    0x28,0x79,0xff,0x70,0x71,0xa,0x21,0xb0,0x1d,0xde,0xf7,0xff,0xeb,0xfb,0x0,0x20,
+    0xb1,0x1d,0x2a,0x0,0xff,0xc,0x32,0x23,0x68,0xdb,0x68,0xc3,0x40,0xff,0xdb,0x7,
+    0x1,0xd5,0x13,0x78,0xb,0x70,0xff,0x40,0x1c,0x52,0x1c,0x49,0x1c,0x9,0x28,0xdf,
+    0xf3,0xdb,0x3,0x20,0xb0,0x37,0x0,0xf0,0x70,0xbf,0x2a,0x68,0x22,0x61,0x10,0x21,
+    0x97,0x2,0x2c,0xff,0xfb,0x73,0xbd,0xf7,0xb5,0x5,0x0,0xa8,0xff,0x6a,0x40,0x78,
+    0x80,0x7,0x40,0xd5,0x0,0xff,0x24,0x28,0x0,0x28,0x30,0x80,0x7b,0x0,0x7f,0x28,
+    0x7,0xd0,0x18,0x22,0x28,0x0,0xdb,0x2,0xff,0xe5,0xfb,0x28,0x35,0xac,0x73,0x32,
+    0xe0,0xff,0xc,0x31,0x2a,0x0,0x88,0x32,0xab,0x6a,0xdf,0xdb,0x68,0x1e,0x0,0xe6,
+    0xb5,0x0,0x9,0xd5,0xff,0xe,0x78,0x17,0x78,0xf6,0x1b,0x0,0xd5,0xff,0x76,0x42,
+    0xaf,0x6a,0x7f,0x88,0xb7,0x42,0xdf,0x0,0xda,0x1,0x20,0x64,0x6d,0x6,0x2c,0xea,
+    0xff,0xd3,0x0,0x28,0x16,0xd0,0x0,0x2b,0x5,0xff,0xd5,0x68,0x46,0x0,0x7a,0x94,
+    0x21,0x69,0x5f,0x5c,0x88,0x42,0xe,0xd0,0x67,0x2,0xc0,0xab,0x1,0x6f,0x18,0x22,
+    0x1,0x99,0x5d,0x6,0xb6,0xfb,0x1f,0x4,0xdf,0x35,0x28,0x70,0x1,0xe0,0x19,0x1,
+    0xe0,0x1,0xff,0x20,0x3,0xb0,0xf0,0xbd,0x80,0x6a,0xc2,0xff,0x68,0x11,0x40,0x49,
+    0x0,0x49,0x8,0x6,0xff,0xd0,0x80,0x23,0x1b,0x6,0x1a,0x40,0x11,0xff,0x43,0x1,
+    0x22,0xa,0x43,0xc2,0x60,0x70,0xff,0x47,0xf5,0xb5,0x87,0xb0,0x0,0x91,0x64,0xff,
+    0x20,0x3,0x90,0x0,0x25,0x0,0x24,0x1e,0xff,0x22,0x33,0xa0,0x3,0xc8,0xde,0xf7,
+    0xa4,0xff,0xf8,0xde,0xf7,0xdc,0xf8,0x6,0x0,0x1d,0xeb,0x22,0x31,0xf,0x4,0x9c,
+    0xf,0x0,0xd4,0xf8,0x7,0xaf,0x0,0x1c,0x22,0x2f,0xf,0x4,0x94,0xf,0x0,0xcc,
+    0xff,0xf8,0x2,0x90,0x3,0xa9,0x68,0x46,0x4,0xff,0xf0,0x59,0xfe,0x0,0x28,0x5,
+    0xd1,0x3,0xff,0x99,0x48,0x42,0x0,0x99,0x49,0x17,0x81,0xff,0x42,0x28,0xda,0x1,
+    0x95,0x2,0xaa,0x69,0x7f,0x46,0x1,0xa8,0x4,0xf0,0x5d,0xfe,0x77,0x1,0xff,0x28,
+    0x1,0xd5,0x40,0x1e,0x1,0x90,0x2,0xbe,0x21,0x0,0x4,0x90,0x4,0xaa,0x1,0x35,
+    0x4,0x72,0xff,0xfe,0x14,0xe0,0x70,0x42,0x6,0x90,0x6,0xfa,0xd,0x4,0x7a,0x43,
+    0x0,0x4,0xd0,0x0,0x98,0xc0,0xff,0x19,0x0,0x90,0x64,0x1e,0x64,0xb2,0x0,0xff,
+    0x2c,0x1,0xd5,0x24,0x1d,0x64,0xb2,0x4,0xff,0x2c,0x1,0xdb,0x24,0x1f,0x64,0xb2,
+    0x75,0xff,0x10,0x0,0x98,0x85,0x42,0x7,0xdb,0x70,0xaf,0x42,0x5,0x90,0x5,0x31,
+    0x4,0x61,0x31,0x0,0x6,0x7e,0x31,0x0,0x85,0x42,0xdb,0xda,0xc0,0x1b,0x35,0x0,
+    0xff,0x1c,0xe3,0xe7,0x0,0x98,0x7,0x99,0x8,0xff,0x60,0x8,0x98,0x4,0x70,0x7,
+    0x98,0x9,0xfe,0xf9,0x0,0x0,0xbf,0x18,0x2d,0x44,0x54,0xfb,0xd7,0x21,0xe9,0x3f,
+    0x7,0x6,0xf9,0x7,0x8,0x19,0x40,0xaa,0xf7,0x26,0x28,0xd7,0x0,0x60,0xf7,0x10,
+    0x20,0xf,0x0,0x58,0x6a,0xf7,0x10,0x18,0xf,0x0,0x50,0xf7,0xc,0xdd,0xfd,0xf7,
+    0x2e,0x5b,0xe1,0xfd,0xf7,0x2a,0xf6,0xfd,0xf7,0x12,0xfe,0x43,0x0,0x32,0xf7,0x56,
+    0xe5,0x31,0x0,0xf7,0x1e,0x80,0x10,0xf9,0x16,0xf7,0x2a,0xff,0x80,0xb5,0x0,0xf0,
+    0x54,0xf8,0xff,0x28,0xff,0x1,0xd0,0xfd,0xf7,0x7f,0xff,0x1,0xbd,0x7f,0x10,0xb5,
+    0xc,0x0,0x0,0xf0,0x4b,0x11,0x0,0xf6,0x53,0x0,0x2c,0x2,0x15,0x0,0x92,0xff,
+    0x10,0xbd,0xa7,0xfd,0xf7,0xbb,0x5,0x0,0x2b,0x2,0x3e,0x2b,0x2,0xd1,0x77,0x0,
+    0x20,0x2,0x13,0x0,0xd5,0xff,0x2,0x2f,0x8,0xfd,0x33,0x15,0x0,0xf,0xd0,0x1,
+    0x2c,0x4,0xd0,0xff,0xc,0xd3,0x3,0x2c,0x6,0xd0,0x2,0xd3,0xff,0x10,0xbd,0x0,
+    0x21,0x3,0xe0,0x0,0x21,0xff,0x1,0x22,0x1,0xe0,0x1,0x21,0xa,0x46,0xf7,0xfd,
+    0xf7,0x20,0x41,0x6,0x28,0x7,0xd0,0x1,0xbe,0x41,0x0,0x1b,0x21,0x4,0xe0,0x2,
+    0x75,0x0,0xff,0xff,0x21,0x0,0xe0,0x12,0x21,0x8,0x0,0xfd,0x93,0xf7,0xd4,0x4d,
+    0x0,0x1f,0x32,0xb1,0x1f,0x0,0x41,0x1,0xd1,0x2f,0x37,0x20,0x70,0x47,0x21,0x2,
+    0x23,0x7,0x0,0x21,0x0,0xeb,0xd1,0x19,0x7,0x0,0x8,0x35,0x0,0x7,0x28,0x5,
+    0xbf,0xd0,0x3,0x28,0x3,0xd0,0x9,0x13,0x0,0x1c,0xfa,0x13,0x0,0xff,0x3,0x0,
+    0x0,0x0,0x70,0xb5,0x5,0xff,0x0,0x2c,0x0,0xf,0x34,0x7,0x20,0x84,0xff,0x43,
+    0xc0,0x46,0xc0,0x46,0xa5,0x42,0x33,0xff,0xd2,0x8,0x2c,0x4,0xd2,0x8,0x24,0x2,
+    0xff,0xe0,0x8,0x30,0x4,0xf0,0x55,0xfd,0x24,0xff,0x48,0x2,0x68,0x11,0x0,0xc,
+    0xd1,0x1,0xff,0x1d,0xa,0x68,0x0,0x2a,0x20,0xd0,0x13,0xff,0x68,0xa3,0x42,0x12,
+    0xd2,0x11,0x1d,0xf7,0xff,0xe7,0x1d,0x68,0xa5,0x42,0xd,0xd2,0x19,0xff,0x1d,0xb,
+    0x68,0x0,0x2b,0xf8,0xd1,0x12,0xdf,0x68,0x1,0x1d,0x0,0xe0,0xd,0x2,0x93,0x42,
+    0xfb,0xd,0xd0,0x1b,0x2,0xf8,0xd3,0x0,0x29,0xc,0xff,0xd0,0xd,0x68,0x2a,0x68,
+    0x13,0x0,0x8,0xff,0x3b,0xa3,0x42,0xa,0xd2,0x6a,0x68,0xa,0xbf,0x60,0xf,0xe0,
+    0x4,0xf0,0x6e,0x93,0x1,0xcf,0xfd,0xd1,0x6f,0x2,0x0,0x20,0x70,0xbd,0x2b,0x19,
+    0xff,0xb,0x60,0x6e,0x68,0x5e,0x60,0x12,0x1b,0xff,0xb,0x68,0x1a,0x60,0x2c,0x60,
+    0x9,0x68,0xdf,0x0,0x29,0x4,0xd0,0x4a,0x6d,0x0,0x1,0xd0,0xe9,0x9,0x53,0x0,
+    0x25,0x1,0x60,0x2b,0x2,0x8,0x35,0x28,0xff,0x0,0x70,0xbd,0x0,0x0,0xbc,0x49,
+    0x0,0xff,0x20,0x10,0xb5,0xff,0xe7,0x4,0x0,0xef,0xff,0xf7,0xdf,0xfe,0x2,0x48,
+    0x20,0x60,0x20,0x7d,0x0,0x4f,0x1,0x0,0xe4,0x47,0x3,0x0,0x4f,0x0,0xfd,0x47,
+    0x3,0x2,0x80,0xb5,0x3,0x7e,0x99,0x42,0xff,0x4,0xd1,0x11,0x0,0x2,0x68,0xd2,
+    0x6a,0x9f,0x90,0x47,0x2,0xbd,0x7,0x93,0x1,0x1d,0xa,0x0,0xff,0x0,0xff,0xe7,
+    0x3,0x4a,0x2,0x60,0x41,0xdf,0x60,0x0,0x21,0xc1,0x72,0xf,0x2,0x24,0x4b,0xff,
+    0x3,0x0,0x41,0x68,0xc2,0x7a,0xb,0x78,0xfd,0x9a,0xa7,0x0,0x89,0x18,0x89,0x78,
+    0x1,0x72,0xff,0x41,0x68,0x89,0x79,0x41,0x72,0xc1,0x7a,0xdf,0x49,0x1c,0xc1,0x72,
+    0x1,0x35,0x0,0x52,0x1c,0xfb,0xc2,0x72,0x3d,0x2,0x10,0xb4,0x0,0x22,0x40,0xff,
+    0x68,0x1,0xe0,0x52,0x1c,0xd2,0xb2,0x43,0xfe,0x2f,0x0,0x7,0xda,0x8b,0x5c,0x54,
+    0x0,0x4,0xff,0x19,0xe4,0x79,0xa3,0x42,0xf4,0xd0,0x0,0xff,0x20,0x0,0xe0,0x1,
+    0x20,0x10,0xbc,0x70,0xbf,0x47,0x38,0xb5,0x4,0x0,0x15,0xa3,0x0,0x8d,0xfe,0xa3,
+    0x4,0x25,0x63,0x20,0x0,0x32,0xbd,0xac,0xef,0x48,0x3,0x0,0x10,0x17,0x0,0x20,
+    0x6b,0x13,0xff,0x0,0xa,0x0,0x21,0x7e,0x4,0x68,0x24,0xff,0x6d,0xa0,0x47,0x10,
+    0xbd,0x10,0xb5,0x82,0xad,0xb0,0x15,0x2,0x0,0x93,0x17,0xa,0x64,0x17,0x0,0x16,
+    0xfe,0xf1,0x1,0x3,0x0,0x18,0x6b,0xa,0x0,0x19,0xbf,0x7e,0x3,0x68,0x9b,0x6d,
+    0x98,0xc7,0x0,0x80,0x3f,0xb5,0x0,0x6b,0x2,0x68,0x52,0xd3,0x4,0xb,0x2,0x7f,
+    0x1,0x68,0x89,0x6b,0x88,0x47,0x1,0xb,0x0,0xff,0x2,0x6b,0x1,0x7e,0x10,0x0,
+    0x12,0x68,0xd3,0x12,0x6e,0x1b,0x6,0xf,0xa,0x52,0xf,0x4,0x70,0xb4,0xff,0x0,
+    0x20,0x14,0x0,0xd,0x88,0x1,0xe0,0xff,0x40,0x1c,0xa4,0x1c,0x98,0x42,0x6,0xda,
+    0xf7,0x26,0x88,0xae,0xa3,0x1,0x43,0x0,0xd2,0x5a,0xff,0xa,0x80,0x6,0xe0,0x58,
+    0x0,0x10,0x18,0xff,0x80,0x1e,0x0,0x88,0x8,0x80,0x0,0x20,0xa7,0xc0,0x43,0x70,
+    0xbf,0x0,0x31,0x22,0xb5,0x31,0x34,0x0,0xff,0x0,0x1,0x20,0x6e,0x49,0x9,0x68,
+    0x88,0xff,0x40,0x6d,0x49,0x1d,0x22,0x42,0x43,0xa,0xfb,0x80,0x31,0x5,0x0,0x4a,
+    0x80,0x2,0x1,0x12,0xbf,0x18,0x92,0x0,0x8a,0x80,0x75,0xd,0x0,0xca,0x7f,0x80,
+    0x9c,0x22,0x50,0x43,0x8,0x81,0x1f,0xf,0xf7,0xfd,0xfd,0x63,0xc3,0x5,0x78,0x30,
+    0x5,0x61,0x3e,0xeb,0x1,0x70,0x30,0x20,0x21,0x54,0x2b,0x3,0xdd,0x0,0xf7,0xf0,
+    0x77,0xfa,0xc9,0x2,0x88,0x30,0x0,0x68,0xfa,0xc7,0x1,0x69,0xc7,0x2,0x0,0x0,
+    0x70,0xb5,0x6,0xff,0x0,0xc,0x0,0x0,0xbf,0xb,0xa0,0x20,0xff,0x60,0x1,0x25,
+    0x25,0x71,0xa,0x22,0x0,0xef,0xbf,0x1e,0xa1,0x30,0x49,0x0,0x6d,0xfe,0xa0,0xff,
+    0x60,0x9a,0x20,0x40,0x0,0xe0,0x80,0x6c,0xff,0x36,0x30,0x88,0xe0,0x60,0x70,0x88,
+    0x20,0x7f,0x61,0xb9,0x48,0x60,0x61,0xa5,0x61,0xb7,0x1,0xff,0xbd,0x53,0x54,0x4d,
+    0x69,0x63,0x72,0x6f,0xff,0x65,0x6c,0x65,0x63,0x74,0x72,0x6f,0x6e,0xff,0x69,0x63,
+    0x73,0x20,0x4c,0x53,0x4d,0x33,0x5f,0x30,0x33,0x44,0x0,0x0,0x63,0xa,0x12,0x57,
+    0x5,0xfb,0x0,0x0,0x9b,0x2,0xd,0x0,0x28,0x68,0x0,0xff,0x90,0xa,0x23,0x7,
+    0xa2,0x69,0x46,0x20,0xff,0x0,0x0,0xf0,0x15,0xfb,0x0,0x99,0x29,0xff,0x60,0x41,
+    0x1c,0x50,0x34,0x21,0x70,0x0,0xff,0x28,0x1,0xd5,0x4,0x20,0x32,0xbd,0x0,0xfe,
+    0x3,0x2,0xe2,0x4,0x0,0x0,0x71,0x2,0x0,0xff,0x80,0x38,0x1,0x0,0x40,0x9c,
+    0x0,0x0,0xff,0x20,0x4e,0x0,0x0,0x10,0x27,0x0,0x0,0x7f,0x88,0x13,0x0,0x0,
+    0xc4,0x9,0x0,0x1e,0xa,0xfb,0x0,0xf8,0x53,0x0,0xe,0x0,0x35,0x68,0xb7,0xfb,
+    0x68,0x22,0xcb,0x4,0x69,0x46,0x8,0x70,0x68,0xff,0x46,0x0,0x78,0x0,0x28,0x3d,
+    0xd1,0xb0,0xff,0x68,0x87,0x42,0x2,0xd1,0x30,0x68,0x85,0xff,0x42,0x1,0xd0,0x5,
+    0x20,0xf2,0xbd,0x20,0xff,0x0,0x50,0x30,0x1,0x78,0x41,0x70,0x30,0xff,0x68,0x1,
+    0x28,0x1,0xdb,0x7,0x20,0x4,0xfd,0xe0,0x71,0x2,0xd,0x20,0x0,0xe0,0x2,0x20,
+    0xff,0x25,0x0,0x30,0x35,0x68,0x70,0x28,0x78,0xff,0x2,0x28,0x10,0xd1,0x68,0x78,
+    0x7,0x28,0xfb,0x3,0xd1,0x9d,0x2,0x44,0xfa,0x1a,0xe0,0xd,0xff,0x28,0x18,0xd1,
+    0x5,0x23,0x7d,0x4a,0x9f,0xfb,0x21,0x20,0xd,0x1,0x94,0xfd,0x9,0x20,0xf,0xfa,
+    0x13,0x0,0xe,0x25,0x0,0xd,0x28,0xb,0xd0,0x0,0xff,0x21,0x20,0x7e,0xff,0xf7,
+    0x9e,0xfd,0x2,0xef,0x23,0x76,0x4a,0xa0,0x21,0x4,0x83,0xfd,0x3,0xeb,0x20,0x28,
+    0x83,0x4,0xf2,0xf3,0x0,0x74,0x4d,0x3,0xff,0x0,0x90,0x49,0x0,0x20,0x4,0x49,
+    0x3,0xfe,0xab,0x4,0x25,0x0,0x18,0x35,0x28,0x78,0x98,0xff,0x42,0x0,0xd0,0xcd,
+    0xe0,0x29,0x7e,0xd,0xff,0x29,0x0,0xd9,0xc5,0xe0,0x1,0xa2,0x52,0xff,0x5c,0x52,
+    0x0,0x97,0x44,0xc5,0xc5,0xc5,0xff,0x6,0x19,0xc5,0x3a,0xc5,0x61,0x92,0xc1,0xff,
+    0xa9,0xc1,0xc5,0x68,0x7e,0x2,0x28,0x0,0xbf,0xd1,0xb4,0xe0,0x7,0x28,0x4,0x8b,
+    0x4,0xfe,0xff,0xf9,0x4,0x20,0xad,0xe0,0x5,0x23,0x5b,0xfa,0x89,0x8,0x4f,0x89,
+    0x0,0xa5,0xe0,0xff,0xf7,0x58,0xff,0xfd,0x1,0x21,0x28,0x78,0xff,0xf7,0x5c,0xff,
+    0xfd,0x26,0x0,0x48,0x36,0x5,0x20,0x30,0xff,0x70,0x0,0x21,0x71,0x70,0x28,0x76,
+    0x0,0xf7,0x22,0xa5,0x21,0x78,0x0,0x0,0x34,0x30,0xfc,0x77,0xf7,0xdf,0xff,0x21,
+    0x2,0x59,0xfd,0x0,0x51,0x0,0xff,0x91,0xe0,0x2a,0x78,0x4c,0x34,0x21,0x0,0xff,
+    0x4,0x20,0xe9,0xf7,0x35,0xfe,0xf1,0xbd,0xff,0x69,0x7e,0x7,0x29,0x77,0xd1,0x21,
+    0x0,0xd7,0x70,0x31,0x4f,0x23,0x0,0x47,0x23,0x0,0x3,0xd1,0xff,0xf,0x2f,0x6,
+    0xd0,0x0,0x2f,0x4,0xd0,0xff,0x20,0x0,0x48,0x30,0x40,0x78,0x4,0x28,0x33,0x2c,
+    0xdb,0x5b,0x2,0xef,0x1,0x70,0x30,0x59,0x1,0x8f,0x6,0xff,0xd2,0xf9,0x7,0x20,
+    0x65,0xe0,0x40,0x1e,0x6f,0x30,0x70,0x5,0x20,0x6d,0xa,0x4e,0xe0,0x4d,0x2,0xfb,
+    0x50,0xd1,0x2d,0x2,0x22,0x0,0x70,0x32,0x91,0xff,0x7a,0xcd,0x4b,0x77,0x7a,0xdb,
+    0x5d,0x99,0xaf,0x42,0x46,0xd1,0x57,0x5d,0x0,0x18,0x5d,0x8,0x15,0x6e,0x5d,0x0,
+    0x13,0xd0,0x70,0x59,0x0,0x10,0xda,0x2b,0x2,0xbf,0x70,0x78,0x40,0x1c,0x70,0x70,
+    0x31,0x2,0x27,0xff,0x20,0x10,0x70,0x8,0x20,0x0,0x90,0x13,0x7b,0x0,0xa7,0xe5,
+    0x4,0xd1,0xfc,0xf1,0xbd,0x77,0x2,0x5a,0x71,0x2,0x99,0x71,0x0,0x2c,0xe0,0x25,
+    0x2,0x1c,0x25,0xc,0x6d,0x9c,0x25,0x4,0xbe,0xfc,0xdf,0x2,0xd3,0xfc,0x9,0x7,
+    0xff,0xd7,0xfc,0x1,0x20,0x48,0x34,0x20,0x77,0xf7,0xb,0x20,0x15,0x8f,0x0,0xd,
+    0x29,0x8,0xd1,0xfd,0xc,0xa1,0x4,0x50,0x21,0x34,0x34,0x20,0x0,0xef,0xfc,0xf7,
+    0x58,0xff,0x53,0x0,0x21,0xff,0xf7,0xdf,0xc3,0xfc,0x2,0x23,0x8,0xb5,0x9,0xa8,
+    0xfc,0xfe,0xb5,0x1,0x76,0xf1,0xbd,0x1,0x21,0x9,0x20,0xef,0xef,0xf7,0x3e,0xf8,
+    0x21,0x0,0x0,0xff,0x7f,0x7f,0x0,0x0,0x58,0xe6,0x2,0x0,0x54,0x3,0x0,0xfd,
+    0x38,0xbb,0x11,0x3a,0xd1,0x10,0x68,0x28,0x65,0xff,0x28,0x7e,0x7,0x28,0xe,0xd1,
+    0x27,0x20,0xef,0x70,0x21,0x60,0x54,0x8b,0x2,0x23,0x0,0x70,0xf9,0x33,0x9b,0x2,
+    0xb7,0x6,0x75,0xfc,0x8,0x20,0x25,0xfb,0xe0,0x5,0x21,0x30,0x64,0xfc,0x6,0x20,
+    0x14,0xff,0xe0,0xd,0x28,0x13,0xd1,0x0,0x22,0x0,0x3b,0x21,0x8,0x8d,0x1,0x6e,
+    0xfd,0x1c,0x2b,0x1c,0xdf,0x6,0xd7,0x4e,0xfc,0xb,0x9d,0x0,0x31,0x93,0x0,0x70,
+    0xb5,0xfb,0x82,0xb0,0x89,0x8,0x7e,0x5,0x28,0x16,0xd1,0xf9,0x6,0x17,0x0,0x41,
+    0x3,0x30,0x78,0x5,0x28,0x1,0xdf,0xda,0x40,0x1c,0x30,0x70,0x6f,0x2a,0x2c,0xfc,
+    0xff,0x73,0xbd,0xc,0x28,0x31,0xd1,0x28,0x78,0xfa,0x13,0x3,0x21,0xa3,0x5,0xff,
+    0xf7,0x4f,0xfc,0x0,0x6f,0x28,0x1,0xd1,0xd,0x29,0x1,0x30,0x7f,0xd9,0x3,0xea,
+    0x8b,0xa,0x28,0x8b,0x2c,0x8,0x8b,0x4,0x0,0x20,0x30,0xeb,0x77,0x73,0x45,0x5,
+    0x20,0x45,0x1,0x0,0xbf,0x87,0xf5,0xa2,0x47,0x7,0x4,0x47,0x5,0x73,0xbd,0x80,
+    0xb5,0xbf,0x29,0x30,0x1,0x70,0x1,0xbd,0x37,0xb,0x68,0xfe,0x2d,0x1,0x17,0xd1,
+    0x22,0x0,0x78,0x32,0x20,0xff,0x0,0x51,0x30,0x0,0xbf,0x7e,0xa1,0x3,0xbf,0x78,
+    0xc9,0x5c,0x91,0x70,0x87,0x7,0x4,0xc0,0xff,0x78,0x8,0x43,0xd0,0x70,0x5,0x23,
+    0x10,0xdf,0x78,0x80,0x21,0x1,0x43,0x47,0x2,0xe0,0xfb,0xfd,0x4,0x1d,0x5,0x7,
+    0xd1,0x5,0x23,0x71,0xa2,0xfd,0x9f,0x5b,0x4,0xd6,0xfb,0x9,0x20,0xa,0xe0,0x7d,
+    0x0,0xe3,0x5,0xe5,0xfb,0x2,0x23,0x6a,0x73,0x8,0xfb,0xca,0xfb,0x73,0x2,0x31,
+    0xbd,0x53,0xa0,0x70,0xff,0x47,0x44,0x20,0x70,0x47,0x80,0xb5,0x88,0xff,0x30,0x0,
+    0x68,0x1,0x68,0x89,0x6b,0x88,0xeb,0x47,0x1,0x33,0x1,0xf8,0x83,0x0,0xd,0x0,
+    0x16,0xff,0x0,0x1,0x20,0x21,0x0,0x18,0x31,0x8,0xfb,0x76,0x2,0x7,0x4,0x48,
+    0x76,0x22,0x0,0x0,0xfe,0x3f,0x0,0x34,0x30,0xfc,0xf7,0x48,0xfe,0x5,0xff,0x22,
+    0x0,0xbf,0x54,0xa1,0x20,0x0,0x78,0xff,0x30,0xdd,0xf7,0x55,0xfe,0x5,0x20,0x51,
+    0xfe,0xfb,0x0,0x27,0x0,0x52,0x37,0x3d,0x80,0x5,0xff,0x23,0x1d,0x4a,0x39,0x0,
+    0x20,0x0,0xff,0xff,0xf7,0x8,0xfd,0x5,0x0,0x53,0xa0,0x40,0xff,0x19,0x40,0x78,
+    0xb8,0x70,0x56,0xa0,0x69,0xff,0x0,0x40,0x18,0x40,0x88,0x38,0x80,0xfa,0xff,0x21,
+    0x89,0x0,0xdd,0xf7,0xff,0xff,0x1,0xff,0x21,0x14,0x4a,0x12,0x68,0x91,0x40,0x48,
+    0xdf,0x43,0x13,0x49,0x48,0x43,0x15,0x6,0xf7,0xff,0xdf,0x78,0x83,0x0,0xbf,0x48,
+    0x2b,0x8,0xb8,0x83,0xff,0x0,0x2e,0x1,0xd1,0x3,0x21,0x4,0xe0,0xff,0xf,0x36,
+    0xf0,0x10,0x0,0xf,0x80,0x19,0xff,0x1,0x11,0xc9,0xb2,0x88,0x20,0x20,0x58,0xff,
+    0xf1,0xf7,0x95,0xf8,0x1,0x21,0x20,0x7e,0x7f,0xff,0xf7,0x91,0xfb,0xe8,0xf,0xf2,
+    0xb3,0x0,0xff,0x60,0xe6,0x2,0x0,0x90,0x49,0x0,0x20,0xff,0x74,0x4d,0x3,0x0,
+    0x4e,0x26,0x0,0x0,0x51,0x10,0xc3,0x0,0x3d,0x3,0x3b,0x3,0x2f,0x3b,0x9,0x38,
+    0x3b,0x29,0x7d,0x42,0x3b,0x1,0x30,0x34,0x20,0x70,0x10,0x47,0x0,0xf7,0x10,0xb5,
+    0x1,0xeb,0x0,0x2,0x0,0x5c,0x32,0xff,0xd3,0x68,0xb,0x64,0xd3,0x7d,0x1b,0x2,
+    0xff,0x94,0x7d,0x23,0x43,0x13,0x80,0x53,0x7e,0xff,0x1b,0x2,0x14,0x7e,0x23,0x43,
+    0x53,0x80,0xf5,0xd3,0x9,0x0,0x94,0x9,0x0,0x93,0x80,0xa,0x78,0xdf,0x58,0x30,
+    0x1,0x0,0x7,0xfd,0x1,0x29,0xfc,0xfa,0x3b,0x2,0x44,0x35,0x1,0x98,0x69,0x6d,
+    0x41,0xdd,0x3f,0x55,0x22,0xaa,0xb6,0x9c,0x0,0x0,0x14,0xf,0x22,0xef,0x36,0xf8,
+    0x20,0x2,0x3,0xa,0x30,0x3a,0x5a,0xff,0x4e,0x53,0x47,0xa4,0xbf,0x1f,0x2,0x5f,
+    0xfb,0xc0,0x4,0x1f,0x0,0x20,0x7,0x0,0x0,0x1f,0xef,0x2,0x3f,0xc0,0x20,0xb,
+    0x0,0xaf,0x1f,0x2f,0xff,0x3f,0x4f,0x5f,0x6f,0x7f,0x8f,0x9f,0xaf,0xee,0x57,0x1,
+    0x8,0x10,0x18,0x14,0x0,0x2,0x0,0x1,0xfe,0x1,0x8,0x2,0x0,0x80,0x3e,0xd0,
+    0x7,0xa0,0xff,0xf,0x70,0x17,0x40,0x1f,0x80,0x3e,0x0,0xfd,0xc0,0x0,0x6,0x40,
+    0x80,0x0,0x0,0x70,0xb4,0xff,0x0,0x20,0x14,0x0,0xd,0x68,0x1,0xe0,0xff,0x40,
+    0x1c,0x24,0x1d,0x98,0x42,0x6,0xda,0xff,0x26,0x68,0xb5,0x42,0xf8,0xdb,0x83,0x0,
+    0xff,0xd2,0x58,0xa,0x60,0x6,0xe0,0x98,0x0,0xff,0x10,0x18,0x0,0x1f,0x0,0x68,
+    0x8,0x60,0xff,0x0,0x20,0xc0,0x43,0x70,0xbc,0x70,0x47,0xff,0x0,0x0,0x38,0xb5,
+    0xff,0xe7,0x4,0x0,0xdd,0x15,0x15,0x1,0x74,0xfa,0x29,0x6d,0x0,0x30,0x30,0xff,
+    0xff,0xf7,0xab,0xfb,0x26,0x48,0x1,0x0,0xff,0x8,0x31,0x21,0x60,0x68,0x30,0x20,
+    0x63,0xff,0x20,0x0,0x50,0x30,0x1,0x21,0xc1,0x62,0xff,0x0,0x21,0x1,0x70,0x20,
+    0x0,0x32,0xbd,0xff,0x2,0x7e,0x91,0x42,0x0,0xd0,0x0,0x20,0xfb,0x70,0x47,0x8d,
+    0x0,0x20,0x9,0x7e,0x88,0x40,0xe3,0x80,0xb2,0x49,0x2,0x7f,0x0,0x83,0x1,0xd,
+    0x0,0x2,0xff,0x20,0x50,0x21,0x60,0x54,0x26,0x0,0xc,0xff,0x36,0x35,0x80,0x22,
+    0x0,0x0,0x21,0x20,0xff,0x0,0x68,0x30,0xfc,0xf7,0x27,0xfd,0x0,0xff,0x21,0x30,
+    0x7b,0xff,0xf7,0x99,0xfa,0x2,0xef,0x23,0x8e,0xa2,0x31,0x15,0x0,0xef,0xf7,0x7e,
+    0xff,0xfa,0x0,0xbf,0x8,0xa0,0x80,0x34,0x1,0xff,0x78,0x21,0x70,0x41,0x78,0x61,
+    0x70,0x1,0xfe,0x21,0x4,0xa0,0xfa,0x7,0x48,0x85,0x42,0x1,0x9f,0xdb,0x3,0x20,
+    0x70,0xbd,0x65,0x0,0x67,0x1,0x31,0xff,0x8,0x1,0x20,0x8,0x71,0x3,0x48,0xc8,
+    0xff,0x60,0x70,0x47,0x38,0x41,0x3,0x0,0xe1,0xed,0xbf,0x6c,0x0,0x33,0x1,0x6f,
+    0x4,0xe,0x0,0xb5,0xff,0x68,0x22,0x68,0xd2,0x69,0x90,0x47,0x0,0xdf,0x28,0x26,
+    0xd1,0xb0,0x68,0x39,0x0,0xd0,0x5,0xfe,0x35,0x0,0x25,0x0,0x50,0x35,0x68,0x61,
+    0x0,0xff,0x28,0x2,0xd1,0x7,0x20,0x68,0x70,0x18,0xfb,0xe0,0xb,0x5,0x0,0x68,
+    0x7c,0x28,0x74,0x68,0xff,0x78,0xb,0x28,0x11,0xd1,0x28,0x78,0x3,0xff,0x28,0x9,
+    0xd1,0x2,0x23,0x0,0xbf,0xc7,0xfe,0x8b,0x8,0x38,0xfa,0x4,0x20,0x28,0x70,0x4,
+    0x73,0xe0,0x7,0x31,0x0,0x6e,0x1,0xf0,0x2f,0xf9,0x7b,0x6,0xdd,0x38,0x63,0x0,
+    0x20,0x7e,0x98,0xf1,0x0,0xc0,0xe0,0xff,0x25,0x0,0x38,0x35,0x29,0x7e,0x49,0x1e,
+    0xff,0xe,0x29,0x0,0xd9,0xb9,0xe0,0x2,0xa2,0xbf,0x52,0x5c,0x52,0x0,0x97,0x44,
+    0xc3,0x0,0x39,0xff,0xb5,0x44,0x52,0x5f,0xb5,0x9f,0xb5,0x63,0xdf,0xb5,0x6a,0xb5,
+    0xb5,0xa7,0x45,0x1,0x2d,0x30,0xff,0x0,0x78,0x0,0x28,0xf,0xd1,0x21,0x0,0x7b,
+    0x83,0x31,0x53,0x3,0x22,0x6b,0x92,0x68,0xa1,0x2,0xff,0x6,0xd0,0x0,0x22,0x21,
+    0x0,0xa,0x20,0xff,0xe9,0xf7,0x8,0xfb,0x0,0x20,0x96,0xe0,0xbe,0x1b,0x2,0x21,
+    0x6b,0xc9,0x68,0x88,0x1b,0x0,0xd,0xff,0xd0,0x29,0x78,0x20,0x0,0x29,0x30,0x1,
+    0xff,0x70,0x69,0x78,0x22,0x0,0x82,0x32,0x80,0xff,0x20,0x8,0x43,0x10,0x70,0x3,
+    0x20,0x0,0xff,0x90,0x13,0x0,0x45,0xe0,0x0,0x22,0x0,0xfd,0x21,0x37,0x2,0xec,
+    0xfa,0x0,0x20,0x7a,0xe0,0xff,0xf,0x20,0x28,0x76,0x3,0x20,0x68,0x76,0xdf,0x2,
+    0x23,0x98,0xa2,0x30,0xbf,0x4,0xd8,0xf9,0x7f,0x31,0xbd,0x60,0x20,0x28,0x72,0x4,
+    0x2f,0x0,0xff,0x23,0x0,0x40,0x33,0x22,0x0,0x40,0x32,0x7d,0x60,0x19,0x4,0xc0,
+    0xf9,0x5,0x20,0x61,0x69,0x0,0xbf,0x21,0x68,0x49,0x6d,0x88,0x47,0xf3,0x2,0x2e,
+    0xbe,0xf3,0x8,0xbe,0xf9,0x6,0x20,0x54,0x19,0x0,0x0,0xff,0xf0,0xb8,0xf8,0x31,
+    0xbd,0xff,0xf7,0xc3,0xff,0xf9,0x69,0x6c,0x20,0x7e,0xff,0xf7,0xc7,0x73,0xf9,0x1b,
+    0x15,0x0,0xc3,0x6,0xc,0xd0,0x10,0x55,0x0,0x95,0xa,0x55,0x10,0x10,0x3b,0x4,
+    0x95,0x6f,0x0,0x39,0x2,0xac,0xff,0xf8,0x68,0x7e,0xb,0x28,0x10,0xd1,0xe8,0x7f,
+    0x6a,0x21,0x69,0x88,0x42,0xc,0xd1,0x3f,0x2,0xff,0xb5,0xf9,0x0,0x28,0x5,0xd0,
+    0x22,0x7e,0xdf,0x14,0x34,0x21,0x0,0x4,0xb3,0x0,0x92,0xfa,0xbf,0xb,0x20,0x20,
+    0xe0,0x0,0x21,0x1b,0x2,0x99,0xef,0xf9,0x2,0x23,0xe,0xff,0xb,0xf9,0x8,0x20,
+    0xfd,0x14,0xd9,0x0,0x2,0x21,0x68,0x34,0x20,0x0,0xff,0xfc,0xf7,0x1c,0xfc,0x9,
+    0x20,0xc,0xe0,0x6a,0x4f,0x2,0x8,0x9b,0x5,0x60,0x27,0x8,0x6a,0xf9,0xd5,0x0,
+    0xfb,0xe0,0x3,0xf3,0x0,0x31,0xbd,0x31,0x0,0x10,0xff,0xb5,0x82,0xb0,0x1,0x0,
+    0x14,0x31,0xc,0xff,0x79,0x9c,0x42,0x13,0xd1,0x4,0x0,0x40,0xff,0x34,0x23,0x7c,
+    0xb,0x2b,0x1,0xd0,0xe,0xff,0x2b,0xc,0xd1,0x12,0x68,0xa,0x60,0x10,0xff,0x21,
+    0x21,0x70,0xa,0x21,0x0,0x91,0x23,0xfe,0x32,0x1,0x10,0x21,0xef,0xf7,0x40,0xf9,
+    0xc,0xbf,0x20,0x20,0x74,0x13,0xbd,0x10,0xc9,0x1,0x50,0xff,0x34,0x22,0x78,0x9,
+    0x2a,0x15,0xd1,0x2,0xff,0x0,0x68,0x32,0x91,0x42,0x11,0xd1,0x61,0xff,0x78,0xb,
+    0x29,0xc,0xd1,0x21,0x7c,0x81,0xff,0x22,0x81,0x54,0x61,0x69,0x1,0x61,0x2,0xbf,
+    0x23,0x2,0x0,0x80,0x32,0x31,0x35,0x0,0x30,0xfd,0xf9,0xf3,0x0,0xe0,0x7,0x20,
+    0x20,0x70,0x10,0x73,0xbd,0x38,0x39,0x0,0xfb,0x3,0x21,0x68,0x9,0x41,0x1,0xff,
+    0x68,0x60,0x28,0x7e,0x0,0x28,0x1d,0xd1,0xf2,0xbb,0x13,0x11,0xbb,0xd,0xb9,0x3,
+    0x68,0x78,0x10,0x70,0xe9,0x1,0xa1,0x5,0xbb,0x3,0x11,0x19,0x0,0xef,0xf7,0xfd,
+    0x9c,0x61,0x1,0xc3,0xb,0xa,0xfa,0x31,0x8d,0x8,0x79,0x22,0xf3,0xfb,0xf8,0xa,
+    0x75,0x4,0xf8,0xb5,0x1,0x0,0x54,0xff,0x31,0x2,0x0,0x14,0x32,0x13,0x68,0xb,
+    0xff,0x60,0x42,0x30,0xc3,0x79,0x1b,0x7,0x3,0xff,0xd5,0x1a,0x48,0x88,0x80,0xc8,
+    0x80,0x2b,0xff,0xe0,0x43,0x78,0x1c,0x2,0x3,0x78,0x1c,0xff,0x43,0x8c,0x80,0xc3,
+    0x78,0x1d,0x2,0x83,0xff,0x78,0x1d,0x43,0xcd,0x80,0x43,0x79,0x1b,0xff,0x2,0x6,
+    0x79,0x33,0x43,0xb,0x81,0x24,0xff,0xb2,0x8,0x26,0x86,0x5f,0x66,0x43,0xf7,0xff,
+    0x11,0x3f,0xe,0xbe,0x19,0x36,0x12,0xa4,0xff,0x19,0x8c,0x80,0x2d,0xb2,0xa,0x24,
+    0x4,0xff,0x5f,0x6c,0x43,0xe6,0x11,0x36,0xe,0x34,0xff,0x19,0x24,0x12,0x2c,0x19,
+    0xcc,0x80,0x1b,0xff,0xb2,0xc,0x24,0x0,0x5f,0x58,0x43,0xc4,0xff,0x11,0x24,0xe,
+    0x20,0x18,0x0,0x12,0x18,0xbf,0x18,0x8,0x81,0x12,0x79,0x7,0xa3,0x0,0xb8,0xff,
+    0xf9,0xf1,0xbd,0x0,0x80,0xff,0xff,0x31,0xef,0x1f,0x0,0x0,0x30,0xe8,0x1,0x70,
+    0xb5,0xff,0xbf,0xe7,0x4,0x0,0x16,0x0,0x1d,0xcb,0x0,0x5f,0xf7,0xf8,0x8,0x99,
+    0xfd,0x2,0xff,0xf7,0x96,0xf9,0xff,0x78,0x48,0x1,0x0,0x8,0x31,0x21,0x60,0xff,
+    0x64,0x30,0x20,0x63,0x20,0x0,0x7a,0x30,0xff,0x6,0x70,0x45,0x80,0x4,0x99,0x1,
+    0x71,0xff,0x5,0x99,0xc1,0x80,0x6,0x99,0x1,0x81,0xff,0x7,0x99,0x81,0x72,0x0,
+    0x21,0xc1,0x72,0xff,0x20,0x0,0x70,0xbd,0x2,0x7e,0x91,0x42,0xff,0x0,0xd0,0x0,
+    0x20,0x70,0x47,0x1,0x0,0xff,0x1,0x20,0x9,0x7e,0x88,0x40,0x80,0xb2,0xdf,0x70,
+    0x47,0x0,0x0,0xf8,0xb,0x1,0xe,0x0,0xff,0x0,0x25,0xa0,0x20,0x25,0x50,0x27,
+    0x0,0x7f,0xc,0x37,0x3e,0x80,0x22,0x0,0x0,0xf9,0x1,0xff,0x88,0x30,0xfc,0xf7,
+    0xb,0xfb,0x9,0x22,0xff,0xc,0xa1,0x20,0x0,0xcf,0x30,0xdd,0xf7,0xdf,0x5,0xfb,
+    0x0,0x22,0x10,0x17,0x8,0x6,0xfb,0xff,0x2,0x20,0x85,0x34,0x20,0x70,0x1,0x21,
+    0xff,0x38,0x7b,0xff,0xf7,0x86,0xf8,0x57,0x48,0xff,0x86,0x42,0x1,0xdb,0x3,0x20,
+    0xf2,0xbd,0xfd,0x0,0x3,0x2,0x0,0x83,0x83,0x2,0x83,0x83,0xef,0x3,0x84,0x84,
+    0x0,0x0,0x0,0x1,0x22,0xa,0xff,0x71,0x84,0x30,0x0,0x78,0x80,0x1c,0xfa,0xff,
+    0x23,0x9b,0x0,0x58,0x43,0x88,0x60,0x21,0xff,0x20,0xc8,0x80,0x4c,0x48,0xc8,0x60,
+    0x4,0xff,0x20,0x8,0x61,0x8a,0x61,0x4a,0x48,0x48,0xef,0x61,0x70,0x47,0x70,0x85,
+    0x0,0xd,0x0,0xa8,0xff,0x68,0x1,0x28,0x2,0xda,0x0,0x20,0xa8,0xff,0x60,0x70,
+    0xbd,0x84,0x34,0xfa,0x26,0xb6,0xff,0x0,0x21,0x78,0x89,0x1c,0x71,0x43,0x88,0xef,
+    0x42,0x2,0xda,0xa9,0x2f,0x0,0x70,0xbd,0x31,0xff,0x0,0xdd,0xf7,0x98,0xfc,0x80,
+    0x1e,0xa8,0xef,0x60,0x24,0x78,0x21,0xb,0x0,0x92,0xfc,0x60,0x7f,0x43,0x80,0x1c,
+    0x70,0x43,0xa8,0x60,0xd9,0x0,0xfc,0xb5,0x1,0xcb,0x2,0xb5,0x68,0x22,0x68,0xd2,
+    0x69,0xff,0x90,0x47,0x0,0x28,0x39,0xd1,0xb0,0x68,0xdf,0x85,0x42,0x1,0xd0,0x5,
+    0x95,0x0,0xfa,0x21,0xfd,0x89,0x2f,0x0,0x7a,0xfc,0x25,0x0,0x84,0x35,0xff,0xe8,
+    0x61,0x0,0x28,0x1,0xd0,0x2,0x21,0xff,0x0,0xe0,0x0,0x21,0x40,0x1a,0xe8,0x61,
+    0xff,0x2e,0x78,0x30,0x2,0x80,0x1b,0xe9,0x69,0xff,0x88,0x42,0x1,0xda,0xff,0x27,
+    0xb,0xe0,0xfb,0x8,0x46,0x67,0x2,0x64,0xfc,0x7,0x0,0xe8,0xfd,0x69,0x9,0x2,
+    0x5f,0xfc,0x0,0x29,0x0,0xd0,0xff,0x7f,0x1c,0xa4,0x20,0x27,0x54,0xe8,0x69,0xfe,
+    0x3b,0x10,0x18,0xe8,0x61,0x69,0x78,0x17,0x29,0xbf,0x4,0xd1,0x0,0x28,0x2,0xd0,
+    0xa8,0x1,0xf0,0xfb,0x98,0xfc,0x1,0x3,0x70,0xb5,0x82,0xb0,0x4,0xff,0x0,0x25,
+    0x0,0x85,0x35,0x28,0x78,0x0,0xff,0x28,0x1c,0xd1,0x26,0x0,0x30,0x36,0x30,0xbf,
+    0x0,0x31,0x68,0xc9,0x68,0x88,0x95,0x0,0xf,0xff,0xd0,0x31,0x7a,0x20,0x0,0x29,
+    0x30,0x1,0xff,0x70,0x1,0x20,0x28,0x70,0x2,0x20,0x0,0xff,0x90,0x23,0x0,0x3c,
+    0x33,0x9,0x4a,0x80,0xfe,0x5d,0x1,0xee,0xf7,0xa7,0xff,0x73,0xbd,0x0,0xff,0x22,
+    0x0,0x21,0xa,0x20,0xe9,0xf7,0xb4,0xff,0xf8,0x73,0xbd,0x98,0x42,0x3,0x0,0xcf,
+    0xef,0xcc,0x0,0x0,0xb0,0xb7,0x1,0xff,0x7f,0x0,0xef,0x0,0x5c,0xf0,0x2,0xb3,
+    0x5,0x25,0x0,0x10,0xef,0x35,0x28,0x7a,0x98,0xd3,0x1,0x9f,0xe1,0x26,0xff,0x0,
+    0x85,0x36,0x30,0x78,0x40,0x1e,0x15,0xff,0x28,0x0,0xd9,0x98,0xe1,0x2,0xa1,0x40,
+    0xff,0x0,0x9,0x5a,0x8f,0x44,0x0,0xbf,0x2c,0xff,0x0,0x28,0x3,0x92,0x0,0xb6,
+    0x0,0xce,0xff,0x0,0xfc,0x0,0xa,0x1,0x36,0x1,0xce,0xff,0x1,0x28,0x3,0xd2,
+    0x1,0xea,0x1,0x0,0xff,0x2,0x46,0x2,0x28,0x3,0x4a,0x2,0x62,0xef,0x2,0x78,
+    0x2,0xa0,0x9,0x0,0xa4,0x2,0xba,0xf2,0x86,0x0,0x2d,0xa5,0x1,0x9d,0x0,0xd1,
+    0x21,0x0,0x3d,0xff,0x31,0x20,0x0,0x30,0x30,0x2a,0x6a,0x92,0xfd,0x68,0x45,0x3,
+    0x6,0xd0,0x0,0x22,0x21,0x0,0x7e,0x8f,0x2,0x6c,0xf8,0x0,0x20,0x67,0xe1,0x1b,
+    0x2,0x7b,0x29,0x6a,0xcb,0xa,0x38,0x20,0x21,0x5c,0xcd,0x6,0xde,0xc9,0xa,0x0,
+    0xbf,0xad,0xa2,0xcb,0x6,0x41,0xff,0xd5,0xf1,0xcb,0xc,0x4e,0x3b,0x0,0x49,0x3b,
+    0x0,0xee,0xf7,0xff,0x74,0xff,0x0,0x28,0x0,0xd0,0x44,0xe1,0xdd,0xf,0x2f,0xc,
+    0xa2,0xa2,0x90,0x2f,0x4,0x29,0xff,0xd7,0x4,0x20,0x37,0x17,0x10,0x9c,0x17,0x8,
+    0x1d,0xff,0xf7,0x5,0x20,0x2b,0x3b,0x0,0x0,0xf0,0x6f,0xfb,0xff,0x20,0x0,0xcc,
+    0x30,0x1,0x7a,0x60,0x22,0xff,0xa2,0x5c,0x92,0x0,0x1c,0x23,0x13,0x40,0xff,0xb,
+    0x43,0x3,0x72,0x0,0x21,0xc1,0x72,0xf5,0x3,0xa3,0x0,0xcf,0xb7,0x0,0xee,0xf7,
+    0x3b,0xff,0xd7,0x6,0x20,0x14,0x69,0x4,0x3f,0x69,0x4,0xf,0xe1,0xff,0xe0,0xe0,
+    0x27,0x0,0xa0,0x37,0x0,0x21,0xff,0xb9,0x76,0xf9,0x76,0x39,0x77,0x25,0x0,0x7f,
+    0xd8,0x35,0x9,0x22,0x89,0xa1,0x28,0xd9,0x1,0xff,0xae,0xf9,0x5,0x20,0x78,0x75,
+    0x3,0x22,0xfb,0x29,0x0,0x2f,0x2,0x1e,0xff,0x8,0x20,0xf7,0xd5,0xe0,0x9,0x2,
+    0x22,0x39,0x4,0xf2,0x37,0x4,0x78,0x7d,0xff,0x40,0x1e,0x78,0x75,0x0,0x6,0xe,
+    0xd4,0xff,0x28,0x7a,0xfe,0xf7,0xef,0xfe,0x1,0x21,0xfe,0x7,0x2,0xf3,0xfe,0x2,
+    0x23,0x7b,0xa2,0x82,0xfe,0x9f,0x4,0xd8,0xfe,0x9,0x20,0xdb,0xe0,0xb8,0xff,0x7e,
+    0x78,0x77,0xf8,0x7e,0xb8,0x77,0x38,0xff,0x7f,0xf8,0x77,0x0,0x21,0xf9,0x84,0x39,
+    0xf7,0x85,0x79,0x85,0xad,0x4,0x70,0x41,0x70,0x81,0xff,0x70,0x21,0x0,0x60,0x31,
+    0x4a,0x8c,0x3a,0xff,0x84,0x4a,0x8c,0x7a,0x84,0x49,0x8c,0xb9,0xff,0x84,0x1e,0x21,
+    0xc9,0x43,0x79,0x75,0xb9,0xff,0x76,0x15,0x21,0x79,0x56,0xf9,0x76,0x15,0xff,0x22,
+    0xba,0x56,0x3a,0x77,0x21,0x23,0x83,0xff,0x73,0x3f,0x23,0x19,0x40,0x41,0x74,0x13,
+    0xbb,0x40,0x3,0x95,0x0,0x21,0x0,0xd8,0xd1,0x4,0xd2,0xff,0xfe,0xd,0x20,0xab,
+    0xe0,0xa,0x20,0xa9,0xbb,0xe0,0x9,0x1b,0xd,0x93,0xa2,0xb0,0x7b,0x4,0x8f,0xef,
+    0xfe,0xc,0x20,0x9d,0xb3,0x0,0x0,0xf0,0x10,0x7d,0xfa,0x31,0xe,0xb9,0xfe,0x8,
+    0x20,0x92,0xc9,0x4,0xeb,0xbd,0xfe,0xc9,0x2,0x8d,0xc9,0xa,0x1c,0x78,0x75,0xbf,
+    0x40,0xb2,0x21,0x28,0xe,0xda,0xc3,0x2,0x89,0xea,0xcb,0x8,0x8d,0xcb,0x0,0x48,
+    0xcb,0x8,0x72,0xfe,0xe,0xff,0x20,0x75,0xe0,0x0,0x20,0xf8,0x82,0x38,0xff,0x68,
+    0x0,0x28,0x69,0xd0,0x64,0xe0,0xf,0xeb,0x20,0x6d,0x77,0x10,0x75,0x77,0x8,0x53,
+    0xfe,0x11,0xab,0x20,0x61,0x77,0x4,0x26,0x77,0x10,0x7d,0xa9,0x0,0x56,0x5a,0x77,
+    0x4,0x81,0x77,0x0,0x52,0xd1,0x5d,0x2,0x56,0x65,0x8,0xed,0x5a,0x65,0x0,0x26,
+    0x4a,0x65,0x6,0x3f,0xfe,0x13,0xbf,0x20,0x42,0xe0,0x14,0x20,0x40,0x59,0xc,0x5f,
+    0xbe,0x57,0x8,0x27,0xfe,0x16,0x20,0x35,0x57,0x4,0xd0,0xfd,0xf8,0xb3,0x2,0xf8,
+    0x8a,0x39,0x8b,0x88,0x42,0xff,0x8,0xd3,0x2,0x23,0x0,0xbf,0x20,0xa2,0xfd,0x81,
+    0x23,0x4,0x20,0xfe,0x7,0x20,0x23,0xe0,0xff,0x3f,0x68,0x0,0x2f,0x19,0xd0,0x28,
+    0x68,0xf7,0xfa,0x21,0x89,0xc9,0x1,0x8d,0xfa,0x87,0x42,0x55,0xe,0x6f,0x4,0x1e,
+    0x6f,0x8,0x22,0x6f,0x0,0xa,0x6f,0x8,0xf5,0x7,0x6f,0x0,0xa,0x55,0x4,0xc7,
+    0xfa,0xf1,0xbd,0xf7,0xa0,0x34,0x20,0x35,0x4,0x48,0x43,0x28,0x60,0xff,0x17,0x20,
+    0x30,0x70,0xf1,0xbd,0x0,0x0,0xff,0x20,0xf6,0x2,0x0,0x80,0x0,0x0,0x0,0xf9,
+    0x90,0x3,0x0,0x0,0x12,0x85,0x85,0x0,0x86,0x86,0xf7,0x0,0x87,0x87,0xb,0x2,
+    0x82,0x1,0x0,0x0,0xfd,0x81,0x7,0x0,0x38,0xb5,0x4,0x0,0x20,0x7e,0xff,0x98,
+    0x42,0x62,0xd1,0x25,0x0,0x85,0x35,0xff,0x28,0x78,0x9,0x28,0x1c,0xd0,0xa,0x28,
+    0xff,0x8,0xd0,0xe,0x28,0x34,0xd0,0xf,0x28,0xff,0x1f,0xd0,0x13,0x28,0x4c,0xd0,
+    0x14,0x28,0xff,0x37,0xd0,0x31,0xbd,0x10,0x68,0x9c,0x21,0xff,0x60,0x50,0x0,0x21,
+    0x20,0x7e,0xfe,0xf7,0xeb,0xda,0xfd,0xeb,0xa,0x24,0xeb,0x8,0xb1,0xfd,0xc,0xf7,
+    0x20,0x3f,0xe0,0x23,0x12,0xc8,0xfd,0xb,0x20,0x75,0x36,0x11,0x14,0xbf,0x35,0xc,
+    0x0,0xbf,0x16,0x37,0x8,0xe7,0x95,0xfd,0x11,0xff,0x0,0x25,0x12,0xac,0xfd,0x10,
+    0xab,0x20,0x1a,0x11,0x14,0xa3,0x37,0x10,0x8,0x37,0x8,0x79,0xef,0xfd,0x16,0x20,
+    0x7,0x25,0x14,0x90,0xfd,0x15,0xaf,0x20,0x28,0x70,0x31,0xff,0x0,0xb0,0xf3,0x10,
+    0x70,0xef,0x47,0x0,0x0,0x10,0xe3,0x0,0x85,0x34,0x21,0xff,0x78,0x2,0x29,0x6,
+    0xd1,0x2,0x22,0x0,0xff,0xbf,0x2,0xa1,0xee,0xf7,0x8e,0xfd,0x3,0xff,0x20,0x20,
+    0x70,0x10,0xbd,0x88,0x88,0x0,0xfb,0x89,0x89,0x27,0x0,0xf0,0xb5,0x87,0xb0,0x4,
+    0xff,0x0,0x21,0x68,0x9,0x6d,0x88,0x47,0x25,0xff,0x0,0x4e,0x35,0x0,0x20,0x28,
+    0x5e,0x0,0xff,0x28,0xe,0xd0,0x2,0x21,0x6a,0x5e,0x0,0xff,0x2a,0xa,0xd0,0x4,
+    0x21,0x69,0x5e,0x0,0xff,0x29,0x6,0xd0,0xab,0x8e,0x98,0x42,0x3,0xff,0xd0,0x9a,
+    0x42,0x1,0xd0,0x99,0x42,0xa,0xff,0xd1,0x26,0x0,0x9c,0x36,0x70,0x8b,0x40,0xff,
+    0x1c,0x70,0x83,0x30,0x68,0xf0,0x60,0x59,0x7f,0x48,0x30,0x82,0x70,0x82,0xa6,0xe0,
+    0x15,0x2,0xff,0x0,0x23,0x73,0x83,0x1e,0x23,0xf3,0x56,0xff,0x77,0x8d,0x7b,0x43,
+    0xc0,0x18,0x28,0x80,0xff,0x1f,0x20,0x30,0x56,0xb3,0x8d,0x58,0x43,0xdf,0x10,0x18,
+    0x68,0x80,0x20,0xb,0x0,0xf2,0x8d,0xff,0x50,0x43,0x8,0x18,0xa8,0x80,0x4c,0x20,
+    0xbf,0x20,0x5e,0xc0,0x0,0x1,0x90,0x6f,0x2,0x69,0xff,0x8e,0x40,0x1a,0xc1,0x0,
+    0x0,0x91,0x14,0xff,0x20,0x29,0x5e,0x1,0x98,0x48,0x43,0x64,0xff,0x21,0xdd,0xf7,
+    0x87,0xf9,0x0,0x99,0x8,0xaf,0x1a,0x3,0x90,0x2,0x1f,0x10,0x16,0x1f,0x10,0x77,
+    0xae,0x1f,0x4,0x4,0x90,0x4,0x1f,0x10,0x18,0x1f,0x10,0x67,0xfe,0x1f,0x6,0x99,
+    0x9,0x1a,0x2,0x91,0x4,0x99,0x7f,0x4a,0x42,0x10,0x1a,0x1,0x90,0x2a,0x1f,0x0,
+    0xff,0x0,0x91,0x3,0x98,0x64,0x21,0x48,0x43,0xfd,0x1a,0xd7,0x0,0x2,0x9a,0x4a,
+    0x43,0x80,0x18,0x55,0x1c,0x9,0x0,0x1,0x9,0x4,0xa,0x37,0x0,0x4b,0x37,0x0,
+    0x57,0x48,0x43,0x5,0x2b,0x8,0x1e,0x5,0x0,0x3,0x51,0x0,0x55,0x20,0x2d,0xc,
+    0x22,0x2d,0x14,0x34,0x2d,0x4,0x4,0x2d,0x8,0x55,0x24,0x2d,0x8,0x26,0x2d,0xc,
+    0x28,0x2d,0x14,0x1d,0x5b,0x6,0xed,0x0,0x33,0x3,0x5,0x98,0x11,0x2,0x14,0xf9,
+    0xc0,0xaf,0x11,0x30,0x82,0x4,0xb,0x4,0xe,0xb,0x0,0x70,0xd7,0x82,0x28,0x0,
+    0xb,0x2,0x8,0xb,0x0,0xb0,0x82,0xff,0x22,0x7e,0xa8,0x34,0x21,0x0,0x7,0x20,
+    0xff,0xe8,0xf7,0x91,0xfd,0x7,0xb0,0xf0,0xbd,0xdf,0x0,0x80,0xff,0xff,0xf8,0xd3,
+    0x1,0x0,0x25,0xef,0x0,0x27,0x0,0x26,0xb3,0x7,0x4e,0x20,0x22,0xff,0x5e,0x20,
+    0x0,0x80,0x30,0x1,0x88,0x91,0xff,0x42,0x1,0xda,0x1,0x27,0x2,0xe0,0x8a,0xff,
+    0x42,0x0,0xda,0xff,0x43,0x50,0x22,0xa2,0x75,0x5e,0x11,0x4,0x25,0x11,0x6,0xed,
+    0x43,0x52,0x11,0xa,0xfd,0x26,0x11,0x6,0xf6,0x43,0x21,0x0,0xba,0x31,0xff,0xa5,
+    0xa2,0x0,0x23,0xcb,0x56,0x9c,0x46,0xff,0x35,0x23,0xc3,0x56,0xd3,0x5c,0x5f,0x43,
+    0x7f,0x63,0x46,0xdb,0x19,0xb,0x70,0x1,0x13,0x0,0xff,0x35,0x27,0xc7,0x57,0xd7,
+    0x5d,0x7d,0x43,0xdf,0x5b,0x19,0x4b,0x70,0x2,0xf,0x2,0x25,0x40,0xff,0x57,0x10,
+    0x5c,0x46,0x43,0x98,0x19,0x88,0xff,0x70,0xda,0x34,0x3f,0x20,0x0,0x22,0x8a,0xbf,
+    0x56,0x2,0x40,0x22,0x70,0x1,0x7,0x4,0xe2,0xff,0x70,0x2,0x22,0x89,0x56,0x8,
+    0x40,0xa0,0xcf,0x71,0xf1,0xbd,0x38,0xa3,0x0,0x9d,0xa,0x21,0x5e,0xff,0x25,0x0,
+    0xba,0x35,0x20,0x0,0x82,0x30,0xdf,0x0,0x29,0xf,0xd0,0x2,0xa5,0x0,0xc,0xd0,
+    0xff,0x6,0x23,0xeb,0x5e,0x0,0x2b,0x8,0xd0,0xff,0x93,0x42,0x6,0xd0,0xaa,0x89,
+    0xd2,0x18,0xff,0x51,0x1a,0xa9,0x81,0xa9,0x7c,0x49,0x1c,0xbf,0xa9,0x74,0x50,0x21,
+    0x61,0x5e,0x27,0xe,0x8,0xba,0x27,0x10,0xea,0x27,0x4,0xe9,0x81,0xe9,0x27,0x0,
+    0xe9,0x6b,0x74,0x52,0x27,0x14,0xa,0x27,0x10,0x2a,0x8a,0x27,0x2,0xff,0x29,0x82,
+    0x29,0x7d,0x49,0x1c,0x29,0x75,0xff,0x33,0x21,0x41,0x56,0x20,0x29,0x14,0xd1,0xff,
+    0xa8,0x89,0xa9,0x7c,0xdd,0xf7,0x5d,0xf8,0xdf,0xa8,0x81,0xe8,0x89,0xe9,0x9,0x0,
+    0x58,0xf8,0xff,0xe8,0x81,0x28,0x8a,0x29,0x7d,0xdd,0xf7,0xff,0x53,0xf8,0x28,0x82,
+    0xe8,0x78,0x28,0x70,0xff,0x28,0x79,0x68,0x70,0x68,0x79,0x10,0xe0,0xbf,0x4e,0x21,
+    0x61,0x5a,0xe9,0x80,0x87,0x0,0x5a,0xbb,0x29,0x81,0x65,0x0,0x5a,0x69,0x81,0x43,
+    0x0,0x5c,0xfb,0x29,0x70,0x5,0x2,0x69,0x70,0x33,0x30,0x0,0xfb,0x78,0xa8,0xfd,
+    0x6,0x21,0x69,0x56,0x1,0x40,0x77,0x21,0x70,0x1,0x7,0x4,0xe1,0x70,0x2,0x7,
+    0x0,0xfe,0xfd,0x2,0x31,0xbd,0xf0,0xb4,0x1,0x0,0x3d,0xff,0x31,0xa,0x78,0xca,
+    0x75,0x4a,0x78,0xa,0xff,0x76,0x8a,0x78,0x4a,0x76,0xca,0x78,0x93,0xff,0x8,0x8b,
+    0x76,0xb,0x79,0x92,0x0,0xc,0xff,0x24,0x14,0x40,0x9a,0x9,0x22,0x43,0xca,0xff,
+    0x76,0x9b,0x6,0x9b,0xe,0xb,0x77,0x4b,0xff,0x79,0x9c,0x8,0x4c,0x77,0x8c,0x79,
+    0x1b,0xff,0x1,0x30,0x25,0x1d,0x40,0x23,0x9,0x2b,0xff,0x43,0x8b,0x77,0xcd,0x79,
+    0xe4,0x0,0x78,0xff,0x26,0x26,0x40,0x6c,0x9,0x34,0x43,0xcc,0xff,0x77,0x6e,0x0,
+    0x3e,0x25,0x35,0x40,0xe,0xff,0x7a,0xf6,0x9,0x2e,0x43,0x5d,0x25,0x46,0xbf,0x55,
+    0xd,0x7a,0x6d,0x0,0x4e,0xd,0x4,0x5,0xff,0x0,0x5d,0x35,0x6e,0x70,0x4d,0x7a,
+    0x6d,0xff,0x6,0xed,0xe,0x6,0x0,0x5d,0x36,0xb5,0xae,0xb,0x0,0x6e,0x0,0x6,
+    0x2d,0x0,0x8e,0x1f,0xc,0xee,0xff,0x70,0x5,0x0,0x62,0x35,0xce,0x7d,0x2f,0xff,
+    0x7e,0x7e,0x43,0x6f,0x8b,0xf6,0x1b,0x2e,0x77,0x80,0xe,0x7e,0xb,0xa,0x6e,0x80,
+    0x4e,0xb,0xc,0xff,0xae,0x80,0x8e,0x7e,0x20,0x3e,0xee,0x80,0xff,0x8,0x3a,0x2a,
+    0x81,0xa,0x7f,0x20,0x3a,0xff,0x6a,0x81,0x49,0x7f,0x26,0x31,0xa9,0x81,0xff,0x20,
+    0x3b,0xeb,0x81,0x40,0x3c,0x2c,0x82,0xfd,0x5d,0xfd,0x0,0x20,0x39,0x69,0x82,0x1,
+    0x0,0xff,0x5d,0x31,0x49,0x78,0xa9,0x82,0x5d,0x30,0xff,0x80,0x78,0x29,0x7f,0x40,
+    0x18,0xe8,0x82,0xef,0xf0,0xbc,0x70,0x47,0xef,0x3,0xd4,0x30,0x1,0xff,0x78,0x60,
+    0x22,0xa2,0x5c,0x92,0x0,0x1c,0xff,0x23,0x13,0x40,0xb,0x43,0x3,0x70,0x25,0xff,
+    0x0,0xa0,0x35,0x29,0x79,0xc1,0x70,0xfa,0xff,0x21,0x89,0x0,0x28,0x68,0x48,0x43,
+    0x20,0xff,0x61,0xdc,0xf7,0x9c,0xff,0x1,0x0,0x7,0xff,0x48,0xdc,0xf7,0x98,0xff,
+    0x28,0x83,0x3,0xff,0x22,0x21,0x0,0xcf,0x31,0x20,0x0,0xee,0xff,0xf7,0x44,0xfb,
+    0x12,0x20,0x85,0x34,0x20,0xff,0x70,0x31,0xbd,0x0,0x0,0xb8,0xb,0x0,0xff,0x0,
+    0x82,0x11,0x0,0x0,0x1,0x2,0x4,0xff,0x8,0x10,0x0,0x0,0x0,0x38,0xb5,0xff,
+    0xff,0xe7,0x4,0x0,0x15,0x0,0xfe,0xf7,0xe0,0xff,0xfb,0xd0,0x48,0x20,0x60,0x20,
+    0x0,0x30,0xff,0x30,0x5,0x70,0x0,0x21,0x81,0x76,0x20,0xff,0x0,0x32,0xbd,0x18,
+    0x30,0x3,0x7e,0x99,0xff,0x42,0x7,0xd1,0x0,0x2a,0x1,0xd0,0x11,0xff,0x68,0x0,
+    0xe0,0x0,0x21,0xc1,0x64,0x0,0xff,0x20,0x70,0x47,0x3,0x78,0x99,0x42,0x6,0xbe,
+    0x15,0x10,0x81,0x64,0xf3,0xe7,0x6,0x17,0x0,0x10,0xff,0xb5,0x82,0xb0,0x4,0x0,
+    0x4a,0x20,0x20,0xff,0x5c,0x0,0x28,0x2,0xd0,0x0,0x20,0xc0,0xff,0x43,0x16,0xbd,
+    0xe1,0x65,0x88,0x20,0x8,0xff,0x70,0xe3,0x6d,0x7,0x20,0x0,0x90,0x1a,0xf7,0x0,
+    0x88,0x21,0x91,0x2,0xc6,0xfa,0x1,0x20,0xbd,0x4a,0x91,0x0,0x0,0x20,0x16,0xbd,
+    0x33,0x6,0x32,0xff,0x34,0x21,0x7e,0x1,0x29,0x6,0xd0,0x6b,0xff,0xd3,0x3,0x29,
+    0x39,0xd0,0x1d,0xd3,0x4,0xff,0x29,0x53,0xd0,0x65,0xe0,0xc1,0x6d,0x8a,0xff,0x78,
+    0x12,0x2,0x4b,0x78,0x1a,0x43,0x22,0xbf,0x80,0xa,0x79,0x12,0x2,0xcb,0x9,0x0,
+    0x62,0xfb,0x80,0x8a,0x9,0x0,0x4b,0x79,0x1a,0x43,0xa2,0xff,0x80,0x8e,0x22,0xa,
+    0x70,0xc3,0x6d,0x7,0xff,0x21,0x0,0x91,0x1a,0x0,0x8e,0x21,0xee,0xbf,0xf7,0x9a,
+    0xfa,0x2,0x20,0x34,0x35,0x10,0xe2,0x76,0x35,0xc,0x22,0x81,0x35,0xa,0x62,0x81,
+    0x94,0x35,0x0,0xdd,0xc2,0x35,0x4,0x13,0x0,0x94,0x35,0x0,0x7f,0xfa,0xb7,0x3,
+    0x20,0x19,0x35,0x10,0xa2,0x81,0x35,0xa,0xe2,0xae,0x35,0xc,0x22,0x82,0x9a,0x35,
+    0x10,0x9a,0x35,0x0,0x64,0xbf,0xfa,0x4,0x20,0x20,0x76,0x1,0xc1,0x0,0xc1,0xff,
+    0x6d,0x88,0x78,0x0,0x2,0x4a,0x78,0x10,0xff,0x43,0x60,0x82,0x8,0x79,0x0,0x2,
+    0xca,0xee,0x9,0x0,0xa0,0x82,0x88,0x9,0x0,0x49,0x79,0x8,0x6f,0x43,0xe0,0x82,
+    0x0,0x27,0x0,0x16,0xbd,0xd,0x7,0xff,0xf8,0xb5,0x6,0x0,0x37,0x0,0x14,0x37,
+    0xff,0xc8,0x10,0xf9,0x8b,0x49,0x0,0x41,0x1a,0xff,0x20,0x20,0x38,0x5e,0x48,0x43,
+    0xc0,0x12,0xff,0xa,0x0,0x4a,0x43,0x91,0x13,0x22,0x22,0xff,0xba,0x5e,0x51,0x43,
+    0x89,0x13,0x44,0x18,0xff,0x35,0x0,0x58,0x35,0xa0,0x0,0x0,0x19,0xff,0x80,0x30,
+    0x0,0x12,0xc0,0x1,0x64,0x21,0xff,0xdc,0xf7,0xae,0xfe,0xe9,0x68,0x40,0x18,0xff,
+    0x28,0x80,0x38,0x68,0x38,0x64,0x3a,0x7f,0xff,0xff,0x2a,0x4,0xd0,0x54,0x36,0x31,
+    0x0,0xff,0x7,0x20,0xe8,0xf7,0x32,0xfb,0x20,0x0,0xdf,0xf2,0xbd,0xf4,0xb5,0x84,
+    0x47,0x1,0xcb,0x17,0xff,0x5d,0xa6,0xc0,0xce,0x76,0x18,0x5f,0x41,0xff,0x30,0x0,
+    0x39,0x0,0x32,0x0,0x3b,0x0,0xff,0xdd,0xf7,0x69,0xf8,0x42,0x22,0xa2,0x5e,0xff,
+    0xd3,0x17,0xdd,0xf7,0x64,0xf8,0x0,0x90,0xeb,0x1,0x91,0x19,0x2,0x40,0x11,0x8,
+    0x5b,0xf8,0x49,0xff,0x4,0xc2,0xb,0x11,0x43,0x40,0x4,0x0,0xff,0x9a,0x1,0x9b,
+    0x80,0x18,0x59,0x41,0x2,0x77,0xaa,0x3,0xc2,0x3b,0xe,0x4b,0xf8,0x3c,0x29,0x8,
+    0xff,0x46,0xf8,0x0,0xa,0xa,0x6,0x10,0x43,0xeb,0x9,0x12,0x43,0xa,0x3a,0x19,
+    0x8,0x39,0xf8,0x9,0x7f,0x3,0x2,0xd,0x11,0x43,0x0,0x3,0x43,0xa,0xff,0x80,
+    0x23,0x1b,0x2,0x4b,0x41,0x19,0x0,0xff,0x22,0x8f,0x0,0x23,0xdd,0xf7,0x29,0xf8,
+    0xff,0x4e,0x10,0xcf,0x17,0x3,0xd1,0x0,0x2e,0xff,0x1,0xd1,0x0,0x20,0x59,0xe0,
+    0x80,0x20,0xff,0x40,0x3,0x4,0x99,0x42,0x1a,0xd3,0x17,0xff,0xdb,0x7,0x50,0x8,
+    0x3,0x43,0xd2,0x7,0xff,0x2,0xa8,0x3,0xc8,0x12,0x1a,0x8b,0x41,0xff,0x3e,0x20,
+    0x20,0x5e,0xc1,0x0,0x0,0x20,0x7e,0xb,0x2,0x10,0x0,0x19,0x0,0x2d,0x4a,0x3f,
+    0x2,0xfb,0x9,0xf8,0x8b,0x2,0xe1,0xf7,0xda,0xfa,0x6,0xef,0x0,0xf,0x0,0x48,
+    0x23,0x2,0x17,0x72,0xb,0xff,0xfd,0x4,0x2a,0x43,0x7b,0x13,0xdc,0xf7,0xef,0xfa,
+    0xff,0x72,0xb,0x9,0x6,0xf5,0xff,0x40,0xff,0xe,0xca,0x1,0x10,0x43,0x49,0x16,
+    0x80,0x97,0x19,0x79,0x41,0xa5,0x2,0x46,0x2b,0x4,0x3d,0x2,0xdc,0xff,0xf7,0xe6,
+    0xff,0xc0,0xc,0x4a,0x3,0x10,0xa7,0x43,0xc9,0x14,0xa5,0xa,0xcf,0xa,0x44,0xc7,
+    0x4,0x1b,0xff,0x1,0x15,0xf,0x2b,0x43,0x12,0x1,0x12,0xff,0x18,0x4b,0x41,0x1b,
+    0x3,0x10,0xd,0x3,0xff,0x43,0x10,0x3,0x19,0x0,0x64,0x22,0x0,0xff,0x23,0xe1,
+    0xf7,0x9d,0xfa,0x61,0x69,0xe1,0xff,0x64,0x20,0x65,0x21,0x6e,0x40,0x18,0x20,0xbf,
+    0x65,0x22,0x7e,0x4c,0x34,0x21,0x79,0x5,0x75,0xbf,0xfa,0x5,0xb0,0xf0,0xbd,0x0,
+    0x0,0x2,0xc,0xfb,0xfe,0xff,0x0,0x2,0x74,0x47,0x3,0x0,0x35,0xff,0xc,0x0,
+    0x0,0x70,0xb4,0x0,0x20,0x14,0xff,0x0,0xd,0x78,0x1,0xe0,0x40,0x1c,0x64,0xff,
+    0x1c,0x98,0x42,0x5,0xda,0x26,0x78,0xae,0xff,0x42,0xf8,0xd3,0x12,0x5c,0xa,0x70,
+    0x5,0xff,0xe0,0xd0,0x18,0x40,0x1e,0x0,0x78,0x8,0xff,0x70,0x0,0x20,0xc0,0x43,
+    0x70,0xbc,0x70,0xf5,0x47,0x2d,0x8,0x68,0x2d,0x2,0x24,0x1d,0x98,0x42,0xef,0x6,
+    0xda,0x26,0x68,0x2d,0x2,0x83,0x0,0xd2,0xff,0x58,0xa,0x60,0x6,0xe0,0x98,0x0,
+    0x10,0x7f,0x18,0x0,0x1f,0x0,0x68,0x8,0x60,0x31,0xa,0xff,0xf5,0xb5,0x83,0xb0,
+    0xe,0x0,0x2,0x90,0xff,0x3,0x27,0x0,0x20,0x0,0x21,0x4,0x9c,0xfb,0x3,0x25,
+    0x95,0x5,0x68,0xc1,0x17,0x22,0x68,0xbf,0xd3,0x17,0xdc,0xf7,0x6f,0xff,0xe5,0xa,
+    0xc,0xff,0x36,0x24,0x1d,0x6d,0x1e,0xef,0xd1,0x0,0xff,0xe,0xa,0x2,0x10,0x43,
+    0x2,0x99,0x8,0xff,0x60,0x2,0x98,0x0,0x1d,0x2,0x90,0x20,0x7f,0x3e,0x7f,0x1e,
+    0xe0,0xd1,0x3,0x98,0xc1,0x6,0xdf,0x70,0x47,0x38,0xb5,0x5,0x79,0x1,0x28,0x60,
+    0xff,0x0,0x24,0x6c,0x60,0xac,0x60,0x3,0x23,0xff,0x10,0x22,0x8b,0x49,0x28,0x0,
+    0x10,0x30,0xff,0xe1,0xf7,0xc0,0xfa,0xac,0x64,0x28,0x0,0xff,0x32,0xbd,0x10,0xb5,
+    0x82,0xb0,0x4,0x0,0xff,0x22,0x60,0x43,0x30,0xa,0x68,0x2,0x70,0xff,0x49,0x68,
+    0x41,0x70,0x20,0x0,0x0,0xf0,0xff,0x50,0xf9,0x82,0x48,0x0,0x90,0x69,0x46,0xfe,
+    0xb,0x2,0xc1,0xf8,0x0,0x20,0x16,0xbd,0x2,0xbf,0x21,0x1,0x60,0xf,0x21,0x41,
+    0xab,0x0,0x70,0xff,0x47,0x0,0x28,0x5,0xd0,0x0,0x29,0x1,0xff,0xd0,0x7a,0x48,
+    0x6,0xe0,0x7a,0x48,0x4,0xfd,0xe0,0xb,0x2,0x79,0x48,0x0,0xe0,0x79,0x48,0xff,
+    0x11,0x68,0x88,0x42,0x0,0xdb,0x8,0x0,0xff,0x10,0x60,0x70,0x47,0x41,0x30,0x1,
+    0x70,0xff,0x42,0x70,0x70,0x47,0xf1,0xb5,0x88,0xb0,0xff,0xc,0x0,0x41,0x30,0x0,
+    0x78,0x0,0x28,0xff,0x6e,0xd0,0x0,0x20,0x3,0x90,0x3,0x23,0xff,0x4,0x22,0x6f,
+    0x49,0x3,0xa8,0x0,0x1d,0xff,0xe1,0xf7,0x7c,0xfa,0x18,0x21,0x20,0x69,0xff,0xe0,
+    0xf7,0x5,0xfe,0x4,0x90,0x18,0x21,0x5d,0x60,0x9,0x0,0x0,0xfe,0x5,0x9,0x0,
+    0xa0,0x9,0x0,0xff,0xfb,0xfd,0x6,0x90,0x60,0x68,0xe3,0xf7,0xff,0xb3,0xff,0x65,
+    0x49,0xe2,0xf7,0xe7,0xf8,0xff,0x3,0x90,0x8,0x98,0x81,0x6c,0xfe,0x20,0xff,0x80,
+    0x5,0xe1,0xf7,0x41,0xfe,0xfc,0x21,0xbf,0x89,0x5,0xe2,0xf7,0xdc,0xf8,0x2f,0x1,
+    0xac,0xff,0x24,0x1d,0x8,0x9d,0x10,0x35,0x3,0x26,0xfd,0x8,0x5,0x1,0x1,0x90,
+    0xa8,0x68,0x68,0x60,0xff,0x27,0x68,0xaf,0x60,0x29,0x68,0x8,0x98,0xff,0x80,0x6c,
+    0xe2,0xf7,0xca,0xf8,0x0,0x90,0xff,0x68,0x68,0x39,0x0,0xe1,0xf7,0x5e,0xfe,0xbf,
+    0x1,0x0,0x2,0x98,0xe2,0xf7,0xd3,0x0,0x99,0xef,0xe1,0xf7,0x1f,0xfe,0x19,0x1,
+    0x21,0xe1,0xf7,0xff,0xab,0xfe,0x2,0xd2,0x1,0x20,0x28,0x73,0xff,0xa8,0x73,0x28,
+    0x7b,0x0,0x28,0xa,0xd0,0xff,0x1,0x98,0x0,0x68,0x29,0x68,0xe1,0xf7,0xff,0x9f,
+    0xfe,0x4,0xd2,0x68,0x7b,0x40,0x1c,0x5b,0x68,0x73,0x43,0x1,0x73,0xa8,0x1b,0x8,
+    0x40,0x1b,0x4,0xd5,0x91,0x1b,0x0,0xe8,0x1b,0x0,0xe8,0x1b,0x0,0xa8,0x73,0xff,
+    0x10,0x35,0x24,0x1d,0x76,0x1e,0xc2,0xd1,0xfd,0x9,0x77,0x1,0x38,0xb5,0x4,0x0,
+    0xd,0x0,0xff,0x41,0x20,0x20,0x5c,0x0,0x28,0xd,0xd0,0xfe,0x41,0x3,0xa9,0xf8,
+    0x28,0x0,0xe3,0xf7,0x44,0xcb,0xff,0x33,0xc5,0x0,0x84,0x8b,0x0,0x57,0x7,0x15,
+    0xf8,0xff,0x31,0xbd,0x70,0xb5,0xc,0x0,0x5,0x0,0xff,0x40,0x35,0x0,0x26,0x69,
+    0x78,0x0,0x29,0xff,0x4,0xd1,0x26,0x60,0x4,0x20,0x20,0x71,0xff,0xa6,0x60,0x70,
+    0xbd,0x0,0xf0,0x5a,0xf8,0xff,0x26,0x60,0xa6,0x60,0x28,0x78,0x20,0x71,0xf7,0x70,
+    0xbd,0xf8,0x53,0x4,0x1d,0x48,0x29,0x68,0x7f,0xe2,0xf7,0x62,0xfb,0x6,0x0,0xfe,
+    0xfb,0x0,0xff,0xe1,0xf7,0x4f,0xfe,0x0,0xd2,0xe,0x0,0xf7,0x27,0x1d,0x43,0x6b,
+    0x0,0xe3,0xf7,0x20,0xff,0xff,0x31,0x0,0xe2,0xf7,0x54,0xf8,0xe3,0xf7,0xff,0x2b,
+    0xff,0x38,0x72,0x20,0x0,0x43,0x30,0x5f,0x40,0x78,0xe3,0xf7,0x15,0x15,0x4,0x49,
+    0x15,0x0,0x7f,0x20,0xff,0x78,0x72,0x28,0x68,0x13,0x83,0x0,0xff,0x5,0xfa,0x7,
+    0xd8,0x12,0x48,0x38,0x60,0xff,0x12,0x48,0x78,0x60,0x1,0x20,0x38,0x72,0xff,0xf,
+    0x20,0x78,0x72,0x10,0x4e,0x28,0x68,0x7d,0x31,0x21,0x1,0x95,0xfd,0x1,0x0,0x30,
+    0x31,0x0,0xff,0x2f,0xfb,0xa0,0x64,0xf1,0xbd,0x0,0x0,0xff,0xad,0x4a,0x3,0x0,
+    0xa,0xd7,0x23,0x3c,0xff,0x67,0x2b,0x0,0x0,0x9c,0xad,0x0,0x0,0xff,0x10,0x27,
+    0x0,0x0,0x40,0x9c,0x0,0x0,0xff,0x6b,0xca,0x0,0x0,0xbd,0x37,0x86,0x35,0xff,
+    0xb,0xd7,0xa3,0x3c,0x9a,0x99,0x19,0x3e,0xff,0xcd,0xcc,0xcc,0x3d,0xec,0x51,0xb8,
+    0x3d,0xff,0xf0,0xb4,0x0,0x22,0x1,0x0,0x1d,0x31,0xff,0x3,0x23,0x3,0x24,0xd,
+    0x78,0x6,0x7b,0xff,0xb5,0x42,0x0,0xd2,0x52,0x1c,0x10,0x31,0xff,0x64,0x1e,0xf7,
+    0xd1,0x1,0x0,0x1f,0x31,0xff,0x3,0x25,0x6,0x0,0xc,0x36,0x76,0x78,0xd7,0xf,
+    0x78,0xbe,0x19,0x0,0x64,0x19,0x0,0x6d,0x1e,0xfd,0xf5,0x19,0x0,0x40,0x31,0x8d,
+    0x78,0x0,0x2d,0xff,0x3,0xd0,0x24,0x6,0x1,0xd0,0x0,0x22,0xff,0x5,0xe0,0xd2,
+    0xb2,0x2,0x2a,0x1,0xdb,0xff,0x3,0x22,0x0,0xe0,0x4,0x22,0xa,0x70,0xff,0x1d,
+    0x30,0x0,0x21,0x1,0x70,0x81,0x70,0xff,0x10,0x30,0x5b,0x1e,0xfa,0xd1,0xf0,0xbc,
+    0xf7,0x70,0x47,0x10,0x11,0x1,0x30,0x21,0x10,0x30,0xff,0xdc,0xf7,0x24,0xfa,0x4,
+    0x20,0x40,0x21,0xff,0x60,0x54,0x19,0x21,0x20,0x68,0xe0,0xf7,0x7f,0xe1,0xfc,0xa0,
+    0x60,0x80,0x21,0xc9,0x1d,0x1,0xbf,0xcf,0xff,0x60,0x60,0x10,0xbd,0x29,0x0,0xb4,
+    0xff,0x3,0x0,0x10,0x39,0x0,0x2b,0x28,0xd0,0xff,0x20,0x29,0x6,0xdb,0x0,0x2b,
+    0x1,0xd4,0xff,0xb6,0x4b,0x23,0xe0,0x80,0x23,0x1b,0x6,0xff,0x20,0xe0,0x1e,0x20,
+    0xc0,0x43,0x81,0x42,0xff,0x1b,0xdb,0x1,0x29,0xe,0xdb,0x80,0x24,0xff,0x24,0x6,
+    0x20,0x0,0x8,0x41,0x83,0x42,0xff,0x1,0xda,0x23,0x0,0x12,0xe0,0xe0,0x43,0xff,
+    0x4,0x0,0xcc,0x40,0x9c,0x42,0x8,0xda,0xff,0x3,0x0,0xb,0xe0,0x0,0x29,0x9,
+    0xd5,0xff,0x48,0x42,0x20,0x28,0x3,0xdb,0xdb,0x17,0xff,0x4,0xe0,0x8b,0x40,0x2,
+    0xe0,0x3,0x41,0x7f,0x0,0xe0,0x0,0x23,0x13,0x60,0x10,0x8d,0x0,0xfe,0x9d,0x0,
+    0x60,0x81,0x60,0xc1,0x60,0x1,0x61,0xff,0x41,0x61,0x81,0x61,0xc1,0x61,0x2,0x0,
+    0xff,0x20,0x32,0x11,0x60,0x51,0x60,0x91,0x60,0x7d,0xc8,0x7,0x0,0x91,0x60,0x2,
+    0x0,0xf4,0xf,0x8,0x7f,0xd1,0x60,0x11,0x61,0x70,0x47,0x70,0xcf,0x5,0x7f,0x26,
+    0x0,0xf4,0x36,0x10,0x21,0xe8,0xb5,0x0,0x7f,0x86,0xfc,0xf0,0x60,0x10,0x21,0xa8,
+    0x9,0x0,0xd7,0x81,0xfc,0xb0,0x9,0x0,0x68,0x9,0x0,0x7c,0xfc,0x75,0x70,0x9,
+    0x0,0x28,0x9,0x0,0x77,0xfc,0x30,0x9,0x2,0xff,0x69,0xe0,0xf7,0x72,0xfc,0x30,
+    0x61,0x20,0xdf,0x0,0x0,0xf0,0xe6,0xf9,0x5,0x2,0x45,0xf9,0xdf,0x0,0x20,0x70,
+    0xbd,0x38,0x4b,0x0,0x27,0x20,0xff,0x22,0x0,0x10,0x21,0xff,0xf7,0x89,0xff,0xbf,
+    0x80,0x20,0x0,0x2,0x22,0x1d,0xb,0x2,0x83,0xff,0xff,0x80,0x25,0xed,0x1,0x28,
+    0x0,0x22,0xb7,0x0,0x8,0x32,0xf,0x2,0x7b,0xff,0xb,0x2,0xc,0x7e,0xb,0x4,
+    0x75,0xff,0x8f,0x48,0x10,0x34,0x33,0x6,0xeb,0x6f,0xff,0xac,0x0,0xbd,0x4f,0x3,
+    0x20,0x79,0x0,0xd7,0x28,0x5,0xd0,0x59,0x2,0xb6,0x5f,0x4,0x15,0xf9,0x3f,0x10,
+    0xbd,0xf8,0xb5,0xac,0xb0,0xab,0x2,0x1b,0x2,0xff,0x0,0xd1,0xcd,0xe0,0x10,0x0,
+    0xe3,0xf7,0xff,0xeb,0xfd,0x81,0x49,0xe1,0xf7,0x1f,0xff,0xff,0x0,0x90,0x14,0x21,
+    0x28,0x0,0xe0,0xf7,0xf7,0x27,0xfc,0x6,0x1c,0x0,0xe3,0xf7,0xd3,0xfd,0xdd,0x7c,
+    0x17,0x0,0x13,0xff,0x7b,0x5,0x0,0x71,0xfc,0xff,0xa0,0x62,0xe4,0x20,0x20,0x58,
+    0x0,0x28,0xdf,0x1,0xd1,0x0,0x98,0x20,0xb,0x4,0x28,0x28,0xff,0x1a,0xda,0x0,
+    0x98,0x21,0x68,0xe1,0xf7,0x7f,0x9a,0xfc,0x0,0x99,0x21,0x60,0xc0,0x27,0x0,0xbf,
+    0xed,0xfc,0x0,0xd2,0xa2,0xe0,0x1d,0x2,0x80,0xff,0x0,0x20,0x18,0x46,0x64,0x0,
+    0x96,0x69,0xed,0x46,0x7b,0x2,0xe5,0xf8,0x13,0x2,0x40,0x1c,0xe4,0xff,0x34,0x20,
+    0x60,0x92,0xe0,0x0,0x21,0x26,0xff,0x0,0x44,0x36,0x28,0x25,0x28,0x27,0x30,0xfe,
+    0x3d,0x0,0x43,0xfc,0x1,0x0,0x36,0x1d,0x7f,0xff,0x1e,0xf8,0xd1,0xbe,0x4e,0x31,
+    0x0,0xe2,0xff,0xf7,0xd9,0xf9,0x1,0x90,0x3,0xa8,0x21,0xff,0x0,0x44,0x31,0xa0,
+    0x22,0xdc,0xf7,0x40,0xbe,0x15,0x1,0x3,0xaf,0x1,0x0,0x38,0x29,0x0,0x2e,0xcf,
+    0xfc,0x3f,0x1d,0x6d,0x27,0x0,0x25,0x2,0xc6,0xf9,0xff,0x2,0x90,0x0,0x26,0x3,
+    0xaf,0x38,0x68,0xff,0x2,0x99,0xe1,0xf7,0x59,0xfc,0x38,0x60,0xff,0x76,0x1c,0x3f,
+    0x1d,0x28,0x2e,0xf6,0xdb,0x7f,0x1,0x98,0x21,0x0,0xe4,0x31,0x49,0x2f,0x0,0xdb,
+    0x4e,0xfc,0xb,0x6,0x48,0x60,0xa7,0x0,0x6a,0xe1,0xff,0xf7,0x46,0xfc,0x7,0x0,
+    0x2c,0xa8,0x0,0xbf,0x78,0x7,0x28,0x1,0xd0,0x8,0xc9,0x0,0x1,0xfd,0x26,0xf3,
+    0x1,0x26,0x0,0x23,0x22,0x0,0x3c,0xff,0x32,0x21,0x0,0x2c,0x31,0x4,0xa8,0x2,
+    0xff,0xf0,0x92,0xfc,0x5,0x98,0x0,0x90,0x4,0xfd,0x98,0x5d,0x0,0x98,0x1,0x90,
+    0x2,0xab,0x1,0xff,0xaa,0x21,0x0,0x3,0xa8,0x0,0xf0,0xb8,0xdf,0xf8,0x0,0x20,
+    0xc0,0x43,0x4d,0x2,0x88,0x60,0xdf,0xa2,0x68,0x10,0x0,0x0,0x75,0x0,0x76,0xfc,
+    0xef,0x1,0xd2,0x1,0x20,0x43,0x0,0x20,0x30,0x42,0xff,0xc,0xd1,0x8,0x46,0x80,
+    0x21,0x9,0x6,0x7f,0x4a,0x40,0x11,0x0,0xe1,0xf7,0x69,0x19,0x10,0xfd,0x2,0x83,
+    0x1,0xe4,0x30,0x85,0x60,0x3,0x97,0x7e,0x7,0x2,0x80,0x68,0xc3,0x43,0xdb,0xf,
+    0x9,0x2,0x77,0xc0,0x68,0x2,0xe7,0x0,0x0,0x90,0x2,0x61,0x0,0x6d,0x1,0x61,
+    0x0,0xa8,0xf8,0xad,0x6,0xc8,0x60,0x31,0x3,0xff,0xdc,0xf8,0x2d,0xb0,0xf0,0xbd,
+    0xff,0xff,0xff,0xff,0x7f,0x10,0xb5,0x84,0xb0,0xc,0x0,0xff,0x1,0x1d,0xa,0x78,
+    0x0,0x2a,0xa,0xd1,0xbf,0x68,0x46,0x0,0xf0,0xfa,0xf8,0x83,0x1,0x60,0xff,0x1,
+    0x98,0x60,0x60,0x2,0x98,0xa0,0x60,0xff,0x3,0x98,0x7,0xe0,0xca,0x69,0x22,0x60,
+    0xff,0xec,0x30,0x2,0x68,0x62,0x60,0x49,0x6a,0xff,0xa1,0x60,0x40,0x68,0xe0,0x60,
+    0x4,0xb0,0xff,0x10,0xbd,0x38,0xb5,0xc,0x0,0x11,0x0,0xfe,0xb3,0x1,0xd0,0x68,
+    0x4a,0x0,0xe0,0x68,0x4a,0xff,0x1d,0x68,0xaa,0x42,0x0,0xdb,0x2a,0x0,0xff,0x1a,
+    0x60,0x0,0x2c,0x2,0xd0,0x0,0xf0,0x7f,0xa9,0xfc,0x31,0xbd,0xe5,0xf7,0x94,0x5,
+    0x0,0xff,0x5c,0xf,0x0,0x0,0xbd,0x37,0x86,0x35,0xff,0xce,0xaa,0x6,0xc1,0x0,
+    0x4a,0x5,0x46,0xdf,0x1,0x0,0x8,0x31,0xf4,0x4f,0x0,0xa,0x60,0xff,0x42,0x68,
+    0x4a,0x60,0xc2,0x68,0x8a,0x60,0xff,0x82,0x68,0xca,0x60,0x0,0x69,0x8,0x61,0xff,
+    0x70,0x47,0xf8,0xb5,0x7,0x0,0xc,0x0,0xff,0xe4,0x20,0x3d,0x58,0x6d,0x1c,0x28,
+    0x0,0xff,0xe3,0xf7,0xbf,0xfc,0x6,0x0,0xfe,0x62,0xff,0x38,0x0,0x30,0x30,0x0,
+    0x90,0x0,0x68,0xfd,0x31,0xfd,0x0,0x5a,0xfb,0x0,0x99,0x8,0x60,0x7f,0x38,0x6b,
+    0x78,0x63,0x38,0x0,0x38,0x15,0x0,0xff,0x28,0x0,0x68,0x43,0xe3,0xf7,0xab,0xfc,
+    0xd7,0x0,0x99,0x9,0x95,0x1,0x4b,0x1d,0x4,0x3d,0x0,0xdf,0x3c,0x35,0x29,0x68,
+    0x20,0xff,0x3,0xfb,0x28,0xdf,0x60,0x20,0x68,0x40,0x37,0x39,0x2,0xdc,0xfd,0xfd,
+    0x39,0x11,0x0,0x3a,0xfb,0x38,0x60,0xf1,0xbd,0xff,0xfe,0xb5,0x4,0x0,0x0,0x20,
+    0x20,0x60,0xff,0x44,0x31,0xd,0x0,0x28,0x26,0x2f,0x68,0xdf,0x1,0x98,0x0,0x68,
+    0x39,0x23,0x0,0xca,0xfd,0xf7,0x1,0x0,0x2,0xb,0x0,0xe1,0xf7,0x26,0xfb,0xee,
+    0xf,0x2,0x5b,0xfb,0x1,0x5,0x0,0xbf,0xfd,0x21,0xfe,0x11,0x0,0x1d,0xfb,0x20,
+    0x60,0x2d,0x1d,0x76,0xef,0x1e,0xe7,0xd1,0x3,0x3d,0x1,0xf8,0xb5,0x5,0x7f,0x0,
+    0x1e,0x0,0x17,0x68,0x2b,0x48,0x27,0x2,0xff,0xae,0xfd,0x4,0x0,0xfe,0x20,0x80,
+    0x5,0xfa,0xb,0x2,0x41,0x33,0x0,0x26,0x48,0xe1,0xf7,0xa4,0xfb,0xfd,0x21,0xd,
+    0x0,0x2,0xfb,0x4,0x0,0x2f,0xf9,0x60,0x1b,0x2,0xd,0x2,0x33,0xfb,0x7,0x0,
+    0x0,0x5f,0x2e,0x6,0xd0,0x1f,0x48,0xd,0x2,0x93,0x35,0x0,0x5f,0x1e,0x48,0x5,
+    0xe0,0x1e,0xd,0x4,0x8c,0xd,0x0,0xf5,0x1c,0x4d,0x4,0x87,0x39,0x4,0xe5,0xfa,
+    0x1,0x0,0x7f,0x20,0x0,0xe2,0xf7,0x7f,0xf8,0x28,0xb1,0x0,0xff,0x0,0x0,0x2,
+    0x2b,0x7,0x3d,0x70,0xb4,0xff,0x0,0x21,0xe4,0x22,0x81,0x50,0x2,0x0,0xff,0x2c,
+    0x32,0x0,0x23,0x2,0x25,0x14,0x0,0xdf,0x2,0x26,0x23,0x60,0x24,0x95,0x0,0xfb,
+    0xd1,0xff,0x49,0x1c,0x8,0x32,0x2,0x29,0xf5,0xdb,0x7f,0x3c,0x30,0x3,0x60,0x0,
+    0x1d,0x6d,0x11,0x0,0xdf,0x70,0xbc,0x70,0x47,0x0,0x0,0x0,0x20,0x42,0xff,0x7,
+    0xb2,0x1,0x0,0xa0,0x86,0x1,0x0,0xff,0xa4,0x70,0x7d,0x3f,0xa,0xd7,0x23,0x3c,
+    0xff,0x66,0x66,0x66,0x3f,0x8f,0xc2,0xf5,0x3c,0xff,0xd0,0xcc,0xcc,0x3d,0xec,0x51,
+    0x78,0x3f,0xff,0x0,0x21,0x1,0x60,0x81,0x60,0xc1,0x60,0xef,0xc9,0x43,0x41,0x60,
+    0x33,0x2,0x10,0xb4,0xa6,0xff,0x48,0x82,0x21,0x49,0x0,0x41,0x18,0xa5,0xff,0x4a,
+    0xca,0x67,0xc2,0x22,0x52,0x0,0x82,0xff,0x18,0xa3,0x4b,0x13,0x60,0xa3,0x4b,0x53,
+    0x6a,0x3,0x0,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,0x61,0xf,0x0,0x6a,0x3,0x0,
+    0x93,0x3,0x0,0xd3,0x3,0x0,0x13,0x62,0xf,0x0,0x6a,0x3,0x0,0x93,0x3,0x0,
+    0xd3,0x3,0x0,0x13,0x63,0xf,0x0,0x6a,0x3,0x0,0x93,0x3,0x0,0xd3,0x3,0x0,
+    0x13,0x64,0xf,0x0,0x6a,0x3,0x0,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,0x65,0xf,
+    0x0,0x6a,0x3,0x0,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,0x66,0xf,0x0,0x6a,0x3,
+    0x0,0x93,0x3,0x0,0xd3,0x3,0x0,0x13,0x67,0xf,0x0,0xfa,0x3,0x0,0x93,0x3,
+    0x0,0xd3,0x67,0x81,0x22,0x92,0xaa,0x85,0x0,0xa2,0x85,0x0,0xa2,0x85,0x0,0xa2,
+    0x85,0x0,0xa2,0xa4,0x85,0x0,0xf,0x0,0x61,0xf,0x0,0x3,0x0,0x93,0x3,0x0,
+    0xd3,0xff,0x61,0x0,0x23,0x13,0x62,0xa1,0x4c,0x54,0x6a,0x3,0x0,0x94,0x3,0x0,
+    0xd4,0x3,0x0,0x14,0x63,0xf,0x0,0xfe,0x3,0x0,0x94,0x63,0xa1,0x4a,0x2,0x60,
+    0xa1,0xab,0x4a,0x42,0x3,0x0,0x82,0x3,0x0,0xc2,0x3,0x0,0x2,0xa9,0x61,0xf,
+    0x0,0x3,0x0,0x82,0x3,0x0,0xc2,0x3,0x0,0x2,0xa9,0x62,0xf,0x0,0x3,0x0,
+    0x82,0x3,0x0,0xc2,0x3,0x0,0x2,0xea,0x33,0x0,0x42,0x3,0x0,0x82,0x3,0x0,
+    0xc2,0x63,0xc1,0xbf,0x4a,0x2,0x64,0xc1,0x4a,0x42,0x3,0x0,0x82,0xfa,0x3,0x0,
+    0xc2,0x3,0x0,0x2,0x65,0x9c,0x4a,0x42,0x6a,0x3,0x0,0x82,0x3,0x0,0xc2,0x3,
+    0x0,0x2,0x66,0xf,0x0,0x6a,0x3,0x0,0x82,0x3,0x0,0xc2,0x3,0x0,0x2,0x67,
+    0xf,0x0,0xea,0x3,0x0,0x82,0x3,0x0,0xc2,0x3,0x0,0x80,0x24,0x2,0xaf,0x51,
+    0x84,0x30,0x9b,0x87,0x0,0xb3,0x87,0x0,0xb3,0x8a,0x87,0x0,0xb3,0x87,0x0,0xb3,
+    0x87,0x0,0xf,0x0,0x3,0x0,0x82,0x9a,0x3,0x0,0xc2,0x3,0x0,0x2,0x62,0xf,
+    0x0,0x3,0x0,0x82,0x9a,0x3,0x0,0xc2,0x3,0x0,0x2,0x63,0xf,0x0,0x3,0x0,
+    0x82,0xab,0x63,0x8d,0x87,0x0,0x8d,0x87,0x0,0x8d,0x87,0x0,0x8d,0xac,0x87,0x0,
+    0xf,0x0,0x64,0xae,0x87,0x0,0xae,0x87,0x0,0xae,0x92,0x87,0x0,0xae,0x87,0x0,
+    0xf,0x0,0x66,0xf,0x0,0x3,0x0,0x82,0x9a,0x3,0x0,0xc2,0x3,0x0,0x2,0x67,
+    0xf,0x0,0x3,0x0,0x82,0xfe,0x3,0x0,0xc2,0x67,0xae,0x48,0x8,0x60,0xae,0xbf,
+    0x48,0x48,0x60,0xc6,0x48,0x88,0x3,0x0,0xc8,0xbe,0x3,0x0,0x8,0x61,0xc6,0x48,
+    0x48,0x3,0x0,0x88,0x9a,0x3,0x0,0xc8,0x3,0x0,0x8,0x62,0xf,0x0,0x3,0x0,
+    0x88,0xef,0x62,0x76,0x48,0xc8,0x3,0x0,0x8,0x63,0x76,0xfb,0x48,0x48,0x3,0x0,
+    0x88,0x63,0xcb,0x63,0xa0,0xff,0x48,0x8,0x64,0x4b,0x64,0xa0,0x48,0x88,0xfa,0x3,
+    0x0,0xc8,0x3,0x0,0x8,0x65,0xa0,0x48,0x48,0xea,0x3,0x0,0x88,0x3,0x0,0xc8,
+    0x3,0x0,0x8,0x66,0xb9,0xab,0x48,0x48,0x3,0x0,0x88,0x3,0x0,0xc8,0x3,0x0,
+    0x8,0xe9,0x67,0xf,0x0,0x3,0x0,0x88,0x3,0x0,0xb9,0x49,0x1,0xaf,0x60,0xb9,
+    0x49,0x41,0x3,0x0,0x81,0x3,0x0,0xc1,0xa6,0x3,0x0,0x1,0x61,0xf,0x0,0x3,
+    0x0,0x81,0x3,0x0,0xc1,0xa6,0x3,0x0,0x1,0x62,0xf,0x0,0x3,0x0,0x81,0x3,
+    0x0,0xc1,0xa6,0x3,0x0,0x1,0x63,0xf,0x0,0x3,0x0,0x81,0x3,0x0,0xc1,0xff,
+    0x63,0x10,0xbc,0x70,0x47,0xfc,0x37,0x0,0xff,0x20,0x44,0x88,0x2c,0x41,0x15,0xab,
+    0xbe,0xff,0x3d,0xd2,0xa4,0x9,0x41,0xf4,0x1e,0xc4,0xff,0x40,0xbc,0x3f,0x94,0x3d,
+    0x89,0x88,0xf8,0xff,0x40,0x4d,0xfb,0x8c,0x40,0x4a,0x23,0xc1,0xff,0x3d,0x9c,0x41,
+    0xeb,0x40,0xca,0x28,0xa0,0xff,0x40,0xfc,0xbf,0x6f,0x3d,0x24,0xa8,0xe9,0xff,0x40,
+    0x46,0x79,0x87,0x3f,0xed,0x6,0xd9,0xff,0x3c,0x45,0xb2,0xa3,0x40,0x45,0x3e,0xf9,
+    0xff,0x3f,0x54,0xed,0x2d,0x3d,0x95,0x35,0xc5,0xff,0x40,0x9a,0xc7,0x86,0x3f,0x4,
+    0x67,0xdc,0xff,0x3c,0x0,0x0,0xce,0x40,0x1,0xed,0x44,0xff,0x3e,0xb7,0x8e,0xf9,
+    0x3c,0xab,0xaa,0xa8,0xff,0x40,0x30,0x6b,0x0,0x3f,0x7f,0xac,0xba,0xff,0x3c,0xf9,
+    0x10,0xa4,0x40,0x8e,0x21,0xed,0xff,0x3f,0xca,0xe1,0x13,0x3d,0x78,0xa3,0xa9,0xff,
+    0x40,0x8a,0x64,0x52,0x40,0x6d,0x23,0x49,0xff,0x3d,0x4a,0x93,0xc6,0x40,0x3c,0xb8,
+    0x92,0xff,0x3d,0x4a,0xbc,0x74,0x3c,0x14,0xc9,0x7d,0xff,0x40,0x35,0x55,0x2,0x3d,
+    0x33,0x40,0x75,0xff,0x3b,0x55,0x55,0x15,0x3f,0xa0,0xeb,0x6e,0xff,0x3d,0x2e,0x5c,
+    0x10,0x3a,0x96,0xa4,0x1e,0xff,0x3d,0xb5,0x62,0xac,0x3b,0xe6,0x28,0x5d,0xff,0x3f,
+    0x8f,0xd5,0x89,0x3d,0x14,0xee,0x91,0xff,0x3b,0xf4,0x3c,0x4f,0x3f,0x24,0xb5,0x90,
+    0xff,0x3d,0xb1,0x7e,0x8f,0xc0,0xc0,0x5d,0x94,0xff,0x3c,0x8c,0xba,0xf,0x45,0xa8,
+    0xbb,0x44,0xff,0x41,0x8b,0x35,0x57,0x3f,0xa8,0x9d,0xb0,0xff,0x3e,0x28,0xaa,0x13,
+    0x42,0x30,0xfd,0xd7,0xff,0xbe,0x6a,0xb4,0x6f,0x46,0x0,0xcc,0x84,0xff,0xc2,0xb4,
+    0xdc,0x93,0x3f,0xd5,0xb2,0xa,0xff,0x40,0xf0,0xad,0xd5,0xc2,0x75,0x67,0xb3,0xff,
+    0xbf,0xc7,0xcf,0xe0,0x45,0x9b,0xdc,0xed,0xff,0x46,0xb4,0x51,0x25,0x43,0x45,0x80,
+    0x3,0xff,0x40,0x42,0x14,0x60,0x3f,0x30,0xb2,0x83,0xff,0xc2,0x93,0xef,0x3e,0x3e,
+    0x45,0x3c,0xbe,0xff,0x46,0xd5,0x25,0x9b,0xc2,0xd4,0xc9,0x82,0xff,0x3f,0x73,0x8e,
+    0xca,0x40,0x2c,0x12,0xdd,0xff,0xc3,0x2f,0x9a,0xf2,0xbe,0x88,0x22,0x1e,0xff,0x47,
+    0xcf,0x3d,0x52,0x41,0x37,0x80,0x16,0xff,0xc4,0x30,0x9d,0x34,0x40,0x98,0x53,0x7f,
+    0xff,0x47,0xfa,0x4c,0x56,0xc3,0x1,0x5d,0x7,0xff,0xc4,0x61,0xc3,0x5e,0x40,0xf6,
+    0x6,0x1c,0xbf,0x46,0x72,0xae,0xbc,0xc5,0xbf,0x9b,0x1,0x1,0xff,0x0,0x10,0x31,
+    0x1,0x22,0xa,0x60,0x0,0x7b,0x23,0x4b,0xb,0x0,0x28,0x31,0xa,0x60,0x7,0x2,
+    0xf7,0xe4,0x31,0xb,0x7,0x0,0x8b,0x60,0xcb,0x60,0xff,0x70,0x47,0x0,0x0,0x15,
+    0x6f,0xc3,0x42,0xff,0xe1,0x69,0x59,0x40,0x83,0x9f,0xaa,0x3e,0xff,0x19,0xdd,0x84,
+    0xc0,0x3a,0xe3,0x7b,0x3e,0xff,0xad,0x2c,0x30,0x42,0xe6,0x3a,0xdd,0x3f,0xff,0x39,
+    0x4,0xf4,0x41,0xdf,0x7f,0xaf,0xc4,0xff,0x90,0xd8,0x6,0xbf,0x89,0x61,0xc8,0x47,
+    0xff,0x73,0xb8,0x4d,0xc3,0xe9,0x9f,0x65,0x40,0xff,0x25,0x40,0xf1,0x42,0xad,0xde,
+    0x1,0xc4,0xff,0x29,0x48,0x1,0x41,0x16,0xca,0x47,0x48,0xff,0xc2,0x92,0x7b,0xc3,
+    0xe2,0x1b,0xb4,0x40,0xff,0x77,0x53,0x7f,0x40,0xc8,0x3f,0x1a,0x3f,0xff,0x7c,0x62,
+    0xd3,0xc1,0xa3,0x9c,0x29,0x3f,0xff,0xe6,0xb7,0x88,0x46,0x7a,0xac,0x50,0xc2,0xff,
+    0x79,0x1,0xc7,0x3f,0xbb,0x15,0x29,0x40,0xff,0xe4,0x24,0x24,0x43,0x2d,0xa9,0x50,
+    0xbf,0xff,0x4e,0xf7,0x13,0x47,0x2a,0x6e,0x9f,0xc1,0xff,0x4e,0xb3,0x7a,0x40,0xce,
+    0xae,0x33,0x43,0xff,0x58,0x70,0x6a,0x49,0x30,0xb9,0x71,0x49,0xff,0x80,0x88,0x28,
+    0x43,0xd9,0x2e,0x66,0xc3,0xff,0x20,0xf5,0xaf,0xc0,0x81,0xf0,0x95,0x47,0xff,0x7f,
+    0xbb,0x80,0xc3,0x49,0x71,0xd9,0x3f,0xff,0x38,0xb5,0x5,0x0,0xc,0x0,0x0,0xf0,
+    0xff,0x32,0xfb,0xff,0x20,0xce,0x30,0x28,0x18,0xff,0x0,0x21,0x81,0x70,0x4,0x21,
+    0x41,0x70,0xff,0xc,0x21,0xc1,0x70,0x10,0x21,0x1,0x70,0xff,0xea,0x20,0x40,0x0,
+    0x28,0x18,0xb1,0x49,0xff,0xc0,0x22,0x52,0x0,0x8a,0x18,0x2,0x60,0xff,0x41,0x60,
+    0x12,0x49,0x81,0x60,0x60,0x68,0xff,0x28,0x73,0x0,0x20,0x32,0xbd,0x0,0x0,0xff,
+    0xf1,0xa,0x3e,0xc4,0x3,0x9e,0x10,0x40,0xff,0xa3,0xde,0xa2,0x47,0x0,0xa0,0x4a,
+    0xc3,0xff,0x15,0xc1,0x31,0x40,0x62,0xd,0x7c,0x43,0xff,0xa9,0xae,0x9d,0xc5,0x99,
+    0x89,0x79,0xc0,0xff,0xd5,0x20,0x8e,0x48,0x85,0xe6,0xab,0x42,0xff,0x67,0x87,0x59,
+    0xc5,0x88,0xeb,0x82,0x40,0xff,0xed,0x46,0x45,0x48,0x1,0x92,0xd1,0xc3,0xff,0xaa,
+    0x6b,0xfa,0x3f,0x38,0x46,0x0,0x20,0xff,0x8b,0x5,0xd9,0xbe,0xe2,0x11,0x90,0x3f,
+    0xff,0xe2,0x1f,0xe3,0x3f,0x34,0x78,0xe9,0x3f,0xff,0x66,0xf,0xfe,0x3f,0xa6,0xa4,
+    0x40,0x40,0xff,0x41,0xb1,0x93,0x40,0x89,0x3a,0xd1,0x40,0xff,0x8b,0x32,0x8c,0x40,
+    0x5a,0xcb,0xdc,0x3f,0xff,0x8,0x3c,0x5f,0x40,0x3c,0xba,0xbc,0x40,0xff,0x6b,0x22,
+    0xc8,0x40,0xb,0x2d,0x7a,0x41,0xff,0xcf,0x94,0xa5,0x40,0x99,0xdf,0x99,0x40,0xff,
+    0x1,0x71,0x70,0x47,0xf2,0xb5,0x86,0xb0,0xff,0x4,0x0,0x0,0x25,0x20,0x79,0x0,
+    0x28,0xff,0xa,0xd1,0x4,0x20,0x8,0x70,0x6,0x99,0xf5,0x4d,0x3,0x0,0x8d,0x3,
+    0x0,0xcd,0x70,0x6,0x98,0xff,0x5,0x71,0xa3,0xe0,0x20,0x0,0x10,0x30,0xff,0x0,
+    0x21,0x1,0xaa,0x3,0x0,0x8,0x33,0xff,0x4,0xe0,0x1e,0x68,0x16,0x60,0x49,0x1c,
+    0xff,0x1b,0x1d,0x12,0x1d,0x6,0x68,0xb1,0x42,0xff,0xf7,0xd3,0x40,0x20,0x20,0x5c,
+    0x80,0x0,0xff,0x20,0x18,0x1,0x99,0x41,0x64,0x20,0x0,0xff,0x28,0x30,0x2,0x90,
+    0x0,0x95,0x1,0xae,0xff,0x2,0x9f,0x10,0x37,0x9,0xe0,0x78,0x68,0xff,0x39,0x68,
+    0xe0,0xf7,0xeb,0xff,0x30,0x60,0xff,0x0,0x98,0x40,0x1c,0x0,0x90,0x3f,0x1d,0xff,
+    0x36,0x1d,0x0,0x98,0x2,0x99,0x9,0x68,0xf7,0x88,0x42,0xf0,0x39,0xc,0xbc,0x30,
+    0x1,0x99,0xfb,0x1,0x60,0xd,0x6,0x26,0x18,0x94,0x36,0xa0,0xff,0x7b,0xe3,0xf7,
+    0x1,0xf9,0x30,0x60,0x20,0xff,0x7b,0x40,0x21,0x61,0x5c,0x4a,0x1c,0x82,0xff,0x42,
+    0x1,0xd1,0x0,0x21,0x0,0xe0,0x49,0xff,0x1c,0x40,0x22,0xa1,0x54,0xe3,0xf7,0xf3,
+    0xff,0xf8,0x0,0x90,0x0,0x20,0x26,0x0,0x44,0xef,0x36,0xa,0x27,0x31,0x5f,0x0,
+    0x83,0xff,0x36,0xff,0x1d,0x7f,0x1e,0xf9,0xd1,0x0,0x99,0xe1,0xff,0xf7,0x1b,0xfd,
+    0x56,0x49,0xe0,0xf7,0x7a,0x5f,0xff,0xe4,0x21,0x60,0x50,0x23,0x2,0xbc,0x23,0x8,
+    0xfd,0x71,0x23,0x10,0x9,0xfd,0x21,0x0,0xe4,0x31,0x2b,0xc8,0x60,0x1f,0x2,0x94,
+    0x1f,0x8,0x61,0x1f,0x8,0x19,0x2,0xff,0x88,0x60,0x20,0x0,0xf4,0x30,0xe4,0x21,
+    0xef,0x61,0x58,0x1,0x60,0xf,0x2,0xc9,0x68,0x41,0xfe,0x7,0x4,0x89,0x68,0x81,
+    0x60,0x3,0x23,0x4,0xff,0x22,0x3e,0x49,0x3,0xa8,0xe0,0xf7,0x67,0xff,0xfb,0xe4,
+    0x20,0x20,0x58,0x3,0x90,0x20,0xbf,0x0,0xe4,0x30,0xc0,0x68,0x4,0x7,0x4,0x80,
+    0x7b,0x68,0x5,0x7,0x0,0x0,0xf0,0x72,0xf8,0x5,0x2,0xef,0x84,0xf9,0x6,0x99,
+    0x7,0x2,0xe5,0xf9,0xa5,0xff,0x73,0x65,0x61,0xe5,0x62,0x7,0xb0,0xf0,0xff,0xbd,
+    0x4,0x4a,0x3,0x0,0xf0,0xb5,0x85,0xf6,0x73,0x1,0xd,0x0,0x73,0x3,0x24,0xd0,
+    0x18,0x21,0xff,0x28,0x69,0xdf,0xf7,0xcd,0xfe,0x1,0x90,0x77,0x18,0x21,0x68,0x9,
+    0x0,0xc8,0xfe,0x2,0x9,0x0,0xfd,0xa8,0x9,0x0,0xc3,0xfe,0x3,0x90,0x0,0x25,
+    0xff,0x1,0xae,0x3,0x27,0x30,0x68,0x1,0x0,0xff,0xe1,0xf7,0xae,0xf9,0x29,0x0,
+    0xe0,0xf7,0xef,0xc,0xff,0x5,0x0,0xab,0x2,0xf4,0xd1,0xe1,0xff,0xf7,0x72,0xf9,
+    0x0,0x90,0x69,0x46,0x10,0xff,0x34,0x20,0x0,0xe5,0xf7,0x35,0xfa,0x5,0xfe,0x5f,
+    0x0,0x1c,0xb5,0x4,0x0,0x8,0x0,0x21,0xff,0x79,0x0,0x29,0x10,0xd0,0xa1,0x7b,
+    0x2,0xdf,0x7b,0x89,0x18,0xa1,0x73,0x3b,0x1,0x91,0x1e,0xfb,0x21,0x0,0x51,0x0,
+    0x9a,0xfe,0x0,0x90,0x1,0xef,0x90,0x1,0xa9,0x28,0x31,0x4,0x1c,0xfa,0x13,0xff,
+    0xbd,0x2,0x79,0x0,0x2a,0x0,0xd1,0x70,0xff,0x47,0x80,0xb5,0x81,0x60,0x0,0xf0,
+    0xcd,0xff,0xf9,0x1,0xbd,0x0,0x28,0x1,0xd0,0x7,0xff,0x48,0x0,0xe0,0x7,0x48,
+    0xa,0x68,0x90,0xff,0x42,0x0,0xdb,0x10,0x0,0x8,0x60,0x70,0xff,0x47,0xfc,0x37,
+    0x0,0x20,0xcd,0xcc,0x1c,0xff,0xc1,0x6b,0xca,0x0,0x0,0x9c,0xad,0x0,0xff,0x0,
+    0x40,0x9c,0x0,0x0,0xf1,0xb5,0xae,0xff,0xb0,0x0,0x20,0x8,0x90,0x2e,0x98,0xa6,
+    0xff,0x21,0x49,0x0,0x40,0x18,0x7,0x90,0x6,0xfe,0xb,0x0,0x88,0x31,0x40,0x18,
+    0x5,0x90,0x0,0xbe,0x11,0x1,0x5,0x98,0x40,0x68,0x3,0x11,0x0,0xc9,0xff,0x1f,
+    0x40,0x18,0x2,0x90,0x80,0xe0,0xc,0xff,0xa8,0x2e,0x99,0xf4,0x31,0x3,0x22,0xb,
+    0xff,0x68,0x3,0x60,0x9,0x1d,0x0,0x1d,0x52,0xde,0x6f,0x1,0x9,0xa8,0xc,0xa9,
+    0x11,0x16,0x0,0x24,0xbf,0x9,0xad,0x4,0x9e,0x28,0x68,0x95,0x3,0xce,0xff,0xfe,
+    0x28,0x60,0x64,0x1c,0x36,0x1d,0x2d,0xff,0x1d,0x3,0x2c,0xf5,0xdb,0xf,0xa8,0x9,
+    0xff,0xa9,0x1c,0xc9,0x1c,0xc0,0x0,0x20,0x0,0xff,0x21,0x15,0xaa,0x0,0x92,0x3,
+    0x9b,0x84,0xff,0x0,0x1b,0x19,0x8c,0x0,0x14,0x19,0x0,0xff,0x9d,0x4e,0x0,0x76,
+    0x18,0xb6,0x0,0xad,0xff,0x19,0x3,0x26,0x76,0x1a,0x1f,0x68,0x2f,0xff,0x60,0x1f,
+    0x68,0x27,0x60,0x40,0x1c,0xc,0xff,0x35,0x24,0x1d,0x1b,0x1d,0x76,0x1e,0xf5,0xff,
+    0xd1,0x49,0x1c,0xc,0x32,0x0,0x9b,0x1b,0xff,0x1d,0x0,0x93,0x3,0x29,0xe2,0xdb,
+    0x15,0xff,0xac,0x12,0xa8,0x0,0x90,0x3,0x20,0x1,0xfa,0x5f,0x1,0xf,0x5f,0x1,
+    0x21,0x68,0x30,0x68,0xe1,0xf7,0xf7,0xfe,0xf8,0x5f,0x3,0x5c,0xfe,0x5,0x0,0xfb,
+    0xc,0x34,0x61,0x3,0xf3,0xd1,0x0,0x98,0x5,0xff,0x60,0x0,0x98,0x0,0x1d,0x0,
+    0x90,0x20,0xff,0x3c,0x1,0x98,0x40,0x1e,0x1,0x90,0xe6,0xae,0x9f,0x0,0xf,0xad,
+    0x12,0x33,0x0,0x29,0x33,0x4,0xe4,0xbb,0xf8,0x21,0x33,0x0,0x42,0xfe,0x4,0x93,
+    0x1,0x2d,0xfe,0x33,0x4,0x6,0x98,0x4,0x60,0x8,0x98,0x40,0xff,0x1c,0x8,0x90,
+    0x3,0x98,0x18,0x30,0x3,0xff,0x90,0x4,0x98,0xc,0x30,0x4,0x90,0x6,0xfe,0x45,
+    0x0,0x6,0x90,0x8,0x98,0x2,0x99,0x9,0xff,0x78,0x88,0x42,0x0,0xda,0x78,0xe7,
+    0x0,0xef,0x24,0x2e,0x98,0xc6,0x37,0x1,0x45,0x18,0x7,0xed,0x9e,0x49,0x2,0x8c,
+    0xf8,0xeb,0xa,0x10,0x2c,0xf6,0xff,0xdb,0x1e,0xa8,0x7,0x99,0x40,0x22,0xdb,0xff,
+    0xf7,0x21,0xfb,0x0,0x24,0x1e,0xad,0xbf,0xf7,0x26,0x36,0x6,0x11,0x1,0x0,0xe1,
+    0xf7,0xac,0x78,0x25,0x4,0x23,0x6,0x19,0x2,0x5,0x98,0x86,0x68,0x2b,0x7,0xf5,
+    0x0,0x2b,0xd,0x10,0x2b,0x1,0xcf,0x24,0x24,0x6,0xff,0x2,0x98,0x2,0x78,0x0,
+    0x2a,0xb,0xd0,0xef,0x1e,0xab,0x18,0x68,0xc1,0x0,0x0,0x0,0x99,0xff,0xe0,0xf7,
+    0x7d,0xfe,0x0,0xd2,0xc,0x46,0xfd,0x1b,0x69,0x1,0xf4,0xd1,0x0,0x25,0x1e,0xae,
+    0xfb,0x30,0x68,0xbf,0x2,0x1a,0xfe,0x30,0x60,0x6d,0x76,0x3b,0x0,0x10,0x2d,0x55,
+    0x6,0x2e,0x98,0x80,0x99,0x0,0xff,0x47,0x18,0x3e,0x0,0x6,0xe0,0x28,0x68,0xdf,
+    0xe5,0xf7,0x61,0xf9,0x30,0x5b,0x8,0x2,0x98,0xdf,0x0,0x78,0x84,0x42,0xf4,0x25,
+    0x0,0x3d,0x0,0xf7,0x10,0x26,0x28,0x3d,0x4,0xc3,0xfd,0x4,0x0,0xd5,0x2d,0x65,
+    0x1,0xf7,0x51,0x0,0x38,0x11,0x0,0xe1,0xf7,0xd7,0x58,0xfb,0x38,0x4f,0x0,0x3f,
+    0x4f,0x4,0x2f,0xb0,0xff,0xf0,0xbd,0xf8,0xb5,0x4,0x0,0xa0,0x20,0xff,0x40,0x0,
+    0x20,0x18,0x3,0x21,0x0,0x22,0xff,0x2,0x60,0x0,0x1d,0x49,0x1e,0xfb,0xd1,0xff,
+    0x60,0x7b,0x21,0x7b,0x88,0x42,0x3,0xd2,0xff,0x40,0x1c,0x60,0x73,0x4,0x20,0x11,
+    0xe0,0xff,0x22,0x0,0xfc,0x32,0x10,0x68,0x80,0x21,0xff,0xc9,0x5,0xe0,0xf7,0x29,
+    0xfe,0x5,0xd3,0xff,0x0,0x25,0xed,0x43,0x0,0x26,0x88,0xd,0xff,0x27,0x18,0x29,
+    0xe0,0xfe,0x20,0x80,0x5,0xdf,0xd0,0x64,0x2,0x20,0xe6,0x97,0x0,0x60,0x54,0xf7,
+    0xf1,0xbd,0xe6,0x4d,0x4,0xc0,0x78,0x86,0x42,0xab,0xb,0xd0,0xb,0x6,0x80,0xb,
+    0x0,0x5,0xb,0x8,0x0,0xff,0x79,0x86,0x42,0x0,0xd1,0x6d,0x1c,0x6d,0xeb,0xb2,
+    0xa8,0xd,0x0,0xa0,0x33,0x0,0x40,0x18,0x0,0xef,0x90,0x1,0x68,0x38,0x27,0x1,
+    0x6c,0xfd,0x0,0x4f,0x99,0x8,0x60,0x76,0x9d,0x0,0x2b,0x6,0x40,0x37,0x0,0xff,
+    0xd7,0xdb,0xcf,0x20,0x0,0x6,0x0,0x23,0xee,0x29,0x2,0x65,0x18,0x29,0x25,0x0,
+    0xe9,0xfd,0x1,0xbf,0xd2,0x8,0x0,0x1a,0x0,0x5b,0x6b,0x1,0x3,0xd7,0x2b,0xf5,
+    0xdb,0x2b,0x2,0x22,0x77,0x0,0x38,0xb5,0x7b,0xc,0x0,0x83,0x2,0x41,0x5c,0x21,
+    0x70,0x2d,0x2,0xff,0x45,0x18,0x68,0x68,0x0,0x21,0xe1,0xf7,0xff,0xa3,0xf9,0x2,
+    0xd8,0xfc,0x21,0x89,0x5,0xff,0x1,0xe0,0xbf,0x21,0x9,0x6,0xe0,0xf7,0xff,0x39,
+    0xfd,0xe5,0xf7,0xe1,0xf8,0xe2,0xf7,0x5f,0xad,0xfe,0x60,0x70,0x28,0x21,0x4,0x92,
+    0x21,0x18,0xf5,0x28,0x21,0x0,0xd0,0x21,0x0,0x9c,0xfe,0xa0,0x70,0x55,0xa8,0x21,
+    0x4,0x81,0x21,0x18,0x17,0x21,0x0,0xbf,0x21,0x0,0xff,0x8b,0xfe,0xe0,0x70,0x31,
+    0xbd,0x70,0xb4,0xff,0x1,0x0,0xd,0x31,0x0,0x22,0x4a,0x70,0xff,0x3,0x0,0x14,
+    0x33,0x1a,0x60,0x9a,0x61,0xff,0x40,0x24,0x2,0x55,0x5,0x0,0x94,0x35,0xbf,0xa,
+    0x24,0xa,0x26,0x2a,0x60,0x81,0x3,0xfb,0x5f,0xd1,0x5,0x0,0x44,0x35,0xd,0x12,
+    0x6c,0xd,0x14,0xeb,0xbc,0x35,0xb,0x2,0x64,0xb,0x0,0x4,0x0,0xe4,0xff,0x34,
+    0xa2,0x60,0x22,0x60,0x62,0x60,0xe2,0xff,0x60,0x4,0x24,0xe6,0x25,0x6d,0x0,0x44,
+    0xff,0x55,0xa0,0x24,0x64,0x0,0x0,0x19,0x3,0xf9,0x24,0x9f,0x3,0x23,0x2,0xa,
+    0x70,0x70,0xbc,0x70,0xff,0x47,0x42,0x0,0x12,0xe,0x7e,0x3a,0xb,0xff,0xdd,0x18,
+    0x21,0x89,0x1a,0x10,0xdd,0xff,0xfe,0x99,0x0,0xc9,0x43,0xd1,0x40,0x0,0x42,0x0,
+    0xff,0xd4,0x40,0x18,0x88,0x43,0x70,0x47,0x7f,0xff,0x22,0xc1,0xd,0x9,0x6,0x1,
+    0xd9,0xd0,0xff,0x7,0x70,0x47,0x0,0xd0,0xd0,0x5,0x70,0xff,0x47,0xf5,0xb5,0x83,
+    0xb0,0x0,0x20,0x1,0xff,0x90,0x3,0x98,0x0,0x90,0x0,0x25,0x4,0xff,0x9e,0xc,
+    0x0,0x6,0x27,0x21,0x68,0x30,0xfe,0x55,0x1,0x4d,0xff,0x29,0x0,0xe0,0xf7,0xab,
+    0xff,0xfc,0x5,0x0,0x18,0x34,0x36,0x1d,0x7f,0xef,0x1e,0xf3,0xd1,0x9e,0xed,0x1,
+    0xe1,0xf7,0x4,0xff,0xf9,0x1,0xd8,0xd,0x46,0x5,0xe0,0xb,0xef,0x49,0xe0,0xf7,
+    0x2c,0x79,0x1,0xcf,0x25,0x2d,0xff,0x6,0x0,0x98,0x5,0x60,0x1,0x98,0x40,0xff,
+    0x1c,0x1,0x90,0x0,0x98,0x0,0x1d,0x0,0xff,0x90,0x21,0x0,0x8c,0x39,0x1,0x98,
+    0x6,0xff,0x28,0xd5,0xdb,0x3,0x98,0x5,0xb0,0xf0,0xff,0xbd,0x0,0xbf,0xfe,0xff,
+    0xff,0xce,0x0,0xff,0xbf,0x0,0x21,0x41,0x63,0x81,0x63,0xc1,0xff,0x63,0x81,0x64,
+    0x70,0x47,0x70,0xb5,0x4,0xff,0x0,0xe,0x0,0x0,0x25,0x25,0x60,0x24,0xff,0x21,
+    0x0,0x1d,0xdb,0xf7,0x5e,0xf9,0x9,0xff,0x21,0x20,0x0,0x28,0x30,0xdb,0xf7,0x59,
+    0xff,0xf9,0x30,0x68,0x60,0x63,0x70,0x68,0xa0,0xff,0x63,0xe5,0x63,0x25,0x64,0x65,
+    0x64,0xa5,0xff,0x64,0xe5,0x64,0x25,0x65,0x65,0x65,0x0,0xef,0x20,0x70,0xbd,0x10,
+    0x35,0x0,0x48,0x6a,0xa,0xff,0x6a,0x80,0x18,0xc9,0x69,0x40,0x18,0xe2,0xff,0xf7,
+    0xb7,0xfd,0x21,0x49,0xe1,0xf7,0xf6,0xff,0xf9,0x20,0x60,0x10,0xbd,0x2e,0x30,0x81,
+    0xff,0x78,0x42,0x78,0x89,0x18,0x0,0x78,0x8,0xef,0x18,0x70,0x47,0xf8,0x29,0x0,
+    0x21,0x60,0x8,0xff,0x46,0xc1,0x17,0x19,0x4a,0x0,0x23,0xdb,0xff,0xf7,0xee,0xfc,
+    0x0,0xd,0xa,0x3,0x10,0xff,0x43,0xe0,0x63,0x26,0x0,0x3c,0x36,0x25,0xff,0x0,
+    0x48,0x35,0x30,0x68,0x0,0x28,0x1,0xff,0xd1,0x13,0x48,0xb,0xe0,0xc1,0x17,0x48,
+    0xff,0x40,0x42,0x1a,0x0,0x20,0x80,0x21,0x9,0xff,0x3,0xdc,0xf7,0xb,0xfa,0x31,
+    0x68,0xc9,0xfe,0x11,0x0,0x40,0x1a,0x28,0x60,0xa6,0x6c,0xf7,0xff,0x17,0x30,0x0,
+    0x39,0x0,0xa2,0x6b,0xd3,0x7f,0x17,0xdb,0xf7,0xcc,0xfc,0xd,0x15,0xd,0x2,0x7d,
+    0x62,0xd,0x4,0xc5,0xfc,0x8,0x15,0x20,0x9f,0x0,0xf7,0xf1,0xbd,0x0,0x0,0x0,
+    0x40,0x40,0x83,0xde,0xff,0x1b,0x43,0xff,0xff,0xff,0x7f,0xf8,0xb5,0xff,0x86,0xb0,
+    0x6,0x0,0x14,0x0,0x35,0x0,0xff,0x28,0x35,0xa8,0x6a,0x4,0x90,0x1,0xa8,0xfb,
+    0xc,0x21,0x7f,0x0,0xf8,0x20,0x68,0x68,0x62,0xff,0xe8,0x6a,0x8,0x28,0x1,0xd2,
+    0x40,0x1c,0xff,0xe8,0x62,0x30,0x1d,0x41,0x68,0x1,0x60,0xff,0x81,0x68,0x41,0x60,
+    0xc1,0x68,0x81,0x60,0xff,0x1,0x69,0xc1,0x60,0x41,0x69,0x1,0x61,0xff,0x81,0x69,
+    0x41,0x61,0xc1,0x69,0x81,0x61,0xff,0x1,0x6a,0xc1,0x61,0x69,0x6a,0x49,0x1c,0xff,
+    0x69,0x62,0x1,0x62,0x0,0x21,0x2,0x68,0xff,0x1,0x2a,0x4d,0xdb,0x2,0x69,0x83,
+    0x69,0xff,0x9c,0x1a,0x0,0xd5,0x64,0x42,0xab,0x69,0xff,0x9c,0x42,0xc,0xda,0x84,
+    0x68,0x14,0x1b,0xfe,0xd,0x2,0x9c,0x42,0x6,0xda,0xeb,0x69,0x93,0xff,0x42,0x3,
+    0xda,0x1,0x22,0x1,0xab,0x1a,0xff,0x71,0x1,0xe0,0x1,0xab,0x19,0x71,0x4,0xff,
+    0x69,0xea,0x69,0xa2,0x42,0x0,0xdb,0xe1,0xef,0xe0,0x83,0x68,0xe7,0x35,0x0,0x7f,
+    0x42,0xae,0xff,0x69,0xbe,0x42,0x6,0xdb,0x87,0x69,0x3c,0xfa,0x35,0x4,0xa6,0x1b,
+    0x0,0xd3,0xe0,0x4,0x68,0x1b,0xfe,0xd,0x0,0x5b,0x42,0xb3,0x42,0x8,0xda,0xc3,
+    0xef,0x68,0x47,0x68,0xdb,0xd,0x8,0x1,0xda,0xa2,0xff,0x42,0xd,0xdb,0x82,0x69,
+    0x3,0x6a,0xd2,0xfe,0x3b,0x0,0x52,0x42,0xb2,0x42,0xa,0xda,0x42,0xef,0x69,0xc0,
+    0x69,0x10,0xd,0x0,0x40,0x42,0xb0,0xfe,0x6b,0x2,0x20,0x1,0xaa,0x10,0x71,0xb2,
+    0xe0,0x7f,0x1,0xaa,0x11,0x71,0xaf,0xe0,0x2,0x79,0x0,0xff,0x9b,0x1c,0x8,0x36,
+    0x70,0x68,0xec,0x69,0xff,0xa0,0x42,0x0,0xda,0x19,0x70,0x70,0x68,0x7f,0x0,0x90,
+    0xf0,0x68,0x0,0x9c,0x0,0x51,0x0,0xf7,0x40,0x42,0xac,0x15,0x0,0xe,0xda,0x0,
+    0x98,0xef,0x34,0x1f,0x24,0x68,0x11,0xe,0x5,0xda,0xe8,0xef,0x69,0x0,0x9c,0xa0,
+    0x6d,0x0,0x1,0x20,0x0,0xff,0xe0,0x0,0x20,0x2,0x2a,0x1,0xd0,0x3,0xf7,0x2a,
+    0x1c,0xd1,0x25,0x2,0xef,0x69,0xa7,0x42,0xf5,0x17,0x31,0x0,0x4,0xad,0x4,0x98,
+    0x1e,0xaf,0x69,0xf5,0xbc,0x27,0x2,0x24,0x27,0x0,0x24,0x4,0x70,0x1c,0xd2,0x5f,
+    0x0,0xf4,0x49,0x10,0x41,0xa,0x5,0x41,0x0,0x6,0x2a,0xf7,0x1f,0xd1,0x74,0x3f,
+    0x4,0x1b,0xda,0xf0,0x68,0xe9,0x20,0xb1,0x4,0x23,0x2,0x2,0x3d,0x0,0x9c,0x70,
+    0x1,0xff,0xe0,0x99,0x70,0x0,0x24,0x1c,0x70,0x30,0x3f,0x1f,0x0,0x68,0x74,0x68,
+    0x24,0x4f,0x5,0x5b,0x2,0xdf,0x4,0xda,0xec,0x69,0x84,0x47,0xc,0x14,0x1f,0xfd,
+    0x3e,0x43,0x0,0x0,0x94,0xec,0x69,0x0,0x9f,0xff,0xbc,0x42,0x38,0xda,0x3c,0x46,
+    0x37,0x1f,0xd7,0x3f,0x68,0xe4,0x8b,0x4,0xaf,0x59,0x0,0x7,0xdb,0xfa,0x7d,0x0,
+    0x9f,0xf,0xe,0x27,0xda,0x30,0x0,0xc,0xa7,0x38,0x4,0x68,0x55,0x2,0x95,0x6,
+    0xb8,0xa1,0x1,0x37,0xff,0x68,0x30,0x0,0x8,0x38,0x0,0x68,0x38,0xae,0x83,0x4,
+    0xaf,0x69,0xb8,0x83,0x0,0xe8,0x89,0x0,0xd,0xdf,0xdb,0xf0,0x68,0x74,0x69,0x27,
+    0xa,0x8,0xda,0xe7,0xb0,0x68,0x34,0xd,0xc,0x81,0xa,0x18,0x70,0x52,0xff,0x1c,
+    0x36,0x1d,0x5b,0x1c,0x7,0x2a,0x0,0xff,0xd2,0x53,0xe7,0xe8,0x6a,0x5,0x28,0xc,
+    0xff,0xd2,0xa9,0x62,0x1,0xa8,0x9,0x22,0xab,0xff,0x6a,0x4,0x78,0x1b,0x19,0xab,
+    0x62,0x40,0xff,0x1c,0x52,0x1e,0xf8,0xd1,0x5b,0x1c,0xab,0xff,0x62,0x16,0xe0,0x1,
+    0xa8,0xaa,0x6a,0x3,0xff,0x79,0xd2,0x18,0xaa,0x62,0x6a,0x78,0x2a,0xff,0x70,0xaa,
+    0x78,0x6a,0x70,0xea,0x78,0xaa,0xff,0x70,0x2a,0x79,0xea,0x70,0x6a,0x79,0x2a,0xff,
+    0x71,0xaa,0x79,0x6a,0x71,0xea,0x79,0xaa,0xff,0x71,0x2a,0x7a,0xea,0x71,0x0,0x79,
+    0x28,0xff,0x72,0x0,0x20,0x0,0x22,0xeb,0x6a,0x7,0xff,0x2b,0x23,0xd1,0x1,0xab,
+    0x8,0x33,0x3,0xff,0x24,0x1e,0x78,0x80,0x19,0xc0,0xb2,0xde,0xff,0x1e,0x36,0x78,
+    0x92,0x19,0xd2,0xb2,0x5b,0xff,0x1e,0x64,0x1e,0xf5,0xd1,0x5,0x23,0x1,0xff,0xac,
+    0x64,0x1d,0x3,0xe0,0x2,0xd0,0x26,0xfa,0x1d,0x4,0xe6,0x1d,0x10,0x5,0x2b,0xf3,
+    0xd2,0x2,0xff,0x28,0x4,0xdb,0xa8,0x6a,0x3,0x23,0x9a,0xff,0x1a,0x80,0x18,0xa8,
+    0x62,0xa8,0x6a,0x4,0xff,0x9a,0x80,0x1a,0x6,0x9a,0x10,0x60,0x69,0xff,0x62,0x0,
+    0x20,0x7,0xb0,0xf0,0xbd,0x70,0xff,0xb5,0x5,0x0,0xc,0x0,0x10,0x0,0x14,0x3f,
+    0x21,0xdf,0xf7,0x34,0xfa,0x6,0x72,0x0,0x9,0x2,0xff,0x2f,0xfa,0x4,0x0,0x30,
+    0x0,0x21,0x0,0xdf,0xe0,0xf7,0x7e,0xfa,0x1,0x13,0x0,0xe1,0xf7,0xff,0x18,0xf8,
+    0x28,0x60,0x0,0x23,0x0,0x22,0xfd,0x1e,0x1d,0x0,0xe8,0xf9,0x80,0x21,0xc9,0x5,
+    0xfb,0x40,0x18,0xb,0x2,0x1a,0xfa,0x68,0x60,0x2d,0xff,0x1d,0x1,0x46,0xfc,0x20,
+    0x80,0x5,0xe0,0xff,0xf7,0x6,0xfd,0x28,0x60,0x70,0xbd,0x3,0xff,0x21,0x0,0x22,
+    0x2,0x60,0x0,0x1d,0x49,0xff,0x1e,0xfb,0xd1,0x70,0x47,0x10,0xb4,0x1,0xff,0x0,
+    0x8,0x31,0x3,0x22,0x3,0x23,0x0,0xbf,0x24,0xc,0x60,0x9,0x1d,0x5b,0x15,0x0,
+    0x1,0xdf,0x0,0x14,0x31,0x3,0x23,0xd,0xa,0x20,0x30,0xf5,0x4,0x2d,0x0,0x52,
+    0x9,0x0,0x10,0xbc,0x70,0x47,0xff,0xf1,0xb5,0x82,0xb0,0x4,0x46,0x8,0x34,0xff,
+    0xd,0x0,0x3,0x26,0x2f,0x68,0x38,0x0,0xdf,0x21,0x68,0xe0,0xf7,0x73,0x85,0x0,
+    0x2,0x98,0xfd,0x40,0x9,0x0,0xd5,0xfc,0x0,0x90,0x2,0x98,0xf7,0x1,0x68,0xe0,
+    0xb,0x0,0xcf,0xfc,0x0,0x99,0xff,0xe0,0xf7,0x2d,0xfa,0x27,0x60,0xe0,0x60,0xfd,
+    0x28,0x85,0x0,0x24,0x1d,0x76,0x1e,0xe5,0xd1,0xfd,0x3,0xd5,0x0,0x10,0xb4,0x0,
+    0x22,0x3,0x0,0xff,0xc,0x68,0x1c,0x60,0x52,0x1c,0x9,0x1d,0xbf,0x1b,0x1d,0x3,
+    0x2a,0xf8,0xdb,0x5b,0x2,0xfe,0xff,0xb5,0x4,0x0,0x0,0x25,0x26,0x0,0x20,0xff,
+    0x36,0xf,0x0,0x39,0x68,0x1,0x98,0x0,0xbe,0x45,0x0,0xac,0xfc,0x1,0x0,0x30,
+    0x7,0x0,0x9,0xff,0xfa,0x30,0x60,0x6d,0x1c,0x3f,0x1d,0x36,0xff,0x1d,0x3,0x2d,
+    0xf0,0xd3,0x2,0x99,0x20,0x7f,0x0,0x20,0x30,0x2c,0xc8,0x2c,0xc1,0x9,0x2,0xef,
+    0xff,0xf7,0xb4,0xff,0x57,0x2,0x0,0x68,0x18,0xff,0x39,0x1,0xd4,0x88,0x40,0x5,
+    0xe0,0x4b,0xff,0x42,0x20,0x2b,0x1,0xdb,0xc0,0x17,0x0,0xff,0xe0,0x18,0x41,0x10,
+    0x60,0x70,0x47,0x0,0xff,0x0,0xb,0x48,0x1,0x78,0xc9,0x7,0x1,0xff,0xd5,0x1,
+    0x20,0x70,0x47,0x1,0x78,0x49,0xaf,0x6,0x1,0xd5,0x2,0x9,0x4,0x89,0x9,0x0,
+    0x3,0xae,0x9,0x0,0x0,0x78,0xc0,0x9,0x0,0x4,0x9,0x0,0x5,0xfe,0xd,0x2,
+    0xbf,0x38,0x4,0x0,0x40,0xc3,0x78,0xff,0x82,0x78,0x41,0x78,0x0,0x78,0x1b,0x2,
+    0xff,0x1a,0x43,0x9,0x2,0x12,0x4,0x8,0x43,0xfb,0x10,0x43,0x4b,0x2,0x93,0xa1,
+    0xa8,0x22,0x52,0xff,0x0,0x8a,0x18,0xb,0x88,0x83,0x42,0x1,0xff,0xd1,0x88,0x78,
+    0x70,0x47,0x9,0x1d,0x91,0xd7,0x42,0xf7,0xd3,0x5b,0x2,0xf7,0x1f,0x1,0x0,0x24,
+    0xff,0x68,0x46,0x4,0x80,0x86,0x4f,0x38,0x78,0xff,0x0,0x28,0x1,0xd0,0x4,0x20,
+    0x67,0xe0,0xff,0x0,0xbf,0x86,0xa0,0xa8,0x21,0x49,0x0,0xff,0x41,0x18,0x2,0x88,
+    0x6b,0x46,0x1b,0x89,0x7f,0x9a,0x42,0x7,0xd0,0x0,0x1d,0x88,0x33,0x4,0xff,0x80,
+    0x7,0x3,0xd4,0x2,0x20,0x55,0xe0,0xff,0x80,0x78,0xf9,0xe7,0x1,0x26,0x3e,0x70,
+    0xff,0x68,0x46,0x0,0x89,0x1,0xf0,0x67,0xfa,0xff,0x0,0x28,0x12,0xd0,0x76,0x4d,
+    0x3,0x98,0xef,0x5,0x60,0x29,0x0,0x13,0x6,0x6b,0xfa,0x69,0xef,0x46,0x8,0x80,
+    0x3c,0x21,0x2,0x88,0x0,0x28,0xff,0x37,0xd1,0x4,0x98,0x4,0x80,0x1,0x20,0xfb,
+    0x38,0xe0,0x1d,0x2,0x6c,0x49,0x88,0x42,0x3,0xfd,0xd0,0x5,0x2,0xe,0xd0,0x1e,
+    0xe0,0x68,0x4d,0xff,0x28,0x0,0x0,0xf0,0xf3,0xff,0x0,0x28,0xfb,0x15,0xd1,0x41,
+    0x2,0x28,0x78,0x69,0x78,0x9,0xff,0x6,0x9,0xc,0x8,0x43,0xdd,0xe7,0x61,0xfe,
+    0x1b,0x0,0x1,0xf0,0xb,0xf8,0x0,0x28,0x7,0xfe,0x1b,0x18,0xcf,0xe7,0x1,0x20,
+    0x3c,0x70,0x8,0xdf,0xe0,0x6a,0x46,0x3,0x99,0x71,0x6,0xb2,0xfb,0xff,0x3c,0x70,
+    0x0,0x28,0xc6,0xd0,0x4,0x99,0xf7,0xc,0x80,0x4,0x67,0x2,0x88,0x4,0x99,0x8,
+    0xef,0x80,0x0,0x20,0x5,0x6d,0x1,0x4e,0x4a,0x13,0xff,0x78,0x0,0x2b,0x8,0xd1,
+    0x2,0x23,0x13,0xff,0x70,0x44,0x28,0x8,0xd2,0x4b,0x4a,0x80,0xef,0x0,0x11,0x50,
+    0x0,0x3,0x1,0x2,0x2b,0xf6,0xf6,0xf5,0x0,0x70,0x47,0x57,0x3,0x44,0x49,0xa,
+    0x78,0xff,0x0,0x2a,0x5,0xd1,0x2,0x22,0xa,0x70,0x4f,0x42,0x49,0x1,0x60,0x1f,
+    0x2,0x1b,0x2,0x70,0xeb,0x1,0xf7,0x3d,0x4d,0x28,0x21,0x3,0xd1,0x6,0x20,0x70,
+    0x7b,0xbd,0x2,0x29,0x5,0x70,0xbd,0x3c,0xa0,0x5b,0x3,0xdf,0x82,0x18,0x3,0x88,
+    0xa3,0x23,0x5,0x90,0x42,0x7d,0xf9,0x23,0x1,0x2,0x28,0x3,0xd1,0x7,0x1d,0x0,
+    0xee,0x23,0x3,0x40,0x7,0x1,0x2f,0x1,0x70,0xbd,0xff,0xff,0x20,0x12,0x30,0x81,
+    0x42,0x1,0xdb,0x3,0xff,0x26,0x11,0xe0,0xa,0x0,0x2b,0x49,0x20,0xfe,0xd5,0x0,
+    0x88,0xfb,0x6,0x0,0x8,0x2e,0x4,0xff,0xd1,0x3,0x20,0x28,0x70,0x6c,0x80,0x8,
+    0xbe,0x25,0x0,0x0,0x2e,0x2,0xd1,0x20,0xb,0x1,0x60,0xdb,0xfb,0x0,0x13,0x0,
+    0x30,0x0,0x11,0x0,0x0,0x70,0xbf,0xb5,0x5,0x0,0x1e,0x4c,0x20,0x9d,0x9,0x70,
+    0xcb,0xbd,0x1f,0x9b,0xd,0xaa,0x97,0x9,0x73,0x2a,0x2,0x20,0xbf,0x20,0x70,0x0,
+    0x22,0x0,0x21,0x41,0x3,0x52,0x4e,0x6b,0xc,0x20,0x70,0x65,0x6b,0xc,0x77,0x3,
+    0x2a,0x6b,0x0,0xfd,0x20,0x6b,0x4,0x5,0x48,0x1,0x78,0x3,0x29,0x7b,0x1,0xd1,
+    0xf1,0x2,0x0,0x21,0x1,0x70,0xfd,0x2,0xff,0x0,0x0,0xc4,0x49,0x0,0x20,0x5c,
+    0x3b,0xff,0x0,0x20,0x4d,0x4d,0x0,0x0,0x4e,0x4e,0xff,0x0,0x0,0x1f,0x1f,0x6,
+    0x0,0x30,0x30,0xff,0x6,0x0,0x79,0x79,0x6,0x0,0x4d,0x4d,0xdf,0x2,0x0,0x8a,
+    0x8a,0x6,0x17,0x0,0x2,0x0,0xff,0x4b,0x4b,0x6,0x0,0x65,0x65,0x6,0x0,0xff,
+    0x29,0x29,0x6,0x0,0x72,0x72,0x6,0x0,0xff,0x54,0x54,0x6,0x0,0x83,0x83,0x6,
+    0x0,0xff,0x9e,0x9e,0x6,0x0,0xad,0xad,0x6,0x0,0xff,0x60,0x1c,0x6,0x0,0xbc,
+    0xbc,0x6,0x0,0xff,0xc1,0xc1,0x6,0x0,0xd0,0xd0,0x6,0x0,0xff,0x3a,0x3a,0x6,
+    0x0,0x3b,0x3b,0x6,0x0,0xff,0x3c,0x3c,0x6,0x0,0x3d,0x3d,0x6,0x0,0xff,0x2c,
+    0x7a,0x6,0x0,0xa1,0xec,0x6,0x0,0xdf,0x27,0x56,0x6,0x0,0x24,0x3b,0x0,0x3e,
+    0x2d,0x57,0x6,0x0,0x41,0x3,0x0,0x43,0x3,0x0,0x46,0x3,0x0,0xfd,0x4c,0x3,
+    0x0,0xe2,0xd3,0x6,0x0,0x2d,0x3e,0xf7,0x6,0x0,0x2e,0x3,0x0,0x5a,0xc2,0x6,
+    0x0,0xf5,0x69,0x3,0x0,0x74,0x3,0x0,0xd7,0xd7,0x6,0x0,0x7f,0x7d,0x7d,0x6,
+    0x0,0xaf,0x39,0x6,0xa8,0x0,0x7f,0x6,0x0,0xc9,0x1a,0x6,0x0,0xb1,0xb,0x0,
+    0x7d,0xa2,0xb,0x0,0x1,0xd4,0x6,0x0,0x2,0x3,0x0,0xff,0x2a,0x1b,0x6,0x0,
+    0x94,0xfc,0x6,0x0,0x5f,0x89,0xed,0x6,0x0,0x85,0x3,0x0,0x87,0x3,0x0,0x7d,
+    0x88,0x3,0x0,0xb4,0x74,0x6,0x0,0x3,0x1f,0x0,0x5f,0x1,0xe3,0x2,0x0,0x2,
+    0x3,0x0,0x3,0x3,0x0,0x55,0x4,0x3,0x0,0x5,0x3,0x0,0x6,0x3,0x0,0x7,
+    0x3,0x0,0x55,0x8,0x3,0x0,0x9,0x3,0x0,0xa,0x3,0x0,0xb,0x3,0x0,0x55,
+    0xc,0x3,0x0,0xd,0x3,0x0,0xe,0x3,0x0,0xf,0x3,0x0,0x55,0x10,0x3,0x0,
+    0x11,0x3,0x0,0x12,0x3,0x0,0x13,0x3,0x0,0x55,0x14,0x3,0x0,0x15,0x3,0x0,
+    0x16,0x3,0x0,0x17,0x3,0x0,0x55,0x18,0x3,0x0,0x19,0x3,0x0,0x1e,0x3,0x0,
+    0x1a,0x3,0x0,0xd5,0x1b,0x3,0x0,0x1c,0x3,0x0,0x1d,0x3,0x0,0xf3,0xb5,0xff,
+    0x81,0xb0,0x48,0x48,0x0,0x88,0x1,0x0,0xfe,0xab,0x1,0x24,0x47,0x4b,0x1d,0x0,
+    0x2,0xe0,0xff,0x64,0x1c,0xa4,0xb2,0x2d,0x1d,0x84,0x42,0xff,0x8,0xda,0x2e,0x68,
+    0x0,0x2e,0xf7,0xd0,0xff,0x36,0x88,0x6f,0x46,0xbf,0x88,0xbe,0x42,0xff,0xf2,0xd1,
+    0x21,0x0,0x34,0x29,0x5,0xdb,0xff,0x2,0x22,0xc,0x21,0x4,0x20,0xf9,0xf7,0xff,
+    0x5c,0xfe,0x16,0xe0,0x2,0x9c,0x0,0x2c,0xff,0xc,0xd1,0x0,0x28,0x11,0xd0,0x40,
+    0x1e,0xff,0x36,0x4c,0x20,0x80,0x0,0x4,0x80,0xb,0xff,0x18,0x18,0x4,0x68,0x89,
+    0x0,0x5c,0x50,0xff,0x2,0x60,0x6,0xe0,0x8a,0x0,0x9c,0x50,0xff,0x81,0x42,0x2,
+    0xd1,0x40,0x1c,0x2f,0x49,0xff,0x8,0x80,0x3,0xb0,0xf0,0xbd,0xf0,0xb4,0xff,0x84,
+    0xb0,0x2,0x0,0x0,0x20,0x0,0x23,0xff,0x2b,0x4c,0x25,0x0,0x29,0x4e,0x36,0x88,
+    0xdf,0x2,0xe0,0x5b,0x1c,0x9b,0x71,0x0,0xb3,0x42,0xff,0x17,0xda,0x2f,0x68,0x0,
+    0x2f,0xf7,0xd0,0xff,0x3f,0x88,0x89,0xb2,0x8f,0x42,0xf3,0xd1,0xff,0x98,0x0,0x20,
+    0x58,0x0,0x28,0x4,0xd1,0xff,0x68,0x46,0x0,0x21,0x0,0x23,0xa,0xc0,0xff,0x5,
+    0xe0,0x69,0x46,0x3,0x88,0xb,0x80,0xff,0x43,0x88,0x4b,0x80,0x1,0x90,0x68,0x46,
+    0xff,0x5,0xe0,0x6b,0x46,0x19,0x81,0x2,0xab,0xff,0x58,0x80,0x3,0x90,0x2,0xa8,
+    0x3,0xc8,0xff,0x3,0xc2,0x4,0xb0,0xf0,0xbc,0x70,0x47,0xfd,0x14,0xd1,0x0,0x70,
+    0x47,0x1c,0xb5,0x4,0x0,0xfd,0x11,0x9,0x0,0x89,0xb2,0x81,0x42,0x10,0xd2,0xdf,
+    0x10,0x48,0x89,0x0,0x40,0x4d,0xe,0x22,0x6,0xfb,0xc0,0xf,0x4d,0x0,0x2,0x88,
+    0xa,0x80,0x42,0xbb,0x88,0x4a,0x4d,0x0,0x8,0xe0,0x3,0xd7,0x8,0xf0,0xed,0xfd,
+    0x21,0xa,0x68,0x46,0x53,0x0,0xc4,0x16,0xbd,0xff,0x0,0x0,0x5e,0x49,0x0,0x20,
+    0xd8,0x40,0xff,0x0,0x20,0x80,0xb5,0x0,0x20,0x5a,0x49,0xff,0x8,0x70,0x1,0xf0,
+    0x6,0xfa,0x1,0xbd,0xff,0xf8,0xb5,0x6,0x0,0x0,0x24,0x56,0x4d,0xff,0x28,0x78,
+    0x0,0x28,0x1,0xd0,0x2,0x20,0xff,0x3b,0xe0,0x70,0x88,0xa8,0x80,0xb0,0x88,0xff,
+    0x68,0x80,0x2,0x27,0xff,0xf7,0x81,0xfd,0xff,0x38,0x42,0x1,0xd1,0x1,0x20,0x30,
+    0xe0,0xff,0x2a,0x0,0x8,0x32,0x29,0x0,0xc,0x31,0xff,0x68,0x88,0xff,0xf7,0x84,
+    0xfd,0x29,0x89,0xff,0xc9,0x1c,0x89,0x8,0x29,0x81,0xf2,0x88,0xff,0x0,0x2a,0x2,
+    0xd0,0x11,0x0,0x2,0x23,0xff,0x3,0xe0,0x29,0x89,0x73,0x88,0xc9,0x1a,0xff,0x1,
+    0x23,0x2b,0x70,0x1,0x28,0x1,0xd1,0xdf,0x5,0x24,0x14,0xe0,0x5,0x7,0x0,0x8,
+    0x24,0x77,0x10,0xe0,0x4,0x7,0x0,0x2,0x24,0xc,0x59,0x0,0xff,0x2b,0x89,0x5e,
+    0x1e,0x86,0x42,0x1,0xda,0xff,0x4,0x24,0x5,0xe0,0x16,0x18,0xb3,0x42,0xff,0x1,
+    0xdb,0x93,0x42,0x0,0xd2,0x19,0x1a,0xff,0xe9,0x80,0x20,0x0,0x0,0xf0,0x1,0xf8,
+    0xff,0xf1,0xbd,0xf1,0xb5,0x84,0xb0,0x0,0x20,0xfe,0xb,0x1,0x90,0x0,0x23,0x31,
+    0x4c,0x21,0x78,0xff,0x0,0x29,0x37,0xd0,0x2,0x29,0x0,0xd0,0xff,0x3d,0xd2,0xe2,
+    0x88,0x3,0x2a,0x0,0xd3,0xff,0x2,0x22,0x6e,0x46,0x36,0x7c,0x0,0x2e,0xff,0x7,
+    0xd0,0x76,0x1e,0x2e,0xd0,0xf6,0x1e,0xff,0x1,0x2e,0x2b,0xd9,0x36,0x1f,0x22,0xd0,
+    0xff,0x2d,0xe0,0xe3,0x88,0x9d,0x1a,0xe5,0x80,0xff,0xa3,0x88,0xe6,0x68,0x9f,0x0,
+    0xf6,0x19,0xff,0x37,0x68,0x3,0x97,0x2,0x2a,0x1,0xd1,0xff,0x76,0x68,0x2,0x96,
+    0xa6,0x88,0xb6,0x18,0xff,0xa6,0x80,0x12,0x1,0x2d,0x4,0x1,0xd0,0xff,0x15,0x0,
+    0x1b,0xe0,0x2,0x29,0x7,0xd1,0xff,0x21,0x89,0xb6,0xb2,0x8e,0x42,0x1,0xd2,0xff,
+    0x6,0x25,0x2,0xe0,0x7,0x25,0x0,0xe0,0xff,0x3,0x25,0x15,0x43,0x0,0xe0,0x8,
+    0x25,0xf7,0x20,0x70,0xb,0x53,0x1,0x9,0x7c,0x1,0x29,0xff,0x4,0xd1,0x69,0x46,
+    0xd,0x7c,0x20,0x70,0xfd,0xa3,0xdd,0x1,0x0,0x98,0x0,0x28,0x8,0xd0,0xff,0xe,
+    0x48,0x1,0x90,0x60,0x88,0x0,0x90,0xff,0xea,0xb2,0x2,0x99,0x3,0x98,0x1,0xf0,
+    0xff,0x92,0xfa,0x21,0x78,0x48,0x1e,0x80,0x41,0xff,0xc0,0x43,0xc0,0xf,0x5,0xb0,
+    0xf0,0xbd,0xf7,0x5,0x48,0x0,0x45,0x1,0x0,0xd1,0x70,0x47,0xbe,0x63,0x3,0xff,
+    0xf7,0x99,0xff,0x1,0x77,0x1,0x10,0xfe,0x77,0x1,0x37,0x1a,0x3,0x0,0x30,0xb4,
+    0x0,0xff,0x21,0xc0,0x4a,0x11,0x70,0x0,0x23,0xc0,0xff,0x4a,0x10,0x0,0x1c,0x30,
+    0x1c,0x0,0x21,0xdf,0x34,0x4,0x70,0x5b,0x1c,0x7,0x2,0x2c,0x25,0xeb,0x44,0x55,
+    0x9,0x6,0x58,0x9,0x4,0x84,0x30,0xf,0xff,0x2b,0xee,0xdb,0x14,0x0,0x60,0x34,
+    0x10,0xff,0x23,0x23,0x80,0x10,0x0,0x8,0x30,0x4,0xff,0x25,0x85,0x85,0x3,0x80,
+    0xa3,0x85,0x10,0xff,0x0,0xb8,0x30,0x3,0x80,0x83,0x85,0x88,0x5f,0x20,0x40,0x0,
+    0x10,0x18,0x9,0x2,0xb4,0x9,0xc,0x7f,0xe0,0x24,0x64,0x0,0x14,0x19,0x23,0x25,
+    0x0,0xff,0x86,0x24,0xa4,0x0,0x12,0x19,0x13,0x80,0xff,0x93,0x85,0x81,0x61,0x30,
+    0xbc,0x70,0x47,0xff,0x70,0xb5,0x1c,0x0,0xa2,0x4b,0x1d,0x0,0xff,0x64,0x35,0x86,
+    0x26,0x2e,0x70,0x4,0x9e,0xff,0xae,0x81,0x6a,0x70,0x6c,0x80,0x68,0x60,0xff,0xa9,
+    0x60,0x5,0x98,0x68,0x61,0x58,0x33,0xfd,0x18,0x7d,0x1,0x42,0xfa,0x70,0xbd,0x38,
+    0xb5,0xff,0x13,0x0,0x98,0x4a,0x14,0x0,0x38,0x34,0xff,0x84,0x25,0x25,0x70,0x61,
+    0x70,0x60,0x80,0xdf,0x63,0x61,0x2c,0x32,0x10,0x1d,0x0,0x33,0xfa,0xff,0x31,0xbd,
+    0x70,0xb5,0x86,0xb0,0x91,0x4c,0xff,0x20,0x0,0xc,0x30,0x1,0xf0,0x26,0xfa,0xef,
+    0x81,0x25,0x25,0x73,0xb5,0x3,0x26,0xfa,0x20,0xff,0x0,0x90,0x30,0x5,0x70,0x0,
+    0x26,0x46,0xff,0x70,0x86,0x70,0xa,0x21,0xc1,0x70,0x89,0xff,0x49,0x41,0x60,0xad,
+    0x21,0x81,0x60,0x86,0xff,0x81,0x20,0x0,0x84,0x30,0x0,0xf0,0x15,0xfa,0x21,0x0,
+    0xbc,0x21,0x0,0x46,0x70,0x83,0x49,0xa,0xff,0x79,0x82,0x70,0x4a,0x79,0xc2,0x70,
+    0xa,0xff,0x68,0x42,0x60,0x8a,0x68,0x82,0x60,0xc9,0xeb,0x88,0x81,0x25,0x0,0xb0,
+    0x25,0x0,0x2,0xfa,0x68,0xaf,0x46,0xd2,0xf7,0x96,0x2b,0x0,0xe8,0x2b,0x4,0x69,
+    0xfd,0x46,0x2b,0xa,0x0,0x9a,0x42,0x60,0x2,0x9a,0xf6,0x2b,0x6,0xdc,0x34,0x73,
+    0x2,0xec,0xf9,0x6,0xb0,0x7f,0x70,0xbd,0xf1,0xb5,0x6d,0x4c,0x8a,0xfd,0x0,0xff,
+    0x20,0x18,0x88,0x22,0x2,0x70,0x69,0x4b,0xff,0x1f,0x78,0x47,0x70,0x2,0x23,0x83,
+    0x70,0xfd,0xc1,0x8b,0x0,0x6,0x71,0x6d,0x46,0x2d,0x78,0xff,0x45,0x71,0xa0,0x25,
+    0x6d,0x0,0x65,0x19,0xdf,0x2a,0x70,0x7f,0x1c,0x6f,0x3,0x0,0x60,0x4a,0xff,0x17,
+    0x70,0xab,0x70,0xe9,0x70,0x1,0x21,0xdb,0x29,0x71,0xe5,0x1,0x78,0x69,0x5,0x4,
+    0x0,0x29,0xfb,0x13,0xd0,0x7,0x2,0x21,0x29,0xf,0xda,0x2a,0xff,0x0,0x1,0x0,
+    0x68,0x46,0x0,0x78,0xeb,0xef,0xf7,0x9b,0xf8,0x84,0x5b,0x4,0x0,0xf0,0xb5,0xff,
+    0xf9,0xa8,0x79,0x0,0x28,0x7,0xd0,0x9a,0xdf,0x20,0x1,0xe0,0x86,0x71,0x15,0xa,
+    0xaa,0xf9,0xff,0xf1,0xbd,0x80,0xb5,0x4c,0x4a,0x0,0x23,0xff,0x93,0x70,0xd1,0x70,
+    0x50,0x70,0x0,0xf0,0x77,0x59,0xf8,0x1,0x41,0x1,0x48,0x4b,0xcc,0x87,0x1,0xf7,
+    0x1c,0x19,0x88,0x41,0x1,0x4,0x25,0xa5,0x70,0xff,0xe0,0x70,0x0,0x20,0x20,0x71,
+    0x62,0x71,0xd7,0xa1,0x71,0xc6,0x39,0x0,0x18,0x39,0x0,0x8d,0xf9,0xff,0x31,0xbd,
+    0x10,0xb5,0x3e,0x4a,0xe2,0x23,0xff,0x5b,0x0,0xd3,0x18,0x88,0x24,0x1c,0x70,0xff,
+    0x84,0x24,0x9c,0x70,0x0,0x24,0x1c,0x71,0xdf,0x59,0x71,0x98,0x71,0xdc,0x25,0x0,
+    0x2f,0xe0,0xff,0x80,0xb5,0x36,0x49,0xf8,0x22,0x52,0x0,0x7f,0x8a,0x18,0x88,0x23,
+    0x13,0x70,0x85,0x63,0x0,0x7f,0x0,0x23,0x13,0x71,0xd0,0x80,0xf2,0x1d,0x0,0xdd,
+    0x8,0x43,0x0,0x6b,0xf9,0x1,0x43,0x0,0x2d,0x4a,0x57,0x87,0x23,0x9b,0x43,0x8,
+    0x6,0x43,0x0,0xd8,0x6b,0x0,0xfd,0x18,0x45,0x0,0x84,0x20,0xd,0xe0,0x10,0xb5,
+    0xd7,0x26,0x4a,0x92,0x1d,0xc,0x7,0x1d,0x10,0x8f,0x20,0xf7,0x80,0x0,0x10,0x43,
+    0x0,0x49,0xf9,0x10,0xbd,0x7f,0xf0,0xb5,0x83,0xb0,0x1c,0x4f,0xb6,0x55,0x0,0xff,
+    0x3c,0x18,0x88,0x20,0x20,0x70,0x18,0x4d,0xff,0x28,0x78,0x60,0x70,0x40,0x1c,0x28,
+    0x70,0xff,0x1,0x20,0xa0,0x70,0xe8,0x78,0xe0,0x70,0xff,0x6e,0x46,0x68,0x46,0xf9,
+    0xf7,0xdd,0xfb,0xff,0x70,0x78,0x1,0x0,0x6a,0x78,0x33,0x78,0xff,0x9a,0x42,0x1,
+    0xd2,0xff,0x29,0xf4,0xd1,0xff,0xaa,0x78,0x22,0x71,0x52,0x1c,0xaa,0x70,0xff,0x32,
+    0x78,0x62,0x71,0x0,0x22,0xa2,0x71,0xff,0xe0,0x71,0xb0,0x78,0x20,0x72,0xf0,0x78,
+    0x7f,0x60,0x72,0x30,0x79,0xa0,0x72,0xb0,0x51,0x0,0xff,0x38,0x18,0xff,0x29,0x2,
+    0xd0,0x7,0x49,0xff,0x61,0x61,0x0,0xe0,0x62,0x61,0x0,0xf0,0xff,0x11,0xf9,0x3,
+    0xb0,0xf0,0xbd,0xcc,0x49,0xff,0x0,0x20,0x68,0x35,0x0,0x20,0xa,0xa3,0xff,0x98,
+    0x0,0x48,0x4d,0x3,0x0,0xeb,0x1c,0xdf,0x3,0x0,0x80,0xb5,0xa,0x77,0x1,0x3,
+    0x20,0x9f,0xf9,0xf7,0x84,0xfb,0x1,0x55,0x1,0xd,0xa,0x8c,0xfe,0xd,0x0,0x10,
+    0xb5,0x60,0x4c,0x20,0x0,0x8,0xff,0x30,0x1,0xf0,0x0,0xf9,0x20,0x0,0x10,0xfe,
+    0x7,0x0,0xfc,0xf8,0x20,0x78,0x2,0x28,0x1,0xbf,0xd1,0x3,0x20,0x0,0xe0,0x1,
+    0xb3,0x0,0x10,0xff,0xbd,0xf8,0xb5,0x4,0x0,0xf,0x0,0x8,0xff,0x25,0x20,0x7f,
+    0x21,0x28,0x4,0xda,0xea,0xff,0xf7,0x61,0xff,0x40,0x7,0x0,0xd5,0x0,0x7f,0x25,
+    0x51,0x4e,0x21,0x0,0x70,0x19,0x3b,0x2,0x7f,0xf7,0xf8,0x5,0x0,0x30,0x78,0x1,
+    0x35,0x0,0xff,0x0,0xf0,0x26,0xf8,0x3c,0x60,0x28,0x0,0xed,0xf2,0xab,0x1,0x49,
+    0x4c,0x49,0x4,0xd0,0x3,0x28,0xff,0x2,0xd1,0x60,0x68,0x0,0x28,0x3,0xd1,0xff,
+    0x0,0x21,0x3,0x20,0xff,0xf7,0xb7,0xff,0xbf,0x65,0x68,0x0,0x20,0x60,0x60,0x5d,
+    0x2,0x0,0xff,0xf0,0xe,0xf8,0x28,0x6a,0x1,0x0,0x0,0xff,0xd0,0x80,0x47,0x31,
+    0xbd,0x3d,0x48,0x0,0xfe,0x45,0x0,0x0,0xd0,0x70,0x47,0x80,0xb5,0x0,0xfb,0xf0,
+    0x1,0xf1,0x1,0xf8,0xb5,0x0,0x20,0x69,0xff,0x46,0x8,0x70,0xfa,0xf7,0x0,0xfa,
+    0x0,0xfa,0x47,0x0,0x1,0xd,0x4,0x0,0x24,0x32,0x4f,0x38,0xfe,0x29,0x0,0x60,
+    0xd1,0xe0,0x0,0x3d,0x18,0x8,0xef,0x35,0x28,0x0,0x1,0xff,0x0,0x0,0x28,0x52,
+    0xfd,0xd1,0x9,0x2,0xfc,0xf8,0x78,0x60,0x6,0x0,0xf7,0xfa,0xf7,0xe7,0x11,0x0,
+    0x6,0xd0,0x31,0x7b,0xff,0x2,0x20,0xfa,0xf7,0xe4,0xf9,0x40,0x7a,0x7f,0x40,0x7,
+    0xea,0xd5,0x78,0x68,0x0,0xc5,0x0,0xff,0x2e,0xda,0xfa,0xf7,0xe6,0xfb,0x79,0x68,
+    0xff,0x4a,0x68,0x80,0x1a,0x0,0xd5,0x40,0x42,0xff,0x0,0x22,0x80,0x23,0x5b,0x0,
+    0x98,0x42,0xff,0x19,0xd3,0x40,0x8,0x1,0x22,0x98,0x42,0x55,0x15,0x7,0x0,0x2,
+    0x7,0x0,0x11,0x7,0x0,0x3,0x7,0x0,0x55,0xd,0x7,0x0,0x4,0x7,0x0,0x9,
+    0x7,0x0,0x5,0x7,0x0,0x55,0x5,0x7,0x0,0x6,0x7,0x0,0x1,0x7,0x0,0x7,
+    0x7,0x0,0xff,0x0,0xd3,0xff,0x20,0xc,0x31,0xc8,0x70,0xff,0x88,0x78,0x92,0x0,
+    0x2,0x43,0x8a,0x70,0xfe,0xb3,0x2,0x48,0x70,0x49,0x1c,0x78,0x68,0xfa,0xb7,0xf7,
+    0x2e,0xfc,0xf9,0x0,0xd0,0x2,0xf9,0x4,0x3a,0xff,0xff,0x2,0x20,0x38,0x70,0xf1,
+    0xbd,0x64,0xff,0x1c,0x68,0x46,0x0,0x78,0xe4,0xb2,0xa0,0xff,0x42,0x9b,0xd2,0xf1,
+    0xbd,0x58,0x48,0x0,0xff,0x20,0x0,0xb5,0xc1,0xb0,0xfa,0xf7,0x12,0xfe,0xe3,0x0,
+    0x1c,0xd0,0x78,0x21,0x22,0xa8,0xda,0xff,0xf7,0x1e,0xf9,0x22,0xa8,0xea,0xf7,0xb7,
+    0xbf,0xfe,0xea,0xf7,0xcf,0xfe,0x0,0x13,0x1,0x1,0xff,0x20,0xe5,0xf7,0x56,0xfc,
+    0x6a,0x46,0x4,0xbf,0xa9,0x22,0xa8,0xe5,0xf7,0x26,0x55,0x8,0xb,0xbe,0x55,0x0,
+    0x16,0xff,0x69,0x46,0x4,0x2b,0x0,0xab,0xef,0xfe,0x41,0xb0,0x0,0xdf,0x1,0xea,
+    0xf7,0xd2,0x9f,0xfe,0xff,0xf7,0xd6,0xff,0xeb,0x3,0x3d,0x2,0xff,0xbf,0xf7,0xd0,
+    0xff,0xff,0xf7,0x51,0xf,0x4,0x0,0xfd,0x90,0x45,0x1,0xd0,0x69,0x46,0xff,0xf7,
+    0x14,0xef,0xff,0x0,0x98,0x2,0x21,0x4,0xc0,0xfe,0x2,0xff,0xbd,0x10,0xb5,0x0,
+    0x24,0x1,0x78,0x80,0xff,0x29,0x8,0xd0,0x82,0x29,0x9,0xd0,0x83,0xff,0x29,0xa,
+    0xd0,0x85,0x29,0xb,0xd0,0x87,0xff,0x29,0xc,0xd0,0xf,0xe0,0x0,0xf0,0xd9,0xbb,
+    0xff,0xd,0x5,0x0,0xac,0xfe,0xa,0x5,0x0,0xe9,0xff,0xfe,0x7,0xe0,0xff,0xf7,
+    0x92,0xfc,0x4,0xfe,0xb,0x0,0x6,0xf8,0x4,0x0,0x0,0xe0,0x5,0xff,0x24,0x20,
+    0x0,0x10,0xbd,0x0,0x0,0x70,0xf7,0xb5,0x86,0xb0,0xf,0x0,0x26,0x0,0x25,0xa0,
+    0xff,0x78,0x40,0x1e,0x7,0x28,0x0,0xd9,0xad,0xff,0xe0,0x1,0xa1,0x9,0x5c,0x49,
+    0x0,0x8f,0xff,0x44,0x3,0x8,0x1d,0x61,0xa9,0x79,0x80,0xff,0x98,0x61,0x78,0xe0,
+    0x78,0xff,0xf7,0x12,0xdf,0xfe,0xa1,0xe0,0xe0,0x78,0x89,0x2,0x1,0x28,0xff,0x5,
+    0xd0,0x9b,0xe0,0x61,0x78,0x20,0x79,0xff,0xff,0xf7,0xc6,0xfd,0x96,0xe0,0x20,0x79,
+    0xfe,0xeb,0x0,0xd1,0x92,0xe0,0x21,0x28,0x0,0xdb,0x7f,0x8f,0xe0,0xea,0xf7,0x91,
+    0xfe,0x8c,0x29,0x4,0xfe,0xeb,0x0,0x28,0x1d,0xd0,0x5,0xd3,0x85,0xe0,0xff,0x61,
+    0x79,0x20,0x79,0xe5,0xf7,0xd9,0xfb,0xd7,0x80,0xe0,0x68,0xc5,0x0,0x75,0x31,0x1,
+    0xc,0xd1,0xff,0x0,0x98,0xe5,0xf7,0xd7,0xfb,0x0,0x28,0xff,0x76,0xd1,0x10,0x21,
+    0x3c,0x48,0xff,0xf7,0xf5,0x76,0x15,0x0,0x70,0x1d,0x1,0x0,0xe0,0x3,0x21,0xfd,
+    0x5,0x21,0x1,0x7e,0xfe,0x69,0xe0,0x60,0x79,0xff,0x0,0x2,0x21,0x79,0x1,0x43,
+    0x1,0x91,0xff,0xe0,0x79,0x1,0x2,0xa0,0x79,0x8,0x43,0xff,0x2,0x90,0x61,0x7a,
+    0xa,0x2,0x21,0x7a,0xff,0x11,0x43,0x3,0x91,0xe2,0x7a,0x13,0x2,0xff,0xa2,0x7a,
+    0x1a,0x43,0x4,0x92,0x1,0x9b,0xff,0x1b,0x4,0x1,0x93,0x0,0x4,0x2,0x90,0xff,
+    0x8,0x4,0x3,0x90,0x10,0x4,0x4,0x90,0xfd,0x1,0x6f,0x1,0xaf,0xfb,0x48,0xe0,
+    0xe1,0x78,0xff,0x0,0x29,0xd,0xd0,0x1,0x29,0xd,0xd1,0xff,0xfa,0xf7,0x87,0xf8,
+    0xfa,0xf7,0x5,0xf9,0xfa,0xc1,0x2,0x10,0x9b,0x3,0x26,0x32,0x0,0x1,0x21,0xff,
+    0x2,0xe0,0x0,0x22,0x0,0xe0,0x1,0x22,0xfd,0x60,0xe1,0x0,0xaa,0xfd,0x30,0xe0,
+    0xfa,0xf7,0xef,0xdb,0xf8,0x1,0x0,0xd,0x2,0xd9,0xfd,0x29,0xf8,0xc5,0x4,0x29,
+    0x2,0xe1,0x2,0x2,0xd0,0x30,0x0,0x2,0xa7,0x26,0x6,0x43,0x93,0x0,0xb,0x4,
+    0x4,0xb,0x0,0x30,0xdf,0x0,0xe5,0xf7,0x83,0xfb,0x2f,0x6,0xd0,0xfd,0x75,0x11,
+    0x2f,0x4,0x8,0x1f,0x1,0x1,0xd1,0x1,0xc7,0x0,0xff,0x0,0x21,0x9,0x20,0xfb,
+    0xf7,0x9a,0xfd,0xfd,0x5,0x55,0x0,0x89,0xfa,0x0,0x20,0xc0,0x46,0xfe,0x77,0x1,
+    0x25,0x28,0x0,0x6,0xb0,0x70,0xbd,0xeb,0x3e,0x2d,0x7b,0x3,0x96,0x7b,0x1,0xe4,
+    0xf7,0x8d,0xff,0xff,0x20,0x0,0x0,0xf0,0x94,0xff,0x0,0xff,0x25,0x9,0xa9,0xb0,
+    0x48,0x0,0xf0,0xe3,0xfe,0xa3,0x0,0x0,0xd1,0x9,0x95,0x8,0xa9,0xae,0xfa,0xd,
+    0x0,0xdc,0xd,0x4,0x8,0x95,0x5,0xa9,0xab,0xfa,0xd,0x0,0xd5,0xd,0x4,0x5,
+    0x95,0xe5,0x75,0x3,0xfb,0xa9,0xa8,0xf,0x0,0xcd,0xf9,0xc,0x28,0xe,0xff,0xd1,
+    0x3,0x98,0xc0,0x7a,0x20,0x76,0x3,0xff,0x98,0x80,0x7a,0xa0,0x75,0x3,0x98,0x0,
+    0xf7,0x89,0xa0,0x82,0x5,0x0,0x68,0xe0,0x60,0x3,0xff,0x98,0x40,0x68,0x20,0x61,
+    0x4,0xa9,0x9f,0xee,0x29,0x0,0xb8,0xf9,0x10,0x97,0x0,0x4,0x98,0xe0,0xea,0xf,
+    0x0,0x9c,0xf,0x0,0xb0,0xf,0x8,0x20,0x62,0x14,0xeb,0xa9,0x99,0xf,0x0,0xa8,
+    0xf,0x4,0x14,0x98,0xa0,0xaf,0x60,0x2,0xa9,0x96,0xf,0x0,0xa0,0xf,0x4,0x2,
+    0xbf,0x98,0x20,0x63,0x2,0xa9,0x93,0xf,0x0,0x98,0xaa,0xf,0x8,0xe0,0xf,0x0,
+    0x90,0xf,0x0,0x90,0xf,0x8,0x60,0xea,0xf,0x0,0x8d,0xf,0x0,0x88,0xf,0x8,
+    0xa0,0x63,0x13,0xbb,0xa9,0x8a,0xf,0x0,0x80,0xf9,0x14,0xf,0x0,0x13,0xbf,0x98,
+    0x60,0x62,0x12,0xa9,0x87,0xf,0x0,0x78,0xfe,0xf,0x4,0x12,0x98,0xa0,0x62,0x26,
+    0x0,0x44,0xef,0x36,0x11,0xa9,0x83,0x13,0x0,0x6e,0xf9,0x8,0xfe,0x13,0x0,0x11,
+    0x98,0x70,0x63,0x69,0x46,0xd,0xff,0x80,0x6a,0x46,0x10,0xa9,0x7e,0x48,0xff,0xff,
+    0xf7,0xdd,0xf8,0x0,0x28,0x6,0xd1,0x68,0xff,0x46,0x0,0x88,0x4,0x28,0x2,0xd1,
+    0x10,0x76,0xc9,0x0,0x30,0x60,0x1f,0x6,0x1,0xa9,0x77,0x1f,0x0,0xe5,0xcd,0x1f,
+    0x0,0x5,0x1f,0x4,0x3d,0x2,0x1,0x98,0x70,0xaa,0x1d,0xc,0x71,0x1d,0x0,0xbe,
+    0x1d,0x1a,0x61,0x1d,0xa,0x6a,0xaa,0x1d,0x0,0xaf,0x1d,0x18,0xf0,0x3b,0xc,0x64,
+    0x1d,0x0,0xa0,0xaa,0x1d,0x18,0xb0,0x1d,0xc,0x5d,0x1d,0x0,0x91,0x1d,0x18,0x30,
+    0xae,0x59,0x8,0x7,0xa9,0x57,0x1d,0x0,0x82,0x1d,0x0,0x3,0xec,0x1d,0x4,0xa1,
+    0x3,0x7,0x95,0x1b,0x6,0x6,0xa9,0x51,0xea,0x1b,0x0,0x74,0x1b,0x14,0x6,0x1b,
+    0x8,0xf,0xa9,0x4b,0xea,0x1b,0x0,0x66,0x55,0xc,0xc,0x55,0x0,0xf,0x98,0x30,
+    0x5d,0x62,0x1d,0x6,0xe,0xa9,0x44,0x1d,0x0,0x57,0x73,0x14,0x77,0xe,0x98,0x70,
+    0x1d,0x8,0xd,0xa9,0x3e,0x1d,0x0,0x75,0x48,0x1d,0xc,0x40,0x1d,0x0,0xd,0x98,
+    0xb0,0x1d,0x8,0xd7,0xc,0xa9,0x37,0x1d,0x0,0x39,0x3b,0x14,0xc,0x98,0x5d,0xf0,
+    0x1d,0x8,0xb,0xa9,0x31,0x1d,0x0,0x2a,0x1d,0xc,0xee,0xb7,0x3,0xb,0x98,0xb0,
+    0x83,0x9,0xa,0xa9,0x2a,0xea,0x1d,0x0,0x1b,0x1d,0x0,0x7,0x83,0x9,0x3,0xd1,
+    0xa,0xff,0x98,0x0,0x78,0x80,0x21,0x60,0x54,0x9,0xff,0x98,0x20,0x60,0x8,0x98,
+    0x60,0x60,0x5,0xff,0x98,0x30,0x63,0xe5,0x75,0x7,0x98,0xb0,0xff,0x61,0x6,0x98,
+    0xf0,0x61,0xe5,0x62,0xe5,0xff,0x63,0x4,0x20,0x43,0x34,0x20,0x70,0x16,0xff,0xb0,
+    0x70,0xbd,0x0,0x0,0x79,0x79,0x0,0xff,0x0,0x1f,0x1f,0x0,0x0,0x88,0xed,0x0,
+    0xff,0x0,0xe2,0xd3,0x0,0x0,0x2d,0x3e,0x0,0xfb,0x0,0x2e,0x3,0x0,0x3e,0x2d,
+    0x0,0x0,0x41,0xaa,0x3,0x0,0x43,0x3,0x0,0x46,0x3,0x0,0x4c,0x3,0x0,0x69,
+    0xff,0xc2,0x0,0x0,0x7d,0x7d,0x0,0x0,0x74,0xfe,0x7,0x0,0xd7,0xd7,0x0,0x0,
+    0xaf,0x39,0x0,0xff,0x0,0x20,0x4d,0x0,0x0,0xc9,0x1a,0x0,0xeb,0x0,0xb1,0xb,
+    0x0,0xa2,0xb,0x0,0x1,0xd4,0x0,0xfb,0x0,0x2,0x3,0x0,0x94,0xfc,0x0,0x0,
+    0x89,0xbe,0x53,0x0,0x2a,0x1b,0x0,0x0,0x85,0x7,0x0,0x87,0xfa,0x3,0x0,0x3,
+    0x17,0x0,0x10,0xb5,0xd4,0xb0,0x4,0xff,0x0,0x8c,0x21,0x31,0xa8,0xd9,0xf7,0x5d,
+    0xff,0xfe,0xb,0xa8,0x33,0x90,0x13,0xa8,0x38,0xff,0x90,0xf,0xa8,0x39,0x90,0x2c,
+    0xa8,0x3a,0xff,0x90,0x27,0xa8,0x3b,0x90,0x8,0xa8,0x4a,0xff,0x90,0x2,0xa8,0x4b,
+    0x90,0x17,0xa8,0x4c,0xff,0x90,0x68,0x46,0x4d,0x90,0x4,0xa8,0x50,0xff,0x90,0x0,
+    0x20,0x4e,0x90,0x31,0xa8,0xff,0xff,0xf7,0x3c,0xfe,0x21,0x0,0x31,0xa8,0xe4,0x7f,
+    0xf7,0x92,0xfe,0x54,0xb0,0x10,0xbd,0x4b,0x12,0xd5,0x37,0x4b,0x5c,0x16,0x4b,0x8,
+    0xc6,0x4b,0x4,0x80,0xb5,0xdf,0x0,0x22,0x6b,0x46,0x1a,0x53,0x1,0xfe,0xf7,0xdf,
+    0x73,0xff,0x0,0x28,0x2,0x4f,0x5,0x2,0xbd,0xf7,0x0,0x20,0x2,0x1b,0x0,0x62,
+    0x4a,0x3,0xc2,0xff,0x62,0x4a,0x51,0x60,0x0,0x20,0x10,0x80,0xff,0x1,0x20,0x50,
+    0x72,0x60,0x49,0x3,0x20,0x7f,0xf9,0xf7,0x4c,0xff,0x5f,0x49,0x4,0x7,0x0,0xdf,
+    0x48,0xff,0x5e,0x49,0x5,0x7,0x0,0x44,0xff,0xaf,0x0,0xf0,0x99,0xfd,0x2f,0x2,
+    0x56,0x2f,0x0,0x56,0xae,0x2f,0x10,0x0,0xf0,0x91,0x17,0x0,0x55,0x15,0x0,0x0,
+    0xff,0x20,0x70,0x47,0x80,0xb5,0x4f,0x49,0xa,0xff,0x7e,0x0,0x2a,0xf,0xd1,0x49,
+    0x7a,0x0,0xff,0x29,0xc,0xd0,0x0,0x28,0xa,0xd0,0x4e,0xff,0x4a,0x11,0x88,0x0,
+    0x29,0x6,0xd0,0x50,0xff,0x68,0x0,0xf0,0xc7,0xfd,0x0,0x22,0x0,0xff,0x21,0x5,
+    0x20,0x2,0xe0,0x2,0x0,0x0,0xfd,0x21,0x69,0x2,0x5f,0xff,0x1,0xbd,0xf8,0xb5,
+    0xff,0x7,0x0,0xe,0x0,0x15,0x0,0x40,0x4c,0xff,0x20,0x7e,0x0,0x28,0x4,0xd0,
+    0x3,0x22,0xff,0x6,0x21,0x4,0x20,0xf8,0xf7,0x4a,0xff,0xbf,0x27,0x72,0x66,0x72,
+    0xe5,0x60,0xaf,0x2,0x20,0xff,0x82,0x6,0x98,0x60,0x82,0x7,0x98,0x20,0x9f,0x75,
+    0x1,0x20,0x20,0x76,0x45,0x2,0x9f,0x2,0x40,0x7b,0xff,0xf1,0x93,0x0,0xfa,0xf7,
+    0x8c,0xfa,0x9b,0x2,0xfe,0x3b,0x2,0x10,0x28,0x1,0xd1,0x1,0x20,0x0,0xff,0xe0,
+    0x3,0x20,0xc0,0x46,0xc0,0x46,0x1,0xff,0xbd,0x0,0xb5,0x83,0xb0,0x2a,0x48,0x0,
+    0xff,0x2a,0x11,0xd0,0x3,0xc8,0xa,0x0,0x1,0x7f,0x0,0x68,0x46,0xfa,0xf7,0xcc,
+    0xf8,0x51,0x2,0xff,0x0,0x28,0x5,0xd0,0x68,0x46,0x1,0x88,0xff,0x1,0x98,0x0,
+    0xf0,0x7b,0xfd,0x6,0xe0,0xff,0x1,0x22,0x8,0xe0,0x1e,0x49,0x9,0x88,0xed,0x40,
+    0xa7,0x0,0x7b,0xfd,0x1d,0x2,0x80,0x22,0x2,0x7d,0x43,0x89,0x6,0x5,0xff,0x3,
+    0xb0,0x0,0x95,0x1,0xff,0x1b,0x4c,0x3,0xcc,0x8,0x3c,0xfa,0xf7,0xff,0xa3,0xf8,
+    0x0,0x20,0x20,0x80,0x10,0xbd,0xfd,0x30,0x5d,0x0,0x12,0x4c,0x20,0x7d,0x38,0x21,
+    0xbf,0x8,0x42,0x1,0xd0,0x1,0x23,0x77,0x0,0x23,0xff,0x62,0x8a,0xe0,0x68,0x21,
+    0x8a,0x25,0x7a,0xff,0x0,0x2d,0x7,0xd0,0x6d,0x46,0x29,0x80,0xfd,0x1,0x9f,0x1,
+    0x3,0xc8,0xfa,0xf7,0x5,0xfa,0xbf,0x5,0xe0,0x60,0x60,0x21,0x80,0x41,0x6,0x36,
+    0xef,0xf9,0x0,0x20,0x61,0x23,0x1,0x0,0xd0,0x20,0xff,0x80,0x20,0x76,0x3,0xb0,
+    0x30,0xbd,0x9c,0xff,0x49,0x0,0x20,0xc,0x48,0x0,0x20,0x33,0xaf,0x26,0x3,0x0,
+    0x91,0x3,0x0,0x7f,0x3,0x0,0xa4,0xfe,0x13,0x0,0x10,0xb5,0x18,0x4c,0x0,0x22,
+    0x18,0xff,0x49,0x20,0x0,0xf8,0xf7,0x41,0xfd,0x2,0xda,0xf5,0x0,0x84,0x45,0x1,
+    0x32,0x21,0xf,0x2,0x40,0xfd,0xfe,0xdf,0x3,0x1,0x28,0xa,0xd1,0xf9,0xf7,0x9e,
+    0xef,0xf8,0x0,0x28,0x11,0xfb,0x0,0xf9,0xf7,0x74,0x6d,0xfd,0x59,0x3,0x93,0xf8,
+    0xfd,0x0,0x28,0x8,0x19,0x0,0xdd,0x91,0x19,0x0,0x4,0xd0,0x0,0x13,0x0,0x89,
+    0xf8,0xff,0xf9,0xf7,0x72,0xfd,0x1,0xbd,0xbf,0xf3,0xff,0x4f,0x8f,0x4,0x48,0x5,
+    0x49,0x8,0x60,0xee,0x9,0x2,0xfe,0xe7,0x70,0x77,0x0,0x49,0x27,0x3,0xff,0x0,
+    0x4,0x0,0xfa,0x5,0xc,0xed,0x0,0xff,0xe0,0x9,0x68,0x0,0x68,0x42,0x17,0x91,
+    0x2f,0x42,0x1,0xda,0x1,0xd5,0x1,0x8a,0x7,0x0,0xdd,0x3,0xff,0xc0,0x0,0xc0,
+    0x8,0x40,0x1e,0x80,0x41,0xff,0xc0,0x43,0xc0,0xf,0x70,0x47,0xf8,0xb5,0xfd,0x4,
+    0xb3,0x1,0x8,0x68,0x40,0x10,0xc1,0x17,0xff,0x2b,0x68,0x0,0x2b,0x1,0xd1,0xb,
+    0x48,0xff,0x10,0xe0,0xce,0x17,0xcf,0x17,0xda,0x17,0xff,0x53,0x40,0x9a,0x1a,0x70,
+    0x40,0x79,0x40,0xff,0x3b,0x0,0x80,0x1b,0x99,0x41,0xda,0xf7,0xff,0xc7,0xfd,0x29,
+    0x68,0xc9,0x17,0x71,0x40,0xff,0x48,0x40,0x40,0x1a,0x20,0x60,0x20,0x0,0xff,0xf2,
+    0xbd,0x0,0xbf,0xff,0xff,0xff,0x7f,0xfd,0x50,0x43,0x0,0x20,0x68,0x46,0x10,0x8,
+    0x68,0xff,0xc1,0x17,0x12,0x68,0xd3,0x17,0xda,0xf7,0xbf,0x80,0xf8,0x80,0x19,0x40,
+    0x0,0x23,0x2,0x50,0xff,0xbd,0x0,0x68,0x9,0x68,0x4a,0x10,0x90,0xda,0x85,0x8,
+    0x82,0x85,0x8,0xc8,0x7,0x7d,0x2,0x0,0x0,0xff,0x0,0x28,0x0,0xd1,0x70,0x47,
+    0x38,0xb5,0xfb,0x8,0x38,0x43,0x2,0x8,0x28,0x36,0xd3,0x40,0xf7,0x7,0x34,0xd1,
+    0xf5,0x3,0x1a,0x48,0x41,0x68,0xff,0x0,0x29,0x1,0xd0,0x8c,0x42,0x3,0xd2,0xff,
+    0x61,0x60,0x44,0x60,0x19,0xe0,0x19,0x0,0xfd,0x4b,0xa1,0x2,0xd0,0xa3,0x42,0xf9,
+    0xd3,0xb,0xff,0x68,0xcd,0x18,0xac,0x42,0x1d,0xd3,0xa5,0xff,0x42,0x4,0xd1,0x22,
+    0x68,0x9a,0x18,0xa,0xff,0x60,0xc,0x0,0x8,0xe0,0x4a,0x68,0x0,0xff,0x2a,0x3,
+    0xd0,0x23,0x68,0xe3,0x18,0x9a,0xff,0x42,0xf,0xd3,0x62,0x60,0x4c,0x60,0x61,0xfe,
+    0x43,0x0,0xa,0xd0,0x22,0x68,0xa3,0x18,0x8b,0xff,0x42,0x6,0xd1,0x0,0x23,0x3,
+    0x60,0x8,0xff,0x68,0x10,0x18,0x20,0x60,0x48,0x68,0x60,0x7d,0x60,0x65,0x2,0x31,
+    0xbd,0x0,0x0,0xbc,0x9f,0x1,0x7f,0x7,0x49,0x8,0x68,0x0,0x28,0x1,0x5f,0x1,
+    0xff,0x70,0x47,0x5,0x48,0x7,0x22,0x90,0x43,0xff,0x8,0x60,0x4,0x49,0x91,0x43,
+    0x9,0x1a,0xdb,0x1,0x60,0xa7,0x0,0xbf,0xdc,0x23,0x0,0xe7,0x59,0xef,0x0,0x20,
+    0xe0,0x5d,0x81,0x1,0xb5,0x89,0xb0,0xff,0x5,0xab,0x2,0x20,0x2,0x24,0x2,0x25,
+    0xff,0xe,0x68,0x1e,0x60,0x9,0x1d,0x1b,0x1d,0xff,0x6d,0x1e,0xf9,0xd1,0x64,0x1e,
+    0xf6,0xd1,0xff,0x3,0xa9,0x13,0x68,0xb,0x60,0x12,0x1d,0xf7,0x9,0x1d,0x40,0x11,
+    0x0,0x6b,0x46,0x1,0xaa,0xff,0x3,0xa9,0x5,0xa8,0xdc,0xf7,0x32,0xf9,0xff,0x0,
+    0x22,0x9,0x9b,0x1,0xac,0xcf,0x25,0xff,0x2d,0x6,0xe,0x4e,0x9e,0x27,0xff,0x5,
+    0xff,0x20,0x68,0x39,0x0,0xdf,0xf7,0xa5,0xfb,0xff,0x1,0xd8,0x38,0x0,0x4,0xe0,
+    0x31,0x0,0xff,0xde,0xf7,0xcd,0xff,0x0,0xd2,0x28,0x0,0xdf,0x18,0x60,0x52,0x1c,
+    0x24,0x51,0x0,0x2,0x2a,0xff,0xed,0xdb,0xa,0x98,0x0,0x28,0x2,0xd0,0xff,0x0,
+    0x98,0xa,0x99,0x8,0x60,0x9,0x98,0xff,0xb,0xb0,0xf0,0xbd,0xfe,0xff,0xff,0xce,
+    0xff,0xff,0x21,0x9,0x2,0x1,0x40,0xe3,0x22,0x77,0x12,0x2,0x91,0xfd,0x0,0x66,
+    0x49,0x88,0x5b,0x9,0xfe,0xbb,0x2,0x38,0xb5,0x5,0x0,0xc,0x0,0xec,0xff,0x21,
+    0x20,0x0,0x24,0x30,0xd9,0xf7,0xfc,0xfd,0xfb,0x84,0x1,0x83,0x20,0x84,0x20,0x60,
+    0x2,0xff,0x21,0xe1,0x81,0xa0,0x82,0xe0,0x82,0x20,0x7b,0x83,0x21,0x72,0x1,0x0,
+    0xf0,0x1a,0xf8,0xed,0x0,0xff,0xd5,0x0,0x20,0x32,0xbd,0x20,0x8c,0x3,0xff,0x21,
+    0x8,0x42,0x3,0xd0,0x2,0x1d,0x1,0xf7,0x40,0x50,0x1a,0x2b,0x0,0x8c,0xec,0x28,
+    0x3,0xff,0xd3,0x2,0x21,0x6,0x20,0xff,0xf7,0xe2,0xfd,0xf9,0x2d,0x6,0x9c,0xf8,
+    0x80,0x4,0x0,0xc,0xbf,0x32,0xbd,0x30,0xb5,0x87,0xb0,0x5f,0x2,0x68,0xdf,0x46,
+    0xd1,0xf7,0x70,0xfb,0x9b,0x4,0x20,0xc0,0xff,0x43,0x87,0xe0,0x20,0x68,0xff,0x21,
+    0x88,0xff,0x43,0x20,0x60,0x9d,0x49,0x6d,0x1a,0x2a,0xef,0xd0,0x6d,0x1e,0x2b,0x3,
+    0x0,0x2c,0xd0,0xad,0x3b,0x1e,0x30,0xb,0x4,0xad,0x1e,0x2f,0x7,0x0,0xb,0x2,
+    0xf5,0x31,0x3,0x0,0x32,0x3,0x0,0x33,0xd0,0xad,0x1f,0x55,0x37,0x7,0x0,0x38,
+    0x3,0x0,0x39,0x3,0x0,0x2e,0x3,0x0,0xa5,0x47,0x3,0x0,0x36,0x3,0x0,0x17,
+    0x2,0x3b,0x3,0x0,0x3c,0xea,0x3,0x0,0x42,0x3,0x0,0x52,0x3b,0x4,0x54,0xe0,
+    0x69,0x6f,0x46,0x9,0x7b,0x37,0x5,0x2,0x7c,0x34,0x5,0x0,0x77,0x49,0x7b,0x31,
+    0x5,0x0,0xc9,0x7b,0x2e,0x5,0x0,0xb7,0x89,0x7b,0x2b,0x17,0x2,0x7d,0x28,0x17,
+    0x2,0x7d,0x6d,0x25,0x5,0x2,0x7c,0x22,0x17,0x2,0x7c,0x1f,0x23,0x2,0xff,0x7c,
+    0x1c,0xe0,0x1,0x20,0xc0,0x46,0x30,0xae,0x5,0x4,0x2d,0xe0,0x3,0x5,0x0,0x2a,
+    0x5,0x4,0x27,0xaa,0x11,0x4,0x24,0x5,0x4,0x21,0x5,0x4,0x1e,0x5,0x4,0x1b,
+    0xeb,0xe0,0x2,0x5,0x0,0x18,0x3b,0x2,0x7d,0x1,0x43,0xff,0x21,0x60,0x16,0xe0,
+    0x20,0x8c,0x20,0x18,0xdf,0x24,0x30,0xe9,0xf7,0x78,0x35,0x1,0x3,0xd1,0xff,0x20,
+    0x8c,0x0,0x1d,0x20,0x84,0x3,0xe0,0xad,0x5,0x23,0x5,0x50,0xf9,0x4b,0x2,0x1,
+    0x45,0x6,0x68,0xfd,0x8,0x5,0x1,0x0,0x20,0x7,0xb0,0x30,0xbd,0xef,0x0,0x0,
+    0x1f,0xe3,0x3a,0x1,0xb5,0x89,0xb0,0xff,0xc,0x0,0x0,0x27,0x6a,0x46,0x97,0x80,
+    0xff,0x0,0x26,0xea,0xf7,0x17,0xf9,0x5,0x0,0xff,0x63,0xd0,0x21,0x68,0x53,0x48,
+    0x8,0x40,0xbf,0x20,0x60,0x69,0x78,0x9,0x4,0x61,0x2,0x28,0xff,0x7a,0xa0,0x83,
+    0x68,0x7a,0xe0,0x83,0x28,0xff,0x7b,0xc0,0x7,0x7,0xd5,0x2,0xa9,0x68,0xef,0x7c,
+    0xe4,0xf7,0x6c,0x5f,0x1,0x4e,0xd1,0x4,0xff,0x98,0x0,0xe0,0x28,0x69,0x20,0x61,
+    0x28,0xef,0x7b,0x80,0x7,0xc,0x19,0x2,0x7d,0xe4,0xf7,0xfd,0x5f,0x19,0x0,0x41,
+    0xd1,0x28,0x7d,0xc0,0x7,0x7f,0x1,0xd5,0x7,0x98,0x2,0xe0,0x5,0x23,0x0,0x7f,
+    0xa8,0x8a,0x60,0x60,0x28,0x7b,0x40,0x23,0x4,0x75,0xe8,0x23,0x0,0x4d,0x23,0x0,
+    0x2f,0xd1,0xa8,0x23,0x4,0x75,0x8,0x23,0x0,0x6,0x23,0x0,0xe8,0x8a,0xa0,0x23,
+    0x0,0xff,0xc0,0x6,0x14,0xd5,0xe8,0x69,0x0,0x90,0xff,0x68,0x7b,0xff,0xb2,0x87,
+    0x42,0xf,0xd2,0xff,0x2,0xa9,0x0,0x98,0x7a,0x0,0x80,0x18,0xdf,0x40,0x78,0xe4,
+    0xf7,0x32,0x35,0x0,0x14,0xd1,0xff,0x2,0xa8,0xc0,0x88,0x36,0x18,0xb6,0xb2,0xff,
+    0x7f,0x1c,0xec,0xe7,0xee,0x69,0xa6,0x81,0xbf,0x20,0x68,0x29,0x49,0x1,0x40,0xa5,
+    0x0,0x7b,0xf7,0x0,0x7,0xf,0x83,0x2,0x7e,0xe4,0xf7,0x1d,0xfa,0x29,0x0,0x1,
+    0xfd,0x1,0x3e,0xe0,0x2,0x9e,0x20,0x7f,0x68,0x2,0xa9,0x9,0x79,0x9,0x2,0xc9,
+    0x2,0xff,0x0,0xe0,0xae,0x69,0x27,0x8c,0xe5,0x19,0x7f,0x24,0x35,0x0,0x2e,0x24,
+    0xd0,0x30,0x0,0x1,0xdf,0xd2,0xfb,0x0,0x90,0x28,0x7,0x0,0xce,0xfb,0xff,0x0,
+    0x99,0x8,0x18,0x80,0xb2,0x3,0x21,0xff,0x8,0x42,0x4,0xd0,0x4,0x22,0x1,0x40,
+    0xbf,0x51,0x1a,0x6a,0x46,0x91,0x80,0xa7,0x1,0x88,0xff,0x40,0x18,0xc0,0x19,0xec,
+    0x28,0x8,0xd2,0xdb,0x31,0x0,0x29,0x2,0xc1,0xfb,0x5,0x2,0xb6,0xfb,0xdf,0x60,
+    0x83,0x3,0xe0,0x4,0x63,0x5,0x9e,0xf8,0xbf,0x20,0x8c,0x61,0x8b,0x40,0x18,0x2b,
+    0x6,0x24,0xdf,0x30,0x41,0x10,0x89,0xf,0x4b,0x0,0x3,0x0,0xbf,0xc,0x9,0xb0,
+    0xf0,0xbd,0x2,0x67,0x1,0xff,0xfd,0xff,0x2,0x6,0xf4,0xb5,0x84,0xb0,0x7,0x0,
+    0xff,0xe,0x0,0x0,0x24,0x0,0x25,0x39,0x0,0xff,0x2,0xa8,0xfe,0xf7,0xd7,0xfd,
+    0x2,0xa8,0xff,0x3,0xc8,0x6a,0x46,0x3,0xc2,0x8,0x46,0xfe,0xbd,0x1,0xd0,0x69,
+    0x46,0x49,0x88,0x2,0x29,0xdf,0xf,0xd2,0x69,0x46,0x38,0x65,0x0,0x99,0xfb,0xdf,
+    0x1,0x98,0x0,0x28,0x4,0x15,0x4,0x4,0x9a,0xff,0x11,0x80,0x8,0xe0,0x4,0x98,
+    0x4,0x80,0xff,0x1,0x25,0x5,0xe0,0x49,0x1e,0x89,0x0,0xfe,0x11,0x2,0x0,0x1d,
+    0x30,0x60,0x28,0x0,0x5,0xfe,0x67,0x0,0x30,0xb5,0x83,0xb0,0x0,0x24,0xff,0xff,
+    0x23,0x12,0x33,0x9a,0x42,0x1,0xdb,0x3,0xff,0x24,0x10,0xe0,0x6b,0x46,0x18,0x80,
+    0xd2,0xff,0x1c,0x90,0x8,0x40,0x1c,0x6a,0x46,0x50,0xff,0x80,0xef,0xf3,0x10,0x85,
+    0x72,0xb6,0xa,0xff,0x0,0x68,0x46,0x3,0xc8,0xf9,0xf7,0x56,0xff,0xf9,0x85,0xf3,
+    0x10,0x88,0x20,0x0,0x3,0xff,0xb0,0x30,0xbd,0x0,0x0,0x10,0xb5,0x92,0xff,0x4c,
+    0x0,0x20,0x20,0x70,0x0,0x22,0x91,0xff,0x49,0x20,0x0,0xc,0x30,0xf8,0xf7,0x3e,
+    0xff,0xfa,0xc,0x34,0x20,0x0,0xf8,0xf7,0x52,0xff,0xfa,0x10,0xbd,0x10,0xb5,0x8a,
+    0x4c,0x21,0xff,0x78,0x0,0x29,0x3,0xd0,0x8a,0x4a,0x2,0xff,0x21,0x0,0x20,0x33,
+    0xe0,0xa1,0x80,0xe1,0xff,0x80,0x81,0x88,0x61,0x80,0x40,0x88,0x20,0xff,0x81,0x8,
+    0x0,0xfe,0xf7,0x6b,0xfb,0x1,0xff,0x28,0x3,0xd1,0x83,0x4a,0x1,0x21,0xa0,0xef,
+    0x88,0x24,0xe0,0x2,0xb,0x0,0x80,0x4a,0xb,0xfe,0xb,0x0,0x1e,0xe0,0x20,0x89,
+    0x45,0x28,0x3,0xef,0xd3,0x7c,0x4a,0x7,0xd,0x0,0x17,0xe0,0x0,0xef,0x28,0x9,
+    0xd1,0xa,0x67,0x0,0x60,0x88,0xfe,0xff,0xf7,0x31,0xfc,0x8,0x28,0x10,0xd0,0x0,
+    0xbf,0xf0,0x61,0xf8,0x10,0xbd,0x2,0x7b,0x4,0xfa,0xf7,0x21,0x49,0x0,0x7d,0x6,
+    0x6,0xfa,0x70,0x4a,0x7f,0x4,0x21,0xe0,0x88,0x0,0xf0,0xe7,0x1d,0x0,0xff,0xf8,
+    0xb5,0x7,0x0,0x0,0x25,0x0,0x26,0xef,0x69,0x4c,0x20,0x78,0x67,0x0,0xd0,0x69,
+    0x4a,0xfd,0x6,0x85,0x0,0x41,0xe0,0x78,0x88,0xa1,0x88,0xff,0x81,0x42,0x2,0xd0,
+    0x9,0x26,0xe0,0x80,0xff,0x1c,0xe0,0xa0,0x80,0xe0,0x80,0x41,0x1c,0xff,0xa1,0x80,
+    0x79,0x68,0xfe,0xf7,0xa6,0xfb,0xff,0x21,0x89,0x49,0x1e,0x21,0x81,0x9,0x4,0xff,
+    0xd,0xd0,0x3,0x28,0xd,0xd0,0xa0,0x88,0xea,0x19,0x2,0xb9,0x19,0x0,0x99,0x19,
+    0x8,0xe1,0x88,0x49,0xff,0x1c,0xe1,0x80,0x3,0x28,0x4,0xd1,0x9,0xff,0x26,0x25,
+    0x70,0xfe,0xf7,0x1f,0xfc,0x16,0xbe,0xab,0x0,0x0,0x28,0xc,0xd1,0x6,0x8b,0x0,
+    0xa0,0xdf,0x88,0x81,0x0,0x89,0xb2,0xa5,0x2,0xa0,0xfb,0xf7,0x8,0x28,0xe,0xa5,
+    0x0,0xe,0xf8,0xf1,0xbd,0x7e,0xa1,0x12,0xb5,0xf9,0x47,0x4a,0x31,0x0,0xa1,0x2,
+    0xfd,0x96,0x19,0x0,0x80,0xb5,0x42,0x4b,0x19,0x78,0xff,0xa,0x29,0xc,0xd1,0x0,
+    0x28,0x7,0xd1,0xff,0x4,0x21,0x8,0x20,0x18,0x70,0x3f,0x4a,0x7d,0xd8,0x1d,0x0,
+    0x87,0xf8,0x1,0xbd,0x8,0xf5,0x0,0xdf,0x1,0xbd,0x6,0x29,0xf9,0x1d,0x0,0x2,
+    0xd1,0xff,0x0,0x21,0x4,0x20,0xef,0xe7,0x8,0x28,0xff,0xf2,0xd0,0x7,0x28,0x12,
+    0xd8,0x1,0xa1,0xff,0x9,0x5c,0x8f,0x44,0x1a,0x1e,0x16,0x12,0xff,0xe,0x1e,0xa,
+    0x6,0xb,0x21,0xa,0xe0,0xff,0x5,0x21,0x8,0xe0,0x2,0x21,0x6,0xe0,0xff,0x9,
+    0x21,0x4,0xe0,0x1,0x21,0x2,0xe0,0xdf,0x3,0x21,0x0,0xe0,0x0,0xef,0x0,0xd5,
+    0xe7,0xf7,0x10,0xb5,0x28,0x1,0x5,0x8,0xd1,0x28,0x4a,0xbd,0x5,0x4f,0x1,0x0,
+    0xf0,0x58,0xf8,0xb5,0x3,0xfe,0xd7,0xf7,0xc0,0xfb,0xa5,0x3,0x21,0x1d,0x2,0x0,
+    0xb,0xff,0x28,0x1,0xd1,0xc,0x21,0x16,0xe0,0x6,0xbe,0x7,0x0,0x5,0x21,0x12,
+    0xe0,0x4,0x7,0x0,0x3,0xaf,0x21,0xe,0xe0,0xa,0x7,0x0,0x9,0x5f,0x0,0x8,
+    0xca,0x7,0x0,0x7,0x5f,0x0,0x2,0x7,0x0,0x5f,0x2,0xd,0x28,0xfd,0x0,0x93,
+    0x0,0x21,0x70,0xff,0xe7,0x20,0x78,0xdd,0x3,0x5b,0x0,0x11,0x4a,0x8,0x5b,0x0,
+    0x40,0x1e,0xff,0x80,0xb2,0x0,0xf0,0x28,0xf8,0xb,0x20,0xb7,0x13,0xe0,0x7,0xcf,
+    0x1,0xc,0x4a,0x87,0x0,0x20,0x97,0x6,0xe0,0xc,0x21,0x1,0x9,0xb,0x0,0x21,
+    0xa,0x17,0xdd,0xf8,0xf,0x7,0x3e,0xf9,0xd,0x89,0x0,0x10,0xbd,0xff,0x0,0x0,
+    0xd0,0x47,0x0,0x20,0x9b,0x2e,0xf7,0x3,0x0,0xb9,0x3,0x0,0x1c,0xb5,0x5,0x9c,
+    0xff,0x1,0x94,0x4,0x9c,0x0,0x94,0xfe,0xf7,0xdf,0xbb,0xfd,0x1,0x20,0x16,0x29,
+    0x1,0xfe,0xf7,0xd7,0xca,0xfd,0x1,0x7,0x4,0xd5,0x7,0x0,0x0,0x0,0xff,0x10,
+    0xb5,0x4,0x0,0xfe,0xf7,0x24,0xfa,0xff,0x60,0x70,0x1,0x20,0xa0,0x70,0x7,0x20,
+    0xff,0xe0,0x70,0x4,0x48,0x60,0x60,0xc3,0x20,0xff,0x40,0x0,0xa0,0x60,0x0,0x20,
+    0xa0,0x81,0xfe,0x53,0x0,0xbf,0x33,0xa3,0x98,0x0,0x10,0xb4,0xfc,0x5,0x1,0x9f,
+    0x0,0xa,0xe0,0x13,0x0,0x1c,0x33,0xff,0x1c,0x78,0x4,0x71,0x52,0x6a,0x2,0x60,
+    0xff,0x99,0x60,0xd9,0x60,0x2,0x68,0x0,0x2a,0xff,0xf4,0xd1,0x1,0x60,0xff,0x21,
+    0x1,0x71,0xff,0x10,0xbc,0x70,0x47,0x70,0xb4,0x0,0x23,0xff,0x0,0x22,0x0,0x29,
+    0x1,0xd1,0x0,0x20,0xff,0x42,0xe0,0x8c,0x6a,0x0,0x2c,0x14,0xd0,0xfb,0x84,0x42,
+    0xed,0x0,0x20,0x3b,0xe0,0x22,0x68,0xff,0x91,0x42,0x3,0xd1,0x4a,0x6a,0x22,0x60,
+    0xff,0x7,0xe0,0x22,0x0,0x0,0x2a,0x4,0xd0,0xff,0x54,0x6a,0x8c,0x42,0xf9,0xd1,
+    0x4c,0x6a,0xff,0x54,0x62,0x4b,0x62,0x8b,0x62,0x1,0x22,0xff,0x88,0x62,0x4,0x68,
+    0x0,0x2c,0xe,0xd0,0xff,0xb,0x7f,0x5,0x79,0x9d,0x42,0x2,0xd2,0xff,0x26,0x7f,
+    0xb3,0x42,0x6,0xd3,0x26,0x7f,0xff,0xae,0x42,0x7,0xd2,0x9d,0x42,0x1,0xd3,0xff,
+    0xb3,0x42,0x3,0xd2,0x4c,0x62,0x1,0x60,0xff,0x14,0xe0,0x4,0x0,0x60,0x6a,0x0,
+    0x28,0xaf,0xe,0xd0,0x25,0x7f,0x27,0x2,0x6,0x27,0x4,0x6,0x7a,0x27,0x0,0xf2,
+    0x27,0x8,0xee,0xd2,0x48,0x62,0xbb,0x1,0xbf,0xd1,0x61,0x62,0x10,0x0,0x70,0x97,
+    0x0,0x1,0xfd,0x0,0x91,0x2,0x70,0x47,0x8,0x68,0x0,0x28,0xff,0x7,0xd0,0x2,
+    0x7f,0xa,0x71,0xa,0x68,0xff,0x52,0x6a,0xa,0x60,0x0,0x21,0x41,0x62,0xff,0x81,
+    0x62,0x70,0x47,0x0,0x28,0x2,0xd0,0xc1,0x0,0x1b,0x0,0xa9,0x2,0xd,0x0,0x3,
+    0x0,0x1b,0x3,0x40,0x30,0xff,0x4,0x21,0x1,0x70,0x41,0x70,0x7,0x21,0xbf,0x81,
+    0x70,0xf8,0xf7,0x3c,0xfb,0x77,0x1,0x41,0xbf,0xc0,0x43,0xc0,0xf,0x80,0x34,0x6f,
+    0x7,0x80,0xff,0xb5,0x0,0xf0,0x1,0xf8,0x2,0xbd,0x70,0xff,0xb5,0x80,0x24,0x64,
+    0x1,0xa8,0x48,0x4,0xfd,0x60,0x3,0x4,0x4d,0xa8,0x48,0x28,0x80,0x80,0xff,0x1d,
+    0x28,0x80,0xa7,0x48,0x1,0x68,0x80,0xff,0x22,0xa,0x43,0x2,0x60,0x1,0x20,0xa5,
+    0xff,0x4e,0x31,0x68,0x1,0x43,0x31,0x60,0x31,0xdf,0x8a,0xc9,0xb,0xfc,0xd1,0xb,
+    0x0,0x40,0xf9,0xff,0xd1,0x30,0x68,0x2,0x21,0x88,0x43,0x30,0xef,0x60,0x30,0x8a,
+    0xc0,0x13,0x0,0x9e,0x48,0x30,0xff,0x60,0x70,0x68,0x9d,0x49,0x1,0x40,0x71,0xfe,
+    0x7,0x0,0x21,0x9,0x1,0x43,0x71,0x60,0xff,0x7f,0xf7,0x7f,0xfa,0x40,0x0,0xfe,
+    0x21,0x13,0x0,0xff,0x61,0x7,0x20,0xb0,0x73,0x2,0x20,0x70,0xaf,0x73,0x31,0x68,
+    0x8,0x33,0xc,0x93,0x69,0x0,0x93,0xff,0x4d,0x0,0x20,0xc0,0x43,0x28,0x70,0x68,
+    0xff,0x78,0x0,0x21,0x69,0x70,0xff,0xf7,0x6a,0xfb,0xfa,0x8f,0x85,0x0,0x68,0x78,
+    0x70,0xbd,0x38,0x7f,0xb5,0x5,0x0,0xc,0x0,0x8b,0x48,0xe5,0x0,0x5f,0x56,0x1,
+    0x29,0x6,0xe0,0xf,0x6,0x87,0xf,0x4,0xff,0x0,0x29,0x6,0xd0,0x4,0x21,0x41,
+    0x70,0xff,0x1,0x22,0x6,0x21,0x4,0x20,0xf8,0xf7,0xfb,0x83,0xf9,0xe2,0x1,0x0,
+    0x0,0xf0,0x2,0xf8,0xff,0x0,0x20,0x32,0xbd,0x7e,0x4a,0x50,0x60,0x7f,0xd1,0x60,
+    0x90,0x60,0x11,0x61,0x7d,0xc3,0x0,0xef,0x78,0x4a,0xa,0x40,0xc3,0x0,0x68,0xc0,
+    0x22,0xfb,0x92,0x2,0xcd,0x2,0x7,0x21,0x41,0x72,0x70,0xff,0x47,0x30,0xb5,0x83,
+    0xb0,0x5,0x0,0x73,0xff,0x4c,0x0,0x20,0x20,0x56,0x0,0x21,0xc9,0xbf,0x43,0x88,
+    0x42,0x4,0xd1,0x2,0x4d,0x8,0x5c,0xf7,0xf9,0x21,0x69,0x17,0x2,0x1,0x28,0x5,
+    0xd1,0xff,0x1,0x29,0x3,0xdb,0x62,0x78,0x10,0x23,0xff,0x13,0x43,0x63,0x70,0xe3,
+    0x68,0x62,0x78,0xff,0x1,0x92,0x59,0x1a,0x89,0xb2,0x0,0x91,0xff,0x9b,0xb2,0x62,
+    0x68,0x29,0x0,0xc0,0xb2,0xff,0xff,0xf7,0xee,0xf9,0x3,0xb0,0x30,0xbd,0xff,0x80,
+    0xb5,0x1,0x20,0xff,0xf7,0xd4,0xff,0xfd,0x5f,0x9f,0x2,0x70,0xc9,0x43,0x1,0x70,
+    0x5f,0xfb,0x48,0x1,0x79,0x1,0x5,0x22,0x2,0x70,0x80,0xff,0x78,0x40,0x8,0x8,
+    0x42,0x2,0xd1,0x2,0xee,0x5b,0x0,0xea,0xfa,0x1,0x71,0x1,0x57,0x4d,0x1,0xbf,
+    0x26,0xa8,0x89,0x40,0x8,0x30,0x15,0x0,0xa8,0xff,0x89,0x30,0x42,0x4,0xd0,0x51,
+    0x4c,0x60,0xff,0x78,0x1,0x21,0x1,0x43,0x61,0x70,0xa8,0xff,0x7a,0x40,0x8,0x1,
+    0x21,0x8,0x42,0xa8,0xbf,0x7a,0x27,0xd0,0x8,0x42,0x27,0xf9,0x1,0xf8,0xef,0xf7,
+    0xcf,0xfa,0x49,0xa9,0x10,0xd,0xd0,0xa8,0xb7,0x89,0x0,0x9,0x35,0x0,0xd1,0x3,
+    0xb1,0x8,0x3,0xfb,0xf9,0x0,0x7d,0x0,0x95,0xff,0x0,0x20,0x60,0xff,0x70,0xa8,
+    0x89,0x1,0x7,0xc9,0xf,0x21,0xdf,0x70,0x2,0x20,0x28,0x72,0x27,0x0,0x6,0xc0,
+    0xdf,0xe,0x6,0x40,0x30,0x0,0x8b,0x1,0xf9,0x70,0xfd,0xbd,0x85,0x0,0xd0,0xff,
+    0xf7,0xa9,0xff,0x70,0xef,0xbd,0xa8,0x7a,0x80,0x93,0x0,0x52,0xd0,0x33,0x7e,0x57,
+    0x6,0x22,0xd2,0x43,0x90,0x42,0x5,0x1,0xd,0x7f,0xdb,0xf8,0x70,0xbd,0x1,0x28,
+    0x2c,0x9b,0x0,0xfd,0x80,0xa3,0x0,0x15,0xd0,0x20,0x69,0xe1,0x68,0xff,0x88,0x42,
+    0x11,0xd0,0x1,0x28,0x2,0xdb,0xff,0x60,0x78,0x10,0x21,0x3,0xe0,0x0,0x28,0xdf,
+    0x3,0xd5,0x60,0x78,0x20,0xb1,0x4,0x28,0x68,0x7f,0x71,0x4,0x1,0x43,0x29,0x60,
+    0x4,0x71,0x0,0xfa,0x59,0x0,0x89,0xdb,0x3,0x20,0x69,0x1,0x28,0x4,0xff,0xdb,
+    0xa1,0x68,0xa,0x78,0x49,0x1c,0xa1,0xff,0x60,0x0,0xe0,0x0,0x22,0x2a,0x75,0x40,
+    0xaf,0x1e,0x20,0x61,0x19,0x35,0x4,0x14,0x3f,0x0,0x14,0xbe,0x23,0x4,0x8,0xdb,
+    0xa9,0x89,0xc9,0x2f,0x0,0xa1,0xdf,0x68,0x2a,0x7d,0xa,0x70,0x2b,0x2,0x1,0xe0,
+    0x4f,0x4,0x21,0xa9,0x72,0x2b,0x2,0x61,0x2,0x8,0x61,0x4,0xff,0x70,0xbd,0x0,
+    0x0,0x80,0xe1,0x0,0xe0,0xff,0x80,0xe2,0x0,0xe0,0x2,0xc,0x0,0x40,0xff,0xc,
+    0x42,0x0,0x0,0x20,0x4,0x0,0x40,0xff,0x0,0x1c,0x0,0x42,0x90,0x0,0x20,0x0,
+    0xff,0xff,0xff,0xfb,0xff,0x12,0x2,0x0,0x0,0x53,0x98,0x48,0xc,0x0,0x27,0x0,
+    0x4,0x17,0x0,0xc,0x3,0x0,0xff,0x1,0x0,0x0,0xe0,0x49,0x1c,0xa,0x78,0xff,
+    0x0,0x2a,0xfb,0xd1,0x8,0x1a,0x70,0x47,0xfe,0x22,0x0,0xe0,0x52,0x1c,0x13,0x78,
+    0x0,0x2b,0xff,0xfb,0xd1,0xb,0x78,0x13,0x70,0x0,0x2b,0xff,0x2,0xd0,0x52,0x1c,
+    0x49,0x1c,0xf8,0xe7,0xff,0x70,0x47,0x8,0x80,0x0,0x22,0x4a,0x80,0xff,0x8,0x4b,
+    0x98,0x42,0x3,0xd1,0x10,0x20,0x7f,0x48,0x80,0x29,0xa2,0x6,0xe0,0x5,0xd,0x4,
+    0xfd,0x88,0xd,0x0,0x0,0xbf,0x3,0xa2,0x4a,0x60,0xff,0x70,0x47,0x0,0x0,0x2d,
+    0x3e,0x0,0x0,0xbb,0x88,0xed,0x3,0x0,0x0,0x3,0x0,0x5f,0x0,0x0,0xff,0x60,
+    0x8f,0xc2,0x5,0xb0,0x94,0x65,0x0,0xff,0x80,0x3d,0xa,0x17,0x80,0x66,0x66,0x26,
+    0xee,0xf,0x2,0x95,0xd4,0x9,0xf,0xc,0x40,0x42,0xf,0xf2,0x27,0x4,0x4,0x3,
+    0x0,0x5,0x2,0x9a,0x99,0x1,0x0,0xf6,0x87,0x0,0x0,0xf,0xf,0x4,0x20,0x0,
+    0x3f,0x1b,0x57,0xd,0x0,0x27,0xa,0x2,0x80,0x3,0x0,0x40,0x3,0x6,0x79,0x5c,
+    0x1c,0x0,0x57,0xa,0x40,0xe1,0x7a,0x14,0x3,0x0,0xff,0x24,0x14,0xae,0x47,0x1,
+    0x28,0x5c,0x8f,0xff,0x2,0xdc,0x46,0x3,0x0,0x80,0x99,0x99,0xff,0x59,0x0,0xcd,
+    0xcc,0x5c,0xff,0xff,0xff,0x4b,0x7f,0x1e,0x32,0x0,0x1d,0x3,0x10,0x0,0x0,0x2,
+    0x9a,0x0,0x5d,0x6,0x6a,0x0,0x5,0x0,0x7,0xf,0x8,0x0,0x82,0x0,0xfe,0x5,
+    0x2,0x0,0x0,0x3,0x15,0x1,0x5,0xe3,0xde,0x26,0x6,0x0,0x0,0x1f,0x3,0x19,
+    0x4,0x0,0x1,0xfc,0x0,0x0,0x7,0x2,0x9c,0x34,0x3,0x0,0x7,0x1,0x7b,0x7,
+    0xe3,0x2b,0x2,0x9,0x9,0x10,0x10,0x1f,0xa,0x7c,0x3,0x0,0x1f,0xc,0x4,0x1,
+    0x3,0xe3,0x10,0x12,0x0,0x1f,0x8,0x0,0x10,0x0,0x17,0x1f,0xa,0x0,0x8,0x1f,
+    0x2,0xdf,0x5,0x1,0xb,0xe3,0x20,0xb,0x0,0xe,0xc,0x97,0x10,0x10,0x11,0x1f,
+    0xa,0x40,0x24,0x6,0x1f,0x2,0x8,0x97,0x1,0xc,0xe3,0xc,0x3,0xe,0x3f,0x0,
+    0x1f,0x22,0x9,0x7,0x1,0xd,0xe3,0x5c,0x0,0x3f,0x6,0xb3,0x2,0x3,0x2,0x1f,
+    0x8,0x9d,0x98,0x1f,0x0,0xb,0x1,0xf,0xbf,0x4,0x22,0x0,0x0,0x65,0x1f,0x16,
+    0x2,0x6,0x3,0x4,0x1,0x2,0x0,0x8e,0x1f,0x0,0xa7,0xc,0x1,0x10,0x1f,0x16,
+    0x78,0x3,0x4,0x1,0x4,0x0,0x1d,0x90,0x1f,0x0,0xd,0x1,0x11,0x1f,0x4,0x16,
+    0x2,0x1f,0x4,0xda,0x23,0x3,0x7,0x1,0x4,0x0,0x94,0x1f,0x0,0x1d,0x1,0x91,
+    0x12,0x1f,0x4,0x16,0x2,0x1f,0x4,0x5,0x3,0x4,0x1,0x2,0x0,0x5d,0x92,0x1f,
+    0x0,0x12,0x1,0x16,0x3f,0xd,0x10,0xfb,0x8,0x74,0x1c,0x5,0x0,0x0,0x88,0x1f,
+    0x0,0x1a,0x1,0x19,0x1f,0x34,0x77,0x20,0x1,0x1e,0x1f,0x34,0x1c,0x1,0x1b,0x1f,
+    0x34,0x77,0x18,0x1,0x14,0x1f,0x34,0x11,0x1,0x15,0x1f,0x1c,0x3b,0xff,0xff,0x1f,
+    0xe,0x1f,0x1,0x1d,0x3f,0x34,0x0,0x4,0xff,0x2,0x0,0x20,0x94,0x4,0x0,0x20,
+    0x8,0xfe,0xae,0x0,0x9c,0x5,0x0,0x20,0xa4,0x6,0x0,0xeb,0x20,0x20,0x3,0x0,
+    0x18,0xb,0x0,0xb0,0x7,0x0,0xbf,0x20,0x3c,0x8,0x0,0x20,0xc8,0x3,0x0,0x48,
+    0x99,0x9,0x7,0x0,0x3,0x0,0x48,0xa,0x7,0x0,0x3,0x0,0x8c,0xd6,0x2f,0x0,
+    0x7c,0x0,0xf,0x0,0xf,0xf,0x0,0xb,0x0,0xfb,0x20,0x30,0x2b,0x0,0x7c,0x1,
+    0x0,0x20,0x10,0x52,0x4b,0x0,0x84,0x53,0x0,0x5a,0x2,0xfc,0x1f,0x2,0xc,0x1f,
+    0x0,0x4a,0x3,0x2,0xd,0xb,0x0,0xe,0x3,0x0,0x2b,0x0,0xc8,0x33,0x2,0xd8,
+    0xb,0x2,0x13,0x0,0x9f,0xa,0x7b,0x47,0xfc,0x3,0x0,0x0,0xff,0xe9,0x4c,0x3,
+    0x0,0x5d,0x44,0x2,0x0,0x7d,0x7f,0x3,0x0,0xfb,0xdb,0x1,0x0,0xa3,0x7,0x0,
+    0xdf,0x3,0xdc,0x1,0x0,0x7,0x3,0x0,0x8d,0x45,0xaa,0x23,0x6,0xf,0x7,0x0,
+    0x13,0xf,0x0,0x17,0x3,0x0,0xaf,0x2a,0x37,0x8,0xfd,0x13,0x0,0x2b,0xf,0x0,
+    0x2f,0x3,0x0,0x0,0x2,0x5f,0x11,0xde,0x2,0x0,0xeb,0x3b,0x0,0x1d,0x33,0x8,
+    0xf5,0x2f,0xf,0x0,0x33,0x3,0x0,0x98,0xff,0xff,0xff,0x94,0x73,0xa,0x0,0x2,
+    0x75,0x13,0x0,0x4d,0x3,0x0,0x0,0xa,0xdd,0xfd,0x2a,0xb,0x6,0x85,0x4d,0x3,
+    0x0,0xd9,0x23,0xf7,0x2,0x0,0xef,0x3,0x0,0x5,0x24,0x2,0x0,0x7d,0xff,0x8b,
+    0x0,0x41,0x26,0x2,0x0,0xc1,0x3,0x0,0xfd,0xb,0x63,0x8,0xad,0x25,0x2,0x0,
+    0x9d,0x2c,0x97,0x2,0x0,0xa1,0x3,0x0,0xc5,0x3,0x0,0x0,0x2,0x51,0x4f,0x27,
+    0x2,0x0,0x85,0x43,0x0,0x87,0xa,0xb9,0x3b,0x0,0xa5,0x15,0x5f,0x0,0xbd,0x2b,
+    0x0,0x0,0x2,0xa5,0x27,0x0,0xb5,0x5a,0x3,0x0,0xd0,0x87,0x38,0x1f,0x43,0xb,
+    0x6,0x7,0x87,0x0,0xbf,0xf1,0x40,0x2,0x0,0x7,0x41,0xf,0x7,0x1d,0x24,0x7,
+    0x0,0xf,0xb,0xb1,0xb,0x0,0x0,0x2,0x61,0x7,0x0,0xf,0xb,0xad,0x51,0x37,
+    0x8,0x11,0x42,0xf,0x1f,0x57,0x27,0x0,0x71,0xd4,0x33,0x8,0xf,0x4b,0x2d,0x3f,
+    0x8,0x9d,0x87,0x0,0x11,0x5d,0x27,0x2,0x0,0x27,0x3,0x0,0x87,0x2,0x83,0x7,
+    0x0,0x87,0xa,0x4b,0x2b,0x5e,0x2f,0x6,0xc1,0x7,0x0,0x87,0xa,0x3d,0x1f,0x0,
+    0x3e,0x3f,0x4,0x5f,0x2,0x0,0x29,0x60,0xf,0xf,0x87,0x2,0xc5,0xe1,0x1b,0x0,
+    0xe5,0x33,0x8,0x87,0xa,0xf,0x3b,0x57,0x8d,0x8c,0x3f,0x9,0x87,0x0,0x1,0x85,
+    0xd7,0x1,0x3,0x0,0x87,0x2,0x7d,0x6c,0x7,0x0,0x87,0xa,0x21,0x88,0x23,0x6,
+    0x35,0x87,0x87,0xe,0xf9,0x33,0x1f,0x0,0x0,0x2,0x7d,0x89,0x2,0x0,0x19,0x7c,
+    0x43,0x0,0x87,0x12,0x89,0x86,0x2,0x0,0x61,0x2b,0x0,0xd6,0x87,0x52,0x45,0x51,
+    0xb,0x6,0xb5,0x87,0x0,0x51,0x50,0x87,0x2,0x0,0x67,0x3,0x0,0x87,0x4,0x7,
+    0x0,0x87,0xa,0xaf,0xb2,0x23,0x8,0xdd,0x13,0x0,0x87,0xa,0xd9,0x53,0x13,0x6,
+    0x6d,0x95,0x52,0x97,0x1f,0xbf,0x27,0x0,0xf9,0x3,0x0,0x87,0x52,0x2f,0xf5,0x0,
+    0xb,0x6,0xd5,0x87,0x0,0x7d,0xf8,0x1,0x0,0xd5,0x93,0x3,0x0,0xd1,0x3,0x0,
+    0xff,0x8b,0x0,0x31,0xfb,0xd7,0x1,0x0,0xcd,0x3,0x0,0xb,0x63,0x8,0x91,0xfa,
+    0xd7,0x1,0x0,0x99,0x2f,0x0,0xf9,0x3,0x0,0x85,0xfc,0x5a,0x13,0x6,0xcd,0x7,
+    0x0,0xcf,0xff,0x87,0xe,0xdb,0x3b,0x0,0xa5,0x15,0x5f,0x0,0xa1,0x2b,0x0,0x0,
+    0x2,0xfd,0x2b,0x0,0x51,0xcd,0x1,0x87,0x3e,0xb9,0x74,0xeb,0x8,0x87,0x0,0x55,
+    0x6e,0x97,0x2,0x0,0x6b,0x3,0x0,0xc5,0x3,0x0,0x87,0x2,0xe5,0xbf,0x6f,0x2,
+    0x0,0x75,0x70,0x2,0x87,0xc,0x39,0xff,0x72,0x2,0x0,0x71,0x71,0x2,0x0,0x25,
+    0x32,0x7,0x0,0x81,0x23,0x0,0x0,0x2,0x9,0x73,0x13,0x0,0x43,0x0,0x92,0x87,
+    0xa,0x2d,0x33,0x0,0x87,0x2,0x75,0x23,0x0,0x0,0x2,0xd1,0xb2,0x2f,0x0,0x29,
+    0xb,0x0,0x87,0x3a,0xe3,0xee,0x3f,0x6,0xe5,0xbe,0x87,0x0,0x6d,0xe8,0x1,0x0,
+    0x83,0x3,0x0,0x99,0xfc,0x3,0x0,0x87,0x2,0x89,0xea,0x1,0x0,0x21,0xeb,0xfe,
+    0xf,0xf,0xf5,0xe9,0x1,0x0,0x5d,0xef,0x1,0x8b,0x0,0x61,0x3,0x0,0x85,0x3,
+    0x0,0xc7,0x4,0x1f,0x0,0x85,0x24,0x43,0x0,0x87,0xa,0x41,0x23,0x0,0x87,0x2,
+    0x5,0x3b,0x0,0x0,0x2,0x65,0x65,0x27,0x0,0x75,0x3,0x0,0x87,0x3a,0x87,0xe4,
+    0x2f,0x6,0x7d,0xed,0x87,0x0,0x63,0xde,0x1,0x0,0x79,0x3,0x0,0x59,0x91,0x3,
+    0x0,0x87,0x2,0xb1,0xe0,0x73,0x0,0xe1,0x87,0xe,0x55,0x15,0xf,0x0,0xcd,0x2f,
+    0x0,0xd1,0x3,0x0,0xfb,0x17,0x0,0x9e,0x77,0x4,0xe2,0x1,0x0,0x37,0xf,0x0,
+    0x87,0xa,0x45,0x45,0xdf,0x87,0x6,0x25,0x2b,0x0,0xef,0x5,0x1b,0x0,0xe5,0x3,
+    0x0,0xaa,0x87,0x4a,0xf5,0x87,0xf8,0x2d,0x3f,0x8,0xfd,0x87,0x0,0xa1,0xaf,0x7b,
+    0x2,0x0,0xb9,0x3,0x0,0xfb,0x83,0x0,0x13,0xaf,0x7c,0x2,0x0,0x3,0x1b,0x0,
+    0x7,0x3,0x0,0x49,0x7d,0x7d,0x2f,0x6,0x8d,0x7e,0x2,0x0,0x13,0xf,0x0,0xe5,
+    0x17,0x3,0x0,0xcf,0x27,0x0,0x0,0x2,0x39,0x7f,0x2,0xaf,0x0,0xd5,0x80,0x2,
+    0x87,0xc,0x11,0x5b,0x0,0xa5,0x52,0x3b,0x0,0xb9,0x2b,0x0,0x0,0x2,0x2f,0xf,
+    0x0,0x33,0x3,0x0,0xfe,0x87,0x4a,0x5,0x4e,0x3,0x0,0x71,0x55,0x2,0x93,0x0,
+    0x87,0x3,0x0,0x87,0x2,0x9d,0x7,0x0,0x87,0xa,0x1d,0xad,0x58,0x2f,0x6,0x85,
+    0x57,0x87,0xe,0xd1,0x13,0x8,0x15,0xdf,0x59,0x2,0x0,0xeb,0x5a,0x87,0x16,0x81,
+    0x56,0x67,0x2,0x0,0xb1,0x2b,0x0,0x87,0x52,0xe9,0x4e,0xb,0x6,0x7d,0x25,0x87,
+    0x0,0xc1,0x4c,0x2,0x0,0xd7,0x3,0x0,0xb2,0x87,0x2,0xed,0x7,0x0,0x87,0xa,
+    0xa5,0x4d,0x23,0x6,0x45,0xac,0x7,0x0,0x87,0xa,0x49,0x4f,0x13,0x6,0x5,0x3f,
+    0x0,0x2b,0x94,0xf,0x0,0x87,0x12,0x27,0x27,0x0,0x65,0x33,0x8,0xf,0x5b,0x3d,
+    0x3e,0x87,0x0,0x2d,0x49,0x2,0x0,0x43,0x3,0x0,0x87,0x2,0x59,0x59,0x7,0x0,
+    0x87,0xa,0x9,0x4a,0x2f,0x6,0xa9,0x13,0x0,0x56,0x87,0xa,0xa9,0x4b,0x13,0x6,
+    0x7d,0x1b,0x0,0x75,0xb,0x0,0xca,0x87,0x12,0x8d,0x27,0x0,0xc9,0x3,0x0,0x87,
+    0x42,0x5,0x6e,0xff,0xfe,0xff,0x5d,0x7c,0xfe,0xff,0xe1,0x65,0xff,0xfe,0xff,0xa9,
+    0x47,0xfe,0xff,0x4d,0x1,0xff,0xfd,0xff,0x2d,0x4d,0xfe,0xff,0xb9,0x5e,0xff,0xfe,
+    0xff,0xd1,0x43,0xfe,0xff,0xdd,0x5b,0xff,0xfe,0xff,0x41,0x56,0xfe,0xff,0x61,0x53,
+    0xff,0xfe,0xff,0x81,0x3f,0xfe,0xff,0x49,0x4a,0xaf,0xfe,0xff,0x55,0x89,0xb,0x0,
+    0xe3,0x1b,0x0,0xf4,0xff,0xfe,0xff,0xd5,0xc4,0xfe,0xff,0x71,0x26,0xff,0xff,0xff,
+    0x51,0xb8,0xfe,0xff,0xbd,0x2d,0xef,0xff,0xff,0x5,0xa8,0x3b,0x0,0x9d,0xfe,0xff,
+    0xeb,0x69,0xd4,0x3f,0x0,0xdc,0x7,0x0,0x62,0xff,0xff,0xff,0x91,0xbd,0xff,0xff,
+    0x89,0xba,0xff,0xff,0xff,0x9d,0x6a,0xff,0xff,0x81,0x53,0xff,0xff,0xfb,0x6f,0x1f,
+    0x67,0x0,0x73,0xff,0xff,0xd1,0x9f,0xff,0xff,0xff,0x95,0x8,0xfe,0xff,0x7d,0xc2,
+    0xfe,0x9b,0x0,0x25,0x3a,0xe0,0x1,0x25,0x38,0xe0,0xf7,0x3,0x25,0x36,0x3,0x0,
+    0x34,0xe0,0x4,0x25,0xff,0x32,0xe0,0x5,0x25,0x30,0xe0,0x6,0x25,0xff,0x2e,0xe0,
+    0x7,0x25,0x2c,0xe0,0x8,0x25,0xff,0x2a,0xe0,0x9,0x25,0x28,0xe0,0xa,0x25,0xff,
+    0x26,0xe0,0xb,0x25,0x24,0xe0,0xc,0x25,0xff,0x22,0xe0,0xd,0x25,0x20,0xe0,0xe,
+    0x25,0xff,0x1e,0xe0,0xf,0x25,0x1c,0xe0,0x10,0x25,0xff,0x1a,0xe0,0x11,0x25,0x18,
+    0xe0,0x12,0x25,0xff,0x16,0xe0,0x13,0x25,0x14,0xe0,0x14,0x25,0xff,0x12,0xe0,0x15,
+    0x25,0x10,0xe0,0x16,0x25,0xff,0xe,0xe0,0x17,0x25,0xc,0xe0,0x18,0x25,0xff,0xa,
+    0xe0,0x19,0x25,0x8,0xe0,0x1a,0x25,0xff,0x6,0xe0,0x1b,0x25,0x4,0xe0,0x1c,0x25,
+    0xff,0x2,0xe0,0x1d,0x25,0x0,0xe0,0x1e,0x25,0xdb,0xfe,0xe7,0x13,0xb,0x7,0x11,
+    0x33,0x7,0x27,0x4d,0xff,0x3,0x0,0xff,0xe6,0x2,0x0,0x9,0xe7,0x5e,0x6f,0x1,
+    0x10,0x2,0x0,0xff,0x8f,0x1,0x35,0x7,0x0,0x55,0x89,0xf,0x0,0xb,0x67,0x9,
+    0x5d,0xf,0x0,0x91,0x3,0x0,0xad,0x95,0x3,0x0,0xf1,0xe9,0x37,0x6,0x9d,0xb,
+    0x0,0x5d,0x14,0x43,0x0,0x8b,0xb,0x99,0xf,0x0,0x5f,0xf,0x0,0x7b,0x2b,0x0,
+    0xa,0x95,0xb7,0x3f,0x8,0x37,0x77,0x10,0x19,0x3,0x0,0x77,0x2,0xf5,0x7c,0x3f,
+    0x0,0x77,0x12,0x2d,0x12,0x2,0x0,0x61,0x3,0x0,0x29,0x65,0x3,0x0,0x77,0xa,
+    0xed,0x1f,0x0,0x7f,0xb,0x0,0x77,0xa,0x25,0x69,0x1b,0x0,0x6d,0x3,0x0,0x77,
+    0x42,0x55,0x73,0x0,0x3,0x2,0x52,0x77,0x1a,0x3,0x4b,0x0,0x77,0x12,0xf,0x7,
+    0x0,0x13,0x3,0x0,0x81,0x17,0x3,0x0,0x77,0x2a,0x4b,0xa,0x77,0xa,0xf,0xa,
+    0x77,0x1a,0x69,0xf5,0xf1,0xb,0x6,0x17,0x1b,0x0,0x39,0xeb,0x2,0x0,0xa5,0x43,
+    0x3,0x0,0x51,0x3,0x0,0x77,0x2,0xd7,0x7,0x0,0x1d,0x4d,0xec,0x77,0xe,0x41,
+    0x13,0x1b,0x0,0x3,0x0,0x55,0x3,0x0,0xf9,0xa5,0x17,0x0,0x0,0x2,0x5,0xed,
+    0x2,0x0,0x85,0xc9,0xf0,0x3,0x1,0x47,0x8,0x59,0x1b,0x0,0xeb,0x3a,0x79,0x64,
+    0xfe,0xb,0x6,0x2d,0x4e,0x3,0x0,0xb9,0x61,0x2,0xcb,0x0,0xc3,0x3,0x0,0xcf,
+    0x3,0x0,0x73,0x2,0x5,0x62,0xa7,0x2,0x0,0xc1,0x3,0x0,0x73,0xa,0x21,0xb,
+    0x0,0x69,0xda,0x3,0x0,0xb1,0x3,0x0,0x3f,0x65,0x37,0x6,0x11,0x63,0x7,0x2,
+    0x0,0x3d,0xb,0x0,0xeb,0xa,0x0,0x2,0x73,0x3a,0xe7,0x2,0xa0,0x3,0xb,0xe7,
+    0x3a,0x5f,0x13,0xe7,0x2a,0x5b,0x43,0x2d,0x4f,0x8,0x7d,0x26,0x1b,0x0,0x1,0xc,
+    0x5f,0x0,0x3,0x0,0x19,0x3,0x0,0x73,0x2,0xc5,0x85,0x7,0x0,0xb5,0x13,0x2,
+    0xaf,0xb,0xb,0x0,0xcd,0xe,0x97,0x2,0x0,0xd1,0x3,0x0,0xd5,0x3,0x0,0xfb,
+    0x4,0xd,0x47,0x2,0x0,0x97,0xb,0x0,0xe7,0xa,0x57,0x3d,0x31,0xb,0x6,0x7d,
+    0x8d,0x6f,0x0,0x21,0x2e,0x2,0x0,0x2b,0x3,0x0,0x29,0x37,0x3,0x0,0x6f,0x2,
+    0xb9,0x7,0x0,0xd5,0x3,0x0,0x6f,0xa,0x55,0x7d,0xb,0x0,0xe5,0x2f,0x0,0xe9,
+    0x3,0x0,0xed,0x37,0x8,0x9f,0x29,0x2f,0x2,0x0,0x21,0xb,0x0,0x6f,0x4a,0x15,
+    0xf5,0x3b,0xb,0x6,0x95,0x6f,0x0,0x15,0x35,0x2,0x0,0xe5,0x1f,0x3,0x0,0x2d,
+    0x3,0x0,0x6f,0x2,0xc1,0x36,0x2,0x57,0x0,0x29,0x37,0x6f,0xe,0x5d,0xf,0x0,
+    0x7d,0x2f,0x0,0xd5,0x81,0x3,0x0,0x85,0x37,0x8,0xfd,0x1f,0x0,0xa9,0x3a,0xd6,
+    0x6f,0x4e,0x3,0xa,0xb,0x6,0xbd,0x6f,0x0,0xcd,0x4,0x97,0x2,0x0,0xd7,0x3,
+    0x0,0xe5,0x3,0x0,0x6f,0x2,0x8d,0xf5,0x6,0xcf,0x1,0x7,0x6f,0xe,0xdd,0x5,
+    0x2,0x0,0x55,0x6d,0x2f,0x0,0x71,0x3,0x0,0x75,0x37,0x8,0xb9,0x1f,0x0,0x5b,
+    0xa5,0x9,0x6f,0x4e,0x9d,0x6b,0xb,0x6,0xc5,0x6f,0x0,0x5f,0x61,0x66,0x2,0x0,
+    0x6b,0x3,0x0,0x79,0x3,0x0,0xc6,0x6f,0x2,0x95,0x68,0x3b,0x1,0x3,0x0,0x6f,
+    0xa,0xa9,0x67,0x94,0xbb,0x1,0x2f,0x0,0xd5,0x3,0x0,0x49,0x17,0x0,0xf3,0x4,
+    0x69,0xa7,0x2,0x0,0x25,0xf,0x0,0x6f,0x4a,0x2d,0x27,0x8,0xcd,0xbe,0x6f,0x0,
+    0xb5,0x3c,0x2,0x0,0xbf,0x3,0x0,0xcd,0x8c,0x3,0x0,0x6f,0x2,0x79,0x3d,0x2b,
+    0x1,0x3,0x0,0x6f,0xa,0xb9,0x69,0x3f,0x7f,0x0,0x3,0x0,0xed,0x3,0x0,0x19,
+    0x3e,0x43,0x6,0x65,0x69,0x7,0x0,0x7f,0xf,0x0,0x6f,0x4a,0xc3,0x79,0xb,0x6,
+    0xff,0xd,0x4e,0x3,0x0,0x65,0x76,0x2,0x0,0xa5,0x6f,0x3,0x0,0xbb,0x3,0x0,
+    0x6f,0x2,0xf3,0x7,0x0,0x29,0xa9,0x77,0x6f,0x10,0xb,0x0,0x6d,0x3,0x0,0xb5,
+    0x3,0x0,0x7b,0xc8,0x1b,0x0,0xbf,0x5,0xb,0x0,0x2b,0x1f,0x0,0x6f,0x4a,0xe5,
+    0x1a,0xfa,0xb,0x6,0x15,0x6f,0x0,0xc5,0x14,0x2,0x0,0xcf,0xf2,0x3,0x0,0xdd,
+    0x3,0x0,0x6f,0x2,0x51,0x16,0x2,0x0,0xf9,0xb1,0x3,0x0,0x6f,0xa,0xe9,0x15,
+    0x2,0x0,0x85,0x2f,0x1b,0x2,0x0,0x89,0x3,0x0,0x8d,0x3,0x0,0x0,0x2,0x63,
+    0x6d,0x17,0xcb,0x1,0x43,0x0,0x6f,0x4a,0x4d,0x21,0xb,0x6,0x7d,0x1d,0x6f,0x0,
+    0x5,0x1d,0x2,0x0,0xf,0x3,0x0,0xf9,0x1d,0x3,0x0,0x6f,0x2,0x45,0x1e,0x2,
+    0x0,0x99,0x54,0x3,0x0,0x6f,0xa,0xfd,0x17,0x0,0xe9,0x2f,0x0,0xed,0x3,0x0,
+    0x7d,0xf1,0x37,0x8,0x35,0x1f,0x2,0x0,0x11,0xb,0x0,0xd6,0x6f,0x4a,0xf,0xf6,
+    0x27,0x6,0x35,0x6f,0x0,0x19,0xf2,0xa4,0x17,0x1,0x3,0x0,0x45,0x3,0x0,0x6f,
+    0x2,0xf9,0x7,0x0,0x91,0x53,0xf3,0x1,0x4f,0xf,0xf,0x0,0xcd,0x2f,0x0,0xd1,
+    0x3,0x0,0x95,0xd5,0x37,0x8,0xed,0x1f,0x0,0x43,0xb,0x0,0x6f,0x4a,0x2d,0xae,
+    0x27,0x0,0x55,0x4d,0x3,0x3,0x4,0xf3,0x63,0x0,0xf7,0x52,0x3,0x0,0xfb,0x3,
+    0x0,0x6f,0x2,0x3,0x1b,0x0,0x7,0x3,0x0,0xaa,0x6f,0xa,0xf,0x7,0x0,0x13,
+    0x3,0x0,0x17,0x3,0x0,0x1b,0x52,0x13,0x8,0x29,0x7,0x0,0xbf,0x13,0x11,0x5b,
+    0x0,0x15,0x3,0x0,0x15,0x19,0x63,0x8,0x2f,0x7,0x0,0x33,0x6f,0x18,0x57,0x5,
+    0xdf,0x0,0x52,0x6f,0xd2,0xad,0xdf,0x88,0x57,0x1a,0x45,0xc7,0x10,0xb5,0x77,0x0,
+    0xa9,0xc9,0x3,0x0,0x57,0xa,0xf3,0x87,0x8,0xe1,0x7,0x0,0xb,0x2f,0xdf,0x2,
+    0x0,0x1b,0x3,0x0,0xff,0x13,0x8,0x57,0x2a,0x2b,0x9d,0xe3,0x1f,0x6,0x55,0x57,
+    0x10,0xdd,0x37,0x2,0x7,0x0,0x4d,0xe5,0x7,0x0,0x49,0xe0,0x4b,0x0,0x33,0x8,
+    0xf5,0xf,0x0,0x5f,0xb9,0xe4,0x2,0x0,0xbd,0x3,0x0,0xc1,0x3,0x0,0xc6,0x0,
+    0x2,0x59,0xe1,0xf,0x1,0x43,0x0,0x57,0xa,0x30,0xb4,0xff,0x1,0x21,0x2,0x68,
+    0x0,0x1d,0x0,0x2a,0xff,0xf,0xd0,0x3,0x68,0xc3,0x18,0x44,0x68,0xff,0x8,0x30,
+    0xc,0x42,0x2,0xd0,0x4d,0x46,0xff,0x6d,0x1e,0x64,0x19,0x1d,0x68,0x25,0x60,0xff,
+    0x1b,0x1d,0x24,0x1d,0x12,0x1f,0xec,0xd0,0x3f,0xf8,0xe7,0x30,0xbc,0x70,0x47,0x8c,
+    0x14,0x0,0x0,0xbf,0x5b,0xa4,0x2,0x0,0xd7,0xa2,0xd3,0x0,0xa3,0xde,0x63,0x0,
+    0xa7,0x2,0x0,0x4d,0xf,0x0,0x41,0xa5,0xfc,0x5f,0xf,0x0,0xa,0x9b,0xac,0x2,
+    0x0,0x11,0xab,0xf7,0x2,0x0,0x3d,0x3,0x0,0xd,0xb0,0x2,0x0,0x6d,0x8d,0xf,
+    0x0,0x81,0xad,0x27,0xe,0x53,0xd3,0x7,0x6,0xff,0x59,0x55,0x1,0x0,0x51,0x56,
+    0x1,0x0,0x7d,0x55,0x3,0x0,0x19,0x59,0x1,0x0,0x8d,0x3,0x0,0xd9,0xa5,0x3,
+    0x0,0x0,0xa,0xff,0x3,0xb,0x6,0x5,0x7,0xd7,0x3,0x0,0xc5,0x3,0x0,0xc9,
+    0x3,0x0,0x3d,0x9,0xd7,0x3,0x0,0x99,0x3,0x0,0xc9,0x3,0x0,0x10,0xb5,0xff,
+    0x7,0x49,0x79,0x44,0x18,0x31,0x6,0x4c,0xff,0x7c,0x44,0x16,0x34,0x4,0xe0,0x8,
+    0x1d,0xff,0xa,0x68,0x89,0x18,0x88,0x47,0x1,0x0,0x7f,0xa1,0x42,0xf8,0xd1,0x10,
+    0xbd,0x8,0x3b,0x0,0xfd,0x2c,0x3,0x0,0x4f,0x6a,0xfd,0xff,0x64,0x49,0xbf,0x0,
+    0x0,0x7c,0x0,0x0,0x20,0x4f,0x2,0xf9,0x77,0xfe,0xff,0xff,0xb,0x0,0x0,0xfc,
+    0x3,0x5e,0x4,0xfa,0x13,0x4,0x5,0x3,0x0,0x10,0xb5,0x4,0x0,0x4,0xfe,0x51,
+    0x0,0xe,0x31,0x4,0x48,0x78,0x44,0xc,0xff,0x30,0x0,0xf0,0x6,0xf8,0x20,0x0,
+    0x10,0xff,0xbd,0x40,0xf5,0xff,0xff,0xb4,0xf4,0xff,0xff,0xff,0x38,0xb5,0x5,0x0,
+    0xc,0x0,0xa5,0xff,0x42,0x5,0xd0,0x28,0x68,0x40,0x19,0x80,0xff,0x47,0x2d,0x1d,
+    0xa5,0x42,0xf9,0xd1,0x31,0xfd,0xbd,0x37,0x2,0x0,0x20,0x20,0x60,0x2,0x23,0xff,
+    0x4,0x22,0x2,0x49,0x20,0x1d,0xdc,0xf7,0xdb,0x89,0xfa,0x37,0x2,0x6b,0xca,0x54,
+    0x0,0xf0,0xc,0xff,0xf8,0x0,0x28,0x1,0xd0,0xff,0xf7,0xa8,0xff,0xff,0x0,0x20,
+    0xc0,0x46,0xc0,0x46,0xe7,0xff,0xf7,0x31,0xfe,0x0,0xf0,0xd,0xf8,0x0,0xff,0x0,
+    0x3,0x48,0xff,0x21,0x88,0x43,0x3,0xdf,0x49,0x8,0x60,0x1,0x20,0x6d,0x5,0x40,
+};
+
+static const uint8_t dfuStream_1_7_0_390_page6[426] PROGMEM = {
+    0x0,0xff,0x0,0x8,0xed,0x0,0xe0,0x80,0xb5,0x0,0xff,0xf0,0x1,0xf8,0x1,0xbd,
+    0x7,0x46,0x38,0x7f,0x46,0x0,0xf0,0x2,0xf8,0xfb,0xe7,0x5e,0x0,0xff,0x21,0x9,
+    0x3,0x26,0x31,0x18,0x20,0xab,0x33,0xbe,0xf9,0xd,0x0,0x0,0x16,0x75,0xde,0x8b,
+    0x1,0x3,0x0,0x6e,0x0,0xa,0x55,0x4d,0x3,0x3,0x4,0x17,0xcb,0x9a,0x1d,0xb7,
+    0x0,0x5d,0xd8,0xaf,0x1f,0x83,0xd5,0x13,0x1e,0x2d,0xb5,0xd7,0x13,0x1e,0xd7,0x13,
+    0x20,0x7d,0xd6,0x13,0x1e,0x9d,0x6d,0xd1,0x13,0x1e,0x55,0xd4,0x13,0x1e,0xef,0xd2,
+    0x13,0x1e,0xcd,0xfd,0x9f,0x20,0x65,0xcc,0x13,0xfe,0x13,0x82,0x99,0xd0,0xfe,0x13,
+    0x1e,0x10,0xb5,0x4,0x0,0xc0,0x46,0xc0,0xf7,0x46,0x20,0x0,0xf3,0x3,0x10,0xbd,
+    0x0,0x28,0xff,0x0,0xd1,0x70,0x47,0x80,0xb5,0xfd,0xf7,0xef,0x84,0xfd,0x1,0xbd,
+    0x1d,0xe,0xff,0xf7,0xf2,0xab,0xff,0x10,0xf,0x14,0xea,0xf,0x18,0xe2,0xf,0x18,
+    0xda,0xfe,0xf,0x0,0x0,0x0,0x36,0xa3,0x98,0x0,0x3,0xef,0x4,0x0,0x0,0x9a,
+    0x6b,0x0,0x80,0xb5,0x2,0xff,0x21,0x36,0x20,0xe8,0xf7,0x11,0xfb,0x1,0xf9,0xbd,
+    0x25,0x2,0x1,0x2,0xff,0xf7,0xae,0xfe,0x5,0xff,0x20,0x9,0x1,0xa1,0x1,0xc0,
+    0x0,0x8,0xfa,0x23,0x0,0x9,0x27,0x4,0xff,0xf7,0xbb,0xff,0x1,0x55,0xbd,0x7,
+    0x2,0xb7,0x7,0x8,0xb3,0x7,0x8,0xaf,0x7,0x8,0x55,0xab,0x7,0x8,0xa7,0x7,
+    0x8,0xa3,0x7,0x8,0x9f,0x7,0x8,0x55,0x9b,0x7,0x8,0x97,0x7,0x8,0x93,0x7,
+    0x8,0x8f,0x7,0x8,0x55,0x8b,0x7,0x8,0x87,0x7,0x8,0x83,0x7,0x8,0x7f,0x7,
+    0x8,0x55,0x7b,0x7,0x8,0x77,0x7,0x8,0x73,0x7,0x8,0x6f,0x7,0x8,0x55,0x6b,
+    0x7,0x8,0x67,0x7,0x8,0x63,0x7,0x8,0x5f,0x7,0x8,0x55,0x5b,0x7,0x8,0x57,
+    0x7,0x8,0x53,0x7,0x8,0x4f,0x7,0x0,0xfe,0x77,0x3,0x1,0x0,0x2,0x0,0x3,
+    0x0,0x4,0xbf,0x0,0x5,0x0,0x6,0x0,0x7,0xf9,0x0,0x9,0xff,0x0,0xa,0x0,
+    0xb,0x0,0xc,0x0,0xd,0xff,0x0,0xe,0x0,0xf,0x0,0x10,0x0,0x11,0xff,0x0,
+    0x12,0x0,0x13,0x0,0x14,0x0,0x15,0xff,0x0,0x16,0x0,0x17,0x0,0x18,0x0,0x19,
+    0xff,0x0,0x1c,0x0,0x1d,0x0,0x1e,0x0,0x1f,0x52,0x3b,0x0,0x1e,0x3e,0x2,0x3f,
+    0x4,0x12,0x41,0x0,0x12,0x43,0x4,0x9f,0x5a,0x1d,0x8b,0xc,0x7,0x15,0x0,0x0,
+    0x2,0x8,0xff,0x10,0x1e,0x2d,0x3c,0x5a,0x0,0x0,0x3,0x8f,0x3,0x2,0x2,0x1,
+    0x13,0x0,0x6,0x8,0x0,0x4,0x3,0x0,0x3,0x0,
+};
+
+#ifndef GET_FAR_ADDRESS
+#define GET_FAR_ADDRESS(var)                                       \
+	({                                                             \
+		uint_farptr_t tmp;                                         \
+		__asm__ __volatile__("ldi    %A0, lo8(%1)"    "\n\t"  \
+		                     "ldi    %B0, hi8(%1)"    "\n\t"  \
+		                     "ldi    %C0, hh8(%1)"    "\n\t"  \
+		                     "clr    %D0"             "\n\t"  \
+		                     : "=d"(tmp)                          \
+		                     : "p"(&(var)));                      \
+		tmp;                                                       \
+	})
+#endif
+
+static uint32_t dfuStream_1_7_0_390_addr(uint32_t index)
+{
+	switch (index / 30000)
+	{
+	case 0:
+		return GET_FAR_ADDRESS(dfuStream_1_7_0_390_page0) + index % 30000;
+	case 1:
+		return GET_FAR_ADDRESS(dfuStream_1_7_0_390_page1) + index % 30000;
+	case 2:
+		return GET_FAR_ADDRESS(dfuStream_1_7_0_390_page2) + index % 30000;
+	case 3:
+		return GET_FAR_ADDRESS(dfuStream_1_7_0_390_page3) + index % 30000;
+	case 4:
+		return GET_FAR_ADDRESS(dfuStream_1_7_0_390_page4) + index % 30000;
+	case 5:
+		return GET_FAR_ADDRESS(dfuStream_1_7_0_390_page5) + index % 30000;
+	case 6:
+		return GET_FAR_ADDRESS(dfuStream_1_7_0_390_page6) + index % 30000;
+	default:
+		return 0;
+	}
+}
+
+const avrLzDfuStream_t dfuStream_1_7_0_390 = {
+    .applicationSize = 200412,
+    .compressedLength = 180426,
+    .packetPayloadSize = 30,
+    .addr = dfuStream_1_7_0_390_addr,
+};
@@ -0,0 +1,111 @@
+/*
+ * bno_async.c
+ *
+ * Only the INTN and TWI interrupts move the state out of IDLE and READING, and only the main loop moves it out of
+ * READY, so the handover needs no locking beyond the single-byte state.
+ */
+
+#include "bno_async.h"
+
+// standard headers
+#include <string.h>
+
+void bno_async_init(bno_async_t *async, const bno_async_twi_t *twi, void *cookie, bool prefixed)
+{
+	memset(async, 0, sizeof(*async));
+	async->twi = twi;
+	async->cookie = cookie;
+	async->prefixed = prefixed;
+	async->state = BNO_ASYNC_IDLE;
+}
+
+bool bno_async_intn(bno_async_t *async, uint32_t time)
+{
+	if (!async->enabled || (async->state != BNO_ASYNC_IDLE))
+	{
+		return false;
+	}
+
+	// READING before the transfer starts, since its completion can come before startRead() returns
+	async->state = BNO_ASYNC_READING;
+	async->intnTime = time;
+	if (!async->twi->startRead(async))
+	{
+		async->state = BNO_ASYNC_IDLE;
+		return false;
+	}
+	return true;
+}
+
+bool bno_async_readDone(bno_async_t *async, bool ok, uint32_t time)
+{
+	if (!ok)
+	{
+		async->state = BNO_ASYNC_IDLE;
+		return false;
+	}
+	async->doneTime = time;
+	async->state = BNO_ASYNC_READY;
+	return true;
+}
+
+static void waitForRead(bno_async_t *async)
+{
+	while (async->state == BNO_ASYNC_READING)
+	{
+		if (async->twi->wait != NULL)
+		{
+			async->twi->wait(async);
+		}
+	}
+}
+
+bool bno_async_take(bno_async_t *async, uint8_t *data, int length, uint32_t *intnTime, uint32_t *doneTime)
+{
+	int copied = length;
+
+	waitForRead(async);
+	if (async->state != BNO_ASYNC_READY)
+	{
+		return false;
+	}
+
+	if (copied > (int)sizeof(async->report))
+	{
+		copied = sizeof(async->report);
+	}
+	if (async->prefixed)
+	{
+		// only the bytes the header says were read are valid
+		int size = async->report[0] | (async->report[1] << 8);
+		if (size < 2)
+		{
+			size = 2;
+		}
+		if (size < copied)
+		{
+			copied = size;
+		}
+	}
+	memcpy(data, async->report, copied);
+	memset(data + copied, 0, length - copied);
+	*intnTime = async->intnTime;
+	*doneTime = async->doneTime;
+	async->state = BNO_ASYNC_IDLE;
+	return true;
+}
+
+void bno_async_enable(bno_async_t *async, bool enable)
+{
+	if (!enable)
+	{
+		async->enabled = false;
+		waitForRead(async);
+	}
+	async->enabled = enable;
+}
+
+bool bno_async_pending(const bno_async_t *async)
+{
+	return async->state != BNO_ASYNC_IDLE;
+}
@@ -4,13 +4,20 @@
 
 // Internal headers for the BNO driver
 #include "sensorhub.h"
+#include "sensorhub_hid.h"
+#include "bno_callbacks.h"
+#include "bno_async.h"
 
 // application headers
 #include "my_hardware.h"
 #include "Console.h"
 #include "TimingDebug.h"
+#include "SvrClock.h"
+#include "SvrYield.h"
+#include "LatencyStats.h"
 
 // asf headers
+#include <interrupt.h>
 #include <ioport.h>
 #include <delay.h>
 #include <util/delay.h>
@@ -31,6 +38,95 @@
 	
 int bno_data_ready = 0;
 
+static volatile uint32_t intnTime_ = 0;  // svr_clock_us() at the latest INTN edge
+static volatile uint8_t intnEdges_ = 0;  // INTN edges seen, so a wait can tell one came and went
+static uint32_t reportTime_ = 0;         // INTN time of the report last handed to the sensorhub library
+static uint32_t readTime_ = 0;           // svr_clock_us() when that report's TWI read completed
+
+// Note the completion of the report read that was signalled at reportTime_.
+static void reportRead(uint32_t readTime)
+{
+	readTime_ = readTime;
+	Latency_Record(LATENCY_INTN_TO_READ, readTime - reportTime_);
+}
+
+#ifdef BNO_ASYNC_READS
+static bool asyncStartRead(bno_async_t *async);
+static const bno_async_twi_t asyncTwi_ = { asyncStartRead, NULL };
+
+static bno_async_t async_ = {
+	.twi      = &asyncTwi_,
+#ifdef BNO_LENGTH_PREFIXED_READS
+	.prefixed = true,
+#endif
+	.state    = BNO_ASYNC_IDLE
+};
+static twi_package_t asyncPackage_ = {
+	.addr_length = 0,
+	.chip        = BNO070_APP_I2C_8BIT_ADDR,
+	.buffer      = async_.report,
+	.length      = sizeof(async_.report),
+#ifdef BNO_LENGTH_PREFIXED_READS
+	.length_prefixed = true
+#endif
+};
+
+// Called from the TWI interrupt when the report read ends.
+static void asyncReadDone(status_code_t status)
+{
+	if (!bno_async_readDone(&async_, status == STATUS_OK, svr_clock_us()))
+	{
+		// let the sensorhub library retry the read synchronously
+		bno_data_ready = 1;
+	}
+}
+
+static bool asyncStartRead(bno_async_t *async)
+{
+	return twi_master_transfer_async(TWI_BNO070_PORT, &asyncPackage_, true, asyncReadDone) == STATUS_OK;
+}
+
+void bno_set_async_reads(bool enable)
+{
+	bno_async_enable(&async_, enable);
+}
+
+// Hands a report fetched in the background to a sensorhub read, if one is available.
+static bool takeAsyncReport(uint8_t *receiveData, int receiveLength)
+{
+	uint32_t doneTime;
+
+	if (!bno_async_take(&async_, receiveData, receiveLength, &reportTime_, &doneTime))
+	{
+		return false;
+	}
+	reportRead(doneTime);
+	return true;
+}
+#endif
+
+// Remember when the report about to be read synchronously was signalled.
+static void stampSyncRead(void)
+{
+	irqflags_t flags = cpu_irq_save();
+	reportTime_ = intnTime_;
+	cpu_irq_restore(flags);
+}
+
+uint32_t bno_report_timestamp(void) { return reportTime_; }
+uint32_t bno_report_read_time(void) { return readTime_; }
+
+bool bno_report_pending(void)
+{
+#ifdef BNO_ASYNC_READS
+	if (bno_async_pending(&async_))
+	{
+		return true;
+	}
+#endif
+	return bno_data_ready != 0;
+}
+
 static void debugPrintf(const char *format, ...)
 {
 #if 0
@@ -100,6 +196,16 @@ static int i2cTransfer(const struct sensorhub_s *sh,
         }
     }
     if (receiveLength > 0) {
+#ifdef BNO_ASYNC_READS
+        if ((sendLength == 0) && (address == BNO070_APP_I2C_8BIT_ADDR) &&
+            takeAsyncReport(receiveData, receiveLength)) {
+            return SENSORHUB_STATUS_SUCCESS;
+        }
+#endif
+        bool const isReport = (sendLength == 0) && (address == BNO070_APP_I2C_8BIT_ADDR);
+        if (isReport) {
+            stampSyncRead();
+        }
         twi_package_t packet_read = {
             .addr[0]      = 0, //regNum,      // TWI slave memory address data
             .addr[1]      = 0, //regNum,      // TWI slave memory address data
@@ -111,9 +217,81 @@ static int i2cTransfer(const struct sensorhub_s *sh,
         if (twi_master_read(TWI_BNO070_PORT, &packet_read)!=STATUS_OK) {
             return SENSORHUB_STATUS_ERROR_I2C_IO;
         }
+        if (isReport) {
+            reportRead(svr_clock_us());
+        }
+    }
+    return SENSORHUB_STATUS_SUCCESS;
+}
+
+#ifdef BNO_LENGTH_PREFIXED_READS
+static int i2cReadReport(const struct sensorhub_s *sh,
+                         uint8_t address,
+                         uint8_t *receiveData,
+                         int maxLength)
+{
+#ifdef BNO_ASYNC_READS
+    if ((address == BNO070_APP_I2C_8BIT_ADDR) && takeAsyncReport(receiveData, maxLength)) {
+        return SENSORHUB_STATUS_SUCCESS;
+    }
+#endif
+    stampSyncRead();
+    twi_package_t packet_read = {
+        .addr_length     = 0,
+        .chip            = address,      // TWI slave bus address
+        .buffer          = receiveData,  // transfer data destination buffer
+        .length          = maxLength,    // upper bound; the report header gives the real size
+        .length_prefixed = true
+    };
+    if (twi_master_read(TWI_BNO070_PORT, &packet_read) != STATUS_OK) {
+        return SENSORHUB_STATUS_ERROR_I2C_IO;
     }
+    reportRead(svr_clock_us());
     return SENSORHUB_STATUS_SUCCESS;
 }
+#endif
+
+/* Background write of a DFU packet, so the next one can be prepared meanwhile */
+static volatile bool writing_ = false;
+static volatile status_code_t writeStatus_;
+static twi_package_t writePackage_;
+
+// Called from the TWI interrupt when the write ends.
+static void writeDone(status_code_t status)
+{
+	writeStatus_ = status;
+	writing_ = false;
+}
+
+static int i2cWriteStart(const struct sensorhub_s *sh,
+                         uint8_t address,
+                         const uint8_t *sendData,
+                         int sendLength)
+{
+    writePackage_.addr_length = 0;
+    writePackage_.chip = address;
+    writePackage_.buffer = (uint8_t *)sendData;
+    writePackage_.length = sendLength;
+
+    // an async start never waits for the bus, so wait here in the main loop until the last STOP has gone out
+    status_code_t status;
+    writing_ = true;
+    do {
+        status = twi_master_transfer_async(TWI_BNO070_PORT, &writePackage_, false, writeDone);
+    } while (status == ERR_BUSY);
+    if (status != STATUS_OK) {
+        writing_ = false;
+        return SENSORHUB_STATUS_ERROR_I2C_IO;
+    }
+    return SENSORHUB_STATUS_SUCCESS;
+}
+
+static int i2cWriteWait(const struct sensorhub_s *sh)
+{
+    while (writing_)
+        ;
+    return (writeStatus_ == STATUS_OK) ? SENSORHUB_STATUS_SUCCESS : SENSORHUB_STATUS_ERROR_I2C_IO;
+}
 
 static void gpioSetRSTN(const struct sensorhub_s *sh, int value)
 {
@@ -141,24 +319,75 @@ static int gpioGetHOST_INTN(const struct sensorhub_s *sh)
     return ioport_get_value(Int_BNO070);
 }
 
+static volatile bool hubWaiting_ = false;  // the library is in delay() and must not be re-entered from a yield
+
+bool bno_hub_waiting(void)
+{
+    return hubWaiting_;
+}
+
+// Wait on the clock rather than spinning a fixed count, yielding meanwhile. The yield leaves the hub alone while
+// hubWaiting_ is set, but keeps up the work that does not need it: sending packed reports, reattaching USB after a
+// report size change, clearing the latency histograms.
 static void delay(const struct sensorhub_s *sh, int milliseconds)
 {
-    delay_ms(milliseconds);
+    uint32_t start = svr_clock_us();
+    uint32_t wait = (uint32_t)milliseconds * 1000;
+    bool nested = hubWaiting_;
+
+    hubWaiting_ = true;
+    while (svr_clock_us() - start < wait) {
+        svr_yield();
+    }
+    hubWaiting_ = nested;
 }
 
+// Yield until INTN reaches the level, or for level 0 until the interrupt has seen it fall, rather than polling every
+// millisecond; the hub can assert and release INTN between two looks at the pin.
+static int waitHOST_INTN(const struct sensorhub_s *sh, int level, uint32_t timeoutMs)
+{
+    uint32_t start = svr_clock_us();
+    uint32_t wait = timeoutMs * 1000;
+    uint8_t edges = intnEdges_;
+    bool nested = hubWaiting_;
+    int seen;
+
+    hubWaiting_ = true;
+    for (;;) {
+        seen = gpioGetHOST_INTN(sh) ? 1 : 0;
+        if ((level == 0) && (intnEdges_ != edges)) {
+            seen = 0;
+        }
+        if ((seen == level) || (svr_clock_us() - start >= wait)) {
+            break;
+        }
+        svr_yield();
+    }
+    hubWaiting_ = nested;
+    return seen;
+}
+
+// The library's timeouts are in milliseconds.
 static uint32_t getTick(const struct sensorhub_s *sh)
 {
-    static uint32_t currTick = 0;
-    currTick += 10;
-    delay_ms(10);
-    return currTick;
+    return svr_clock_ms();
 }
 
 BNO070_ISR() {
     // Clear interrupt cause
     PORTD.INTFLAGS = PORT_INT0IF_bm;
+    intnTime_ = svr_clock_us();
+    intnEdges_++;
 
+#ifdef BNO_ASYNC_READS
+    // Start fetching the report right away so the I2C transfer overlaps with the main loop.
+    // If the bus is busy or a report is still waiting to be consumed, the main loop polls for it instead.
+    if (!bno_async_intn(&async_, intnTime_)) {
+        bno_data_ready = 1;
+    }
+#else
     bno_data_ready = 1;
+#endif
 	#ifdef MeasurePerformance
 		TimingDebug_event1(); // measure time in which interrupt was received
 	    bno_interrupts++;
@@ -169,10 +398,23 @@ static int bnoDataReady(const struct sensorhub_s *sh)
 {
     int retval;
 
+#ifdef BNO_ASYNC_READS
+    // A fetched report is consumed by the next read, so leave the flag for the one after it.
+    // The TWI interrupt can also set the flag, so mask all interrupts rather than just INTN.
+    irqflags_t flags = cpu_irq_save();
+    if (bno_async_pending(&async_)) {
+        retval = 1;
+    } else {
+        retval = bno_data_ready;
+        bno_data_ready = 0;
+    }
+    cpu_irq_restore(flags);
+#else
     PORTD.INTCTRL &= ~PORT_INT0LVL0_bm;  // disable interrupt
     retval = bno_data_ready;
     bno_data_ready = 0;
     PORTD.INTCTRL |= PORT_INT0LVL0_bm;  // enable interrupt, level high
+#endif
 
     return retval;
 }
@@ -193,7 +435,17 @@ sensorhub_t sensorhub = {
     logError,
     debugPrintf,
     5,                          /* I2C retries */
-    NULL                        /* cookie */
+    NULL,                       /* cookie */
+#ifdef BNO_LENGTH_PREFIXED_READS
+    i2cReadReport,
+#else
+    NULL,
+#endif
+    i2cWriteStart,
+    i2cWriteWait,
+    NULL,                       /* dfuProgress, set by whoever runs a DFU */
+    NULL,                       /* takeReport, set by init_BNO070 */
+    waitHOST_INTN
 };
 
 #endif // BNO
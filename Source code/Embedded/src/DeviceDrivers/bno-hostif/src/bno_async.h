@@ -0,0 +1,66 @@
+/*
+ * bno_async.h
+ * Report read started from the BNO INTN interrupt and handed to the next sensorhub library read. The TWI side is
+ * behind bno_async_twi_t, so the state machine runs the same against twim and against a simulated peripheral.
+ */
+
+#ifndef BNO_ASYNC_H_
+#define BNO_ASYNC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sensorhub_hid.h"
+
+/// State of the background read.
+typedef enum
+{
+	BNO_ASYNC_IDLE,     ///< no read in flight, buffer empty
+	BNO_ASYNC_READING,  ///< TWI transfer in progress
+	BNO_ASYNC_READY     ///< buffer holds a report not yet handed to the sensorhub library
+} bno_async_state_t;
+
+struct bno_async_s;
+
+typedef struct bno_async_twi_s
+{
+	/// Start reading into async->report without waiting for the bus; false if the bus was not free. The transfer
+	/// must end with bno_async_readDone(), normally from the TWI interrupt.
+	bool (*startRead)(struct bno_async_s *async);
+	/// Run while the main loop waits for a read in flight to end; NULL spins until the TWI interrupt ends it.
+	void (*wait)(struct bno_async_s *async);
+} bno_async_twi_t;
+
+typedef struct bno_async_s
+{
+	const bno_async_twi_t *twi;
+	void *cookie;
+	bool prefixed;  ///< reads stop at the length in the report header
+	bool enabled;
+	volatile bno_async_state_t state;
+	uint8_t report[BNO070_MAX_INPUT_REPORT_LEN];
+	uint32_t intnTime;  ///< INTN time of the report in the buffer
+	uint32_t doneTime;  ///< completion time of the read into the buffer
+} bno_async_t;
+
+/// Set up a disabled, idle reader.
+void bno_async_init(bno_async_t *async, const bno_async_twi_t *twi, void *cookie, bool prefixed);
+
+/// From the INTN interrupt: start fetching the report signalled at `time`. False if no read was started (disabled,
+/// a report still waiting or the bus busy); the caller then leaves the report to a polled read.
+bool bno_async_intn(bno_async_t *async, uint32_t time);
+
+/// From the TWI interrupt: the read ended at `time`. False if it failed, so the report must be read by polling.
+bool bno_async_readDone(bno_async_t *async, bool ok, uint32_t time);
+
+/// Hand a fetched report to a sensorhub read of `length` bytes, waiting for a read in flight first. Bytes the report
+/// does not fill are zeroed. False if there is no fetched report.
+bool bno_async_take(bno_async_t *async, uint8_t *data, int length, uint32_t *intnTime, uint32_t *doneTime);
+
+/// Enable or disable starting reads from INTN. Disabling lets a read in flight end; its report can still be taken.
+void bno_async_enable(bno_async_t *async, bool enable);
+
+/// True while a read is in flight or a fetched report is waiting.
+bool bno_async_pending(const bno_async_t *async);
+
+#endif /* BNO_ASYNC_H_ */
@@ -9,6 +9,26 @@
 #ifndef BNO_CALLBACKS_H_
 #define BNO_CALLBACKS_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
 extern int bno_data_ready; // from bno_callbacks. Testing for optimization
 
+/// True when the BNO has signalled a report that has not been read by the sensorhub library yet.
+bool bno_report_pending(void);
+
+/// svr_clock_us() at the INTN edge that signalled the input report most recently read from the BNO.
+uint32_t bno_report_timestamp(void);
+
+/// svr_clock_us() when the TWI read of that report completed.
+uint32_t bno_report_read_time(void);
+
+/// True while the sensorhub library is waiting in its delay callback; it must not be called again until it returns.
+bool bno_hub_waiting(void);
+
+#ifdef BNO_ASYNC_READS
+/// Enable or disable fetching reports over TWI straight from the INTN interrupt.
+void bno_set_async_reads(bool enable);
+#endif
+
 #endif /* BNO_CALLBACKS_H_ */
\ No newline at end of file
@@ -16,6 +16,7 @@
 uint32_t sensorhub_resets = 0;
 uint32_t sensorhub_events = 0;
 uint32_t sensorhub_empty_events = 0;
+int sensorhub_dcdSaveStatus = SENSORHUB_STATUS_SUCCESS;
 
 static int sensorhub_pollForReport(const sensorhub_t * sh, uint8_t * report);
 
@@ -135,10 +136,42 @@ static int sensorhub_i2c_handshake(const sensorhub_t * sh) {
     return SENSORHUB_STATUS_SUCCESS;
 }
 
+/* Deadline for the whole of sensorhub_probe(): the old fixed loops added up to 1.2 s */
+#define PROBE_TIMEOUT_MS 1200
+/* Longest wait for a HOST_INTN change that may already have happened unseen */
+#define PROBE_INTN_MS 100
+/* Interval between HID descriptor reads while the hub boots */
+#define PROBE_RETRY_MS 1
+
+/* Wait for HOST_INTN to reach level, for at most timeout ms and not past the probe deadline */
+static int sensorhub_waitIntn(const sensorhub_t * sh, int level,
+                              uint32_t start, uint32_t timeout)
+{
+    uint32_t elapsed = sh->getTick(sh) - start;
+
+    if (elapsed >= PROBE_TIMEOUT_MS)
+        return sh->getHOST_INTN(sh) ? 1 : 0;
+    if (timeout > PROBE_TIMEOUT_MS - elapsed)
+        timeout = PROBE_TIMEOUT_MS - elapsed;
+
+    if (sh->waitHOST_INTN)
+        return sh->waitHOST_INTN(sh, level, timeout);
+
+    uint32_t waitStart = sh->getTick(sh);
+    while ((sh->getHOST_INTN(sh) ? 1 : 0) != level
+           && (sh->getTick(sh) - waitStart < timeout)) {
+        sh->delay(sh, 1);
+    }
+    return sh->getHOST_INTN(sh) ? 1 : 0;
+}
+
 static int sensorhub_probe_internal(const sensorhub_t * sh, bool reset)
 {
     int i;
     int rc;
+    uint32_t start;
+    uint32_t phase;
+    int intn;
 
     if (reset) {
         bool host_intn_pulled_low;
@@ -157,39 +190,43 @@ static int sensorhub_probe_internal(const sensorhub_t * sh, bool reset)
 
         /* Take the BNO070 out of reset */
         sh->setRSTN(sh, 1);
+        start = sh->getTick(sh);
 
         if (host_intn_pulled_low) {
             /* If HOST_INTN is pulled low, wait for the BNO to set
              * it high. Once the BNO inits HOST_INTN high, it leaves
              * it high for 8-10 ms before it's ready for commands.
-             * Wait for a max of 100 ms, since the BNO will surely be
-             * ready by then and we probably missed the short time
+             * Give up after PROBE_INTN_MS, since the BNO will surely
+             * be ready by then and we probably missed the short time
              * that it wasn't.
              */
-            for (i = 0; i < 100; i++) {
-                if (sh->getHOST_INTN(sh))
-                    break;
-                sh->delay(sh, 1);
-            }
+            sensorhub_waitIntn(sh, 1, start, PROBE_INTN_MS);
         }
+    } else {
+        start = sh->getTick(sh);
     }
+    phase = sh->getTick(sh);
+    sh->stats->probeResetMs = phase - start;
 
     /* Wait for the BNO070 to boot and check the HID descriptor */
-    for (i = 0; i < 100; i++) {
+    for (;;) {
         rc = sensorhub_i2c_handshake(sh);
-        if (rc != SENSORHUB_STATUS_ERROR_I2C_IO) break;
-        sh->delay(sh, 10);
+        if (rc != SENSORHUB_STATUS_ERROR_I2C_IO
+            || sh->getTick(sh) - start >= PROBE_TIMEOUT_MS)
+            break;
+        sh->delay(sh, PROBE_RETRY_MS);
     }
+    sh->stats->probeDescriptorMs = sh->getTick(sh) - phase;
     if (rc < 0) {
         return checkError(sh, rc);
     }
-	
-	/* Wait up to 100ms for INTN to be asserted for first time */
-	for (i = 0; (i < 100) && (sh->getHOST_INTN(sh)); i++) {
-		sh->delay(sh, 1);
-	}
 
-    if (!sh->getHOST_INTN(sh)) {
+    /* Wait for INTN to be asserted for the first time */
+    phase = sh->getTick(sh);
+    intn = sensorhub_waitIntn(sh, 0, start, PROBE_INTN_MS);
+    sh->stats->probeIntnMs = sh->getTick(sh) - phase;
+
+    if (!intn) {
         /* Clear the interrupt by reading up to 10 pending reports */
         for (i = 0; i < 10; i++) {
             uint8_t report[BNO070_MAX_INPUT_REPORT_LEN];
@@ -439,10 +476,14 @@ static int sensorhub_decodeEvent(const sensorhub_t * sh,
         event->un.field16[0] = read16(&report[6]);
 	    break;
 	    
+    case SENSORHUB_CMD_RESP:
+        if (report[4] == CMD_SAVE_DCD && length >= 8)
+            sensorhub_dcdSaveStatus = (report[7] != 0) ? SENSORHUB_STATUS_OP_FAILED : SENSORHUB_STATUS_SUCCESS;
+        return SENSORHUB_STATUS_NOT_AN_EVENT;
+
     case SENSORHUB_PRODUCT_ID_RESPONSE:
     case SENSORHUB_FRS_READ_RESPONSE:
     case SENSORHUB_FRS_WRITE_RESPONSE:
-    case SENSORHUB_CMD_RESP:
         /* Stale FRS read or write responses */
         /* NOTE: Don't run these through checkError, since they are such a
          *       minor annoyance that we don't want to alert the user. The
@@ -460,6 +501,45 @@ static int sensorhub_decodeEvent(const sensorhub_t * sh,
     return SENSORHUB_STATUS_SUCCESS;
 }
 
+static int sensorhub_readReportWithRetry(const sensorhub_t * sh,
+                                         uint8_t * report)
+{
+    int rc;
+    int retries = 0;
+
+    for (;;) {
+        sh->stats->i2cTransfers++;
+        rc = sh->i2cReadReport(sh, sh->sensorhubAddress, report,
+                               BNO070_MAX_INPUT_REPORT_LEN);
+        if (rc >= 0)
+            break;
+
+        sh->stats->i2cErrors++;
+
+        if (retries >= sh->max_retries)
+            break;
+
+        sh->stats->i2cRetries++;
+        retries++;
+    }
+
+    if (rc < 0)
+        return rc;
+
+    /* Only the header and the length it gives were read; clear the rest
+       so decoding never sees bytes left over from an earlier report. */
+    int length = read16(report);
+    if (length < 2)
+        length = 2;
+    else if (length > BNO070_MAX_INPUT_REPORT_LEN)
+        length = BNO070_MAX_INPUT_REPORT_LEN;
+    memset(&report[length], 0, BNO070_MAX_INPUT_REPORT_LEN - length);
+
+    sh->stats->reportBytesRead += length;
+    sh->stats->reportBytesSaved += BNO070_MAX_INPUT_REPORT_LEN - length;
+    return rc;
+}
+
 static int sensorhub_pollForReport(const sensorhub_t * sh,
                                    uint8_t * report)
 {
@@ -470,8 +550,15 @@ static int sensorhub_pollForReport(const sensorhub_t * sh,
         return checkError(sh, SENSORHUB_STATUS_NO_REPORT_PENDING);
     }
 
+    if (sh->i2cReadReport) {
+        rc = sensorhub_readReportWithRetry(sh, report);
+        return checkError(sh, rc);
+    }
+
     rc = sensorhub_i2cTransferWithRetry(sh, sh->sensorhubAddress, NULL, 0, report,
                                         BNO070_MAX_INPUT_REPORT_LEN);
+    if (rc >= 0)
+        sh->stats->reportBytesRead += BNO070_MAX_INPUT_REPORT_LEN;
     return checkError(sh, rc);
 }
 
@@ -500,6 +587,9 @@ int sensorhub_poll(const sensorhub_t * sh, sensorhub_Event_t * events,
             return SENSORHUB_STATUS_SUCCESS;
         }
 
+        if (sh->takeReport && sh->takeReport(sh, report))
+            continue;
+
         /* Decode the event. Ignore reports that aren't events. */
         rc = sensorhub_decodeEvent(sh, report, &events[*numEvents]);
         if (rc == SENSORHUB_STATUS_NOT_AN_EVENT)
@@ -1017,7 +1107,75 @@ void avr_readBuf(uint8_t *buf, unsigned long length,
 }
 
 uint32_t dfu_index;
-uint8_t dfu_writeBuf[32];
+
+/* Two packet buffers: one on the bus while the next is prepared */
+static uint8_t dfu_writeBuf[2][32];
+
+/*
+ * Fills packet with the next packet of a PROGMEM DFU stream and returns
+ * its length, or 0 once the whole stream has been produced.
+ */
+typedef int (*dfu_fill_t)(void *source, uint8_t *packet);
+
+/*
+ * Sends the packets from fill, preparing each one while the previous
+ * one is written and acknowledged; stream bytes 0-3 (the format) are
+ * not sent. Calls sh->dfuProgress after every acknowledged packet.
+ */
+static int dfu_sendPackets(const sensorhub_t *sh, dfu_fill_t fill, void *source, uint32_t totalLength)
+{
+    int current = 0;
+    int length = fill(source, dfu_writeBuf[current]);
+
+    dfu_index = 4;
+    if (sh->dfuProgress)
+        sh->dfuProgress(sh, dfu_index, totalLength);
+
+    while (length > 0) {
+        int rc = sensorhub_dfuStartPacket(sh, dfu_writeBuf[current], length);
+        if (rc != SENSORHUB_STATUS_SUCCESS)
+            return rc;
+
+        int next = fill(source, dfu_writeBuf[!current]);
+
+        rc = sensorhub_dfuFinishPacket(sh, dfu_writeBuf[current], length);
+        if (rc != SENSORHUB_STATUS_SUCCESS)
+            return rc;
+
+        dfu_index += length;
+        if (sh->dfuProgress)
+            sh->dfuProgress(sh, dfu_index, totalLength);
+
+        current = !current;
+        length = next;
+    }
+
+    return SENSORHUB_STATUS_SUCCESS;
+}
+
+typedef struct avrSource_s {
+    const avrDfuStream_t *stream;
+    uint32_t index;
+    int packetSize;
+} avrSource_t;
+
+static int avr_fill(void *source, uint8_t *packet)
+{
+    avrSource_t *avr = source;
+    uint32_t totalLength = avr->stream->totalLength;
+
+    int lengthToWrite = avr->packetSize;
+    if (avr->index == 4)
+        lengthToWrite = 6; // First packet -> total length
+    else if (avr->index == 10)
+        lengthToWrite = 3; // Second packet -> packet length
+    else if (avr->index + lengthToWrite > totalLength)
+        lengthToWrite = totalLength - avr->index; // Last packet -> could be short
+
+    avr_readBuf(packet, lengthToWrite, avr->stream, avr->index);
+    avr->index += lengthToWrite;
+    return lengthToWrite;
+}
 
 int sensorhub_dfu_avr(const sensorhub_t *sh,
                   const avrDfuStream_t *dfuStream)
@@ -1043,59 +1201,199 @@ int sensorhub_dfu_avr(const sensorhub_t *sh,
                             ((applicationSize + packetPayloadSize - 1) / packetPayloadSize) * 2; /* CRC per packet */
     if (expectedLength != dfuStream->totalLength)
         return checkError(sh, SENSORHUB_STATUS_DFU_STREAM_SIZE_WRONG);
+    if (packetSize > sizeof(dfu_writeBuf[0]))
+        return checkError(sh, SENSORHUB_STATUS_DFU_STREAM_SIZE_WRONG);
 
-    /* Put the BNO070 into reset */
-    sh->setRSTN(sh, 0);
+    sensorhub_dfuBegin(sh);
 
-    /* BNO070 BOOTN low (bootloader mode) */
-    sh->setBOOTN(sh, 0);
+    /* Send each packet of the DFU */
+    avrSource_t source = { dfuStream, 4, packetSize };
+    int rc = dfu_sendPackets(sh, avr_fill, &source, dfuStream->totalLength);
+    if (rc != SENSORHUB_STATUS_SUCCESS)
+        return rc;
 
-    sh->delay(sh, 10);
+    return sensorhub_dfuEnd(sh);
+}
 
-    /* Take the BNO070 out of reset */
-    sh->setRSTN(sh, 1);
+/* CRC-16/CCITT with the bootloader's seed of 0xFFFF */
+static uint16_t dfu_crc16(uint16_t crc, const uint8_t *data, int length)
+{
+    while (length-- > 0) {
+        crc ^= (uint16_t) (*data++) << 8;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+    }
+    return crc;
+}
 
-    sh->delay(sh, 10);
+/* Appends the big-endian CRC of the first length bytes; returns the packet length */
+static int dfu_appendCrc(uint8_t *packet, int length)
+{
+    uint16_t crc = dfu_crc16(0xFFFF, packet, length);
+    packet[length] = (uint8_t) (crc >> 8);
+    packet[length + 1] = (uint8_t) crc;
+    return length + 2;
+}
 
-    /* Send each packet of the DFU */
-    uint32_t index = 4;
-    while (index < dfuStream->totalLength) {
-        int rc;
-        uint8_t response;
+/*
+ * The compressed image is LZSS: a flag byte announces the next eight
+ * tokens, least significant bit first. A set bit is a literal byte; a
+ * clear bit a two-byte match whose low 9 bits are the distance back
+ * minus 1 and whose high 7 bits are the length minus 3.
+ */
+typedef struct lzReader_s {
+    const avrLzDfuStream_t *stream;
+    uint32_t in;           /* next compressed byte */
+    uint32_t remaining;    /* application bytes not yet produced */
+    uint8_t headersLeft;   /* header packets not yet produced */
+    uint8_t flags;
+    uint8_t tokensLeft;    /* tokens left under flags */
+    uint8_t matchLeft;     /* bytes left to copy from the window */
+    uint16_t matchFrom;
+    uint16_t out;          /* window position of the next output byte */
+    uint8_t window[DFU_LZ_WINDOW];
+} lzReader_t;
+
+static uint8_t lz_in(lzReader_t *lz)
+{
+    return pgm_read_byte_far(lz->stream->addr(lz->in++));
+}
 
-        int lengthToWrite = packetSize;
-        if (index == 4)
-            lengthToWrite = 6; // First packet -> total length
-        else if (index == 10)
-            lengthToWrite = 3; // Second packet -> packet length
-        else if (index + lengthToWrite > dfuStream->totalLength)
-            lengthToWrite = dfuStream->totalLength - index; // Last packet -> could be short
+/*
+ * Walks the tokens without rebuilding the image: true if they produce
+ * exactly applicationSize bytes from exactly compressedLength bytes,
+ * and no match reaches back before the start of the image.
+ */
+static bool lz_check(const avrLzDfuStream_t *stream)
+{
+    uint32_t in = 0;
+    uint32_t out = 0;
+    uint8_t flags = 0;
+    uint8_t tokensLeft = 0;
+
+    while (out < stream->applicationSize) {
+        if (tokensLeft == 0) {
+            if (in >= stream->compressedLength)
+                return false;
+            flags = pgm_read_byte_far(stream->addr(in++));
+            tokensLeft = 8;
+        }
+        tokensLeft--;
+        bool literal = flags & 1;
+        flags >>= 1;
+
+        if (literal) {
+            if (in >= stream->compressedLength)
+                return false;
+            in++;
+            out++;
+            continue;
+        }
 
-	    avr_readBuf(dfu_writeBuf, lengthToWrite, dfuStream, index);
+        if (in + 2 > stream->compressedLength)
+            return false;
+        uint16_t token = pgm_read_byte_far(stream->addr(in));
+        token |= (uint16_t) pgm_read_byte_far(stream->addr(in + 1)) << 8;
+        in += 2;
+        if ((token & 0x1FF) >= out)
+            return false;
+        out += (token >> 9) + 3;
+    }
+    return out == stream->applicationSize && in == stream->compressedLength;
+}
 
-        rc = sensorhub_i2cTransferWithRetry(sh, sh->bootloaderAddress, dfu_writeBuf, lengthToWrite, 0, 0);
-        if (rc != SENSORHUB_STATUS_SUCCESS)
-            return checkError(sh, rc);
+static uint8_t lz_next(lzReader_t *lz)
+{
+    uint8_t byte;
 
-        rc = sensorhub_i2cTransferWithRetry(sh, sh->bootloaderAddress, 0, 0, &response, sizeof(response));
-        if (rc != SENSORHUB_STATUS_SUCCESS)
-            return checkError(sh, rc);
+    if (lz->matchLeft == 0) {
+        if (lz->tokensLeft == 0) {
+            lz->flags = lz_in(lz);
+            lz->tokensLeft = 8;
+        }
+        lz->tokensLeft--;
+        bool literal = lz->flags & 1;
+        lz->flags >>= 1;
+
+        if (literal) {
+            byte = lz_in(lz);
+            lz->window[lz->out] = byte;
+            lz->out = (lz->out + 1) % DFU_LZ_WINDOW;
+            return byte;
+        }
 
-        /* Check that we got a successful response. */
-        if (response != 's')
-            return checkError(sh, SENSORHUB_STATUS_DFU_RECEIVED_NAK);
+        uint16_t token = lz_in(lz);
+        token |= (uint16_t) lz_in(lz) << 8;
+        lz->matchLeft = (token >> 9) + 3;
+        lz->matchFrom = (lz->out + DFU_LZ_WINDOW - 1 - (token & 0x1FF)) % DFU_LZ_WINDOW;
+    }
 
-        /* The capture from the Bosch programmer had a 1-3 ms delay between packets.
-         * Testing confirms that if we don't delay that the programmed image doesn't
-         * work. 2 ms works. 1 ms doesn't.
-         */
-        //sh->delay(sh, 2);
+    byte = lz->window[lz->matchFrom];
+    lz->matchFrom = (lz->matchFrom + 1) % DFU_LZ_WINDOW;
+    lz->matchLeft--;
+    lz->window[lz->out] = byte;
+    lz->out = (lz->out + 1) % DFU_LZ_WINDOW;
+    return byte;
+}
 
-        index += lengthToWrite;
-		dfu_index = index;
+/* Rebuilds the stream: the application size, the packet payload size, then the application packets */
+static int lz_fill(void *source, uint8_t *packet)
+{
+    lzReader_t *lz = source;
+    int payloadSize = lz->stream->packetPayloadSize;
+
+    if (lz->headersLeft == 2) {
+        uint32_t applicationSize = lz->stream->applicationSize;
+        packet[0] = (uint8_t) (applicationSize >> 24);
+        packet[1] = (uint8_t) (applicationSize >> 16);
+        packet[2] = (uint8_t) (applicationSize >> 8);
+        packet[3] = (uint8_t) applicationSize;
+        lz->headersLeft--;
+        return dfu_appendCrc(packet, 4);
+    }
+    if (lz->headersLeft == 1) {
+        packet[0] = (uint8_t) payloadSize;
+        lz->headersLeft--;
+        return dfu_appendCrc(packet, 1);
     }
 
-    return sensorhub_probe_internal(sh, false);
+    int length = (lz->remaining < payloadSize) ? lz->remaining : payloadSize;
+    if (length == 0)
+        return 0;
+    for (int n = 0; n < length; n++)
+        packet[n] = lz_next(lz);
+    lz->remaining -= length;
+    return dfu_appendCrc(packet, length);
+}
+
+int sensorhub_dfu_avr_lz(const sensorhub_t *sh,
+                         const avrLzDfuStream_t *dfuStream)
+{
+    uint32_t applicationSize = dfuStream->applicationSize;
+    int payloadSize = dfuStream->packetPayloadSize;
+    if (payloadSize == 0 || payloadSize + 2 > sizeof(dfu_writeBuf[0]))
+        return checkError(sh, SENSORHUB_STATUS_DFU_STREAM_SIZE_WRONG);
+
+    /* A damaged image must be refused before the hub's firmware is erased */
+    if (!lz_check(dfuStream))
+        return checkError(sh, SENSORHUB_STATUS_DFU_STREAM_SIZE_WRONG);
+
+    lzReader_t lz;
+    memset(&lz, 0, sizeof(lz) - sizeof(lz.window));
+    lz.stream = dfuStream;
+    lz.remaining = applicationSize;
+    lz.headersLeft = 2;
+
+    int rc = sensorhub_dfuBegin(sh);
+    if (rc != SENSORHUB_STATUS_SUCCESS)
+        return rc;
+
+    uint32_t totalLength = 13 + applicationSize + ((applicationSize + payloadSize - 1) / payloadSize) * 2;
+    rc = dfu_sendPackets(sh, lz_fill, &lz, totalLength);
+    if (rc != SENSORHUB_STATUS_SUCCESS)
+        return rc;
+
+    return sensorhub_dfuEnd(sh);
 }
 
 int sensorhub_dfu(const sensorhub_t *sh,
@@ -1124,24 +1422,12 @@ int sensorhub_dfu(const sensorhub_t *sh,
     if (expectedLength != length)
         return checkError(sh, SENSORHUB_STATUS_DFU_STREAM_SIZE_WRONG);
 
-    /* Put the BNO070 into reset */
-    sh->setRSTN(sh, 0);
-
-    /* BNO070 BOOTN low (bootloader mode) */
-    sh->setBOOTN(sh, 0);
-
-    sh->delay(sh, 10);
-
-    /* Take the BNO070 out of reset */
-    sh->setRSTN(sh, 1);
-
-    sh->delay(sh, 10);
+    sensorhub_dfuBegin(sh);
 
     /* Send each packet of the DFU */
     int index = 4;
     while (index < length) {
         int rc;
-        uint8_t response;
 
         int lengthToWrite = packetSize;
         if (index == 4)
@@ -1151,27 +1437,104 @@ int sensorhub_dfu(const sensorhub_t *sh,
         else if (index + lengthToWrite > length)
             lengthToWrite = length - index; // Last packet -> could be short
 
-        rc = sensorhub_i2cTransferWithRetry(sh, sh->bootloaderAddress, &dfuStream[index], lengthToWrite, 0, 0);
+        rc = sensorhub_dfuWritePacket(sh, &dfuStream[index], lengthToWrite);
         if (rc != SENSORHUB_STATUS_SUCCESS)
-            return checkError(sh, rc);
+            return rc;
 
-        rc = sensorhub_i2cTransferWithRetry(sh, sh->bootloaderAddress, 0, 0, &response, sizeof(response));
-        if (rc != SENSORHUB_STATUS_SUCCESS)
-            return checkError(sh, rc);
+        index += lengthToWrite;
+        if (sh->dfuProgress)
+            sh->dfuProgress(sh, index, length);
+    }
 
-        /* Check that we got a successful response. */
-        if (response != 's')
-            return checkError(sh, SENSORHUB_STATUS_DFU_RECEIVED_NAK);
+    return sensorhub_dfuEnd(sh);
+}
 
-        /* The capture from the Bosch programmer had a 1-3 ms delay between packets.
-         * Testing confirms that if we don't delay that the programmed image doesn't
-         * work. 2 ms works. 1 ms doesn't.
-         */
-        //sh->delay(sh, 2);
+int sensorhub_dfuBegin(const sensorhub_t * sh)
+{
+    /* Put the BNO070 into reset */
+    sh->setRSTN(sh, 0);
 
-        index += lengthToWrite;
+    /* BNO070 BOOTN low (bootloader mode) */
+    sh->setBOOTN(sh, 0);
+
+    sh->delay(sh, 10);
+
+    /* Take the BNO070 out of reset */
+    sh->setRSTN(sh, 1);
+
+    sh->delay(sh, 10);
+
+    return SENSORHUB_STATUS_SUCCESS;
+}
+
+/* The DFU packet handed to sh->i2cWriteStart() and not yet waited for */
+static bool dfu_writeInFlight;
+
+int sensorhub_dfuStartPacket(const sensorhub_t * sh,
+                             const uint8_t * packet, int length)
+{
+    if (sh->i2cWriteStart &&
+        sh->i2cWriteStart(sh, sh->bootloaderAddress, packet, length) == SENSORHUB_STATUS_SUCCESS) {
+        dfu_writeInFlight = true;
+        return SENSORHUB_STATUS_SUCCESS;
     }
 
+    /* No background writes (or the bus was busy): write it now */
+    dfu_writeInFlight = false;
+    int rc = sensorhub_i2cTransferWithRetry(sh, sh->bootloaderAddress, packet, length, 0, 0);
+    if (rc != SENSORHUB_STATUS_SUCCESS)
+        return checkError(sh, rc);
+    return SENSORHUB_STATUS_SUCCESS;
+}
+
+int sensorhub_dfuFinishPacket(const sensorhub_t * sh,
+                              const uint8_t * packet, int length)
+{
+    int rc;
+    uint8_t response;
+
+    if (dfu_writeInFlight) {
+        dfu_writeInFlight = false;
+        if (sh->i2cWriteWait(sh) != SENSORHUB_STATUS_SUCCESS) {
+            /* Send it again the slow way, retrying as any other transfer */
+            rc = sensorhub_i2cTransferWithRetry(sh, sh->bootloaderAddress, packet, length, 0, 0);
+            if (rc != SENSORHUB_STATUS_SUCCESS)
+                return checkError(sh, rc);
+        }
+    }
+
+    rc = sensorhub_i2cTransferWithRetry(sh, sh->bootloaderAddress, 0, 0, &response, sizeof(response));
+    if (rc != SENSORHUB_STATUS_SUCCESS)
+        return checkError(sh, rc);
+
+    /* Check that we got a successful response. */
+    if (response != 's')
+        return checkError(sh, SENSORHUB_STATUS_DFU_RECEIVED_NAK);
+
+    /* The capture from the Bosch programmer had a 1-3 ms delay between packets.
+     * Testing confirms that if we don't delay that the programmed image doesn't
+     * work. 2 ms works. 1 ms doesn't.
+     */
+    //sh->delay(sh, 2);
+
+    return SENSORHUB_STATUS_SUCCESS;
+}
+
+int sensorhub_dfuWritePacket(const sensorhub_t * sh,
+                             const uint8_t * packet, int length)
+{
+    int rc = sensorhub_dfuStartPacket(sh, packet, length);
+    if (rc != SENSORHUB_STATUS_SUCCESS)
+        return rc;
+    return sensorhub_dfuFinishPacket(sh, packet, length);
+}
+
+int sensorhub_dfuEnd(const sensorhub_t * sh)
+{
+    /* BOOTN high again, so the next reset of any kind starts the new
+     * application rather than the bootloader */
+    sh->setBOOTN(sh, 1);
+
     return sensorhub_probe_internal(sh, false);
 }
 
@@ -1278,6 +1641,21 @@ int sensorhub_saveDcd(const sensorhub_t *sh)
 	return rc;
 }
 
+int sensorhub_startSaveDcd(const sensorhub_t *sh)
+{
+	uint8_t buffer[SENSORHUB_CMD_LEN];
+
+	memset(buffer, 0, sizeof(buffer));
+	buffer[1] = CMD_SAVE_DCD;
+
+	sensorhub_dcdSaveStatus = SENSORHUB_STATUS_DCD_SAVE_PENDING;
+	int rc = shhid_setReport(sh, HID_REPORT_TYPE_OUTPUT, SENSORHUB_CMD_REQ,
+	                         buffer, SENSORHUB_CMD_LEN-1);
+	if (rc != SENSORHUB_STATUS_SUCCESS)
+		sensorhub_dcdSaveStatus = rc;
+	return checkError(sh, rc);
+}
+
 int sensorhub_dcdAutoSave(const sensorhub_t *sh, bool state)
 {
 	uint8_t buffer[32];
@@ -181,6 +181,12 @@ typedef struct sensorhub_stats_s {
     int i2cTransfers;
     int i2cRetries;
     int i2cErrors;
+    uint32_t reportBytesRead;   /* input report bytes moved over I2C */
+    uint32_t reportBytesSaved;  /* bytes not read thanks to i2cReadReport */
+    /* Phases of the last sensorhub_probe(), in getTick() milliseconds */
+    uint32_t probeResetMs;       /* reset release until HOST_INTN went high */
+    uint32_t probeDescriptorMs;  /* then until the HID descriptor was read */
+    uint32_t probeIntnMs;        /* then until HOST_INTN was first asserted */
 } sensorhub_stats_t;
 
 /**
@@ -302,6 +308,77 @@ typedef struct sensorhub_s {
 
     /* Optional pointer for callbacks */
     void *cookie;
+
+    /**
+     * Optional. Read one input report in two phases: first the 2-byte
+     * HID length header, then, continuing the same read (no STOP), only
+     * the rest of the report. If NULL, every report read transfers
+     * maxLength bytes through i2cTransfer().
+     *
+     * @param sh the sensorhub
+     * @param address the I2C address to receive from
+     * @param receiveData where to store the report, header included
+     * @param maxLength the most bytes to receive
+     * @return 0 on success. <0 will be propogated back through Sensor Hub API.
+     */
+    int (*i2cReadReport) (const struct sensorhub_s * sh, uint8_t address,
+                          uint8_t * receiveData, int maxLength);
+
+    /**
+     * Optional. Start writing bytes to the BNO070 and return without
+     * waiting for the transfer to end; sendData must stay valid until
+     * i2cWriteWait() returns. The DFU functions use this to prepare the
+     * next packet while one is on the bus. If NULL, or if it fails,
+     * DFU packets are written through i2cTransfer().
+     *
+     * @return 0 if the write was started.
+     */
+    int (*i2cWriteStart) (const struct sensorhub_s * sh, uint8_t address,
+                          const uint8_t * sendData, int sendLength);
+
+    /**
+     * Wait for the write started by i2cWriteStart().
+     *
+     * @return 0 if all the bytes were written.
+     */
+    int (*i2cWriteWait) (const struct sensorhub_s * sh);
+
+    /**
+     * Optional. Called by sensorhub_dfu(), sensorhub_dfu_avr() and
+     * sensorhub_dfu_avr_lz() when they start sending packets and after
+     * every packet the bootloader accepts.
+     *
+     * @param written DFU stream bytes sent so far, counting the format
+     * @param total length of the DFU stream
+     */
+    void (*dfuProgress) (const struct sensorhub_s * sh, uint32_t written,
+                         uint32_t total);
+
+    /**
+     * Optional. Offered every input report read by sensorhub_poll()
+     * before it is decoded, so the caller can handle the reports it
+     * cares most about straight from the I2C buffer.
+     *
+     * @param report the report as read, starting with its length
+     * @return true if the report was consumed; it is then not decoded
+     *         into an event.
+     */
+    bool (*takeReport) (const struct sensorhub_s * sh, const uint8_t * report);
+
+    /**
+     * Optional. Wait until HOST_INTN is at the given level, returning
+     * as soon as it is rather than after a fixed delay; for level 0 an
+     * assertion that has come and gone by the time the caller looks
+     * also counts. If NULL, sensorhub_probe() polls getHOST_INTN()
+     * every millisecond.
+     *
+     * @param sh the sensorhub
+     * @param level 0 or 1
+     * @param timeoutMs the most milliseconds to wait
+     * @return the level HOST_INTN was seen at, 0 or 1
+     */
+    int (*waitHOST_INTN) (const struct sensorhub_s * sh, int level,
+                          uint32_t timeoutMs);
 } sensorhub_t;
 
 typedef struct sensorhub_RawAccelerometer {
@@ -497,6 +574,7 @@ enum sensorhub_Status_e {
 	SENSORHUB_STATUS_MORE_EVENTS_PENDING = 1,
     SENSORHUB_STATUS_NO_REPORT_PENDING = 2,
 	SENSORHUB_STATUS_HUB_RESET = 3,
+	SENSORHUB_STATUS_DCD_SAVE_PENDING = 4,
 
     /* Success */
     SENSORHUB_STATUS_SUCCESS = 0,         /**< The operation was successful */
@@ -536,6 +614,7 @@ enum sensorhub_Status_e {
     SENSORHUB_STATUS_DFU_RECEIVED_NAK = -32,
     SENSORHUB_STATUS_INVALID_HID_DESCRIPTOR = -33,
     SENSORHUB_STATUS_OP_FAILED = -34,
+    SENSORHUB_STATUS_DFU_BAD_CRC = -35,     /* a DFU stream packet failed its CRC check */
 };
 
 enum sensorhub_FRS_ReadStatus_e {
@@ -626,16 +705,35 @@ typedef struct avrDfuStream_s {
   /* const int_farptr_t page[DFU_MAX_PAGES]; */
 } avrDfuStream_t;
 
+/* History the LZ decompressor keeps while rebuilding an image (bytes) */
+#define DFU_LZ_WINDOW (512)
+
+/*
+ * A DFU stream whose application bytes are LZ compressed in far
+ * PROGMEM, as written by generate-bno-dfu.py. The stream header and
+ * packet CRCs are rebuilt while the image is sent.
+ */
+typedef struct avrLzDfuStream_s {
+  unsigned long applicationSize;
+  unsigned long compressedLength;
+  uint8_t packetPayloadSize;
+  uint32_t (*addr)(uint32_t index);  /* far address of compressed byte */
+} avrLzDfuStream_t;
+
 extern bool sensorhub_needs_init;
 extern uint32_t sensorhub_resets;
 extern uint32_t sensorhub_events;
 extern uint32_t sensorhub_empty_events;
+/* Outcome of the last sensorhub_startSaveDcd(), filled in by sensorhub_poll() when the hub answers */
+extern int sensorhub_dcdSaveStatus;
 
 /**
  * Reset the sensor hub and initialize it over the I2C bus. This
  * function should be called on power up or if the sensor hub's
  * configuration should be reset. The sensor hub will not send
  * any notifications until sensors have been configured.
+ * Each wait ends as soon as the hub is ready, within 1.2 s overall;
+ * how long each phase took is left in sh->stats.
  *
  * @param sh the sensor hub configuration
  * @return 0 on success; negative on failure
@@ -698,6 +796,10 @@ int sensorhub_calEnable(const sensorhub_t *sh, uint8_t flags);
 
 /* Save the current dynamic calibration data in non-volatile storage. */	
 int sensorhub_saveDcd(const sensorhub_t * sh);
+
+/* Send the Save DCD command without waiting; sensorhub_dcdSaveStatus stays
+ * SENSORHUB_STATUS_DCD_SAVE_PENDING until the response has been polled. */
+int sensorhub_startSaveDcd(const sensorhub_t * sh);
 	
 /**
  * This function will wait for an event. It only returns when it either
@@ -808,6 +910,49 @@ int sensorhub_dfu_avr(const sensorhub_t * sh,
 			  
 uint32_t dfuAddr(uint32_t index);
 
+/**
+ * Update the firmware on the sensor hub from a compressed image,
+ * decompressing it one packet at a time. Needs DFU_LZ_WINDOW bytes
+ * of stack on top of what sensorhub_dfu_avr() uses. The compressed
+ * stream is checked first, so a damaged image is refused with
+ * SENSORHUB_STATUS_DFU_STREAM_SIZE_WRONG before the hub is reset into
+ * its bootloader.
+ *
+ * @param dfuStream the firmware written by generate-bno-dfu.py
+ * @return 0 on success; negative on failure
+ */
+int sensorhub_dfu_avr_lz(const sensorhub_t * sh,
+                         const avrLzDfuStream_t * dfuStream);
+
+/**
+ * The steps of sensorhub_dfu(), for callers that receive the DFU stream
+ * a packet at a time: sensorhub_dfuBegin() resets the hub into its
+ * bootloader, sensorhub_dfuWritePacket() sends one packet (the 6-byte
+ * application size, the 3-byte packet size, then each payload with its
+ * CRC) and waits for the bootloader's ack, and sensorhub_dfuEnd() sets
+ * BOOTN high again and waits for the new firmware to start. Call
+ * sensorhub_probe() afterwards.
+ *
+ * @return 0 on success; negative on failure
+ */
+int sensorhub_dfuBegin(const sensorhub_t * sh);
+int sensorhub_dfuWritePacket(const sensorhub_t * sh,
+                             const uint8_t * packet, int length);
+int sensorhub_dfuEnd(const sensorhub_t * sh);
+
+/**
+ * sensorhub_dfuWritePacket() in two halves, so the caller can prepare
+ * the next packet while this one is written (if sh->i2cWriteStart is
+ * set). Pass the same packet, unchanged, to both; the finish waits for
+ * the write and the bootloader's ack.
+ *
+ * @return 0 on success; negative on failure
+ */
+int sensorhub_dfuStartPacket(const sensorhub_t * sh,
+                             const uint8_t * packet, int length);
+int sensorhub_dfuFinishPacket(const sensorhub_t * sh,
+                              const uint8_t * packet, int length);
+
 /**
  * Turn on/off automatic saving of DCD (Dynamic Cal Data)
  *
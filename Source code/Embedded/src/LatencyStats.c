@@ -0,0 +1,86 @@
+/*
+ * LatencyStats.c
+ *
+ * Recording costs one bit-length computation and one 32-bit increment, so it stays enabled in normal builds.
+ */
+
+#include "LatencyStats.h"
+
+// asf headers
+#include <interrupt.h>
+
+// standard headers
+#include <stdbool.h>
+#include <string.h>
+
+static uint32_t histograms_[LATENCY_STAGE_COUNT][LATENCY_BUCKET_COUNT];
+static volatile bool resetPending_ = false;  // set by Latency_Reset(), cleared by Latency_Task()
+
+static uint8_t bucketOf(uint32_t us)
+{
+	uint8_t bits = 0;
+	while (us > 0xFF)
+	{
+		us >>= 8;
+		bits += 8;
+	}
+	while (us)
+	{
+		us >>= 1;
+		bits++;
+	}
+	return (bits < LATENCY_BUCKET_COUNT) ? bits : LATENCY_BUCKET_COUNT - 1;
+}
+
+void Latency_Record(LatencyStage_t stage, uint32_t us)
+{
+	uint32_t *count = &histograms_[stage][bucketOf(us)];
+	if (*count != UINT32_MAX)
+	{
+		(*count)++;
+	}
+}
+
+uint32_t Latency_GetCount(LatencyStage_t stage, uint8_t bucket)
+{
+	if (stage >= LATENCY_STAGE_COUNT || bucket >= LATENCY_BUCKET_COUNT)
+	{
+		return 0;
+	}
+	irqflags_t flags = cpu_irq_save();
+	uint32_t count = resetPending_ ? 0 : histograms_[stage][bucket];
+	cpu_irq_restore(flags);
+	return count;
+}
+
+void Latency_Reset(void) { resetPending_ = true; }
+void Latency_Task(void)
+{
+	if (!resetPending_)
+	{
+		return;
+	}
+
+	// the queue>sent stage is recorded from the USB interrupt
+	irqflags_t flags = cpu_irq_save();
+	memset(histograms_, 0, sizeof(histograms_));
+	resetPending_ = false;
+	cpu_irq_restore(flags);
+}
+
+const char *Latency_StageName(LatencyStage_t stage)
+{
+	switch (stage)
+	{
+	case LATENCY_INTN_TO_READ:
+		return "INTN>read";
+	case LATENCY_READ_TO_DECODE:
+		return "read>decode";
+	case LATENCY_DECODE_TO_QUEUE:
+		return "decode>queued";
+	case LATENCY_QUEUE_TO_SENT:
+		return "queued>sent";
+	default:
+		return "?";
+	}
+}
@@ -0,0 +1,37 @@
+/*
+ * LatencyStats.h
+ * Log-scale latency histograms for each stage of the tracker path, from the BNO interrupt to the USB endpoint.
+ */
+
+#ifndef LATENCYSTATS_H_
+#define LATENCYSTATS_H_
+
+#include <stdint.h>
+
+typedef enum
+{
+	LATENCY_INTN_TO_READ = 0,   ///< INTN edge to the report read completing over TWI
+	LATENCY_READ_TO_DECODE,     ///< read complete to the decoded event being handled
+	LATENCY_DECODE_TO_QUEUE,    ///< event handled to the HID report being queued
+	LATENCY_QUEUE_TO_SENT,      ///< report queued to the IN transfer completing
+	LATENCY_STAGE_COUNT
+} LatencyStage_t;
+
+/// Bucket 0 counts 0 us; bucket n (n >= 1) counts [2^(n-1), 2^n) us; the last bucket also takes anything longer.
+#define LATENCY_BUCKET_COUNT 16
+
+/// Add one measurement, in microseconds. Each stage must only be recorded from one context.
+void Latency_Record(LatencyStage_t stage, uint32_t us);
+
+uint32_t Latency_GetCount(LatencyStage_t stage, uint8_t bucket);
+
+/// Clear all histograms. Safe from the USB interrupt: counts read as zero at once, and Latency_Task() clears them.
+void Latency_Reset(void);
+
+/// Carry out a requested reset. Main loop only, since that is where most stages are recorded without masking.
+void Latency_Task(void);
+
+/// Short name of a stage, for console output.
+const char *Latency_StageName(LatencyStage_t stage);
+
+#endif /* LATENCYSTATS_H_ */
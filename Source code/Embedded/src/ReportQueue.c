@@ -0,0 +1,180 @@
+/*
+ * ReportQueue.c
+ *
+ * Single-producer/single-consumer ring: the producer only writes tail_, the consumer only writes head_, so pushing
+ * never masks interrupts. The consumer side runs either in the USB interrupt or with interrupts masked, so it is
+ * never re-entered.
+ *
+ * The endpoint sends straight from the slot, so slot sending_ stays taken until the transfer completes: with a
+ * transfer in flight, the producer can only fill the slots from sending_ + 1 on. Flushing only happens while the
+ * endpoint is reset or detached, when no transfer can be using a slot.
+ */
+
+#include "ReportQueue.h"
+
+// Options header
+#include "GlobalOptions.h"
+
+// application headers
+#include "SvrClock.h"
+#include "LatencyStats.h"
+
+// asf headers
+#include <interrupt.h>
+#include <udi_hid_generic.h>
+
+// standard headers
+#include <string.h>
+
+#if (HID_REPORT_QUEUE_DEPTH & (HID_REPORT_QUEUE_DEPTH - 1)) || HID_REPORT_QUEUE_DEPTH < 2 || \
+    HID_REPORT_QUEUE_DEPTH > 128
+#error "HID_REPORT_QUEUE_DEPTH must be a power of two between 2 and 128"
+#endif
+#define QUEUE_MASK (HID_REPORT_QUEUE_DEPTH - 1)
+
+static uint8_t slots_[HID_REPORT_QUEUE_DEPTH][USB_REPORT_SIZE];
+static uint32_t slotTime_[HID_REPORT_QUEUE_DEPTH];  // svr_clock_us() when each report was queued
+static uint32_t inFlightTime_;                      // queue time of the report the endpoint is sending
+static volatile bool inFlight_ = false;
+static volatile uint8_t sending_ = 0;  // free-running index of the slot the endpoint is sending from, if inFlight_
+static volatile uint8_t head_ = 0;  // free-running index of the next report to send (consumer)
+static volatile uint8_t tail_ = 0;  // free-running index of the next free slot (producer)
+static volatile ReportQueuePolicy_t policy_ = REPORT_QUEUE_FIFO;
+static volatile ReportQueueStats_t stats_;
+
+/// Consumer side; must not be interrupted by itself.
+static void service(void)
+{
+	uint8_t head = head_;
+	uint8_t count = tail_ - head;
+	if (count == 0)
+	{
+		return;
+	}
+
+	if (policy_ == REPORT_QUEUE_LATEST && count > 1)
+	{
+		// only the newest pose matters
+		stats_.coalesced += count - 1;
+		head += count - 1;
+	}
+
+	if (udi_hid_generic_send_report_in_nocopy(slots_[head & QUEUE_MASK]))
+	{
+		inFlightTime_ = slotTime_[head & QUEUE_MASK];
+		sending_ = head;
+		inFlight_ = true;
+		head++;
+		stats_.delivered++;
+	}
+	head_ = head;
+}
+
+/// Slots taken, from the one in flight (or the oldest waiting) up to tail.
+static inline uint8_t used(uint8_t tail)
+{
+	// the interrupt only ever moves sending_ forward, so a stale read overestimates
+	return inFlight_ ? (uint8_t)(tail - sending_) : (uint8_t)(tail - head_);
+}
+
+uint8_t *ReportQueue_Claim(void)
+{
+	uint8_t tail = tail_;
+	if (used(tail) >= HID_REPORT_QUEUE_DEPTH)
+	{
+		if (policy_ != REPORT_QUEUE_LATEST)
+		{
+			stats_.dropped++;
+			return NULL;
+		}
+
+		// only the report about to be written matters: retire all waiting ones, acting as the consumer, and restart
+		// the ring just after the slot in flight
+		irqflags_t flags = cpu_irq_save();
+		tail = tail_;
+		if (used(tail) >= HID_REPORT_QUEUE_DEPTH)
+		{
+			stats_.coalesced += (uint8_t)(tail - head_);
+			tail = inFlight_ ? sending_ + 1 : tail;
+			head_ = tail;
+			tail_ = tail;
+		}
+		cpu_irq_restore(flags);
+	}
+	return slots_[tail & QUEUE_MASK];
+}
+
+bool ReportQueue_HasRoom(void)
+{
+	// the interrupt only frees slots, so the answer holds until the main loop claims one
+	return policy_ == REPORT_QUEUE_LATEST || used(tail_) < HID_REPORT_QUEUE_DEPTH;
+}
+
+void ReportQueue_Commit(void)
+{
+	uint8_t tail = tail_;
+	slotTime_[tail & QUEUE_MASK] = svr_clock_us();
+	tail_ = tail + 1;  // publish
+
+	irqflags_t flags = cpu_irq_save();
+	service();
+	cpu_irq_restore(flags);
+}
+
+bool ReportQueue_Push(const uint8_t *report)
+{
+	uint8_t *slot = ReportQueue_Claim();
+	if (slot == NULL)
+	{
+		return false;
+	}
+	memcpy(slot, report, USB_REPORT_SIZE);
+	ReportQueue_Commit();
+	return true;
+}
+
+void ReportQueue_CountDirect(uint8_t dropped)
+{
+	irqflags_t flags = cpu_irq_save();
+	stats_.delivered++;
+	stats_.dropped += dropped;
+	cpu_irq_restore(flags);
+}
+
+void ReportQueue_Sent(void)
+{
+	if (inFlight_)
+	{
+		inFlight_ = false;
+		Latency_Record(LATENCY_QUEUE_TO_SENT, svr_clock_us() - inFlightTime_);
+	}
+	service();
+}
+
+void ReportQueue_Flush(void)
+{
+	irqflags_t flags = cpu_irq_save();
+	head_ = tail_;
+	inFlight_ = false;
+	cpu_irq_restore(flags);
+}
+
+void ReportQueue_SetPolicy(ReportQueuePolicy_t policy) { policy_ = policy; }
+ReportQueuePolicy_t ReportQueue_GetPolicy(void) { return policy_; }
+void ReportQueue_GetStats(ReportQueueStats_t *stats)
+{
+	irqflags_t flags = cpu_irq_save();
+	stats->delivered = stats_.delivered;
+	stats->dropped = stats_.dropped;
+	stats->coalesced = stats_.coalesced;
+	cpu_irq_restore(flags);
+}
+
+void ReportQueue_ResetStats(void)
+{
+	irqflags_t flags = cpu_irq_save();
+	stats_.delivered = 0;
+	stats_.dropped = 0;
+	stats_.coalesced = 0;
+	cpu_irq_restore(flags);
+}
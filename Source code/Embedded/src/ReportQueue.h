@@ -0,0 +1,62 @@
+/*
+ * ReportQueue.h
+ * Queue of tracker reports waiting for the HID generic IN endpoint.
+ *
+ * The main loop is the only producer. Reports are sent from the endpoint's transfer-complete interrupt, or right
+ * away when the endpoint is idle.
+ */
+
+#ifndef REPORTQUEUE_H_
+#define REPORTQUEUE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum
+{
+	REPORT_QUEUE_FIFO = 0,   ///< send every report in order; drop new reports when full
+	REPORT_QUEUE_LATEST = 1  ///< send only the newest report, superseding any still waiting
+} ReportQueuePolicy_t;
+
+typedef struct
+{
+	uint32_t delivered;  ///< handed to the endpoint
+	uint32_t dropped;    ///< discarded because the queue was full (FIFO policy), or packed samples (see below)
+	uint32_t coalesced;  ///< superseded by a newer report before being sent (latest-wins policy)
+} ReportQueueStats_t;
+
+/// Queue a USB_REPORT_SIZE-byte report and start sending it if the endpoint is idle. Main loop only.
+bool ReportQueue_Push(const uint8_t *report);
+
+/**
+ * Slot for the next report, to be filled in place and queued with ReportQueue_Commit(); NULL if the queue is full.
+ * Main loop only; nothing else may be pushed between the two calls.
+ */
+uint8_t *ReportQueue_Claim(void);
+
+/// True if ReportQueue_Claim() would return a slot rather than count a drop. Main loop only.
+bool ReportQueue_HasRoom(void);
+
+/// Queue the report written to the slot from ReportQueue_Claim() and start sending it if the endpoint is idle.
+void ReportQueue_Commit(void);
+
+/**
+ * Count a report the caller handed to the endpoint itself, and the samples it had to discard while the endpoint was
+ * busy. The 64-byte packed formats send this way: they gather samples into a single report until the endpoint is
+ * free, so there is never a second one to queue. Main loop only.
+ */
+void ReportQueue_CountDirect(uint8_t dropped);
+
+/// Account for the completed IN transfer and send the next waiting report. Called from the transfer-complete callback.
+void ReportQueue_Sent(void);
+
+/// Discard all waiting reports, e.g. when the host reconfigures the interface.
+void ReportQueue_Flush(void);
+
+void ReportQueue_SetPolicy(ReportQueuePolicy_t policy);
+ReportQueuePolicy_t ReportQueue_GetPolicy(void);
+
+void ReportQueue_GetStats(ReportQueueStats_t *stats);
+void ReportQueue_ResetStats(void);
+
+#endif /* REPORTQUEUE_H_ */
@@ -55,6 +55,8 @@
 #include <util/delay.h>
 #include "my_hardware.h"
 #include "SideBySide.h"
+#include "ReportQueue.h"
+#include "LatencyStats.h"
 
 #ifdef SVR_HAVE_SOLOMON
 #include "DeviceDrivers/Solomon.h"
@@ -729,12 +731,48 @@ void ProcessInfoCommands(void)
 }
 
 #ifdef BNO070
+static const char *const orientationSourceNames_[BNO_SOURCE_COUNT] = {"RV", "GRV", "Geomagnetic RV"};
+
 void ProcessBNO070Commands(void)
 {
 	char OutString[40];
 
 	switch (CommandToExecute[1])
 	{
+	case 'C':
+	case 'c':
+	{
+		switch (CommandToExecute[2])
+		{
+		case 'Q':
+		case 'q':
+		{
+			// #BCQ - sensor rates in Hz as configured, 0 = off
+			sprintf(OutString, "%s: %u Hz", orientationSourceNames_[SELECT_GRV],
+			        GetSensorRate_BNO070(BNO_SENSOR_ORIENTATION));
+			WriteLn(OutString);
+			sprintf(OutString, "Gyro: %u Hz", GetSensorRate_BNO070(BNO_SENSOR_GYRO));
+			WriteLn(OutString);
+			sprintf(OutString, "Acc: %u Hz", GetSensorRate_BNO070(BNO_SENSOR_ACC));
+			WriteLn(OutString);
+			sprintf(OutString, "Mag: %u Hz", GetSensorRate_BNO070(BNO_SENSOR_MAG));
+			WriteLn(OutString);
+			sprintf(OutString, "Lin acc: %u Hz", GetSensorRate_BNO070(BNO_SENSOR_LIN_ACC));
+			WriteLn(OutString);
+			break;
+		}
+		case 'C':
+		case 'c':
+		{
+			// #BCCxx hub report capture xx=0 turn off, all else = on
+			bool enabled = HexPairToDecimal(3) > 0;
+			SetCapture_BNO070(enabled);
+			WriteLn(enabled ? "Capture on" : "Capture off");
+			break;
+		}
+		}
+		break;
+	}
 	case 'D':
 	case 'd':
 	{
@@ -759,10 +797,10 @@ void ProcessBNO070Commands(void)
 		case 'S':
 		case 's':
 		{
-			// #BDS - BNO DCD Save
+			// #BDS - BNO DCD Save; the outcome is printed when the save finishes
 			if (SaveDcd_BNO070())
 			{
-				WriteLn("DCD Saved.");
+				WriteLn("Saving DCD.");
 			}
 			else
 			{
@@ -827,6 +865,114 @@ void ProcessBNO070Commands(void)
 		}
 		break;
 	}
+	case 'L':
+	case 'l':
+	{
+		switch (CommandToExecute[2])
+		{
+		case 'Q':
+		case 'q':
+		{
+			// #BLQ - BNO Latency Query, non-empty histogram buckets per stage
+			for (uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++)
+			{
+				WriteLn(Latency_StageName((LatencyStage_t)stage));
+				for (uint8_t bucket = 0; bucket < LATENCY_BUCKET_COUNT; bucket++)
+				{
+					uint32_t count = Latency_GetCount((LatencyStage_t)stage, bucket);
+					if (count == 0)
+					{
+						continue;
+					}
+					if (bucket == LATENCY_BUCKET_COUNT - 1)
+					{
+						sprintf(OutString, " >=%lu us: %lu", 1UL << (bucket - 1), count);
+					}
+					else
+					{
+						sprintf(OutString, " <%lu us: %lu", 1UL << bucket, count);
+					}
+					WriteLn(OutString);
+				}
+			}
+			break;
+		}
+		case 'R':
+		case 'r':
+		{
+			// #BLR - BNO Latency Reset, also clears the HID queue counters
+			Latency_Reset();
+			ReportQueue_ResetStats();
+			WriteLn("Latency stats cleared.");
+			break;
+		}
+		}
+		break;
+	}
+	case 'O':
+	case 'o':
+	{
+		switch (CommandToExecute[2])
+		{
+		case 'S':
+		case 's':
+		{
+			// #BOSxx - BNO Orientation Source, xx = 00 RV, 01 GRV, 02 geomagnetic RV; cross-faded, not stored
+			uint8_t source = HexPairToDecimal(3);
+			if (SetOrientationSource_BNO070(source))
+			{
+				WriteLn(orientationSourceNames_[source]);
+			}
+			else
+			{
+				WriteLn("Failed.");
+			}
+			break;
+		}
+		case 'Q':
+		case 'q':
+		{
+			// #BOQ - BNO Orientation source Query
+			WriteLn(orientationSourceNames_[GetOrientationSource_BNO070()]);
+			break;
+		}
+		}
+		break;
+	}
+#ifdef BNO_POSE_PREDICTION
+	case 'P':
+	case 'p':
+	{
+		switch (CommandToExecute[2])
+		{
+		case 'H':
+		case 'h':
+		{
+			// #BPHxx - BNO Prediction Horizon, xx in ms (00 = off)
+			uint8_t ms = HexPairToDecimal(3);
+			if (SetPredictionHorizon_BNO070(ms))
+			{
+				sprintf(OutString, "Prediction horizon: %d ms", ms);
+				WriteLn(OutString);
+			}
+			else
+			{
+				WriteLn("Failed.");
+			}
+			break;
+		}
+		case 'Q':
+		case 'q':
+		{
+			// #BPQ - BNO Prediction Query
+			sprintf(OutString, "Prediction horizon: %d ms", GetPredictionHorizon_BNO070());
+			WriteLn(OutString);
+			break;
+		}
+		}
+		break;
+	}
+#endif
 	case 'S':
 	case 's':
 	{
@@ -844,6 +990,52 @@ void ProcessBNO070Commands(void)
 			WriteLn(OutString);
 			sprintf(OutString, "Empty events:%lu", stats.empty_events);
 			WriteLn(OutString);
+			sprintf(OutString, "Ring overflows: %lu", stats.ring_overflows);
+			WriteLn(OutString);
+			sprintf(OutString, "Report bytes read: %lu", stats.report_bytes_read);
+			WriteLn(OutString);
+			sprintf(OutString, "Report bytes saved: %lu", stats.report_bytes_saved);
+			WriteLn(OutString);
+			sprintf(OutString, "DCD saves: %lu failed: %lu aborted: %lu", stats.dcd_saves, stats.dcd_failures,
+			        stats.dcd_aborts);
+			WriteLn(OutString);
+			sprintf(OutString, "DCD gap: %lu ms max: %lu ms", stats.dcd_gap_last_ms, stats.dcd_gap_max_ms);
+			WriteLn(OutString);
+			sprintf(OutString, "Source switch failures: %lu", stats.source_switch_failures);
+			WriteLn(OutString);
+			sprintf(OutString, "Config writes: %lu skipped: %lu", stats.config_writes, stats.config_skipped);
+			WriteLn(OutString);
+			sprintf(OutString, "Tracker cycles: %lu max: %lu fast: %lu", stats.tracker_cycles, stats.tracker_cycles_max,
+			        stats.fast_path_reports);
+			WriteLn(OutString);
+			sprintf(OutString, "Reset recovery: %lu us", stats.reset_recovery_last_us);
+			WriteLn(OutString);
+			sprintf(OutString, "Reset recovery max: %lu us", stats.reset_recovery_max_us);
+			WriteLn(OutString);
+			sprintf(OutString, "Probe reset: %lu ms", stats.probe_reset_ms);
+			WriteLn(OutString);
+			sprintf(OutString, "Probe descriptor: %lu ms", stats.probe_descriptor_ms);
+			WriteLn(OutString);
+			sprintf(OutString, "Probe INTN: %lu ms", stats.probe_intn_ms);
+			WriteLn(OutString);
+			sprintf(OutString, "Product ID: %lu ms", stats.product_id_ms);
+			WriteLn(OutString);
+			sprintf(OutString, "Gyro matched: %lu", stats.gyro_matched);
+			WriteLn(OutString);
+			sprintf(OutString, "Gyro interpolated: %lu", stats.gyro_interpolated);
+			WriteLn(OutString);
+			sprintf(OutString, "Gyro nearest: %lu", stats.gyro_nearest);
+			WriteLn(OutString);
+			sprintf(OutString, "Gyro skew: %d us max: %u us", stats.gyro_skew_last_us, stats.gyro_skew_max_us);
+			WriteLn(OutString);
+			ReportQueueStats_t queueStats;
+			ReportQueue_GetStats(&queueStats);
+			sprintf(OutString, "HID sent: %lu", queueStats.delivered);
+			WriteLn(OutString);
+			sprintf(OutString, "HID dropped: %lu", queueStats.dropped);
+			WriteLn(OutString);
+			sprintf(OutString, "HID coalesced: %lu", queueStats.coalesced);
+			WriteLn(OutString);
 			break;
 		}
 		}
@@ -905,6 +1097,15 @@ void ProcessBNO070Commands(void)
 			}
 			break;
 		}
+		case 'M':
+		case 'm':
+		{
+			// #BRMxx raw IMU streaming xx=0 turn off, all else = on
+			bool enabled = HexPairToDecimal(3) > 0;
+			SetRawImu_BNO070(enabled);
+			WriteLn(enabled ? "Raw IMU on" : "Raw IMU off");
+			break;
+		}
 		}
 	}
 	}
@@ -958,20 +1159,15 @@ void ProcessSPICommand(void)
 	case 'G':
 	case 'g':
 	{
-		if (CommandToExecute[2] == '1')
+		uint8_t source = CommandToExecute[2] - '0';
+		if (SetOrientationSource_BNO070(source))
 		{
-			SELECT_GRV = 1;
-			WriteLn("Game rotation vector");
-		}
-		else if (CommandToExecute[2] == '0')
-		{
-			SELECT_GRV = 0;
-			WriteLn("Rotation vector");
+			WriteLn(source == BNO_USE_GRV ? "Game rotation vector"
+			                              : (source == BNO_USE_RV ? "Rotation vector" : "Geomagnetic rotation vector"));
+			SetConfigValue(GRVOffset, source);
 		}
 		else
 			WriteLn("Bad parameter");
-
-		SetConfigValue(GRVOffset, SELECT_GRV);
 		break;
 	}
 #endif
@@ -0,0 +1,75 @@
+/*
+ * SvrClock.c
+ *
+ * TCC1 counts the peripheral clock divided by 8 and overflows every millisecond; the overflow interrupt extends it
+ * to 32 bits.
+ */
+
+#include "SvrClock.h"
+
+// Options header
+#include "GlobalOptions.h"
+
+// asf headers
+#include <interrupt.h>
+#include <sysclk.h>
+#include <tc.h>
+
+#define SVR_CLOCK_TC TCC1
+
+/// Timer counts per microsecond; assumes a whole-MHz peripheral clock (24 MHz gives 3).
+#define SVR_CLOCK_TICKS_PER_US (sysclk_get_per_hz() / 8 / 1000000UL)
+#define SVR_CLOCK_TICKS_PER_MS (SVR_CLOCK_TICKS_PER_US * 1000)
+
+static volatile uint32_t ms_ = 0;
+
+static void svr_clock_overflow(void) { ms_++; }
+
+void svr_clock_init(void)
+{
+	tc_enable(&SVR_CLOCK_TC);
+	tc_set_overflow_interrupt_callback(&SVR_CLOCK_TC, svr_clock_overflow);
+	tc_set_wgm(&SVR_CLOCK_TC, TC_WG_NORMAL);
+	tc_write_period(&SVR_CLOCK_TC, SVR_CLOCK_TICKS_PER_MS - 1);
+	tc_set_overflow_interrupt_level(&SVR_CLOCK_TC, TC_INT_LVL_HI);
+	tc_write_clock_source(&SVR_CLOCK_TC, TC_CLKSEL_DIV8_gc);
+}
+
+uint32_t svr_clock_ms(void)
+{
+	irqflags_t flags = cpu_irq_save();
+	uint32_t ms = ms_;
+	cpu_irq_restore(flags);
+	return ms;
+}
+
+/// Whole milliseconds and the timer count into the current one.
+static inline uint32_t readClock(uint16_t *count)
+{
+	irqflags_t flags = cpu_irq_save();
+	uint32_t ms = ms_;
+	*count = tc_read_count(&SVR_CLOCK_TC);
+	if (tc_is_overflow(&SVR_CLOCK_TC))
+	{
+		// overflowed while interrupts were masked, so ms_ has not caught up yet; re-read in case the count wrapped
+		// after we sampled it.
+		ms++;
+		*count = tc_read_count(&SVR_CLOCK_TC);
+	}
+	cpu_irq_restore(flags);
+	return ms;
+}
+
+uint32_t svr_clock_us(void)
+{
+	uint16_t count;
+	uint32_t ms = readClock(&count);
+	return ms * 1000 + count / SVR_CLOCK_TICKS_PER_US;
+}
+
+uint32_t svr_clock_cycles(void)
+{
+	uint16_t count;
+	uint32_t ms = readClock(&count);
+	return (ms * SVR_CLOCK_TICKS_PER_MS + count) * 8;
+}
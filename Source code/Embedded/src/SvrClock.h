@@ -0,0 +1,24 @@
+/*
+ * SvrClock.h
+ * Free-running millisecond/microsecond clock, used to timestamp tracker samples.
+ */
+
+#ifndef SVRCLOCK_H_
+#define SVRCLOCK_H_
+
+#include <stdint.h>
+
+/// Start the clock. Call once during startup, before interrupts are enabled.
+void svr_clock_init(void);
+
+/// Milliseconds since svr_clock_init(); wraps after about 49 days.
+uint32_t svr_clock_ms(void);
+
+/// Microseconds since svr_clock_init(); wraps after about 71 minutes. Safe to call from interrupt handlers.
+uint32_t svr_clock_us(void);
+
+/// Peripheral clock cycles since svr_clock_init(), in steps of 8; for timing short stretches of code (wraps after
+/// about three minutes at 24 MHz).
+uint32_t svr_clock_cycles(void);
+
+#endif /* SVRCLOCK_H_ */
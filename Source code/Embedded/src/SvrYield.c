@@ -11,6 +11,7 @@
 #include "GlobalOptions.h"
 
 // Application headers
+#include "LatencyStats.h"
 #ifdef BNO070
 #include "DeviceDrivers/BNO070.h"
 #endif
@@ -27,6 +28,7 @@ __attribute__((always_inline)) inline static void svr_yield_impl()
 	/// switch to an RTOS.
 	BNO_Yield();
 #endif
+	Latency_Task();
 }
 
 void svr_yield(void) { svr_yield_impl(); }
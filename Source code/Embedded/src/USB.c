@@ -22,6 +22,11 @@
 #include "Console.h"
 
 #include "TimingDebug.h"
+#include "ReportQueue.h"
+#include "LatencyStats.h"
+#ifdef BNO_HOST_DFU
+#include "DeviceDrivers/BNO070_Dfu.h"
+#endif
 
 #if defined(OSVRHDK) && defined(HDK_ENABLE_HID_SXS)
 #include "SideBySide.h"
@@ -30,6 +35,8 @@
 #include "USB.h"
 #include <udi_cdc.h>
 
+#include <string.h>
+
 // Make our internal buffer the size of the endpoint buffer for full-speed.
 static const uint8_t RX_BUF_SZ = UDI_CDC_DATA_EPS_FS_SIZE;
 
@@ -118,6 +125,7 @@ static bool my_flag_autorize_generic_events = false;
 bool my_callback_generic_enable(void)
 {
 	my_flag_autorize_generic_events = true;
+	ReportQueue_Flush();  // anything queued was meant for the previous configuration
 	return true;
 }
 void my_callback_generic_disable(void) { my_flag_autorize_generic_events = false; }
@@ -137,12 +145,72 @@ void my_callback_generic_report_out(uint8_t *report)
 		Display_Off(Display1);
 		// The report is correct
 	}
+#ifdef BNO_HOST_DFU
+	else if ((report[0] == 0x71) && (report[1] == 0x26))
+	{
+		BnoDfu_Receive(report);  // BNO070 firmware stream chunk
+	}
+#endif
+}
+void my_callback_generic_report_in_sent(void) { ReportQueue_Sent(); }
+/// Latency histogram page returned by GetFeature: stage in the high nibble, first bucket in the low nibble.
+static uint8_t latency_page = 0;
+/// Command whose state GetFeature returns: 6 for the latency histograms, 12 for the firmware update.
+static uint8_t feature_page = 6;
+
+// GetFeature returns the signature, command 6 and the selected page, then three little-endian 32-bit bucket counts;
+// after command 12 it returns 12, the update state, the bytes written and expected (little-endian 32-bit), the error
+// and the time since the update started (little-endian 16-bit, tenths of a second)
+void my_callback_generic_get_feature(uint8_t *report_feature)
+{
+	LatencyStage_t stage = (LatencyStage_t)(latency_page >> 4);
+	uint8_t bucket = latency_page & 0x0F;
+
+	memset(report_feature, 0, UDI_HID_REPORT_FEATURE_SIZE);
+	report_feature[0] = 0x71;
+	report_feature[1] = 0x25;
+#ifdef BNO_HOST_DFU
+	if (feature_page == 12)
+	{
+		BnoDfu_Status_t status;
+		BnoDfu_GetStatus(&status);
+		report_feature[2] = 12;
+		report_feature[3] = status.state;
+		memcpy(&report_feature[4], &status.written, 4);
+		memcpy(&report_feature[8], &status.expected, 4);
+		report_feature[12] = (uint8_t)status.error;
+		memcpy(&report_feature[13], &status.elapsed, 2);
+		return;
+	}
+#endif
+	report_feature[2] = 6;
+	report_feature[3] = latency_page;
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		uint32_t count = Latency_GetCount(stage, bucket + i);
+		memcpy(&report_feature[4 + 4 * i], &count, 4);
+	}
 }
+
 void my_callback_generic_set_feature(uint8_t *report_feature)
 
 // 0x7125 is signature in first two bytes
-// next byte is version number for report, defaults to 1
-// next byte is "1" to set side-by-side mode, 0 to go to normal mode
+// next byte is the command: 1 = side-by-side, 2 = tracker report version, 3 = prediction horizon,
+// 4 = packed tracker reports, 5 = report queue policy, 6 = select latency histogram page, 7 = reset latency histograms,
+// 8 = raw IMU streaming, 9 = sensor rate, 10 = orientation source, 11 = store sensor settings,
+// 12 = BNO070 firmware update, 13 = hub report capture
+// next byte is the value: for side-by-side, "1" to set side-by-side mode, 0 to go to normal mode;
+// for the report version, 1, 3 or 4 (timestamped), or 0 for the default; for the horizon, milliseconds (0 = off);
+// for packed reports, 1 for 64-byte multi-sample reports, 0 for the 16-byte report;
+// for the queue policy, 0 to send every report in order, 1 to send only the latest;
+// for the histogram page, stage in the high nibble and first bucket in the low nibble, read back with GetFeature;
+// for raw IMU streaming, 1 for 64-byte reports of raw samples, 0 for the 16-byte report;
+// for the sensor rate, the sensor (0 = orientation, 1 = gyro, 2 = accelerometer, 3 = magnetometer, 4 = linear
+// acceleration) followed by the rate in Hz as a little-endian 16-bit value, 0 = off; for the orientation source, 0
+// for the rotation vector, 1 for the game rotation vector, 2 for the geomagnetic rotation vector; for storing, 1 to
+// save the rates and source to EEPROM, 0 to go back to the defaults;
+// for the firmware update, 1 to start taking the DFU stream in 0x7126 OUT reports, 0 to abandon it;
+// for the capture, 1 for 64-byte reports of undecoded hub reports, 0 for the 16-byte report
 {
 	if ((report_feature[0] == 0x71) && (report_feature[1] == 0x25))
 	{
@@ -160,6 +228,62 @@ void my_callback_generic_set_feature(uint8_t *report_feature)
 			}
 #endif
 		}
+#ifdef BNO070
+		else if (report_feature[2] == 2)
+		{
+			SetReportVersion_BNO070(report_feature[3]);
+		}
+#ifdef BNO_POSE_PREDICTION
+		else if (report_feature[2] == 3)
+		{
+			SetPredictionHorizon_BNO070(report_feature[3]);
+		}
+#endif
+		else if (report_feature[2] == 4)
+		{
+			SetPackedReports_BNO070(report_feature[3] != 0);
+		}
+		else if (report_feature[2] == 5)
+		{
+			ReportQueue_SetPolicy(report_feature[3] ? REPORT_QUEUE_LATEST : REPORT_QUEUE_FIFO);
+		}
+		else if (report_feature[2] == 6)
+		{
+			latency_page = report_feature[3];
+			feature_page = 6;
+		}
+		else if (report_feature[2] == 7)
+		{
+			Latency_Reset();
+		}
+		else if (report_feature[2] == 8)
+		{
+			SetRawImu_BNO070(report_feature[3] != 0);
+		}
+		else if (report_feature[2] == 9)
+		{
+			SetSensorRate_BNO070((BNO070_Sensor_t)report_feature[3], report_feature[4] | (report_feature[5] << 8));
+		}
+		else if (report_feature[2] == 10)
+		{
+			SetOrientationSource_BNO070(report_feature[3]);
+		}
+		else if (report_feature[2] == 11)
+		{
+			PersistSensorConfig_BNO070(report_feature[3] != 0);
+		}
+#ifdef BNO_HOST_DFU
+		else if (report_feature[2] == 12)
+		{
+			BnoDfu_Request(report_feature[3] != 0);
+			feature_page = 12;
+		}
+#endif
+		else if (report_feature[2] == 13)
+		{
+			SetCapture_BNO070(report_feature[3] != 0);
+		}
+#endif
 	}
 }
 
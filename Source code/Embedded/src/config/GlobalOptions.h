@@ -123,10 +123,41 @@ extern char Msg[];
 #ifdef BNO070
 //#define MeasurePerformance // if defined, performance is being recorded for BNO work, with some performance impact
 #define BNO_TWI_SPEED 400000  //!< TWI data transfer rate
+
+/// Number of decoded BNO events that can be drained from the hub each time INTN fires.
+/// A depth of 1 reproduces the original one-report-per-yield behavior.
+#ifndef BNO_EVENT_RING_DEPTH
+#define BNO_EVENT_RING_DEPTH 8
+#endif
+
+/// Start the TWI read of each BNO report from the INTN interrupt instead of the main loop.
+#define BNO_ASYNC_READS
+
+/// Read the 2-byte HID length header first and only transfer the rest of each report.
+#define BNO_LENGTH_PREFIXED_READS
+
+/// Allow the host to have orientation extrapolated with the gyro before it is sent (horizon 0, i.e. off, by default).
+#define BNO_POSE_PREDICTION
+
+/// Accept BNO070 firmware updates streamed by the host over HID (see BNO070_Dfu.h).
+#define BNO_HOST_DFU
+
+/// Build tracker reports straight from the I2C buffer into the HID queue slot for orientation and gyro reports,
+/// instead of decoding them into the event ring first, whenever the tracker report is streamed without prediction.
+#define BNO_TRACKER_FAST_PATH
+
+/// Pair each orientation sample with the gyro sample taken at the same time on the BNO (INTN time less the reported
+/// delay), interpolating between gyro samples or briefly holding the orientation back when they do not line up.
+#define BNO_GYRO_PAIRING
 #endif
 
 #define USB_REPORT_SIZE 16
 
+/// Number of tracker report slots, including the one the HID IN endpoint is sending from (power of two).
+#ifndef HID_REPORT_QUEUE_DEPTH
+#define HID_REPORT_QUEUE_DEPTH 8
+#endif
+
 #define MaxCommandLength 20
 
 #if !defined(OSVRHDK) || defined(SVR_HAVE_TMDS422)
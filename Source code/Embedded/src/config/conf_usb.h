@@ -366,6 +366,10 @@ extern void my_callback_generic_disable(void);
 extern void my_callback_generic_report_out(uint8_t *report);
 #define  UDI_HID_GENERIC_SET_FEATURE(f) my_callback_generic_set_feature(f)
 extern void my_callback_generic_set_feature(uint8_t *report_feature);
+#define  UDI_HID_GENERIC_REPORT_IN_SENT() my_callback_generic_report_in_sent()
+extern void my_callback_generic_report_in_sent(void);
+#define  UDI_HID_GENERIC_GET_FEATURE(f) my_callback_generic_get_feature(f)
+extern void my_callback_generic_get_feature(uint8_t *report_feature);
 
 #define  UDI_HID_REPORT_IN_SIZE             USB_REPORT_SIZE
 #define  UDI_HID_REPORT_OUT_SIZE            64
@@ -197,10 +197,25 @@ typedef struct SvrEepromOffset_
 	uint8_t offset;
 } SvrEepromOffset_t;
 
+/**
+ * Offsets of the config values from the start of SVR_EEP_CONFIGURATION_PAGE. They have outgrown that page: from 32 on
+ * they run into the next one, which nothing else uses, so SVR_EEP_CONFIGURATION_PAGES pages are reserved for them.
+ */
+#define SVR_EEP_CONFIGURATION_PAGES 2
 #define PersistenceOffset ((SvrEepromOffset_t){4})         //< Persistence refresh rate
 #define PersistencePercentOffset ((SvrEepromOffset_t){8})  //< Persistence percent
 #define SideBySideOffset ((SvrEepromOffset_t){12})         //< Side-by-side settings
 #define GRVOffset ((SvrEepromOffset_t){16})                //< BNO game rotation vector mode
+#define OrientationRateOffset ((SvrEepromOffset_t){20})    //< BNO orientation rate, 5 Hz steps, 0xFF = default
+#define GyroRateOffset ((SvrEepromOffset_t){24})           //< BNO calibrated gyro rate, as above
+#define AccRateOffset ((SvrEepromOffset_t){28})            //< BNO accelerometer rate, as above
+#define MagRateOffset ((SvrEepromOffset_t){32})            //< BNO magnetometer rate, as above
+#define LinAccRateOffset ((SvrEepromOffset_t){36})         //< BNO linear acceleration rate, as above
+
+/// End of the last config value's block; move it along when adding one.
+#define SVR_CONFIG_END_OFFSET (36 + SVR_CONFIG_BLOCK_SIZE)
+_Static_assert(SVR_CONFIG_END_OFFSET <= SVR_EEP_CONFIGURATION_PAGES * EEPROM_PAGE_SIZE,
+               "The config values no longer fit in the EEPROM pages reserved for them.");
 
 /**
  * Set all values of a memory buffer of size EEPROM_PAGE_SIZE to a given value
@@ -62,6 +62,7 @@
 
 #include "USB.h"
 #include "SvrYield.h"
+#include "SvrClock.h"
 
 /// The HDK 1.x OLED firmware works across lots of hardware versions, so we determine a product string at runtime based
 /// on the BNO firmware version (loaded at the factory).
@@ -102,6 +103,7 @@ int main(void)
 	board_init();
 
 	custom_board_init();  // add initialization that is specific to Sensics board
+	svr_clock_init();     // timestamps for tracker reports
 	// timeout_init(); //- timeouts not working quite yet // todo: activate this
 	cpu_irq_enable();
 